@@ -18,6 +18,7 @@
 #include "random_distribution_factory.hpp"
 
 #include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/bit.hpp>
 
@@ -29,7 +30,10 @@
 #include <rmm/device_vector.hpp>
 
 #include <future>
+#include <list>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <random>
 #include <thread>
 #include <vector>
@@ -91,6 +95,19 @@ size_t avg_element_size<cudf::list_view>(data_profile const& profile)
   return element_size * pow(single_level_mean, dist_params.max_depth);
 }
 
+size_t avg_element_bytes(data_profile const& profile, cudf::type_id tid);
+
+template <>
+size_t avg_element_size<cudf::struct_view>(data_profile const& profile)
+{
+  auto const dist_params = profile.get_distribution_params<cudf::struct_view>();
+  return std::accumulate(
+    dist_params.leaf_types.cbegin(),
+    dist_params.leaf_types.cend(),
+    size_t{0},
+    [&](auto sum, auto type) { return sum + avg_element_bytes(profile, type); });
+}
+
 struct avg_element_size_fn {
   template <typename T>
   size_t operator()(data_profile const& profile)
@@ -225,6 +242,62 @@ auto create_run_length_dist(cudf::size_type avg_run_len)
   return std::gamma_distribution<float>{alpha, avg_run_len / alpha};
 }
 
+/**
+ * @brief Draws the runs of rows of a column: the sample each run copies, and the length of the run.
+ *
+ * Without correlation, the draws come from the column's own engine. Otherwise, the run lengths and
+ * a uniform variate per run come from an engine seeded identically for every column, so that the
+ * columns generated with the same profile line up run by run. A `correlation` fraction of the runs
+ * then picks the sample at the position of the shared variate, which makes these rows equal in
+ * columns with the same cardinality.
+ */
+class run_generator {
+ public:
+  run_generator(data_profile const& profile, std::mt19937& engine, cudf::size_type cardinality)
+    : engine{engine},
+      shared_engine{deterministic_engine(0)},
+      cardinality{cardinality},
+      avg_run_len{profile.get_avg_run_length()},
+      correlation{profile.get_correlation()},
+      sample_dist{0, std::max(cardinality - 1, 0)},
+      correlated_dist{correlation},
+      run_len_dist{create_run_length_dist(avg_run_len)}
+  {
+  }
+
+  /**
+   * @brief Returns the index of the sample of the next run.
+   */
+  cudf::size_type next_sample()
+  {
+    if (correlation == 0) { return sample_dist(engine); }
+    auto const shared_value = unit_dist(shared_engine);
+    if (!correlated_dist(engine)) { return sample_dist(engine); }
+    return std::min(cardinality - 1, static_cast<cudf::size_type>(shared_value * cardinality));
+  }
+
+  /**
+   * @brief Returns the length of the next run, at most `max_length`.
+   */
+  int next_run_length(int max_length)
+  {
+    if (avg_run_len <= 1) { return 1; }
+    auto& run_engine = correlation == 0 ? engine : shared_engine;
+    return std::min<int>(max_length, std::round(run_len_dist(run_engine)));
+  }
+
+ private:
+  std::mt19937& engine;
+  std::mt19937 shared_engine;
+  cudf::size_type const cardinality;
+  cudf::size_type const avg_run_len;
+  double const correlation;
+  std::uniform_int_distribution<cudf::size_type> sample_dist;
+  std::bernoulli_distribution correlated_dist;
+  std::uniform_real_distribution<double> unit_dist{0., 1.};
+  std::gamma_distribution<float> run_len_dist;
+};
+
 // identity mapping, except for bools
 template <typename T, typename Enable = void>
 struct stored_as {
@@ -266,10 +339,7 @@ std::unique_ptr<cudf::column> create_random_column(data_profile const& profile,
       (stored_Type)value_dist(engine), valid_dist(engine), samples, samples_null_mask, si);
   }
 
-  // Distribution for picking elements from the array of samples
-  std::uniform_int_distribution<cudf::size_type> sample_dist{0, cardinality - 1};
-  auto const avg_run_len = profile.get_avg_run_length();
-  auto run_len_dist      = create_run_length_dist(avg_run_len);
+  run_generator runs(profile, engine, cardinality);
   std::vector<stored_Type> data(num_rows);
   std::vector<cudf::bitmask_type> null_mask(null_mask_size(num_rows), ~0);
 
@@ -277,7 +347,7 @@ std::unique_ptr<cudf::column> create_random_column(data_profile const& profile,
     if (cardinality == 0) {
       set_element_at((stored_Type)value_dist(engine), valid_dist(engine), data, null_mask, row);
     } else {
-      auto const sample_idx = sample_dist(engine);
+      auto const sample_idx = runs.next_sample();
       set_element_at(samples[sample_idx],
                      cudf::bit_is_set(samples_null_mask.data(), sample_idx),
                      data,
@@ -285,14 +355,12 @@ std::unique_ptr<cudf::column> create_random_column(data_profile const& profile,
                      row);
     }
 
-    if (avg_run_len > 1) {
-      int const run_len = std::min<int>(num_rows - row, std::round(run_len_dist(engine)));
-      for (int offset = 1; offset < run_len; ++offset) {
-        set_element_at(
-          data[row], cudf::bit_is_set(null_mask.data(), row), data, null_mask, row + offset);
-      }
-      row += std::max(run_len - 1, 0);
+    int const run_len = runs.next_run_length(num_rows - row);
+    for (int offset = 1; offset < run_len; ++offset) {
+      set_element_at(
+        data[row], cudf::bit_is_set(null_mask.data(), row), data, null_mask, row + offset);
     }
+    row += std::max(run_len - 1, 0);
   }
 
   return std::make_unique<cudf::column>(
@@ -393,24 +461,19 @@ std::unique_ptr<cudf::column> create_random_column<cudf::string_view>(data_profi
     append_string(char_dist, valid_dist(engine), len_dist(engine), samples);
   }
 
-  auto const avg_run_len = profile.get_avg_run_length();
-  auto run_len_dist      = create_run_length_dist(avg_run_len);
-
+  run_generator runs(profile, engine, cardinality);
   string_column_data out_col(num_rows, num_rows * avg_string_len);
-  std::uniform_int_distribution<cudf::size_type> sample_dist{0, cardinality - 1};
   for (cudf::size_type row = 0; row < num_rows; ++row) {
     if (cardinality == 0) {
       append_string(char_dist, valid_dist(engine), len_dist(engine), out_col);
     } else {
-      copy_string(sample_dist(engine), samples, row, out_col);
+      copy_string(runs.next_sample(), samples, row, out_col);
     }
-    if (avg_run_len > 1) {
-      int const run_len = std::min<int>(num_rows - row, std::round(run_len_dist(engine)));
-      for (int offset = 1; offset < run_len; ++offset) {
-        copy_string(row, out_col, row + offset, out_col);
-      }
-      row += std::max(run_len - 1, 0);
+    int const run_len = runs.next_run_length(num_rows - row);
+    for (int offset = 1; offset < run_len; ++offset) {
+      copy_string(row, out_col, row + offset, out_col);
     }
+    row += std::max(run_len - 1, 0);
   }
 
   rmm::device_vector<char> d_chars(out_col.chars);
@@ -430,10 +493,7 @@ std::unique_ptr<cudf::column> create_random_column<cudf::dictionary32>(data_prof
 template <>
 std::unique_ptr<cudf::column> create_random_column<cudf::struct_view>(data_profile const& profile,
                                                                       std::mt19937& engine,
-                                                                      cudf::size_type num_rows)
-{
-  CUDF_FAIL("not implemented yet");
-}
+                                                                      cudf::size_type num_rows);
 
 /**
  * @brief Functor to dispatch create_random_column calls.
@@ -510,6 +570,53 @@ std::unique_ptr<cudf::column> create_random_column<cudf::list_view>(data_profile
   return list_column;  // return the top-level column
 }
 
+/**
+ * @brief Creates a struct column with random content.
+ *
+ * The data profile determines the types of the leaf children and the number of nested levels. The
+ * top level struct holds the leaf children, and each additional level wraps the level below as its
+ * only child.
+ *
+ * @param profile Parameters for the random generator
+ * @param engine Pseudo-random engine
+ * @param num_rows Size of the output column
+ *
+ * @return Column filled with random structs
+ */
+template <>
+std::unique_ptr<cudf::column> create_random_column<cudf::struct_view>(data_profile const& profile,
+                                                                      std::mt19937& engine,
+                                                                      cudf::size_type num_rows)
+{
+  auto const dist_params = profile.get_distribution_params<cudf::struct_view>();
+  auto valid_dist        = std::bernoulli_distribution{1. - profile.get_null_frequency()};
+
+  std::vector<std::unique_ptr<cudf::column>> children;
+  for (auto const type : dist_params.leaf_types) {
+    children.push_back(cudf::type_dispatcher(
+      cudf::data_type(type), create_rand_col_fn{}, profile, engine, num_rows));
+  }
+
+  // Generate the struct column bottom-up
+  std::unique_ptr<cudf::column> struct_column;
+  for (int lvl = 0; lvl < dist_params.max_depth; ++lvl) {
+    std::vector<cudf::bitmask_type> null_mask(null_mask_size(num_rows), ~0);
+    for (cudf::size_type row = 0; row < num_rows; ++row) {
+      if (!valid_dist(engine)) cudf::clear_bit_unsafe(null_mask.data(), row);
+    }
+    if (struct_column) { children.push_back(std::move(struct_column)); }
+
+    struct_column = cudf::make_structs_column(
+      num_rows,
+      std::move(children),
+      cudf::UNKNOWN_NULL_COUNT,
+      rmm::device_buffer(
+        null_mask.data(), null_mask.size() * sizeof(cudf::bitmask_type), rmm::cuda_stream_default));
+    children.clear();
+  }
+  return struct_column;  // return the top-level column
+}
+
 using columns_vector = std::vector<std::unique_ptr<cudf::column>>;
 
 /**
@@ -551,6 +658,103 @@ std::vector<cudf::type_id> repeat_dtypes(std::vector<cudf::type_id> const& dtype
   return out_dtypes;
 }
 
+bool operator==(data_profile const& lhs, data_profile const& rhs)
+{
+  return lhs.int_params == rhs.int_params && lhs.float_params == rhs.float_params &&
+         lhs.string_dist_desc == rhs.string_dist_desc && lhs.list_dist_desc == rhs.list_dist_desc &&
+         lhs.struct_dist_desc == rhs.struct_dist_desc &&
+         lhs.bool_probability == rhs.bool_probability &&
+         lhs.null_frequency == rhs.null_frequency && lhs.cardinality == rhs.cardinality &&
+         lhs.avg_run_length == rhs.avg_run_length && lhs.correlation == rhs.correlation;
+}
+
+namespace {
+
+/**
+ * @brief Host copies of the most recently generated tables, so that the benchmark cases that
+ * request the same data skip its generation.
+ *
+ * The copies are kept in host memory because the benchmark fixture replaces the device memory
+ * resource in each benchmark case. The least recently used tables are evicted once the copies
+ * exceed `max_bytes`.
+ */
+class generated_table_cache {
+ public:
+  static constexpr size_t max_bytes = size_t{4} << 30;
+
+  std::unique_ptr<cudf::table> find(std::vector<cudf::type_id> const& dtype_ids,
+                                    cudf::size_type num_rows,
+                                    data_profile const& profile,
+                                    unsigned seed)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto const it = std::find_if(entries.begin(), entries.end(), [&](auto const& entry) {
+      return entry.seed == seed && entry.num_rows == num_rows && entry.dtype_ids == dtype_ids &&
+             entry.profile == profile;
+    });
+    if (it == entries.end()) { return nullptr; }
+    entries.splice(entries.end(), entries, it);  // the most recently used tables are last
+
+    rmm::device_buffer gpu_data(it->gpu_data.data(), it->gpu_data.size(), rmm::cuda_stream_default);
+    auto const view =
+      cudf::unpack(it->metadata.data(), static_cast<uint8_t const*>(gpu_data.data()));
+    return std::make_unique<cudf::table>(view);
+  }
+
+  void insert(std::vector<cudf::type_id> const& dtype_ids,
+              cudf::size_type num_rows,
+              data_profile const& profile,
+              unsigned seed,
+              cudf::table_view const& table)
+  {
+    if (table.num_columns() == 0 || table.num_rows() == 0) { return; }
+    auto const packed = cudf::pack(table);
+    auto const bytes  = packed.metadata_->size() + packed.gpu_data->size();
+    if (bytes > max_bytes) { return; }
+
+    entry new_entry{dtype_ids,
+                    num_rows,
+                    profile,
+                    seed,
+                    {packed.metadata_->data(), packed.metadata_->data() + packed.metadata_->size()},
+                    std::vector<uint8_t>(packed.gpu_data->size())};
+    CUDA_TRY(cudaMemcpy(new_entry.gpu_data.data(),
+                        packed.gpu_data->data(),
+                        packed.gpu_data->size(),
+                        cudaMemcpyDeviceToHost));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.push_back(std::move(new_entry));
+    cached_bytes += bytes;
+    while (cached_bytes > max_bytes) {
+      cached_bytes -= entries.front().metadata.size() + entries.front().gpu_data.size();
+      entries.pop_front();
+    }
+  }
+
+ private:
+  struct entry {
+    std::vector<cudf::type_id> dtype_ids;
+    cudf::size_type num_rows;
+    data_profile profile;
+    unsigned seed;
+    std::vector<uint8_t> metadata;  // `cudf::pack` metadata
+    std::vector<uint8_t> gpu_data;  // host copy of the `cudf::pack` device data
+  };
+
+  std::mutex mutex;
+  std::list<entry> entries;
+  size_t cached_bytes = 0;
+};
+
+generated_table_cache& table_cache()
+{
+  static generated_table_cache cache;
+  return cache;
+}
+
+}  // namespace
+
 std::unique_ptr<cudf::table> create_random_table(std::vector<cudf::type_id> const& dtype_ids,
                                                  cudf::size_type num_cols,
                                                  table_size_bytes table_bytes,
@@ -574,7 +778,10 @@ std::unique_ptr<cudf::table> create_random_table(std::vector<cudf::type_id> cons
                                                  unsigned seed)
 {
   auto const out_dtype_ids = repeat_dtypes(dtype_ids, num_cols);
-  auto seed_engine         = deterministic_engine(seed);
+  if (auto cached = table_cache().find(out_dtype_ids, num_rows.count, profile, seed)) {
+    return cached;
+  }
+  auto seed_engine = deterministic_engine(seed);
 
   auto const processor_count            = std::thread::hardware_concurrency();
   cudf::size_type const cols_per_thread = (num_cols + processor_count - 1) / processor_count;
@@ -605,7 +812,9 @@ std::unique_ptr<cudf::table> create_random_table(std::vector<cudf::type_id> cons
     partial_table.clear();
   }
 
-  return std::make_unique<cudf::table>(std::move(output_columns));
+  auto output = std::make_unique<cudf::table>(std::move(output_columns));
+  table_cache().insert(out_dtype_ids, num_rows.count, profile, seed, output->view());
+  return output;
 }
 
 std::vector<cudf::type_id> get_type_or_group(int32_t id)
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <map>
 
 #include <cudf/table/table.hpp>
@@ -32,6 +33,9 @@
  *
  * Currently, the data generation is done on the CPU and the data is then copied to the device
  * memory.
+ *
+ * The most recently generated tables are cached in host memory, so that the benchmark cases that
+ * request the same table only copy it to the device.
  */
 
 /**
@@ -174,6 +178,53 @@ struct distribution_params<T, typename std::enable_if_t<std::is_same<T, cudf::li
   cudf::size_type max_depth;
 };
 
+/**
+ * @brief Structs are parameterized by the types of their leaf children and the nesting level.
+ */
+template <typename T>
+struct distribution_params<T,
+                           typename std::enable_if_t<std::is_same<T, cudf::struct_view>::value>> {
+  std::vector<cudf::type_id> leaf_types;
+  cudf::size_type max_depth;
+};
+
+/**
+ * @brief Distribution parameters are equal when all of their parameters are equal.
+ */
+template <typename T,
+          std::enable_if_t<!std::is_same<T, bool>::value &&
+                           (cudf::is_numeric<T>() || cudf::is_chrono<T>())>* = nullptr>
+bool operator==(distribution_params<T> const& lhs, distribution_params<T> const& rhs)
+{
+  return lhs.id == rhs.id && lhs.lower_bound == rhs.lower_bound &&
+         lhs.upper_bound == rhs.upper_bound;
+}
+
+template <typename T, std::enable_if_t<std::is_same<T, bool>::value>* = nullptr>
+bool operator==(distribution_params<T> const& lhs, distribution_params<T> const& rhs)
+{
+  return lhs.probability_true == rhs.probability_true;
+}
+
+template <typename T, std::enable_if_t<std::is_same<T, cudf::string_view>::value>* = nullptr>
+bool operator==(distribution_params<T> const& lhs, distribution_params<T> const& rhs)
+{
+  return lhs.length_params == rhs.length_params;
+}
+
+template <typename T, std::enable_if_t<std::is_same<T, cudf::list_view>::value>* = nullptr>
+bool operator==(distribution_params<T> const& lhs, distribution_params<T> const& rhs)
+{
+  return lhs.element_type == rhs.element_type && lhs.length_params == rhs.length_params &&
+         lhs.max_depth == rhs.max_depth;
+}
+
+template <typename T, std::enable_if_t<std::is_same<T, cudf::struct_view>::value>* = nullptr>
+bool operator==(distribution_params<T> const& lhs, distribution_params<T> const& rhs)
+{
+  return lhs.leaf_types == rhs.leaf_types && lhs.max_depth == rhs.max_depth;
+}
+
 // Present for compilation only. To be implemented once reader/writers support the fixed width type.
 template <typename T>
 struct distribution_params<T, typename std::enable_if_t<cudf::is_fixed_point<T>()>> {
@@ -217,11 +268,14 @@ class data_profile {
   distribution_params<cudf::string_view> string_dist_desc{{distribution_id::NORMAL, 0, 32}};
   distribution_params<cudf::list_view> list_dist_desc{
     cudf::type_id::INT32, {distribution_id::GEOMETRIC, 0, 100}, 2};
+  distribution_params<cudf::struct_view> struct_dist_desc{
+    {cudf::type_id::INT32, cudf::type_id::FLOAT32, cudf::type_id::STRING}, 2};
 
   double bool_probability        = 0.5;
   double null_frequency          = 0.01;
   cudf::size_type cardinality    = 2000;
   cudf::size_type avg_run_length = 4;
+  double correlation             = 0.0;
 
  public:
   template <typename T,
@@ -284,6 +338,12 @@ class data_profile {
     return list_dist_desc;
   }
 
+  template <typename T, std::enable_if_t<std::is_same<T, cudf::struct_view>::value>* = nullptr>
+  distribution_params<T> get_distribution_params() const
+  {
+    return struct_dist_desc;
+  }
+
   template <typename T, typename std::enable_if_t<cudf::is_fixed_point<T>()>* = nullptr>
   distribution_params<T> get_distribution_params() const
   {
@@ -294,6 +354,7 @@ class data_profile {
   auto get_null_frequency() const { return null_frequency; };
   auto get_cardinality() const { return cardinality; };
   auto get_avg_run_length() const { return avg_run_length; };
+  auto get_correlation() const { return correlation; };
 
   // Users should pass integral values for bounds when setting the parameters for types that have
   // discrete distributions (integers, strings, lists). Otherwise the call with have no effect.
@@ -340,8 +401,33 @@ class data_profile {
   void set_cardinality(cudf::size_type c) { cardinality = c; }
   void set_avg_run_length(cudf::size_type avg_rl) { avg_run_length = avg_rl; }
 
+  /**
+   * @brief Sets the fraction of the rows, in runs, that take the same sample in all columns of a
+   * table with the same cardinality.
+   *
+   * Correlated columns model dependent attributes, such as a city and its zip code. The run
+   * lengths of all columns are the same when the correlation is non-zero.
+   */
+  void set_correlation(double c)
+  {
+    CUDF_EXPECTS(c >= 0. && c <= 1., "Correlation must be between 0 and 1");
+    correlation = c;
+  }
+
   void set_list_depth(cudf::size_type max_depth) { list_dist_desc.max_depth = max_depth; }
   void set_list_type(cudf::type_id type) { list_dist_desc.element_type = type; }
+
+  void set_struct_depth(cudf::size_type max_depth) { struct_dist_desc.max_depth = max_depth; }
+  void set_struct_types(std::vector<cudf::type_id> const& types)
+  {
+    CUDF_EXPECTS(
+      std::none_of(
+        types.cbegin(), types.cend(), [](auto& type) { return type == cudf::type_id::STRUCT; }),
+      "Cannot include STRUCT as its own subtype");
+    struct_dist_desc.leaf_types = types;
+  }
+
+  friend bool operator==(data_profile const& lhs, data_profile const& rhs);
 };
 
 /**
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+class Concurrency : public cudf::benchmark {
+};
+
+enum class operation { read_parquet, inner_join, groupby };
+
+namespace {
+
+/**
+ * @brief The inputs of one operation. Each thread has its own, so that the threads share no data.
+ */
+struct operation_inputs {
+  std::unique_ptr<cudf::table> left;   // INT32 keys and INT64 values
+  std::unique_ptr<cudf::table> right;  // INT32 keys
+  std::vector<char> parquet;           // `left` written to Parquet
+};
+
+operation_inputs make_inputs(operation op, cudf::size_type num_rows, unsigned seed)
+{
+  data_profile profile;
+  profile.set_cardinality(0);
+  profile.set_avg_run_length(1);
+  profile.set_null_frequency(0.0);
+  profile.set_distribution_params(
+    cudf::type_id::INT32, distribution_id::UNIFORM, 0, std::max(num_rows / 4, 1));
+
+  operation_inputs inputs;
+  inputs.left = create_random_table(
+    {cudf::type_id::INT32, cudf::type_id::INT64}, 2, row_count{num_rows}, profile, seed);
+  switch (op) {
+    case operation::read_parquet: {
+      auto const options = cudf::io::parquet_writer_options::builder(
+                             cudf::io::sink_info{&inputs.parquet}, inputs.left->view())
+                             .build();
+      cudf::io::write_parquet(options);
+    } break;
+    case operation::inner_join:
+      inputs.right =
+        create_random_table({cudf::type_id::INT32}, 1, row_count{num_rows}, profile, seed + 1);
+      break;
+    case operation::groupby: break;
+  }
+  return inputs;
+}
+
+/**
+ * @brief Runs the operation on the default stream of the calling thread, and waits for it.
+ */
+void run_operation(operation op, operation_inputs const& inputs)
+{
+  switch (op) {
+    case operation::read_parquet: {
+      auto const options = cudf::io::parquet_reader_options::builder(
+                             cudf::io::source_info{inputs.parquet.data(), inputs.parquet.size()})
+                             .build();
+      cudf::io::read_parquet(options);
+    } break;
+    case operation::inner_join:
+      cudf::inner_join(inputs.left->select({0}), inputs.right->view());
+      break;
+    case operation::groupby: {
+      cudf::groupby::groupby groupby{inputs.left->select({0})};
+      std::vector<cudf::groupby::aggregation_request> requests(1);
+      requests[0].values = inputs.left->get_column(1).view();
+      requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+      groupby.aggregate(requests);
+    } break;
+  }
+  rmm::cuda_stream_default.synchronize();
+}
+
+/**
+ * @brief Returns the wall time in seconds of running the operation once on each of the first
+ * `num_threads` inputs, each on its own thread.
+ */
+double run_concurrently(operation op, std::vector<operation_inputs> const& inputs, int num_threads)
+{
+  auto const start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_threads; ++i) {
+    threads.emplace_back([op, &inputs, i]() { run_operation(op, inputs[i]); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+}  // namespace
+
+/**
+ * @brief Runs `state.range(0)` instances of the operation concurrently, each on its own thread.
+ *
+ * With per-thread default streams (built with `PER_THREAD_DEFAULT_STREAM=ON`), each thread issues
+ * its work to its own stream. The `scaling_efficiency` counter is the time of one operation run
+ * alone times the number of threads, divided by the time of the concurrent runs: 1 when the
+ * threads do not slow each other down, and 1 / the number of threads when they are serialized.
+ * A synchronization of the whole device or of the legacy default stream, or a lock held during
+ * GPU work, shows up as a drop of the efficiency.
+ */
+void BM_concurrent(benchmark::State& state, operation op)
+{
+  auto const num_threads = static_cast<int>(state.range(0));
+  auto const num_rows    = static_cast<cudf::size_type>(state.range(1));
+
+  std::vector<operation_inputs> inputs;
+  for (int i = 0; i < num_threads; ++i) {
+    inputs.push_back(make_inputs(op, num_rows, i + 1));
+  }
+
+  // the time of one operation without contention, after a warm-up run
+  run_operation(op, inputs.front());
+  constexpr int baseline_runs = 3;
+  double baseline_time        = 0;
+  for (int i = 0; i < baseline_runs; ++i) {
+    baseline_time += run_concurrently(op, inputs, 1);
+  }
+  baseline_time /= baseline_runs;
+
+  double total_time = 0;
+  for (auto _ : state) {
+    auto const elapsed = run_concurrently(op, inputs, num_threads);
+    state.SetIterationTime(elapsed);
+    total_time += elapsed;
+  }
+
+  auto const concurrent_time = total_time / state.iterations();
+
+  state.counters["scaling_efficiency"] = baseline_time * num_threads / concurrent_time;
+  state.SetItemsProcessed(state.iterations() * num_threads);
+  state.SetLabel(cudf::is_ptds_enabled() ? "per-thread default stream" : "legacy default stream");
+}
+
+#define CONCURRENCY_BENCHMARK_DEFINE(name)                              \
+  BENCHMARK_DEFINE_F(Concurrency, name)                                 \
+  (::benchmark::State & st) { BM_concurrent(st, operation::name); }     \
+  BENCHMARK_REGISTER_F(Concurrency, name)                               \
+    ->ArgsProduct({{1, 2, 4, 8, 16}, {100'000, 1'000'000, 10'000'000}}) \
+    ->UseManualTime()                                                   \
+    ->Unit(benchmark::kMillisecond);
+
+CONCURRENCY_BENCHMARK_DEFINE(read_parquet)
+CONCURRENCY_BENCHMARK_DEFINE(inner_join)
+CONCURRENCY_BENCHMARK_DEFINE(groupby)
@@ -19,6 +19,7 @@
 #include <rmm/mr/device/owning_wrapper.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/mr/device/pool_memory_resource.hpp>
+#include <rmm/mr/device/statistics_resource_adaptor.hpp>
 
 namespace cudf {
 
@@ -30,6 +31,11 @@ inline auto make_pool()
 {
   return rmm::mr::make_owning_wrapper<rmm::mr::pool_memory_resource>(make_cuda());
 }
+
+inline auto make_statistics(std::shared_ptr<rmm::mr::device_memory_resource> upstream)
+{
+  return rmm::mr::make_owning_wrapper<rmm::mr::statistics_resource_adaptor>(upstream);
+}
 }  // namespace
 
 /**
@@ -44,6 +50,12 @@ inline auto make_pool()
  * and finalize it, respectively. These methods are called automatically by
  * Google Benchmark
  *
+ * The allocations from the pool are tracked, and TearDown reports them in the
+ * counters of every benchmark, including those made to set up its input:
+ *  - `peak_memory_bytes`: the peak of the memory allocated at once
+ *  - `allocated_bytes`: the bytes allocated per iteration
+ *  - `allocations`: the number of allocations per iteration
+ *
  * Example:
  *
  * template <class T>
@@ -67,7 +79,9 @@ class benchmark : public ::benchmark::Fixture {
  public:
   virtual void SetUp(const ::benchmark::State& state)
   {
-    mr = make_pool();
+    auto statistics_mr = make_statistics(make_pool());
+    stats              = &statistics_mr->wrapped();
+    mr                 = statistics_mr;
     rmm::mr::set_current_device_resource(mr.get());  // set default resource to pool
   }
 
@@ -75,6 +89,7 @@ class benchmark : public ::benchmark::Fixture {
   {
     // reset default resource to the initial resource
     rmm::mr::set_current_device_resource(nullptr);
+    stats = nullptr;
     mr.reset();
   }
 
@@ -82,10 +97,21 @@ class benchmark : public ::benchmark::Fixture {
   virtual void SetUp(::benchmark::State& st) { SetUp(const_cast<const ::benchmark::State&>(st)); }
   virtual void TearDown(::benchmark::State& st)
   {
+    if (stats != nullptr) {
+      auto const bytes                 = stats->get_bytes_counter();
+      auto const allocations           = stats->get_allocations_counter();
+      st.counters["peak_memory_bytes"] = ::benchmark::Counter(bytes.peak);
+      st.counters["allocated_bytes"] =
+        ::benchmark::Counter(bytes.total, ::benchmark::Counter::kAvgIterations);
+      st.counters["allocations"] =
+        ::benchmark::Counter(allocations.total, ::benchmark::Counter::kAvgIterations);
+    }
     TearDown(const_cast<const ::benchmark::State&>(st));
   }
 
   std::shared_ptr<rmm::mr::device_memory_resource> mr;
+  // tracks the allocations from `mr`, which owns it
+  rmm::mr::statistics_resource_adaptor<rmm::mr::device_memory_resource>* stats{};
 };
 
 }  // namespace cudf
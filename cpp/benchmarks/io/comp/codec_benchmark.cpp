@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <io/comp/gpuinflate.h>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+#include <vector>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+constexpr size_t data_size = 256 << 20;
+
+using cudf::io::gpu_inflate_input_s;
+using cudf::io::gpu_inflate_status_s;
+
+class Codec : public cudf::benchmark {
+};
+
+enum class codec { snappy, deflate, zstd };
+
+namespace {
+
+/**
+ * @brief Returns `data_size` bytes of the columns of the given type, with the cardinality and run
+ * length that make the data compress about as well as typical cuIO pages.
+ */
+rmm::device_buffer make_uncompressed_data(int32_t type_or_group)
+{
+  data_profile profile;
+  profile.set_cardinality(1000);
+  profile.set_avg_run_length(32);
+  auto const data_types = get_type_or_group(type_or_group);
+  auto const tbl =
+    create_random_table(data_types, data_types.size(), table_size_bytes{data_size}, profile);
+  return std::move(*cudf::pack(tbl->view()).gpu_data);
+}
+
+/**
+ * @brief Splits `src` into blocks of `block_size` bytes, each to be written to its own slot of
+ * `slot_size` bytes of `dst`.
+ */
+std::vector<gpu_inflate_input_s> make_blocks(void const* src,
+                                             size_t src_size,
+                                             size_t block_size,
+                                             void* dst,
+                                             size_t slot_size)
+{
+  std::vector<gpu_inflate_input_s> blocks((src_size + block_size - 1) / block_size);
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    auto const offset   = i * block_size;
+    blocks[i].srcDevice = static_cast<uint8_t const*>(src) + offset;
+    blocks[i].srcSize   = std::min(block_size, src_size - offset);
+    blocks[i].dstDevice = static_cast<uint8_t*>(dst) + i * slot_size;
+    blocks[i].dstSize   = slot_size;
+  }
+  return blocks;
+}
+
+void compress(codec c,
+              rmm::device_uvector<gpu_inflate_input_s>& inputs,
+              rmm::device_uvector<gpu_inflate_status_s>& statuses)
+{
+  auto const count = static_cast<int>(inputs.size());
+  switch (c) {
+    case codec::snappy:
+      CUDA_TRY(cudf::io::gpu_snap(inputs.data(), statuses.data(), count, inputs.stream()));
+      break;
+    case codec::deflate:
+      CUDA_TRY(cudf::io::gpu_deflate(inputs.data(), statuses.data(), count, 0, inputs.stream()));
+      break;
+    case codec::zstd:
+      CUDA_TRY(cudf::io::gpu_zstd(inputs.data(), statuses.data(), count, inputs.stream()));
+      break;
+  }
+}
+
+void decompress(codec c,
+                rmm::device_uvector<gpu_inflate_input_s>& inputs,
+                rmm::device_uvector<gpu_inflate_status_s>& statuses)
+{
+  auto const count = static_cast<int>(inputs.size());
+  switch (c) {
+    case codec::snappy:
+      CUDA_TRY(cudf::io::gpu_unsnap(inputs.data(), statuses.data(), count, inputs.stream()));
+      break;
+    case codec::deflate:
+      CUDA_TRY(cudf::io::gpuinflate(inputs.data(), statuses.data(), count, 0, inputs.stream()));
+      break;
+    case codec::zstd:
+      CUDA_TRY(cudf::io::gpu_unzstd(inputs.data(), statuses.data(), count, inputs.stream()));
+      break;
+  }
+}
+
+/**
+ * @brief Checks that all blocks were (de)compressed and returns the total size of the output.
+ */
+size_t output_size(std::vector<gpu_inflate_status_s> const& statuses)
+{
+  size_t total = 0;
+  for (auto const& status : statuses) {
+    CUDF_EXPECTS(status.status == 0, "Failed to process a block");
+    total += status.bytes_written;
+  }
+  return total;
+}
+
+}  // namespace
+
+/**
+ * @brief Benchmarks the compression or the decompression of independent blocks with a cuIO codec.
+ *
+ * The bytes processed are the uncompressed bytes in both directions, and the `compression_ratio`
+ * counter is the uncompressed size over the compressed size.
+ */
+void BM_codec(benchmark::State& state, codec c, bool is_decompression)
+{
+  auto const type_or_group = static_cast<int32_t>(state.range(0));
+  auto const block_size    = static_cast<size_t>(state.range(1));
+  auto const stream        = rmm::cuda_stream_default;
+
+  auto const uncompressed = make_uncompressed_data(type_or_group);
+  // each block is compressed into its own slot, large enough for any expansion by the codec
+  auto const num_blocks = (uncompressed.size() + block_size - 1) / block_size;
+  auto const slot_size  = block_size + (block_size >> 7) + 32;
+  rmm::device_buffer compressed(num_blocks * slot_size, stream);
+  auto const h_compress_inputs = make_blocks(
+    uncompressed.data(), uncompressed.size(), block_size, compressed.data(), slot_size);
+
+  auto compress_inputs = cudf::detail::make_device_uvector_async(h_compress_inputs, stream);
+  rmm::device_uvector<gpu_inflate_status_s> compress_statuses(num_blocks, stream);
+  compress(c, compress_inputs, compress_statuses);
+  auto const h_compress_statuses = cudf::detail::make_std_vector_sync(compress_statuses, stream);
+  auto const compressed_size     = output_size(h_compress_statuses);
+
+  // decompress each slot back into its place in the uncompressed layout
+  rmm::device_buffer decompressed(uncompressed.size(), stream);
+  std::vector<gpu_inflate_input_s> h_decompress_inputs(num_blocks);
+  for (size_t i = 0; i < num_blocks; ++i) {
+    h_decompress_inputs[i] = {h_compress_inputs[i].dstDevice,
+                              h_compress_statuses[i].bytes_written,
+                              static_cast<uint8_t*>(decompressed.data()) + i * block_size,
+                              h_compress_inputs[i].srcSize};
+  }
+  auto decompress_inputs = cudf::detail::make_device_uvector_async(h_decompress_inputs, stream);
+  rmm::device_uvector<gpu_inflate_status_s> decompress_statuses(num_blocks, stream);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true, stream);
+    if (is_decompression) {
+      decompress(c, decompress_inputs, decompress_statuses);
+    } else {
+      compress(c, compress_inputs, compress_statuses);
+    }
+  }
+
+  if (is_decompression) {
+    auto const h_statuses = cudf::detail::make_std_vector_sync(decompress_statuses, stream);
+    CUDF_EXPECTS(output_size(h_statuses) == uncompressed.size(),
+                 "Decompressed size does not match the input");
+  }
+  state.SetBytesProcessed(uncompressed.size() * state.iterations());
+  state.counters["compression_ratio"] = static_cast<double>(uncompressed.size()) / compressed_size;
+}
+
+#define CODEC_BENCHMARK_DEFINE(name, c, is_decompression)                       \
+  BENCHMARK_DEFINE_F(Codec, name)                                               \
+  (::benchmark::State & state) { BM_codec(state, codec::c, is_decompression); } \
+  BENCHMARK_REGISTER_F(Codec, name)                                             \
+    ->ArgsProduct({{int32_t(type_group_id::INTEGRAL),                           \
+                    int32_t(type_group_id::FLOATING_POINT),                     \
+                    int32_t(cudf::type_id::STRING)},                            \
+                   {64 << 10, 256 << 10}})                                      \
+    ->Unit(benchmark::kMillisecond)                                             \
+    ->UseManualTime();
+
+CODEC_BENCHMARK_DEFINE(snappy_compress, snappy, false)
+CODEC_BENCHMARK_DEFINE(snappy_decompress, snappy, true)
+CODEC_BENCHMARK_DEFINE(deflate_compress, deflate, false)
+CODEC_BENCHMARK_DEFINE(deflate_decompress, deflate, true)
+CODEC_BENCHMARK_DEFINE(zstd_compress, zstd, false)
+CODEC_BENCHMARK_DEFINE(zstd_decompress, zstd, true)
@@ -16,6 +16,7 @@
 
 #include <benchmarks/io/cuio_benchmark_common.hpp>
 
+#include <cstdlib>
 #include <numeric>
 #include <string>
 
@@ -60,6 +61,13 @@ cudf_io::sink_info cuio_source_sink_pair::make_sink_info()
   }
 }
 
+std::string io_type_label(io_type type)
+{
+  if (type != io_type::FILEPATH) { return ""; }
+  auto const policy = std::getenv("LIBCUDF_CUFILE_POLICY");
+  return std::string("cufile_policy=") + (policy == nullptr ? "OFF" : policy);
+}
+
 std::vector<cudf::type_id> dtypes_for_column_selection(std::vector<cudf::type_id> const& data_types,
                                                        column_selection col_sel)
 {
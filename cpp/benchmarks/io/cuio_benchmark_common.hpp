@@ -72,6 +72,17 @@ class cuio_source_sink_pair {
   std::string const file_name;
 };
 
+/**
+ * @brief Returns the label of a benchmark that reads from or writes to the given type of source or
+ * sink.
+ *
+ * cuIO reads and writes files through cuFile or through the host, as set by the
+ * `LIBCUDF_CUFILE_POLICY` environment variable when the first file is opened. Labeling the
+ * file benchmarks with the policy lets runs with `LIBCUDF_CUFILE_POLICY=OFF` and
+ * `LIBCUDF_CUFILE_POLICY=GDS` be compared side by side.
+ */
+std::string io_type_label(io_type type);
+
 /**
  * @brief Column selection strategy.
  */
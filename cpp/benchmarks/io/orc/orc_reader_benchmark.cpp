@@ -38,9 +38,8 @@ void BM_orc_read_varying_input(benchmark::State& state)
   auto const data_types             = get_type_or_group(state.range(0));
   cudf::size_type const cardinality = state.range(1);
   cudf::size_type const run_length  = state.range(2);
-  cudf_io::compression_type const compression =
-    state.range(3) ? cudf_io::compression_type::SNAPPY : cudf_io::compression_type::NONE;
-  io_type const source_type = static_cast<io_type>(state.range(4));
+  auto const compression            = static_cast<cudf_io::compression_type>(state.range(3));
+  io_type const source_type         = static_cast<io_type>(state.range(4));
 
   data_profile table_data_profile;
   table_data_profile.set_cardinality(cardinality);
@@ -63,6 +62,7 @@ void BM_orc_read_varying_input(benchmark::State& state)
     cudf_io::read_orc(read_opts);
   }
 
+  state.SetLabel(io_type_label(source_type));
   state.SetBytesProcessed(data_size * state.iterations());
 }
 
@@ -143,12 +143,17 @@ void BM_orc_read_varying_options(benchmark::State& state)
   state.SetBytesProcessed(data_processed * state.iterations());
 }
 
-#define ORC_RD_BM_INPUTS_DEFINE(name, type_or_group, src_type)                               \
-  BENCHMARK_DEFINE_F(OrcRead, name)                                                          \
-  (::benchmark::State & state) { BM_orc_read_varying_input(state); }                         \
-  BENCHMARK_REGISTER_F(OrcRead, name)                                                        \
-    ->ArgsProduct({{int32_t(type_or_group)}, {0, 1000}, {1, 32}, {true, false}, {src_type}}) \
-    ->Unit(benchmark::kMillisecond)                                                          \
+#define ORC_RD_BM_INPUTS_DEFINE(name, type_or_group, src_type)       \
+  BENCHMARK_DEFINE_F(OrcRead, name)                                  \
+  (::benchmark::State & state) { BM_orc_read_varying_input(state); } \
+  BENCHMARK_REGISTER_F(OrcRead, name)                                \
+    ->ArgsProduct({{int32_t(type_or_group)},                         \
+                   {0, 1000},                                        \
+                   {1, 32},                                          \
+                   {int32_t(cudf_io::compression_type::SNAPPY),      \
+                    int32_t(cudf_io::compression_type::NONE)},       \
+                   {src_type}})                                      \
+    ->Unit(benchmark::kMillisecond)                                  \
     ->UseManualTime();
 
 RD_BENCHMARK_DEFINE_ALL_SOURCES(ORC_RD_BM_INPUTS_DEFINE, integral, type_group_id::INTEGRAL_SIGNED);
@@ -156,6 +161,21 @@ RD_BENCHMARK_DEFINE_ALL_SOURCES(ORC_RD_BM_INPUTS_DEFINE, floats, type_group_id::
 RD_BENCHMARK_DEFINE_ALL_SOURCES(ORC_RD_BM_INPUTS_DEFINE, timestamps, type_group_id::TIMESTAMP);
 RD_BENCHMARK_DEFINE_ALL_SOURCES(ORC_RD_BM_INPUTS_DEFINE, string, cudf::type_id::STRING);
 
+// throughput of each codec, on data that compresses well
+BENCHMARK_DEFINE_F(OrcRead, codecs)
+(::benchmark::State& state) { BM_orc_read_varying_input(state); }
+BENCHMARK_REGISTER_F(OrcRead, codecs)
+  ->ArgsProduct({{int32_t(type_group_id::INTEGRAL_SIGNED), int32_t(cudf::type_id::STRING)},
+                 {1000},
+                 {32},
+                 {int32_t(cudf_io::compression_type::NONE),
+                  int32_t(cudf_io::compression_type::SNAPPY),
+                  int32_t(cudf_io::compression_type::ZLIB),
+                  int32_t(cudf_io::compression_type::ZSTD)},
+                 {int32_t(io_type::HOST_BUFFER)}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
+
 BENCHMARK_DEFINE_F(OrcRead, column_selection)
 (::benchmark::State& state) { BM_orc_read_varying_options(state); }
 BENCHMARK_REGISTER_F(OrcRead, column_selection)
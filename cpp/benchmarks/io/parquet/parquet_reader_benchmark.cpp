@@ -38,9 +38,8 @@ void BM_parq_read_varying_input(benchmark::State& state)
   auto const data_types             = get_type_or_group(state.range(0));
   cudf::size_type const cardinality = state.range(1);
   cudf::size_type const run_length  = state.range(2);
-  cudf_io::compression_type const compression =
-    state.range(3) ? cudf_io::compression_type::SNAPPY : cudf_io::compression_type::NONE;
-  io_type const source_type = static_cast<io_type>(state.range(4));
+  auto const compression            = static_cast<cudf_io::compression_type>(state.range(3));
+  io_type const source_type         = static_cast<io_type>(state.range(4));
 
   data_profile table_data_profile;
   table_data_profile.set_cardinality(cardinality);
@@ -63,6 +62,7 @@ void BM_parq_read_varying_input(benchmark::State& state)
     cudf_io::read_parquet(read_opts);
   }
 
+  state.SetLabel(io_type_label(source_type));
   state.SetBytesProcessed(data_size * state.iterations());
 }
 
@@ -145,12 +145,17 @@ void BM_parq_read_varying_options(benchmark::State& state)
   state.SetBytesProcessed(data_processed * state.iterations());
 }
 
-#define PARQ_RD_BM_INPUTS_DEFINE(name, type_or_group, src_type)                              \
-  BENCHMARK_DEFINE_F(ParquetRead, name)                                                      \
-  (::benchmark::State & state) { BM_parq_read_varying_input(state); }                        \
-  BENCHMARK_REGISTER_F(ParquetRead, name)                                                    \
-    ->ArgsProduct({{int32_t(type_or_group)}, {0, 1000}, {1, 32}, {true, false}, {src_type}}) \
-    ->Unit(benchmark::kMillisecond)                                                          \
+#define PARQ_RD_BM_INPUTS_DEFINE(name, type_or_group, src_type)       \
+  BENCHMARK_DEFINE_F(ParquetRead, name)                               \
+  (::benchmark::State & state) { BM_parq_read_varying_input(state); } \
+  BENCHMARK_REGISTER_F(ParquetRead, name)                             \
+    ->ArgsProduct({{int32_t(type_or_group)},                          \
+                   {0, 1000},                                         \
+                   {1, 32},                                           \
+                   {int32_t(cudf_io::compression_type::SNAPPY),       \
+                    int32_t(cudf_io::compression_type::NONE)},        \
+                   {src_type}})                                       \
+    ->Unit(benchmark::kMillisecond)                                   \
     ->UseManualTime();
 
 RD_BENCHMARK_DEFINE_ALL_SOURCES(PARQ_RD_BM_INPUTS_DEFINE, integral, type_group_id::INTEGRAL);
@@ -158,6 +163,22 @@ RD_BENCHMARK_DEFINE_ALL_SOURCES(PARQ_RD_BM_INPUTS_DEFINE, floats, type_group_id:
 RD_BENCHMARK_DEFINE_ALL_SOURCES(PARQ_RD_BM_INPUTS_DEFINE, timestamps, type_group_id::TIMESTAMP);
 RD_BENCHMARK_DEFINE_ALL_SOURCES(PARQ_RD_BM_INPUTS_DEFINE, string, cudf::type_id::STRING);
 RD_BENCHMARK_DEFINE_ALL_SOURCES(PARQ_RD_BM_INPUTS_DEFINE, list, cudf::type_id::LIST);
+RD_BENCHMARK_DEFINE_ALL_SOURCES(PARQ_RD_BM_INPUTS_DEFINE, struct, cudf::type_id::STRUCT);
+
+// throughput of each codec, on data that compresses well
+BENCHMARK_DEFINE_F(ParquetRead, codecs)
+(::benchmark::State& state) { BM_parq_read_varying_input(state); }
+BENCHMARK_REGISTER_F(ParquetRead, codecs)
+  ->ArgsProduct({{int32_t(type_group_id::INTEGRAL), int32_t(cudf::type_id::STRING)},
+                 {1000},
+                 {32},
+                 {int32_t(cudf_io::compression_type::NONE),
+                  int32_t(cudf_io::compression_type::SNAPPY),
+                  int32_t(cudf_io::compression_type::GZIP),
+                  int32_t(cudf_io::compression_type::ZSTD)},
+                 {int32_t(io_type::HOST_BUFFER)}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
 
 BENCHMARK_DEFINE_F(ParquetRead, column_selection)
 (::benchmark::State& state) { BM_parq_read_varying_options(state); }
@@ -38,9 +38,8 @@ void BM_parq_write_varying_inout(benchmark::State& state)
   auto const data_types             = get_type_or_group(state.range(0));
   cudf::size_type const cardinality = state.range(1);
   cudf::size_type const run_length  = state.range(2);
-  cudf_io::compression_type const compression =
-    state.range(3) ? cudf_io::compression_type::SNAPPY : cudf_io::compression_type::NONE;
-  io_type const sink_type = static_cast<io_type>(state.range(4));
+  auto const compression            = static_cast<cudf_io::compression_type>(state.range(3));
+  io_type const sink_type           = static_cast<io_type>(state.range(4));
 
   data_profile table_data_profile;
   table_data_profile.set_cardinality(cardinality);
@@ -58,6 +57,7 @@ void BM_parq_write_varying_inout(benchmark::State& state)
     cudf_io::write_parquet(opts);
   }
 
+  state.SetLabel(io_type_label(sink_type));
   state.SetBytesProcessed(data_size * state.iterations());
 }
 
@@ -89,12 +89,17 @@ void BM_parq_write_varying_options(benchmark::State& state)
   state.SetBytesProcessed(data_size * state.iterations());
 }
 
-#define PARQ_WR_BM_INOUTS_DEFINE(name, type_or_group, sink_type)                              \
-  BENCHMARK_DEFINE_F(ParquetWrite, name)                                                      \
-  (::benchmark::State & state) { BM_parq_write_varying_inout(state); }                        \
-  BENCHMARK_REGISTER_F(ParquetWrite, name)                                                    \
-    ->ArgsProduct({{int32_t(type_or_group)}, {0, 1000}, {1, 32}, {true, false}, {sink_type}}) \
-    ->Unit(benchmark::kMillisecond)                                                           \
+#define PARQ_WR_BM_INOUTS_DEFINE(name, type_or_group, sink_type)       \
+  BENCHMARK_DEFINE_F(ParquetWrite, name)                               \
+  (::benchmark::State & state) { BM_parq_write_varying_inout(state); } \
+  BENCHMARK_REGISTER_F(ParquetWrite, name)                             \
+    ->ArgsProduct({{int32_t(type_or_group)},                           \
+                   {0, 1000},                                          \
+                   {1, 32},                                            \
+                   {int32_t(cudf_io::compression_type::SNAPPY),        \
+                    int32_t(cudf_io::compression_type::NONE)},         \
+                   {sink_type}})                                       \
+    ->Unit(benchmark::kMillisecond)                                    \
     ->UseManualTime();
 
 WR_BENCHMARK_DEFINE_ALL_SINKS(PARQ_WR_BM_INOUTS_DEFINE, integral, type_group_id::INTEGRAL);
@@ -102,6 +107,22 @@ WR_BENCHMARK_DEFINE_ALL_SINKS(PARQ_WR_BM_INOUTS_DEFINE, floats, type_group_id::F
 WR_BENCHMARK_DEFINE_ALL_SINKS(PARQ_WR_BM_INOUTS_DEFINE, timestamps, type_group_id::TIMESTAMP);
 WR_BENCHMARK_DEFINE_ALL_SINKS(PARQ_WR_BM_INOUTS_DEFINE, string, cudf::type_id::STRING);
 WR_BENCHMARK_DEFINE_ALL_SINKS(PARQ_WR_BM_INOUTS_DEFINE, list, cudf::type_id::LIST);
+WR_BENCHMARK_DEFINE_ALL_SINKS(PARQ_WR_BM_INOUTS_DEFINE, struct, cudf::type_id::STRUCT);
+
+// throughput of each codec, on data that compresses well
+BENCHMARK_DEFINE_F(ParquetWrite, codecs)
+(::benchmark::State& state) { BM_parq_write_varying_inout(state); }
+BENCHMARK_REGISTER_F(ParquetWrite, codecs)
+  ->ArgsProduct({{int32_t(type_group_id::INTEGRAL), int32_t(cudf::type_id::STRING)},
+                 {1000},
+                 {32},
+                 {int32_t(cudf_io::compression_type::NONE),
+                  int32_t(cudf_io::compression_type::SNAPPY),
+                  int32_t(cudf_io::compression_type::GZIP),
+                  int32_t(cudf_io::compression_type::ZSTD)},
+                 {int32_t(io_type::VOID)}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
 
 BENCHMARK_DEFINE_F(ParquetWrite, writer_options)
 (::benchmark::State& state) { BM_parq_write_varying_options(state); }
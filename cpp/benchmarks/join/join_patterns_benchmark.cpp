@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+class JoinPatterns : public cudf::benchmark {
+};
+
+enum class key_pattern {
+  unique_int,    ///< INT32 keys, about one match per probe row
+  skewed_int,    ///< INT32 keys, 99% of the rows on 1/8 of the keys with geometric frequencies
+  strings,       ///< STRING keys of 0 to 32 characters
+  nullable_int,  ///< INT32 keys, 10% null
+  multi_column,  ///< INT32, INT64 and STRING keys
+  high_fanout,   ///< INT32 keys, about 16 matches per probe row
+};
+
+enum class join_kind { inner, left, left_semi, left_anti, hash_join_build, hash_join_probe };
+
+namespace {
+
+/**
+ * @brief Returns the build and probe tables of keys, drawn from the same set of distinct keys
+ * so that the probe rows find matches.
+ */
+std::pair<std::unique_ptr<cudf::table>, std::unique_ptr<cudf::table>> make_join_keys(
+  key_pattern pattern, cudf::size_type build_rows, cudf::size_type probe_rows)
+{
+  auto const types = [&]() -> std::vector<cudf::type_id> {
+    switch (pattern) {
+      case key_pattern::strings: return {cudf::type_id::STRING};
+      case key_pattern::multi_column:
+        return {cudf::type_id::INT32, cudf::type_id::INT64, cudf::type_id::STRING};
+      default: return {cudf::type_id::INT32};
+    }
+  }();
+  auto const num_keys =
+    pattern == key_pattern::high_fanout ? std::max(build_rows / 16, 1) : build_rows;
+
+  data_profile keys_profile;
+  keys_profile.set_cardinality(0);
+  keys_profile.set_avg_run_length(1);
+  keys_profile.set_null_frequency(pattern == key_pattern::nullable_int ? 0.1 : 0.0);
+  auto const keys = create_random_table(types, types.size(), row_count{num_keys}, keys_profile);
+
+  // the rows of the keys each build and probe row takes
+  data_profile map_profile;
+  map_profile.set_cardinality(0);
+  map_profile.set_avg_run_length(1);
+  map_profile.set_null_frequency(0.0);
+  if (pattern == key_pattern::skewed_int) {
+    map_profile.set_distribution_params(
+      cudf::type_id::INT32, distribution_id::GEOMETRIC, 0, num_keys / 8);
+  } else {
+    map_profile.set_distribution_params(
+      cudf::type_id::INT32, distribution_id::UNIFORM, 0, num_keys - 1);
+  }
+  auto const build_map =
+    create_random_table({cudf::type_id::INT32}, 1, row_count{build_rows}, map_profile, 1);
+  auto const probe_map =
+    create_random_table({cudf::type_id::INT32}, 1, row_count{probe_rows}, map_profile, 2);
+
+  // a geometric sample can exceed its range, with negligible probability
+  auto const policy = cudf::out_of_bounds_policy::NULLIFY;
+  return {cudf::gather(keys->view(), build_map->get_column(0), policy),
+          cudf::gather(keys->view(), probe_map->get_column(0), policy)};
+}
+
+}  // namespace
+
+static void BM_join_pattern(benchmark::State& state, join_kind kind, key_pattern pattern)
+{
+  auto const build_rows = static_cast<cudf::size_type>(state.range(0));
+  auto const probe_rows = static_cast<cudf::size_type>(state.range(1));
+  auto const tables     = make_join_keys(pattern, build_rows, probe_rows);
+  auto const build      = tables.first->view();
+  auto const probe      = tables.second->view();
+
+  std::vector<cudf::size_type> columns(build.num_columns());
+  std::iota(columns.begin(), columns.end(), 0);
+  auto const compare_nulls = cudf::null_equality::UNEQUAL;
+  cudf::hash_join const hash_table{build, compare_nulls};
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true, rmm::cuda_stream_default);
+    switch (kind) {
+      case join_kind::inner: cudf::inner_join(probe, build, columns, columns, compare_nulls); break;
+      case join_kind::left: cudf::left_join(probe, build, columns, columns, compare_nulls); break;
+      case join_kind::left_semi: cudf::left_semi_join(probe, build, compare_nulls); break;
+      case join_kind::left_anti: cudf::left_anti_join(probe, build, compare_nulls); break;
+      case join_kind::hash_join_build: cudf::hash_join{build, compare_nulls}; break;
+      case join_kind::hash_join_probe: hash_table.inner_join(probe, compare_nulls); break;
+    }
+  }
+
+  auto const input_rows = kind == join_kind::hash_join_build ? build_rows : build_rows + probe_rows;
+  state.SetItemsProcessed(state.iterations() * input_rows);
+}
+
+#define JOIN_PATTERN_BENCHMARK_DEFINE(name, kind, pattern)                     \
+  BENCHMARK_DEFINE_F(JoinPatterns, name)                                       \
+  (::benchmark::State & st) { BM_join_pattern(st, join_kind::kind, pattern); } \
+  BENCHMARK_REGISTER_F(JoinPatterns, name)                                     \
+    ->Args({100'000, 400'000})                                                 \
+    ->Args({1'000'000, 4'000'000})                                             \
+    ->Args({10'000'000, 10'000'000})                                           \
+    ->UseManualTime()                                                          \
+    ->Unit(benchmark::kMillisecond);
+
+// the output grows with the fan-out, so the largest size is left out
+#define JOIN_FANOUT_BENCHMARK_DEFINE(name, kind)                                              \
+  BENCHMARK_DEFINE_F(JoinPatterns, name)                                                      \
+  (::benchmark::State & st) { BM_join_pattern(st, join_kind::kind, key_pattern::high_fanout); } \
+  BENCHMARK_REGISTER_F(JoinPatterns, name)                                                    \
+    ->Args({100'000, 400'000})                                                                \
+    ->Args({1'000'000, 1'000'000})                                                            \
+    ->UseManualTime()                                                                         \
+    ->Unit(benchmark::kMillisecond);
+
+JOIN_PATTERN_BENCHMARK_DEFINE(inner_unique_int, inner, key_pattern::unique_int)
+JOIN_PATTERN_BENCHMARK_DEFINE(inner_skewed_int, inner, key_pattern::skewed_int)
+JOIN_PATTERN_BENCHMARK_DEFINE(inner_strings, inner, key_pattern::strings)
+JOIN_PATTERN_BENCHMARK_DEFINE(inner_nullable_int, inner, key_pattern::nullable_int)
+JOIN_PATTERN_BENCHMARK_DEFINE(inner_multi_column, inner, key_pattern::multi_column)
+JOIN_FANOUT_BENCHMARK_DEFINE(inner_high_fanout, inner)
+
+JOIN_PATTERN_BENCHMARK_DEFINE(left_unique_int, left, key_pattern::unique_int)
+JOIN_PATTERN_BENCHMARK_DEFINE(left_strings, left, key_pattern::strings)
+JOIN_PATTERN_BENCHMARK_DEFINE(left_multi_column, left, key_pattern::multi_column)
+JOIN_FANOUT_BENCHMARK_DEFINE(left_high_fanout, left)
+
+JOIN_PATTERN_BENCHMARK_DEFINE(left_semi_unique_int, left_semi, key_pattern::unique_int)
+JOIN_PATTERN_BENCHMARK_DEFINE(left_semi_skewed_int, left_semi, key_pattern::skewed_int)
+JOIN_PATTERN_BENCHMARK_DEFINE(left_semi_strings, left_semi, key_pattern::strings)
+JOIN_PATTERN_BENCHMARK_DEFINE(left_anti_unique_int, left_anti, key_pattern::unique_int)
+JOIN_PATTERN_BENCHMARK_DEFINE(left_anti_skewed_int, left_anti, key_pattern::skewed_int)
+JOIN_PATTERN_BENCHMARK_DEFINE(left_anti_strings, left_anti, key_pattern::strings)
+
+JOIN_PATTERN_BENCHMARK_DEFINE(hash_join_build_unique_int, hash_join_build, key_pattern::unique_int)
+JOIN_PATTERN_BENCHMARK_DEFINE(hash_join_build_skewed_int, hash_join_build, key_pattern::skewed_int)
+JOIN_PATTERN_BENCHMARK_DEFINE(hash_join_build_strings, hash_join_build, key_pattern::strings)
+JOIN_PATTERN_BENCHMARK_DEFINE(hash_join_probe_unique_int, hash_join_probe, key_pattern::unique_int)
+JOIN_PATTERN_BENCHMARK_DEFINE(hash_join_probe_skewed_int, hash_join_probe, key_pattern::skewed_int)
+JOIN_PATTERN_BENCHMARK_DEFINE(hash_join_probe_strings, hash_join_probe, key_pattern::strings)
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ndsh_utilities.hpp"
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/ast/transform.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/join.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
+
+#include <algorithm>
+
+// End-to-end queries modeled on TPC-H, run entirely with libcudf on the Parquet tables of
+// `get_ndsh_dataset`. Each stage is timed on its own, see `stage_timer`.
+
+class NDSH : public cudf::benchmark {
+};
+
+namespace {
+
+using cudf::ast::ast_operator;
+using cudf::ast::column_reference;
+using cudf::ast::expression;
+using cudf::ast::literal;
+
+auto days(int32_t days_since_epoch)
+{
+  return cudf::timestamp_scalar<cudf::timestamp_D>(
+    cudf::timestamp_D{cudf::duration_D{days_since_epoch}}, true);
+}
+
+/**
+ * @brief Returns the rows of `input` for which the AST `predicate` is true.
+ */
+std::unique_ptr<cudf::table> filter(cudf::table_view const& input, expression const& predicate)
+{
+  auto const mask = cudf::ast::compute_column(input, predicate);
+  return cudf::apply_boolean_mask(input, mask->view());
+}
+
+/**
+ * @brief Returns `price * (1 - discount)` of the given columns of `input`.
+ */
+std::unique_ptr<cudf::column> discounted_price(cudf::table_view const& input,
+                                               cudf::size_type price,
+                                               cudf::size_type discount)
+{
+  cudf::numeric_scalar<double> one(1.);
+  auto const one_literal  = literal(one);
+  auto const price_ref    = column_reference(price);
+  auto const discount_ref = column_reference(discount);
+  auto const kept         = expression(ast_operator::SUB, one_literal, discount_ref);
+  return cudf::ast::compute_column(input, expression(ast_operator::MUL, price_ref, kept));
+}
+
+cudf::groupby::aggregation_request make_request(cudf::column_view const& values,
+                                                std::vector<cudf::aggregation::Kind> const& kinds)
+{
+  cudf::groupby::aggregation_request request;
+  request.values = values;
+  for (auto kind : kinds) {
+    switch (kind) {
+      case cudf::aggregation::SUM:
+        request.aggregations.push_back(cudf::make_sum_aggregation());
+        break;
+      case cudf::aggregation::MEAN:
+        request.aggregations.push_back(cudf::make_mean_aggregation());
+        break;
+      default: request.aggregations.push_back(cudf::make_count_aggregation()); break;
+    }
+  }
+  return request;
+}
+
+/**
+ * @brief Returns the columns of the keys of a groupby followed by the results of its requests.
+ */
+std::vector<cudf::column_view> groupby_columns(
+  cudf::table_view const& keys, std::vector<cudf::groupby::aggregation_result> const& results)
+{
+  std::vector<cudf::column_view> columns(keys.begin(), keys.end());
+  for (auto const& result : results) {
+    for (auto const& column : result.results) {
+      columns.push_back(column->view());
+    }
+  }
+  return columns;
+}
+
+}  // namespace
+
+/**
+ * @brief Q1, pricing summary report: aggregates the line items shipped before a date by return
+ * flag and line status.
+ */
+static void BM_ndsh_q1(benchmark::State& state)
+{
+  auto const& data = get_ndsh_dataset(state.range(0));
+  stage_timer timer(state);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true, rmm::cuda_stream_default);
+    auto const lineitem = timer("read", [&] {
+      return read_ndsh_table(data.lineitem,
+                             {"l_returnflag",
+                              "l_linestatus",
+                              "l_quantity",
+                              "l_extendedprice",
+                              "l_discount",
+                              "l_tax",
+                              "l_shipdate"});
+    });
+
+    auto const shipped = timer("filter", [&] {
+      auto date              = days(10471);  // 1998-09-02
+      auto const date_lit    = literal(date);
+      auto const shipdate    = column_reference(6);
+      auto const before_date = expression(ast_operator::LESS_EQUAL, shipdate, date_lit);
+      return filter(lineitem->view(), before_date);
+    });
+
+    // the discounted prices, and the charges including the taxes
+    auto const charges = timer("project", [&] {
+      std::vector<std::unique_ptr<cudf::column>> columns;
+      columns.push_back(discounted_price(shipped->view(), 3, 4));
+      cudf::numeric_scalar<double> one(1.);
+      auto const one_literal = literal(one);
+      auto const price       = column_reference(0);
+      auto const tax         = column_reference(1);
+      auto const taxed       = expression(ast_operator::ADD, one_literal, tax);
+      columns.push_back(cudf::ast::compute_column(
+        cudf::table_view{{columns.front()->view(), shipped->get_column(5)}},
+        expression(ast_operator::MUL, price, taxed)));
+      return std::make_unique<cudf::table>(std::move(columns));
+    });
+
+    auto const summary = timer("groupby", [&] {
+      auto const view = shipped->view();
+      cudf::groupby::groupby groupby(cudf::table_view{{view.column(0), view.column(1)}});
+      std::vector<cudf::groupby::aggregation_request> requests;
+      requests.push_back(
+        make_request(view.column(2), {cudf::aggregation::SUM, cudf::aggregation::MEAN}));
+      requests.push_back(
+        make_request(view.column(3), {cudf::aggregation::SUM, cudf::aggregation::MEAN}));
+      requests.push_back(make_request(charges->get_column(0), {cudf::aggregation::SUM}));
+      requests.push_back(make_request(charges->get_column(1), {cudf::aggregation::SUM}));
+      requests.push_back(
+        make_request(view.column(4), {cudf::aggregation::MEAN, cudf::aggregation::COUNT_VALID}));
+      auto result = groupby.aggregate(requests);
+      return std::make_pair(std::move(result.first), std::move(result.second));
+    });
+
+    timer("sort", [&] {
+      auto const keys = summary.first->view();
+      return cudf::sort_by_key(cudf::table_view{groupby_columns(keys, summary.second)}, keys);
+    });
+  }
+}
+
+/**
+ * @brief Q3, shipping priority: the 10 unshipped orders of a market segment with the highest
+ * revenue.
+ */
+static void BM_ndsh_q3(benchmark::State& state)
+{
+  auto const& data = get_ndsh_dataset(state.range(0));
+  stage_timer timer(state);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true, rmm::cuda_stream_default);
+    auto const customer =
+      timer("read", [&] { return read_ndsh_table(data.customer, {"c_custkey", "c_mktsegment"}); });
+    auto const orders = timer("read", [&] {
+      return read_ndsh_table(data.orders,
+                             {"o_orderkey", "o_custkey", "o_orderdate", "o_shippriority"});
+    });
+    auto const lineitem = timer("read", [&] {
+      return read_ndsh_table(data.lineitem,
+                             {"l_orderkey", "l_extendedprice", "l_discount", "l_shipdate"});
+    });
+
+    auto date                    = days(9204);  // 1995-03-15
+    auto const date_lit          = literal(date);
+    auto const segment_customers = timer("filter", [&] {
+      cudf::numeric_scalar<int8_t> building(1);
+      auto const segment_lit = literal(building);
+      auto const segment     = column_reference(1);
+      return filter(customer->view(), expression(ast_operator::EQUAL, segment, segment_lit));
+    });
+    auto const open_orders = timer("filter", [&] {
+      auto const orderdate = column_reference(2);
+      return filter(orders->view(), expression(ast_operator::LESS, orderdate, date_lit));
+    });
+    auto const unshipped = timer("filter", [&] {
+      auto const shipdate = column_reference(3);
+      return filter(lineitem->view(), expression(ast_operator::GREATER, shipdate, date_lit));
+    });
+
+    // the columns of the line items, followed by those of the orders and customers
+    auto const joined = timer("join", [&] {
+      auto const customer_orders =
+        cudf::inner_join(open_orders->view(), segment_customers->view(), {1}, {0});
+      return cudf::inner_join(unshipped->view(), customer_orders->view(), {0}, {0});
+    });
+
+    auto const revenue = timer("project", [&] { return discounted_price(joined->view(), 1, 2); });
+
+    auto const order_revenue = timer("groupby", [&] {
+      auto const view = joined->view();
+      cudf::groupby::groupby groupby(
+        cudf::table_view{{view.column(0), view.column(6), view.column(7)}});
+      std::vector<cudf::groupby::aggregation_request> requests;
+      requests.push_back(make_request(revenue->view(), {cudf::aggregation::SUM}));
+      auto result = groupby.aggregate(requests);
+      return std::make_unique<cudf::table>(
+        cudf::table_view{groupby_columns(result.first->view(), result.second)});
+    });
+
+    timer("top_k", [&] {
+      auto const view   = order_revenue->view();
+      auto const sorted = cudf::sort_by_key(view,
+                                            cudf::table_view{{view.column(3), view.column(1)}},
+                                            {cudf::order::DESCENDING, cudf::order::ASCENDING});
+      auto const top = cudf::slice(sorted->view(), {0, std::min(10, sorted->num_rows())});
+      return std::make_unique<cudf::table>(top.front());
+    });
+  }
+}
+
+/**
+ * @brief Q6, forecasting revenue change: the revenue of the line items of a year within a range
+ * of discounts and below a quantity.
+ */
+static void BM_ndsh_q6(benchmark::State& state)
+{
+  auto const& data = get_ndsh_dataset(state.range(0));
+  stage_timer timer(state);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true, rmm::cuda_stream_default);
+    auto const lineitem = timer("read", [&] {
+      return read_ndsh_table(data.lineitem,
+                             {"l_quantity", "l_extendedprice", "l_discount", "l_shipdate"});
+    });
+
+    auto const selected = timer("filter", [&] {
+      auto begin = days(8766);  // 1994-01-01
+      auto end   = days(9131);  // 1995-01-01
+      cudf::numeric_scalar<double> min_discount(0.05);
+      cudf::numeric_scalar<double> max_discount(0.07);
+      cudf::numeric_scalar<double> max_quantity(24.);
+      auto const begin_lit        = literal(begin);
+      auto const end_lit          = literal(end);
+      auto const min_discount_lit = literal(min_discount);
+      auto const max_discount_lit = literal(max_discount);
+      auto const max_quantity_lit = literal(max_quantity);
+      auto const quantity         = column_reference(0);
+      auto const discount         = column_reference(2);
+      auto const shipdate         = column_reference(3);
+
+      // expressions refer to their operands, which must outlive them
+      auto const after_begin  = expression(ast_operator::GREATER_EQUAL, shipdate, begin_lit);
+      auto const before_end   = expression(ast_operator::LESS, shipdate, end_lit);
+      auto const above_min    = expression(ast_operator::GREATER_EQUAL, discount, min_discount_lit);
+      auto const below_max    = expression(ast_operator::LESS_EQUAL, discount, max_discount_lit);
+      auto const low_quantity = expression(ast_operator::LESS, quantity, max_quantity_lit);
+      auto const in_year      = expression(ast_operator::LOGICAL_AND, after_begin, before_end);
+      auto const in_discounts = expression(ast_operator::LOGICAL_AND, above_min, below_max);
+      auto const in_ranges    = expression(ast_operator::LOGICAL_AND, in_year, in_discounts);
+      return filter(lineitem->view(),
+                    expression(ast_operator::LOGICAL_AND, in_ranges, low_quantity));
+    });
+
+    auto const revenue = timer("project", [&] {
+      auto const price    = column_reference(1);
+      auto const discount = column_reference(2);
+      return cudf::ast::compute_column(selected->view(),
+                                       expression(ast_operator::MUL, price, discount));
+    });
+
+    timer("reduce", [&] {
+      return cudf::reduce(revenue->view(),
+                          cudf::make_sum_aggregation(),
+                          cudf::data_type{cudf::type_id::FLOAT64});
+    });
+  }
+}
+
+#define NDSH_BENCHMARK_DEFINE(name)                 \
+  BENCHMARK_DEFINE_F(NDSH, name)                    \
+  (::benchmark::State & st) { BM_ndsh_##name(st); } \
+  BENCHMARK_REGISTER_F(NDSH, name)                  \
+    ->Arg(1'000'000)                                \
+    ->Arg(6'000'000)                                \
+    ->UseManualTime()                               \
+    ->Unit(benchmark::kMillisecond);
+
+NDSH_BENCHMARK_DEFINE(q1)
+NDSH_BENCHMARK_DEFINE(q3)
+NDSH_BENCHMARK_DEFINE(q6)
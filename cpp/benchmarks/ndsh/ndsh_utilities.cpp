@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ndsh_utilities.hpp"
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+
+#include <cudf/filling.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <mutex>
+
+namespace {
+
+// days since the epoch of the TPC-H date bounds
+constexpr int32_t start_date     = 8035;   // 1992-01-01
+constexpr int32_t end_date       = 10561;  // 1998-12-01
+constexpr int32_t end_order_date = 10440;  // 1998-08-02
+
+/**
+ * @brief Returns a column of `num_rows` values drawn uniformly between `lower` and `upper`.
+ */
+template <typename T>
+std::unique_ptr<cudf::column> random_column(cudf::type_id type,
+                                            cudf::size_type num_rows,
+                                            T lower,
+                                            T upper,
+                                            unsigned seed)
+{
+  data_profile profile;
+  profile.set_cardinality(0);
+  profile.set_avg_run_length(1);
+  profile.set_null_frequency(0.0);
+  profile.set_distribution_params(type, distribution_id::UNIFORM, lower, upper);
+  auto columns = create_random_table({type}, 1, row_count{num_rows}, profile, seed)->release();
+  return std::move(columns.front());
+}
+
+/**
+ * @brief Returns the INT64 keys 0 to `num_rows` - 1.
+ */
+std::unique_ptr<cudf::column> key_column(cudf::size_type num_rows)
+{
+  return cudf::sequence(num_rows, cudf::numeric_scalar<int64_t>(0));
+}
+
+std::vector<char> write_table(std::vector<std::unique_ptr<cudf::column>>&& columns,
+                              std::vector<std::string> const& names)
+{
+  cudf::table const table(std::move(columns));
+  cudf::io::table_input_metadata metadata(table.view());
+  for (size_t i = 0; i < names.size(); ++i) {
+    metadata.column_metadata[i].set_name(names[i]);
+  }
+
+  std::vector<char> parquet;
+  auto const options =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&parquet}, table.view())
+      .metadata(&metadata)
+      .build();
+  cudf::io::write_parquet(options);
+  return parquet;
+}
+
+ndsh_dataset generate_dataset(cudf::size_type num_lineitems)
+{
+  auto const num_orders    = std::max(num_lineitems / 4, 1);
+  auto const num_customers = std::max(num_lineitems / 40, 1);
+  auto const timestamp     = cudf::type_id::TIMESTAMP_DAYS;
+  unsigned seed            = 0;
+
+  std::vector<std::unique_ptr<cudf::column>> lineitem;
+  lineitem.push_back(
+    random_column<int64_t>(cudf::type_id::INT64, num_lineitems, 0, num_orders - 1, ++seed));
+  lineitem.push_back(random_column(cudf::type_id::FLOAT64, num_lineitems, 1., 50., ++seed));
+  lineitem.push_back(
+    random_column(cudf::type_id::FLOAT64, num_lineitems, 900., 105'000., ++seed));
+  lineitem.push_back(random_column(cudf::type_id::FLOAT64, num_lineitems, 0., 0.1, ++seed));
+  lineitem.push_back(random_column(cudf::type_id::FLOAT64, num_lineitems, 0., 0.08, ++seed));
+  lineitem.push_back(random_column<int8_t>(cudf::type_id::INT8, num_lineitems, 0, 2, ++seed));
+  lineitem.push_back(random_column<int8_t>(cudf::type_id::INT8, num_lineitems, 0, 1, ++seed));
+  lineitem.push_back(random_column(timestamp, num_lineitems, start_date, end_date, ++seed));
+
+  std::vector<std::unique_ptr<cudf::column>> orders;
+  orders.push_back(key_column(num_orders));
+  orders.push_back(
+    random_column<int64_t>(cudf::type_id::INT64, num_orders, 0, num_customers - 1, ++seed));
+  orders.push_back(random_column(timestamp, num_orders, start_date, end_order_date, ++seed));
+  orders.push_back(random_column(cudf::type_id::INT32, num_orders, 0, 4, ++seed));
+
+  std::vector<std::unique_ptr<cudf::column>> customer;
+  customer.push_back(key_column(num_customers));
+  customer.push_back(random_column<int8_t>(cudf::type_id::INT8, num_customers, 0, 4, ++seed));
+
+  return {write_table(std::move(lineitem),
+                      {"l_orderkey",
+                       "l_quantity",
+                       "l_extendedprice",
+                       "l_discount",
+                       "l_tax",
+                       "l_returnflag",
+                       "l_linestatus",
+                       "l_shipdate"}),
+          write_table(std::move(orders),
+                      {"o_orderkey", "o_custkey", "o_orderdate", "o_shippriority"}),
+          write_table(std::move(customer), {"c_custkey", "c_mktsegment"})};
+}
+
+}  // namespace
+
+ndsh_dataset const& get_ndsh_dataset(cudf::size_type num_lineitems)
+{
+  static std::mutex mutex;
+  static std::map<cudf::size_type, ndsh_dataset> datasets;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = datasets.find(num_lineitems);
+  if (it == datasets.end()) {
+    it = datasets.emplace(num_lineitems, generate_dataset(num_lineitems)).first;
+  }
+  return it->second;
+}
+
+std::unique_ptr<cudf::table> read_ndsh_table(std::vector<char> const& parquet,
+                                             std::vector<std::string> const& columns)
+{
+  auto const options =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{parquet.data(), parquet.size()})
+      .columns(columns)
+      .build();
+  return cudf::io::read_parquet(options).tbl;
+}
+
+stage_timer::stage_timer(benchmark::State& state) : _state(state)
+{
+  CUDA_TRY(cudaEventCreate(&_start));
+  CUDA_TRY(cudaEventCreate(&_stop));
+}
+
+stage_timer::~stage_timer()
+{
+  for (auto const& stage : _stage_ms) {
+    _state.counters[stage.first + "_ms"] =
+      benchmark::Counter(stage.second, benchmark::Counter::kAvgIterations);
+  }
+  CUDA_TRY(cudaEventDestroy(_start));
+  CUDA_TRY(cudaEventDestroy(_stop));
+}
+
+void stage_timer::start() { CUDA_TRY(cudaEventRecord(_start, rmm::cuda_stream_default.value())); }
+
+void stage_timer::stop(std::string const& stage)
+{
+  CUDA_TRY(cudaEventRecord(_stop, rmm::cuda_stream_default.value()));
+  CUDA_TRY(cudaEventSynchronize(_stop));
+  float milliseconds = 0.0f;
+  CUDA_TRY(cudaEventElapsedTime(&milliseconds, _start, _stop));
+  _stage_ms[stage] += milliseconds;
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cudf/table/table.hpp>
+
+#include <driver_types.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The tables of the NDS-H (TPC-H-like) queries, each written to a Parquet file in host
+ * memory.
+ *
+ * The columns are a subset of the TPC-H schema. Prices, quantities and discounts are FLOAT64,
+ * dates TIMESTAMP_DAYS, and the flag, status and market segment columns INT8 codes.
+ */
+struct ndsh_dataset {
+  std::vector<char> lineitem;  ///< l_orderkey, l_quantity, l_extendedprice, l_discount, l_tax,
+                               ///< l_returnflag, l_linestatus, l_shipdate
+  std::vector<char> orders;    ///< o_orderkey, o_custkey, o_orderdate, o_shippriority
+  std::vector<char> customer;  ///< c_custkey, c_mktsegment
+};
+
+/**
+ * @brief Returns the dataset with `num_lineitems` rows of lineitem, and as in TPC-H, a fourth as
+ * many orders and a fortieth as many customers.
+ *
+ * The datasets are generated once and shared by the benchmarks.
+ */
+ndsh_dataset const& get_ndsh_dataset(cudf::size_type num_lineitems);
+
+/**
+ * @brief Reads the given columns of a table of `get_ndsh_dataset`.
+ */
+std::unique_ptr<cudf::table> read_ndsh_table(std::vector<char> const& parquet,
+                                             std::vector<std::string> const& columns);
+
+/**
+ * @brief Times the stages of a query on the default stream, and reports the average time of
+ * each stage per iteration as the counter `<stage>_ms` of the benchmark when destroyed.
+ *
+ * Every stage ends with a synchronization of the default stream.
+ *
+ * Example:
+ * ```
+ * stage_timer timer(state);
+ * for (auto _ : state) {
+ *   cuda_event_timer raii(state, true);
+ *   auto table = timer("read", [&] { return read_ndsh_table(data.lineitem, {"l_tax"}); });
+ *   ...
+ * }
+ * ```
+ */
+class stage_timer {
+ public:
+  explicit stage_timer(benchmark::State& state);
+  stage_timer(stage_timer const&) = delete;
+  stage_timer& operator=(stage_timer const&) = delete;
+  ~stage_timer();
+
+  /**
+   * @brief Runs the stage `fn` and returns its result.
+   */
+  template <typename Fn>
+  auto operator()(std::string const& stage, Fn&& fn)
+  {
+    start();
+    auto result = fn();
+    stop(stage);
+    return result;
+  }
+
+ private:
+  void start();
+  void stop(std::string const& stage);
+
+  benchmark::State& _state;
+  cudaEvent_t _start;
+  cudaEvent_t _stop;
+  std::map<std::string, double> _stage_ms;  // total time of each stage
+};
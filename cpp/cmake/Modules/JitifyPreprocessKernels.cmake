@@ -55,7 +55,8 @@ function(jit_preprocess_files)
 endfunction()
 
 jit_preprocess_files(SOURCE_DIRECTORY      ${CUDF_SOURCE_DIR}/src
-                     FILES                 binaryop/jit/kernel.cu
+                     FILES                 ast/jit/kernel.cu
+                                           binaryop/jit/kernel.cu
                                            transform/jit/kernel.cu
                                            rolling/jit/kernel.cu
                      )
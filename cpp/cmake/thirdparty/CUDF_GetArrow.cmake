@@ -47,6 +47,7 @@ function(find_and_configure_arrow VERSION BUILD_STATIC)
                         "ARROW_IPC ON"
                         "ARROW_CUDA ON"
                         "ARROW_DATASET ON"
+                        "ARROW_S3 ${CUDF_ENABLE_ARROW_S3}"
                         "ARROW_WITH_BACKTRACE ON"
                         "ARROW_CXXFLAGS -w"
                         "ARROW_JEMALLOC OFF"
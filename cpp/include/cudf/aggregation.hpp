@@ -78,8 +78,21 @@ class aggregation {
     COLLECT_SET,     ///< collect values into a list without duplicate entries
     LEAD,            ///< window function, accesses row at specified offset following current row
     LAG,             ///< window function, accesses row at specified offset preceding current row
-    PTX,             ///< PTX  UDF based reduction
-    CUDA             ///< CUDA UDF based reduction
+    M2,              ///< sum of squares of differences from the mean
+    MERGE_M2,        ///< merge partial M2 states of multiple groups
+    MERGE_LISTS,     ///< merge multiple lists values into one list
+    MERGE_SETS,      ///< merge multiple lists values into one list then drop duplicate entries
+    /// estimate the number of distinct elements with a HyperLogLog sketch
+    APPROX_COUNT_DISTINCT,
+    HLL_SKETCH,        ///< build a HyperLogLog sketch of the elements
+    MERGE_HLL_SKETCH,  ///< merge multiple HyperLogLog sketches into one sketch
+    TDIGEST,           ///< build a t-digest of the elements for approximate percentiles
+    MERGE_TDIGEST,     ///< merge multiple t-digests into one t-digest
+    RANK,              ///< get rank of current index
+    DENSE_RANK,        ///< get dense rank of current index
+    PERCENT_RANK,      ///< get percentage rank of current index within its group
+    PTX,               ///< PTX  UDF based reduction
+    CUDA               ///< CUDA UDF based reduction
   };
 
   aggregation(aggregation::Kind a) : kind{a} {}
@@ -205,6 +218,45 @@ std::unique_ptr<aggregation> make_nth_element_aggregation(
 /// Factory to create a ROW_NUMBER aggregation
 std::unique_ptr<aggregation> make_row_number_aggregation();
 
+/**
+ * @brief Factory to create a RANK aggregation
+ *
+ * `RANK` returns a non-nullable column of `size_type` ranks. The input must be presorted; each
+ * row gets the position (1-based) of the first row equal to it, so equal rows share a rank and
+ * the rank following a run of `n` equal rows jumps by `n`. Nulls compare equal to each other.
+ *
+ * Example: for the sorted input `{3, 3, 4, 5, 5, 5}` the ranks are `{1, 1, 3, 4, 4, 4}`.
+ *
+ * In `groupby::scan` the ranks restart at 1 in each group, whose values must be presorted.
+ */
+std::unique_ptr<aggregation> make_rank_aggregation();
+
+/**
+ * @brief Factory to create a DENSE_RANK aggregation
+ *
+ * `DENSE_RANK` returns a non-nullable column of `size_type` ranks. The input must be presorted;
+ * equal rows share a rank and each new distinct row increments the rank by one, leaving no gaps.
+ * Nulls compare equal to each other.
+ *
+ * Example: for the sorted input `{3, 3, 4, 5, 5, 5}` the dense ranks are `{1, 1, 2, 3, 3, 3}`.
+ *
+ * In `groupby::scan` the dense ranks restart at 1 in each group, whose values must be presorted.
+ */
+std::unique_ptr<aggregation> make_dense_rank_aggregation();
+
+/**
+ * @brief Factory to create a PERCENT_RANK aggregation
+ *
+ * `PERCENT_RANK` returns a non-nullable column of `double` ranks, computed from the `RANK` of
+ * each row as `(rank - 1) / (count - 1)` where `count` is the number of rows of its group, or 0
+ * for a group of one row. It is only supported by `groupby::scan`, whose values must be presorted
+ * within each group.
+ *
+ * Example: for the sorted group `{3, 3, 4, 5, 5}` the percent ranks are
+ * `{0, 0, 0.5, 0.75, 0.75}`.
+ */
+std::unique_ptr<aggregation> make_percent_rank_aggregation();
+
 /**
  * @brief Factory to create a COLLECT_LIST aggregation
  *
@@ -244,6 +296,123 @@ std::unique_ptr<aggregation> make_lag_aggregation(size_type offset);
 /// Factory to create a LEAD aggregation
 std::unique_ptr<aggregation> make_lead_aggregation(size_type offset);
 
+/**
+ * @brief Factory to create a M2 aggregation
+ *
+ * `M2` returns the sum of squares of differences from the group mean of the valid elements in
+ * each group. Together with the valid count and the mean, it is a partial state from which
+ * `VARIANCE` and `STD` can be computed after merging the states with a `MERGE_M2` aggregation.
+ * Groups with no valid element have a null result.
+ */
+std::unique_ptr<aggregation> make_m2_aggregation();
+
+/**
+ * @brief Factory to create a MERGE_M2 aggregation
+ *
+ * `MERGE_M2` merges partial states computed for the same group on different partitions of the
+ * data. The values to merge must be a structs column with the children
+ * `[COUNT_VALID (INT32), MEAN (FLOAT64), M2 (FLOAT64)]`, as produced by the `COUNT_VALID`,
+ * `MEAN` and `M2` aggregations. The result is a structs column of the same layout holding the
+ * merged state of each group. The variance of a group is then `M2 / (COUNT_VALID - ddof)`.
+ */
+std::unique_ptr<aggregation> make_merge_m2_aggregation();
+
+/**
+ * @brief Factory to create a MERGE_LISTS aggregation
+ *
+ * `MERGE_LISTS` concatenates the lists in each group into one list, e.g. to merge the partial
+ * results of a `COLLECT_LIST` aggregation. The values to merge must be a lists column without
+ * nulls.
+ */
+std::unique_ptr<aggregation> make_merge_lists_aggregation();
+
+/**
+ * @brief Factory to create a MERGE_SETS aggregation
+ *
+ * `MERGE_SETS` concatenates the lists in each group into one list then drops the duplicate
+ * entries, e.g. to merge the partial results of a `COLLECT_SET` aggregation. The values to merge
+ * must be a lists column without nulls.
+ *
+ * @param nulls_equal Flag to specify whether null entries within each list should be considered
+ * equal
+ * @param nans_equal  Flag to specify whether NaN values in floating point column should be
+ * considered equal
+ */
+std::unique_ptr<aggregation> make_merge_sets_aggregation(
+  null_equality nulls_equal = null_equality::EQUAL,
+  nan_equality nans_equal   = nan_equality::UNEQUAL);
+
+/**
+ * @brief Factory to create an APPROX_COUNT_DISTINCT aggregation
+ *
+ * `APPROX_COUNT_DISTINCT` estimates the number of distinct valid elements with a HyperLogLog
+ * sketch of `2^precision` registers. The relative standard error of the estimate is about
+ * `1.04 / sqrt(2^precision)`. The result is an INT64 column.
+ *
+ * To aggregate partitioned data, compute the `HLL_SKETCH` of each partition, merge the sketches
+ * with a `MERGE_HLL_SKETCH` aggregation and estimate the result with `approx_distinct_count`.
+ *
+ * @throws cudf::logic_error if `precision` is not within `[4, 18]`
+ *
+ * @param precision Number of bits of the element hash used to select a register
+ */
+std::unique_ptr<aggregation> make_approx_count_distinct_aggregation(int precision = 12);
+
+/**
+ * @brief Factory to create a HLL_SKETCH aggregation
+ *
+ * `HLL_SKETCH` builds the HyperLogLog sketch of the valid elements that `APPROX_COUNT_DISTINCT`
+ * estimates from. The result is a LIST<UINT8> column holding the `2^precision` registers of each
+ * group's sketch. Sketches built with the same precision can be merged with a `MERGE_HLL_SKETCH`
+ * aggregation.
+ *
+ * @throws cudf::logic_error if `precision` is not within `[4, 18]`
+ *
+ * @param precision Number of bits of the element hash used to select a register
+ */
+std::unique_ptr<aggregation> make_hll_sketch_aggregation(int precision = 12);
+
+/**
+ * @brief Factory to create a MERGE_HLL_SKETCH aggregation
+ *
+ * `MERGE_HLL_SKETCH` merges the HyperLogLog sketches in each group into one sketch by taking the
+ * maximum of each register. The values to merge must be a LIST<UINT8> column of sketches produced
+ * by `HLL_SKETCH` aggregations of the same precision. Null sketches are ignored.
+ */
+std::unique_ptr<aggregation> make_merge_hll_sketch_aggregation();
+
+/**
+ * @brief Factory to create a TDIGEST aggregation
+ *
+ * `TDIGEST` summarizes the valid elements of each group with a t-digest: a sorted list of
+ * centroids `(mean, weight)` that are small near the extremes of the distribution and larger
+ * around its median, plus the minimum and maximum elements. The result is a structs column with
+ * the children `[LIST<STRUCT<mean (FLOAT64), weight (FLOAT64)>>, min (FLOAT64), max (FLOAT64)]`.
+ * A group without valid elements has no centroid.
+ *
+ * Approximate percentiles are extracted from the digests with `percentile_approx`. Digests of
+ * partitions of the data can be merged with a `MERGE_TDIGEST` aggregation.
+ *
+ * @throws cudf::logic_error if `max_centroids` is not positive
+ *
+ * @param max_centroids Maximum number of centroids of a digest. Larger values give more accurate
+ * percentiles with larger digests.
+ */
+std::unique_ptr<aggregation> make_tdigest_aggregation(int max_centroids = 1000);
+
+/**
+ * @brief Factory to create a MERGE_TDIGEST aggregation
+ *
+ * `MERGE_TDIGEST` merges the t-digests in each group into one t-digest of at most
+ * `max_centroids` centroids. The values to merge must be a structs column of digests produced by
+ * `TDIGEST` or `MERGE_TDIGEST` aggregations.
+ *
+ * @throws cudf::logic_error if `max_centroids` is not positive
+ *
+ * @param max_centroids Maximum number of centroids of a merged digest
+ */
+std::unique_ptr<aggregation> make_merge_tdigest_aggregation(int max_centroids = 1000);
+
 /**
  * @brief Factory to create an aggregation base on UDF for PTX or CUDA
  *
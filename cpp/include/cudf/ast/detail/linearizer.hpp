@@ -18,10 +18,18 @@
 #include <cudf/ast/operators.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/strings/string_view.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
 namespace cudf {
 namespace ast {
 
@@ -69,8 +77,88 @@ struct alignas(8) device_data_reference {
 
   inline bool operator==(const device_data_reference& rhs) const
   {
-    return std::tie(data_index, reference_type, table_source) ==
-           std::tie(rhs.data_index, rhs.reference_type, rhs.table_source);
+    return std::tie(data_index, reference_type, table_source, data_type) ==
+           std::tie(rhs.data_index, rhs.reference_type, rhs.table_source, rhs.data_type);
+  }
+};
+
+/**
+ * @brief A type-erased device view of a literal of any type supported by expressions.
+ *
+ * Fixed-width values are read from the scalar's device memory, and string values are returned as
+ * a `string_view` of the scalar's characters. This is a POD class, so it can be copied to the
+ * device with the rest of the linearized expression.
+ */
+class generic_scalar_device_view : public cudf::detail::scalar_device_view_base {
+ public:
+  /**
+   * @brief Construct a device view of a numeric scalar.
+   *
+   * @tparam T Numeric scalar template type.
+   * @param s A numeric scalar value.
+   */
+  template <typename T>
+  generic_scalar_device_view(cudf::numeric_scalar<T>& s)
+    : generic_scalar_device_view(s.type(), s.data(), s.validity_data())
+  {
+  }
+
+  /**
+   * @brief Construct a device view of a timestamp scalar.
+   *
+   * @tparam T Timestamp scalar template type.
+   * @param s A timestamp scalar value.
+   */
+  template <typename T>
+  generic_scalar_device_view(cudf::timestamp_scalar<T>& s)
+    : generic_scalar_device_view(s.type(), s.data(), s.validity_data())
+  {
+  }
+
+  /**
+   * @brief Construct a device view of a duration scalar.
+   *
+   * @tparam T Duration scalar template type.
+   * @param s A duration scalar value.
+   */
+  template <typename T>
+  generic_scalar_device_view(cudf::duration_scalar<T>& s)
+    : generic_scalar_device_view(s.type(), s.data(), s.validity_data())
+  {
+  }
+
+  /**
+   * @brief Construct a device view of a string scalar.
+   *
+   * @param s A string scalar value.
+   */
+  generic_scalar_device_view(cudf::string_scalar& s)
+    : generic_scalar_device_view(s.type(), s.data(), s.validity_data(), s.size())
+  {
+  }
+
+  /**
+   * @brief Returns the stored value.
+   *
+   * @tparam T The desired type, `cudf::string_view` for string scalars.
+   */
+  template <typename T>
+  __device__ T value() const noexcept
+  {
+    if constexpr (std::is_same<T, cudf::string_view>::value) {
+      return cudf::string_view(static_cast<char const*>(_data), _size);
+    } else {
+      return *static_cast<T const*>(_data);
+    }
+  }
+
+ protected:
+  void const* _data{};  ///< Pointer to device memory containing the value
+  size_type _size{};    ///< Size of the string in bytes, unused for fixed-width values
+
+  generic_scalar_device_view(data_type type, void const* data, bool* is_valid, size_type size = 0)
+    : cudf::detail::scalar_device_view_base(type, is_valid), _data(data), _size(size)
+  {
   }
 };
 
@@ -100,6 +188,12 @@ class node {
  * the nodes and constructing vectors of information that are later used by the device for
  * evaluating the abstract syntax tree as a "linear" list of operators whose input dependencies are
  * resolved into intermediate data storage in shared memory.
+ *
+ * Common subexpressions are evaluated once: subtrees with the same operators applied to the same
+ * columns and literal objects are numbered alike before linearization, and the value of a repeated
+ * subtree is kept in its intermediate until its last use. An intermediate is given back to the
+ * `intermediate_counter` after its last use, so the storage needed is that of the largest set of
+ * simultaneously live values rather than one per operator.
  */
 class linearizer {
   friend class literal;
@@ -113,8 +207,22 @@ class linearizer {
    * @param table The table used for evaluating the abstract syntax tree.
    */
   linearizer(detail::node const& expr, cudf::table_view table)
-    : _table(table), _node_count(0), _intermediate_counter()
+    : _table(table), _right_table(table), _node_count(0), _intermediate_counter()
   {
+    number_values(expr);
+    expr.accept(*this);
+  }
+
+  /**
+   * @brief Construct a new linearizer object for an expression on two tables
+   *
+   * @param left The table referenced by `table_reference::LEFT` columns.
+   * @param right The table referenced by `table_reference::RIGHT` columns.
+   */
+  linearizer(detail::node const& expr, cudf::table_view left, cudf::table_view right)
+    : _table(left), _right_table(right), _node_count(0), _intermediate_counter()
+  {
+    number_values(expr);
     expr.accept(*this);
   }
 
@@ -162,13 +270,23 @@ class linearizer {
   /**
    * @brief Get the literal device views.
    *
-   * @return std::vector<cudf::detail::fixed_width_scalar_device_view_base>
+   * @return std::vector<generic_scalar_device_view>
    */
-  std::vector<cudf::detail::fixed_width_scalar_device_view_base> const& literals() const
+  std::vector<generic_scalar_device_view> const& literals() const
   {
     return _literals;
   }
 
+  /**
+   * @brief Get the scalars the literals were constructed from, in the order of `literals()`.
+   *
+   * @return std::vector<std::reference_wrapper<cudf::scalar const>>
+   */
+  std::vector<std::reference_wrapper<cudf::scalar const>> const& literal_scalars() const
+  {
+    return _literal_scalars;
+  }
+
   /**
    * @brief Visit a literal node.
    *
@@ -219,18 +337,29 @@ class linearizer {
   };
 
  private:
+  cudf::size_type number_values(detail::node const& expr);
   std::vector<cudf::size_type> visit_operands(
     std::vector<std::reference_wrapper<const node>> operands);
   cudf::size_type add_data_reference(detail::device_data_reference data_ref);
 
   // State information about the "linearized" GPU execution plan
   cudf::table_view _table;
+  cudf::table_view _right_table;
   cudf::size_type _node_count;
   intermediate_counter _intermediate_counter;
   std::vector<detail::device_data_reference> _data_references;
   std::vector<ast_operator> _operators;
   std::vector<cudf::size_type> _operator_source_indices;
-  std::vector<cudf::detail::fixed_width_scalar_device_view_base> _literals;
+  std::vector<generic_scalar_device_view> _literals;
+  std::vector<std::reference_wrapper<cudf::scalar const>> _literal_scalars;
+
+  // Common subexpression elimination: the value number of every node, the key of every value
+  // number, the operand uses of every value number not yet evaluated, and the data reference of
+  // every value number already evaluated
+  std::unordered_map<detail::node const*, cudf::size_type> _value_numbers;
+  std::map<std::vector<std::int64_t>, cudf::size_type> _value_keys;
+  std::vector<cudf::size_type> _remaining_uses;
+  std::vector<cudf::size_type> _value_references;
 };
 
 }  // namespace detail
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -114,6 +114,12 @@ CUDA_HOST_DEVICE_CALLABLE constexpr void ast_operator_dispatcher(ast_operator op
     case ast_operator::LOGICAL_OR:
       f.template operator()<ast_operator::LOGICAL_OR>(std::forward<Ts>(args)...);
       break;
+    case ast_operator::NULL_EQUAL:
+      f.template operator()<ast_operator::NULL_EQUAL>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::COALESCE:
+      f.template operator()<ast_operator::COALESCE>(std::forward<Ts>(args)...);
+      break;
     case ast_operator::IDENTITY:
       f.template operator()<ast_operator::IDENTITY>(std::forward<Ts>(args)...);
       break;
@@ -183,6 +189,21 @@ CUDA_HOST_DEVICE_CALLABLE constexpr void ast_operator_dispatcher(ast_operator op
     case ast_operator::NOT:
       f.template operator()<ast_operator::NOT>(std::forward<Ts>(args)...);
       break;
+    case ast_operator::CAST_TO_INT64:
+      f.template operator()<ast_operator::CAST_TO_INT64>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::CAST_TO_UINT64:
+      f.template operator()<ast_operator::CAST_TO_UINT64>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::CAST_TO_FLOAT64:
+      f.template operator()<ast_operator::CAST_TO_FLOAT64>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::IS_NULL:
+      f.template operator()<ast_operator::IS_NULL>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::IF_ELSE:
+      f.template operator()<ast_operator::IF_ELSE>(std::forward<Ts>(args)...);
+      break;
     default:
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Invalid operator.");
@@ -493,6 +514,41 @@ struct operator_functor<ast_operator::LOGICAL_OR> {
   }
 };
 
+/**
+ * @brief Compares valid operands for equality.
+ *
+ * The evaluator only applies this to valid operands. It compares a null operand equal to another
+ * null operand and unequal to a valid one, and the result is never null.
+ */
+template <>
+struct operator_functor<ast_operator::NULL_EQUAL> {
+  static constexpr auto arity{2};
+
+  template <typename LHS, typename RHS>
+  CUDA_DEVICE_CALLABLE auto operator()(LHS lhs, RHS rhs) -> decltype(lhs == rhs)
+  {
+    return lhs == rhs;
+  }
+};
+
+/**
+ * @brief Selects the left operand.
+ *
+ * The evaluator selects the right operand instead if the left operand is null.
+ */
+template <>
+struct operator_functor<ast_operator::COALESCE> {
+  static constexpr auto arity{2};
+
+  template <typename LHS,
+            typename RHS,
+            std::enable_if_t<std::is_same<LHS, RHS>::value>* = nullptr>
+  CUDA_DEVICE_CALLABLE auto operator()(LHS lhs, RHS) -> LHS
+  {
+    return lhs;
+  }
+};
+
 template <>
 struct operator_functor<ast_operator::IDENTITY> {
   static constexpr auto arity{1};
@@ -753,6 +809,67 @@ struct operator_functor<ast_operator::NOT> {
   }
 };
 
+/**
+ * @brief Converts a numeric or boolean operand to `To`.
+ *
+ * Casts let operands of different types be combined by the binary operators, which require
+ * operands of the same type.
+ */
+template <typename To>
+struct cast_operator {
+  static constexpr auto arity{1};
+
+  template <typename InputT, std::enable_if_t<std::is_arithmetic<InputT>::value>* = nullptr>
+  CUDA_DEVICE_CALLABLE auto operator()(InputT input) -> To
+  {
+    return static_cast<To>(input);
+  }
+};
+
+template <>
+struct operator_functor<ast_operator::CAST_TO_INT64> : cast_operator<int64_t> {
+};
+
+template <>
+struct operator_functor<ast_operator::CAST_TO_UINT64> : cast_operator<uint64_t> {
+};
+
+template <>
+struct operator_functor<ast_operator::CAST_TO_FLOAT64> : cast_operator<double> {
+};
+
+/**
+ * @brief Returns false, the result for a valid operand.
+ *
+ * The evaluator returns true instead if the operand is null, and the result is never null.
+ */
+template <>
+struct operator_functor<ast_operator::IS_NULL> {
+  static constexpr auto arity{1};
+
+  template <typename InputT>
+  CUDA_DEVICE_CALLABLE auto operator()(InputT) -> bool
+  {
+    return false;
+  }
+};
+
+/**
+ * @brief Selects the second operand if the condition is true, otherwise the third.
+ *
+ * The evaluator treats a null condition as false.
+ */
+template <>
+struct operator_functor<ast_operator::IF_ELSE> {
+  static constexpr auto arity{3};
+
+  template <typename T>
+  CUDA_DEVICE_CALLABLE auto operator()(bool condition, T lhs, T rhs) -> T
+  {
+    return condition ? lhs : rhs;
+  }
+};
+
 #if 0
 /**
  * @brief Functor used to double-type-dispatch binary operators.
@@ -1048,6 +1165,11 @@ inline cudf::data_type ast_operator_return_type(ast_operator op,
       binary_operator_dispatcher(
         op, operand_types[0], operand_types[1], detail::return_type_functor{}, result);
       break;
+    case 3:
+      // The only ternary operator, IF_ELSE, returns the type of the operands it selects from
+      CUDF_EXPECTS(op == ast_operator::IF_ELSE, "Invalid ternary operation.");
+      result = operand_types[1];
+      break;
     default: CUDF_FAIL("Unsupported operator return type."); break;
   }
   return result;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -28,6 +28,7 @@
 #include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 
 #include <cstring>
 #include <numeric>
@@ -50,23 +51,30 @@ struct row_output {
    *
    * Only output columns (COLUMN) and intermediates (INTERMEDIATE) are supported as output reference
    * types. Intermediates must be of fixed width less than or equal to sizeof(std::int64_t). This
-   * requirement on intermediates is enforced by the linearizer.
+   * requirement on intermediates is enforced by the linearizer. If the evaluator has no output
+   * column, the result of the root node is stored in the first intermediate instead.
+   *
+   * The validity is recorded if the evaluator tracks the validity of intermediates, and for a
+   * nullable output column, whose null mask must be initialized to all null.
    *
    * @tparam Element Type of result element.
    * @param device_data_reference Data reference to resolve.
    * @param row_index Row index of data column.
    * @param result Value to assign to output.
+   * @param valid Whether the result is valid.
    */
   template <typename Element, CUDF_ENABLE_IF(is_rep_layout_compatible<Element>())>
   __device__ void resolve_output(detail::device_data_reference device_data_reference,
                                  cudf::size_type row_index,
-                                 Element result) const;
+                                 Element result,
+                                 bool valid) const;
   // Definition below after row_evaluator is a complete type
 
   template <typename Element, CUDF_ENABLE_IF(not is_rep_layout_compatible<Element>())>
   __device__ void resolve_output(detail::device_data_reference device_data_reference,
                                  cudf::size_type row_index,
-                                 Element result) const
+                                 Element result,
+                                 bool valid) const
   {
     cudf_assert(false && "Invalid type in resolve_output.");
   }
@@ -84,11 +92,16 @@ struct unary_row_output : public row_output {
     std::enable_if_t<detail::is_valid_unary_op<detail::operator_functor<op>, Input>>* = nullptr>
   __device__ void operator()(cudf::size_type row_index,
                              Input input,
+                             bool input_valid,
                              detail::device_data_reference output) const
   {
     using OperatorFunctor = detail::operator_functor<op>;
     using Out             = cuda::std::invoke_result_t<OperatorFunctor, Input>;
-    resolve_output<Out>(output, row_index, OperatorFunctor{}(input));
+    if constexpr (op == ast_operator::IS_NULL) {
+      resolve_output<Out>(output, row_index, not input_valid, true);
+    } else {
+      resolve_output<Out>(output, row_index, OperatorFunctor{}(input), input_valid);
+    }
   }
 
   template <
@@ -96,6 +109,7 @@ struct unary_row_output : public row_output {
     std::enable_if_t<!detail::is_valid_unary_op<detail::operator_functor<op>, Input>>* = nullptr>
   __device__ void operator()(cudf::size_type row_index,
                              Input input,
+                             bool input_valid,
                              detail::device_data_reference output) const
   {
     cudf_assert(false && "Invalid unary dispatch operator for the provided input.");
@@ -112,11 +126,21 @@ struct binary_row_output : public row_output {
   __device__ void operator()(cudf::size_type row_index,
                              LHS lhs,
                              RHS rhs,
+                             bool lhs_valid,
+                             bool rhs_valid,
                              detail::device_data_reference output) const
   {
     using OperatorFunctor = detail::operator_functor<op>;
     using Out             = cuda::std::invoke_result_t<OperatorFunctor, LHS, RHS>;
-    resolve_output<Out>(output, row_index, OperatorFunctor{}(lhs, rhs));
+    if constexpr (op == ast_operator::NULL_EQUAL) {
+      auto const result =
+        lhs_valid && rhs_valid ? OperatorFunctor{}(lhs, rhs) : not lhs_valid && not rhs_valid;
+      resolve_output<Out>(output, row_index, result, true);
+    } else if constexpr (op == ast_operator::COALESCE) {
+      resolve_output<Out>(output, row_index, lhs_valid ? lhs : rhs, lhs_valid || rhs_valid);
+    } else {
+      resolve_output<Out>(output, row_index, OperatorFunctor{}(lhs, rhs), lhs_valid && rhs_valid);
+    }
   }
 
   template <ast_operator op,
@@ -125,6 +149,8 @@ struct binary_row_output : public row_output {
   __device__ void operator()(cudf::size_type row_index,
                              LHS lhs,
                              RHS rhs,
+                             bool lhs_valid,
+                             bool rhs_valid,
                              detail::device_data_reference output) const
   {
     cudf_assert(false && "Invalid binary dispatch operator for the provided input.");
@@ -134,9 +160,10 @@ struct binary_row_output : public row_output {
 /**
  * @brief An expression evaluator owned by a single thread operating on rows of a table.
  *
- * This class is designed for n-ary transform evaluation. Currently this class assumes that there's
- * only one relevant "row index" in its methods, which corresponds to a row in a single input table
- * and the same row index in an output column.
+ * This class is designed for n-ary transform evaluation. The "row index" in its methods
+ * corresponds to a row in the input table and the same row index in an output column. For
+ * expressions on two tables, such as join predicates, columns of the right table are read at a
+ * separate "right row index".
  */
 struct row_evaluator {
   friend struct row_output;
@@ -154,15 +181,48 @@ struct row_evaluator {
    * @param thread_intermediate_storage Pointer to this thread's portion of shared memory for
    * storing intermediates.
    * @param output_column The output column where results are stored.
+   * @param thread_intermediate_validity Pointer to this thread's portion of shared memory for
+   * storing the validity of intermediates, or null to treat all intermediates as valid.
    */
   __device__ row_evaluator(table_device_view const& table,
-                           const cudf::detail::fixed_width_scalar_device_view_base* literals,
+                           const detail::generic_scalar_device_view* literals,
                            std::int64_t* thread_intermediate_storage,
-                           mutable_column_device_view* output_column)
-    : table(table),
+                           mutable_column_device_view* output_column,
+                           bool* thread_intermediate_validity = nullptr)
+    : row_evaluator(table,
+                    table,
+                    literals,
+                    thread_intermediate_storage,
+                    output_column,
+                    thread_intermediate_validity)
+  {
+  }
+
+  /**
+   * @brief Construct a row evaluator for an expression on two tables.
+   *
+   * @param left The table device view referenced by `table_reference::LEFT` columns.
+   * @param right The table device view referenced by `table_reference::RIGHT` columns.
+   * @param literals Array of literal values used for evaluation.
+   * @param thread_intermediate_storage Pointer to this thread's portion of shared memory for
+   * storing intermediates. Must hold at least one intermediate if `output_column` is null.
+   * @param output_column The output column where results are stored, or null to store the result
+   * in the first intermediate.
+   * @param thread_intermediate_validity Pointer to this thread's portion of shared memory for
+   * storing the validity of intermediates, or null to treat all intermediates as valid.
+   */
+  __device__ row_evaluator(table_device_view const& left,
+                           table_device_view const& right,
+                           const detail::generic_scalar_device_view* literals,
+                           std::int64_t* thread_intermediate_storage,
+                           mutable_column_device_view* output_column,
+                           bool* thread_intermediate_validity = nullptr)
+    : table(left),
+      right_table(right),
       literals(literals),
       thread_intermediate_storage(thread_intermediate_storage),
-      output_column(output_column)
+      output_column(output_column),
+      thread_intermediate_validity(thread_intermediate_validity)
   {
   }
 
@@ -176,16 +236,20 @@ struct row_evaluator {
    * @tparam Element Type of element to return.
    * @param device_data_reference Data reference to resolve.
    * @param row_index Row index of data column.
+   * @param right_row_index Row index of data column in the right table.
    * @return Element
    */
   template <typename Element, CUDF_ENABLE_IF(column_device_view::has_element_accessor<Element>())>
   __device__ Element resolve_input(detail::device_data_reference device_data_reference,
-                                   cudf::size_type row_index) const
+                                   cudf::size_type row_index,
+                                   cudf::size_type right_row_index) const
   {
     auto const data_index = device_data_reference.data_index;
     auto const ref_type   = device_data_reference.reference_type;
     if (ref_type == detail::device_data_reference_type::COLUMN) {
-      return table.column(data_index).element<Element>(row_index);
+      return (device_data_reference.table_source == table_reference::RIGHT)
+               ? right_table.column(data_index).element<Element>(right_row_index)
+               : table.column(data_index).element<Element>(row_index);
     } else if (ref_type == detail::device_data_reference_type::LITERAL) {
       return literals[data_index].value<Element>();
     } else {  // Assumes ref_type == detail::device_data_reference_type::INTERMEDIATE
@@ -201,29 +265,59 @@ struct row_evaluator {
   template <typename Element,
             CUDF_ENABLE_IF(not column_device_view::has_element_accessor<Element>())>
   __device__ Element resolve_input(detail::device_data_reference device_data_reference,
-                                   cudf::size_type row_index) const
+                                   cudf::size_type row_index,
+                                   cudf::size_type right_row_index) const
   {
     cudf_assert(false && "Unsupported type in resolve_input.");
     return {};
   }
 
+  /**
+   * @brief Resolves whether the value of an input data reference is valid.
+   *
+   * @param device_data_reference Data reference to resolve.
+   * @param row_index Row index of data column.
+   * @param right_row_index Row index of data column in the right table.
+   * @return Whether the value is valid
+   */
+  __device__ bool resolve_input_validity(detail::device_data_reference device_data_reference,
+                                         cudf::size_type row_index,
+                                         cudf::size_type right_row_index) const
+  {
+    auto const data_index = device_data_reference.data_index;
+    auto const ref_type   = device_data_reference.reference_type;
+    if (ref_type == detail::device_data_reference_type::COLUMN) {
+      return (device_data_reference.table_source == table_reference::RIGHT)
+               ? right_table.column(data_index).is_valid(right_row_index)
+               : table.column(data_index).is_valid(row_index);
+    } else if (ref_type == detail::device_data_reference_type::LITERAL) {
+      return literals[data_index].is_valid();
+    } else {  // Assumes ref_type == detail::device_data_reference_type::INTERMEDIATE
+      return thread_intermediate_validity == nullptr || thread_intermediate_validity[data_index];
+    }
+  }
+
   /**
    * @brief Callable to perform a unary operation.
    *
    * @tparam OperatorFunctor Functor that performs desired operation when `operator()` is called.
    * @tparam Input Type of input value.
    * @param row_index Row index of data column(s).
+   * @param right_row_index Row index of data column(s) in the right table.
    * @param input Input data reference.
    * @param output Output data reference.
    */
   template <typename Input>
   __device__ void operator()(cudf::size_type row_index,
+                             cudf::size_type right_row_index,
                              detail::device_data_reference input,
                              detail::device_data_reference output,
                              ast_operator op) const
   {
-    auto const typed_input = resolve_input<Input>(input, row_index);
-    ast_operator_dispatcher(op, unary_row_output<Input>(*this), row_index, typed_input, output);
+    auto const typed_input = resolve_input<Input>(input, row_index, right_row_index);
+    auto const input_valid = resolve_input_validity(input, row_index, right_row_index);
+    ast_operator_dispatcher(
+      op, unary_row_output<Input>(*this), row_index, typed_input, input_valid, output);
   }
 
   /**
@@ -233,21 +327,65 @@ struct row_evaluator {
    * @tparam LHS Type of left input value.
    * @tparam RHS Type of right input value.
    * @param row_index Row index of data column(s).
+   * @param right_row_index Row index of data column(s) in the right table.
    * @param lhs Left input data reference.
    * @param rhs Right input data reference.
    * @param output Output data reference.
    */
   template <typename LHS, typename RHS>
   __device__ void operator()(cudf::size_type row_index,
+                             cudf::size_type right_row_index,
                              detail::device_data_reference lhs,
                              detail::device_data_reference rhs,
                              detail::device_data_reference output,
                              ast_operator op) const
   {
-    auto const typed_lhs = resolve_input<LHS>(lhs, row_index);
-    auto const typed_rhs = resolve_input<RHS>(rhs, row_index);
-    ast_operator_dispatcher(
-      op, binary_row_output<LHS, RHS>(*this), row_index, typed_lhs, typed_rhs, output);
+    auto const typed_lhs = resolve_input<LHS>(lhs, row_index, right_row_index);
+    auto const typed_rhs = resolve_input<RHS>(rhs, row_index, right_row_index);
+    auto const lhs_valid = resolve_input_validity(lhs, row_index, right_row_index);
+    auto const rhs_valid = resolve_input_validity(rhs, row_index, right_row_index);
+    ast_operator_dispatcher(op,
+                            binary_row_output<LHS, RHS>(*this),
+                            row_index,
+                            typed_lhs,
+                            typed_rhs,
+                            lhs_valid,
+                            rhs_valid,
+                            output);
+  }
+
+  /**
+   * @brief Callable to perform a ternary operation.
+   *
+   * The only ternary operator, `IF_ELSE`, selects `lhs` if the boolean `condition` is valid and
+   * true, and `rhs` otherwise.
+   *
+   * @tparam Input Type of the selected input values.
+   * @param row_index Row index of data column(s).
+   * @param right_row_index Row index of data column(s) in the right table.
+   * @param condition Condition data reference.
+   * @param lhs Left input data reference.
+   * @param rhs Right input data reference.
+   * @param output Output data reference.
+   */
+  template <typename Input>
+  __device__ void operator()(cudf::size_type row_index,
+                             cudf::size_type right_row_index,
+                             detail::device_data_reference condition,
+                             detail::device_data_reference lhs,
+                             detail::device_data_reference rhs,
+                             detail::device_data_reference output,
+                             ast_operator op) const
+  {
+    cudf_assert(op == ast_operator::IF_ELSE && "Invalid ternary operator.");
+    auto const is_true = resolve_input_validity(condition, row_index, right_row_index) &&
+                         resolve_input<bool>(condition, row_index, right_row_index);
+    auto const selected = is_true ? lhs : rhs;
+    row_output(*this).resolve_output<Input>(
+      output,
+      row_index,
+      resolve_input<Input>(selected, row_index, right_row_index),
+      resolve_input_validity(selected, row_index, right_row_index));
   }
 
   template <typename OperatorFunctor,
@@ -255,6 +393,7 @@ struct row_evaluator {
             typename RHS,
             std::enable_if_t<!detail::is_valid_binary_op<OperatorFunctor, LHS, RHS>>* = nullptr>
   __device__ void operator()(cudf::size_type row_index,
+                             cudf::size_type right_row_index,
                              detail::device_data_reference lhs,
                              detail::device_data_reference rhs,
                              detail::device_data_reference output) const
@@ -264,46 +403,61 @@ struct row_evaluator {
 
  private:
   table_device_view const& table;
-  const cudf::detail::fixed_width_scalar_device_view_base* literals;
+  table_device_view const& right_table;
+  const detail::generic_scalar_device_view* literals;
   std::int64_t* thread_intermediate_storage;
   mutable_column_device_view* output_column;
+  bool* thread_intermediate_validity;
 };
 
 template <typename Element, std::enable_if_t<is_rep_layout_compatible<Element>()>*>
 __device__ void row_output::resolve_output(detail::device_data_reference device_data_reference,
                                            cudf::size_type row_index,
-                                           Element result) const
+                                           Element result,
+                                           bool valid) const
 {
   auto const ref_type = device_data_reference.reference_type;
-  if (ref_type == detail::device_data_reference_type::COLUMN) {
+  auto const to_column = ref_type == detail::device_data_reference_type::COLUMN;
+  if (to_column && evaluator.output_column != nullptr) {
     evaluator.output_column->element<Element>(row_index) = result;
+    if (valid && evaluator.output_column->nullable()) {
+      evaluator.output_column->set_valid(row_index);
+    }
   } else {  // Assumes ref_type == detail::device_data_reference_type::INTERMEDIATE
     // Using memcpy instead of reinterpret_cast<Element*> for safe type aliasing.
     // Using a temporary variable ensures that the compiler knows the result is aligned.
+    // Without an output column, the output reference of the root node (index 0) selects the
+    // first intermediate, which is safe to overwrite as the operands have already been read.
     std::int64_t tmp;
     memcpy(&tmp, &result, sizeof(Element));
     evaluator.thread_intermediate_storage[device_data_reference.data_index] = tmp;
+    if (evaluator.thread_intermediate_validity != nullptr) {
+      evaluator.thread_intermediate_validity[device_data_reference.data_index] = valid;
+    }
   }
 }
 
 /**
- * @brief Evaluate an expression applied to a row.
+ * @brief Evaluate an expression applied to a pair of rows of two tables.
  *
- * This function performs an n-ary transform for one row on one thread.
+ * This function performs an n-ary transform for one pair of rows on one thread.
  *
  * @param evaluator The row evaluator used for evaluation.
  * @param data_references Array of data references.
  * @param operators Array of operators to perform.
  * @param operator_source_indices Array of source indices for the operators.
  * @param num_operators Number of operators.
- * @param row_index Row index of data column(s).
+ * @param row_index Row index of data column(s) of the left table and of the output.
+ * @param right_row_index Row index of data column(s) of the right table.
  */
-__device__ void evaluate_row_expression(detail::row_evaluator const& evaluator,
-                                        const detail::device_data_reference* data_references,
-                                        const ast_operator* operators,
-                                        const cudf::size_type* operator_source_indices,
-                                        cudf::size_type num_operators,
-                                        cudf::size_type row_index)
+__device__ inline void evaluate_row_expression(
+  detail::row_evaluator const& evaluator,
+  const detail::device_data_reference* data_references,
+  const ast_operator* operators,
+  const cudf::size_type* operator_source_indices,
+  cudf::size_type num_operators,
+  cudf::size_type row_index,
+  cudf::size_type right_row_index)
 {
   auto operator_source_index = cudf::size_type(0);
   for (cudf::size_type operator_index(0); operator_index < num_operators; operator_index++) {
@@ -315,7 +469,7 @@ __device__ void evaluate_row_expression(detail::row_evaluator const& evaluator,
       auto const input  = data_references[operator_source_indices[operator_source_index]];
       auto const output = data_references[operator_source_indices[operator_source_index + 1]];
       operator_source_index += arity + 1;
-      type_dispatcher(input.data_type, evaluator, row_index, input, output, op);
+      type_dispatcher(input.data_type, evaluator, row_index, right_row_index, input, output, op);
     } else if (arity == 2) {
       // Binary operator
       auto const lhs    = data_references[operator_source_indices[operator_source_index]];
@@ -326,16 +480,55 @@ __device__ void evaluate_row_expression(detail::row_evaluator const& evaluator,
                       detail::single_dispatch_binary_operator{},
                       evaluator,
                       row_index,
+                      right_row_index,
                       lhs,
                       rhs,
                       output,
                       op);
+    } else if (arity == 3) {
+      // Ternary operator
+      auto const condition = data_references[operator_source_indices[operator_source_index]];
+      auto const lhs       = data_references[operator_source_indices[operator_source_index + 1]];
+      auto const rhs       = data_references[operator_source_indices[operator_source_index + 2]];
+      auto const output    = data_references[operator_source_indices[operator_source_index + 3]];
+      operator_source_index += arity + 1;
+      type_dispatcher(
+        lhs.data_type, evaluator, row_index, right_row_index, condition, lhs, rhs, output, op);
     } else {
       cudf_assert(false && "Invalid operator arity.");
     }
   }
 }
 
+/**
+ * @brief Evaluate an expression applied to a row.
+ *
+ * This function performs an n-ary transform for one row on one thread.
+ *
+ * @param evaluator The row evaluator used for evaluation.
+ * @param data_references Array of data references.
+ * @param operators Array of operators to perform.
+ * @param operator_source_indices Array of source indices for the operators.
+ * @param num_operators Number of operators.
+ * @param row_index Row index of data column(s).
+ */
+__device__ inline void evaluate_row_expression(
+  detail::row_evaluator const& evaluator,
+  const detail::device_data_reference* data_references,
+  const ast_operator* operators,
+  const cudf::size_type* operator_source_indices,
+  cudf::size_type num_operators,
+  cudf::size_type row_index)
+{
+  evaluate_row_expression(evaluator,
+                          data_references,
+                          operators,
+                          operator_source_indices,
+                          num_operators,
+                          row_index,
+                          row_index);
+}
+
 struct ast_plan {
  public:
   ast_plan() : sizes(), data_pointers() {}
@@ -373,6 +566,65 @@ struct ast_plan {
   std::vector<const void*> data_pointers;
 };
 
+/**
+ * @brief The linearized form of an expression in device memory.
+ *
+ * The copy to the device is not synchronized; it is ordered before any kernel launched on `stream`.
+ */
+struct device_ast_plan {
+  device_ast_plan(linearizer const& expr_linearizer,
+                  rmm::cuda_stream_view stream,
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+    : num_operators(expr_linearizer.operators().size()),
+      num_intermediates(expr_linearizer.intermediate_count())
+  {
+    auto plan = ast_plan();
+    plan.add_to_plan(expr_linearizer.data_references());
+    plan.add_to_plan(expr_linearizer.literals());
+    plan.add_to_plan(expr_linearizer.operators());
+    plan.add_to_plan(expr_linearizer.operator_source_indices());
+    host_data_buffer          = plan.get_host_data_buffer();
+    auto const buffer_offsets = plan.get_offsets();
+    device_data_buffer =
+      rmm::device_buffer(host_data_buffer.first.get(), host_data_buffer.second, stream, mr);
+
+    // Create device pointers to components of plan
+    auto const device_data_buffer_ptr = static_cast<const char*>(device_data_buffer.data());
+    data_references                   = reinterpret_cast<const detail::device_data_reference*>(
+      device_data_buffer_ptr + buffer_offsets[0]);
+    literals = reinterpret_cast<const detail::generic_scalar_device_view*>(
+      device_data_buffer_ptr + buffer_offsets[1]);
+    operators = reinterpret_cast<const ast_operator*>(device_data_buffer_ptr + buffer_offsets[2]);
+    operator_source_indices =
+      reinterpret_cast<const cudf::size_type*>(device_data_buffer_ptr + buffer_offsets[3]);
+  }
+
+  const detail::device_data_reference* data_references;
+  const detail::generic_scalar_device_view* literals;
+  const ast_operator* operators;
+  const cudf::size_type* operator_source_indices;
+  cudf::size_type num_operators;
+  cudf::size_type num_intermediates;
+
+ private:
+  ast_plan::buffer_type host_data_buffer;  // Source of the pending copy to the device
+  rmm::device_buffer device_data_buffer;
+};
+
+/**
+ * @brief Returns whether evaluating a linearized expression on `table` may produce nulls.
+ *
+ * This is the case if a column it references is nullable or one of its literals is null.
+ *
+ * @param expr_linearizer The linearized expression.
+ * @param table The table the expression is evaluated on.
+ * @param stream Stream on which to read the validity of the literals.
+ * @return Whether the result of the expression may contain nulls.
+ */
+bool may_produce_nulls(linearizer const& expr_linearizer,
+                       table_view const& table,
+                       rmm::cuda_stream_view stream);
+
 /**
  * @brief Compute a new column by evaluating an expression tree on a table.
  *
@@ -390,6 +642,17 @@ std::unique_ptr<column> compute_column(
   expression const& expr,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::ast::compute_column_jit
+ *
+ * @param stream Stream on which to perform the computation.
+ */
+std::unique_ptr<column> compute_column_jit(
+  table_view const table,
+  expression const& expr,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 }  // namespace detail
 
 }  // namespace ast
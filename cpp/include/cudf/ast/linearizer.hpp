@@ -57,7 +57,7 @@ class literal : public detail::node {
    * @param value A numeric scalar value.
    */
   template <typename T>
-  literal(cudf::numeric_scalar<T>& value) : value(cudf::get_scalar_device_view(value))
+  literal(cudf::numeric_scalar<T>& value) : host_scalar(value), value(value)
   {
   }
 
@@ -68,7 +68,7 @@ class literal : public detail::node {
    * @param value A timestamp scalar value.
    */
   template <typename T>
-  literal(cudf::timestamp_scalar<T>& value) : value(cudf::get_scalar_device_view(value))
+  literal(cudf::timestamp_scalar<T>& value) : host_scalar(value), value(value)
   {
   }
 
@@ -79,10 +79,19 @@ class literal : public detail::node {
    * @param value A duration scalar value.
    */
   template <typename T>
-  literal(cudf::duration_scalar<T>& value) : value(cudf::get_scalar_device_view(value))
+  literal(cudf::duration_scalar<T>& value) : host_scalar(value), value(value)
   {
   }
 
+  /**
+   * @brief Construct a new literal object.
+   *
+   * String literals can be compared with string columns and other string literals.
+   *
+   * @param value A string scalar value.
+   */
+  literal(cudf::string_scalar& value) : host_scalar(value), value(value) {}
+
   /**
    * @brief Get the data type.
    *
@@ -90,13 +99,22 @@ class literal : public detail::node {
    */
   cudf::data_type get_data_type() const { return get_value().type(); }
 
+  /**
+   * @brief Get the scalar the literal was constructed from.
+   *
+   * Allows the literal value to be read on the host, for example to test it against metadata.
+   *
+   * @return cudf::scalar const&
+   */
+  cudf::scalar const& get_scalar() const { return host_scalar; }
+
  private:
   /**
    * @brief Get the value object.
    *
-   * @return cudf::detail::fixed_width_scalar_device_view_base
+   * @return detail::generic_scalar_device_view
    */
-  cudf::detail::fixed_width_scalar_device_view_base get_value() const { return value; }
+  detail::generic_scalar_device_view get_value() const { return value; }
 
   /**
    * @brief Accepts a visitor class.
@@ -106,7 +124,8 @@ class literal : public detail::node {
    */
   cudf::size_type accept(detail::linearizer& visitor) const override;
 
-  const cudf::detail::fixed_width_scalar_device_view_base value;
+  cudf::scalar const& host_scalar;
+  const detail::generic_scalar_device_view value;
 };
 
 /**
@@ -242,6 +261,33 @@ class expression : public detail::node {
    */
   expression(ast_operator op, node const& left, node&& right) = delete;
 
+  /**
+   * @brief Construct a new ternary expression object.
+   *
+   * @param op Operator
+   * @param condition Boolean input node (first operand)
+   * @param left Input node selected if the condition is true (second operand)
+   * @param right Input node selected otherwise (third operand)
+   */
+  expression(ast_operator op, node const& condition, node const& left, node const& right)
+    : op(op), operands({condition, left, right})
+  {
+    if (cudf::ast::detail::ast_operator_arity(op) != 3) {
+      CUDF_FAIL("The provided operator is not a ternary operator.");
+    }
+  }
+
+  /**
+   * @brief `expression` doesn't accept r-value references for expression nodes
+   */
+  template <typename Condition,
+            typename Left,
+            typename Right,
+            std::enable_if_t<std::is_rvalue_reference<Condition&&>::value ||
+                             std::is_rvalue_reference<Left&&>::value ||
+                             std::is_rvalue_reference<Right&&>::value>* = nullptr>
+  expression(ast_operator op, Condition&& condition, Left&& left, Right&& right) = delete;
+
   /**
    * @brief Get the operator.
    *
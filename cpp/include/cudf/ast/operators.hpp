@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,10 @@ namespace ast {
 
 /**
  * @brief Enum of supported operators.
+ *
+ * The result of an operator is null if any of its operands is null, except that `NULL_EQUAL` and
+ * `IS_NULL` are never null, `COALESCE` is null only if both of its operands are, and `IF_ELSE` is
+ * null only if the operand it selects is.
  */
 enum class ast_operator {
   // Binary operators
@@ -45,6 +49,8 @@ enum class ast_operator {
   BITWISE_XOR,    ///< operator ^
   LOGICAL_AND,    ///< operator &&
   LOGICAL_OR,     ///< operator ||
+  NULL_EQUAL,     ///< operator == where nulls compare equal to each other and unequal to values
+  COALESCE,       ///< lhs if it is valid, otherwise rhs
   // Unary operators
   IDENTITY,    ///< Identity function
   SIN,         ///< Trigonometric sine
@@ -68,7 +74,14 @@ enum class ast_operator {
   ABS,         ///< Absolute value
   RINT,        ///< Rounds the floating-point argument arg to an integer value
   BIT_INVERT,  ///< Bitwise Not (~)
-  NOT          ///< Logical Not (!)
+  NOT,         ///< Logical Not (!)
+  // Casting operators
+  CAST_TO_INT64,    ///< Cast value to int64_t
+  CAST_TO_UINT64,   ///< Cast value to uint64_t
+  CAST_TO_FLOAT64,  ///< Cast value to double
+  IS_NULL,          ///< Whether the operand is null
+  // Ternary operators
+  IF_ELSE  ///< Second operand if the first is true, otherwise the third (a null condition is false)
 };
 
 }  // namespace ast
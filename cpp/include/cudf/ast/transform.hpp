@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -26,7 +26,10 @@ namespace ast {
  * @brief Compute a new column by evaluating an expression tree on a table.
  *
  * This evaluates an expression over a table to produce a new column. Also called an n-ary
- * transform.
+ * transform. String columns and string literals can be operands of comparison operators, which
+ * are evaluated with `string_view` comparisons in the same kernel as the rest of the expression.
+ *
+ * @throw cudf::logic_error if the expression does not produce a fixed-width type.
  *
  * @param table The table used for expression evaluation.
  * @param expr The root of the expression tree.
@@ -38,6 +41,28 @@ std::unique_ptr<column> compute_column(
   expression const& expr,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Compute a new column by evaluating an expression tree on a table with a kernel compiled
+ * for the expression.
+ *
+ * Produces the same column as `compute_column`. Instead of interpreting the linearized expression
+ * for every row, the expression is translated to a CUDA function that is compiled at runtime
+ * into a fused kernel. Compiled kernels are cached by the structure and the types of the
+ * expression, so expressions differing only in literal values or in the table they are
+ * evaluated on compile once. Expressions on types other than numeric and boolean types,
+ * expressions without operators, and expressions on nullable columns or null literals are
+ * evaluated by `compute_column`.
+ *
+ * @param table The table used for expression evaluation.
+ * @param expr The root of the expression tree.
+ * @param mr Device memory resource.
+ * @return std::unique_ptr<column> Output column.
+ */
+std::unique_ptr<column> compute_column_jit(
+  table_view const table,
+  expression const& expr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace ast
 
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,7 +19,9 @@
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
 
+#include <future>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 
@@ -149,6 +151,70 @@ std::unique_ptr<column> binary_operation(
   data_type output_type,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Performs a binary operation between a scalar and a column into a preallocated column.
+ *
+ * Computes the same values and validity as the overload returning a new column with the type of
+ * `output` as the output type, without allocating the output. Steady-state pipelines can reuse
+ * the same output column for each batch.
+ *
+ * @throw cudf::logic_error if `output` and `rhs` are different sizes
+ * @throw cudf::logic_error if an operand or `output` is not fixed-width or is `fixed_point`
+ * @throw cudf::logic_error if the result can have nulls and `output` is not nullable
+ * @throw cudf::logic_error if `output` is nullable and has an offset
+ *
+ * @param lhs    The left operand scalar
+ * @param rhs    The right operand column
+ * @param op     The binary operator
+ * @param output Column of the output type and of the size of `rhs` written with the result
+ */
+void binary_operation(scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output);
+
+/**
+ * @brief Performs a binary operation between a column and a scalar into a preallocated column.
+ *
+ * Computes the same values and validity as the overload returning a new column with the type of
+ * `output` as the output type, without allocating the output.
+ *
+ * @throw cudf::logic_error if `output` and `lhs` are different sizes
+ * @throw cudf::logic_error if an operand or `output` is not fixed-width or is `fixed_point`
+ * @throw cudf::logic_error if the result can have nulls and `output` is not nullable
+ * @throw cudf::logic_error if `output` is nullable and has an offset
+ *
+ * @param lhs    The left operand column
+ * @param rhs    The right operand scalar
+ * @param op     The binary operator
+ * @param output Column of the output type and of the size of `lhs` written with the result
+ */
+void binary_operation(column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output);
+
+/**
+ * @brief Performs a binary operation between two columns into a preallocated column.
+ *
+ * Computes the same values and validity as the overload returning a new column with the type of
+ * `output` as the output type, without allocating the output.
+ *
+ * @throw cudf::logic_error if @p lhs, @p rhs and @p output are different sizes
+ * @throw cudf::logic_error if an operand or `output` is not fixed-width or is `fixed_point`
+ * @throw cudf::logic_error if the result can have nulls and `output` is not nullable
+ * @throw cudf::logic_error if `output` is nullable and has an offset
+ *
+ * @param lhs    The left operand column
+ * @param rhs    The right operand column
+ * @param op     The binary operator
+ * @param output Column of the output type and of the size of the operands written with the result
+ */
+void binary_operation(column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output);
+
 /**
  * @brief Performs a binary operation between two columns using a
  * user-defined PTX function.
@@ -202,5 +268,40 @@ cudf::data_type binary_operation_fixed_point_output_type(binary_operator op,
                                                          cudf::data_type const& lhs,
                                                          cudf::data_type const& rhs);
 
+/**
+ * @brief Types and operator of a binary operation, identifying the kernel computing it.
+ */
+struct binary_operation_signature {
+  binary_operator op;  ///< The binary operator
+  data_type lhs;       ///< Type of the left operand
+  data_type rhs;       ///< Type of the right operand
+  data_type output;    ///< Type of the output
+};
+
+/**
+ * @brief Loads or compiles the JIT kernels of binary operations ahead of their first use.
+ *
+ * The kernels of every operation between two columns, a column and a scalar, and a scalar and a
+ * column are loaded from the JIT kernel cache, or compiled and stored in it. Operations computed
+ * by precompiled kernels are skipped.
+ *
+ * @param operations The binary operations to prepare
+ */
+void prewarm_binary_operations(std::vector<binary_operation_signature> const& operations);
+
+/**
+ * @brief Starts loading or compiling the JIT kernels of binary operations in the background.
+ *
+ * Same as `prewarm_binary_operations`, except that the kernels are compiled concurrently on a
+ * pool of `LIBCUDF_JIT_COMPILE_THREADS` threads (default: the number of hardware threads) while
+ * the caller proceeds with other work. Wait for the returned future before running the operations,
+ * or a kernel still being compiled may be compiled again by the operation needing it.
+ *
+ * @param operations The binary operations to prepare
+ * @return Future that waits for all the kernels and rethrows the first compilation error
+ */
+std::future<void> prewarm_binary_operations_async(
+  std::vector<binary_operation_signature> const& operations);
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace comms {
+/**
+ * @addtogroup copy_split
+ * @{
+ * @file
+ */
+
+/**
+ * @brief A table made available to other processes on the same device by `export_ipc`.
+ *
+ * The exporting process must keep this object, and the table it was created from, alive until
+ * every importing process has released its `ipc_imported_table`.
+ */
+class ipc_exported_table {
+ public:
+  ipc_exported_table(std::vector<uint8_t>&& message, std::unique_ptr<rmm::device_buffer>&& packed)
+    : _message(std::move(message)), _packed(std::move(packed))
+  {
+  }
+
+  /**
+   * @brief Returns the bytes to send to the importing processes: the CUDA IPC memory handle of
+   * the device allocation holding the table, followed by the `packed_columns::metadata` of the
+   * table relative to the start of that allocation.
+   */
+  std::vector<uint8_t> const& message() const noexcept { return _message; }
+
+  /**
+   * @brief Returns whether the table was copied into a new allocation to be exported.
+   */
+  bool is_copy() const noexcept { return _packed != nullptr; }
+
+ private:
+  std::vector<uint8_t> _message;
+  std::unique_ptr<rmm::device_buffer> _packed;  // the copy of the table, if one was needed
+};
+
+/**
+ * @brief A table of another process opened by `import_ipc`.
+ *
+ * The device memory of the exporting process is mapped into this process until this object is
+ * destroyed, which is when the views returned by `view` become invalid.
+ */
+class ipc_imported_table {
+ public:
+  ipc_imported_table(void* base, table_view const& view) : _base(base), _view(view) {}
+  ipc_imported_table(ipc_imported_table const&) = delete;
+  ipc_imported_table& operator=(ipc_imported_table const&) = delete;
+  ~ipc_imported_table();
+
+  /**
+   * @brief Returns the view of the imported table.
+   */
+  table_view view() const noexcept { return _view; }
+
+ private:
+  void* _base;  // the mapped allocation, or nullptr if the table has no device data
+  table_view _view;
+};
+
+/**
+ * @brief Exports a table for other processes on the same device.
+ *
+ * No device memory is copied if all the columns of `input` and of their children start at offset
+ * 0 and lie in one device allocation made with `cudaMalloc`, such as the tables unpacked from a
+ * `packed_columns`, or any table allocated from a pool memory resource. The whole allocation is
+ * then shared with the importing processes. Otherwise `input` is packed once into a new
+ * allocation, which the returned object owns.
+ *
+ * @param input The table to export
+ * @return The exported table, whose `message` is sent to the importing processes
+ */
+ipc_exported_table export_ipc(table_view const& input);
+
+/**
+ * @brief Opens a table exported by another process with `export_ipc`.
+ *
+ * The device memory of the table is mapped into this process without being copied.
+ *
+ * @throw cudf::logic_error if `message` is too short to be a message of `export_ipc`
+ * @throw cudf::cuda_error if the memory handle cannot be opened on the current device
+ *
+ * @param message The message of the exported table
+ * @return The imported table, which keeps the device memory mapped while it lives
+ */
+std::unique_ptr<ipc_imported_table> import_ipc(std::vector<uint8_t> const& message);
+
+/** @} */  // end of group
+}  // namespace comms
+}  // namespace cudf
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/copying.hpp>
+#include <cudf/hashing.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace comms {
+/**
+ * @addtogroup reorder_partition
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Interface of the transport used by `shuffle` to exchange packed partitions between the
+ * ranks of a group of processes.
+ *
+ * Both operations are collective: every rank of the group must call them the same number of
+ * times and in the same order. Implementations may wrap NCCL, UCX, CUDA IPC or any other means
+ * of moving device buffers between ranks.
+ */
+class shuffle_transport {
+ public:
+  virtual ~shuffle_transport() = default;
+
+  /**
+   * @brief Returns the rank of this process in the group.
+   */
+  virtual int rank() const = 0;
+
+  /**
+   * @brief Returns the number of ranks in the group.
+   */
+  virtual int num_ranks() const = 0;
+
+  /**
+   * @brief Sends `partitions[r]` to each rank `r` and returns the partitions sent to this rank,
+   * indexed by the rank that sent them.
+   *
+   * @param partitions The packed partition to send to each rank, indexed by rank
+   * @param stream CUDA stream on which the device buffers of `partitions` were written
+   * @return The packed partition received from each rank
+   */
+  virtual std::vector<packed_columns> all_to_all(std::vector<packed_columns>&& partitions,
+                                                 rmm::cuda_stream_view stream) = 0;
+
+  /**
+   * @brief Returns the maximum of `value` over all the ranks.
+   */
+  virtual int64_t all_reduce_max(int64_t value) = 0;
+};
+
+/**
+ * @brief Transport of a group with a single rank, which receives the partition it sends to
+ * itself.
+ */
+class loopback_transport : public shuffle_transport {
+ public:
+  int rank() const override { return 0; }
+  int num_ranks() const override { return 1; }
+  std::vector<packed_columns> all_to_all(std::vector<packed_columns>&& partitions,
+                                         rmm::cuda_stream_view) override
+  {
+    return std::move(partitions);
+  }
+  int64_t all_reduce_max(int64_t value) override { return value; }
+};
+
+/**
+ * @brief Function that partitions the rows of a table into a number of partitions, returning the
+ * partitioned table and the offset of each partition, like `cudf::hash_partition`.
+ */
+using partition_function = std::function<std::pair<std::unique_ptr<table>, std::vector<size_type>>(
+  table_view const&, int)>;
+
+/**
+ * @brief Returns a partition function that hash partitions the rows on `columns_to_hash`.
+ *
+ * @param columns_to_hash Indices of input columns to hash
+ * @param hash_function Optional hash id that chooses the hash function to use
+ * @param seed Optional seed value to the hash function
+ */
+partition_function hash_partitioner(std::vector<size_type> const& columns_to_hash,
+                                    hash_id hash_function = hash_id::HASH_MURMUR3,
+                                    uint32_t seed         = DEFAULT_HASH_SEED);
+
+/**
+ * @brief Exchanges the rows of `input` between the ranks of `transport`, so that each rank ends up
+ * with the rows that `partition` assigns to it from all the ranks.
+ *
+ * The input is processed in chunks of at most `max_chunk_rows` rows. Each chunk is partitioned
+ * into one partition per rank, the partitions are packed into contiguous buffers and exchanged
+ * with `transport.all_to_all`, and the received buffers are kept until all the chunks of all the
+ * ranks have been exchanged. This bounds the memory used for partitioning and packing to a chunk
+ * however large `input` is. The received partitions are then concatenated.
+ *
+ * This is a collective operation: every rank of `transport` must call it, with tables of the same
+ * schema and the same `max_chunk_rows`.
+ *
+ * @throw cudf::logic_error if `max_chunk_rows` is not positive
+ * @throw cudf::logic_error if `partition` or `transport` does not return a partition per rank
+ *
+ * @param input The rows of this rank
+ * @param partition The function that partitions the rows into one partition per rank
+ * @param transport The transport used to exchange the partitions
+ * @param max_chunk_rows The maximum number of rows to partition and exchange at once
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The rows received from all the ranks
+ */
+std::unique_ptr<table> shuffle(
+  table_view const& input,
+  partition_function const& partition,
+  shuffle_transport& transport,
+  size_type max_chunk_rows            = 1 << 22,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace comms
+}  // namespace cudf
@@ -20,7 +20,9 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -81,6 +83,37 @@ std::unique_ptr<table> gather(
   out_of_bounds_policy bounds_policy  = out_of_bounds_policy::DONT_CHECK,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Gathers the specified rows of a set of fixed-width columns into preallocated columns.
+ *
+ * @ingroup copy_gather
+ *
+ * Same as `gather` above, except that row "i" of the gathered columns is written to row "i" of
+ * the columns of `output` instead of a new table, so that no output memory is allocated.
+ *
+ * The null masks of the output columns are written only if they are nullable. Each output
+ * column must be nullable, without an offset, when its source column has nulls or when
+ * `bounds_policy` is `NULLIFY`. The null counts of the views in `output` are updated.
+ *
+ * @throws cudf::logic_error if gather_map contains null values.
+ * @throws cudf::logic_error if the number of columns or their types differ between
+ * `source_table` and `output`, or if the number of rows of `output` is not the size of
+ * `gather_map`.
+ * @throws cudf::logic_error if a column is not fixed-width.
+ * @throws cudf::logic_error if an output column that can receive nulls is not nullable.
+ *
+ * @param[in] source_table The input columns whose rows will be gathered
+ * @param[in] gather_map View into a non-nullable column of integral indices that maps the
+ * rows in the source columns to rows in the destination columns.
+ * @param[in,out] output Columns into which the rows are gathered
+ * @param[in] bounds_policy Policy to apply to account for possible out-of-bounds indices, as in
+ * `gather` above. Defaults to `DONT_CHECK`.
+ */
+void gather(table_view const& source_table,
+            column_view const& gather_map,
+            mutable_table_view& output,
+            out_of_bounds_policy bounds_policy = out_of_bounds_policy::DONT_CHECK);
+
 /**
  * @brief Scatters the rows of the source table into a copy of the target table
  * according to a scatter map.
@@ -568,6 +601,57 @@ std::vector<packed_table> contiguous_split(
   std::vector<size_type> const& splits,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief A region of the contiguous buffer of a partition, packed into a bounce buffer by
+ * `chunked_contiguous_split`
+ *
+ * @ingroup copy_split
+ */
+struct packed_region {
+  size_type partition;           ///< Index of the partition
+  std::size_t partition_size;    ///< Size in bytes of the contiguous buffer of the partition
+  std::size_t partition_offset;  ///< Offset of the region in the contiguous buffer of the partition
+  std::size_t buffer_offset;     ///< Offset of the region in the bounce buffer
+  std::size_t size;              ///< Size of the region in bytes
+};
+
+/**
+ * @brief Performs a deep-copy split of a `table_view` like `contiguous_split`, packing the data of
+ * the partitions into a sequence of caller-supplied bounce buffers rather than into one new
+ * allocation per partition.
+ *
+ * @ingroup copy_split
+ *
+ * The contiguous buffers that `contiguous_split` would allocate for the partitions are laid out
+ * one after the other and packed in order into `buffers`, taking each buffer in turn and filling
+ * it with as many whole column buffers as fit. After each buffer is filled, `packed_callback` is
+ * called with the index of the buffer and the regions of the partitions it holds, in order. The
+ * contiguous buffer of a partition is rebuilt by copying each of its regions to
+ * `partition_offset`, and then unpacked with the metadata of the partition returned by this
+ * function.
+ *
+ * The device memory used does not depend on the number of partitions, and sending the packed
+ * buffers may be pipelined with packing: a buffer is packed again after all the other buffers,
+ * so `packed_callback` must return only once the data packed in the previous use of the next
+ * buffer is no longer needed.
+ *
+ * @throws cudf::logic_error for the same reasons as `contiguous_split`.
+ * @throws cudf::logic_error if `buffers` is empty or a buffer is not aligned to 64 bytes.
+ * @throws cudf::logic_error if the data of a column of a partition does not fit in a buffer.
+ *
+ * @param input View of a table to split
+ * @param splits A vector of indices where the view will be split
+ * @param buffers The device bounce buffers to pack the partitions into
+ * @param packed_callback Function called with the index of a buffer and the regions of the
+ * partitions it holds, each time a buffer is packed
+ * @return The metadata to `unpack` each partition from its contiguous buffer
+ */
+std::vector<packed_columns::metadata> chunked_contiguous_split(
+  cudf::table_view const& input,
+  std::vector<size_type> const& splits,
+  std::vector<device_span<uint8_t>> const& buffers,
+  std::function<void(std::size_t, std::vector<packed_region> const&)> const& packed_callback);
+
 /**
  * @brief Deep-copy a `table_view` into a serialized contiguous memory format
  *
@@ -583,6 +667,55 @@ std::vector<packed_table> contiguous_split(
 packed_columns pack(cudf::table_view const& input,
                     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Codec used by `pack` to compress the contiguous data buffer
+ *
+ * @ingroup copy_split
+ */
+enum class pack_compression : int32_t {
+  NONE,     ///< No compression
+  SNAPPY,   ///< Snappy
+  DEFLATE,  ///< Raw DEFLATE stream, without GZIP or ZLIB header
+  ZSTD      ///< Zstandard
+};
+
+/**
+ * @brief Deep-copy a `table_view` into a serialized contiguous memory format, compressing the
+ * contiguous data buffer on the device
+ *
+ * The data buffer of `pack(input)` is split into blocks of 64KB that are compressed independently
+ * with `compression`. Blocks that do not shrink are stored uncompressed. The codec and the
+ * location of each block are recorded in the metadata, after the metadata of the uncompressed
+ * pack. The result must be passed to `cudf::decompress_packed` before it is unpacked.
+ *
+ * @throws cudf::logic_error if the compression of a block fails
+ *
+ * @param input View of the table to pack
+ * @param compression The codec to compress the data buffer with
+ * @param[in] mr Optional, The resource to use for all returned device allocations
+ * @return packed_columns A struct containing the serialized metadata and the compressed data in
+ *         contiguous host and device memory respectively
+ */
+packed_columns pack(cudf::table_view const& input,
+                    pack_compression compression,
+                    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Decompress on the device the result of `cudf::pack` with compression
+ *
+ * The result can be passed to `cudf::unpack`. If `input` is not compressed, a copy of `input` is
+ * returned.
+ *
+ * @throws cudf::logic_error if the decompression of a block fails
+ *
+ * @param input The packed columns to decompress
+ * @param[in] mr Optional, The resource to use for all returned device allocations
+ * @return packed_columns The uncompressed packed columns
+ */
+packed_columns decompress_packed(
+  packed_columns const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Produce the metadata used for packing a table stored in a contiguous buffer.
  *
@@ -611,6 +744,8 @@ packed_columns::metadata pack_metadata(table_view const& table,
  *
  * No new device memory is allocated in this function.
  *
+ * @throws cudf::logic_error if `input` is compressed; see `cudf::decompress_packed`
+ *
  * @param input The packed columns to unpack
  * @return The unpacked `table_view`
  */
@@ -730,6 +865,66 @@ std::unique_ptr<column> copy_if_else(
   column_view const& boolean_mask,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Writes each element selected from either @p lhs or @p rhs based on the value of the
+ *        corresponding element in @p boolean_mask into the preallocated column @p output
+ *
+ * Same as the `copy_if_else` overloads returning a new column, except that no output memory is
+ * allocated. Only fixed-width types are supported. If either input has nulls, @p output must be
+ * nullable and have no offset; otherwise the null mask of @p output, if any, is set to all valid.
+ * The null count of @p output is updated.
+ *
+ * @throws cudf::logic_error if lhs, rhs and output are not of the same fixed-width type
+ * @throws cudf::logic_error if lhs, rhs, boolean_mask and output are not of the same size
+ * @throws cudf::logic_error if boolean mask is not of type bool
+ * @throws cudf::logic_error if the inputs have nulls and output is not nullable
+ * @param[in] lhs left-hand column_view
+ * @param[in] rhs right-hand column_view
+ * @param[in] boolean_mask column of `type_id::BOOL8` representing "left (true) / right (false)"
+ * boolean for each element. null element represents false.
+ * @param[in,out] output column the selected elements are written to
+ */
+void copy_if_else(column_view const& lhs,
+                  column_view const& rhs,
+                  column_view const& boolean_mask,
+                  mutable_column_view& output);
+
+/**
+ * @copydoc cudf::copy_if_else(column_view const&,column_view const&,column_view const&,
+ * mutable_column_view&)
+ *
+ * @param[in] lhs left-hand scalar
+ * @param[in] rhs right-hand column_view
+ */
+void copy_if_else(scalar const& lhs,
+                  column_view const& rhs,
+                  column_view const& boolean_mask,
+                  mutable_column_view& output);
+
+/**
+ * @copydoc cudf::copy_if_else(column_view const&,column_view const&,column_view const&,
+ * mutable_column_view&)
+ *
+ * @param[in] lhs left-hand column_view
+ * @param[in] rhs right-hand scalar
+ */
+void copy_if_else(column_view const& lhs,
+                  scalar const& rhs,
+                  column_view const& boolean_mask,
+                  mutable_column_view& output);
+
+/**
+ * @copydoc cudf::copy_if_else(column_view const&,column_view const&,column_view const&,
+ * mutable_column_view&)
+ *
+ * @param[in] lhs left-hand scalar
+ * @param[in] rhs right-hand scalar
+ */
+void copy_if_else(scalar const& lhs,
+                  scalar const& rhs,
+                  column_view const& boolean_mask,
+                  mutable_column_view& output);
+
 /**
  * @brief Scatters rows from the input table to rows of the output corresponding
  * to true values in a boolean mask.
@@ -869,5 +1064,35 @@ std::unique_ptr<table> sample(
   int64_t const seed                  = 0,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Samples each row of `input` independently with probability `fraction`
+ *
+ * The number of sampled rows is random, with an expected value of
+ * `fraction * input.num_rows()`. The sampled rows are in the order of `input`. Sampling takes a
+ * single pass over the row indices and needs memory only for the indices of the sampled rows.
+ *
+ * @code{.pseudo}
+ * Example:
+ * input: {col1: {1, 2, 3, 4, 5}, col2: {6, 7, 8, 9, 10}}
+ * fraction: 0.4
+ *
+ * output:       {col1: {2, 5}, col2: {7, 10}}
+ * @endcode
+ *
+ * @throws cudf::logic_error if `fraction` is not in the range [0, 1].
+ *
+ * @param input View of a table to sample.
+ * @param fraction Probability of sampling each row.
+ * @param seed Seed value to initiate random number generator.
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @return std::unique_ptr<table> Table containing samples from `input`
+ */
+std::unique_ptr<table> bernoulli_sample(
+  table_view const& input,
+  double fraction,
+  int64_t const seed                  = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */
 }  // namespace cudf
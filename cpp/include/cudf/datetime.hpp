@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,8 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 /**
  * @file datetime.hpp
@@ -33,6 +35,19 @@ namespace datetime {
  * @file
  */
 
+/**
+ * @brief Datetime components that can be extracted with `extract_datetime_components`.
+ */
+enum class datetime_component : int32_t {
+  YEAR,     ///< Year
+  MONTH,    ///< Month of the year, 1 to 12
+  DAY,      ///< Day of the month, 1 to 31
+  WEEKDAY,  ///< ISO day of the week, 1 (Monday) to 7 (Sunday)
+  HOUR,     ///< Hour of the day, 0 to 23
+  MINUTE,   ///< Minute of the hour, 0 to 59
+  SECOND    ///< Second of the minute, 0 to 59
+};
+
 /**
  * @brief  Extracts year from any date time type and returns an int16_t
  * cudf::column.
@@ -124,6 +139,31 @@ std::unique_ptr<cudf::column> extract_second(
   cudf::column_view const& column,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief  Extracts several components from any date time type in a single pass and returns a
+ * table of int16_t columns, one per requested component, in the order of `components`.
+ *
+ * The date is computed from the timestamp once per row for all the components, instead of once
+ * per component as with separate `extract_*` calls.
+ *
+ * @code{.pseudo}
+ * Example:
+ * column = [2018-07-04 12:00:00, 2023-01-25 07:32:12]
+ * r = extract_datetime_components(column, {YEAR, MONTH, HOUR})
+ * r is {[2018, 2023], [7, 1], [12, 7]}
+ * @endcode
+ *
+ * @param[in] column cudf::column_view of the input datetime values
+ * @param[in] components Components to extract; a component may be repeated
+ *
+ * @returns cudf::table of the extracted int16_t components
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ */
+std::unique_ptr<cudf::table> extract_datetime_components(
+  cudf::column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 /**
  * @addtogroup datetime_compute
@@ -189,6 +229,66 @@ std::unique_ptr<cudf::column> add_calendrical_months(
   cudf::column_view const& timestamps,
   cudf::column_view const& months,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief  Converts UTC timestamps to the local time of the given timezone and returns a
+ * timestamp column that is of the same type as the input `timestamps` column.
+ *
+ * The offset from UTC, including daylight saving time, is looked up in the system TZif file of
+ * the timezone. Transition tables are cached on the device for the lifetime of the process, so
+ * repeated conversions to the same timezone do not read the file again. Timestamps after the last
+ * transition in the file follow the rule from the file's POSIX TZ string.
+ *
+ * @code{.pseudo}
+ * Example:
+ * timestamps = [1/1/20 00:00:00, 7/1/20 00:00:00]
+ * r = convert_utc_to_timezone(timestamps, "America/Los_Angeles")
+ * r is [12/31/19 16:00:00, 6/30/20 17:00:00]
+ * @endcode
+ *
+ * @param[in] timestamps cudf::column_view of timestamp type.
+ * @param[in] timezone_name Standard timezone name, for example "US/Pacific"; "UTC" and the empty
+ * string leave the timestamps unchanged.
+ *
+ * @returns cudf::column of timestamp type containing the local timestamps.
+ * @throw cudf::logic_error if `timestamps` datatype is not a TIMESTAMP.
+ * @throw cudf::logic_error if the TZif file for `timezone_name` cannot be read.
+ */
+std::unique_ptr<cudf::column> convert_utc_to_timezone(
+  cudf::column_view const& timestamps,
+  std::string const& timezone_name,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief  Converts timestamps from the local time of one timezone to the local time of another
+ * and returns a timestamp column that is of the same type as the input `timestamps` column.
+ *
+ * Both timezones use the cached device transition tables of `convert_utc_to_timezone`. Local
+ * times that occur twice, when the clocks are set back, are taken as the later of the two. Local
+ * times that are skipped, when the clocks are set forward, are shifted by the change of offset.
+ *
+ * @code{.pseudo}
+ * Example:
+ * timestamps = [1/1/20 00:00:00, 7/1/20 00:00:00]
+ * r = convert_timezone(timestamps, "America/Los_Angeles", "America/New_York")
+ * r is [1/1/20 03:00:00, 7/1/20 03:00:00]
+ * @endcode
+ *
+ * @param[in] timestamps cudf::column_view of timestamp type.
+ * @param[in] from_timezone Standard timezone name of the input timestamps; "UTC" and the empty
+ * string denote UTC.
+ * @param[in] to_timezone Standard timezone name of the output timestamps; "UTC" and the empty
+ * string denote UTC.
+ *
+ * @returns cudf::column of timestamp type containing the converted timestamps.
+ * @throw cudf::logic_error if `timestamps` datatype is not a TIMESTAMP.
+ * @throw cudf::logic_error if the TZif file of either timezone cannot be read.
+ */
+std::unique_ptr<cudf::column> convert_timezone(
+  cudf::column_view const& timestamps,
+  std::string const& from_timezone,
+  std::string const& to_timezone,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 /** @} */  // end of group
 }  // namespace datetime
 }  // namespace cudf
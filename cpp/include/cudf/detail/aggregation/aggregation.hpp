@@ -374,6 +374,79 @@ struct collect_set_aggregation final : derived_aggregation<collect_set_aggregati
   }
 };
 
+/**
+ * @brief Derived aggregation class for specifying MERGE_SETS aggregation
+ */
+struct merge_sets_aggregation final : derived_aggregation<merge_sets_aggregation> {
+  explicit merge_sets_aggregation(null_equality nulls_equal = null_equality::EQUAL,
+                                  nan_equality nans_equal   = nan_equality::UNEQUAL)
+    : derived_aggregation{MERGE_SETS}, _nulls_equal(nulls_equal), _nans_equal(nans_equal)
+  {
+  }
+  null_equality _nulls_equal;  ///< whether to consider nulls as equal values
+  nan_equality _nans_equal;    ///< whether to consider NaNs as equal value (applicable only to
+                               ///< floating point types)
+
+ protected:
+  friend class derived_aggregation<merge_sets_aggregation>;
+
+  bool operator==(merge_sets_aggregation const& other) const
+  {
+    return _nulls_equal == other._nulls_equal && _nans_equal == other._nans_equal;
+  }
+
+  size_t hash_impl() const
+  {
+    return std::hash<int>{}(static_cast<int>(_nulls_equal) ^ static_cast<int>(_nans_equal));
+  }
+};
+
+/**
+ * @brief Derived aggregation class for specifying APPROX_COUNT_DISTINCT and HLL_SKETCH
+ * aggregations
+ */
+struct hll_aggregation final : derived_aggregation<hll_aggregation> {
+  hll_aggregation(aggregation::Kind k, int precision)
+    : derived_aggregation{k}, _precision{precision}
+  {
+    CUDF_EXPECTS(k == aggregation::APPROX_COUNT_DISTINCT or k == aggregation::HLL_SKETCH,
+                 "hll_aggregation can accept only APPROX_COUNT_DISTINCT, HLL_SKETCH");
+    CUDF_EXPECTS(precision >= 4 and precision <= 18, "HyperLogLog precision must be in [4, 18]");
+  }
+  int _precision;  ///< Number of hash bits selecting one of the `2^precision` registers
+
+ protected:
+  friend class derived_aggregation<hll_aggregation>;
+
+  bool operator==(hll_aggregation const& other) const { return _precision == other._precision; }
+
+  size_t hash_impl() const { return std::hash<int>{}(_precision); }
+};
+
+/**
+ * @brief Derived aggregation class for specifying TDIGEST and MERGE_TDIGEST aggregations
+ */
+struct tdigest_aggregation final : derived_aggregation<tdigest_aggregation> {
+  tdigest_aggregation(aggregation::Kind k, int max_centroids)
+    : derived_aggregation{k}, _max_centroids{max_centroids}
+  {
+    CUDF_EXPECTS(k == aggregation::TDIGEST or k == aggregation::MERGE_TDIGEST,
+                 "tdigest_aggregation can accept only TDIGEST, MERGE_TDIGEST");
+    CUDF_EXPECTS(max_centroids > 0, "t-digest max_centroids must be positive");
+  }
+  int _max_centroids;  ///< Maximum number of centroids of a digest
+
+ protected:
+  friend class derived_aggregation<tdigest_aggregation>;
+
+  bool operator==(tdigest_aggregation const& other) const
+  {
+    return _max_centroids == other._max_centroids;
+  }
+
+  size_t hash_impl() const { return std::hash<int>{}(_max_centroids); }
+};
+
 /**
  * @brief Sentinel value used for `ARGMAX` aggregation.
  *
@@ -548,6 +621,24 @@ struct target_type_impl<Source, aggregation::ROW_NUMBER> {
   using type = cudf::size_type;
 };
 
+// Always use size_type accumulator for RANK
+template <typename Source>
+struct target_type_impl<Source, aggregation::RANK> {
+  using type = cudf::size_type;
+};
+
+// Always use size_type accumulator for DENSE_RANK
+template <typename Source>
+struct target_type_impl<Source, aggregation::DENSE_RANK> {
+  using type = cudf::size_type;
+};
+
+// Always use `double` for PERCENT_RANK
+template <typename Source>
+struct target_type_impl<Source, aggregation::PERCENT_RANK> {
+  using type = double;
+};
+
 // Always use list for COLLECT_LIST
 template <typename Source>
 struct target_type_impl<Source, aggregation::COLLECT_LIST> {
@@ -572,6 +663,86 @@ struct target_type_impl<Source, aggregation::LAG> {
   using type = Source;
 };
 
+// Always use `double` for M2
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::M2,
+                        std::enable_if_t<std::is_arithmetic<Source>::value>> {
+  using type = double;
+};
+
+// Merging M2 states produces a struct of the same layout
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::MERGE_M2,
+                        std::enable_if_t<std::is_same<Source, cudf::struct_view>::value>> {
+  using type = cudf::struct_view;
+};
+
+// Merging lists produces a list
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::MERGE_LISTS,
+                        std::enable_if_t<std::is_same<Source, cudf::list_view>::value>> {
+  using type = cudf::list_view;
+};
+
+// Merging sets produces a list
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::MERGE_SETS,
+                        std::enable_if_t<std::is_same<Source, cudf::list_view>::value>> {
+  using type = cudf::list_view;
+};
+
+// HyperLogLog sketches can be built from the elements of any hashable type
+template <typename Source>
+constexpr bool is_hll_hashable()
+{
+  return (is_numeric<Source>() or is_chrono<Source>() or
+          std::is_same<Source, cudf::string_view>::value);
+}
+
+// Always use `int64_t` for APPROX_COUNT_DISTINCT
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::APPROX_COUNT_DISTINCT,
+                        std::enable_if_t<is_hll_hashable<Source>()>> {
+  using type = int64_t;
+};
+
+// A HyperLogLog sketch is a list of `uint8_t` registers
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::HLL_SKETCH,
+                        std::enable_if_t<is_hll_hashable<Source>()>> {
+  using type = cudf::list_view;
+};
+
+// Merging HyperLogLog sketches produces a sketch
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::MERGE_HLL_SKETCH,
+                        std::enable_if_t<std::is_same<Source, cudf::list_view>::value>> {
+  using type = cudf::list_view;
+};
+
+// A t-digest is a struct of its centroids, minimum and maximum
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::TDIGEST,
+                        std::enable_if_t<std::is_arithmetic<Source>::value>> {
+  using type = cudf::struct_view;
+};
+
+// Merging t-digests produces a t-digest
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::MERGE_TDIGEST,
+                        std::enable_if_t<std::is_same<Source, cudf::struct_view>::value>> {
+  using type = cudf::struct_view;
+};
+
 /**
  * @brief Helper alias to get the accumulator type for performing aggregation
  * `k` on elements of type `Source`
@@ -665,6 +836,30 @@ CUDA_HOST_DEVICE_CALLABLE decltype(auto) aggregation_dispatcher(aggregation::Kin
       return f.template operator()<aggregation::LEAD>(std::forward<Ts>(args)...);
     case aggregation::LAG:
       return f.template operator()<aggregation::LAG>(std::forward<Ts>(args)...);
+    case aggregation::M2:
+      return f.template operator()<aggregation::M2>(std::forward<Ts>(args)...);
+    case aggregation::MERGE_M2:
+      return f.template operator()<aggregation::MERGE_M2>(std::forward<Ts>(args)...);
+    case aggregation::MERGE_LISTS:
+      return f.template operator()<aggregation::MERGE_LISTS>(std::forward<Ts>(args)...);
+    case aggregation::MERGE_SETS:
+      return f.template operator()<aggregation::MERGE_SETS>(std::forward<Ts>(args)...);
+    case aggregation::APPROX_COUNT_DISTINCT:
+      return f.template operator()<aggregation::APPROX_COUNT_DISTINCT>(std::forward<Ts>(args)...);
+    case aggregation::HLL_SKETCH:
+      return f.template operator()<aggregation::HLL_SKETCH>(std::forward<Ts>(args)...);
+    case aggregation::MERGE_HLL_SKETCH:
+      return f.template operator()<aggregation::MERGE_HLL_SKETCH>(std::forward<Ts>(args)...);
+    case aggregation::TDIGEST:
+      return f.template operator()<aggregation::TDIGEST>(std::forward<Ts>(args)...);
+    case aggregation::MERGE_TDIGEST:
+      return f.template operator()<aggregation::MERGE_TDIGEST>(std::forward<Ts>(args)...);
+    case aggregation::RANK:
+      return f.template operator()<aggregation::RANK>(std::forward<Ts>(args)...);
+    case aggregation::DENSE_RANK:
+      return f.template operator()<aggregation::DENSE_RANK>(std::forward<Ts>(args)...);
+    case aggregation::PERCENT_RANK:
+      return f.template operator()<aggregation::PERCENT_RANK>(std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported aggregation.");
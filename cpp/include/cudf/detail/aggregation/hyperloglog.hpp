@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Builds the HyperLogLog sketch of the valid elements of each group.
+ *
+ * Each valid element is hashed with a 32-bit MurmurHash3. The top `precision` bits of the hash
+ * select one of the `2^precision` registers of the sketch, which keeps the maximum over its
+ * elements of the number of leading zeros of the remaining hash bits plus one. The registers of a
+ * group without valid elements are all zero.
+ *
+ * @param values Grouped values to sketch
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param num_groups Number of groups
+ * @param precision Number of hash bits selecting a register, in `[4, 18]`
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return LIST<UINT8> column of `num_groups` sketches of `2^precision` registers each
+ */
+std::unique_ptr<column> group_hll_sketch(column_view const& values,
+                                         cudf::device_span<size_type const> group_labels,
+                                         size_type num_groups,
+                                         int precision,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Estimates the number of distinct valid elements of each group with a HyperLogLog
+ * sketch.
+ *
+ * Equivalent to estimating the sketches built by `group_hll_sketch`, without materializing the
+ * registers that no element updates.
+ *
+ * @code{.pseudo}
+ * values       = ["a", "b", "a", "c", null]
+ * group_labels = [ 0,   0,   0,   1,   1  ]
+ * num_groups   = 2
+ *
+ * result       = [2, 1]
+ * @endcode
+ *
+ * @param values Grouped values to count
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param num_groups Number of groups
+ * @param precision Number of hash bits selecting a register, in `[4, 18]`
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return INT64 column of `num_groups` estimates
+ */
+std::unique_ptr<column> group_approx_count_distinct(column_view const& values,
+                                                    cudf::device_span<size_type const> group_labels,
+                                                    size_type num_groups,
+                                                    int precision,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Merges the HyperLogLog sketches of each group by taking the maximum of each register.
+ *
+ * Null sketches are ignored. All valid sketches must have the same number of registers.
+ *
+ * @code{.pseudo}
+ * sketches      = [[0, 2, 0, 1], [1, 1, 0, 3], null, [0, 0, 4, 0]]
+ * group_offsets = [0, 3, 4]
+ * num_groups    = 2
+ *
+ * result        = [[1, 2, 0, 3], [0, 0, 4, 0]]
+ * @endcode
+ *
+ * @throws cudf::logic_error if `sketches` is not a LIST<UINT8> column or if the valid sketches
+ * have different sizes
+ *
+ * @param sketches Grouped sketches to merge
+ * @param group_offsets Offsets of groups' starting points within @p sketches
+ * @param num_groups Number of groups
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return LIST<UINT8> column of `num_groups` merged sketches
+ */
+std::unique_ptr<column> group_merge_hll_sketch(column_view const& sketches,
+                                               cudf::device_span<size_type const> group_offsets,
+                                               size_type num_groups,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::approx_distinct_count(lists_column_view const&, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> approx_distinct_count(
+  lists_column_view const& sketches,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Builds the t-digest of the valid values of each group.
+ *
+ * The sorted values of a group are clustered by their quantile with the `k1` scale function
+ * `k(q) = max_centroids / pi * (asin(2q - 1) + pi / 2)`, so that the centroids are small near the
+ * extremes of the distribution and larger around its median.
+ *
+ * @code{.pseudo}
+ * sorted_values = [1, 2, 3, null, 5, 6]
+ * group_offsets = [0, 4, 6]
+ * group_sizes   = [3, 2]
+ * max_centroids = 1000
+ *
+ * result        = [{[{1, 1}, {2, 1}, {3, 1}], 1, 3}, {[{5, 1}, {6, 1}], 5, 6}]
+ * @endcode
+ *
+ * @param sorted_values Values sorted within each group, with the nulls last
+ * @param group_sizes Number of valid values per group
+ * @param group_offsets Offsets of groups' starting points within @p sorted_values
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param num_groups Number of groups
+ * @param max_centroids Maximum number of centroids of a digest
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Structs column `[LIST<STRUCT<mean, weight>>, min, max]` of `num_groups` digests
+ */
+std::unique_ptr<column> group_tdigest(column_view const& sorted_values,
+                                      column_view const& group_sizes,
+                                      cudf::device_span<size_type const> group_offsets,
+                                      cudf::device_span<size_type const> group_labels,
+                                      size_type num_groups,
+                                      int max_centroids,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Merges the t-digests of each group into one t-digest.
+ *
+ * The centroids of the digests of a group are sorted by mean and clustered again like the values
+ * of `group_tdigest`, weighted by the centroid weights.
+ *
+ * @throws cudf::logic_error if `digests` is not a column of t-digests
+ *
+ * @param digests Grouped digests to merge
+ * @param group_labels ID of group that the corresponding digest belongs to
+ * @param num_groups Number of groups
+ * @param max_centroids Maximum number of centroids of a merged digest
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Structs column `[LIST<STRUCT<mean, weight>>, min, max]` of `num_groups` digests
+ */
+std::unique_ptr<column> group_merge_tdigest(column_view const& digests,
+                                            cudf::device_span<size_type const> group_labels,
+                                            size_type num_groups,
+                                            int max_centroids,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::percentile_approx(column_view const&, std::vector<double> const&,
+ *                                  rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> percentile_approx(
+  column_view const& digests,
+  std::vector<double> const& percentiles,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+}  // namespace detail
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -78,5 +78,41 @@ std::unique_ptr<column> binary_operation(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::binary_operation(scalar const&, column_view const&, binary_operator,
+ * mutable_column_view&)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void binary_operation(scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output,
+                      rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::binary_operation(column_view const&, scalar const&, binary_operator,
+ * mutable_column_view&)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void binary_operation(column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output,
+                      rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::binary_operation(column_view const&, column_view const&, binary_operator,
+ * mutable_column_view&)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void binary_operation(column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output,
+                      rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 }  // namespace detail
 }  // namespace cudf
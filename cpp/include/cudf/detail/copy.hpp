@@ -140,6 +140,18 @@ std::vector<packed_table> contiguous_split(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::chunked_contiguous_split
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+std::vector<packed_columns::metadata> chunked_contiguous_split(
+  cudf::table_view const& input,
+  std::vector<size_type> const& splits,
+  std::vector<device_span<uint8_t>> const& buffers,
+  std::function<void(std::size_t, std::vector<packed_region> const&)> const& packed_callback,
+  rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 /**
  * @copydoc cudf::pack
  *
@@ -149,6 +161,27 @@ packed_columns pack(cudf::table_view const& input,
                     rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
                     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::pack(cudf::table_view const&, pack_compression,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream Optional CUDA stream on which to execute kernels
+ **/
+packed_columns pack(cudf::table_view const& input,
+                    pack_compression compression,
+                    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+                    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::decompress_packed
+ *
+ * @param stream Optional CUDA stream on which to execute kernels
+ **/
+packed_columns decompress_packed(
+  packed_columns const& input,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::allocate_like(column_view const&, size_type, mask_allocation_policy,
  * rmm::mr::device_memory_resource*)
@@ -214,6 +247,54 @@ std::unique_ptr<column> copy_if_else(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::copy_if_else(column_view const&,column_view const&,column_view const&,
+ * mutable_column_view&)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void copy_if_else(column_view const& lhs,
+                  column_view const& rhs,
+                  column_view const& boolean_mask,
+                  mutable_column_view& output,
+                  rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::copy_if_else(scalar const&,column_view const&,column_view const&,
+ * mutable_column_view&)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void copy_if_else(scalar const& lhs,
+                  column_view const& rhs,
+                  column_view const& boolean_mask,
+                  mutable_column_view& output,
+                  rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::copy_if_else(column_view const&,scalar const&,column_view const&,
+ * mutable_column_view&)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void copy_if_else(column_view const& lhs,
+                  scalar const& rhs,
+                  column_view const& boolean_mask,
+                  mutable_column_view& output,
+                  rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::copy_if_else(scalar const&,scalar const&,column_view const&,
+ * mutable_column_view&)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void copy_if_else(scalar const& lhs,
+                  scalar const& rhs,
+                  column_view const& boolean_mask,
+                  mutable_column_view& output,
+                  rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 /**
  * @copydoc cudf::sample
  *
@@ -227,6 +308,18 @@ std::unique_ptr<table> sample(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::bernoulli_sample
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> bernoulli_sample(
+  table_view const& input,
+  double fraction,
+  int64_t const seed                  = 0,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::get_element
  *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,12 +23,16 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
@@ -36,10 +40,16 @@
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
 
 #include <cub/cub.cuh>
 
 #include <algorithm>
+#include <array>
 
 namespace {
 // Compute the count of elements that pass the mask within each block
@@ -203,6 +213,47 @@ __launch_bounds__(block_size) __global__
   }
 }
 
+// This kernel gathers the rows `gather_map` of several fixed-width columns whose elements have the
+// size of `T`, each column handled by one row of the grid. The gather map is read once for all the
+// columns. As the output rows are dense and `block_size` is a multiple of the warp size, each warp
+// writes whole words of the output validity masks, so no atomics are needed.
+template <typename T, int block_size>
+__launch_bounds__(block_size) __global__
+  void fused_gather_kernel(cudf::mutable_table_device_view output,
+                           cudf::size_type* null_counts,
+                           cudf::table_device_view input,
+                           cudf::size_type const* __restrict__ gather_map,
+                           cudf::size_type output_size)
+{
+  static_assert(block_size % cudf::detail::warp_size == 0,
+                "Block size must be a multiple of the warp size");
+  constexpr cudf::size_type leader_lane{0};
+
+  cudf::size_type const row    = threadIdx.x + block_size * blockIdx.x;
+  bool const in_range          = row < output_size;
+  cudf::size_type const source = in_range ? gather_map[row] : 0;
+
+  for (cudf::size_type c = blockIdx.y; c < input.num_columns(); c += gridDim.y) {
+    auto const& input_column = input.column(c);
+    auto& output_column      = output.column(c);
+    if (in_range) { output_column.data<T>()[row] = input_column.data<T>()[source]; }
+
+    if (output_column.nullable()) {
+      uint32_t const valid_warp =
+        __ballot_sync(0xffffffff, in_range && input_column.is_valid(source));
+      cudf::size_type warp_null_count{0};
+      if (in_range && threadIdx.x % cudf::detail::warp_size == leader_lane) {
+        output_column.null_mask()[cudf::word_index(row)] = valid_warp;
+        warp_null_count = min(output_size - row, cudf::detail::warp_size) - __popc(valid_warp);
+      }
+      cudf::size_type block_null_count =
+        cudf::detail::single_lane_block_sum_reduce<block_size, leader_lane>(warp_null_count);
+      if (threadIdx.x == 0) { atomicAdd(&null_counts[c], block_null_count); }
+      __syncthreads();  // the shared memory of the reduction is reused by the next column
+    }
+  }
+}
+
 template <typename T, typename Enable = void>
 struct DeviceType {
   using type = T;
@@ -240,7 +291,8 @@ struct scatter_gather_functor {
       input, output_size, cudf::mask_allocation_policy::RETAIN, stream, mr);
     auto output = output_column->mutable_view();
 
-    bool has_valid = input.nullable();
+    // a nullable input without nulls takes the kernel without validity
+    bool has_valid = input.has_nulls();
 
     using Type = typename DeviceType<T>::type;
 
@@ -252,9 +304,9 @@ struct scatter_gather_functor {
     rmm::device_scalar<cudf::size_type> null_count{0, stream};
     if (output.nullable()) {
       // Have to initialize the output mask to all zeros because we may update
-      // it with atomicOr().
+      // it with atomicOr(). Without nulls the kernel leaves it all valid.
       CUDA_TRY(cudaMemsetAsync(static_cast<void*>(output.null_mask()),
-                               0,
+                               has_valid ? 0 : 0xff,
                                cudf::bitmask_allocation_size_bytes(output.size()),
                                stream.value()));
     }
@@ -269,7 +321,7 @@ struct scatter_gather_functor {
                                                                 per_thread,
                                                                 filter);
 
-    if (has_valid) { output_column->set_null_count(null_count.value(stream)); }
+    output_column->set_null_count(has_valid ? null_count.value(stream) : 0);
     return output_column;
   }
 
@@ -308,6 +360,141 @@ struct scatter_gather_functor {
 
 namespace cudf {
 namespace detail {
+
+/**
+ * @brief Minimum number of fixed-width columns for `copy_if` to gather them with
+ * `fused_gather` rather than scatter each column separately.
+ */
+constexpr size_type fused_copy_if_min_columns = 4;
+
+/**
+ * @brief Returns the indices of the elements for which `filter` returns true, in increasing order
+ *
+ * @p filter must be a functor or lambda with the following signature:
+ * __device__ bool operator()(cudf::size_type i);
+ *
+ * @tparam Filter the filter functor type
+ * @param[in] size The number of elements to filter
+ * @param[in] filter A function object that takes an index and returns a bool
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @param[in] mr Device memory resource used to allocate the returned vector's device memory
+ * @return The gather map of the elements passing `filter`
+ */
+template <typename Filter>
+rmm::device_uvector<size_type> copy_if_gather_map(
+  size_type size,
+  Filter filter,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  auto const output_size = thrust::count_if(rmm::exec_policy(stream),
+                                            thrust::counting_iterator<size_type>(0),
+                                            thrust::counting_iterator<size_type>(size),
+                                            filter);
+  rmm::device_uvector<size_type> gather_map(output_size, stream, mr);
+  thrust::copy_if(rmm::exec_policy(stream),
+                  thrust::counting_iterator<size_type>(0),
+                  thrust::counting_iterator<size_type>(size),
+                  gather_map.begin(),
+                  filter);
+  return gather_map;
+}
+
+/**
+ * @brief Gathers the rows `gather_map` of `input`
+ *
+ * The fixed-width columns are gathered with one kernel for each element size, whatever their
+ * number, while the other columns are gathered separately with `detail::gather`.
+ *
+ * @param[in] input The table_view to gather from
+ * @param[in] gather_map The indices of the rows of `input` to gather, all in bounds
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return The table of the gathered rows
+ */
+inline std::unique_ptr<table> fused_gather(
+  table_view const& input,
+  device_span<size_type const> gather_map,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  constexpr int block_size = 256;
+  auto const output_size   = static_cast<size_type>(gather_map.size());
+  std::vector<std::unique_ptr<column>> out_columns(input.num_columns());
+
+  // Indices of the fixed-width columns with elements of 1, 2, 4 and 8 bytes
+  std::array<std::vector<size_type>, 4> fused_columns;
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const& col         = input.column(i);
+    auto const element_size = is_fixed_width(col.type()) ? size_of(col.type()) : 0;
+    switch (element_size) {
+      case 1: fused_columns[0].push_back(i); break;
+      case 2: fused_columns[1].push_back(i); break;
+      case 4: fused_columns[2].push_back(i); break;
+      case 8: fused_columns[3].push_back(i); break;
+      default: {
+        auto output_table = detail::gather(table_view{{col}},
+                                           gather_map.begin(),
+                                           gather_map.end(),
+                                           out_of_bounds_policy::DONT_CHECK,
+                                           stream,
+                                           mr);
+        out_columns[i]    = std::move(output_table->release().front());
+      }
+    }
+  }
+
+  for (std::size_t group = 0; group < fused_columns.size(); ++group) {
+    auto const& columns = fused_columns[group];
+    if (columns.empty()) { continue; }
+
+    std::vector<column_view> group_inputs;
+    std::vector<mutable_column_view> group_outputs;
+    for (auto i : columns) {
+      out_columns[i] =
+        allocate_like(input.column(i), output_size, mask_allocation_policy::RETAIN, stream, mr);
+      group_inputs.push_back(input.column(i));
+      group_outputs.push_back(out_columns[i]->mutable_view());
+    }
+    auto const d_inputs  = table_device_view::create(table_view{group_inputs}, stream);
+    auto const d_outputs = mutable_table_device_view::create(mutable_table_view{group_outputs},
+                                                             stream);
+    rmm::device_uvector<size_type> null_counts(columns.size(), stream);
+    CUDA_TRY(cudaMemsetAsync(
+      null_counts.data(), 0, null_counts.size() * sizeof(size_type), stream.value()));
+
+    // The grid is limited to 65535 rows, further columns are handled by striding over the rows
+    dim3 const grid(util::div_rounding_up_safe(output_size, block_size),
+                    std::min<std::size_t>(columns.size(), 65535));
+    switch (group) {
+      case 0:
+        fused_gather_kernel<int8_t, block_size><<<grid, block_size, 0, stream.value()>>>(
+          *d_outputs, null_counts.data(), *d_inputs, gather_map.data(), output_size);
+        break;
+      case 1:
+        fused_gather_kernel<int16_t, block_size><<<grid, block_size, 0, stream.value()>>>(
+          *d_outputs, null_counts.data(), *d_inputs, gather_map.data(), output_size);
+        break;
+      case 2:
+        fused_gather_kernel<int32_t, block_size><<<grid, block_size, 0, stream.value()>>>(
+          *d_outputs, null_counts.data(), *d_inputs, gather_map.data(), output_size);
+        break;
+      default:
+        fused_gather_kernel<int64_t, block_size><<<grid, block_size, 0, stream.value()>>>(
+          *d_outputs, null_counts.data(), *d_inputs, gather_map.data(), output_size);
+    }
+
+    auto const h_null_counts = make_std_vector_sync(null_counts, stream);
+    for (std::size_t j = 0; j < columns.size(); ++j) {
+      if (out_columns[columns[j]]->nullable()) {
+        out_columns[columns[j]]->set_null_count(h_null_counts[j]);
+      }
+    }
+  }
+
+  return std::make_unique<table>(std::move(out_columns));
+}
+
 /**
  * @brief Filters `input` using a Filter function object
  *
@@ -382,8 +569,21 @@ std::unique_ptr<table> copy_if(
 
   stream.synchronize();
 
+  auto const num_fixed_width_columns = std::count_if(
+    input.begin(), input.end(), [](auto const& col) { return is_fixed_width(col.type()); });
+
   if (output_size == input.num_rows()) {
     return std::make_unique<table>(input, stream, mr);
+  } else if (output_size > 0 && num_fixed_width_columns >= fused_copy_if_min_columns) {
+    // Wide tables are gathered with a gather map computed once rather than scattered column by
+    // column, which would evaluate `filter` and launch kernels for each column
+    rmm::device_uvector<size_type> gather_map(output_size, stream);
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::counting_iterator<size_type>(0),
+                    thrust::counting_iterator<size_type>(input.num_rows()),
+                    gather_map.begin(),
+                    filter);
+    return fused_gather(input, gather_map, stream, mr);
   } else if (output_size > 0) {
     std::vector<std::unique_ptr<column>> out_columns(input.num_columns());
     std::transform(input.begin(), input.end(), out_columns.begin(), [&](auto col_view) {
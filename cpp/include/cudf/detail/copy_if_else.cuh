@@ -114,6 +114,67 @@ __launch_bounds__(block_size) __global__
 
 }  // anonymous namespace
 
+/**
+ * @brief Writes each element selected from either of two input ranges based on a filter into a
+ * preallocated column
+ *
+ * Same as the allocating `copy_if_else` below, except that the output is written to `out`, whose
+ * size must be the size of the lhs range. If `nullable`, `out` must have a null mask and no offset,
+ * and its null count is updated.
+ *
+ * @param nullable    Indicate whether either input range can contain nulls
+ * @param lhs_begin   Begin iterator of lhs range
+ * @param lhs_end     End iterator of lhs range
+ * @param rhs         Begin iterator of rhs range
+ * @param filter      Function of type `FilterFn` which determines for index `i` where to get the
+ *                    corresponding output value from
+ * @param out         Column the selected values are written to
+ * @param stream      CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename FilterFn, typename LeftIter, typename RightIter>
+void copy_if_else(bool nullable,
+                  LeftIter lhs_begin,
+                  LeftIter lhs_end,
+                  RightIter rhs,
+                  FilterFn filter,
+                  mutable_column_view &out,
+                  rmm::cuda_stream_view stream)
+{
+  using Element =
+    typename thrust::tuple_element<0, typename thrust::iterator_traits<LeftIter>::value_type>::type;
+
+  size_type size = std::distance(lhs_begin, lhs_end);
+  CUDF_EXPECTS(out.size() == size, "Output size must match the input size");
+  CUDF_EXPECTS(not nullable or (out.nullable() and out.offset() == 0),
+               "Output column must be nullable and have no offset when the inputs have nulls");
+  if (size == 0) {
+    if (nullable) { out.set_null_count(0); }
+    return;
+  }
+
+  size_type num_els        = cudf::util::round_up_safe(size, warp_size);
+  constexpr int block_size = 256;
+  cudf::detail::grid_1d grid{num_els, block_size, 1};
+
+  auto out_v = mutable_column_device_view::create(out, stream);
+
+  // if we have validity in the output
+  if (nullable) {
+    rmm::device_scalar<size_type> valid_count{0, stream};
+
+    // call the kernel
+    copy_if_else_kernel<block_size, Element, LeftIter, RightIter, FilterFn, true>
+      <<<grid.num_blocks, block_size, 0, stream.value()>>>(
+        lhs_begin, rhs, filter, *out_v, valid_count.data());
+
+    out.set_null_count(size - valid_count.value(stream));
+  } else {
+    // call the kernel
+    copy_if_else_kernel<block_size, Element, LeftIter, RightIter, FilterFn, false>
+      <<<grid.num_blocks, block_size, 0, stream.value()>>>(lhs_begin, rhs, filter, *out_v, nullptr);
+  }
+}
+
 /**
  * @brief Returns a new column, where each element is selected from either of two input ranges based
  * on a filter
@@ -168,34 +229,14 @@ std::unique_ptr<column> copy_if_else(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource())
 {
-  using Element =
-    typename thrust::tuple_element<0, typename thrust::iterator_traits<LeftIter>::value_type>::type;
-
-  size_type size           = std::distance(lhs_begin, lhs_end);
-  size_type num_els        = cudf::util::round_up_safe(size, warp_size);
-  constexpr int block_size = 256;
-  cudf::detail::grid_1d grid{num_els, block_size, 1};
+  size_type size = std::distance(lhs_begin, lhs_end);
 
   std::unique_ptr<column> out = make_fixed_width_column(
     output_type, size, nullable ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED, stream, mr);
 
-  auto out_v = mutable_column_device_view::create(*out);
-
-  // if we have validity in the output
-  if (nullable) {
-    rmm::device_scalar<size_type> valid_count{0, stream};
-
-    // call the kernel
-    copy_if_else_kernel<block_size, Element, LeftIter, RightIter, FilterFn, true>
-      <<<grid.num_blocks, block_size, 0, stream.value()>>>(
-        lhs_begin, rhs, filter, *out_v, valid_count.data());
-
-    out->set_null_count(size - valid_count.value());
-  } else {
-    // call the kernel
-    copy_if_else_kernel<block_size, Element, LeftIter, RightIter, FilterFn, false>
-      <<<grid.num_blocks, block_size, 0, stream.value()>>>(lhs_begin, rhs, filter, *out_v, nullptr);
-  }
+  auto out_view = out->mutable_view();
+  copy_if_else(nullable, lhs_begin, lhs_end, rhs, filter, out_view, stream);
+  if (nullable) { out->set_null_count(out_view.null_count()); }
 
   return out;
 }
@@ -16,9 +16,12 @@
 
 #pragma once
 
+#include <cudf/datetime.hpp>
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace cudf {
 namespace datetime {
@@ -93,6 +96,18 @@ std::unique_ptr<cudf::column> extract_second(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::extract_datetime_components(cudf::column_view const&,
+ * std::vector<datetime_component> const&, rmm::mr::device_memory_resource *)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<cudf::table> extract_datetime_components(
+  cudf::column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::last_day_of_month(cudf::column_view const&, rmm::mr::device_memory_resource *)
  *
@@ -124,6 +139,31 @@ std::unique_ptr<cudf::column> add_calendrical_months(
   cudf::column_view const& months,
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::convert_utc_to_timezone(cudf::column_view const&, std::string const&,
+ * rmm::mr::device_memory_resource *)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<cudf::column> convert_utc_to_timezone(
+  cudf::column_view const& timestamps,
+  std::string const& timezone_name,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::convert_timezone(cudf::column_view const&, std::string const&,
+ * std::string const&, rmm::mr::device_memory_resource *)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<cudf::column> convert_timezone(
+  cudf::column_view const& timestamps,
+  std::string const& from_timezone,
+  std::string const& to_timezone,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 }  // namespace detail
 }  // namespace datetime
 }  // namespace cudf
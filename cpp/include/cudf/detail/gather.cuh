@@ -39,6 +39,7 @@
 #include <rmm/exec_policy.hpp>
 
 #include <algorithm>
+#include <vector>
 
 #include <thrust/functional.h>
 #include <thrust/gather.h>
@@ -555,8 +556,25 @@ void gather_bitmask(table_view const& source,
                            [target_rows](auto const& col) { return target_rows == col->size(); }),
                "Column size mismatch");
 
+  // A column whose gathered rows can have no nulls gets an all valid mask without a kernel:
+  // its source has no nulls and no row is nullified or passed through from a null target row
+  std::vector<size_type> gathered;
+  for (size_type i = 0; i < static_cast<size_type>(target.size()); ++i) {
+    auto const all_valid =
+      not source.column(i).has_nulls() and
+      (op == gather_bitmask_op::DONT_CHECK or
+       (op == gather_bitmask_op::PASSTHROUGH and target[i]->null_count() == 0));
+    if (not all_valid) {
+      gathered.push_back(i);
+    } else if (source.column(i).nullable() or target[i]->nullable()) {
+      target[i]->set_null_mask(
+        detail::create_null_mask(target_rows, mask_state::ALL_VALID, stream, mr), 0);
+    }
+  }
+  if (gathered.empty()) { return; }
+
   // Create null mask if source is nullable but target is not
-  for (size_t i = 0; i < target.size(); ++i) {
+  for (auto const i : gathered) {
     if ((source.column(i).nullable() or op == gather_bitmask_op::NULLIFY) and
         not target[i]->nullable()) {
       auto const state =
@@ -567,14 +585,14 @@ void gather_bitmask(table_view const& source,
   }
 
   // Make device array of target bitmask pointers
-  std::vector<bitmask_type*> target_masks(target.size());
-  std::transform(target.begin(), target.end(), target_masks.begin(), [](auto const& col) {
-    return col->mutable_view().null_mask();
+  std::vector<bitmask_type*> target_masks(gathered.size());
+  std::transform(gathered.begin(), gathered.end(), target_masks.begin(), [&target](auto i) {
+    return target[i]->mutable_view().null_mask();
   });
   auto d_target_masks = make_device_uvector_async(target_masks, stream);
 
-  auto const device_source = table_device_view::create(source, stream);
-  auto d_valid_counts      = make_zeroed_device_uvector_async<size_type>(target.size(), stream);
+  auto const device_source = table_device_view::create(source.select(gathered), stream);
+  auto d_valid_counts      = make_zeroed_device_uvector_async<size_type>(gathered.size(), stream);
 
   // Dispatch operation enum to get implementation
   auto const impl = [op]() {
@@ -591,17 +609,17 @@ void gather_bitmask(table_view const& source,
   impl(*device_source,
        gather_map,
        d_target_masks.data(),
-       target.size(),
+       gathered.size(),
        target_rows,
        d_valid_counts.data(),
        stream);
 
   // Copy the valid counts into each column
   auto const valid_counts = make_std_vector_sync(d_valid_counts, stream);
-  for (size_t i = 0; i < target.size(); ++i) {
-    if (target[i]->nullable()) {
+  for (size_t i = 0; i < gathered.size(); ++i) {
+    if (target[gathered[i]]->nullable()) {
       auto const null_count = target_rows - valid_counts[i];
-      target[i]->set_null_count(null_count);
+      target[gathered[i]]->set_null_count(null_count);
     }
   }
 }
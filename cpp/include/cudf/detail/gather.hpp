@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -67,5 +67,20 @@ std::unique_ptr<table> gather(
   negative_index_policy neg_indices,
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::gather(table_view const&,column_view const&,mutable_table_view&,
+ * out_of_bounds_policy)
+ *
+ * @param neg_indices Interpret each negative index `i` in the gathermap as the positive index
+ * `i+num_source_rows`.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void gather(table_view const& source_table,
+            column_view const& gather_map,
+            mutable_table_view& output,
+            out_of_bounds_policy bounds_policy,
+            negative_index_policy neg_indices,
+            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 }  // namespace detail
 }  // namespace cudf
@@ -39,6 +39,15 @@ namespace hash {
  */
 bool can_use_hash_groupby(table_view const& keys, host_span<aggregation_request const> requests);
 
+/**
+ * @brief Indicates if an aggregation can be computed by the hash-based groupby.
+ *
+ * @param kind The aggregation to verify
+ * @return true The hash-based groupby can compute `kind`
+ * @return false The hash-based groupby cannot compute `kind`
+ */
+bool can_use_hash_aggregation(aggregation::Kind kind);
+
 // Hash-based groupby
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   table_view const& keys,
@@ -46,6 +55,19 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   null_policy include_null_keys,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Hash-based groupby scan, returning the rows in the order of `keys`.
+ *
+ * The rows are labeled with the groups of their keys from a hash map, and grouped by a stable
+ * sort of the labels rather than of the keys.
+ */
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> scan(
+  table_view const& keys,
+  host_span<aggregation_request const> requests,
+  null_policy include_null_keys,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
 }  // namespace hash
 
 }  // namespace detail
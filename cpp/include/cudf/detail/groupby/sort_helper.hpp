@@ -72,6 +72,26 @@ struct sort_groupby_helper {
     }
   };
 
+  /**
+   * @brief Construct a new helper object for keys whose rows are already grouped
+   *
+   * Equal rows of `keys` must be adjacent. The rows of group `i` are
+   * `[group_offsets[i], group_offsets[i+1])`, so the keys are neither sorted
+   * nor compared. Rows with null values are grouped like any other row.
+   *
+   * @param keys table to group by
+   * @param group_offsets Offsets of the first row of each group in `keys`,
+   *                      followed by `keys.num_rows()`
+   */
+  sort_groupby_helper(table_view const& keys, index_vector&& group_offsets)
+    : _keys(keys),
+      _group_offsets(std::make_unique<index_vector>(std::move(group_offsets))),
+      _num_keys(-1),
+      _keys_pre_sorted(sorted::YES),
+      _include_null_keys(null_policy::INCLUDE)
+  {
+  }
+
   ~sort_groupby_helper()                          = default;
   sort_groupby_helper(sort_groupby_helper const&) = delete;
   sort_groupby_helper& operator=(sort_groupby_helper const&) = delete;
@@ -129,6 +149,11 @@ struct sort_groupby_helper {
     rmm::cuda_stream_view stream,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+  /**
+   * @brief Get the keys to group by
+   */
+  table_view const& keys() const noexcept { return _keys; }
+
   /**
    * @brief Get the number of groups in `keys`
    */
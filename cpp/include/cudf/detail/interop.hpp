@@ -46,6 +46,16 @@ DLManagedTensor* to_dlpack(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::to_dlpack_view
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+DLManagedTensor* to_dlpack_view(
+  table_view const& input,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 // Creating arrow as per given type_id and buffer arguments
 template <typename... Ts>
 std::shared_ptr<arrow::Array> to_arrow_array(cudf::type_id id, Ts&&... args)
@@ -116,5 +126,36 @@ std::unique_ptr<table> from_arrow(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::from_arrow_async
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::future<std::unique_ptr<table>> from_arrow_async(
+  arrow::Table const& input_table,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::to_arrow_device
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+unique_device_array_t to_arrow_device(
+  table&& input,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::from_arrow_device
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::pair<table_view, std::vector<std::unique_ptr<column>>> from_arrow_device(
+  ArrowSchema const* schema,
+  ArrowDeviceArray const* input,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace detail
 }  // namespace cudf
@@ -53,6 +53,22 @@ std::unique_ptr<column> label_bins(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::histogram(column_view const& input, column_view const& left_edges, inclusive
+ * left_inclusive, column_view const& right_edges, inclusive right_inclusive,
+ * rmm::mr::device_memory_resource* mr)
+ *
+ * @param stream Stream view on which to allocate resources and queue execution.
+ */
+std::unique_ptr<column> histogram(
+  column_view const& input,
+  column_view const& left_edges,
+  inclusive left_inclusive,
+  column_view const& right_edges,
+  inclusive right_inclusive,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace detail
 }  // namespace cudf
@@ -17,8 +17,16 @@
 #pragma once
 
 #include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 /**
@@ -72,8 +80,14 @@ template <bool has_nulls = true>
 struct tagged_element_relational_comparator {
   __host__ __device__ tagged_element_relational_comparator(column_device_view lhs,
                                                            column_device_view rhs,
-                                                           null_order null_precedence)
-    : lhs{lhs}, rhs{rhs}, null_precedence{null_precedence}
+                                                           null_order null_precedence,
+                                                           string_prefix const* lhs_prefixes,
+                                                           string_prefix const* rhs_prefixes)
+    : lhs{lhs},
+      rhs{rhs},
+      null_precedence{null_precedence},
+      lhs_prefixes{lhs_prefixes},
+      rhs_prefixes{rhs_prefixes}
   {
   }
 
@@ -91,7 +105,11 @@ struct tagged_element_relational_comparator {
     column_device_view const* ptr_right_dview{r_side == side::LEFT ? &lhs : &rhs};
 
     auto erl_comparator =
-      element_relational_comparator<has_nulls>(*ptr_left_dview, *ptr_right_dview, null_precedence);
+      element_relational_comparator<has_nulls>(*ptr_left_dview,
+                                               *ptr_right_dview,
+                                               null_precedence,
+                                               l_side == side::LEFT ? lhs_prefixes : rhs_prefixes,
+                                               r_side == side::LEFT ? lhs_prefixes : rhs_prefixes);
 
     return cudf::type_dispatcher(lhs.type(), erl_comparator, l_indx, r_indx);
   }
@@ -100,6 +118,8 @@ struct tagged_element_relational_comparator {
   column_device_view lhs;
   column_device_view rhs;
   null_order null_precedence;
+  string_prefix const* lhs_prefixes;
+  string_prefix const* rhs_prefixes;
 };
 
 /**
@@ -109,9 +129,16 @@ template <bool has_nulls = true>
 struct row_lexicographic_tagged_comparator {
   row_lexicographic_tagged_comparator(table_device_view lhs,
                                       table_device_view rhs,
-                                      order const* column_order         = nullptr,
-                                      null_order const* null_precedence = nullptr)
-    : _lhs{lhs}, _rhs{rhs}, _column_order{column_order}, _null_precedence{null_precedence}
+                                      order const* column_order                = nullptr,
+                                      null_order const* null_precedence        = nullptr,
+                                      string_prefix const* const* lhs_prefixes = nullptr,
+                                      string_prefix const* const* rhs_prefixes = nullptr)
+    : _lhs{lhs},
+      _rhs{rhs},
+      _column_order{column_order},
+      _null_precedence{null_precedence},
+      _lhs_prefixes{lhs_prefixes},
+      _rhs_prefixes{rhs_prefixes}
   {
     // Add check for types to be the same.
     CUDF_EXPECTS(_lhs.num_columns() == _rhs.num_columns(), "Mismatched number of columns.");
@@ -126,8 +153,13 @@ struct row_lexicographic_tagged_comparator {
       null_order null_precedence =
         _null_precedence == nullptr ? null_order::BEFORE : _null_precedence[i];
 
-      auto comparator = tagged_element_relational_comparator<has_nulls>{
-        _lhs.column(i), _rhs.column(i), null_precedence};
+      auto const has_prefixes = _lhs_prefixes != nullptr and _rhs_prefixes != nullptr;
+      auto comparator         = tagged_element_relational_comparator<has_nulls>{
+        _lhs.column(i),
+        _rhs.column(i),
+        null_precedence,
+        has_prefixes ? _lhs_prefixes[i] : nullptr,
+        has_prefixes ? _rhs_prefixes[i] : nullptr};
 
       weak_ordering state = comparator.compare(lhs_tagged_index, rhs_tagged_index);
 
@@ -143,7 +175,46 @@ struct row_lexicographic_tagged_comparator {
   table_device_view _rhs;
   null_order const* _null_precedence{};
   order const* _column_order{};
+  string_prefix const* const* _lhs_prefixes{};
+  string_prefix const* const* _rhs_prefixes{};
 };
 
+/**
+ * @brief Generates the row indices and source side (left or right) in accordance with the index
+ * columns.
+ *
+ * Equivalent rows of `left_table` precede those of `right_table` in the merged order.
+ *
+ * @param[in] left_table The left table_view to be merged
+ * @param[in] right_table The right table_view to be merged
+ * @param[in] column_order Sort order types of index columns
+ * @param[in] null_precedence Array indicating the order of nulls with respect to non-nulls for the
+ * index columns
+ * @param[in] nullable Flag indicating if at least one of the table_view arguments has nulls
+ * (defaults to true)
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return A device_uvector of merged indices
+ */
+index_vector generate_merged_indices(table_view const& left_table,
+                                     table_view const& right_table,
+                                     std::vector<order> const& column_order,
+                                     std::vector<null_order> const& null_precedence,
+                                     bool nullable                = true,
+                                     rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::merge
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<cudf::table> merge(
+  std::vector<table_view> const& tables_to_merge,
+  std::vector<cudf::size_type> const& key_cols,
+  std::vector<cudf::order> const& column_order,
+  std::vector<cudf::null_order> const& null_precedence,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace detail
 }  // namespace cudf
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/metrics.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace cudf {
+namespace metrics {
+namespace detail {
+
+/**
+ * @brief Number of live `metrics::scope`s; no metrics are collected while it is 0.
+ */
+extern std::atomic<int> active_scopes;
+
+/**
+ * @brief Starts recording an operation on the calling thread, unless one is already recorded.
+ */
+void begin_operation(char const* name);
+
+/**
+ * @brief Ends the operation started by the matching `begin_operation` and, if it is the
+ * outermost one, passes its metrics to the registered callbacks.
+ */
+void end_operation();
+
+/**
+ * @brief Adds `bytes` to the bytes processed by the operation recorded on the calling thread.
+ */
+void add_bytes_processed(int64_t bytes);
+
+/**
+ * @brief Records the metrics of an operation for its lifetime if a `metrics::scope` exists.
+ *
+ * Opened by `CUDF_FUNC_RANGE` next to the NVTX range of the function.
+ */
+class operation_recorder {
+ public:
+  explicit operation_recorder(char const* name)
+    : _recording{active_scopes.load(std::memory_order_relaxed) > 0}
+  {
+    if (_recording) { begin_operation(name); }
+  }
+  operation_recorder(operation_recorder const&) = delete;
+  operation_recorder& operator=(operation_recorder const&) = delete;
+  ~operation_recorder()
+  {
+    if (_recording) { end_operation(); }
+  }
+
+ private:
+  bool _recording;  // whether `begin_operation` was called
+};
+
+/**
+ * @copydoc add_bytes_processed
+ *
+ * Does nothing if no `metrics::scope` exists.
+ */
+inline void record_bytes_processed(int64_t bytes)
+{
+  if (bytes > 0 and active_scopes.load(std::memory_order_relaxed) > 0) {
+    add_bytes_processed(bytes);
+  }
+}
+
+}  // namespace detail
+}  // namespace metrics
+}  // namespace cudf
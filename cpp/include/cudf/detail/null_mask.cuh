@@ -19,29 +19,48 @@
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/null_mask.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <cub/block/block_reduce.cuh>
+
+#include <algorithm>
+#include <utility>
 
 namespace cudf {
 namespace detail {
 /**
  * @brief Computes the merger of an array of bitmasks using a binary operator
  *
+ * The number of set bits of the result is counted in the same pass.
+ *
  * @param op The binary operator used to combine the bitmasks
  * @param destination The bitmask to write result into
  * @param source Array of source mask pointers. All masks must be of same size
  * @param source_begin_bits Array of offsets into corresponding @p source masks.
  *                          Must be same size as source array
  * @param source_size_bits Number of bits in each mask in @p source
+ * @param count_ptr Pointer to the counter of set bits, must be zero on entry
  */
-template <typename Binop>
+template <int block_size, typename Binop>
 __global__ void offset_bitmask_binop(Binop op,
                                      device_span<bitmask_type> destination,
                                      device_span<bitmask_type const *> source,
                                      device_span<size_type const> source_begin_bits,
-                                     size_type source_size_bits)
+                                     size_type source_size_bits,
+                                     size_type *count_ptr)
 {
+  constexpr auto const word_size{detail::size_in_bits<bitmask_type>()};
+  auto const last_word_index = static_cast<size_type>(destination.size()) - 1;
+  // bits past `source_size_bits` in the last word are not counted
+  auto const num_slack_bits = (word_size - source_size_bits % word_size) % word_size;
+
+  size_type thread_count{0};
   for (size_type destination_word_index = threadIdx.x + blockIdx.x * blockDim.x;
        destination_word_index < destination.size();
        destination_word_index += blockDim.x * gridDim.x) {
@@ -61,17 +80,32 @@ __global__ void offset_bitmask_binop(Binop op,
     }
 
     destination[destination_word_index] = destination_word;
+    if (destination_word_index == last_word_index && num_slack_bits > 0) {
+      destination_word &= ~set_most_significant_bits(num_slack_bits);
+    }
+    thread_count += __popc(destination_word);
   }
+
+  using BlockReduce = cub::BlockReduce<size_type, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  size_type block_count{BlockReduce(temp_storage).Sum(thread_count)};
+
+  if (threadIdx.x == 0) { atomicAdd(count_ptr, block_count); }
 }
 
 /**
- * @copydoc bitmask_binop(Binop op, host_span<bitmask_type const *> const, host_span<size_type>
- * const, size_type, rmm::mr::device_memory_resource *)
+ * @brief Performs a merge of the specified bitmasks using the binary operator provided
  *
+ * @param op The binary operator used to combine the bitmasks
+ * @param masks The list of data pointers of the bitmasks to be merged
+ * @param masks_begin_bits The bit offsets from which each mask is to be merged
+ * @param mask_size_bits The number of bits to be merged in each mask
  * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned device_buffer
+ * @return The merged bitmask and its count of unset bits
  */
 template <typename Binop>
-rmm::device_buffer bitmask_binop(
+std::pair<rmm::device_buffer, size_type> bitmask_binop(
   Binop op,
   host_span<bitmask_type const *> masks,
   host_span<size_type const> masks_begin_bits,
@@ -81,16 +115,17 @@ rmm::device_buffer bitmask_binop(
 {
   auto dest_mask = rmm::device_buffer{bitmask_allocation_size_bytes(mask_size_bits), stream, mr};
 
-  inplace_bitmask_binop(op,
-                        device_span<bitmask_type>(static_cast<bitmask_type *>(dest_mask.data()),
-                                                  num_bitmask_words(mask_size_bits)),
-                        masks,
-                        masks_begin_bits,
-                        mask_size_bits,
-                        stream,
-                        mr);
+  auto const null_count =
+    inplace_bitmask_binop(op,
+                          device_span<bitmask_type>(static_cast<bitmask_type *>(dest_mask.data()),
+                                                    num_bitmask_words(mask_size_bits)),
+                          masks,
+                          masks_begin_bits,
+                          mask_size_bits,
+                          stream,
+                          mr);
 
-  return dest_mask;
+  return std::make_pair(std::move(dest_mask), null_count);
 }
 
 /**
@@ -103,11 +138,11 @@ rmm::device_buffer bitmask_binop(
  * @param masks_begin_bits The bit offsets from which each mask is to be merged
  * @param mask_size_bits The number of bits to be ANDed in each mask
  * @param stream CUDA stream used for device memory operations and kernel launches
- * @param mr Device memory resource used to allocate the returned device_buffer
- * @return rmm::device_buffer Output bitmask
+ * @param mr Device memory resource used to allocate temporary device memory
+ * @return Count of unset bits in the merged bitmask
  */
 template <typename Binop>
-void inplace_bitmask_binop(
+size_type inplace_bitmask_binop(
   Binop op,
   device_span<bitmask_type> dest_mask,
   host_span<bitmask_type const *> masks,
@@ -134,11 +169,15 @@ void inplace_bitmask_binop(
                            cudaMemcpyHostToDevice,
                            stream.value()));
 
-  cudf::detail::grid_1d config(dest_mask.size(), 256);
-  offset_bitmask_binop<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
-    op, dest_mask, d_masks, d_begin_bits, mask_size_bits);
+  rmm::device_scalar<size_type> d_counter{0, stream, mr};
+
+  constexpr size_type block_size{256};
+  cudf::detail::grid_1d config(dest_mask.size(), block_size);
+  offset_bitmask_binop<block_size>
+    <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+      op, dest_mask, d_masks, d_begin_bits, mask_size_bits, d_counter.data());
   CHECK_CUDA(stream.value());
-  stream.synchronize();
+  return mask_size_bits - d_counter.value(stream);
 }
 
 }  // namespace detail
@@ -20,6 +20,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <utility>
 #include <vector>
 
 namespace cudf {
@@ -89,12 +90,16 @@ rmm::device_buffer copy_bitmask(
   rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
 
 /**
- * @copydoc bitmask_and(host_span<bitmask_type const *> const, host_span<size_type> const,
- * size_type, rmm::mr::device_memory_resource *)
+ * @brief Returns a bitwise AND of the specified bitmasks
  *
+ * @param masks The list of data pointers of the bitmasks to be ANDed
+ * @param masks_begin_bits The bit offsets from which each mask is to be ANDed
+ * @param mask_size_bits The number of bits to be ANDed in each mask
  * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned device_buffer
+ * @return The output bitmask and its count of unset bits
  */
-rmm::device_buffer bitmask_and(
+std::pair<rmm::device_buffer, size_type> bitmask_and(
   host_span<bitmask_type const *> masks,
   host_span<size_type const> masks_begin_bits,
   size_type mask_size_bits,
@@ -104,9 +109,13 @@ rmm::device_buffer bitmask_and(
 /**
  * @copydoc cudf::bitmask_and
  *
+ * The null count of the output bitmask is computed in the same pass and returned with it,
+ * so a column built from it does not need to count its nulls again.
+ *
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @return The output bitmask and its count of unset bits
  */
-rmm::device_buffer bitmask_and(
+std::pair<rmm::device_buffer, size_type> bitmask_and(
   table_view const &view,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
@@ -114,9 +123,12 @@ rmm::device_buffer bitmask_and(
 /**
  * @copydoc cudf::bitmask_or
  *
+ * The null count of the output bitmask is computed in the same pass and returned with it.
+ *
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @return The output bitmask and its count of unset bits
  */
-rmm::device_buffer bitmask_or(
+std::pair<rmm::device_buffer, size_type> bitmask_or(
   table_view const &view,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
@@ -130,10 +142,10 @@ rmm::device_buffer bitmask_or(
  * @param masks_begin_bits The bit offsets from which each mask is to be ANDed
  * @param mask_size_bits The number of bits to be ANDed in each mask
  * @param stream CUDA stream used for device memory operations and kernel launches
- * @param mr Device memory resource used to allocate the returned device_buffer
- * @return rmm::device_buffer Output bitmask
+ * @param mr Device memory resource used to allocate temporary device memory
+ * @return Count of unset bits in the ANDed bitmask
  */
-void inplace_bitmask_and(
+size_type inplace_bitmask_and(
   device_span<bitmask_type> dest_mask,
   host_span<bitmask_type const *> masks,
   host_span<size_type const> masks_begin_bits,
@@ -141,6 +153,24 @@ void inplace_bitmask_and(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Writes the bitwise AND of the null masks of the columns of `view` to the null mask of
+ * `output`, and sets the null count of `output`
+ *
+ * Columns without a null mask count as all valid. If `output` has no null mask, nothing is written.
+ *
+ * @throws cudf::logic_error if `output` and `view` differ in size
+ * @throws cudf::logic_error if `output` has no null mask and a column of `view` has nulls
+ * @throws cudf::logic_error if `output` has a null mask and an offset
+ *
+ * @param output Column whose null mask is written
+ * @param view Columns whose null masks are ANDed
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void inplace_bitmask_and(mutable_column_view &output,
+                         table_view const &view,
+                         rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 }  // namespace detail
 
 }  // namespace cudf
@@ -18,6 +18,11 @@
 
 #include "nvtx3.hpp"
 
+#include <cudf/detail/metrics.hpp>
+
+#include <cstdint>
+#include <string>
+
 namespace cudf {
 /**
  * @brief Tag type for libcudf's NVTX domain.
@@ -31,6 +36,48 @@ struct libcudf_domain {
  */
 using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
 
+/**
+ * @brief An NVTX range in the libcudf domain for one stage of a function.
+ *
+ * Nested within the range of the function, e.g. from `CUDF_FUNC_RANGE`, it shows which stage is
+ * slow and on how much data: the payload is the number of bytes the stage processes, and the
+ * number of rows, if known, is appended to the message.
+ *
+ * Example:
+ * ```
+ * {
+ *   cudf::stage_range range{"parquet::decompress", compressed_bytes};
+ *   ...
+ * }
+ * ```
+ */
+class stage_range {
+ public:
+  /**
+   * @param name Name of the stage
+   * @param bytes Number of bytes processed by the stage, or a negative value if unknown
+   * @param rows Number of rows processed by the stage, or a negative value if unknown
+   */
+  stage_range(char const* name, int64_t bytes, int64_t rows = -1)
+    : _message{rows < 0 ? std::string{name}
+                        : std::string{name} + " (" + std::to_string(rows) + " rows)"},
+      _range{bytes < 0 ? ::nvtx3::event_attributes{::nvtx3::message{_message}}
+                       : ::nvtx3::event_attributes{::nvtx3::message{_message},
+                                                   ::nvtx3::payload{bytes}}}
+  {
+    metrics::detail::record_bytes_processed(bytes);
+  }
+
+  /**
+   * @brief Returns the message of the range: the name of the stage and the number of rows.
+   */
+  std::string const& message() const { return _message; }
+
+ private:
+  std::string _message;  // must outlive the construction of `_range`
+  thread_range _range;
+};
+
 }  // namespace cudf
 
 /**
@@ -38,7 +85,8 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  * from the lifetime of a function.
  *
  * Uses the name of the immediately enclosing function returned by `__func__` to
- * name the range.
+ * name the range. While a `cudf::metrics::scope` exists, the metrics of the function are
+ * also recorded.
  *
  * Example:
  * ```
@@ -48,4 +96,6 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  * }
  * ```
  */
-#define CUDF_FUNC_RANGE() NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain)
+#define CUDF_FUNC_RANGE()                   \
+  NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain) \
+  cudf::metrics::detail::operation_recorder const cudf_metrics_recorder__{__func__}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -49,5 +49,42 @@ std::unique_ptr<table> quantiles(
   rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes quantiles of the valid elements of an unsorted column, without sorting it.
+ *
+ * The elements that the quantiles are interpolated from are selected together with a radix
+ * select, which reads `input` once per byte of its type, and needs no copy of it. The result is
+ * the same as `quantile` with the sorted order of the valid elements of `input` as
+ * `ordered_indices`.
+ *
+ * @throws cudf::logic_error if `is_quantile_by_selection_supported` is false for the arguments
+ *
+ * @param input Column from which to compute quantile values
+ * @param q Specified quantiles in range [0, 1]
+ * @param interp Strategy used to select between values adjacent to a specified quantile
+ * @param exact If true, returns doubles. If false, returns same type as input.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Column of specified quantiles, all null if `input` has no valid elements
+ */
+std::unique_ptr<column> quantile_by_selection(
+  column_view const& input,
+  std::vector<double> const& q,
+  interpolation interp,
+  bool exact,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns whether `quantile_by_selection` supports the quantiles `q` of a column of type
+ * `type`.
+ *
+ * Selection supports numeric types other than BOOL8, and fixed-point types, for up to four
+ * quantiles, or up to eight with a LOWER, HIGHER or NEAREST interpolation.
+ */
+bool is_quantile_by_selection_supported(data_type type,
+                                        std::vector<double> const& q,
+                                        interpolation interp);
+
 }  // namespace detail
 }  // namespace cudf
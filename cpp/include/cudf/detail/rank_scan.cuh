@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/scan.h>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @copydoc cudf::detail::rank_generator(column_view const&, LabelIterator, OffsetIterator, bool,
+ * rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
+ *
+ * @tparam has_nulls Whether `values` has nulls
+ */
+template <bool has_nulls, typename LabelIterator, typename OffsetIterator>
+std::unique_ptr<column> rank_generator(column_view const& values,
+                                       LabelIterator group_labels,
+                                       OffsetIterator group_offsets,
+                                       bool dense,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  auto ranks = make_fixed_width_column(
+    data_type{type_id::INT32}, values.size(), mask_state::UNALLOCATED, stream, mr);
+  if (values.is_empty()) { return ranks; }
+
+  auto const d_values   = table_device_view::create(table_view{{values}}, stream);
+  auto const run_starts = make_counting_transform_iterator(
+    0,
+    [comparator = row_equality_comparator<has_nulls>{*d_values, *d_values, true},
+     group_labels,
+     group_offsets,
+     dense] __device__(size_type row) {
+      auto const group_start  = group_offsets[group_labels[row]];
+      bool const is_run_start = row == group_start or not comparator(row, row - 1);
+      return is_run_start ? (dense ? 1 : row - group_start + 1) : 0;
+    });
+
+  auto d_ranks = ranks->mutable_view().begin<size_type>();
+  if (dense) {
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                  group_labels,
+                                  group_labels + values.size(),
+                                  run_starts,
+                                  d_ranks,
+                                  thrust::equal_to<size_type>{},
+                                  DeviceSum{});
+  } else {
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                  group_labels,
+                                  group_labels + values.size(),
+                                  run_starts,
+                                  d_ranks,
+                                  thrust::equal_to<size_type>{},
+                                  DeviceMax{});
+  }
+  return ranks;
+}
+
+/**
+ * @brief Computes the ranks of values sorted within their groups with one segmented scan.
+ *
+ * The first row of each run of equal values within a group maps to 1 for a dense rank, so that
+ * a sum yields the dense rank, or to its 1-based position within the group for a rank, so that a
+ * max yields the rank. All other rows map to 0.
+ *
+ * An ungrouped column is ranked with constant labels and offsets of zero.
+ *
+ * @tparam LabelIterator Iterator of `size_type` group labels
+ * @tparam OffsetIterator Iterator of `size_type` group offsets
+ *
+ * @param values Values sorted within each group
+ * @param group_labels Group label of each row of `values`, in non-decreasing order
+ * @param group_offsets First row of each group, indexed by group label
+ * @param dense Whether to compute the dense rank instead of the rank
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return INT32 column of the 1-based ranks of `values` within their groups
+ */
+template <typename LabelIterator, typename OffsetIterator>
+std::unique_ptr<column> rank_generator(column_view const& values,
+                                       LabelIterator group_labels,
+                                       OffsetIterator group_offsets,
+                                       bool dense,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  return values.has_nulls()
+           ? rank_generator<true>(values, group_labels, group_offsets, dense, stream, mr)
+           : rank_generator<false>(values, group_labels, group_offsets, dense, stream, mr);
+}
+
+}  // namespace detail
+}  // namespace cudf
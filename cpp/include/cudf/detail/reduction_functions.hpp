@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,11 +16,17 @@
 
 #pragma once
 
+#include <cudf/aggregation.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace cudf {
 namespace reduction {
 /**
@@ -254,5 +260,70 @@ std::unique_ptr<scalar> nth_element(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the reductions of the numeric columns of `input` that can be computed from a
+ * single pass over each column.
+ *
+ * The sum, product, sum of squares, min, max, mean, variance, standard deviation, any, all and
+ * count aggregations of a column are all computed from a single reduction of the column, and the
+ * reductions of all the columns are copied to the host with a single transfer. The output type of
+ * each aggregation is `cudf::detail::target_type` of the column type.
+ *
+ * @param input Table of the columns to reduce
+ * @param aggs Aggregations to compute for each column
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned scalars' device memory
+ * @return For each column, the scalar of each aggregation, or null for the aggregations that are
+ * not computed in the single pass and the columns that are not numeric
+ */
+std::vector<std::vector<std::unique_ptr<scalar>>> fused_reduce(
+  table_view const& input,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace reduction
+
+namespace detail {
+/**
+ * @copydoc cudf::minmax
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>> minmax(
+  column_view const& col,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::minmax_into
+ */
+void minmax_into(column_view const& col,
+                 scalar& minimum,
+                 scalar& maximum,
+                 rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::reduce_into
+ */
+void reduce_into(column_view const& col,
+                 std::unique_ptr<aggregation> const& agg,
+                 scalar& output,
+                 rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::segmented_reduce
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> segmented_reduce(
+  column_view const& segmented_values,
+  device_span<size_type const> offsets,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  null_policy null_handling,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+}  // namespace detail
 }  // namespace cudf
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/row_conversion.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <limits>
+
+namespace cudf {
+namespace detail {
+/**
+ * @copydoc cudf::convert_to_rows
+ *
+ * @param max_batch_bytes The maximum number of bytes in each returned column
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::unique_ptr<column>> convert_to_rows(
+  table_view const& input,
+  size_type max_batch_bytes           = std::numeric_limits<size_type>::max(),
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::convert_from_rows
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> convert_from_rows(
+  lists_column_view const& input,
+  std::vector<data_type> const& schema,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+}  // namespace detail
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -40,6 +40,21 @@ std::unique_ptr<column> lower_bound(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::lower_bound(table_view const&, table_view const&, std::vector<order> const&,
+ * std::vector<null_order> const&, sorted, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> lower_bound(
+  table_view const& t,
+  table_view const& values,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  sorted values_sorted,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::upper_bound
  *
@@ -53,6 +68,21 @@ std::unique_ptr<column> upper_bound(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::upper_bound(table_view const&, table_view const&, std::vector<order> const&,
+ * std::vector<null_order> const&, sorted, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> upper_bound(
+  table_view const& t,
+  table_view const& values,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  sorted values_sorted,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::contains(column_view const&, scalar const&,
  *                                       rmm::mr::device_memory_resource*)
@@ -20,7 +20,9 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace cudf {
@@ -90,5 +92,48 @@ std::unique_ptr<table> segmented_sort_by_key(
   rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::top_k
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> top_k(
+  table_view const& keys,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::segmented_top_k
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> segmented_top_k(
+  table_view const& keys,
+  column_view const& segment_offsets,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::external_sort
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void external_sort(
+  std::function<std::unique_ptr<table>()> const& read_chunk,
+  std::function<void(std::unique_ptr<table>&&)> const& write_chunk,
+  std::vector<size_type> const& key_cols,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence = {},
+  size_type block_rows                           = 1 << 20,
+  std::string const& spill_directory             = {},
+  rmm::cuda_stream_view stream                   = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
 }  // namespace detail
 }  // namespace cudf
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Returns the prefix of each row of a strings column, null rows have an empty prefix.
+ */
+struct make_string_prefix_fn {
+  column_device_view strings;
+
+  __device__ string_prefix operator()(size_type row) const noexcept
+  {
+    return strings.is_null(row) ? string_prefix{0, 0}
+                                : make_string_prefix(strings.element<string_view>(row));
+  }
+};
+
+/**
+ * @brief The prefixes of the strings columns of a table, for `row_lexicographic_comparator`.
+ *
+ * Computing the prefixes reads every string once, after which comparing two strings reads their
+ * characters only if their first 8 bytes are equal.
+ */
+class table_string_prefixes {
+ public:
+  /**
+   * @brief Computes the prefixes of the strings columns of `input`.
+   *
+   * @param input Table whose rows are compared
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  table_string_prefixes(table_view const& input, rmm::cuda_stream_view stream)
+    : _pointers{0, stream}
+  {
+    if (std::none_of(input.begin(), input.end(), [](column_view const& col) {
+          return col.type().id() == type_id::STRING;
+        })) {
+      return;
+    }
+    std::vector<string_prefix const*> pointers;
+    for (auto const& col : input) {
+      if (col.type().id() != type_id::STRING) {
+        pointers.push_back(nullptr);
+        continue;
+      }
+      auto const d_col = column_device_view::create(col, stream);
+      _prefixes.emplace_back(col.size(), stream);
+      thrust::transform(rmm::exec_policy(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(col.size()),
+                        _prefixes.back().begin(),
+                        make_string_prefix_fn{*d_col});
+      pointers.push_back(_prefixes.back().data());
+    }
+    _pointers = make_device_uvector_sync(pointers, stream);
+  }
+
+  /**
+   * @brief Returns the device array of the prefixes of each column, with nullptr for the columns
+   * that are not strings, or nullptr if the table has no strings columns.
+   */
+  string_prefix const* const* data() const noexcept
+  {
+    return _pointers.is_empty() ? nullptr : _pointers.data();
+  }
+
+ private:
+  std::vector<rmm::device_uvector<string_prefix>> _prefixes;
+  rmm::device_uvector<string_prefix const*> _pointers;
+};
+
+}  // namespace detail
+}  // namespace cudf
@@ -87,5 +87,14 @@ std::unique_ptr<column> row_bit_count(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::split_by_size
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<size_type> split_by_size(table_view const& t,
+                                     std::size_t max_bytes,
+                                     rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 }  // namespace detail
 }  // namespace cudf
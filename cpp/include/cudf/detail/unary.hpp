@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -61,7 +61,8 @@ std::unique_ptr<column> true_if(
 }
 
 /**
- * @copydoc cudf::unary_operation
+ * @copydoc cudf::unary_operation(cudf::column_view const&, cudf::unary_operator,
+ * rmm::mr::device_memory_resource*)
  *
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -72,7 +73,18 @@ std::unique_ptr<cudf::column> unary_operation(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
- * @copydoc cudf::cast
+ * @copydoc cudf::unary_operation(cudf::column_view const&, cudf::unary_operator,
+ * mutable_column_view&)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void unary_operation(cudf::column_view const& input,
+                     cudf::unary_operator op,
+                     mutable_column_view& output,
+                     rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @copydoc cudf::cast(column_view const&, data_type, rmm::mr::device_memory_resource*)
  *
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -82,6 +94,15 @@ std::unique_ptr<column> cast(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::cast(column_view const&, mutable_column_view&)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void cast(column_view const& input,
+          mutable_column_view& output,
+          rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 /**
  * @copydoc cudf::is_nan
  *
@@ -487,6 +487,10 @@ hash_value_type CUDA_DEVICE_CALLABLE MurmurHash3_32<bool>::operator()(bool const
 
 /**
  * @brief Specialization of MurmurHash3_32 operator for strings.
+ *
+ * Short strings are read a byte at a time. The 4-byte blocks of longer strings are assembled
+ * with funnel shifts from aligned words of the string, which are loaded 16 bytes at a time where
+ * possible, so that hashing long strings is not bound by the number of load instructions.
  */
 template <>
 hash_value_type CUDA_DEVICE_CALLABLE
@@ -503,18 +507,51 @@ MurmurHash3_32<cudf::string_view>::operator()(cudf::string_view const& key) cons
     auto q = (uint8_t const*)(p + i);
     return q[0] | (q[1] << 8) | (q[2] << 16) | (q[3] << 24);
   };
+  auto mix_block = [c1, c2, this] __device__(uint32_t h, uint32_t k) -> uint32_t {
+    k *= c1;
+    k = rotl32(k, 15);
+    k *= c2;
+    h ^= k;
+    h = rotl32(h, 13);
+    return h * 5 + 0xe6546b64;
+  };
 
   //----------
   // body
-  uint32_t const* const blocks = reinterpret_cast<uint32_t const*>(data + nblocks * 4);
-  for (int i = -nblocks; i; i++) {
-    uint32_t k1 = getblock32(blocks, i);
-    k1 *= c1;
-    k1 = rotl32(k1, 15);
-    k1 *= c2;
-    h1 ^= k1;
-    h1 = rotl32(h1, 13);
-    h1 = h1 * 5 + 0xe6546b64;
+  constexpr int min_wide_load_length = 32;
+  if (len < min_wide_load_length) {
+    uint32_t const* const blocks = reinterpret_cast<uint32_t const*>(data + nblocks * 4);
+    for (int i = -nblocks; i; i++) {
+      h1 = mix_block(h1, getblock32(blocks, i));
+    }
+  } else {
+    // Block i is made of the bytes of words i and i + 1 after the first `misalignment` bytes.
+    // Every word read holds at least one byte of the string, so no read crosses its allocation.
+    auto const misalignment = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(data) & 3);
+    auto const words        = reinterpret_cast<uint32_t const*>(data - misalignment);
+    auto const shift        = misalignment * 8;
+    uint32_t lo             = words[0];
+    int i                   = 0;
+    auto scalar_block       = [&] __device__() {
+      uint32_t const hi = (misalignment != 0 || i + 1 < nblocks) ? words[i + 1] : 0;
+      h1                = mix_block(h1, __funnelshift_r(lo, hi, shift));
+      lo                = hi;
+      ++i;
+    };
+    while (i < nblocks && (reinterpret_cast<uintptr_t>(words + i + 1) & 15) != 0) {
+      scalar_block();
+    }
+    for (; i + 4 < nblocks; i += 4) {
+      uint4 const hi = *reinterpret_cast<uint4 const*>(words + i + 1);
+      h1             = mix_block(h1, __funnelshift_r(lo, hi.x, shift));
+      h1             = mix_block(h1, __funnelshift_r(hi.x, hi.y, shift));
+      h1             = mix_block(h1, __funnelshift_r(hi.y, hi.z, shift));
+      h1             = mix_block(h1, __funnelshift_r(hi.z, hi.w, shift));
+      lo             = hi.w;
+    }
+    while (i < nblocks) {
+      scalar_block();
+    }
   }
   //----------
   // tail
@@ -821,5 +858,269 @@ struct IdentityHash {
   uint32_t m_seed{cudf::DEFAULT_HASH_SEED};
 };
 
+namespace cudf {
+namespace detail {
+/**
+ * @brief Returns the bytes of `key` to hash with the 64-bit hash functions, as a pointer to the
+ * bytes and their number.
+ *
+ * Floating point zeros and NaNs are normalized so that equal values hash equally, and the bytes
+ * of strings are their characters.
+ */
+template <typename Key>
+struct hashable_bytes {
+  Key normalized;
+
+  CUDA_DEVICE_CALLABLE explicit hashable_bytes(Key const& key) : normalized{key}
+  {
+    if constexpr (std::is_floating_point<Key>::value) {
+      if (key == Key{0.0}) {
+        normalized = Key{0.0};
+      } else if (isnan(key)) {
+        normalized = std::numeric_limits<Key>::quiet_NaN();
+      }
+    }
+  }
+
+  CUDA_DEVICE_CALLABLE uint8_t const* data() const
+  {
+    if constexpr (std::is_same<Key, cudf::string_view>::value) {
+      return reinterpret_cast<uint8_t const*>(normalized.data());
+    } else {
+      return reinterpret_cast<uint8_t const*>(&normalized);
+    }
+  }
+
+  CUDA_DEVICE_CALLABLE cudf::size_type size() const
+  {
+    if constexpr (std::is_same<Key, cudf::string_view>::value) {
+      return normalized.size_bytes();
+    } else {
+      return sizeof(Key);
+    }
+  }
+};
+
+/**
+ * @brief Reads a little-endian 64-bit word from a possibly unaligned address.
+ */
+CUDA_DEVICE_CALLABLE uint64_t load_u64(uint8_t const* p)
+{
+  uint64_t word = 0;
+  for (int i = 7; i >= 0; --i) {
+    word = (word << 8) | p[i];
+  }
+  return word;
+}
+
+/**
+ * @brief Reads a little-endian 32-bit word from a possibly unaligned address.
+ */
+CUDA_DEVICE_CALLABLE uint32_t load_u32(uint8_t const* p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+CUDA_DEVICE_CALLABLE uint64_t rotl64(uint64_t x, int8_t r) { return (x << r) | (x >> (64 - r)); }
+
+}  // namespace detail
+}  // namespace cudf
+
+/**
+ * @brief xxHash64 hash function, computing 64-bit hash values that collide much less than the
+ * 32-bit MurmurHash3_32 on large key sets.
+ *
+ * xxHash was written by Yann Collet and is distributed under the BSD 2-Clause License.
+ */
+template <typename Key>
+struct XXHash_64 {
+  using argument_type = Key;
+  using result_type   = uint64_t;
+
+  XXHash_64() = default;
+  constexpr XXHash_64(uint64_t seed) : m_seed(seed) {}
+
+  result_type CUDA_DEVICE_CALLABLE operator()(Key const& key) const
+  {
+    if constexpr (std::is_same<Key, cudf::list_view>::value ||
+                  std::is_same<Key, cudf::struct_view>::value) {
+      cudf_assert(false && "Direct hashing of nested types is not supported");
+      return 0;
+    } else if constexpr (std::is_same<Key, bool>::value) {
+      return XXHash_64<uint8_t>{m_seed}(static_cast<uint8_t>(key));
+    } else {
+      cudf::detail::hashable_bytes<Key> const bytes{key};
+      return compute(bytes.data(), bytes.size());
+    }
+  }
+
+ private:
+  static constexpr uint64_t prime1 = 0x9E3779B185EBCA87ull;
+  static constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+  static constexpr uint64_t prime3 = 0x165667B19E3779F9ull;
+  static constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ull;
+  static constexpr uint64_t prime5 = 0x27D4EB2F165667C5ull;
+
+  CUDA_DEVICE_CALLABLE static uint64_t round(uint64_t acc, uint64_t input)
+  {
+    return cudf::detail::rotl64(acc + input * prime2, 31) * prime1;
+  }
+
+  CUDA_DEVICE_CALLABLE static uint64_t merge_round(uint64_t acc, uint64_t val)
+  {
+    return (acc ^ round(0, val)) * prime1 + prime4;
+  }
+
+  result_type CUDA_DEVICE_CALLABLE compute(uint8_t const* data, cudf::size_type len) const
+  {
+    uint8_t const* const end = data + len;
+    uint64_t h;
+
+    if (len >= 32) {
+      uint64_t v1 = m_seed + prime1 + prime2;
+      uint64_t v2 = m_seed + prime2;
+      uint64_t v3 = m_seed;
+      uint64_t v4 = m_seed - prime1;
+      for (; data + 32 <= end; data += 32) {
+        v1 = round(v1, cudf::detail::load_u64(data));
+        v2 = round(v2, cudf::detail::load_u64(data + 8));
+        v3 = round(v3, cudf::detail::load_u64(data + 16));
+        v4 = round(v4, cudf::detail::load_u64(data + 24));
+      }
+      h = cudf::detail::rotl64(v1, 1) + cudf::detail::rotl64(v2, 7) +
+          cudf::detail::rotl64(v3, 12) + cudf::detail::rotl64(v4, 18);
+      h = merge_round(h, v1);
+      h = merge_round(h, v2);
+      h = merge_round(h, v3);
+      h = merge_round(h, v4);
+    } else {
+      h = m_seed + prime5;
+    }
+    h += static_cast<uint64_t>(len);
+
+    for (; data + 8 <= end; data += 8) {
+      h ^= round(0, cudf::detail::load_u64(data));
+      h = cudf::detail::rotl64(h, 27) * prime1 + prime4;
+    }
+    if (data + 4 <= end) {
+      h ^= static_cast<uint64_t>(cudf::detail::load_u32(data)) * prime1;
+      h = cudf::detail::rotl64(h, 23) * prime2 + prime3;
+      data += 4;
+    }
+    for (; data < end; ++data) {
+      h ^= *data * prime5;
+      h = cudf::detail::rotl64(h, 11) * prime1;
+    }
+
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+  }
+
+  uint64_t m_seed{cudf::DEFAULT_HASH_SEED};
+};
+
+/**
+ * @brief 64-bit MurmurHash3 hash function, returning the first 64 bits of the x64 128-bit
+ * variant of MurmurHash3.
+ */
+template <typename Key>
+struct MurmurHash3_64 {
+  using argument_type = Key;
+  using result_type   = uint64_t;
+
+  MurmurHash3_64() = default;
+  constexpr MurmurHash3_64(uint64_t seed) : m_seed(seed) {}
+
+  result_type CUDA_DEVICE_CALLABLE operator()(Key const& key) const
+  {
+    if constexpr (std::is_same<Key, cudf::list_view>::value ||
+                  std::is_same<Key, cudf::struct_view>::value) {
+      cudf_assert(false && "Direct hashing of nested types is not supported");
+      return 0;
+    } else if constexpr (std::is_same<Key, bool>::value) {
+      return MurmurHash3_64<uint8_t>{m_seed}(static_cast<uint8_t>(key));
+    } else {
+      cudf::detail::hashable_bytes<Key> const bytes{key};
+      return compute(bytes.data(), bytes.size());
+    }
+  }
+
+ private:
+  CUDA_DEVICE_CALLABLE static uint64_t fmix64(uint64_t k)
+  {
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdull;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ull;
+    k ^= k >> 33;
+    return k;
+  }
+
+  result_type CUDA_DEVICE_CALLABLE compute(uint8_t const* data, cudf::size_type len) const
+  {
+    constexpr uint64_t c1 = 0x87c37b91114253d5ull;
+    constexpr uint64_t c2 = 0x4cf5ad432745937full;
+    auto const nblocks    = len / 16;
+
+    uint64_t h1 = m_seed;
+    uint64_t h2 = m_seed;
+    //----------
+    // body
+    for (cudf::size_type i = 0; i < nblocks; i++) {
+      uint64_t k1 = cudf::detail::load_u64(data + i * 16);
+      uint64_t k2 = cudf::detail::load_u64(data + i * 16 + 8);
+
+      h1 ^= cudf::detail::rotl64(k1 * c1, 31) * c2;
+      h1 = cudf::detail::rotl64(h1, 27) + h2;
+      h1 = h1 * 5 + 0x52dce729;
+
+      h2 ^= cudf::detail::rotl64(k2 * c2, 33) * c1;
+      h2 = cudf::detail::rotl64(h2, 31) + h1;
+      h2 = h2 * 5 + 0x38495ab5;
+    }
+    //----------
+    // tail
+    uint8_t const* tail = data + nblocks * 16;
+    uint64_t k1         = 0;
+    uint64_t k2         = 0;
+    switch (len & 15) {
+      case 15: k2 ^= static_cast<uint64_t>(tail[14]) << 48;
+      case 14: k2 ^= static_cast<uint64_t>(tail[13]) << 40;
+      case 13: k2 ^= static_cast<uint64_t>(tail[12]) << 32;
+      case 12: k2 ^= static_cast<uint64_t>(tail[11]) << 24;
+      case 11: k2 ^= static_cast<uint64_t>(tail[10]) << 16;
+      case 10: k2 ^= static_cast<uint64_t>(tail[9]) << 8;
+      case 9:
+        k2 ^= static_cast<uint64_t>(tail[8]);
+        h2 ^= cudf::detail::rotl64(k2 * c2, 33) * c1;
+      case 8: k1 ^= static_cast<uint64_t>(tail[7]) << 56;
+      case 7: k1 ^= static_cast<uint64_t>(tail[6]) << 48;
+      case 6: k1 ^= static_cast<uint64_t>(tail[5]) << 40;
+      case 5: k1 ^= static_cast<uint64_t>(tail[4]) << 32;
+      case 4: k1 ^= static_cast<uint64_t>(tail[3]) << 24;
+      case 3: k1 ^= static_cast<uint64_t>(tail[2]) << 16;
+      case 2: k1 ^= static_cast<uint64_t>(tail[1]) << 8;
+      case 1:
+        k1 ^= static_cast<uint64_t>(tail[0]);
+        h1 ^= cudf::detail::rotl64(k1 * c1, 31) * c2;
+    };
+    //----------
+    // finalization
+    h1 ^= static_cast<uint64_t>(len);
+    h2 ^= static_cast<uint64_t>(len);
+    h1 += h2;
+    h2 += h1;
+    h1 = fmix64(h1);
+    h2 = fmix64(h2);
+    return h1 + h2;
+  }
+
+  uint64_t m_seed{cudf::DEFAULT_HASH_SEED};
+};
+
 template <typename Key>
 using default_hash = MurmurHash3_32<Key>;
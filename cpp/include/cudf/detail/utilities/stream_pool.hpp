@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Returns up to `count` streams of the global stream pool, each waiting for the work
+ * already queued on `stream`.
+ *
+ * The pool streams are non-blocking and shared by all threads, which take them in round-robin
+ * order. When the pool has a single stream or `count` is at most 1, returns `stream` itself.
+ * Work submitted to the returned streams must be joined back into `stream` with `join_streams`
+ * before `stream` consumes its results.
+ *
+ * Memory allocated on a forked stream is freed on that stream. Buffers that outlive the forked
+ * work, such as those of the output columns, must be moved to `stream` after the join, e.g. with
+ * `rmm::device_buffer::set_stream`.
+ *
+ * Example:
+ * ```
+ * auto const streams = cudf::detail::fork_streams(stream, input.num_columns());
+ * for (size_type i = 0; i < input.num_columns(); ++i) {
+ *   process(input.column(i), streams[i % streams.size()]);
+ * }
+ * cudf::detail::join_streams(streams, stream);
+ * ```
+ *
+ * @param stream Stream whose work the returned streams wait for
+ * @param count Number of streams requested
+ * @return The forked streams, at least one
+ */
+std::vector<rmm::cuda_stream_view> fork_streams(rmm::cuda_stream_view stream, std::size_t count);
+
+/**
+ * @brief Makes `stream` wait for the work queued on each of the `forked_streams`.
+ *
+ * Does not block the calling thread.
+ *
+ * @param forked_streams Streams returned by `fork_streams`
+ * @param stream Stream that waits for the forked streams
+ */
+void join_streams(host_span<rmm::cuda_stream_view const> forked_streams,
+                  rmm::cuda_stream_view stream);
+
+}  // namespace detail
+}  // namespace cudf
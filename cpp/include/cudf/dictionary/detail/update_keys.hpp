@@ -99,7 +99,8 @@ std::vector<std::unique_ptr<column>> match_dictionaries(
  * Merging the dictionary keys also adjusts the indices appropriately in the
  * output dictionary columns.
  *
- * Any null rows are left unchanged.
+ * Any null rows are left unchanged. Dictionary columns that already have the same keys
+ * are not matched and their column_views are copied like the other columns.
  *
  * @param input Vector of cudf::table_views that include dictionary columns to be matched.
  * @param mr Device memory resource used to allocate the returned column's device memory.
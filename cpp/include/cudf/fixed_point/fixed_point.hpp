@@ -48,7 +48,8 @@ enum class Radix : int32_t { BASE_2 = 2, BASE_10 = 10 };
 template <typename T>
 constexpr inline auto is_supported_representation_type()
 {
-  return cuda::std::is_same<T, int32_t>::value || cuda::std::is_same<T, int64_t>::value;
+  return cuda::std::is_same<T, int32_t>::value || cuda::std::is_same<T, int64_t>::value ||
+         cuda::std::is_same<T, __int128_t>::value;
 }
 
 template <typename T>
@@ -151,6 +152,32 @@ CUDA_HOST_DEVICE_CALLABLE constexpr T shift(T const& val, scale_type const& scal
     return left_shift<Rep, Rad>(val, scale);
 }
 
+/**
+ * @brief Returns the decimal digits of `value`
+ */
+template <typename T>
+std::string to_string(T value)
+{
+  return std::to_string(value);
+}
+
+/**
+ * @brief Returns the decimal digits of `value`, which `std::to_string` does not support
+ */
+inline std::string to_string(__int128_t value)
+{
+  if (value == 0) { return "0"; }
+  std::string digits;
+  // the digits of a negative value are negated one at a time, so that the minimum has no overflow
+  for (auto remaining = value; remaining != 0; remaining /= 10) {
+    auto const digit = static_cast<int>(remaining % 10);
+    digits.push_back(static_cast<char>('0' + (digit < 0 ? -digit : digit)));
+  }
+  if (value < 0) { digits.push_back('-'); }
+  std::reverse(digits.begin(), digits.end());
+  return digits;
+}
+
 }  // namespace detail
 
 /**
@@ -169,7 +196,7 @@ CUDA_HOST_DEVICE_CALLABLE constexpr T shift(T const& val, scale_type const& scal
  * auto n = decimal32{scaled_integer{1001, 3}}; // n = 1.001
  * ```
  *
- * @tparam Rep The representation type (either `int32_t` or `int64_t`)
+ * @tparam Rep The representation type (`int32_t`, `int64_t` or `__int128_t`)
  */
 template <typename Rep,
           typename cuda::std::enable_if_t<is_supported_representation_type<Rep>()>* = nullptr>
@@ -185,7 +212,7 @@ struct scaled_integer {
  * Currently, only binary and decimal `fixed_point` numbers are supported.
  * Binary operations can only be performed with other `fixed_point` numbers
  *
- * @tparam Rep The representation type (either `int32_t` or `int64_t`)
+ * @tparam Rep The representation type (`int32_t`, `int64_t` or `__int128_t`)
  * @tparam Rad The radix/base (either `Radix::BASE_2` or `Radix::BASE_10`)
  */
 template <typename Rep, Radix Rad>
@@ -549,17 +576,17 @@ class fixed_point {
   explicit operator std::string() const
   {
     if (_scale < 0) {
-      auto const av   = std::abs(_value);
-      int64_t const n = std::pow(10, -_scale);
-      int64_t const f = av % n;
+      auto const av = _value < 0 ? -_value : _value;
+      auto const n  = detail::ipow<Rep, Radix::BASE_10>(static_cast<int32_t>(-_scale));
+      auto const f  = av % n;
       auto const num_zeros =
-        std::max(0, (-_scale - static_cast<int32_t>(std::to_string(f).size())));
+        std::max(0, (-_scale - static_cast<int32_t>(detail::to_string(f).size())));
       auto const zeros = std::string(num_zeros, '0');
       auto const sign  = _value < 0 ? std::string("-") : std::string();
-      return sign + std::to_string(av / n) + std::string(".") + zeros + std::to_string(av % n);
+      return sign + detail::to_string(av / n) + std::string(".") + zeros + detail::to_string(f);
     } else {
       auto const zeros = std::string(_scale, '0');
-      return std::to_string(_value) + zeros;
+      return detail::to_string(_value) + zeros;
     }
   }
 };
@@ -752,6 +779,13 @@ CUDA_HOST_DEVICE_CALLABLE bool operator>(fixed_point<Rep1, Rad1> const& lhs,
 
 using decimal32 = fixed_point<int32_t, Radix::BASE_10>;
 using decimal64 = fixed_point<int64_t, Radix::BASE_10>;
+/**
+ * @brief A 128-bit decimal value for host and device arithmetic
+ *
+ * There is no column type for `decimal128`: it has no `type_id` and is not handled by the type
+ * dispatcher, so it cannot be stored in a column or passed to column operations or I/O.
+ */
+using decimal128 = fixed_point<__int128_t, Radix::BASE_10>;
 
 /** @} */  // end of group
 }  // namespace numeric
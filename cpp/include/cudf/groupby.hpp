@@ -23,6 +23,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -42,6 +43,14 @@ class sort_groupby_helper;
  * @file
  */
 
+/**
+ * @brief Order of the rows returned by `groupby::scan`.
+ */
+enum class scan_order : bool {
+  GROUPED,  ///< The rows of each group are adjacent, in the order of the sorted keys
+  INPUT     ///< The rows are in the order of the keys given to the groupby object
+};
+
 /**
  * @brief Request for groupby aggregation(s) to perform on a column.
  *
@@ -110,6 +119,44 @@ class groupby {
                    std::vector<order> const& column_order         = {},
                    std::vector<null_order> const& null_precedence = {});
 
+  /**
+   * @brief Construct a groupby object with the specified `keys` whose rows are already grouped
+   *
+   * Equal rows of `keys` must be adjacent, e.g. as in the `keys` of the `groups` returned by
+   * `get_groups`. The rows of group `i` are `[group_offsets[i], group_offsets[i+1])`, so the keys
+   * are neither sorted nor compared. Rows with null values are grouped like any other row.
+   *
+   * @note This object does *not* maintain the lifetime of `keys`.
+   *
+   * @throws cudf::logic_error if `group_offsets` does not start at 0 and end at `keys.num_rows()`
+   *
+   * @param keys Table whose rows act as the groupby keys
+   * @param group_offsets Offsets of the first row of each group in `keys`, followed by
+   * `keys.num_rows()`
+   */
+  groupby(table_view const& keys, host_span<size_type const> group_offsets);
+
+  /**
+   * @brief Construct a groupby object reusing the grouping of the keys of another one
+   *
+   * The keys are grouped at most once for all the `groupby` objects sharing `grouping`, so the
+   * aggregations, scans and shifts of all of them reuse the same sorted order and group offsets.
+   * `groupby` objects sharing a grouping must not be used concurrently.
+   *
+   * @note This object does *not* maintain the lifetime of the keys of `grouping`.
+   *
+   * @param grouping Grouping returned by `groupby::grouping()`
+   */
+  explicit groupby(std::shared_ptr<detail::sort::sort_groupby_helper> grouping);
+
+  /**
+   * @brief Returns the grouping of the keys used by the sort-based implementation
+   *
+   * The returned handle can be passed to the constructor of other `groupby` objects over the same
+   * keys to reuse the grouping, which is computed on first use by any of them.
+   */
+  std::shared_ptr<detail::sort::sort_groupby_helper> grouping();
+
   /**
    * @brief Performs grouped aggregations on the specified values.
    *
@@ -222,6 +269,46 @@ class groupby {
     host_span<aggregation_request const> requests,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+  /**
+   * @brief Performs grouped scans on the specified values, returning the rows in `order`.
+   *
+   * With `scan_order::GROUPED`, this is the same as `scan(requests, mr)`.
+   *
+   * With `scan_order::INPUT`, row `i` of the returned keys and results is the `i`th row of the
+   * `keys` given to the groupby object, skipping the rows excluded for their null keys. The keys
+   * are not sorted: each row is labeled with the group of its key from a hash map, and the
+   * results are computed in the order of the labels and returned in the input order.
+   *
+   * Example:
+   * ```
+   * Input:
+   * keys:     {1 2 1 3 1}
+   * request:
+   *   values: {3 1 4 9 2}
+   *   aggregations: {{SUM}}
+   *
+   * result with scan_order::INPUT:
+   *
+   * keys:  {1 2 1 3 1}
+   * values:
+   *   SUM: {3 1 7 9 9}
+   * ```
+   *
+   * @throws cudf::logic_error If `requests[i].values.size() !=
+   * keys.num_rows()`.
+   *
+   * @param requests The set of columns to scan and the scans to perform
+   * @param order Order of the returned rows
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @return Pair containing the table with each row's key and
+   * a vector of aggregation_results for each request in the same order as
+   * specified in `requests`.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> scan(
+    host_span<aggregation_request const> requests,
+    scan_order order,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
   /**
    * @brief Performs grouped shifts for specified values.
    *
@@ -297,7 +384,7 @@ class groupby {
   std::vector<null_order> _null_precedence{};            ///< If keys are sorted,
                                                          ///< indicates null order
                                                          ///< of each column
-  std::unique_ptr<detail::sort::sort_groupby_helper>
+  std::shared_ptr<detail::sort::sort_groupby_helper>
     _helper;  ///< Helper object
               ///< used by sort based implementation
 
@@ -318,6 +405,15 @@ class groupby {
     rmm::cuda_stream_view stream,
     rmm::mr::device_memory_resource* mr);
 
+  /**
+   * @brief Computes the aggregations supported by the hash-based groupby with it, and the others
+   * with the sort-based groupby, then returns all results in the order of the sorted keys.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> hash_and_sort_aggregate(
+    host_span<aggregation_request const> requests,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr);
+
   // Sort-based groupby
   std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> sort_aggregate(
     host_span<aggregation_request const> requests,
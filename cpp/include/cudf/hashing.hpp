@@ -28,9 +28,15 @@ namespace cudf {
 /**
  * @brief Computes the hash value of each row in the input set of columns.
  *
+ * `HASH_XXHASH64` and `HASH_MURMUR3_64` return a `UINT64` column. They hash the columns of a row
+ * from left to right, each element being hashed with the hash of the previous elements as seed,
+ * starting from `seed`. Null elements leave the hash unchanged.
+ *
  * @param input The table of columns to hash
+ * @param hash_function The hash function to use
  * @param initial_hash Optional vector of initial hash values for each column.
  * If this vector is empty then each element will be hashed as-is.
+ * @param seed Optional seed value of the serial and 64-bit hash functions
  * @param mr Device memory resource used to allocate the returned column's device memory.
  *
  * @returns A column where each row is the hash of a column from the input
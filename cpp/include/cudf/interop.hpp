@@ -17,14 +17,43 @@
 #pragma once
 
 #include <arrow/api.h>
+#include <arrow/c/abi.h>
 #include <cudf/column/column.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <utility>
+#include <vector>
+
 struct DLManagedTensor;
 
+// The Arrow C Device Data Interface structures, as defined by the Arrow specification for
+// producers and consumers that do not get them from an Arrow release.
+#ifndef ARROW_C_DEVICE_DATA_INTERFACE
+#define ARROW_C_DEVICE_DATA_INTERFACE
+
+typedef int32_t ArrowDeviceType;
+
+#define ARROW_DEVICE_CPU 1
+#define ARROW_DEVICE_CUDA 2
+#define ARROW_DEVICE_CUDA_HOST 3
+#define ARROW_DEVICE_CUDA_MANAGED 13
+
+struct ArrowDeviceArray {
+  struct ArrowArray array;
+  int64_t device_id;
+  ArrowDeviceType device_type;
+  void* sync_event;
+  int64_t reserved[3];
+};
+
+#endif  // ARROW_C_DEVICE_DATA_INTERFACE
+
 namespace cudf {
 /**
  * @addtogroup interop_dlpack
@@ -75,6 +104,30 @@ DLManagedTensor* to_dlpack(
   table_view const& input,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Convert a cudf table into a DLPack DLTensor, sharing its device memory when possible
+ *
+ * The requirements on `input` are those of `to_dlpack`. When `input` has a single column, or
+ * its columns are equally spaced in device memory as are the columns of one column-major matrix,
+ * the tensor views their memory without copying it. Otherwise the rows of `input` are
+ * interleaved into a new row-major tensor, the layout deep learning frameworks favor.
+ *
+ * @note A tensor viewing `input` does not own its memory, so `input` must outlive it and writes
+ * through either one are seen by the other. The `deleter` of the returned `DLManagedTensor` must
+ * be called in either case.
+ *
+ * @throw cudf::logic_error if the data types are not equal or not numeric,
+ * or if any of columns have non-zero null count
+ *
+ * @param input Table to convert to DLPack
+ * @param mr Device memory resource used to allocate the tensor's device memory when it is copied
+ *
+ * @return 1D or 2D DLPack tensor viewing or holding the table data, or nullptr
+ */
+DLManagedTensor* to_dlpack_view(
+  table_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 
 /**
@@ -126,5 +179,89 @@ std::unique_ptr<table> from_arrow(
   arrow::Table const& input,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create `cudf::table` from given arrow Table input, asynchronously
+ *
+ * Same as `from_arrow`, but the host buffers of `input` are first packed into pinned staging
+ * memory and sent to the device with a single transfer, instead of one pageable transfer per
+ * buffer. The packing and conversion run on a background thread, so the caller can keep working
+ * while a large host table is brought onto the device.
+ *
+ * The device briefly holds both the staged buffers and the resulting table.
+ *
+ * @param input arrow:Table that needs to be converted to `cudf::table`, which must stay alive
+ * until the returned future is ready
+ * @param mr    Device memory resource used to allocate `cudf::table`
+ * @return Future of the cudf table generated from given arrow Table, usable on any stream once
+ * ready
+ */
+std::future<std::unique_ptr<table>> from_arrow_async(
+  arrow::Table const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/// An `ArrowSchema` released by its `release` callback when the pointer is destroyed
+using unique_schema_t = std::unique_ptr<ArrowSchema, void (*)(ArrowSchema*)>;
+
+/// An `ArrowDeviceArray` released by its `release` callback when the pointer is destroyed
+using unique_device_array_t = std::unique_ptr<ArrowDeviceArray, void (*)(ArrowDeviceArray*)>;
+
+/**
+ * @brief Create the Arrow C Data Interface schema of the cudf table `input`
+ *
+ * The schema is a struct whose children are the columns of `input`, named by `metadata`.
+ * It describes the arrays produced by `to_arrow_device`.
+ *
+ * @throws cudf::logic_error if `metadata` is not empty and its size doesn't match the number
+ * of columns, or if a column has a type not supported by the device interface: dictionary,
+ * fixed point and `DURATION_DAYS` columns are not supported.
+ *
+ * @param input table_view whose schema is created
+ * @param metadata Contains hierarchy of names of columns and children
+ * @return Arrow schema of `input`
+ */
+unique_schema_t to_arrow_schema(table_view const& input,
+                                std::vector<column_metadata> const& metadata = {});
+
+/**
+ * @brief Export the cudf table `input` through the Arrow C Device Data Interface
+ *
+ * The device memory of `input` is shared with the returned array without copies and is freed
+ * once the array and any of its children moved out by the consumer are released. The only
+ * columns copied are BOOL8 columns, which Arrow stores as bits.
+ *
+ * The `sync_event` of the returned array points to a `cudaEvent_t` recorded after the work of
+ * this function, for consumers working on another stream.
+ *
+ * @throws cudf::logic_error if a column has a type not supported by `to_arrow_schema`
+ *
+ * @param input Table whose ownership is passed to the returned array
+ * @param mr Device memory resource used to allocate the converted BOOL8 columns
+ * @return Arrow device array holding the columns of `input` as the children of a struct
+ */
+unique_device_array_t to_arrow_device(
+  table&& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief View an Arrow C Device Data Interface array as a cudf table
+ *
+ * The device memory of `input` is viewed without copies, so `input` must not be released
+ * while the returned table_view is in use. Arrow boolean arrays, which store bits, are the
+ * only ones converted and the resulting BOOL8 columns are returned with the view.
+ *
+ * If `input` has a `sync_event`, it is waited on before any work is done.
+ *
+ * @throws cudf::logic_error if `schema` is not a struct, if the device of `input` is not a
+ * CUDA device or if a child has a type that cudf does not support
+ *
+ * @param schema Schema of `input`, a struct whose children are the columns
+ * @param input Arrow device array to view
+ * @param mr Device memory resource used to allocate the converted boolean columns
+ * @return The table_view of `input` and the columns it views that had to be converted
+ */
+std::pair<table_view, std::vector<std::unique_ptr<column>>> from_arrow_device(
+  ArrowSchema const* schema,
+  ArrowDeviceArray const* input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
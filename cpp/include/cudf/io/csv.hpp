@@ -29,6 +29,13 @@
 namespace cudf {
 namespace io {
 
+// Forward declaration
+namespace detail {
+namespace csv {
+class chunked_reader;
+}  // namespace csv
+}  // namespace detail
+
 /**
  * @addtogroup io_readers
  * @{
@@ -111,6 +118,8 @@ class csv_reader_options {
 
   // Per-column types; disables type inference on those columns
   std::vector<std::string> _dtypes;
+  // Rows to infer the column types from; 0 is all
+  size_type _type_inference_sample_rows = 0;
   // Additional values to recognize as boolean true values
   std::vector<std::string> _true_values{"True", "TRUE", "true"};
   // Additional values to recognize as boolean false values
@@ -291,6 +300,12 @@ class csv_reader_options {
    */
   std::vector<std::string> const& get_dtypes() const { return _dtypes; }
 
+  /**
+   * @brief Returns the number of rows, spread across the data, that column types are inferred
+   * from; 0 if they are inferred from all rows.
+   */
+  size_type get_type_inference_sample_rows() const { return _type_inference_sample_rows; }
+
   /**
    * @brief Returns additional values to recognize as boolean true values.
    */
@@ -565,6 +580,21 @@ class csv_reader_options {
    */
   void set_dtypes(std::vector<std::string> types) { _dtypes = std::move(types); }
 
+  /**
+   * @brief Sets the number of rows to infer column types from.
+   *
+   * Types are inferred from rows spread evenly across the data and the data is converted in the
+   * same pass. Columns holding a value that doesn't fit the inferred type are then inferred from
+   * all rows and converted again, so the result matches inference from all rows.
+   *
+   * @param rows Number of rows to sample; 0 to infer types from all rows
+   */
+  void set_type_inference_sample_rows(size_type rows)
+  {
+    CUDF_EXPECTS(rows >= 0, "Number of sampled rows cannot be negative");
+    _type_inference_sample_rows = rows;
+  }
+
   /**
    * @brief Sets additional values to recognize as boolean true values.
    *
@@ -974,6 +1004,18 @@ class csv_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the number of rows to infer column types from.
+   *
+   * @param rows Number of rows to sample; 0 to infer types from all rows
+   * @return this for chaining.
+   */
+  csv_reader_options_builder& type_inference_sample_rows(size_type rows)
+  {
+    options.set_type_inference_sample_rows(rows);
+    return *this;
+  }
+
   /**
    * @brief Sets additional values to recognize as boolean true values.
    *
@@ -1093,6 +1135,77 @@ table_with_metadata read_csv(
   csv_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked CSV reader class to read a CSV dataset iteratively into a series of tables,
+ * chunk by chunk.
+ *
+ * The source is read and parsed `chunk_size` bytes at a time; the next chunk is read from the
+ * source while the current one is parsed on the device. A row that continues past the end of a
+ * chunk is carried over and returned with the next chunk, so rows, including quoted fields that
+ * span lines, are never split. Column names and types are resolved from the first chunk and
+ * used for all the following chunks; set the column types explicitly if the first chunk is not
+ * representative of the dataset.
+ *
+ * Byte ranges, `skiprows`, `skipfooter`, `nrows` and compressed input are not supported.
+ *
+ * The following code snippet demonstrates how to read a file in chunks:
+ * @code
+ *  auto reader = cudf::io::csv_chunked_reader(chunk_size, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    ...
+ *  }
+ * @endcode
+ */
+class csv_chunked_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  csv_chunked_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * @param chunk_size Number of source bytes to read and parse per chunk
+   * @param options The options used to read the CSV dataset
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  csv_chunked_reader(
+    std::size_t chunk_size,
+    csv_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   */
+  ~csv_chunked_reader();
+
+  /**
+   * @brief Check if there is any data in the given source has not yet read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Read a chunk of rows in the given CSV source.
+   *
+   * The sequence of returned tables, if concatenated by their order, guarantees to form a complete
+   * dataset as reading the entire given source at once.
+   *
+   * An empty table will be returned if all the data in the source has been read and returned by
+   * the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  table_with_metadata read_chunk();
+
+ private:
+  std::unique_ptr<cudf::io::detail::csv::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -21,6 +21,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -134,6 +135,35 @@ class data_sink {
     CUDF_FAIL("data_sink classes that support device_write must override it.");
   }
 
+  /**
+   * @brief Asynchronously append the buffer content to the sink from a gpu address
+   *
+   * The data is placed in the sink in call order with respect to the other writes, so the writes
+   * that follow can be issued before the returned future is ready. The data must be ready on
+   * `stream` at the time of the call and must remain valid until the future is ready.
+   *
+   * For optimal performance, should only be called when `is_device_write_preferred` returns `true`.
+   * The default implementation calls `device_write` and returns a future that is already ready.
+   *
+   * @throws cudf::logic_error the object does not support direct device writes, i.e.
+   * `supports_device_write` returns `false`.
+   *
+   * @param gpu_data Pointer to the buffer to be written into the sink object
+   * @param size Number of bytes to write
+   * @param stream CUDA stream to use
+   *
+   * @return Future that is ready once the data has been written
+   */
+  virtual std::future<void> device_write_async(void const* gpu_data,
+                                               size_t size,
+                                               rmm::cuda_stream_view stream)
+  {
+    device_write(gpu_data, size, stream);
+    std::promise<void> written;
+    written.set_value();
+    return written.get_future();
+  }
+
   /**
    * @brief Flush the data written into the sink
    */
@@ -20,13 +20,22 @@
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 
 #include <arrow/buffer.h>
+#include <arrow/filesystem/filesystem.h>
 #include <arrow/io/file.h>
 #include <arrow/io/interfaces.h>
 #include <arrow/io/memory.h>
 
+#include <future>
+#include <list>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 //! IO interfaces
@@ -64,9 +73,12 @@ class datasource {
   };
 
   /**
-   * @brief Creates a source from a file path.
+   * @brief Creates a source from a file path or a remote URI.
    *
-   * @param[in] filepath Path to the file to use
+   * Paths with a URI scheme other than `file://` (e.g. `s3://bucket/key`) are read with
+   * `remote_source`. Plain paths and `file://` URIs are read as local files.
+   *
+   * @param[in] filepath Path to the file or URI of the object to use
    * @param[in] offset Bytes from the start of the file (the default is zero)
    * @param[in] size Bytes from the offset; use zero for entire file (the default is zero)
    */
@@ -205,6 +217,66 @@ class datasource {
     CUDF_FAIL("datasource classes that support device_read must override it.");
   }
 
+  /**
+   * @brief A range of the source to read into existing memory.
+   */
+  struct read_request {
+    size_t offset;  ///< Bytes from the start of the source
+    size_t size;    ///< Bytes to read
+    uint8_t* dst;   ///< Address of the destination memory
+  };
+
+  /**
+   * @brief Returns the largest gap between two ranges that are still read with a single call by
+   * the batched `host_read_async` and `device_read_async`.
+   *
+   * Sources with a high per-read latency should override it to return a larger gap.
+   *
+   * @return size_t The gap in bytes
+   */
+  virtual size_t read_coalesce_gap() const { return 64 << 10; }
+
+  /**
+   * @brief Whether the read functions of this source can be called from multiple threads at once.
+   *
+   * Batched reads are only dispatched concurrently for sources that return true. Data source
+   * implementations with thread-safe reads should override it to return true.
+   *
+   * @return bool Whether this source supports concurrent reads
+   */
+  virtual bool supports_concurrent_reads() const { return false; }
+
+  /**
+   * @brief Reads a batch of ranges into preallocated host memory, asynchronously.
+   *
+   * Ranges that are close together in the source are read with a single call, and the resulting
+   * reads are dispatched concurrently if `supports_concurrent_reads` returns `true`. The default
+   * implementation is built on `host_read`. The source and the destination memory must remain valid
+   * until the returned future is ready.
+   *
+   * @param requests Ranges to read and their destinations in host memory
+   *
+   * @return Future of the total number of bytes read
+   */
+  virtual std::future<size_t> host_read_async(std::vector<read_request> requests);
+
+  /**
+   * @brief Reads a batch of ranges into preallocated device memory, asynchronously.
+   *
+   * Same as `host_read_async`, but built on `device_read`. The data is available on `stream` once
+   * the returned future is ready.
+   *
+   *  @throws cudf::logic_error when the object does not support direct device reads, i.e.
+   * `supports_device_read` returns `false`.
+   *
+   * @param requests Ranges to read and their destinations in device memory
+   * @param stream CUDA stream to use
+   *
+   * @return Future of the total number of bytes read
+   */
+  virtual std::future<size_t> device_read_async(std::vector<read_request> requests,
+                                                rmm::cuda_stream_view stream);
+
   /**
    * @brief Returns the size of the data in the source.
    *
@@ -329,6 +401,11 @@ class arrow_io_source : public datasource {
     return result.ValueOrDie();
   }
 
+  /**
+   * @brief `ReadAt` calls on `arrow` random access files are thread-safe.
+   */
+  bool supports_concurrent_reads() const override { return true; }
+
   /**
    * @brief Returns the size of the data in the `arrow` source.
    */
@@ -343,5 +420,259 @@ class arrow_io_source : public datasource {
   std::shared_ptr<arrow::io::RandomAccessFile> arrow_file;
 };
 
+/**
+ * @brief Bounded LRU cache of fixed-size, aligned blocks of source data.
+ *
+ * The cache can be shared by any number of `caching_source` objects, including ones used by
+ * different reader calls; blocks are keyed by the cache key of the source and the block index.
+ * When inserting a block would exceed the capacity, the least recently used blocks are evicted.
+ * All member functions are thread-safe.
+ */
+class datasource_block_cache {
+ public:
+  /**
+   * @brief Where the cached blocks are stored.
+   */
+  enum class location { HOST, DEVICE };
+
+  /**
+   * @brief One cached block; only the member that matches the cache location holds data.
+   */
+  struct block {
+    std::vector<uint8_t> host_data;
+    rmm::device_buffer device_data;
+    size_t size = 0;
+
+    uint8_t const* data(location loc) const
+    {
+      return loc == location::HOST ? host_data.data()
+                                   : static_cast<uint8_t const*>(device_data.data());
+    }
+  };
+
+  /**
+   * @brief Creates an empty cache.
+   *
+   * @param capacity Maximum total size of the cached blocks, in bytes
+   * @param block_size Size of the blocks, in bytes; reads from the sources are aligned to it
+   * @param loc Whether the blocks are kept in host or device memory
+   */
+  explicit datasource_block_cache(size_t capacity,
+                                  size_t block_size = 1 << 20,
+                                  location loc      = location::HOST);
+
+  size_t block_size() const { return _block_size; }
+  location memory_location() const { return _location; }
+
+  /**
+   * @brief Returns the cached block, or nullptr if it is not in the cache.
+   */
+  std::shared_ptr<block const> find(std::string const& key, size_t block_idx);
+
+  /**
+   * @brief Adds a block to the cache, evicting the least recently used blocks to make room.
+   *
+   * Blocks larger than the capacity are not cached.
+   */
+  void insert(std::string const& key, size_t block_idx, std::shared_ptr<block const> data);
+
+  /**
+   * @brief Returns the total size of the cached blocks, in bytes.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Evicts all blocks.
+   */
+  void clear();
+
+ private:
+  using block_key = std::pair<std::string, size_t>;
+  struct entry {
+    std::shared_ptr<block const> data;
+    std::list<block_key>::iterator lru_pos;
+  };
+
+  size_t const _capacity;
+  size_t const _block_size;
+  location const _location;
+
+  mutable std::mutex _mutex;
+  size_t _size = 0;
+  std::list<block_key> _lru;  ///< Most recently used first
+  std::map<block_key, entry> _entries;
+};
+
+/**
+ * @brief Decorator that serves reads of another datasource through a `datasource_block_cache`.
+ *
+ * Reads are split at block boundaries; cached blocks are served from the cache, and each run of
+ * missing blocks is read from the wrapped source with a single call and added to the cache.
+ * Repeated reads of the same data, by this object or by other objects with the same cache key and
+ * cache, skip the wrapped source entirely.
+ */
+class caching_source : public datasource {
+ public:
+  /**
+   * @brief Wraps a datasource.
+   *
+   * @param source The datasource to read the blocks that are not cached from
+   * @param cache_key Identifies the data of the source in the cache, e.g. the file path; sources
+   * with the same key must have the same contents
+   * @param cache The cache, possibly shared with other `caching_source` objects
+   */
+  caching_source(std::unique_ptr<datasource> source,
+                 std::string cache_key,
+                 std::shared_ptr<datasource_block_cache> cache);
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override;
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override;
+
+  /**
+   * @brief Device reads are supported for both cache locations.
+   */
+  bool supports_device_read() const override { return true; }
+
+  /**
+   * @brief Device reads are preferred when the blocks are cached in device memory.
+   */
+  bool is_device_read_preferred(size_t size) const override
+  {
+    return _cache->memory_location() == datasource_block_cache::location::DEVICE;
+  }
+
+  std::unique_ptr<buffer> device_read(size_t offset,
+                                      size_t size,
+                                      rmm::cuda_stream_view stream) override;
+
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override;
+
+  bool supports_concurrent_reads() const override { return _source->supports_concurrent_reads(); }
+
+  size_t size() const override { return _source->size(); }
+
+ private:
+  /**
+   * @brief Copies the requested range out of the cached blocks, reading the missing blocks first.
+   *
+   * @return The number of bytes read
+   */
+  size_t read(
+    size_t offset, size_t size, uint8_t* dst, bool dst_on_device, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Reads a run of consecutive blocks from the wrapped source.
+   */
+  std::vector<std::shared_ptr<datasource_block_cache::block const>> read_blocks(
+    size_t first_block, size_t num_blocks, rmm::cuda_stream_view stream);
+
+  std::unique_ptr<datasource> _source;
+  std::string const _cache_key;
+  std::shared_ptr<datasource_block_cache> _cache;
+};
+
+/**
+ * @brief Settings for reading from a remote object store with `remote_source`.
+ */
+struct remote_source_options {
+  /// Ranges less than this many bytes apart are fetched with a single request
+  size_t coalesce_gap = 1 << 20;
+  /// Large reads are split into ranged requests of this many bytes, issued in parallel
+  size_t part_size = 8 << 20;
+  /// Small reads fetch at least this many bytes, and later reads within them are served locally
+  size_t prefetch_size = 16 << 20;
+  /// Maximum number of ranged requests in flight for a single read
+  size_t max_requests = 16;
+};
+
+/**
+ * @brief Implementation class for reading from an object in a remote store, such as S3.
+ *
+ * The object is accessed through the Arrow filesystem that matches the URI scheme; each read is
+ * a set of parallel ranged requests. Small reads are extended into a prefetch window, so that the
+ * sequential metadata reads of the readers do not each pay the request latency.
+ */
+class remote_source : public datasource {
+ public:
+  /**
+   * @brief Opens the object at the given URI.
+   *
+   * @throws cudf::logic_error if the URI scheme is not supported or the object cannot be opened
+   *
+   * @param uri URI of the object, e.g. `s3://bucket/key`
+   * @param options Settings for the ranged requests
+   */
+  explicit remote_source(std::string const& uri, remote_source_options const& options = {});
+
+  /**
+   * @brief Reads from an already opened Arrow file, e.g. one opened with custom credentials.
+   *
+   * @throws cudf::logic_error if the file is null or its size cannot be read
+   *
+   * @param file The file to read from
+   * @param options Settings for the ranged requests
+   */
+  explicit remote_source(std::shared_ptr<arrow::io::RandomAccessFile> file,
+                         remote_source_options const& options = {});
+
+  /**
+   * @brief Returns whether the path is the URI of a remote object, i.e. whether it has a scheme
+   * other than `file`.
+   */
+  static bool is_remote_uri(std::string const& path);
+
+  /**
+   * @brief Returns a buffer with a subset of data from the object.
+   */
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override;
+
+  /**
+   * @brief Reads a selected range from the object into a preallocated buffer.
+   */
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override;
+
+  /**
+   * @brief Ranged requests to the remote store are independent.
+   */
+  bool supports_concurrent_reads() const override { return true; }
+
+  /**
+   * @brief Returns the configured `coalesce_gap`; a request costs much more than reading the gap.
+   */
+  size_t read_coalesce_gap() const override { return _options.coalesce_gap; }
+
+  /**
+   * @brief Returns the size of the remote object.
+   */
+  size_t size() const override { return _size; }
+
+ private:
+  /**
+   * @brief Reads a range of the object with up to `max_requests` parallel ranged requests.
+   *
+   * @throws cudf::logic_error if the object ends before the end of the range
+   */
+  size_t fetch(size_t offset, size_t size, uint8_t* dst);
+
+  /**
+   * @brief Returns the prefetch window that covers the given range, fetching a new one if needed.
+   */
+  std::shared_ptr<std::vector<uint8_t>> window_for(size_t offset,
+                                                   size_t size,
+                                                   size_t& window_offset);
+
+  std::shared_ptr<arrow::io::RandomAccessFile> _file;
+  remote_source_options const _options;
+  size_t _size = 0;
+
+  std::mutex _window_mutex;
+  std::shared_ptr<std::vector<uint8_t>> _window;
+  size_t _window_offset = 0;
+};
+
 }  // namespace io
 }  // namespace cudf
@@ -28,10 +28,15 @@ namespace csv {
  * @brief Class to read CSV dataset data into columns.
  */
 class reader {
- private:
+ protected:
   class impl;
   std::unique_ptr<impl> _impl;
 
+  /**
+   * @brief Default constructor, needed for subclassing
+   */
+  reader();
+
  public:
   /**
    * @brief Constructor from an array of file paths
@@ -70,6 +75,47 @@ class reader {
   table_with_metadata read(rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 };
 
+/**
+ * @brief Class to read a CSV dataset into a series of tables, chunk by chunk.
+ */
+class chunked_reader : private reader {
+ public:
+  /**
+   * @brief Constructor from an array of datasources
+   *
+   * @param chunk_size Number of source bytes to read and parse per chunk
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(std::size_t chunk_size,
+                          std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
+                          csv_reader_options const &options,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource *mr);
+
+  /**
+   * @brief Destructor explicitly declared to avoid inlining in header
+   */
+  ~chunked_reader();
+
+  /**
+   * @brief Returns true if there is any data left to read.
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of the dataset.
+   *
+   * @return The set of columns along with table metadata
+   */
+  table_with_metadata read_chunk();
+
+ private:
+  rmm::cuda_stream_view _stream;
+};
+
 class writer {
  public:
   class impl;
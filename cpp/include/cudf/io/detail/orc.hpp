@@ -42,10 +42,15 @@ namespace orc {
  * @brief Class to read ORC dataset data into columns.
  */
 class reader {
- private:
+ protected:
   class impl;
   std::unique_ptr<impl> _impl;
 
+  /**
+   * @brief Default constructor, needed for subclassing
+   */
+  reader();
+
  public:
   /**
    * @brief Constructor from an array of file paths
@@ -86,6 +91,51 @@ class reader {
                            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 };
 
+/**
+ * @brief Class to read an ORC dataset in chunks of bounded size.
+ *
+ * The selected rows are split up front, using the file footer and stripe statistics, into
+ * windows whose estimated decoded size does not exceed `chunk_read_limit`. Each call to
+ * `read_chunk()` reads and decodes a single window.
+ */
+class chunked_reader : private reader {
+ public:
+  /**
+   * @brief Constructor from an array of datasources
+   *
+   * @param chunk_read_limit Limit on the size of each output table, in bytes; 0 for no limit
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(std::size_t chunk_read_limit,
+                          std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                          orc_reader_options const& options,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Destructor explicitly declared to avoid inlining in header
+   */
+  ~chunked_reader();
+
+  /**
+   * @brief Returns true if there is any data left to read.
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of the dataset.
+   *
+   * @return The set of columns along with table metadata
+   */
+  table_with_metadata read_chunk();
+
+ private:
+  rmm::cuda_stream_view _stream;
+};
+
 /**
  * @brief Class to write ORC dataset data into columns.
  */
@@ -33,6 +33,7 @@ namespace cudf {
 namespace io {
 
 // Forward declaration
+class parquet_metadata;
 class parquet_reader_options;
 class parquet_writer_options;
 class chunked_parquet_writer_options;
@@ -44,10 +45,15 @@ namespace parquet {
  * @brief Class to read Parquet dataset data into columns.
  */
 class reader {
- private:
+ protected:
   class impl;
   std::unique_ptr<impl> _impl;
 
+  /**
+   * @brief Default constructor, needed for subclassing
+   */
+  reader();
+
  public:
   /**
    * @brief Constructor from an array of file paths
@@ -88,6 +94,56 @@ class reader {
                            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 };
 
+/**
+ * @brief Class to read a Parquet dataset in chunks of bounded size.
+ *
+ * The selected rows are split up front, using the page headers, into passes that need at most
+ * `pass_read_limit` bytes of compressed and decompressed page data, and the rows of each pass into
+ * chunks whose estimated decoded size does not exceed `chunk_read_limit`. The pages of a pass are
+ * read and decompressed by the call to `read_chunk()` that decodes its first chunk, and are kept
+ * until its last chunk is decoded.
+ */
+class chunked_reader : private reader {
+ public:
+  /**
+   * @brief Constructor from an array of datasources
+   *
+   * @param chunk_read_limit Limit on the size of each output table, in bytes; 0 for no limit
+   * @param pass_read_limit Limit on the temporary memory used to read and decompress page data,
+   * in bytes; 0 for no limit
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(std::size_t chunk_read_limit,
+                          std::size_t pass_read_limit,
+                          std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                          parquet_reader_options const& options,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_reader();
+
+  /**
+   * @brief Returns true if there is any data left to read.
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of the dataset.
+   *
+   * @return The set of columns along with table metadata
+   */
+  table_with_metadata read_chunk();
+
+ private:
+  rmm::cuda_stream_view _stream;
+};
+
 /**
  * @brief Class to write parquet dataset data into columns.
  */
@@ -161,6 +217,23 @@ class writer {
     const std::vector<std::unique_ptr<std::vector<uint8_t>>>& metadata_list);
 };
 
+/**
+ * @brief Parses the footers of a set of sources
+ *
+ * @param sources Input `datasource` objects
+ * @param filepaths Paths of the sources, used as footer cache keys; empty bypasses the cache
+ *
+ * @return The parsed footer of each source
+ */
+std::vector<parquet_metadata> read_metadata(
+  std::vector<std::unique_ptr<cudf::io::datasource>> const& sources,
+  std::vector<std::string> const& filepaths);
+
+/**
+ * @copydoc cudf::io::set_parquet_metadata_cache_size
+ */
+void set_metadata_cache_size(std::size_t max_entries);
+
 };  // namespace parquet
 };  // namespace detail
 };  // namespace io
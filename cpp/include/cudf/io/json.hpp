@@ -23,6 +23,7 @@
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -81,6 +82,9 @@ class json_reader_options {
   // Whether to parse dates as DD/MM versus MM/DD
   bool _dayfirst = false;
 
+  // Read nested objects and arrays as struct and list columns
+  bool _nested = false;
+
   /**
    * @brief Constructor from source info.
    *
@@ -141,6 +145,11 @@ class json_reader_options {
    */
   bool is_enabled_dayfirst() const { return _dayfirst; }
 
+  /**
+   * @brief Whether to read nested objects and arrays as struct and list columns.
+   */
+  bool is_enabled_nested() const { return _nested; }
+
   /**
    * @brief Set data types for columns to be read.
    *
@@ -182,6 +191,16 @@ class json_reader_options {
    * @param val Boolean value to enable/disable day first parsing format.
    */
   void enable_dayfirst(bool val) { _dayfirst = val; }
+
+  /**
+   * @brief Set whether to read nested objects and arrays as struct and list columns.
+   *
+   * Each line must hold a JSON object. The schema is inferred from all records; data types
+   * cannot be specified.
+   *
+   * @param val Boolean value to enable/disable reading nested data.
+   */
+  void enable_nested(bool val) { _nested = val; }
 };
 
 class json_reader_options_builder {
@@ -274,6 +293,18 @@ class json_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Set whether to read nested objects and arrays as struct and list columns.
+   *
+   * @param val Boolean value to enable/disable reading nested data.
+   * @return this for chaining.
+   */
+  json_reader_options_builder& nested(bool val)
+  {
+    options._nested = val;
+    return *this;
+  }
+
   /**
    * @brief move json_reader_options member once it's built.
    */
@@ -309,6 +340,249 @@ table_with_metadata read_json(
   json_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Builds settings to use for `write_json()`.
+ */
+class json_writer_options_builder;
+
+/**
+ * @brief Settings to use for `write_json()`.
+ *
+ * Each row is written as a JSON object keyed by the column names. Struct columns are written as
+ * nested objects and list columns as arrays.
+ */
+class json_writer_options {
+  // Specify the sink to use for writer output
+  sink_info _sink;
+  // Set of columns to output
+  table_view _table;
+  // string to use for null entries
+  std::string _na_rep = "null";
+  // Indicates whether to write the fields of null entries; always true for list elements
+  bool _include_nulls = false;
+  // Indicates whether to write JSON Lines instead of a single array of records
+  bool _lines = false;
+  // maximum number of rows to write in each chunk (limits memory use)
+  size_type _rows_per_chunk = std::numeric_limits<size_type>::max();
+  // Optional associated metadata
+  table_metadata const* _metadata = nullptr;
+
+  /**
+   * @brief Constructor from sink and table.
+   *
+   * @param sink The sink used for writer output.
+   * @param table Table to be written to output.
+   */
+  explicit json_writer_options(sink_info const& sink, table_view const& table)
+    : _sink(sink), _table(table), _rows_per_chunk(table.num_rows())
+  {
+  }
+
+  friend json_writer_options_builder;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  explicit json_writer_options() = default;
+
+  /**
+   * @brief Create builder to create `json_writer_options`.
+   *
+   * @param sink The sink used for writer output.
+   * @param table Table to be written to output.
+   *
+   * @return Builder to build json_writer_options.
+   */
+  static json_writer_options_builder builder(sink_info const& sink, table_view const& table);
+
+  /**
+   * @brief Returns sink used for writer output.
+   */
+  sink_info const& get_sink() const { return _sink; }
+
+  /**
+   * @brief Returns table that would be written to output.
+   */
+  table_view const& get_table() const { return _table; }
+
+  /**
+   * @brief Returns optional associated metadata.
+   */
+  table_metadata const* get_metadata() const { return _metadata; }
+
+  /**
+   * @brief Returns string used for null entries.
+   */
+  std::string get_na_rep() const { return _na_rep; }
+
+  /**
+   * @brief Whether to write the fields of null entries.
+   */
+  bool is_enabled_include_nulls() const { return _include_nulls; }
+
+  /**
+   * @brief Whether to write JSON Lines.
+   */
+  bool is_enabled_lines() const { return _lines; }
+
+  /**
+   * @brief Returns maximum number of rows to process for each file write.
+   */
+  size_type get_rows_per_chunk() const { return _rows_per_chunk; }
+
+  /**
+   * @brief Sets optional associated metadata.
+   *
+   * @param metadata Associated metadata.
+   */
+  void set_metadata(table_metadata const* metadata) { _metadata = metadata; }
+
+  /**
+   * @brief Sets string used for null entries.
+   *
+   * @param val String to represent null value.
+   */
+  void set_na_rep(std::string val) { _na_rep = val; }
+
+  /**
+   * @brief Enables/Disables writing the fields of null entries.
+   *
+   * @param val Boolean value to enable/disable.
+   */
+  void enable_include_nulls(bool val) { _include_nulls = val; }
+
+  /**
+   * @brief Enables/Disables JSON Lines output.
+   *
+   * @param val Boolean value to enable/disable.
+   */
+  void enable_lines(bool val) { _lines = val; }
+
+  /**
+   * @brief Sets maximum number of rows to process for each file write.
+   *
+   * @param val Number of rows per chunk.
+   */
+  void set_rows_per_chunk(size_type val) { _rows_per_chunk = val; }
+};
+
+class json_writer_options_builder {
+  json_writer_options options;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  explicit json_writer_options_builder() = default;
+
+  /**
+   * @brief Constructor from sink and table.
+   *
+   * @param sink The sink used for writer output.
+   * @param table Table to be written to output.
+   */
+  explicit json_writer_options_builder(sink_info const& sink, table_view const& table)
+    : options{sink, table}
+  {
+  }
+
+  /**
+   * @brief Sets optional associated metadata.
+   *
+   * @param metadata Associated metadata.
+   * @return this for chaining.
+   */
+  json_writer_options_builder& metadata(table_metadata const* metadata)
+  {
+    options._metadata = metadata;
+    return *this;
+  }
+
+  /**
+   * @brief Sets string used for null entries.
+   *
+   * @param val String to represent null value.
+   * @return this for chaining.
+   */
+  json_writer_options_builder& na_rep(std::string val)
+  {
+    options._na_rep = val;
+    return *this;
+  }
+
+  /**
+   * @brief Enables/Disables writing the fields of null entries.
+   *
+   * @param val Boolean value to enable/disable.
+   * @return this for chaining.
+   */
+  json_writer_options_builder& include_nulls(bool val)
+  {
+    options._include_nulls = val;
+    return *this;
+  }
+
+  /**
+   * @brief Enables/Disables JSON Lines output.
+   *
+   * @param val Boolean value to enable/disable.
+   * @return this for chaining.
+   */
+  json_writer_options_builder& lines(bool val)
+  {
+    options._lines = val;
+    return *this;
+  }
+
+  /**
+   * @brief Sets maximum number of rows to process for each file write.
+   *
+   * @param val Number of rows per chunk.
+   * @return this for chaining.
+   */
+  json_writer_options_builder& rows_per_chunk(size_type val)
+  {
+    options._rows_per_chunk = val;
+    return *this;
+  }
+
+  /**
+   * @brief move `json_writer_options` member once it's built.
+   */
+  operator json_writer_options &&() { return std::move(options); }
+
+  /**
+   * @brief move `json_writer_options` member once it's built.
+   *
+   * This has been added since Cython does not support overloading of conversion operators.
+   */
+  json_writer_options&& build() { return std::move(options); }
+};
+
+/**
+ * @brief Writes a set of columns to JSON format.
+ *
+ * The following code snippet demonstrates how to write columns to a JSON Lines file:
+ * @code
+ *  std::string filepath = "dataset.json";
+ *  cudf::io::sink_info sink_info(filepath);
+ *
+ *  auto options = cudf::io::json_writer_options::builder(sink_info, table->view()).lines(true);
+ *  ...
+ *  cudf::io::write_json(options);
+ * @endcode
+ *
+ * @param options Settings for controlling writing behavior.
+ * @param mr Device memory resource to use for device memory allocation.
+ */
+void write_json(json_writer_options const& options,
+                rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace io
 }  // namespace cudf
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file memory_resource.hpp
+ * @brief cuDF-IO API for the memory resource of the readers' and writers' temporary buffers
+ */
+
+#pragma once
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+namespace cudf {
+namespace io {
+/**
+ * @addtogroup io_apis
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Sets the memory resource of the large temporary device buffers of the cuIO readers and
+ * writers.
+ *
+ * The temporary buffers are the raw and decompressed column chunks and stripes of the Parquet and
+ * ORC readers, and the encoding, dictionary and compression buffers of their writers. They are
+ * freed before the read or write returns, so a separate resource, e.g. an arena, keeps them from
+ * fragmenting the resource of the long-lived columns. The returned columns are still allocated
+ * from the `mr` passed to the readers.
+ *
+ * The resource is process-wide, and must outlive the reads and writes that use it.
+ *
+ * @param mr The resource for the temporary buffers, or `nullptr` to use the current device
+ * resource at the time of each allocation, which is the default
+ * @return The previous resource, or `nullptr` if none was set
+ */
+rmm::mr::device_memory_resource* set_temporary_memory_resource(
+  rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Returns the memory resource of the temporary device buffers of the cuIO readers and
+ * writers.
+ *
+ * @return The resource set by `set_temporary_memory_resource`, or the current device resource if
+ * none is set
+ */
+rmm::mr::device_memory_resource* get_temporary_memory_resource();
+
+/** @} */  // end of group
+}  // namespace io
+}  // namespace cudf
@@ -20,13 +20,21 @@
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
 
+#include <thrust/optional.h>
+
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 namespace cudf {
+namespace ast {
+class expression;
+}  // namespace ast
+
 namespace io {
 /**
  * @addtogroup io_readers
@@ -63,6 +71,12 @@ class orc_reader_options {
   // Cast timestamp columns to a specific type
   data_type _timestamp_type{type_id::EMPTY};
 
+  // Predicate used to skip stripes based on their column statistics
+  thrust::optional<std::reference_wrapper<ast::expression const>> _filter;
+
+  // Number of CUDA streams used to read stripe data concurrently
+  size_type _num_read_streams = 1;
+
   friend orc_reader_options_builder;
 
   /**
@@ -128,6 +142,19 @@ class orc_reader_options {
    */
   data_type get_timestamp_type() const { return _timestamp_type; }
 
+  /**
+   * @brief Returns the expression used to skip stripes, if any.
+   */
+  thrust::optional<std::reference_wrapper<ast::expression const>> const& get_filter() const
+  {
+    return _filter;
+  }
+
+  /**
+   * @brief Returns the number of CUDA streams used to read stripe data concurrently.
+   */
+  size_type get_num_read_streams() const { return _num_read_streams; }
+
   // Setters
 
   /**
@@ -157,6 +184,7 @@ class orc_reader_options {
   void set_skip_rows(size_type rows)
   {
     CUDF_EXPECTS(rows == 0 or _stripes.empty(), "Can't set both skip_rows along with stripes");
+    CUDF_EXPECTS(rows == 0 or not _filter.has_value(), "Can't set skip_rows along with a filter");
     _skip_rows = rows;
   }
 
@@ -168,6 +196,7 @@ class orc_reader_options {
   void set_num_rows(size_type nrows)
   {
     CUDF_EXPECTS(nrows == -1 or _stripes.empty(), "Can't set both num_rows along with stripes");
+    CUDF_EXPECTS(nrows == -1 or not _filter.has_value(), "Can't set num_rows along with a filter");
     _num_rows = nrows;
   }
 
@@ -191,6 +220,41 @@ class orc_reader_options {
    * @param type Type of timestamp.
    */
   void set_timestamp_type(data_type type) { _timestamp_type = type; }
+
+  /**
+   * @brief Sets the expression used to skip stripes based on column statistics.
+   *
+   * Column references in the expression refer to the columns of the output table, i.e. after
+   * column selection. Before any stripe data is read, each stripe's min/max statistics are tested
+   * against the expression, followed by the statistics of the stripe's row index entries when the
+   * row index is used, and stripes that cannot contain a matching row are skipped. Stripes that
+   * survive may still contain rows that do not satisfy the expression; the filter is not applied
+   * to the returned rows. The expression must outlive the read.
+   *
+   * @param filter AST expression evaluated against stripe and row index statistics.
+   */
+  void set_filter(ast::expression const& filter)
+  {
+    CUDF_EXPECTS(_skip_rows == 0 and _num_rows == -1,
+                 "Can't set a filter along with skip_rows and num_rows");
+    _filter = std::cref(filter);
+  }
+
+  /**
+   * @brief Sets the number of CUDA streams used to read stripe data concurrently.
+   *
+   * With more than one stream, the stripe reads are spread over a pool of host threads, each
+   * copying its data to the device on its own CUDA stream, so that file reads, host-to-device
+   * copies and device reads of different stripes overlap. All reads are joined into the read's
+   * stream before decoding, which still processes every stripe in the same kernel launches.
+   *
+   * @param num_streams Number of streams; 1 reads the stripes sequentially on the read's stream.
+   */
+  void set_num_read_streams(size_type num_streams)
+  {
+    CUDF_EXPECTS(num_streams > 0, "The number of read streams must be positive");
+    _num_read_streams = num_streams;
+  }
 };
 
 class orc_reader_options_builder {
@@ -295,6 +359,30 @@ class orc_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the expression used to skip stripes based on column statistics.
+   *
+   * @param filter AST expression evaluated against stripe and row index statistics.
+   * @return this for chaining.
+   */
+  orc_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the number of CUDA streams used to read stripe data concurrently.
+   *
+   * @param num_streams Number of streams; 1 reads the stripes sequentially on the read's stream.
+   * @return this for chaining.
+   */
+  orc_reader_options_builder& num_read_streams(size_type num_streams)
+  {
+    options.set_num_read_streams(num_streams);
+    return *this;
+  }
+
   /**
    * @brief move orc_reader_options member once it's built.
    */
@@ -331,6 +419,77 @@ table_with_metadata read_orc(
   orc_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked ORC reader class to read an ORC file iteratively into a series of tables,
+ * chunk by chunk.
+ *
+ * The selected stripes are split up front, using the file footer and stripe statistics, into
+ * windows whose estimated decoded size stays within the given limit. Windows contain whole
+ * stripes where possible; a stripe that alone exceeds the limit is split at row group (row index
+ * stride) boundaries.
+ *
+ * The following code snippet demonstrates how to read a file in chunks:
+ * @code
+ *  auto reader = cudf::io::orc_chunked_reader(chunk_read_limit, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    ...
+ *  }
+ * @endcode
+ */
+class orc_chunked_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  orc_chunked_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * Chunk boundaries are estimated from the file metadata, so a chunk may exceed
+   * `chunk_read_limit` when a single row group is larger than the limit.
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   * or `0` if there is no limit
+   * @param options The options used to read the ORC file
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  orc_chunked_reader(
+    std::size_t chunk_read_limit,
+    orc_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   */
+  ~orc_chunked_reader();
+
+  /**
+   * @brief Check if there is any data in the given file has not yet read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Read a chunk of rows in the given ORC file.
+   *
+   * The sequence of returned tables, if concatenated by their order, guarantees to form a complete
+   * dataset as reading the entire given file at once.
+   *
+   * An empty table will be returned if the given file is empty, or all the data in the file has
+   * been read and returned by the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  table_with_metadata read_chunk();
+
+ private:
+  std::unique_ptr<cudf::io::detail::orc::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -357,6 +516,8 @@ class orc_writer_options {
   table_view _table;
   // Optional associated metadata
   const table_metadata* _metadata = nullptr;
+  // Indexes of the columns to write bloom filters for
+  std::vector<size_type> _bloom_filter_columns;
 
   friend orc_writer_options_builder;
 
@@ -414,6 +575,11 @@ class orc_writer_options {
    */
   table_metadata const* get_metadata() const { return _metadata; }
 
+  /**
+   * @brief Returns the indexes of the columns to write bloom filters for.
+   */
+  std::vector<size_type> const& get_bloom_filter_columns() const { return _bloom_filter_columns; }
+
   // Setters
 
   /**
@@ -443,6 +609,19 @@ class orc_writer_options {
    * @param meta Associated metadata.
    */
   void set_metadata(table_metadata* meta) { _metadata = meta; }
+
+  /**
+   * @brief Sets the columns to write bloom filters for.
+   *
+   * A BLOOM_FILTER_UTF8 stream, with one bloom filter per row group, is written for each listed
+   * column. Supported column types are integers, floating-point, strings and TIMESTAMP_DAYS.
+   *
+   * @param columns Indexes of the columns in the written table.
+   */
+  void set_bloom_filter_columns(std::vector<size_type> columns)
+  {
+    _bloom_filter_columns = std::move(columns);
+  }
 };
 
 class orc_writer_options_builder {
@@ -514,6 +693,18 @@ class orc_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the columns to write bloom filters for.
+   *
+   * @param columns Indexes of the columns in the written table.
+   * @return this for chaining.
+   */
+  orc_writer_options_builder& bloom_filter_columns(std::vector<size_type> columns)
+  {
+    options.set_bloom_filter_columns(std::move(columns));
+    return *this;
+  }
+
   /**
    * @brief move orc_writer_options member once it's built.
    */
@@ -563,6 +754,8 @@ class chunked_orc_writer_options {
   bool _enable_statistics = true;
   // Optional associated metadata
   const table_metadata_with_nullability* _metadata = nullptr;
+  // Indexes of the columns to write bloom filters for
+  std::vector<size_type> _bloom_filter_columns;
 
   friend chunked_orc_writer_options_builder;
 
@@ -610,6 +803,11 @@ class chunked_orc_writer_options {
    */
   table_metadata_with_nullability const* get_metadata() const { return _metadata; }
 
+  /**
+   * @brief Returns the indexes of the columns to write bloom filters for.
+   */
+  std::vector<size_type> const& get_bloom_filter_columns() const { return _bloom_filter_columns; }
+
   // Setters
 
   /**
@@ -632,6 +830,19 @@ class chunked_orc_writer_options {
    * @param meta Associated metadata.
    */
   void metadata(table_metadata_with_nullability* meta) { _metadata = meta; }
+
+  /**
+   * @brief Sets the columns to write bloom filters for.
+   *
+   * A BLOOM_FILTER_UTF8 stream, with one bloom filter per row group, is written for each listed
+   * column. Supported column types are integers, floating-point, strings and TIMESTAMP_DAYS.
+   *
+   * @param columns Indexes of the columns in the written table.
+   */
+  void set_bloom_filter_columns(std::vector<size_type> columns)
+  {
+    _bloom_filter_columns = std::move(columns);
+  }
 };
 
 class chunked_orc_writer_options_builder {
@@ -688,6 +899,18 @@ class chunked_orc_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the columns to write bloom filters for.
+   *
+   * @param columns Indexes of the columns in the written table.
+   * @return this for chaining.
+   */
+  chunked_orc_writer_options_builder& bloom_filter_columns(std::vector<size_type> columns)
+  {
+    options.set_bloom_filter_columns(std::move(columns));
+    return *this;
+  }
+
   /**
    * @brief move chunked_orc_writer_options member once it's built.
    */
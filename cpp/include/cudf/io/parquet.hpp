@@ -26,12 +26,17 @@
 
 #include <thrust/optional.h>
 
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <string>
 #include <vector>
 
 namespace cudf {
+namespace ast {
+class expression;
+}  // namespace ast
+
 namespace io {
 /**
  * @addtogroup io_readers
@@ -39,6 +44,50 @@ namespace io {
  * @file
  */
 
+/**
+ * @brief Parsed footer of a Parquet file.
+ *
+ * The footer of a file can be parsed once with `read_parquet_metadata()` and passed to any number
+ * of reads of that file through `parquet_reader_options::set_metadata()`, so that reads with
+ * different column selections do not parse it again. Copies share the parsed footer.
+ */
+class parquet_metadata {
+ public:
+  struct impl;
+
+  /**
+   * @brief Default constructor, holding no footer.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  parquet_metadata() = default;
+
+  /**
+   * @brief Constructor from a parsed footer.
+   *
+   * @param footer Parsed footer.
+   */
+  explicit parquet_metadata(std::shared_ptr<impl const> footer) : _impl(std::move(footer)) {}
+
+  /**
+   * @brief Returns the number of rows of the file.
+   */
+  size_type num_rows() const;
+
+  /**
+   * @brief Returns the number of row groups of the file.
+   */
+  size_type num_row_groups() const;
+
+  /**
+   * @brief Returns the parsed footer.
+   */
+  std::shared_ptr<impl const> const& get_impl() const { return _impl; }
+
+ private:
+  std::shared_ptr<impl const> _impl;
+};
+
 /**
  * @brief Builds parquet_reader_options to use for `read_parquet()`.
  */
@@ -62,6 +111,8 @@ class parquet_reader_options {
 
   // Whether to store string data as categorical type
   bool _convert_strings_to_categories = false;
+  // Whether to return string columns as dictionary columns
+  bool _convert_strings_to_dictionary = false;
   // Whether to use PANDAS metadata to load columns
   bool _use_pandas_metadata = true;
   // Cast timestamp columns to a specific type
@@ -71,6 +122,15 @@ class parquet_reader_options {
   // doubles for storage of types unsupported by cudf
   bool _strict_decimal_types = false;
 
+  // Predicate used to skip row groups based on their column chunk statistics
+  thrust::optional<std::reference_wrapper<ast::expression const>> _filter;
+
+  // Limit on the page data of each batch of a pipelined read; 0 reads everything in one pass
+  std::size_t _pipeline_read_limit = 0;
+
+  // Footers parsed ahead of the read, one per source; empty parses them from the sources
+  std::vector<parquet_metadata> _metadata;
+
   /**
    * @brief Constructor from source info.
    *
@@ -107,6 +167,12 @@ class parquet_reader_options {
    */
   bool is_enabled_convert_strings_to_categories() const { return _convert_strings_to_categories; }
 
+  /**
+   * @brief Returns true/false depending on whether string columns should be returned as
+   * dictionary columns or not.
+   */
+  bool is_enabled_convert_strings_to_dictionary() const { return _convert_strings_to_dictionary; }
+
   /**
    * @brief Returns true/false depending whether to use pandas metadata or not while reading.
    */
@@ -143,6 +209,24 @@ class parquet_reader_options {
    */
   bool is_enabled_strict_decimal_types() const { return _strict_decimal_types; }
 
+  /**
+   * @brief Returns the expression used to skip row groups, if any.
+   */
+  thrust::optional<std::reference_wrapper<ast::expression const>> const& get_filter() const
+  {
+    return _filter;
+  }
+
+  /**
+   * @brief Returns the limit on the page data read by each batch of a pipelined read.
+   */
+  std::size_t get_pipeline_read_limit() const { return _pipeline_read_limit; }
+
+  /**
+   * @brief Returns the footers parsed ahead of the read, if any.
+   */
+  std::vector<parquet_metadata> const& get_metadata() const { return _metadata; }
+
   /**
    * @brief Sets names of the columns to be read.
    *
@@ -171,6 +255,18 @@ class parquet_reader_options {
    */
   void enable_convert_strings_to_categories(bool val) { _convert_strings_to_categories = val; }
 
+  /**
+   * @brief Sets to enable/disable returning string columns as dictionary columns.
+   *
+   * Top-level string columns are returned as DICTIONARY32 columns with UINT32 indices. When
+   * every data page of the column is dictionary encoded, the keys are built from the dictionary
+   * pages of the column chunks and the rows are never expanded to a strings column. Other string
+   * columns are decoded and then dictionary encoded. Conversion to categories takes precedence.
+   *
+   * @param val Boolean value to enable/disable returning string columns as dictionary columns.
+   */
+  void enable_convert_strings_to_dictionary(bool val) { _convert_strings_to_dictionary = val; }
+
   /**
    * @brief Sets to enable/disable use of pandas metadata to read.
    *
@@ -188,6 +284,9 @@ class parquet_reader_options {
     if ((val != 0) and (!_row_groups.empty())) {
       CUDF_FAIL("skip_rows can't be set along with a non-empty row_groups");
     }
+    if ((val != 0) and _filter.has_value()) {
+      CUDF_FAIL("skip_rows can't be set along with a filter");
+    }
 
     _skip_rows = val;
   }
@@ -202,6 +301,9 @@ class parquet_reader_options {
     if ((val != -1) and (!_row_groups.empty())) {
       CUDF_FAIL("num_rows can't be set along with a non-empty row_groups");
     }
+    if ((val != -1) and _filter.has_value()) {
+      CUDF_FAIL("num_rows can't be set along with a filter");
+    }
 
     _num_rows = val;
   }
@@ -220,6 +322,46 @@ class parquet_reader_options {
    * cudf will convert unsupported types to double.
    */
   void set_strict_decimal_types(bool val) { _strict_decimal_types = val; }
+
+  /**
+   * @brief Sets the expression used to skip row groups based on column chunk statistics.
+   *
+   * Column references in the expression refer to the columns of the output table, i.e. after
+   * column selection. Before any column data is read, each row group's min/max statistics are
+   * tested against the expression and row groups that cannot contain a matching row are skipped.
+   * Row groups that survive may still contain rows that do not satisfy the expression; the filter
+   * is not applied to the returned rows. The expression must outlive the read.
+   *
+   * @param filter AST expression evaluated against row group statistics.
+   */
+  void set_filter(ast::expression const& filter)
+  {
+    if ((_skip_rows != 0) or (_num_rows != -1)) {
+      CUDF_FAIL("filter can't be set along with skip_rows and num_rows");
+    }
+
+    _filter = std::cref(filter);
+  }
+
+  /**
+   * @brief Sets the limit on the page data read by each batch of a pipelined read.
+   *
+   * When nonzero, the selected rows are read in batches that need at most this many bytes of
+   * compressed and decompressed page data, splitting row groups at page boundaries. The column
+   * chunks of the next batch are read from the sources in the background while the current batch
+   * is decompressed and decoded, and the decoded batches are concatenated. The sources must
+   * support concurrent reads. Zero reads all row groups in a single pass.
+   *
+   * @param limit Limit on the page data of each batch, in bytes.
+   */
+  void set_pipeline_read_limit(std::size_t limit) { _pipeline_read_limit = limit; }
+
+  /**
+   * @brief Sets the footers of the sources, parsed ahead of the read.
+   *
+   * @param metadata Footers returned by `read_parquet_metadata()`, one per source.
+   */
+  void set_metadata(std::vector<parquet_metadata> metadata) { _metadata = std::move(metadata); }
 };
 
 class parquet_reader_options_builder {
@@ -276,6 +418,18 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets enable/disable returning string columns as dictionary columns.
+   *
+   * @param val Boolean value to enable/disable returning string columns as dictionary columns.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& convert_strings_to_dictionary(bool val)
+  {
+    options._convert_strings_to_dictionary = val;
+    return *this;
+  }
+
   /**
    * @brief Sets to enable/disable use of pandas metadata to read.
    *
@@ -336,6 +490,42 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the expression used to skip row groups based on column chunk statistics.
+   *
+   * @param filter AST expression evaluated against row group statistics.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the limit on the page data read by each batch of a pipelined read.
+   *
+   * @param limit Limit on the page data of each batch, in bytes; 0 disables pipelining.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& pipeline_read_limit(std::size_t limit)
+  {
+    options._pipeline_read_limit = limit;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the footers of the sources, parsed ahead of the read.
+   *
+   * @param metadata Footers returned by `read_parquet_metadata()`, one per source.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& metadata(std::vector<parquet_metadata> metadata)
+  {
+    options._metadata = std::move(metadata);
+    return *this;
+  }
+
   /**
    * @brief move parquet_reader_options member once it's built.
    */
@@ -372,6 +562,122 @@ table_with_metadata read_parquet(
   parquet_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Parses the footers of a Parquet dataset.
+ *
+ * The returned footers can be passed to reads of the same sources with
+ * `parquet_reader_options::set_metadata()`.
+ *
+ * @param src_info Dataset source
+ *
+ * @return The parsed footer of each source
+ */
+std::vector<parquet_metadata> read_parquet_metadata(source_info const& src_info);
+
+/**
+ * @brief Sets the number of footers kept by the process-wide Parquet footer cache.
+ *
+ * When the capacity is nonzero, the footers of file path sources are cached by path, size and
+ * modification time, so repeated reads of an unchanged file do not parse its footer again. The
+ * least recently used footers are evicted first. The cache is disabled by default.
+ *
+ * @param max_entries Maximum number of cached footers; 0 disables and clears the cache
+ */
+void set_parquet_metadata_cache_size(std::size_t max_entries);
+
+/**
+ * @brief The chunked parquet reader class to read Parquet file iteratively in to a series of
+ * tables, chunk by chunk.
+ *
+ * This class is designed to address the reading issue when reading very large Parquet files such
+ * that the sizes of their columns exceed the limit that can be stored in cudf column. By reading
+ * the file content by chunks using this class, each chunk is guaranteed to have its size stay
+ * within the given limit.
+ *
+ * The following code snippet demonstrates how to read a file in chunks:
+ * @code
+ *  auto reader = cudf::io::parquet_chunked_reader(chunk_read_limit, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    ...
+ *  }
+ * @endcode
+ */
+class parquet_chunked_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  parquet_chunked_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * Chunk boundaries are estimated from the file footers, so a chunk may exceed
+   * `chunk_read_limit` when a single row is larger than the limit.
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   * or `0` if there is no limit
+   * @param options The options used to read Parquet file
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  parquet_chunked_reader(
+    std::size_t chunk_read_limit,
+    parquet_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Constructor for chunked reader with a limit on temporary memory.
+   *
+   * In addition to the output limit, the compressed and decompressed page data held at a time is
+   * kept within `pass_read_limit`: the rows are read in passes, split at page boundaries within
+   * row groups, and the chunks of a pass are decoded from the same decompressed pages. The pages
+   * overlapping a row, along with the dictionaries and the nested column chunks of its row group,
+   * are always read together, even if they exceed the limit.
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   * or `0` if there is no limit
+   * @param pass_read_limit Limit on the amount of memory used for reading and decompressing data,
+   * or `0` if there is no limit
+   * @param options The options used to read Parquet file
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  parquet_chunked_reader(
+    std::size_t chunk_read_limit,
+    std::size_t pass_read_limit,
+    parquet_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   */
+  ~parquet_chunked_reader();
+
+  /**
+   * @brief Check if there is any data in the given file has not yet read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Read a chunk of rows in the given Parquet file.
+   *
+   * The sequence of returned tables, if concatenated by their order, guarantees to form a complete
+   * dataset as reading the entire given file at once.
+   *
+   * An empty table will be returned if the given file is empty, or all the data in the file has
+   * been read and returned by the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  table_with_metadata read_chunk();
+
+ private:
+  std::unique_ptr<cudf::io::detail::parquet::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -380,6 +686,17 @@ table_with_metadata read_parquet(
  */
 class table_input_metadata;
 
+/**
+ * @brief Encodings that can be requested for the data pages of a column
+ */
+enum class column_encoding {
+  AUTO,                 ///< Dictionary encoding if it makes the data smaller, PLAIN otherwise
+  DICTIONARY,           ///< Dictionary encoding for as many values as the dictionary can hold
+  PLAIN,                ///< PLAIN encoding
+  DELTA_BINARY_PACKED,  ///< DELTA_BINARY_PACKED encoding. Only valid for 32 and 64-bit integers
+  BYTE_STREAM_SPLIT,    ///< BYTE_STREAM_SPLIT encoding. Only valid for float32 and float64
+};
+
 class column_in_metadata {
   friend table_input_metadata;
   std::string _name = "";
@@ -389,6 +706,8 @@ class column_in_metadata {
   bool _use_int96_timestamp = false;
   // bool _output_as_binary = false;
   thrust::optional<uint8_t> _decimal_precision;
+  column_encoding _encoding = column_encoding::AUTO;
+  bool _bloom_filter         = false;
   std::vector<column_in_metadata> children;
 
  public:
@@ -456,6 +775,31 @@ class column_in_metadata {
     return *this;
   }
 
+  /**
+   * @brief Set the encoding of the data pages of this column. Only valid for leaf columns
+   *
+   * @param encoding The encoding to use for this column
+   * @return this for chaining
+   */
+  column_in_metadata& set_encoding(column_encoding encoding)
+  {
+    _encoding = encoding;
+    return *this;
+  }
+
+  /**
+   * @brief Set whether to write a bloom filter for each column chunk of this column. Only valid
+   * for non-nested leaf columns
+   *
+   * @param enabled Boolean value to enable/disable the bloom filter
+   * @return this for chaining
+   */
+  column_in_metadata& enable_bloom_filter(bool enabled)
+  {
+    _bloom_filter = enabled;
+    return *this;
+  }
+
   /**
    * @brief Get reference to a child of this column
    *
@@ -511,6 +855,16 @@ class column_in_metadata {
    */
   uint8_t get_decimal_precision() const { return _decimal_precision.value(); }
 
+  /**
+   * @brief Get the encoding that was set for this column
+   */
+  column_encoding get_encoding() const { return _encoding; }
+
+  /**
+   * @brief Get whether a bloom filter is written for this column
+   */
+  bool is_enabled_bloom_filter() const { return _bloom_filter; }
+
   /**
    * @brief Get the number of children of this column
    */
@@ -559,6 +913,12 @@ class parquet_writer_options {
   bool _write_timestamps_as_int96 = false;
   // Column chunks file path to be set in the raw output metadata
   std::string _column_chunks_file_path;
+  // False positive probability of the bloom filters of the columns that request one
+  double _bloom_filter_fpp = 0.01;
+  // Dictionary size in bytes above which a column chunk falls back to plain encoding
+  size_t _max_dictionary_size = 512 * 1024;
+  // Target size in bytes of the uncompressed data pages
+  size_t _max_page_size_bytes = 512 * 1024;
 
   /**
    * @brief Constructor from sink and table.
@@ -633,6 +993,21 @@ class parquet_writer_options {
    */
   std::string get_column_chunks_file_path() const { return _column_chunks_file_path; }
 
+  /**
+   * @brief Returns the false positive probability of the bloom filters.
+   */
+  double get_bloom_filter_fpp() const { return _bloom_filter_fpp; }
+
+  /**
+   * @brief Returns the maximum dictionary size in bytes of a column chunk.
+   */
+  size_t get_max_dictionary_size() const { return _max_dictionary_size; }
+
+  /**
+   * @brief Returns the target size in bytes of the uncompressed data pages.
+   */
+  size_t get_max_page_size_bytes() const { return _max_page_size_bytes; }
+
   /**
    * @brief Sets metadata.
    *
@@ -671,6 +1046,36 @@ class parquet_writer_options {
   {
     _column_chunks_file_path.assign(file_path);
   }
+
+  /**
+   * @brief Sets the false positive probability of the bloom filters.
+   *
+   * @param fpp False positive probability, between 0 and 1 exclusive.
+   */
+  void set_bloom_filter_fpp(double fpp) { _bloom_filter_fpp = fpp; }
+
+  /**
+   * @brief Sets the maximum dictionary size in bytes of a column chunk.
+   *
+   * Column chunks whose dictionary is estimated to exceed this size are written with plain
+   * encoding, unless dictionary encoding was explicitly requested for the column. Zero disables
+   * dictionary encoding of such columns.
+   *
+   * @param size Maximum dictionary size in bytes.
+   */
+  void set_max_dictionary_size(size_t size) { _max_dictionary_size = size; }
+
+  /**
+   * @brief Sets the target size in bytes of the uncompressed data pages.
+   *
+   * The pages of a column chunk are cut at page fragment boundaries before they exceed this size,
+   * so a page holds at least one fragment. A page that already holds a third or a half of the
+   * values of its chunk is cut at three quarters or half of this size. Larger pages mean fewer,
+   * larger units for the batched encode and compress kernels.
+   *
+   * @param size Target page size in bytes.
+   */
+  void set_max_page_size_bytes(size_t size) { _max_page_size_bytes = size; }
 };
 
 class parquet_writer_options_builder {
@@ -755,6 +1160,42 @@ class parquet_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the false positive probability of the bloom filters in parquet_writer_options.
+   *
+   * @param fpp False positive probability, between 0 and 1 exclusive.
+   * @return this for chaining.
+   */
+  parquet_writer_options_builder& bloom_filter_fpp(double fpp)
+  {
+    options._bloom_filter_fpp = fpp;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the maximum dictionary size of a column chunk in parquet_writer_options.
+   *
+   * @param size Maximum dictionary size in bytes.
+   * @return this for chaining.
+   */
+  parquet_writer_options_builder& max_dictionary_size(size_t size)
+  {
+    options._max_dictionary_size = size;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the target size of the uncompressed data pages in parquet_writer_options.
+   *
+   * @param size Target page size in bytes.
+   * @return this for chaining.
+   */
+  parquet_writer_options_builder& max_page_size_bytes(size_t size)
+  {
+    options._max_page_size_bytes = size;
+    return *this;
+  }
+
   /**
    * @brief move parquet_writer_options member once it's built.
    */
@@ -807,6 +1248,12 @@ std::unique_ptr<std::vector<uint8_t>> merge_rowgroup_metadata(
  */
 class chunked_parquet_writer_options_builder;
 
+/**
+ * @brief Creates the sink of a file of a partitioned dataset from the path of the file relative to
+ * the root of the dataset, e.g. `year=2026/month=10/part-0.parquet`.
+ */
+using partition_sink_factory = std::function<std::unique_ptr<data_sink>(std::string const&)>;
+
 /**
  * @brief Settings for `write_parquet_chunked()`.
  */
@@ -822,6 +1269,16 @@ class chunked_parquet_writer_options {
   // Parquet writer can write INT96 or TIMESTAMP_MICROS. Defaults to TIMESTAMP_MICROS.
   // If true then overrides any per-column setting in _metadata.
   bool _write_timestamps_as_int96 = false;
+  // False positive probability of the bloom filters of the columns that request one
+  double _bloom_filter_fpp = 0.01;
+  // Dictionary size in bytes above which a column chunk falls back to plain encoding
+  size_t _max_dictionary_size = 512 * 1024;
+  // Target size in bytes of the uncompressed data pages
+  size_t _max_page_size_bytes = 512 * 1024;
+  // Indices of the columns that partition the output, empty if it is a single file
+  std::vector<size_type> _partition_columns;
+  // Creates the sinks of the files of the partitions
+  partition_sink_factory _partition_sinks;
 
   /**
    * @brief Constructor from sink.
@@ -894,6 +1351,90 @@ class chunked_parquet_writer_options {
    */
   void enable_int96_timestamps(bool req) { _write_timestamps_as_int96 = req; }
 
+  /**
+   * @brief Returns the false positive probability of the bloom filters.
+   */
+  double get_bloom_filter_fpp() const { return _bloom_filter_fpp; }
+
+  /**
+   * @brief Returns the maximum dictionary size in bytes of a column chunk.
+   */
+  size_t get_max_dictionary_size() const { return _max_dictionary_size; }
+
+  /**
+   * @brief Returns the target size in bytes of the uncompressed data pages.
+   */
+  size_t get_max_page_size_bytes() const { return _max_page_size_bytes; }
+
+  /**
+   * @brief Sets the false positive probability of the bloom filters.
+   *
+   * @param fpp False positive probability, between 0 and 1 exclusive.
+   */
+  void set_bloom_filter_fpp(double fpp) { _bloom_filter_fpp = fpp; }
+
+  /**
+   * @brief Sets the maximum dictionary size in bytes of a column chunk.
+   *
+   * Column chunks whose dictionary is estimated to exceed this size are written with plain
+   * encoding, unless dictionary encoding was explicitly requested for the column. Zero disables
+   * dictionary encoding of such columns.
+   *
+   * @param size Maximum dictionary size in bytes.
+   */
+  void set_max_dictionary_size(size_t size) { _max_dictionary_size = size; }
+
+  /**
+   * @brief Sets the target size in bytes of the uncompressed data pages.
+   *
+   * The pages of a column chunk are cut at page fragment boundaries before they exceed this size,
+   * so a page holds at least one fragment. A page that already holds a third or a half of the
+   * values of its chunk is cut at three quarters or half of this size. Larger pages mean fewer,
+   * larger units for the batched encode and compress kernels.
+   *
+   * @param size Target page size in bytes.
+   */
+  void set_max_page_size_bytes(size_t size) { _max_page_size_bytes = size; }
+
+  /**
+   * @brief Returns the indices of the columns that partition the output.
+   */
+  std::vector<size_type> const& get_partition_columns() const { return _partition_columns; }
+
+  /**
+   * @brief Returns the factory of the sinks of the partition files.
+   */
+  partition_sink_factory const& get_partition_sinks() const { return _partition_sinks; }
+
+  /**
+   * @brief Sets the columns that partition the output into a Hive-style dataset.
+   *
+   * Each call to `write` sorts the rows of the table by the partition columns once on the device,
+   * and the row groups of all the partitions are encoded and compressed together. The rows of each
+   * partition are written, without the partition columns, to the file
+   * `<name>=<value>/.../part-0.parquet` of the partition, relative to the root of the dataset. The
+   * file stays open across calls to `write` and is completed by `close`.
+   *
+   * The names of the partition columns are taken from the metadata, which describes all the
+   * columns of the written tables, and default to `_col<index>`. Null partition values are written
+   * as `__HIVE_DEFAULT_PARTITION__`. Partition columns must be of integral, boolean or string type.
+   *
+   * @param columns Indices of the partition columns, from the outermost directory level.
+   */
+  void set_partition_columns(std::vector<size_type> columns)
+  {
+    _partition_columns = std::move(columns);
+  }
+
+  /**
+   * @brief Sets the factory of the sinks of the partition files.
+   *
+   * Without a factory, the sink must be a file path, used as the root directory of the dataset.
+   *
+   * @param sinks Creates the sink of a partition file from its path relative to the root.
+   */
+  void set_partition_sinks(partition_sink_factory sinks) { _partition_sinks = std::move(sinks); }
+
   /**
    * @brief creates builder to build chunked_parquet_writer_options.
    *
@@ -973,6 +1514,67 @@ class chunked_parquet_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the false positive probability of the bloom filters in
+   * chunked_parquet_writer_options.
+   *
+   * @param fpp False positive probability, between 0 and 1 exclusive.
+   * @return this for chaining.
+   */
+  chunked_parquet_writer_options_builder& bloom_filter_fpp(double fpp)
+  {
+    options._bloom_filter_fpp = fpp;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the maximum dictionary size of a column chunk in chunked_parquet_writer_options.
+   *
+   * @param size Maximum dictionary size in bytes.
+   * @return this for chaining.
+   */
+  chunked_parquet_writer_options_builder& max_dictionary_size(size_t size)
+  {
+    options._max_dictionary_size = size;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the target size of the uncompressed data pages in chunked_parquet_writer_options.
+   *
+   * @param size Target page size in bytes.
+   * @return this for chaining.
+   */
+  chunked_parquet_writer_options_builder& max_page_size_bytes(size_t size)
+  {
+    options._max_page_size_bytes = size;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the columns that partition the output in chunked_parquet_writer_options.
+   *
+   * @param columns Indices of the partition columns, from the outermost directory level.
+   * @return this for chaining.
+   */
+  chunked_parquet_writer_options_builder& partition_columns(std::vector<size_type> columns)
+  {
+    options._partition_columns = std::move(columns);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the factory of the sinks of the partition files in chunked_parquet_writer_options.
+   *
+   * @param sinks Creates the sink of a partition file from its path relative to the root.
+   * @return this for chaining.
+   */
+  chunked_parquet_writer_options_builder& partition_sinks(partition_sink_factory sinks)
+  {
+    options._partition_sinks = std::move(sinks);
+    return *this;
+  }
+
   /**
    * @brief move chunked_parquet_writer_options member once it's built.
    */
@@ -1031,6 +1633,9 @@ class parquet_chunked_writer {
   /**
    * @brief Constructor with chunked writer options
    *
+   * If partition columns are set without a sink factory, the sink must be the file path of the
+   * root directory of the dataset; the partition directories are created under it as needed.
+   *
    * @param[in] op options used to write table
    * @param[in] mr Device memory resource to use for device memory allocation
    */
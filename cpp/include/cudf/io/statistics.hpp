@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file statistics.hpp
+ * @brief cuDF-IO API for the statistics computed by the writers
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace io {
+/**
+ * @addtogroup io_writers
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Statistics of the chunks of a column, with one row per chunk in each member column.
+ */
+struct chunk_statistics {
+  std::unique_ptr<column> null_counts;  ///< INT32 number of nulls of each chunk
+  std::unique_ptr<column> min_values;   ///< Minimum of each chunk, of the type of the column
+  std::unique_ptr<column> max_values;   ///< Maximum of each chunk, of the type of the column
+  std::unique_ptr<column> sums;         ///< Sum of each chunk, see `compute_column_statistics`
+};
+
+/**
+ * @brief Computes the statistics that the ORC and Parquet writers store, for each chunk of
+ * `chunk_rows` rows of each column of `table`.
+ *
+ * The minimum and maximum of a chunk are null if the chunk has no valid value. Floating-point
+ * NaNs are ignored by the sums.
+ *
+ * The sums are:
+ * - INT64 sums of the bool, 8 to 32 bit integer, and day duration columns
+ * - DECIMAL64 sums of the DECIMAL32 columns, with their scale
+ * - FLOAT64 sums of the floating-point columns
+ * - INT64 sums of the string lengths, in bytes, of the string columns
+ *
+ * They are null for the other columns, like the writers that do not check 64-bit sums for
+ * overflow.
+ *
+ * @throw cudf::logic_error if `chunk_rows` is not positive
+ * @throw cudf::logic_error if a column is unsigned, dictionary or nested
+ *
+ * @param table Table to compute the statistics of
+ * @param chunk_rows Number of rows of each chunk, except the last one
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return The statistics of each column of `table`
+ */
+std::vector<chunk_statistics> compute_column_statistics(
+  table_view const& table,
+  size_type chunk_rows,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace io
+}  // namespace cudf
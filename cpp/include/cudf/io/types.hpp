@@ -58,7 +58,9 @@ enum class compression_type {
   BZIP2,   ///< BZIP2 format, using Burrows-Wheeler transform
   BROTLI,  ///< BROTLI format, using LZ77 + Huffman + 2nd order context modeling
   ZIP,     ///< ZIP format, using DEFLATE algorithm
-  XZ       ///< XZ format, using LZMA(2) algorithm
+  XZ,      ///< XZ format, using LZMA(2) algorithm
+  ZLIB,    ///< ZLIB format, using DEFLATE algorithm
+  ZSTD     ///< ZSTD format, using LZ77 + Huffman + FSE entropy coding
 };
 
 /**
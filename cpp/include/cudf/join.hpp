@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,9 +22,15 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <optional>
+#include <tuple>
 #include <vector>
 
 namespace cudf {
+namespace ast {
+class expression;
+}  // namespace ast
+
 /**
  * @addtogroup column_join
  * @{
@@ -490,6 +496,79 @@ std::unique_ptr<cudf::table> cross_join(
   cudf::table_view const& right,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief A bloom filter over the rows of a table of join keys.
+ *
+ * The filter answers whether a probe row may have an equal row in the key table. It has no false
+ * negatives, so the rows for which `contains()` is false can be dropped before a join without
+ * changing the result of an inner or left semi join with the key table. This allows filtering a
+ * large probe table, e.g. the fact table of a star schema query, with the filter built from a
+ * small, selective build table before its other columns are gathered or decoded.
+ *
+ * The filter is split into 32-bit words. Every key sets a few bits of a single word, so that
+ * inserting or looking up a key touches one word of device memory.
+ */
+class join_bloom_filter {
+ public:
+  join_bloom_filter() = delete;
+  ~join_bloom_filter();
+  join_bloom_filter(join_bloom_filter const&) = delete;
+  join_bloom_filter(join_bloom_filter&&);
+  join_bloom_filter& operator=(join_bloom_filter const&) = delete;
+  join_bloom_filter& operator=(join_bloom_filter&&);
+
+  /**
+   * @brief Builds a bloom filter over the rows of `keys`.
+   *
+   * @throw cudf::logic_error if `keys` has no columns.
+   * @throw cudf::logic_error if `bits_per_key` is not positive.
+   *
+   * @param keys The table of join keys
+   * @param compare_nulls Controls whether null join-key values should match or not. If UNEQUAL,
+   * rows with nulls are not inserted and never contained.
+   * @param bits_per_key The number of filter bits per row of `keys`. More bits lower the false
+   * positive rate.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the filter's device memory
+   */
+  join_bloom_filter(
+    cudf::table_view const& keys,
+    null_equality compare_nulls         = null_equality::EQUAL,
+    int bits_per_key                    = 10,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns a boolean column that is false for the rows of `probe` that have no equal
+   * row in the key table, and true for the rows that may have one.
+   *
+   * The result can be passed to `cudf::apply_boolean_mask` to drop the rows without a match.
+   *
+   * @throw cudf::logic_error if the columns of `probe` do not match those of the key table.
+   *
+   * @param probe The probe table
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   *
+   * @return A BOOL8 column with one row per row of `probe` and no nulls
+   */
+  std::unique_ptr<cudf::column> contains(
+    cudf::table_view const& probe,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the size of the filter in bytes.
+   */
+  std::size_t size_bytes() const;
+
+ private:
+  std::vector<data_type> _key_types;
+  null_equality _compare_nulls;
+  int _num_hashes;
+  rmm::device_uvector<bitmask_type> _words;
+};
+
 /**
  * @brief Hash join that builds hash table in creation and probes results in subsequent `*_join`
  * member functions.
@@ -526,6 +605,9 @@ class hash_join {
    *
    * @param probe The probe table, from which the tuples are probed.
    * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param output_size Optional value which allows users to specify the exact output size,
+   * e.g. as returned by `inner_join_size()`. If not given, the output size is estimated, which may
+   * require probing the hash table again with a larger output.
    * @param mr Device memory resource used to allocate the returned table and columns' device
    * memory.
    * @param stream CUDA stream used for device memory operations and kernel launches
@@ -537,9 +619,10 @@ class hash_join {
   std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
             std::unique_ptr<rmm::device_uvector<size_type>>>
   inner_join(cudf::table_view const& probe,
-             null_equality compare_nulls         = null_equality::EQUAL,
-             rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
-             rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+             null_equality compare_nulls            = null_equality::EQUAL,
+             std::optional<std::size_t> output_size = {},
+             rmm::cuda_stream_view stream           = rmm::cuda_stream_default,
+             rmm::mr::device_memory_resource* mr    = rmm::mr::get_current_device_resource()) const;
 
   /**
    * Returns the row indices that can be used to construct the result of performing
@@ -547,6 +630,9 @@ class hash_join {
    *
    * @param probe The probe table, from which the tuples are probed.
    * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param output_size Optional value which allows users to specify the exact output size,
+   * e.g. as returned by `left_join_size()`. If not given, the output size is estimated, which may
+   * require probing the hash table again with a larger output.
    * @param mr Device memory resource used to allocate the returned table and columns' device
    * memory.
    * @param stream CUDA stream used for device memory operations and kernel launches
@@ -558,9 +644,10 @@ class hash_join {
   std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
             std::unique_ptr<rmm::device_uvector<size_type>>>
   left_join(cudf::table_view const& probe,
-            null_equality compare_nulls         = null_equality::EQUAL,
-            rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
-            rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+            null_equality compare_nulls            = null_equality::EQUAL,
+            std::optional<std::size_t> output_size = {},
+            rmm::cuda_stream_view stream           = rmm::cuda_stream_default,
+            rmm::mr::device_memory_resource* mr    = rmm::mr::get_current_device_resource()) const;
 
   /**
    * Returns the row indices that can be used to construct the result of performing
@@ -583,10 +670,712 @@ class hash_join {
             rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
             rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
 
+  /**
+   * Returns the exact number of matches (rows) when performing an inner join with the specified
+   * probe table.
+   *
+   * The hash table is probed without writing any output, so the size can be used to plan the
+   * memory of a query before `inner_join()` is called with it as `output_size`.
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The exact number of output rows of performing an inner join between two tables with
+   * `build` and `probe` as the the join keys .
+   */
+  std::size_t inner_join_size(cudf::table_view const& probe,
+                              null_equality compare_nulls  = null_equality::EQUAL,
+                              rmm::cuda_stream_view stream = rmm::cuda_stream_default) const;
+
+  /**
+   * Returns the exact number of matches (rows) when performing a left join with the specified
+   * probe table.
+   *
+   * @see inner_join_size().
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The exact number of output rows of performing a left join between two tables with
+   * `build` and `probe` as the the join keys .
+   */
+  std::size_t left_join_size(cudf::table_view const& probe,
+                             null_equality compare_nulls  = null_equality::EQUAL,
+                             rmm::cuda_stream_view stream = rmm::cuda_stream_default) const;
+
+  /**
+   * Returns the row indices of the next chunk of the result of performing an inner join between
+   * two tables, and the probe row at which the following chunk starts. @see inner_join().
+   *
+   * A chunk holds the output rows of consecutive probe rows starting at `probe_row_begin`. It
+   * holds as many probe rows as fit in `max_output_rows` output rows, but at most
+   * `max_output_rows` probe rows and at least one, even if that row alone has more output rows.
+   * Calling this with the returned cursor until it is `probe.num_rows()` produces the whole
+   * result, so joins with a large output can be consumed incrementally.
+   *
+   * @throw cudf::logic_error if `probe_row_begin` is not in `[0, probe.num_rows()]`.
+   * @throw cudf::logic_error if `max_output_rows` is zero.
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param probe_row_begin The first probe row of the chunk.
+   * @param max_output_rows The maximum number of output rows of the chunk.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param mr Device memory resource used to allocate the returned table and columns' device
+   * memory.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return A tuple of [`left_indices`, `right_indices`, `next_probe_row`] where the indices are
+   * the chunk's rows of the result and `next_probe_row` is the first probe row of the next chunk.
+   */
+  std::tuple<std::unique_ptr<rmm::device_uvector<size_type>>,
+             std::unique_ptr<rmm::device_uvector<size_type>>,
+             size_type>
+  inner_join_chunk(
+    cudf::table_view const& probe,
+    size_type probe_row_begin,
+    std::size_t max_output_rows,
+    null_equality compare_nulls         = null_equality::EQUAL,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * Returns the row indices of the next chunk of the result of performing a left join between
+   * two tables, and the probe row at which the following chunk starts. @see left_join().
+   *
+   * A chunk holds the output rows of consecutive probe rows starting at `probe_row_begin`. It
+   * holds as many probe rows as fit in `max_output_rows` output rows, but at most
+   * `max_output_rows` probe rows and at least one, even if that row alone has more output rows.
+   * Calling this with the returned cursor until it is `probe.num_rows()` produces the whole
+   * result, so joins with a large output can be consumed incrementally.
+   *
+   * @throw cudf::logic_error if `probe_row_begin` is not in `[0, probe.num_rows()]`.
+   * @throw cudf::logic_error if `max_output_rows` is zero.
+   *
+   * @param probe The probe table, from which the tuples are probed.
+   * @param probe_row_begin The first probe row of the chunk.
+   * @param max_output_rows The maximum number of output rows of the chunk.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param mr Device memory resource used to allocate the returned table and columns' device
+   * memory.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return A tuple of [`left_indices`, `right_indices`, `next_probe_row`] where the indices are
+   * the chunk's rows of the result and `next_probe_row` is the first probe row of the next chunk.
+   */
+  std::tuple<std::unique_ptr<rmm::device_uvector<size_type>>,
+             std::unique_ptr<rmm::device_uvector<size_type>>,
+             size_type>
+  left_join_chunk(
+    cudf::table_view const& probe,
+    size_type probe_row_begin,
+    std::size_t max_output_rows,
+    null_equality compare_nulls         = null_equality::EQUAL,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * Returns a bloom filter over the rows of the build table. @see join_bloom_filter.
+   *
+   * Probing the filter is much cheaper than a join, so it can drop the probe rows without a match
+   * before they are gathered or decoded.
+   *
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param bits_per_key The number of filter bits per row of the build table.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the filter's device memory
+   *
+   * @return A bloom filter over the build table
+   */
+  join_bloom_filter bloom_filter(
+    null_equality compare_nulls         = null_equality::EQUAL,
+    int bits_per_key                    = 10,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
  private:
   struct hash_join_impl;
   const std::unique_ptr<const hash_join_impl> impl;
 };
 
+/**
+ * @brief Semi and anti join that builds a hash table of the right table's keys in creation and
+ * probes it with any number of left tables in subsequent member functions.
+ *
+ * Only the distinct keys of the right table are inserted, since semi and anti joins only test
+ * whether a left row has any match.
+ *
+ * @code{.pseudo}
+ * semi_join filter(right_keys);
+ * for (left_keys : queries) consume(filter.left_semi_join(left_keys));
+ * @endcode
+ */
+class semi_join {
+ public:
+  semi_join() = delete;
+  ~semi_join();
+  semi_join(semi_join const&) = delete;
+  semi_join(semi_join&&)      = delete;
+  semi_join& operator=(semi_join const&) = delete;
+  semi_join& operator=(semi_join&&) = delete;
+
+  /**
+   * @brief Construct a semi join object for subsequent probe calls.
+   *
+   * @note The `semi_join` object must not outlive the table viewed by `right_keys`, else
+   * behavior is undefined.
+   *
+   * @throw cudf::logic_error if `right_keys` has no columns.
+   *
+   * @param right_keys The right table, from which the hash table is built.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  semi_join(cudf::table_view const& right_keys,
+            null_equality compare_nulls  = null_equality::EQUAL,
+            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Returns whether each row of `left_keys` has a matching row in the right table.
+   *
+   * @throw cudf::logic_error if the columns of `left_keys` do not match those of the right table.
+   *
+   * @param left_keys The left table, from which the tuples are probed.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   *
+   * @return A non-nullable BOOL8 column with a row for each row of `left_keys`
+   */
+  std::unique_ptr<cudf::column> contains(
+    cudf::table_view const& left_keys,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the row indices of `left_keys` that have a matching row in the right table.
+   * @see cudf::left_semi_join().
+   *
+   * @throw cudf::logic_error if the columns of `left_keys` do not match those of the right table.
+   *
+   * @param left_keys The left table, from which the tuples are probed.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned vector's device memory
+   *
+   * @return A vector `left_indices` of the rows of the result of a left semi join
+   */
+  std::unique_ptr<rmm::device_uvector<size_type>> left_semi_join(
+    cudf::table_view const& left_keys,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the row indices of `left_keys` that have no matching row in the right table.
+   * @see cudf::left_anti_join().
+   *
+   * @throw cudf::logic_error if the columns of `left_keys` do not match those of the right table.
+   *
+   * @param left_keys The left table, from which the tuples are probed.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned vector's device memory
+   *
+   * @return A vector `left_indices` of the rows of the result of a left anti join
+   */
+  std::unique_ptr<rmm::device_uvector<size_type>> left_anti_join(
+    cudf::table_view const& left_keys,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  struct semi_join_impl;
+  const std::unique_ptr<const semi_join_impl> impl;
+};
+
+/**
+ * @brief Hash join of tables that are too large to be joined on the device at once.
+ *
+ * The rows of both tables are added in chunks. Each chunk is hash partitioned on its join keys into
+ * `num_partitions` partitions, which are copied to host memory, so that only one chunk has to be on
+ * the device at a time. As rows with equal keys always land in the same partition, joining the two
+ * tables is the same as joining each pair of partitions separately. The `*_join` member functions
+ * join a single pair of partitions, so that the device only holds one partition of each table and
+ * its hash table at a time, and the result can be consumed before the next partition is joined.
+ *
+ * @code{.pseudo}
+ * partitioned_join join({0}, {0}, 16);
+ * for (chunk : left_chunks) join.add_left(chunk);
+ * for (chunk : right_chunks) join.add_right(chunk);
+ * for (p = 0; p < join.num_partitions(); ++p) consume(join.inner_join(p));
+ * @endcode
+ *
+ * The concatenation of the results of all partitions holds the same rows as the result of the
+ * corresponding non-partitioned join, in an unspecified order.
+ *
+ * @note Dictionary join key columns are not supported, since chunks with different key sets would
+ * partition equal keys differently.
+ */
+class partitioned_join {
+ public:
+  partitioned_join() = delete;
+  ~partitioned_join();
+  partitioned_join(partitioned_join const&) = delete;
+  partitioned_join(partitioned_join&&)      = delete;
+  partitioned_join& operator=(partitioned_join const&) = delete;
+  partitioned_join& operator=(partitioned_join&&) = delete;
+
+  /**
+   * @brief Construct a partitioned join without any rows.
+   *
+   * @throw cudf::logic_error if `left_on` and `right_on` differ in size or are empty.
+   * @throw cudf::logic_error if `num_partitions` is not positive.
+   *
+   * @param left_on The column indices from the left table to join on
+   * @param right_on The column indices from the right table to join on
+   * @param num_partitions The number of partitions of each table
+   * @param compare_nulls Controls whether null join-key values should match or not
+   */
+  partitioned_join(std::vector<size_type> const& left_on,
+                   std::vector<size_type> const& right_on,
+                   int num_partitions,
+                   null_equality compare_nulls = null_equality::EQUAL);
+
+  /**
+   * @brief Partitions a chunk of rows of the left table and moves it to host memory.
+   *
+   * @throw cudf::logic_error if a join key column is a dictionary column.
+   *
+   * @param chunk Rows of the left table; all chunks must have the same columns
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void add_left(cudf::table_view const& chunk,
+                rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Partitions a chunk of rows of the right table and moves it to host memory.
+   *
+   * @throw cudf::logic_error if a join key column is a dictionary column.
+   *
+   * @param chunk Rows of the right table; all chunks must have the same columns
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void add_right(cudf::table_view const& chunk,
+                 rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Returns the number of partitions of each table.
+   */
+  int num_partitions() const;
+
+  /**
+   * @brief Performs an inner join of one partition of the left and right tables.
+   * @see cudf::inner_join().
+   *
+   * @throw cudf::logic_error if no chunk was added to either table.
+   * @throw cudf::logic_error if `partition` is out of range.
+   *
+   * @param partition The index of the partition to join
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   *
+   * @return Result of joining the rows of the left and right tables in `partition`
+   */
+  std::unique_ptr<cudf::table> inner_join(
+    int partition,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Performs a left join of one partition of the left and right tables.
+   * @see cudf::left_join().
+   *
+   * @throw cudf::logic_error if no chunk was added to either table.
+   * @throw cudf::logic_error if `partition` is out of range.
+   *
+   * @param partition The index of the partition to join
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   *
+   * @return Result of joining the rows of the left and right tables in `partition`
+   */
+  std::unique_ptr<cudf::table> left_join(
+    int partition,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Performs a full join of one partition of the left and right tables.
+   * @see cudf::full_join().
+   *
+   * @throw cudf::logic_error if no chunk was added to either table.
+   * @throw cudf::logic_error if `partition` is out of range.
+   *
+   * @param partition The index of the partition to join
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   *
+   * @return Result of joining the rows of the left and right tables in `partition`
+   */
+  std::unique_ptr<cudf::table> full_join(
+    int partition,
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  struct partitioned_join_impl;
+  const std::unique_ptr<partitioned_join_impl> impl;
+};
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to all pairs of rows between the
+ * specified tables where the predicate evaluates to true.
+ *
+ * The first returned vector contains the row indices from the left table that have a match in the
+ * right table. The corresponding values in the second returned vector are the matched row indices
+ * from the right table. The output is ordered by left row index, then by right row index.
+ *
+ * The predicate refers to the columns of `left` with `table_reference::LEFT` and to the columns
+ * of `right` with `table_reference::RIGHT`, which allows joining on inequalities, e.g. range
+ * conditions. Every pair of rows is evaluated, so a join with equality conditions should use
+ * `mixed_inner_join` instead. The output size is computed before the output is written, so no
+ * non-matching pair of rows is ever materialized.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 2}}
+ * Right: {{1, 2, 3}}
+ * Predicate: Left.Column_0 > Right.Column_0
+ * Result: {{2}, {0}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the predicate does not return a boolean.
+ * @throw cudf::logic_error if either table has nulls.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] binary_predicate The condition on which to join
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a conditional inner join between two tables `left` and `right` .
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+conditional_inner_join(
+  table_view const& left,
+  table_view const& right,
+  ast::expression const& binary_predicate,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to all pairs of rows between the
+ * specified tables where the predicate evaluates to true, or null matches for rows in left that
+ * have no match in right.
+ *
+ * Left rows without a match appear once, paired with a right index of
+ * `std::numeric_limits<size_type>::min()`. The output is ordered by left row index, then by
+ * right row index. @see conditional_inner_join().
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 2}}
+ * Right: {{1, 2, 3}}
+ * Predicate: Left.Column_0 > Right.Column_0
+ * Result: {{0, 1, 2}, {None, None, 0}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the predicate does not return a boolean.
+ * @throw cudf::logic_error if either table has nulls.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] binary_predicate The condition on which to join
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a conditional left join between two tables `left` and `right` .
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+conditional_left_join(
+  table_view const& left,
+  table_view const& right,
+  ast::expression const& binary_predicate,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to all pairs of rows between the
+ * specified tables where the equality columns are equal and the predicate evaluates to true.
+ *
+ * A hash table is built on `right_equality` and probed with `left_equality`; the predicate is
+ * only evaluated on the pairs of rows with equal keys, while they are probed, so the pairs that
+ * fail the predicate are never materialized. The predicate refers to the columns of
+ * `left_conditional` with `table_reference::LEFT` and to the columns of `right_conditional` with
+ * `table_reference::RIGHT`. Row `i` of an equality table and row `i` of the corresponding
+ * conditional table describe the same row. The output is in an unspecified order.
+ *
+ * @code{.pseudo}
+ * left_equality: {{0, 1, 2}}
+ * right_equality: {{1, 2, 3}}
+ * left_conditional: {{4, 4, 4}}
+ * right_conditional: {{3, 4, 5}}
+ * Predicate: Left.Column_0 > Right.Column_0
+ * Result: {{1}, {0}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the predicate does not return a boolean.
+ * @throw cudf::logic_error if either conditional table has nulls.
+ * @throw cudf::logic_error if the equality tables have no columns or a different number of
+ * columns.
+ * @throw cudf::logic_error if an equality table and the corresponding conditional table have a
+ * different number of rows.
+ *
+ * @param[in] left_equality The left table used for the equality join
+ * @param[in] right_equality The right table used for the equality join
+ * @param[in] left_conditional The left table used for the conditional join
+ * @param[in] right_conditional The right table used for the conditional join
+ * @param[in] binary_predicate The condition on which to join
+ * @param[in] compare_nulls Controls whether null join-key values should match or not
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a mixed inner join between the two tables.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_inner_join(
+  table_view const& left_equality,
+  table_view const& right_equality,
+  table_view const& left_conditional,
+  table_view const& right_conditional,
+  ast::expression const& binary_predicate,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to all pairs of rows between the
+ * specified tables where the equality columns are equal and the predicate evaluates to true, or
+ * null matches for rows in left that have no match in right.
+ *
+ * Left rows without a match appear once, paired with a right index of
+ * `std::numeric_limits<size_type>::min()`. @see mixed_inner_join().
+ *
+ * @code{.pseudo}
+ * left_equality: {{0, 1, 2}}
+ * right_equality: {{1, 2, 3}}
+ * left_conditional: {{4, 4, 4}}
+ * right_conditional: {{3, 4, 5}}
+ * Predicate: Left.Column_0 > Right.Column_0
+ * Result: {{0, 1, 2}, {None, 0, None}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the predicate does not return a boolean.
+ * @throw cudf::logic_error if either conditional table has nulls.
+ * @throw cudf::logic_error if the equality tables have no columns or a different number of
+ * columns.
+ * @throw cudf::logic_error if an equality table and the corresponding conditional table have a
+ * different number of rows.
+ *
+ * @param[in] left_equality The left table used for the equality join
+ * @param[in] right_equality The right table used for the equality join
+ * @param[in] left_conditional The left table used for the conditional join
+ * @param[in] right_conditional The right table used for the conditional join
+ * @param[in] binary_predicate The condition on which to join
+ * @param[in] compare_nulls Controls whether null join-key values should match or not
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a mixed left join between the two tables.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_left_join(
+  table_view const& left_equality,
+  table_view const& right_equality,
+  table_view const& left_conditional,
+  table_view const& right_conditional,
+  ast::expression const& binary_predicate,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join between two tables
+ * that are sorted on their join keys.
+ *
+ * Instead of building a hash table, the two key tables are merged, which finds the range of
+ * matching right rows of every left row in linear time. The output is ordered by left row index,
+ * then by right row index, so the joined keys keep the sort order of the inputs and the result
+ * can be merged or grouped without sorting it again.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 1, 2}}
+ * Right: {{1, 1, 2, 3}}
+ * Result: {{1, 1, 2, 2, 3}, {0, 1, 0, 1, 2}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the key tables have no columns or a different number of columns.
+ * @throw cudf::logic_error if `column_order` or `null_precedence` is neither empty nor of the size
+ * of the number of key columns.
+ *
+ * @param[in] left_keys The left table, sorted on all its columns
+ * @param[in] right_keys The right table, sorted on all its columns in the same order
+ * @param[in] column_order The sort order of each key column. Empty means all ascending.
+ * @param[in] null_precedence The order of nulls of each key column. Empty means all nulls
+ * before.
+ * @param[in] compare_nulls Controls whether null join-key values should match or not
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and `right_keys`
+ * as the join keys.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_inner_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  null_equality compare_nulls                    = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to a left join between two tables
+ * that are sorted on their join keys.
+ *
+ * Left rows without a match appear once, paired with a right index of
+ * `std::numeric_limits<size_type>::min()`. The output is ordered by left row index, then by
+ * right row index. @see sort_merge_inner_join().
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 1, 2}}
+ * Right: {{1, 1, 2, 3}}
+ * Result: {{0, 1, 1, 2, 2, 3}, {None, 0, 1, 0, 1, 2}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the key tables have no columns or a different number of columns.
+ * @throw cudf::logic_error if `column_order` or `null_precedence` is neither empty nor of the size
+ * of the number of key columns.
+ *
+ * @param[in] left_keys The left table, sorted on all its columns
+ * @param[in] right_keys The right table, sorted on all its columns in the same order
+ * @param[in] column_order The sort order of each key column. Empty means all ascending.
+ * @param[in] null_precedence The order of nulls of each key column. Empty means all nulls
+ * before.
+ * @param[in] compare_nulls Controls whether null join-key values should match or not
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a left join between two tables with `left_keys` and `right_keys`
+ * as the join keys.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_left_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  null_equality compare_nulls                    = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief The direction in which an as-of join looks for the nearest right row.
+ */
+enum class asof_direction : int32_t {
+  BACKWARD,  ///< The right row with the largest `on` value not greater than the left row's
+  FORWARD,   ///< The right row with the smallest `on` value not less than the left row's
+  NEAREST    ///< The closer of the backward and forward matches, preferring the backward one
+};
+
+/**
+ * @brief Returns the row of the right table nearest to each row of the left table among the right
+ * rows with equal `by` keys.
+ *
+ * This is the as-of join of time series, e.g. matching each trade to the latest quote of the same
+ * symbol at or before the time of the trade. The right table does not need to be sorted. It is
+ * sorted once, and each left row is then matched by a single binary search over the right rows
+ * ordered by `by` keys and `on` value, which finds the group of its keys and its position in that
+ * group at once.
+ *
+ * @code{.pseudo}
+ * Left by: {{"a", "a", "b"}}, left on: {3, 9, 5}
+ * Right by: {{"a", "b", "a", "a"}}, right on: {1, 2, 8, 4}
+ * BACKWARD: {0, 2, 1}
+ * FORWARD: {3, None, None}
+ * NEAREST with tolerance 2: {3, 2, None}
+ * @endcode
+ *
+ * Left rows without a match, including those whose `on` value is null, have a right index of
+ * `std::numeric_limits<size_type>::min()`, so the result can be gathered with
+ * `out_of_bounds_policy::NULLIFY`. Right rows whose `on` value is null never match.
+ *
+ * @throw cudf::logic_error if `left_by` and `right_by` have different numbers or types of columns.
+ * @throw cudf::logic_error if `left_on` and `right_on` have different types, or a type that is
+ * neither numeric nor a timestamp or duration.
+ * @throw cudf::logic_error if `tolerance` is negative.
+ *
+ * @param[in] left_by The keys of the left table that must equal those of the matched right row
+ * @param[in] right_by The keys of the right table that must equal those of the left row
+ * @param[in] left_on The values of the left table ordering the rows of each group
+ * @param[in] right_on The values of the right table ordering the rows of each group
+ * @param[in] direction The direction in which to look for the nearest right row
+ * @param[in] tolerance The maximum distance between the `on` values of matched rows, in units of
+ * the `on` type's representation, e.g. ticks of a timestamp. If not given, any distance matches.
+ * @param[in] compare_nulls Controls whether null `by` keys should match or not
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A vector of `left_by.num_rows()` indices of the matched right rows
+ */
+std::unique_ptr<rmm::device_uvector<size_type>> asof_join(
+  cudf::table_view const& left_by,
+  cudf::table_view const& right_by,
+  cudf::column_view const& left_on,
+  cudf::column_view const& right_on,
+  asof_direction direction            = asof_direction::BACKWARD,
+  std::optional<double> tolerance     = {},
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Merges `updates` into `target` by their key columns: the rows of `target` whose keys
+ * match a row of `updates` are overwritten in place by that row, and the rows of `updates` whose
+ * keys match no row of `target` are returned, to be appended to `target`.
+ *
+ * The hash table is built once on the keys of `updates` and probed with the keys of `target`.
+ * Only the matched elements of `target` are written, instead of rewriting every column as a join
+ * followed by a scatter and a concatenate would.
+ *
+ * ```
+ * target:      {{1, 2, 3}, {10, 20, 30}}
+ * updates:     {{3, 4, 1}, {33, 44, 11}}
+ * key_columns: {0}
+ * target after: {{1, 2, 3}, {11, 20, 33}}
+ * result:       {{4}, {44}}
+ * ```
+ *
+ * The key columns of the matched rows are equal and are not written. The keys of `updates` must
+ * be unique; if several rows of `updates` match a row of `target`, the values it is updated with
+ * are unspecified.
+ *
+ * @throw cudf::logic_error if `target` and `updates` have different numbers or types of columns.
+ * @throw cudf::logic_error if a key column index is out of bounds.
+ * @throw cudf::logic_error if a non-key column is not fixed-width, since it cannot be updated in
+ * place.
+ * @throw cudf::logic_error if a non-key column of `updates` has nulls and the column of `target`
+ * is not nullable.
+ *
+ * @param[in,out] target The table to update, whose null counts are updated with its elements
+ * @param[in] updates The rows to merge into `target`
+ * @param[in] key_columns Indices of the key columns in both tables
+ * @param[in] compare_nulls Controls whether null keys should match or not
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @return The rows of `updates` whose keys match no row of `target`, in the order of `updates`
+ */
+std::unique_ptr<cudf::table> upsert(
+  mutable_table_view& target,
+  table_view const& updates,
+  std::vector<size_type> const& key_columns,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
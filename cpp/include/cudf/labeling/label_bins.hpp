@@ -77,5 +77,33 @@ std::unique_ptr<column> label_bins(
   inclusive right_inclusive,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Counts the elements of `input` in each of the specified bins.
+ *
+ * The bins and the membership of the elements are the same as in `label_bins`, but the elements
+ * are counted as they are binned, without materializing their labels. `output[i]` is the number
+ * of elements of `input` that `label_bins` would label `i`.
+ *
+ * @throws cudf::logic_error if `input.type() == left_edges.type() == right_edges.type()` is
+ * violated.
+ * @throws cudf::logic_error if `left_edges.size() != right_edges.size()`
+ * @throws cudf::logic_error if `left_edges.has_nulls()` or `right_edges.has_nulls()`
+ *
+ * @param input The input elements to count according to the specified bins.
+ * @param left_edges Values of the left edge of each bin.
+ * @param left_inclusive Whether or not the left edge is inclusive.
+ * @param right_edges Value of the right edge of each bin.
+ * @param right_inclusive Whether or not the right edge is inclusive.
+ * @param mr Device memory resource used to allocate the returned column's device.
+ * @return The INT64 number of elements of `input` in each bin, without nulls.
+ */
+std::unique_ptr<column> histogram(
+  column_view const& input,
+  column_view const& left_edges,
+  inclusive left_inclusive,
+  column_view const& right_edges,
+  inclusive right_inclusive,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -26,6 +26,15 @@ namespace lists {
  * @file
  */
 
+/**
+ * @brief Option to choose whether `index_of()` returns the first or last match
+ * of a search key in a list row
+ */
+enum class duplicate_find_option : int32_t {
+  FIND_FIRST = 0,  ///< Finds the first matching index in a list row
+  FIND_LAST        ///< Finds the last matching index in a list row
+};
+
 /**
  * @brief Create a column of bool values indicating whether the specified scalar
  * is an element of each row of a list column.
@@ -74,6 +83,69 @@ std::unique_ptr<column> contains(
   cudf::column_view const& search_keys,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create a column of values indicating the position of the specified scalar
+ * in each row of a list column.
+ *
+ * The output column has as many elements as the input `lists` column.
+ * Output `column[i]` contains a 0-based index indicating the position of `search_key`
+ * in the lists row `lists[i]`, or -1 if `lists[i]` does not contain it.
+ * For lists that contain the key more than once, `find_option` chooses whether the
+ * index of the first or the last match is returned.
+ *
+ * Null entries of a list row are never matched. Output `column[i]` is set to null if
+ * the search key `search_key` is null or the list row `lists[i]` is null.
+ *
+ * @code{.pseudo}
+ * lists  = { {1, 2, 3, 2}, {4}, {}, null }
+ * r = index_of(lists, 2, FIND_FIRST)
+ * r is now { 1, -1, -1, null }
+ * r = index_of(lists, 2, FIND_LAST)
+ * r is now { 3, -1, -1, null }
+ * @endcode
+ *
+ * @throw cudf::logic_error if the type of `search_key` does not match the element type of `lists`
+ *
+ * @param lists Lists column whose `n` rows are to be searched
+ * @param search_key The scalar key to be looked up in each list row
+ * @param find_option Whether to find the first or last match of the key
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return std::unique_ptr<column> INT32 column of `n` rows with the position of the key
+ */
+std::unique_ptr<column> index_of(
+  cudf::lists_column_view const& lists,
+  cudf::scalar const& search_key,
+  duplicate_find_option find_option   = duplicate_find_option::FIND_FIRST,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a column of values indicating the position of the values of the second
+ * column in the corresponding list rows of the first column
+ *
+ * The output column has as many elements as the input `lists` column.
+ * Output `column[i]` contains a 0-based index indicating the position of `search_keys[i]`
+ * in the lists row `lists[i]`, or -1 if `lists[i]` does not contain it.
+ * For lists that contain the key more than once, `find_option` chooses whether the
+ * index of the first or the last match is returned.
+ *
+ * Null entries of a list row are never matched. Output `column[i]` is set to null if
+ * `search_keys[i]` is null or the list row `lists[i]` is null.
+ *
+ * @throw cudf::logic_error if the type of `search_keys` does not match the element type of
+ * `lists`, or if `search_keys` and `lists` do not have the same number of rows
+ *
+ * @param lists Lists column whose `n` rows are to be searched
+ * @param search_keys Column of elements to be looked up in each list row
+ * @param find_option Whether to find the first or last match of each key
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return std::unique_ptr<column> INT32 column of `n` rows with the position of each key
+ */
+std::unique_ptr<column> index_of(
+  cudf::lists_column_view const& lists,
+  cudf::column_view const& search_keys,
+  duplicate_find_option find_option   = duplicate_find_option::FIND_FIRST,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace lists
 }  // namespace cudf
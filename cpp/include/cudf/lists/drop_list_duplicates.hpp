@@ -61,6 +61,35 @@ std::unique_ptr<column> drop_list_duplicates(
   nan_equality nans_equal             = nan_equality::UNEQUAL,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create a new lists column by removing duplicated entries from each list element in the
+ * given lists column, keeping the first occurrence of each entry in its input order
+ *
+ * @throw cudf::logic_error if any row (list element) in the input column is a nested type.
+ *
+ * This produces the same entries as `drop_list_duplicates` without sorting them. The duplicates
+ * are found with a hash set of the entries keyed by the lists containing them, which makes this
+ * faster than `drop_list_duplicates` when the order of the entries does not matter.
+ *
+ * @param lists_column The input lists_column_view
+ * @param nulls_equal  Flag to specify whether null entries should be considered equal
+ * @param nans_equal   Flag to specify whether NaN entries should be considered as equal value (only
+ * applicable for floating point data column)
+ * @param mr           Device resource used to allocate memory
+ *
+ * @code{.pseudo}
+ * lists_column = { {1, 1, 2, 1, 3}, {4}, NULL, {}, {NULL, NULL, NULL, 5, 6, 6, 6, 5} }
+ * output = { {1, 2, 3}, {4}, NULL, {}, {NULL, 5, 6} }
+ * @endcode
+ *
+ * @return A list column with list elements having unique entries
+ */
+std::unique_ptr<column> distinct(
+  lists_column_view const& lists_column,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  nan_equality nans_equal             = nan_equality::UNEQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace lists
 }  // namespace cudf
@@ -109,6 +109,47 @@ std::unique_ptr<table> explode_position(
   size_type explode_column_idx,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Explodes a list column's elements without duplicating the other columns of its table.
+ *
+ * Returns the exploded elements along with a gather map of the row of the list containing each
+ * element, and optionally the position of each element within its list. Gathering the other
+ * columns of a table with this map produces the rows of `explode` or `explode_position`, so a
+ * caller that filters or projects the exploded rows can gather only the rows and columns it keeps.
+ * Example:
+ * ```
+ * [[5,10,15],
+ *  null,
+ *  [20,25],
+ *  [],
+ *  [30]]
+ * returns
+ * [0,  0,   5],
+ * [0,  1,  10],
+ * [0,  2,  15],
+ * [2,  0,  20],
+ * [2,  1,  25],
+ * [4,  0,  30],
+ * ```
+ *
+ * As for `explode`, null and empty lists produce no rows and null elements are null rows of the
+ * exploded column.
+ *
+ * @throw cudf::logic_error if `explode_column` is not a lists column.
+ *
+ * @param explode_column Lists column to explode.
+ * @param include_position Whether the position column is included.
+ * @param mr Device memory resource used to allocate the returned columns' device memory.
+ *
+ * @return A new table whose columns are [gather_map, explode_position, explode_value] if
+ *         `include_position` is true, or [gather_map, explode_value] otherwise. The gather map and
+ *         the positions are INT32 columns without nulls.
+ */
+std::unique_ptr<table> explode_gather_map(
+  column_view const& explode_column,
+  bool include_position               = false,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Explodes a list column's elements retaining any null entries or empty lists inside.
  *
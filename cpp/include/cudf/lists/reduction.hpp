@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+
+namespace cudf {
+namespace lists {
+/**
+ * @addtogroup lists_reduction
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Computes the reduction of the entries of each list element in the given lists column.
+ *
+ * The output column has one row per list element. The entries of each list are reduced as the
+ * segments of `cudf::segmented_reduce`, so the supported aggregations are `sum`, `product`, `min`,
+ * `max`, `mean`, `any` and `all`.
+ *
+ * @code{.pseudo}
+ * l = { {1, 2, 3}, {4, null}, {}, null }
+ * r = reduce(l, sum, INT64, EXCLUDE)
+ * r is now {6, 4, null, null}
+ * r = reduce(l, sum, INT64, INCLUDE)
+ * r is now {6, null, null, null}
+ * @endcode
+ *
+ * A null list element or an empty list reduces to null. With `null_policy::EXCLUDE` the null
+ * entries of a list are skipped and it reduces to null only if all of them are null. With
+ * `null_policy::INCLUDE` a list with any null entry reduces to null.
+ *
+ * @throw cudf::logic_error if the aggregation is not supported for the type of the entries or
+ * for `output_dtype`, as for `cudf::segmented_reduce`.
+ *
+ * @param input Input lists column
+ * @param agg Aggregation operator applied to the entries of each list
+ * @param output_dtype The computation and output precision
+ * @param null_handling Whether the null entries of a list are skipped or make its reduction null
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Column of the reduction of each list element
+ */
+std::unique_ptr<column> reduce(
+  lists_column_view const& input,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of lists_reduction group
+
+}  // namespace lists
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,11 +16,13 @@
 
 #pragma once
 
+#include <cudf/copying.hpp>
 #include <cudf/types.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
+#include <tuple>
 #include <vector>
 
 namespace cudf {
@@ -78,6 +80,10 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
  * the same bin are grouped consecutively in the output table. Returns a vector
  * of row offsets to the start of each partition in the output table.
  *
+ * When `num_partitions` is greater than 1024, the rows are partitioned by a stable radix sort of
+ * their partition numbers, so the rows of each partition keep their order in `input`. The order
+ * of the rows within a partition is otherwise unspecified.
+ *
  * @throw std::out_of_range if index is `columns_to_hash` is invalid
  *
  * @param input The table to partition
@@ -99,6 +105,117 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Partitions rows from the input table into multiple output tables by precomputed row
+ * hash values.
+ *
+ * Partitions rows of `input` into `num_partitions` bins like `hash_partition`, but takes the hash
+ * value of each row from `row_hashes` rather than hashing the rows. The hash values of a table
+ * can be computed once by `cudf::hash` and reused to partition it several times, or to partition
+ * tables sharing the same keys. Partitioning by `cudf::hash(input.select(columns_to_hash))`
+ * assigns each row to the same partition as `hash_partition(input, columns_to_hash,
+ * num_partitions)`.
+ *
+ * Returns an empty table and no offsets if `num_partitions` is not positive or `input` has no
+ * rows.
+ *
+ * @throw cudf::logic_error if `row_hashes` is not an INT32 or UINT32 column
+ * @throw cudf::logic_error if `row_hashes` has nulls
+ * @throw cudf::logic_error if the size of `row_hashes` is not the number of rows of `input`
+ *
+ * @param input The table to partition
+ * @param row_hashes The hash value of each row of `input`
+ * @param num_partitions The number of partitions to use
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ *
+ * @returns An output table and a vector of row offsets to each partition
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_by_hashes(
+  table_view const& input,
+  column_view const& row_hashes,
+  int num_partitions,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Partitions rows from the input table into multiple packed tables.
+ *
+ * Partitions rows of `input` into `num_partitions` bins based on the hash value of the columns
+ * specified by `columns_to_hash`, like `hash_partition`, but returns each partition packed into
+ * its own contiguous buffer, like `contiguous_split`. When all the columns of `input` are
+ * fixed-width, the rows are scattered directly into the packed buffers without materializing the
+ * partitioned table.
+ *
+ * The partitions contain the same rows as the partitions of `hash_partition`, but the order of the
+ * rows within a partition is unspecified.
+ *
+ * Returns an empty vector if `num_partitions` is not positive or `columns_to_hash` is empty.
+ *
+ * @throw std::out_of_range if index is `columns_to_hash` is invalid
+ *
+ * @param input The table to partition
+ * @param columns_to_hash Indices of input columns to hash
+ * @param num_partitions The number of partitions to use
+ * @param hash_function Optional hash id that chooses the hash function to use
+ * @param seed Optional seed value to the hash function
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned buffers' device memory.
+ *
+ * @returns A packed table for each partition
+ */
+std::vector<packed_table> hash_partition_and_pack(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
+  uint32_t seed                       = DEFAULT_HASH_SEED,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Partitions rows from the input table into ranges of the order of the key columns, with
+ * splitters chosen from a sample of the rows.
+ *
+ * A sample of `sample_size` rows of the key columns is sorted, and `num_partitions - 1` evenly
+ * spaced rows of the sorted sample are chosen as splitters. Each row of `input` goes to the
+ * partition of the number of splitters that are less than or equal to its keys, so partition
+ * `i` holds the rows ordered between splitters `i - 1` and `i`. Sorting each partition then sorts
+ * the whole table, e.g. for a distributed sort.
+ *
+ * Returns a `vector<size_type>` of `num_partitions` offsets to the start of each partition in the
+ * output table, which is empty if `input` has no rows. The order of the rows within a partition
+ * is unspecified.
+ *
+ * @throw cudf::logic_error if `num_partitions` or `sample_size` is not positive
+ * @throw cudf::logic_error if `key_columns` is empty
+ * @throw cudf::logic_error if `column_order` does not have an order for each key column
+ * @throw std::out_of_range if an index in `key_columns` is invalid
+ *
+ * @param input The table to partition
+ * @param key_columns Indices of the input columns to order the rows by
+ * @param column_order The order of each key column
+ * @param num_partitions The number of partitions to use
+ * @param sample_size The number of rows to sample to choose the splitters. All the rows are used
+ * if `input` has fewer rows.
+ * @param null_precedence The order of the nulls of each key column. Nulls are ordered before
+ * other values if empty.
+ * @param seed Seed of the random sampling of the rows
+ * @param mr Device memory resource used to allocate the returned tables' device memory
+ *
+ * @returns A tuple of the partitioned table, the row offsets of the partitions and a table of
+ * the key columns of the `num_partitions - 1` splitters
+ */
+std::tuple<std::unique_ptr<table>, std::vector<size_type>, std::unique_ptr<table>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  std::vector<order> const& column_order,
+  size_type num_partitions,
+  size_type sample_size,
+  std::vector<null_order> const& null_precedence = {},
+  int64_t seed                                   = 0,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Round-robin partition.
  *
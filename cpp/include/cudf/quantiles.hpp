@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -94,5 +94,26 @@ std::unique_ptr<table> quantiles(
   std::vector<null_order> const& null_precedence = {},
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes approximate percentiles from t-digests.
+ *
+ * The t-digests are produced by `TDIGEST` aggregations, possibly merged by `MERGE_TDIGEST`
+ * aggregations. A percentile is interpolated linearly between the centroids around it, with the
+ * minimum and maximum of the digest at its ends, so percentiles `0` and `1` are exact.
+ *
+ * @throws cudf::logic_error if `digests` is not a structs column of t-digests
+ *
+ * @param digests Structs column of t-digests
+ * @param percentiles Desired percentiles in range [0, 1]
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns LIST<FLOAT64> column of the approximate percentiles of each digest. The list of a null
+ * digest or of a digest without centroids is null.
+ */
+std::unique_ptr<column> percentile_approx(
+  column_view const& digests,
+  std::vector<double> const& percentiles,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
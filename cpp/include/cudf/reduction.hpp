@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,10 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
 
 namespace cudf {
 /**
@@ -69,13 +73,127 @@ std::unique_ptr<scalar> reduce(
   data_type output_dtype,
   rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the reduction of the values in all rows of a column into an existing scalar
+ * without synchronizing the stream.
+ *
+ * Like `reduce`, but the result is written to the device memory of `output`, whose type is the
+ * output type of the reduction, and no host memory is copied to or from the device, so the
+ * reduction is ordered on `stream` without blocking the host. A scalar allocated once can be
+ * reduced into repeatedly and passed to `binary_operation` as a scalar operand on the same
+ * stream. The validity of `output` is set on the device: it is null if `col` is empty or all of
+ * its elements are null.
+ *
+ * Supports the `sum`, `product`, `sum_of_squares`, `min`, `max`, `any` and `all` aggregations of
+ * fixed-width columns that are neither dictionary nor fixed-point.
+ *
+ * @note The null count of `col` must be known, as it is for any column_view of a column, or
+ * computing it synchronizes the stream.
+ *
+ * @throw cudf::logic_error if the aggregation is not supported.
+ * @throw cudf::logic_error if `col` or `output` is not of a supported type.
+ * @throw cudf::logic_error if `min` or `max` is called and the type of `output` does not match
+ * the type of `col`.
+ * @throw cudf::logic_error if `any` or `all` is called and the type of `output` is not BOOL8.
+ *
+ * @param col Input column view
+ * @param agg Aggregation operator applied by the reduction
+ * @param output Scalar the reduction is written to
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void reduce_into(column_view const &col,
+                 std::unique_ptr<aggregation> const &agg,
+                 scalar &output,
+                 rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @brief Computes the reductions of the values in all rows of each column of a table.
+ *
+ * Computes each aggregation of `aggs` for each column of `input`, like calling `reduce` for each
+ * column and aggregation with the output type `cudf::detail::target_type` of the column type and
+ * aggregation: `int64` for the `sum`, `product` and `sum_of_squares` of integers, `double` for
+ * `mean`, `var` and `std`, `bool8` for `any` and `all`, `int32` for `count` and the column type
+ * otherwise.
+ *
+ * The `sum`, `product`, `sum_of_squares`, `min`, `max`, `mean`, `var`, `std`, `any`, `all` and
+ * `count` aggregations of the numeric columns are all computed from a single pass over each
+ * column, and their results are copied to the host with a single transfer for the whole table.
+ * The other aggregations and columns are reduced one at a time by `reduce`. A `count` with
+ * `null_policy::EXCLUDE` is the number of valid elements of a column, which is never null.
+ *
+ * @throw cudf::logic_error if an aggregation is not supported for the type of a column.
+ *
+ * @param input Table of the columns to reduce
+ * @param aggs Aggregations to compute for each column
+ * @param mr Device memory resource used to allocate the returned scalars' device memory
+ * @returns For each column, the scalar of each aggregation in `aggs`
+ */
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce(
+  table_view const &input,
+  std::vector<std::unique_ptr<aggregation>> const &aggs,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes the reduction of the values in each segment of a column.
+ *
+ * Segment `i` is made of the rows `[offsets[i], offsets[i+1])` of `segmented_values`, such as the
+ * rows of a list of a lists column or of a group of a sorted column, so the output column has
+ * `offsets.size() - 1` rows. Supported aggregations are `sum`, `product`, `min`, `max`, `mean`,
+ * `any` and `all`. The `mean` of a segment is its sum divided by its number of valid elements.
+ *
+ * @code{.pseudo}
+ * segmented_values = {1, 2, 3, 4, null, 5, null}
+ * offsets          = {0, 3, 6, 6, 7}
+ * sum, EXCLUDE     = {6, 9, null, null}
+ * sum, INCLUDE     = {6, null, null, null}
+ * @endcode
+ *
+ * The reduction of an empty segment is null. With `null_policy::EXCLUDE` the null elements of a
+ * segment are skipped and the reduction is null only if all of them are null. With
+ * `null_policy::INCLUDE` the reduction of a segment with any null element is null.
+ *
+ * @throw cudf::logic_error if `offsets` is empty.
+ * @throw cudf::logic_error if the aggregation is not supported.
+ * @throw cudf::logic_error if `sum`, `product`, `any` or `all` is called for a non-arithmetic
+ * input or output type.
+ * @throw cudf::logic_error if `min` or `max` is called and `output_dtype` does not match the
+ * input column data type, or for a non-fixed-width or fixed-point input column.
+ * @throw cudf::logic_error if `any` or `all` is called and `output_dtype` is not BOOL8.
+ * @throw cudf::logic_error if `mean` is called and `output_dtype` is not floating-point.
+ *
+ * @param segmented_values Input column view
+ * @param offsets Offsets of the segments, which must be sorted and within the size of
+ * `segmented_values`
+ * @param agg Aggregation operator applied by the reduction
+ * @param output_dtype The computation and output precision
+ * @param null_handling Whether the null elements of a segment are skipped or make its reduction
+ * null
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @returns Column of the reduction of each segment
+ */
+std::unique_ptr<column> segmented_reduce(
+  column_view const &segmented_values,
+  device_span<size_type const> offsets,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  null_policy null_handling,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief  Computes the scan of a column.
  *
  * The null values are skipped for the operation, and if an input element
  * at `i` is null, then the output element at `i` will also be null.
  *
+ * Strings columns support inclusive and exclusive min/max scans. Since strings have no
+ * representable identity, the rows of an exclusive string scan that are not preceded by any
+ * valid element are null.
+ *
+ * RANK and DENSE_RANK aggregations rank the rows of a presorted column of any type and return a
+ * non-nullable `size_type` column; null elements compare equal and `null_handling` is ignored.
+ *
  * @throws cudf::logic_error if column datatype is not numeric type.
+ * @throws cudf::logic_error if a RANK or DENSE_RANK scan is not inclusive.
  *
  * @param[in] input The input column view for the scan
  * @param[in] agg unique_ptr to aggregation operator applied by the scan
@@ -107,6 +225,30 @@ std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>> minmax(
   column_view const &col,
   rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Determines the minimum and maximum values of a column into existing scalars without
+ * synchronizing the stream.
+ *
+ * Like `minmax`, but the minimum and maximum are written to the device memory of `minimum` and
+ * `maximum` with no copies between host and device memory. Their validity is set on the device:
+ * they are null if `col` is empty or all of its elements are null.
+ *
+ * @note The null count of `col` must be known, or computing it synchronizes the stream.
+ *
+ * @throw cudf::logic_error if `col` is not fixed-width, or is dictionary or fixed-point.
+ * @throw cudf::logic_error if the type of `minimum` or `maximum` does not match the type of
+ * `col`.
+ *
+ * @param col Column to compute minmax
+ * @param minimum Scalar the minimum value is written to
+ * @param maximum Scalar the maximum value is written to
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void minmax_into(column_view const &col,
+                 scalar &minimum,
+                 scalar &maximum,
+                 rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 /** @} */  // end of group
 
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,7 +17,10 @@
 #pragma once
 
 #include <cudf/types.hpp>
+
+#include <functional>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -86,6 +89,48 @@ std::unique_ptr<column> replace_nulls(
   replace_policy const& replace_policy,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Replaces all null values in each column of a table with the scalar of that column.
+ *
+ * If `input.column(j)[i]` is NULL, then `output.column(j)[i]` will contain `replacements[j]`.
+ * Each column and its scalar must have the same type. Columns whose scalar is not valid are
+ * copied unchanged.
+ *
+ * The fixed-width columns are filled with one kernel launch per element size, instead of one
+ * launch per column as with the column overload.
+ *
+ * @throws cudf::logic_error if the number of `replacements` is not the number of columns
+ * @throws cudf::logic_error if the type of a column and of its scalar differ
+ *
+ * @param[in] input A table whose null values will be replaced
+ * @param[in] replacements Scalars used to replace the null values, one per column of `input`
+ * @param[in] mr Device memory resource used to allocate device memory of the returned table.
+ *
+ * @returns Copy of `input` with null values replaced by `replacements`.
+ */
+std::unique_ptr<table> replace_nulls(
+  table_view const& input,
+  std::vector<std::reference_wrapper<scalar const>> const& replacements,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Replaces all null values in each column of a table with the first non-null value of
+ * the column that precedes/follows.
+ *
+ * The positions of the replacement values of all the columns are computed with a single scan, and
+ * the fixed-width columns are then gathered with one kernel launch per element size.
+ *
+ * @param[in] input A table whose null values will be replaced.
+ * @param[in] replace_policy Specify the position of replacement values relative to null values.
+ * @param[in] mr Device memory resource used to allocate device memory of the returned table.
+ *
+ * @returns Copy of `input` with null values replaced based on `replace_policy`.
+ */
+std::unique_ptr<table> replace_nulls(
+  table_view const& input,
+  replace_policy const& replace_policy,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Replaces all NaN values in a column with corresponding values from another column
  *
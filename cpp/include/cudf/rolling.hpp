@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,9 +16,13 @@
 
 #pragma once
 
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
 #include <cudf/types.hpp>
 
+#include <future>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -119,6 +123,47 @@ struct window_bounds {
   {
   }
 };
+
+/**
+ * @brief Precomputed window sizes of every row of a variable-size rolling window.
+ *
+ * Computing the windows of a range-based rolling window requires grouping the keys and searching
+ * the timestamps of every row. A `rolling_window_spec` keeps the resulting window sizes so that
+ * any number of aggregations can be applied over them with
+ * `rolling_window(column_view const&, rolling_window_spec const&, ...)`.
+ */
+class rolling_window_spec {
+ public:
+  /**
+   * @brief Construct a window specification from the window sizes of every row.
+   *
+   * @throws cudf::logic_error if the window columns are not of type INT32 or differ in size
+   *
+   * @param preceding_window Non-nullable INT32 preceding window size of every row
+   * @param following_window Non-nullable INT32 following window size of every row
+   */
+  rolling_window_spec(std::unique_ptr<column>&& preceding_window,
+                      std::unique_ptr<column>&& following_window);
+
+  /**
+   * @brief Returns the preceding window size of every row.
+   */
+  column_view preceding_window() const { return _preceding_window->view(); }
+
+  /**
+   * @brief Returns the following window size of every row.
+   */
+  column_view following_window() const { return _following_window->view(); }
+
+  /**
+   * @brief Returns the number of rows the windows are defined for.
+   */
+  size_type size() const { return _preceding_window->size(); }
+
+ private:
+  std::unique_ptr<column> _preceding_window;
+  std::unique_ptr<column> _following_window;
+};
 /**
  * @brief  Applies a grouping-aware, fixed-size rolling window function to the values in a column.
  *
@@ -379,6 +424,35 @@ std::unique_ptr<column> grouped_time_range_rolling_window(
   std::unique_ptr<aggregation> const& aggr,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the windows of a grouping-aware, time-range-based rolling window once, for use
+ * by any number of aggregations.
+ *
+ * The windows are those `grouped_time_range_rolling_window()` uses for the same arguments, so
+ * `rolling_window(input, spec, min_periods, aggs)` matches calling
+ * `grouped_time_range_rolling_window()` once per aggregation, without grouping the keys and
+ * searching the timestamps again for every aggregation.
+ *
+ * @throws cudf::logic_error if `group_keys` and `timestamp_column` differ in size, or if
+ * `timestamp_column` is not of a supported timestamp type
+ *
+ * @param[in] group_keys The (pre-sorted) grouping columns
+ * @param[in] timestamp_column The (pre-sorted) timestamps for each row
+ * @param[in] timestamp_order  The order (ASCENDING/DESCENDING) in which the timestamps are sorted
+ * @param[in] preceding_window_in_days The rolling window time-interval in the backward direction.
+ * @param[in] following_window_in_days The rolling window time-interval in the forward direction.
+ * @param[in] mr Device memory resource used to allocate the window sizes
+ *
+ * @returns The window sizes of every row
+ */
+rolling_window_spec make_grouped_time_range_window_spec(
+  table_view const& group_keys,
+  column_view const& timestamp_column,
+  cudf::order const& timestamp_order,
+  window_bounds preceding_window_in_days,
+  window_bounds following_window_in_days,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief  Applies a variable-size rolling window function to the values in a column.
  *
@@ -421,5 +495,53 @@ std::unique_ptr<column> rolling_window(
   std::unique_ptr<aggregation> const& agg,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Applies several rolling window functions over the same precomputed windows.
+ *
+ * Equivalent to calling `rolling_window(input, window_spec.preceding_window(),
+ * window_spec.following_window(), min_periods, agg)` for every aggregation of `aggs`.
+ *
+ * @throws cudf::logic_error if `window_spec` and `input` differ in size
+ *
+ * @param[in] input The input column
+ * @param[in] window_spec The window sizes of every row of `input`
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] aggs The rolling window aggregations to apply
+ * @param[in] mr Device memory resource used to allocate the returned columns' device memory
+ *
+ * @returns One nullable output column per aggregation, in the order of `aggs`
+ */
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  rolling_window_spec const& window_spec,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Compiles the kernels of a rolling window UDF aggregation on a background thread.
+ *
+ * Rolling windows with `udf_type::CUDA` or `udf_type::PTX` aggregations are compiled on first
+ * use for every combination of input type and window kind, which delays the first call by the
+ * compilation time. This function compiles the kernels of the fixed-size, variable-size and
+ * grouped rolling windows of `agg` on `input_type` ahead of time, so that the first call of
+ * `rolling_window`, `grouped_rolling_window` or `grouped_time_range_rolling_window` with `agg`
+ * launches a cached kernel. The kernels are compiled for the current device.
+ *
+ * Compiled kernels are also persisted in the kernel cache directory, `LIBCUDF_KERNEL_CACHE_PATH`
+ * or `$HOME/.cudf` by default, from which later processes load them instead of compiling.
+ *
+ * @throws cudf::logic_error if `agg` is not a `udf_type::CUDA` or `udf_type::PTX` aggregation
+ *
+ * @param[in] input_type The type of the input columns `agg` will be applied to
+ * @param[in] agg The rolling window UDF aggregation
+ *
+ * @returns A future that becomes ready once the kernels are compiled, and rethrows compilation
+ *          errors from `get()`
+ */
+std::future<void> precompile_rolling_window_udf(data_type input_type,
+                                                std::unique_ptr<aggregation> const& agg);
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup reshape_transpose
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Converts a table into rows in a row-major layout.
+ *
+ * Each row starts with a fixed width section, in which every column has a slot aligned to its
+ * size, in column order:
+ * - a fixed width value occupies `size_of(type)` bytes
+ * - a string occupies 8 bytes, aligned to 4: the `int32_t` offset of its characters from the
+ *   start of the row, followed by its `int32_t` length in bytes
+ *
+ * The slots are followed by the validity bytes, in which bit `i % 8` of byte `i / 8` is set if
+ * column `i` is valid, and the section is padded to a multiple of 8 bytes. The characters of the
+ * strings of the row follow in column order, and the row is padded to a multiple of 8 bytes
+ * again. The values of null elements are unspecified, and null strings are empty.
+ *
+ * Tables with only fixed width columns thus have rows of the same size, like Spark's UnsafeRow
+ * without its null bitset header.
+ *
+ * @code{.pseudo}
+ * input: {INT8 [1, 2], INT32 [3, null]}
+ * rows:  [01 __ __ __ 03 00 00 00 03 00 00 00 00 00 00 00,
+ *         02 __ __ __ __ __ __ __ 01 00 00 00 00 00 00 00]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `input` has no columns
+ * @throw cudf::logic_error if a column is neither fixed width nor STRING
+ *
+ * @param input The table to convert
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return LIST<INT8> columns holding one row of `input` per list. Consecutive rows are split
+ * between columns so that each holds fewer than 2^31 bytes.
+ */
+std::vector<std::unique_ptr<column>> convert_to_rows(
+  table_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Converts rows in the layout of `convert_to_rows` back into a table.
+ *
+ * @throw cudf::logic_error if `input` is not a list of INT8 or UINT8
+ * @throw cudf::logic_error if a type of `schema` is neither fixed width nor STRING
+ *
+ * @param input One of the columns returned by `convert_to_rows`
+ * @param schema The types of the columns of the rows
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The table of the rows of `input`
+ */
+std::unique_ptr<table> convert_from_rows(
+  lists_column_view const& input,
+  std::vector<data_type> const& schema,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
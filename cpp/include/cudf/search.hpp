@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -73,6 +73,32 @@ std::unique_ptr<column> lower_bound(
   std::vector<null_order> const& null_precedence,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Find the first indices in a sorted table where values should be inserted to maintain
+ * order, with a hint of whether the values are sorted.
+ *
+ * When @p values_sorted is `sorted::YES`, the values are sorted in the order of @p t given by
+ * @p column_order and @p null_precedence, and the search may co-iterate them with @p t in
+ * O(t.num_rows() + values.num_rows()) instead of searching each of them separately. The result is
+ * undefined if the values are not sorted.
+ *
+ * @param t               Table to search
+ * @param values          Find insert locations for these values
+ * @param column_order    Vector of column sort order
+ * @param null_precedence Vector of null_precedence enums values
+ * @param values_sorted   Whether @p values is sorted in the order of @p t
+ * @param mr              Device memory resource used to allocate the returned column's device
+ * memory
+ * @return A non-nullable column of cudf::size_type elements containing the insertion points.
+ */
+std::unique_ptr<column> lower_bound(
+  table_view const& t,
+  table_view const& values,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  sorted values_sorted,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Find largest indices in a sorted table where values should be
  *  inserted to maintain order
@@ -115,6 +141,32 @@ std::unique_ptr<column> upper_bound(
   std::vector<null_order> const& null_precedence,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Find the last indices in a sorted table where values should be inserted to maintain
+ * order, with a hint of whether the values are sorted.
+ *
+ * When @p values_sorted is `sorted::YES`, the values are sorted in the order of @p t given by
+ * @p column_order and @p null_precedence, and the search may co-iterate them with @p t in
+ * O(t.num_rows() + values.num_rows()) instead of searching each of them separately. The result is
+ * undefined if the values are not sorted.
+ *
+ * @param t               Table to search
+ * @param values          Find insert locations for these values
+ * @param column_order    Vector of column sort order
+ * @param null_precedence Vector of null_precedence enums values
+ * @param values_sorted   Whether @p values is sorted in the order of @p t
+ * @param mr              Device memory resource used to allocate the returned column's device
+ * memory
+ * @return A non-nullable column of cudf::size_type elements containing the insertion points.
+ */
+std::unique_ptr<column> upper_bound(
+  table_view const& t,
+  table_view const& values,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  sorted values_sorted,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Find if the `value` is present in the `col`
  *
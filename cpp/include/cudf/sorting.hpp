@@ -18,7 +18,9 @@
 
 #include <cudf/types.hpp>
 
+#include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace cudf {
@@ -241,5 +243,113 @@ std::unique_ptr<table> segmented_sort_by_key(
   std::vector<null_order> const& null_precedence = {},
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the row indices of the first `k` rows of `keys` in a lexicographical sorted
+ * order, without sorting all rows.
+ *
+ * The result equals the first `min(k, keys.num_rows())` indices of `stable_sorted_order`. When
+ * the keys are fixed-width and fit in 64 bits, a radix select finds the `k`-th row in a few passes
+ * over the keys, and only the `k` selected rows are sorted.
+ *
+ * @throws cudf::logic_error if `k` is negative.
+ *
+ * @param keys The table that determines the ordering
+ * @param k The number of rows to select
+ * @param column_order The desired sort order for each column. Size must be
+ * equal to `keys.num_columns()` or empty. If empty, all columns will be sorted
+ * in ascending order.
+ * @param null_precedence The desired order of null compared to other elements
+ * for each column.  Size must be equal to `keys.num_columns()` or empty.
+ * If empty, all columns will be sorted in `null_order::BEFORE`.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A non-nullable column of `size_type` elements containing the row indices of the first
+ * `k` rows of `keys` if it were sorted
+ */
+std::unique_ptr<column> top_k(
+  table_view const& keys,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes the row indices of the first `k` rows of each segment of `keys` in a
+ * lexicographical sorted order.
+ *
+ * @code{.pseudo}
+ * keys            = [5, 1, 4, 2, 9, 8, 3]
+ * segment_offsets = [0, 3, 4, 7]
+ * k               = 2
+ *
+ * result          = [[1, 2], [3], [6, 5]]
+ * @endcode
+ *
+ * @throws cudf::logic_error if `segment_offsets` is not a `size_type` column.
+ * @throws cudf::logic_error if `k` is negative.
+ *
+ * @param keys The table that determines the ordering of the rows of each segment
+ * @param segment_offsets The offsets of the segments, starting with 0 and ending with the number
+ * of rows of `keys`
+ * @param k The number of rows to select from each segment
+ * @param column_order The desired sort order for each column. Size must be
+ * equal to `keys.num_columns()` or empty. If empty, all columns will be sorted
+ * in ascending order.
+ * @param null_precedence The desired order of null compared to other elements
+ * for each column.  Size must be equal to `keys.num_columns()` or empty.
+ * If empty, all columns will be sorted in `null_order::BEFORE`.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Lists column of the row indices of the first `min(k, size)` rows of each segment
+ */
+std::unique_ptr<column> segmented_top_k(
+  table_view const& keys,
+  column_view const& segment_offsets,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Sorts a sequence of tables that may not fit in device memory at once.
+ *
+ * Each input chunk is sorted on the device into a run, which is spilled to host memory, or to
+ * files in `spill_directory` when it is not empty. The runs are then merged in rounds: every
+ * round loads at most one block of `block_rows` rows per run, and merges the rows that are not
+ * greater than the smallest last row of the loaded blocks whose run has more blocks. The rows
+ * of each round are passed to `write_chunk` as one sorted output chunk, so that at most one
+ * block per run and one output chunk reside in device memory at once.
+ *
+ * @code{.pseudo}
+ * chunks     = [{3, 1, 5}, {4, 2, 6}, {0, 7}]
+ * key_cols   = {0}
+ * block_rows = 2
+ *
+ * runs       = [{1, 3 | 5}, {2, 4 | 6}, {0, 7}]
+ * output     = [{0, 1, 2, 3}, {4}, {5, 6, 7}]
+ * @endcode
+ *
+ * @throws cudf::logic_error if the input chunks have different column types
+ * @throws cudf::logic_error if `key_cols` is empty or its size does not match `column_order`
+ * @throws cudf::logic_error if `block_rows` is not positive
+ * @throws cudf::logic_error if a spill file cannot be written or read
+ *
+ * @param read_chunk Returns the next input chunk, or `nullptr` once the input is exhausted
+ * @param write_chunk Receives the sorted output chunks in order
+ * @param key_cols Indices of the key columns to sort by
+ * @param column_order Sort order of each key column
+ * @param null_precedence Order of the nulls of each key column, `null_order::BEFORE` if empty
+ * @param block_rows Number of rows of the blocks in which the runs are spilled and merged
+ * @param spill_directory Directory of the spill files; runs are kept in host memory if empty
+ * @param mr Device memory resource used to allocate the output chunks' device memory
+ */
+void external_sort(
+  std::function<std::unique_ptr<table>()> const& read_chunk,
+  std::function<void(std::unique_ptr<table>&&)> const& write_chunk,
+  std::vector<size_type> const& key_cols,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence = {},
+  size_type block_rows                           = 1 << 20,
+  std::string const& spill_directory             = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,12 +16,17 @@
 
 #pragma once
 
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/types.hpp>
 
 #include <memory>
 #include <vector>
 
 namespace cudf {
+namespace ast {
+class expression;
+}  // namespace ast
+
 /**
  * @addtogroup reorder_compact
  * @{
@@ -204,13 +209,70 @@ std::unique_ptr<table> apply_boolean_mask(
   column_view const& boolean_mask,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the indices of the elements of `boolean_mask` that are non-null and `true`.
+ *
+ * The result is the gather map of `apply_boolean_mask`: gathering the rows of a table with it
+ * gives the same table as applying `boolean_mask` to the table. This allows to defer a filter and
+ * combine it with a later gather.
+ *
+ * @throws cudf::logic_error if `boolean_mask` is not `type_id::BOOL8` type.
+ *
+ * @param[in] boolean_mask A nullable column_view of type type_id::BOOL8 used as a mask
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @return INT32 column of the indices of the rows passing the filter defined by @p boolean_mask,
+ * in increasing order
+ */
+std::unique_ptr<column> boolean_mask_gather_map(
+  column_view const& boolean_mask,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Filters `input` with the rows for which the boolean expression `predicate` is non-null
+ * and `true`.
+ *
+ * The result is the same as `apply_boolean_mask(input, *ast::compute_column(input, predicate))`,
+ * but the predicate is evaluated inside the stream compaction kernels, so the boolean column is
+ * never materialized. This operation is stable: the input order is preserved.
+ *
+ * @throws cudf::logic_error if `predicate` does not produce a `type_id::BOOL8` value.
+ *
+ * @param[in] input The input table_view to filter
+ * @param[in] predicate A boolean expression on the columns of `input`
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return Table containing copy of all rows of @p input passing @p predicate
+ */
+std::unique_ptr<table> filter(
+  table_view const& input,
+  ast::expression const& predicate,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the indices of the rows of `input` for which the boolean expression `predicate`
+ * is non-null and `true`.
+ *
+ * The result is the gather map of `filter`, computed without materializing the boolean column.
+ *
+ * @throws cudf::logic_error if `predicate` does not produce a `type_id::BOOL8` value.
+ *
+ * @param[in] input The table_view the predicate is evaluated on
+ * @param[in] predicate A boolean expression on the columns of `input`
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ * @return INT32 column of the indices of the rows passing @p predicate, in increasing order
+ */
+std::unique_ptr<column> filter_gather_map(
+  table_view const& input,
+  ast::expression const& predicate,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Choices for drop_duplicates API for retainment of duplicate rows
  */
 enum class duplicate_keep_option {
   KEEP_FIRST = 0,  ///< Keeps first duplicate row and unique rows
   KEEP_LAST,       ///< Keeps last  duplicate row and unique rows
-  KEEP_NONE        ///< Keeps only unique rows are kept
+  KEEP_NONE,       ///< Keeps only unique rows are kept
+  KEEP_ANY         ///< Keeps any one of the duplicate rows and unique rows
 };
 
 /**
@@ -221,6 +283,7 @@ enum class duplicate_keep_option {
  * - KEEP_FIRST: only the first of a sequence of duplicate rows is copied
  * - KEEP_LAST: only the last of a sequence of duplicate rows is copied
  * - KEEP_NONE: no duplicate rows are copied
+ * - KEEP_ANY: same as KEEP_FIRST
  *
  * @throws cudf::logic_error if The `input` row size mismatches with `keys`.
  *
@@ -243,6 +306,42 @@ std::unique_ptr<table> drop_duplicates(
   null_order null_precedence          = null_order::BEFORE,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create a new table without duplicate rows, using a hash set of the `keys` rows
+ *
+ * Unlike `drop_duplicates`, the rows are not sorted. The rows that are kept are copied in the
+ * order of `input`, where the definition of duplicate rows depends on the value of @p keep:
+ * - KEEP_FIRST: only the first row of each set of duplicate rows is copied
+ * - KEEP_LAST: only the last row of each set of duplicate rows is copied
+ * - KEEP_NONE: no duplicate rows are copied
+ * - KEEP_ANY: one row of each set of duplicate rows, whichever is found first, is copied
+ *
+ * @code{.pseudo}
+ * input = [{4, 1, 4, 2, 1, 4}, {"a", "b", "c", "d", "e", "f"}]
+ * keys  = {0}
+ *
+ * distinct(input, keys, KEEP_FIRST) = [{4, 1, 2}, {"a", "b", "d"}]
+ * distinct(input, keys, KEEP_LAST)  = [{2, 1, 4}, {"d", "e", "f"}]
+ * distinct(input, keys, KEEP_NONE)  = [{2}, {"d"}]
+ * @endcode
+ *
+ * @param[in] input       input table_view to copy only distinct rows
+ * @param[in] keys        vector of indices representing key columns from `input`
+ * @param[in] keep        keep first entry, last entry, any entry, or no entries if duplicates found
+ * @param[in] nulls_equal flag to denote nulls are equal if null_equality::EQUAL, nulls are not
+ *                        equal if null_equality::UNEQUAL
+ * @param[in] mr          Device memory resource used to allocate the returned table's device
+ * memory
+ *
+ * @return Table with distinct rows as per specified `keep`, in the order of `input`.
+ */
+std::unique_ptr<table> distinct(
+  table_view const& input,
+  std::vector<size_type> const& keys,
+  duplicate_keep_option keep          = duplicate_keep_option::KEEP_ANY,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Count the unique elements in the column_view
  *
@@ -276,5 +375,45 @@ cudf::size_type distinct_count(column_view const& input,
 cudf::size_type distinct_count(table_view const& input,
                                null_equality nulls_equal = null_equality::EQUAL);
 
+/**
+ * @brief Estimates the number of unique elements in the column_view with a HyperLogLog sketch.
+ *
+ * The sketch has the fewest registers whose relative standard error, `1.04 / sqrt(registers)`,
+ * is at most `max_relative_error`, within the sketch sizes of `make_hll_sketch_aggregation`.
+ * Unlike `distinct_count`, the elements are neither sorted nor inserted into a hash set, and the
+ * memory used does not depend on the number of unique elements.
+ *
+ * `NaN` values are counted as one unique element. If `null_handling` is null_policy::INCLUDE,
+ * nulls are counted as one more unique element.
+ *
+ * @throws cudf::logic_error if `max_relative_error` is not positive
+ *
+ * @param[in] input The column_view whose unique elements will be counted.
+ * @param[in] max_relative_error Upper bound of the relative standard error of the estimate
+ * @param[in] null_handling flag to include or ignore `null` while counting
+ *
+ * @return estimated number of unique elements
+ */
+cudf::size_type approx_distinct_count(column_view const& input,
+                                      double max_relative_error,
+                                      null_policy null_handling = null_policy::EXCLUDE);
+
+/**
+ * @brief Estimates the number of distinct elements summarized by each HyperLogLog sketch.
+ *
+ * The sketches are produced by `HLL_SKETCH` aggregations, possibly merged by `MERGE_HLL_SKETCH`
+ * aggregations. The estimate of a null sketch is null.
+ *
+ * @throws cudf::logic_error if `sketches` is not a LIST<UINT8> column
+ *
+ * @param[in] sketches The HyperLogLog sketches to estimate
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @return INT64 column of the estimated number of distinct elements of each sketch
+ */
+std::unique_ptr<column> approx_distinct_count(
+  lists_column_view const& sketches,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */
 }  // namespace cudf
@@ -53,9 +53,10 @@ std::unique_ptr<column> to_floats(
  *
  * Any null entries will result in corresponding null entries in the output column.
  *
- * For each float, a string is created in base-10 decimal.
+ * For each float, a string is created in base-10 decimal with the fewest digits that
+ * convert back to the same float value.
  * Negative numbers will include a '-' prefix.
- * Numbers producing more than 10 significant digits will produce a string that
+ * Numbers below 1e-4 or from 1e9 will produce a string that
  * includes scientific notation (e.g. "-1.78e+15").
  *
  * @throw cudf::logic_error if floats column is not float type.
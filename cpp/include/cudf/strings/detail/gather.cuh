@@ -18,8 +18,11 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -30,16 +33,118 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
 
+#include <cstdint>
+
 namespace cudf {
 namespace strings {
 namespace detail {
 
+// Average bytes per output row from which `gather_chars` copies the strings with warps
+constexpr size_type GATHER_CHARS_WARP_BYTES_PER_ROW_THRESHOLD = 64;
+
+// Bytes of the output chars copied by each warp of `gather_chars_warp_kernel`
+constexpr size_type GATHER_CHARS_BYTES_PER_WARP = 4096;
+
+/**
+ * @brief Loads the 16 bytes at `ptr`, which may have any alignment.
+ *
+ * Only the aligned 4-byte words that overlap the 16 bytes are read, and the bytes are shifted
+ * into place with funnel shifts.
+ */
+__device__ inline uint4 load_uint4(char const* ptr)
+{
+  auto const offset       = reinterpret_cast<std::uintptr_t>(ptr) % 4;
+  auto const aligned_ptr  = reinterpret_cast<uint32_t const*>(ptr - offset);
+  auto const shift        = static_cast<uint32_t>(offset * 8);
+  uint4 regs              = {aligned_ptr[0], aligned_ptr[1], aligned_ptr[2], aligned_ptr[3]};
+  uint32_t const next_reg = shift != 0 ? aligned_ptr[4] : 0;
+  regs.x                  = __funnelshift_r(regs.x, regs.y, shift);
+  regs.y                  = __funnelshift_r(regs.y, regs.z, shift);
+  regs.z                  = __funnelshift_r(regs.z, regs.w, shift);
+  regs.w                  = __funnelshift_r(regs.w, next_reg, shift);
+  return regs;
+}
+
+/**
+ * @brief Copies `size` bytes from `in` to `out` with the threads of a warp.
+ *
+ * The 16-byte aligned part of `out` is written with vectorized stores.
+ */
+__device__ inline void copy_chars_warp(char* out, char const* in, size_type size, size_type lane)
+{
+  constexpr size_type vector_size = sizeof(uint4);
+  auto const misalignment =
+    static_cast<size_type>(reinterpret_cast<std::uintptr_t>(out) % vector_size);
+  auto const head        = min(size, (vector_size - misalignment) % vector_size);
+  auto const num_vectors = (size - head) / vector_size;
+  auto const tail        = head + num_vectors * vector_size;
+  for (auto i = lane; i < head; i += cudf::detail::warp_size) {
+    out[i] = in[i];
+  }
+  auto const out_vectors = reinterpret_cast<uint4*>(out + head);
+  for (auto v = lane; v < num_vectors; v += cudf::detail::warp_size) {
+    out_vectors[v] = load_uint4(in + head + v * vector_size);
+  }
+  for (auto i = tail + lane; i < size; i += cudf::detail::warp_size) {
+    out[i] = in[i];
+  }
+}
+
+/**
+ * @brief Gathers the characters of the output strings, with each warp copying the bytes of a
+ * range of `GATHER_CHARS_BYTES_PER_WARP` output bytes.
+ *
+ * The warps find the first row of their range in `offsets` and copy the strings that overlap
+ * the range, so long strings are split between warps and the work is balanced by bytes rather
+ * than by rows.
+ */
+template <typename StringIterator, typename MapIterator>
+__global__ void gather_chars_warp_kernel(StringIterator strings_begin,
+                                         MapIterator map_begin,
+                                         cudf::device_span<int32_t const> const offsets,
+                                         char* out_chars,
+                                         size_type chars_bytes)
+{
+  auto const tid      = static_cast<int64_t>(threadIdx.x) + blockIdx.x * blockDim.x;
+  auto const lane     = static_cast<size_type>(tid % cudf::detail::warp_size);
+  auto const num_rows = static_cast<size_type>(offsets.size() - 1);
+  auto const first    = (tid / cudf::detail::warp_size) * GATHER_CHARS_BYTES_PER_WARP;
+  if (first >= chars_bytes) { return; }
+  auto const begin = static_cast<size_type>(first);
+  auto const end   = static_cast<size_type>(
+    min(first + GATHER_CHARS_BYTES_PER_WARP, static_cast<int64_t>(chars_bytes)));
+
+  // the last row starting at or before `begin` is the non-empty row that contains it
+  auto const last_row_at = [offsets](size_type from_row, size_type position) {
+    return static_cast<size_type>(
+      thrust::distance(
+        offsets.begin(),
+        thrust::upper_bound(thrust::seq, offsets.begin() + from_row, offsets.end(), position)) -
+      1);
+  };
+  auto row = last_row_at(0, begin);
+  while (offsets[row] < end) {
+    auto const row_begin = offsets[row];
+    auto const out_begin = max(row_begin, begin);
+    auto const out_end   = min(offsets[row + 1], end);
+    auto const d_str     = strings_begin[map_begin[row]];
+    copy_chars_warp(
+      out_chars + out_begin, d_str.data() + (out_begin - row_begin), out_end - out_begin, lane);
+    ++row;
+    // skip a run of empty rows, e.g. nulls, without reading their strings
+    if (row < num_rows and offsets[row + 1] == offsets[row]) {
+      row = last_row_at(row, offsets[row]);
+    }
+  }
+}
+
 /**
  * @brief Returns a new chars column using the specified indices to select
  * strings from the input iterator.
  *
- * This uses a character-parallel gather CUDA kernel that performs very
- * well on a strings column with long strings (e.g. average > 64 bytes).
+ * Short strings are copied with a character-parallel gather CUDA kernel. Long strings
+ * (average >= `GATHER_CHARS_WARP_BYTES_PER_ROW_THRESHOLD` bytes) are copied by warps that
+ * each write an equal range of output bytes with vectorized stores.
  *
  * @tparam StringIterator Iterator should produce `string_view` objects.
  * @tparam MapIterator Iterator for retrieving integer indices of the `StringIterator`.
@@ -68,6 +173,17 @@ std::unique_ptr<cudf::column> gather_chars(StringIterator strings_begin,
   auto chars_column  = create_chars_child_column(output_count, chars_bytes, stream, mr);
   auto const d_chars = chars_column->mutable_view().template data<char>();
 
+  if (chars_bytes / output_count >= GATHER_CHARS_WARP_BYTES_PER_ROW_THRESHOLD) {
+    constexpr int block_size            = 256;
+    constexpr size_type bytes_per_block = GATHER_CHARS_BYTES_PER_WARP *
+                                          (block_size / cudf::detail::warp_size);
+    auto const num_blocks = cudf::util::div_rounding_up_safe(chars_bytes, bytes_per_block);
+    gather_chars_warp_kernel<<<num_blocks, block_size, 0, stream.value()>>>(
+      strings_begin, map_begin, offsets, d_chars, chars_bytes);
+    CHECK_CUDA(stream.value());
+    return chars_column;
+  }
+
   auto gather_chars_fn = [strings_begin, map_begin, offsets] __device__(size_type out_idx) -> char {
     auto const out_row =
       thrust::prev(thrust::upper_bound(thrust::seq, offsets.begin(), offsets.end(), out_idx));
@@ -20,6 +20,8 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -35,6 +37,18 @@ std::unique_ptr<cudf::column> get_json_object(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::strings::get_json_object(cudf::strings_column_view const&,
+ * std::vector<cudf::string_scalar> const&, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::vector<std::unique_ptr<cudf::column>> get_json_object(
+  cudf::strings_column_view const& col,
+  std::vector<cudf::string_scalar> const& json_paths,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
@@ -23,10 +23,19 @@
 #include <cudf/strings/string_view.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/scan.h>
+#include <thrust/transform_reduce.h>
+
+#include <cub/block/block_scan.cuh>
+
+#include <cstddef>
 
 #include <mutex>
 #include <unordered_map>
@@ -281,6 +290,117 @@ make_strings_children_with_null_mask(
                          null_count);
 }
 
+/**
+ * @brief Kernel writing each string into its block's slot of an over-allocated buffer.
+ *
+ * Each block reserves the sum of the upper bounds of its strings with a single atomic bump of
+ * `d_cursor`, and each string is written at its prefix of that reservation.
+ */
+template <int block_size, typename BoundFunction, typename WriteFunction>
+__global__ void write_strings_single_pass_kernel(BoundFunction bound_fn,
+                                                 WriteFunction write_fn,
+                                                 size_type strings_count,
+                                                 char* d_buffer,
+                                                 unsigned long long* d_cursor,
+                                                 std::size_t* d_positions,
+                                                 size_type* d_sizes)
+{
+  using BlockScan = cub::BlockScan<unsigned long long, block_size>;
+  __shared__ typename BlockScan::TempStorage temp_storage;
+  __shared__ unsigned long long block_position;
+
+  auto const idx   = static_cast<size_type>(blockIdx.x * block_size + threadIdx.x);
+  auto const bound = static_cast<unsigned long long>(idx < strings_count ? bound_fn(idx) : 0);
+  unsigned long long position{};
+  unsigned long long block_bytes{};
+  BlockScan(temp_storage).ExclusiveSum(bound, position, block_bytes);
+  if (threadIdx.x == 0) { block_position = atomicAdd(d_cursor, block_bytes); }
+  __syncthreads();
+
+  if (idx < strings_count) {
+    position += block_position;
+    d_positions[idx] = position;
+    d_sizes[idx]     = write_fn(idx, d_buffer + position);
+  }
+}
+
+/**
+ * @brief Creates child offsets and chars columns with a single call of the write function per
+ * string.
+ *
+ * Each string is written into a temporary buffer sized by the sum of conservative upper bounds
+ * of the output sizes. The strings are then compacted into the chars column. This avoids running
+ * expensive functions once for the sizes and again for the chars, in exchange for the temporary
+ * memory and the copy.
+ *
+ * @tparam BoundFunction Function must accept an index and return an upper bound of the number of
+ *         bytes written for that string.
+ * @tparam WriteFunction Function must accept an index and an output pointer, write the string
+ *         there and return the number of bytes written. Null strings should write 0 bytes.
+ *
+ * @param bound_fn Called once per string to size the temporary buffer.
+ * @param write_fn Called once per string to write the output.
+ * @param strings_count Number of strings.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned columns' device memory.
+ * @return offsets child column and chars child column for a strings column
+ */
+template <typename BoundFunction, typename WriteFunction>
+auto make_strings_children_single_pass(
+  BoundFunction bound_fn,
+  WriteFunction write_fn,
+  size_type strings_count,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  auto const buffer_bytes = thrust::transform_reduce(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(strings_count),
+    [bound_fn] __device__(size_type idx) { return static_cast<std::size_t>(bound_fn(idx)); },
+    std::size_t{0},
+    thrust::plus<std::size_t>());
+
+  rmm::device_uvector<char> buffer(buffer_bytes, stream);
+  rmm::device_scalar<unsigned long long> cursor(0, stream);
+  rmm::device_uvector<std::size_t> positions(strings_count, stream);
+  rmm::device_uvector<size_type> sizes(strings_count, stream);
+
+  constexpr int block_size = 256;
+  auto const grid_size     = (strings_count + block_size - 1) / block_size;
+  if (grid_size > 0) {
+    write_strings_single_pass_kernel<block_size>
+      <<<grid_size, block_size, 0, stream.value()>>>(bound_fn,
+                                                      write_fn,
+                                                      strings_count,
+                                                      buffer.data(),
+                                                      cursor.data(),
+                                                      positions.data(),
+                                                      sizes.data());
+  }
+
+  // compact the strings into the chars column
+  auto offsets_column = make_offsets_child_column(sizes.begin(), sizes.end(), stream, mr);
+  auto d_offsets      = offsets_column->view().template data<int32_t>();
+  auto const bytes =
+    cudf::detail::get_value<int32_t>(offsets_column->view(), strings_count, stream);
+  auto chars_column = create_chars_child_column(strings_count, bytes, stream, mr);
+  auto d_chars      = chars_column->mutable_view().template data<char>();
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    strings_count,
+    [d_buffer    = buffer.data(),
+     d_positions = positions.data(),
+     d_sizes     = sizes.data(),
+     d_offsets,
+     d_chars] __device__(size_type idx) {
+      memcpy(d_chars + d_offsets[idx], d_buffer + d_positions[idx], d_sizes[idx]);
+    });
+
+  return std::make_pair(std::move(offsets_column), std::move(chars_column));
+}
+
 // This template is a thin wrapper around per-context singleton objects.
 // It maintains a single object for each CUDA context.
 template <typename TableType>
@@ -90,6 +90,17 @@ std::unique_ptr<cudf::column> child_chars_from_string_vector(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns true if the strings in the view of a column contain only ASCII characters,
+ * each of which is encoded in a single byte below 0x80.
+ *
+ * @param strings Strings column instance.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return true if no byte of the strings has its high bit set
+ */
+bool is_ascii(strings_column_view const& strings,
+              rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
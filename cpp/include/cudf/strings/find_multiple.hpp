@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 
 namespace cudf {
 namespace strings {
@@ -42,6 +43,8 @@ namespace strings {
  *           -1,-1, 1 ]  // for "def": "a" and "b" not found, "e" at  pos 1
  * @endcode
  *
+ * All the targets are searched in one pass over each string with an Aho-Corasick automaton.
+ *
  * @throw cudf::logic_error targets is empty or contains nulls
  *
  * @param strings Strings instance for this operation.
@@ -54,6 +57,64 @@ std::unique_ptr<column> find_multiple(
   strings_column_view const& targets,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a table of boolean columns, one per target, telling whether each string
+ * contains the target.
+ *
+ * All the targets are searched in one pass over each string with an Aho-Corasick automaton, so
+ * this is much faster than calling `contains` once per target when there are many targets.
+ * Any null string entry results in a null entry in every output column.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["abc","def"]
+ * t = ["a","c","e"]
+ * r = contains_multiple(s,t)
+ * r is now [[true, false],   // "a"
+ *           [true, false],   // "c"
+ *           [false, true]]   // "e"
+ * @endcode
+ *
+ * @throw cudf::logic_error targets is empty or contains nulls
+ *
+ * @param strings Strings instance for this operation.
+ * @param targets Strings to search for in each string.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return New table with a boolean column per target.
+ */
+std::unique_ptr<table> contains_multiple(
+  strings_column_view const& strings,
+  strings_column_view const& targets,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a column with the index of the first target, in the order of `targets`, that
+ * each string contains.
+ *
+ * All the targets are searched in one pass over each string with an Aho-Corasick automaton.
+ * The index is -1 for the strings containing no target. Any null string entry results in a null
+ * entry in the output column.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["abc","def","xyz"]
+ * t = ["e","c","a"]
+ * r = find_first_target(s,t)
+ * r is now [1,0,-1]
+ * @endcode
+ *
+ * @throw cudf::logic_error targets is empty or contains nulls
+ *
+ * @param strings Strings instance for this operation.
+ * @param targets Strings to search for in each string.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New integer column with target indices.
+ */
+std::unique_ptr<column> find_first_target(
+  strings_column_view const& strings,
+  strings_column_view const& targets,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
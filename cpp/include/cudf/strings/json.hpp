@@ -17,6 +17,8 @@
 
 #include <cudf/strings/strings_column_view.hpp>
 
+#include <vector>
+
 namespace cudf {
 namespace strings {
 
@@ -45,6 +47,26 @@ std::unique_ptr<cudf::column> get_json_object(
   cudf::string_scalar const& json_path,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Apply several JSONPath strings to all rows in an input strings column.
+ *
+ * Returns the same columns as calling `get_json_object` with each of the JSONPath strings,
+ * while parsing each row only once for all the paths starting with a named field such as
+ * `$.name`: the top-level fields of a row are scanned once and each such path continues from the
+ * field it names.
+ *
+ * @throw cudf::logic_error if any JSONPath string is too complex
+ *
+ * @param col The input strings column. Each row must contain a valid json string
+ * @param json_paths The JSONPath strings to be applied to each row
+ * @param mr Resource for allocating device memory.
+ * @return New strings columns containing the retrieved json object strings, one per JSONPath
+ */
+std::vector<std::unique_ptr<cudf::column>> get_json_object(
+  cudf::strings_column_view const& col,
+  std::vector<cudf::string_scalar> const& json_paths,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
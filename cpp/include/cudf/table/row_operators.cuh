@@ -19,15 +19,20 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/utilities/assert.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/lists/list_view.cuh>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <thrust/equal.h>
+#include <thrust/optional.h>
+#include <thrust/pair.h>
 #include <thrust/swap.h>
 #include <thrust/transform_reduce.h>
 
+#include <algorithm>
 #include <limits>
 
 namespace cudf {
@@ -157,6 +162,141 @@ __device__ bool equality_compare(Element const lhs, Element const rhs)
   return lhs == rhs;
 }
 
+/**
+ * @brief The leading bytes and the size of a string, cached so that most pairs of strings can be
+ * ordered without reading their characters.
+ */
+struct string_prefix {
+  uint64_t bytes;  ///< First 8 bytes as a big-endian unsigned integer padded with zeros
+  size_type size;  ///< Number of bytes in the string
+};
+
+/**
+ * @brief Returns the prefix of a string.
+ */
+__device__ inline string_prefix make_string_prefix(string_view const& d_str)
+{
+  auto const bytes = reinterpret_cast<unsigned char const*>(d_str.data());
+  uint64_t prefix  = 0;
+  for (size_type i = 0; i < static_cast<size_type>(sizeof(uint64_t)); ++i) {
+    prefix = (prefix << 8) | (i < d_str.size_bytes() ? bytes[i] : 0);
+  }
+  return string_prefix{prefix, d_str.size_bytes()};
+}
+
+/**
+ * @brief Orders two strings by their prefixes.
+ *
+ * @return The ordering of the strings, or an empty optional if their prefixes are equal and both
+ * strings are longer than 8 bytes, in which case the bytes after the first 8 must be compared.
+ */
+__device__ inline thrust::optional<weak_ordering> compare_string_prefixes(string_prefix lhs,
+                                                                          string_prefix rhs)
+{
+  if (lhs.bytes != rhs.bytes) {
+    return lhs.bytes < rhs.bytes ? weak_ordering::LESS : weak_ordering::GREATER;
+  }
+  // a string of up to 8 bytes is a prefix of any string with the same first 8 bytes
+  if (lhs.size <= static_cast<size_type>(sizeof(uint64_t)) or
+      rhs.size <= static_cast<size_type>(sizeof(uint64_t))) {
+    return detail::compare_elements(lhs.size, rhs.size);
+  }
+  return thrust::nullopt;
+}
+
+namespace detail {
+/**
+ * @brief Returns the range of child rows of a row of a lists column.
+ *
+ * @param lists The lists column
+ * @param row_index The index of the row, not including the offset of `lists`
+ * @return The first and one past the last child rows of the list
+ */
+__device__ inline thrust::pair<size_type, size_type> list_child_range(
+  column_device_view const& lists, size_type row_index)
+{
+  auto const offsets = lists.child(lists_column_view::offsets_column_index);
+  auto const offset  = lists.offset() + row_index;
+  return {offsets.element<size_type>(offset), offsets.element<size_type>(offset + 1)};
+}
+
+/**
+ * @brief Compares the elements of two lists for equality, dispatched once per pair of lists on
+ * the type of their elements.
+ */
+struct list_elements_equality_fn {
+  column_device_view lhs;
+  column_device_view rhs;
+  bool nulls_are_equal;
+
+  template <typename Element,
+            std::enable_if_t<cudf::is_equality_comparable<Element, Element>()>* = nullptr>
+  __device__ bool operator()(size_type lhs_begin, size_type rhs_begin, size_type size) const
+  {
+    for (size_type i = 0; i < size; ++i) {
+      bool const lhs_is_null{lhs.is_null(lhs_begin + i)};
+      bool const rhs_is_null{rhs.is_null(rhs_begin + i)};
+      if (lhs_is_null or rhs_is_null) {
+        if (lhs_is_null != rhs_is_null or not nulls_are_equal) { return false; }
+      } else if (not equality_compare(lhs.element<Element>(lhs_begin + i),
+                                      rhs.element<Element>(rhs_begin + i))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template <typename Element,
+            std::enable_if_t<not cudf::is_equality_comparable<Element, Element>()>* = nullptr>
+  __device__ bool operator()(size_type, size_type, size_type) const
+  {
+    cudf_assert(false && "Attempted to compare lists of uncomparable or nested types.");
+    return false;
+  }
+};
+
+/**
+ * @brief Orders the first `size` elements of two lists, dispatched once per pair of lists on the
+ * type of their elements.
+ */
+struct list_elements_relational_fn {
+  column_device_view lhs;
+  column_device_view rhs;
+  null_order null_precedence;
+
+  template <typename Element,
+            std::enable_if_t<cudf::is_relationally_comparable<Element, Element>()>* = nullptr>
+  __device__ weak_ordering operator()(size_type lhs_begin,
+                                      size_type rhs_begin,
+                                      size_type size) const
+  {
+    for (size_type i = 0; i < size; ++i) {
+      bool const lhs_is_null{lhs.is_null(lhs_begin + i)};
+      bool const rhs_is_null{rhs.is_null(rhs_begin + i)};
+      auto const state = (lhs_is_null or rhs_is_null)
+                           ? null_compare(lhs_is_null, rhs_is_null, null_precedence)
+                           : relational_compare(lhs.element<Element>(lhs_begin + i),
+                                                rhs.element<Element>(rhs_begin + i));
+      if (state != weak_ordering::EQUIVALENT) { return state; }
+    }
+    return weak_ordering::EQUIVALENT;
+  }
+
+  template <typename Element,
+            std::enable_if_t<not cudf::is_relationally_comparable<Element, Element>()>* = nullptr>
+  __device__ weak_ordering operator()(size_type, size_type, size_type) const
+  {
+    cudf_assert(false && "Attempted to compare lists of uncomparable or nested types.");
+    return weak_ordering::LESS;
+  }
+};
+
+template <template <typename> class hash_function>
+struct list_elements_hasher_fn;
+template <template <typename> class hash_function>
+struct list_elements_hasher_with_seed_fn;
+}  // namespace detail
+
 /**
  * @brief Performs an equality comparison between two elements in two columns.
  *
@@ -208,8 +348,47 @@ class element_equality_comparator {
                             rhs.element<Element>(rhs_element_index));
   }
 
+  /**
+   * @brief Compares the specified lists for equality, element by element.
+   *
+   * Lists are equal if they have the same size and their elements are equal. Lists of nested
+   * types are not supported.
+   *
+   * @param lhs_element_index The index of the first list
+   * @param rhs_element_index The index of the second list
+   */
+  template <typename Element, std::enable_if_t<std::is_same<Element, list_view>::value>* = nullptr>
+  __device__ bool operator()(size_type lhs_element_index, size_type rhs_element_index) const
+    noexcept
+  {
+    if (has_nulls) {
+      bool const lhs_is_null{lhs.is_null(lhs_element_index)};
+      bool const rhs_is_null{rhs.is_null(rhs_element_index)};
+      if (lhs_is_null and rhs_is_null) {
+        return nulls_are_equal;
+      } else if (lhs_is_null != rhs_is_null) {
+        return false;
+      }
+    }
+
+    auto const lhs_range = detail::list_child_range(lhs, lhs_element_index);
+    auto const rhs_range = detail::list_child_range(rhs, rhs_element_index);
+    auto const size      = lhs_range.second - lhs_range.first;
+    if (size != rhs_range.second - rhs_range.first) { return false; }
+
+    auto const lhs_child = lhs.child(lists_column_view::child_column_index);
+    auto const rhs_child = rhs.child(lists_column_view::child_column_index);
+    return cudf::type_dispatcher(
+      lhs_child.type(),
+      detail::list_elements_equality_fn{lhs_child, rhs_child, nulls_are_equal},
+      lhs_range.first,
+      rhs_range.first,
+      size);
+  }
+
   template <typename Element,
-            std::enable_if_t<not cudf::is_equality_comparable<Element, Element>()>* = nullptr>
+            std::enable_if_t<not cudf::is_equality_comparable<Element, Element>() and
+                             not std::is_same<Element, list_view>::value>* = nullptr>
   __device__ bool operator()(size_type lhs_element_index, size_type rhs_element_index)
   {
     cudf_assert(false && "Attempted to compare elements of uncomparable types.");
@@ -275,6 +454,31 @@ class element_relational_comparator {
   {
   }
 
+  /**
+   * @brief Construct type-dispatched function object for performing a
+   * relational comparison between two elements, ordering strings by their
+   * cached prefixes before reading their characters.
+   *
+   * @param lhs The column containing the first element
+   * @param rhs The column containing the second element (may be the same as lhs)
+   * @param null_precedence Indicates how null values are ordered with other
+   * values
+   * @param lhs_prefixes Prefixes of the strings in `lhs`, or nullptr
+   * @param rhs_prefixes Prefixes of the strings in `rhs`, or nullptr
+   */
+  __host__ __device__ element_relational_comparator(column_device_view lhs,
+                                                    column_device_view rhs,
+                                                    null_order null_precedence,
+                                                    string_prefix const* lhs_prefixes,
+                                                    string_prefix const* rhs_prefixes)
+    : lhs{lhs},
+      rhs{rhs},
+      null_precedence{null_precedence},
+      lhs_prefixes{lhs_prefixes},
+      rhs_prefixes{rhs_prefixes}
+  {
+  }
+
   /**
    * @brief Performs a relational comparison between the specified elements
    *
@@ -299,12 +503,69 @@ class element_relational_comparator {
       }
     }
 
+    if constexpr (std::is_same<Element, string_view>::value) {
+      if (lhs_prefixes != nullptr and rhs_prefixes != nullptr) {
+        auto const ordering =
+          compare_string_prefixes(lhs_prefixes[lhs_element_index], rhs_prefixes[rhs_element_index]);
+        if (ordering.has_value()) { return *ordering; }
+        // only the bytes after the equal prefixes are left to compare
+        auto const lhs_str  = lhs.element<string_view>(lhs_element_index);
+        auto const rhs_str  = rhs.element<string_view>(rhs_element_index);
+        auto constexpr skip = static_cast<size_type>(sizeof(uint64_t));
+        return relational_compare(
+          string_view{lhs_str.data() + skip, lhs_str.size_bytes() - skip},
+          string_view{rhs_str.data() + skip, rhs_str.size_bytes() - skip});
+      }
+    }
     return relational_compare(lhs.element<Element>(lhs_element_index),
                               rhs.element<Element>(rhs_element_index));
   }
 
+  /**
+   * @brief Performs a lexicographic comparison between the specified lists.
+   *
+   * The first pair of unequal elements orders the lists, and if one list is a prefix of the other
+   * the shorter list is ordered first. Null elements are ordered by `null_precedence`. Lists of
+   * nested types are not supported.
+   *
+   * @param lhs_element_index The index of the first list
+   * @param rhs_element_index The index of the second list
+   * @return weak_ordering Indicates the relationship between the lists in
+   * the `lhs` and `rhs` columns.
+   */
+  template <typename Element, std::enable_if_t<std::is_same<Element, list_view>::value>* = nullptr>
+  __device__ weak_ordering operator()(size_type lhs_element_index,
+                                      size_type rhs_element_index) const noexcept
+  {
+    if (has_nulls) {
+      bool const lhs_is_null{lhs.is_null(lhs_element_index)};
+      bool const rhs_is_null{rhs.is_null(rhs_element_index)};
+
+      if (lhs_is_null or rhs_is_null) {  // atleast one is null
+        return null_compare(lhs_is_null, rhs_is_null, null_precedence);
+      }
+    }
+
+    auto const lhs_range = detail::list_child_range(lhs, lhs_element_index);
+    auto const rhs_range = detail::list_child_range(rhs, rhs_element_index);
+    auto const lhs_size  = lhs_range.second - lhs_range.first;
+    auto const rhs_size  = rhs_range.second - rhs_range.first;
+
+    auto const lhs_child = lhs.child(lists_column_view::child_column_index);
+    auto const rhs_child = rhs.child(lists_column_view::child_column_index);
+    auto const state     = cudf::type_dispatcher(
+      lhs_child.type(),
+      detail::list_elements_relational_fn{lhs_child, rhs_child, null_precedence},
+      lhs_range.first,
+      rhs_range.first,
+      std::min(lhs_size, rhs_size));
+    return state == weak_ordering::EQUIVALENT ? detail::compare_elements(lhs_size, rhs_size)
+                                              : state;
+  }
+
   template <typename Element,
-            std::enable_if_t<not cudf::is_relationally_comparable<Element, Element>()>* = nullptr>
+            std::enable_if_t<not cudf::is_relationally_comparable<Element, Element>() and
+                             not std::is_same<Element, list_view>::value>* = nullptr>
   __device__ weak_ordering operator()(size_type lhs_element_index, size_type rhs_element_index)
   {
     cudf_assert(false && "Attempted to compare elements of uncomparable types.");
@@ -315,6 +576,8 @@ class element_relational_comparator {
   column_device_view lhs;
   column_device_view rhs;
   null_order null_precedence;
+  string_prefix const* lhs_prefixes{};
+  string_prefix const* rhs_prefixes{};
 };
 
 /**
@@ -330,6 +593,9 @@ class element_relational_comparator {
  * second letter in both words is the first non-equal letter, and `a < b`, thus
  * `aac < abb`.
  *
+ * Elements of LIST columns are themselves ordered lexicographically by their
+ * elements, which must not be nested. STRUCT columns must be flattened first.
+ *
  * @tparam has_nulls Indicates the potential for null values in either row.
  */
 template <bool has_nulls = true>
@@ -351,12 +617,24 @@ class row_lexicographic_comparator {
    * and indicates how null values compare to all other for every column. If
    * it is nullptr, then null precedence would be `null_order::BEFORE` for all
    * columns.
+   * @param lhs_prefixes Optional, device array the same length as a row with
+   * the prefixes of the strings of each column of `lhs`, or nullptr for the
+   * columns that are not strings. Strings are ordered by their prefixes
+   * before their characters are read if both tables have them.
+   * @param rhs_prefixes Optional, the same as `lhs_prefixes` for `rhs`
    */
   row_lexicographic_comparator(table_device_view lhs,
                                table_device_view rhs,
-                               order const* column_order         = nullptr,
-                               null_order const* null_precedence = nullptr)
-    : _lhs{lhs}, _rhs{rhs}, _column_order{column_order}, _null_precedence{null_precedence}
+                               order const* column_order                = nullptr,
+                               null_order const* null_precedence        = nullptr,
+                               string_prefix const* const* lhs_prefixes = nullptr,
+                               string_prefix const* const* rhs_prefixes = nullptr)
+    : _lhs{lhs},
+      _rhs{rhs},
+      _column_order{column_order},
+      _null_precedence{null_precedence},
+      _lhs_prefixes{lhs_prefixes},
+      _rhs_prefixes{rhs_prefixes}
   {
     CUDF_EXPECTS(_lhs.num_columns() == _rhs.num_columns(), "Mismatched number of columns.");
     CUDF_EXPECTS(detail::is_relationally_comparable(_lhs, _rhs),
@@ -381,8 +659,13 @@ class row_lexicographic_comparator {
       null_order null_precedence =
         _null_precedence == nullptr ? null_order::BEFORE : _null_precedence[i];
 
-      auto comparator =
-        element_relational_comparator<has_nulls>{_lhs.column(i), _rhs.column(i), null_precedence};
+      auto const has_prefixes = _lhs_prefixes != nullptr and _rhs_prefixes != nullptr;
+      auto comparator         = element_relational_comparator<has_nulls>{
+        _lhs.column(i),
+        _rhs.column(i),
+        null_precedence,
+        has_prefixes ? _lhs_prefixes[i] : nullptr,
+        has_prefixes ? _rhs_prefixes[i] : nullptr};
 
       state = cudf::type_dispatcher(_lhs.column(i).type(), comparator, lhs_index, rhs_index);
 
@@ -398,6 +681,8 @@ class row_lexicographic_comparator {
   table_device_view _rhs;
   null_order const* _null_precedence{};
   order const* _column_order{};
+  string_prefix const* const* _lhs_prefixes{};
+  string_prefix const* const* _rhs_prefixes{};
 };  // class row_lexicographic_comparator
 
 /**
@@ -416,7 +701,24 @@ class element_hasher {
     return hash_function<T>{}(col.element<T>(row_index));
   }
 
-  template <typename T, CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>())>
+  /**
+   * @brief Hashes a list by combining the hash of its size with the hashes of its elements.
+   */
+  template <typename T, CUDF_ENABLE_IF(std::is_same<T, list_view>::value)>
+  __device__ hash_value_type operator()(column_device_view col, size_type row_index) const
+  {
+    if (has_nulls && col.is_null(row_index)) { return std::numeric_limits<hash_value_type>::max(); }
+    auto const range = detail::list_child_range(col, row_index);
+    auto const child = col.child(lists_column_view::child_column_index);
+    return cudf::type_dispatcher(child.type(),
+                                 detail::list_elements_hasher_fn<hash_function>{child},
+                                 range.first,
+                                 range.second);
+  }
+
+  template <typename T,
+            CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>() and
+                           not std::is_same<T, list_view>::value)>
   __device__ hash_value_type operator()(column_device_view col, size_type row_index) const
   {
     cudf_assert(false && "Unsupported type in hash.");
@@ -441,7 +743,26 @@ class element_hasher_with_seed {
     return hash_function<T>{_seed}(col.element<T>(row_index));
   }
 
-  template <typename T, CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>())>
+  /**
+   * @brief Hashes a list by hashing each element with the hash of the elements before it as the
+   * seed, skipping null elements.
+   */
+  template <typename T, CUDF_ENABLE_IF(std::is_same<T, list_view>::value)>
+  __device__ hash_value_type operator()(column_device_view col, size_type row_index) const
+  {
+    if (has_nulls && col.is_null(row_index)) { return _null_hash; }
+    auto const range = detail::list_child_range(col, row_index);
+    auto const child = col.child(lists_column_view::child_column_index);
+    return cudf::type_dispatcher(child.type(),
+                                 detail::list_elements_hasher_with_seed_fn<hash_function>{child},
+                                 range.first,
+                                 range.second,
+                                 _seed);
+  }
+
+  template <typename T,
+            CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>() and
+                           not std::is_same<T, list_view>::value)>
   __device__ hash_value_type operator()(column_device_view col, size_type row_index) const
   {
     cudf_assert(false && "Unsupported type in hash.");
@@ -453,9 +774,67 @@ class element_hasher_with_seed {
   hash_value_type _null_hash{std::numeric_limits<hash_value_type>::max()};
 };
 
+namespace detail {
+/**
+ * @brief Hashes the elements of a list, dispatched once per list on the type of its elements.
+ */
+template <template <typename> class hash_function>
+struct list_elements_hasher_fn {
+  column_device_view child;
+
+  template <typename T, CUDF_ENABLE_IF(column_device_view::has_element_accessor<T>())>
+  __device__ hash_value_type operator()(size_type begin, size_type end) const
+  {
+    auto const hasher = element_hasher<hash_function, true>{};
+    auto hash         = hash_function<size_type>{}(end - begin);
+    for (auto i = begin; i < end; ++i) {
+      auto const element_hash = hasher.template operator()<T>(child, i);
+      hash                    = hash_function<hash_value_type>{}.hash_combine(hash, element_hash);
+    }
+    return hash;
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>())>
+  __device__ hash_value_type operator()(size_type, size_type) const
+  {
+    cudf_assert(false && "Unsupported list element type in hash.");
+    return {};
+  }
+};
+
+/**
+ * @brief Hashes the elements of a list starting from `seed`, dispatched once per list on the type
+ * of its elements.
+ */
+template <template <typename> class hash_function>
+struct list_elements_hasher_with_seed_fn {
+  column_device_view child;
+
+  template <typename T, CUDF_ENABLE_IF(column_device_view::has_element_accessor<T>())>
+  __device__ hash_value_type operator()(size_type begin, size_type end, uint32_t seed) const
+  {
+    auto hash = seed;
+    for (auto i = begin; i < end; ++i) {
+      auto const hasher = element_hasher_with_seed<hash_function, true>{hash, hash};
+      hash              = hasher.template operator()<T>(child, i);
+    }
+    return hash;
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>())>
+  __device__ hash_value_type operator()(size_type, size_type, uint32_t) const
+  {
+    cudf_assert(false && "Unsupported list element type in hash.");
+    return {};
+  }
+};
+}  // namespace detail
+
 /**
  * @brief Computes the hash value of a row in the given table.
  *
+ * Lists are hashed from their elements, which must not be nested.
+ *
  * @tparam hash_function Hash functor to use for hashing elements.
  * @tparam has_nulls Indicates the potential for null values in the table.
  */
@@ -550,4 +929,22 @@ class row_hasher_initial_values {
   hash_value_type* _initial_hash;
 };
 
+/**
+ * @brief Returns the precomputed hash value of a row, such as a row of the column returned by
+ * `cudf::hash`.
+ *
+ * Lets the hash values of a table be computed once and reused by every operation that hashes
+ * the same keys.
+ */
+class precomputed_row_hasher {
+ public:
+  precomputed_row_hasher() = delete;
+  precomputed_row_hasher(hash_value_type const* hashes) : _hashes{hashes} {}
+
+  __device__ hash_value_type operator()(size_type row_index) const { return _hashes[row_index]; }
+
+ private:
+  hash_value_type const* _hashes;
+};
+
 }  // namespace cudf
@@ -19,6 +19,7 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -171,5 +172,30 @@ std::unique_ptr<column> row_bit_count(
   table_view const& t,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the indices at which to split a table into consecutive batches of rows whose
+ * size is at most `max_bytes` each.
+ *
+ * The batches are formed greedily from the first row, each with as many rows as fit in
+ * `max_bytes`, using the per-row sizes of `row_bit_count`. A row larger than `max_bytes` is a
+ * batch on its own. The returned indices can be passed to `cudf::split`.
+ *
+ * The sizes are the approximations of `row_bit_count`: a batch of strings or lists columns can
+ * exceed `max_bytes` by the terminating offset of each such column. The batches are computed
+ * with a single scan of the row sizes followed by a binary search per batch.
+ *
+ * @code{.pseudo}
+ * t = {{1, 2, 3, 4, 5}}  // INT32, 4 bytes per row
+ * split_by_size(t, 8) = {2, 4}
+ * @endcode
+ *
+ * @throws cudf::logic_error if `max_bytes` is 0
+ *
+ * @param t The table to split
+ * @param max_bytes The maximum size in bytes of a batch
+ * @return The indices of the first row of each batch but the first, in increasing order
+ */
+std::vector<size_type> split_by_size(table_view const& t, std::size_t max_bytes);
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -336,7 +336,9 @@ enum class hash_id {
   HASH_MURMUR3,         ///< Murmur3 hash function
   HASH_MD5,             ///< MD5 hash function
   HASH_SERIAL_MURMUR3,  ///< Serial Murmur3 hash function
-  HASH_SPARK_MURMUR3    ///< Spark Murmur3 hash function
+  HASH_SPARK_MURMUR3,   ///< Spark Murmur3 hash function
+  HASH_XXHASH64,        ///< xxHash64 hash function
+  HASH_MURMUR3_64       ///< 64-bit Murmur3 hash function, the first half of MurmurHash3_x64_128
 };
 
 /**
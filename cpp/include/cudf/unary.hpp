@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -68,6 +68,26 @@ std::unique_ptr<cudf::column> unary_operation(
   cudf::unary_operator op,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Performs unary op on all values in column into a preallocated column
+ *
+ * Computes the same values and validity as the overload returning a new column, without allocating
+ * the output. Steady-state pipelines can reuse the same output column for each batch.
+ *
+ * @throw cudf::logic_error if `input` is a `fixed_point` or dictionary column
+ * @throw cudf::logic_error if `output` is not of the type of the result of `op`, i.e. `BOOL8` for
+ * `NOT` and the type of `input` otherwise, or not of the size of `input`
+ * @throw cudf::logic_error if `input` has nulls and `output` is not nullable
+ * @throw cudf::logic_error if `output` is nullable and has an offset
+ *
+ * @param input A `column_view` as input
+ * @param op operation to perform
+ * @param output Column written with the result of the operation
+ */
+void unary_operation(cudf::column_view const& input,
+                     cudf::unary_operator op,
+                     mutable_column_view& output);
+
 /**
  * @brief Creates a column of `type_id::BOOL8` elements where for every element in `input` `true`
  * indicates the value is null and `false` indicates the value is valid.
@@ -113,6 +133,22 @@ std::unique_ptr<column> cast(
   data_type out_type,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief  Casts data from dtype specified in input to the dtype of a preallocated column.
+ *
+ * Computes the same values and validity as the overload returning a new column with the type of
+ * `output` as the output type, without allocating the output.
+ *
+ * @param input Input column
+ * @param output Column of the desired datatype and of the size of `input` written with the result
+ *
+ * @throw cudf::logic_error if `input` and `output` are `fixed_point` columns, i.e. a rescale
+ * @throw cudf::logic_error if `output` is not a fixed-width type or not of the size of `input`
+ * @throw cudf::logic_error if `input` has nulls and `output` is not nullable
+ * @throw cudf::logic_error if `output` is nullable and has an offset
+ */
+void cast(column_view const& input, mutable_column_view& output);
+
 /**
  * @brief Creates a column of `type_id::BOOL8` elements indicating the presence of `NaN` values
  * in a column of floating point values.
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace cudf {
+
+/**
+ * @brief Counters of the lookups of JIT-compiled kernels.
+ *
+ * A kernel is first looked up in an in-memory cache, bounded to
+ * `LIBCUDF_KERNEL_CACHE_LIMIT_PER_PROCESS` kernels per program (default 100) and evicting the least
+ * recently used kernels, then in an on-disk cache under `LIBCUDF_KERNEL_CACHE_PATH` shared by all
+ * processes, bounded to `LIBCUDF_KERNEL_CACHE_LIMIT_DISK` kernels per program (default 10000, 0
+ * disables the on-disk cache), and is compiled only if neither holds it.
+ */
+struct jit_cache_statistics {
+  std::size_t lookups{};  ///< Number of kernel lookups
+  std::size_t misses{};   ///< Number of lookups of a kernel for the first time in the process
+  std::chrono::nanoseconds miss_duration{};  ///< Time spent loading or compiling missed kernels
+};
+
+/**
+ * @brief Returns the counters of the JIT kernel lookups since the process started or since the
+ * last call to `reset_jit_cache_statistics`.
+ */
+jit_cache_statistics get_jit_cache_statistics();
+
+/**
+ * @brief Resets the counters of the JIT kernel lookups.
+ *
+ * Kernels already used by the process are not counted as misses again.
+ */
+void reset_jit_cache_statistics();
+
+}  // namespace cudf
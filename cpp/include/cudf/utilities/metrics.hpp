@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace cudf {
+namespace metrics {
+/**
+ * @addtogroup utility_metrics
+ * @{
+ * @file
+ */
+
+/**
+ * @brief The metrics of one libcudf operation, i.e. one call of a function that opens a
+ * `CUDF_FUNC_RANGE`, including the libcudf functions it calls.
+ */
+struct operation_metrics {
+  char const* name;         ///< Name of the function
+  float elapsed_ms;         ///< Time of the work of the operation on the default stream
+  int64_t bytes_processed;  ///< Bytes reported by the stages of the operation, e.g. of cuIO
+  /// Bytes allocated during the operation, or -1 if the current device resource is not a
+  /// `rmm::mr::statistics_resource_adaptor<rmm::mr::device_memory_resource>`
+  int64_t allocated_bytes;
+  /// Peak bytes held by the operation above those held when it started if it raised the peak of
+  /// the statistics adaptor, otherwise 0; or -1 as above
+  int64_t peak_bytes;
+};
+
+/**
+ * @brief Callback receiving the metrics of each operation, on the thread that ran it.
+ *
+ * Must not throw.
+ */
+using callback = std::function<void(operation_metrics const&)>;
+
+/**
+ * @brief Registers a callback for the metrics of libcudf operations for the lifetime of this
+ * object.
+ *
+ * Metrics are only collected while a scope exists, which costs a synchronization of the default
+ * stream at the end of every operation. An operation called from within another operation is
+ * accounted to the outer one.
+ *
+ * Example:
+ * ```
+ * cudf::metrics::scope metrics{[](auto const& m) { record(m.name, m.elapsed_ms); }};
+ * auto result = cudf::sort(input);  // calls the callback once
+ * ```
+ */
+class scope {
+ public:
+  explicit scope(callback cb);
+  scope(scope const&) = delete;
+  scope& operator=(scope const&) = delete;
+  ~scope();
+
+ private:
+  int _id;  // the key of the callback in the registry
+};
+
+/** @} */  // end of group
+}  // namespace metrics
+}  // namespace cudf
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/copying.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace cudf {
+/**
+ * @addtogroup utility_spill
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Where the data of spilled tables is kept.
+ */
+enum class spill_target {
+  HOST,  ///< Pinned host memory
+  DISK   ///< Files in the spill directory, written with cuFile when it is enabled
+};
+
+class spillable_table;
+
+/**
+ * @brief Tracks the `spillable_table`s that can be moved out of device memory, and spills them
+ * when device memory runs out.
+ *
+ * Tables are spilled in least recently locked order. A table is never spilled while it is locked.
+ *
+ * The manager must outlive its tables.
+ */
+class spill_manager {
+ public:
+  /**
+   * @brief Constructs a manager that spills to `target`.
+   *
+   * @param target Where the spilled data is kept
+   * @param spill_directory Directory of the spill files when `target` is `DISK`
+   */
+  explicit spill_manager(spill_target target = spill_target::HOST,
+                         std::string spill_directory = "");
+  spill_manager(spill_manager const&) = delete;
+  spill_manager& operator=(spill_manager const&) = delete;
+  ~spill_manager();
+
+  /**
+   * @brief Spills unlocked tables until at least `bytes` bytes of device memory are freed, or no
+   * table is left to spill.
+   *
+   * Tables that are being locked or spilled by another thread are skipped.
+   *
+   * @param bytes Number of bytes of device memory to free
+   * @param stream CUDA stream on which the tables are copied out of device memory
+   * @return The number of bytes of device memory freed
+   */
+  std::size_t spill(std::size_t bytes,
+                    rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Returns the total size of the data of the tables that are currently spilled.
+   */
+  std::size_t spilled_bytes() const { return _spilled_bytes; }
+
+  /**
+   * @brief Returns the target of the spilled data.
+   */
+  spill_target target() const { return _target; }
+
+ private:
+  friend class spillable_table;
+
+  void register_table(spillable_table* table);
+  void unregister_table(spillable_table* table);
+  void touch(spillable_table* table);  ///< Marks `table` as the most recently locked
+
+  spill_target const _target;
+  std::string const _spill_directory;
+  std::mutex _mutex;
+  std::list<spillable_table*> _tables;  // least recently locked first
+  std::atomic<std::size_t> _spilled_bytes{0};
+  std::atomic<std::size_t> _next_file_id{0};
+};
+
+/**
+ * @brief A table kept in a single device buffer, packed with `cudf::pack`, that its
+ * `spill_manager` can move to host memory or disk while it is not locked.
+ *
+ * Access to the data goes through `lock`, which copies the data back to device memory if it was
+ * spilled and keeps it there until the returned `locked_view` is destroyed. The work using the
+ * view must be complete, e.g. its stream synchronized, before the view is destroyed.
+ *
+ * Example:
+ * ```
+ * cudf::spill_manager manager;
+ * cudf::spilling_resource_adaptor mr{rmm::mr::get_current_device_resource(), manager};
+ * rmm::mr::set_current_device_resource(&mr);
+ *
+ * cudf::spillable_table cached{input, manager};
+ * ...
+ * {
+ *   auto const locked = cached.lock();
+ *   auto result       = cudf::sort(locked.view());
+ * }  // `cached` may be spilled again from here on
+ * ```
+ */
+class spillable_table {
+ public:
+  /**
+   * @brief RAII handle to a table locked in device memory.
+   */
+  class locked_view {
+   public:
+    locked_view(locked_view&& other) noexcept
+      : _table(std::exchange(other._table, nullptr)), _view(other._view)
+    {
+    }
+    locked_view(locked_view const&) = delete;
+    locked_view& operator=(locked_view const&) = delete;
+    locked_view& operator=(locked_view&&) = delete;
+    ~locked_view();
+
+    /**
+     * @brief Returns the view of the table, valid for the lifetime of this object.
+     */
+    table_view view() const { return _view; }
+
+   private:
+    friend class spillable_table;
+    locked_view(spillable_table* table, table_view view) : _table(table), _view(view) {}
+
+    spillable_table* _table;
+    table_view _view;
+  };
+
+  /**
+   * @brief Packs a copy of `input` and registers it with `manager`.
+   *
+   * @param input Table to copy
+   * @param manager Manager that spills the table
+   * @param mr Device memory resource used to allocate the packed table, also when it is restored
+   */
+  spillable_table(table_view const& input,
+                  spill_manager& manager,
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+  spillable_table(spillable_table const&) = delete;
+  spillable_table& operator=(spillable_table const&) = delete;
+  ~spillable_table();
+
+  /**
+   * @brief Locks the table in device memory, copying it back first if it is spilled.
+   *
+   * @throw rmm::bad_alloc if the table is spilled and there is not enough device memory to
+   * restore it
+   *
+   * @param stream CUDA stream on which the table is restored; synchronized before returning
+   * @return Handle that keeps the table in device memory while it exists
+   */
+  locked_view lock(rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Returns whether the data of the table is currently out of device memory.
+   */
+  bool is_spilled() const;
+
+  /**
+   * @brief Returns the size in bytes of the packed data of the table.
+   */
+  std::size_t size() const { return _size; }
+
+ private:
+  friend class spill_manager;
+  class spilled_data;
+
+  /**
+   * @brief Moves the data out of device memory. Requires `_mutex` and no lock.
+   *
+   * @return The number of bytes of device memory freed
+   */
+  std::size_t spill(rmm::cuda_stream_view stream);
+
+  void unlock();
+
+  spill_manager& _manager;
+  rmm::mr::device_memory_resource* _mr;
+  mutable std::mutex _mutex;
+  int _lock_count = 0;
+  std::size_t _size;
+  std::unique_ptr<packed_columns::metadata> _metadata;
+  std::unique_ptr<rmm::device_buffer> _device_data;  // null while spilled
+  std::unique_ptr<spilled_data> _spilled;            // null while in device memory
+};
+
+/**
+ * @brief Device memory resource that spills the tables of a `spill_manager` when an allocation
+ * from its upstream resource fails, and retries the allocation.
+ *
+ * The allocation fails with `rmm::bad_alloc` once no more tables can be spilled.
+ */
+class spilling_resource_adaptor final : public rmm::mr::device_memory_resource {
+ public:
+  /**
+   * @brief Constructs an adaptor of `upstream` that spills the tables of `manager`.
+   *
+   * @param upstream Resource that performs the allocations
+   * @param manager Manager of the tables to spill
+   */
+  spilling_resource_adaptor(rmm::mr::device_memory_resource* upstream, spill_manager& manager);
+
+  /**
+   * @brief Returns the upstream resource.
+   */
+  rmm::mr::device_memory_resource* get_upstream() const noexcept { return _upstream; }
+
+  bool supports_streams() const noexcept override { return _upstream->supports_streams(); }
+
+  bool supports_get_mem_info() const noexcept override
+  {
+    return _upstream->supports_get_mem_info();
+  }
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override;
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override;
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(rmm::cuda_stream_view stream) const override
+  {
+    return _upstream->get_mem_info(stream);
+  }
+
+  rmm::mr::device_memory_resource* _upstream;
+  spill_manager& _manager;
+};
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace cudf {
+/**
+ * @addtogroup utility_stream_pool
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Returns the number of streams on which libcudf runs the independent parts of an
+ * operation, such as the columns of a table, concurrently.
+ *
+ * The initial size is the value of the `LIBCUDF_STREAM_POOL_SIZE` environment variable, or 16
+ * when it is not set.
+ */
+std::size_t get_stream_pool_size();
+
+/**
+ * @brief Sets the number of streams on which libcudf runs the independent parts of an operation
+ * concurrently.
+ *
+ * With a size of 1, all of the work of an operation runs on the stream it is called with. Calls
+ * already in progress keep the streams they forked.
+ *
+ * @throw cudf::logic_error if `size` is 0
+ *
+ * @param size Number of streams of the pool
+ */
+void set_stream_pool_size(std::size_t size);
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -149,6 +149,7 @@
  *   @defgroup lists_elements Counting
  *   @defgroup lists_drop_duplicates Filtering
  *   @defgroup lists_sort Sorting
+ *   @defgroup lists_reduction Reducing
  * @}
  * @defgroup nvtext_apis NVText
  * @{
@@ -158,6 +159,7 @@
  *   @defgroup nvtext_edit_distance Edit Distance
  *   @defgroup nvtext_tokenize Tokenizing
  *   @defgroup nvtext_replace Replacing
+ *   @defgroup nvtext_minhash MinHashing
  * @}
  * @defgroup utility_apis Utilities
  * @{
@@ -165,6 +167,9 @@
  *   @defgroup utility_dispatcher Type Dispatcher
  *   @defgroup utility_bitmask Bitmask
  *   @defgroup utility_error Exception
+ *   @defgroup utility_metrics Metrics
+ *   @defgroup utility_spill Spilling
+ *   @defgroup utility_stream_pool Stream Pool
  * @}
  * @defgroup labeling_apis Labeling
  * @{
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <nvtext/subword_tokenize.hpp>
+
+namespace nvtext {
+
+/**
+ * @addtogroup nvtext_tokenize
+ * @{
+ * @file
+ */
+
+/**
+ * @brief The merge pairs data for use with the byte_pair_encoding function.
+ *
+ * Each merge pair is identified by the hash of its two symbols separated by a space
+ * and ranked by its position in the merges file.
+ */
+struct bpe_merge_pairs {
+  std::unique_ptr<cudf::column> keys;   // uint64 hashes of the merge pairs, sorted
+  std::unique_ptr<cudf::column> ranks;  // int32 rank of each key
+};
+
+/**
+ * @brief Load the merge pairs file into device memory.
+ *
+ * Each line of the file holds the two symbols of a merge pair separated by a space,
+ * in priority order. Lines starting with '#' such as a version header are ignored.
+ *
+ * The object here can be used to call byte_pair_encoding without
+ * incurring the cost of loading the same file each time.
+ *
+ * @throw cudf::logic_error if the `filename_merges` could not be opened.
+ *
+ * @param filename_merges A path to the merges file.
+ * @param mr Memory resource to allocate any returned objects.
+ * @return merge pairs table elements
+ */
+std::unique_ptr<bpe_merge_pairs> load_merge_pairs_file(
+  std::string const& filename_merges,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Tokenizes the strings into token-ids using byte-pair-encoding.
+ *
+ * Each string is split into words on spaces. The characters of each word are then
+ * merged pairwise, always merging the adjacent pair with the lowest rank in `merge_pairs`,
+ * until no adjacent pair is in `merge_pairs`. The resulting symbols are looked up in
+ * `vocabulary_table` and any symbol not found produces its `unknown_token_id`.
+ *
+ * The strings are expected to be encoded as the model expects before merging,
+ * for example by mapping each byte to its printable character for GPT-2 style models.
+ *
+ * @code{.pseudo}
+ * merges = ["t h", "th e", "a n"]
+ * s = ["the man", null]
+ * ids = byte_pair_encoding(s, merges, vocab)
+ * ids is [[id("the"), id("m"), id("an")], null]
+ * @endcode
+ *
+ * Null rows result in null rows in the output.
+ *
+ * @param strings The input strings to tokenize.
+ * @param merge_pairs The merge pairs pre-loaded by @ref load_merge_pairs_file.
+ * @param vocabulary_table The vocabulary table pre-loaded by @ref load_vocabulary_file.
+ * @param mr Memory resource to allocate any returned objects.
+ * @return Lists column of UINT32 token-ids, one list per string.
+ */
+std::unique_ptr<cudf::column> byte_pair_encoding(
+  cudf::strings_column_view const& strings,
+  bpe_merge_pairs const& merge_pairs,
+  hashed_vocabulary const& vocabulary_table,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace nvtext
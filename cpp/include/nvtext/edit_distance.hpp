@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -61,6 +61,38 @@ std::unique_ptr<cudf::column> edit_distance(
   cudf::strings_column_view const& targets,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Compute the edit distance between individual strings in two strings columns,
+ * stopping as soon as a distance is known to be larger than `max_distance`.
+ *
+ * This is the same as @ref edit_distance except distances larger than `max_distance`
+ * are returned as `max_distance + 1`. Pairs of strings whose lengths differ by more
+ * than `max_distance` are not compared at all.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["hello", "", "world"]
+ * t = ["hallo", "goodbye", "world"]
+ * d = edit_distance(s, t, 2)
+ * d is now [1, 3, 0]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `targets.size() != strings.size()` and
+ *                          if `targets.size() != 1`
+ * @throw cudf::logic_error if `max_distance < 0`
+ *
+ * @param strings Strings column of input strings
+ * @param targets Strings to compute edit distance against `strings`
+ * @param max_distance Largest edit distance to compute
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New column of edit distance values.
+ */
+std::unique_ptr<cudf::column> edit_distance(
+  cudf::strings_column_view const& strings,
+  cudf::strings_column_view const& targets,
+  int32_t max_distance,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Compute the edit distance between all the strings in the input column.
  *
@@ -97,5 +129,34 @@ std::unique_ptr<cudf::column> edit_distance_matrix(
   cudf::strings_column_view const& strings,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Compute the edit distance between all the strings in the input column,
+ * stopping as soon as a distance is known to be larger than `max_distance`.
+ *
+ * This is the same as @ref edit_distance_matrix except distances larger than
+ * `max_distance` are returned as `max_distance + 1`.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["hello", "hallo", "hi"]
+ * d = edit_distance_matrix(s, 2)
+ * d is now [[0, 1, 3],
+ *           [1, 0, 3]
+ *           [3, 3, 0]]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `strings.size() == 1`
+ * @throw cudf::logic_error if `max_distance < 0`
+ *
+ * @param strings Strings column of input strings
+ * @param max_distance Largest edit distance to compute
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New lists column of edit distance values.
+ */
+std::unique_ptr<cudf::column> edit_distance_matrix(
+  cudf::strings_column_view const& strings,
+  int32_t max_distance,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
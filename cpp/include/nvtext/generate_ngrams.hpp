@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 
 namespace nvtext {
 /**
@@ -90,5 +91,57 @@ std::unique_ptr<cudf::column> generate_character_ngrams(
   cudf::size_type ngrams              = 2,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Hashes the ngrams of characters within each string.
+ *
+ * Each ngram is hashed with MurmurHash3_32 in place so no ngram strings are created.
+ * The ngrams are the same as those of @ref generate_character_ngrams.
+ *
+ * ```
+ * ["abc", "de", null] would produce bigram hashes as
+ * [[hash("ab"), hash("bc")], [hash("de")], null]
+ * ```
+ *
+ * Strings with fewer than `ngrams` characters produce empty rows
+ * and null rows produce null rows.
+ *
+ * @throw cudf::logic_error if `ngrams < 2`
+ *
+ * @param strings Strings column to produce ngram hashes from.
+ * @param ngrams The ngram number to generate.
+ *               Default is 5.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return Lists column of UINT32 hashes, one list per string.
+ */
+std::unique_ptr<cudf::column> hash_character_ngrams(
+  cudf::strings_column_view const& strings,
+  cudf::size_type ngrams              = 5,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Counts the distinct ngrams of characters of all the strings by their hashes.
+ *
+ * Each ngram is hashed as in @ref hash_character_ngrams and the hashes are counted in a
+ * device hash map, so neither the ngrams nor their hashes are created.
+ *
+ * ```
+ * ["abab", "ba"] would count bigrams as
+ * [[hash("ab"), hash("ba")], [2, 2]] in no particular order
+ * ```
+ *
+ * @throw cudf::logic_error if `ngrams < 2`
+ *
+ * @param strings Strings column to produce ngram counts from.
+ * @param ngrams The ngram number to generate.
+ *               Default is 5.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return Table of the UINT32 hash of each distinct ngram and its INT32 count,
+ *         in no particular order.
+ */
+std::unique_ptr<cudf::table> count_character_ngrams(
+  cudf::strings_column_view const& strings,
+  cudf::size_type ngrams              = 5,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
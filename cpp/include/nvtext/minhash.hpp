@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+namespace nvtext {
+/**
+ * @addtogroup nvtext_minhash
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Returns the minhash signature of each string using character ngrams.
+ *
+ * Each ngram is `width` adjacent characters of a string. A string with fewer than `width`
+ * characters is a single ngram. Each ngram is hashed with MurmurHash3_32 once for each seed
+ * and the signature value for a seed is the minimum hash of the string's ngrams.
+ * No ngrams are materialized.
+ *
+ * ```
+ * s = ["abcd", null]
+ * r = minhash(s, [seed0, seed1], 3)
+ * r is [[min(h0("abc"), h0("bcd")), min(h1("abc"), h1("bcd"))], null]
+ * ```
+ *
+ * Null rows result in null rows in the output.
+ *
+ * @throw cudf::logic_error if `width < 1`
+ * @throw cudf::logic_error if `seeds` is empty, not UINT32 or has nulls
+ *
+ * @param strings Strings column to compute the signatures of.
+ * @param seeds The seeds of the hash functions, one per value of the signature.
+ * @param width The number of characters of each ngram.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return Lists column of UINT32 signatures with `seeds.size()` values per row.
+ */
+std::unique_ptr<cudf::column> minhash(
+  cudf::strings_column_view const& strings,
+  cudf::column_view const& seeds,
+  cudf::size_type width               = 4,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the minhash signature of each string using word ngrams.
+ *
+ * Words are separated by whitespace. Each ngram is the substring from the start of a word
+ * to the end of the `width-1`th word after it. A string with fewer than `width` words is
+ * a single ngram. Each ngram is hashed with MurmurHash3_32 once for each seed and the
+ * signature value for a seed is the minimum hash of the string's ngrams.
+ * No ngrams are materialized.
+ *
+ * ```
+ * s = ["a bb ccc", null]
+ * r = word_minhash(s, [seed0], 2)
+ * r is [[min(h0("a bb"), h0("bb ccc"))], null]
+ * ```
+ *
+ * Null rows result in null rows in the output.
+ *
+ * @throw cudf::logic_error if `width < 1`
+ * @throw cudf::logic_error if `seeds` is empty, not UINT32 or has nulls
+ *
+ * @param strings Strings column to compute the signatures of.
+ * @param seeds The seeds of the hash functions, one per value of the signature.
+ * @param width The number of words of each ngram.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return Lists column of UINT32 signatures with `seeds.size()` values per row.
+ */
+std::unique_ptr<cudf::column> word_minhash(
+  cudf::strings_column_view const& strings,
+  cudf::column_view const& seeds,
+  cudf::size_type width               = 2,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace nvtext
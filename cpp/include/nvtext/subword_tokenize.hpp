@@ -179,5 +179,50 @@ tokenizer_result subword_tokenize(
   uint32_t max_rows_tensor,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Creates a tokenizer that cleans the text, splits it into tokens and
+ * returns token-ids from an input vocabulary, writing into preallocated output columns.
+ *
+ * This function differs from the one above by writing the token-ids, attention-mask
+ * and metadata into the given columns instead of allocating new ones. A stream of
+ * batches can reuse the same output columns and the same pre-loaded vocabulary
+ * for every batch so no output memory is allocated per batch.
+ *
+ * The columns hold `tensor_metadata.size() / 3` rows. Only the first rows, as many
+ * as the returned value, are written; the remaining rows are left unchanged.
+ *
+ * @throw cudf::logic_error if `stride > max_sequence_length`
+ * @throw cudf::logic_error if any output column is not UINT32 or has a null mask
+ * @throw cudf::logic_error if `tensor_token_ids` and `tensor_attention_mask` do not have
+ *        `max_sequence_length` elements for each row of `tensor_metadata`
+ * @throw cudf::logic_error if the strings need more rows than the output columns hold
+ *
+ * @param strings The input strings to tokenize.
+ * @param vocabulary_table The vocabulary table pre-loaded into this object.
+ * @param max_sequence_length Limit of the number of token-ids per row in final tensor
+ *        for each string.
+ * @param stride Each row in the output token-ids will replicate `max_sequence_length - stride`
+ *        the token-ids from the previous row, unless it is the first string.
+ * @param do_lower_case If true, the tokenizer will convert uppercase characters in the
+ *        input stream to lower-case and strip accents from those characters.
+ *        If false, accented and uppercase characters are not transformed.
+ * @param do_truncate If true, the tokenizer will discard all the token-ids after
+ *        `max_sequence_length` for each input string. If false, it will use a new row
+ *        in the output token-ids to continue generating the output.
+ * @param tensor_token_ids Output column for the token-ids of each row.
+ * @param tensor_attention_mask Output column for the attention mask of each row.
+ * @param tensor_metadata Output column for the 3 metadata values of each row.
+ * @return Number of rows written to the output columns
+ */
+uint32_t subword_tokenize(cudf::strings_column_view const& strings,
+                          hashed_vocabulary const& vocabulary_table,
+                          uint32_t max_sequence_length,
+                          uint32_t stride,
+                          bool do_lower_case,
+                          bool do_truncate,
+                          cudf::mutable_column_view& tensor_token_ids,
+                          cudf::mutable_column_view& tensor_attention_mask,
+                          cudf::mutable_column_view& tensor_metadata);
+
 /** @} */  // end of group
 }  // namespace nvtext
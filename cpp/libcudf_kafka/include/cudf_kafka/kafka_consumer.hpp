@@ -19,15 +19,60 @@
 #include <algorithm>
 #include <chrono>
 #include <cudf/io/datasource.hpp>
+#include <future>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace cudf {
 namespace io {
 namespace external {
 namespace kafka {
 
+/**
+ * @brief Kafka messages appended into page-locked host memory
+ *
+ * The GPU readers copy the data to the device directly from this memory, without staging it
+ * through a pageable buffer first. The memory is kept across `clear` so that consecutive batches
+ * reuse it.
+ */
+class message_batch {
+ public:
+  message_batch() = default;
+  message_batch(message_batch const &) = delete;
+  message_batch &operator=(message_batch const &) = delete;
+  ~message_batch();
+
+  /**
+   * @brief Appends a message followed by `delimiter`, growing the pinned allocation if needed
+   *
+   * @param[in] payload The message data
+   * @param[in] size Bytes in the message
+   * @param[in] delimiter Bytes to insert after the message
+   */
+  void append(void const *payload, size_t size, std::string const &delimiter);
+
+  /**
+   * @brief Removes all messages, keeping the pinned allocation
+   */
+  void clear();
+
+  uint8_t const *data() const { return _data; }
+  size_t size() const { return _size; }
+
+  /**
+   * @brief Returns the byte offset of each message in `data`
+   */
+  std::vector<size_t> const &message_offsets() const { return _message_offsets; }
+
+ private:
+  uint8_t *_data   = nullptr;
+  size_t _size     = 0;
+  size_t _capacity = 0;
+  std::vector<size_t> _message_offsets;
+};
+
 /**
  * @brief libcudf datasource for Apache Kafka
  *
@@ -102,6 +147,36 @@ class kafka_consumer : public cudf::io::datasource {
    */
   size_t host_read(size_t offset, size_t size, uint8_t *dst) override;
 
+  /**
+   * @brief Starts consuming the messages that follow the current batch into a second pinned
+   * buffer, in the background
+   *
+   * The current batch stays readable while the next one is polled, so a reader can parse it on
+   * the GPU in the meantime, e.g. with `read_json(source_info{&consumer})`.
+   *
+   * @throws cudf::logic_error if the consumer was not assigned a topic partition
+   *
+   * @param[in] max_messages Maximum number of messages in the next batch
+   */
+  void prefetch_next_batch(int64_t max_messages);
+
+  /**
+   * @brief Makes the batch started by `prefetch_next_batch` the data of this datasource, waiting
+   * until it has been consumed
+   *
+   * Buffers returned by `host_read` for the previous batch must not be used afterwards.
+   *
+   * @throws cudf::logic_error if no batch was prefetched
+   *
+   * @return The number of messages in the new batch
+   */
+  size_t next_batch();
+
+  /**
+   * @brief Returns the byte offset of each message of the current batch
+   */
+  std::vector<size_t> const &message_offsets() const;
+
   /**
    * @brief Commits an offset to a specified Kafka Topic/Partition instance
    *
@@ -186,7 +261,9 @@ class kafka_consumer : public cudf::io::datasource {
   int default_timeout = 10000;  // milliseconds
   std::string delimiter;
 
-  std::string buffer;
+  message_batch batches[2];
+  int current_batch = 0;  // index of the readable batch; the other one is being prefetched
+  std::future<void> prefetch;
 
  private:
   RdKafka::ErrorCode update_consumer_topic_partition_assignment(std::string const &topic,
@@ -198,7 +275,7 @@ class kafka_consumer : public cudf::io::datasource {
    */
   int64_t now();
 
-  void consume_to_buffer();
+  void consume_to_buffer(message_batch &batch, int64_t max_messages);
 };
 
 }  // namespace kafka
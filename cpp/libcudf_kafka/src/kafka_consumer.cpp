@@ -15,8 +15,10 @@
  */
 
 #include "cudf_kafka/kafka_consumer.hpp"
+#include <cuda_runtime.h>
 #include <librdkafka/rdkafkacpp.h>
 #include <chrono>
+#include <cstring>
 #include <memory>
 
 namespace cudf {
@@ -24,6 +26,36 @@ namespace io {
 namespace external {
 namespace kafka {
 
+message_batch::~message_batch()
+{
+  if (_data != nullptr) { cudaFreeHost(_data); }
+}
+
+void message_batch::append(void const *payload, size_t size, std::string const &delimiter)
+{
+  auto const new_size = _size + size + delimiter.size();
+  if (new_size > _capacity) {
+    // grows geometrically, since pinned allocations are expensive
+    auto const capacity = std::max(new_size, 2 * _capacity);
+    uint8_t *data       = nullptr;
+    CUDA_TRY(cudaMallocHost(&data, capacity));
+    if (_size > 0) { std::memcpy(data, _data, _size); }
+    if (_data != nullptr) { cudaFreeHost(_data); }
+    _data     = data;
+    _capacity = capacity;
+  }
+  _message_offsets.push_back(_size);
+  if (size > 0) { std::memcpy(_data + _size, payload, size); }
+  std::copy(delimiter.begin(), delimiter.end(), _data + _size + size);
+  _size = new_size;
+}
+
+void message_batch::clear()
+{
+  _size = 0;
+  _message_offsets.clear();
+}
+
 kafka_consumer::kafka_consumer(std::map<std::string, std::string> const &configs)
   : kafka_conf(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL))
 {
@@ -78,25 +110,51 @@ kafka_consumer::kafka_consumer(std::map<std::string, std::string> const &configs
 
   // Pre fill the local buffer with messages so the datasource->size() invocation
   // will return a valid size.
-  consume_to_buffer();
+  update_consumer_topic_partition_assignment(topic_name, partition, start_offset);
+  consume_to_buffer(batches[current_batch], end_offset - start_offset);
 }
 
 std::unique_ptr<cudf::io::datasource::buffer> kafka_consumer::host_read(size_t offset, size_t size)
 {
+  auto const &buffer = batches[current_batch];
   if (offset > buffer.size()) { return 0; }
   size = std::min(size, buffer.size() - offset);
-  return std::make_unique<non_owning_buffer>((uint8_t *)buffer.data() + offset, size);
+  return std::make_unique<non_owning_buffer>(buffer.data() + offset, size);
 }
 
 size_t kafka_consumer::host_read(size_t offset, size_t size, uint8_t *dst)
 {
+  auto const &buffer = batches[current_batch];
   if (offset > buffer.size()) { return 0; }
   auto const read_size = std::min(size, buffer.size() - offset);
-  memcpy(dst, buffer.data() + offset, size);
+  memcpy(dst, buffer.data() + offset, read_size);
   return read_size;
 }
 
-size_t kafka_consumer::size() const { return buffer.size(); }
+size_t kafka_consumer::size() const { return batches[current_batch].size(); }
+
+void kafka_consumer::prefetch_next_batch(int64_t max_messages)
+{
+  CUDF_EXPECTS(not topic_name.empty(), "Kafka consumer has no topic partition to consume from");
+  CUDF_EXPECTS(not prefetch.valid(), "The next Kafka batch is already being prefetched");
+  // librdkafka continues from the last consumed message, so no reassignment is needed
+  prefetch = std::async(std::launch::async, [this, max_messages] {
+    consume_to_buffer(batches[1 - current_batch], max_messages);
+  });
+}
+
+size_t kafka_consumer::next_batch()
+{
+  CUDF_EXPECTS(prefetch.valid(), "No Kafka batch was prefetched");
+  prefetch.get();
+  current_batch = 1 - current_batch;
+  return batches[current_batch].message_offsets().size();
+}
+
+std::vector<size_t> const &kafka_consumer::message_offsets() const
+{
+  return batches[current_batch].message_offsets();
+}
 
 /**
  * Change the TOPPAR assignment for this consumer instance
@@ -109,20 +167,19 @@ RdKafka::ErrorCode kafka_consumer::update_consumer_topic_partition_assignment(
   return consumer.get()->assign(topic_partitions);
 }
 
-void kafka_consumer::consume_to_buffer()
+void kafka_consumer::consume_to_buffer(message_batch &batch, int64_t max_messages)
 {
-  update_consumer_topic_partition_assignment(topic_name, partition, start_offset);
+  batch.clear();
 
   int64_t messages_read = 0;
   auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_timeout);
 
-  while (messages_read < end_offset - start_offset && end > std::chrono::steady_clock::now()) {
+  while (messages_read < max_messages && end > std::chrono::steady_clock::now()) {
     std::unique_ptr<RdKafka::Message> msg{
       consumer->consume((end - std::chrono::steady_clock::now()).count())};
 
     if (msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR) {
-      buffer.append(static_cast<char *>(msg->payload()));
-      buffer.append(delimiter);
+      batch.append(msg->payload(), msg->len(), delimiter);
       messages_read++;
     } else if (msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
       // If there are no more messages return
@@ -54,3 +54,21 @@ TEST_F(KafkaDatasourceTest, InvalidConfigValues)
   EXPECT_THROW(kafka::kafka_consumer kc(kafka_configs, "csv-topic", 0, 0, 3, 5000, "\n"),
                cudf::logic_error);
 }
+
+TEST_F(KafkaDatasourceTest, MessageBatch)
+{
+  kafka::message_batch batch;
+  std::string const message("abc");
+  for (int i = 0; i < 1000; ++i) {
+    batch.append(message.data(), message.size(), "\n");
+  }
+  EXPECT_EQ(batch.size(), 4000u);
+  EXPECT_EQ(batch.message_offsets().size(), 1000u);
+  EXPECT_EQ(batch.message_offsets()[999], 3996u);
+  EXPECT_EQ(std::string(reinterpret_cast<char const*>(batch.data()) + 3996, 4), "abc\n");
+
+  batch.clear();
+  batch.append(message.data(), message.size(), "");
+  EXPECT_EQ(batch.size(), 3u);
+  EXPECT_EQ(batch.message_offsets().size(), 1u);
+}
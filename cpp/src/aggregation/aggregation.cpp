@@ -125,6 +125,21 @@ std::unique_ptr<aggregation> make_row_number_aggregation()
 {
   return std::make_unique<aggregation>(aggregation::ROW_NUMBER);
 }
+/// Factory to create a RANK aggregation
+std::unique_ptr<aggregation> make_rank_aggregation()
+{
+  return std::make_unique<aggregation>(aggregation::RANK);
+}
+/// Factory to create a DENSE_RANK aggregation
+std::unique_ptr<aggregation> make_dense_rank_aggregation()
+{
+  return std::make_unique<aggregation>(aggregation::DENSE_RANK);
+}
+/// Factory to create a PERCENT_RANK aggregation
+std::unique_ptr<aggregation> make_percent_rank_aggregation()
+{
+  return std::make_unique<aggregation>(aggregation::PERCENT_RANK);
+}
 /// Factory to create a COLLECT_LIST aggregation
 std::unique_ptr<aggregation> make_collect_list_aggregation(null_policy null_handling)
 {
@@ -147,6 +162,52 @@ std::unique_ptr<aggregation> make_lead_aggregation(size_type offset)
 {
   return std::make_unique<cudf::detail::lead_lag_aggregation>(aggregation::LEAD, offset);
 }
+/// Factory to create a M2 aggregation
+std::unique_ptr<aggregation> make_m2_aggregation()
+{
+  return std::make_unique<aggregation>(aggregation::M2);
+}
+/// Factory to create a MERGE_M2 aggregation
+std::unique_ptr<aggregation> make_merge_m2_aggregation()
+{
+  return std::make_unique<aggregation>(aggregation::MERGE_M2);
+}
+/// Factory to create a MERGE_LISTS aggregation
+std::unique_ptr<aggregation> make_merge_lists_aggregation()
+{
+  return std::make_unique<aggregation>(aggregation::MERGE_LISTS);
+}
+/// Factory to create a MERGE_SETS aggregation
+std::unique_ptr<aggregation> make_merge_sets_aggregation(null_equality nulls_equal,
+                                                         nan_equality nans_equal)
+{
+  return std::make_unique<detail::merge_sets_aggregation>(nulls_equal, nans_equal);
+}
+/// Factory to create an APPROX_COUNT_DISTINCT aggregation
+std::unique_ptr<aggregation> make_approx_count_distinct_aggregation(int precision)
+{
+  return std::make_unique<detail::hll_aggregation>(aggregation::APPROX_COUNT_DISTINCT, precision);
+}
+/// Factory to create a HLL_SKETCH aggregation
+std::unique_ptr<aggregation> make_hll_sketch_aggregation(int precision)
+{
+  return std::make_unique<detail::hll_aggregation>(aggregation::HLL_SKETCH, precision);
+}
+/// Factory to create a MERGE_HLL_SKETCH aggregation
+std::unique_ptr<aggregation> make_merge_hll_sketch_aggregation()
+{
+  return std::make_unique<aggregation>(aggregation::MERGE_HLL_SKETCH);
+}
+/// Factory to create a TDIGEST aggregation
+std::unique_ptr<aggregation> make_tdigest_aggregation(int max_centroids)
+{
+  return std::make_unique<detail::tdigest_aggregation>(aggregation::TDIGEST, max_centroids);
+}
+/// Factory to create a MERGE_TDIGEST aggregation
+std::unique_ptr<aggregation> make_merge_tdigest_aggregation(int max_centroids)
+{
+  return std::make_unique<detail::tdigest_aggregation>(aggregation::MERGE_TDIGEST, max_centroids);
+}
 /// Factory to create a UDF aggregation
 std::unique_ptr<aggregation> make_udf_aggregation(udf_type type,
                                                   std::string const& user_defined_aggregator,
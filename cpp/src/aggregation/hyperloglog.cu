@@ -0,0 +1,417 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/hyperloglog.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/reduce.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+constexpr int hash_bits = 32;
+
+/**
+ * @brief Computes the HyperLogLog estimate of a sketch of `num_registers` registers `M[j]`.
+ *
+ * @param num_registers Number of registers of the sketch
+ * @param inverse_sum Sum over the registers of `2^-M[j]`
+ * @param num_zeros Number of registers that are zero
+ */
+__device__ int64_t hll_estimate(size_type num_registers, double inverse_sum, size_type num_zeros)
+{
+  if (num_registers == 0) { return 0; }
+  double const m     = num_registers;
+  double const alpha = num_registers == 16   ? 0.673
+                       : num_registers == 32 ? 0.697
+                       : num_registers == 64 ? 0.709
+                                             : 0.7213 / (1.0 + 1.079 / m);
+  double const hash_range = 4294967296.0;
+
+  auto estimate = alpha * m * m / inverse_sum;
+  if (estimate <= 2.5 * m and num_zeros > 0) {
+    // Small range correction: linear counting of the zero registers
+    estimate = m * log(m / num_zeros);
+  } else if (estimate > hash_range / 30.0 and estimate < hash_range) {
+    // Large range correction for the collisions of the 32-bit hashes
+    estimate = -hash_range * log1p(-estimate / hash_range);
+  }
+  return llround(estimate);
+}
+
+/**
+ * @brief Maps each value to the `(group << precision) | register` key of the sketch register it
+ * updates and to the rank it updates the register with.
+ *
+ * A null value maps to the first register of its group with a rank of zero, which leaves the
+ * register unchanged.
+ */
+template <bool has_nulls>
+struct register_update_fn {
+  column_device_view d_values;
+  size_type const* d_labels;
+  int precision;
+
+  __device__ thrust::tuple<int64_t, int32_t> operator()(size_type i) const
+  {
+    auto const group_key = static_cast<int64_t>(d_labels[i]) << precision;
+    if (has_nulls and d_values.is_null(i)) { return thrust::make_tuple(group_key, 0); }
+    hash_value_type const hash = type_dispatcher(
+      d_values.type(), element_hasher_with_seed<MurmurHash3_32, false>{}, d_values, i);
+    auto const index = static_cast<int64_t>(hash >> (hash_bits - precision));
+    auto const rank  = min(__clz(static_cast<int32_t>(hash << precision)), hash_bits - precision);
+    return thrust::make_tuple(group_key | index, rank + 1);
+  }
+};
+
+/**
+ * @brief Computes the sorted keys of the sketch registers that the values update and the maximum
+ * rank of each.
+ */
+std::pair<rmm::device_uvector<int64_t>, rmm::device_uvector<int32_t>> sparse_registers(
+  column_view const& values,
+  cudf::device_span<size_type const> group_labels,
+  int precision,
+  rmm::cuda_stream_view stream)
+{
+  // Hash the keys of a dictionary so that the sketches do not depend on its encoding
+  auto const decoded = cudf::is_dictionary(values.type())
+                         ? dictionary::detail::decode(dictionary_column_view(values), stream)
+                         : std::unique_ptr<column>{};
+  auto const input    = decoded ? decoded->view() : values;
+  auto const d_values = column_device_view::create(input, stream);
+
+  rmm::device_uvector<int64_t> keys(input.size(), stream);
+  rmm::device_uvector<int32_t> ranks(input.size(), stream);
+  auto const updates = thrust::make_zip_iterator(thrust::make_tuple(keys.begin(), ranks.begin()));
+  if (input.has_nulls()) {
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(input.size()),
+                      updates,
+                      register_update_fn<true>{*d_values, group_labels.data(), precision});
+  } else {
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(input.size()),
+                      updates,
+                      register_update_fn<false>{*d_values, group_labels.data(), precision});
+  }
+  thrust::sort_by_key(rmm::exec_policy(stream), keys.begin(), keys.end(), ranks.begin());
+
+  rmm::device_uvector<int64_t> register_keys(keys.size(), stream);
+  rmm::device_uvector<int32_t> register_ranks(keys.size(), stream);
+  auto const ends = thrust::reduce_by_key(rmm::exec_policy(stream),
+                                          keys.begin(),
+                                          keys.end(),
+                                          ranks.begin(),
+                                          register_keys.begin(),
+                                          register_ranks.begin(),
+                                          thrust::equal_to<int64_t>{},
+                                          thrust::maximum<int32_t>{});
+  auto const num_registers = static_cast<std::size_t>(ends.first - register_keys.begin());
+  register_keys.resize(num_registers, stream);
+  register_ranks.resize(num_registers, stream);
+  return {std::move(register_keys), std::move(register_ranks)};
+}
+
+/**
+ * @brief Maps a register rank to its `(2^-rank - 1, rank != 0)` contribution to the inverse sum
+ * and the number of nonzero registers of its sketch.
+ */
+struct register_term_fn {
+  __device__ thrust::tuple<double, size_type> operator()(int32_t rank) const
+  {
+    return rank == 0 ? thrust::make_tuple(0.0, 0) : thrust::make_tuple(ldexp(1.0, -rank) - 1, 1);
+  }
+};
+
+struct register_term_sum_fn {
+  __device__ thrust::tuple<double, size_type> operator()(
+    thrust::tuple<double, size_type> const& lhs, thrust::tuple<double, size_type> const& rhs) const
+  {
+    return thrust::make_tuple(thrust::get<0>(lhs) + thrust::get<0>(rhs),
+                              thrust::get<1>(lhs) + thrust::get<1>(rhs));
+  }
+};
+
+/**
+ * @brief Returns the number of registers of a sketch, or -1 for a null sketch.
+ */
+struct sketch_size_fn {
+  column_device_view d_sketches;
+  offset_type const* d_offsets;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    return d_sketches.is_null(i) ? -1 : d_offsets[i + 1] - d_offsets[i];
+  }
+};
+
+/**
+ * @brief Computes a register of a merged sketch as the maximum of that register over the valid
+ * sketches of its group.
+ */
+struct merge_register_fn {
+  column_device_view d_sketches;
+  offset_type const* d_offsets;
+  uint8_t const* d_registers;
+  size_type const* d_group_offsets;
+  size_type num_registers;
+
+  __device__ uint8_t operator()(size_type i) const
+  {
+    auto const group = i / num_registers;
+    auto const index = i % num_registers;
+    uint8_t merged{0};
+    for (auto row = d_group_offsets[group]; row < d_group_offsets[group + 1]; ++row) {
+      if (d_sketches.is_null(row)) { continue; }
+      auto const value = d_registers[d_offsets[row] + index];
+      if (value > merged) { merged = value; }
+    }
+    return merged;
+  }
+};
+
+/**
+ * @brief Estimates the number of distinct elements of a dense sketch.
+ */
+struct sketch_estimate_fn {
+  offset_type const* d_offsets;
+  uint8_t const* d_registers;
+
+  __device__ int64_t operator()(size_type i) const
+  {
+    double inverse_sum{0};
+    size_type num_zeros{0};
+    for (auto j = d_offsets[i]; j < d_offsets[i + 1]; ++j) {
+      inverse_sum += ldexp(1.0, -static_cast<int>(d_registers[j]));
+      num_zeros += d_registers[j] == 0;
+    }
+    return hll_estimate(d_offsets[i + 1] - d_offsets[i], inverse_sum, num_zeros);
+  }
+};
+
+/**
+ * @brief Makes a lists column of `num_groups` sketches of `num_registers` registers each.
+ */
+std::unique_ptr<column> make_sketches_column(size_type num_groups,
+                                             size_type num_registers,
+                                             std::unique_ptr<column>&& registers,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  auto offsets = make_numeric_column(
+    data_type(type_to_id<offset_type>()), num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::sequence(rmm::exec_policy(stream),
+                   offsets->mutable_view().begin<offset_type>(),
+                   offsets->mutable_view().end<offset_type>(),
+                   0,
+                   num_registers);
+  return make_lists_column(num_groups,
+                           std::move(offsets),
+                           std::move(registers),
+                           0,
+                           rmm::device_buffer{0, stream, mr},
+                           stream,
+                           mr);
+}
+
+}  // namespace
+
+std::unique_ptr<column> group_hll_sketch(column_view const& values,
+                                         cudf::device_span<size_type const> group_labels,
+                                         size_type num_groups,
+                                         int precision,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS((static_cast<int64_t>(num_groups) << precision) <=
+                 std::numeric_limits<size_type>::max(),
+               "Too many HyperLogLog sketch registers for the size of a column.");
+  auto const num_registers = size_type{1} << precision;
+
+  auto registers   = make_numeric_column(data_type{type_id::UINT8},
+                                       num_groups * num_registers,
+                                       mask_state::UNALLOCATED,
+                                       stream,
+                                       mr);
+  auto d_registers = registers->mutable_view().data<uint8_t>();
+  thrust::fill(
+    rmm::exec_policy(stream), d_registers, d_registers + registers->size(), uint8_t{0});
+  if (not values.is_empty()) {
+    auto const [keys, ranks] = sparse_registers(values, group_labels, precision, stream);
+    thrust::scatter(
+      rmm::exec_policy(stream), ranks.begin(), ranks.end(), keys.begin(), d_registers);
+  }
+
+  return make_sketches_column(num_groups, num_registers, std::move(registers), stream, mr);
+}
+
+std::unique_ptr<column> group_approx_count_distinct(column_view const& values,
+                                                    cudf::device_span<size_type const> group_labels,
+                                                    size_type num_groups,
+                                                    int precision,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  auto result = make_numeric_column(
+    data_type{type_id::INT64}, num_groups, mask_state::UNALLOCATED, stream, mr);
+  if (num_groups == 0) { return result; }
+
+  // Only the registers that some value updates are materialized: the others are zero, so each
+  // contributes one to the inverse sum of its sketch
+  auto const [keys, ranks] = sparse_registers(values, group_labels, precision, stream);
+  rmm::device_uvector<double> inverse_sums(num_groups, stream);
+  rmm::device_uvector<size_type> num_nonzeros(num_groups, stream);
+  auto const group_keys = thrust::make_transform_iterator(
+    keys.begin(), [precision] __device__(int64_t key) { return key >> precision; });
+  thrust::reduce_by_key(
+    rmm::exec_policy(stream),
+    group_keys,
+    group_keys + keys.size(),
+    thrust::make_transform_iterator(ranks.begin(), register_term_fn{}),
+    thrust::make_discard_iterator(),
+    thrust::make_zip_iterator(thrust::make_tuple(inverse_sums.begin(), num_nonzeros.begin())),
+    thrust::equal_to<int64_t>{},
+    register_term_sum_fn{});
+
+  auto const num_registers = size_type{1} << precision;
+  thrust::transform(rmm::exec_policy(stream),
+                    inverse_sums.begin(),
+                    inverse_sums.end(),
+                    num_nonzeros.begin(),
+                    result->mutable_view().begin<int64_t>(),
+                    [num_registers] __device__(double inverse_sum, size_type num_nonzero) {
+                      return hll_estimate(
+                        num_registers, num_registers + inverse_sum, num_registers - num_nonzero);
+                    });
+  return result;
+}
+
+std::unique_ptr<column> group_merge_hll_sketch(column_view const& sketches,
+                                               cudf::device_span<size_type const> group_offsets,
+                                               size_type num_groups,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(sketches.type().id() == type_id::LIST,
+               "HyperLogLog sketches must be a LIST<UINT8> column.");
+  auto const lists = lists_column_view(sketches);
+  CUDF_EXPECTS(sketches.is_empty() or lists.child().type().id() == type_id::UINT8,
+               "HyperLogLog sketches must be a LIST<UINT8> column.");
+
+  auto const d_sketches = column_device_view::create(sketches, stream);
+  auto const sizes =
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                    sketch_size_fn{*d_sketches, lists.offsets_begin()});
+  auto const num_registers = std::max(
+    thrust::reduce(
+      rmm::exec_policy(stream), sizes, sizes + sketches.size(), -1, thrust::maximum<size_type>{}),
+    0);
+  CUDF_EXPECTS(thrust::all_of(rmm::exec_policy(stream),
+                              sizes,
+                              sizes + sketches.size(),
+                              [num_registers] __device__(size_type size) {
+                                return size == -1 or size == num_registers;
+                              }),
+               "All HyperLogLog sketches must have the same number of registers.");
+  CUDF_EXPECTS(static_cast<int64_t>(num_groups) * num_registers <=
+                 std::numeric_limits<size_type>::max(),
+               "Too many HyperLogLog sketch registers for the size of a column.");
+
+  auto registers = make_numeric_column(data_type{type_id::UINT8},
+                                       num_groups * num_registers,
+                                       mask_state::UNALLOCATED,
+                                       stream,
+                                       mr);
+  if (registers->size() > 0) {
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(registers->size()),
+                      registers->mutable_view().begin<uint8_t>(),
+                      merge_register_fn{*d_sketches,
+                                        lists.offsets_begin(),
+                                        lists.child().data<uint8_t>(),
+                                        group_offsets.data(),
+                                        num_registers});
+  }
+
+  return make_sketches_column(num_groups, num_registers, std::move(registers), stream, mr);
+}
+
+std::unique_ptr<column> approx_distinct_count(lists_column_view const& sketches,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(sketches.is_empty() or sketches.child().type().id() == type_id::UINT8,
+               "HyperLogLog sketches must be a LIST<UINT8> column.");
+
+  auto result = make_numeric_column(data_type{type_id::INT64},
+                                    sketches.size(),
+                                    cudf::detail::copy_bitmask(sketches.parent(), stream, mr),
+                                    sketches.null_count(),
+                                    stream,
+                                    mr);
+  if (sketches.is_empty()) { return result; }
+
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(sketches.size()),
+                    result->mutable_view().begin<int64_t>(),
+                    sketch_estimate_fn{sketches.offsets_begin(),
+                                       sketches.child().data<uint8_t>()});
+  return result;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> approx_distinct_count(lists_column_view const& sketches,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::approx_distinct_count(sketches, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,559 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/tdigest.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/quantiles.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// Children of a t-digest
+constexpr int centroids_child_index = 0;
+constexpr int min_child_index       = 1;
+constexpr int max_child_index       = 2;
+// Children of a centroid
+constexpr int mean_child_index   = 0;
+constexpr int weight_child_index = 1;
+
+constexpr double pi = 3.14159265358979323846;
+
+/**
+ * @brief Maps each weighted point to the `group * max_centroids + cluster` key of the centroid it
+ * is merged into.
+ *
+ * The cluster of a point is given by the `k1` scale function of the quantile of its left edge
+ * within its group.
+ */
+struct cluster_key_fn {
+  size_type const* d_groups;
+  double const* d_weights;
+  double const* d_cumulative_weights;
+  double const* d_group_weights;
+  int max_centroids;
+
+  __device__ int64_t operator()(size_type i) const
+  {
+    auto const group = d_groups[i];
+    auto const q     = min(
+      max((d_cumulative_weights[i] - d_weights[i]) / d_group_weights[group], 0.0), 1.0);
+    auto const k       = static_cast<int64_t>(max_centroids / pi * (asin(2 * q - 1) + pi / 2));
+    auto const cluster = k < max_centroids ? k : max_centroids - 1;
+    return static_cast<int64_t>(group) * max_centroids + cluster;
+  }
+};
+
+struct weighted_sum_fn {
+  __device__ thrust::tuple<double, double> operator()(
+    thrust::tuple<double, double> const& lhs, thrust::tuple<double, double> const& rhs) const
+  {
+    return thrust::make_tuple(thrust::get<0>(lhs) + thrust::get<0>(rhs),
+                              thrust::get<1>(lhs) + thrust::get<1>(rhs));
+  }
+};
+
+/**
+ * @brief Clusters weighted points sorted by group then by mean into the t-digest of each group.
+ */
+std::unique_ptr<column> make_tdigest_column(cudf::device_span<size_type const> groups,
+                                            cudf::device_span<double const> means,
+                                            cudf::device_span<double const> weights,
+                                            std::unique_ptr<column>&& min_column,
+                                            std::unique_ptr<column>&& max_column,
+                                            size_type num_groups,
+                                            int max_centroids,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  auto const num_points = static_cast<size_type>(groups.size());
+
+  // Cumulative weight of each point within its group, and total weight of each group
+  rmm::device_uvector<double> cumulative_weights(num_points, stream);
+  thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                groups.begin(),
+                                groups.end(),
+                                weights.begin(),
+                                cumulative_weights.begin());
+  rmm::device_uvector<double> group_weights(num_groups, stream);
+  thrust::fill(rmm::exec_policy(stream), group_weights.begin(), group_weights.end(), 0.0);
+  rmm::device_uvector<size_type> weighted_groups(num_points, stream);
+  rmm::device_uvector<double> weighted_group_totals(num_points, stream);
+  auto const group_ends = thrust::reduce_by_key(rmm::exec_policy(stream),
+                                                groups.begin(),
+                                                groups.end(),
+                                                weights.begin(),
+                                                weighted_groups.begin(),
+                                                weighted_group_totals.begin());
+  thrust::scatter(rmm::exec_policy(stream),
+                  weighted_group_totals.begin(),
+                  group_ends.second,
+                  weighted_groups.begin(),
+                  group_weights.begin());
+
+  // Merge the points of each cluster into a centroid
+  auto const cluster_keys = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    cluster_key_fn{groups.data(),
+                   weights.data(),
+                   cumulative_weights.data(),
+                   group_weights.data(),
+                   max_centroids});
+  auto const weighted_means = thrust::make_transform_iterator(
+    thrust::make_zip_iterator(thrust::make_tuple(means.begin(), weights.begin())),
+    [] __device__(thrust::tuple<double, double> const& point) {
+      return thrust::make_tuple(thrust::get<0>(point) * thrust::get<1>(point),
+                                thrust::get<1>(point));
+    });
+  rmm::device_uvector<int64_t> centroid_keys(num_points, stream);
+  rmm::device_uvector<double> centroid_sums(num_points, stream);
+  rmm::device_uvector<double> centroid_weights(num_points, stream);
+  auto const centroid_ends = thrust::reduce_by_key(
+    rmm::exec_policy(stream),
+    cluster_keys,
+    cluster_keys + num_points,
+    weighted_means,
+    centroid_keys.begin(),
+    thrust::make_zip_iterator(thrust::make_tuple(centroid_sums.begin(), centroid_weights.begin())),
+    thrust::equal_to<int64_t>{},
+    weighted_sum_fn{});
+  auto const num_centroids =
+    static_cast<size_type>(centroid_ends.first - centroid_keys.begin());
+
+  auto mean_column = make_numeric_column(
+    data_type{type_id::FLOAT64}, num_centroids, mask_state::UNALLOCATED, stream, mr);
+  auto weight_column = make_numeric_column(
+    data_type{type_id::FLOAT64}, num_centroids, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    centroid_sums.begin(),
+                    centroid_sums.begin() + num_centroids,
+                    centroid_weights.begin(),
+                    mean_column->mutable_view().begin<double>(),
+                    thrust::divides<double>{});
+  thrust::copy(rmm::exec_policy(stream),
+               centroid_weights.begin(),
+               centroid_weights.begin() + num_centroids,
+               weight_column->mutable_view().begin<double>());
+
+  // The centroids of a group start at the first centroid whose key is in the group
+  auto offsets = make_numeric_column(
+    data_type(type_to_id<offset_type>()), num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+  auto const centroid_groups = thrust::make_transform_iterator(
+    centroid_keys.begin(), [max_centroids] __device__(int64_t key) {
+      return static_cast<size_type>(key / max_centroids);
+    });
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      centroid_groups,
+                      centroid_groups + num_centroids,
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_groups + 1),
+                      offsets->mutable_view().begin<offset_type>());
+
+  std::vector<std::unique_ptr<column>> centroid_children;
+  centroid_children.push_back(std::move(mean_column));
+  centroid_children.push_back(std::move(weight_column));
+  auto centroids = make_structs_column(
+    num_centroids, std::move(centroid_children), 0, rmm::device_buffer{0, stream, mr}, stream, mr);
+
+  std::vector<std::unique_ptr<column>> children;
+  children.push_back(make_lists_column(num_groups,
+                                       std::move(offsets),
+                                       std::move(centroids),
+                                       0,
+                                       rmm::device_buffer{0, stream, mr},
+                                       stream,
+                                       mr));
+  children.push_back(std::move(min_column));
+  children.push_back(std::move(max_column));
+  return make_structs_column(
+    num_groups, std::move(children), 0, rmm::device_buffer{0, stream, mr}, stream, mr);
+}
+
+/**
+ * @brief Maps each centroid of the digests to the group of the digest it belongs to.
+ */
+struct centroid_group_fn {
+  offset_type const* d_offsets;
+  size_type num_digests;
+  size_type const* d_group_labels;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    auto const centroid = d_offsets[0] + i;
+    auto const digest   = thrust::upper_bound(
+                          thrust::seq, d_offsets + 1, d_offsets + num_digests + 1, centroid) -
+                        (d_offsets + 1);
+    return d_group_labels[digest];
+  }
+};
+
+/**
+ * @brief Returns whether a digest is valid and has centroids.
+ */
+struct has_centroids_fn {
+  column_device_view d_digests;
+  offset_type const* d_offsets;
+
+  __device__ bool operator()(size_type i) const
+  {
+    return d_digests.is_valid(i) and d_offsets[i] != d_offsets[i + 1];
+  }
+};
+
+/**
+ * @brief Interpolates the approximate value of each percentile of a digest.
+ *
+ * The centroids of a digest are points at the middle of their weight, and the minimum and maximum
+ * are points at the ends of the digest's total weight. A percentile is interpolated linearly
+ * between the two points around it.
+ */
+struct percentile_fn {
+  offset_type const* d_offsets;
+  double const* d_means;
+  double const* d_weights;
+  double const* d_mins;
+  double const* d_maxs;
+  double const* d_percentiles;
+  size_type num_percentiles;
+  offset_type const* d_result_offsets;
+  double* d_results;
+
+  __device__ static double interpolate(
+    double lhs_position, double lhs_value, double rhs_position, double rhs_value, double position)
+  {
+    if (rhs_position <= lhs_position) { return rhs_value; }
+    return lhs_value +
+           (rhs_value - lhs_value) * (position - lhs_position) / (rhs_position - lhs_position);
+  }
+
+  __device__ double percentile(size_type digest, double total_weight, double p) const
+  {
+    auto const position = min(max(p, 0.0), 1.0) * total_weight;
+
+    double lhs_position{0};
+    double lhs_value{d_mins[digest]};
+    double cumulative_weight{0};
+    for (auto c = d_offsets[digest]; c < d_offsets[digest + 1]; ++c) {
+      auto const rhs_position = cumulative_weight + d_weights[c] / 2;
+      if (position <= rhs_position) {
+        return interpolate(lhs_position, lhs_value, rhs_position, d_means[c], position);
+      }
+      lhs_position = rhs_position;
+      lhs_value    = d_means[c];
+      cumulative_weight += d_weights[c];
+    }
+    return interpolate(lhs_position, lhs_value, total_weight, d_maxs[digest], position);
+  }
+
+  __device__ void operator()(size_type digest) const
+  {
+    // A digest without percentiles has an empty list
+    if (d_result_offsets[digest] == d_result_offsets[digest + 1]) { return; }
+
+    double total_weight{0};
+    for (auto c = d_offsets[digest]; c < d_offsets[digest + 1]; ++c) {
+      total_weight += d_weights[c];
+    }
+    for (size_type i = 0; i < num_percentiles; ++i) {
+      d_results[d_result_offsets[digest] + i] = percentile(digest, total_weight, d_percentiles[i]);
+    }
+  }
+};
+
+void expects_tdigests(column_view const& digests)
+{
+  CUDF_EXPECTS(
+    digests.type().id() == type_id::STRUCT and digests.num_children() == 3 and
+      digests.child(centroids_child_index).type().id() == type_id::LIST and
+      digests.child(min_child_index).type().id() == type_id::FLOAT64 and
+      digests.child(max_child_index).type().id() == type_id::FLOAT64,
+    "t-digests must be a structs column of [LIST<STRUCT<FLOAT64, FLOAT64>>, FLOAT64, FLOAT64].");
+}
+
+}  // namespace
+
+std::unique_ptr<column> group_tdigest(column_view const& sorted_values,
+                                      column_view const& group_sizes,
+                                      cudf::device_span<size_type const> group_offsets,
+                                      cudf::device_span<size_type const> group_labels,
+                                      size_type num_groups,
+                                      int max_centroids,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  auto const cast_values =
+    sorted_values.type().id() == type_id::FLOAT64
+      ? std::unique_ptr<column>{}
+      : cudf::detail::cast(sorted_values, data_type{type_id::FLOAT64}, stream);
+  auto const values    = cast_values ? cast_values->view() : sorted_values;
+  auto const d_values  = values.data<double>();
+  auto const d_sizes   = group_sizes.data<size_type>();
+  auto const d_offsets = group_offsets.data();
+  auto const d_labels  = group_labels.data();
+
+  // The valid values of a group are sorted first in the group
+  auto const is_valid_value = [d_sizes, d_offsets, d_labels] __device__(size_type i) {
+    auto const group = d_labels[i];
+    return i - d_offsets[group] < d_sizes[group];
+  };
+  auto const num_points = static_cast<size_type>(
+    thrust::count_if(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     thrust::make_counting_iterator<size_type>(values.size()),
+                     is_valid_value));
+  rmm::device_uvector<size_type> groups(num_points, stream);
+  rmm::device_uvector<double> means(num_points, stream);
+  rmm::device_uvector<double> weights(num_points, stream);
+  thrust::copy_if(rmm::exec_policy(stream),
+                  thrust::make_zip_iterator(thrust::make_tuple(d_labels, d_values)),
+                  thrust::make_zip_iterator(thrust::make_tuple(d_labels, d_values)) + values.size(),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_zip_iterator(thrust::make_tuple(groups.begin(), means.begin())),
+                  is_valid_value);
+  thrust::fill(rmm::exec_policy(stream), weights.begin(), weights.end(), 1.0);
+
+  auto min_column = make_numeric_column(
+    data_type{type_id::FLOAT64}, num_groups, mask_state::UNALLOCATED, stream, mr);
+  auto max_column = make_numeric_column(
+    data_type{type_id::FLOAT64}, num_groups, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_groups),
+    thrust::make_zip_iterator(thrust::make_tuple(min_column->mutable_view().begin<double>(),
+                                                 max_column->mutable_view().begin<double>())),
+    [d_values, d_sizes, d_offsets] __device__(size_type group) {
+      if (d_sizes[group] == 0) { return thrust::make_tuple(0.0, 0.0); }
+      return thrust::make_tuple(d_values[d_offsets[group]],
+                                d_values[d_offsets[group] + d_sizes[group] - 1]);
+    });
+
+  return make_tdigest_column(groups,
+                             means,
+                             weights,
+                             std::move(min_column),
+                             std::move(max_column),
+                             num_groups,
+                             max_centroids,
+                             stream,
+                             mr);
+}
+
+std::unique_ptr<column> group_merge_tdigest(column_view const& digests,
+                                            cudf::device_span<size_type const> group_labels,
+                                            size_type num_groups,
+                                            int max_centroids,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  expects_tdigests(digests);
+
+  auto const digests_view = structs_column_view(digests);
+  auto const centroid_lists =
+    lists_column_view(digests_view.get_sliced_child(centroids_child_index));
+  auto const centroids  = structs_column_view(centroid_lists.get_sliced_child(stream));
+  auto const num_points = centroids.size();
+
+  // Gather the centroids of each group, sorted by mean
+  rmm::device_uvector<size_type> groups(num_points, stream);
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_points),
+    groups.begin(),
+    centroid_group_fn{centroid_lists.offsets_begin(), digests.size(), group_labels.data()});
+  auto means = cudf::detail::make_device_uvector_async(
+    cudf::device_span<double const>{
+      centroids.get_sliced_child(mean_child_index).data<double>(),
+      static_cast<std::size_t>(num_points)},
+    stream);
+  auto weights = cudf::detail::make_device_uvector_async(
+    cudf::device_span<double const>{
+      centroids.get_sliced_child(weight_child_index).data<double>(),
+      static_cast<std::size_t>(num_points)},
+    stream);
+  thrust::stable_sort_by_key(
+    rmm::exec_policy(stream),
+    means.begin(),
+    means.end(),
+    thrust::make_zip_iterator(thrust::make_tuple(groups.begin(), weights.begin())));
+  thrust::stable_sort_by_key(
+    rmm::exec_policy(stream),
+    groups.begin(),
+    groups.end(),
+    thrust::make_zip_iterator(thrust::make_tuple(means.begin(), weights.begin())));
+
+  // The minimum and maximum of a group are over its digests with centroids
+  auto min_column = make_numeric_column(
+    data_type{type_id::FLOAT64}, num_groups, mask_state::UNALLOCATED, stream, mr);
+  auto max_column = make_numeric_column(
+    data_type{type_id::FLOAT64}, num_groups, mask_state::UNALLOCATED, stream, mr);
+  auto const d_offsets = centroid_lists.offsets_begin();
+  auto const d_mins    = digests_view.get_sliced_child(min_child_index).data<double>();
+  auto const d_maxs    = digests_view.get_sliced_child(max_child_index).data<double>();
+
+  auto const digest_extremes = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [d_offsets, d_mins, d_maxs] __device__(size_type i) {
+      return d_offsets[i] == d_offsets[i + 1]
+               ? thrust::make_tuple(std::numeric_limits<double>::infinity(),
+                                    -std::numeric_limits<double>::infinity())
+               : thrust::make_tuple(d_mins[i], d_maxs[i]);
+    });
+  auto const group_extremes = thrust::make_zip_iterator(thrust::make_tuple(
+    min_column->mutable_view().begin<double>(), max_column->mutable_view().begin<double>()));
+  thrust::reduce_by_key(rmm::exec_policy(stream),
+                        group_labels.begin(),
+                        group_labels.end(),
+                        digest_extremes,
+                        thrust::make_discard_iterator(),
+                        group_extremes,
+                        thrust::equal_to<size_type>{},
+                        [] __device__(thrust::tuple<double, double> const& lhs,
+                                      thrust::tuple<double, double> const& rhs) {
+                          return thrust::make_tuple(
+                            min(thrust::get<0>(lhs), thrust::get<0>(rhs)),
+                            max(thrust::get<1>(lhs), thrust::get<1>(rhs)));
+                        });
+  thrust::transform(rmm::exec_policy(stream),
+                    group_extremes,
+                    group_extremes + num_groups,
+                    group_extremes,
+                    [] __device__(thrust::tuple<double, double> const& extremes) {
+                      return thrust::get<0>(extremes) > thrust::get<1>(extremes)
+                               ? thrust::make_tuple(0.0, 0.0)
+                               : extremes;
+                    });
+
+  return make_tdigest_column(groups,
+                             means,
+                             weights,
+                             std::move(min_column),
+                             std::move(max_column),
+                             num_groups,
+                             max_centroids,
+                             stream,
+                             mr);
+}
+
+std::unique_ptr<column> percentile_approx(column_view const& digests,
+                                          std::vector<double> const& percentiles,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  expects_tdigests(digests);
+  if (digests.is_empty()) { return make_empty_column(data_type{type_id::LIST}); }
+
+  auto const digests_view = structs_column_view(digests);
+  auto const centroid_lists =
+    lists_column_view(digests_view.get_sliced_child(centroids_child_index));
+  auto const centroids       = structs_column_view(centroid_lists.child());
+  auto const num_digests     = digests.size();
+  auto const num_percentiles = static_cast<size_type>(percentiles.size());
+  auto const d_percentiles   = cudf::detail::make_device_uvector_async(percentiles, stream);
+
+  // A null digest or a digest without centroids has a null, empty list of percentiles
+  auto const d_digests     = column_device_view::create(digests, stream);
+  auto const has_centroids = has_centroids_fn{*d_digests, centroid_lists.offsets_begin()};
+  auto [null_mask, null_count] =
+    cudf::detail::valid_if(thrust::make_counting_iterator<size_type>(0),
+                           thrust::make_counting_iterator<size_type>(num_digests),
+                           has_centroids,
+                           stream,
+                           mr);
+  auto offsets = make_numeric_column(
+    data_type(type_to_id<offset_type>()), num_digests + 1, mask_state::UNALLOCATED, stream, mr);
+  auto const sizes = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [has_centroids, num_digests, num_percentiles] __device__(size_type i) {
+      return i < num_digests and has_centroids(i) ? num_percentiles : 0;
+    });
+  thrust::exclusive_scan(rmm::exec_policy(stream),
+                         sizes,
+                         sizes + num_digests + 1,
+                         offsets->mutable_view().begin<offset_type>());
+
+  auto values = make_numeric_column(
+    data_type{type_id::FLOAT64},
+    cudf::detail::get_value<offset_type>(offsets->view(), num_digests, stream),
+    mask_state::UNALLOCATED,
+    stream,
+    mr);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_digests,
+                     percentile_fn{centroid_lists.offsets_begin(),
+                                   centroids.get_sliced_child(mean_child_index).data<double>(),
+                                   centroids.get_sliced_child(weight_child_index).data<double>(),
+                                   digests_view.get_sliced_child(min_child_index).data<double>(),
+                                   digests_view.get_sliced_child(max_child_index).data<double>(),
+                                   d_percentiles.data(),
+                                   num_percentiles,
+                                   offsets->view().data<offset_type>(),
+                                   values->mutable_view().data<double>()});
+
+  return make_lists_column(num_digests,
+                           std::move(offsets),
+                           std::move(values),
+                           null_count,
+                           std::move(null_mask),
+                           stream,
+                           mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> percentile_approx(column_view const& digests,
+                                          std::vector<double> const& percentiles,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::percentile_approx(digests, percentiles, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include Jitify's cstddef header first
+#include <cstddef>
+
+#include <cuda/std/climits>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+#include <cudf/types.hpp>
+
+#include <ast/jit/operation-udf.hpp>
+
+namespace cudf {
+namespace ast {
+namespace jit {
+
+/**
+ * @brief Kernel evaluating a generated expression function on every row of a table.
+ *
+ * `GENERIC_EXPRESSION` is generated from the linearized expression and reads the row of every
+ * column and literal it references from `columns` and `literals`.
+ *
+ * @param size Number of rows of the table
+ * @param out_data The output column data
+ * @param columns Data of the table columns, in column order
+ * @param literals Device values of the literals, in linearizer order
+ */
+template <typename TypeOut>
+__global__ void kernel(cudf::size_type size,
+                       TypeOut* out_data,
+                       void const* const* columns,
+                       void const* const* literals)
+{
+  int tid    = threadIdx.x;
+  int blkid  = blockIdx.x;
+  int blksz  = blockDim.x;
+  int gridsz = gridDim.x;
+
+  int start = tid + blkid * blksz;
+  int step  = blksz * gridsz;
+
+  for (cudf::size_type i = start; i < size; i += step) {
+    out_data[i] = GENERIC_EXPRESSION(columns, literals, i);
+  }
+}
+
+}  // namespace jit
+}  // namespace ast
+}  // namespace cudf
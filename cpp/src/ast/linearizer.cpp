@@ -26,8 +26,10 @@
 #include <thrust/iterator/transform_iterator.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <iterator>
+#include <vector>
 
 namespace cudf {
 
@@ -94,6 +96,49 @@ cudf::size_type linearizer::intermediate_counter::find_first_missing() const
            : used_values.size();  // No missing elements. Return the next element in the sequence.
 }
 
+/**
+ * @brief Assigns a value number to every node of the expression tree.
+ *
+ * Columns are numbered by their table and index, literals by the scalar they view, and
+ * expressions by their operator and the value numbers of their operands, so structurally equal
+ * subtrees share a number. Every operand of a newly numbered expression counts as one use of the
+ * operand's value.
+ *
+ * @param expr The root of the subtree to number.
+ * @return cudf::size_type The value number of `expr`.
+ */
+cudf::size_type linearizer::number_values(detail::node const& expr)
+{
+  auto key            = std::vector<std::int64_t>();
+  auto operand_values = std::vector<cudf::size_type>();
+  if (auto const col = dynamic_cast<column_reference const*>(&expr)) {
+    key = {0, static_cast<std::int64_t>(col->get_table_source()), col->get_column_index()};
+  } else if (auto const lit = dynamic_cast<literal const*>(&expr)) {
+    key = {1, static_cast<std::int64_t>(reinterpret_cast<std::intptr_t>(&lit->get_scalar()))};
+  } else {
+    auto const& op_expr = dynamic_cast<expression const&>(expr);
+    auto const operands = op_expr.get_operands();
+    std::transform(operands.cbegin(),
+                   operands.cend(),
+                   std::back_inserter(operand_values),
+                   [this](auto const& operand) { return number_values(operand.get()); });
+    key = {2, static_cast<std::int64_t>(op_expr.get_operator())};
+    key.insert(key.end(), operand_values.cbegin(), operand_values.cend());
+  }
+
+  auto const inserted = _value_keys.emplace(std::move(key), _value_keys.size());
+  auto const value    = inserted.first->second;
+  if (inserted.second) {
+    _remaining_uses.push_back(0);
+    _value_references.push_back(-1);
+    for (auto const operand_value : operand_values) {
+      ++_remaining_uses[operand_value];
+    }
+  }
+  _value_numbers[&expr] = value;
+  return value;
+}
+
 cudf::size_type linearizer::visit(literal const& expr)
 {
   _node_count++;                                                 // Increment the node index
@@ -101,6 +146,7 @@ cudf::size_type linearizer::visit(literal const& expr)
   auto device_view         = expr.get_value();                   // Construct a scalar device view
   auto const literal_index = cudf::size_type(_literals.size());  // Push literal
   _literals.push_back(device_view);
+  _literal_scalars.push_back(expr.get_scalar());
   auto const source = detail::device_data_reference(
     detail::device_data_reference_type::LITERAL, data_type, literal_index);  // Push data reference
   return add_data_reference(source);
@@ -111,7 +157,7 @@ cudf::size_type linearizer::visit(column_reference const& expr)
   // Increment the node index
   _node_count++;
   // Resolve node type
-  auto const data_type = expr.get_data_type(_table);
+  auto const data_type = expr.get_data_type(_table, _right_table);
   // Push data reference
   auto const source = detail::device_data_reference(detail::device_data_reference_type::COLUMN,
                                                     data_type,
@@ -132,23 +178,29 @@ cudf::size_type linearizer::visit(expression const& expr)
   auto end      = begin + operand_data_ref_indices.size();
   auto const operand_types = std::vector<cudf::data_type>(begin, end);
 
-  // Validate types of operand data references match
-  if (std::adjacent_find(operand_types.cbegin(), operand_types.cend(), std::not_equal_to<>()) !=
+  // Validate types of operand data references match. The first operand of a ternary operator is
+  // its boolean condition and is not compared with the others.
+  auto const is_ternary = operand_types.size() == 3;
+  if (is_ternary && operand_types.front().id() != cudf::type_id::BOOL8) {
+    CUDF_FAIL("An AST expression was provided a non-boolean condition.");
+  }
+  auto const compared_types_begin = operand_types.cbegin() + (is_ternary ? 1 : 0);
+  if (std::adjacent_find(compared_types_begin, operand_types.cend(), std::not_equal_to<>()) !=
       operand_types.cend()) {
     CUDF_FAIL("An AST expression was provided non-matching operand types.");
   }
 
-  // Give back intermediate storage locations that are consumed by this operation
-  std::for_each(
-    operand_data_ref_indices.cbegin(),
-    operand_data_ref_indices.cend(),
-    [this](auto const& data_reference_index) {
-      auto const operand_source = data_references()[data_reference_index];
-      if (operand_source.reference_type == detail::device_data_reference_type::INTERMEDIATE) {
-        auto const intermediate_index = operand_source.data_index;
-        _intermediate_counter.give(intermediate_index);
-      }
-    });
+  // Give back intermediate storage locations whose last use is this operation
+  auto const operands = expr.get_operands();
+  std::for_each(operands.cbegin(), operands.cend(), [this](auto const& operand) {
+    auto const value = _value_numbers.at(&operand.get());
+    if (--_remaining_uses[value] > 0) { return; }
+    auto const operand_source = data_references()[_value_references[value]];
+    if (operand_source.reference_type == detail::device_data_reference_type::INTERMEDIATE) {
+      auto const intermediate_index = operand_source.data_index;
+      _intermediate_counter.give(intermediate_index);
+    }
+  });
   // Resolve node type
   auto const op        = expr.get_operator();
   auto const data_type = cudf::ast::detail::ast_operator_return_type(op, operand_types);
@@ -192,8 +244,10 @@ std::vector<cudf::size_type> linearizer::visit_operands(
 {
   auto operand_data_reference_indices = std::vector<cudf::size_type>();
   for (auto const& operand : operands) {
-    auto const operand_data_reference_index = operand.get().accept(*this);
-    operand_data_reference_indices.push_back(operand_data_reference_index);
+    // A common subexpression is only evaluated at its first occurrence
+    auto const value = _value_numbers.at(&operand.get());
+    if (_value_references[value] < 0) { _value_references[value] = operand.get().accept(*this); }
+    operand_data_reference_indices.push_back(_value_references[value]);
   }
   return operand_data_reference_indices;
 }
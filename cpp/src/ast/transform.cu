@@ -32,6 +32,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
+#include <rmm/device_scalar.hpp>
 #include <rmm/mr/device/device_memory_resource.hpp>
 
 #include <algorithm>
@@ -50,6 +51,9 @@ namespace detail {
  * transform.
  *
  * @tparam block_size
+ * @tparam has_nulls Whether the expression may produce nulls. If so, the validity of intermediates
+ * is stored after the intermediates of all threads of the block in shared memory, and the output
+ * column has a null mask initialized to all null.
  * @param table The table device view used for evaluation.
  * @param literals Array of literal values used for evaluation.
  * @param output_column The output column where results are stored.
@@ -59,30 +63,57 @@ namespace detail {
  * @param num_operators Number of operators.
  * @param num_intermediates Number of intermediates, used to allocate a portion of shared memory to
  * each thread.
+ * @param valid_count Incremented by the number of valid output rows if `has_nulls`.
  */
-template <cudf::size_type max_block_size>
+template <cudf::size_type max_block_size, bool has_nulls>
 __launch_bounds__(max_block_size) __global__
   void compute_column_kernel(table_device_view const table,
-                             const cudf::detail::fixed_width_scalar_device_view_base* literals,
+                             const detail::generic_scalar_device_view* literals,
                              mutable_column_device_view output_column,
                              const detail::device_data_reference* data_references,
                              const ast_operator* operators,
                              const cudf::size_type* operator_source_indices,
                              cudf::size_type num_operators,
-                             cudf::size_type num_intermediates)
+                             cudf::size_type num_intermediates,
+                             cudf::size_type* valid_count)
 {
   extern __shared__ std::int64_t intermediate_storage[];
   auto thread_intermediate_storage = &intermediate_storage[threadIdx.x * num_intermediates];
-  auto const start_idx             = cudf::size_type(threadIdx.x + blockIdx.x * blockDim.x);
-  auto const stride                = cudf::size_type(blockDim.x * gridDim.x);
-  auto const num_rows              = table.num_rows();
-  auto const evaluator =
-    cudf::ast::detail::row_evaluator(table, literals, thread_intermediate_storage, &output_column);
-
+  auto thread_intermediate_validity =
+    has_nulls ? reinterpret_cast<bool*>(&intermediate_storage[blockDim.x * num_intermediates]) +
+                  threadIdx.x * num_intermediates
+              : nullptr;
+  auto const start_idx = cudf::size_type(threadIdx.x + blockIdx.x * blockDim.x);
+  auto const stride    = cudf::size_type(blockDim.x * gridDim.x);
+  auto const num_rows  = table.num_rows();
+  auto const evaluator = cudf::ast::detail::row_evaluator(
+    table, literals, thread_intermediate_storage, &output_column, thread_intermediate_validity);
+
+  cudf::size_type thread_valid_count = 0;
   for (cudf::size_type row_index = start_idx; row_index < num_rows; row_index += stride) {
     evaluate_row_expression(
       evaluator, data_references, operators, operator_source_indices, num_operators, row_index);
+    if (has_nulls) { thread_valid_count += output_column.is_valid_nocheck(row_index); }
   }
+  if (has_nulls) { atomicAdd(valid_count, thread_valid_count); }
+}
+
+bool may_produce_nulls(linearizer const& expr_linearizer,
+                       table_view const& table,
+                       rmm::cuda_stream_view stream)
+{
+  auto const& data_references = expr_linearizer.data_references();
+  auto const& literals        = expr_linearizer.literal_scalars();
+  return std::any_of(data_references.cbegin(),
+                     data_references.cend(),
+                     [&table](auto const& reference) {
+                       return reference.reference_type == device_data_reference_type::COLUMN &&
+                              reference.table_source != table_reference::OUTPUT &&
+                              table.column(reference.data_index).nullable();
+                     }) ||
+         std::any_of(literals.cbegin(), literals.cend(), [stream](auto const& literal) {
+           return not literal.get().is_valid(stream);
+         });
 }
 
 std::unique_ptr<column> compute_column(table_view const table,
@@ -91,53 +122,31 @@ std::unique_ptr<column> compute_column(table_view const table,
                                        rmm::mr::device_memory_resource* mr)
 {
   // Linearize the AST
-  auto const expr_linearizer         = linearizer(expr, table);
-  auto const data_references         = expr_linearizer.data_references();
-  auto const literals                = expr_linearizer.literals();
-  auto const operators               = expr_linearizer.operators();
-  auto const num_operators           = cudf::size_type(operators.size());
-  auto const operator_source_indices = expr_linearizer.operator_source_indices();
-  auto const expr_data_type          = expr_linearizer.root_data_type();
-
-  // Create ast_plan and device buffer
-  auto plan = ast_plan();
-  plan.add_to_plan(data_references);
-  plan.add_to_plan(literals);
-  plan.add_to_plan(operators);
-  plan.add_to_plan(operator_source_indices);
-  auto const host_data_buffer = plan.get_host_data_buffer();
-  auto const buffer_offsets   = plan.get_offsets();
-  auto const buffer_size      = host_data_buffer.second;
-  auto device_data_buffer =
-    rmm::device_buffer(host_data_buffer.first.get(), buffer_size, stream, mr);
+  auto const expr_linearizer = linearizer(expr, table);
+  auto const expr_data_type  = expr_linearizer.root_data_type();
+  CUDF_EXPECTS(cudf::is_fixed_width(expr_data_type),
+               "The expression must produce a fixed-width type.");
   // To reduce overhead, we don't call a stream sync here.
   // The stream is synced later when the table_device_view is created.
-
-  // Create device pointers to components of plan
-  auto const device_data_buffer_ptr = static_cast<const char*>(device_data_buffer.data());
-  auto const device_data_references = reinterpret_cast<const detail::device_data_reference*>(
-    device_data_buffer_ptr + buffer_offsets[0]);
-  auto const device_literals =
-    reinterpret_cast<const cudf::detail::fixed_width_scalar_device_view_base*>(
-      device_data_buffer_ptr + buffer_offsets[1]);
-  auto const device_operators =
-    reinterpret_cast<const ast_operator*>(device_data_buffer_ptr + buffer_offsets[2]);
-  auto const device_operator_source_indices =
-    reinterpret_cast<const cudf::size_type*>(device_data_buffer_ptr + buffer_offsets[3]);
+  auto const plan = device_ast_plan(expr_linearizer, stream, mr);
 
   // Create table device view
   auto table_device         = table_device_view::create(table, stream);
   auto const table_num_rows = table.num_rows();
 
-  // Prepare output column
-  auto output_column = cudf::make_fixed_width_column(
-    expr_data_type, table_num_rows, mask_state::UNALLOCATED, stream, mr);
+  // Prepare output column. Rows are marked valid as they are evaluated.
+  auto const has_nulls         = may_produce_nulls(expr_linearizer, table, stream);
+  auto const output_mask_state = has_nulls ? mask_state::ALL_NULL : mask_state::UNALLOCATED;
+  auto output_column           = cudf::make_fixed_width_column(
+    expr_data_type, table_num_rows, output_mask_state, stream, mr);
   auto mutable_output_device =
     cudf::mutable_column_device_view::create(output_column->mutable_view(), stream);
+  rmm::device_scalar<cudf::size_type> valid_count{0, stream};
 
   // Configure kernel parameters
-  auto const num_intermediates     = expr_linearizer.intermediate_count();
-  auto const shmem_size_per_thread = static_cast<int>(sizeof(std::int64_t) * num_intermediates);
+  auto const num_intermediates     = plan.num_intermediates;
+  auto const intermediate_size     = sizeof(std::int64_t) + (has_nulls ? sizeof(bool) : 0);
+  auto const shmem_size_per_thread = static_cast<int>(intermediate_size * num_intermediates);
   int device_id;
   CUDA_TRY(cudaGetDevice(&device_id));
   int shmem_limit_per_block;
@@ -152,17 +161,20 @@ std::unique_ptr<column> compute_column(table_view const table,
   auto const shmem_size_per_block = shmem_size_per_thread * config.num_threads_per_block;
 
   // Execute the kernel
-  cudf::ast::detail::compute_column_kernel<MAX_BLOCK_SIZE>
-    <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-      *table_device,
-      device_literals,
-      *mutable_output_device,
-      device_data_references,
-      device_operators,
-      device_operator_source_indices,
-      num_operators,
-      num_intermediates);
+  auto kernel = has_nulls ? cudf::ast::detail::compute_column_kernel<MAX_BLOCK_SIZE, true>
+                          : cudf::ast::detail::compute_column_kernel<MAX_BLOCK_SIZE, false>;
+  kernel<<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+    *table_device,
+    plan.literals,
+    *mutable_output_device,
+    plan.data_references,
+    plan.operators,
+    plan.operator_source_indices,
+    plan.num_operators,
+    num_intermediates,
+    valid_count.data());
   CHECK_CUDA(stream.value());
+  if (has_nulls) { output_column->set_null_count(table_num_rows - valid_count.value(stream)); }
   return output_column;
 }
 
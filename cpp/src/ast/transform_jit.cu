@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/detail/linearizer.hpp>
+#include <cudf/ast/detail/operators.hpp>
+#include <cudf/ast/detail/transform.cuh>
+#include <cudf/ast/linearizer.hpp>
+#include <cudf/ast/transform.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <jit/cache.hpp>
+#include <jit/type.hpp>
+
+#include <jit_preprocessed_files/ast/jit/kernel.cu.jit.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace ast {
+namespace jit {
+namespace {
+
+/**
+ * @brief Returns the source of a call of the math function `name` on `operand`.
+ *
+ * As with the `std` overloads used by the interpreter, `FLOAT32` operands are evaluated in single
+ * precision and all others in double precision.
+ */
+std::string math_call(std::string const& name, std::string const& operand, data_type type)
+{
+  return type.id() == type_id::FLOAT32 ? name + "f(" + operand + ")"
+                                       : name + "(static_cast<double>(" + operand + "))";
+}
+
+/**
+ * @brief Returns the source of the operator `op` applied to `operands` of type `type`.
+ *
+ * The generated code computes the same values as `detail::operator_functor<op>`. Operands are
+ * never null, which `compute_column_jit` ensures, so the null-aware operators reduce to their
+ * results for valid operands.
+ */
+std::string operator_source(ast_operator op,
+                            std::vector<std::string> const& operands,
+                            data_type type)
+{
+  auto const is_float  = type.id() == type_id::FLOAT32;
+  auto const is_double = type.id() == type_id::FLOAT64;
+  auto const& a        = operands.front();
+  auto const& b        = operands.back();
+  auto binary          = [&](std::string const& symbol) { return "(" + a + symbol + b + ")"; };
+  auto as_double       = [](std::string const& x) { return "static_cast<double>(" + x + ")"; };
+  auto fmod_call       = [&](std::string const& x, std::string const& y) {
+    return (is_float ? "fmodf(" : "fmod(") + x + ", " + y + ")";
+  };
+
+  switch (op) {
+    case ast_operator::ADD: return binary(" + ");
+    case ast_operator::SUB: return binary(" - ");
+    case ast_operator::MUL: return binary(" * ");
+    case ast_operator::DIV: return binary(" / ");
+    case ast_operator::TRUE_DIV: return "(" + as_double(a) + " / " + as_double(b) + ")";
+    case ast_operator::FLOOR_DIV: return "floor(" + as_double(a) + " / " + as_double(b) + ")";
+    case ast_operator::MOD: return is_float || is_double ? fmod_call(a, b) : binary(" % ");
+    case ast_operator::PYMOD:
+      return is_float || is_double ? fmod_call(fmod_call(a, b) + " + " + b, b)
+                                   : "(((" + a + " % " + b + ") + " + b + ") % " + b + ")";
+    case ast_operator::POW:
+      return is_float ? "powf(" + a + ", " + b + ")"
+                      : "pow(" + as_double(a) + ", " + as_double(b) + ")";
+    case ast_operator::EQUAL: return binary(" == ");
+    case ast_operator::NOT_EQUAL: return binary(" != ");
+    case ast_operator::LESS: return binary(" < ");
+    case ast_operator::GREATER: return binary(" > ");
+    case ast_operator::LESS_EQUAL: return binary(" <= ");
+    case ast_operator::GREATER_EQUAL: return binary(" >= ");
+    case ast_operator::BITWISE_AND: return binary(" & ");
+    case ast_operator::BITWISE_OR: return binary(" | ");
+    case ast_operator::BITWISE_XOR: return binary(" ^ ");
+    case ast_operator::LOGICAL_AND: return binary(" && ");
+    case ast_operator::LOGICAL_OR: return binary(" || ");
+    case ast_operator::NULL_EQUAL: return binary(" == ");
+    case ast_operator::COALESCE: return a;
+    case ast_operator::IDENTITY: return a;
+    case ast_operator::SIN: return math_call("sin", a, type);
+    case ast_operator::COS: return math_call("cos", a, type);
+    case ast_operator::TAN: return math_call("tan", a, type);
+    case ast_operator::ARCSIN: return math_call("asin", a, type);
+    case ast_operator::ARCCOS: return math_call("acos", a, type);
+    case ast_operator::ARCTAN: return math_call("atan", a, type);
+    case ast_operator::SINH: return math_call("sinh", a, type);
+    case ast_operator::COSH: return math_call("cosh", a, type);
+    case ast_operator::TANH: return math_call("tanh", a, type);
+    case ast_operator::ARCSINH: return math_call("asinh", a, type);
+    case ast_operator::ARCCOSH: return math_call("acosh", a, type);
+    case ast_operator::ARCTANH: return math_call("atanh", a, type);
+    case ast_operator::EXP: return math_call("exp", a, type);
+    case ast_operator::LOG: return math_call("log", a, type);
+    case ast_operator::SQRT: return math_call("sqrt", a, type);
+    case ast_operator::CBRT: return math_call("cbrt", a, type);
+    case ast_operator::CEIL: return math_call("ceil", a, type);
+    case ast_operator::FLOOR: return math_call("floor", a, type);
+    case ast_operator::ABS:
+      if (is_float || is_double) { return math_call("fabs", a, type); }
+      return is_unsigned(type) ? a : "(" + a + " < 0 ? -" + a + " : " + a + ")";
+    case ast_operator::RINT: return math_call("rint", a, type);
+    case ast_operator::BIT_INVERT: return "(~" + a + ")";
+    case ast_operator::NOT: return "(!" + a + ")";
+    // The conversion to the output type of the operator is the cast
+    case ast_operator::CAST_TO_INT64:
+    case ast_operator::CAST_TO_UINT64:
+    case ast_operator::CAST_TO_FLOAT64: return a;
+    case ast_operator::IS_NULL: return "false";
+    case ast_operator::IF_ELSE: return "(" + a + " ? " + operands[1] + " : " + b + ")";
+    default: CUDF_FAIL("Unsupported operator for JIT expression evaluation.");
+  }
+}
+
+/**
+ * @brief Generates the `GENERIC_EXPRESSION` device function evaluating a linearized expression.
+ *
+ * Every operator is assigned to a local variable of its output type, in the order of the
+ * linearized plan, so the compiler sees the whole expression and keeps intermediates in
+ * registers. Columns and literals are read through the type-erased pointer arrays passed to the
+ * kernel. Only the structure and the types of the expression appear in the source, so
+ * expressions differing only in literal values share one compiled kernel.
+ */
+std::string expression_source(detail::linearizer const& expr_linearizer)
+{
+  auto const& data_references = expr_linearizer.data_references();
+  auto const& operators       = expr_linearizer.operators();
+  auto const& source_indices  = expr_linearizer.operator_source_indices();
+
+  // Variable currently holding each intermediate, as the linearizer reuses intermediate slots
+  std::vector<std::string> intermediates(expr_linearizer.intermediate_count());
+
+  auto reference_source = [&](size_type index) -> std::string {
+    auto const& reference = data_references[index];
+    auto const type_name  = cudf::jit::get_type_name(reference.data_type);
+    auto const data_index = std::to_string(reference.data_index);
+    switch (reference.reference_type) {
+      case detail::device_data_reference_type::COLUMN:
+        return "static_cast<" + type_name + " const*>(columns[" + data_index + "])[row]";
+      case detail::device_data_reference_type::LITERAL:
+        return "(*static_cast<" + type_name + " const*>(literals[" + data_index + "]))";
+      default: return intermediates[reference.data_index];
+    }
+  };
+
+  std::string body;
+  std::string result;
+  auto source_index = source_indices.cbegin();
+  for (std::size_t i = 0; i < operators.size(); ++i) {
+    auto const op    = operators[i];
+    auto const arity = detail::ast_operator_arity(op);
+    std::vector<std::string> operands;
+    std::transform(
+      source_index, source_index + arity, std::back_inserter(operands), reference_source);
+    auto const operand_type = data_references[*source_index].data_type;
+    source_index += arity;
+
+    auto const& output   = data_references[*source_index++];
+    auto const type_name = cudf::jit::get_type_name(output.data_type);
+    auto const variable  = "value_" + std::to_string(i);
+    body += "  " + type_name + " const " + variable + " = static_cast<" + type_name + ">(" +
+            operator_source(op, operands, operand_type) + ");\n";
+    if (output.reference_type == detail::device_data_reference_type::INTERMEDIATE) {
+      intermediates[output.data_index] = variable;
+    }
+    result = variable;
+  }
+
+  return "#pragma once\n\n__device__ inline " +
+         cudf::jit::get_type_name(expr_linearizer.root_data_type()) +
+         " GENERIC_EXPRESSION(void const* const* columns, void const* const* literals, "
+         "cudf::size_type row)\n{\n" +
+         body + "  return " + result + ";\n}\n";
+}
+
+/**
+ * @brief Returns whether the linearized expression can be evaluated by a JIT-compiled kernel.
+ *
+ * Expressions with at least one operator on numeric and boolean types are supported. Whether the
+ * inputs contain nulls is checked separately.
+ */
+bool is_jit_supported(detail::linearizer const& expr_linearizer)
+{
+  auto const& data_references = expr_linearizer.data_references();
+  return not expr_linearizer.operators().empty() &&
+         std::all_of(data_references.cbegin(), data_references.cend(), [](auto const& reference) {
+           return is_numeric(reference.data_type);
+         });
+}
+
+}  // namespace
+}  // namespace jit
+
+namespace detail {
+
+std::unique_ptr<column> compute_column_jit(table_view const table,
+                                           expression const& expr,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  auto const expr_linearizer = linearizer(expr, table);
+  if (not jit::is_jit_supported(expr_linearizer) ||
+      detail::may_produce_nulls(expr_linearizer, table, stream)) {
+    return detail::compute_column(table, expr, stream, mr);
+  }
+
+  auto output_column = cudf::make_fixed_width_column(
+    expr_linearizer.root_data_type(), table.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  if (table.num_rows() == 0) { return output_column; }
+
+  // Data of the referenced columns followed by the device values of the literals
+  auto const num_columns = table.num_columns();
+  std::vector<void const*> h_data(num_columns, nullptr);
+  for (auto const& reference : expr_linearizer.data_references()) {
+    if (reference.reference_type == device_data_reference_type::COLUMN &&
+        reference.table_source != table_reference::OUTPUT) {
+      h_data[reference.data_index] = cudf::jit::get_data_ptr(table.column(reference.data_index));
+    }
+  }
+  auto const& literals = expr_linearizer.literal_scalars();
+  std::transform(literals.cbegin(), literals.cend(), std::back_inserter(h_data), [](auto s) {
+    return cudf::jit::get_data_ptr(s.get());
+  });
+  auto const d_data = cudf::detail::make_device_uvector_async(h_data, stream);
+
+  std::string kernel_name =
+    jitify2::reflection::Template("cudf::ast::jit::kernel")  //
+      .instantiate(cudf::jit::get_type_name(output_column->type()));
+
+  auto output_view = output_column->mutable_view();
+  cudf::jit::get_kernel(*ast_jit_kernel_cu_jit,
+                        kernel_name,
+                        {{"ast/jit/operation-udf.hpp", jit::expression_source(expr_linearizer)}})
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
+    ->launch(table.num_rows(),
+             cudf::jit::get_data_ptr(output_view),
+             d_data.data(),
+             d_data.data() + num_columns);
+
+  return output_column;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> compute_column_jit(table_view const table,
+                                           expression const& expr,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_column_jit(table, expr, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace ast
+}  // namespace cudf
@@ -42,7 +42,9 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <future>
 #include <string>
+#include <vector>
 
 #include <thrust/optional.h>
 
@@ -73,6 +75,23 @@ rmm::device_buffer scalar_col_valid_mask_and(column_view const& col,
 
 namespace jit {
 
+/**
+ * @brief Returns the name of the instantiation of `kernel` computing `op`.
+ */
+std::string kernel_name(std::string const& kernel,
+                        data_type out,
+                        data_type lhs,
+                        data_type rhs,
+                        binary_operator op,
+                        OperatorType op_type)
+{
+  return jitify2::reflection::Template("cudf::binops::jit::" + kernel)
+    .instantiate(cudf::jit::get_type_name(out),  // list of template arguments
+                 cudf::jit::get_type_name(lhs),
+                 cudf::jit::get_type_name(rhs),
+                 get_operator_name(op, op_type));
+}
+
 void binary_operation(mutable_column_view& out,
                       column_view const& lhs,
                       scalar const& rhs,
@@ -81,16 +100,11 @@ void binary_operation(mutable_column_view& out,
                       rmm::cuda_stream_view stream)
 {
   if (is_null_dependent(op)) {
-    std::string kernel_name =
-      jitify2::reflection::Template("cudf::binops::jit::kernel_v_s_with_validity")  //
-        .instantiate(cudf::jit::get_type_name(out.type()),  // list of template arguments
-                     cudf::jit::get_type_name(lhs.type()),
-                     cudf::jit::get_type_name(rhs.type()),
-                     get_operator_name(op, op_type));
-
-    cudf::jit::get_program_cache(*binaryop_jit_kernel_cu_jit)
-      .get_kernel(kernel_name, {}, {}, {"-arch=sm_."})       //
-      ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
+    auto const kernel =
+      kernel_name("kernel_v_s_with_validity", out.type(), lhs.type(), rhs.type(), op, op_type);
+
+    cudf::jit::get_kernel(*binaryop_jit_kernel_cu_jit, kernel)  //
+      ->configure_1d_max_occupancy(0, 0, 0, stream.value())     //
       ->launch(out.size(),
                cudf::jit::get_data_ptr(out),
                cudf::jit::get_data_ptr(lhs),
@@ -100,16 +114,10 @@ void binary_operation(mutable_column_view& out,
                lhs.offset(),
                rhs.is_valid());
   } else {
-    std::string kernel_name =
-      jitify2::reflection::Template("cudf::binops::jit::kernel_v_s")  //
-        .instantiate(cudf::jit::get_type_name(out.type()),            // list of template arguments
-                     cudf::jit::get_type_name(lhs.type()),
-                     cudf::jit::get_type_name(rhs.type()),
-                     get_operator_name(op, op_type));
-
-    cudf::jit::get_program_cache(*binaryop_jit_kernel_cu_jit)
-      .get_kernel(kernel_name, {}, {}, {"-arch=sm_."})       //
-      ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
+    auto const kernel = kernel_name("kernel_v_s", out.type(), lhs.type(), rhs.type(), op, op_type);
+
+    cudf::jit::get_kernel(*binaryop_jit_kernel_cu_jit, kernel)  //
+      ->configure_1d_max_occupancy(0, 0, 0, stream.value())     //
       ->launch(out.size(),
                cudf::jit::get_data_ptr(out),
                cudf::jit::get_data_ptr(lhs),
@@ -142,16 +150,11 @@ void binary_operation(mutable_column_view& out,
                       rmm::cuda_stream_view stream)
 {
   if (is_null_dependent(op)) {
-    std::string kernel_name =
-      jitify2::reflection::Template("cudf::binops::jit::kernel_v_v_with_validity")  //
-        .instantiate(cudf::jit::get_type_name(out.type()),  // list of template arguments
-                     cudf::jit::get_type_name(lhs.type()),
-                     cudf::jit::get_type_name(rhs.type()),
-                     get_operator_name(op, OperatorType::Direct));
-
-    cudf::jit::get_program_cache(*binaryop_jit_kernel_cu_jit)
-      .get_kernel(kernel_name, {}, {}, {"-arch=sm_."})       //
-      ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
+    auto const kernel = kernel_name(
+      "kernel_v_v_with_validity", out.type(), lhs.type(), rhs.type(), op, OperatorType::Direct);
+
+    cudf::jit::get_kernel(*binaryop_jit_kernel_cu_jit, kernel)  //
+      ->configure_1d_max_occupancy(0, 0, 0, stream.value())     //
       ->launch(out.size(),
                cudf::jit::get_data_ptr(out),
                cudf::jit::get_data_ptr(lhs),
@@ -162,16 +165,11 @@ void binary_operation(mutable_column_view& out,
                rhs.null_mask(),
                rhs.offset());
   } else {
-    std::string kernel_name =
-      jitify2::reflection::Template("cudf::binops::jit::kernel_v_v")  //
-        .instantiate(cudf::jit::get_type_name(out.type()),            // list of template arguments
-                     cudf::jit::get_type_name(lhs.type()),
-                     cudf::jit::get_type_name(rhs.type()),
-                     get_operator_name(op, OperatorType::Direct));
-
-    cudf::jit::get_program_cache(*binaryop_jit_kernel_cu_jit)
-      .get_kernel(kernel_name, {}, {}, {"-arch=sm_."})       //
-      ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
+    auto const kernel =
+      kernel_name("kernel_v_v", out.type(), lhs.type(), rhs.type(), op, OperatorType::Direct);
+
+    cudf::jit::get_kernel(*binaryop_jit_kernel_cu_jit, kernel)  //
+      ->configure_1d_max_occupancy(0, 0, 0, stream.value())     //
       ->launch(out.size(),
                cudf::jit::get_data_ptr(out),
                cudf::jit::get_data_ptr(lhs),
@@ -192,23 +190,61 @@ void binary_operation(mutable_column_view& out,
   std::string cuda_source =
     cudf::jit::parse_single_function_ptx(ptx, "GENERIC_BINARY_OP", output_type_name);
 
-  std::string kernel_name =
-    jitify2::reflection::Template("cudf::binops::jit::kernel_v_v")  //
-      .instantiate(output_type_name,                                // list of template arguments
-                   cudf::jit::get_type_name(lhs.type()),
-                   cudf::jit::get_type_name(rhs.type()),
-                   get_operator_name(binary_operator::GENERIC_BINARY, OperatorType::Direct));
-
-  cudf::jit::get_program_cache(*binaryop_jit_kernel_cu_jit)
-    .get_kernel(
-      kernel_name, {}, {{"binaryop/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})  //
-    ->configure_1d_max_occupancy(0, 0, 0, stream.value())                                  //
+  auto const kernel = kernel_name("kernel_v_v",
+                                  out.type(),
+                                  lhs.type(),
+                                  rhs.type(),
+                                  binary_operator::GENERIC_BINARY,
+                                  OperatorType::Direct);
+
+  cudf::jit::get_kernel(
+    *binaryop_jit_kernel_cu_jit, kernel, {{"binaryop/jit/operation-udf.hpp", cuda_source}})
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
     ->launch(out.size(),
              cudf::jit::get_data_ptr(out),
              cudf::jit::get_data_ptr(lhs),
              cudf::jit::get_data_ptr(rhs));
 }
 
+/**
+ * @brief Returns the names of the JIT kernels computing `operation` between two columns, a column
+ * and a scalar, and a scalar and a column.
+ */
+std::vector<std::string> kernel_names(binary_operation_signature const& operation)
+{
+  auto const suffix = is_null_dependent(operation.op) ? "_with_validity" : "";
+  auto const v_v    = std::string{"kernel_v_v"} + suffix;
+  auto const v_s    = std::string{"kernel_v_s"} + suffix;
+  auto const op     = operation.op;
+  auto const& out   = operation.output;
+  auto const& lhs   = operation.lhs;
+  auto const& rhs   = operation.rhs;
+  // A scalar left operand is computed by the reversed operator with swapped operands
+  return {kernel_name(v_v, out, lhs, rhs, op, OperatorType::Direct),
+          kernel_name(v_s, out, lhs, rhs, op, OperatorType::Direct),
+          kernel_name(v_s, out, rhs, lhs, op, OperatorType::Reverse)};
+}
+
+/**
+ * @brief Returns the names of the JIT kernels computing `operations`, skipping the operations on
+ * strings and the operations computed by precompiled kernels.
+ */
+std::vector<std::string> kernel_names(std::vector<binary_operation_signature> const& operations)
+{
+  std::vector<std::string> names;
+  for (auto const& operation : operations) {
+    auto const is_string =
+      operation.lhs.id() == type_id::STRING and operation.rhs.id() == type_id::STRING;
+    if (is_string or compiled::is_supported_operation(
+                       operation.output, operation.lhs, operation.rhs, operation.op)) {
+      continue;
+    }
+    auto const operation_names = kernel_names(operation);
+    names.insert(names.end(), operation_names.begin(), operation_names.end());
+  }
+  return names;
+}
+
 }  // namespace jit
 }  // namespace binops
 
@@ -299,9 +335,9 @@ std::unique_ptr<column> make_fixed_width_column_for_output(column_view const& lh
   if (binops::is_null_dependent(op)) {
     return make_fixed_width_column(output_type, rhs.size(), mask_state::ALL_VALID, stream, mr);
   } else {
-    auto new_mask = cudf::detail::bitmask_and(table_view({lhs, rhs}), stream, mr);
+    auto [new_mask, null_count] = cudf::detail::bitmask_and(table_view({lhs, rhs}), stream, mr);
     return make_fixed_width_column(
-      output_type, lhs.size(), std::move(new_mask), cudf::UNKNOWN_NULL_COUNT, stream, mr);
+      output_type, lhs.size(), std::move(new_mask), null_count, stream, mr);
   }
 };
 
@@ -580,6 +616,68 @@ std::unique_ptr<column> fixed_point_binary_operation(column_view const& lhs,
   return output_type.scale() != scale ? cudf::cast(out_view, output_type) : std::move(out);
 }
 
+/**
+ * @brief Computes a binary operation of fixed-width, non-`fixed_point` operands into `out`, with
+ * the compiled kernels if they support the operation and with JIT otherwise
+ */
+template <typename Lhs, typename Rhs>
+void fixed_width_binary_operation(mutable_column_view& out,
+                                  Lhs const& lhs,
+                                  Rhs const& rhs,
+                                  binary_operator op,
+                                  rmm::cuda_stream_view stream)
+{
+  if (binops::compiled::is_supported_operation(out.type(), lhs.type(), rhs.type(), op)) {
+    binops::compiled::binary_operation(out, lhs, rhs, op, stream);
+  } else {
+    binops::jit::binary_operation(out, lhs, rhs, op, stream);
+  }
+}
+
+/**
+ * @brief Checks the data types of a binary operation into a preallocated column
+ */
+void expects_preallocated_output_types(data_type out, data_type lhs, data_type rhs)
+{
+  auto const is_supported = [](data_type type) {
+    return is_fixed_width(type) and not is_fixed_point(type);
+  };
+  CUDF_EXPECTS(is_supported(out), "Invalid/Unsupported output datatype");
+  CUDF_EXPECTS(is_supported(lhs), "Invalid/Unsupported lhs datatype");
+  CUDF_EXPECTS(is_supported(rhs), "Invalid/Unsupported rhs datatype");
+}
+
+/**
+ * @brief Initializes the null mask of `out` for a null-dependent operation, whose kernels only
+ * clear the bits of the null results
+ */
+void prepare_null_dependent_output(mutable_column_view& out, rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(out.nullable(), "Output column must be nullable for a null-dependent operation");
+  CUDF_EXPECTS(out.offset() == 0, "Output column with a null mask must not have an offset");
+  set_null_mask(out.null_mask(), 0, out.size(), true, stream);
+  out.set_null_count(UNKNOWN_NULL_COUNT);
+}
+
+/**
+ * @brief Writes the validity of a binary operation between `col` and `s` to `out`
+ */
+void set_column_scalar_validity(mutable_column_view& out,
+                                column_view const& col,
+                                scalar const& s,
+                                rmm::cuda_stream_view stream)
+{
+  if (s.is_valid()) {
+    inplace_bitmask_and(out, table_view{{col}}, stream);
+    return;
+  }
+  if (out.is_empty()) { return; }
+  CUDF_EXPECTS(out.nullable(), "Output column must be nullable when the input has nulls");
+  CUDF_EXPECTS(out.offset() == 0, "Output column with a null mask must not have an offset");
+  set_null_mask(out.null_mask(), 0, out.size(), false, stream);
+  out.set_null_count(out.size());
+}
+
 std::unique_ptr<column> binary_operation(scalar const& lhs,
                                          column_view const& rhs,
                                          binary_operator op,
@@ -603,7 +701,7 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
   if (rhs.is_empty()) return out;
 
   auto out_view = out->mutable_view();
-  binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  fixed_width_binary_operation(out_view, lhs, rhs, op, stream);
   return out;
 }
 
@@ -630,7 +728,7 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   if (lhs.is_empty()) return out;
 
   auto out_view = out->mutable_view();
-  binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  fixed_width_binary_operation(out_view, lhs, rhs, op, stream);
   return out;
 }
 
@@ -659,7 +757,7 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   if (lhs.is_empty() or rhs.is_empty()) return out;
 
   auto out_view = out->mutable_view();
-  binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
+  fixed_width_binary_operation(out_view, lhs, rhs, op, stream);
   return out;
 }
 
@@ -682,9 +780,9 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
 
   CUDF_EXPECTS((lhs.size() == rhs.size()), "Column sizes don't match");
 
-  auto new_mask = bitmask_and(table_view({lhs, rhs}), stream, mr);
-  auto out      = make_fixed_width_column(
-    output_type, lhs.size(), std::move(new_mask), cudf::UNKNOWN_NULL_COUNT, stream, mr);
+  auto [new_mask, null_count] = bitmask_and(table_view({lhs, rhs}), stream, mr);
+  auto out                    = make_fixed_width_column(
+    output_type, lhs.size(), std::move(new_mask), null_count, stream, mr);
 
   // Check for 0 sized data
   if (lhs.is_empty() or rhs.is_empty()) return out;
@@ -694,6 +792,61 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   return out;
 }
 
+void binary_operation(scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output,
+                      rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(output.size() == rhs.size(), "Mismatch in output size");
+  expects_preallocated_output_types(output.type(), lhs.type(), rhs.type());
+
+  if (binops::is_null_dependent(op)) {
+    prepare_null_dependent_output(output, stream);
+  } else {
+    set_column_scalar_validity(output, rhs, lhs, stream);
+  }
+  if (output.is_empty()) return;
+  fixed_width_binary_operation(output, lhs, rhs, op, stream);
+}
+
+void binary_operation(column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output,
+                      rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(output.size() == lhs.size(), "Mismatch in output size");
+  expects_preallocated_output_types(output.type(), lhs.type(), rhs.type());
+
+  if (binops::is_null_dependent(op)) {
+    prepare_null_dependent_output(output, stream);
+  } else {
+    set_column_scalar_validity(output, lhs, rhs, stream);
+  }
+  if (output.is_empty()) return;
+  fixed_width_binary_operation(output, lhs, rhs, op, stream);
+}
+
+void binary_operation(column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output,
+                      rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(lhs.size() == rhs.size(), "Column sizes don't match");
+  CUDF_EXPECTS(output.size() == lhs.size(), "Mismatch in output size");
+  expects_preallocated_output_types(output.type(), lhs.type(), rhs.type());
+
+  if (binops::is_null_dependent(op)) {
+    prepare_null_dependent_output(output, stream);
+  } else {
+    inplace_bitmask_and(output, table_view{{lhs, rhs}}, stream);
+  }
+  if (output.is_empty()) return;
+  fixed_width_binary_operation(output, lhs, rhs, op, stream);
+}
+
 }  // namespace detail
 
 int32_t binary_operation_fixed_point_scale(binary_operator op,
@@ -717,6 +870,20 @@ cudf::data_type binary_operation_fixed_point_output_type(binary_operator op,
   return cudf::data_type{lhs.id(), scale};
 }
 
+void prewarm_binary_operations(std::vector<binary_operation_signature> const& operations)
+{
+  CUDF_FUNC_RANGE();
+  cudf::jit::prewarm_kernels(*binaryop_jit_kernel_cu_jit, binops::jit::kernel_names(operations));
+}
+
+std::future<void> prewarm_binary_operations_async(
+  std::vector<binary_operation_signature> const& operations)
+{
+  CUDF_FUNC_RANGE();
+  return cudf::jit::prewarm_kernels_async(*binaryop_jit_kernel_cu_jit,
+                                          binops::jit::kernel_names(operations));
+}
+
 std::unique_ptr<column> binary_operation(scalar const& lhs,
                                          column_view const& rhs,
                                          binary_operator op,
@@ -757,4 +924,31 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   return detail::binary_operation(lhs, rhs, ptx, output_type, rmm::cuda_stream_default, mr);
 }
 
+void binary_operation(scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output)
+{
+  CUDF_FUNC_RANGE();
+  detail::binary_operation(lhs, rhs, op, output, rmm::cuda_stream_default);
+}
+
+void binary_operation(column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output)
+{
+  CUDF_FUNC_RANGE();
+  detail::binary_operation(lhs, rhs, op, output, rmm::cuda_stream_default);
+}
+
+void binary_operation(column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      mutable_column_view& output)
+{
+  CUDF_FUNC_RANGE();
+  detail::binary_operation(lhs, rhs, op, output, rmm::cuda_stream_default);
+}
+
 }  // namespace cudf
@@ -15,18 +15,24 @@
  */
 
 #include "binary_ops.hpp"
+#include "operation.cuh"
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <type_traits>
+
 namespace cudf {
 namespace binops {
 namespace compiled {
@@ -168,9 +174,9 @@ struct binary_op {
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
   {
-    auto new_mask = cudf::detail::bitmask_and(table_view({lhs, rhs}), stream, mr);
-    auto out      = make_fixed_width_column(
-      out_type, lhs.size(), std::move(new_mask), cudf::UNKNOWN_NULL_COUNT, stream, mr);
+    auto [new_mask, null_count] = cudf::detail::bitmask_and(table_view({lhs, rhs}), stream, mr);
+    auto out                    = make_fixed_width_column(
+      out_type, lhs.size(), std::move(new_mask), null_count, stream, mr);
 
     if (lhs.size() > 0) {
       auto out_view        = out->mutable_view();
@@ -415,6 +421,103 @@ struct null_considering_binop {
   }
 };
 
+/**
+ * @brief Calls `f.template operator()<BinaryOperator>()` with the operator of `ops` computing
+ * `op`, or with `void` if `op` has no precompiled operator.
+ */
+template <typename F>
+decltype(auto) ops_dispatcher(binary_operator op, F&& f)
+{
+  switch (op) {
+    case binary_operator::ADD: return f.template operator()<ops::Add>();
+    case binary_operator::SUB: return f.template operator()<ops::Sub>();
+    case binary_operator::MUL: return f.template operator()<ops::Mul>();
+    case binary_operator::DIV: return f.template operator()<ops::Div>();
+    case binary_operator::TRUE_DIV: return f.template operator()<ops::TrueDiv>();
+    case binary_operator::FLOOR_DIV: return f.template operator()<ops::FloorDiv>();
+    case binary_operator::MOD: return f.template operator()<ops::Mod>();
+    case binary_operator::PYMOD: return f.template operator()<ops::PyMod>();
+    case binary_operator::POW: return f.template operator()<ops::Pow>();
+    case binary_operator::EQUAL: return f.template operator()<ops::Equal>();
+    case binary_operator::NOT_EQUAL: return f.template operator()<ops::NotEqual>();
+    case binary_operator::LESS: return f.template operator()<ops::Less>();
+    case binary_operator::GREATER: return f.template operator()<ops::Greater>();
+    case binary_operator::LESS_EQUAL: return f.template operator()<ops::LessEqual>();
+    case binary_operator::GREATER_EQUAL: return f.template operator()<ops::GreaterEqual>();
+    case binary_operator::BITWISE_AND: return f.template operator()<ops::BitwiseAnd>();
+    case binary_operator::BITWISE_OR: return f.template operator()<ops::BitwiseOr>();
+    case binary_operator::BITWISE_XOR: return f.template operator()<ops::BitwiseXor>();
+    case binary_operator::LOGICAL_AND: return f.template operator()<ops::LogicalAnd>();
+    case binary_operator::LOGICAL_OR: return f.template operator()<ops::LogicalOr>();
+    default: return f.template operator()<void>();
+  }
+}
+
+struct is_supported_operation_functor {
+  data_type out;
+  data_type lhs;
+  data_type rhs;
+
+  template <typename BinaryOperator>
+  bool operator()() const
+  {
+    if constexpr (std::is_void<BinaryOperator>::value) {
+      return false;
+    } else {
+      return is_supported_operation<BinaryOperator>(out, lhs, rhs);
+    }
+  }
+};
+
+struct apply_binary_op_functor {
+  mutable_column_view& out;
+  column_view const& lhs;
+  column_view const& rhs;
+  bool is_lhs_scalar;
+  bool is_rhs_scalar;
+  rmm::cuda_stream_view stream;
+
+  template <typename BinaryOperator>
+  void operator()() const
+  {
+    if constexpr (std::is_void<BinaryOperator>::value) {
+      CUDF_FAIL("Unsupported operator for compiled binary operation");
+    } else {
+      apply_binary_op<BinaryOperator>(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, stream);
+    }
+  }
+};
+
+/**
+ * @brief Type-dispatched functor viewing the value of a fixed-width scalar as a column of one
+ * row.
+ */
+struct scalar_as_column_view {
+  template <typename T, std::enable_if_t<is_supported_type<T>()>* = nullptr>
+  column_view operator()(scalar const& s) const
+  {
+    auto const& typed_scalar = static_cast<scalar_type_t<T> const&>(s);
+    return column_view(s.type(), 1, typed_scalar.data());
+  }
+
+  template <typename T, std::enable_if_t<not is_supported_type<T>()>* = nullptr>
+  column_view operator()(scalar const&) const
+  {
+    CUDF_FAIL("Unsupported scalar type for compiled binary operation");
+  }
+};
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      bool is_lhs_scalar,
+                      bool is_rhs_scalar,
+                      binary_operator op,
+                      rmm::cuda_stream_view stream)
+{
+  ops_dispatcher(op, apply_binary_op_functor{out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, stream});
+}
+
 }  // namespace
 
 std::unique_ptr<column> binary_operation(scalar const& lhs,
@@ -484,6 +587,44 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   }
 }
 
+bool is_supported_operation(data_type out, data_type lhs, data_type rhs, binary_operator op)
+{
+  auto const is_supported = [](data_type type) {
+    return is_fixed_width(type) and not is_fixed_point(type);
+  };
+  if (not(is_supported(out) and is_supported(lhs) and is_supported(rhs))) { return false; }
+  return ops_dispatcher(op, is_supported_operation_functor{out, lhs, rhs});
+}
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      rmm::cuda_stream_view stream)
+{
+  binary_operation(out, lhs, rhs, false, false, op, stream);
+}
+
+void binary_operation(mutable_column_view& out,
+                      scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      rmm::cuda_stream_view stream)
+{
+  auto const lhs_view = type_dispatcher(lhs.type(), scalar_as_column_view{}, lhs);
+  binary_operation(out, lhs_view, rhs, true, false, op, stream);
+}
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op,
+                      rmm::cuda_stream_view stream)
+{
+  auto const rhs_view = type_dispatcher(rhs.type(), scalar_as_column_view{}, rhs);
+  binary_operation(out, lhs, rhs_view, false, true, op, stream);
+}
+
 }  // namespace compiled
 }  // namespace binops
 }  // namespace cudf
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "binary_ops.hpp"
+#include "operation.cuh"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/utilities/assert.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <optional>
+#include <type_traits>
+
+namespace cudf {
+namespace binops {
+namespace compiled {
+
+/**
+ * @brief Returns whether a `From` value can be converted to `To` with `static_cast`.
+ */
+template <typename From, typename To>
+constexpr bool is_castable()
+{
+  return is_supported_type<From>() and is_supported_type<To>() and
+         std::is_constructible<To, From>::value;
+}
+
+/**
+ * @brief Returns whether `BinaryOperator` can be applied to a `TypeLhs` and a `TypeRhs` operand.
+ */
+template <typename BinaryOperator, typename TypeLhs, typename TypeRhs>
+constexpr bool is_invocable()
+{
+  return is_supported_type<TypeLhs>() and is_supported_type<TypeRhs>() and
+         std::is_invocable<BinaryOperator, TypeLhs, TypeRhs>::value;
+}
+
+/**
+ * @brief Returns the type both operands of `BinaryOperator` are converted to before it is
+ * applied.
+ *
+ * As in `binaryop/jit/operation.hpp`, comparisons and logical operators are computed in the
+ * common type of the operands, bitwise operators in the output type, and every other operator in
+ * the common type of the output and the operands. An empty optional means there is no common type,
+ * for instance between a timestamp and a duration, and the operator is applied to the operands
+ * as they are.
+ */
+template <typename BinaryOperator>
+std::optional<data_type> get_operand_type(data_type out, data_type lhs, data_type rhs)
+{
+  if constexpr (std::is_same<BinaryOperator, ops::BitwiseAnd>::value or
+                std::is_same<BinaryOperator, ops::BitwiseOr>::value or
+                std::is_same<BinaryOperator, ops::BitwiseXor>::value) {
+    return out;
+  } else if constexpr (std::is_same<BinaryOperator, ops::Equal>::value or
+                       std::is_same<BinaryOperator, ops::NotEqual>::value or
+                       std::is_same<BinaryOperator, ops::Less>::value or
+                       std::is_same<BinaryOperator, ops::Greater>::value or
+                       std::is_same<BinaryOperator, ops::LessEqual>::value or
+                       std::is_same<BinaryOperator, ops::GreaterEqual>::value or
+                       std::is_same<BinaryOperator, ops::LogicalAnd>::value or
+                       std::is_same<BinaryOperator, ops::LogicalOr>::value) {
+    return get_common_type(lhs, rhs);
+  } else {
+    auto const operands = get_common_type(lhs, rhs);
+    return operands.has_value() ? get_common_type(out, *operands) : std::nullopt;
+  }
+}
+
+namespace detail {
+
+/**
+ * @brief Type-dispatched functor returning the type of the result of `BinaryOperator` applied to
+ * operands of the dispatched types, or an empty optional if the operator does not apply to them.
+ */
+template <typename BinaryOperator>
+struct result_type_functor {
+  template <typename TypeLhs, typename TypeRhs>
+  std::optional<data_type> operator()() const
+  {
+    if constexpr (is_invocable<BinaryOperator, TypeLhs, TypeRhs>()) {
+      using result_t = std::invoke_result_t<BinaryOperator, TypeLhs, TypeRhs>;
+      auto const id  = type_to_id<result_t>();
+      if (id != type_id::EMPTY) { return data_type{id}; }
+    }
+    return std::nullopt;
+  }
+};
+
+/**
+ * @brief Type-dispatched functor reading an element of a column converted to `Operand`.
+ */
+template <typename Operand>
+struct converted_element_reader {
+  template <typename Element>
+  __device__ Operand operator()(column_device_view const& col, size_type i) const
+  {
+    if constexpr (is_castable<Element, Operand>()) {
+      return static_cast<Operand>(col.element<Element>(i));
+    } else {
+      cudf_assert(false && "Unsupported operand type");
+      return Operand{};
+    }
+  }
+};
+
+/**
+ * @brief Type-dispatched functor writing a `Result` value converted to the type of the output
+ * column.
+ */
+template <typename Result>
+struct converted_element_writer {
+  template <typename Element>
+  __device__ void operator()(mutable_column_device_view& out, size_type i, Result value) const
+  {
+    if constexpr (is_castable<Result, Element>()) {
+      out.element<Element>(i) = static_cast<Element>(value);
+    } else {
+      cudf_assert(false && "Unsupported output type");
+    }
+  }
+};
+
+/**
+ * @brief Device functor applying `BinaryOperator` to one row of the operands, both converted to
+ * `Operand`.
+ */
+template <typename BinaryOperator, typename Operand>
+struct converted_operands_functor {
+  mutable_column_device_view out;
+  column_device_view lhs;
+  column_device_view rhs;
+  bool is_lhs_scalar;
+  bool is_rhs_scalar;
+
+  __device__ void operator()(size_type i)
+  {
+    auto const x = type_dispatcher(
+      lhs.type(), converted_element_reader<Operand>{}, lhs, is_lhs_scalar ? 0 : i);
+    auto const y = type_dispatcher(
+      rhs.type(), converted_element_reader<Operand>{}, rhs, is_rhs_scalar ? 0 : i);
+    using result_t = std::invoke_result_t<BinaryOperator, Operand, Operand>;
+    type_dispatcher(
+      out.type(), converted_element_writer<result_t>{}, out, i, BinaryOperator{}(x, y));
+  }
+};
+
+/**
+ * @brief Device functor applying `BinaryOperator` to one row of the operands as they are.
+ */
+template <typename BinaryOperator, typename TypeLhs, typename TypeRhs>
+struct operands_functor {
+  mutable_column_device_view out;
+  column_device_view lhs;
+  column_device_view rhs;
+  bool is_lhs_scalar;
+  bool is_rhs_scalar;
+
+  __device__ void operator()(size_type i)
+  {
+    auto const x   = lhs.element<TypeLhs>(is_lhs_scalar ? 0 : i);
+    auto const y   = rhs.element<TypeRhs>(is_rhs_scalar ? 0 : i);
+    using result_t = std::invoke_result_t<BinaryOperator, TypeLhs, TypeRhs>;
+    type_dispatcher(
+      out.type(), converted_element_writer<result_t>{}, out, i, BinaryOperator{}(x, y));
+  }
+};
+
+/**
+ * @brief Type-dispatched functor launching `converted_operands_functor` for the dispatched
+ * operand type.
+ */
+template <typename BinaryOperator>
+struct converted_operands_launcher {
+  template <typename Operand>
+  void operator()(mutable_column_device_view out,
+                  column_device_view lhs,
+                  column_device_view rhs,
+                  bool is_lhs_scalar,
+                  bool is_rhs_scalar,
+                  rmm::cuda_stream_view stream) const
+  {
+    if constexpr (is_invocable<BinaryOperator, Operand, Operand>()) {
+      thrust::for_each_n(rmm::exec_policy(stream),
+                         thrust::make_counting_iterator<size_type>(0),
+                         out.size(),
+                         converted_operands_functor<BinaryOperator, Operand>{
+                           out, lhs, rhs, is_lhs_scalar, is_rhs_scalar});
+    } else {
+      CUDF_FAIL("Unsupported operand types for compiled binary operation");
+    }
+  }
+};
+
+/**
+ * @brief Type-dispatched functor launching `operands_functor` for the dispatched operand types.
+ */
+template <typename BinaryOperator>
+struct operands_launcher {
+  template <typename TypeLhs, typename TypeRhs>
+  void operator()(mutable_column_device_view out,
+                  column_device_view lhs,
+                  column_device_view rhs,
+                  bool is_lhs_scalar,
+                  bool is_rhs_scalar,
+                  rmm::cuda_stream_view stream) const
+  {
+    if constexpr (is_invocable<BinaryOperator, TypeLhs, TypeRhs>()) {
+      thrust::for_each_n(rmm::exec_policy(stream),
+                         thrust::make_counting_iterator<size_type>(0),
+                         out.size(),
+                         operands_functor<BinaryOperator, TypeLhs, TypeRhs>{
+                           out, lhs, rhs, is_lhs_scalar, is_rhs_scalar});
+    } else {
+      CUDF_FAIL("Unsupported operand types for compiled binary operation");
+    }
+  }
+};
+
+}  // namespace detail
+
+template <typename BinaryOperator>
+bool is_supported_operation(data_type out, data_type lhs, data_type rhs)
+{
+  auto const operand = get_operand_type<BinaryOperator>(out, lhs, rhs);
+  if (operand.has_value() and not(is_castable(lhs, *operand) and is_castable(rhs, *operand))) {
+    return false;
+  }
+  auto const result = operand.has_value()
+                        ? double_type_dispatcher(*operand,
+                                                 *operand,
+                                                 detail::result_type_functor<BinaryOperator>{})
+                        : double_type_dispatcher(
+                            lhs, rhs, detail::result_type_functor<BinaryOperator>{});
+  return result.has_value() and is_castable(*result, out);
+}
+
+template <typename BinaryOperator>
+void apply_binary_op(mutable_column_view& out,
+                     column_view const& lhs,
+                     column_view const& rhs,
+                     bool is_lhs_scalar,
+                     bool is_rhs_scalar,
+                     rmm::cuda_stream_view stream)
+{
+  auto const d_out = mutable_column_device_view::create(out, stream);
+  auto const d_lhs = column_device_view::create(lhs, stream);
+  auto const d_rhs = column_device_view::create(rhs, stream);
+
+  auto const operand = get_operand_type<BinaryOperator>(out.type(), lhs.type(), rhs.type());
+  if (operand.has_value()) {
+    type_dispatcher(*operand,
+                    detail::converted_operands_launcher<BinaryOperator>{},
+                    *d_out,
+                    *d_lhs,
+                    *d_rhs,
+                    is_lhs_scalar,
+                    is_rhs_scalar,
+                    stream);
+  } else {
+    double_type_dispatcher(lhs.type(),
+                           rhs.type(),
+                           detail::operands_launcher<BinaryOperator>{},
+                           *d_out,
+                           *d_lhs,
+                           *d_rhs,
+                           is_lhs_scalar,
+                           is_rhs_scalar,
+                           stream);
+  }
+}
+
+
+/**
+ * @brief Explicitly instantiates `is_supported_operation` and `apply_binary_op` for an operator.
+ */
+#define INSTANTIATE_COMPILED_BINARY_OP(BinaryOperator)                                          \
+  template bool is_supported_operation<BinaryOperator>(data_type, data_type, data_type);      \
+  template void apply_binary_op<BinaryOperator>(mutable_column_view&,                          \
+                                                column_view const&,                            \
+                                                column_view const&,                            \
+                                                bool,                                          \
+                                                bool,                                          \
+                                                rmm::cuda_stream_view);
+
+}  // namespace compiled
+}  // namespace binops
+}  // namespace cudf
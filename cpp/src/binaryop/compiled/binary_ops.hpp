@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,9 +18,12 @@
 
 #include <cudf/binaryop.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <optional>
+
 namespace cudf {
 namespace binops {
 namespace detail {
@@ -123,6 +126,112 @@ std::unique_ptr<column> binary_operation(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+
+/**
+ * @brief Returns whether `T` may be the type of an operand or of the output of a precompiled
+ * fixed-width binary operation.
+ *
+ * Fixed-point columns are rescaled around the operation and are left to the JIT kernels.
+ */
+template <typename T>
+constexpr bool is_supported_type()
+{
+  return is_fixed_width<T>() and not is_fixed_point<T>();
+}
+
+/**
+ * @brief Returns the common type of `lhs` and `rhs`, as given by `cuda::std::common_type`, or an
+ * empty optional if they have none.
+ */
+std::optional<data_type> get_common_type(data_type lhs, data_type rhs);
+
+/**
+ * @brief Returns whether a value of type `from` can be converted to `to` with `static_cast`.
+ */
+bool is_castable(data_type from, data_type to);
+
+/**
+ * @brief Returns whether `BinaryOperator` of `compiled::ops` has a precompiled kernel for the
+ * output and operand types.
+ *
+ * Explicitly instantiated for every operator of `compiled::ops`.
+ */
+template <typename BinaryOperator>
+bool is_supported_operation(data_type out, data_type lhs, data_type rhs);
+
+/**
+ * @brief Writes `BinaryOperator` of `compiled::ops` applied to every row of `lhs` and `rhs` to
+ * `out`.
+ *
+ * Explicitly instantiated for every operator of `compiled::ops`.
+ *
+ * @param out Output column, whose null mask is left unchanged
+ * @param lhs Left operand, a column of one row if `is_lhs_scalar`
+ * @param rhs Right operand, a column of one row if `is_rhs_scalar`
+ * @param is_lhs_scalar Whether the single row of `lhs` is the left operand of every row
+ * @param is_rhs_scalar Whether the single row of `rhs` is the right operand of every row
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename BinaryOperator>
+void apply_binary_op(mutable_column_view& out,
+                     column_view const& lhs,
+                     column_view const& rhs,
+                     bool is_lhs_scalar,
+                     bool is_rhs_scalar,
+                     rmm::cuda_stream_view stream);
+
+/**
+ * @brief Returns whether `op` on fixed-width operands of types `lhs` and `rhs` producing `out`
+ * is computed by a precompiled kernel.
+ *
+ * Arithmetic, comparison, bitwise and logical operators on numeric, boolean, timestamp and
+ * duration types are precompiled. Fixed-point types, null-aware operators and the remaining
+ * operators are computed by JIT-compiled kernels.
+ */
+bool is_supported_operation(data_type out, data_type lhs, data_type rhs, binary_operator op);
+
+/**
+ * @brief Performs a binary operation between two fixed-width columns with a precompiled kernel.
+ *
+ * The output must be allocated with the size of the operands and its null mask must already be
+ * computed. The operation must satisfy `is_supported_operation`.
+ *
+ * @param out         Output column
+ * @param lhs         The left operand column
+ * @param rhs         The right operand column
+ * @param op          The binary operator
+ * @param stream      CUDA stream used for device memory operations and kernel launches.
+ */
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      rmm::cuda_stream_view stream);
+
+/**
+ * @copydoc binary_operation(mutable_column_view&, column_view const&, column_view const&,
+ * binary_operator, rmm::cuda_stream_view)
+ *
+ * @param lhs         The left operand scalar
+ */
+void binary_operation(mutable_column_view& out,
+                      scalar const& lhs,
+                      column_view const& rhs,
+                      binary_operator op,
+                      rmm::cuda_stream_view stream);
+
+/**
+ * @copydoc binary_operation(mutable_column_view&, column_view const&, column_view const&,
+ * binary_operator, rmm::cuda_stream_view)
+ *
+ * @param rhs         The right operand scalar
+ */
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      scalar const& rhs,
+                      binary_operator op,
+                      rmm::cuda_stream_view stream);
+
 }  // namespace compiled
 }  // namespace binops
 }  // namespace cudf
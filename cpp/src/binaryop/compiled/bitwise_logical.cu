@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "binary_ops.cuh"
+
+namespace cudf {
+namespace binops {
+namespace compiled {
+
+INSTANTIATE_COMPILED_BINARY_OP(ops::BitwiseAnd)
+INSTANTIATE_COMPILED_BINARY_OP(ops::BitwiseOr)
+INSTANTIATE_COMPILED_BINARY_OP(ops::BitwiseXor)
+INSTANTIATE_COMPILED_BINARY_OP(ops::LogicalAnd)
+INSTANTIATE_COMPILED_BINARY_OP(ops::LogicalOr)
+
+}  // namespace compiled
+}  // namespace binops
+}  // namespace cudf
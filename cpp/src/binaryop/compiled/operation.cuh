@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <cmath>
+#include <type_traits>
+
+namespace cudf {
+namespace binops {
+namespace compiled {
+
+/**
+ * @brief Binary operators of the precompiled binary operation kernels.
+ *
+ * Every operator computes the same value as the operator of the same name in
+ * `binaryop/jit/operation.hpp` once its operands have been converted to the operand type chosen
+ * by `get_operand_type`. The return type of `operator()` is deduced, and invalid operand types are
+ * removed from overload resolution, so `std::is_invocable` tells which operand types an operator
+ * supports.
+ */
+namespace ops {
+
+struct Add {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs) -> decltype(lhs + rhs)
+  {
+    return lhs + rhs;
+  }
+};
+
+struct Sub {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs) -> decltype(lhs - rhs)
+  {
+    return lhs - rhs;
+  }
+};
+
+struct Mul {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs) -> decltype(lhs * rhs)
+  {
+    return lhs * rhs;
+  }
+};
+
+struct Div {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs) -> decltype(lhs / rhs)
+  {
+    return lhs / rhs;
+  }
+};
+
+struct TrueDiv {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs)
+    -> decltype(static_cast<double>(lhs) / static_cast<double>(rhs))
+  {
+    return static_cast<double>(lhs) / static_cast<double>(rhs);
+  }
+};
+
+struct FloorDiv {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs)
+    -> decltype(floor(static_cast<double>(lhs) / static_cast<double>(rhs)))
+  {
+    return floor(static_cast<double>(lhs) / static_cast<double>(rhs));
+  }
+};
+
+struct Mod {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs) -> decltype(lhs % rhs)
+  {
+    return lhs % rhs;
+  }
+
+  template <typename T1,
+            typename T2,
+            std::enable_if_t<std::is_floating_point<T1>::value and
+                             std::is_floating_point<T2>::value>* = nullptr>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs)
+  {
+    using common_t = std::common_type_t<T1, T2>;
+    if constexpr (std::is_same<common_t, float>::value) {
+      return fmodf(lhs, rhs);
+    } else {
+      return fmod(static_cast<double>(lhs), static_cast<double>(rhs));
+    }
+  }
+};
+
+struct PyMod {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs)
+    -> decltype(((lhs % rhs) + rhs) % rhs)
+  {
+    return ((lhs % rhs) + rhs) % rhs;
+  }
+
+  template <typename T1,
+            typename T2,
+            std::enable_if_t<std::is_floating_point<T1>::value and
+                             std::is_floating_point<T2>::value>* = nullptr>
+  CUDA_HOST_DEVICE_CALLABLE double operator()(T1 const& lhs, T2 const& rhs)
+  {
+    auto const x = static_cast<double>(lhs);
+    auto const y = static_cast<double>(rhs);
+    return fmod(fmod(x, y) + y, y);
+  }
+};
+
+struct Pow {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs)
+    -> decltype(pow(static_cast<double>(lhs), static_cast<double>(rhs)))
+  {
+    return pow(static_cast<double>(lhs), static_cast<double>(rhs));
+  }
+};
+
+struct Equal {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs) -> decltype(lhs == rhs)
+  {
+    return lhs == rhs;
+  }
+};
+
+struct NotEqual {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs) -> decltype(lhs != rhs)
+  {
+    return lhs != rhs;
+  }
+};
+
+struct Less {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs) -> decltype(lhs < rhs)
+  {
+    return lhs < rhs;
+  }
+};
+
+struct Greater {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs) -> decltype(lhs > rhs)
+  {
+    return lhs > rhs;
+  }
+};
+
+struct LessEqual {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs) -> decltype(lhs <= rhs)
+  {
+    return lhs <= rhs;
+  }
+};
+
+struct GreaterEqual {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs) -> decltype(lhs >= rhs)
+  {
+    return lhs >= rhs;
+  }
+};
+
+struct BitwiseAnd {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs) -> decltype(lhs & rhs)
+  {
+    return lhs & rhs;
+  }
+};
+
+struct BitwiseOr {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs) -> decltype(lhs | rhs)
+  {
+    return lhs | rhs;
+  }
+};
+
+struct BitwiseXor {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs) -> decltype(lhs ^ rhs)
+  {
+    return lhs ^ rhs;
+  }
+};
+
+struct LogicalAnd {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs) -> decltype(lhs && rhs)
+  {
+    return lhs && rhs;
+  }
+};
+
+struct LogicalOr {
+  template <typename T1, typename T2>
+  CUDA_HOST_DEVICE_CALLABLE auto operator()(T1 const& lhs, T2 const& rhs) -> decltype(lhs || rhs)
+  {
+    return lhs || rhs;
+  }
+};
+
+}  // namespace ops
+}  // namespace compiled
+}  // namespace binops
+}  // namespace cudf
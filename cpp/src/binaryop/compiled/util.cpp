@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "binary_ops.hpp"
+
+#include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <cuda/std/type_traits>
+
+#include <optional>
+#include <type_traits>
+
+namespace cudf {
+namespace binops {
+namespace compiled {
+namespace {
+
+template <typename AlwaysVoid, typename... Ts>
+struct has_common_type_impl : std::false_type {
+};
+
+template <typename... Ts>
+struct has_common_type_impl<std::void_t<typename cuda::std::common_type<Ts...>::type>, Ts...>
+  : std::true_type {
+};
+
+template <typename... Ts>
+constexpr bool has_common_type_v = has_common_type_impl<void, Ts...>::value;
+
+struct common_type_functor {
+  template <typename TypeLhs, typename TypeRhs>
+  std::optional<data_type> operator()() const
+  {
+    if constexpr (is_supported_type<TypeLhs>() and is_supported_type<TypeRhs>() and
+                  has_common_type_v<TypeLhs, TypeRhs>) {
+      auto const id = type_to_id<typename cuda::std::common_type<TypeLhs, TypeRhs>::type>();
+      if (id != type_id::EMPTY) { return data_type{id}; }
+    }
+    return std::nullopt;
+  }
+};
+
+struct is_castable_functor {
+  template <typename From, typename To>
+  bool operator()() const
+  {
+    return is_supported_type<From>() and is_supported_type<To>() and
+           std::is_constructible<To, From>::value;
+  }
+};
+
+}  // namespace
+
+std::optional<data_type> get_common_type(data_type lhs, data_type rhs)
+{
+  return double_type_dispatcher(lhs, rhs, common_type_functor{});
+}
+
+bool is_castable(data_type from, data_type to)
+{
+  return double_type_dispatcher(from, to, is_castable_functor{});
+}
+
+}  // namespace compiled
+}  // namespace binops
+}  // namespace cudf
@@ -394,14 +394,14 @@ rmm::device_buffer copy_bitmask(column_view const &view,
 }
 
 // Inplace Bitwise AND of the masks
-void inplace_bitmask_and(device_span<bitmask_type> dest_mask,
+size_type inplace_bitmask_and(device_span<bitmask_type> dest_mask,
                          host_span<bitmask_type const *> masks,
                          host_span<size_type const> begin_bits,
                          size_type mask_size,
                          rmm::cuda_stream_view stream,
                          rmm::mr::device_memory_resource *mr)
 {
-  inplace_bitmask_binop(
+  return inplace_bitmask_binop(
     [] __device__(bitmask_type left, bitmask_type right) { return left & right; },
     dest_mask,
     masks,
@@ -412,11 +412,11 @@ void inplace_bitmask_and(device_span<bitmask_type> dest_mask,
 }
 
 // Bitwise AND of the masks
-rmm::device_buffer bitmask_and(host_span<bitmask_type const *> masks,
-                               host_span<size_type const> begin_bits,
-                               size_type mask_size,
-                               rmm::cuda_stream_view stream,
-                               rmm::mr::device_memory_resource *mr)
+std::pair<rmm::device_buffer, size_type> bitmask_and(host_span<bitmask_type const *> masks,
+                                                     host_span<size_type const> begin_bits,
+                                                     size_type mask_size,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::mr::device_memory_resource *mr)
 {
   return bitmask_binop(
     [] __device__(bitmask_type left, bitmask_type right) { return left & right; },
@@ -591,13 +591,15 @@ std::vector<size_type> segmented_count_unset_bits(bitmask_type const *bitmask,
 }
 
 // Returns the bitwise AND of the null masks of all columns in the table view
-rmm::device_buffer bitmask_and(table_view const &view,
-                               rmm::cuda_stream_view stream,
-                               rmm::mr::device_memory_resource *mr)
+std::pair<rmm::device_buffer, size_type> bitmask_and(table_view const &view,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::mr::device_memory_resource *mr)
 {
   CUDF_FUNC_RANGE();
   rmm::device_buffer null_mask{0, stream, mr};
-  if (view.num_rows() == 0 or view.num_columns() == 0) { return null_mask; }
+  if (view.num_rows() == 0 or view.num_columns() == 0) {
+    return std::make_pair(std::move(null_mask), 0);
+  }
 
   std::vector<bitmask_type const *> masks;
   std::vector<size_type> offsets;
@@ -618,17 +620,19 @@ rmm::device_buffer bitmask_and(table_view const &view,
       mr);
   }
 
-  return null_mask;
+  return std::make_pair(std::move(null_mask), 0);
 }
 
 // Returns the bitwise OR of the null masks of all columns in the table view
-rmm::device_buffer bitmask_or(table_view const &view,
-                              rmm::cuda_stream_view stream,
-                              rmm::mr::device_memory_resource *mr)
+std::pair<rmm::device_buffer, size_type> bitmask_or(table_view const &view,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource *mr)
 {
   CUDF_FUNC_RANGE();
   rmm::device_buffer null_mask{0, stream, mr};
-  if (view.num_rows() == 0 or view.num_columns() == 0) { return null_mask; }
+  if (view.num_rows() == 0 or view.num_columns() == 0) {
+    return std::make_pair(std::move(null_mask), 0);
+  }
 
   std::vector<bitmask_type const *> masks;
   std::vector<size_type> offsets;
@@ -649,7 +653,47 @@ rmm::device_buffer bitmask_or(table_view const &view,
       mr);
   }
 
-  return null_mask;
+  return std::make_pair(std::move(null_mask), 0);
+}
+
+// Writes the bitwise AND of the null masks of all columns in the table view to `output`
+void inplace_bitmask_and(mutable_column_view &output,
+                         table_view const &view,
+                         rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(output.size() == view.num_rows(), "Mismatch in output size");
+
+  std::vector<bitmask_type const *> masks;
+  std::vector<size_type> offsets;
+  for (auto &&col : view) {
+    if (col.nullable()) {
+      masks.push_back(col.null_mask());
+      offsets.push_back(col.offset());
+    }
+  }
+
+  if (not output.nullable()) {
+    CUDF_EXPECTS(std::none_of(view.begin(), view.end(), [](auto const &col) {
+                   return col.has_nulls();
+                 }),
+                 "Output column must be nullable when the input has nulls");
+    return;
+  }
+  CUDF_EXPECTS(output.offset() == 0, "Output column with a null mask must not have an offset");
+  if (output.size() == 0) {
+    output.set_null_count(0);
+  } else if (masks.empty()) {
+    set_null_mask(output.null_mask(), 0, output.size(), true, stream);
+    output.set_null_count(0);
+  } else {
+    auto const null_count = inplace_bitmask_and(
+      device_span<bitmask_type>(output.null_mask(), num_bitmask_words(output.size())),
+      masks,
+      offsets,
+      output.size(),
+      stream);
+    output.set_null_count(null_count);
+  }
 }
 }  // namespace detail
 
@@ -700,12 +744,12 @@ rmm::device_buffer copy_bitmask(column_view const &view, rmm::mr::device_memory_
 
 rmm::device_buffer bitmask_and(table_view const &view, rmm::mr::device_memory_resource *mr)
 {
-  return detail::bitmask_and(view, rmm::cuda_stream_default, mr);
+  return detail::bitmask_and(view, rmm::cuda_stream_default, mr).first;
 }
 
 rmm::device_buffer bitmask_or(table_view const &view, rmm::mr::device_memory_resource *mr)
 {
-  return detail::bitmask_or(view, rmm::cuda_stream_default, mr);
+  return detail::bitmask_or(view, rmm::cuda_stream_default, mr).first;
 }
 
 }  // namespace cudf
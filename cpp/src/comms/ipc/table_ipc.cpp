@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/comms/ipc.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/cuda_memory_resource.hpp>
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace cudf {
+namespace comms {
+namespace detail {
+namespace {
+
+/**
+ * @brief The start of a message of `export_ipc`, followed by the `packed_columns::metadata`
+ */
+struct message_header {
+  cudaIpcMemHandle_t handle;
+  bool has_data;  // false if the table has no device data and `handle` is unset
+};
+
+/**
+ * @brief Appends the device pointers of `col` and its children to `pointers`, and returns whether
+ * they all start at offset 0, since `packed_columns::metadata` records no offsets.
+ */
+bool collect_pointers(column_view const& col, std::vector<uint8_t const*>& pointers)
+{
+  // the same pointers as `pack_metadata` records
+  if (col.size() > 0 and col.head() != nullptr) { pointers.push_back(col.head<uint8_t>()); }
+  if (col.size() > 0 and col.nullable()) {
+    pointers.push_back(reinterpret_cast<uint8_t const*>(col.null_mask()));
+  }
+  bool no_offsets = col.offset() == 0;
+  for (auto child = col.child_begin(); child != col.child_end(); ++child) {
+    no_offsets = collect_pointers(*child, pointers) and no_offsets;
+  }
+  return no_offsets;
+}
+
+/**
+ * @brief Returns the device allocation holding `ptr`, or nullptr if it is not in one.
+ */
+std::pair<uint8_t const*, size_t> allocation_range(uint8_t const* ptr)
+{
+  CUdeviceptr base{};
+  size_t size{0};
+  if (cuMemGetAddressRange(&base, &size, reinterpret_cast<CUdeviceptr>(ptr)) != CUDA_SUCCESS) {
+    return {nullptr, 0};
+  }
+  return {reinterpret_cast<uint8_t const*>(base), size};
+}
+
+/**
+ * @brief Returns the allocation holding all of `pointers` if it can be shared with other
+ * processes, with its IPC memory handle in `handle`, or nullptr.
+ */
+std::pair<uint8_t const*, size_t> shared_allocation(std::vector<uint8_t const*> const& pointers,
+                                                    cudaIpcMemHandle_t& handle)
+{
+  auto const range = allocation_range(pointers.front());
+  auto const base  = range.first;
+  auto const end   = range.first + range.second;
+  if (base == nullptr or std::any_of(pointers.begin(), pointers.end(), [&](auto ptr) {
+        return ptr < base or ptr >= end;
+      })) {
+    return {nullptr, 0};
+  }
+  // memory not allocated with cudaMalloc, such as managed memory, cannot be shared
+  if (cudaIpcGetMemHandle(&handle, const_cast<uint8_t*>(base)) != cudaSuccess) {
+    cudaGetLastError();  // clears the error
+    return {nullptr, 0};
+  }
+  return range;
+}
+
+}  // namespace
+
+ipc_exported_table export_ipc(table_view const& input, rmm::cuda_stream_view stream)
+{
+  std::vector<uint8_t const*> pointers;
+  auto no_offsets = true;
+  for (auto const& col : input) {
+    no_offsets = collect_pointers(col, pointers) and no_offsets;
+  }
+
+  message_header header{};
+  header.has_data = not pointers.empty();
+  std::unique_ptr<rmm::device_buffer> packed;
+  auto metadata = [&] {
+    if (not header.has_data) { return cudf::pack_metadata(input, nullptr, 0); }
+    if (no_offsets) {
+      auto const [base, size] = shared_allocation(pointers, header.handle);
+      if (base != nullptr) { return cudf::pack_metadata(input, base, size); }
+    }
+    // the packed copy is allocated with cudaMalloc, whose allocations can always be shared
+    static rmm::mr::cuda_memory_resource cuda_mr;
+    auto packed_columns = cudf::detail::pack(input, stream, &cuda_mr);
+    packed              = std::move(packed_columns.gpu_data);
+    header.has_data     = packed->size() > 0;
+    if (header.has_data) { CUDA_TRY(cudaIpcGetMemHandle(&header.handle, packed->data())); }
+    return std::move(*packed_columns.metadata_);
+  }();
+
+  std::vector<uint8_t> message(sizeof(message_header) + metadata.size());
+  std::memcpy(message.data(), &header, sizeof(message_header));
+  std::memcpy(message.data() + sizeof(message_header), metadata.data(), metadata.size());
+
+  // the importing processes read the device data without synchronizing with this process
+  stream.synchronize();
+
+  return ipc_exported_table{std::move(message), std::move(packed)};
+}
+
+std::unique_ptr<ipc_imported_table> import_ipc(std::vector<uint8_t> const& message)
+{
+  CUDF_EXPECTS(message.size() > sizeof(message_header), "Invalid IPC table message");
+  message_header header;
+  std::memcpy(&header, message.data(), sizeof(message_header));
+
+  // closes the mapping if the table cannot be unpacked
+  std::unique_ptr<void, void (*)(void*)> mapping(nullptr, [](void* base) {
+    cudaIpcCloseMemHandle(base);
+  });
+  if (header.has_data) {
+    void* base = nullptr;
+    CUDA_TRY(cudaIpcOpenMemHandle(&base, header.handle, cudaIpcMemLazyEnablePeerAccess));
+    mapping.reset(base);
+  }
+
+  // copied out of the message for the alignment of the metadata entries
+  std::vector<int64_t> metadata((message.size() - sizeof(message_header) + 7) / 8);
+  std::memcpy(metadata.data(),
+              message.data() + sizeof(message_header),
+              message.size() - sizeof(message_header));
+  auto const view = cudf::unpack(reinterpret_cast<uint8_t const*>(metadata.data()),
+                                 static_cast<uint8_t const*>(mapping.get()));
+  return std::make_unique<ipc_imported_table>(mapping.release(), view);
+}
+
+}  // namespace detail
+
+ipc_imported_table::~ipc_imported_table()
+{
+  if (_base != nullptr) { cudaIpcCloseMemHandle(_base); }
+}
+
+ipc_exported_table export_ipc(table_view const& input)
+{
+  CUDF_FUNC_RANGE();
+  return detail::export_ipc(input, rmm::cuda_stream_default);
+}
+
+std::unique_ptr<ipc_imported_table> import_ipc(std::vector<uint8_t> const& message)
+{
+  CUDF_FUNC_RANGE();
+  return detail::import_ipc(message);
+}
+
+}  // namespace comms
+}  // namespace cudf
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/comms/shuffle.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+namespace cudf {
+namespace comms {
+namespace detail {
+
+std::unique_ptr<table> shuffle(table_view const& input,
+                               partition_function const& partition,
+                               shuffle_transport& transport,
+                               size_type max_chunk_rows,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(max_chunk_rows > 0, "max_chunk_rows must be positive");
+
+  auto const num_ranks  = transport.num_ranks();
+  auto const num_rows   = input.num_rows();
+  auto const num_chunks = (static_cast<int64_t>(num_rows) + max_chunk_rows - 1) / max_chunk_rows;
+  // All the ranks take part in every exchange, even once they have no rows left to send
+  auto const num_rounds = transport.all_reduce_max(num_chunks);
+  if (num_rounds == 0) { return empty_like(input); }
+
+  std::vector<packed_columns> received;
+  for (int64_t round = 0; round < num_rounds; ++round) {
+    auto const begin = std::min<int64_t>(round * max_chunk_rows, num_rows);
+    auto const end   = std::min<int64_t>(begin + max_chunk_rows, num_rows);
+    auto const chunk =
+      cudf::slice(input, {static_cast<size_type>(begin), static_cast<size_type>(end)}).front();
+
+    std::vector<size_type> splits(num_ranks - 1, 0);
+    std::unique_ptr<table> partitioned;
+    if (chunk.num_rows() > 0) {
+      std::vector<size_type> offsets;
+      std::tie(partitioned, offsets) = partition(chunk, num_ranks);
+      CUDF_EXPECTS(offsets.size() == static_cast<std::size_t>(num_ranks),
+                   "The partition function must return an offset for each rank");
+      std::copy(offsets.begin() + 1, offsets.end(), splits.begin());
+    }
+    auto packed_tables = cudf::detail::contiguous_split(partitioned ? partitioned->view() : chunk,
+                                                        splits,
+                                                        stream,
+                                                        rmm::mr::get_current_device_resource());
+    partitioned.reset();
+
+    std::vector<packed_columns> partitions;
+    partitions.reserve(num_ranks);
+    std::transform(packed_tables.begin(),
+                   packed_tables.end(),
+                   std::back_inserter(partitions),
+                   [](auto& packed_table) { return std::move(packed_table.data); });
+    auto from_ranks = transport.all_to_all(std::move(partitions), stream);
+    CUDF_EXPECTS(from_ranks.size() == static_cast<std::size_t>(num_ranks),
+                 "The transport must return a partition from each rank");
+    std::move(from_ranks.begin(), from_ranks.end(), std::back_inserter(received));
+  }
+
+  std::vector<table_view> views;
+  views.reserve(received.size());
+  std::transform(received.begin(),
+                 received.end(),
+                 std::back_inserter(views),
+                 [](auto const& packed) { return cudf::unpack(packed); });
+  return cudf::detail::concatenate(views, stream, mr);
+}
+
+}  // namespace detail
+
+partition_function hash_partitioner(std::vector<size_type> const& columns_to_hash,
+                                    hash_id hash_function,
+                                    uint32_t seed)
+{
+  return [columns_to_hash, hash_function, seed](table_view const& input, int num_partitions) {
+    return cudf::hash_partition(input, columns_to_hash, num_partitions, hash_function, seed);
+  };
+}
+
+std::unique_ptr<table> shuffle(table_view const& input,
+                               partition_function const& partition,
+                               shuffle_transport& transport,
+                               size_type max_chunk_rows,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::shuffle(
+    input, partition, transport, max_chunk_rows, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace comms
+}  // namespace cudf
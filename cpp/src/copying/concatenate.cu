@@ -21,6 +21,7 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/detail/concatenate.hpp>
 #include <cudf/lists/detail/concatenate.hpp>
@@ -52,43 +53,27 @@ constexpr bool use_fused_kernel_heuristic(bool const has_nulls, size_t const num
 
 auto create_device_views(host_span<column_view const> views, rmm::cuda_stream_view stream)
 {
-  // Create device views for each input view
-  using CDViewPtr = decltype(
-    column_device_view::create(std::declval<column_view>(), std::declval<rmm::cuda_stream_view>()));
-  auto device_view_owners = std::vector<CDViewPtr>(views.size());
-  std::transform(views.begin(), views.end(), device_view_owners.begin(), [stream](auto const& col) {
-    // TODO creating this device view can invoke null count computation
-    // even though it isn't used. See this issue:
-    // https://github.com/rapidsai/cudf/issues/4368
-    return column_device_view::create(col, stream);
-  });
-
-  // Assemble contiguous array of device views
-  auto device_views = thrust::host_vector<column_device_view>();
-  device_views.reserve(views.size());
-  std::transform(device_view_owners.cbegin(),
-                 device_view_owners.cend(),
-                 std::back_inserter(device_views),
-                 [](auto const& col) { return *col; });
-  // TODO each of these device vector copies invoke stream synchronization
-  // which appears to add unnecessary overhead. See this issue:
-  // https://github.com/rapidsai/rmm/issues/120
-  auto d_views = make_device_uvector_async(device_views);
+  // Assemble contiguous array of device views, with the descendants of all the views in the same
+  // allocation, so that thousands of inputs cost a single copy to device memory
+  std::unique_ptr<rmm::device_buffer> device_view_owners;
+  column_device_view* device_views_ptr;
+  std::tie(device_view_owners, device_views_ptr) =
+    contiguous_copy_column_device_views<column_device_view>(views, stream);
+  auto const d_views = device_span<column_device_view const>(device_views_ptr, views.size());
 
   // Compute the partition offsets
   auto offsets = thrust::host_vector<size_t>(views.size() + 1);
   thrust::transform_inclusive_scan(
     thrust::host,
-    device_views.cbegin(),
-    device_views.cend(),
+    views.begin(),
+    views.end(),
     std::next(offsets.begin()),
-    [](auto const& col) { return col.size(); },
+    [](auto const& col) { return static_cast<size_t>(col.size()); },
     thrust::plus<size_t>{});
-  auto d_offsets         = make_device_uvector_async(offsets);
+  auto d_offsets         = make_device_uvector_async(offsets, stream);
   auto const output_size = offsets.back();
 
-  return std::make_tuple(
-    std::move(device_view_owners), std::move(d_views), std::move(d_offsets), output_size);
+  return std::make_tuple(std::move(device_view_owners), d_views, std::move(d_offsets), output_size);
 }
 
 /**
@@ -410,6 +395,35 @@ std::unique_ptr<column> concatenate(host_span<column_view const> columns_to_conc
     columns_to_concat.front().type(), concatenate_dispatch{columns_to_concat, stream, mr});
 }
 
+namespace {
+
+/**
+ * @brief Moves the buffers of `col` and of its descendants to `stream`, so that they are freed on
+ * `stream` rather than on the stream they were allocated on.
+ */
+std::unique_ptr<column> rebind_to_stream(std::unique_ptr<column>&& col,
+                                         rmm::cuda_stream_view stream)
+{
+  auto const type       = col->type();
+  auto const size       = col->size();
+  auto const null_count = col->null_count();
+  auto contents         = col->release();
+  contents.data->set_stream(stream);
+  contents.null_mask->set_stream(stream);
+  std::transform(contents.children.begin(),
+                 contents.children.end(),
+                 contents.children.begin(),
+                 [stream](auto& child) { return rebind_to_stream(std::move(child), stream); });
+  return std::make_unique<column>(type,
+                                  size,
+                                  std::move(*contents.data),
+                                  std::move(*contents.null_mask),
+                                  null_count,
+                                  std::move(contents.children));
+}
+
+}  // namespace
+
 std::unique_ptr<table> concatenate(host_span<table_view const> tables_to_concat,
                                    rmm::cuda_stream_view stream,
                                    rmm::mr::device_memory_resource* mr)
@@ -424,17 +438,31 @@ std::unique_ptr<table> concatenate(host_span<table_view const> tables_to_concat,
                            }),
                "Mismatch in table columns to concatenate.");
 
-  std::vector<std::unique_ptr<column>> concat_columns;
+  std::vector<std::vector<column_view>> columns_to_concat(first_table.num_columns());
   for (size_type i = 0; i < first_table.num_columns(); ++i) {
-    std::vector<column_view> cols;
     std::transform(tables_to_concat.begin(),
                    tables_to_concat.end(),
-                   std::back_inserter(cols),
+                   std::back_inserter(columns_to_concat[i]),
                    [i](auto const& t) { return t.column(i); });
 
     // verify all types match and that we won't overflow size_type in output size
-    bounds_and_type_check(cols.begin(), cols.end());
-    concat_columns.emplace_back(detail::concatenate(cols, stream, mr));
+    bounds_and_type_check(columns_to_concat[i].begin(), columns_to_concat[i].end());
+  }
+
+  // The columns are independent, so concatenate them concurrently on streams of the pool
+  auto const streams = fork_streams(stream, columns_to_concat.size());
+  std::vector<std::unique_ptr<column>> concat_columns;
+  for (size_t i = 0; i < columns_to_concat.size(); ++i) {
+    concat_columns.emplace_back(
+      detail::concatenate(columns_to_concat[i], streams[i % streams.size()], mr));
+  }
+  join_streams(streams, stream);
+
+  if (streams.size() > 1) {
+    std::transform(concat_columns.begin(),
+                   concat_columns.end(),
+                   concat_columns.begin(),
+                   [stream](auto& col) { return rebind_to_stream(std::move(col), stream); });
   }
   return std::make_unique<table>(std::move(concat_columns));
 }
@@ -22,15 +22,20 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/iterator/discard_iterator.h>
 
+#include <cstdint>
+#include <functional>
 #include <numeric>
 
 namespace cudf {
@@ -279,6 +284,49 @@ __global__ void copy_partition(int num_src_bufs,
     buf_info[buf_index].valid_count > 0 ? &buf_info[buf_index].valid_count : nullptr);
 }
 
+/**
+ * @brief Kernel which copies a range of destination buffers into a bounce buffer.
+ *
+ * Copies the destination buffers `[first_buf, first_buf + gridDim.x)`, one block per buffer. The
+ * partitions are laid out one after the other, and `dst` holds the bytes of this layout starting
+ * at `dst_begin`.
+ *
+ * @param num_src_bufs Total number of source buffers (N)
+ * @param first_buf Index of the first destination buffer to copy
+ * @param src_bufs Input source buffers (N)
+ * @param dst Bounce buffer to copy to
+ * @param dst_begin Offset of `dst` in the layout of all the partitions
+ * @param partition_offsets Offset of each partition in the layout of all the partitions
+ * @param buf_info Information on the range of values to be copied for each destination buffer.
+ */
+template <int block_size>
+__global__ void copy_partition_chunk(int num_src_bufs,
+                                     std::size_t first_buf,
+                                     uint8_t** src_bufs,
+                                     uint8_t* dst,
+                                     std::size_t dst_begin,
+                                     std::size_t const* partition_offsets,
+                                     dst_buf_info* buf_info)
+{
+  std::size_t const buf_index = first_buf + blockIdx.x;
+  int const partition_index   = buf_index / num_src_bufs;
+  int const src_buf_index     = buf_index % num_src_bufs;
+
+  // copy, shifting offsets and validity bits as needed
+  copy_buffer<block_size>(
+    dst + (partition_offsets[partition_index] + buf_info[buf_index].dst_offset - dst_begin),
+    src_bufs[src_buf_index],
+    threadIdx.x,
+    buf_info[buf_index].num_elements,
+    buf_info[buf_index].element_size,
+    buf_info[buf_index].src_row_index,
+    blockDim.x,
+    buf_info[buf_index].value_shift,
+    buf_info[buf_index].bit_shift,
+    buf_info[buf_index].num_rows,
+    buf_info[buf_index].valid_count > 0 ? &buf_info[buf_index].valid_count : nullptr);
+}
+
 // The block of functions below are all related:
 //
 // compute_offset_stack_size()
@@ -759,16 +807,11 @@ struct size_of_helper {
   }
 };
 
-};  // anonymous namespace
-
-namespace detail {
-
-std::vector<packed_table> contiguous_split(cudf::table_view const& input,
-                                           std::vector<size_type> const& splits,
-                                           rmm::cuda_stream_view stream,
-                                           rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Throws if `splits` are not valid split indices of `input`.
+ */
+void validate_splits(cudf::table_view const& input, std::vector<size_type> const& splits)
 {
-  if (input.num_columns() == 0) { return {}; }
   if (splits.size() > 0) {
     CUDF_EXPECTS(splits.back() <= input.column(0).size(),
                  "splits can't exceed size of input columns");
@@ -783,26 +826,52 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
       begin = end;
     }
   }
+}
 
-  std::size_t const num_partitions   = splits.size() + 1;
-  std::size_t const num_root_columns = input.num_columns();
-
-  // if inputs are empty, just return num_partitions empty tables
-  if (input.column(0).size() == 0) {
-    // build the empty results
-    std::vector<packed_table> result;
-    result.reserve(num_partitions);
-    auto iter = thrust::make_counting_iterator(0);
-    std::transform(
-      iter, iter + num_partitions, std::back_inserter(result), [&input](int partition_index) {
-        return packed_table{input,
-                            packed_columns{std::make_unique<packed_columns::metadata>(pack_metadata(
-                                             input, static_cast<uint8_t const*>(nullptr), 0)),
-                                           std::make_unique<rmm::device_buffer>()}};
-      });
-
-    return result;
+/**
+ * @brief The destination buffers of a split, with their sizes and offsets in their partitions.
+ *
+ * The host and device copies hold the total size of each partition followed by the
+ * `dst_buf_info` of each of the `num_partitions * num_src_bufs` destination buffers, partition
+ * after partition.
+ */
+struct split_layout {
+  std::size_t num_partitions;
+  size_type num_src_bufs;
+  std::size_t num_bufs;
+  std::size_t buf_sizes_size;
+  std::size_t dst_buf_info_size;
+  std::vector<uint8_t> h_buf_sizes_and_dst_info;
+  rmm::device_buffer d_buf_sizes_and_dst_info;
+
+  std::size_t* h_buf_sizes()
+  {
+    return reinterpret_cast<std::size_t*>(h_buf_sizes_and_dst_info.data());
+  }
+  dst_buf_info* h_dst_buf_info()
+  {
+    return reinterpret_cast<dst_buf_info*>(h_buf_sizes_and_dst_info.data() + buf_sizes_size);
+  }
+  std::size_t* d_buf_sizes()
+  {
+    return reinterpret_cast<std::size_t*>(d_buf_sizes_and_dst_info.data());
   }
+  dst_buf_info* d_dst_buf_info()
+  {
+    return reinterpret_cast<dst_buf_info*>(static_cast<uint8_t*>(d_buf_sizes_and_dst_info.data()) +
+                                           buf_sizes_size);
+  }
+};
+
+/**
+ * @brief Computes the sizes and offsets of the destination buffers of splitting the non-empty
+ * `input` at `splits`, and copies them to the host.
+ */
+split_layout compute_split_layout(cudf::table_view const& input,
+                                  std::vector<size_type> const& splits,
+                                  rmm::cuda_stream_view stream)
+{
+  std::size_t const num_partitions = splits.size() + 1;
 
   // compute # of source buffers (column data, validity, children), # of partitions
   // and total # of buffers
@@ -854,17 +923,19 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
     cudf::util::round_up_safe(num_partitions * sizeof(std::size_t), split_align);
   std::size_t const dst_buf_info_size =
     cudf::util::round_up_safe(num_bufs * sizeof(dst_buf_info), split_align);
-  // host-side
-  std::vector<uint8_t> h_buf_sizes_and_dst_info(buf_sizes_size + dst_buf_info_size);
-  std::size_t* h_buf_sizes = reinterpret_cast<std::size_t*>(h_buf_sizes_and_dst_info.data());
-  dst_buf_info* h_dst_buf_info =
-    reinterpret_cast<dst_buf_info*>(h_buf_sizes_and_dst_info.data() + buf_sizes_size);
-  // device-side
-  rmm::device_buffer d_buf_sizes_and_dst_info(
-    buf_sizes_size + dst_buf_info_size, stream, rmm::mr::get_current_device_resource());
-  std::size_t* d_buf_sizes     = reinterpret_cast<std::size_t*>(d_buf_sizes_and_dst_info.data());
-  dst_buf_info* d_dst_buf_info = reinterpret_cast<dst_buf_info*>(
-    static_cast<uint8_t*>(d_buf_sizes_and_dst_info.data()) + buf_sizes_size);
+  // host-side and device-side
+  split_layout layout{num_partitions,
+                      num_src_bufs,
+                      num_bufs,
+                      buf_sizes_size,
+                      dst_buf_info_size,
+                      std::vector<uint8_t>(buf_sizes_size + dst_buf_info_size),
+                      rmm::device_buffer(buf_sizes_size + dst_buf_info_size,
+                                         stream,
+                                         rmm::mr::get_current_device_resource())};
+  std::size_t* h_buf_sizes     = layout.h_buf_sizes();
+  std::size_t* d_buf_sizes     = layout.d_buf_sizes();
+  dst_buf_info* d_dst_buf_info = layout.d_dst_buf_info();
 
   // compute sizes of each column in each partition, including alignment.
   thrust::transform(
@@ -979,6 +1050,61 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
                            stream.value()));
   stream.synchronize();
 
+  return layout;
+}
+
+/**
+ * @brief Returns the pointers to the source buffers of `input`, copied to the device.
+ */
+rmm::device_uvector<uint8_t*> make_src_buf_pointers(cudf::table_view const& input,
+                                                   size_type num_src_bufs,
+                                                   rmm::cuda_stream_view stream)
+{
+  std::vector<uint8_t*> h_src_bufs(num_src_bufs);
+  setup_src_buf_data(input.begin(), input.end(), h_src_bufs.data());
+  return cudf::detail::make_device_uvector_async(h_src_bufs, stream);
+}
+
+};  // anonymous namespace
+
+namespace detail {
+
+std::vector<packed_table> contiguous_split(cudf::table_view const& input,
+                                           std::vector<size_type> const& splits,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  if (input.num_columns() == 0) { return {}; }
+  validate_splits(input, splits);
+
+  std::size_t const num_partitions   = splits.size() + 1;
+  std::size_t const num_root_columns = input.num_columns();
+
+  // if inputs are empty, just return num_partitions empty tables
+  if (input.column(0).size() == 0) {
+    // build the empty results
+    std::vector<packed_table> result;
+    result.reserve(num_partitions);
+    auto iter = thrust::make_counting_iterator(0);
+    std::transform(
+      iter, iter + num_partitions, std::back_inserter(result), [&input](int partition_index) {
+        return packed_table{input,
+                            packed_columns{std::make_unique<packed_columns::metadata>(pack_metadata(
+                                             input, static_cast<uint8_t const*>(nullptr), 0)),
+                                           std::make_unique<rmm::device_buffer>()}};
+      });
+
+    return result;
+  }
+
+  auto layout                         = compute_split_layout(input, splits, stream);
+  size_type const num_src_bufs        = layout.num_src_bufs;
+  std::size_t const num_bufs          = layout.num_bufs;
+  std::size_t const dst_buf_info_size = layout.dst_buf_info_size;
+  std::size_t* h_buf_sizes            = layout.h_buf_sizes();
+  dst_buf_info* h_dst_buf_info        = layout.h_dst_buf_info();
+  dst_buf_info* d_dst_buf_info        = layout.d_dst_buf_info();
+
   // allocate output partition buffers
   std::vector<rmm::device_buffer> out_buffers;
   out_buffers.reserve(num_partitions);
@@ -989,8 +1115,7 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
                    return rmm::device_buffer{bytes, stream, mr};
                  });
 
-  // packed block of memory 3. pointers to source and destination buffers (and stack space on the
-  // gpu for offset computation)
+  // packed block of memory 3. pointers to source and destination buffers
   std::size_t const src_bufs_size =
     cudf::util::round_up_safe(num_src_bufs * sizeof(uint8_t*), split_align);
   std::size_t const dst_bufs_size =
@@ -1000,9 +1125,8 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
   uint8_t** h_src_bufs = reinterpret_cast<uint8_t**>(h_src_and_dst_buffers.data());
   uint8_t** h_dst_bufs = reinterpret_cast<uint8_t**>(h_src_and_dst_buffers.data() + src_bufs_size);
   // device-side
-  rmm::device_buffer d_src_and_dst_buffers(src_bufs_size + dst_bufs_size + offset_stack_size,
-                                           stream,
-                                           rmm::mr::get_current_device_resource());
+  rmm::device_buffer d_src_and_dst_buffers(
+    src_bufs_size + dst_bufs_size, stream, rmm::mr::get_current_device_resource());
   uint8_t** d_src_bufs = reinterpret_cast<uint8_t**>(d_src_and_dst_buffers.data());
   uint8_t** d_dst_bufs = reinterpret_cast<uint8_t**>(
     reinterpret_cast<uint8_t*>(d_src_and_dst_buffers.data()) + src_bufs_size);
@@ -1058,6 +1182,120 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
   return result;
 }
 
+std::vector<packed_columns::metadata> chunked_contiguous_split(
+  cudf::table_view const& input,
+  std::vector<size_type> const& splits,
+  std::vector<device_span<uint8_t>> const& buffers,
+  std::function<void(std::size_t, std::vector<packed_region> const&)> const& packed_callback,
+  rmm::cuda_stream_view stream)
+{
+  if (input.num_columns() == 0) { return {}; }
+  validate_splits(input, splits);
+  CUDF_EXPECTS(not buffers.empty(), "No bounce buffers to pack into");
+  for (auto const& buffer : buffers) {
+    CUDF_EXPECTS(reinterpret_cast<std::uintptr_t>(buffer.data()) % split_align == 0,
+                 "Bounce buffers must be aligned to 64 bytes");
+  }
+
+  std::size_t const num_partitions = splits.size() + 1;
+
+  // if inputs are empty, all the partitions are empty tables
+  if (input.column(0).size() == 0) {
+    return std::vector<packed_columns::metadata>(
+      num_partitions, pack_metadata(input, static_cast<uint8_t const*>(nullptr), 0));
+  }
+
+  auto layout                  = compute_split_layout(input, splits, stream);
+  size_type const num_src_bufs = layout.num_src_bufs;
+  std::size_t const num_bufs   = layout.num_bufs;
+  std::size_t* h_buf_sizes     = layout.h_buf_sizes();
+  dst_buf_info* h_dst_buf_info = layout.h_dst_buf_info();
+  dst_buf_info* d_dst_buf_info = layout.d_dst_buf_info();
+
+  // the partitions are packed one after the other, each destination buffer at its offset in its
+  // partition
+  std::vector<std::size_t> partition_offsets(num_partitions);
+  std::exclusive_scan(
+    h_buf_sizes, h_buf_sizes + num_partitions, partition_offsets.begin(), std::size_t{0});
+  auto const d_partition_offsets = make_device_uvector_async(partition_offsets, stream);
+  auto const d_src_bufs          = make_src_buf_pointers(input, num_src_bufs, stream);
+  auto const buf_begin           = [&](std::size_t buf_index) {
+    return partition_offsets[buf_index / num_src_bufs] + h_dst_buf_info[buf_index].dst_offset;
+  };
+  auto const buf_end = [&](std::size_t buf_index) {
+    return buf_begin(buf_index) + h_dst_buf_info[buf_index].buf_size;
+  };
+
+  // fill the bounce buffers in turn with as many whole destination buffers as fit
+  std::size_t first_buf = 0;
+  for (std::size_t chunk = 0; first_buf < num_bufs; ++chunk) {
+    auto const buffer_index = chunk % buffers.size();
+    auto const& buffer      = buffers[buffer_index];
+    auto const chunk_begin  = buf_begin(first_buf);
+    auto last_buf           = first_buf;
+    while (last_buf < num_bufs and buf_end(last_buf) - chunk_begin <= buffer.size()) {
+      ++last_buf;
+    }
+    CUDF_EXPECTS(last_buf > first_buf,
+                 "Bounce buffer is smaller than the data of a column of a partition");
+
+    // copy.  1 block per buffer
+    {
+      constexpr size_type block_size = 512;
+      copy_partition_chunk<block_size>
+        <<<last_buf - first_buf, block_size, 0, stream.value()>>>(num_src_bufs,
+                                                                  first_buf,
+                                                                  d_src_bufs.data(),
+                                                                  buffer.data(),
+                                                                  chunk_begin,
+                                                                  d_partition_offsets.data(),
+                                                                  d_dst_buf_info);
+    }
+
+    // DtoH dst info of the chunk (to retrieve null counts)
+    CUDA_TRY(cudaMemcpyAsync(h_dst_buf_info + first_buf,
+                             d_dst_buf_info + first_buf,
+                             (last_buf - first_buf) * sizeof(dst_buf_info),
+                             cudaMemcpyDeviceToHost,
+                             stream.value()));
+    stream.synchronize();
+
+    // one region for each partition with destination buffers in the chunk
+    std::vector<packed_region> regions;
+    for (auto buf_index = first_buf; buf_index < last_buf;) {
+      auto const partition    = buf_index / num_src_bufs;
+      auto const region_end   = std::min((partition + 1) * num_src_bufs, last_buf);
+      auto const region_begin = buf_begin(buf_index);
+      regions.push_back(packed_region{static_cast<size_type>(partition),
+                                      h_buf_sizes[partition],
+                                      region_begin - partition_offsets[partition],
+                                      region_begin - chunk_begin,
+                                      buf_end(region_end - 1) - region_begin});
+      buf_index = region_end;
+    }
+    packed_callback(buffer_index, regions);
+
+    first_buf = last_buf;
+  }
+
+  // build the metadata of each partition.  Only the offsets of the columns in the contiguous
+  // buffer of their partition are serialized, so any base address will do.
+  auto const base_ptr = reinterpret_cast<uint8_t const*>(split_align);
+  std::vector<packed_columns::metadata> result;
+  result.reserve(num_partitions);
+  std::vector<column_view> cols;
+  cols.reserve(input.num_columns());
+  auto cur_dst_buf_info = h_dst_buf_info;
+  for (std::size_t idx = 0; idx < num_partitions; idx++) {
+    cur_dst_buf_info = build_output_columns(
+      input.begin(), input.end(), cur_dst_buf_info, std::back_inserter(cols), base_ptr);
+    result.push_back(cudf::pack_metadata(cudf::table_view{cols}, base_ptr, h_buf_sizes[idx]));
+    cols.clear();
+  }
+
+  return result;
+}
+
 };  // namespace detail
 
 std::vector<packed_table> contiguous_split(cudf::table_view const& input,
@@ -1068,4 +1306,15 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
   return cudf::detail::contiguous_split(input, splits, rmm::cuda_stream_default, mr);
 }
 
+std::vector<packed_columns::metadata> chunked_contiguous_split(
+  cudf::table_view const& input,
+  std::vector<size_type> const& splits,
+  std::vector<device_span<uint8_t>> const& buffers,
+  std::function<void(std::size_t, std::vector<packed_region> const&)> const& packed_callback)
+{
+  CUDF_FUNC_RANGE();
+  return cudf::detail::chunked_contiguous_split(
+    input, splits, buffers, packed_callback, rmm::cuda_stream_default);
+}
+
 };  // namespace cudf
@@ -18,6 +18,7 @@
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/copy_if_else.cuh>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/strings/string_view.cuh>
@@ -219,6 +220,96 @@ std::unique_ptr<column> copy_if_else(Left const& lhs,
   }
 }
 
+/**
+ * @brief Functor called by the `type_dispatcher` to invoke copy_if_else into a preallocated
+ *        column on combinations of column_view and scalar
+ */
+struct copy_if_else_into_functor {
+  template <typename T, typename Left, typename Right, typename Filter>
+  std::enable_if_t<is_rep_layout_compatible<T>()> operator()(Left const& lhs,
+                                                             Right const& rhs,
+                                                             bool left_nullable,
+                                                             bool right_nullable,
+                                                             Filter filter,
+                                                             mutable_column_view& output,
+                                                             rmm::cuda_stream_view stream)
+  {
+    auto const nullable = left_nullable or right_nullable;
+    auto const copy     = [&](auto lhs_iter, auto rhs_iter) {
+      detail::copy_if_else(
+        nullable, lhs_iter, lhs_iter + output.size(), rhs_iter, filter, output, stream);
+    };
+    if (left_nullable) {
+      if (right_nullable) {
+        return copy(cudf::detail::make_pair_iterator<T, true>(lhs),
+                    cudf::detail::make_pair_iterator<T, true>(rhs));
+      }
+      return copy(cudf::detail::make_pair_iterator<T, true>(lhs),
+                  cudf::detail::make_pair_iterator<T, false>(rhs));
+    }
+    if (right_nullable) {
+      return copy(cudf::detail::make_pair_iterator<T, false>(lhs),
+                  cudf::detail::make_pair_iterator<T, true>(rhs));
+    }
+    copy(cudf::detail::make_pair_iterator<T, false>(lhs),
+         cudf::detail::make_pair_iterator<T, false>(rhs));
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_rep_layout_compatible<T>()> operator()(Args&&...)
+  {
+    CUDF_FAIL("Only fixed-width columns can be written into a preallocated column");
+  }
+};
+
+// wrap up boolean_mask into a filter lambda
+template <typename Left, typename Right>
+void copy_if_else(Left const& lhs,
+                  Right const& rhs,
+                  bool left_nullable,
+                  bool right_nullable,
+                  column_view const& boolean_mask,
+                  mutable_column_view& output,
+                  rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(lhs.type() == rhs.type(), "Both inputs must be of the same type");
+  CUDF_EXPECTS(lhs.type() == output.type(), "Output column must be of the type of the inputs");
+  CUDF_EXPECTS(boolean_mask.type() == data_type(type_id::BOOL8),
+               "Boolean mask column must be of type type_id::BOOL8");
+  CUDF_EXPECTS(boolean_mask.size() == output.size(),
+               "Boolean mask column must be the same size as the output column");
+
+  auto bool_mask_device_p             = column_device_view::create(boolean_mask, stream);
+  column_device_view bool_mask_device = *bool_mask_device_p;
+
+  auto const dispatch = [&](auto filter) {
+    cudf::type_dispatcher<dispatch_storage_type>(lhs.type(),
+                                                 copy_if_else_into_functor{},
+                                                 lhs,
+                                                 rhs,
+                                                 left_nullable,
+                                                 right_nullable,
+                                                 filter,
+                                                 output,
+                                                 stream);
+  };
+  if (boolean_mask.has_nulls()) {
+    dispatch([bool_mask_device] __device__(cudf::size_type i) {
+      return bool_mask_device.is_valid_nocheck(i) and bool_mask_device.element<bool>(i);
+    });
+  } else {
+    dispatch([bool_mask_device] __device__(cudf::size_type i) {
+      return bool_mask_device.element<bool>(i);
+    });
+  }
+
+  if (not(left_nullable or right_nullable) and output.nullable()) {
+    set_null_mask(
+      output.null_mask(), output.offset(), output.offset() + output.size(), true, stream);
+    output.set_null_count(0);
+  }
+}
+
 };  // namespace
 
 std::unique_ptr<column> copy_if_else(column_view const& lhs,
@@ -282,6 +373,67 @@ std::unique_ptr<column> copy_if_else(scalar const& lhs,
   return copy_if_else(lhs, rhs, !lhs.is_valid(), !rhs.is_valid(), boolean_mask, stream, mr);
 }
 
+void copy_if_else(column_view const& lhs,
+                  column_view const& rhs,
+                  column_view const& boolean_mask,
+                  mutable_column_view& output,
+                  rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(lhs.size() == rhs.size(), "Both columns must be of the size");
+  CUDF_EXPECTS(boolean_mask.size() == lhs.size(),
+               "Boolean mask column must be the same size as lhs and rhs columns");
+  copy_if_else(*column_device_view::create(lhs, stream),
+               *column_device_view::create(rhs, stream),
+               lhs.has_nulls(),
+               rhs.has_nulls(),
+               boolean_mask,
+               output,
+               stream);
+}
+
+void copy_if_else(scalar const& lhs,
+                  column_view const& rhs,
+                  column_view const& boolean_mask,
+                  mutable_column_view& output,
+                  rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(boolean_mask.size() == rhs.size(),
+               "Boolean mask column must be the same size as rhs column");
+  copy_if_else(lhs,
+               *column_device_view::create(rhs, stream),
+               !lhs.is_valid(),
+               rhs.has_nulls(),
+               boolean_mask,
+               output,
+               stream);
+}
+
+void copy_if_else(column_view const& lhs,
+                  scalar const& rhs,
+                  column_view const& boolean_mask,
+                  mutable_column_view& output,
+                  rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(boolean_mask.size() == lhs.size(),
+               "Boolean mask column must be the same size as lhs column");
+  copy_if_else(*column_device_view::create(lhs, stream),
+               rhs,
+               lhs.has_nulls(),
+               !rhs.is_valid(),
+               boolean_mask,
+               output,
+               stream);
+}
+
+void copy_if_else(scalar const& lhs,
+                  scalar const& rhs,
+                  column_view const& boolean_mask,
+                  mutable_column_view& output,
+                  rmm::cuda_stream_view stream)
+{
+  copy_if_else(lhs, rhs, !lhs.is_valid(), !rhs.is_valid(), boolean_mask, output, stream);
+}
+
 };  // namespace detail
 
 std::unique_ptr<column> copy_if_else(column_view const& lhs,
@@ -320,4 +472,40 @@ std::unique_ptr<column> copy_if_else(scalar const& lhs,
   return detail::copy_if_else(lhs, rhs, boolean_mask, rmm::cuda_stream_default, mr);
 }
 
+void copy_if_else(column_view const& lhs,
+                  column_view const& rhs,
+                  column_view const& boolean_mask,
+                  mutable_column_view& output)
+{
+  CUDF_FUNC_RANGE();
+  detail::copy_if_else(lhs, rhs, boolean_mask, output, rmm::cuda_stream_default);
+}
+
+void copy_if_else(scalar const& lhs,
+                  column_view const& rhs,
+                  column_view const& boolean_mask,
+                  mutable_column_view& output)
+{
+  CUDF_FUNC_RANGE();
+  detail::copy_if_else(lhs, rhs, boolean_mask, output, rmm::cuda_stream_default);
+}
+
+void copy_if_else(column_view const& lhs,
+                  scalar const& rhs,
+                  column_view const& boolean_mask,
+                  mutable_column_view& output)
+{
+  CUDF_FUNC_RANGE();
+  detail::copy_if_else(lhs, rhs, boolean_mask, output, rmm::cuda_stream_default);
+}
+
+void copy_if_else(scalar const& lhs,
+                  scalar const& rhs,
+                  column_view const& boolean_mask,
+                  mutable_column_view& output)
+{
+  CUDF_FUNC_RANGE();
+  detail::copy_if_else(lhs, rhs, boolean_mask, output, rmm::cuda_stream_default);
+}
+
 }  // namespace cudf
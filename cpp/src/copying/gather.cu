@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,7 +19,10 @@
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/indexalator.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
@@ -54,6 +57,143 @@ std::unique_ptr<table> gather(table_view const& source_table,
   return gather(source_table, map_begin, map_end, bounds_policy, stream, mr);
 }
 
+namespace {
+
+/**
+ * @brief Gathers the elements of a fixed-width column into the data of a preallocated column.
+ */
+struct column_gatherer_into {
+  template <typename Element,
+            typename MapIterator,
+            std::enable_if_t<is_rep_layout_compatible<Element>()>* = nullptr>
+  void operator()(column_view const& source,
+                  MapIterator map_begin,
+                  MapIterator map_end,
+                  bool nullify_out_of_bounds,
+                  mutable_column_view& target,
+                  rmm::cuda_stream_view stream)
+  {
+    gather_helper(source.begin<Element>(),
+                  source.size(),
+                  target.begin<Element>(),
+                  map_begin,
+                  map_end,
+                  nullify_out_of_bounds,
+                  stream);
+  }
+
+  template <typename Element,
+            typename MapIterator,
+            std::enable_if_t<not is_rep_layout_compatible<Element>()>* = nullptr>
+  void operator()(column_view const&,
+                  MapIterator,
+                  MapIterator,
+                  bool,
+                  mutable_column_view&,
+                  rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Only fixed-width columns can be gathered into a preallocated column");
+  }
+};
+
+template <typename MapIterator>
+void gather_into(table_view const& source_table,
+                 MapIterator map_begin,
+                 MapIterator map_end,
+                 mutable_table_view& output,
+                 out_of_bounds_policy bounds_policy,
+                 rmm::cuda_stream_view stream)
+{
+  auto const nullify = bounds_policy == out_of_bounds_policy::NULLIFY;
+
+  // Only the columns whose gathered rows can be null need a null mask kernel
+  std::vector<size_type> gathered;
+  for (size_type i = 0; i < source_table.num_columns(); ++i) {
+    if (source_table.column(i).has_nulls() or nullify) {
+      CUDF_EXPECTS(output.column(i).nullable(),
+                   "Output column must be nullable when the gathered rows can be null");
+      CUDF_EXPECTS(output.column(i).offset() == 0,
+                   "Output column with a null mask must not have an offset");
+      gathered.push_back(i);
+    }
+  }
+
+  for (size_type i = 0; i < source_table.num_columns(); ++i) {
+    auto& target = output.column(i);
+    type_dispatcher<dispatch_storage_type>(source_table.column(i).type(),
+                                           column_gatherer_into{},
+                                           source_table.column(i),
+                                           map_begin,
+                                           map_end,
+                                           nullify,
+                                           target,
+                                           stream);
+    auto const is_gathered = std::find(gathered.begin(), gathered.end(), i) != gathered.end();
+    if (not is_gathered and target.nullable()) {
+      set_null_mask(
+        target.null_mask(), target.offset(), target.offset() + target.size(), true, stream);
+      target.set_null_count(0);
+    }
+  }
+  if (gathered.empty()) { return; }
+
+  std::vector<bitmask_type*> target_masks(gathered.size());
+  std::transform(gathered.begin(), gathered.end(), target_masks.begin(), [&output](auto i) {
+    return output.column(i).null_mask();
+  });
+  auto d_target_masks = make_device_uvector_async(target_masks, stream);
+
+  auto const device_source = table_device_view::create(source_table.select(gathered), stream);
+  auto d_valid_counts      = make_zeroed_device_uvector_async<size_type>(gathered.size(), stream);
+  auto const impl          = nullify ? gather_bitmask<gather_bitmask_op::NULLIFY, MapIterator>
+                                     : gather_bitmask<gather_bitmask_op::DONT_CHECK, MapIterator>;
+  impl(*device_source,
+       map_begin,
+       d_target_masks.data(),
+       gathered.size(),
+       output.num_rows(),
+       d_valid_counts.data(),
+       stream);
+
+  auto const valid_counts = make_std_vector_sync(d_valid_counts, stream);
+  for (size_t i = 0; i < gathered.size(); ++i) {
+    output.column(gathered[i]).set_null_count(output.num_rows() - valid_counts[i]);
+  }
+}
+
+}  // namespace
+
+void gather(table_view const& source_table,
+            column_view const& gather_map,
+            mutable_table_view& output,
+            out_of_bounds_policy bounds_policy,
+            negative_index_policy neg_indices,
+            rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(gather_map.has_nulls() == false, "gather_map contains nulls");
+  CUDF_EXPECTS(source_table.num_columns() == output.num_columns(), "Column count mismatch");
+  CUDF_EXPECTS(gather_map.size() == output.num_rows(), "Output size must match the gather map");
+  for (size_type i = 0; i < source_table.num_columns(); ++i) {
+    CUDF_EXPECTS(source_table.column(i).type() == output.column(i).type(), "Column type mismatch");
+  }
+
+  auto map_begin = indexalator_factory::make_input_iterator(gather_map);
+  auto map_end   = map_begin + gather_map.size();
+
+  if (neg_indices == negative_index_policy::ALLOWED) {
+    cudf::size_type n_rows = source_table.num_rows();
+    auto idx_converter = [n_rows] __device__(size_type in) { return in < 0 ? in + n_rows : in; };
+    gather_into(source_table,
+                thrust::make_transform_iterator(map_begin, idx_converter),
+                thrust::make_transform_iterator(map_end, idx_converter),
+                output,
+                bounds_policy,
+                stream);
+  } else {
+    gather_into(source_table, map_begin, map_end, output, bounds_policy, stream);
+  }
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> gather(table_view const& source_table,
@@ -70,4 +210,18 @@ std::unique_ptr<table> gather(table_view const& source_table,
     source_table, gather_map, bounds_policy, index_policy, rmm::cuda_stream_default, mr);
 }
 
+void gather(table_view const& source_table,
+            column_view const& gather_map,
+            mutable_table_view& output,
+            out_of_bounds_policy bounds_policy)
+{
+  CUDF_FUNC_RANGE();
+
+  auto index_policy = is_unsigned(gather_map.type()) ? detail::negative_index_policy::NOT_ALLOWED
+                                                     : detail::negative_index_policy::ALLOWED;
+
+  detail::gather(
+    source_table, gather_map, output, bounds_policy, index_policy, rmm::cuda_stream_default);
+}
+
 }  // namespace cudf
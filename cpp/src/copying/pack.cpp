@@ -14,10 +14,18 @@
  * limitations under the License.
  */
 
+#include <io/comp/gpuinflate.h>
+
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 
 namespace cudf {
 namespace detail {
@@ -52,7 +60,9 @@ struct serialized_column {
   data_type type;
   size_type size;
   size_type null_count;
-  int64_t data_offset;       // offset into contiguous data buffer, or -1 if column data is null
+  // offset into contiguous data buffer, or -1 if column data is null.  For the first entry, the
+  // offset into the metadata of the `compression_header` of a compressed pack, or -1.
+  int64_t data_offset;
   int64_t null_mask_offset;  // offset into contiguous data buffer, or -1 if column data is null
   size_type num_children;
   // Explicitly pad to avoid uninitialized padding bits, allowing `serialized_column` to be bit-wise
@@ -60,6 +70,33 @@ struct serialized_column {
   int pad;
 };
 
+/**
+ * @brief Size of the blocks of the contiguous data buffer compressed independently by `pack`
+ */
+constexpr std::size_t pack_compression_block_size = 64 * 1024;
+
+/**
+ * @brief Describes the compressed data buffer of a `pack` with compression.
+ *
+ * The metadata of a compressed pack is the metadata of the uncompressed pack, followed by this
+ * header and by a `compressed_block` for each block of the uncompressed data buffer.
+ */
+struct compression_header {
+  pack_compression codec;
+  int32_t pad;  // explicit padding, see `serialized_column`
+  int64_t uncompressed_size;
+  int64_t block_size;
+  int64_t num_blocks;
+};
+
+/**
+ * @brief Location of a block of the uncompressed data buffer in the compressed data buffer
+ */
+struct compressed_block {
+  int64_t offset;
+  int64_t size;  // size of the compressed block, or -1 if the block is stored uncompressed
+};
+
 /**
  * @brief Deserialize a single column into a column_view
  *
@@ -148,6 +185,186 @@ packed_columns pack(cudf::table_view const& input,
   return std::move(contig_split_result[0].data);
 }
 
+/**
+ * @copydoc cudf::detail::pack(cudf::table_view const&, pack_compression,
+ * rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
+ */
+packed_columns pack(cudf::table_view const& input,
+                    pack_compression compression,
+                    rmm::cuda_stream_view stream,
+                    rmm::mr::device_memory_resource* mr)
+{
+  if (compression == pack_compression::NONE) { return pack(input, stream, mr); }
+
+  auto uncompressed             = pack(input, stream, rmm::mr::get_current_device_resource());
+  auto const uncompressed_size = uncompressed.gpu_data->size();
+  if (uncompressed_size == 0) {
+    return packed_columns{std::move(uncompressed.metadata_),
+                          std::make_unique<rmm::device_buffer>(0, stream, mr)};
+  }
+
+  // compress each block into its own slot, large enough for any expansion by the codec
+  auto const num_blocks =
+    (uncompressed_size + pack_compression_block_size - 1) / pack_compression_block_size;
+  auto const max_compressed_block_size =
+    pack_compression_block_size + (pack_compression_block_size >> 7) + 32;
+  rmm::device_buffer compressed_blocks(num_blocks * max_compressed_block_size, stream);
+  auto const src = static_cast<uint8_t const*>(uncompressed.gpu_data->data());
+  auto const dst = static_cast<uint8_t*>(compressed_blocks.data());
+  std::vector<io::gpu_inflate_input_s> h_inputs(num_blocks);
+  for (std::size_t i = 0; i < num_blocks; ++i) {
+    auto const offset = i * pack_compression_block_size;
+    auto const size   = std::min(pack_compression_block_size, uncompressed_size - offset);
+    h_inputs[i]       = io::gpu_inflate_input_s{
+      src + offset, size, dst + i * max_compressed_block_size, max_compressed_block_size};
+  }
+  auto const inputs = make_device_uvector_async(h_inputs, stream);
+  rmm::device_uvector<io::gpu_inflate_status_s> statuses(num_blocks, stream);
+  auto const count = static_cast<int>(num_blocks);
+  switch (compression) {
+    case pack_compression::SNAPPY:
+      CUDA_TRY(io::gpu_snap(inputs.data(), statuses.data(), count, stream));
+      break;
+    case pack_compression::DEFLATE:
+      CUDA_TRY(io::gpu_deflate(inputs.data(), statuses.data(), count, 0, stream));
+      break;
+    case pack_compression::ZSTD:
+      CUDA_TRY(io::gpu_zstd(inputs.data(), statuses.data(), count, stream));
+      break;
+    default: CUDF_FAIL("Unsupported pack compression");
+  }
+  auto const h_statuses = make_std_vector_sync(statuses, stream);
+
+  // blocks that do not shrink are stored uncompressed
+  std::vector<compressed_block> blocks(num_blocks);
+  std::vector<io::gpu_inflate_input_s> h_copies(num_blocks);
+  int64_t compressed_size = 0;
+  for (std::size_t i = 0; i < num_blocks; ++i) {
+    auto const is_compressed =
+      h_statuses[i].status == 0 and h_statuses[i].bytes_written < h_inputs[i].srcSize;
+    auto const size = is_compressed ? h_statuses[i].bytes_written : h_inputs[i].srcSize;
+    blocks[i]       = compressed_block{compressed_size, is_compressed ? int64_t(size) : -1};
+    h_copies[i]     = io::gpu_inflate_input_s{
+      is_compressed ? h_inputs[i].dstDevice : h_inputs[i].srcDevice, size, nullptr, size};
+    compressed_size += size;
+  }
+  auto gpu_data = std::make_unique<rmm::device_buffer>(compressed_size, stream, mr);
+  for (std::size_t i = 0; i < num_blocks; ++i) {
+    h_copies[i].dstDevice = static_cast<uint8_t*>(gpu_data->data()) + blocks[i].offset;
+  }
+  auto const copies = make_device_uvector_async(h_copies, stream);
+  CUDA_TRY(io::gpu_copy_uncompressed_blocks(copies.data(), count, stream));
+
+  // append the compression header and the blocks to the uncompressed metadata
+  compression_header const header{compression,
+                                  0,
+                                  static_cast<int64_t>(uncompressed_size),
+                                  static_cast<int64_t>(pack_compression_block_size),
+                                  static_cast<int64_t>(num_blocks)};
+  std::vector<uint8_t> metadata_bytes(uncompressed.metadata_->data(),
+                                      uncompressed.metadata_->data() +
+                                        uncompressed.metadata_->size());
+  auto const header_offset = static_cast<int64_t>(metadata_bytes.size());
+  std::memcpy(metadata_bytes.data() + offsetof(serialized_column, data_offset),
+              &header_offset,
+              sizeof(header_offset));
+  auto const header_begin = reinterpret_cast<uint8_t const*>(&header);
+  metadata_bytes.insert(metadata_bytes.end(), header_begin, header_begin + sizeof(header));
+  auto const blocks_begin = reinterpret_cast<uint8_t const*>(blocks.data());
+  metadata_bytes.insert(
+    metadata_bytes.end(), blocks_begin, blocks_begin + blocks.size() * sizeof(compressed_block));
+
+  // the temporary buffers must outlive the copy
+  stream.synchronize();
+  return packed_columns{std::make_unique<packed_columns::metadata>(std::move(metadata_bytes)),
+                        std::move(gpu_data)};
+}
+
+/**
+ * @copydoc cudf::detail::decompress_packed
+ */
+packed_columns decompress_packed(packed_columns const& input,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(input.metadata_ != nullptr, "Encountered invalid packed column input");
+  auto const metadata = input.metadata_->data();
+  serialized_column stub{data_type{type_id::EMPTY}, 0, 0, -1, -1, 0};
+  std::memcpy(&stub, metadata, sizeof(stub));
+  if (stub.data_offset == -1) {
+    return packed_columns{std::make_unique<packed_columns::metadata>(*input.metadata_),
+                          std::make_unique<rmm::device_buffer>(*input.gpu_data, stream, mr)};
+  }
+
+  compression_header header{};
+  std::memcpy(&header, metadata + stub.data_offset, sizeof(header));
+  std::vector<compressed_block> blocks(header.num_blocks);
+  std::memcpy(blocks.data(),
+              metadata + stub.data_offset + sizeof(header),
+              blocks.size() * sizeof(compressed_block));
+
+  // compressed blocks are decompressed by the codec, the others are copied
+  auto gpu_data = std::make_unique<rmm::device_buffer>(header.uncompressed_size, stream, mr);
+  auto const src = static_cast<uint8_t const*>(input.gpu_data->data());
+  auto const dst = static_cast<uint8_t*>(gpu_data->data());
+  std::vector<io::gpu_inflate_input_s> h_compressed;
+  std::vector<io::gpu_inflate_input_s> h_stored;
+  for (int64_t i = 0; i < header.num_blocks; ++i) {
+    auto const offset = i * header.block_size;
+    auto const size   = std::min(header.block_size, header.uncompressed_size - offset);
+    if (blocks[i].size >= 0) {
+      h_compressed.push_back(io::gpu_inflate_input_s{src + blocks[i].offset,
+                                                     static_cast<uint64_t>(blocks[i].size),
+                                                     dst + offset,
+                                                     static_cast<uint64_t>(size)});
+    } else {
+      h_stored.push_back(io::gpu_inflate_input_s{src + blocks[i].offset,
+                                                 static_cast<uint64_t>(size),
+                                                 dst + offset,
+                                                 static_cast<uint64_t>(size)});
+    }
+  }
+
+  auto const stored = make_device_uvector_async(h_stored, stream);
+  CUDA_TRY(io::gpu_copy_uncompressed_blocks(
+    stored.data(), static_cast<int>(stored.size()), stream));
+
+  if (not h_compressed.empty()) {
+    auto const compressed = make_device_uvector_async(h_compressed, stream);
+    rmm::device_uvector<io::gpu_inflate_status_s> statuses(compressed.size(), stream);
+    auto const count = static_cast<int>(compressed.size());
+    switch (header.codec) {
+      case pack_compression::SNAPPY:
+        CUDA_TRY(io::gpu_unsnap(compressed.data(), statuses.data(), count, stream));
+        break;
+      case pack_compression::DEFLATE:
+        CUDA_TRY(io::gpuinflate(compressed.data(), statuses.data(), count, 0, stream));
+        break;
+      case pack_compression::ZSTD:
+        CUDA_TRY(io::gpu_unzstd(compressed.data(), statuses.data(), count, stream));
+        break;
+      default: CUDF_FAIL("Unsupported pack compression");
+    }
+    auto const h_statuses = make_std_vector_sync(statuses, stream);
+    for (std::size_t i = 0; i < h_statuses.size(); ++i) {
+      CUDF_EXPECTS(h_statuses[i].status == 0 and
+                     h_statuses[i].bytes_written == h_compressed[i].dstSize,
+                   "Failed to decompress packed columns");
+    }
+  }
+
+  // the metadata of the uncompressed pack precedes the compression header
+  std::vector<uint8_t> metadata_bytes(metadata, metadata + stub.data_offset);
+  int64_t const no_header = -1;
+  std::memcpy(metadata_bytes.data() + offsetof(serialized_column, data_offset),
+              &no_header,
+              sizeof(no_header));
+
+  stream.synchronize();
+  return packed_columns{std::make_unique<packed_columns::metadata>(std::move(metadata_bytes)),
+                        std::move(gpu_data)};
+}
+
 template <typename ColumnIter>
 packed_columns::metadata pack_metadata(ColumnIter begin,
                                        ColumnIter end,
@@ -187,6 +404,8 @@ table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data)
   // gpu data can be null if everything is empty but the metadata must always be valid
   CUDF_EXPECTS(metadata != nullptr, "Encountered invalid packed column input");
   auto serialized_columns = reinterpret_cast<serialized_column const*>(metadata);
+  CUDF_EXPECTS(serialized_columns[0].data_offset == -1,
+               "Compressed packed columns must be decompressed before they are unpacked");
   uint8_t const* base_ptr = gpu_data;
   // first entry is a stub where size == the total # of top level columns (see pack_metadata above)
   auto const num_columns = serialized_columns[0].size;
@@ -221,6 +440,27 @@ packed_columns pack(cudf::table_view const& input, rmm::mr::device_memory_resour
   return detail::pack(input, rmm::cuda_stream_default, mr);
 }
 
+/**
+ * @copydoc cudf::pack(cudf::table_view const&, pack_compression,
+ * rmm::mr::device_memory_resource*)
+ */
+packed_columns pack(cudf::table_view const& input,
+                    pack_compression compression,
+                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::pack(input, compression, rmm::cuda_stream_default, mr);
+}
+
+/**
+ * @copydoc cudf::decompress_packed
+ */
+packed_columns decompress_packed(packed_columns const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::decompress_packed(input, rmm::cuda_stream_default, mr);
+}
+
 /**
  * @copydoc cudf::pack_metadata
  */
@@ -16,6 +16,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
@@ -24,13 +25,65 @@
 #include <cudf/table/table_view.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/count.h>
 #include <thrust/random.h>
 #include <thrust/random/uniform_int_distribution.h>
+#include <thrust/random/uniform_real_distribution.h>
 #include <thrust/shuffle.h>
 
+#include <algorithm>
+#include <cmath>
+
 namespace cudf {
 namespace detail {
+namespace {
+
+/**
+ * @brief Samples without replacement by shuffling the candidates of a Bernoulli sample when the
+ * sample is at most this fraction of the input, and by shuffling all the row indices otherwise.
+ */
+constexpr double max_sparse_sample_fraction = 0.125;
+
+/**
+ * @brief Selects row `i` with probability `probability`.
+ */
+struct bernoulli_selector {
+  int64_t seed;
+  double probability;
+
+  __device__ bool operator()(size_type i) const
+  {
+    thrust::default_random_engine rng(seed);
+    thrust::uniform_real_distribution<double> dist{0.0, 1.0};
+    rng.discard(i);
+    return dist(rng) < probability;
+  }
+};
+
+/**
+ * @brief Returns the indices of the rows selected independently with probability `probability`,
+ * in increasing order.
+ */
+rmm::device_uvector<size_type> bernoulli_gather_map(size_type num_rows,
+                                                    double probability,
+                                                    int64_t seed,
+                                                    rmm::cuda_stream_view stream)
+{
+  auto const selector = bernoulli_selector{seed, probability};
+  auto const begin    = thrust::make_counting_iterator<size_type>(0);
+
+  auto const count = thrust::count_if(rmm::exec_policy(stream), begin, begin + num_rows, selector);
+  rmm::device_uvector<size_type> gather_map(count, stream);
+  thrust::copy_if(
+    rmm::exec_policy(stream), begin, begin + num_rows, gather_map.begin(), selector);
+  return gather_map;
+}
+
+}  // namespace
 
 std::unique_ptr<table> sample(table_view const& input,
                               size_type const n,
@@ -59,6 +112,25 @@ std::unique_ptr<table> sample(table_view const& input,
     auto begin = cudf::detail::make_counting_transform_iterator(0, RandomGen);
 
     return detail::gather(input, begin, begin + n, out_of_bounds_policy::DONT_CHECK, stream, mr);
+  } else if (n <= max_sparse_sample_fraction * num_rows) {
+    // A uniform choice of `n` rows out of a Bernoulli sample of at least `n` rows is a uniform
+    // sample of `n` rows. The probability leaves enough margin that a retry is rare.
+    auto probability = (n + 4.0 * std::sqrt(n) + 16.0) / num_rows;
+    for (auto attempt_seed = seed;; ++attempt_seed, probability *= 2) {
+      auto candidates =
+        bernoulli_gather_map(num_rows, std::min(probability, 1.0), attempt_seed, stream);
+      if (static_cast<size_type>(candidates.size()) < n) { continue; }
+      thrust::shuffle(rmm::exec_policy(stream),
+                      candidates.begin(),
+                      candidates.end(),
+                      thrust::default_random_engine(seed));
+      return detail::gather(input,
+                            candidates.begin(),
+                            candidates.begin() + n,
+                            out_of_bounds_policy::DONT_CHECK,
+                            stream,
+                            mr);
+    }
   } else {
     auto gather_map =
       make_numeric_column(data_type{type_id::INT32}, num_rows, mask_state::UNALLOCATED, stream);
@@ -81,6 +153,22 @@ std::unique_ptr<table> sample(table_view const& input,
   }
 }
 
+std::unique_ptr<table> bernoulli_sample(table_view const& input,
+                                        double fraction,
+                                        int64_t const seed,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(fraction >= 0.0 and fraction <= 1.0, "fraction should be in the range [0, 1]");
+  auto const gather_map = bernoulli_gather_map(input.num_rows(), fraction, seed, stream);
+  return detail::gather(input,
+                        gather_map.begin(),
+                        gather_map.end(),
+                        out_of_bounds_policy::DONT_CHECK,
+                        stream,
+                        mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> sample(table_view const& input,
@@ -93,4 +181,14 @@ std::unique_ptr<table> sample(table_view const& input,
 
   return detail::sample(input, n, replacement, seed, rmm::cuda_stream_default, mr);
 }
+
+std::unique_ptr<table> bernoulli_sample(table_view const& input,
+                                        double fraction,
+                                        int64_t const seed,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  return detail::bernoulli_sample(input, fraction, seed, rmm::cuda_stream_default, mr);
+}
 }  // namespace cudf
@@ -19,30 +19,28 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/datetime.hpp>
+#include <cudf/detail/datetime.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 #include <cudf/utilities/traits.hpp>
 
+#include <io/orc/timezone.cuh>
+
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
 namespace cudf {
 namespace datetime {
 namespace detail {
-enum class datetime_component {
-  INVALID = 0,
-  YEAR,
-  MONTH,
-  DAY,
-  WEEKDAY,
-  HOUR,
-  MINUTE,
-  SECOND,
-};
-
 template <datetime_component Component>
 struct extract_component_operator {
   template <typename Timestamp>
@@ -77,6 +75,59 @@ struct extract_component_operator {
   }
 };
 
+// Extract all the requested components of each row, computing the date once per row
+struct extract_datetime_components_functor {
+  column_view input;
+  device_span<datetime_component const> components;
+  device_span<int16_t* const> outputs;
+
+  template <typename Element>
+  typename std::enable_if_t<!cudf::is_timestamp_t<Element>::value, void> operator()(
+    rmm::cuda_stream_view stream) const
+  {
+    CUDF_FAIL("Cannot extract datetime component from non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  typename std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, void> operator()(
+    rmm::cuda_stream_view stream) const
+  {
+    auto const timestamps = input.begin<Timestamp>();
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      input.size(),
+      [timestamps, components = components, outputs = outputs] __device__(size_type row) {
+        using namespace cuda::std::chrono;
+
+        auto const ts                  = timestamps[row];
+        auto const days_since_epoch    = floor<days>(ts);
+        auto const date                = year_month_day(days_since_epoch);
+        auto const time_since_midnight = ts - days_since_epoch;
+
+        auto const hrs_  = duration_cast<hours>(time_since_midnight);
+        auto const mins_ = duration_cast<minutes>(time_since_midnight - hrs_);
+        auto const secs_ = duration_cast<seconds>(time_since_midnight - hrs_ - mins_);
+
+        for (std::size_t i = 0; i < components.size(); ++i) {
+          int16_t value = 0;
+          switch (components[i]) {
+            case datetime_component::YEAR: value = static_cast<int>(date.year()); break;
+            case datetime_component::MONTH: value = static_cast<unsigned>(date.month()); break;
+            case datetime_component::DAY: value = static_cast<unsigned>(date.day()); break;
+            case datetime_component::WEEKDAY:
+              value = year_month_weekday(days_since_epoch).weekday().iso_encoding();
+              break;
+            case datetime_component::HOUR: value = hrs_.count(); break;
+            case datetime_component::MINUTE: value = mins_.count(); break;
+            case datetime_component::SECOND: value = secs_.count(); break;
+          }
+          outputs[i][row] = value;
+        }
+      });
+  }
+};
+
 // Number of days until month indexed by leap year and month (0-based index)
 static __device__ int16_t const days_until_month[2][13] = {
   {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365},  // For non leap years
@@ -266,10 +317,10 @@ std::unique_ptr<column> add_calendrical_months(column_view const& timestamp_colu
   // Return an empty column if source column is empty
   if (size == 0) return make_empty_column(output_col_type);
 
-  auto output_col_mask =
+  auto [output_col_mask, null_count] =
     cudf::detail::bitmask_and(table_view({timestamp_column, months_column}), stream, mr);
   auto output = make_fixed_width_column(
-    output_col_type, size, std::move(output_col_mask), cudf::UNKNOWN_NULL_COUNT, stream, mr);
+    output_col_type, size, std::move(output_col_mask), null_count, stream, mr);
 
   auto launch = add_calendrical_months_functor{
     timestamp_column, months_column, static_cast<mutable_column_view>(*output)};
@@ -279,12 +330,162 @@ std::unique_ptr<column> add_calendrical_months(column_view const& timestamp_colu
   return output;
 }
 
+struct convert_utc_to_timezone_functor {
+  column_view timestamp_column;
+  cudf::io::timezone_table_view tz_table;
+  mutable_column_view output;
+
+  template <typename Element>
+  typename std::enable_if_t<!cudf::is_timestamp_t<Element>::value, void> operator()(
+    rmm::cuda_stream_view stream) const
+  {
+    CUDF_FAIL("Cannot convert timezone of non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  typename std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, void> operator()(
+    rmm::cuda_stream_view stream) const
+  {
+    thrust::transform(rmm::exec_policy(stream),
+                      timestamp_column.begin<Timestamp>(),
+                      timestamp_column.end<Timestamp>(),
+                      output.begin<Timestamp>(),
+                      [tz_table = tz_table] __device__(Timestamp time_val) -> Timestamp {
+                        using namespace cuda::std::chrono;
+                        if (tz_table.ttimes.empty()) { return time_val; }
+                        auto const utc_seconds = floor<seconds>(time_val).time_since_epoch();
+                        auto const offset      = cudf::io::get_gmt_offset(
+                          tz_table.ttimes, tz_table.offsets, utc_seconds.count());
+                        return floor<typename Timestamp::duration>(time_val + duration_s{offset});
+                      });
+  }
+};
+
+std::unique_ptr<column> convert_utc_to_timezone(column_view const& timestamp_column,
+                                                std::string const& timezone_name,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(timestamp_column.type()), "Column type should be timestamp");
+  auto size            = timestamp_column.size();
+  auto output_col_type = timestamp_column.type();
+
+  // Return an empty column if source column is empty
+  if (size == 0) return make_empty_column(output_col_type);
+
+  auto const tz_table = cudf::io::get_timezone_table(timezone_name, stream);
+  auto output         = make_fixed_width_column(output_col_type,
+                                        size,
+                                        cudf::detail::copy_bitmask(timestamp_column, stream, mr),
+                                        timestamp_column.null_count(),
+                                        stream,
+                                        mr);
+
+  auto launch = convert_utc_to_timezone_functor{
+    timestamp_column, tz_table, static_cast<mutable_column_view>(*output)};
+
+  type_dispatcher(timestamp_column.type(), launch, stream);
+
+  return output;
+}
+
+/**
+ * @brief Returns the GMT offset of the timezone at the given local time, in seconds.
+ *
+ * The candidate offsets are the ones in effect at the earliest and at the latest UTC time that
+ * the local time can correspond to. A local time that occurs twice gets the earlier offset, and
+ * a local time that is skipped gets the offset from before the transition, which shifts it
+ * forward by the length of the gap.
+ */
+__device__ int32_t get_local_gmt_offset(cudf::io::timezone_table_view tz_table,
+                                        int64_t local_seconds)
+{
+  // GMT offsets range from UTC-12:00 to UTC+14:00
+  constexpr int64_t max_offset_seconds = 14 * 60 * 60;
+  constexpr int64_t min_offset_seconds = -12 * 60 * 60;
+  if (tz_table.ttimes.empty()) { return 0; }
+  auto const offset_at = [&](int64_t utc_seconds) {
+    return cudf::io::get_gmt_offset(tz_table.ttimes, tz_table.offsets, utc_seconds);
+  };
+  auto const earlier_offset = offset_at(local_seconds - max_offset_seconds);
+  if (offset_at(local_seconds - earlier_offset) == earlier_offset) { return earlier_offset; }
+  auto const later_offset = offset_at(local_seconds - min_offset_seconds);
+  return offset_at(local_seconds - later_offset) == later_offset ? later_offset : earlier_offset;
+}
+
+struct convert_timezone_functor {
+  column_view timestamp_column;
+  cudf::io::timezone_table_view from_table;
+  cudf::io::timezone_table_view to_table;
+  mutable_column_view output;
+
+  template <typename Element>
+  typename std::enable_if_t<!cudf::is_timestamp_t<Element>::value, void> operator()(
+    rmm::cuda_stream_view stream) const
+  {
+    CUDF_FAIL("Cannot convert timezone of non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  typename std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, void> operator()(
+    rmm::cuda_stream_view stream) const
+  {
+    thrust::transform(
+      rmm::exec_policy(stream),
+      timestamp_column.begin<Timestamp>(),
+      timestamp_column.end<Timestamp>(),
+      output.begin<Timestamp>(),
+      [from_table = from_table, to_table = to_table] __device__(Timestamp time_val) -> Timestamp {
+        using namespace cuda::std::chrono;
+        auto const local_seconds = floor<seconds>(time_val).time_since_epoch().count();
+        auto const from_offset   = get_local_gmt_offset(from_table, local_seconds);
+        auto const to_offset =
+          to_table.ttimes.empty()
+            ? 0
+            : cudf::io::get_gmt_offset(
+                to_table.ttimes, to_table.offsets, local_seconds - from_offset);
+        return floor<typename Timestamp::duration>(time_val +
+                                                   duration_s{to_offset - from_offset});
+      });
+  }
+};
+
+std::unique_ptr<column> convert_timezone(column_view const& timestamp_column,
+                                         std::string const& from_timezone,
+                                         std::string const& to_timezone,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(timestamp_column.type()), "Column type should be timestamp");
+  auto size            = timestamp_column.size();
+  auto output_col_type = timestamp_column.type();
+
+  // Return an empty column if source column is empty
+  if (size == 0) return make_empty_column(output_col_type);
+
+  auto const from_table = cudf::io::get_timezone_table(from_timezone, stream);
+  auto const to_table   = cudf::io::get_timezone_table(to_timezone, stream);
+  auto output           = make_fixed_width_column(output_col_type,
+                                        size,
+                                        cudf::detail::copy_bitmask(timestamp_column, stream, mr),
+                                        timestamp_column.null_count(),
+                                        stream,
+                                        mr);
+
+  auto launch = convert_timezone_functor{
+    timestamp_column, from_table, to_table, static_cast<mutable_column_view>(*output)};
+
+  type_dispatcher(timestamp_column.type(), launch, stream);
+
+  return output;
+}
+
 std::unique_ptr<column> extract_year(column_view const& column,
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::YEAR>,
+    detail::extract_component_operator<datetime_component::YEAR>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -293,7 +494,7 @@ std::unique_ptr<column> extract_month(column_view const& column,
                                       rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MONTH>,
+    detail::extract_component_operator<datetime_component::MONTH>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -302,7 +503,7 @@ std::unique_ptr<column> extract_day(column_view const& column,
                                     rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::DAY>,
+    detail::extract_component_operator<datetime_component::DAY>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -311,7 +512,7 @@ std::unique_ptr<column> extract_weekday(column_view const& column,
                                         rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::WEEKDAY>,
+    detail::extract_component_operator<datetime_component::WEEKDAY>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -320,7 +521,7 @@ std::unique_ptr<column> extract_hour(column_view const& column,
                                      rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::HOUR>,
+    detail::extract_component_operator<datetime_component::HOUR>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -329,7 +530,7 @@ std::unique_ptr<column> extract_minute(column_view const& column,
                                        rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MINUTE>,
+    detail::extract_component_operator<datetime_component::MINUTE>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -338,10 +539,47 @@ std::unique_ptr<column> extract_second(column_view const& column,
                                        rmm::mr::device_memory_resource* mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::SECOND>,
+    detail::extract_component_operator<datetime_component::SECOND>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
+std::unique_ptr<table> extract_datetime_components(
+  column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
+  auto const output_col_type = data_type{type_id::INT16};
+
+  std::vector<std::unique_ptr<cudf::column>> output_columns;
+  std::vector<int16_t*> output_data;
+  for (std::size_t i = 0; i < components.size(); ++i) {
+    if (column.size() == 0) {
+      output_columns.push_back(make_empty_column(output_col_type));
+      continue;
+    }
+    output_columns.push_back(
+      make_fixed_width_column(output_col_type,
+                              column.size(),
+                              cudf::detail::copy_bitmask(column, stream, mr),
+                              column.null_count(),
+                              stream,
+                              mr));
+    output_data.push_back(output_columns.back()->mutable_view().data<int16_t>());
+  }
+  if (output_data.empty()) { return std::make_unique<table>(std::move(output_columns)); }
+
+  auto const d_components  = cudf::detail::make_device_uvector_async(components, stream);
+  auto const d_output_data = cudf::detail::make_device_uvector_async(output_data, stream);
+
+  auto launch = extract_datetime_components_functor{column, d_components, d_output_data};
+
+  type_dispatcher(column.type(), launch, stream);
+
+  return std::make_unique<table>(std::move(output_columns));
+}
+
 std::unique_ptr<column> last_day_of_month(column_view const& column,
                                           rmm::cuda_stream_view stream,
                                           rmm::mr::device_memory_resource* mr)
@@ -405,6 +643,15 @@ std::unique_ptr<column> extract_second(column_view const& column,
   return detail::extract_second(column, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<table> extract_datetime_components(
+  column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extract_datetime_components(column, components, rmm::cuda_stream_default, mr);
+}
+
 std::unique_ptr<column> last_day_of_month(column_view const& column,
                                           rmm::mr::device_memory_resource* mr)
 {
@@ -426,5 +673,24 @@ std::unique_ptr<cudf::column> add_calendrical_months(cudf::column_view const& ti
   return detail::add_calendrical_months(
     timestamp_column, months_column, rmm::cuda_stream_default, mr);
 }
+
+std::unique_ptr<cudf::column> convert_utc_to_timezone(cudf::column_view const& timestamp_column,
+                                                      std::string const& timezone_name,
+                                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_utc_to_timezone(
+    timestamp_column, timezone_name, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<cudf::column> convert_timezone(cudf::column_view const& timestamp_column,
+                                               std::string const& from_timezone,
+                                               std::string const& to_timezone,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_timezone(
+    timestamp_column, from_timezone, to_timezone, rmm::cuda_stream_default, mr);
+}
 }  // namespace datetime
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -70,11 +70,13 @@ std::unique_ptr<column> add_keys(
   std::unique_ptr<column> keys_column(std::move(table_keys.front()));
   // create a map for the indices
   // lower_bound([a,b,c,d,e,f],[a,b,c,d,f]) = [0,1,2,3,5]
+  // the old keys are sorted, so they are searched in a single pass over the new ones
   auto map_indices = cudf::detail::lower_bound(
     table_view{{keys_column->view()}},
     table_view{{old_keys}},
     std::vector<order>{order::ASCENDING},
     std::vector<null_order>{null_order::AFTER},  // should be no nulls here
+    sorted::YES,
     stream,
     mr);
   // now create the indices column -- map old values to the new ones
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,38 +14,125 @@
  * limitations under the License.
  */
 
+#include <hash/concurrent_unordered_map.cuh>
+#include <hash/helper_functions.cuh>
+
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/dictionary/encode.hpp>
 #include <cudf/stream_compaction.hpp>
+#include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/transform.h>
+
+#include <limits>
 
 namespace cudf {
 namespace dictionary {
 namespace detail {
+namespace {
 /**
- * @copydoc cudf::dictionary::encode
+ * @brief Inserts each valid row into the set of keys, and stores the row of the set that it
+ * duplicates, itself if it was inserted, or -1 if it is null.
+ */
+template <typename Map>
+struct insert_key_fn {
+  Map map;
+  column_device_view input;
+  size_type* representatives;
+
+  __device__ void operator()(size_type row)
+  {
+    representatives[row] =
+      input.is_null(row) ? -1 : map.insert(thrust::make_pair(row, row)).first->second;
+  }
+};
+
+/**
+ * @brief Returns the index of the key of a row from its representative row, or the number of
+ * keys for a null row.
+ */
+template <typename IndexType>
+struct key_index_fn {
+  size_type const* key_indices;
+  size_type num_keys;
+
+  __device__ IndexType operator()(size_type representative) const
+  {
+    return static_cast<IndexType>(representative < 0 ? num_keys : key_indices[representative]);
+  }
+};
+
+/**
+ * @brief Creates the indices column of a dictionary from the representative row of each row.
+ */
+struct make_indices_fn {
+  template <typename IndexType, CUDF_ENABLE_IF(std::is_unsigned<IndexType>::value)>
+  std::unique_ptr<column> operator()(device_span<size_type const> representatives,
+                                     size_type const* key_indices,
+                                     size_type num_keys,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr) const
+  {
+    auto indices = make_numeric_column(data_type{type_to_id<IndexType>()},
+                                       static_cast<size_type>(representatives.size()),
+                                       mask_state::UNALLOCATED,
+                                       stream,
+                                       mr);
+    thrust::transform(rmm::exec_policy(stream),
+                      representatives.begin(),
+                      representatives.end(),
+                      indices->mutable_view().begin<IndexType>(),
+                      key_index_fn<IndexType>{key_indices, num_keys});
+    return indices;
+  }
+
+  template <typename IndexType, CUDF_ENABLE_IF(not std::is_unsigned<IndexType>::value)>
+  std::unique_ptr<column> operator()(device_span<size_type const>,
+                                     size_type const*,
+                                     size_type,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*) const
+  {
+    CUDF_FAIL("indices must be type unsigned integer");
+  }
+};
+
+/**
+ * @brief Encodes a column by sorting it and searching for each row in its distinct values.
  *
- * @param stream CUDA stream used for device memory operations and kernel launches.
+ * Used for the struct columns that the row hasher does not support.
  */
-std::unique_ptr<column> encode(column_view const& input_column,
-                               data_type indices_type,
-                               rmm::cuda_stream_view stream,
-                               rmm::mr::device_memory_resource* mr)
+std::unique_ptr<column> sort_encode(column_view const& input_column,
+                                    data_type indices_type,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
 {
-  CUDF_EXPECTS(is_unsigned(indices_type), "indices must be type unsigned integer");
-  CUDF_EXPECTS(input_column.type().id() != type_id::DICTIONARY32,
-               "cannot encode a dictionary from a dictionary");
-
   auto codified       = cudf::detail::encode(cudf::table_view({input_column}), stream, mr);
   auto keys_table     = std::move(codified.first);
   auto indices_column = std::move(codified.second);
@@ -69,6 +156,116 @@ std::unique_ptr<column> encode(column_view const& input_column,
                                 cudf::detail::copy_bitmask(input_column, stream, mr),
                                 input_column.null_count());
 }
+}  // namespace
+
+/**
+ * @copydoc cudf::dictionary::encode
+ *
+ * The distinct values are found by inserting the rows into a hash set, so that only the keys
+ * and not the whole column are sorted.
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> encode(column_view const& input_column,
+                               data_type indices_type,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_unsigned(indices_type), "indices must be type unsigned integer");
+  CUDF_EXPECTS(input_column.type().id() != type_id::DICTIONARY32,
+               "cannot encode a dictionary from a dictionary");
+
+  if (input_column.type().id() == type_id::STRUCT) {
+    return sort_encode(input_column, indices_type, stream, mr);
+  }
+
+  auto const num_rows = input_column.size();
+  if (num_rows == 0) {
+    return make_dictionary_column(
+      empty_like(input_column),
+      make_numeric_column(indices_type, 0, mask_state::UNALLOCATED, stream, mr),
+      rmm::device_buffer{0, stream, mr},
+      0);
+  }
+
+  // Null rows are never inserted, so the rows in the set have no nulls
+  size_type constexpr unused_key{std::numeric_limits<size_type>::max()};
+  using map_type = concurrent_unordered_map<size_type,
+                                            size_type,
+                                            row_hasher<default_hash, false>,
+                                            row_equality_comparator<false>>;
+
+  auto const input_table = table_view({input_column});
+  auto const d_table     = table_device_view::create(input_table, stream);
+  auto const d_column    = column_device_view::create(input_column, stream);
+
+  auto const map = map_type::create(compute_hash_table_size(num_rows),
+                                    stream,
+                                    unused_key,
+                                    unused_key,
+                                    row_hasher<default_hash, false>{*d_table},
+                                    row_equality_comparator<false>{*d_table, *d_table},
+                                    typename map_type::allocator_type());
+
+  rmm::device_uvector<size_type> representatives(num_rows, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator(0),
+                     num_rows,
+                     insert_key_fn<map_type>{*map, *d_column, representatives.data()});
+
+  // The first row of each key
+  rmm::device_uvector<size_type> key_rows(num_rows, stream);
+  auto const d_representatives = representatives.data();
+  auto const key_rows_end      = thrust::copy_if(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator(0),
+    thrust::make_counting_iterator(num_rows),
+    key_rows.begin(),
+    [d_representatives] __device__(size_type row) { return d_representatives[row] == row; });
+  key_rows.resize(thrust::distance(key_rows.begin(), key_rows_end), stream);
+  auto const num_keys = static_cast<size_type>(key_rows.size());
+
+  // Only the keys are sorted
+  auto const unsorted_keys =
+    cudf::detail::gather(input_table,
+                         column_view(data_type{type_id::INT32}, num_keys, key_rows.data()),
+                         out_of_bounds_policy::DONT_CHECK,
+                         cudf::detail::negative_index_policy::NOT_ALLOWED,
+                         stream);
+  auto const key_order = cudf::detail::sorted_order(unsorted_keys->view(), {}, {}, stream);
+  auto sorted_keys     = cudf::detail::gather(unsorted_keys->view(),
+                                          key_order->view(),
+                                          out_of_bounds_policy::DONT_CHECK,
+                                          cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                          stream,
+                                          mr);
+  auto keys_column     = std::move(sorted_keys->release().front());
+  if (keys_column->nullable()) {
+    keys_column->set_null_mask(rmm::device_buffer{0, stream, mr}, 0);  // remove the null-mask
+  }
+
+  // The index of each key in the sorted keys, stored at the first row of the key
+  rmm::device_uvector<size_type> key_indices(num_rows, stream);
+  thrust::scatter(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator(0),
+    thrust::make_counting_iterator(num_keys),
+    thrust::make_permutation_iterator(key_rows.begin(), key_order->view().begin<size_type>()),
+    key_indices.begin());
+
+  auto indices_column = type_dispatcher(indices_type,
+                                        make_indices_fn{},
+                                        device_span<size_type const>(representatives),
+                                        key_indices.data(),
+                                        num_keys,
+                                        stream,
+                                        mr);
+
+  return make_dictionary_column(std::move(keys_column),
+                                std::move(indices_column),
+                                cudf::detail::copy_bitmask(input_column, stream, mr),
+                                input_column.null_count());
+}
 
 /**
  * @copydoc cudf::dictionary::detail::get_indices_type_for_size
@@ -26,11 +26,15 @@
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/stream_compaction.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/logical.h>
+
 #include <algorithm>
 #include <iterator>
 
@@ -97,6 +101,29 @@ struct dispatch_compute_indices {
   }
 };
 
+/**
+ * @brief Returns true if all the dictionaries have the same keys.
+ *
+ * The keys of a dictionary are sorted and unique so two key sets are the same
+ * only if they are equal element by element.
+ */
+bool have_same_keys(std::vector<dictionary_column_view> const& input,
+                    rmm::cuda_stream_view stream)
+{
+  auto const first = input.front().keys();
+  return std::all_of(input.begin() + 1, input.end(), [first, stream](auto const& col) {
+    auto const keys = col.keys();
+    if (keys.type() != first.type() || keys.size() != first.size()) { return false; }
+    auto const d_lhs = table_device_view::create(table_view{{first}}, stream);
+    auto const d_rhs = table_device_view::create(table_view{{keys}}, stream);
+    auto const equal = row_equality_comparator<false>{*d_lhs, *d_rhs};
+    return thrust::all_of(rmm::exec_policy(stream),
+                          thrust::make_counting_iterator<size_type>(0),
+                          thrust::make_counting_iterator<size_type>(keys.size()),
+                          [equal] __device__(size_type idx) { return equal(idx, idx); });
+  });
+}
+
 }  // namespace
 
 //
@@ -190,6 +217,8 @@ std::pair<std::vector<std::unique_ptr<column>>, std::vector<table_view>> match_d
         tables.begin(), tables.end(), std::back_inserter(dict_views), [col_idx](auto& t) {
           return dictionary_column_view(t.column(col_idx));
         });
+      // dictionaries already sharing their keys need no matching
+      if (have_same_keys(dict_views, stream)) { continue; }
       // now match the keys in these dictionary columns
       auto dict_cols = dictionary::detail::match_dictionaries(dict_views, stream, mr);
       // replace the updated_columns vector entries for the set of columns at col_idx
@@ -24,6 +24,8 @@
 #include <cudf/detail/groupby.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/table/table.hpp>
@@ -35,8 +37,10 @@
 
 #include <thrust/copy.h>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace cudf {
 namespace groupby {
@@ -54,6 +58,21 @@ groupby::groupby(table_view const& keys,
 {
 }
 
+groupby::groupby(table_view const& keys, host_span<size_type const> group_offsets)
+  : _keys{keys}, _include_null_keys{null_policy::INCLUDE}, _keys_are_sorted{sorted::YES}
+{
+  CUDF_EXPECTS(not group_offsets.empty() and group_offsets.front() == 0 and
+                 group_offsets.back() == keys.num_rows(),
+               "Group offsets must start at 0 and end at the number of rows of the keys.");
+  _helper = std::make_shared<detail::sort::sort_groupby_helper>(
+    keys, cudf::detail::make_device_uvector_sync(group_offsets));
+}
+
+groupby::groupby(std::shared_ptr<detail::sort::sort_groupby_helper> grouping)
+  : _keys{grouping->keys()}, _helper{std::move(grouping)}
+{
+}
+
 // Select hash vs. sort groupby implementation
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::dispatch_aggregation(
   host_span<aggregation_request const> requests,
@@ -69,9 +88,80 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::disp
   if (_keys_are_sorted == sorted::NO and not _helper and
       detail::hash::can_use_hash_groupby(_keys, requests)) {
     return detail::hash::groupby(_keys, requests, _include_null_keys, stream, mr);
+  }
+  // When only some aggregations need the sort-based groupby, the others are still computed by the
+  // hash-based groupby
+  auto const has_hash_aggregation = [](auto const& request) {
+    return std::any_of(
+      request.aggregations.begin(), request.aggregations.end(), [](auto const& agg) {
+        return detail::hash::can_use_hash_aggregation(agg->kind);
+      });
+  };
+  if (_keys_are_sorted == sorted::NO and not _helper and
+      std::any_of(requests.begin(), requests.end(), has_hash_aggregation)) {
+    return hash_and_sort_aggregate(requests, stream, mr);
+  }
+  return sort_aggregate(requests, stream, mr);
+}
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>
+groupby::hash_and_sort_aggregate(host_span<aggregation_request const> requests,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  std::vector<aggregation_request> hash_requests(requests.size());
+  std::vector<aggregation_request> sort_requests(requests.size());
+  for (size_t i = 0; i < requests.size(); i++) {
+    hash_requests[i].values = requests[i].values;
+    sort_requests[i].values = requests[i].values;
+    for (auto const& agg : requests[i].aggregations) {
+      auto& split_requests =
+        detail::hash::can_use_hash_aggregation(agg->kind) ? hash_requests : sort_requests;
+      split_requests[i].aggregations.push_back(agg->clone());
+    }
+  }
+
+  auto sort_result = sort_aggregate(sort_requests, stream, mr);
+  auto hash_result = detail::hash::groupby(_keys, hash_requests, _include_null_keys, stream, mr);
+
+  // The sort-based groupby returns its unique keys in ascending order with nulls last, so sorting
+  // the unique keys of the hash-based groupby the same way aligns the groups of both results. If
+  // the two disagree on the groups, e.g. for floating-point keys, the sort-based groupby computes
+  // everything.
+  if (hash_result.first->num_rows() != sort_result.first->num_rows()) {
+    hash_result = sort_aggregate(hash_requests, stream, mr);
   } else {
-    return sort_aggregate(requests, stream, mr);
+    auto const hash_keys = hash_result.first->view();
+    auto const order     = cudf::detail::sorted_order(
+      hash_keys,
+      {},
+      std::vector<null_order>(hash_keys.num_columns(), null_order::AFTER),
+      stream,
+      rmm::mr::get_current_device_resource());
+    for (auto& result : hash_result.second) {
+      for (auto& col : result.results) {
+        col = std::move(cudf::detail::gather(table_view({col->view()}),
+                                             order->view(),
+                                             cudf::out_of_bounds_policy::DONT_CHECK,
+                                             cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                             stream,
+                                             mr)
+                          ->release()[0]);
+      }
+    }
   }
+
+  // Restore the order of the aggregations of each request
+  std::vector<aggregation_result> results(requests.size());
+  for (size_t i = 0; i < requests.size(); i++) {
+    auto hash_it = hash_result.second[i].results.begin();
+    auto sort_it = sort_result.second[i].results.begin();
+    for (auto const& agg : requests[i].aggregations) {
+      auto& it = detail::hash::can_use_hash_aggregation(agg->kind) ? hash_it : sort_it;
+      results[i].results.push_back(std::move(*it++));
+    }
+  }
+  return std::make_pair(std::move(sort_result.first), std::move(results));
 }
 
 // Destructor
@@ -159,6 +249,30 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::scan
   return sort_scan(requests, rmm::cuda_stream_default, mr);
 }
 
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::scan(
+  host_span<aggregation_request const> requests,
+  scan_order order,
+  rmm::mr::device_memory_resource* mr)
+{
+  // sorted keys are already grouped in input order
+  if (order == scan_order::GROUPED or _keys_are_sorted == sorted::YES) {
+    return scan(requests, mr);
+  }
+
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(
+    std::all_of(requests.begin(),
+                requests.end(),
+                [this](auto const& request) { return request.values.size() == _keys.num_rows(); }),
+    "Size mismatch between request values and groupby keys.");
+
+  verify_valid_requests(requests);
+
+  if (_keys.num_rows() == 0) { return std::make_pair(empty_like(_keys), empty_results(requests)); }
+
+  return detail::hash::scan(_keys, requests, _include_null_keys, rmm::cuda_stream_default, mr);
+}
+
 groupby::groups groupby::get_groups(table_view values, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
@@ -188,11 +302,17 @@ groupby::groups groupby::get_groups(table_view values, rmm::mr::device_memory_re
 detail::sort::sort_groupby_helper& groupby::helper()
 {
   if (_helper) return *_helper;
-  _helper = std::make_unique<detail::sort::sort_groupby_helper>(
+  _helper = std::make_shared<detail::sort::sort_groupby_helper>(
     _keys, _include_null_keys, _keys_are_sorted);
   return *_helper;
 };
 
+std::shared_ptr<detail::sort::sort_groupby_helper> groupby::grouping()
+{
+  helper();
+  return _helper;
+}
+
 std::pair<std::unique_ptr<table>, std::unique_ptr<column>> groupby::shift(
   column_view const& values,
   size_type offset,
@@ -16,6 +16,7 @@
 
 #include <groupby/common/utils.hpp>
 #include <groupby/hash/groupby_kernels.cuh>
+#include <groupby/sort/group_scan.hpp>
 
 #include <cudf/aggregation.hpp>
 #include <cudf/column/column.hpp>
@@ -29,12 +30,16 @@
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby.hpp>
+#include <cudf/detail/reduction_functions.hpp>
 #include <cudf/detail/replace.hpp>
 #include <cudf/detail/unary.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
@@ -45,8 +50,23 @@
 #include <hash/concurrent_unordered_map.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
-
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/gather.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <functional>
 #include <memory>
+#include <numeric>
+#include <tuple>
 #include <unordered_set>
 #include <utility>
 
@@ -73,6 +93,15 @@ constexpr std::array<aggregation::Kind, 12> hash_aggregations{aggregation::SUM,
                                                               aggregation::STD,
                                                               aggregation::VARIANCE};
 
+// Low-cardinality groupbys accumulate partial results in shared memory, up to the dynamic shared
+// memory available without opting in to more
+constexpr size_type GROUPBY_SHARED_MEMORY_MAX_GROUPS{4096};
+constexpr std::size_t GROUPBY_SHARED_MEMORY_MAX_BYTES{48 * 1024};
+
+// Dictionary or small-range integer keys with at most this many combinations of key values, or
+// at most one per row, are grouped into one sparse result row per combination without hashing
+constexpr int64_t GROUPBY_DIRECT_MAX_GROUPS{1 << 16};
+
 // Could be hash: SUM, PRODUCT, MIN, MAX, COUNT_VALID, COUNT_ALL, ANY, ALL,
 // Compound: MEAN(SUM, COUNT_VALID), VARIANCE, STD(MEAN (SUM, COUNT_VALID), COUNT_VALID),
 // ARGMAX, ARGMIN
@@ -239,8 +268,10 @@ class hash_compound_agg_finalizer final : public cudf::detail::aggregation_final
     auto sum_view    = column_device_view::create(sum_result);
     auto count_view  = column_device_view::create(count_result);
 
-    auto var_result = make_fixed_width_column(
-      cudf::detail::target_type(result_type, agg.kind), col.size(), mask_state::ALL_NULL, stream);
+    auto var_result = make_fixed_width_column(cudf::detail::target_type(result_type, agg.kind),
+                                              count_result.size(),
+                                              mask_state::ALL_NULL,
+                                              stream);
     auto var_result_view = mutable_column_device_view::create(var_result->mutable_view());
     mutable_table_view var_table_view{{var_result->mutable_view()}};
     cudf::detail::initialize_with_identity(var_table_view, {agg.kind}, stream);
@@ -319,7 +350,7 @@ void sparse_to_dense_results(table_view const& keys,
                              rmm::cuda_stream_view stream,
                              rmm::mr::device_memory_resource* mr)
 {
-  auto row_bitmask{bitmask_and(keys, stream, rmm::mr::get_current_device_resource())};
+  auto row_bitmask{bitmask_and(keys, stream, rmm::mr::get_current_device_resource()).first};
   bool skip_key_rows_with_nulls = keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
   bitmask_type const* row_bitmask_ptr =
     skip_key_rows_with_nulls ? static_cast<bitmask_type*>(row_bitmask.data()) : nullptr;
@@ -377,9 +408,10 @@ auto create_hash_map(table_device_view const& d_keys,
                           allocator_type());
 }
 
-// make table that will hold sparse results
+// make table that will hold `num_rows` sparse results
 auto create_sparse_results_table(table_view const& flattened_values,
                                  std::vector<aggregation::Kind> aggs,
+                                 size_type num_rows,
                                  rmm::cuda_stream_view stream)
 {
   // TODO single allocation - room for performance improvement
@@ -389,7 +421,7 @@ auto create_sparse_results_table(table_view const& flattened_values,
     flattened_values.end(),
     aggs.begin(),
     std::back_inserter(sparse_columns),
-    [stream](auto const& col, auto const& agg) {
+    [num_rows, stream](auto const& col, auto const& agg) {
       bool nullable =
         (agg == aggregation::COUNT_VALID or agg == aggregation::COUNT_ALL)
           ? false
@@ -401,7 +433,7 @@ auto create_sparse_results_table(table_view const& flattened_values,
                         : col.type();
 
       return make_fixed_width_column(
-        cudf::detail::target_type(col_type, agg), col.size(), mask_flag, stream);
+        cudf::detail::target_type(col_type, agg), num_rows, mask_flag, stream);
     });
 
   table sparse_table(std::move(sparse_columns));
@@ -410,6 +442,167 @@ auto create_sparse_results_table(table_view const& flattened_values,
   return sparse_table;
 }
 
+/**
+ * @brief Indicates whether the single-pass aggregations of `values` can accumulate their partial
+ * results in shared memory.
+ */
+bool can_use_shared_memory_aggs(table_view const& values,
+                                std::vector<aggregation::Kind> const& aggs)
+{
+  return std::all_of(thrust::make_counting_iterator<size_t>(0),
+                     thrust::make_counting_iterator<size_t>(aggs.size()),
+                     [&](auto i) {
+                       auto const type = values.column(i).type();
+                       return not cudf::is_dictionary(type) and
+                              cudf::detail::dispatch_type_and_aggregation(
+                                type, aggs[i], shared_memory_aggregation_fn{});
+                     });
+}
+
+/**
+ * @brief Returns the byte offsets of the partial results of each column of `sparse_table` in the
+ * shared memory of `compute_shared_memory_aggs`, and the total number of bytes.
+ */
+std::pair<std::vector<std::size_t>, std::size_t> shared_memory_layout(
+  table_view const& sparse_table, size_type num_groups)
+{
+  auto const aligned = [](std::size_t bytes) {
+    return cudf::util::round_up_safe(bytes, std::size_t{16});
+  };
+  std::vector<std::size_t> offsets;
+  std::size_t num_bytes = 0;
+  for (auto const& col : sparse_table) {
+    offsets.push_back(num_bytes);
+    num_bytes += aligned(num_groups * cudf::size_of(col.type()));
+    offsets.push_back(num_bytes);
+    if (col.nullable()) {
+      num_bytes += aligned(num_bitmask_words(num_groups) * sizeof(bitmask_type));
+    }
+  }
+  return {std::move(offsets), num_bytes};
+}
+
+/**
+ * @brief Launches `compute_shared_memory_aggs` to aggregate the rows of `num_groups` groups whose
+ * partial results take the shared memory described by `layout`.
+ *
+ * @see hash::compute_shared_memory_aggs
+ */
+void launch_shared_memory_aggs(size_type num_rows,
+                               size_type const* row_keys,
+                               size_type const* key_groups,
+                               size_type const* group_keys,
+                               size_type num_groups,
+                               std::pair<std::vector<std::size_t>, std::size_t> const& layout,
+                               table_device_view const& d_values,
+                               mutable_table_device_view const& d_sparse_table,
+                               aggregation::Kind const* d_aggs,
+                               rmm::cuda_stream_view stream)
+{
+  rmm::device_vector<std::size_t> d_offsets(layout.first);
+
+  // Each block merges all groups once, so launch no more blocks than can run at a time
+  constexpr int block_size{256};
+  int max_blocks_per_sm{0};
+  CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+    &max_blocks_per_sm, hash::compute_shared_memory_aggs, block_size, layout.second));
+  int device{0};
+  CUDA_TRY(cudaGetDevice(&device));
+  int num_sms{0};
+  CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, device));
+  cudf::detail::grid_1d const config(num_rows, block_size);
+  auto const num_blocks = std::min(config.num_blocks, std::max(1, max_blocks_per_sm) * num_sms);
+
+  hash::compute_shared_memory_aggs<<<num_blocks, block_size, layout.second, stream.value()>>>(
+    num_rows,
+    row_keys,
+    key_groups,
+    group_keys,
+    num_groups,
+    d_values,
+    d_sparse_table,
+    d_aggs,
+    d_offsets.data().get());
+  CHECK_CUDA(stream.value());
+}
+
+/**
+ * @brief Computes single-pass aggregations after inserting every key into `map`, so that the
+ * number of groups is known before aggregating.
+ *
+ * If the partial results of all groups fit in shared memory, each block accumulates its rows in
+ * shared memory and merges them into `sparse_table` once per group, which avoids contention on the
+ * global atomics of few groups. Otherwise the rows are aggregated directly into `sparse_table`.
+ */
+template <typename Map>
+void compute_aggs_by_key_rows(Map& map,
+                              size_type num_rows,
+                              table_device_view const& d_values,
+                              mutable_table_view const& sparse_table,
+                              mutable_table_device_view const& d_sparse_table,
+                              aggregation::Kind const* d_aggs,
+                              bitmask_type const* row_bitmask,
+                              bool skip_rows_with_nulls,
+                              rmm::cuda_stream_view stream)
+{
+  // The representative key row of each row, which indexes its sparse results
+  rmm::device_uvector<size_type> row_keys(num_rows, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator(0),
+                     num_rows,
+                     hash::insert_key_rows_fn<Map>{
+                       map, row_bitmask, skip_rows_with_nulls, row_keys.data()});
+
+  auto const is_group_key = [row_keys = row_keys.data()] __device__(size_type row) {
+    return row_keys[row] == row;
+  };
+  auto const num_groups = static_cast<size_type>(
+    thrust::count_if(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator(0),
+                     thrust::make_counting_iterator(num_rows),
+                     is_group_key));
+
+  auto const layout = shared_memory_layout(sparse_table, num_groups);
+  if (num_groups > GROUPBY_SHARED_MEMORY_MAX_GROUPS or
+      layout.second > GROUPBY_SHARED_MEMORY_MAX_BYTES) {
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator(0),
+                       num_rows,
+                       [row_keys = row_keys.data(),
+                        d_values,
+                        d_sparse_table,
+                        d_aggs] __device__(size_type row) {
+                         if (row_keys[row] < 0) { return; }
+                         cudf::detail::aggregate_row<true, true>(
+                           d_sparse_table, row_keys[row], d_values, row, d_aggs);
+                       });
+    return;
+  }
+
+  rmm::device_uvector<size_type> group_keys(num_groups, stream);
+  thrust::copy_if(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator(0),
+                  thrust::make_counting_iterator(num_rows),
+                  group_keys.begin(),
+                  is_group_key);
+  rmm::device_uvector<size_type> key_groups(num_rows, stream);
+  thrust::scatter(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator(0),
+                  thrust::make_counting_iterator(num_groups),
+                  group_keys.begin(),
+                  key_groups.begin());
+  launch_shared_memory_aggs(num_rows,
+                            row_keys.data(),
+                            key_groups.data(),
+                            group_keys.data(),
+                            num_groups,
+                            layout,
+                            d_values,
+                            d_sparse_table,
+                            d_aggs,
+                            stream);
+}
+
 /**
  * @brief Computes all aggregations from `requests` that require a single pass
  * over the data and stores the results in `sparse_results`
@@ -431,7 +624,8 @@ void compute_single_pass_aggs(table_view const& keys,
   std::tie(flattened_values, aggs, col_ids) = flatten_single_pass_aggs(requests);
 
   // make table that will hold sparse results
-  table sparse_table = create_sparse_results_table(flattened_values, aggs, stream);
+  table sparse_table =
+    create_sparse_results_table(flattened_values, aggs, flattened_values.num_rows(), stream);
   // prepare to launch kernel to do the actual aggregation
   auto d_sparse_table = mutable_table_device_view::create(sparse_table, stream);
   auto d_values       = table_device_view::create(flattened_values, stream);
@@ -439,19 +633,31 @@ void compute_single_pass_aggs(table_view const& keys,
 
   bool skip_key_rows_with_nulls = keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
 
-  auto row_bitmask =
-    skip_key_rows_with_nulls ? cudf::detail::bitmask_and(keys, stream) : rmm::device_buffer{};
-  thrust::for_each_n(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator(0),
-    keys.num_rows(),
-    hash::compute_single_pass_aggs_fn<Map>{map,
-                                           keys.num_rows(),
-                                           *d_values,
-                                           *d_sparse_table,
-                                           d_aggs.data().get(),
-                                           static_cast<bitmask_type*>(row_bitmask.data()),
-                                           skip_key_rows_with_nulls});
+  auto row_bitmask = skip_key_rows_with_nulls ? cudf::detail::bitmask_and(keys, stream).first
+                                              : rmm::device_buffer{};
+  if (keys.num_rows() > 0 and can_use_shared_memory_aggs(flattened_values, aggs)) {
+    compute_aggs_by_key_rows(map,
+                             keys.num_rows(),
+                             *d_values,
+                             sparse_table.mutable_view(),
+                             *d_sparse_table,
+                             d_aggs.data().get(),
+                             static_cast<bitmask_type*>(row_bitmask.data()),
+                             skip_key_rows_with_nulls,
+                             stream);
+  } else {
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator(0),
+      keys.num_rows(),
+      hash::compute_single_pass_aggs_fn<Map>{map,
+                                             keys.num_rows(),
+                                             *d_values,
+                                             *d_sparse_table,
+                                             d_aggs.data().get(),
+                                             static_cast<bitmask_type*>(row_bitmask.data()),
+                                             skip_key_rows_with_nulls});
+  }
   // Add results back to sparse_results cache
   auto sparse_result_cols = sparse_table.release();
   for (size_t i = 0; i < aggs.size(); i++) {
@@ -561,6 +767,292 @@ std::unique_ptr<table> groupby_null_templated(table_view const& keys,
                               mr);
 }
 
+/**
+ * @brief Returns the smallest value and the range of the values of an integer key column.
+ */
+struct direct_key_range_fn {
+  template <typename T, std::enable_if_t<cudf::is_index_type<T>()>* = nullptr>
+  std::pair<int64_t, uint64_t> operator()(column_view const& col, rmm::cuda_stream_view stream)
+  {
+    using ScalarType = cudf::scalar_type_t<T>;
+    auto const range = cudf::detail::minmax(col, stream, rmm::mr::get_current_device_resource());
+    auto const min   = static_cast<ScalarType*>(range.first.get())->value(stream);
+    auto const max   = static_cast<ScalarType*>(range.second.get())->value(stream);
+    return {static_cast<int64_t>(min), static_cast<uint64_t>(max) - static_cast<uint64_t>(min)};
+  }
+
+  template <typename T, std::enable_if_t<not cudf::is_index_type<T>()>* = nullptr>
+  std::pair<int64_t, uint64_t> operator()(column_view const&, rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Only integer keys have a range of values.");
+  }
+};
+
+/**
+ * @brief The radix and the smallest value of each key column in the group numbers of
+ * `direct_group_fn`.
+ */
+struct direct_group_layout {
+  std::vector<size_type> radices;
+  std::vector<int64_t> min_values;
+};
+
+/**
+ * @brief Returns the layout of the group numbers of `direct_group_fn`, or an empty layout if the
+ * keys cannot be grouped directly.
+ *
+ * The keys are grouped directly if they are all dictionary or integer columns and the number of
+ * combinations of their key values is at most `GROUPBY_DIRECT_MAX_GROUPS` or the number of rows.
+ * The range of the values of an integer key column is computed with a minmax of the column.
+ */
+direct_group_layout make_direct_group_layout(table_view const& keys,
+                                             null_policy include_null_keys,
+                                             rmm::cuda_stream_view stream)
+{
+  if (keys.num_rows() == 0 or
+      not std::all_of(keys.begin(), keys.end(), [](column_view const& col) {
+        return cudf::is_dictionary(col.type()) or cudf::is_index_type(col.type());
+      })) {
+    return {};
+  }
+  auto const max_groups = std::max<int64_t>(GROUPBY_DIRECT_MAX_GROUPS, keys.num_rows());
+  direct_group_layout layout;
+  int64_t num_groups = 1;
+  for (auto const& col : keys) {
+    auto const null_radix = col.has_nulls() and include_null_keys == null_policy::INCLUDE ? 1 : 0;
+    int64_t min_value   = 0;
+    uint64_t num_values = 0;
+    if (cudf::is_dictionary(col.type())) {
+      num_values = cudf::dictionary_column_view(col).keys_size();
+    } else if (col.null_count() < col.size()) {
+      uint64_t range;
+      std::tie(min_value, range) = type_dispatcher(col.type(), direct_key_range_fn{}, col, stream);
+      if (range >= static_cast<uint64_t>(max_groups)) { return {}; }
+      num_values = range + 1;
+    }
+    auto const radix = static_cast<int64_t>(num_values) + null_radix;
+    num_groups *= radix;
+    if (num_groups == 0 or num_groups > max_groups) { return {}; }
+    layout.radices.push_back(static_cast<size_type>(radix));
+    layout.min_values.push_back(min_value);
+  }
+  return layout;
+}
+
+/**
+ * @brief Computes groupby of keys grouped directly by their values.
+ *
+ * Instead of a hash map of the key rows, the group of every row is computed directly from the
+ * dictionary indices or integer values of its keys by `direct_group_fn`. The sparse results have
+ * one row per combination of key values, which the single-pass aggregations index with the group
+ * of each row. If the partial results of all combinations fit in shared memory, each block
+ * accumulates its rows there before merging them into the sparse results.
+ *
+ * The populated groups are then compacted like the populated keys of the hash map in
+ * `groupby_null_templated`, and the unique keys are gathered from a row of each group. The groups
+ * are in the order of the values of the keys, with null keys last.
+ *
+ * @param layout The layout of the group numbers from `make_direct_group_layout`
+ */
+std::unique_ptr<table> groupby_direct(table_view const& keys,
+                                      direct_group_layout const& layout,
+                                      host_span<aggregation_request const> requests,
+                                      cudf::detail::result_cache* cache,
+                                      null_policy include_null_keys,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows   = keys.num_rows();
+  auto const num_groups = std::accumulate(
+    layout.radices.begin(), layout.radices.end(), size_type{1}, std::multiplies<size_type>());
+  bool const keys_have_nulls = has_nulls(keys);
+  bool const skip_key_rows_with_nulls =
+    keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
+
+  auto const d_keys       = table_device_view::create(keys, stream);
+  auto const d_radices    = cudf::detail::make_device_uvector_async(layout.radices, stream);
+  auto const d_min_values = cudf::detail::make_device_uvector_async(layout.min_values, stream);
+  rmm::device_uvector<size_type> row_groups(num_rows, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(num_rows),
+                    row_groups.begin(),
+                    hash::direct_group_fn{
+                      *d_keys, d_radices.data(), d_min_values.data(), skip_key_rows_with_nulls});
+  hash::direct_group_map const map{row_groups.data()};
+
+  // A row of each populated group, from which its keys are gathered
+  rmm::device_uvector<size_type> group_rows(num_groups, stream);
+  thrust::fill(rmm::exec_policy(stream), group_rows.begin(), group_rows.end(), -1);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator(0),
+    num_rows,
+    [row_groups = row_groups.data(), group_rows = group_rows.data()] __device__(size_type row) {
+      if (row_groups[row] >= 0) { group_rows[row_groups[row]] = row; }
+    });
+
+  // Compute all single pass aggs into one sparse result row per group
+  table_view flattened_values;
+  std::vector<aggregation::Kind> aggs;
+  std::vector<size_t> col_ids;
+  std::tie(flattened_values, aggs, col_ids) = flatten_single_pass_aggs(requests);
+
+  table sparse_table  = create_sparse_results_table(flattened_values, aggs, num_groups, stream);
+  auto d_sparse_table = mutable_table_device_view::create(sparse_table, stream);
+  auto d_values       = table_device_view::create(flattened_values, stream);
+  rmm::device_vector<aggregation::Kind> d_aggs(aggs);
+
+  auto const shared_layout = shared_memory_layout(sparse_table.view(), num_groups);
+  if (can_use_shared_memory_aggs(flattened_values, aggs) and
+      num_groups <= GROUPBY_SHARED_MEMORY_MAX_GROUPS and
+      shared_layout.second <= GROUPBY_SHARED_MEMORY_MAX_BYTES) {
+    // Every group is its own representative key and sparse result row
+    rmm::device_uvector<size_type> groups(num_groups, stream);
+    thrust::sequence(rmm::exec_policy(stream), groups.begin(), groups.end());
+    launch_shared_memory_aggs(num_rows,
+                              row_groups.data(),
+                              groups.data(),
+                              groups.data(),
+                              num_groups,
+                              shared_layout,
+                              *d_values,
+                              *d_sparse_table,
+                              d_aggs.data().get(),
+                              stream);
+  } else {
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator(0),
+                       num_rows,
+                       [row_groups = row_groups.data(),
+                        d_values   = *d_values,
+                        d_sparse   = *d_sparse_table,
+                        d_aggs     = d_aggs.data().get()] __device__(size_type row) {
+                         if (row_groups[row] < 0) { return; }
+                         cudf::detail::aggregate_row<true, true>(
+                           d_sparse, row_groups[row], d_values, row, d_aggs);
+                       });
+  }
+
+  cudf::detail::result_cache sparse_results(requests.size());
+  auto sparse_result_cols = sparse_table.release();
+  for (size_t i = 0; i < aggs.size(); i++) {
+    // Note that the cache will make a copy of this temporary aggregation
+    auto agg = std::make_unique<aggregation>(aggs[i]);
+    sparse_results.add_result(col_ids[i], *agg, std::move(sparse_result_cols[i]));
+  }
+
+  // Gathering the populated groups from sparse results will give dense results
+  rmm::device_uvector<size_type> gather_map(num_groups, stream);
+  rmm::device_uvector<size_type> key_rows(num_groups, stream);
+  auto const is_populated = [] __device__(size_type row) { return row >= 0; };
+  auto const map_size     = static_cast<size_type>(
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(num_groups),
+                    group_rows.begin(),
+                    gather_map.begin(),
+                    is_populated) -
+    gather_map.begin());
+  thrust::copy_if(rmm::exec_policy(stream),
+                  group_rows.begin(),
+                  group_rows.end(),
+                  key_rows.begin(),
+                  is_populated);
+
+  sparse_to_dense_results(keys,
+                          requests,
+                          &sparse_results,
+                          cache,
+                          gather_map,
+                          map_size,
+                          map,
+                          keys_have_nulls,
+                          include_null_keys,
+                          stream,
+                          mr);
+
+  return cudf::detail::gather(keys,
+                              key_rows.begin(),
+                              key_rows.begin() + map_size,
+                              out_of_bounds_policy::DONT_CHECK,
+                              stream,
+                              mr);
+}
+
+/**
+ * @brief Labels each row of `keys` with the group of its key, numbering the groups densely from a
+ * hash map.
+ *
+ * @return The rows that are not skipped for their null keys, in input order, their group labels
+ * and the number of groups
+ */
+template <bool keys_have_nulls>
+std::tuple<rmm::device_uvector<size_type>, rmm::device_uvector<size_type>, size_type>
+compute_row_labels(table_view const& keys,
+                   null_policy include_null_keys,
+                   rmm::cuda_stream_view stream)
+{
+  auto const num_rows = keys.num_rows();
+  auto const d_keys   = table_device_view::create(keys, stream);
+  auto map            = create_hash_map<keys_have_nulls>(*d_keys, include_null_keys, stream);
+  using map_type      = std::remove_reference_t<decltype(*map)>;
+
+  bool const skip_key_rows_with_nulls =
+    keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
+  auto const row_bitmask = skip_key_rows_with_nulls
+                             ? cudf::detail::bitmask_and(keys, stream).first
+                             : rmm::device_buffer{0, stream};
+
+  // The representative key row of each row, or -1 if the row is skipped
+  rmm::device_uvector<size_type> row_keys(num_rows, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator(0),
+                     num_rows,
+                     hash::insert_key_rows_fn<map_type>{
+                       *map,
+                       static_cast<bitmask_type const*>(row_bitmask.data()),
+                       skip_key_rows_with_nulls,
+                       row_keys.data()});
+
+  // The groups are numbered in the order of their representative rows
+  rmm::device_uvector<size_type> group_ids(num_rows, stream);
+  auto const is_group_key = [row_keys = row_keys.data()] __device__(size_type row) -> size_type {
+    return row_keys[row] == row;
+  };
+  thrust::transform_exclusive_scan(rmm::exec_policy(stream),
+                                   thrust::make_counting_iterator(0),
+                                   thrust::make_counting_iterator(num_rows),
+                                   group_ids.begin(),
+                                   is_group_key,
+                                   0,
+                                   thrust::plus<size_type>{});
+  auto const num_groups = group_ids.back_element(stream) +
+                          (row_keys.back_element(stream) == num_rows - 1 ? 1 : 0);
+
+  rmm::device_uvector<size_type> rows(num_rows, stream);
+  if (skip_key_rows_with_nulls) {
+    auto const rows_end = thrust::copy_if(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator(0),
+      thrust::make_counting_iterator(num_rows),
+      rows.begin(),
+      [row_keys = row_keys.data()] __device__(size_type row) { return row_keys[row] >= 0; });
+    rows.resize(thrust::distance(rows.begin(), rows_end), stream);
+  } else {
+    thrust::sequence(rmm::exec_policy(stream), rows.begin(), rows.end());
+  }
+
+  rmm::device_uvector<size_type> labels(rows.size(), stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    rows.begin(),
+                    rows.end(),
+                    labels.begin(),
+                    [row_keys = row_keys.data(), group_ids = group_ids.data()] __device__(
+                      size_type row) { return group_ids[row_keys[row]]; });
+  return {std::move(rows), std::move(labels), num_groups};
+}
+
 }  // namespace
 
 /**
@@ -582,6 +1074,8 @@ bool can_use_hash_groupby(table_view const& keys, host_span<aggregation_request
   });
 }
 
+bool can_use_hash_aggregation(aggregation::Kind kind) { return is_hash_aggregation(kind); }
+
 // Hash-based groupby
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   table_view const& keys,
@@ -593,7 +1087,11 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   cudf::detail::result_cache cache(requests.size());
 
   std::unique_ptr<table> unique_keys;
-  if (has_nulls(keys)) {
+  auto const direct_layout = make_direct_group_layout(keys, include_null_keys, stream);
+  if (not direct_layout.radices.empty()) {
+    unique_keys =
+      groupby_direct(keys, direct_layout, requests, &cache, include_null_keys, stream, mr);
+  } else if (has_nulls(keys)) {
     unique_keys =
       groupby_null_templated<true>(keys, requests, &cache, include_null_keys, stream, mr);
   } else {
@@ -603,6 +1101,97 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
 
   return std::make_pair(std::move(unique_keys), extract_results(requests, cache));
 }
+
+// Hash-based groupby scan
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> scan(
+  table_view const& keys,
+  host_span<aggregation_request const> requests,
+  null_policy include_null_keys,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto [rows, labels, num_groups] =
+    has_nulls(keys) ? compute_row_labels<true>(keys, include_null_keys, stream)
+                    : compute_row_labels<false>(keys, include_null_keys, stream);
+  auto const num_out_rows = static_cast<size_type>(rows.size());
+
+  // A stable sort of the labels groups the rows, keeping the rows of each group in input order.
+  // `positions` are the output rows in grouped order, and `out_rows` their inverse.
+  rmm::device_uvector<size_type> positions(num_out_rows, stream);
+  thrust::sequence(rmm::exec_policy(stream), positions.begin(), positions.end());
+  thrust::stable_sort_by_key(
+    rmm::exec_policy(stream), labels.begin(), labels.end(), positions.begin());
+  rmm::device_uvector<size_type> grouped_rows(num_out_rows, stream);
+  thrust::gather(rmm::exec_policy(stream),
+                 positions.begin(),
+                 positions.end(),
+                 rows.begin(),
+                 grouped_rows.begin());
+  rmm::device_uvector<size_type> out_rows(num_out_rows, stream);
+  thrust::scatter(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator(0),
+                  thrust::make_counting_iterator(num_out_rows),
+                  positions.begin(),
+                  out_rows.begin());
+
+  auto const in_input_order = [&](column_view const& grouped_result) {
+    return std::move(cudf::detail::gather(table_view{{grouped_result}},
+                                          out_rows.begin(),
+                                          out_rows.end(),
+                                          out_of_bounds_policy::DONT_CHECK,
+                                          stream,
+                                          mr)
+                       ->release()
+                       .front());
+  };
+
+  cudf::detail::result_cache cache(requests.size());
+  for (size_t i = 0; i < requests.size(); i++) {
+    std::unique_ptr<table> grouped_values;
+    auto const get_grouped_values = [&]() {
+      if (not grouped_values) {
+        grouped_values = cudf::detail::gather(table_view{{requests[i].values}},
+                                              grouped_rows.begin(),
+                                              grouped_rows.end(),
+                                              out_of_bounds_policy::DONT_CHECK,
+                                              stream,
+                                              rmm::mr::get_current_device_resource());
+      }
+      return grouped_values->get_column(0).view();
+    };
+    for (auto const& agg : requests[i].aggregations) {
+      if (cache.has_result(i, *agg)) { continue; }
+      auto const tmp_mr = rmm::mr::get_current_device_resource();
+      std::unique_ptr<column> grouped_result;
+      switch (agg->kind) {
+        case aggregation::SUM:
+          grouped_result =
+            detail::sum_scan(get_grouped_values(), num_groups, labels, stream, tmp_mr);
+          break;
+        case aggregation::MIN:
+          grouped_result =
+            detail::min_scan(get_grouped_values(), num_groups, labels, stream, tmp_mr);
+          break;
+        case aggregation::MAX:
+          grouped_result =
+            detail::max_scan(get_grouped_values(), num_groups, labels, stream, tmp_mr);
+          break;
+        case aggregation::COUNT_ALL:
+          grouped_result = detail::count_scan(labels, stream, tmp_mr);
+          break;
+        default: CUDF_FAIL("Unsupported groupby scan aggregation");
+      }
+      cache.add_result(i, *agg, in_input_order(grouped_result->view()));
+    }
+  }
+
+  auto out_keys =
+    num_out_rows == keys.num_rows()
+      ? std::make_unique<table>(keys, stream, mr)
+      : cudf::detail::gather(
+          keys, rows.begin(), rows.end(), out_of_bounds_policy::DONT_CHECK, stream, mr);
+  return std::make_pair(std::move(out_keys), extract_results(requests, cache));
+}
 }  // namespace hash
 }  // namespace detail
 }  // namespace groupby
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,9 +19,15 @@
 #include <cudf/detail/aggregation/aggregation.cuh>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/groupby.hpp>
+#include <cudf/detail/utilities/assert.cuh>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 #include "multi_pass_kernels.cuh"
 
+#include <thrust/pair.h>
+
 namespace cudf {
 namespace groupby {
 namespace detail {
@@ -115,6 +121,305 @@ struct compute_single_pass_aggs_fn {
   }
 };
 
+/**
+ * @brief Inserts every row `i` of the keys into `map` and records the index of the row of its key
+ * stored in the map, which indexes the sparse results of the row.
+ *
+ * Rows skipped because their keys contain nulls are recorded as `-1`.
+ *
+ * @tparam Map The type of the hash map
+ */
+template <typename Map>
+struct insert_key_rows_fn {
+  Map map;
+  bitmask_type const* __restrict__ row_bitmask;
+  bool skip_rows_with_nulls;
+  size_type* __restrict__ row_keys;
+
+  insert_key_rows_fn(Map map,
+                     bitmask_type const* row_bitmask,
+                     bool skip_rows_with_nulls,
+                     size_type* row_keys)
+    : map(map),
+      row_bitmask(row_bitmask),
+      skip_rows_with_nulls(skip_rows_with_nulls),
+      row_keys(row_keys)
+  {
+  }
+
+  __device__ void operator()(size_type i)
+  {
+    row_keys[i] = (not skip_rows_with_nulls or cudf::bit_is_set(row_bitmask, i))
+                    ? map.insert(thrust::make_pair(i, i)).first->second
+                    : -1;
+  }
+};
+
+/**
+ * @brief Returns the value of a key that can be grouped directly: the index of a dictionary key or
+ * the value of an integer key.
+ */
+struct direct_key_value_fn {
+  template <typename T, std::enable_if_t<cudf::is_index_type<T>()>* = nullptr>
+  __device__ int64_t operator()(column_device_view const& key, size_type i) const noexcept
+  {
+    return static_cast<int64_t>(key.element<T>(i));
+  }
+
+  template <typename T, std::enable_if_t<std::is_same<T, dictionary32>::value>* = nullptr>
+  __device__ int64_t operator()(column_device_view const& key, size_type i) const noexcept
+  {
+    return static_cast<int64_t>(key.element<T>(i).value());
+  }
+
+  template <typename T,
+            std::enable_if_t<not cudf::is_index_type<T>() and
+                             not std::is_same<T, dictionary32>::value>* = nullptr>
+  __device__ int64_t operator()(column_device_view const&, size_type) const noexcept
+  {
+    cudf_assert(false and "Keys of this type cannot be grouped directly.");
+    return 0;
+  }
+};
+
+/**
+ * @brief Computes the group of every row `i` directly from the values of its keys, which are
+ * dictionary indices or integers in a small range.
+ *
+ * The keys are the digits of the group number in a mixed radix: the digit of a key is its value
+ * minus the smallest value of its column, and the radix of a column is the range of its values,
+ * plus one for a null key if null keys are grouped. A null key takes the last digit of its column.
+ *
+ * Rows skipped because their keys contain nulls are in group `-1`.
+ */
+struct direct_group_fn {
+  table_device_view keys;
+  size_type const* __restrict__ radices;
+  int64_t const* __restrict__ min_values;
+  bool skip_rows_with_nulls;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    size_type group = 0;
+    for (size_type c = 0; c < keys.num_columns(); ++c) {
+      auto const& key = keys.column(c);
+      if (key.is_null(i) and skip_rows_with_nulls) { return -1; }
+      auto const digit =
+        key.is_null(i)
+          ? radices[c] - 1
+          : static_cast<size_type>(
+              static_cast<uint64_t>(type_dispatcher(key.type(), direct_key_value_fn{}, key, i)) -
+              static_cast<uint64_t>(min_values[c]));
+      group = group * radices[c] + digit;
+    }
+    return group;
+  }
+};
+
+/**
+ * @brief Maps every row of the keys to its group computed by `direct_group_fn`, which indexes the
+ * sparse results of the row.
+ *
+ * It provides the `find` of the hash map used by the multi-pass aggregations, so that they can
+ * look up the sparse result row of any row of the keys.
+ */
+struct direct_group_map {
+  size_type const* row_groups;
+
+  // The (key, value) entry of a row as found in the hash map
+  struct entry {
+    thrust::pair<size_type, size_type> row_group;
+    __device__ thrust::pair<size_type, size_type> const* operator->() const { return &row_group; }
+  };
+
+  __device__ entry find(size_type i) const { return entry{thrust::make_pair(i, row_groups[i])}; }
+};
+
+/**
+ * @brief Indicates whether the partial results of aggregation `k` of `Source` values can be
+ * accumulated in shared memory and then merged into the sparse results.
+ */
+template <typename Source, aggregation::Kind k>
+constexpr bool is_shared_memory_aggregation()
+{
+  return cudf::is_fixed_width<Source>() and not cudf::is_fixed_point<Source>() and
+         cudf::detail::is_valid_aggregation<Source, k>() and
+         (k == aggregation::SUM or k == aggregation::MIN or k == aggregation::MAX or
+          k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL or
+          ((k == aggregation::PRODUCT or k == aggregation::SUM_OF_SQUARES) and
+           cudf::detail::is_product_supported<Source>()));
+}
+
+/**
+ * @brief Dispatched functor returning whether an aggregation can use shared memory.
+ */
+struct shared_memory_aggregation_fn {
+  template <typename Source, aggregation::Kind k>
+  constexpr bool operator()() const noexcept
+  {
+    return is_shared_memory_aggregation<Source, k>();
+  }
+};
+
+/**
+ * @brief A column of per-block partial results held in shared memory.
+ *
+ * It has the type of the sparse result column it is merged into, so that partial results are
+ * accumulated by the same `update_target_element` operations as the sparse results.
+ */
+struct shared_memory_column : mutable_column_device_view {
+  __device__ shared_memory_column(mutable_column_device_view output,
+                                  void* data,
+                                  bitmask_type* null_mask)
+    : mutable_column_device_view(output)
+  {
+    _data      = data;
+    _null_mask = null_mask;
+    _offset    = 0;
+  }
+};
+
+/**
+ * @brief Dispatched functor setting a partial result to the identity of its aggregation.
+ */
+struct initialize_shared_memory_element {
+  template <typename Source, aggregation::Kind k>
+  __device__ void operator()(mutable_column_device_view partial, size_type index) const noexcept
+  {
+    if constexpr (is_shared_memory_aggregation<Source, k>()) {
+      using Target = cudf::detail::target_type_t<Source, k>;
+      partial.element<Target>(index) =
+        cudf::detail::corresponding_operator_t<k>::template identity<Target>();
+    }
+  }
+};
+
+/**
+ * @brief Dispatched functor merging a partial result into a sparse result.
+ *
+ * Counts, sums and sums of squares are merged by adding them, and other aggregations by
+ * applying themselves again. Null partial results had no valid values and are skipped.
+ */
+struct merge_shared_memory_element {
+  template <typename Source, aggregation::Kind k>
+  __device__ void operator()(mutable_column_device_view target,
+                             size_type target_index,
+                             mutable_column_device_view partial,
+                             size_type partial_index) const noexcept
+  {
+    if constexpr (is_shared_memory_aggregation<Source, k>()) {
+      if (partial.is_null(partial_index)) { return; }
+
+      using Target     = cudf::detail::target_type_t<Source, k>;
+      auto const value = partial.element<Target>(partial_index);
+      if constexpr (k == aggregation::MIN) {
+        atomicMin(&target.element<Target>(target_index), value);
+      } else if constexpr (k == aggregation::MAX) {
+        atomicMax(&target.element<Target>(target_index), value);
+      } else if constexpr (k == aggregation::PRODUCT) {
+        atomicMul(&target.element<Target>(target_index), value);
+      } else {
+        atomicAdd(&target.element<Target>(target_index), value);
+      }
+
+      if (target.is_null(target_index)) { target.set_valid(target_index); }
+    }
+  }
+};
+
+/**
+ * @brief Computes single-pass aggregations of a few groups, accumulating the partial results of
+ * each block in shared memory before merging them into the sparse `output_values`.
+ *
+ * With few groups, every row of a group updates the same sparse result row, so the global atomics
+ * serialize. Here the rows of a block update shared memory instead, and each block merges only
+ * one partial result per group and aggregation.
+ *
+ * The partial results of column `c` of `output_values` take `num_groups` elements starting at byte
+ * `shared_offsets[2 * c]` of the dynamic shared memory, followed by a null mask starting at byte
+ * `shared_offsets[2 * c + 1]` if the column is nullable.
+ *
+ * @param num_rows The number of rows in the input keys and values
+ * @param row_keys The representative key row of each row, or `-1` for skipped rows
+ * @param key_groups The group of each representative key row
+ * @param group_keys The representative key row of each group, which is the sparse result row
+ * @param num_groups The number of groups
+ * @param input_values The table whose rows will be aggregated
+ * @param output_values Table that stores the sparse results of the aggregations
+ * @param aggs The aggregation of each column of `input_values`
+ * @param shared_offsets The byte offsets of the partial results in shared memory
+ */
+__global__ void compute_shared_memory_aggs(size_type num_rows,
+                                           size_type const* __restrict__ row_keys,
+                                           size_type const* __restrict__ key_groups,
+                                           size_type const* __restrict__ group_keys,
+                                           size_type num_groups,
+                                           table_device_view input_values,
+                                           mutable_table_device_view output_values,
+                                           aggregation::Kind const* __restrict__ aggs,
+                                           std::size_t const* __restrict__ shared_offsets)
+{
+  extern __shared__ __align__(16) unsigned char shared_memory[];
+
+  auto const partial_column = [&](size_type c) {
+    auto const output = output_values.column(c);
+    auto const mask   = reinterpret_cast<bitmask_type*>(shared_memory + shared_offsets[2 * c + 1]);
+    return shared_memory_column{
+      output, shared_memory + shared_offsets[2 * c], output.nullable() ? mask : nullptr};
+  };
+  auto const num_columns    = output_values.num_columns();
+  auto const num_mask_words = (num_groups + cudf::detail::size_in_bits<bitmask_type>() - 1) /
+                              cudf::detail::size_in_bits<bitmask_type>();
+
+  for (size_type c = 0; c < num_columns; ++c) {
+    auto const partial = partial_column(c);
+    for (size_type group = threadIdx.x; group < num_groups; group += blockDim.x) {
+      cudf::detail::dispatch_type_and_aggregation(input_values.column(c).type(),
+                                                  aggs[c],
+                                                  initialize_shared_memory_element{},
+                                                  partial,
+                                                  group);
+    }
+    if (partial.nullable()) {
+      for (size_type word = threadIdx.x; word < num_mask_words; word += blockDim.x) {
+        partial.null_mask()[word] = 0;
+      }
+    }
+  }
+  __syncthreads();
+
+  for (size_type row = threadIdx.x + blockIdx.x * blockDim.x; row < num_rows;
+       row += blockDim.x * gridDim.x) {
+    auto const key = row_keys[row];
+    if (key < 0) { continue; }
+    auto const group = key_groups[key];
+    for (size_type c = 0; c < num_columns; ++c) {
+      cudf::detail::dispatch_type_and_aggregation(
+        input_values.column(c).type(),
+        aggs[c],
+        cudf::detail::elementwise_aggregator<true, true>{},
+        partial_column(c),
+        group,
+        input_values.column(c),
+        row);
+    }
+  }
+  __syncthreads();
+
+  for (size_type c = 0; c < num_columns; ++c) {
+    auto const partial = partial_column(c);
+    for (size_type group = threadIdx.x; group < num_groups; group += blockDim.x) {
+      cudf::detail::dispatch_type_and_aggregation(input_values.column(c).type(),
+                                                  aggs[c],
+                                                  merge_shared_memory_element{},
+                                                  output_values.column(c),
+                                                  group_keys[group],
+                                                  partial,
+                                                  group);
+    }
+  }
+}
+
 }  // namespace hash
 }  // namespace detail
 }  // namespace groupby
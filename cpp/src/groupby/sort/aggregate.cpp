@@ -22,6 +22,8 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/aggregation/hyperloglog.hpp>
+#include <cudf/detail/aggregation/tdigest.hpp>
 #include <cudf/detail/aggregation/result_cache.hpp>
 #include <cudf/detail/binaryop.hpp>
 #include <cudf/detail/gather.hpp>
@@ -400,6 +402,147 @@ void aggregrate_result_functor::operator()<aggregation::COLLECT_SET>(aggregation
     lists::detail::drop_list_duplicates(
       lists_column_view(collect_result->view()), nulls_equal, nans_equal, stream, mr));
 };
+
+template <>
+void aggregrate_result_functor::operator()<aggregation::M2>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto mean_agg = make_mean_aggregation();
+  operator()<aggregation::MEAN>(*mean_agg);
+  column_view mean_result = cache.get_result(col_idx, *mean_agg);
+
+  cache.add_result(
+    col_idx,
+    agg,
+    detail::group_m2(get_grouped_values(), mean_result, helper.group_labels(stream), stream, mr));
+};
+
+template <>
+void aggregrate_result_functor::operator()<aggregation::MERGE_M2>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  cache.add_result(col_idx,
+                   agg,
+                   detail::group_merge_m2(get_grouped_values(),
+                                          helper.group_labels(stream),
+                                          helper.num_groups(stream),
+                                          stream,
+                                          mr));
+};
+
+template <>
+void aggregrate_result_functor::operator()<aggregation::MERGE_LISTS>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  cache.add_result(
+    col_idx,
+    agg,
+    detail::group_merge_lists(
+      get_grouped_values(), helper.group_offsets(stream), helper.num_groups(stream), stream, mr));
+};
+
+template <>
+void aggregrate_result_functor::operator()<aggregation::MERGE_SETS>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto const merged_result = detail::group_merge_lists(
+    get_grouped_values(), helper.group_offsets(stream), helper.num_groups(stream), stream, mr);
+  auto const& merge_sets_agg = static_cast<cudf::detail::merge_sets_aggregation const&>(agg);
+  cache.add_result(col_idx,
+                   agg,
+                   lists::detail::drop_list_duplicates(lists_column_view(merged_result->view()),
+                                                       merge_sets_agg._nulls_equal,
+                                                       merge_sets_agg._nans_equal,
+                                                       stream,
+                                                       mr));
+};
+
+template <>
+void aggregrate_result_functor::operator()<aggregation::APPROX_COUNT_DISTINCT>(
+  aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto const& hll_agg = static_cast<cudf::detail::hll_aggregation const&>(agg);
+  cache.add_result(col_idx,
+                   agg,
+                   cudf::detail::group_approx_count_distinct(get_grouped_values(),
+                                                             helper.group_labels(stream),
+                                                             helper.num_groups(stream),
+                                                             hll_agg._precision,
+                                                             stream,
+                                                             mr));
+};
+
+template <>
+void aggregrate_result_functor::operator()<aggregation::HLL_SKETCH>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto const& hll_agg = static_cast<cudf::detail::hll_aggregation const&>(agg);
+  cache.add_result(col_idx,
+                   agg,
+                   cudf::detail::group_hll_sketch(get_grouped_values(),
+                                                  helper.group_labels(stream),
+                                                  helper.num_groups(stream),
+                                                  hll_agg._precision,
+                                                  stream,
+                                                  mr));
+};
+
+template <>
+void aggregrate_result_functor::operator()<aggregation::MERGE_HLL_SKETCH>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  cache.add_result(
+    col_idx,
+    agg,
+    cudf::detail::group_merge_hll_sketch(
+      get_grouped_values(), helper.group_offsets(stream), helper.num_groups(stream), stream, mr));
+};
+
+template <>
+void aggregrate_result_functor::operator()<aggregation::TDIGEST>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto count_agg = make_count_aggregation();
+  operator()<aggregation::COUNT_VALID>(*count_agg);
+  column_view group_sizes = cache.get_result(col_idx, *count_agg);
+  auto const& tdigest_agg = static_cast<cudf::detail::tdigest_aggregation const&>(agg);
+
+  cache.add_result(col_idx,
+                   agg,
+                   cudf::detail::group_tdigest(get_sorted_values(),
+                                               group_sizes,
+                                               helper.group_offsets(stream),
+                                               helper.group_labels(stream),
+                                               helper.num_groups(stream),
+                                               tdigest_agg._max_centroids,
+                                               stream,
+                                               mr));
+};
+
+template <>
+void aggregrate_result_functor::operator()<aggregation::MERGE_TDIGEST>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto const& tdigest_agg = static_cast<cudf::detail::tdigest_aggregation const&>(agg);
+  cache.add_result(col_idx,
+                   agg,
+                   cudf::detail::group_merge_tdigest(get_grouped_values(),
+                                                     helper.group_labels(stream),
+                                                     helper.num_groups(stream),
+                                                     tdigest_agg._max_centroids,
+                                                     stream,
+                                                     mr));
+};
 }  // namespace detail
 
 // Sort-based groupby
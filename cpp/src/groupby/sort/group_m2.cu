@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "group_reductions.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+
+template <typename ResultType, typename T>
+struct m2_transform {
+  column_device_view const d_values;
+  ResultType const* d_means;
+  size_type const* d_group_labels;
+
+  __device__ ResultType operator()(size_type i) const
+  {
+    if (d_values.is_null(i)) return 0.0;
+
+    auto const x     = static_cast<ResultType>(d_values.element<T>(i));
+    auto const delta = x - d_means[d_group_labels[i]];
+    return delta * delta;
+  }
+};
+
+struct m2_functor {
+  template <typename T>
+  std::enable_if_t<std::is_arithmetic<T>::value, std::unique_ptr<column>> operator()(
+    column_view const& values,
+    column_view const& group_means,
+    cudf::device_span<size_type const> group_labels,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr)
+  {
+    using ResultType = cudf::detail::target_type_t<T, aggregation::Kind::M2>;
+
+    // Groups without valid values have a null mean and a null M2
+    auto result = make_numeric_column(data_type(type_to_id<ResultType>()),
+                                      group_means.size(),
+                                      cudf::detail::copy_bitmask(group_means, stream, mr),
+                                      group_means.null_count(),
+                                      stream,
+                                      mr);
+    if (values.is_empty()) { return result; }
+
+    auto const d_values = column_device_view::create(values, stream);
+    auto m2_iter        = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      m2_transform<ResultType, T>{
+        *d_values, group_means.data<ResultType>(), group_labels.data()});
+
+    thrust::reduce_by_key(rmm::exec_policy(stream),
+                          group_labels.begin(),
+                          group_labels.end(),
+                          m2_iter,
+                          thrust::make_discard_iterator(),
+                          result->mutable_view().data<ResultType>());
+    return result;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<!std::is_arithmetic<T>::value, std::unique_ptr<column>> operator()(Args&&...)
+  {
+    CUDF_FAIL("Only numeric types are supported in M2 aggregation");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> group_m2(column_view const& values,
+                                 column_view const& group_means,
+                                 cudf::device_span<size_type const> group_labels,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  return type_dispatcher(
+    values.type(), m2_functor{}, values, group_means, group_labels, stream, mr);
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "group_reductions.hpp"
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+std::unique_ptr<column> group_merge_lists(column_view const& values,
+                                          cudf::device_span<size_type const> group_offsets,
+                                          size_type num_groups,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(values.type().id() == type_id::LIST,
+               "Input to `group_merge_lists` must be a lists column.");
+  CUDF_EXPECTS(!values.has_nulls(),
+               "Input to `group_merge_lists` must be a non-nullable lists column.");
+
+  if (values.is_empty()) { return cudf::empty_like(values); }
+
+  // The lists of a group are adjacent, so their elements are too: the merged list of a group
+  // spans from the first element of its first list to the last element of its last list
+  auto const lists = lists_column_view(values);
+  auto offsets     = make_numeric_column(
+    data_type(type_to_id<offset_type>()), num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    group_offsets.begin(),
+                    group_offsets.end(),
+                    offsets->mutable_view().begin<offset_type>(),
+                    [d_offsets = lists.offsets_begin()] __device__(size_type group_offset) {
+                      return d_offsets[group_offset] - d_offsets[0];
+                    });
+
+  return make_lists_column(num_groups,
+                           std::move(offsets),
+                           std::make_unique<column>(lists.get_sliced_child(stream), stream, mr),
+                           0,
+                           rmm::device_buffer{0, stream, mr},
+                           stream,
+                           mr);
+}
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "group_reductions.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/transform.h>
+
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+
+/**
+ * @brief Partial state of the variance of a group: its valid count, mean and M2.
+ */
+struct m2_state {
+  double count;
+  double mean;
+  double m2;
+};
+
+/**
+ * @brief Reads the partial state of a row, with rows of empty or null states as the identity.
+ */
+struct m2_state_reader {
+  column_device_view const d_values;
+  column_device_view const d_counts;
+  column_device_view const d_means;
+  column_device_view const d_m2s;
+
+  __device__ m2_state operator()(size_type i) const
+  {
+    if (d_values.is_null(i) or d_counts.is_null(i) or d_means.is_null(i) or d_m2s.is_null(i)) {
+      return m2_state{0.0, 0.0, 0.0};
+    }
+    auto const count = d_counts.element<size_type>(i);
+    if (count == 0) { return m2_state{0.0, 0.0, 0.0}; }
+    return m2_state{
+      static_cast<double>(count), d_means.element<double>(i), d_m2s.element<double>(i)};
+  }
+};
+
+/**
+ * @brief Merges two partial states (Chan et al. parallel variance algorithm).
+ */
+struct merge_m2_states {
+  __device__ m2_state operator()(m2_state const& lhs, m2_state const& rhs) const
+  {
+    if (lhs.count == 0.0) { return rhs; }
+    if (rhs.count == 0.0) { return lhs; }
+    auto const count = lhs.count + rhs.count;
+    auto const delta = rhs.mean - lhs.mean;
+    return m2_state{count,
+                    lhs.mean + delta * rhs.count / count,
+                    lhs.m2 + rhs.m2 + delta * delta * lhs.count * rhs.count / count};
+  }
+};
+
+struct m2_state_is_valid {
+  __device__ bool operator()(m2_state const& state) const { return state.count > 0.0; }
+};
+
+}  // namespace
+
+std::unique_ptr<column> group_merge_m2(column_view const& values,
+                                       cudf::device_span<size_type const> group_labels,
+                                       size_type num_groups,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(values.type().id() == type_id::STRUCT,
+               "Input to `group_merge_m2` must be a structs column.");
+  CUDF_EXPECTS(values.num_children() == 3,
+               "Input to `group_merge_m2` must be a structs column having 3 children columns.");
+
+  auto const structs = structs_column_view(values);
+  auto const counts  = structs.get_sliced_child(0);
+  auto const means   = structs.get_sliced_child(1);
+  auto const m2s     = structs.get_sliced_child(2);
+  CUDF_EXPECTS(counts.type().id() == type_to_id<size_type>() and
+                 means.type().id() == type_id::FLOAT64 and m2s.type().id() == type_id::FLOAT64,
+               "Input to `group_merge_m2` must have children of types [INT32, FLOAT64, FLOAT64].");
+
+  rmm::device_uvector<m2_state> states(num_groups, stream);
+  if (not values.is_empty()) {
+    auto const d_values = column_device_view::create(values, stream);
+    auto const d_counts = column_device_view::create(counts, stream);
+    auto const d_means  = column_device_view::create(means, stream);
+    auto const d_m2s    = column_device_view::create(m2s, stream);
+    auto states_iter    = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      m2_state_reader{*d_values, *d_counts, *d_means, *d_m2s});
+    thrust::reduce_by_key(rmm::exec_policy(stream),
+                          group_labels.begin(),
+                          group_labels.end(),
+                          states_iter,
+                          thrust::make_discard_iterator(),
+                          states.begin(),
+                          thrust::equal_to<size_type>{},
+                          merge_m2_states{});
+  }
+
+  auto result_counts = make_numeric_column(
+    data_type(type_to_id<size_type>()), num_groups, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    states.begin(),
+                    states.end(),
+                    result_counts->mutable_view().begin<size_type>(),
+                    [] __device__(m2_state const& state) {
+                      return static_cast<size_type>(state.count);
+                    });
+
+  // Groups without valid values have a null mean and a null M2
+  auto make_valid_column = [&](auto get_value) {
+    auto [null_mask, null_count] = cudf::detail::valid_if(
+      states.begin(), states.end(), m2_state_is_valid{}, stream, mr);
+    auto result = make_numeric_column(
+      data_type(type_id::FLOAT64), num_groups, std::move(null_mask), null_count, stream, mr);
+    thrust::transform(rmm::exec_policy(stream),
+                      states.begin(),
+                      states.end(),
+                      result->mutable_view().begin<double>(),
+                      get_value);
+    return result;
+  };
+
+  std::vector<std::unique_ptr<column>> children;
+  children.push_back(std::move(result_counts));
+  children.push_back(
+    make_valid_column([] __device__(m2_state const& state) { return state.mean; }));
+  children.push_back(make_valid_column([] __device__(m2_state const& state) { return state.m2; }));
+  return make_structs_column(num_groups, std::move(children), 0, {}, stream, mr);
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/rank_scan.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+std::unique_ptr<column> rank_scan(column_view const& grouped_values,
+                                  device_span<size_type const> group_labels,
+                                  device_span<size_type const> group_offsets,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  return cudf::detail::rank_generator(
+    grouped_values, group_labels.begin(), group_offsets.begin(), false, stream, mr);
+}
+
+std::unique_ptr<column> dense_rank_scan(column_view const& grouped_values,
+                                        device_span<size_type const> group_labels,
+                                        device_span<size_type const> group_offsets,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  return cudf::detail::rank_generator(
+    grouped_values, group_labels.begin(), group_offsets.begin(), true, stream, mr);
+}
+
+std::unique_ptr<column> percent_rank_scan(column_view const& grouped_values,
+                                          device_span<size_type const> group_labels,
+                                          device_span<size_type const> group_offsets,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  auto const ranks = cudf::detail::rank_generator(grouped_values,
+                                                  group_labels.begin(),
+                                                  group_offsets.begin(),
+                                                  false,
+                                                  stream,
+                                                  rmm::mr::get_current_device_resource());
+  auto percent_ranks = make_fixed_width_column(
+    data_type{type_id::FLOAT64}, group_labels.size(), mask_state::UNALLOCATED, stream, mr);
+  if (group_labels.empty()) { return percent_ranks; }
+
+  thrust::transform(rmm::exec_policy(stream),
+                    ranks->view().begin<size_type>(),
+                    ranks->view().end<size_type>(),
+                    group_labels.begin(),
+                    percent_ranks->mutable_view().begin<double>(),
+                    [offsets = group_offsets.data()] __device__(size_type rank, size_type label) {
+                      auto const group_size = offsets[label + 1] - offsets[label];
+                      return group_size == 1 ? 0.0
+                                             : static_cast<double>(rank - 1) / (group_size - 1);
+                    });
+  return percent_ranks;
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
@@ -366,6 +366,75 @@ std::unique_ptr<column> group_collect(column_view const& values,
                                       rmm::cuda_stream_view stream,
                                       rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Internal API to calculate sum of squares of differences from means of each group
+ *
+ * @code{.pseudo}
+ * values       = [2, 1, 4, -1, -2, <NA>, 4, <NA>]
+ * group_labels = [0, 0, 0,  1,  1,    2, 2,    3]
+ * group_means  = [2.333333, -1.5, 4.0, <NA>]
+ *
+ * group_m2     = [4.666666, 0.5, 0.0, <NA>]
+ * @endcode
+ *
+ * @param values Grouped values to compute M2 values from
+ * @param group_means Pre-computed groupwise MEAN
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> group_m2(column_view const& values,
+                                 column_view const& group_means,
+                                 cudf::device_span<size_type const> group_labels,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Internal API to merge grouped `COUNT_VALID`, `MEAN` and `M2` partial states
+ *
+ * @code{.pseudo}
+ * values       = [{2, 1.5, 0.5}, {1, 4.0, 0.0}, {3, -2.0, 2.0}, {0, <NA>, <NA>}]
+ * group_labels = [0,             0,             1,              1]
+ * num_groups   = 2
+ *
+ * group_merge_m2 = [{3, 2.333333, 4.666666}, {3, -2.0, 2.0}]
+ * @endcode
+ *
+ * @param values Grouped structs column of `[COUNT_VALID (INT32), MEAN (FLOAT64), M2 (FLOAT64)]`
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param num_groups Number of groups
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> group_merge_m2(column_view const& values,
+                                       cudf::device_span<size_type const> group_labels,
+                                       size_type num_groups,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Internal API to concatenate the grouped lists of each group into one list
+ *
+ * @code{.pseudo}
+ * values        = [[2, 1], [], [4], [-1, -2], [<NA>, 4], [<NA>]]
+ * group_offsets = [0,             3,        4,              6]
+ * num_groups    = 3
+ *
+ * group_merge_lists = [[2, 1, 4], [-1, -2], [<NA>, 4, <NA>]]
+ * @endcode
+ *
+ * @param values Grouped lists column without nulls to merge
+ * @param group_offsets Offsets of groups' starting points within @p values
+ * @param num_groups Number of groups
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> group_merge_lists(column_view const& values,
+                                          cudf::device_span<size_type const> group_offsets,
+                                          size_type num_groups,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr);
+
 /** @endinternal
  *
  */
@@ -83,6 +83,60 @@ std::unique_ptr<column> max_scan(column_view const& values,
 std::unique_ptr<column> count_scan(cudf::device_span<size_type const> group_labels,
                                    rmm::cuda_stream_view stream,
                                    rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Internal API to calculate groupwise rank
+ *
+ * Each run of equal values within a group gets the 1-based position of its first row in the group.
+ *
+ * @param grouped_values Grouped and presorted values to rank
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param group_offsets Offsets of the first row of each group, followed by the number of rows
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Column of type INT32 of ranks
+ */
+std::unique_ptr<column> rank_scan(column_view const& grouped_values,
+                                  cudf::device_span<size_type const> group_labels,
+                                  cudf::device_span<size_type const> group_offsets,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Internal API to calculate groupwise dense rank
+ *
+ * Each run of equal values within a group increments the rank by one.
+ *
+ * @param grouped_values Grouped and presorted values to rank
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param group_offsets Offsets of the first row of each group, followed by the number of rows
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Column of type INT32 of dense ranks
+ */
+std::unique_ptr<column> dense_rank_scan(column_view const& grouped_values,
+                                        cudf::device_span<size_type const> group_labels,
+                                        cudf::device_span<size_type const> group_offsets,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Internal API to calculate groupwise percent rank
+ *
+ * The percent rank is `(rank - 1) / (group size - 1)`, or 0 for a group of one row.
+ *
+ * @param grouped_values Grouped and presorted values to rank
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param group_offsets Offsets of the first row of each group, followed by the number of rows
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Column of type FLOAT64 of percent ranks
+ */
+std::unique_ptr<column> percent_rank_scan(column_view const& grouped_values,
+                                          cudf::device_span<size_type const> group_labels,
+                                          cudf::device_span<size_type const> group_offsets,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr);
 }  // namespace detail
 }  // namespace groupby
 }  // namespace cudf
@@ -106,6 +106,48 @@ void scan_result_functor::operator()<aggregation::COUNT_ALL>(aggregation const&
 
   cache.add_result(col_idx, agg, detail::count_scan(helper.group_labels(stream), stream, mr));
 }
+
+template <>
+void scan_result_functor::operator()<aggregation::RANK>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  cache.add_result(col_idx,
+                   agg,
+                   detail::rank_scan(get_grouped_values(),
+                                    helper.group_labels(stream),
+                                    helper.group_offsets(stream),
+                                    stream,
+                                    mr));
+}
+
+template <>
+void scan_result_functor::operator()<aggregation::DENSE_RANK>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  cache.add_result(col_idx,
+                   agg,
+                   detail::dense_rank_scan(get_grouped_values(),
+                                          helper.group_labels(stream),
+                                          helper.group_offsets(stream),
+                                          stream,
+                                          mr));
+}
+
+template <>
+void scan_result_functor::operator()<aggregation::PERCENT_RANK>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  cache.add_result(col_idx,
+                   agg,
+                   detail::percent_rank_scan(get_grouped_values(),
+                                            helper.group_labels(stream),
+                                            helper.group_offsets(stream),
+                                            stream,
+                                            mr));
+}
 }  // namespace detail
 
 // Sort-based groupby
@@ -74,6 +74,8 @@ std::unique_ptr<column> hash(table_view const& input,
       return serial_murmur_hash3_32<MurmurHash3_32>(input, seed, stream, mr);
     case (hash_id::HASH_SPARK_MURMUR3):
       return serial_murmur_hash3_32<SparkMurmurHash3_32>(input, seed, stream, mr);
+    case (hash_id::HASH_XXHASH64): return hash_64<XXHash_64>(input, seed, stream, mr);
+    case (hash_id::HASH_MURMUR3_64): return hash_64<MurmurHash3_64>(input, seed, stream, mr);
     default: return nullptr;
   }
 }
@@ -196,6 +198,82 @@ std::unique_ptr<column> serial_murmur_hash3_32(table_view const& input,
   return output;
 }
 
+/**
+ * @brief Hashes an element with the 64-bit `hash_function` seeded with the hash of the previous
+ * elements of its row, leaving the hash unchanged for nulls.
+ */
+template <template <typename> class hash_function, bool has_nulls>
+struct element_hasher_64 {
+  uint64_t seed;
+
+  template <typename T, CUDF_ENABLE_IF(column_device_view::has_element_accessor<T>())>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row_index) const
+  {
+    if (has_nulls && col.is_null(row_index)) { return seed; }
+    return hash_function<T>{seed}(col.element<T>(row_index));
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>())>
+  __device__ uint64_t operator()(column_device_view const&, size_type) const
+  {
+    cudf_assert(false && "Unsupported type in hash.");
+    return seed;
+  }
+};
+
+/**
+ * @brief Hashes the elements of a row from left to right with the 64-bit `hash_function`.
+ */
+template <template <typename> class hash_function, bool has_nulls>
+struct row_hasher_64 {
+  table_device_view input;
+  uint64_t seed;
+
+  __device__ uint64_t operator()(size_type row_index) const
+  {
+    uint64_t hash = seed;
+    for (auto const& column : input) {
+      hash = cudf::type_dispatcher(
+        column.type(), element_hasher_64<hash_function, has_nulls>{hash}, column, row_index);
+    }
+    return hash;
+  }
+};
+
+template <template <typename> class hash_function>
+std::unique_ptr<column> hash_64(table_view const& input,
+                                uint64_t seed,
+                                rmm::cuda_stream_view stream,
+                                rmm::mr::device_memory_resource* mr)
+{
+  auto output = make_numeric_column(
+    data_type(type_id::UINT64), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
+
+  if (input.num_columns() == 0 || input.num_rows() == 0) { return output; }
+
+  table_view const leaf_table(to_leaf_columns(input.begin(), input.end()));
+  CUDF_EXPECTS(std::none_of(leaf_table.begin(),
+                            leaf_table.end(),
+                            [](auto const& col) { return col.type().id() == type_id::LIST; }),
+               "64-bit hashing of list columns is not supported");
+  auto const device_input = table_device_view::create(leaf_table, stream);
+  auto output_view        = output->mutable_view();
+
+  if (has_nulls(leaf_table)) {
+    thrust::tabulate(rmm::exec_policy(stream),
+                     output_view.begin<uint64_t>(),
+                     output_view.end<uint64_t>(),
+                     row_hasher_64<hash_function, true>{*device_input, seed});
+  } else {
+    thrust::tabulate(rmm::exec_policy(stream),
+                     output_view.begin<uint64_t>(),
+                     output_view.end<uint64_t>(),
+                     row_hasher_64<hash_function, false>{*device_input, seed});
+  }
+
+  return output;
+}
+
 std::unique_ptr<column> murmur_hash3_32(table_view const& input,
                                         std::vector<uint32_t> const& initial_hash,
                                         rmm::cuda_stream_view stream,
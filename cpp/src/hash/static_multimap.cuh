@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <thrust/fill.h>
+
+#include <cooperative_groups.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Returns the smallest prime number that is not less than `n`.
+ */
+inline size_t next_prime(size_t n)
+{
+  auto const is_prime = [](size_t value) {
+    if (value < 2) { return false; }
+    for (size_t divisor = 2; divisor * divisor <= value; ++divisor) {
+      if (value % divisor == 0) { return false; }
+    }
+    return true;
+  };
+  while (not is_prime(n)) {
+    ++n;
+  }
+  return n;
+}
+
+/**
+ * @brief A fixed-capacity, open addressing hash multimap probed by cooperative groups.
+ *
+ * The slots are split into windows of `CGSize * VectorWidth` consecutive slots. A key is looked up
+ * by a tile of `CGSize` threads that loads one window at a time, each thread reading
+ * `VectorWidth` adjacent slots with a single vector load, and walks a double hashing sequence of
+ * windows until it reaches a window with an empty slot. All pairs with equal keys are therefore
+ * found in the windows visited before the first empty slot, and a probe touches far fewer cache
+ * lines than a thread probing one slot at a time, even for keys with many duplicates.
+ *
+ * The map is built once and probed any number of times. Pairs cannot be erased.
+ *
+ * @note A slot whose key is `EmptyKey` is empty, so inserting `EmptyKey` results in undefined
+ * behavior.
+ *
+ * @tparam Key Key type; the map does not hash the keys, which must already be well distributed
+ * @tparam Value Mapped type
+ * @tparam EmptyKey Sentinel key of empty slots
+ * @tparam EmptyValue Sentinel value of empty slots
+ * @tparam CGSize Number of threads that probe a key together
+ * @tparam VectorWidth Number of slots each thread loads per window
+ */
+template <typename Key,
+          typename Value,
+          Key EmptyKey,
+          Value EmptyValue,
+          int CGSize      = 2,
+          int VectorWidth = 2>
+class static_multimap {
+  static_assert(sizeof(Key) + sizeof(Value) == sizeof(unsigned long long),
+                "A key-value pair must fit in a single 64-bit atomic");
+
+ public:
+  static constexpr int cg_size      = CGSize;
+  static constexpr int vector_width = VectorWidth;
+  static constexpr int window_size  = CGSize * VectorWidth;
+
+  using key_type    = Key;
+  using mapped_type = Value;
+
+  struct alignas(sizeof(unsigned long long)) slot_type {
+    Key first;
+    Value second;
+  };
+
+ private:
+  /**
+   * @brief The slots of a window read by one thread of the tile.
+   */
+  struct alignas(sizeof(slot_type) * VectorWidth) lane_slots {
+    slot_type slots[VectorWidth];
+  };
+  static_assert(sizeof(lane_slots) <= 16, "Per-thread window slice must fit in one vector load");
+
+  class device_view_base {
+   public:
+    __host__ __device__ static constexpr Key get_empty_key_sentinel() { return EmptyKey; }
+
+    /**
+     * @brief Returns the first window of the probe sequence of `key`.
+     */
+    __device__ size_t initial_window(Key key) const
+    {
+      return static_cast<size_t>(key) % _num_windows;
+    }
+
+    /**
+     * @brief Returns the window that follows `window` in the probe sequence of `key`.
+     *
+     * The step is derived from a second hash of the key. As the number of windows is prime, the
+     * sequence visits every window.
+     */
+    __device__ size_t next_window(size_t window, Key key) const
+    {
+      auto h = static_cast<uint32_t>(key);
+      h ^= h >> 16;
+      h *= 0x85ebca6b;
+      h ^= h >> 13;
+      h *= 0xc2b2ae35;
+      h ^= h >> 16;
+      return (window + 1 + h % (_num_windows - 1)) % _num_windows;
+    }
+
+    /**
+     * @brief Loads the slots of `window` that belong to the calling thread of `tile`.
+     */
+    template <typename Tile>
+    __device__ void load_window(Tile const& tile,
+                                size_t window,
+                                slot_type (&slots)[VectorWidth]) const
+    {
+      auto const loaded = *reinterpret_cast<lane_slots const*>(
+        _slots + window * window_size + tile.thread_rank() * VectorWidth);
+#pragma unroll
+      for (int i = 0; i < VectorWidth; ++i) {
+        slots[i] = loaded.slots[i];
+      }
+    }
+
+   protected:
+    device_view_base(slot_type* slots, size_t num_windows)
+      : _slots{slots}, _num_windows{num_windows}
+    {
+    }
+
+    slot_type* _slots;
+    size_t _num_windows;
+  };
+
+ public:
+  /**
+   * @brief Non-owning view used to insert pairs into the map from device code.
+   */
+  class device_mutable_view : public device_view_base {
+   public:
+    device_mutable_view(slot_type* slots, size_t num_windows)
+      : device_view_base{slots, num_windows}
+    {
+    }
+
+    /**
+     * @brief Inserts a pair into the map.
+     *
+     * Must be called by all threads of `tile` with the same pair.
+     *
+     * @return `true` if the pair was inserted, `false` if the map is full
+     */
+    template <typename Tile>
+    __device__ bool insert(Tile const& tile, Key key, Value value)
+    {
+      auto window = this->initial_window(key);
+      for (size_t attempt = 0; attempt < this->_num_windows;) {
+        slot_type slots[VectorWidth];
+        this->load_window(tile, window, slots);
+
+        int empty_slot = -1;
+#pragma unroll
+        for (int i = VectorWidth - 1; i >= 0; --i) {
+          if (slots[i].first == EmptyKey) { empty_slot = i; }
+        }
+        auto const empty_lanes = tile.ballot(empty_slot >= 0);
+        if (empty_lanes == 0) {
+          window = this->next_window(window, key);
+          ++attempt;
+          continue;
+        }
+
+        // The first thread that saw an empty slot claims it for the whole tile
+        auto const leader = __ffs(empty_lanes) - 1;
+        bool inserted     = false;
+        if (static_cast<int>(tile.thread_rank()) == leader) {
+          auto* slot = this->_slots + window * window_size + leader * VectorWidth + empty_slot;
+          auto const expected = pack(slot_type{EmptyKey, EmptyValue});
+          inserted = atomicCAS(reinterpret_cast<unsigned long long*>(slot),
+                               expected,
+                               pack(slot_type{key, value})) == expected;
+        }
+        if (tile.shfl(inserted, leader)) { return true; }
+        // Another tile took the slot first; look at the same window again
+      }
+      return false;
+    }
+
+   private:
+    __device__ static unsigned long long pack(slot_type slot)
+    {
+      unsigned long long packed;
+      memcpy(&packed, &slot, sizeof(packed));
+      return packed;
+    }
+  };
+
+  /**
+   * @brief Non-owning view used to probe the map from device code.
+   */
+  class device_view : public device_view_base {
+   public:
+    device_view(slot_type const* slots, size_t num_windows)
+      : device_view_base{const_cast<slot_type*>(slots), num_windows}
+    {
+    }
+
+    /**
+     * @brief Probes a single window for `key`.
+     *
+     * Must be called by all threads of `tile` with the same key and window. Each thread calls
+     * `on_match` with the value of every slot it loaded whose key equals `key`. Unless the probe
+     * sequence ends at this window, `window` is advanced to the next window to probe.
+     *
+     * @return `true` if the window holds an empty slot, i.e. there are no more matches for `key`
+     */
+    template <typename Tile, typename Callback>
+    __device__ bool probe_window(Tile const& tile,
+                                 size_t& window,
+                                 Key key,
+                                 Callback&& on_match) const
+    {
+      slot_type slots[VectorWidth];
+      this->load_window(tile, window, slots);
+
+      bool has_empty_slot = false;
+#pragma unroll
+      for (int i = 0; i < VectorWidth; ++i) {
+        if (slots[i].first == EmptyKey) {
+          has_empty_slot = true;
+        } else if (slots[i].first == key) {
+          on_match(slots[i].second);
+        }
+      }
+      if (tile.any(has_empty_slot)) { return true; }
+      window = this->next_window(window, key);
+      return false;
+    }
+  };
+
+  /**
+   * @brief Constructs a map with room for at least `capacity` pairs.
+   *
+   * The map always keeps at least one slot empty, which ends every probe sequence, so at most
+   * `capacity` pairs may be inserted.
+   *
+   * @param capacity The number of pairs the map must be able to hold
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the slots
+   */
+  static_multimap(size_t capacity,
+                  rmm::cuda_stream_view stream,
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+    : _num_windows{next_prime(std::max<size_t>(2, capacity / window_size + 1))},
+      _slots(_num_windows * window_size, stream, mr)
+  {
+    thrust::fill(rmm::exec_policy(stream),
+                 _slots.begin(),
+                 _slots.end(),
+                 slot_type{EmptyKey, EmptyValue});
+  }
+
+  static_multimap(static_multimap const&) = delete;
+  static_multimap& operator=(static_multimap const&) = delete;
+
+  /**
+   * @brief Returns the number of slots in the map.
+   */
+  size_t capacity() const noexcept { return _slots.size(); }
+
+  device_mutable_view get_device_mutable_view() noexcept
+  {
+    return device_mutable_view{_slots.data(), _num_windows};
+  }
+
+  device_view get_device_view() const noexcept { return device_view{_slots.data(), _num_windows}; }
+
+ private:
+  size_t _num_windows;
+  rmm::device_uvector<slot_type> _slots;
+};
+
+}  // namespace detail
+}  // namespace cudf
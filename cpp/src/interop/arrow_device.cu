@@ -0,0 +1,484 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/interop.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/interop.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <string>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the Arrow format string of a cudf type
+ */
+std::string arrow_format(data_type type)
+{
+  switch (type.id()) {
+    case type_id::INT8: return "c";
+    case type_id::INT16: return "s";
+    case type_id::INT32: return "i";
+    case type_id::INT64: return "l";
+    case type_id::UINT8: return "C";
+    case type_id::UINT16: return "S";
+    case type_id::UINT32: return "I";
+    case type_id::UINT64: return "L";
+    case type_id::FLOAT32: return "f";
+    case type_id::FLOAT64: return "g";
+    case type_id::BOOL8: return "b";
+    case type_id::TIMESTAMP_DAYS: return "tdD";
+    case type_id::TIMESTAMP_SECONDS: return "tss:";
+    case type_id::TIMESTAMP_MILLISECONDS: return "tsm:";
+    case type_id::TIMESTAMP_MICROSECONDS: return "tsu:";
+    case type_id::TIMESTAMP_NANOSECONDS: return "tsn:";
+    case type_id::DURATION_SECONDS: return "tDs";
+    case type_id::DURATION_MILLISECONDS: return "tDm";
+    case type_id::DURATION_MICROSECONDS: return "tDu";
+    case type_id::DURATION_NANOSECONDS: return "tDn";
+    case type_id::STRING: return "u";
+    case type_id::LIST: return "+l";
+    case type_id::STRUCT: return "+s";
+    default: CUDF_FAIL("Unsupported type for the Arrow device interface");
+  }
+}
+
+/**
+ * @brief Returns the cudf type of an Arrow format string
+ */
+data_type cudf_type(std::string const& format)
+{
+  // timestamps may carry a time zone after the ':', which cudf has no use for
+  auto const prefix = format.substr(0, std::min<std::size_t>(format.size(), 4));
+  if (prefix == "tss:") return data_type{type_id::TIMESTAMP_SECONDS};
+  if (prefix == "tsm:") return data_type{type_id::TIMESTAMP_MILLISECONDS};
+  if (prefix == "tsu:") return data_type{type_id::TIMESTAMP_MICROSECONDS};
+  if (prefix == "tsn:") return data_type{type_id::TIMESTAMP_NANOSECONDS};
+  if (format == "c") return data_type{type_id::INT8};
+  if (format == "s") return data_type{type_id::INT16};
+  if (format == "i") return data_type{type_id::INT32};
+  if (format == "l") return data_type{type_id::INT64};
+  if (format == "C") return data_type{type_id::UINT8};
+  if (format == "S") return data_type{type_id::UINT16};
+  if (format == "I") return data_type{type_id::UINT32};
+  if (format == "L") return data_type{type_id::UINT64};
+  if (format == "f") return data_type{type_id::FLOAT32};
+  if (format == "g") return data_type{type_id::FLOAT64};
+  if (format == "b") return data_type{type_id::BOOL8};
+  if (format == "tdD") return data_type{type_id::TIMESTAMP_DAYS};
+  if (format == "tDs") return data_type{type_id::DURATION_SECONDS};
+  if (format == "tDm") return data_type{type_id::DURATION_MILLISECONDS};
+  if (format == "tDu") return data_type{type_id::DURATION_MICROSECONDS};
+  if (format == "tDn") return data_type{type_id::DURATION_NANOSECONDS};
+  if (format == "u") return data_type{type_id::STRING};
+  if (format == "+l") return data_type{type_id::LIST};
+  if (format == "+s") return data_type{type_id::STRUCT};
+  CUDF_FAIL("Unsupported Arrow format for the Arrow device interface: " + format);
+}
+
+/**
+ * @brief Owns the strings and children of an exported `ArrowSchema`
+ */
+struct schema_private {
+  std::string format;
+  std::string name;
+  std::vector<std::unique_ptr<ArrowSchema>> children;
+  std::vector<ArrowSchema*> child_pointers;
+};
+
+void release_schema(ArrowSchema* schema)
+{
+  auto priv = static_cast<schema_private*>(schema->private_data);
+  for (auto child : priv->child_pointers) {
+    if (child->release != nullptr) { child->release(child); }
+  }
+  delete priv;
+  schema->release = nullptr;
+}
+
+void fill_schema(ArrowSchema* out,
+                 std::string const& format,
+                 std::string const& name,
+                 bool nullable,
+                 std::vector<std::unique_ptr<ArrowSchema>>&& children)
+{
+  auto priv = new schema_private{format, name, std::move(children), {}};
+  for (auto& child : priv->children) {
+    priv->child_pointers.push_back(child.get());
+  }
+  *out              = ArrowSchema{};
+  out->format       = priv->format.c_str();
+  out->name         = priv->name.c_str();
+  out->flags        = nullable ? ARROW_FLAG_NULLABLE : 0;
+  out->n_children   = static_cast<int64_t>(priv->child_pointers.size());
+  out->children     = priv->child_pointers.data();
+  out->release      = release_schema;
+  out->private_data = priv;
+}
+
+std::unique_ptr<ArrowSchema> column_schema(column_view const& col, column_metadata const& metadata)
+{
+  auto const format = arrow_format(col.type());
+  std::vector<std::unique_ptr<ArrowSchema>> children;
+  if (col.type().id() == type_id::LIST) {
+    // as in to_arrow, the metadata of a list holds the names of its offsets and child
+    auto const child_meta = metadata.children_meta.size() > 1 ? metadata.children_meta[1]
+                                                              : column_metadata{};
+    children.push_back(
+      column_schema(col.child(lists_column_view::child_column_index), child_meta));
+  } else if (col.type().id() == type_id::STRUCT) {
+    for (size_type i = 0; i < col.num_children(); ++i) {
+      auto const child_meta = static_cast<std::size_t>(i) < metadata.children_meta.size()
+                                ? metadata.children_meta[i]
+                                : column_metadata{};
+      children.push_back(column_schema(col.child(i), child_meta));
+    }
+  }
+  auto result = std::make_unique<ArrowSchema>();
+  fill_schema(result.get(), format, metadata.name, col.nullable(), std::move(children));
+  return result;
+}
+
+/**
+ * @brief The device memory shared by all the arrays of one export
+ *
+ * It is freed when the last of the arrays is released, which may be a child that the consumer
+ * moved out of its parent.
+ */
+struct export_owner {
+  std::unique_ptr<table> input;
+  std::vector<rmm::device_buffer> converted;  // BOOL8 data and masks, offsets of empty strings
+  cudaEvent_t event{nullptr};
+
+  ~export_owner()
+  {
+    if (event != nullptr) { cudaEventDestroy(event); }
+  }
+};
+
+/**
+ * @brief Owns the buffer pointers and children of an exported `ArrowArray`
+ */
+struct array_private {
+  std::shared_ptr<export_owner> owner;
+  std::vector<void const*> buffers;
+  std::vector<std::unique_ptr<ArrowArray>> children;
+  std::vector<ArrowArray*> child_pointers;
+};
+
+void release_array(ArrowArray* array)
+{
+  auto priv = static_cast<array_private*>(array->private_data);
+  for (auto child : priv->child_pointers) {
+    if (child->release != nullptr) { child->release(child); }
+  }
+  delete priv;
+  array->release = nullptr;
+}
+
+void release_device_array(ArrowDeviceArray* array)
+{
+  if (array->array.release != nullptr) { array->array.release(&array->array); }
+  delete array;
+}
+
+void check_supported(column_view const& col)
+{
+  arrow_format(col.type());
+  std::for_each(col.child_begin(), col.child_end(), check_supported);
+}
+
+std::unique_ptr<ArrowArray> export_column(column_view const& col,
+                                          std::shared_ptr<export_owner> const& owner,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  void const* mask = col.nullable() ? col.null_mask() : nullptr;
+  auto offset      = static_cast<int64_t>(col.offset());
+  std::vector<void const*> buffers;
+  std::vector<std::unique_ptr<ArrowArray>> children;
+  switch (col.type().id()) {
+    case type_id::BOOL8: {
+      // Arrow stores booleans as bits, so both the data and the mask start at the first row
+      auto const data = col.data<bool>();
+      auto bits       = detail::valid_if(thrust::make_counting_iterator<size_type>(0),
+                                         thrust::make_counting_iterator<size_type>(col.size()),
+                                         [data] __device__(size_type i) { return data[i]; },
+                                         stream,
+                                         mr);
+      owner->converted.push_back(std::move(bits.first));
+      buffers.push_back(owner->converted.back().data());
+      if (mask != nullptr) {
+        owner->converted.push_back(detail::copy_bitmask(col, stream, mr));
+        mask = owner->converted.back().data();
+      }
+      offset = 0;
+      break;
+    }
+    case type_id::STRING: {
+      if (col.num_children() == 0) {
+        // an empty strings column has no offsets, which Arrow requires even for no rows
+        owner->converted.emplace_back(sizeof(size_type), stream, mr);
+        CUDA_TRY(cudaMemsetAsync(
+          owner->converted.back().data(), 0, sizeof(size_type), stream.value()));
+        buffers = {owner->converted.back().data(), nullptr};
+      } else {
+        buffers = {col.child(strings_column_view::offsets_column_index).head(),
+                   col.child(strings_column_view::chars_column_index).head()};
+      }
+      break;
+    }
+    case type_id::LIST: {
+      CUDF_EXPECTS(col.num_children() == 2, "Lists column must have offsets and a child");
+      buffers.push_back(col.child(lists_column_view::offsets_column_index).head());
+      children.push_back(
+        export_column(col.child(lists_column_view::child_column_index), owner, stream, mr));
+      break;
+    }
+    case type_id::STRUCT: {
+      for (size_type i = 0; i < col.num_children(); ++i) {
+        children.push_back(export_column(col.child(i), owner, stream, mr));
+      }
+      break;
+    }
+    default: buffers.push_back(col.head());
+  }
+  buffers.insert(buffers.begin(), mask);
+
+  auto priv = new array_private{owner, std::move(buffers), std::move(children), {}};
+  for (auto& child : priv->children) {
+    priv->child_pointers.push_back(child.get());
+  }
+  auto result          = std::make_unique<ArrowArray>();
+  *result              = ArrowArray{};
+  result->length       = col.size();
+  result->null_count   = col.null_count();
+  result->offset       = offset;
+  result->n_buffers    = static_cast<int64_t>(priv->buffers.size());
+  result->n_children   = static_cast<int64_t>(priv->child_pointers.size());
+  result->buffers      = priv->buffers.data();
+  result->children     = priv->child_pointers.data();
+  result->release      = release_array;
+  result->private_data = priv;
+  return result;
+}
+
+/**
+ * @brief Views an Arrow array as a cudf column, converting the boolean arrays into `converted`
+ */
+column_view import_column(ArrowSchema const* schema,
+                          ArrowArray const* array,
+                          std::vector<std::unique_ptr<column>>& converted,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(schema->dictionary == nullptr, "Arrow dictionary arrays are not supported");
+  auto const type       = cudf_type(schema->format);
+  auto const size       = static_cast<size_type>(array->length);
+  auto const offset     = static_cast<size_type>(array->offset);
+  auto const null_count = array->null_count < 0 ? UNKNOWN_NULL_COUNT
+                                                : static_cast<size_type>(array->null_count);
+  auto const mask = static_cast<bitmask_type const*>(array->buffers[0]);
+
+  switch (type.id()) {
+    case type_id::BOOL8: {
+      auto const bits = static_cast<bitmask_type const*>(array->buffers[1]);
+      auto result = make_numeric_column(type, size, mask_state::UNALLOCATED, stream, mr);
+      thrust::transform(rmm::exec_policy(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(size),
+                        result->mutable_view().begin<bool>(),
+                        [bits, offset] __device__(size_type i) {
+                          return bit_is_set(bits, offset + i);
+                        });
+      if (mask != nullptr) {
+        result->set_null_mask(
+          detail::copy_bitmask(mask, offset, offset + size, stream, mr), null_count);
+      }
+      converted.push_back(std::move(result));
+      return converted.back()->view();
+    }
+    case type_id::STRING: {
+      if (size == 0) { return column_view{type, 0, nullptr}; }
+      auto const offsets = static_cast<size_type const*>(array->buffers[1]);
+      // the last offset is the number of characters the rows reach
+      size_type num_chars{0};
+      CUDA_TRY(cudaMemcpyAsync(&num_chars,
+                               offsets + offset + size,
+                               sizeof(size_type),
+                               cudaMemcpyDefault,
+                               stream.value()));
+      stream.synchronize();
+      column_view offsets_view{data_type{type_id::INT32}, offset + size + 1, offsets};
+      column_view chars_view{data_type{type_id::INT8}, num_chars, array->buffers[2]};
+      return column_view{type, size, nullptr, mask, null_count, offset, {offsets_view, chars_view}};
+    }
+    case type_id::LIST: {
+      auto const offsets = array->buffers[1];
+      column_view offsets_view{
+        data_type{type_id::INT32}, offsets != nullptr ? offset + size + 1 : 0, offsets};
+      auto const child =
+        import_column(schema->children[0], array->children[0], converted, stream, mr);
+      return column_view{type, size, nullptr, mask, null_count, offset, {offsets_view, child}};
+    }
+    case type_id::STRUCT: {
+      std::vector<column_view> children;
+      for (int64_t i = 0; i < array->n_children; ++i) {
+        children.push_back(
+          import_column(schema->children[i], array->children[i], converted, stream, mr));
+      }
+      return column_view{type, size, nullptr, mask, null_count, offset, children};
+    }
+    default: return column_view{type, size, array->buffers[1], mask, null_count, offset};
+  }
+}
+
+}  // namespace
+
+unique_schema_t to_arrow_schema(table_view const& input,
+                                std::vector<column_metadata> const& metadata)
+{
+  CUDF_EXPECTS(metadata.empty() or metadata.size() == static_cast<std::size_t>(input.num_columns()),
+               "columns' metadata should be equal to number of columns in table");
+  std::vector<std::unique_ptr<ArrowSchema>> children;
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    children.push_back(
+      column_schema(input.column(i), metadata.empty() ? column_metadata{} : metadata[i]));
+  }
+  auto result = unique_schema_t(new ArrowSchema{}, [](ArrowSchema* schema) {
+    if (schema->release != nullptr) { schema->release(schema); }
+    delete schema;
+  });
+  fill_schema(result.get(), "+s", "", false, std::move(children));
+  return result;
+}
+
+unique_device_array_t to_arrow_device(table&& input,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  auto owner      = std::make_shared<export_owner>();
+  owner->input    = std::make_unique<table>(std::move(input));
+  auto const view = owner->input->view();
+  // unsupported types are rejected before any array is created, so that none leaks
+  std::for_each(view.begin(), view.end(), check_supported);
+
+  std::vector<std::unique_ptr<ArrowArray>> children;
+  for (auto const& col : view) {
+    children.push_back(export_column(col, owner, stream, mr));
+  }
+  CUDA_TRY(cudaEventCreateWithFlags(&owner->event, cudaEventDisableTiming));
+  CUDA_TRY(cudaEventRecord(owner->event, stream.value()));
+  int device_id{0};
+  CUDA_TRY(cudaGetDevice(&device_id));
+
+  auto priv = new array_private{owner, {nullptr}, std::move(children), {}};
+  for (auto& child : priv->children) {
+    priv->child_pointers.push_back(child.get());
+  }
+  auto result                = unique_device_array_t(new ArrowDeviceArray{}, release_device_array);
+  result->array.length       = view.num_rows();
+  result->array.n_buffers    = 1;
+  result->array.n_children   = static_cast<int64_t>(priv->child_pointers.size());
+  result->array.buffers      = priv->buffers.data();
+  result->array.children     = priv->child_pointers.data();
+  result->array.release      = release_array;
+  result->array.private_data = priv;
+  result->device_id          = device_id;
+  result->device_type        = ARROW_DEVICE_CUDA;
+  result->sync_event         = &owner->event;
+  return result;
+}
+
+std::pair<table_view, std::vector<std::unique_ptr<column>>> from_arrow_device(
+  ArrowSchema const* schema,
+  ArrowDeviceArray const* input,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(schema != nullptr and input != nullptr, "Arrow schema and array must be given");
+  CUDF_EXPECTS(input->device_type == ARROW_DEVICE_CUDA or
+                 input->device_type == ARROW_DEVICE_CUDA_HOST or
+                 input->device_type == ARROW_DEVICE_CUDA_MANAGED,
+               "Arrow device array must be in memory accessible by CUDA");
+  CUDF_EXPECTS(std::string(schema->format) == "+s",
+               "Arrow schema must be a struct of the columns");
+  CUDF_EXPECTS(schema->n_children == input->array.n_children,
+               "Arrow schema and array have different numbers of columns");
+  if (input->sync_event != nullptr) {
+    CUDA_TRY(
+      cudaStreamWaitEvent(stream.value(), *static_cast<cudaEvent_t*>(input->sync_event), 0));
+  }
+
+  std::vector<std::unique_ptr<column>> converted;
+  std::vector<column_view> columns;
+  auto const begin = static_cast<size_type>(input->array.offset);
+  auto const end   = begin + static_cast<size_type>(input->array.length);
+  for (int64_t i = 0; i < input->array.n_children; ++i) {
+    auto const col =
+      import_column(schema->children[i], input->array.children[i], converted, stream, mr);
+    // the offset and length of the struct apply to all of its children
+    columns.push_back(begin == 0 and end == col.size() ? col : detail::slice(col, begin, end));
+  }
+  return {table_view{columns}, std::move(converted)};
+}
+
+}  // namespace detail
+
+unique_schema_t to_arrow_schema(table_view const& input,
+                                std::vector<column_metadata> const& metadata)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_arrow_schema(input, metadata);
+}
+
+unique_device_array_t to_arrow_device(table&& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_arrow_device(std::move(input), rmm::cuda_stream_default, mr);
+}
+
+std::pair<table_view, std::vector<std::unique_ptr<column>>> from_arrow_device(
+  ArrowSchema const* schema, ArrowDeviceArray const* input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::from_arrow_device(schema, input, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -15,6 +15,7 @@
  */
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/interop.hpp>
+#include <cudf/detail/reshape.hpp>
 #include <cudf/lists/list_view.cuh>
 #include <cudf/structs/struct_view.hpp>
 #include <cudf/utilities/error.hpp>
@@ -22,9 +23,13 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+
 #include <dlpack/dlpack.h>
 
 #include <algorithm>
+#include <cstddef>
+#include <limits>
 #include <cudf/utilities/traits.hpp>
 
 namespace cudf {
@@ -112,6 +117,27 @@ DLDataType data_type_to_DLDataType(data_type type)
   return type_dispatcher(type, data_type_to_DLDataType_impl{});
 }
 
+// Returns the DLPack type of the columns of `input`, which must all have the same numeric type
+// and no nulls
+DLDataType table_to_DLDataType(table_view const& input)
+{
+  // Ensure that type is convertible to DLDataType
+  data_type const type    = input.column(0).type();
+  DLDataType const dltype = data_type_to_DLDataType(type);
+
+  // Ensure all columns are the same type
+  CUDF_EXPECTS(
+    std::all_of(input.begin(), input.end(), [type](auto const& col) { return col.type() == type; }),
+    "All columns required to have same data type");
+
+  // Ensure none of the columns have nulls
+  CUDF_EXPECTS(
+    std::none_of(input.begin(), input.end(), [](auto const& col) { return col.has_nulls(); }),
+    "Input required to have null count zero");
+
+  return dltype;
+}
+
 // Context object to own memory allocated for DLManagedTensor
 struct dltensor_context {
   int64_t shape[2];
@@ -204,19 +230,8 @@ DLManagedTensor* to_dlpack(table_view const& input,
   auto const num_cols = input.num_columns();
   if (num_rows == 0) { return nullptr; }
 
-  // Ensure that type is convertible to DLDataType
   data_type const type    = input.column(0).type();
-  DLDataType const dltype = data_type_to_DLDataType(type);
-
-  // Ensure all columns are the same type
-  CUDF_EXPECTS(
-    std::all_of(input.begin(), input.end(), [type](auto const& col) { return col.type() == type; }),
-    "All columns required to have same data type");
-
-  // Ensure none of the columns have nulls
-  CUDF_EXPECTS(
-    std::none_of(input.begin(), input.end(), [](auto const& col) { return col.has_nulls(); }),
-    "Input required to have null count zero");
+  DLDataType const dltype = table_to_DLDataType(input);
 
   auto managed_tensor = std::make_unique<DLManagedTensor>();
   auto context        = std::make_unique<dltensor_context>();
@@ -274,6 +289,70 @@ DLManagedTensor* to_dlpack(table_view const& input,
   return managed_tensor.release();
 }
 
+DLManagedTensor* to_dlpack_view(table_view const& input,
+                                rmm::cuda_stream_view stream,
+                                rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = input.num_rows();
+  auto const num_cols = input.num_columns();
+  if (num_rows == 0) { return nullptr; }
+
+  DLDataType const dltype = table_to_DLDataType(input);
+  auto const width        = static_cast<std::ptrdiff_t>(size_of(input.column(0).type()));
+
+  auto managed_tensor = std::make_unique<DLManagedTensor>();
+  auto context        = std::make_unique<dltensor_context>();
+
+  DLTensor& tensor = managed_tensor->dl_tensor;
+  tensor.dtype     = dltype;
+  tensor.ndim      = (num_cols > 1) ? 2 : 1;
+  tensor.shape     = context->shape;
+  tensor.shape[0]  = num_rows;
+
+  CUDA_TRY(cudaGetDevice(&tensor.ctx.device_id));
+  tensor.ctx.device_type = kDLGPU;
+
+  auto const column_data = [width](column_view const& col) {
+    return static_cast<char const*>(col.head()) + col.offset() * width;
+  };
+  // columns the same distance apart are the columns of one column-major matrix
+  auto const first   = column_data(input.column(0));
+  auto const spacing = (num_cols > 1) ? column_data(input.column(1)) - first : 0;
+  auto const is_matrix =
+    spacing >= num_rows * width and spacing % width == 0 and
+    std::all_of(thrust::make_counting_iterator(0),
+                thrust::make_counting_iterator(num_cols),
+                [&](size_type i) { return column_data(input.column(i)) == first + i * spacing; });
+
+  if (num_cols == 1 or is_matrix) {
+    tensor.data = const_cast<char*>(first);
+    if (tensor.ndim > 1) {
+      tensor.shape[1]   = num_cols;
+      tensor.strides    = context->strides;
+      tensor.strides[0] = 1;
+      tensor.strides[1] = spacing / width;
+    }
+  } else {
+    CUDF_EXPECTS(static_cast<int64_t>(num_rows) * num_cols <= std::numeric_limits<size_type>::max(),
+                 "Interleaved table exceeds size supported by cudf");
+    // the interleaved rows are the rows of a row-major matrix
+    context->buffer   = std::move(*detail::interleave_columns(input, stream, mr)->release().data);
+    tensor.data       = context->buffer.data();
+    tensor.shape[1]   = num_cols;
+    tensor.strides    = context->strides;
+    tensor.strides[0] = num_cols;
+    tensor.strides[1] = 1;
+  }
+
+  managed_tensor->deleter     = dltensor_context::deleter;
+  managed_tensor->manager_ctx = context.release();
+
+  // the consumer may read the tensor on any stream once it is returned
+  stream.synchronize();
+
+  return managed_tensor.release();
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
@@ -287,4 +366,9 @@ DLManagedTensor* to_dlpack(table_view const& input, rmm::mr::device_memory_resou
   return detail::to_dlpack(input, rmm::cuda_stream_default, mr);
 }
 
+DLManagedTensor* to_dlpack_view(table_view const& input, rmm::mr::device_memory_resource* mr)
+{
+  return detail::to_dlpack_view(input, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
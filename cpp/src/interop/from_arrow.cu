@@ -23,6 +23,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/interop.hpp>
 #include <cudf/null_mask.hpp>
@@ -32,10 +33,18 @@
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <io/utilities/pinned_memory_pool.hpp>
+
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 
 #include <thrust/gather.h>
 
+#include <cstring>
+#include <future>
+#include <map>
+#include <utility>
+
 namespace cudf {
 
 namespace detail {
@@ -407,6 +416,102 @@ std::unique_ptr<column> get_column(arrow::Array const& array,
            : get_empty_type_column(array.length());
 }
 
+/**
+ * @brief The host buffers of an Arrow table staged in one device allocation
+ *
+ * Each distinct host buffer is packed into a block of pinned memory, which reaches the device with
+ * a single transfer. `mirror` returns arrays of the same layout whose buffers point into the
+ * device allocation, so that converting them to columns copies only within device memory.
+ */
+class staged_buffers {
+ public:
+  staged_buffers(arrow::Table const& input, rmm::cuda_stream_view stream)
+  {
+    for (auto const& chunked_array : input.columns()) {
+      for (auto const& chunk : chunked_array->chunks()) {
+        collect(*chunk);
+      }
+    }
+    _host = io::detail::pinned_buffer<uint8_t>(_size);
+    for (auto const& [buffer, offset] : _offsets) {
+      std::memcpy(_host.data() + offset, buffer.first, buffer.second);
+    }
+    _device = rmm::device_buffer(_size, stream);
+    CUDA_TRY(cudaMemcpyAsync(
+      _device.data(), _host.data(), _size, cudaMemcpyHostToDevice, stream.value()));
+  }
+
+  /**
+   * @brief Returns `input` with its host buffers replaced by their device copies.
+   */
+  std::shared_ptr<arrow::Table> mirror(arrow::Table const& input) const
+  {
+    std::vector<std::shared_ptr<arrow::ChunkedArray>> columns;
+    for (auto const& chunked_array : input.columns()) {
+      arrow::ArrayVector chunks;
+      for (auto const& chunk : chunked_array->chunks()) {
+        chunks.push_back(mirror(*chunk));
+      }
+      columns.push_back(std::make_shared<arrow::ChunkedArray>(chunks, chunked_array->type()));
+    }
+    return arrow::Table::Make(input.schema(), columns, input.num_rows());
+  }
+
+ private:
+  // buffers are placed at the alignment Arrow allocates them with
+  static constexpr std::size_t alignment = 64;
+
+  static bool is_staged(std::shared_ptr<arrow::Buffer> const& buffer)
+  {
+    return buffer != nullptr and buffer->is_cpu() and buffer->size() > 0;
+  }
+
+  void collect(arrow::Array const& array)
+  {
+    for (auto const& buffer : array.data()->buffers) {
+      if (not is_staged(buffer)) { continue; }
+      auto const key = std::make_pair(buffer->data(), static_cast<std::size_t>(buffer->size()));
+      if (_offsets.emplace(key, _size).second) {
+        _size += cudf::util::round_up_safe(key.second, alignment);
+      }
+    }
+    for (auto const& child : array.data()->child_data) {
+      collect(*arrow::MakeArray(child));
+    }
+    if (array.type_id() == arrow::Type::DICTIONARY) {
+      collect(*static_cast<arrow::DictionaryArray const&>(array).dictionary());
+    }
+  }
+
+  std::shared_ptr<arrow::Array> mirror(arrow::Array const& array) const
+  {
+    auto data = array.data()->Copy();
+    // counted now, since the buffers will no longer be readable on the host
+    data->null_count = array.null_count();
+    for (auto& buffer : data->buffers) {
+      if (not is_staged(buffer)) { continue; }
+      auto const offset = _offsets.at({buffer->data(), static_cast<std::size_t>(buffer->size())});
+      buffer = std::make_shared<arrow::Buffer>(static_cast<uint8_t const*>(_device.data()) + offset,
+                                               buffer->size());
+    }
+    for (auto& child : data->child_data) {
+      child = mirror(*arrow::MakeArray(child))->data();
+    }
+    if (array.type_id() == arrow::Type::DICTIONARY) {
+      auto const& dict_array = static_cast<arrow::DictionaryArray const&>(array);
+      data->type             = dict_array.indices()->type();
+      return std::make_shared<arrow::DictionaryArray>(
+        array.type(), arrow::MakeArray(data), mirror(*dict_array.dictionary()));
+    }
+    return arrow::MakeArray(data);
+  }
+
+  std::map<std::pair<uint8_t const*, std::size_t>, std::size_t> _offsets;
+  std::size_t _size{0};
+  io::detail::pinned_buffer<uint8_t> _host;
+  rmm::device_buffer _device;
+};
+
 }  // namespace
 
 std::unique_ptr<table> from_arrow(arrow::Table const& input_table,
@@ -449,6 +554,22 @@ std::unique_ptr<table> from_arrow(arrow::Table const& input_table,
   return std::make_unique<table>(std::move(columns));
 }
 
+std::future<std::unique_ptr<table>> from_arrow_async(arrow::Table const& input_table,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  int device_id{0};
+  CUDA_TRY(cudaGetDevice(&device_id));
+  return std::async(std::launch::async, [&input_table, stream, mr, device_id]() {
+    CUDA_TRY(cudaSetDevice(device_id));
+    staged_buffers const staged(input_table, stream);
+    auto result = from_arrow(*staged.mirror(input_table), stream, mr);
+    // the staging buffers are released once the columns are built from them
+    stream.synchronize();
+    return result;
+  });
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> from_arrow(arrow::Table const& input_table,
@@ -459,4 +580,12 @@ std::unique_ptr<table> from_arrow(arrow::Table const& input_table,
   return detail::from_arrow(input_table, rmm::cuda_stream_default, mr);
 }
 
+std::future<std::unique_ptr<table>> from_arrow_async(arrow::Table const& input_table,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  return detail::from_arrow_async(input_table, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
@@ -15,6 +15,7 @@
  */
 
 #include "avro.h"
+#include <ctype.h>
 #include <string.h>
 #include <unordered_map>
 
@@ -22,6 +23,31 @@ namespace cudf {
 namespace io {
 namespace avro {
 
+namespace {
+/**
+ * @Brief Returns the index of the entry following the subtree rooted at `idx`
+ */
+size_t next_sibling(const std::vector<schema_entry> &schema, size_t idx)
+{
+  int skip = 1;
+  do {
+    skip += schema[idx].num_children - 1;
+    idx++;
+  } while (skip != 0 && idx < schema.size());
+  return idx;
+}
+
+const std::unordered_map<std::string, type_kind_e> primitive_types = {{"null", type_null},
+                                                                      {"boolean", type_boolean},
+                                                                      {"int", type_int},
+                                                                      {"long", type_long},
+                                                                      {"float", type_float},
+                                                                      {"double", type_double},
+                                                                      {"bytes", type_bytes},
+                                                                      {"string", type_string}};
+
+}  // namespace
+
 template <>
 uint64_t container::get_encoded()
 {
@@ -121,44 +147,36 @@ bool container::parse(file_metadata *md, size_t max_num_rows, size_t first_row)
   md->max_block_size  = max_block_size;
   md->num_rows        = total_object_count;
   md->total_data_size = m_cur - (m_base + md->metadata_size);
-  // Extract columns
-  for (size_t i = 0; i < md->schema.size(); i++) {
-    type_kind_e kind = md->schema[i].kind;
-    if (kind > type_null && kind < type_record) {
-      // Primitive type column
+  // Extract columns: one column for each field of the root record
+  if (!md->schema.empty()) {
+    std::vector<size_t> fields;
+    if (md->schema[0].kind == type_record) {
+      for (size_t i = 1, n = 0; n < static_cast<size_t>(md->schema[0].num_children); n++) {
+        fields.push_back(i);
+        i = next_sibling(md->schema, i);
+      }
+    } else {
+      fields.push_back(0);
+    }
+    for (auto const field : fields) {
       column_desc col;
-      int parent_idx       = md->schema[i].parent_idx;
-      col.schema_data_idx  = (int32_t)i;
-      col.schema_null_idx  = -1;
-      col.parent_union_idx = -1;
-      col.name             = md->schema[i].name;
-      if (parent_idx >= 0) {
-        while (parent_idx >= 0) {
-          if (md->schema[parent_idx].kind == type_union) {
-            std::size_t pos = parent_idx + 1;
-            for (int num_children = md->schema[parent_idx].num_children; num_children > 0;
-                 --num_children) {
-              int skip = 1;
-              if (pos == i) {
-                col.parent_union_idx = md->schema[parent_idx].num_children - num_children;
-              } else if (md->schema[pos].kind == type_null) {
-                col.schema_null_idx = pos;
-                break;
-              }
-              do {
-                skip = skip + md->schema[pos].num_children - 1;
-                pos++;
-              } while (skip != 0);
-            }
+      col.name = md->schema[field].name;
+      if (md->schema[field].kind == type_union) {
+        // Nullable fields are unions of null and the data type
+        for (size_t pos = field + 1, n = 0;
+             n < static_cast<size_t>(md->schema[field].num_children);
+             n++) {
+          if (md->schema[pos].kind == type_null) {
+            if (col.schema_null_idx < 0) { col.schema_null_idx = static_cast<int32_t>(pos); }
+          } else if (col.schema_data_idx < 0) {
+            col.schema_data_idx  = static_cast<int32_t>(pos);
+            col.parent_union_idx = static_cast<int32_t>(n);
           }
-          // Ignore the root or array entries
-          if ((parent_idx != 0 && md->schema[parent_idx].kind != type_array) ||
-              col.name.length() == 0) {
-            if (col.name.length() > 0) { col.name.insert(0, 1, '.'); }
-            col.name.insert(0, md->schema[parent_idx].name);
-          }
-          parent_idx = md->schema[parent_idx].parent_idx;
+          pos = next_sibling(md->schema, pos);
         }
+        if (col.schema_data_idx < 0) { continue; }
+      } else {
+        col.schema_data_idx = static_cast<int32_t>(field);
       }
       md->columns.emplace_back(std::move(col));
     }
@@ -166,27 +184,6 @@ bool container::parse(file_metadata *md, size_t max_num_rows, size_t first_row)
   return true;
 }
 
-/**
- * @brief Parser state
- */
-enum json_state_e {
-  state_attrname = 0,
-  state_attrcolon,
-  state_attrvalue,
-  state_attrvalue_last,
-  state_nextattr,
-  state_nextsymbol,
-};
-
-enum {
-  attrtype_none = -1,
-  attrtype_type = 0,
-  attrtype_name,
-  attrtype_fields,
-  attrtype_symbols,
-  attrtype_items,
-};
-
 /**
  * @Brief AVRO JSON schema parser
  *
@@ -200,159 +197,337 @@ bool schema_parser::parse(std::vector<schema_entry> &schema, const std::string &
   // Empty schema
   if (json_str == "[]") return true;
 
-  char depthbuf[MAX_SCHEMA_DEPTH];
-  int depth = 0, parent_idx = -1, entry_idx = -1;
-  json_state_e state = state_attrname;
-  std::string str;
-  const std::unordered_map<std::string, type_kind_e> typenames = {{"null", type_null},
-                                                                  {"boolean", type_boolean},
-                                                                  {"int", type_int},
-                                                                  {"long", type_long},
-                                                                  {"float", type_float},
-                                                                  {"double", type_double},
-                                                                  {"bytes", type_bytes},
-                                                                  {"string", type_string},
-                                                                  {"record", type_record},
-                                                                  {"enum", type_enum},
-                                                                  {"array", type_array}};
-  const std::unordered_map<std::string, int> attrnames         = {{"type", attrtype_type},
-                                                          {"name", attrtype_name},
-                                                          {"fields", attrtype_fields},
-                                                          {"symbols", attrtype_symbols},
-                                                          {"items", attrtype_items}};
-  int cur_attr                                                 = attrtype_none;
-  m_base                                                       = json_str.c_str();
-  m_cur                                                        = m_base;
-  m_end                                                        = m_base + json_str.length();
-  while (more_data()) {
-    int c = *m_cur++;
-    switch (c) {
-      case '"':
-        str = get_str();
-        // printf("str: \"%s\" (cur_attr=%d, state=%d)\n", str.c_str(), cur_attr, state);
-        if (state == state_attrname && cur_attr == attrtype_none &&
-            typenames.find(str) != typenames.end()) {
-          cur_attr = attrtype_type;
-          state    = state_attrvalue_last;
-        }
-        if (state == state_attrname) {
-          auto t   = attrnames.find(str);
-          cur_attr = (t == attrnames.end()) ? attrtype_none : t->second;
-          state    = state_attrcolon;
-        } else if (state == state_attrvalue || state == state_attrvalue_last) {
-          if (entry_idx < 0) {
-            entry_idx = static_cast<int>(schema.size());
-            schema.emplace_back(type_not_set, parent_idx);
-            if (parent_idx >= 0) { schema[parent_idx].num_children++; }
-          }
-          if (cur_attr == attrtype_type) {
-            auto t = typenames.find(str);
-            if (t == typenames.end()) return false;
-            schema[entry_idx].kind = t->second;
-          } else if (cur_attr == attrtype_name) {
-            if (entry_idx < 0) return false;
-            schema[entry_idx].name = std::move(str);
-          }
-          if (state == state_attrvalue_last) { entry_idx = -1; }
-          state    = state_nextattr;
-          cur_attr = attrtype_none;
-        } else if (state == state_nextsymbol) {
-          if (entry_idx < 0) return false;
-          schema[entry_idx].symbols.emplace_back(std::move(str));
-        }
-        break;
-      case ':':
-        if (state != state_attrcolon) return false;
-        state = state_attrvalue;
-        break;
-      case ',':
-        if (state != state_nextsymbol) {
-          if (state != state_nextattr) return false;
-          state = state_attrname;
-        }
-        break;
-      case '{':
-        if (state == state_attrvalue && cur_attr == attrtype_type) {
-          if (entry_idx < 0) {
-            entry_idx = static_cast<int>(schema.size());
-            schema.emplace_back(type_record, parent_idx);
-            if (parent_idx >= 0) { schema[parent_idx].num_children++; }
-          }
-          cur_attr = attrtype_none;
-          state    = state_attrname;
-        } else if (state == state_attrvalue && cur_attr == attrtype_items && entry_idx >= 0) {
-          // Treat array as a one-field record
-          parent_idx = entry_idx;
-          entry_idx  = -1;
-          cur_attr   = attrtype_none;
-          state      = state_attrname;
-        }
-        if (depth >= MAX_SCHEMA_DEPTH || state != state_attrname) { return false; }
-        depthbuf[depth++] = '{';
-        break;
-      case '}':
-        if (depth == 0 || state != state_nextattr || depthbuf[depth - 1] != '{') return false;
-        --depth;
-        if (entry_idx < 0) {
-          parent_idx = (parent_idx >= 0) ? schema[parent_idx].parent_idx : -1;
-        } else {
-          entry_idx = -1;
-        }
-        break;
-      case '[':
-        if (state == state_attrname && cur_attr == attrtype_none) {
-          cur_attr = attrtype_type;
-          state    = state_attrvalue;
-        }
-        if (depth >= MAX_SCHEMA_DEPTH || state != state_attrvalue) { return false; }
-        depthbuf[depth++] = '[';
-        if (cur_attr == attrtype_symbols) {
-          state = state_nextsymbol;
-          break;
-        } else if (cur_attr == attrtype_type) {
-          if (entry_idx < 0 || schema[entry_idx].kind != type_not_set) {
-            entry_idx = static_cast<int>(schema.size());
-            schema.emplace_back(type_union, parent_idx);
-            if (parent_idx >= 0) { schema[parent_idx].num_children++; }
-          } else {
-            schema[entry_idx].kind = type_union;
-          }
-          parent_idx = entry_idx;
-        } else if (cur_attr != attrtype_fields || entry_idx < 0 ||
-                   schema[entry_idx].kind < type_record) {
+  m_base = json_str.c_str();
+  m_cur  = m_base;
+  m_end  = m_base + json_str.length();
+  m_named_types.clear();
+  if (!parse_type(schema, -1, "", 0)) { return false; }
+  skip_whitespace();
+  return !more_data();
+}
+
+/**
+ * @Brief Parse a type definition and append its entries to the schema
+ *
+ * @param schema[in,out] avro schema
+ * @param parent_idx[in] index of the parent entry, negative for the root
+ * @param name[in] name of the field holding the type, if any
+ * @param depth[in] current nesting depth
+ *
+ * @returns true if successful, false if error
+ */
+bool schema_parser::parse_type(std::vector<schema_entry> &schema,
+                               int parent_idx,
+                               const std::string &name,
+                               int depth)
+{
+  if (depth >= MAX_SCHEMA_DEPTH) { return false; }
+  skip_whitespace();
+  if (!more_data()) { return false; }
+  switch (*m_cur++) {
+    case '"': {
+      auto const type_name = get_str();
+      auto const t         = primitive_types.find(type_name);
+      if (t == primitive_types.end()) {
+        return parse_named_type_reference(schema, parent_idx, name, type_name);
+      }
+      schema.emplace_back(t->second, parent_idx);
+      schema.back().name = name;
+      if (parent_idx >= 0) { schema[parent_idx].num_children++; }
+      return true;
+    }
+    case '[': {
+      // Union of the listed types
+      auto const union_idx = static_cast<int>(schema.size());
+      schema.emplace_back(type_union, parent_idx);
+      schema.back().name = name;
+      if (parent_idx >= 0) { schema[parent_idx].num_children++; }
+      skip_whitespace();
+      if (more_data() && *m_cur == ']') {
+        m_cur++;
+        return true;
+      }
+      for (;;) {
+        if (!parse_type(schema, union_idx, "", depth + 1)) { return false; }
+        skip_whitespace();
+        if (!more_data()) { return false; }
+        auto const c = *m_cur++;
+        if (c == ']') { return true; }
+        if (c != ',') { return false; }
+      }
+    }
+    case '{': m_cur--; return parse_object_type(schema, parent_idx, name, depth);
+    default: return false;
+  }
+}
+
+/**
+ * @Brief Parse a type definition given as a JSON object
+ *
+ * @param schema[in,out] avro schema
+ * @param parent_idx[in] index of the parent entry, negative for the root
+ * @param name[in] name of the field holding the type, if any
+ * @param depth[in] current nesting depth
+ *
+ * @returns true if successful, false if error
+ */
+bool schema_parser::parse_object_type(std::vector<schema_entry> &schema,
+                                      int parent_idx,
+                                      const std::string &name,
+                                      int depth)
+{
+  std::map<std::string, const char *> attrs;
+  if (!parse_attributes(attrs, depth)) { return false; }
+  const char *const obj_end = m_cur;
+  // Returns the string value of an attribute, or an empty string if absent
+  auto get_attr_str = [&](const char *attr) {
+    auto const a = attrs.find(attr);
+    if (a == attrs.end() || *a->second != '"') { return std::string{}; }
+    m_cur = a->second + 1;
+    return get_str();
+  };
+
+  auto const type_attr = attrs.find("type");
+  if (type_attr == attrs.end()) { return false; }
+  if (*type_attr->second != '"') {
+    // Nested type definition, such as `{"type": {"type": "record", ...}}` or a union
+    m_cur = type_attr->second;
+    if (!parse_type(schema, parent_idx, name, depth + 1)) { return false; }
+    m_cur = obj_end;
+    return true;
+  }
+
+  auto const type_name = get_attr_str("type");
+  auto const type_ns   = get_attr_str("namespace");
+  auto const own_name  = get_attr_str("name");
+  auto const entry_idx = static_cast<int>(schema.size());
+  auto const prim      = primitive_types.find(type_name);
+  auto add_entry       = [&](type_kind_e kind) {
+    schema.emplace_back(kind, parent_idx);
+    schema.back().name = (name.empty() && parent_idx < 0) ? own_name : name;
+    if (parent_idx >= 0) { schema[parent_idx].num_children++; }
+  };
+
+  if (prim != primitive_types.end()) {
+    // Primitive type with attributes, such as a logical type
+    add_entry(prim->second);
+  } else if (type_name == "record" || type_name == "error") {
+    add_entry(type_record);
+    auto const fields = attrs.find("fields");
+    if (fields == attrs.end()) { return false; }
+    m_cur = fields->second;
+    if (*m_cur++ != '[') { return false; }
+    skip_whitespace();
+    if (more_data() && *m_cur == ']') {
+      m_cur++;
+    } else {
+      for (;;) {
+        skip_whitespace();
+        std::map<std::string, const char *> field_attrs;
+        if (!more_data() || *m_cur != '{' || !parse_attributes(field_attrs, depth + 1)) {
           return false;
-        } else {
-          parent_idx = entry_idx;
         }
-        entry_idx = -1;
-        cur_attr  = attrtype_none;
-        state     = state_attrname;
-        break;
-      case ']':
-        if (depth == 0 || (state != state_nextattr && state != state_nextsymbol) ||
-            depthbuf[depth - 1] != '[')
+        const char *const field_end = m_cur;
+        auto const field_name       = field_attrs.find("name");
+        auto const field_type       = field_attrs.find("type");
+        if (field_name == field_attrs.end() || field_type == field_attrs.end() ||
+            *field_name->second != '"') {
           return false;
-        --depth;
-        if (state == state_nextsymbol) {
-          state = state_nextattr;
-        } else if (parent_idx >= 0) {
-          entry_idx  = parent_idx;
-          parent_idx = schema[parent_idx].parent_idx;
         }
-        break;
-      case ' ':
-      case '\x09':
-      case '\x0d':
-      case '\x0a':
-        // Ignore spaces, tabs and CRLF
-        break;
-      default: return false;
+        m_cur                = field_name->second + 1;
+        auto const field_str = get_str();
+        m_cur                = field_type->second;
+        if (!parse_type(schema, entry_idx, field_str, depth + 1)) { return false; }
+        m_cur = field_end;
+        skip_whitespace();
+        if (!more_data()) { return false; }
+        auto const c = *m_cur++;
+        if (c == ']') { break; }
+        if (c != ',') { return false; }
+      }
+    }
+  } else if (type_name == "enum") {
+    add_entry(type_enum);
+    auto const symbols = attrs.find("symbols");
+    if (symbols == attrs.end()) { return false; }
+    m_cur = symbols->second;
+    if (*m_cur++ != '[') { return false; }
+    for (;;) {
+      skip_whitespace();
+      if (!more_data()) { return false; }
+      auto const c = *m_cur++;
+      if (c == ']') { break; }
+      if (c == ',') { continue; }
+      if (c != '"') { return false; }
+      schema[entry_idx].symbols.emplace_back(get_str());
+    }
+  } else if (type_name == "array") {
+    add_entry(type_array);
+    auto const items = attrs.find("items");
+    if (items == attrs.end()) { return false; }
+    m_cur = items->second;
+    if (!parse_type(schema, entry_idx, "", depth + 1)) { return false; }
+  } else if (type_name == "map") {
+    // Maps are stored as arrays of key-value pairs with implicit string keys
+    add_entry(type_map);
+    schema.emplace_back(type_string, entry_idx);
+    schema.back().name = "key";
+    schema[entry_idx].num_children++;
+    auto const values = attrs.find("values");
+    if (values == attrs.end()) { return false; }
+    m_cur = values->second;
+    if (!parse_type(schema, entry_idx, "value", depth + 1)) { return false; }
+  } else {
+    // `fixed` is not supported; anything else must be a previously defined named type
+    if (type_name == "fixed" ||
+        !parse_named_type_reference(schema, parent_idx, name, type_name)) {
+      return false;
+    }
+  }
+
+  // Records and enums can be referenced by name in the rest of the schema
+  if (!own_name.empty() && (type_name == "record" || type_name == "error" || type_name == "enum")) {
+    auto const range = std::make_pair(static_cast<size_t>(entry_idx), schema.size());
+    m_named_types[own_name] = range;
+    if (!type_ns.empty() && own_name.find('.') == std::string::npos) {
+      m_named_types[type_ns + "." + own_name] = range;
+    }
+  }
+  m_cur = obj_end;
+  return true;
+}
+
+/**
+ * @Brief Parse the attributes of a JSON object, recording the start of each value
+ *
+ * @param attrs[out] position of the value of each attribute
+ * @param depth[in] current nesting depth
+ *
+ * @returns true if successful, false if error
+ */
+bool schema_parser::parse_attributes(std::map<std::string, const char *> &attrs, int depth)
+{
+  if (!more_data() || *m_cur++ != '{') { return false; }
+  skip_whitespace();
+  if (more_data() && *m_cur == '}') {
+    m_cur++;
+    return true;
+  }
+  for (;;) {
+    skip_whitespace();
+    if (!more_data() || *m_cur++ != '"') { return false; }
+    auto key = get_str();
+    skip_whitespace();
+    if (!more_data() || *m_cur++ != ':') { return false; }
+    skip_whitespace();
+    attrs[std::move(key)] = m_cur;
+    if (!skip_value(depth + 1)) { return false; }
+    skip_whitespace();
+    if (!more_data()) { return false; }
+    auto const c = *m_cur++;
+    if (c == '}') { return true; }
+    if (c != ',') { return false; }
+  }
+}
+
+/**
+ * @Brief Duplicate the entries of a previously defined named type
+ *
+ * @param schema[in,out] avro schema
+ * @param parent_idx[in] index of the parent entry, negative for the root
+ * @param name[in] name of the field holding the type, if any
+ * @param type_name[in] name of the referenced type, optionally qualified by its namespace
+ *
+ * @returns true if successful, false if the type is not defined
+ */
+bool schema_parser::parse_named_type_reference(std::vector<schema_entry> &schema,
+                                               int parent_idx,
+                                               const std::string &name,
+                                               const std::string &type_name)
+{
+  auto t = m_named_types.find(type_name);
+  if (t == m_named_types.end()) {
+    auto const pos = type_name.rfind('.');
+    if (pos == std::string::npos) { return false; }
+    t = m_named_types.find(type_name.substr(pos + 1));
+    if (t == m_named_types.end()) { return false; }
+  }
+  auto const first = t->second.first;
+  auto const last  = t->second.second;
+  auto const base  = static_cast<int>(schema.size());
+  for (size_t i = first; i < last; i++) {
+    schema.push_back(schema[i]);
+    auto &entry = schema.back();
+    if (i == first) {
+      entry.parent_idx = parent_idx;
+      entry.name       = name;
+    } else {
+      entry.parent_idx = entry.parent_idx - static_cast<int>(first) + base;
     }
   }
-  // printf("schema (%d entries) = %s\n", (int)schema.size(), m_base);
+  if (parent_idx >= 0) { schema[parent_idx].num_children++; }
   return true;
 }
 
+/**
+ * @Brief Skip a JSON value, including any nested objects or arrays
+ *
+ * @returns true if successful, false if error
+ */
+bool schema_parser::skip_value(int depth)
+{
+  if (depth >= MAX_SCHEMA_DEPTH * 2) { return false; }
+  skip_whitespace();
+  if (!more_data()) { return false; }
+  auto const c = *m_cur;
+  if (c == '"') {
+    m_cur++;
+    get_str();
+    return true;
+  }
+  if (c == '{' || c == '[') {
+    const char close = (c == '{') ? '}' : ']';
+    m_cur++;
+    skip_whitespace();
+    if (more_data() && *m_cur == close) {
+      m_cur++;
+      return true;
+    }
+    for (;;) {
+      if (c == '{') {
+        skip_whitespace();
+        if (!more_data() || *m_cur++ != '"') { return false; }
+        get_str();
+        skip_whitespace();
+        if (!more_data() || *m_cur++ != ':') { return false; }
+      }
+      if (!skip_value(depth + 1)) { return false; }
+      skip_whitespace();
+      if (!more_data()) { return false; }
+      auto const d = *m_cur++;
+      if (d == close) { return true; }
+      if (d != ',') { return false; }
+    }
+  }
+  // Number, boolean or null literal
+  const char *const start = m_cur;
+  while (more_data() && (isalnum(*m_cur) || *m_cur == '-' || *m_cur == '+' || *m_cur == '.')) {
+    m_cur++;
+  }
+  return m_cur != start;
+}
+
+/**
+ * @Brief Skip spaces, tabs and CRLF
+ */
+void schema_parser::skip_whitespace()
+{
+  while (more_data() &&
+         (*m_cur == ' ' || *m_cur == '\x09' || *m_cur == '\x0d' || *m_cur == '\x0a')) {
+    m_cur++;
+  }
+}
+
 /**
  * @Brief Parse a string
  *
@@ -361,13 +536,13 @@ bool schema_parser::parse(std::vector<schema_entry> &schema, const std::string &
 std::string schema_parser::get_str()
 {
   std::string s;
-  const char *start = m_cur;
-  const char *cur   = start;
-  while (cur < m_end && *cur++ != '"')
-    ;
-  int32_t len = static_cast<int32_t>(cur - start - 1);
-  m_cur       = cur;
-  return s.assign(start, std::max(len, 0));
+  while (more_data()) {
+    auto c = *m_cur++;
+    if (c == '"') { break; }
+    if (c == '\\' && more_data()) { c = *m_cur++; }
+    s.push_back(c);
+  }
+  return s;
 }
 
 }  // namespace avro
@@ -75,6 +75,10 @@ struct file_metadata {
 
 /**
  * @Brief Extract AVRO schema from JSON string
+ *
+ * The schema is flattened into a pre-order list of entries, in which each record, union, array
+ * and map entry is followed by the entries of its children. Map entries have two children: the
+ * implicit string key and the value.
  */
 class schema_parser {
  protected:
@@ -87,11 +91,28 @@ class schema_parser {
  protected:
   bool more_data() const { return (m_cur < m_end); }
   std::string get_str();
+  void skip_whitespace();
+  bool skip_value(int depth);
+  bool parse_type(std::vector<schema_entry> &schema,
+                  int parent_idx,
+                  const std::string &name,
+                  int depth);
+  bool parse_object_type(std::vector<schema_entry> &schema,
+                         int parent_idx,
+                         const std::string &name,
+                         int depth);
+  bool parse_attributes(std::map<std::string, const char *> &attrs, int depth);
+  bool parse_named_type_reference(std::vector<schema_entry> &schema,
+                                  int parent_idx,
+                                  const std::string &name,
+                                  const std::string &type_name);
 
  protected:
   const char *m_base;
   const char *m_cur;
   const char *m_end;
+  // Ranges of schema entries of the named types (records and enums) defined so far
+  std::map<std::string, std::pair<size_t, size_t>> m_named_types;
 };
 
 /**
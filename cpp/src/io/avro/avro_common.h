@@ -55,6 +55,7 @@ enum type_kind_e {
   type_record,
   type_union,
   type_array,
+  type_map,
 };
 
 using cudf::io::detail::string_index_pair;
@@ -51,9 +51,22 @@ static inline int64_t __device__ avro_decode_zigzag_varint(const uint8_t *&cur,
   return (int64_t)((u >> 1u) ^ -(int64_t)(u & 1));
 }
 
+/**
+ * @brief State of an array, map or union member being decoded
+ */
+struct nested_frame_s {
+  uint32_t entry;     // schema index of the array, map or union
+  uint32_t end;       // schema index following the items, or the chosen union member
+  size_t parent_pos;  // position of the array or union within its column
+  int64_t remaining;  // number of items left in the current block, negative for unions
+};
+
 /**
  * @brief Decode a row of values given an avro schema
  *
+ * Values within arrays and maps are written at the position of their item, which is taken from
+ * `item_pos`. Without `decode_values`, only the items of the arrays and maps are counted.
+ *
  * @param[in] schema Schema description
  * @param[in] schema_g Global schema in device mem
  * @param[in] schema_len Number of schema entries
@@ -62,6 +75,8 @@ static inline int64_t __device__ avro_decode_zigzag_varint(const uint8_t *&cur,
  * @param[in] cur Current input data pointer
  * @param[in] end End of input data
  * @param[in] global_Dictionary Global dictionary entries
+ * @param[in,out] item_pos Position of the next item of each array and map
+ * @param[in] decode_values Whether to write the decoded values
  *
  * @return data pointer at the end of the row (start of next row)
  */
@@ -72,35 +87,61 @@ static const uint8_t *__device__ avro_decode_row(const schemadesc_s *schema,
                                                  size_t max_rows,
                                                  const uint8_t *cur,
                                                  const uint8_t *end,
-                                                 device_span<string_index_pair> global_dictionary)
+                                                 device_span<string_index_pair> global_dictionary,
+                                                 uint32_t *item_pos,
+                                                 bool decode_values)
 {
-  uint32_t array_start = 0, array_repeat_count = 0;
-  int array_children = 0;
-  for (uint32_t i = 0; i < schema_len;) {
-    uint32_t kind = schema[i].kind;
-    int skip      = 0;
+  nested_frame_s frames[max_nesting_depth];
+  int depth           = 0;
+  bool const in_range = row < max_rows;
+  bool const write    = decode_values && in_range;
+  size_t pos          = row;
+  // Items of rows outside the selected range are not given a position
+  auto next_item_pos = [&](uint32_t array_idx) -> size_t {
+    return (in_range) ? item_pos[array_idx]++ : 0;
+  };
+  auto decode_block_count = [&]() {
+    int64_t count = avro_decode_zigzag_varint(cur, end);
+    if (count < 0) {
+      avro_decode_zigzag_varint(cur, end);  // block size in bytes, ignored
+      count = -count;
+    }
+    return count;
+  };
 
-    if (kind == type_union) {
-      int skip_after;
-      if (cur >= end) break;
-      skip       = (*cur++) >> 1;  // NOTE: Assumes 1-byte union member
-      skip_after = schema[i].count - skip - 1;
-      ++i;
-      while (skip > 0 && i < schema_len) {
-        if (schema[i].kind >= type_record) { skip += schema[i].count; }
-        ++i;
-        --skip;
+  for (uint32_t i = 0;;) {
+    // Move on to the next item or past the end of completed arrays and union members
+    while (depth > 0 && i == frames[depth - 1].end) {
+      auto &frame = frames[depth - 1];
+      if (frame.remaining >= 0) {
+        if (--frame.remaining == 0) {
+          frame.remaining = decode_block_count();
+          if (frame.remaining != 0) {
+            void *sizes = schema[frame.entry].dataptr;
+            if (sizes != nullptr && write) {
+              static_cast<int32_t *>(sizes)[frame.parent_pos] += frame.remaining;
+            }
+          }
+        }
+        if (frame.remaining != 0) {
+          if (cur >= end) { return cur; }
+          pos = next_item_pos(schema[frame.entry].array_idx);
+          i   = frame.entry + 1;
+          break;
+        }
+        pos = frame.parent_pos;
       }
-      if (i >= schema_len || skip_after < 0) break;
-      kind = schema[i].kind;
-      skip = skip_after;
+      i = schema[frame.entry].next_idx;
+      --depth;
     }
+    if (i >= schema_len) break;
 
+    uint32_t kind = schema[i].kind;
     void *dataptr = schema[i].dataptr;
     switch (kind) {
       case type_null:
-        if (dataptr != nullptr && row < max_rows) {
-          atomicAnd(static_cast<uint32_t *>(dataptr) + (row >> 5), ~(1 << (row & 0x1f)));
+        if (dataptr != nullptr && write) {
+          atomicAnd(static_cast<uint32_t *>(dataptr) + (pos >> 5), ~(1 << (pos & 0x1f)));
           atomicAdd(&schema_g[i].count, 1);
         }
         break;
@@ -112,11 +153,11 @@ static const uint8_t *__device__ avro_decode_row(const schemadesc_s *schema,
       case type_enum: {
         int64_t v = avro_decode_zigzag_varint(cur, end);
         if (kind == type_int) {
-          if (dataptr != nullptr && row < max_rows) {
-            static_cast<int32_t *>(dataptr)[row] = static_cast<int32_t>(v);
+          if (dataptr != nullptr && write) {
+            static_cast<int32_t *>(dataptr)[pos] = static_cast<int32_t>(v);
           }
         } else if (kind == type_long) {
-          if (dataptr != nullptr && row < max_rows) { static_cast<int64_t *>(dataptr)[row] = v; }
+          if (dataptr != nullptr && write) { static_cast<int64_t *>(dataptr)[pos] = v; }
         } else {  // string or enum
           size_t count    = 0;
           const char *ptr = 0;
@@ -131,15 +172,15 @@ static const uint8_t *__device__ avro_decode_row(const schemadesc_s *schema,
             count = (size_t)v;
             cur += count;
           }
-          if (dataptr != nullptr && row < max_rows) {
-            static_cast<string_index_pair *>(dataptr)[row].first  = ptr;
-            static_cast<string_index_pair *>(dataptr)[row].second = count;
+          if (dataptr != nullptr && write) {
+            static_cast<string_index_pair *>(dataptr)[pos].first  = ptr;
+            static_cast<string_index_pair *>(dataptr)[pos].second = count;
           }
         }
       } break;
 
       case type_float:
-        if (dataptr != nullptr && row < max_rows) {
+        if (dataptr != nullptr && write) {
           uint32_t v;
           if (cur + 3 < end) {
             v = unaligned_load32(cur);
@@ -147,14 +188,14 @@ static const uint8_t *__device__ avro_decode_row(const schemadesc_s *schema,
           } else {
             v = 0;
           }
-          static_cast<uint32_t *>(dataptr)[row] = v;
+          static_cast<uint32_t *>(dataptr)[pos] = v;
         } else {
           cur += 4;
         }
         break;
 
       case type_double:
-        if (dataptr != nullptr && row < max_rows) {
+        if (dataptr != nullptr && write) {
           uint64_t v;
           if (cur + 7 < end) {
             v = unaligned_load64(cur);
@@ -162,53 +203,51 @@ static const uint8_t *__device__ avro_decode_row(const schemadesc_s *schema,
           } else {
             v = 0;
           }
-          static_cast<uint64_t *>(dataptr)[row] = v;
+          static_cast<uint64_t *>(dataptr)[pos] = v;
         } else {
           cur += 8;
         }
         break;
 
       case type_boolean:
-        if (dataptr != nullptr && row < max_rows) {
+        if (dataptr != nullptr && write) {
           uint8_t v                            = (cur < end) ? *cur : 0;
-          static_cast<uint8_t *>(dataptr)[row] = (v) ? 1 : 0;
+          static_cast<uint8_t *>(dataptr)[pos] = (v) ? 1 : 0;
         }
         cur++;
         break;
 
-      case type_array: {
-        int32_t array_block_count = avro_decode_zigzag_varint(cur, end);
-        if (array_block_count < 0) {
-          avro_decode_zigzag_varint(cur, end);  // block size in bytes, ignored
-          array_block_count = -array_block_count;
+      case type_union: {
+        if (cur >= end || depth >= max_nesting_depth) { return cur; }
+        // Skip to the chosen member, and past the union once the member is decoded
+        int64_t member = avro_decode_zigzag_varint(cur, end);
+        uint32_t idx   = i + 1;
+        for (; member > 0 && idx < schema[i].next_idx; --member) {
+          idx = schema[idx].next_idx;
         }
-        array_start        = i;
-        array_repeat_count = array_block_count;
-        array_children     = 1;
-        if (array_repeat_count == 0) {
-          skip += schema[i].count;  // Should always be 1
+        if (member != 0 || idx >= schema[i].next_idx) { return cur; }
+        frames[depth++] = {i, schema[idx].next_idx, pos, -1};
+        i               = idx;
+        continue;
+      }
+
+      case type_array:
+      case type_map: {
+        int64_t count = decode_block_count();
+        if (count == 0) {
+          i = schema[i].next_idx;
+          continue;
         }
-      } break;
-    }
-    if (array_repeat_count != 0) {
-      array_children--;
-      if (schema[i].kind >= type_record) { array_children += schema[i].count; }
-    }
-    i++;
-    while (skip > 0 && i < schema_len) {
-      if (schema[i].kind >= type_record) { skip += schema[i].count; }
-      ++i;
-      --skip;
-    }
-    // If within an array, check if we reached the last item
-    if (array_repeat_count != 0 && array_children <= 0 && cur < end) {
-      if (!--array_repeat_count) {
-        i = array_start;  // Restart at the array parent
-      } else {
-        i              = array_start + 1;  // Restart after the array parent
-        array_children = schema[array_start].count;
+        if (depth >= max_nesting_depth) { return cur; }
+        if (dataptr != nullptr && write) { static_cast<int32_t *>(dataptr)[pos] += count; }
+        frames[depth++] = {i, schema[i].next_idx, pos, count};
+        pos             = next_item_pos(schema[i].array_idx);
+        i++;
+        continue;
       }
     }
+    // Records have no data of their own, their fields follow
+    i++;
   }
   return cur;
 }
@@ -225,6 +264,9 @@ static const uint8_t *__device__ avro_decode_row(const schemadesc_s *schema,
  * @param[in] min_row_size Minimum size in bytes of a row
  * @param[in] max_rows Maximum number of rows to load
  * @param[in] first_row Crop all rows below first_row
+ * @param[in,out] array_item_pos Position of the next item of each array and map, per block
+ * @param[in] num_arrays Number of arrays and maps in schema
+ * @param[in] decode_values Whether to write values, or only count the items of arrays and maps
  */
 // blockDim {32,num_warps,1}
 extern "C" __global__ void __launch_bounds__(num_warps * 32, 2)
@@ -236,7 +278,10 @@ extern "C" __global__ void __launch_bounds__(num_warps * 32, 2)
                           uint32_t schema_len,
                           uint32_t min_row_size,
                           size_t max_rows,
-                          size_t first_row)
+                          size_t first_row,
+                          uint32_t *array_item_pos,
+                          uint32_t num_arrays,
+                          bool decode_values)
 {
   __shared__ __align__(8) schemadesc_s g_shared_schema[max_shared_schema_len];
   __shared__ __align__(8) block_desc_s blk_g[num_warps];
@@ -261,8 +306,11 @@ extern "C" __global__ void __launch_bounds__(num_warps * 32, 2)
   if (block_id < num_blocks and threadIdx.x == 0) { *blk = blocks[block_id]; }
   __syncthreads();
   if (block_id >= num_blocks) { return; }
-  cur_row        = blk->first_row;
-  rows_remaining = blk->num_rows;
+  // Rows are only decoded in parallel if they have no array items, so that the item positions of
+  // a block are only updated by one thread at a time
+  uint32_t *const item_pos = array_item_pos + static_cast<size_t>(block_id) * num_arrays;
+  cur_row                  = blk->first_row;
+  rows_remaining           = blk->num_rows;
   cur            = avro_data + blk->offset;
   end            = cur + blk->size;
   while (rows_remaining > 0 && cur < end) {
@@ -284,7 +332,9 @@ extern "C" __global__ void __launch_bounds__(num_warps * 32, 2)
                             max_rows,
                             cur,
                             end,
-                            global_dictionary);
+                            global_dictionary,
+                            item_pos,
+                            decode_values);
     }
     if (nrows <= 1) {
       cur = start + shuffle(static_cast<uint32_t>(cur - start));
@@ -309,6 +359,9 @@ extern "C" __global__ void __launch_bounds__(num_warps * 32, 2)
  * @param[in] max_rows Maximum number of rows to load
  * @param[in] first_row Crop all rows below first_row
  * @param[in] min_row_size Minimum size in bytes of a row
+ * @param[in,out] array_item_pos Position of the next item of each array and map, per block
+ * @param[in] num_arrays Number of arrays and maps in schema
+ * @param[in] decode_values Whether to write values, or only count the items of arrays and maps
  * @param[in] stream CUDA stream to use, default 0
  */
 void DecodeAvroColumnData(block_desc_s *blocks,
@@ -320,6 +373,9 @@ void DecodeAvroColumnData(block_desc_s *blocks,
                           size_t max_rows,
                           size_t first_row,
                           uint32_t min_row_size,
+                          uint32_t *array_item_pos,
+                          uint32_t num_arrays,
+                          bool decode_values,
                           rmm::cuda_stream_view stream)
 {
   // num_warps warps per threadblock
@@ -335,7 +391,10 @@ void DecodeAvroColumnData(block_desc_s *blocks,
                                                                       schema_len,
                                                                       min_row_size,
                                                                       max_rows,
-                                                                      first_row);
+                                                                      first_row,
+                                                                      array_item_pos,
+                                                                      num_arrays,
+                                                                      decode_values);
 }
 
 }  // namespace gpu
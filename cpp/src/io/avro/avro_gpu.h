@@ -26,14 +26,22 @@ namespace io {
 namespace avro {
 namespace gpu {
 
+/**
+ * @brief Maximum number of nested arrays, maps and unions within a row
+ */
+constexpr int max_nesting_depth = 16;
+
 /**
  * @brief Struct to describe the avro schema
  */
 struct schemadesc_s {
-  uint32_t kind;   // avro type kind
-  uint32_t count;  // for records/unions: number of following child columns, for nulls: global
-                   // null_count, for enums: dictionary ofs
-  void *dataptr;   // Ptr to column data, or null if column not selected
+  uint32_t kind;       // avro type kind
+  uint32_t count;      // for records/unions: number of following child columns, for nulls: global
+                       // null_count, for enums: dictionary ofs
+  void *dataptr;       // Ptr to column data, or null if column not selected. For arrays and maps,
+                       // ptr to the list sizes, for nulls, ptr to the validity of the union's data
+  uint32_t next_idx;   // index of the entry following the subtree of this entry
+  uint32_t array_idx;  // for arrays and maps: index among all the arrays and maps of the schema
 };
 
 /**
@@ -48,6 +56,9 @@ struct schemadesc_s {
  * @param[in] max_rows Maximum number of rows to load
  * @param[in] first_row Crop all rows below first_row
  * @param[in] min_row_size Minimum size in bytes of a row
+ * @param[in,out] array_item_pos Position of the next item of each array and map, per block
+ * @param[in] num_arrays Number of arrays and maps in schema
+ * @param[in] decode_values Whether to write values, or only count the items of arrays and maps
  * @param[in] stream CUDA stream to use, default 0
  */
 void DecodeAvroColumnData(block_desc_s *blocks,
@@ -59,6 +70,9 @@ void DecodeAvroColumnData(block_desc_s *blocks,
                           size_t max_rows              = ~0,
                           size_t first_row             = 0,
                           uint32_t min_row_size        = 0,
+                          uint32_t *array_item_pos     = nullptr,
+                          uint32_t num_arrays          = 0,
+                          bool decode_values           = true,
                           rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
 }  // namespace gpu
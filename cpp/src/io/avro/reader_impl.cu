@@ -31,6 +31,12 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <limits>
 
 using cudf::device_span;
 
@@ -57,10 +63,223 @@ type_id to_type_id(const avro::schema_entry *col)
     case avro::type_bytes:
     case avro::type_string: return type_id::STRING;
     case avro::type_enum: return (!col->symbols.empty()) ? type_id::STRING : type_id::INT32;
+    case avro::type_record: return type_id::STRUCT;
+    case avro::type_array:
+    case avro::type_map: return type_id::LIST;
     default: return type_id::EMPTY;
   }
 }
 
+/**
+ * @brief Returns the schema indices of the data and null members of a nullable union, or of the
+ * entry itself if it is not a union
+ */
+std::pair<int, int> resolve_union(std::vector<avro::schema_entry> const &schema,
+                                  host_span<gpu::schemadesc_s const> schema_desc,
+                                  int idx)
+{
+  if (schema[idx].kind != avro::type_union) { return {idx, -1}; }
+  int data_idx = -1, null_idx = -1;
+  for (int pos = idx + 1, n = 0; n < schema[idx].num_children; n++) {
+    if (schema[pos].kind == avro::type_null) {
+      if (null_idx < 0) { null_idx = pos; }
+    } else if (data_idx < 0) {
+      data_idx = pos;
+    }
+    pos = schema_desc[pos].next_idx;
+  }
+  return {data_idx, null_idx};
+}
+
+/**
+ * @brief Creates the buffers of a column and of its children, and points the schema entries of
+ * the column at them
+ *
+ * The validity of nullable columns is initialized to all valid, and the schema index of their null
+ * entry is kept in the `user_data` of the buffer.
+ *
+ * @param schema Avro schema
+ * @param schema_desc Schema description to update with the buffer pointers
+ * @param data_idx Schema index of the column data
+ * @param null_idx Schema index of the null member of the union holding the column, or -1
+ * @param name Name of the column
+ * @param size Number of rows of the column
+ * @param array_sizes Total number of items of each array and map
+ */
+column_buffer create_column_buffer(std::vector<avro::schema_entry> const &schema,
+                                   host_span<gpu::schemadesc_s> schema_desc,
+                                   int data_idx,
+                                   int null_idx,
+                                   std::string const &name,
+                                   size_type size,
+                                   std::vector<size_type> const &array_sizes,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource *mr)
+{
+  auto const &entry = schema[data_idx];
+  column_buffer buffer(data_type{to_type_id(&entry)}, null_idx >= 0);
+  buffer.name = name;
+  if (entry.kind == avro::type_array || entry.kind == avro::type_map) {
+    // Item counts are accumulated in the offsets, and scanned once decoded
+    buffer.create(size + 1, stream, mr);
+  } else {
+    buffer.create(size, stream, mr);
+  }
+  schema_desc[data_idx].dataptr = buffer.data();
+  if (null_idx >= 0) {
+    cudf::detail::set_null_mask(buffer.null_mask(), 0, size, true, stream);
+    schema_desc[null_idx].dataptr = buffer.null_mask();
+    buffer.user_data              = static_cast<uint32_t>(null_idx);
+  }
+
+  auto create_child = [&](int idx, std::string const &child_name, size_type child_size) {
+    auto const child = resolve_union(schema, schema_desc, idx);
+    CUDF_EXPECTS(child.first >= 0, "Unsupported data type");
+    return create_column_buffer(schema,
+                                schema_desc,
+                                child.first,
+                                child.second,
+                                child_name,
+                                child_size,
+                                array_sizes,
+                                stream,
+                                mr);
+  };
+  auto const first_child = static_cast<int>(data_idx + 1);
+  switch (entry.kind) {
+    case avro::type_record:
+      for (int pos = first_child, n = 0; n < entry.num_children; n++) {
+        buffer.children.emplace_back(create_child(pos, schema[pos].name, size));
+        pos = schema_desc[pos].next_idx;
+      }
+      break;
+    case avro::type_array:
+      buffer.children.emplace_back(
+        create_child(first_child, "", array_sizes[schema_desc[data_idx].array_idx]));
+      break;
+    case avro::type_map: {
+      // Key-value pairs are a list of structs
+      auto const num_items = array_sizes[schema_desc[data_idx].array_idx];
+      column_buffer pairs(data_type{type_id::STRUCT}, num_items, false, stream, mr);
+      pairs.children.emplace_back(create_child(first_child, "key", num_items));
+      pairs.children.emplace_back(
+        create_child(schema_desc[first_child].next_idx, "value", num_items));
+      buffer.children.emplace_back(std::move(pairs));
+    } break;
+    default: break;
+  }
+  return buffer;
+}
+
+/**
+ * @brief Returns the schema indices of the children of a schema entry
+ */
+std::vector<int> child_indices(std::vector<avro::schema_entry> const &schema, int idx)
+{
+  std::vector<int> children;
+  for (int pos = idx + 1; pos < static_cast<int>(schema.size()) &&
+                          static_cast<int>(children.size()) < schema[idx].num_children;
+       pos++) {
+    if (schema[pos].parent_idx == idx) { children.push_back(pos); }
+  }
+  return children;
+}
+
+/**
+ * @brief Creates the buffers of an empty column and of its children, for a source without data
+ *
+ * @param schema Avro schema
+ * @param data_idx Schema index of the column data
+ * @param is_nullable Whether the column is held in a union with null
+ * @param name Name of the column
+ */
+column_buffer create_empty_column_buffer(std::vector<avro::schema_entry> const &schema,
+                                         int data_idx,
+                                         bool is_nullable,
+                                         std::string const &name,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource *mr)
+{
+  auto const &entry = schema[data_idx];
+  column_buffer buffer(data_type{to_type_id(&entry)}, is_nullable);
+  buffer.name = name;
+  if (entry.kind == avro::type_array || entry.kind == avro::type_map) {
+    // The offsets of an empty list column are a single zero
+    buffer.create(1, stream, mr);
+    CUDA_TRY(cudaMemsetAsync(buffer.data(), 0, sizeof(size_type), stream.value()));
+  } else {
+    buffer.create(0, stream, mr);
+  }
+
+  auto create_child = [&](int idx, std::string const &child_name) {
+    auto child_idx      = idx;
+    bool child_nullable = false;
+    if (schema[idx].kind == avro::type_union) {
+      child_idx = -1;
+      for (auto const member : child_indices(schema, idx)) {
+        if (schema[member].kind == avro::type_null) {
+          child_nullable = true;
+        } else if (child_idx < 0) {
+          child_idx = member;
+        }
+      }
+      CUDF_EXPECTS(child_idx >= 0, "Unsupported data type");
+    }
+    return create_empty_column_buffer(schema, child_idx, child_nullable, child_name, stream, mr);
+  };
+  auto const children = child_indices(schema, data_idx);
+  switch (entry.kind) {
+    case avro::type_record:
+      for (auto const child : children) {
+        buffer.children.emplace_back(create_child(child, schema[child].name));
+      }
+      break;
+    case avro::type_array: buffer.children.emplace_back(create_child(children[0], "")); break;
+    case avro::type_map: {
+      column_buffer pairs(data_type{type_id::STRUCT}, 0, false, stream, mr);
+      pairs.children.emplace_back(create_child(children[0], "key"));
+      pairs.children.emplace_back(create_child(children[1], "value"));
+      buffer.children.emplace_back(std::move(pairs));
+    } break;
+    default: break;
+  }
+  return buffer;
+}
+
+/**
+ * @brief Sets the null counts of a column and its children, and converts the item counts of list
+ * columns to offsets
+ */
+void finalize_column_buffer(column_buffer &buffer,
+                            host_span<gpu::schemadesc_s const> schema_desc,
+                            rmm::cuda_stream_view stream)
+{
+  if (buffer.is_nullable) { buffer.null_count() = schema_desc[buffer.user_data].count; }
+  if (buffer.type.id() == type_id::LIST) {
+    auto const sizes = static_cast<size_type *>(buffer.data());
+    thrust::exclusive_scan(rmm::exec_policy(stream), sizes, sizes + buffer.size, sizes);
+  }
+  for (auto &child : buffer.children) { finalize_column_buffer(child, schema_desc, stream); }
+}
+
+/**
+ * @brief Functor that extracts the uncompressed length from the start of a snappy stream
+ */
+struct snappy_uncompressed_length_fn {
+  __device__ uint32_t operator()(gpu_inflate_input_s const &block) const
+  {
+    // The length is a varint of up to 4 bytes
+    auto const src   = static_cast<uint8_t const *>(block.srcDevice);
+    auto const bytes = block.srcSize < 4 ? static_cast<uint32_t>(block.srcSize) : 4u;
+    uint32_t length  = 0;
+    for (uint32_t i = 0; i < bytes; ++i) {
+      length |= static_cast<uint32_t>(src[i] & 0x7f) << (7 * i);
+      if (src[i] < 0x80) break;
+    }
+    return length;
+  }
+};
+
 }  // namespace
 
 /**
@@ -114,20 +333,9 @@ class metadata : public file_metadata {
       CUDF_EXPECTS(selection.size() > 0, "Filtered out all columns");
     } else {
       for (int i = 0; i < num_avro_columns; ++i) {
-        // Exclude array columns (unsupported)
-        bool column_in_array = false;
-        for (int parent_idx = schema[columns[i].schema_data_idx].parent_idx; parent_idx > 0;
-             parent_idx     = schema[parent_idx].parent_idx) {
-          if (schema[parent_idx].kind == avro::type_array) {
-            column_in_array = true;
-            break;
-          }
-        }
-        if (!column_in_array) {
-          auto col_type = to_type_id(&schema[columns[i].schema_data_idx]);
-          CUDF_EXPECTS(col_type != type_id::EMPTY, "Unsupported data type");
-          selection.emplace_back(i, columns[i].name);
-        }
+        auto col_type = to_type_id(&schema[columns[i].schema_data_idx]);
+        CUDF_EXPECTS(col_type != type_id::EMPTY, "Unsupported data type");
+        selection.emplace_back(i, columns[i].name);
       }
     }
 
@@ -141,43 +349,41 @@ class metadata : public file_metadata {
 rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_block_data,
                                                  rmm::cuda_stream_view stream)
 {
-  size_t uncompressed_data_size = 0;
-  hostdevice_vector<gpu_inflate_input_s> inflate_in(_metadata->block_list.size());
-  hostdevice_vector<gpu_inflate_status_s> inflate_out(_metadata->block_list.size());
+  auto const num_blocks = _metadata->block_list.size();
+  hostdevice_vector<gpu_inflate_input_s> inflate_in(num_blocks);
+  hostdevice_vector<gpu_inflate_status_s> inflate_out(num_blocks);
+
+  const auto base_offset = _metadata->block_list[0].offset;
+  for (size_t i = 0; i < num_blocks; i++) {
+    const auto src_pos      = _metadata->block_list[i].offset - base_offset;
+    inflate_in[i].srcDevice = static_cast<const uint8_t *>(comp_block_data.data()) + src_pos;
+    inflate_in[i].srcSize   = _metadata->block_list[i].size;
+  }
 
   if (_metadata->codec == "deflate") {
     // Guess an initial maximum uncompressed block size
     uint32_t initial_blk_len = (_metadata->max_block_size * 2 + 0xfff) & ~0xfff;
-    uncompressed_data_size   = initial_blk_len * _metadata->block_list.size();
-    for (size_t i = 0; i < inflate_in.size(); ++i) { inflate_in[i].dstSize = initial_blk_len; }
+    for (size_t i = 0; i < num_blocks; ++i) { inflate_in[i].dstSize = initial_blk_len; }
   } else if (_metadata->codec == "snappy") {
-    // Extract the uncompressed length from the snappy stream
-    for (size_t i = 0; i < _metadata->block_list.size(); i++) {
-      const auto buffer  = _source->host_read(_metadata->block_list[i].offset, 4);
-      const uint8_t *blk = buffer->data();
-      uint32_t blk_len   = blk[0];
-      if (blk_len > 0x7f) {
-        blk_len = (blk_len & 0x7f) | (blk[1] << 7);
-        if (blk_len > 0x3fff) {
-          blk_len = (blk_len & 0x3fff) | (blk[2] << 14);
-          if (blk_len > 0x1fffff) { blk_len = (blk_len & 0x1fffff) | (blk[3] << 21); }
-        }
-      }
-      inflate_in[i].dstSize = blk_len;
-      uncompressed_data_size += blk_len;
-    }
+    // Extract the uncompressed length from the snappy stream of all blocks in one pass
+    hostdevice_vector<uint32_t> uncomp_lengths(num_blocks, stream);
+    inflate_in.host_to_device(stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      inflate_in.device_ptr(),
+                      inflate_in.device_ptr() + num_blocks,
+                      uncomp_lengths.device_ptr(),
+                      snappy_uncompressed_length_fn{});
+    uncomp_lengths.device_to_host(stream, true);
+    for (size_t i = 0; i < num_blocks; ++i) { inflate_in[i].dstSize = uncomp_lengths[i]; }
   } else {
     CUDF_FAIL("Unsupported compression codec\n");
   }
 
+  size_t uncompressed_data_size = 0;
+  for (size_t i = 0; i < num_blocks; ++i) { uncompressed_data_size += inflate_in[i].dstSize; }
   rmm::device_buffer decomp_block_data(uncompressed_data_size, stream);
 
-  const auto base_offset = _metadata->block_list[0].offset;
-  for (size_t i = 0, dst_pos = 0; i < _metadata->block_list.size(); i++) {
-    const auto src_pos = _metadata->block_list[i].offset - base_offset;
-
-    inflate_in[i].srcDevice = static_cast<const uint8_t *>(comp_block_data.data()) + src_pos;
-    inflate_in[i].srcSize   = _metadata->block_list[i].size;
+  for (size_t i = 0, dst_pos = 0; i < num_blocks; i++) {
     inflate_in[i].dstDevice = static_cast<uint8_t *>(decomp_block_data.data()) + dst_pos;
 
     // Update blocks offsets & sizes to refer to uncompressed data
@@ -186,75 +392,88 @@ rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_
     dst_pos += _metadata->block_list[i].size;
   }
 
-  for (int loop_cnt = 0; loop_cnt < 2; loop_cnt++) {
-    inflate_in.host_to_device(stream);
-    CUDA_TRY(
-      cudaMemsetAsync(inflate_out.device_ptr(), 0, inflate_out.memory_size(), stream.value()));
+  // Decompresses a batch of blocks with a single launch of the codec kernel
+  auto decompress_blocks = [&](hostdevice_vector<gpu_inflate_input_s> &in,
+                               hostdevice_vector<gpu_inflate_status_s> &out) {
+    in.host_to_device(stream);
+    CUDA_TRY(cudaMemsetAsync(out.device_ptr(), 0, out.memory_size(), stream.value()));
     if (_metadata->codec == "deflate") {
-      CUDA_TRY(gpuinflate(
-        inflate_in.device_ptr(), inflate_out.device_ptr(), inflate_in.size(), 0, stream));
-    } else if (_metadata->codec == "snappy") {
-      CUDA_TRY(
-        gpu_unsnap(inflate_in.device_ptr(), inflate_out.device_ptr(), inflate_in.size(), stream));
+      CUDA_TRY(gpuinflate(in.device_ptr(), out.device_ptr(), in.size(), 0, stream));
     } else {
-      CUDF_FAIL("Unsupported compression codec\n");
+      CUDA_TRY(gpu_unsnap(in.device_ptr(), out.device_ptr(), in.size(), stream));
     }
-    inflate_out.device_to_host(stream, true);
-
-    // Check if larger output is required, as it's not known ahead of time
-    if (_metadata->codec == "deflate" && !loop_cnt) {
-      size_t actual_uncompressed_size = 0;
-      for (size_t i = 0; i < _metadata->block_list.size(); i++) {
-        // If error status is 1 (buffer too small), the `bytes_written` field
-        // is actually contains the uncompressed data size
-        if (inflate_out[i].status == 1 && inflate_out[i].bytes_written > inflate_in[i].dstSize) {
-          inflate_in[i].dstSize = inflate_out[i].bytes_written;
-        }
-        actual_uncompressed_size += inflate_in[i].dstSize;
+    out.device_to_host(stream, true);
+  };
+  decompress_blocks(inflate_in, inflate_out);
+
+  // Check if larger output is required, as it's not known ahead of time
+  if (_metadata->codec == "deflate") {
+    // If error status is 1 (buffer too small), the `bytes_written` field
+    // actually contains the uncompressed data size
+    std::vector<size_t> retry_blocks;
+    size_t retry_data_size = 0;
+    for (size_t i = 0; i < num_blocks; i++) {
+      if (inflate_out[i].status == 1 && inflate_out[i].bytes_written > inflate_in[i].dstSize) {
+        retry_blocks.push_back(i);
+        retry_data_size += inflate_out[i].bytes_written;
       }
-      if (actual_uncompressed_size > uncompressed_data_size) {
-        decomp_block_data.resize(actual_uncompressed_size);
-        for (size_t i = 0, dst_pos = 0; i < _metadata->block_list.size(); i++) {
-          auto dst_base           = static_cast<uint8_t *>(decomp_block_data.data());
-          inflate_in[i].dstDevice = dst_base + dst_pos;
-
-          _metadata->block_list[i].offset = dst_pos;
-          _metadata->block_list[i].size   = static_cast<uint32_t>(inflate_in[i].dstSize);
-          dst_pos += _metadata->block_list[i].size;
-        }
-      } else {
-        break;
+    }
+
+    // Only the blocks that did not fit are decompressed again, into space appended to the output
+    if (!retry_blocks.empty()) {
+      decomp_block_data.resize(uncompressed_data_size + retry_data_size);
+      auto const dst_base = static_cast<uint8_t *>(decomp_block_data.data());
+      for (size_t i = 0; i < num_blocks; i++) {
+        inflate_in[i].dstDevice = dst_base + _metadata->block_list[i].offset;
       }
-    } else {
-      break;
+
+      hostdevice_vector<gpu_inflate_input_s> retry_in(retry_blocks.size());
+      hostdevice_vector<gpu_inflate_status_s> retry_out(retry_blocks.size());
+      for (size_t r = 0, dst_pos = uncompressed_data_size; r < retry_blocks.size(); r++) {
+        auto const i          = retry_blocks[r];
+        retry_in[r]           = inflate_in[i];
+        retry_in[r].dstSize   = inflate_out[i].bytes_written;
+        retry_in[r].dstDevice = dst_base + dst_pos;
+
+        _metadata->block_list[i].offset = dst_pos;
+        _metadata->block_list[i].size   = static_cast<uint32_t>(retry_in[r].dstSize);
+        dst_pos += _metadata->block_list[i].size;
+      }
+      decompress_blocks(retry_in, retry_out);
     }
   }
 
   return decomp_block_data;
 }
 
-void reader::impl::decode_data(const rmm::device_buffer &block_data,
-                               const std::vector<std::pair<uint32_t, uint32_t>> &dict,
-                               device_span<string_index_pair> global_dictionary,
-                               size_t num_rows,
-                               std::vector<std::pair<int, std::string>> selection,
-                               std::vector<column_buffer> &out_buffers,
-                               rmm::cuda_stream_view stream)
+std::vector<column_buffer> reader::impl::decode_data(
+  const rmm::device_buffer &block_data,
+  const std::vector<std::pair<uint32_t, uint32_t>> &dict,
+  device_span<string_index_pair> global_dictionary,
+  size_t num_rows,
+  std::vector<std::pair<int, std::string>> selection,
+  rmm::cuda_stream_view stream)
 {
+  auto const &schema      = _metadata->schema;
+  auto const num_rows_out = static_cast<size_type>(num_rows);
+
   // Build gpu schema
-  hostdevice_vector<gpu::schemadesc_s> schema_desc(_metadata->schema.size());
+  hostdevice_vector<gpu::schemadesc_s> schema_desc(schema.size());
   uint32_t min_row_data_size = 0;
+  uint32_t num_arrays        = 0;
   int skip_field_cnt         = 0;
-  for (size_t i = 0; i < _metadata->schema.size(); i++) {
-    type_kind_e kind = _metadata->schema[i].kind;
+  std::vector<int> nesting_depth(schema.size(), 0);
+  for (size_t i = 0; i < schema.size(); i++) {
+    type_kind_e kind = schema[i].kind;
     if (skip_field_cnt != 0) {
       // Exclude union and array members from min_row_data_size
-      skip_field_cnt += _metadata->schema[i].num_children - 1;
+      skip_field_cnt += schema[i].num_children - 1;
     } else {
       switch (kind) {
         case type_union:
         case type_array:
-          skip_field_cnt = _metadata->schema[i].num_children;
+        case type_map:
+          skip_field_cnt = schema[i].num_children;
           // fall through
         case type_boolean:
         case type_int:
@@ -267,69 +486,107 @@ void reader::impl::decode_data(const rmm::device_buffer &block_data,
         default: break;
       }
     }
-    if (kind == type_enum && !_metadata->schema[i].symbols.size()) { kind = type_int; }
-    schema_desc[i].kind    = kind;
-    schema_desc[i].count   = (kind == type_enum) ? 0 : (uint32_t)_metadata->schema[i].num_children;
-    schema_desc[i].dataptr = nullptr;
-    CUDF_EXPECTS(
-      kind != type_union || _metadata->schema[i].num_children < 2 ||
-        (_metadata->schema[i].num_children == 2 && (_metadata->schema[i + 1].kind == type_null ||
-                                                    _metadata->schema[i + 2].kind == type_null)),
-      "Union with non-null type not currently supported");
-  }
-  std::vector<void *> valid_alias(out_buffers.size(), nullptr);
-  for (size_t i = 0; i < out_buffers.size(); i++) {
-    const auto col_idx  = selection[i].first;
-    int schema_data_idx = _metadata->columns[col_idx].schema_data_idx;
-    int schema_null_idx = _metadata->columns[col_idx].schema_null_idx;
-
-    schema_desc[schema_data_idx].dataptr = out_buffers[i].data();
-    if (schema_null_idx >= 0) {
-      if (!schema_desc[schema_null_idx].dataptr) {
-        schema_desc[schema_null_idx].dataptr = out_buffers[i].null_mask();
-      } else {
-        valid_alias[i] = schema_desc[schema_null_idx].dataptr;
-      }
-    }
-    if (_metadata->schema[schema_data_idx].kind == type_enum) {
-      schema_desc[schema_data_idx].count = dict[i].first;
-    }
-    if (out_buffers[i].null_mask_size()) {
-      cudf::detail::set_null_mask(out_buffers[i].null_mask(), 0, num_rows, true, stream);
+    if (kind == type_enum && !schema[i].symbols.size()) { kind = type_int; }
+    schema_desc[i].kind      = kind;
+    schema_desc[i].count     = (kind == type_enum) ? dict[i].first : schema[i].num_children;
+    schema_desc[i].dataptr   = nullptr;
+    schema_desc[i].array_idx = (kind == type_array || kind == type_map) ? num_arrays++ : 0;
+    CUDF_EXPECTS(kind != type_union || schema[i].num_children < 2 ||
+                   (schema[i].num_children == 2 &&
+                    (schema[i + 1].kind == type_null || schema[i + 2].kind == type_null)),
+                 "Union with non-null type not currently supported");
+
+    // Each array, map and union nests the decoding of its children one level deeper
+    auto const nests = (kind == type_union || kind == type_array || kind == type_map) ? 1 : 0;
+    if (schema[i].parent_idx >= 0) {
+      auto const parent_kind = schema[schema[i].parent_idx].kind;
+      nesting_depth[i] =
+        nesting_depth[schema[i].parent_idx] +
+        ((parent_kind == type_union || parent_kind == type_array || parent_kind == type_map) ? 1
+                                                                                              : 0);
     }
+    CUDF_EXPECTS(nesting_depth[i] + nests <= gpu::max_nesting_depth,
+                 "Schema nesting is too deep");
+  }
+  // Children follow their parent, so the end of each subtree is found from the last entry back
+  for (size_t i = schema.size(); i-- > 0;) {
+    auto next = static_cast<uint32_t>(i + 1);
+    for (int n = 0; n < schema[i].num_children; n++) { next = schema_desc[next].next_idx; }
+    schema_desc[i].next_idx = next;
   }
+
   rmm::device_buffer block_list(
     _metadata->block_list.data(), _metadata->block_list.size() * sizeof(block_desc_s), stream);
+  auto const num_blocks = static_cast<uint32_t>(_metadata->block_list.size());
+
+  // Count the items of arrays and maps in each block, to get the position of the first item of
+  // each block and the size of the columns holding the items
+  std::vector<size_type> array_sizes(num_arrays, 0);
+  hostdevice_vector<uint32_t> array_item_pos(num_blocks * num_arrays, stream);
+  if (num_arrays > 0) {
+    schema_desc.host_to_device(stream);
+    CUDA_TRY(cudaMemsetAsync(
+      array_item_pos.device_ptr(), 0, array_item_pos.memory_size(), stream.value()));
+    gpu::DecodeAvroColumnData(static_cast<block_desc_s *>(block_list.data()),
+                              schema_desc.device_ptr(),
+                              global_dictionary,
+                              static_cast<const uint8_t *>(block_data.data()),
+                              num_blocks,
+                              static_cast<uint32_t>(schema_desc.size()),
+                              _metadata->num_rows,
+                              _metadata->skip_rows,
+                              min_row_data_size,
+                              array_item_pos.device_ptr(),
+                              num_arrays,
+                              false,
+                              stream);
+    array_item_pos.device_to_host(stream, true);
+    for (uint32_t a = 0; a < num_arrays; a++) {
+      size_t total = 0;
+      for (uint32_t b = 0; b < num_blocks; b++) {
+        auto const count                  = array_item_pos[b * num_arrays + a];
+        array_item_pos[b * num_arrays + a] = static_cast<uint32_t>(total);
+        total += count;
+      }
+      CUDF_EXPECTS(total <= static_cast<size_t>(std::numeric_limits<size_type>::max()),
+                   "Number of list items exceeds the column size limit");
+      array_sizes[a] = static_cast<size_type>(total);
+    }
+    array_item_pos.host_to_device(stream);
+  }
+
+  std::vector<column_buffer> out_buffers;
+  for (auto const &col : selection) {
+    auto const &col_desc = _metadata->columns[col.first];
+    out_buffers.emplace_back(create_column_buffer(schema,
+                                                  schema_desc,
+                                                  col_desc.schema_data_idx,
+                                                  col_desc.schema_null_idx,
+                                                  col.second,
+                                                  num_rows_out,
+                                                  array_sizes,
+                                                  stream,
+                                                  _mr));
+  }
   schema_desc.host_to_device(stream);
 
   gpu::DecodeAvroColumnData(static_cast<block_desc_s *>(block_list.data()),
                             schema_desc.device_ptr(),
                             global_dictionary,
                             static_cast<const uint8_t *>(block_data.data()),
-                            static_cast<uint32_t>(_metadata->block_list.size()),
+                            num_blocks,
                             static_cast<uint32_t>(schema_desc.size()),
                             _metadata->num_rows,
                             _metadata->skip_rows,
                             min_row_data_size,
+                            array_item_pos.device_ptr(),
+                            num_arrays,
+                            true,
                             stream);
-
-  // Copy valid bits that are shared between columns
-  for (size_t i = 0; i < out_buffers.size(); i++) {
-    if (valid_alias[i] != nullptr) {
-      CUDA_TRY(cudaMemcpyAsync(out_buffers[i].null_mask(),
-                               valid_alias[i],
-                               out_buffers[i].null_mask_size(),
-                               cudaMemcpyHostToDevice,
-                               stream.value()));
-    }
-  }
   schema_desc.device_to_host(stream, true);
 
-  for (size_t i = 0; i < out_buffers.size(); i++) {
-    const auto col_idx          = selection[i].first;
-    const auto schema_null_idx  = _metadata->columns[col_idx].schema_null_idx;
-    out_buffers[i].null_count() = (schema_null_idx >= 0) ? schema_desc[schema_null_idx].count : 0;
-  }
+  for (auto &buffer : out_buffers) { finalize_column_buffer(buffer, schema_desc, stream); }
+  return out_buffers;
 }
 
 reader::impl::impl(std::unique_ptr<datasource> source,
@@ -356,14 +613,10 @@ table_with_metadata reader::impl::read(avro_reader_options const &options,
   // Select only columns required by the options
   auto selected_columns = _metadata->select_columns(_columns);
   if (selected_columns.size() != 0) {
-    // Get a list of column data types
-    std::vector<data_type> column_types;
+    // Check the column data types
     for (const auto &col : selected_columns) {
       auto &col_schema = _metadata->schema[_metadata->columns[col.first].schema_data_idx];
-
-      auto col_type = to_type_id(&col_schema);
-      CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
-      column_types.emplace_back(col_type);
+      CUDF_EXPECTS(to_type_id(&col_schema) != type_id::EMPTY, "Unknown type");
     }
 
     if (_metadata->total_data_size > 0) {
@@ -391,16 +644,16 @@ table_with_metadata reader::impl::read(avro_reader_options const &options,
         }
       }
 
+      // Dictionary of the symbols of all the enums in the schema
+      auto const &schema              = _metadata->schema;
       size_t total_dictionary_entries = 0;
       size_t dictionary_data_size     = 0;
-      std::vector<std::pair<uint32_t, uint32_t>> dict(column_types.size());
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        auto col_idx     = selected_columns[i].first;
-        auto &col_schema = _metadata->schema[_metadata->columns[col_idx].schema_data_idx];
-        dict[i].first    = static_cast<uint32_t>(total_dictionary_entries);
-        dict[i].second   = static_cast<uint32_t>(col_schema.symbols.size());
+      std::vector<std::pair<uint32_t, uint32_t>> dict(schema.size());
+      for (size_t i = 0; i < schema.size(); ++i) {
+        dict[i].first  = static_cast<uint32_t>(total_dictionary_entries);
+        dict[i].second = static_cast<uint32_t>(schema[i].symbols.size());
         total_dictionary_entries += dict[i].second;
-        for (const auto &sym : col_schema.symbols) { dictionary_data_size += sym.length(); }
+        for (const auto &sym : schema[i].symbols) { dictionary_data_size += sym.length(); }
       }
 
       rmm::device_uvector<string_index_pair> d_global_dict(total_dictionary_entries, stream);
@@ -409,12 +662,10 @@ table_with_metadata reader::impl::read(avro_reader_options const &options,
         std::vector<string_index_pair> h_global_dict(total_dictionary_entries);
         std::vector<char> h_global_dict_data(dictionary_data_size);
         size_t dict_pos = 0;
-        for (size_t i = 0; i < column_types.size(); ++i) {
-          auto const col_idx     = selected_columns[i].first;
-          auto const &col_schema = _metadata->schema[_metadata->columns[col_idx].schema_data_idx];
-          auto const col_dict_entries = &(h_global_dict[dict[i].first]);
+        for (size_t i = 0; i < schema.size(); ++i) {
+          auto const col_dict_entries = h_global_dict.data() + dict[i].first;
           for (size_t j = 0; j < dict[i].second; j++) {
-            auto const &symbols = col_schema.symbols[j];
+            auto const &symbols = schema[i].symbols[j];
 
             auto const data_dst        = h_global_dict_data.data() + dict_pos;
             auto const len             = symbols.length();
@@ -439,22 +690,27 @@ table_with_metadata reader::impl::read(avro_reader_options const &options,
         stream.synchronize();
       }
 
-      std::vector<column_buffer> out_buffers;
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        auto col_idx     = selected_columns[i].first;
-        bool is_nullable = (_metadata->columns[col_idx].schema_null_idx >= 0);
-        out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, _mr);
-      }
-
-      decode_data(block_data, dict, d_global_dict, num_rows, selected_columns, out_buffers, stream);
+      auto out_buffers =
+        decode_data(block_data, dict, d_global_dict, num_rows, selected_columns, stream);
 
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(make_column(out_buffers[i], nullptr, stream, _mr));
+      for (auto &buffer : out_buffers) {
+        metadata_out.schema_info.emplace_back();
+        out_columns.emplace_back(
+          make_column(buffer, &metadata_out.schema_info.back(), stream, _mr));
       }
     } else {
-      // Create empty columns
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(make_empty_column(column_types[i]));
+      // Create empty columns, with the children of nested types
+      for (auto const &col : selected_columns) {
+        auto const &col_desc = _metadata->columns[col.first];
+        auto buffer          = create_empty_column_buffer(_metadata->schema,
+                                                 col_desc.schema_data_idx,
+                                                 col_desc.schema_null_idx >= 0,
+                                                 col.second,
+                                                 stream,
+                                                 _mr);
+        metadata_out.schema_info.emplace_back();
+        out_columns.emplace_back(
+          make_column(buffer, &metadata_out.schema_info.back(), stream, _mr));
       }
     }
   }
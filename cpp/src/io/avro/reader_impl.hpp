@@ -90,18 +90,20 @@ class reader::impl {
    * @brief Convert the avro row-based block data and outputs to columns
    *
    * @param block_data Uncompressed block data
-   * @param dict Dictionary entries
+   * @param dict Offset and number of the dictionary entries of each schema entry
    * @param global_dictionary Dictionary allocation
-   * @param out_buffers Output columns' device buffers
+   * @param num_rows Number of rows to output
+   * @param columns Selected columns and their names
    * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Device buffers of the selected columns, including the buffers of nested columns
    */
-  void decode_data(const rmm::device_buffer &block_data,
-                   const std::vector<std::pair<uint32_t, uint32_t>> &dict,
-                   cudf::device_span<string_index_pair> global_dictionary,
-                   size_t num_rows,
-                   std::vector<std::pair<int, std::string>> columns,
-                   std::vector<column_buffer> &out_buffers,
-                   rmm::cuda_stream_view stream);
+  std::vector<column_buffer> decode_data(const rmm::device_buffer &block_data,
+                                         const std::vector<std::pair<uint32_t, uint32_t>> &dict,
+                                         cudf::device_span<string_index_pair> global_dictionary,
+                                         size_t num_rows,
+                                         std::vector<std::pair<int, std::string>> columns,
+                                         rmm::cuda_stream_view stream);
 
  private:
   rmm::mr::device_memory_resource *_mr = nullptr;
@@ -81,6 +81,10 @@ For more information on these sources, see the manual.
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
 #include <vector>
 #include "io_uncomp.h"
 #include "unbz2.h"
@@ -592,5 +596,144 @@ int32_t cpu_bz2_uncompress(
   return ret;
 }
 
+namespace {
+// Bits used by the "BZh1".."BZh9" stream header
+constexpr uint64_t bz2_stream_header_bits = 32;
+// Maximum number of blocks decoded ahead of the stream position, per thread
+constexpr size_t bz2_blocks_per_thread = 4;
+
+/**
+ * @brief Result of decoding one block at a candidate bit offset
+ */
+struct bz2_block_result {
+  uint64_t bit_offs;       // Bit offset of the block signature
+  uint64_t next_bit_offs;  // Bit offset of the following block
+  int32_t status;          // BZ_OK if followed by another block, BZ_STREAM_END if last
+  std::vector<uint8_t> data;
+};
+
+/**
+ * @brief Decodes the single block starting at `r.bit_offs`, sizing `r.data` to its output
+ */
+void bz2_decode_block_at(unbz_state_s &s,
+                         const uint8_t *source,
+                         size_t sourceLen,
+                         bz2_block_result &r)
+{
+  s.base   = source;
+  s.end    = source + sourceLen - 4;
+  s.cur    = source + (size_t)(r.bit_offs >> 3);
+  s.bitpos = (uint32_t)(r.bit_offs & 7);
+  if (s.cur + 8 > s.end) {
+    r.status = BZ_PARAM_ERROR;
+    return;
+  }
+  s.bitbuf = __builtin_bswap64(*reinterpret_cast<const uint64_t *>(s.cur));
+  r.status = bz2_decompress_block(&s);
+  if (r.status != BZ_OK && r.status != BZ_STREAM_END) { return; }
+  r.next_bit_offs = ((s.cur - s.base) << 3) + s.bitpos;
+  // The initial guess leaves room for short runs; retry once with the exact size otherwise
+  r.data.resize(s.save_nblock + s.save_nblock / 4);
+  for (int pass = 0; pass < 2; pass++) {
+    s.out     = r.data.data();
+    s.outend  = s.out + r.data.size();
+    s.outbase = s.out;
+    bzUnRLE(&s);
+    size_t out_len = s.out - s.outbase;
+    r.data.resize(out_len);
+    if (s.out <= s.outend) { break; }
+  }
+}
+
+}  // namespace
+
+int32_t cpu_bz2_uncompress_parallel(const uint8_t *source,
+                                    size_t sourceLen,
+                                    std::vector<char> &dst,
+                                    int num_threads)
+{
+  uint32_t blockSize100k;
+  std::vector<uint64_t> candidates;
+
+  if (source == NULL || sourceLen < 12) return BZ_PARAM_ERROR;
+  if (source[0] != BZ_HDR_B || source[1] != BZ_HDR_Z || source[2] != BZ_HDR_h)
+    return BZ_DATA_ERROR_MAGIC;
+  blockSize100k = source[3] - BZ_HDR_0;
+  if (blockSize100k < 1 || blockSize100k > 9) return BZ_DATA_ERROR_MAGIC;
+
+  // Blocks are not byte-aligned: look for the 48-bit block signature at every bit offset. Some
+  // candidates may be false positives within compressed data; only the blocks that chain from the
+  // stream header are used.
+  {
+    uint64_t window = 0;
+    for (size_t i = 0; i < sourceLen; i++) {
+      window = (window << 8) | source[i];
+      if (i < 7) { continue; }
+      for (uint32_t k = 0; k < 8; k++) {
+        if (((window >> (16 - k)) & 0xffffffffffffull) == 0x314159265359ull) {
+          uint64_t bit_offs = (uint64_t)(i - 7) * 8 + k;
+          if (bit_offs >= bz2_stream_header_bits) { candidates.push_back(bit_offs); }
+        }
+      }
+    }
+  }
+  if (candidates.empty() || candidates[0] != bz2_stream_header_bits) {
+    // A stream without blocks only holds the end-of-stream signature
+    static constexpr uint8_t empty_stream_sig[6] = {0x17, 0x72, 0x45, 0x38, 0x50, 0x90};
+    if (sourceLen >= 10 + 4 && memcmp(source + 4, empty_stream_sig, 6) == 0) {
+      dst.clear();
+      return BZ_OK;
+    }
+    return BZ_DATA_ERROR;
+  }
+
+  if (num_threads <= 0) { num_threads = std::max(1u, std::thread::hardware_concurrency()); }
+  size_t const batch_size = bz2_blocks_per_thread * num_threads;
+  std::vector<unbz_state_s> states(num_threads);
+  for (auto &st : states) {
+    st.blockSize100k = blockSize100k;
+    st.tt.resize(blockSize100k * 100000);
+  }
+
+  dst.clear();
+  uint64_t expected = bz2_stream_header_bits;
+  for (size_t batch_start = 0; batch_start < candidates.size(); batch_start += batch_size) {
+    size_t const batch_end = std::min(candidates.size(), batch_start + batch_size);
+    // Skip candidates that lie inside blocks already decoded
+    if (candidates[batch_end - 1] < expected) { continue; }
+    std::vector<bz2_block_result> results(batch_end - batch_start);
+    std::atomic<size_t> next_result{0};
+    auto worker = [&](unbz_state_s &st) {
+      for (size_t r = next_result++; r < results.size(); r = next_result++) {
+        results[r].bit_offs = candidates[batch_start + r];
+        if (results[r].bit_offs < expected) {
+          results[r].status = BZ_SEQUENCE_ERROR;
+        } else {
+          bz2_decode_block_at(st, source, sourceLen, results[r]);
+        }
+      }
+    };
+    int const batch_threads = std::min<int>(num_threads, results.size());
+    std::vector<std::thread> threads;
+    for (int t = 1; t < batch_threads; t++) {
+      threads.emplace_back(worker, std::ref(states[t]));
+    }
+    worker(states[0]);
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    // Follow the chain of blocks through this batch
+    for (auto &r : results) {
+      if (r.bit_offs != expected) { continue; }
+      if (r.status != BZ_OK && r.status != BZ_STREAM_END) { return r.status; }
+      dst.insert(dst.end(), r.data.begin(), r.data.end());
+      if (r.status == BZ_STREAM_END) { return BZ_OK; }
+      expected = r.next_bit_offs;
+      std::vector<uint8_t>().swap(r.data);
+    }
+  }
+  return BZ_UNEXPECTED_EOF;
+}
+
 }  // namespace io
 }  // namespace cudf
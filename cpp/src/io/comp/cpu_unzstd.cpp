@@ -0,0 +1,595 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file cpu_unzstd.cpp
+ * @brief Host Zstandard decompression (RFC 8878), used for ORC metadata
+ */
+
+#include "unzstd.h"
+#include "zstd_tables.h"
+
+#include <string.h>  // memcpy, memset
+
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace {
+struct fse_entry {
+  uint16_t base;
+  uint8_t symbol;
+  uint8_t nbits;
+};
+
+inline uint32_t load_le16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+
+inline uint32_t load_le32(const uint8_t *p) { return load_le16(p) | (load_le16(p + 2) << 16); }
+
+inline int highest_bit(uint32_t v) { return (v) ? 31 - __builtin_clz(v) : -1; }
+
+/**
+ * @brief Backward bitstream reader
+ */
+class backward_bit_reader {
+ public:
+  bool init(const uint8_t *base, size_t len)
+  {
+    if (len == 0 || base[len - 1] == 0) { return false; }
+    m_base   = base;
+    m_bitpos = static_cast<int64_t>(len - 1) * 8 + highest_bit(base[len - 1]);
+    return true;
+  }
+  uint32_t read(uint32_t nbits)
+  {
+    uint64_t v = 0;
+    m_bitpos -= nbits;
+    for (uint32_t i = 0; i < nbits; i++) {
+      int64_t pos = m_bitpos + i;
+      if (pos >= 0) { v |= static_cast<uint64_t>((m_base[pos >> 3] >> (pos & 7)) & 1) << i; }
+    }
+    return static_cast<uint32_t>(v);
+  }
+  int64_t bitpos() const { return m_bitpos; }
+
+ private:
+  const uint8_t *m_base = nullptr;
+  int64_t m_bitpos      = 0;
+};
+
+/**
+ * @brief Zstandard frame decoder
+ */
+class zstd_decoder {
+ public:
+  zstd_decoder(uint8_t *dst, size_t dst_len) : m_out(dst), m_out_end(dst + dst_len) {}
+
+  /// Decodes all the frames of the input, returning false on error
+  bool decode(const uint8_t *cur, const uint8_t *end)
+  {
+    if (cur >= end) { return false; }
+    while (cur < end) {
+      uint32_t magic;
+      if (end - cur < 8) { return false; }
+      magic = load_le32(cur);
+      if ((magic & ~0xfu) == zstd_skippable_magic) {
+        uint32_t skip_len = load_le32(cur + 4);
+        if (skip_len > static_cast<size_t>(end - cur - 8)) { return false; }
+        cur += 8 + skip_len;
+        continue;
+      }
+      if (magic != zstd_magic) { return false; }
+      cur = decode_frame(cur + 4, end);
+      if (!cur) { return false; }
+    }
+    return true;
+  }
+
+  size_t bytes_written(uint8_t *dst) const { return m_out - dst; }
+
+ private:
+  const uint8_t *decode_frame(const uint8_t *cur, const uint8_t *end)
+  {
+    uint32_t fhd, dict_len, fcs_len, last_block;
+    uint64_t dict_id = 0;
+    bool has_checksum;
+    if (cur >= end) { return nullptr; }
+    fhd = *cur++;
+    if (fhd & 8) { return nullptr; }
+    if (!(fhd & 0x20)) { cur++; }  // Window descriptor
+    dict_len = (fhd & 3) ? 1 << ((fhd & 3) - 1) : 0;
+    fcs_len  = (fhd >> 6) ? 1 << (fhd >> 6) : (fhd >> 5) & 1;
+    if (cur + dict_len + fcs_len > end) { return nullptr; }
+    for (uint32_t i = 0; i < dict_len; i++) {
+      dict_id |= static_cast<uint64_t>(cur[i]) << (i * 8);
+    }
+    if (dict_id != 0) { return nullptr; }  // Dictionaries are not supported
+    cur += dict_len + fcs_len;
+    has_checksum = (fhd >> 2) & 1;
+    m_frame_out  = m_out;
+    m_rep[0]     = 1;
+    m_rep[1]     = 4;
+    m_rep[2]     = 8;
+    m_huf_valid  = false;
+    m_seq_valid  = 0;
+    do {
+      uint32_t hdr, block_size, block_type;
+      if (end - cur < 3) { return nullptr; }
+      hdr        = cur[0] | (cur[1] << 8) | (cur[2] << 16);
+      last_block = hdr & 1;
+      block_type = (hdr >> 1) & 3;
+      block_size = hdr >> 3;
+      cur += 3;
+      switch (block_type) {
+        case zstd_block_raw:
+          if (block_size > end - cur || block_size > m_out_end - m_out) { return nullptr; }
+          memcpy(m_out, cur, block_size);
+          m_out += block_size;
+          cur += block_size;
+          break;
+        case zstd_block_rle:
+          if (cur >= end || block_size > m_out_end - m_out) { return nullptr; }
+          memset(m_out, *cur++, block_size);
+          m_out += block_size;
+          break;
+        case zstd_block_compressed:
+          if (block_size > end - cur || block_size > zstd_max_block_size ||
+              !decode_block(cur, cur + block_size)) {
+            return nullptr;
+          }
+          cur += block_size;
+          break;
+        default: return nullptr;
+      }
+    } while (!last_block);
+    if (has_checksum) {
+      if (end - cur < 4) { return nullptr; }
+      cur += 4;
+    }
+    return cur;
+  }
+
+  static const uint8_t *parse_fse_header(const uint8_t *cur,
+                                         const uint8_t *end,
+                                         int16_t *norm,
+                                         uint32_t max_symbols,
+                                         uint32_t max_log,
+                                         uint32_t *log,
+                                         uint32_t *num_symbols)
+  {
+    uint32_t bitpos = 0;
+    auto read_bits  = [&](uint32_t nbits) {
+      uint32_t v = 0;
+      for (uint32_t i = 0; i < nbits; i++, bitpos++) {
+        const uint8_t *p = cur + (bitpos >> 3);
+        if (p < end) { v |= ((*p >> (bitpos & 7)) & 1) << i; }
+      }
+      return v;
+    };
+    int32_t remaining;
+    uint32_t sym = 0;
+    *log         = read_bits(4) + 5;
+    if (*log > max_log) { return nullptr; }
+    remaining = (1 << *log) + 1;
+    while (remaining > 1 && sym < max_symbols) {
+      uint32_t nbits      = highest_bit(remaining) + 1;
+      uint32_t lower_mask = (1u << (nbits - 1)) - 1;
+      uint32_t threshold  = (1u << nbits) - 1 - remaining;
+      uint32_t val        = read_bits(nbits - 1);
+      int32_t proba;
+      if (val >= threshold) {
+        val |= read_bits(1) << (nbits - 1);
+        if (val > lower_mask) { val -= threshold; }
+      }
+      proba = static_cast<int32_t>(val) - 1;
+      remaining -= (proba < 0) ? -proba : proba;
+      norm[sym++] = static_cast<int16_t>(proba);
+      if (proba == 0) {
+        uint32_t repeat;
+        do {
+          repeat = read_bits(2);
+          for (uint32_t i = 0; i < repeat && sym < max_symbols; i++) {
+            norm[sym++] = 0;
+          }
+        } while (repeat == 3);
+      }
+    }
+    cur += (bitpos + 7) >> 3;
+    if (remaining != 1 || cur > end) { return nullptr; }
+    *num_symbols = sym;
+    return cur;
+  }
+
+  static bool build_fse_table(fse_entry *table,
+                              const int16_t *norm,
+                              uint32_t num_symbols,
+                              uint32_t log)
+  {
+    uint32_t size           = 1 << log;
+    uint32_t high_threshold = size;
+    uint32_t step           = (size >> 1) + (size >> 3) + 3;
+    uint32_t pos            = 0;
+    uint16_t next_state[zstd_num_ml_codes];
+    for (uint32_t s = 0; s < num_symbols; s++) {
+      if (norm[s] == -1) {
+        table[--high_threshold].symbol = s;
+        next_state[s]                  = 1;
+      }
+    }
+    for (uint32_t s = 0; s < num_symbols; s++) {
+      if (norm[s] <= 0) { continue; }
+      next_state[s] = norm[s];
+      for (int i = 0; i < norm[s]; i++) {
+        table[pos].symbol = s;
+        do {
+          pos = (pos + step) & (size - 1);
+        } while (pos >= high_threshold);
+      }
+    }
+    if (pos != 0) { return false; }
+    for (uint32_t i = 0; i < size; i++) {
+      uint32_t state = next_state[table[i].symbol]++;
+      uint32_t nbits = log - highest_bit(state);
+      table[i].nbits = nbits;
+      table[i].base  = (state << nbits) - size;
+    }
+    return true;
+  }
+
+  const uint8_t *decode_huffman_tree(const uint8_t *cur, const uint8_t *end)
+  {
+    uint8_t weights[256];
+    uint32_t num_weights, weight_sum = 0, max_bits, left_over;
+    uint32_t rank_count[zstd_max_huf_bits + 1] = {0};
+    uint32_t rank_idx[zstd_max_huf_bits + 1];
+    uint32_t hdr;
+    if (cur >= end) { return nullptr; }
+    hdr = *cur++;
+    if (hdr >= 128) {
+      num_weights = hdr - 127;
+      if (cur + ((num_weights + 1) >> 1) > end) { return nullptr; }
+      for (uint32_t i = 0; i < num_weights; i++) {
+        weights[i] = (i & 1) ? cur[i >> 1] & 0xf : cur[i >> 1] >> 4;
+      }
+      cur += (num_weights + 1) >> 1;
+    } else {
+      const uint8_t *hdr_end = cur + hdr;
+      int16_t norm[zstd_max_huf_bits + 1];
+      fse_entry table[1 << zstd_max_huf_weight_log];
+      backward_bit_reader br;
+      uint32_t log, num_symbols, state[2];
+      if (hdr_end > end) { return nullptr; }
+      cur = parse_fse_header(
+        cur, hdr_end, norm, zstd_max_huf_bits + 1, zstd_max_huf_weight_log, &log, &num_symbols);
+      if (!cur || !build_fse_table(table, norm, num_symbols, log) ||
+          !br.init(cur, hdr_end - cur)) {
+        return nullptr;
+      }
+      state[0]    = br.read(log);
+      state[1]    = br.read(log);
+      num_weights = 0;
+      for (uint32_t i = 0;; i ^= 1) {
+        const fse_entry &e     = table[state[i]];
+        weights[num_weights++] = e.symbol;
+        state[i]               = e.base + br.read(e.nbits);
+        if (br.bitpos() < 0) {
+          weights[num_weights++] = table[state[i ^ 1]].symbol;
+          break;
+        }
+        if (num_weights > 253) { return nullptr; }
+      }
+      cur = hdr_end;
+    }
+    for (uint32_t i = 0; i < num_weights; i++) {
+      if (weights[i] > zstd_max_huf_bits) { return nullptr; }
+      weight_sum += (1 << weights[i]) >> 1;
+    }
+    if (weight_sum == 0) { return nullptr; }
+    max_bits  = highest_bit(weight_sum) + 1;
+    left_over = (1 << max_bits) - weight_sum;
+    if (max_bits > zstd_max_huf_bits || (left_over & (left_over - 1)) != 0) { return nullptr; }
+    weights[num_weights++] = highest_bit(left_over) + 1;
+    for (uint32_t i = 0; i < num_weights; i++) {
+      if (weights[i] != 0) { weights[i] = max_bits + 1 - weights[i]; }
+      rank_count[weights[i]]++;
+    }
+    rank_idx[max_bits] = 0;
+    for (uint32_t i = max_bits; i >= 1; i--) {
+      rank_idx[i - 1] = rank_idx[i] + rank_count[i] * (1 << (max_bits - i));
+    }
+    for (uint32_t i = 0; i < num_weights; i++) {
+      uint32_t nbits = weights[i];
+      if (nbits != 0) {
+        uint32_t len = 1 << (max_bits - nbits);
+        for (uint32_t j = 0; j < len; j++) {
+          m_huf_table[rank_idx[nbits] + j] = (i << 4) | nbits;
+        }
+        rank_idx[nbits] += len;
+      }
+    }
+    m_huf_bits = max_bits;
+    return cur;
+  }
+
+  bool decode_huffman_stream(uint8_t *dst, const uint8_t *src, size_t src_len, uint32_t count)
+  {
+    backward_bit_reader br;
+    uint32_t mask = (1 << m_huf_bits) - 1;
+    uint32_t state;
+    if (!br.init(src, src_len)) { return false; }
+    state = br.read(m_huf_bits);
+    for (uint32_t i = 0; i < count; i++) {
+      uint32_t e     = m_huf_table[state];
+      uint32_t nbits = e & 0xf;
+      dst[i]         = static_cast<uint8_t>(e >> 4);
+      state          = ((state << nbits) | br.read(nbits)) & mask;
+    }
+    return br.bitpos() == -static_cast<int64_t>(m_huf_bits);
+  }
+
+  const uint8_t *decode_literals(const uint8_t *cur, const uint8_t *end)
+  {
+    uint32_t b0       = cur[0];
+    uint32_t lit_type = b0 & 3;
+    uint32_t size_fmt = (b0 >> 2) & 3;
+    uint32_t regen_size;
+    if (lit_type == zstd_lit_raw || lit_type == zstd_lit_rle) {
+      uint32_t hdr_len = (size_fmt & 1) ? (size_fmt >> 1) + 2 : 1;
+      if (cur + hdr_len > end) { return nullptr; }
+      regen_size = (hdr_len == 1)   ? b0 >> 3
+                   : (hdr_len == 2) ? (b0 >> 4) + (cur[1] << 4)
+                                    : (b0 >> 4) + (cur[1] << 4) + (cur[2] << 12);
+      cur += hdr_len;
+      if (lit_type == zstd_lit_raw) {
+        if (cur + regen_size > end) { return nullptr; }
+        m_literals.assign(cur, cur + regen_size);
+        cur += regen_size;
+      } else {
+        if (cur >= end) { return nullptr; }
+        m_literals.assign(regen_size, *cur++);
+      }
+    } else {
+      uint32_t hdr_len     = (size_fmt < 2) ? 3 : size_fmt + 2;
+      uint32_t size_len    = (size_fmt < 2) ? 10 : size_fmt * 4 + 6;
+      uint32_t num_streams = (size_fmt == 0) ? 1 : 4;
+      uint64_t hdr         = 0;
+      uint32_t comp_size;
+      const uint8_t *comp_end;
+      if (cur + hdr_len > end) { return nullptr; }
+      for (uint32_t i = 0; i < hdr_len; i++) {
+        hdr |= static_cast<uint64_t>(cur[i]) << (i * 8);
+      }
+      regen_size = static_cast<uint32_t>(hdr >> 4) & ((1u << size_len) - 1);
+      comp_size  = static_cast<uint32_t>(hdr >> (4 + size_len)) & ((1u << size_len) - 1);
+      cur += hdr_len;
+      comp_end = cur + comp_size;
+      if (comp_end > end) { return nullptr; }
+      if (lit_type == zstd_lit_compressed) {
+        cur = decode_huffman_tree(cur, comp_end);
+        if (!cur) { return nullptr; }
+        m_huf_valid = true;
+      } else if (!m_huf_valid) {
+        return nullptr;
+      }
+      m_literals.resize(regen_size);
+      if (num_streams == 1) {
+        if (!decode_huffman_stream(m_literals.data(), cur, comp_end - cur, regen_size)) {
+          return nullptr;
+        }
+      } else {
+        uint32_t seg_len = (regen_size + 3) >> 2;
+        const uint8_t *stream;
+        size_t stream_len[4], total = 6;
+        if (cur + 6 > comp_end || regen_size < seg_len * 3) { return nullptr; }
+        for (uint32_t i = 0; i < 3; i++) {
+          stream_len[i] = load_le16(cur + i * 2);
+          total += stream_len[i];
+        }
+        if (total > static_cast<size_t>(comp_end - cur)) { return nullptr; }
+        stream_len[3] = (comp_end - cur) - total;
+        stream        = cur + 6;
+        for (uint32_t i = 0; i < 4; i++) {
+          uint32_t count = (i < 3) ? seg_len : regen_size - seg_len * 3;
+          uint8_t *dst   = m_literals.data() + seg_len * i;
+          if (!decode_huffman_stream(dst, stream, stream_len[i], count)) {
+            return nullptr;
+          }
+          stream += stream_len[i];
+        }
+      }
+      cur = comp_end;
+    }
+    return cur;
+  }
+
+  const uint8_t *decode_seq_table(const uint8_t *cur,
+                                  const uint8_t *end,
+                                  uint32_t mode,
+                                  fse_entry *table,
+                                  uint32_t *log,
+                                  const int16_t *default_norm,
+                                  uint32_t num_default,
+                                  uint32_t default_log,
+                                  uint32_t max_symbols,
+                                  uint32_t max_log,
+                                  uint32_t table_bit)
+  {
+    int16_t norm[zstd_num_ml_codes];
+    uint32_t num_symbols;
+    switch (mode) {
+      case zstd_seq_predefined:
+        if (!build_fse_table(table, default_norm, num_default, default_log)) { return nullptr; }
+        *log = default_log;
+        break;
+      case zstd_seq_rle:
+        if (cur >= end || *cur >= max_symbols) { return nullptr; }
+        table[0] = {0, *cur++, 0};
+        *log     = 0;
+        break;
+      case zstd_seq_fse:
+        cur = parse_fse_header(cur, end, norm, max_symbols, max_log, log, &num_symbols);
+        if (!cur || !build_fse_table(table, norm, num_symbols, *log)) { return nullptr; }
+        break;
+      default:
+        if (!(m_seq_valid & table_bit)) { return nullptr; }
+        break;
+    }
+    m_seq_valid |= table_bit;
+    return cur;
+  }
+
+  bool decode_block(const uint8_t *cur, const uint8_t *end)
+  {
+    backward_bit_reader br;
+    uint32_t num_seq, modes, ll_state, of_state, ml_state;
+    size_t lit_pos = 0;
+    cur            = decode_literals(cur, end);
+    if (!cur || cur >= end) { return false; }
+    num_seq = *cur++;
+    if (num_seq >= 128) {
+      if (num_seq < 255) {
+        if (cur >= end) { return false; }
+        num_seq = ((num_seq - 128) << 8) + *cur++;
+      } else {
+        if (cur + 2 > end) { return false; }
+        num_seq = load_le16(cur) + 0x7f00;
+        cur += 2;
+      }
+    }
+    if (num_seq != 0) {
+      if (cur >= end) { return false; }
+      modes = *cur++;
+      if (modes & 3) { return false; }
+      cur = decode_seq_table(cur,
+                             end,
+                             modes >> 6,
+                             m_ll_table,
+                             &m_ll_log,
+                             zstd_ll_default_norm,
+                             zstd_num_ll_codes,
+                             zstd_predefined_ll_log,
+                             zstd_num_ll_codes,
+                             zstd_max_ll_log,
+                             1);
+      if (cur) {
+        cur = decode_seq_table(cur,
+                               end,
+                               (modes >> 4) & 3,
+                               m_of_table,
+                               &m_of_log,
+                               zstd_of_default_norm,
+                               zstd_num_predefined_of,
+                               zstd_predefined_of_log,
+                               zstd_num_of_codes,
+                               zstd_max_of_log,
+                               2);
+      }
+      if (cur) {
+        cur = decode_seq_table(cur,
+                               end,
+                               (modes >> 2) & 3,
+                               m_ml_table,
+                               &m_ml_log,
+                               zstd_ml_default_norm,
+                               zstd_num_ml_codes,
+                               zstd_predefined_ml_log,
+                               zstd_num_ml_codes,
+                               zstd_max_ml_log,
+                               4);
+      }
+      if (!cur || !br.init(cur, end - cur)) { return false; }
+      ll_state = br.read(m_ll_log);
+      of_state = br.read(m_of_log);
+      ml_state = br.read(m_ml_log);
+      for (uint32_t i = 0; i < num_seq; i++) {
+        const fse_entry &ll_e = m_ll_table[ll_state];
+        const fse_entry &of_e = m_of_table[of_state];
+        const fse_entry &ml_e = m_ml_table[ml_state];
+        uint32_t offset, ml, ll;
+        if (ll_e.symbol >= zstd_num_ll_codes || ml_e.symbol >= zstd_num_ml_codes) { return false; }
+        offset = (1u << of_e.symbol) + br.read(of_e.symbol);
+        ml     = zstd_ml_base[ml_e.symbol] + br.read(zstd_ml_bits[ml_e.symbol]);
+        ll     = zstd_ll_base[ll_e.symbol] + br.read(zstd_ll_bits[ll_e.symbol]);
+        if (offset > 3) {
+          offset -= 3;
+          m_rep[2] = m_rep[1];
+          m_rep[1] = m_rep[0];
+          m_rep[0] = offset;
+        } else {
+          uint32_t idx = offset - 1 + (ll == 0);
+          if (idx == 0) {
+            offset = m_rep[0];
+          } else {
+            offset = (idx < 3) ? m_rep[idx] : m_rep[0] - 1;
+            if (idx > 1) { m_rep[2] = m_rep[1]; }
+            m_rep[1] = m_rep[0];
+            m_rep[0] = offset;
+          }
+        }
+        if (i + 1 < num_seq) {
+          ll_state = ll_e.base + br.read(ll_e.nbits);
+          ml_state = ml_e.base + br.read(ml_e.nbits);
+          of_state = of_e.base + br.read(of_e.nbits);
+        }
+        if (ll > m_literals.size() - lit_pos || ll > static_cast<size_t>(m_out_end - m_out)) {
+          return false;
+        }
+        memcpy(m_out, m_literals.data() + lit_pos, ll);
+        m_out += ll;
+        lit_pos += ll;
+        if (offset == 0 || offset > static_cast<size_t>(m_out - m_frame_out) ||
+            ml > static_cast<size_t>(m_out_end - m_out)) {
+          return false;
+        }
+        for (uint32_t j = 0; j < ml; j++, m_out++) {
+          *m_out = m_out[-static_cast<ptrdiff_t>(offset)];
+        }
+      }
+      if (br.bitpos() != 0) { return false; }
+    }
+    if (m_literals.size() - lit_pos > static_cast<size_t>(m_out_end - m_out)) { return false; }
+    memcpy(m_out, m_literals.data() + lit_pos, m_literals.size() - lit_pos);
+    m_out += m_literals.size() - lit_pos;
+    return true;
+  }
+
+  uint8_t *m_out;
+  uint8_t *const m_out_end;
+  uint8_t *m_frame_out = nullptr;
+  uint32_t m_rep[3]    = {1, 4, 8};
+  bool m_huf_valid     = false;
+  uint32_t m_seq_valid = 0;
+  uint32_t m_huf_bits  = 0;
+  uint32_t m_ll_log = 0, m_of_log = 0, m_ml_log = 0;
+  std::vector<uint8_t> m_literals;
+  uint16_t m_huf_table[1 << zstd_max_huf_bits];
+  fse_entry m_ll_table[1 << zstd_max_ll_log];
+  fse_entry m_of_table[1 << zstd_max_of_log];
+  fse_entry m_ml_table[1 << zstd_max_ml_log];
+};
+
+}  // namespace
+
+int32_t cpu_unzstd(const uint8_t *input, size_t inlen, uint8_t *dst, size_t *dstlen)
+{
+  zstd_decoder decoder(dst, *dstlen);
+  if (!decoder.decode(input, input + inlen)) { return -1; }
+  *dstlen = decoder.bytes_written(dst);
+  return 0;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,481 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpuinflate.h"
+
+#include <io/utilities/block_utils.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace io {
+constexpr int deflate_hash_bits         = 13;
+constexpr uint32_t max_copy_length      = 258;
+constexpr uint32_t max_copy_distance    = 32768;
+constexpr uint32_t crc32_poly           = 0xedb88320;  // Reflected CRC-32 polynomial
+constexpr uint32_t gzip_header_size     = 10;
+constexpr uint32_t deflate_bit_buf_size = 32;
+
+/**
+ * @brief deflate compressor state
+ */
+struct deflate_state_s {
+  const uint8_t *src;                         ///< Ptr to uncompressed data
+  uint32_t src_len;                           ///< Uncompressed data length
+  uint8_t *dst_base;                          ///< Base ptr to output compressed data
+  uint8_t *dst;                               ///< Current ptr to compressed data
+  uint8_t *end;                               ///< End of compressed data buffer
+  volatile uint32_t literal_length;           ///< Number of literal bytes
+  volatile uint32_t copy_length;              ///< Number of copy bytes
+  volatile uint32_t copy_distance;            ///< Distance for copy bytes
+  uint32_t bit_count;                         ///< Number of pending bits in bit_buf
+  uint32_t bit_buf[deflate_bit_buf_size];     ///< Pending output bits (LSB first)
+  uint32_t crc_table[256];                    ///< Byte-wise CRC-32 lookup (gzip only)
+  uint32_t x2n_table[32];                     ///< x^(2^n) mod crc32_poly (gzip only)
+  uint32_t crc_part[4];                       ///< Per-warp CRC-32 partial results
+  uint16_t hash_map[1 << deflate_hash_bits];  ///< Low 16-bit offset from hash
+};
+
+/**
+ * @brief 13-bit hash from four consecutive bytes
+ */
+static inline __device__ uint32_t deflate_hash(uint32_t v)
+{
+  return (v * ((1 << 20) + (0x2a00) + (0x6a) + 1)) >> (32 - deflate_hash_bits);
+}
+
+/**
+ * @brief Fetches four consecutive bytes
+ */
+static inline __device__ uint32_t fetch4(const uint8_t *src)
+{
+  uint32_t src_align    = 3 & reinterpret_cast<uintptr_t>(src);
+  const uint32_t *src32 = reinterpret_cast<const uint32_t *>(src - src_align);
+  uint32_t v            = src32[0];
+  return (src_align) ? __funnelshift_r(v, src32[1], src_align * 8) : v;
+}
+
+/**
+ * @brief Appends a variable-length bit field per lane to the output bit stream, and writes all the
+ * completed bytes to the output buffer
+ *
+ * @param s Compressor state
+ * @param bits Bits to output (LSB first)
+ * @param nbits Number of bits to output, up to 31 (zero if the lane has nothing to output)
+ * @param t Thread in warp
+ */
+static __device__ void PutBits(deflate_state_s *s, uint32_t bits, uint32_t nbits, uint32_t t)
+{
+  uint32_t pos = WarpReducePos32(nbits, t) - nbits + s->bit_count;
+  if (nbits != 0) {
+    uint32_t b = pos & 0x1f;
+    atomicOr(&s->bit_buf[pos >> 5], bits << b);
+    if (b + nbits > 32) { atomicOr(&s->bit_buf[(pos >> 5) + 1], bits >> (32 - b)); }
+  }
+  uint32_t total_bits = shuffle(pos + nbits, 31);
+  uint32_t nbytes     = total_bits >> 3;
+  uint8_t *dst        = s->dst;
+  __syncwarp();
+  for (uint32_t i = t; i < nbytes; i += 32) {
+    if (dst + i < s->end) { dst[i] = static_cast<uint8_t>(s->bit_buf[i >> 2] >> ((i & 3) * 8)); }
+  }
+  uint32_t remainder = (s->bit_buf[nbytes >> 2] >> ((nbytes & 3) * 8)) & 0xff;
+  __syncwarp();
+  s->bit_buf[t] = (t == 0) ? remainder : 0;
+  if (t == 0) {
+    s->dst       = dst + nbytes;
+    s->bit_count = total_bits & 7;
+  }
+  __syncwarp();
+}
+
+/**
+ * @brief Returns the fixed Huffman code of a literal/length symbol, bit-reversed for output
+ */
+static inline __device__ uint32_t LitLenCode(uint32_t sym, uint32_t &nbits)
+{
+  uint32_t code;
+  if (sym < 144) {
+    code  = 0x30 + sym;
+    nbits = 8;
+  } else if (sym < 256) {
+    code  = 0x190 + sym - 144;
+    nbits = 9;
+  } else if (sym < 280) {
+    code  = sym - 256;
+    nbits = 7;
+  } else {
+    code  = 0xc0 + sym - 280;
+    nbits = 8;
+  }
+  return __brev(code) >> (32 - nbits);
+}
+
+/**
+ * @brief Outputs literal bytes
+ *
+ * @param s Compressor state
+ * @param src Pointer to literal bytes
+ * @param len Number of literal bytes
+ * @param t Thread in warp
+ */
+static __device__ void StoreLiterals(deflate_state_s *s,
+                                     const uint8_t *src,
+                                     uint32_t len,
+                                     uint32_t t)
+{
+  for (uint32_t i = 0; i < len; i += 32) {
+    uint32_t code = 0, nbits = 0;
+    if (i + t < len) { code = LitLenCode(src[i + t], nbits); }
+    PutBits(s, code, nbits, t);
+  }
+}
+
+/**
+ * @brief Outputs a length/distance pair
+ *
+ * @param s Compressor state
+ * @param copy_len Copy length (3 to 258)
+ * @param distance Copy distance (1 to 32768)
+ * @param t Thread in warp
+ */
+static __device__ void StoreCopy(deflate_state_s *s,
+                                 uint32_t copy_len,
+                                 uint32_t distance,
+                                 uint32_t t)
+{
+  uint32_t code = 0, nbits = 0;
+  if (t == 0) {
+    // Length symbol followed by extra bits
+    uint32_t l = copy_len - 3, sym, e;
+    if (copy_len == max_copy_length) {
+      sym = 285;
+      e   = 0;
+    } else if (l < 8) {
+      sym = 257 + l;
+      e   = 0;
+    } else {
+      e   = 29 - __clz(l);
+      sym = 261 + 4 * e + (l >> e) - 4;
+    }
+    code = LitLenCode(sym, nbits);
+    code |= (l & ((1 << e) - 1)) << nbits;
+    nbits += e;
+  } else if (t == 1) {
+    // 5-bit distance symbol followed by extra bits
+    uint32_t d = distance - 1, sym, e;
+    if (d < 4) {
+      sym = d;
+      e   = 0;
+    } else {
+      e   = 30 - __clz(d);
+      sym = 2 * e + 2 + ((d >> e) & 1);
+    }
+    code  = (__brev(sym) >> 27) | ((d & ((1 << e) - 1)) << 5);
+    nbits = 5 + e;
+  }
+  PutBits(s, code, nbits, t);
+}
+
+/**
+ * @brief Returns mask of any thread in the warp that has a hash value
+ * equal to that of the calling thread
+ */
+static inline __device__ uint32_t HashMatchAny(uint32_t v, uint32_t t)
+{
+#if (__CUDA_ARCH__ >= 700)
+  return __match_any_sync(~0, v);
+#else
+  uint32_t err_map = 0;
+  for (uint32_t i = 0; i < deflate_hash_bits; i++, v >>= 1) {
+    uint32_t b       = v & 1;
+    uint32_t match_b = ballot(b);
+    err_map |= match_b ^ -(int32_t)b;
+  }
+  return ~err_map;
+#endif
+}
+
+/**
+ * @brief Finds the first occurrence of a consecutive 4-byte match in the input sequence,
+ * or at most 256 bytes
+ *
+ * @param s Compressor state (copy_length set to 4 if a match is found, zero otherwise)
+ * @param src Uncompressed buffer
+ * @param pos0 Position in uncompressed buffer
+ * @param t thread in warp
+ *
+ * @return Number of bytes before first match (literal length)
+ */
+static __device__ uint32_t FindFourByteMatch(deflate_state_s *s,
+                                             const uint8_t *src,
+                                             uint32_t pos0,
+                                             uint32_t t)
+{
+  constexpr int max_literal_length = 256;
+  uint32_t len                     = s->src_len;
+  uint32_t pos                     = pos0;
+  uint32_t maxpos                  = pos0 + max_literal_length - 31;
+  uint32_t match_mask, literal_cnt;
+  if (t == 0) { s->copy_length = 0; }
+  do {
+    bool valid4               = (pos + t + 4 <= len);
+    uint32_t data32           = (valid4) ? fetch4(src + pos + t) : 0;
+    uint32_t hash             = (valid4) ? deflate_hash(data32) : 0;
+    uint32_t local_match      = HashMatchAny(hash, t);
+    uint32_t local_match_lane = 31 - __clz(local_match & ((1 << t) - 1));
+    uint32_t local_match_data = shuffle(data32, min(local_match_lane, t));
+    uint32_t offset, match;
+    if (valid4) {
+      if (local_match_lane < t && local_match_data == data32) {
+        match  = 1;
+        offset = pos + local_match_lane;
+      } else {
+        offset = (pos & ~0xffff) | s->hash_map[hash];
+        if (offset >= pos) { offset = (offset >= 0x10000) ? offset - 0x10000 : pos; }
+        match =
+          (offset < pos && offset + max_copy_distance >= pos + t && fetch4(src + offset) == data32);
+      }
+    } else {
+      match       = 0;
+      local_match = 0;
+      offset      = pos + t;
+    }
+    match_mask = ballot(match);
+    if (match_mask != 0) {
+      literal_cnt = __ffs(match_mask) - 1;
+      if (t == literal_cnt) {
+        s->copy_distance = pos + t - offset;
+        s->copy_length   = 4;
+      }
+    } else {
+      literal_cnt = 32;
+    }
+    // Update hash up to the first 4 bytes of the copy length
+    local_match &= (0x2 << literal_cnt) - 1;
+    if (t <= literal_cnt && t == 31 - __clz(local_match)) { s->hash_map[hash] = pos + t; }
+    pos += literal_cnt;
+  } while (literal_cnt == 32 && pos < maxpos);
+  return min(pos, len) - pos0;
+}
+
+/// @brief Returns the number of matching bytes for two byte sequences up to len bytes
+static __device__ uint32_t MatchLength(const uint8_t *src1,
+                                       const uint8_t *src2,
+                                       uint32_t len,
+                                       uint32_t t)
+{
+  for (uint32_t ofs = 0;; ofs += 32) {
+    uint32_t mismatch = ballot(ofs + t >= len || src1[ofs + t] != src2[ofs + t]);
+    if (mismatch != 0) { return ofs + __ffs(mismatch) - 1; }
+  }
+}
+
+/**
+ * @brief Multiplies two polynomials modulo the CRC-32 polynomial (reflected bit order)
+ */
+static inline __device__ uint32_t crc32_multmodp(uint32_t a, uint32_t b)
+{
+  uint32_t p = 0;
+  for (uint32_t m = 1u << 31; m != 0; m >>= 1) {
+    if (a & m) { p ^= b; }
+    b = (b & 1) ? (b >> 1) ^ crc32_poly : b >> 1;
+  }
+  return p;
+}
+
+/**
+ * @brief Returns x^(8 * n) modulo the CRC-32 polynomial, the factor that shifts a CRC past n
+ * zero bytes
+ */
+static inline __device__ uint32_t crc32_x8nmodp(const uint32_t *x2n_table, uint32_t n)
+{
+  uint32_t p = 1u << 31;  // x^0
+  for (uint32_t k = 3; n != 0; n >>= 1, k++) {
+    if (n & 1) { p = crc32_multmodp(x2n_table[k & 31], p); }
+  }
+  return p;
+}
+
+/**
+ * @brief Deflate compression kernel (single block with fixed Huffman codes)
+ * See https://tools.ietf.org/html/rfc1951 and https://tools.ietf.org/html/rfc1952 (gzip)
+ *
+ * blockDim {128,1,1}
+ *
+ * @param[in] inputs Source/Destination buffer information per block
+ * @param[out] outputs Compression status per block
+ * @param[in] count Number of blocks to compress
+ * @param[in] gzip_hdr Whether to add a gzip header and trailer
+ */
+extern "C" __global__ void __launch_bounds__(128) deflate_kernel(gpu_inflate_input_s *inputs,
+                                                                 gpu_inflate_status_s *outputs,
+                                                                 int count,
+                                                                 int gzip_hdr)
+{
+  __shared__ __align__(16) deflate_state_s state_g;
+
+  deflate_state_s *const s = &state_g;
+  uint32_t t               = threadIdx.x;
+  uint32_t pos;
+  const uint8_t *src;
+
+  if (!t) {
+    const uint8_t *src = static_cast<const uint8_t *>(inputs[blockIdx.x].srcDevice);
+    uint32_t src_len   = static_cast<uint32_t>(inputs[blockIdx.x].srcSize);
+    uint8_t *dst       = static_cast<uint8_t *>(inputs[blockIdx.x].dstDevice);
+    uint32_t dst_len   = static_cast<uint32_t>(inputs[blockIdx.x].dstSize);
+    uint8_t *end       = dst + dst_len;
+    s->src             = src;
+    s->src_len         = src_len;
+    s->dst_base        = dst;
+    s->end             = end;
+    if (gzip_hdr) {
+      // ID1, ID2, CM=deflate, FLG=0, MTIME=0, XFL=0, OS=unknown
+      const uint8_t hdr[gzip_header_size] = {0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff};
+      for (uint32_t i = 0; i < gzip_header_size; i++) {
+        if (dst + i < end) { dst[i] = hdr[i]; }
+      }
+      dst += gzip_header_size;
+    }
+    s->dst            = dst;
+    s->literal_length = 0;
+    s->copy_length    = 0;
+    s->copy_distance  = 0;
+    // Block header: BFINAL=1, BTYPE=01 (fixed Huffman codes)
+    s->bit_buf[0] = 3;
+    s->bit_count  = 3;
+  }
+  if (t > 0 && t < deflate_bit_buf_size) { s->bit_buf[t] = 0; }
+  for (uint32_t i = t; i < sizeof(s->hash_map) / sizeof(uint32_t); i += 128) {
+    *reinterpret_cast<volatile uint32_t *>(&s->hash_map[i * 2]) = 0;
+  }
+  if (gzip_hdr) {
+    for (uint32_t i = t; i < 256; i += 128) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; k++) {
+        c = (c & 1) ? (c >> 1) ^ crc32_poly : c >> 1;
+      }
+      s->crc_table[i] = c;
+    }
+    if (t == 0) {
+      uint32_t p = 1u << 30;  // x^1
+      for (int k = 0; k < 32; k++) {
+        s->x2n_table[k] = p;
+        p               = crc32_multmodp(p, p);
+      }
+    }
+  }
+  __syncthreads();
+  src = s->src;
+  pos = 0;
+  while (pos < s->src_len) {
+    uint32_t literal_len = s->literal_length;
+    uint32_t copy_len    = s->copy_length;
+    uint32_t distance    = s->copy_distance;
+    __syncthreads();
+    if (t < 32) {
+      // WARP0: Encode literals and copies
+      if (literal_len > 0) {
+        StoreLiterals(s, src + pos, literal_len, t);
+        pos += literal_len;
+      }
+      if (copy_len > 0) {
+        StoreCopy(s, copy_len, distance, t);
+        pos += copy_len;
+      }
+    } else {
+      pos += literal_len + copy_len;
+      if (t < 32 * 2) {
+        // WARP1: Find a match using 13-bit hashes of 4-byte blocks
+        uint32_t t5 = t & 0x1f;
+        literal_len = FindFourByteMatch(s, src, pos, t5);
+        if (t5 == 0) { s->literal_length = literal_len; }
+        __syncwarp();
+        copy_len = s->copy_length;
+        if (copy_len != 0) {
+          uint32_t match_pos = pos + literal_len + copy_len;  // NOTE: copy_len is always 4 here
+          copy_len += MatchLength(src + match_pos,
+                                  src + match_pos - s->copy_distance,
+                                  min(s->src_len - match_pos, max_copy_length - copy_len),
+                                  t5);
+          if (t5 == 0) { s->copy_length = copy_len; }
+        }
+      }
+    }
+    __syncthreads();
+  }
+  if (t < 32) {
+    // End-of-block symbol (7 zero bits), then flush the last partial byte
+    PutBits(s, 0, (t == 0) ? 7 : 0, t);
+    if (t == 0 && s->bit_count != 0) {
+      if (s->dst < s->end) { s->dst[0] = static_cast<uint8_t>(s->bit_buf[0]); }
+      s->dst++;
+    }
+  }
+  if (gzip_hdr) {
+    // CRC-32 of the uncompressed data: each thread computes the CRC of a segment (with a zero
+    // initial value), shifted past the bytes that follow it
+    uint32_t len       = s->src_len;
+    uint32_t seg_len   = (len + 127) / 128;
+    uint32_t seg_start = min(t * seg_len, len);
+    uint32_t seg_end   = min(seg_start + seg_len, len);
+    uint32_t crc       = 0;
+    for (uint32_t i = seg_start; i < seg_end; i++) {
+      crc = s->crc_table[(crc ^ src[i]) & 0xff] ^ (crc >> 8);
+    }
+    if (crc != 0) { crc = crc32_multmodp(crc32_x8nmodp(s->x2n_table, len - seg_end), crc); }
+    for (uint32_t k = 16; k > 0; k >>= 1) {
+      crc ^= shuffle_xor(crc, k);
+    }
+    if (!(t & 0x1f)) { s->crc_part[t >> 5] = crc; }
+    __syncthreads();
+    if (t == 0) {
+      crc = s->crc_part[0] ^ s->crc_part[1] ^ s->crc_part[2] ^ s->crc_part[3];
+      // Account for the 0xffffffff initial value and final inversion
+      crc = ~(crc ^ crc32_multmodp(crc32_x8nmodp(s->x2n_table, len), 0xffffffffu));
+      uint8_t *dst = s->dst;
+      for (uint32_t i = 0; i < 4; i++) {
+        if (dst + i < s->end) { dst[i] = static_cast<uint8_t>(crc >> (i * 8)); }
+        if (dst + 4 + i < s->end) { dst[4 + i] = static_cast<uint8_t>(len >> (i * 8)); }
+      }
+      s->dst = dst + 8;
+    }
+  }
+  __syncthreads();
+  if (!t) {
+    outputs[blockIdx.x].bytes_written = s->dst - s->dst_base;
+    outputs[blockIdx.x].status        = (s->dst > s->end) ? 1 : 0;
+    outputs[blockIdx.x].reserved      = 0;
+  }
+}
+
+cudaError_t __host__ gpu_deflate(gpu_inflate_input_s *inputs,
+                                 gpu_inflate_status_s *outputs,
+                                 int count,
+                                 int gzip_hdr,
+                                 rmm::cuda_stream_view stream)
+{
+  dim3 dim_block(128, 1);  // 4 warps per stream, 1 stream per block
+  dim3 dim_grid(count, 1);
+  if (count > 0) {
+    deflate_kernel<<<dim_grid, dim_block, 0, stream.value()>>>(inputs, outputs, count, gzip_hdr);
+  }
+  return cudaSuccess;
+}
+
+}  // namespace io
+}  // namespace cudf
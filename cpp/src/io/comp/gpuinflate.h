@@ -86,6 +86,23 @@ cudaError_t gpu_unsnap(gpu_inflate_input_s *inputs,
                        int count                    = 1,
                        rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
+/**
+ * @brief Interface for decompressing Zstandard-compressed data
+ *
+ * Multiple, independent chunks of compressed data can be decompressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ * Frames that require a dictionary are not supported.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] stream CUDA stream to use, default 0
+ */
+cudaError_t gpu_unzstd(gpu_inflate_input_s *inputs,
+                       gpu_inflate_status_s *outputs,
+                       int count                    = 1,
+                       rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 /**
  * @brief Computes the size of temporary memory for Brotli decompression
  *
@@ -131,5 +148,40 @@ cudaError_t gpu_snap(gpu_inflate_input_s *inputs,
                      int count                    = 1,
                      rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
+/**
+ * @brief Interface for compressing data with DEFLATE
+ *
+ * Multiple, independent chunks of compressed data can be compressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] gzip_hdr Whether or not to add a GZIP header and trailer, default false
+ * @param[in] stream CUDA stream to use, default 0
+ */
+cudaError_t gpu_deflate(gpu_inflate_input_s *inputs,
+                        gpu_inflate_status_s *outputs,
+                        int count                    = 1,
+                        int gzip_hdr                 = 0,
+                        rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+/**
+ * @brief Interface for compressing data with Zstandard
+ *
+ * Multiple, independent chunks of compressed data can be compressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ * Each chunk is compressed into a single frame without a checksum.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] stream CUDA stream to use, default 0
+ */
+cudaError_t gpu_zstd(gpu_inflate_input_s *inputs,
+                     gpu_inflate_status_s *outputs,
+                     int count                    = 1,
+                     rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 }  // namespace io
 }  // namespace cudf
@@ -17,11 +17,15 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include <cudf/utilities/span.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
 using cudf::host_span;
 
 namespace cudf {
@@ -44,6 +48,20 @@ std::vector<char> io_uncompress_single_h2d(void const* src, size_t src_size, int
 
 std::vector<char> get_uncompressed_data(host_span<char const> data, std::string const& compression);
 
+/**
+ * @brief Decompresses a GZIP stream of one or more members on the GPU
+ *
+ * Members are decompressed in parallel, one per thread block.
+ *
+ * @param data Compressed data in host memory
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Uncompressed data in device memory, or an empty optional if the stream must be
+ * decompressed on the host instead
+ */
+std::optional<rmm::device_uvector<char>> gpu_uncompress_gzip(host_span<char const> data,
+                                                             rmm::cuda_stream_view stream);
+
 class HostDecompressor {
  public:
   virtual size_t Decompress(uint8_t* dstBytes,
@@ -77,6 +77,8 @@ For more information on these sources, see the manual.
 
 #pragma once
 
+#include <vector>
+
 namespace cudf {
 namespace io {
 // If BZ_OUTBUFF_FULL is returned and block_start is non-NULL, dstlen will be updated to point to
@@ -102,5 +104,12 @@ int32_t cpu_bz2_uncompress(const uint8_t *input,
                            size_t *dstlen,
                            uint64_t *block_start = nullptr);
 
+// Decompresses a whole bz2 stream, decoding independent blocks concurrently on num_threads host
+// threads (all hardware threads if num_threads <= 0). The output is resized to fit.
+int32_t cpu_bz2_uncompress_parallel(const uint8_t *input,
+                                    size_t inlen,
+                                    std::vector<char> &dst,
+                                    int num_threads = 0);
+
 }  // namespace io
 }  // namespace cudf
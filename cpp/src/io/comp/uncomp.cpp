@@ -14,12 +14,18 @@
  * limitations under the License.
  */
 
+#include "gpuinflate.h"
 #include "io_uncomp.h"
-#include "unbz2.h"  // bz2 uncompress
+#include "unbz2.h"   // bz2 uncompress
+#include "unzstd.h"  // zstd uncompress
+
+#include <io/utilities/hostdevice_vector.hpp>
 
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <rmm/device_buffer.hpp>
+
 #include <cuda_runtime.h>
 
 #include <string.h>  // memset
@@ -383,27 +389,10 @@ std::vector<char> io_uncompress_single_h2d(const void *src, size_t src_size, int
     return dst;
   }
   if (stream_type == IO_UNCOMP_STREAM_TYPE_BZIP2) {
-    size_t src_ofs = 0;
-    size_t dst_ofs = 0;
-    int bz_err     = 0;
-    std::vector<char> dst(uncomp_len);
-    do {
-      size_t dst_len = uncomp_len - dst_ofs;
-      bz_err         = cpu_bz2_uncompress(
-        comp_data, comp_len, reinterpret_cast<uint8_t *>(dst.data()) + dst_ofs, &dst_len, &src_ofs);
-      if (bz_err == BZ_OUTBUFF_FULL) {
-        // TBD: We could infer the compression ratio based on produced/consumed byte counts
-        // in order to minimize realloc events and over-allocation
-        dst_ofs = dst_len;
-        dst_len = uncomp_len + (uncomp_len / 2);
-        dst.resize(dst_len);
-        uncomp_len = dst_len;
-      } else if (bz_err == 0) {
-        uncomp_len = dst_len;
-        dst.resize(uncomp_len);
-      }
-    } while (bz_err == BZ_OUTBUFF_FULL);
-    CUDF_EXPECTS(bz_err == 0, "Decompression: error in stream");
+    // bz2 blocks are independent, so they are decoded concurrently on all host threads
+    std::vector<char> dst;
+    CUDF_EXPECTS(cpu_bz2_uncompress_parallel(comp_data, comp_len, dst) == BZ_OK,
+                 "Decompression: error in stream");
     return dst;
   }
 
@@ -435,6 +424,85 @@ std::vector<char> get_uncompressed_data(host_span<char const> const data,
   return io_uncompress_single_h2d(data.data(), data.size(), comp_type);
 }
 
+/**
+ * @copydoc cudf::io::gpu_uncompress_gzip
+ */
+std::optional<rmm::device_uvector<char>> gpu_uncompress_gzip(host_span<char const> const data,
+                                                             rmm::cuda_stream_view stream)
+{
+  constexpr size_t min_member_size   = 10 + 2 + 8;  // header, empty final block, trailer
+  constexpr size_t max_inflate_ratio = 1032;        // DEFLATE cannot expand data any further
+  auto const raw  = reinterpret_cast<const uint8_t *>(data.data());
+  auto const size = data.size();
+
+  auto is_member_start = [&](size_t pos) {
+    return pos + min_member_size <= size && raw[pos] == 0x1f && raw[pos + 1] == 0x8b &&
+           raw[pos + 2] == 8 && (raw[pos + 3] & 0xe0) == 0;
+  };
+  if (!is_member_start(0)) { return std::nullopt; }
+
+  // A member's length is only known after decoding it, so every plausible member header is
+  // considered a boundary; the ones that lie inside compressed data are removed below.
+  std::vector<size_t> starts{0};
+  for (size_t pos = min_member_size; pos + min_member_size <= size; pos++) {
+    if (is_member_start(pos)) { starts.push_back(pos); }
+  }
+  auto member_end   = [&](size_t i) { return (i + 1 < starts.size()) ? starts[i + 1] : size; };
+  auto member_isize = [&](size_t i) {
+    auto const p = raw + member_end(i) - 4;
+    return static_cast<size_t>(p[0] | (p[1] << 8) | (p[2] << 16) | (p[3] << 24));
+  };
+
+  rmm::device_buffer d_comp(data.data(), size, stream);
+  while (true) {
+    // An uncompressed size that does not fit the ratio limit is not a real trailer
+    for (size_t i = 0; i < starts.size();) {
+      if (member_isize(i) <= (member_end(i) - starts[i]) * max_inflate_ratio) {
+        i++;
+      } else if (i + 1 < starts.size()) {
+        starts.erase(starts.begin() + i + 1);
+      } else {
+        return std::nullopt;
+      }
+    }
+    auto const num_members = starts.size();
+    size_t total_size      = 0;
+    hostdevice_vector<gpu_inflate_input_s> inflate_in(num_members, stream);
+    hostdevice_vector<gpu_inflate_status_s> inflate_out(num_members, stream);
+    for (size_t i = 0; i < num_members; i++) {
+      inflate_in[i].srcDevice = static_cast<const uint8_t *>(d_comp.data()) + starts[i];
+      inflate_in[i].srcSize   = member_end(i) - starts[i];
+      inflate_in[i].dstSize   = member_isize(i);
+      total_size += member_isize(i);
+    }
+    rmm::device_uvector<char> d_uncomp(total_size, stream);
+    for (size_t i = 0, offset = 0; i < num_members; offset += inflate_in[i++].dstSize) {
+      inflate_in[i].dstDevice = d_uncomp.data() + offset;
+    }
+    inflate_in.host_to_device(stream);
+    CUDA_TRY(gpuinflate(inflate_in.device_ptr(), inflate_out.device_ptr(), num_members, 1, stream));
+    inflate_out.device_to_host(stream, true);
+
+    // The first member of a run of failures starts at a real header, so it must extend past the
+    // next boundary. Sizes of 4GB and above are ambiguous and left to the host decompressor.
+    std::vector<size_t> false_starts;
+    bool prev_failed = false;
+    for (size_t i = 0; i < num_members; i++) {
+      bool const failed =
+        inflate_out[i].status != 0 || inflate_out[i].bytes_written != inflate_in[i].dstSize;
+      if (failed && !prev_failed) {
+        if (i + 1 == num_members) { return std::nullopt; }
+        false_starts.push_back(i + 1);
+      }
+      prev_failed = failed;
+    }
+    if (false_starts.empty()) { return d_uncomp; }
+    for (auto it = false_starts.rbegin(); it != false_starts.rend(); ++it) {
+      starts.erase(starts.begin() + *it);
+    }
+  }
+}
+
 /**
  * @Brief ZLIB host decompressor class
  */
@@ -557,6 +625,23 @@ class HostDecompressor_SNAPPY : public HostDecompressor {
   }
 };
 
+/**
+ * @Brief ZSTD host decompressor class
+ */
+class HostDecompressor_ZSTD : public HostDecompressor {
+ public:
+  HostDecompressor_ZSTD() {}
+  size_t Decompress(uint8_t *dstBytes,
+                    size_t dstLen,
+                    const uint8_t *srcBytes,
+                    size_t srcLen) override
+  {
+    size_t dst_len = dstLen;
+    if (!dstBytes || srcLen < 1) { return 0; }
+    return (cpu_unzstd(srcBytes, srcLen, dstBytes, &dst_len) == 0) ? dst_len : 0;
+  }
+};
+
 /**
  * @Brief CPU decompression class
  *
@@ -570,6 +655,7 @@ std::unique_ptr<HostDecompressor> HostDecompressor::Create(int stream_type)
     case IO_UNCOMP_STREAM_TYPE_GZIP: return std::make_unique<HostDecompressor_ZLIB>(true);
     case IO_UNCOMP_STREAM_TYPE_INFLATE: return std::make_unique<HostDecompressor_ZLIB>(false);
     case IO_UNCOMP_STREAM_TYPE_SNAPPY: return std::make_unique<HostDecompressor_SNAPPY>();
+    case IO_UNCOMP_STREAM_TYPE_ZSTD: return std::make_unique<HostDecompressor_ZSTD>();
   }
   CUDF_FAIL("Unsupported compression type");
 }
@@ -0,0 +1,964 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file unzstd.cu
+ * @brief Zstandard decompression (RFC 8878)
+ *
+ * Each stream is decoded by a single warp: lane 0 parses the frame and block headers and decodes
+ * the FSE-compressed sequences, lanes 0-3 decode the Huffman-compressed literal streams, and the
+ * whole warp executes the literal and match copies. Decoded literals are staged at the end of the
+ * output buffer, which the output never overtakes before they are consumed, so no scratch memory
+ * is needed.
+ */
+
+#include "gpuinflate.h"
+
+#include <io/utilities/block_utils.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#define CONSTANT static const __device__ __constant__
+#include "zstd_tables.h"
+
+namespace cudf {
+namespace io {
+constexpr uint32_t zstd_seq_batch_size = 32;
+
+/**
+ * @brief FSE decoding table entry
+ */
+struct fse_entry_s {
+  uint16_t base;   ///< Base of the next state
+  uint8_t symbol;  ///< Decoded symbol
+  uint8_t nbits;   ///< Number of bits to read for the next state
+};
+
+/**
+ * @brief Backward bit reader for FSE and Huffman bitstreams, that are read from the last byte
+ * towards the first one
+ */
+struct zstd_bitreader_s {
+  const uint8_t *base;  ///< Start of the bitstream
+  int32_t len;          ///< Length of the bitstream in bytes
+  int32_t bitpos;       ///< Number of unread bits (negative if the stream is overconsumed)
+  int32_t cache_pos;    ///< Bit position of the lowest bit in cache
+  uint64_t cache;       ///< Bits [cache_pos, cache_pos + 64) of the bitstream
+};
+
+/**
+ * @brief zstd decompressor state
+ */
+struct unzstd_state_s {
+  const uint8_t *cur;                           ///< Current position in the compressed data
+  const uint8_t *end;                           ///< End of the compressed data
+  const uint8_t *block_end;                     ///< End of the current compressed block
+  uint8_t *out_base;                            ///< Start of the output buffer
+  uint8_t *out;                                 ///< Current output position
+  uint8_t *out_end;                             ///< End of the output buffer
+  uint8_t *frame_out;                           ///< Output position at the start of the frame
+  const uint8_t *lit_ptr;                       ///< Next literal byte of the current block
+  const uint8_t *copy_src;                      ///< Source of raw block bytes
+  uint32_t lit_staged;                          ///< Literals are staged in the output buffer
+  uint32_t copy_len;                            ///< Number of raw or RLE block bytes
+  uint32_t fill_byte;                           ///< RLE byte value (raw block if > 0xff)
+  uint32_t lit_len;                             ///< Number of literal bytes remaining in the block
+  int32_t error;                                ///< Nonzero if the data is invalid
+  int32_t huf_error;                            ///< Nonzero if a literal stream is invalid
+  uint32_t block_type;                          ///< Type of the current block
+  uint32_t last_block;                          ///< Current block is the last one of the frame
+  uint32_t has_checksum;                        ///< Frame is followed by a content checksum
+  uint32_t num_huf_streams;                     ///< Number of Huffman literal streams (0 if none)
+  uint32_t num_seq;                             ///< Number of sequences remaining in the block
+  uint32_t batch_len;                           ///< Number of sequences in the current batch
+  uint32_t huf_bits;                            ///< Huffman table log
+  uint32_t huf_valid;                           ///< Huffman table is available for treeless blocks
+  uint32_t ll_log, of_log, ml_log;              ///< FSE table logs
+  uint32_t tables_valid;                        ///< Sequence tables available for repeat mode
+  uint32_t ll_state, of_state, ml_state;        ///< Sequence FSE states
+  uint32_t rep[3];                              ///< Repeat offsets
+  zstd_bitreader_s seq_br;                      ///< Sequence bitstream
+  const uint8_t *huf_src[4];                    ///< Huffman literal streams
+  uint32_t huf_src_len[4];                      ///< Length of Huffman literal streams
+  uint32_t huf_dst_len[4];                      ///< Number of literals per Huffman stream
+  uint8_t *huf_dst;                             ///< Huffman literals destination
+  uint32_t seq_ll[zstd_seq_batch_size];         ///< Literal length of batch sequences
+  uint32_t seq_ml[zstd_seq_batch_size];         ///< Match length of batch sequences
+  uint32_t seq_of[zstd_seq_batch_size];         ///< Offset of batch sequences
+  int16_t norm[zstd_num_ml_codes];              ///< Normalized frequencies (temporary)
+  uint16_t next_state[zstd_num_ml_codes];       ///< Next state per symbol (temporary)
+  uint8_t weights[256];                         ///< Huffman weights (temporary)
+  fse_entry_s weight_table[1 << zstd_max_huf_weight_log];  ///< Huffman weights FSE table
+  fse_entry_s ll_table[1 << zstd_max_ll_log];              ///< Literal lengths FSE table
+  fse_entry_s ml_table[1 << zstd_max_ml_log];              ///< Match lengths FSE table
+  fse_entry_s of_table[1 << zstd_max_of_log];              ///< Offsets FSE table
+  uint16_t huf_table[1 << zstd_max_huf_bits];              ///< Huffman table (symbol << 4 | bits)
+};
+
+inline __device__ uint32_t load_le16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+
+inline __device__ uint32_t load_le24(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16); }
+
+inline __device__ uint32_t load_le32(const uint8_t *p)
+{
+  return load_le16(p) | (load_le16(p + 2) << 16);
+}
+
+/// @brief Returns the position of the highest set bit, -1 if v is zero
+inline __device__ int highest_bit(uint32_t v) { return 31 - __clz(v); }
+
+/**
+ * @brief Loads the 64 bits of the bitstream below the current position into the bit cache
+ */
+static __device__ void bitreader_refill(zstd_bitreader_s *br)
+{
+  int32_t byte_pos = (br->bitpos >> 3) - 7;
+  uint64_t v       = 0;
+  for (int i = 7; i >= 0; i--) {
+    int32_t p = byte_pos + i;
+    v         = (v << 8) | ((p >= 0 && p < br->len) ? br->base[p] : 0);
+  }
+  br->cache     = v;
+  br->cache_pos = byte_pos * 8;
+}
+
+/**
+ * @brief Initializes a backward bitstream, skipping the padding bits and the end marker
+ *
+ * @return false if the bitstream is empty or has no end marker
+ */
+static __device__ bool bitreader_init(zstd_bitreader_s *br, const uint8_t *base, uint32_t len)
+{
+  if (len == 0 || base[len - 1] == 0) { return false; }
+  br->base   = base;
+  br->len    = len;
+  br->bitpos = (len - 1) * 8 + highest_bit(base[len - 1]);
+  bitreader_refill(br);
+  return true;
+}
+
+/**
+ * @brief Reads up to 32 bits from a backward bitstream, with zeros past its start
+ */
+inline __device__ uint32_t bitreader_read(zstd_bitreader_s *br, uint32_t nbits)
+{
+  int32_t pos = br->bitpos - static_cast<int32_t>(nbits);
+  if (pos < br->cache_pos) { bitreader_refill(br); }
+  br->bitpos = pos;
+  return static_cast<uint32_t>(br->cache >> (pos - br->cache_pos)) &
+         static_cast<uint32_t>((1ull << nbits) - 1);
+}
+
+/**
+ * @brief Reads up to 16 bits from a forward bitstream (FSE table descriptions)
+ */
+inline __device__ uint32_t fwd_read_bits(const uint8_t *p,
+                                         const uint8_t *end,
+                                         uint32_t bitpos,
+                                         uint32_t nbits)
+{
+  const uint8_t *q = p + (bitpos >> 3);
+  uint32_t v       = 0;
+  for (int i = 2; i >= 0; i--) {
+    v = (v << 8) | ((q + i < end) ? q[i] : 0);
+  }
+  return (v >> (bitpos & 7)) & ((1u << nbits) - 1);
+}
+
+/**
+ * @brief Parses an FSE table description
+ *
+ * @param cur Start of the table description
+ * @param end End of the compressed data
+ * @param norm[out] Normalized frequencies
+ * @param max_symbols Maximum number of symbols
+ * @param max_log Maximum accuracy log
+ * @param accuracy_log[out] Accuracy log of the table
+ * @param num_symbols[out] Number of symbols
+ *
+ * @return Position after the table description, nullptr if invalid
+ */
+static __device__ const uint8_t *fse_parse_header(const uint8_t *cur,
+                                                  const uint8_t *end,
+                                                  int16_t *norm,
+                                                  uint32_t max_symbols,
+                                                  uint32_t max_log,
+                                                  uint32_t *accuracy_log,
+                                                  uint32_t *num_symbols)
+{
+  uint32_t bitpos = 4;
+  uint32_t log    = fwd_read_bits(cur, end, 0, 4) + 5;
+  int32_t remaining;
+  uint32_t sym = 0;
+  if (log > max_log) { return nullptr; }
+  remaining = (1 << log) + 1;
+  while (remaining > 1 && sym < max_symbols) {
+    uint32_t nbits      = highest_bit(remaining) + 1;
+    uint32_t val        = fwd_read_bits(cur, end, bitpos, nbits);
+    uint32_t lower_mask = (1u << (nbits - 1)) - 1;
+    uint32_t threshold  = (1u << nbits) - 1 - remaining;
+    int32_t proba;
+    if ((val & lower_mask) < threshold) {
+      val &= lower_mask;
+      bitpos += nbits - 1;
+    } else {
+      if (val > lower_mask) { val -= threshold; }
+      bitpos += nbits;
+    }
+    proba = static_cast<int32_t>(val) - 1;
+    remaining -= (proba < 0) ? -proba : proba;
+    norm[sym++] = static_cast<int16_t>(proba);
+    if (proba == 0) {
+      // Zero probabilities are followed by 2-bit repeat flags
+      uint32_t repeat;
+      do {
+        repeat = fwd_read_bits(cur, end, bitpos, 2);
+        bitpos += 2;
+        for (uint32_t i = 0; i < repeat && sym < max_symbols; i++) {
+          norm[sym++] = 0;
+        }
+      } while (repeat == 3);
+    }
+  }
+  cur += (bitpos + 7) >> 3;
+  if (remaining != 1 || cur > end) { return nullptr; }
+  *accuracy_log = log;
+  *num_symbols  = sym;
+  return cur;
+}
+
+/**
+ * @brief Builds an FSE decoding table from normalized frequencies
+ *
+ * @return false if the distribution is invalid
+ */
+static __device__ bool fse_build_table(fse_entry_s *table,
+                                       const int16_t *norm,
+                                       uint16_t *next_state,
+                                       uint32_t num_symbols,
+                                       uint32_t log)
+{
+  uint32_t size           = 1 << log;
+  uint32_t high_threshold = size;
+  uint32_t step           = (size >> 1) + (size >> 3) + 3;
+  uint32_t pos            = 0;
+  // Symbols with a "less than 1" probability get a single cell at the end of the table
+  for (uint32_t s = 0; s < num_symbols; s++) {
+    if (norm[s] == -1) {
+      table[--high_threshold].symbol = s;
+      next_state[s]                  = 1;
+    }
+  }
+  for (uint32_t s = 0; s < num_symbols; s++) {
+    if (norm[s] <= 0) { continue; }
+    next_state[s] = norm[s];
+    for (int i = 0; i < norm[s]; i++) {
+      table[pos].symbol = s;
+      do {
+        pos = (pos + step) & (size - 1);
+      } while (pos >= high_threshold);
+    }
+  }
+  if (pos != 0) { return false; }
+  for (uint32_t i = 0; i < size; i++) {
+    uint32_t state  = next_state[table[i].symbol]++;
+    uint32_t nbits  = log - highest_bit(state);
+    table[i].nbits  = nbits;
+    table[i].base   = (state << nbits) - size;
+  }
+  return true;
+}
+
+/**
+ * @brief Parses the Huffman tree description of a literals section and builds the decoding table
+ *
+ * @return Position after the tree description, nullptr if invalid
+ */
+static __device__ const uint8_t *decode_huffman_tree(unzstd_state_s *s,
+                                                     const uint8_t *cur,
+                                                     const uint8_t *end)
+{
+  uint8_t *weights = s->weights;
+  uint32_t num_weights, hdr, weight_sum, max_bits, left_over;
+  uint32_t rank_count[zstd_max_huf_bits + 1] = {0};
+  uint32_t rank_idx[zstd_max_huf_bits + 1];
+  if (cur >= end) { return nullptr; }
+  hdr = *cur++;
+  if (hdr >= 128) {
+    // Weights stored as 4-bit values
+    num_weights = hdr - 127;
+    if (cur + ((num_weights + 1) >> 1) > end) { return nullptr; }
+    for (uint32_t i = 0; i < num_weights; i++) {
+      weights[i] = (i & 1) ? cur[i >> 1] & 0xf : cur[i >> 1] >> 4;
+    }
+    cur += (num_weights + 1) >> 1;
+  } else {
+    // FSE-compressed weights, with two interleaved states
+    const uint8_t *hdr_end = cur + hdr;
+    zstd_bitreader_s br;
+    uint32_t log, num_symbols, state1, state2;
+    if (hdr_end > end) { return nullptr; }
+    cur = fse_parse_header(
+      cur, hdr_end, s->norm, zstd_max_huf_bits + 1, zstd_max_huf_weight_log, &log, &num_symbols);
+    if (!cur || !fse_build_table(s->weight_table, s->norm, s->next_state, num_symbols, log) ||
+        !bitreader_init(&br, cur, static_cast<uint32_t>(hdr_end - cur))) {
+      return nullptr;
+    }
+    state1      = bitreader_read(&br, log);
+    state2      = bitreader_read(&br, log);
+    num_weights = 0;
+    for (;;) {
+      fse_entry_s e = s->weight_table[state1];
+      weights[num_weights++] = e.symbol;
+      state1                 = e.base + bitreader_read(&br, e.nbits);
+      if (br.bitpos < 0) {
+        weights[num_weights++] = s->weight_table[state2].symbol;
+        break;
+      }
+      e                      = s->weight_table[state2];
+      weights[num_weights++] = e.symbol;
+      state2                 = e.base + bitreader_read(&br, e.nbits);
+      if (br.bitpos < 0) {
+        weights[num_weights++] = s->weight_table[state1].symbol;
+        break;
+      }
+      if (num_weights > 253) { return nullptr; }
+    }
+    cur = hdr_end;
+  }
+  // The weight of the last symbol is implied by the others summing up to a power of 2
+  weight_sum = 0;
+  for (uint32_t i = 0; i < num_weights; i++) {
+    if (weights[i] > zstd_max_huf_bits) { return nullptr; }
+    weight_sum += (1 << weights[i]) >> 1;
+  }
+  if (weight_sum == 0) { return nullptr; }
+  max_bits  = highest_bit(weight_sum) + 1;
+  left_over = (1 << max_bits) - weight_sum;
+  if (max_bits > zstd_max_huf_bits || (left_over & (left_over - 1)) != 0) { return nullptr; }
+  weights[num_weights++] = highest_bit(left_over) + 1;
+  // Convert weights to code lengths, and fill the table by decreasing code length
+  for (uint32_t i = 0; i < num_weights; i++) {
+    if (weights[i] != 0) { weights[i] = max_bits + 1 - weights[i]; }
+    rank_count[weights[i]]++;
+  }
+  rank_idx[max_bits] = 0;
+  for (uint32_t i = max_bits; i >= 1; i--) {
+    rank_idx[i - 1] = rank_idx[i] + rank_count[i] * (1 << (max_bits - i));
+  }
+  for (uint32_t i = 0; i < num_weights; i++) {
+    uint32_t nbits = weights[i];
+    if (nbits != 0) {
+      uint32_t code = rank_idx[nbits];
+      uint32_t len  = 1 << (max_bits - nbits);
+      for (uint32_t j = 0; j < len; j++) {
+        s->huf_table[code + j] = (i << 4) | nbits;
+      }
+      rank_idx[nbits] = code + len;
+    }
+  }
+  s->huf_bits = max_bits;
+  return cur;
+}
+
+/**
+ * @brief Decodes a single Huffman-compressed literals stream
+ *
+ * @return false if the stream is invalid
+ */
+static __device__ bool decode_huffman_stream(const unzstd_state_s *s,
+                                             uint8_t *dst,
+                                             const uint8_t *src,
+                                             uint32_t src_len,
+                                             uint32_t count)
+{
+  zstd_bitreader_s br;
+  uint32_t max_bits = s->huf_bits;
+  uint32_t mask     = (1 << max_bits) - 1;
+  uint32_t state;
+  if (!bitreader_init(&br, src, src_len)) { return false; }
+  state = bitreader_read(&br, max_bits);
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t e     = s->huf_table[state];
+    uint32_t nbits = e & 0xf;
+    dst[i]         = static_cast<uint8_t>(e >> 4);
+    state          = ((state << nbits) | bitreader_read(&br, nbits)) & mask;
+  }
+  // All the bits of the stream must be consumed, the final state reading past its start
+  return br.bitpos == -static_cast<int32_t>(max_bits);
+}
+
+/**
+ * @brief Parses the literals section of a compressed block
+ *
+ * @return false if the literals section is invalid
+ */
+static __device__ bool decode_literals_header(unzstd_state_s *s)
+{
+  const uint8_t *cur = s->cur;
+  const uint8_t *end = s->block_end;
+  uint32_t b0        = cur[0];
+  uint32_t lit_type  = b0 & 3;
+  uint32_t size_fmt  = (b0 >> 2) & 3;
+  uint32_t avail     = static_cast<uint32_t>(s->out_end - s->out);
+  uint32_t regen_size;
+  s->num_huf_streams = 0;
+  s->huf_error       = 0;
+  s->lit_staged      = (lit_type != zstd_lit_raw);
+  if (lit_type == zstd_lit_raw || lit_type == zstd_lit_rle) {
+    uint32_t hdr_len;
+    if (!(size_fmt & 1)) {
+      regen_size = b0 >> 3;
+      hdr_len    = 1;
+    } else if (size_fmt == 1) {
+      if (cur + 2 > end) { return false; }
+      regen_size = (b0 >> 4) + (cur[1] << 4);
+      hdr_len    = 2;
+    } else {
+      if (cur + 3 > end) { return false; }
+      regen_size = (b0 >> 4) + (cur[1] << 4) + (cur[2] << 12);
+      hdr_len    = 3;
+    }
+    cur += hdr_len;
+    if (lit_type == zstd_lit_raw) {
+      if (cur + regen_size > end) { return false; }
+      s->lit_ptr = cur;
+      cur += regen_size;
+    } else {
+      if (cur >= end || regen_size > avail) { return false; }
+      s->fill_byte = *cur++;
+      s->lit_ptr   = s->out_end - regen_size;
+    }
+  } else {
+    uint32_t hdr_len  = (size_fmt < 2) ? 3 : size_fmt + 2;
+    uint32_t size_len = (size_fmt < 2) ? 10 : size_fmt * 4 + 6;
+    uint32_t num_streams = (size_fmt == 0) ? 1 : 4;
+    uint64_t hdr         = 0;
+    uint32_t comp_size;
+    const uint8_t *comp_end;
+    if (cur + hdr_len > end) { return false; }
+    for (uint32_t i = 0; i < hdr_len; i++) {
+      hdr |= static_cast<uint64_t>(cur[i]) << (i * 8);
+    }
+    regen_size = static_cast<uint32_t>(hdr >> 4) & ((1u << size_len) - 1);
+    comp_size  = static_cast<uint32_t>(hdr >> (4 + size_len)) & ((1u << size_len) - 1);
+    cur += hdr_len;
+    comp_end = cur + comp_size;
+    if (comp_end > end || regen_size > avail) { return false; }
+    if (lit_type == zstd_lit_compressed) {
+      cur = decode_huffman_tree(s, cur, comp_end);
+      if (!cur) { return false; }
+      s->huf_valid = 1;
+    } else if (!s->huf_valid) {
+      return false;
+    }
+    if (num_streams == 1) {
+      s->huf_src[0]     = cur;
+      s->huf_src_len[0] = static_cast<uint32_t>(comp_end - cur);
+      s->huf_dst_len[0] = regen_size;
+    } else {
+      uint32_t seg_len = (regen_size + 3) >> 2;
+      int32_t remaining;
+      if (cur + 6 > comp_end || regen_size < seg_len * 3) { return false; }
+      remaining = static_cast<int32_t>(comp_end - cur) - 6;
+      for (uint32_t i = 0; i < 3; i++) {
+        s->huf_src_len[i] = load_le16(cur + i * 2);
+        remaining -= s->huf_src_len[i];
+      }
+      if (remaining < 0) { return false; }
+      s->huf_src_len[3] = remaining;
+      s->huf_src[0]     = cur + 6;
+      for (uint32_t i = 0; i < 3; i++) {
+        s->huf_src[i + 1]  = s->huf_src[i] + s->huf_src_len[i];
+        s->huf_dst_len[i] = seg_len;
+      }
+      s->huf_dst_len[3] = regen_size - seg_len * 3;
+    }
+    s->num_huf_streams = num_streams;
+    s->lit_ptr         = s->out_end - regen_size;
+    s->huf_dst         = s->out_end - regen_size;
+    cur                = comp_end;
+  }
+  s->lit_len = regen_size;
+  s->cur     = cur;
+  return true;
+}
+
+/**
+ * @brief Sets up the FSE table of one sequence symbol type
+ *
+ * @return Position after the table description, nullptr if invalid
+ */
+static __device__ const uint8_t *decode_seq_table(unzstd_state_s *s,
+                                                  const uint8_t *cur,
+                                                  uint32_t mode,
+                                                  fse_entry_s *table,
+                                                  uint32_t *log,
+                                                  const int16_t *default_norm,
+                                                  uint32_t num_default,
+                                                  uint32_t default_log,
+                                                  uint32_t max_symbols,
+                                                  uint32_t max_log,
+                                                  uint32_t table_bit)
+{
+  uint32_t num_symbols;
+  switch (mode) {
+    case zstd_seq_predefined:
+      for (uint32_t i = 0; i < num_default; i++) {
+        s->norm[i] = default_norm[i];
+      }
+      if (!fse_build_table(table, s->norm, s->next_state, num_default, default_log)) {
+        return nullptr;
+      }
+      *log = default_log;
+      break;
+    case zstd_seq_rle:
+      if (cur >= s->block_end || *cur >= max_symbols) { return nullptr; }
+      table[0].symbol = *cur++;
+      table[0].nbits  = 0;
+      table[0].base   = 0;
+      *log            = 0;
+      break;
+    case zstd_seq_fse:
+      cur = fse_parse_header(cur, s->block_end, s->norm, max_symbols, max_log, log, &num_symbols);
+      if (!cur || !fse_build_table(table, s->norm, s->next_state, num_symbols, *log)) {
+        return nullptr;
+      }
+      break;
+    default:
+      if (!(s->tables_valid & table_bit)) { return nullptr; }
+      break;
+  }
+  s->tables_valid |= table_bit;
+  return cur;
+}
+
+/**
+ * @brief Parses the sequences section header of a compressed block and initializes the FSE states
+ *
+ * @return false if the sequences section is invalid
+ */
+static __device__ bool decode_sequences_header(unzstd_state_s *s)
+{
+  const uint8_t *cur = s->cur;
+  const uint8_t *end = s->block_end;
+  uint32_t num_seq, modes;
+  if (cur >= end) { return false; }
+  num_seq = *cur++;
+  if (num_seq >= 128) {
+    if (num_seq < 255) {
+      if (cur >= end) { return false; }
+      num_seq = ((num_seq - 128) << 8) + *cur++;
+    } else {
+      if (cur + 2 > end) { return false; }
+      num_seq = load_le16(cur) + 0x7f00;
+      cur += 2;
+    }
+  }
+  s->num_seq = num_seq;
+  if (num_seq == 0) { return true; }
+  if (cur >= end) { return false; }
+  modes = *cur++;
+  if (modes & 3) { return false; }
+  cur = decode_seq_table(s,
+                         cur,
+                         modes >> 6,
+                         s->ll_table,
+                         &s->ll_log,
+                         zstd_ll_default_norm,
+                         zstd_num_ll_codes,
+                         zstd_predefined_ll_log,
+                         zstd_num_ll_codes,
+                         zstd_max_ll_log,
+                         1);
+  if (!cur) { return false; }
+  cur = decode_seq_table(s,
+                         cur,
+                         (modes >> 4) & 3,
+                         s->of_table,
+                         &s->of_log,
+                         zstd_of_default_norm,
+                         zstd_num_predefined_of,
+                         zstd_predefined_of_log,
+                         zstd_num_of_codes,
+                         zstd_max_of_log,
+                         2);
+  if (!cur) { return false; }
+  cur = decode_seq_table(s,
+                         cur,
+                         (modes >> 2) & 3,
+                         s->ml_table,
+                         &s->ml_log,
+                         zstd_ml_default_norm,
+                         zstd_num_ml_codes,
+                         zstd_predefined_ml_log,
+                         zstd_num_ml_codes,
+                         zstd_max_ml_log,
+                         4);
+  if (!cur || !bitreader_init(&s->seq_br, cur, static_cast<uint32_t>(end - cur))) {
+    return false;
+  }
+  s->ll_state = bitreader_read(&s->seq_br, s->ll_log);
+  s->of_state = bitreader_read(&s->seq_br, s->of_log);
+  s->ml_state = bitreader_read(&s->seq_br, s->ml_log);
+  return true;
+}
+
+/**
+ * @brief Decodes the next batch of sequences, checking that they stay within the output buffer
+ *
+ * @return false if a sequence is invalid
+ */
+static __device__ bool decode_sequence_batch(unzstd_state_s *s)
+{
+  zstd_bitreader_s br = s->seq_br;
+  uint32_t ll_state   = s->ll_state;
+  uint32_t of_state   = s->of_state;
+  uint32_t ml_state   = s->ml_state;
+  uint32_t rep0 = s->rep[0], rep1 = s->rep[1], rep2 = s->rep[2];
+  uint32_t num_seq    = s->num_seq;
+  uint32_t batch_len  = min(num_seq, zstd_seq_batch_size);
+  uint32_t lit_len    = s->lit_len;
+  bool lit_staged     = s->lit_staged;
+  size_t out_pos      = s->out - s->frame_out;
+  size_t out_limit    = s->out_end - s->frame_out;
+  for (uint32_t i = 0; i < batch_len; i++) {
+    fse_entry_s ll_e = s->ll_table[ll_state];
+    fse_entry_s of_e = s->of_table[of_state];
+    fse_entry_s ml_e = s->ml_table[ml_state];
+    uint32_t ll_code = ll_e.symbol, of_code = of_e.symbol, ml_code = ml_e.symbol;
+    uint32_t offset, ml, ll;
+    if (ll_code >= zstd_num_ll_codes || ml_code >= zstd_num_ml_codes) { return false; }
+    offset = (1u << of_code) + bitreader_read(&br, of_code);
+    ml     = zstd_ml_base[ml_code] + bitreader_read(&br, zstd_ml_bits[ml_code]);
+    ll     = zstd_ll_base[ll_code] + bitreader_read(&br, zstd_ll_bits[ll_code]);
+    if (offset > 3) {
+      offset -= 3;
+      rep2 = rep1;
+      rep1 = rep0;
+      rep0 = offset;
+    } else {
+      // Repeat offsets are shifted by one if the literal length is zero
+      uint32_t idx = offset - 1 + (ll == 0);
+      if (idx == 0) {
+        offset = rep0;
+      } else {
+        offset = (idx == 1) ? rep1 : (idx == 2) ? rep2 : rep0 - 1;
+        if (idx > 1) { rep2 = rep1; }
+        rep1 = rep0;
+        rep0 = offset;
+      }
+    }
+    if (num_seq > i + 1) {
+      ll_state = ll_e.base + bitreader_read(&br, ll_e.nbits);
+      ml_state = ml_e.base + bitreader_read(&br, ml_e.nbits);
+      of_state = of_e.base + bitreader_read(&br, of_e.nbits);
+    }
+    // Literals staged in the output buffer must not be overwritten before being consumed
+    if (ll > lit_len || ll > out_limit - out_pos) { return false; }
+    lit_len -= ll;
+    out_pos += ll;
+    if (offset == 0 || offset > out_pos || ml + (lit_staged ? lit_len : 0) > out_limit - out_pos) {
+      return false;
+    }
+    out_pos += ml;
+    s->seq_ll[i] = ll;
+    s->seq_ml[i] = ml;
+    s->seq_of[i] = offset;
+  }
+  if (num_seq == batch_len && br.bitpos != 0) { return false; }
+  s->seq_br    = br;
+  s->ll_state  = ll_state;
+  s->of_state  = of_state;
+  s->ml_state  = ml_state;
+  s->rep[0]    = rep0;
+  s->rep[1]    = rep1;
+  s->rep[2]    = rep2;
+  s->num_seq   = num_seq - batch_len;
+  s->batch_len = batch_len;
+  return true;
+}
+
+/**
+ * @brief Parses the next block header, and the frame header if at the start of a frame
+ *
+ * @return false if the data is invalid
+ */
+static __device__ bool decode_block_header(unzstd_state_s *s, bool frame_start)
+{
+  const uint8_t *cur = s->cur;
+  const uint8_t *end = s->end;
+  uint32_t hdr, block_size;
+  if (frame_start) {
+    uint32_t magic, fhd, fcs_len, dict_len;
+    uint64_t dict_id = 0;
+    for (;;) {
+      if (cur + 4 > end) { return false; }
+      magic = load_le32(cur);
+      if ((magic & ~0xfu) != zstd_skippable_magic) { break; }
+      if (cur + 8 > end || load_le32(cur + 4) > static_cast<size_t>(end - cur - 8)) {
+        return false;
+      }
+      cur += 8 + load_le32(cur + 4);
+      if (cur == end) {
+        // Nothing but skippable frames left
+        s->cur        = cur;
+        s->block_type = ~0;
+        return true;
+      }
+    }
+    if (magic != zstd_magic || cur + 5 > end) { return false; }
+    fhd = cur[4];
+    cur += 5;
+    if (fhd & 8) { return false; }
+    if (!(fhd & 0x20)) { cur++; }  // Window descriptor
+    dict_len = (fhd & 3) ? 1 << ((fhd & 3) - 1) : 0;
+    fcs_len  = (fhd >> 6) ? 1 << (fhd >> 6) : (fhd >> 5) & 1;
+    if (cur + dict_len + fcs_len > end) { return false; }
+    for (uint32_t i = 0; i < dict_len; i++) {
+      dict_id |= static_cast<uint64_t>(cur[i]) << (i * 8);
+    }
+    if (dict_id != 0) { return false; }  // Dictionaries are not supported
+    cur += dict_len + fcs_len;
+    s->has_checksum = (fhd >> 2) & 1;
+    s->frame_out    = s->out;
+    s->rep[0]       = 1;
+    s->rep[1]       = 4;
+    s->rep[2]       = 8;
+    s->huf_valid    = 0;
+    s->tables_valid = 0;
+  }
+  if (cur + 3 > end) { return false; }
+  hdr        = load_le24(cur);
+  block_size = hdr >> 3;
+  cur += 3;
+  s->last_block = hdr & 1;
+  s->block_type = (hdr >> 1) & 3;
+  s->copy_src   = cur;
+  s->copy_len   = block_size;
+  switch (s->block_type) {
+    case zstd_block_raw:
+      if (block_size > end - cur || block_size > s->out_end - s->out) { return false; }
+      s->fill_byte = 0x100;
+      cur += block_size;
+      break;
+    case zstd_block_rle:
+      if (cur >= end || block_size > s->out_end - s->out) { return false; }
+      s->fill_byte = *cur++;
+      break;
+    case zstd_block_compressed:
+      if (block_size > end - cur || block_size > zstd_max_block_size || block_size == 0) {
+        return false;
+      }
+      s->block_end = cur + block_size;
+      break;
+    default: return false;
+  }
+  s->cur = cur;
+  return true;
+}
+
+/**
+ * @brief Copies or fills bytes with the whole warp
+ *
+ * All source bytes of a 32-byte chunk are read before any of them is written, so the source may be
+ * located after the destination even if they overlap.
+ *
+ * @param dst Destination
+ * @param src Source bytes, or nullptr to fill with fill_byte
+ * @param fill_byte Fill value if src is nullptr
+ * @param len Number of bytes to copy
+ * @param t Thread in warp
+ */
+static __device__ void warp_copy(
+  uint8_t *dst, const uint8_t *src, uint32_t fill_byte, uint32_t len, uint32_t t)
+{
+  for (uint32_t i = 0; i < len; i += 32) {
+    uint32_t b = (src && i + t < len) ? src[i + t] : fill_byte;
+    __syncwarp();
+    if (i + t < len) { dst[i + t] = static_cast<uint8_t>(b); }
+  }
+}
+
+/**
+ * @brief Copies a match with the whole warp
+ *
+ * @param dst Destination
+ * @param offset Match distance
+ * @param len Match length
+ * @param t Thread in warp
+ */
+static __device__ void warp_match_copy(uint8_t *dst, uint32_t offset, uint32_t len, uint32_t t)
+{
+  const uint8_t *src = dst - offset;
+  if (offset >= 32) {
+    for (uint32_t i = 0; i < len; i += 32) {
+      if (i + t < len) { dst[i + t] = src[i + t]; }
+      __syncwarp();
+    }
+  } else {
+    // Short repeating pattern: only read bytes preceding the match
+    for (uint32_t i = t; i < len; i += 32) {
+      dst[i] = src[i % offset];
+    }
+  }
+}
+
+/**
+ * @brief Zstandard decompression kernel
+ * See https://tools.ietf.org/html/rfc8878
+ *
+ * blockDim {32,1,1}
+ *
+ * @param[in] inputs Source/Destination buffer information per block
+ * @param[out] outputs Decompression status per block
+ * @param[in] count Number of blocks to decompress
+ */
+extern "C" __global__ void __launch_bounds__(32)
+  unzstd_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, int count)
+{
+  __shared__ __align__(16) unzstd_state_s state_g;
+
+  unzstd_state_s *const s = &state_g;
+  uint32_t t              = threadIdx.x;
+  bool frame_start        = true;
+
+  if (!t) {
+    s->cur      = static_cast<const uint8_t *>(inputs[blockIdx.x].srcDevice);
+    s->end      = s->cur + inputs[blockIdx.x].srcSize;
+    s->out_base = static_cast<uint8_t *>(inputs[blockIdx.x].dstDevice);
+    s->out      = s->out_base;
+    s->out_end  = s->out_base + inputs[blockIdx.x].dstSize;
+    s->error    = (s->cur >= s->end);
+  }
+  __syncwarp();
+  while (!s->error && s->cur < s->end) {
+    uint32_t block_type;
+    __syncwarp();
+    if (!t) {
+      if (!decode_block_header(s, frame_start) ||
+          (s->block_type == zstd_block_compressed && !decode_literals_header(s))) {
+        s->error = 1;
+      }
+    }
+    __syncwarp();
+    block_type = s->block_type;
+    if (s->error || block_type == ~0u) { break; }
+    if (block_type != zstd_block_compressed) {
+      // Raw or RLE block
+      warp_copy(s->out,
+                (s->fill_byte > 0xff) ? s->copy_src : nullptr,
+                s->fill_byte,
+                s->copy_len,
+                t);
+    } else {
+      if (s->num_huf_streams != 0) {
+        // Huffman-compressed literals, one lane per literal stream
+        for (uint32_t i = t; i < s->num_huf_streams; i += 32) {
+          uint8_t *dst = s->huf_dst;
+          for (uint32_t j = 0; j < i; j++) {
+            dst += s->huf_dst_len[j];
+          }
+          if (!decode_huffman_stream(s, dst, s->huf_src[i], s->huf_src_len[i], s->huf_dst_len[i])) {
+            s->huf_error = 1;
+          }
+        }
+      } else if (s->lit_staged) {
+        // RLE literals
+        warp_copy(const_cast<uint8_t *>(s->lit_ptr), nullptr, s->fill_byte, s->lit_len, t);
+      }
+      __syncwarp();
+      if (!t && (s->huf_error || !decode_sequences_header(s))) { s->error = 1; }
+      __syncwarp();
+      if (s->error) { break; }
+      while (s->num_seq != 0) {
+        uint32_t batch_len;
+        uint8_t *out;
+        const uint8_t *lit_ptr;
+        __syncwarp();
+        if (!t && !decode_sequence_batch(s)) { s->error = 1; }
+        __syncwarp();
+        if (s->error) { break; }
+        batch_len = s->batch_len;
+        out       = s->out;
+        lit_ptr   = s->lit_ptr;
+        for (uint32_t i = 0; i < batch_len; i++) {
+          uint32_t ll = s->seq_ll[i];
+          uint32_t ml = s->seq_ml[i];
+          warp_copy(out, lit_ptr, 0, ll, t);
+          out += ll;
+          lit_ptr += ll;
+          __syncwarp();
+          warp_match_copy(out, s->seq_of[i], ml, t);
+          out += ml;
+          __syncwarp();
+        }
+        if (!t) {
+          s->lit_len -= static_cast<uint32_t>(lit_ptr - s->lit_ptr);
+          s->out     = out;
+          s->lit_ptr = lit_ptr;
+        }
+        __syncwarp();
+      }
+      if (s->error) { break; }
+      // Remaining literals after the last sequence
+      if (s->lit_len > s->out_end - s->out) {
+        if (!t) { s->error = 1; }
+        break;
+      }
+      warp_copy(s->out, s->lit_ptr, 0, s->lit_len, t);
+      __syncwarp();
+      if (!t) {
+        s->copy_len = s->lit_len;
+        s->cur      = s->block_end;
+      }
+    }
+    __syncwarp();
+    if (!t) {
+      s->out += s->copy_len;
+      if (s->last_block && s->has_checksum) {
+        // Skip the content checksum
+        if (s->end - s->cur < 4) { s->error = 1; }
+        s->cur += 4;
+      }
+    }
+    frame_start = s->last_block;
+    __syncwarp();
+  }
+  __syncwarp();
+  if (!t) {
+    if (!frame_start) { s->error = 1; }  // Truncated frame
+    outputs[blockIdx.x].bytes_written = s->out - s->out_base;
+    outputs[blockIdx.x].status        = s->error;
+    outputs[blockIdx.x].reserved      = 0;
+  }
+}
+
+cudaError_t __host__ gpu_unzstd(gpu_inflate_input_s *inputs,
+                                gpu_inflate_status_s *outputs,
+                                int count,
+                                rmm::cuda_stream_view stream)
+{
+  dim3 dim_block(32, 1);  // 1 warp per stream, 1 stream per block
+  dim3 dim_grid(count, 1);
+  if (count > 0) {
+    unzstd_kernel<<<dim_grid, dim_block, 0, stream.value()>>>(inputs, outputs, count);
+  }
+  return cudaSuccess;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace cudf {
+namespace io {
+/**
+ * @brief Decompresses one or more Zstandard frames on the host
+ *
+ * @param[in] input Compressed data
+ * @param[in] inlen Size of the compressed data in bytes
+ * @param[out] dst Destination buffer
+ * @param[in,out] dstlen Size of the destination buffer, updated to the decompressed size
+ *
+ * @return 0 if successful, nonzero if the data is invalid or does not fit in the destination
+ */
+int32_t cpu_unzstd(const uint8_t *input, size_t inlen, uint8_t *dst, size_t *dstlen);
+
+}  // namespace io
+}  // namespace cudf
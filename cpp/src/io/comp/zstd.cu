@@ -0,0 +1,559 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file zstd.cu
+ * @brief Zstandard compression (RFC 8878)
+ *
+ * Each stream is compressed by a single warp into a single frame. Matches are found with 12-bit
+ * hashes of 4-byte blocks, literals are stored uncompressed and sequences are encoded with the
+ * predefined FSE distributions. Blocks that do not compress are stored as raw blocks.
+ */
+
+#include "gpuinflate.h"
+
+#include <io/utilities/block_utils.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#define CONSTANT static const __device__ __constant__
+#include "zstd_tables.h"
+
+namespace cudf {
+namespace io {
+constexpr int zstd_hash_bits           = 12;
+constexpr uint32_t zstd_max_seq        = 1024;     // Maximum number of sequences per block
+constexpr uint32_t zstd_max_window_log = 27;       // Largest window accepted by default decoders
+constexpr uint32_t zstd_max_distance   = 1 << zstd_max_window_log;
+
+/**
+ * @brief FSE encoding transform of a symbol
+ */
+struct fse_symbol_s {
+  int32_t delta_find_state;  ///< Offset of the symbol's states in the state table
+  uint32_t delta_nbits;      ///< Number of bits to output (in upper 16 bits), minus minimum state
+};
+
+/**
+ * @brief FSE encoding table
+ */
+template <int max_log, int num_symbols>
+struct fse_ctable_s {
+  uint16_t state_table[1 << max_log];    ///< Next state, indexed by symbol and current state
+  fse_symbol_s symbols[num_symbols];     ///< Symbol transforms
+};
+
+/**
+ * @brief Bit writer for the sequences bitstream (LSB first)
+ */
+struct zstd_bitwriter_s {
+  uint8_t *dst;        ///< Current output position
+  uint8_t *end;        ///< End of output buffer
+  uint64_t bit_buf;    ///< Pending bits
+  uint32_t bit_count;  ///< Number of pending bits
+};
+
+/**
+ * @brief zstd compressor state
+ */
+struct zstd_state_s {
+  const uint8_t *src;                                                   ///< Uncompressed data
+  uint32_t src_len;                                                     ///< Uncompressed length
+  uint8_t *dst_base;                                                    ///< Compressed output
+  uint8_t *dst;                                                         ///< Current output ptr
+  uint8_t *end;                                                         ///< Output buffer end
+  volatile uint32_t copy_length;                                        ///< Match length
+  volatile uint32_t copy_distance;                                      ///< Match distance
+  fse_ctable_s<zstd_predefined_ll_log, zstd_num_ll_codes> ll_ctable;    ///< Literal lengths
+  fse_ctable_s<zstd_predefined_ml_log, zstd_num_ml_codes> ml_ctable;    ///< Match lengths
+  fse_ctable_s<zstd_predefined_of_log, zstd_num_predefined_of> of_ctable;  ///< Offsets
+  uint8_t spread[1 << zstd_predefined_ml_log];                          ///< Temporary
+  uint32_t seq_ll[zstd_max_seq];                                        ///< Literal lengths
+  uint32_t seq_ml[zstd_max_seq];                                        ///< Match lengths
+  uint32_t seq_of[zstd_max_seq];                                        ///< Match offsets
+  uint32_t hash_map[1 << zstd_hash_bits];                               ///< Position+1 from hash
+};
+
+/// @brief Returns the position of the highest set bit
+inline __device__ uint32_t highest_bit(uint32_t v) { return 31 - __clz(v); }
+
+/**
+ * @brief Builds the FSE encoding table of a predefined distribution
+ */
+template <int max_log, int num_symbols>
+static __device__ void fse_build_ctable(fse_ctable_s<max_log, num_symbols> *ct,
+                                        const int16_t *norm,
+                                        uint8_t *spread)
+{
+  constexpr uint32_t size = 1 << max_log;
+  uint32_t cumul[num_symbols + 1];
+  uint32_t high = size - 1;
+  uint32_t step = (size >> 1) + (size >> 3) + 3;
+  uint32_t pos  = 0;
+  int32_t total = 0;
+  cumul[0]      = 0;
+  for (uint32_t s = 0; s < num_symbols; s++) {
+    if (norm[s] == -1) {
+      cumul[s + 1]   = cumul[s] + 1;
+      spread[high--] = s;
+    } else {
+      cumul[s + 1] = cumul[s] + norm[s];
+    }
+  }
+  // Same symbol spreading as the decoder
+  for (uint32_t s = 0; s < num_symbols; s++) {
+    for (int i = 0; i < norm[s]; i++) {
+      spread[pos] = s;
+      do {
+        pos = (pos + step) & (size - 1);
+      } while (pos > high);
+    }
+  }
+  for (uint32_t u = 0; u < size; u++) {
+    ct->state_table[cumul[spread[u]]++] = size + u;
+  }
+  for (uint32_t s = 0; s < num_symbols; s++) {
+    if (norm[s] == -1 || norm[s] == 1) {
+      ct->symbols[s].delta_nbits      = (max_log << 16) - size;
+      ct->symbols[s].delta_find_state = total - 1;
+      total++;
+    } else if (norm[s] > 1) {
+      uint32_t max_bits_out           = max_log - highest_bit(norm[s] - 1);
+      ct->symbols[s].delta_nbits      = (max_bits_out << 16) - (norm[s] << max_bits_out);
+      ct->symbols[s].delta_find_state = total - norm[s];
+      total += norm[s];
+    }
+  }
+}
+
+/**
+ * @brief Appends up to 31 bits to the sequences bitstream
+ */
+inline __device__ void put_bits(zstd_bitwriter_s *bw, uint32_t v, uint32_t nbits)
+{
+  bw->bit_buf |= static_cast<uint64_t>(v & ((1u << nbits) - 1)) << bw->bit_count;
+  bw->bit_count += nbits;
+  while (bw->bit_count >= 8) {
+    if (bw->dst < bw->end) { *bw->dst = static_cast<uint8_t>(bw->bit_buf); }
+    bw->dst++;
+    bw->bit_buf >>= 8;
+    bw->bit_count -= 8;
+  }
+}
+
+/**
+ * @brief Initializes an FSE state with the first symbol to encode (last symbol to be decoded)
+ */
+template <int max_log, int num_symbols>
+inline __device__ uint32_t fse_init_state(const fse_ctable_s<max_log, num_symbols> *ct,
+                                          uint32_t symbol)
+{
+  fse_symbol_s tt = ct->symbols[symbol];
+  uint32_t nbits  = (tt.delta_nbits + (1 << 15)) >> 16;
+  uint32_t v      = (nbits << 16) - tt.delta_nbits;
+  return ct->state_table[(v >> nbits) + tt.delta_find_state];
+}
+
+/**
+ * @brief Encodes a symbol, outputting the low bits of the current state
+ */
+template <int max_log, int num_symbols>
+inline __device__ uint32_t fse_encode(zstd_bitwriter_s *bw,
+                                      const fse_ctable_s<max_log, num_symbols> *ct,
+                                      uint32_t state,
+                                      uint32_t symbol)
+{
+  fse_symbol_s tt = ct->symbols[symbol];
+  uint32_t nbits  = (state + tt.delta_nbits) >> 16;
+  put_bits(bw, state, nbits);
+  return ct->state_table[(state >> nbits) + tt.delta_find_state];
+}
+
+/// @brief Literal length code
+inline __device__ uint32_t ll_code(uint32_t ll)
+{
+  uint32_t code = zstd_num_ll_codes - 1;
+  if (ll < 16) { return ll; }
+  while (zstd_ll_base[code] > ll) {
+    code--;
+  }
+  return code;
+}
+
+/// @brief Match length code
+inline __device__ uint32_t ml_code(uint32_t ml)
+{
+  uint32_t code = zstd_num_ml_codes - 1;
+  if (ml < 35) { return ml - zstd_min_match; }
+  while (zstd_ml_base[code] > ml) {
+    code--;
+  }
+  return code;
+}
+
+/**
+ * @brief Outputs the sequences section of a compressed block
+ *
+ * @param s Compressor state
+ * @param dst Output position
+ * @param num_seq Number of sequences
+ *
+ * @return Position after the sequences section
+ */
+static __device__ uint8_t *EncodeSequences(zstd_state_s *s, uint8_t *dst, uint32_t num_seq)
+{
+  zstd_bitwriter_s bw;
+  uint32_t ll_state, ml_state, of_state;
+  uint8_t hdr[3];
+  uint32_t hdr_len = 0;
+  if (num_seq < 128) {
+    hdr[hdr_len++] = num_seq;
+  } else {
+    hdr[hdr_len++] = (num_seq >> 8) + 128;
+    hdr[hdr_len++] = num_seq & 0xff;
+  }
+  if (num_seq != 0) { hdr[hdr_len++] = zstd_seq_predefined; }  // LL, OF and ML modes
+  for (uint32_t i = 0; i < hdr_len; i++) {
+    if (dst + i < s->end) { dst[i] = hdr[i]; }
+  }
+  dst += hdr_len;
+  if (num_seq == 0) { return dst; }
+  bw.dst       = dst;
+  bw.end       = s->end;
+  bw.bit_buf   = 0;
+  bw.bit_count = 0;
+  // Sequences are encoded backwards, so that the decoder reads them in order
+  for (int32_t n = num_seq - 1; n >= 0; n--) {
+    uint32_t ll     = s->seq_ll[n];
+    uint32_t ml     = s->seq_ml[n];
+    uint32_t of     = s->seq_of[n] + 3;  // No repeat offsets
+    uint32_t llc    = ll_code(ll);
+    uint32_t mlc    = ml_code(ml);
+    uint32_t ofc    = highest_bit(of);
+    if (n == static_cast<int32_t>(num_seq) - 1) {
+      ml_state = fse_init_state(&s->ml_ctable, mlc);
+      of_state = fse_init_state(&s->of_ctable, ofc);
+      ll_state = fse_init_state(&s->ll_ctable, llc);
+    } else {
+      of_state = fse_encode(&bw, &s->of_ctable, of_state, ofc);
+      ml_state = fse_encode(&bw, &s->ml_ctable, ml_state, mlc);
+      ll_state = fse_encode(&bw, &s->ll_ctable, ll_state, llc);
+    }
+    put_bits(&bw, ll - zstd_ll_base[llc], zstd_ll_bits[llc]);
+    put_bits(&bw, ml - zstd_ml_base[mlc], zstd_ml_bits[mlc]);
+    put_bits(&bw, of, ofc);
+  }
+  put_bits(&bw, ml_state, zstd_predefined_ml_log);
+  put_bits(&bw, of_state, zstd_predefined_of_log);
+  put_bits(&bw, ll_state, zstd_predefined_ll_log);
+  put_bits(&bw, 1, 1);  // End marker, padded to the next byte
+  if (bw.bit_count != 0) { put_bits(&bw, 0, 8 - bw.bit_count); }
+  return bw.dst;
+}
+
+/**
+ * @brief 12-bit hash from four consecutive bytes
+ */
+static inline __device__ uint32_t zstd_hash(uint32_t v)
+{
+  return (v * 2654435761u) >> (32 - zstd_hash_bits);
+}
+
+/**
+ * @brief Fetches four consecutive bytes
+ */
+static inline __device__ uint32_t fetch4(const uint8_t *src)
+{
+  uint32_t src_align    = 3 & reinterpret_cast<uintptr_t>(src);
+  const uint32_t *src32 = reinterpret_cast<const uint32_t *>(src - src_align);
+  uint32_t v            = src32[0];
+  return (src_align) ? __funnelshift_r(v, src32[1], src_align * 8) : v;
+}
+
+/**
+ * @brief Returns mask of any thread in the warp that has a hash value
+ * equal to that of the calling thread
+ */
+static inline __device__ uint32_t HashMatchAny(uint32_t v, uint32_t t)
+{
+#if (__CUDA_ARCH__ >= 700)
+  return __match_any_sync(~0, v);
+#else
+  uint32_t err_map = 0;
+  for (uint32_t i = 0; i < zstd_hash_bits; i++, v >>= 1) {
+    uint32_t b       = v & 1;
+    uint32_t match_b = ballot(b);
+    err_map |= match_b ^ -(int32_t)b;
+  }
+  return ~err_map;
+#endif
+}
+
+/**
+ * @brief Finds the first occurrence of a consecutive 4-byte match in the input sequence
+ *
+ * @param s Compressor state (copy_length set to 4 if a match is found, zero otherwise)
+ * @param src Uncompressed buffer
+ * @param pos0 Position in uncompressed buffer
+ * @param end_pos End of the current block in uncompressed buffer
+ * @param t thread in warp
+ *
+ * @return Number of bytes before first match (literal length)
+ */
+static __device__ uint32_t FindFourByteMatch(
+  zstd_state_s *s, const uint8_t *src, uint32_t pos0, uint32_t end_pos, uint32_t t)
+{
+  uint32_t pos = pos0;
+  uint32_t match_mask, literal_cnt;
+  if (t == 0) { s->copy_length = 0; }
+  do {
+    bool valid4               = (pos + t + 4 <= end_pos);
+    uint32_t data32           = (valid4) ? fetch4(src + pos + t) : 0;
+    uint32_t hash             = (valid4) ? zstd_hash(data32) : 0;
+    uint32_t local_match      = HashMatchAny(hash, t);
+    uint32_t local_match_lane = 31 - __clz(local_match & ((1 << t) - 1));
+    uint32_t local_match_data = shuffle(data32, min(local_match_lane, t));
+    uint32_t offset, match;
+    if (valid4) {
+      if (local_match_lane < t && local_match_data == data32) {
+        match  = 1;
+        offset = pos + local_match_lane;
+      } else {
+        offset = s->hash_map[hash] - 1;  // Wraps around if empty
+        match  = (offset < pos && offset + zstd_max_distance >= pos + t &&
+                 fetch4(src + offset) == data32);
+      }
+    } else {
+      match       = 0;
+      local_match = 0;
+      offset      = pos + t;
+    }
+    match_mask = ballot(match);
+    if (match_mask != 0) {
+      literal_cnt = __ffs(match_mask) - 1;
+      if (t == literal_cnt) {
+        s->copy_distance = pos + t - offset;
+        s->copy_length   = 4;
+      }
+    } else {
+      literal_cnt = 32;
+    }
+    // Update hash up to the first 4 bytes of the copy length
+    local_match &= (literal_cnt >= 31) ? ~0u : (2u << literal_cnt) - 1;
+    if (t <= literal_cnt && t == 31 - __clz(local_match)) { s->hash_map[hash] = pos + t + 1; }
+    pos += literal_cnt;
+  } while (literal_cnt == 32 && pos < end_pos);
+  return min(pos, end_pos) - pos0;
+}
+
+/// @brief Returns the number of matching bytes for two byte sequences up to len bytes
+static __device__ uint32_t MatchLength(const uint8_t *src1,
+                                       const uint8_t *src2,
+                                       uint32_t len,
+                                       uint32_t t)
+{
+  for (uint32_t ofs = 0;; ofs += 32) {
+    uint32_t mismatch = ballot(ofs + t >= len || src1[ofs + t] != src2[ofs + t]);
+    if (mismatch != 0) { return ofs + __ffs(mismatch) - 1; }
+  }
+}
+
+/**
+ * @brief Copies bytes to the output with the whole warp
+ */
+static __device__ void StoreBytes(
+  zstd_state_s *s, uint8_t *dst, const uint8_t *src, uint32_t len, uint32_t t)
+{
+  for (uint32_t i = t; i < len; i += 32) {
+    if (dst + i < s->end) { dst[i] = src[i]; }
+  }
+}
+
+/**
+ * @brief Outputs a compressed block, or a raw block if it doesn't compress
+ *
+ * @param s Compressor state
+ * @param block_start Block start position in uncompressed buffer
+ * @param block_end Block end position in uncompressed buffer
+ * @param num_seq Number of sequences in the block
+ * @param lit_total Number of literal bytes in the block
+ * @param t thread in warp
+ */
+static __device__ void StoreBlock(zstd_state_s *s,
+                                  uint32_t block_start,
+                                  uint32_t block_end,
+                                  uint32_t num_seq,
+                                  uint32_t lit_total,
+                                  uint32_t t)
+{
+  const uint8_t *src = s->src;
+  uint8_t *hdr       = s->dst;
+  uint32_t block_len = block_end - block_start;
+  uint32_t lit_hdr_len = (lit_total < 32) ? 1 : (lit_total < 4096) ? 2 : 3;
+  uint8_t *dst         = hdr + 3 + lit_hdr_len;
+  uint32_t pos         = block_start;
+  uint32_t last        = (block_end == s->src_len);
+  uint32_t block_hdr;
+  // Raw literals section
+  if (t < lit_hdr_len) {
+    uint32_t v = (lit_hdr_len == 1) ? lit_total << 3
+                                    : (lit_total << 4) | ((lit_hdr_len == 2) ? 1 << 2 : 3 << 2);
+    if (hdr + 3 + t < s->end) { hdr[3 + t] = static_cast<uint8_t>(v >> (t * 8)); }
+  }
+  for (uint32_t i = 0; i < num_seq; i++) {
+    uint32_t ll = s->seq_ll[i];
+    StoreBytes(s, dst, src + pos, ll, t);
+    dst += ll;
+    pos += ll + s->seq_ml[i];
+  }
+  StoreBytes(s, dst, src + pos, block_end - pos, t);
+  dst += block_end - pos;
+  __syncwarp();
+  if (t == 0) { s->dst = EncodeSequences(s, dst, num_seq); }
+  __syncwarp();
+  dst = s->dst;
+  if (static_cast<size_t>(dst - hdr - 3) < block_len) {
+    block_hdr = (static_cast<uint32_t>(dst - hdr - 3) << 3) | (zstd_block_compressed << 1) | last;
+  } else {
+    // Store the block uncompressed
+    __syncwarp();
+    StoreBytes(s, hdr + 3, src + block_start, block_len, t);
+    block_hdr = (block_len << 3) | (zstd_block_raw << 1) | last;
+    dst       = hdr + 3 + block_len;
+  }
+  if (t < 3 && hdr + t < s->end) { hdr[t] = static_cast<uint8_t>(block_hdr >> (t * 8)); }
+  __syncwarp();
+  if (t == 0) { s->dst = dst; }
+  __syncwarp();
+}
+
+/**
+ * @brief Zstandard compression kernel (single frame without checksum)
+ * See https://tools.ietf.org/html/rfc8878
+ *
+ * blockDim {32,1,1}
+ *
+ * @param[in] inputs Source/Destination buffer information per block
+ * @param[out] outputs Compression status per block
+ * @param[in] count Number of blocks to compress
+ */
+extern "C" __global__ void __launch_bounds__(32)
+  zstd_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, int count)
+{
+  __shared__ __align__(16) zstd_state_s state_g;
+
+  zstd_state_s *const s = &state_g;
+  uint32_t t            = threadIdx.x;
+  uint32_t block_start  = 0;
+  uint32_t src_len;
+  const uint8_t *src;
+
+  if (!t) {
+    uint8_t *dst     = static_cast<uint8_t *>(inputs[blockIdx.x].dstDevice);
+    uint8_t *end     = dst + inputs[blockIdx.x].dstSize;
+    uint32_t len     = static_cast<uint32_t>(inputs[blockIdx.x].srcSize);
+    uint8_t hdr[14]  = {0x28, 0xb5, 0x2f, 0xfd};
+    uint32_t hdr_len = 5;
+    s->src           = static_cast<const uint8_t *>(inputs[blockIdx.x].srcDevice);
+    s->src_len       = len;
+    s->dst_base      = dst;
+    s->end           = end;
+    // Frame header with the content size: single segment if the window fits default decoders
+    if (len < 256) {
+      hdr[4]          = 0x20;
+      hdr[hdr_len++]  = len;
+    } else if (len < 0x10000 + 256) {
+      hdr[4]          = 0x60;
+      hdr[hdr_len++]  = (len - 256);
+      hdr[hdr_len++]  = (len - 256) >> 8;
+    } else {
+      hdr[4] = 0xa0;
+      if (len > zstd_max_distance) {
+        hdr[4]         = 0x80;
+        hdr[hdr_len++] = (zstd_max_window_log - 10) << 3;
+      }
+      for (uint32_t i = 0; i < 4; i++) {
+        hdr[hdr_len++] = len >> (i * 8);
+      }
+    }
+    for (uint32_t i = 0; i < hdr_len; i++) {
+      if (dst + i < end) { dst[i] = hdr[i]; }
+    }
+    s->dst = dst + hdr_len;
+    fse_build_ctable(&s->ll_ctable, zstd_ll_default_norm, s->spread);
+    fse_build_ctable(&s->ml_ctable, zstd_ml_default_norm, s->spread);
+    fse_build_ctable(&s->of_ctable, zstd_of_default_norm, s->spread);
+  }
+  for (uint32_t i = t; i < (1 << zstd_hash_bits); i += 32) {
+    s->hash_map[i] = 0;
+  }
+  __syncwarp();
+  src     = s->src;
+  src_len = s->src_len;
+  do {
+    uint32_t max_end   = min(block_start + zstd_max_block_size, src_len);
+    uint32_t pos       = block_start;
+    uint32_t num_seq   = 0;
+    uint32_t lit_len   = 0;
+    uint32_t lit_total = 0;
+    while (pos < max_end && num_seq < zstd_max_seq) {
+      uint32_t literal_len = FindFourByteMatch(s, src, pos, max_end, t);
+      uint32_t copy_len;
+      __syncwarp();
+      copy_len = s->copy_length;
+      lit_len += literal_len;
+      lit_total += literal_len;
+      if (copy_len != 0) {
+        uint32_t match_pos = pos + literal_len + copy_len;
+        uint32_t distance  = s->copy_distance;
+        copy_len +=
+          MatchLength(src + match_pos, src + match_pos - distance, max_end - match_pos, t);
+        if (t == 0) {
+          s->seq_ll[num_seq] = lit_len;
+          s->seq_ml[num_seq] = copy_len;
+          s->seq_of[num_seq] = distance;
+        }
+        num_seq++;
+        lit_len = 0;
+      }
+      pos += literal_len + copy_len;
+      __syncwarp();
+    }
+    StoreBlock(s, block_start, pos, num_seq, lit_total, t);
+    block_start = pos;
+  } while (block_start < src_len);
+  if (!t) {
+    outputs[blockIdx.x].bytes_written = s->dst - s->dst_base;
+    outputs[blockIdx.x].status        = (s->dst > s->end) ? 1 : 0;
+    outputs[blockIdx.x].reserved      = 0;
+  }
+}
+
+cudaError_t __host__ gpu_zstd(gpu_inflate_input_s *inputs,
+                              gpu_inflate_status_s *outputs,
+                              int count,
+                              rmm::cuda_stream_view stream)
+{
+  dim3 dim_block(32, 1);  // 1 warp per stream, 1 stream per block
+  dim3 dim_grid(count, 1);
+  if (count > 0) {
+    zstd_kernel<<<dim_grid, dim_block, 0, stream.value()>>>(inputs, outputs, count);
+  }
+  return cudaSuccess;
+}
+
+}  // namespace io
+}  // namespace cudf
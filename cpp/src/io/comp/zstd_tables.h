@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file zstd_tables.h
+ * @brief Constants and predefined tables of the Zstandard format
+ * See https://tools.ietf.org/html/rfc8878
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#ifndef CONSTANT
+#define CONSTANT static const
+#endif
+
+namespace cudf {
+namespace io {
+constexpr uint32_t zstd_magic            = 0xfd2fb528;
+constexpr uint32_t zstd_skippable_magic  = 0x184d2a50;  // Low 4 bits are user-defined
+constexpr uint32_t zstd_max_block_size   = 128 * 1024;
+constexpr int zstd_min_match             = 3;
+constexpr int zstd_max_huf_bits          = 11;
+constexpr int zstd_max_huf_weight_log    = 6;
+constexpr int zstd_max_ll_log            = 9;
+constexpr int zstd_max_ml_log            = 9;
+constexpr int zstd_max_of_log            = 8;
+constexpr int zstd_num_ll_codes          = 36;
+constexpr int zstd_num_ml_codes          = 53;
+constexpr int zstd_num_of_codes          = 32;
+constexpr int zstd_predefined_ll_log     = 6;
+constexpr int zstd_predefined_ml_log     = 6;
+constexpr int zstd_predefined_of_log     = 5;
+constexpr int zstd_num_predefined_of     = 29;
+
+/// Block types
+enum { zstd_block_raw = 0, zstd_block_rle = 1, zstd_block_compressed = 2 };
+
+/// Literals block types
+enum { zstd_lit_raw = 0, zstd_lit_rle = 1, zstd_lit_compressed = 2, zstd_lit_treeless = 3 };
+
+/// Sequence symbol compression modes
+enum { zstd_seq_predefined = 0, zstd_seq_rle = 1, zstd_seq_fse = 2, zstd_seq_repeat = 3 };
+
+/// Literal length code baselines
+CONSTANT uint32_t zstd_ll_base[zstd_num_ll_codes] = {
+  0,  1,  2,  3,  4,  5,  6,   7,   8,   9,   10,   11,   12,   13,   14,    15,    16,    18,
+  20, 22, 24, 28, 32, 40, 48,  64,  128, 256, 512,  1024, 2048, 4096, 8192,  16384, 32768, 65536};
+
+/// Literal length code extra bits
+CONSTANT uint8_t zstd_ll_bits[zstd_num_ll_codes] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 3, 4, 6, 7, 8, 9, 10, 11, 12,
+  13, 14, 15, 16};
+
+/// Match length code baselines
+CONSTANT uint32_t zstd_ml_base[zstd_num_ml_codes] = {
+  3,  4,  5,  6,  7,  8,  9,  10,  11,  12,  13,   14,   15,   16,   17,    18,    19,    20,
+  21, 22, 23, 24, 25, 26, 27, 28,  29,  30,  31,   32,   33,   34,   35,    37,    39,    41,
+  43, 47, 51, 59, 67, 83, 99, 131, 259, 515, 1027, 2051, 4099, 8195, 16387, 32771, 65539};
+
+/// Match length code extra bits
+CONSTANT uint8_t zstd_ml_bits[zstd_num_ml_codes] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 2, 2, 3, 3, 4, 4, 5, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+
+/// Predefined literal length distribution (accuracy log 6)
+CONSTANT int16_t zstd_ll_default_norm[zstd_num_ll_codes] = {
+  4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 1, 1, 1, 1, 1,
+  -1, -1, -1, -1};
+
+/// Predefined match length distribution (accuracy log 6)
+CONSTANT int16_t zstd_ml_default_norm[zstd_num_ml_codes] = {
+  1, 4, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, -1, -1};
+
+/// Predefined offset code distribution (accuracy log 5)
+CONSTANT int16_t zstd_of_default_norm[zstd_num_predefined_of] = {
+  1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1};
+
+}  // namespace io
+}  // namespace cudf
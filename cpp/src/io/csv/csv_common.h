@@ -31,7 +31,7 @@ namespace column_parse {
 enum : uint8_t {
   disabled       = 0,   ///< data is not read
   enabled        = 1,   ///< data is read and parsed as usual
-  inferred       = 2,   ///< infer the dtype
+  inferred       = 2,   ///< dtype inferred from a sample of the rows; verify the other rows
   as_default     = 4,   ///< no special decoding
   as_hexadecimal = 8,   ///< decode with base-16
   as_datetime    = 16,  ///< decode as date and/or time
@@ -147,6 +147,126 @@ __device__ __inline__ bool is_floatingpoint(
   return true;
 }
 
+/**
+ * @brief Returns the type histogram counter that a field contributes to during type detection
+ *
+ * @param opts A set of parsing options
+ * @param field_start Start of the field
+ * @param field_end End of the field
+ * @param flags Parsing flags of the field's column
+ * @param stats Type histogram of the field's column
+ *
+ * @return Pointer to the counter of `stats` to increment
+ */
+__device__ cudf::size_type *field_type_counter(parse_options_view const &opts,
+                                               char const *field_start,
+                                               char const *field_end,
+                                               column_parse::flags flags,
+                                               column_type_histogram &stats)
+{
+  auto const field_len = static_cast<size_t>(field_end - field_start);
+  if (serialized_trie_contains(opts.trie_na, {field_start, field_len})) {
+    return &stats.null_count;
+  } else if (serialized_trie_contains(opts.trie_true, {field_start, field_len}) ||
+             serialized_trie_contains(opts.trie_false, {field_start, field_len})) {
+    return &stats.bool_count;
+  } else if (cudf::io::is_infinity(field_start, field_end)) {
+    return &stats.float_count;
+  }
+  long countNumber   = 0;
+  long countDecimal  = 0;
+  long countSlash    = 0;
+  long countDash     = 0;
+  long countPlus     = 0;
+  long countColon    = 0;
+  long countString   = 0;
+  long countExponent = 0;
+
+  // Modify field_start & end to ignore whitespace and quotechars
+  // This could possibly result in additional empty fields
+  auto const trimmed_field_range = trim_whitespaces_quotes(field_start, field_end);
+  auto const trimmed_field_len   = trimmed_field_range.second - trimmed_field_range.first;
+
+  for (auto cur = trimmed_field_range.first; cur < trimmed_field_range.second; ++cur) {
+    if (is_digit(*cur)) {
+      countNumber++;
+      continue;
+    }
+    // Looking for unique characters that will help identify column types.
+    switch (*cur) {
+      case '.': countDecimal++; break;
+      case '-': countDash++; break;
+      case '+': countPlus++; break;
+      case '/': countSlash++; break;
+      case ':': countColon++; break;
+      case 'e':
+      case 'E':
+        if (cur > trimmed_field_range.first && cur < trimmed_field_range.second - 1)
+          countExponent++;
+        break;
+      default: countString++; break;
+    }
+  }
+
+  // Integers have to have the length of the string
+  // Off by one if they start with a minus sign
+  auto const int_req_number_cnt =
+    trimmed_field_len -
+    ((*trimmed_field_range.first == '-' || *trimmed_field_range.first == '+') &&
+     trimmed_field_len > 1);
+
+  if (flags & column_parse::as_datetime) {
+    // PANDAS uses `object` dtype if the date is unparseable
+    if (is_datetime(countString, countDecimal, countColon, countDash, countSlash)) {
+      return &stats.datetime_count;
+    }
+    return &stats.string_count;
+  } else if (countNumber == int_req_number_cnt) {
+    auto const is_negative = (*trimmed_field_range.first == '-');
+    auto const data_begin =
+      trimmed_field_range.first + (is_negative || (*trimmed_field_range.first == '+'));
+    return cudf::io::gpu::infer_integral_field_counter(
+      data_begin, data_begin + countNumber, is_negative, stats);
+  } else if (is_floatingpoint(trimmed_field_len,
+                              countNumber,
+                              countDecimal,
+                              countDash + countPlus,
+                              countExponent)) {
+    return &stats.float_count;
+  }
+  return &stats.string_count;
+}
+
+/**
+ * @brief Returns true if a field of a column whose type was inferred from a sample of the rows
+ * could have changed the type inferred from all rows
+ *
+ * @param type Type inferred from the sample
+ * @param stats Type histogram holding only the field
+ */
+__device__ bool is_sampled_type_mismatch(cudf::type_id type, column_type_histogram const &stats)
+{
+  auto const is_string_or_datetime = stats.string_count != 0 || stats.datetime_count != 0;
+  switch (type) {
+    // The sample only held nulls
+    case cudf::type_id::INT8: return stats.null_count == 0;
+    // The inferred timestamp type may have been overridden by the user
+    case cudf::type_id::TIMESTAMP_DAYS:
+    case cudf::type_id::TIMESTAMP_SECONDS:
+    case cudf::type_id::TIMESTAMP_MILLISECONDS:
+    case cudf::type_id::TIMESTAMP_MICROSECONDS:
+    case cudf::type_id::TIMESTAMP_NANOSECONDS: return stats.string_count != 0;
+    case cudf::type_id::BOOL8: return is_string_or_datetime;
+    case cudf::type_id::FLOAT64: return is_string_or_datetime || stats.bool_count != 0;
+    // Any other value, including a null, changes the type of an integer column
+    case cudf::type_id::INT64:
+      return stats.negative_small_int_count == 0 && stats.positive_small_int_count == 0;
+    case cudf::type_id::UINT64:
+      return stats.positive_small_int_count == 0 && stats.big_int_count == 0;
+    default: return false;
+  }
+}
+
 /*
  * @brief CUDA kernel that parses and converts CSV data into cuDF column data.
  *
@@ -157,6 +277,7 @@ __device__ __inline__ bool is_floatingpoint(
  * @param csv_text The entire CSV data to read
  * @param column_flags Per-column parsing behavior flags
  * @param row_offsets The start the CSV data of interest
+ * @param row_stride Only every `row_stride`-th row is processed
  * @param d_columnData The count for each column data type
  */
 __global__ void __launch_bounds__(csvparse_block_dim)
@@ -164,13 +285,14 @@ __global__ void __launch_bounds__(csvparse_block_dim)
                       device_span<char const> csv_text,
                       device_span<column_parse::flags const> const column_flags,
                       device_span<uint64_t const> const row_offsets,
+                      size_t row_stride,
                       device_span<column_type_histogram> d_columnData)
 {
   auto const raw_csv = csv_text.data();
 
   // ThreadIds range per block, so also need the blockId
   // This is entry into the fields; threadId is an element within `num_records`
-  long const rec_id      = threadIdx.x + (blockDim.x * blockIdx.x);
+  long const rec_id      = (threadIdx.x + (blockDim.x * blockIdx.x)) * row_stride;
   long const rec_id_next = rec_id + 1;
 
   // we can have more threads than data, make sure we are not past the end of
@@ -190,81 +312,9 @@ __global__ void __launch_bounds__(csvparse_block_dim)
 
     // Checking if this is a column that the user wants --- user can filter columns
     if (column_flags[col] & column_parse::enabled) {
-      // points to last character in the field
-      auto const field_len = static_cast<size_t>(next_delimiter - field_start);
-      if (serialized_trie_contains(opts.trie_na, {field_start, field_len})) {
-        atomicAdd(&d_columnData[actual_col].null_count, 1);
-      } else if (serialized_trie_contains(opts.trie_true, {field_start, field_len}) ||
-                 serialized_trie_contains(opts.trie_false, {field_start, field_len})) {
-        atomicAdd(&d_columnData[actual_col].bool_count, 1);
-      } else if (cudf::io::is_infinity(field_start, next_delimiter)) {
-        atomicAdd(&d_columnData[actual_col].float_count, 1);
-      } else {
-        long countNumber   = 0;
-        long countDecimal  = 0;
-        long countSlash    = 0;
-        long countDash     = 0;
-        long countPlus     = 0;
-        long countColon    = 0;
-        long countString   = 0;
-        long countExponent = 0;
-
-        // Modify field_start & end to ignore whitespace and quotechars
-        // This could possibly result in additional empty fields
-        auto const trimmed_field_range = trim_whitespaces_quotes(field_start, next_delimiter);
-        auto const trimmed_field_len   = trimmed_field_range.second - trimmed_field_range.first;
-
-        for (auto cur = trimmed_field_range.first; cur < trimmed_field_range.second; ++cur) {
-          if (is_digit(*cur)) {
-            countNumber++;
-            continue;
-          }
-          // Looking for unique characters that will help identify column types.
-          switch (*cur) {
-            case '.': countDecimal++; break;
-            case '-': countDash++; break;
-            case '+': countPlus++; break;
-            case '/': countSlash++; break;
-            case ':': countColon++; break;
-            case 'e':
-            case 'E':
-              if (cur > trimmed_field_range.first && cur < trimmed_field_range.second - 1)
-                countExponent++;
-              break;
-            default: countString++; break;
-          }
-        }
-
-        // Integers have to have the length of the string
-        // Off by one if they start with a minus sign
-        auto const int_req_number_cnt = trimmed_field_len - ((*trimmed_field_range.first == '-' ||
-                                                              *trimmed_field_range.first == '+') &&
-                                                             trimmed_field_len > 1);
-
-        if (column_flags[col] & column_parse::as_datetime) {
-          // PANDAS uses `object` dtype if the date is unparseable
-          if (is_datetime(countString, countDecimal, countColon, countDash, countSlash)) {
-            atomicAdd(&d_columnData[actual_col].datetime_count, 1);
-          } else {
-            atomicAdd(&d_columnData[actual_col].string_count, 1);
-          }
-        } else if (countNumber == int_req_number_cnt) {
-          auto const is_negative = (*trimmed_field_range.first == '-');
-          auto const data_begin =
-            trimmed_field_range.first + (is_negative || (*trimmed_field_range.first == '+'));
-          cudf::size_type *ptr = cudf::io::gpu::infer_integral_field_counter(
-            data_begin, data_begin + countNumber, is_negative, d_columnData[actual_col]);
-          atomicAdd(ptr, 1);
-        } else if (is_floatingpoint(trimmed_field_len,
-                                    countNumber,
-                                    countDecimal,
-                                    countDash + countPlus,
-                                    countExponent)) {
-          atomicAdd(&d_columnData[actual_col].float_count, 1);
-        } else {
-          atomicAdd(&d_columnData[actual_col].string_count, 1);
-        }
-      }
+      atomicAdd(field_type_counter(
+                  opts, field_start, next_delimiter, column_flags[col], d_columnData[actual_col]),
+                1);
       actual_col++;
     }
     next_field  = next_delimiter + 1;
@@ -530,6 +580,8 @@ struct decode_op {
  * @param[out] data The output column data
  * @param[out] valid The bitmaps indicating whether column fields are valid
  * @param[out] num_valid The numbers of valid fields in columns
+ * @param[out] type_mismatches Set for the columns with the `inferred` flag that hold a value
+ * that does not fit the type inferred from a sample of the rows
  */
 __global__ void __launch_bounds__(csvparse_block_dim)
   convert_csv_to_cudf(cudf::io::parse_options_view options,
@@ -538,7 +590,8 @@ __global__ void __launch_bounds__(csvparse_block_dim)
                       device_span<uint64_t const> row_offsets,
                       device_span<cudf::data_type const> dtypes,
                       device_span<void *const> columns,
-                      device_span<cudf::bitmask_type *const> valids)
+                      device_span<cudf::bitmask_type *const> valids,
+                      device_span<bool> type_mismatches)
 {
   auto const raw_csv = data.data();
   // thread IDs range per block, so also need the block id.
@@ -561,6 +614,14 @@ __global__ void __launch_bounds__(csvparse_block_dim)
     auto next_delimiter = cudf::io::gpu::seek_field_end(next_field, row_end, options);
 
     if (column_flags[col] & column_parse::enabled) {
+      if (column_flags[col] & column_parse::inferred) {
+        column_type_histogram field_stats{};
+        ++*field_type_counter(options, field_start, next_delimiter, column_flags[col], field_stats);
+        if (is_sampled_type_mismatch(dtypes[actual_col].id(), field_stats)) {
+          type_mismatches[actual_col] = true;
+        }
+      }
+
       // check if the entire field is a NaN string - consistent with pandas
       auto const is_valid = !serialized_trie_contains(
         options.trie_na, {field_start, static_cast<size_t>(next_delimiter - field_start)});
@@ -1014,17 +1075,19 @@ std::vector<column_type_histogram> detect_column_types(
   device_span<column_parse::flags const> const column_flags,
   device_span<uint64_t const> const row_starts,
   size_t const num_active_columns,
+  size_t const row_stride,
   rmm::cuda_stream_view stream)
 {
   // Calculate actual block count to use based on records count
   const int block_size = csvparse_block_dim;
-  const int grid_size  = (row_starts.size() + block_size - 1) / block_size;
+  const int num_rows   = (row_starts.size() + row_stride - 1) / row_stride;
+  const int grid_size  = (num_rows + block_size - 1) / block_size;
 
   auto d_stats =
     detail::make_zeroed_device_uvector_async<column_type_histogram>(num_active_columns, stream);
 
   data_type_detection<<<grid_size, block_size, 0, stream.value()>>>(
-    options, data, column_flags, row_starts, d_stats);
+    options, data, column_flags, row_starts, row_stride, d_stats);
 
   return detail::make_std_vector_sync(d_stats, stream);
 }
@@ -1036,6 +1099,7 @@ void __host__ decode_row_column_data(cudf::io::parse_options_view const &options
                                      device_span<cudf::data_type const> dtypes,
                                      device_span<void *const> columns,
                                      device_span<cudf::bitmask_type *const> valids,
+                                     device_span<bool> type_mismatches,
                                      rmm::cuda_stream_view stream)
 {
   // Calculate actual block count to use based on records count
@@ -1044,7 +1108,7 @@ void __host__ decode_row_column_data(cudf::io::parse_options_view const &options
   auto const grid_size  = (num_rows + block_size - 1) / block_size;
 
   convert_csv_to_cudf<<<grid_size, block_size, 0, stream.value()>>>(
-    options, data, column_flags, row_offsets, dtypes, columns, valids);
+    options, data, column_flags, row_offsets, dtypes, columns, valids, type_mismatches);
 }
 
 uint32_t __host__ gather_row_offsets(const parse_options_view &options,
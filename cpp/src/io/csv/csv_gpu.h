@@ -195,6 +195,8 @@ device_span<uint64_t> remove_blank_rows(const cudf::io::parse_options_view &opti
  * @param[in] data The row-column data
  * @param[in] column_flags Flags that control individual column parsing
  * @param[in] row_offsets List of row data start positions (offsets)
+ * @param[in] num_active_columns Number of columns to detect the dtype of
+ * @param[in] row_stride Only every `row_stride`-th row is sampled; 1 to detect from all rows
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return stats Histogram of each dtypes' occurrence for each column
@@ -205,6 +207,7 @@ std::vector<column_type_histogram> detect_column_types(
   device_span<column_parse::flags const> column_flags,
   device_span<uint64_t const> row_offsets,
   size_t const num_active_columns,
+  size_t const row_stride,
   rmm::cuda_stream_view stream);
 
 /**
@@ -217,6 +220,8 @@ std::vector<column_type_histogram> detect_column_types(
  * @param[in] dtypes List of dtype corresponding to each column
  * @param[out] columns Device memory output of column data
  * @param[out] valids Device memory output of column valids bitmap data
+ * @param[out] type_mismatches Set for each column with the `inferred` flag that holds a value
+ * that does not fit the dtype inferred from a sample of the rows
  * @param[in] stream CUDA stream to use, default 0
  */
 void decode_row_column_data(cudf::io::parse_options_view const &options,
@@ -226,6 +231,7 @@ void decode_row_column_data(cudf::io::parse_options_view const &options,
                             device_span<cudf::data_type const> dtypes,
                             device_span<void *const> columns,
                             device_span<cudf::bitmask_type *const> valids,
+                            device_span<bool> type_mismatches,
                             rmm::cuda_stream_view stream);
 
 }  // namespace gpu
@@ -281,6 +281,59 @@ __inline__ __device__ int32_t to_date(char const* begin, char const* end, bool d
            : -1;
 }
 
+/**
+ * @brief Parses the fixed ISO-8601 layouts `YYYY-MM-DD`, `YYYY-MM-DDTHH:MM:SS` and
+ * `YYYY-MM-DDTHH:MM:SS.sss`, with either 'T' or ' ' between the date and the time.
+ *
+ * These make up most of the timestamps in practice and are read at fixed positions, without
+ * searching for the separators.
+ *
+ * @param[in] begin Pointer to the first element of the string
+ * @param[in] end Pointer to the first element after the string
+ * @param[out] milliseconds Milliseconds since epoch
+ * @return true if the string has one of the layouts, false otherwise
+ */
+__inline__ __device__ bool parse_iso_date_time(char const* begin,
+                                               char const* end,
+                                               int64_t* milliseconds)
+{
+  auto const length = end - begin;
+  if (length != 10 && length != 19 && length != 23) return false;
+
+  auto is_digits = [begin](int pos, int count) {
+    for (int i = pos; i < pos + count; ++i) {
+      if (begin[i] < '0' || begin[i] > '9') return false;
+    }
+    return true;
+  };
+  auto to_int = [begin](int pos, int count) {
+    return to_non_negative_integer<int>(begin + pos, begin + pos + count);
+  };
+  if (!is_digits(0, 4) || begin[4] != '-' || !is_digits(5, 2) || begin[7] != '-' ||
+      !is_digits(8, 2))
+    return false;
+  auto const year  = to_int(0, 4);
+  auto const month = to_int(5, 2);
+  auto const day   = to_int(8, 2);
+  if (length == 10) {
+    *milliseconds = seconds_since_epoch(year, month, day, 0, 0, 0) * 1000;
+    return true;
+  }
+
+  if ((begin[10] != 'T' && begin[10] != ' ') || !is_digits(11, 2) || begin[13] != ':' ||
+      !is_digits(14, 2) || begin[16] != ':' || !is_digits(17, 2))
+    return false;
+  auto millisecond = 0;
+  if (length == 23) {
+    if (begin[19] != '.' || !is_digits(20, 3)) return false;
+    millisecond = to_int(20, 3);
+  }
+  *milliseconds =
+    seconds_since_epoch(year, month, day, to_int(11, 2), to_int(14, 2), to_int(17, 2)) * 1000 +
+    millisecond;
+  return true;
+}
+
 /**
  * @brief Parses a datetime string and computes the number of milliseconds since epoch.
  *
@@ -298,6 +351,8 @@ __inline__ __device__ int64_t to_date_time(char const* begin, char const* end, b
   int hour, minute, second, millisecond = 0;
   int64_t answer = -1;
 
+  if (parse_iso_date_time(begin, end, &answer)) return answer;
+
   // Find end of the date portion
   // TODO: Refactor all the date/time parsing to remove multiple passes over each character because
   // of find() then convert(); that can also avoid the ugliness below.
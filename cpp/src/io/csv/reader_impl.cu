@@ -25,6 +25,7 @@
 #include <io/utilities/parsing_utils.cuh>
 #include <io/utilities/type_conversion.cuh>
 
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/io/types.hpp>
@@ -102,6 +103,43 @@ std::tuple<data_type, column_parse::flags> get_dtype_info(const std::string &dty
   return std::make_tuple(convert_string_to_dtype(dtype), column_parse::as_default);
 }
 
+/**
+ * @brief Returns the dtype of a column, based on the histogram of its detected field types.
+ *
+ * @param[in] stats Histogram of the column's field types
+ * @param[in] num_rows Number of rows the histogram was gathered from
+ *
+ * @return Inferred dtype of the column
+ */
+data_type infer_column_type(column_type_histogram const &stats, size_t num_rows)
+{
+  unsigned long long int_count_total =
+    stats.big_int_count + stats.negative_small_int_count + stats.positive_small_int_count;
+
+  if (static_cast<size_t>(stats.null_count) == num_rows) {
+    // Entire column is NULL; allocate the smallest amount of memory
+    return data_type{cudf::type_id::INT8};
+  } else if (stats.string_count > 0L) {
+    return data_type{cudf::type_id::STRING};
+  } else if (stats.datetime_count > 0L) {
+    return data_type{cudf::type_id::TIMESTAMP_NANOSECONDS};
+  } else if (stats.bool_count > 0L) {
+    return data_type{cudf::type_id::BOOL8};
+  } else if (stats.float_count > 0L ||
+             (stats.float_count == 0L && int_count_total > 0L && stats.null_count > 0L)) {
+    // The second condition has been added to conform to
+    // PANDAS which states that a column of integers with
+    // a single NULL record need to be treated as floats.
+    return data_type{cudf::type_id::FLOAT64};
+  } else if (stats.big_int_count == 0) {
+    return data_type{cudf::type_id::INT64};
+  } else if (stats.big_int_count != 0 && stats.negative_small_int_count != 0) {
+    return data_type{cudf::type_id::STRING};
+  }
+  // Integers are stored as 64-bit to conform to PANDAS
+  return data_type{cudf::type_id::UINT64};
+}
+
 /**
  * @brief Removes the first and Last quote in the string
  */
@@ -223,18 +261,30 @@ reader::impl::select_data_and_row_offsets(rmm::cuda_stream_view stream)
   // Transfer source data to GPU
   if (!source_->is_empty()) {
     auto data_size = (map_range_size != 0) ? map_range_size : source_->size();
-    auto buffer    = source_->host_read(range_offset, data_size);
+    auto buffer    = [&] {
+      stage_range range{"csv::read_source", static_cast<int64_t>(data_size)};
+      return source_->host_read(range_offset, data_size);
+    }();
 
     auto h_data = host_span<char const>(  //
       reinterpret_cast<const char *>(buffer->data()),
       buffer->size());
 
     std::vector<char> h_uncomp_data_owner;
+    std::optional<rmm::device_uvector<char>> d_uncomp_data;
 
-    if (compression_type_ != "none") {
+    // GZIP input is decompressed directly into device memory when possible
+    if (compression_type_ == "gzip") { d_uncomp_data = gpu_uncompress_gzip(h_data, stream); }
+    if (d_uncomp_data.has_value()) {
+      h_data = {};
+    } else if (compression_type_ != "none") {
       h_uncomp_data_owner = get_uncompressed_data(h_data, compression_type_);
       h_data              = h_uncomp_data_owner;
     }
+    auto const d_data    = d_uncomp_data.has_value()
+                             ? device_span<char const>(d_uncomp_data->data(), d_uncomp_data->size())
+                             : device_span<char const>();
+    auto const data_size = d_uncomp_data.has_value() ? d_data.size() : h_data.size();
     // None of the parameters for row selection is used, we are parsing the entire file
     const bool load_whole_file = range_offset == 0 && range_size == 0 && skip_rows <= 0 &&
                                  skip_end_rows <= 0 && num_rows == -1;
@@ -249,8 +299,9 @@ reader::impl::select_data_and_row_offsets(rmm::cuda_stream_view stream)
     // Gather row offsets
     auto data_row_offsets =
       load_data_and_gather_row_offsets(h_data,
+                                       d_data,
                                        data_start_offset,
-                                       (range_size) ? range_size : h_data.size(),
+                                       (range_size) ? range_size : data_size,
                                        (skip_rows > 0) ? skip_rows : 0,
                                        num_rows,
                                        load_whole_file,
@@ -268,9 +319,84 @@ reader::impl::select_data_and_row_offsets(rmm::cuda_stream_view stream)
 table_with_metadata reader::impl::read(rmm::cuda_stream_view stream)
 {
   auto const data_row_offsets = select_data_and_row_offsets(stream);
-  auto const &data            = data_row_offsets.first;
-  auto const &row_offsets     = data_row_offsets.second;
+  return read_rows(data_row_offsets.first, data_row_offsets.second, stream);
+}
 
+void reader::impl::setup_chunking(std::size_t chunk_size)
+{
+  CUDF_EXPECTS(chunk_size > 0, "Chunk size must be positive");
+  CUDF_EXPECTS(opts_.get_byte_range_offset() == 0 && opts_.get_byte_range_size() == 0,
+               "Reading in chunks using `byte range` is unsupported");
+  CUDF_EXPECTS(opts_.get_skiprows() <= 0 && opts_.get_skipfooter() <= 0 && opts_.get_nrows() == -1,
+               "Reading in chunks with row selection is unsupported");
+  CUDF_EXPECTS(compression_type_ == "none", "Reading compressed data in chunks is unsupported");
+
+  chunk_size_ = chunk_size;
+  chunk_pos_  = 0;
+  if (source_->size() != 0) { prefetch_next_chunk(); }
+}
+
+void reader::impl::prefetch_next_chunk()
+{
+  auto const size = std::min(chunk_size_, source_->size() - chunk_pos_);
+  chunk_prefetch_ =
+    std::async(std::launch::async, [source = source_.get(), offset = chunk_pos_, size]() {
+      // Copy on this thread, so that pages of memory-mapped sources are also read ahead
+      auto const buffer = source->host_read(offset, size);
+      auto const data   = reinterpret_cast<char const *>(buffer->data());
+      return std::vector<char>(data, data + buffer->size());
+    });
+  chunk_pos_ += size;
+}
+
+table_with_metadata reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  if (!has_next()) { return {std::make_unique<table>(), {}}; }
+
+  while (true) {
+    if (chunk_prefetch_.valid()) {
+      auto const chunk = chunk_prefetch_.get();
+      chunk_carry_.insert(chunk_carry_.end(), chunk.begin(), chunk.end());
+      // Read the next chunk while this one is parsed
+      if (chunk_pos_ < source_->size()) { prefetch_next_chunk(); }
+    }
+    bool const is_last_chunk = !chunk_prefetch_.valid();
+
+    auto data_row_offsets = load_data_and_gather_row_offsets(
+      chunk_carry_, {}, 0, chunk_carry_.size(), 0, -1, true, stream);
+    auto &row_offsets = data_row_offsets.second;
+
+    // Unless this is the end of the source, the last row may continue in the next chunk; it is
+    // parsed again with the next chunk, which then starts at a row boundary, outside of quotes
+    std::vector<char> next_carry;
+    if (!is_last_chunk) {
+      if (row_offsets.size() <= 2) {
+        // No complete row yet
+        continue;
+      }
+      uint64_t last_row_start = 0;
+      CUDA_TRY(cudaMemcpyAsync(&last_row_start,
+                               row_offsets.data() + row_offsets.size() - 2,
+                               sizeof(uint64_t),
+                               cudaMemcpyDeviceToHost,
+                               stream.value()));
+      stream.synchronize();
+      next_carry.assign(chunk_carry_.begin() + last_row_start, chunk_carry_.end());
+      row_offsets.shrink(row_offsets.size() - 1);
+    }
+    chunk_carry_ = std::move(next_carry);
+
+    auto result = read_rows(data_row_offsets.first, row_offsets, stream);
+    // Following chunks have no header; they use the columns and types of the first chunk
+    header_row_ = -1;
+    return result;
+  }
+}
+
+table_with_metadata reader::impl::read_rows(device_span<char const> data,
+                                            selected_rows_offsets const &row_offsets,
+                                            rmm::cuda_stream_view stream)
+{
   // Exclude the end-of-data row from number of rows with actual data
   num_records_ = std::max(row_offsets.size(), 1ul) - 1;
 
@@ -278,8 +404,8 @@ table_with_metadata reader::impl::read(rmm::cuda_stream_view stream)
   if (not opts_.get_names().empty()) {
     column_flags_.resize(opts_.get_names().size(), column_parse::enabled);
     col_names_ = opts_.get_names();
-  } else {
-    col_names_ = setColumnNames(header_, opts.view(), opts_.get_header(), opts_.get_prefix());
+  } else if (col_names_.empty()) {
+    col_names_ = setColumnNames(header_, opts.view(), header_row_, opts_.get_prefix());
 
     num_actual_cols_ = num_active_cols_ = col_names_.size();
 
@@ -352,12 +478,33 @@ table_with_metadata reader::impl::read(rmm::cuda_stream_view stream)
 
   auto metadata     = table_metadata{};
   auto out_columns  = std::vector<std::unique_ptr<cudf::column>>();
-  auto column_types = gather_column_types(data, row_offsets, stream);
+  auto column_types = chunk_column_types_.empty()
+                        ? gather_column_types(data, row_offsets, stream)
+                        : chunk_column_types_;
+  if (chunk_size_ != 0) { chunk_column_types_ = column_types; }
 
   out_columns.reserve(column_types.size());
 
   if (num_records_ != 0) {
-    auto out_buffers = decode_data(data, row_offsets, column_types, stream);
+    // Flags the columns whose types were inferred from a sample but hold values that don't fit
+    hostdevice_vector<bool> type_mismatches(column_types.size(), stream);
+    std::fill(type_mismatches.host_ptr(), type_mismatches.host_ptr() + column_types.size(), false);
+    type_mismatches.host_to_device(stream);
+
+    auto out_buffers =
+      decode_data(data, row_offsets, column_flags_, column_types, type_mismatches, stream);
+
+    if (std::any_of(column_flags_.begin(), column_flags_.end(), [](auto flags) {
+          return flags & column_parse::inferred;
+        })) {
+      type_mismatches.device_to_host(stream, true);
+      decode_type_mismatches(data, row_offsets, type_mismatches, column_types, out_buffers, stream);
+      // The types are final now; later chunks are converted without verification
+      for (auto &flags : column_flags_) {
+        flags &= ~column_parse::inferred;
+      }
+      if (chunk_size_ != 0) { chunk_column_types_ = column_types; }
+    }
     for (size_t i = 0; i < column_types.size(); ++i) {
       metadata.column_names.emplace_back(out_buffers[i].name);
       if (column_types[i].id() == type_id::STRING && opts.quotechar != '\0' &&
@@ -400,7 +547,8 @@ size_t reader::impl::find_first_row_start(host_span<char const> data)
 }
 
 std::pair<rmm::device_uvector<char>, reader::impl::selected_rows_offsets>
-reader::impl::load_data_and_gather_row_offsets(host_span<char const> data,
+reader::impl::load_data_and_gather_row_offsets(host_span<char const> h_data,
+                                               device_span<char const> d_data_in,
                                                size_t range_begin,
                                                size_t range_end,
                                                size_t skip_rows,
@@ -409,32 +557,36 @@ reader::impl::load_data_and_gather_row_offsets(host_span<char const> data,
                                                rmm::cuda_stream_view stream)
 {
   constexpr size_t max_chunk_bytes = 64 * 1024 * 1024;  // 64MB
-  size_t buffer_size               = std::min(max_chunk_bytes, data.size());
+  // Input that already resides in device memory is copied device-to-device
+  char const *const data = d_data_in.empty() ? h_data.data() : d_data_in.data();
+  size_t const data_size = d_data_in.empty() ? h_data.size() : d_data_in.size();
+  stage_range range{"csv::gather_row_offsets", static_cast<int64_t>(data_size)};
+  size_t buffer_size     = std::min(max_chunk_bytes, data_size);
   size_t max_blocks =
     std::max<size_t>((buffer_size / cudf::io::csv::gpu::rowofs_block_bytes) + 1, 2);
   hostdevice_vector<uint64_t> row_ctx(max_blocks);
-  size_t buffer_pos  = std::min(range_begin - std::min(range_begin, sizeof(char)), data.size());
-  size_t pos         = std::min(range_begin, data.size());
-  size_t header_rows = (opts_.get_header() >= 0) ? opts_.get_header() + 1 : 0;
+  size_t buffer_pos  = std::min(range_begin - std::min(range_begin, sizeof(char)), data_size);
+  size_t pos         = std::min(range_begin, data_size);
+  size_t header_rows = (header_row_ >= 0) ? header_row_ + 1 : 0;
   uint64_t ctx       = 0;
 
   // For compatibility with the previous parser, a row is considered in-range if the
   // previous row terminator is within the given range
-  range_end += (range_end < data.size());
+  range_end += (range_end < data_size);
 
   // Reserve memory by allocating and then resetting the size
   rmm::device_uvector<char> d_data{
-    (load_whole_file) ? data.size() : std::min(buffer_size * 2, data.size()), stream};
+    (load_whole_file) ? data_size : std::min(buffer_size * 2, data_size), stream};
   d_data.resize(0, stream);
   rmm::device_uvector<uint64_t> all_row_offsets{0, stream};
   do {
-    size_t target_pos = std::min(pos + max_chunk_bytes, data.size());
+    size_t target_pos = std::min(pos + max_chunk_bytes, data_size);
     size_t chunk_size = target_pos - pos;
 
     auto const previous_data_size = d_data.size();
     d_data.resize(target_pos - buffer_pos, stream);
     CUDA_TRY(cudaMemcpyAsync(d_data.begin() + previous_data_size,
-                             data.begin() + buffer_pos + previous_data_size,
+                             data + buffer_pos + previous_data_size,
                              target_pos - buffer_pos - previous_data_size,
                              cudaMemcpyDefault,
                              stream.value()));
@@ -448,7 +600,7 @@ reader::impl::load_data_and_gather_row_offsets(host_span<char const> data,
                                                                  chunk_size,
                                                                  pos,
                                                                  buffer_pos,
-                                                                 data.size(),
+                                                                 data_size,
                                                                  range_begin,
                                                                  range_end,
                                                                  skip_rows,
@@ -487,13 +639,13 @@ reader::impl::load_data_and_gather_row_offsets(host_span<char const> data,
                                              chunk_size,
                                              pos,
                                              buffer_pos,
-                                             data.size(),
+                                             data_size,
                                              range_begin,
                                              range_end,
                                              skip_rows,
                                              stream);
       // With byte range, we want to keep only one row out of the specified range
-      if (range_end < data.size()) {
+      if (range_end < data_size) {
         CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
                                  row_ctx.device_ptr(),
                                  num_blocks * sizeof(uint64_t),
@@ -532,7 +684,7 @@ reader::impl::load_data_and_gather_row_offsets(host_span<char const> data,
       }
     }
     pos = target_pos;
-  } while (pos < data.size());
+  } while (pos < data_size);
 
   auto const non_blank_row_offsets =
     io::csv::gpu::remove_blank_rows(opts.view(), d_data, all_row_offsets, stream);
@@ -550,9 +702,15 @@ reader::impl::load_data_and_gather_row_offsets(host_span<char const> data,
 
     const auto header_start = buffer_pos + row_ctx[0];
     const auto header_end   = buffer_pos + row_ctx[1];
-    CUDF_EXPECTS(header_start <= header_end && header_end <= data.size(),
+    CUDF_EXPECTS(header_start <= header_end && header_end <= data_size,
                  "Invalid csv header location");
-    header_.assign(data.begin() + header_start, data.begin() + header_end);
+    header_.resize(header_end - header_start);
+    CUDA_TRY(cudaMemcpyAsync(header_.data(),
+                             data + header_start,
+                             header_.size(),
+                             cudaMemcpyDefault,
+                             stream.value()));
+    stream.synchronize();
     if (header_rows > 0) { row_offsets.erase_first_n(header_rows); }
   }
   // Apply num_rows limit
@@ -566,52 +724,40 @@ std::vector<data_type> reader::impl::gather_column_types(device_span<char const>
                                                          device_span<uint64_t const> row_offsets,
                                                          rmm::cuda_stream_view stream)
 {
+  stage_range range{"csv::infer_column_types",
+                    static_cast<int64_t>(data.size()),
+                    static_cast<int64_t>(num_records_)};
   std::vector<data_type> dtypes;
 
   if (opts_.get_dtypes().empty()) {
     if (num_records_ == 0) {
       dtypes.resize(num_active_cols_, data_type{type_id::EMPTY});
     } else {
+      // Infer the types from rows spread evenly across the data, if requested; the rows that
+      // were not sampled are verified while they are converted
+      auto const sample_rows = static_cast<size_t>(opts_.get_type_inference_sample_rows());
+      auto const num_rows    = static_cast<size_t>(num_records_);
+      auto const row_stride  = (sample_rows == 0) ? 1 : (num_rows + sample_rows - 1) / sample_rows;
+      auto const num_sampled_rows = (num_rows + row_stride - 1) / row_stride;
+      if (row_stride > 1) {
+        for (auto &flags : column_flags_) {
+          if (flags & column_parse::enabled) { flags |= column_parse::inferred; }
+        }
+      }
+
       auto column_stats =
         cudf::io::csv::gpu::detect_column_types(opts.view(),
                                                 data,
                                                 make_device_uvector_async(column_flags_, stream),
                                                 row_offsets,
                                                 num_active_cols_,
+                                                row_stride,
                                                 stream);
 
       stream.synchronize();
 
       for (int col = 0; col < num_active_cols_; col++) {
-        unsigned long long int_count_total = column_stats[col].big_int_count +
-                                             column_stats[col].negative_small_int_count +
-                                             column_stats[col].positive_small_int_count;
-
-        if (column_stats[col].null_count == num_records_) {
-          // Entire column is NULL; allocate the smallest amount of memory
-          dtypes.emplace_back(cudf::type_id::INT8);
-        } else if (column_stats[col].string_count > 0L) {
-          dtypes.emplace_back(cudf::type_id::STRING);
-        } else if (column_stats[col].datetime_count > 0L) {
-          dtypes.emplace_back(cudf::type_id::TIMESTAMP_NANOSECONDS);
-        } else if (column_stats[col].bool_count > 0L) {
-          dtypes.emplace_back(cudf::type_id::BOOL8);
-        } else if (column_stats[col].float_count > 0L ||
-                   (column_stats[col].float_count == 0L && int_count_total > 0L &&
-                    column_stats[col].null_count > 0L)) {
-          // The second condition has been added to conform to
-          // PANDAS which states that a column of integers with
-          // a single NULL record need to be treated as floats.
-          dtypes.emplace_back(cudf::type_id::FLOAT64);
-        } else if (column_stats[col].big_int_count == 0) {
-          dtypes.emplace_back(cudf::type_id::INT64);
-        } else if (column_stats[col].big_int_count != 0 &&
-                   column_stats[col].negative_small_int_count != 0) {
-          dtypes.emplace_back(cudf::type_id::STRING);
-        } else {
-          // Integers are stored as 64-bit to conform to PANDAS
-          dtypes.emplace_back(cudf::type_id::UINT64);
-        }
+        dtypes.emplace_back(infer_column_type(column_stats[col], num_sampled_rows));
       }
     }
   } else {
@@ -685,17 +831,22 @@ std::vector<data_type> reader::impl::gather_column_types(device_span<char const>
   return dtypes;
 }
 
-std::vector<column_buffer> reader::impl::decode_data(device_span<char const> data,
-                                                     device_span<uint64_t const> row_offsets,
-                                                     host_span<data_type const> column_types,
-                                                     rmm::cuda_stream_view stream)
+std::vector<column_buffer> reader::impl::decode_data(
+  device_span<char const> data,
+  device_span<uint64_t const> row_offsets,
+  host_span<column_parse::flags const> column_flags,
+  host_span<data_type const> column_types,
+  device_span<bool> type_mismatches,
+  rmm::cuda_stream_view stream)
 {
+  stage_range range{
+    "csv::decode_data", static_cast<int64_t>(data.size()), static_cast<int64_t>(num_records_)};
   // Alloc output; columns' data memory is still expected for empty dataframe
   std::vector<column_buffer> out_buffers;
   out_buffers.reserve(column_types.size());
 
   for (int col = 0, active_col = 0; col < num_actual_cols_; ++col) {
-    if (column_flags_[col] & column_parse::enabled) {
+    if (column_flags[col] & column_parse::enabled) {
       const bool is_final_allocation = column_types[active_col].id() != type_id::STRING;
       auto out_buffer =
         column_buffer(column_types[active_col],
@@ -711,26 +862,74 @@ std::vector<column_buffer> reader::impl::decode_data(device_span<char const> dat
     }
   }
 
-  thrust::host_vector<void *> h_data(num_active_cols_);
-  thrust::host_vector<bitmask_type *> h_valid(num_active_cols_);
+  thrust::host_vector<void *> h_data(out_buffers.size());
+  thrust::host_vector<bitmask_type *> h_valid(out_buffers.size());
 
-  for (int i = 0; i < num_active_cols_; ++i) {
+  for (size_t i = 0; i < out_buffers.size(); ++i) {
     h_data[i]  = out_buffers[i].data();
     h_valid[i] = out_buffers[i].null_mask();
   }
 
   cudf::io::csv::gpu::decode_row_column_data(opts.view(),
                                              data,
-                                             make_device_uvector_async(column_flags_, stream),
+                                             make_device_uvector_async(column_flags, stream),
                                              row_offsets,
                                              make_device_uvector_async(column_types, stream),
                                              make_device_uvector_async(h_data, stream),
                                              make_device_uvector_async(h_valid, stream),
+                                             type_mismatches,
                                              stream);
 
   return out_buffers;
 }
 
+void reader::impl::decode_type_mismatches(device_span<char const> data,
+                                          device_span<uint64_t const> row_offsets,
+                                          host_span<bool const> type_mismatches,
+                                          std::vector<data_type> &column_types,
+                                          std::vector<column_buffer> &out_buffers,
+                                          rmm::cuda_stream_view stream)
+{
+  // Only parse the columns that hold a value the sampled type does not fit
+  std::vector<column_parse::flags> retry_flags(column_flags_.size(), column_parse::disabled);
+  std::vector<int> retry_cols;
+  for (int col = 0, active_col = 0; col < num_actual_cols_; ++col) {
+    if (column_flags_[col] & column_parse::enabled) {
+      if (type_mismatches[active_col]) {
+        retry_flags[col] = column_flags_[col] & ~column_parse::inferred;
+        retry_cols.push_back(active_col);
+      }
+      active_col++;
+    }
+  }
+  if (retry_cols.empty()) { return; }
+
+  // Infer the types of the columns from all rows; this is at most the first pass that sampling
+  // skipped, run over the affected columns only
+  auto const column_stats =
+    cudf::io::csv::gpu::detect_column_types(opts.view(),
+                                            data,
+                                            make_device_uvector_async(retry_flags, stream),
+                                            row_offsets,
+                                            retry_cols.size(),
+                                            1,
+                                            stream);
+  std::vector<data_type> retry_types;
+  for (auto const &stats : column_stats) {
+    auto type = infer_column_type(stats, num_records_);
+    if (cudf::is_timestamp(type) && opts_.get_timestamp_type().id() != cudf::type_id::EMPTY) {
+      type = opts_.get_timestamp_type();
+    }
+    retry_types.push_back(type);
+  }
+
+  auto retry_buffers = decode_data(data, row_offsets, retry_flags, retry_types, {}, stream);
+  for (size_t i = 0; i < retry_cols.size(); ++i) {
+    column_types[retry_cols[i]] = retry_types[i];
+    out_buffers[retry_cols[i]]  = std::move(retry_buffers[i]);
+  }
+}
+
 /**
  * @brief Create a serialized trie for N/A value matching, based on the options.
  */
@@ -831,6 +1030,7 @@ reader::impl::impl(std::unique_ptr<datasource> source,
                    rmm::mr::device_memory_resource *mr)
   : mr_(mr), source_(std::move(source)), filepath_(filepath), opts_(options)
 {
+  header_row_      = opts_.get_header();
   num_actual_cols_ = opts_.get_names().size();
   num_active_cols_ = num_actual_cols_;
 
@@ -842,6 +1042,8 @@ reader::impl::impl(std::unique_ptr<datasource> source,
   opts = make_parse_options(options);
 }
 
+reader::reader() = default;
+
 // Forward to implementation
 reader::reader(std::vector<std::string> const &filepaths,
                csv_reader_options const &options,
@@ -868,6 +1070,27 @@ reader::~reader() = default;
 // Forward to implementation
 table_with_metadata reader::read(rmm::cuda_stream_view stream) { return _impl->read(stream); }
 
+chunked_reader::chunked_reader(std::size_t chunk_size,
+                               std::vector<std::unique_ptr<datasource>> &&sources,
+                               csv_reader_options const &options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource *mr)
+  : _stream(stream)
+{
+  CUDF_EXPECTS(sources.size() == 1, "Only a single source is currently supported.");
+  _impl = std::make_unique<impl>(std::move(sources[0]), "", options, mr);
+  _impl->setup_chunking(chunk_size);
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk() { return _impl->read_chunk(_stream); }
+
 }  // namespace csv
 }  // namespace detail
 }  // namespace io
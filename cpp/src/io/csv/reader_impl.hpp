@@ -30,6 +30,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <future>
 #include <memory>
 #include <string>
 #include <utility>
@@ -90,6 +91,27 @@ class reader::impl {
    */
   table_with_metadata read(rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Prepares the reader to read the source in chunks, and starts reading the first one
+   *
+   * @param chunk_size Number of source bytes to read and parse per chunk
+   */
+  void setup_chunking(std::size_t chunk_size);
+
+  /**
+   * @brief Returns true if there is data left to read in chunks.
+   */
+  bool has_next() const { return chunk_prefetch_.valid() || !chunk_carry_.empty(); }
+
+  /**
+   * @brief Reads the rows of the next chunk, which end within the data read so far.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
+
  private:
   /**
    * @brief Offsets of CSV rows in device memory, accessed through a shrinkable span.
@@ -140,7 +162,9 @@ class reader::impl {
    * This function scans the input data to record the row offsets (relative to the start of the
    * input data). A row is actually the data/offset between two termination symbols.
    *
-   * @param data Uncompressed input data in host memory
+   * @param h_data Uncompressed input data in host memory
+   * @param d_data_in Uncompressed input data in device memory, used instead of `h_data` if not
+   * empty
    * @param range_begin Only include rows starting after this position
    * @param range_end Only include rows starting before this position
    * @param skip_rows Number of rows to skip from the start
@@ -150,7 +174,8 @@ class reader::impl {
    * @return Input data and row offsets in the device memory
    */
   std::pair<rmm::device_uvector<char>, reader::impl::selected_rows_offsets>
-  load_data_and_gather_row_offsets(host_span<char const> data,
+  load_data_and_gather_row_offsets(host_span<char const> h_data,
+                                   device_span<char const> d_data_in,
                                    size_t range_begin,
                                    size_t range_end,
                                    size_t skip_rows,
@@ -158,6 +183,24 @@ class reader::impl {
                                    bool load_whole_file,
                                    rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Converts the selected rows of the input data to a set of columns.
+   *
+   * @param data Uncompressed input data in device memory
+   * @param row_offsets Offsets of the selected rows, followed by the end of the last row
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_rows(device_span<char const> data,
+                                selected_rows_offsets const &row_offsets,
+                                rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Starts reading the next chunk of the source on a host thread.
+   */
+  void prefetch_next_chunk();
+
   /**
    * @brief Find the start position of the first data row
    *
@@ -181,16 +224,36 @@ class reader::impl {
   /**
    * @brief Converts the row-column data and outputs to column bufferrs.
    *
+   * @param column_flags Per-column parsing flags; only the enabled columns are converted
    * @param column_types Column types
+   * @param type_mismatches Set for the columns whose sampled type does not fit a value
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return list of column buffers of decoded data, or ptr/size in the case of strings.
    */
   std::vector<column_buffer> decode_data(device_span<char const> data,
                                          device_span<uint64_t const> row_offsets,
+                                         host_span<column_parse::flags const> column_flags,
                                          host_span<data_type const> column_types,
+                                         device_span<bool> type_mismatches,
                                          rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Infers the types of the columns flagged in `type_mismatches` from all rows and
+   * converts those columns again.
+   *
+   * @param type_mismatches Per active column, whether its sampled type does not fit all values
+   * @param column_types Column types; updated for the converted columns
+   * @param out_buffers Column buffers; replaced for the converted columns
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void decode_type_mismatches(device_span<char const> data,
+                              device_span<uint64_t const> row_offsets,
+                              host_span<bool const> type_mismatches,
+                              std::vector<data_type> &column_types,
+                              std::vector<column_buffer> &out_buffers,
+                              rmm::cuda_stream_view stream);
+
  private:
   rmm::mr::device_memory_resource *mr_ = nullptr;
   std::unique_ptr<datasource> source_;
@@ -209,6 +272,14 @@ class reader::impl {
   // Intermediate data
   std::vector<std::string> col_names_;
   std::vector<char> header_;
+  int header_row_ = -1;  // Row holding the column names; -1 once it has been read
+
+  // Chunked reading state
+  std::size_t chunk_size_ = 0;                     // Source bytes to read per chunk
+  std::size_t chunk_pos_  = 0;                     // Offset of the next chunk in the source
+  std::future<std::vector<char>> chunk_prefetch_;  // Next chunk, being read
+  std::vector<char> chunk_carry_;                  // Data read but not yet parsed into rows
+  std::vector<data_type> chunk_column_types_;      // Column types resolved by the first chunk
 };
 
 }  // namespace csv
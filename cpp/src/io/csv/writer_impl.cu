@@ -24,11 +24,17 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/copying.hpp>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/detail/combine.hpp>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/utilities.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <io/utilities/pinned_memory_pool.hpp>
+#include <strings/convert/utilities.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
@@ -39,6 +45,8 @@
 #include <thrust/scan.h>
 
 #include <algorithm>
+#include <array>
+#include <future>
 #include <sstream>
 
 namespace cudf {
@@ -245,6 +253,135 @@ struct column_to_strings_fn {
   rmm::cuda_stream_view stream_;
   rmm::mr::device_memory_resource* mr_;
 };
+
+/**
+ * @brief Functor to format the rows of a table as CSV text, one string per row.
+ *
+ * Integer and boolean fields are formatted directly into the output; fields of other types are
+ * expected to be already converted to strings by `column_to_strings_fn`. Null fields are written
+ * as `na_rep`, and every row is followed by the line terminator.
+ */
+struct format_rows_fn {
+  table_device_view const d_table;
+  string_view const d_delimiter;
+  string_view const d_terminator;
+  string_view const d_na_rep;
+  string_view const d_true;
+  string_view const d_false;
+  offset_type* d_offsets{};
+  char* d_chars{};
+
+  __device__ size_type write_string(string_view const& d_str, char* d_buffer)
+  {
+    if (d_buffer) memcpy(d_buffer, d_str.data(), d_str.size_bytes());
+    return d_str.size_bytes();
+  }
+
+  template <typename IntegerType>
+  __device__ size_type write_integer(IntegerType value, char* d_buffer)
+  {
+    return d_buffer ? cudf::strings::detail::integer_to_string(value, d_buffer)
+                    : cudf::strings::detail::count_digits(value);
+  }
+
+  __device__ size_type write_field(column_device_view const& col, size_type idx, char* d_buffer)
+  {
+    if (col.is_null(idx)) return write_string(d_na_rep, d_buffer);
+    switch (col.type().id()) {
+      case type_id::BOOL8: return write_string(col.element<bool>(idx) ? d_true : d_false, d_buffer);
+      case type_id::INT8: return write_integer(col.element<int8_t>(idx), d_buffer);
+      case type_id::INT16: return write_integer(col.element<int16_t>(idx), d_buffer);
+      case type_id::INT32: return write_integer(col.element<int32_t>(idx), d_buffer);
+      case type_id::INT64: return write_integer(col.element<int64_t>(idx), d_buffer);
+      case type_id::UINT8: return write_integer(col.element<uint8_t>(idx), d_buffer);
+      case type_id::UINT16: return write_integer(col.element<uint16_t>(idx), d_buffer);
+      case type_id::UINT32: return write_integer(col.element<uint32_t>(idx), d_buffer);
+      case type_id::UINT64: return write_integer(col.element<uint64_t>(idx), d_buffer);
+      default: return write_string(col.element<string_view>(idx), d_buffer);
+    }
+  }
+
+  __device__ void operator()(size_type idx)
+  {
+    char* d_buffer    = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    offset_type bytes = 0;
+    for (size_type col = 0; col < d_table.num_columns(); ++col) {
+      if (col > 0) bytes += write_string(d_delimiter, d_buffer ? d_buffer + bytes : nullptr);
+      bytes += write_field(d_table.column(col), idx, d_buffer ? d_buffer + bytes : nullptr);
+    }
+    bytes += write_string(d_terminator, d_buffer ? d_buffer + bytes : nullptr);
+
+    if (!d_chars) d_offsets[idx] = bytes;
+  }
+};
+
+/**
+ * @brief Returns true for the column types that `format_rows_fn` formats directly
+ */
+bool is_formatted_in_rows(data_type type)
+{
+  return type.id() == type_id::BOOL8 || cudf::is_integral(type);
+}
+
+/**
+ * @brief Writes buffers of device data to a sink from a host thread.
+ *
+ * Each buffer is copied to one of two pinned host buffers and written out on a host thread, so
+ * the caller can prepare the next buffer on the device while the previous one is being written.
+ * Writes are issued in order.
+ */
+class double_buffered_writer {
+ public:
+  explicit double_buffered_writer(data_sink* sink) : sink_(sink) {}
+
+  // Waits for the last write, so that no write outlives the buffers
+  ~double_buffered_writer()
+  {
+    if (pending_write_.valid()) pending_write_.wait();
+  }
+
+  /**
+   * @brief Starts writing `data`, returning once it has been copied from device memory
+   */
+  void write(device_span<char const> data, rmm::cuda_stream_view stream)
+  {
+    if (data.empty()) return;
+    if (sink_->is_device_write_preferred(data.size())) {
+      finish();
+      sink_->device_write(data.data(), data.size(), stream);
+      return;
+    }
+
+    // The buffer was last written from two writes ago, which completed before the previous one
+    // was started
+    auto& buffer = buffers_[next_buffer_];
+    if (buffer.size() < data.size()) { buffer = pinned_buffer<char>{data.size()}; }
+    CUDA_TRY(cudaMemcpyAsync(
+      buffer.get(), data.data(), data.size(), cudaMemcpyDeviceToHost, stream.value()));
+    stream.synchronize();
+
+    finish();
+    pending_write_ = std::async(std::launch::async,
+                                [sink = sink_, ptr = buffer.get(), size = data.size()]() {
+                                  sink->host_write(ptr, size);
+                                });
+    next_buffer_ ^= 1;
+  }
+
+  /**
+   * @brief Waits for the pending write, rethrowing its exception if it failed
+   */
+  void finish()
+  {
+    if (pending_write_.valid()) pending_write_.get();
+  }
+
+ private:
+  data_sink* sink_;
+  std::array<pinned_buffer<char>, 2> buffers_;
+  int next_buffer_ = 0;
+  std::future<void> pending_write_;
+};
 }  // unnamed namespace
 
 // Forward to implementation
@@ -289,54 +426,38 @@ void writer::impl::write_chunked_begin(table_view const& table,
   }
 }
 
-void writer::impl::write_chunked(strings_column_view const& str_column_view,
-                                 const table_metadata* metadata,
-                                 rmm::cuda_stream_view stream)
+std::unique_ptr<column> writer::impl::format_rows(table_view const& table,
+                                                  rmm::cuda_stream_view stream)
 {
-  // algorithm outline:
-  //
-  //  for_each(strings_column.begin(), strings_column.end(),
-  //           [sink = out_sink_](auto str_row) mutable {
-  //               auto host_buffer = str_row.host_buffer();
-  //               sink->host_write(host_buffer_.data(), host_buffer_.size());
-  //           });//or...sink->device_write(device_buffer,...);
-  //
-  // added line_terminator functionality
-  //
-
-  CUDF_EXPECTS(str_column_view.size() > 0, "Unexpected empty strings column.");
-
-  cudf::string_scalar newline{options_.get_line_terminator()};
-  auto p_str_col_w_nl =
-    cudf::strings::detail::join_strings(str_column_view, newline, string_scalar("", false), stream);
-  strings_column_view strings_column{p_str_col_w_nl->view()};
-
-  auto total_num_bytes      = strings_column.chars_size();
-  char const* ptr_all_bytes = strings_column.chars().data<char>();
-
-  if (out_sink_->is_device_write_preferred(total_num_bytes)) {
-    // Direct write from device memory
-    out_sink_->device_write(ptr_all_bytes, total_num_bytes, stream);
-  } else {
-    // copy the bytes to host to write them out
-    thrust::host_vector<char> h_bytes(total_num_bytes);
-    CUDA_TRY(cudaMemcpyAsync(h_bytes.data(),
-                             ptr_all_bytes,
-                             total_num_bytes * sizeof(char),
-                             cudaMemcpyDeviceToHost,
-                             stream.value()));
-    stream.synchronize();
-
-    out_sink_->host_write(h_bytes.data(), total_num_bytes);
+  stage_range range{"csv::format_rows", -1, table.num_rows()};
+  // Convert the columns that are not formatted directly into the rows to strings
+  column_to_strings_fn converter{options_, stream, rmm::mr::get_current_device_resource()};
+  std::vector<std::unique_ptr<column>> str_columns;
+  std::vector<column_view> row_columns;
+  for (auto const& current_col : table) {
+    if (is_formatted_in_rows(current_col.type())) {
+      row_columns.push_back(current_col);
+    } else {
+      str_columns.push_back(cudf::type_dispatcher(current_col.type(), converter, current_col));
+      row_columns.push_back(str_columns.back()->view());
+    }
   }
 
-  // Needs newline at the end, to separate from next chunk
-  if (out_sink_->is_device_write_preferred(newline.size())) {
-    out_sink_->device_write(newline.data(), newline.size(), stream);
-  } else {
-    out_sink_->host_write(options_.get_line_terminator().data(),
-                          options_.get_line_terminator().size());
-  }
+  string_scalar delimiter{std::string{options_.get_inter_column_delimiter()}, true, stream};
+  string_scalar terminator{options_.get_line_terminator(), true, stream};
+  string_scalar na_rep{options_.get_na_rep(), true, stream};
+  string_scalar true_value{options_.get_true_value(), true, stream};
+  string_scalar false_value{options_.get_false_value(), true, stream};
+
+  auto d_table = table_device_view::create(table_view{row_columns}, stream);
+  format_rows_fn fn{*d_table,
+                    delimiter.value(stream),
+                    terminator.value(stream),
+                    na_rep.value(stream),
+                    true_value.value(stream),
+                    false_value.value(stream)};
+  auto children = cudf::strings::detail::make_strings_children(fn, table.num_rows(), stream);
+  return std::move(children.second);
 }
 
 void writer::impl::write(table_view const& table,
@@ -380,37 +501,19 @@ void writer::impl::write(table_view const& table,
       vector_views = cudf::split(table, splits);
     }
 
-    // convert each chunk to CSV:
-    //
-    column_to_strings_fn converter{options_, stream, rmm::mr::get_current_device_resource()};
+    // Format each chunk into CSV rows on the device; the write of a chunk overlaps with the
+    // formatting of the next one
+    double_buffered_writer chunk_writer{out_sink_.get()};
     for (auto&& sub_view : vector_views) {
       // Skip if the table has no rows
       if (sub_view.num_rows() == 0) continue;
-      std::vector<std::unique_ptr<column>> str_column_vec;
-
-      // populate vector of string-converted columns:
-      //
-      std::transform(sub_view.begin(),
-                     sub_view.end(),
-                     std::back_inserter(str_column_vec),
-                     [converter](auto const& current_col) {
-                       return cudf::type_dispatcher(current_col.type(), converter, current_col);
-                     });
-
-      // create string table view from str_column_vec:
-      //
-      auto str_table_ptr  = std::make_unique<cudf::table>(std::move(str_column_vec));
-      auto str_table_view = str_table_ptr->view();
-
-      // concatenate columns in each row into one big string column
-      //(using null representation and delimiter):
-      //
-      std::string delimiter_str{options_.get_inter_column_delimiter()};
-      auto str_concat_col = cudf::strings::detail::concatenate(
-        str_table_view, delimiter_str, options_.get_na_rep(), stream);
-
-      write_chunked(str_concat_col->view(), metadata, stream);
+      auto const rows = format_rows(sub_view, stream);
+      stage_range range{"csv::write_rows", rows->size(), sub_view.num_rows()};
+      chunk_writer.write(device_span<char const>{rows->view().data<char>(),
+                                                 static_cast<size_t>(rows->size())},
+                         stream);
     }
+    chunk_writer.finish();
   }
 
   // finalize (no-op, for now, but offers a hook for future extensions):
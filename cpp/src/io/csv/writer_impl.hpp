@@ -80,17 +80,6 @@ class writer::impl {
                            const table_metadata* metadata = nullptr,
                            rmm::cuda_stream_view stream   = rmm::cuda_stream_default);
 
-  /**
-   * @brief Write dataset to CSV format without header.
-   *
-   * @param strings_column Subset of columns converted to string to be written.
-   * @param metadata The metadata associated with the table
-   * @param stream CUDA stream used for device memory operations and kernel launches.
-   */
-  void write_chunked(strings_column_view const& strings_column,
-                     const table_metadata* metadata = nullptr,
-                     rmm::cuda_stream_view stream   = rmm::cuda_stream_default);
-
   /**
    * @brief Write footer of CSV format (typically, empty).
    *
@@ -106,6 +95,16 @@ class writer::impl {
   }
 
  private:
+  /**
+   * @brief Formats the rows of a table as CSV text, each row followed by the line terminator.
+   *
+   * @param table The set of columns
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Characters column holding the formatted rows
+   */
+  std::unique_ptr<column> format_rows(table_view const& table, rmm::cuda_stream_view stream);
+
   std::unique_ptr<data_sink> out_sink_;
   rmm::mr::device_memory_resource* mr_ = nullptr;
   csv_writer_options const options_;
@@ -27,12 +27,19 @@
 #include <cudf/io/detail/orc.hpp>
 #include <cudf/io/detail/parquet.hpp>
 #include <cudf/io/json.hpp>
+#include <cudf/io/memory_resource.hpp>
 #include <cudf/io/orc.hpp>
 #include <cudf/io/orc_metadata.hpp>
 #include <cudf/io/parquet.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <atomic>
+
 namespace cudf {
 namespace io {
 // Returns builder for csv_reader_options
@@ -79,6 +86,13 @@ json_reader_options_builder json_reader_options::builder(source_info const& src)
   return json_reader_options_builder(src);
 }
 
+// Returns builder for json_writer_options
+json_writer_options_builder json_writer_options::builder(sink_info const& sink,
+                                                         table_view const& table)
+{
+  return json_writer_options_builder{sink, table};
+}
+
 // Returns builder for parquet_reader_options
 parquet_reader_options_builder parquet_reader_options::builder(source_info const& src)
 {
@@ -127,6 +141,16 @@ std::unique_ptr<reader> make_reader(source_info const& src_info,
   return std::make_unique<reader>(std::move(datasources), options, mr);
 }
 
+std::vector<std::unique_ptr<datasource>> make_datasources(source_info const& src_info)
+{
+  switch (src_info.type) {
+    case io_type::FILEPATH: return cudf::io::datasource::create(src_info.filepaths);
+    case io_type::HOST_BUFFER: return cudf::io::datasource::create(src_info.buffers);
+    case io_type::USER_IMPLEMENTED: return cudf::io::datasource::create(src_info.user_sources);
+    default: CUDF_FAIL("Unsupported source type");
+  }
+}
+
 template <typename writer, typename... Ts>
 std::unique_ptr<writer> make_writer(sink_info const& sink, Ts&&... args)
 {
@@ -168,6 +192,17 @@ table_with_metadata read_json(json_reader_options const& opts, rmm::mr::device_m
   return reader->read(opts);
 }
 
+// Freeform API wraps the detail writer class API
+void write_json(json_writer_options const& options, rmm::mr::device_memory_resource* mr)
+{
+  namespace json = cudf::io::detail::json;
+
+  CUDF_FUNC_RANGE();
+  auto writer = make_writer<json::writer>(options.get_sink(), options, mr);
+
+  writer->write(options.get_table(), options.get_metadata());
+}
+
 table_with_metadata read_csv(csv_reader_options const& options, rmm::mr::device_memory_resource* mr)
 {
   namespace csv = cudf::io::detail::csv;
@@ -178,6 +213,42 @@ table_with_metadata read_csv(csv_reader_options const& options, rmm::mr::device_
   return reader->read();
 }
 
+/**
+ * @copydoc cudf::io::csv_chunked_reader::csv_chunked_reader
+ */
+csv_chunked_reader::csv_chunked_reader(std::size_t chunk_size,
+                                       csv_reader_options const& options,
+                                       rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<cudf::io::detail::csv::chunked_reader>(
+      chunk_size, make_datasources(options.get_source()), options, rmm::cuda_stream_default, mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::csv_chunked_reader::~csv_chunked_reader
+ */
+csv_chunked_reader::~csv_chunked_reader() = default;
+
+/**
+ * @copydoc cudf::io::csv_chunked_reader::has_next
+ */
+bool csv_chunked_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::csv_chunked_reader::read_chunk
+ */
+table_with_metadata csv_chunked_reader::read_chunk()
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 // Freeform API wraps the detail writer class API
 void write_csv(csv_writer_options const& options, rmm::mr::device_memory_resource* mr)
 {
@@ -350,6 +421,45 @@ table_with_metadata read_orc(orc_reader_options const& options, rmm::mr::device_
   return reader->read(options);
 }
 
+/**
+ * @copydoc cudf::io::orc_chunked_reader::orc_chunked_reader
+ */
+orc_chunked_reader::orc_chunked_reader(std::size_t chunk_read_limit,
+                                       orc_reader_options const& options,
+                                       rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<detail_orc::chunked_reader>(chunk_read_limit,
+                                                        make_datasources(options.get_source()),
+                                                        options,
+                                                        rmm::cuda_stream_default,
+                                                        mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::orc_chunked_reader::~orc_chunked_reader
+ */
+orc_chunked_reader::~orc_chunked_reader() = default;
+
+/**
+ * @copydoc cudf::io::orc_chunked_reader::has_next
+ */
+bool orc_chunked_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::orc_chunked_reader::read_chunk
+ */
+table_with_metadata orc_chunked_reader::read_chunk()
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 /**
  * @copydoc cudf::io::write_orc
  */
@@ -409,6 +519,79 @@ table_with_metadata read_parquet(parquet_reader_options const& options,
   return reader->read(options);
 }
 
+/**
+ * @copydoc cudf::io::read_parquet_metadata
+ */
+std::vector<parquet_metadata> read_parquet_metadata(source_info const& src_info)
+{
+  CUDF_FUNC_RANGE();
+  auto const sources = make_datasources(src_info);
+  return detail_parquet::read_metadata(
+    sources,
+    src_info.type == io_type::FILEPATH ? src_info.filepaths : std::vector<std::string>{});
+}
+
+/**
+ * @copydoc cudf::io::set_parquet_metadata_cache_size
+ */
+void set_parquet_metadata_cache_size(std::size_t max_entries)
+{
+  detail_parquet::set_metadata_cache_size(max_entries);
+}
+
+/**
+ * @copydoc cudf::io::parquet_chunked_reader::parquet_chunked_reader(std::size_t,
+ * parquet_reader_options const&, rmm::mr::device_memory_resource*)
+ */
+parquet_chunked_reader::parquet_chunked_reader(std::size_t chunk_read_limit,
+                                               parquet_reader_options const& options,
+                                               rmm::mr::device_memory_resource* mr)
+  : parquet_chunked_reader(chunk_read_limit, 0, options, mr)
+{
+}
+
+/**
+ * @copydoc cudf::io::parquet_chunked_reader::parquet_chunked_reader(std::size_t, std::size_t,
+ * parquet_reader_options const&, rmm::mr::device_memory_resource*)
+ */
+parquet_chunked_reader::parquet_chunked_reader(std::size_t chunk_read_limit,
+                                               std::size_t pass_read_limit,
+                                               parquet_reader_options const& options,
+                                               rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<detail_parquet::chunked_reader>(chunk_read_limit,
+                                                            pass_read_limit,
+                                                            make_datasources(options.get_source()),
+                                                            options,
+                                                            rmm::cuda_stream_default,
+                                                            mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::parquet_chunked_reader::~parquet_chunked_reader
+ */
+parquet_chunked_reader::~parquet_chunked_reader() = default;
+
+/**
+ * @copydoc cudf::io::parquet_chunked_reader::has_next
+ */
+bool parquet_chunked_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::parquet_chunked_reader::read_chunk
+ */
+table_with_metadata parquet_chunked_reader::read_chunk()
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 /**
  * @copydoc cudf::io::merge_rowgroup_metadata
  */
@@ -458,8 +641,26 @@ parquet_chunked_writer::parquet_chunked_writer(chunked_parquet_writer_options co
                                                rmm::mr::device_memory_resource* mr)
 {
   namespace io_detail = cudf::io::detail;
-  writer              = make_writer<detail_parquet::writer>(
-    op.get_sink(), op, io_detail::SingleWriteMode::NO, mr, rmm::cuda_stream_default);
+  if (op.get_partition_columns().empty()) {
+    writer = make_writer<detail_parquet::writer>(
+      op.get_sink(), op, io_detail::SingleWriteMode::NO, mr, rmm::cuda_stream_default);
+    return;
+  }
+
+  // Without a sink factory, the partition files are created under the root directory
+  auto options = op;
+  if (not options.get_partition_sinks()) {
+    CUDF_EXPECTS(op.get_sink().type == io_type::FILEPATH,
+                 "Partitioned writes require a sink factory or a root directory");
+    boost::filesystem::path const root(op.get_sink().filepath);
+    options.set_partition_sinks([root](std::string const& path) {
+      auto const file_path = root / path;
+      boost::filesystem::create_directories(file_path.parent_path());
+      return cudf::io::data_sink::create(file_path.string());
+    });
+  }
+  writer = std::make_unique<detail_parquet::writer>(
+    nullptr, options, io_detail::SingleWriteMode::NO, mr, rmm::cuda_stream_default);
 }
 
 /**
@@ -484,5 +685,20 @@ std::unique_ptr<std::vector<uint8_t>> parquet_chunked_writer::close(
   return writer->close(column_chunks_file_path);
 }
 
+namespace {
+std::atomic<rmm::mr::device_memory_resource*> temporary_memory_resource{nullptr};
+}  // namespace
+
+rmm::mr::device_memory_resource* set_temporary_memory_resource(rmm::mr::device_memory_resource* mr)
+{
+  return temporary_memory_resource.exchange(mr);
+}
+
+rmm::mr::device_memory_resource* get_temporary_memory_resource()
+{
+  auto const mr = temporary_memory_resource.load();
+  return mr != nullptr ? mr : rmm::mr::get_current_device_resource();
+}
+
 }  // namespace io
 }  // namespace cudf
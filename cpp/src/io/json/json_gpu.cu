@@ -21,6 +21,7 @@
 #include <io/utilities/parsing_utils.cuh>
 
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/detail/utilities/trie.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/lists/list_view.cuh>
@@ -32,11 +33,17 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/device_vector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
 #include <thrust/detail/copy.h>
 #include <thrust/find.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
 
 using cudf::device_span;
 
@@ -542,6 +549,102 @@ __global__ void convert_data_to_columns_kernel(parse_options_view opts,
   }
 }
 
+/**
+ * @brief Returns the type histogram counter that a non-null value contributes to during type
+ * detection.
+ *
+ * @param[in] opts A set of parsing options
+ * @param[in] value_begin Start of the value, with whitespace and quotes trimmed
+ * @param[in] value_end End of the value, with whitespace and quotes trimmed
+ * @param[in] stats Type histogram of the value's column
+ *
+ * @return Pointer to the counter of `stats` to increment
+ */
+__device__ cudf::size_type *value_type_counter(parse_options_view const &opts,
+                                               char const *value_begin,
+                                               char const *value_end,
+                                               cudf::io::column_type_histogram &stats)
+{
+  auto const value_len = static_cast<size_t>(std::max(value_end - value_begin, 0L));
+
+  // Don't need counts to detect strings, any field in quotes is deduced to be a string
+  if (*(value_begin - 1) == opts.quotechar && *value_end == opts.quotechar) {
+    return &stats.string_count;
+  }
+
+  int digit_count    = 0;
+  int decimal_count  = 0;
+  int slash_count    = 0;
+  int dash_count     = 0;
+  int plus_count     = 0;
+  int colon_count    = 0;
+  int exponent_count = 0;
+  int other_count    = 0;
+
+  const bool maybe_hex =
+    ((value_len > 2 && *value_begin == '0' && *(value_begin + 1) == 'x') ||
+     (value_len > 3 && *value_begin == '-' && *(value_begin + 1) == '0' &&
+      *(value_begin + 2) == 'x'));
+  for (auto pos = value_begin; pos < value_end; ++pos) {
+    if (is_digit(*pos, maybe_hex)) {
+      digit_count++;
+      continue;
+    }
+    // Looking for unique characters that will help identify column types
+    switch (*pos) {
+      case '.': decimal_count++; break;
+      case '-': dash_count++; break;
+      case '+': plus_count++; break;
+      case '/': slash_count++; break;
+      case ':': colon_count++; break;
+      case 'e':
+      case 'E':
+        if (!maybe_hex && pos > value_begin && pos < value_end - 1) exponent_count++;
+        break;
+      default: other_count++; break;
+    }
+  }
+
+  // Integers have to have the length of the string
+  int int_req_number_cnt = value_len;
+  // Off by one if they start with a minus sign
+  if ((*value_begin == '-' || *value_begin == '+') && value_len > 1) { --int_req_number_cnt; }
+  // Off by one if they are a hexadecimal number
+  if (maybe_hex) { --int_req_number_cnt; }
+  if (serialized_trie_contains(opts.trie_true, {value_begin, value_len}) ||
+      serialized_trie_contains(opts.trie_false, {value_begin, value_len})) {
+    return &stats.bool_count;
+  } else if (digit_count == int_req_number_cnt) {
+    bool is_negative       = (*value_begin == '-');
+    char const *data_begin = value_begin + (is_negative || (*value_begin == '+'));
+    return cudf::io::gpu::infer_integral_field_counter(
+      data_begin, data_begin + digit_count, is_negative, stats);
+  } else if (is_like_float(
+               value_len, digit_count, decimal_count, dash_count + plus_count, exponent_count)) {
+    return &stats.float_count;
+  }
+  // A date-time field cannot have more than 3 non-special characters
+  // A number field cannot have more than one decimal point
+  else if (other_count > 3 || decimal_count > 1) {
+    return &stats.string_count;
+  } else {
+    // A date field can have either one or two '-' or '\'; A legal combination will only have one
+    // of them To simplify the process of auto column detection, we are not covering all the
+    // date-time formation permutations
+    if ((dash_count > 0 && dash_count <= 2 && slash_count == 0) ||
+        (dash_count == 0 && slash_count > 0 && slash_count <= 2)) {
+      if (colon_count <= 2) {
+        return &stats.datetime_count;
+      } else {
+        return &stats.string_count;
+      }
+    } else {
+      // Default field type is string
+      return &stats.string_count;
+    }
+  }
+}
+
 /**
  * @brief CUDA kernel that processes a buffer of data and determines information about the
  * column types within.
@@ -592,86 +695,8 @@ __global__ void detect_data_types_kernel(
       // here for every valid field.
       atomicAdd(&column_infos[desc.column].null_count, -1);
     }
-    // Don't need counts to detect strings, any field in quotes is deduced to be a string
-    if (*(desc.value_begin - 1) == opts.quotechar && *desc.value_end == opts.quotechar) {
-      atomicAdd(&column_infos[desc.column].string_count, 1);
-      continue;
-    }
-
-    int digit_count    = 0;
-    int decimal_count  = 0;
-    int slash_count    = 0;
-    int dash_count     = 0;
-    int plus_count     = 0;
-    int colon_count    = 0;
-    int exponent_count = 0;
-    int other_count    = 0;
-
-    const bool maybe_hex =
-      ((value_len > 2 && *desc.value_begin == '0' && *(desc.value_begin + 1) == 'x') ||
-       (value_len > 3 && *desc.value_begin == '-' && *(desc.value_begin + 1) == '0' &&
-        *(desc.value_begin + 2) == 'x'));
-    for (auto pos = desc.value_begin; pos < desc.value_end; ++pos) {
-      if (is_digit(*pos, maybe_hex)) {
-        digit_count++;
-        continue;
-      }
-      // Looking for unique characters that will help identify column types
-      switch (*pos) {
-        case '.': decimal_count++; break;
-        case '-': dash_count++; break;
-        case '+': plus_count++; break;
-        case '/': slash_count++; break;
-        case ':': colon_count++; break;
-        case 'e':
-        case 'E':
-          if (!maybe_hex && pos > desc.value_begin && pos < desc.value_end - 1) exponent_count++;
-          break;
-        default: other_count++; break;
-      }
-    }
-
-    // Integers have to have the length of the string
-    int int_req_number_cnt = value_len;
-    // Off by one if they start with a minus sign
-    if ((*desc.value_begin == '-' || *desc.value_begin == '+') && value_len > 1) {
-      --int_req_number_cnt;
-    }
-    // Off by one if they are a hexadecimal number
-    if (maybe_hex) { --int_req_number_cnt; }
-    if (serialized_trie_contains(opts.trie_true, {desc.value_begin, value_len}) ||
-        serialized_trie_contains(opts.trie_false, {desc.value_begin, value_len})) {
-      atomicAdd(&column_infos[desc.column].bool_count, 1);
-    } else if (digit_count == int_req_number_cnt) {
-      bool is_negative       = (*desc.value_begin == '-');
-      char const *data_begin = desc.value_begin + (is_negative || (*desc.value_begin == '+'));
-      cudf::size_type *ptr   = cudf::io::gpu::infer_integral_field_counter(
-        data_begin, data_begin + digit_count, is_negative, column_infos[desc.column]);
-      atomicAdd(ptr, 1);
-    } else if (is_like_float(
-                 value_len, digit_count, decimal_count, dash_count + plus_count, exponent_count)) {
-      atomicAdd(&column_infos[desc.column].float_count, 1);
-    }
-    // A date-time field cannot have more than 3 non-special characters
-    // A number field cannot have more than one decimal point
-    else if (other_count > 3 || decimal_count > 1) {
-      atomicAdd(&column_infos[desc.column].string_count, 1);
-    } else {
-      // A date field can have either one or two '-' or '\'; A legal combination will only have one
-      // of them To simplify the process of auto column detection, we are not covering all the
-      // date-time formation permutations
-      if ((dash_count > 0 && dash_count <= 2 && slash_count == 0) ||
-          (dash_count == 0 && slash_count > 0 && slash_count <= 2)) {
-        if (colon_count <= 2) {
-          atomicAdd(&column_infos[desc.column].datetime_count, 1);
-        } else {
-          atomicAdd(&column_infos[desc.column].string_count, 1);
-        }
-      } else {
-        // Default field type is string
-        atomicAdd(&column_infos[desc.column].string_count, 1);
-      }
-    }
+    atomicAdd(
+      value_type_counter(opts, desc.value_begin, desc.value_end, column_infos[desc.column]), 1);
   }
   if (!are_rows_objects) {
     // For array rows, mark missing fields as null
@@ -745,6 +770,283 @@ __global__ void collect_keys_info_kernel(parse_options_view const options,
   }
 }
 
+
+/**
+ * @brief Path hash of the records; members and elements extend the hash of their parent.
+ */
+constexpr uint32_t record_path_hash = 0;
+
+/**
+ * @brief Hash that extends the path of an array to the path of its elements.
+ */
+constexpr uint32_t array_element_hash = 0x5bd1e995;
+
+/**
+ * @brief Returns the position after the closing quote of the string that starts at `begin`.
+ *
+ * @return `end` if the string is not terminated
+ */
+__device__ char const *seek_string_end(char const *begin, char const *end, char quotechar)
+{
+  for (auto cur = begin + 1; cur < end; ++cur) {
+    if (*cur == '\\') {
+      ++cur;
+    } else if (*cur == quotechar) {
+      return cur + 1;
+    }
+  }
+  return end;
+}
+
+/**
+ * @brief Returns the position after the number or literal that starts at `begin`.
+ */
+__device__ char const *seek_literal_end(char const *begin, char const *end)
+{
+  return thrust::find_if(thrust::seq, begin, end, [] __device__(auto c) {
+    return c == ',' || c == '}' || c == ']' || is_whitespace(c);
+  });
+}
+
+/**
+ * @brief CUDA kernel that splits nested JSON records into their values.
+ *
+ * Data is processed one record at a time. The kernel is launched twice: first without output
+ * nodes, to count the nodes of each record, then to write the nodes at the offsets of their
+ * records.
+ *
+ * @param[in] opts A set of parsing options
+ * @param[in] data The entire data to read
+ * @param[in] row_offsets The offset of each record in the input
+ * @param[in] node_offsets Offset of the first node of each record; nullptr when counting
+ * @param[out] node_counts Number of nodes of each record; nullptr when writing
+ * @param[out] nodes Nodes of all records; nullptr when counting
+ * @param[out] error Set if a record is not a valid JSON object
+ */
+__global__ void tokenize_nested_records_kernel(parse_options_view opts,
+                                               device_span<char const> const data,
+                                               device_span<uint64_t const> const row_offsets,
+                                               size_type const *node_offsets,
+                                               size_type *node_counts,
+                                               json_node *nodes,
+                                               int *error)
+{
+  auto const rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (rec_id >= row_offsets.size()) return;
+
+  auto const row_begin = data.begin() + row_offsets[rec_id];
+  auto const row_end =
+    data.begin() + ((rec_id < row_offsets.size() - 1) ? row_offsets[rec_id + 1] : data.size());
+  auto const row_nodes = (nodes != nullptr) ? nodes + node_offsets[rec_id] : nullptr;
+
+  // Objects and arrays enclosing the current position
+  struct scope {
+    size_type node;
+    uint32_t path_hash;
+    size_type num_children;
+    bool is_array;
+  };
+  scope stack[max_nesting_depth];
+  int depth = 0;
+
+  enum class expect { value, key, delimiter };
+  auto state = expect::value;
+
+  size_type num_nodes   = 0;
+  char const *key_begin = nullptr;
+  uint16_t key_length   = 0;
+  uint32_t key_hash     = 0;
+  bool is_valid         = true;
+
+  // Closes the innermost scope if `c` is its closing bracket
+  auto close_scope = [&](char c) {
+    auto const &top = stack[depth - 1];
+    if (c != (top.is_array ? ']' : '}')) { return false; }
+    if (row_nodes != nullptr && top.is_array) {
+      row_nodes[top.node].num_children = top.num_children;
+    }
+    --depth;
+    return true;
+  };
+
+  auto cur = row_begin;
+  while (true) {
+    cur = thrust::find_if(thrust::seq, cur, row_end, [] __device__(auto c) {
+      return !is_whitespace(c);
+    });
+    if (cur == row_end) {
+      // Blank records have no nodes and are read as nulls
+      is_valid = (depth == 0);
+      break;
+    }
+    auto const c = *cur;
+
+    if (state == expect::value) {
+      // Records must be objects
+      if (depth == 0 && c != '{') {
+        is_valid = false;
+        break;
+      }
+      if (c == ']' && stack[depth - 1].is_array && stack[depth - 1].num_children == 0) {
+        close_scope(c);
+        ++cur;
+        state = expect::delimiter;
+        continue;
+      }
+
+      auto const node_depth = depth;
+      auto const is_member  = depth > 0 && !stack[depth - 1].is_array;
+      auto path_hash        = record_path_hash;
+      size_type parent      = -1;
+      size_type list_index  = 0;
+      if (depth > 0) {
+        auto &top  = stack[depth - 1];
+        parent     = top.node;
+        list_index = top.is_array ? top.num_children : 0;
+        path_hash  = MurmurHash3_32<cudf::string_view>{}.hash_combine(
+          top.path_hash, top.is_array ? array_element_hash : key_hash);
+        ++top.num_children;
+      }
+      auto const node = num_nodes++;
+
+      uint8_t category;
+      char const *value_end;
+      if (c == '{' || c == '[') {
+        if (depth == max_nesting_depth) {
+          is_valid = false;
+          break;
+        }
+        category       = (c == '{') ? node_category::object : node_category::array;
+        stack[depth++] = {node, path_hash, 0, c == '['};
+        value_end      = cur + 1;
+        state          = (c == '{') ? expect::key : expect::value;
+      } else {
+        value_end = (c == opts.quotechar) ? seek_string_end(cur, row_end, opts.quotechar)
+                                          : seek_literal_end(cur, row_end);
+        // Same null values as in flat records, which are compared without quotes
+        auto const trimmed = trim_whitespaces_quotes(cur, value_end, opts.quotechar);
+        auto const is_null = serialized_trie_contains(
+          opts.trie_na,
+          {trimmed.first, static_cast<size_t>(std::max(trimmed.second - trimmed.first, 0L))});
+        category = is_null ? node_category::null : node_category::value;
+        state    = expect::delimiter;
+      }
+
+      if (row_nodes != nullptr) {
+        auto const is_nested = (category & (node_category::object | node_category::array)) != 0;
+        auto &out            = row_nodes[node];
+        out.value_offset     = cur - data.begin();
+        out.key_offset       = is_member ? key_begin - data.begin() : 0;
+        out.value_length     = is_nested ? 0 : static_cast<uint32_t>(value_end - cur);
+        out.path_hash        = path_hash;
+        out.parent           = parent;
+        out.list_index       = list_index;
+        out.num_children     = 0;
+        out.row              = (parent == -1) ? static_cast<size_type>(rec_id) : 0;
+        out.key_length       = is_member ? key_length : 0;
+        out.depth            = node_depth;
+        out.category         = category;
+      }
+      cur = value_end;
+    } else if (state == expect::key) {
+      if (c == '}' && stack[depth - 1].num_children == 0) {
+        close_scope(c);
+        ++cur;
+        state = expect::delimiter;
+        if (depth == 0) { break; }
+        continue;
+      }
+      if (c != opts.quotechar) {
+        is_valid = false;
+        break;
+      }
+      auto const key_end = seek_string_end(cur, row_end, opts.quotechar);
+      key_begin          = cur + 1;
+      key_length         = static_cast<uint16_t>(std::max(key_end - 1 - key_begin, 0L));
+      key_hash = MurmurHash3_32<cudf::string_view>{}(cudf::string_view(key_begin, key_length));
+
+      cur = thrust::find_if(thrust::seq, key_end, row_end, [] __device__(auto c) {
+        return !is_whitespace(c);
+      });
+      if (cur == row_end || *cur != ':') {
+        is_valid = false;
+        break;
+      }
+      ++cur;
+      state = expect::value;
+    } else {
+      if (c == ',') {
+        state = stack[depth - 1].is_array ? expect::value : expect::key;
+      } else if (!close_scope(c)) {
+        is_valid = false;
+        break;
+      }
+      ++cur;
+      // The record ends with its closing bracket
+      if (depth == 0) { break; }
+    }
+  }
+
+  if (!is_valid) { *error = 1; }
+  if (node_counts != nullptr) { node_counts[rec_id] = num_nodes; }
+}
+
+/**
+ * @brief CUDA kernel that converts the scalar nodes of nested JSON records to column data and
+ * sets the validity of all nodes.
+ *
+ * Data is processed one node at a time.
+ *
+ * @param[in] opts A set of parsing options
+ * @param[in] data The entire data to read
+ * @param[in] nodes The nodes of all records, with their rows set
+ * @param[in] node_columns Index of the column of each node
+ * @param[in] column_types The data type of each column
+ * @param[out] output_columns The output column data
+ * @param[out] valid_fields The bitmaps indicating whether column fields are valid
+ * @param[out] num_valid_fields The numbers of valid fields in columns
+ */
+__global__ void convert_nested_values_kernel(parse_options_view opts,
+                                             device_span<char const> const data,
+                                             device_span<json_node const> const nodes,
+                                             device_span<size_type const> const node_columns,
+                                             device_span<data_type const> const column_types,
+                                             device_span<void *const> const output_columns,
+                                             device_span<bitmask_type *const> const valid_fields,
+                                             device_span<cudf::size_type> const num_valid_fields)
+{
+  auto const node_id = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (node_id >= nodes.size()) return;
+
+  auto const &node = nodes[node_id];
+  auto const col   = node_columns[node_id];
+  // Records are the rows of the output table, not a column
+  if (node.depth == 0 || node.category == node_category::null) return;
+
+  if (node.category == node_category::value) {
+    auto const value_begin = data.begin() + node.value_offset;
+    auto const trimmed =
+      trim_whitespaces_quotes(value_begin, value_begin + node.value_length, opts.quotechar);
+    // Type dispatcher does not handle strings
+    if (column_types[col].id() == type_id::STRING) {
+      auto str_list             = static_cast<string_index_pair *>(output_columns[col]);
+      str_list[node.row].first  = trimmed.first;
+      str_list[node.row].second = trimmed.second - trimmed.first;
+    } else if (!cudf::type_dispatcher(column_types[col],
+                                      ConvertFunctor{},
+                                      trimmed.first,
+                                      trimmed.second,
+                                      output_columns[col],
+                                      node.row,
+                                      opts)) {
+      return;
+    }
+  }
+  // set the valid bitmap - all bits were set to 0 to start
+  set_bit(valid_fields[col], node.row);
+  atomicAdd(&num_valid_fields[col], 1);
+}
+
 }  // namespace
 
 /**
@@ -842,6 +1144,214 @@ void collect_keys_info(parse_options_view const &options,
   CUDA_TRY(cudaGetLastError());
 }
 
+
+/**
+ * @copydoc cudf::io::json::gpu::tokenize_nested_records
+ */
+rmm::device_uvector<json_node> tokenize_nested_records(
+  parse_options_view const &options,
+  device_span<char const> const data,
+  device_span<uint64_t const> const row_offsets,
+  rmm::cuda_stream_view stream)
+{
+  int block_size;
+  int min_grid_size;
+  CUDA_TRY(cudaOccupancyMaxPotentialBlockSize(
+    &min_grid_size, &block_size, tokenize_nested_records_kernel));
+
+  const int grid_size = (row_offsets.size() + block_size - 1) / block_size;
+
+  // Count the nodes of each record, then write them at the offsets of the records
+  rmm::device_uvector<size_type> node_offsets(row_offsets.size() + 1, stream);
+  rmm::device_scalar<int> error(0, stream);
+  tokenize_nested_records_kernel<<<grid_size, block_size, 0, stream.value()>>>(
+    options, data, row_offsets, nullptr, node_offsets.data(), nullptr, error.data());
+  CUDA_TRY(cudaGetLastError());
+  CUDF_EXPECTS(error.value(stream) == 0,
+               "Input data is not valid JSON, or is nested more than " +
+                 std::to_string(max_nesting_depth) + " levels deep");
+
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), node_offsets.begin(), node_offsets.end(), node_offsets.begin());
+  auto const num_nodes = node_offsets.back_element(stream);
+
+  rmm::device_uvector<json_node> nodes(num_nodes, stream);
+  tokenize_nested_records_kernel<<<grid_size, block_size, 0, stream.value()>>>(
+    options, data, row_offsets, node_offsets.data(), nullptr, nodes.data(), error.data());
+  CUDA_TRY(cudaGetLastError());
+
+  return nodes;
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::infer_nested_columns
+ */
+std::vector<nested_column_info> infer_nested_columns(parse_options_view const &options,
+                                                     device_span<char const> const data,
+                                                     device_span<json_node const> const nodes,
+                                                     device_span<size_type> node_columns,
+                                                     rmm::cuda_stream_view stream)
+{
+  auto const num_nodes = nodes.size();
+  auto const node_paths =
+    thrust::make_transform_iterator(nodes.begin(), [] __device__(json_node const &node) {
+      return node.path_hash;
+    });
+
+  // Group the nodes by path, keeping them in document order within each path
+  rmm::device_uvector<uint32_t> paths(num_nodes, stream);
+  rmm::device_uvector<size_type> order(num_nodes, stream);
+  thrust::copy(rmm::exec_policy(stream), node_paths, node_paths + num_nodes, paths.begin());
+  thrust::sequence(rmm::exec_policy(stream), order.begin(), order.end());
+  thrust::stable_sort_by_key(rmm::exec_policy(stream), paths.begin(), paths.end(), order.begin());
+
+  // One entry per path, with its first node, node count and the kinds of its values
+  rmm::device_uvector<uint32_t> column_paths(num_nodes, stream);
+  rmm::device_uvector<nested_column_info> columns(num_nodes, stream);
+  auto const node_infos = thrust::make_transform_iterator(
+    order.begin(), [nodes] __device__(size_type node) {
+      nested_column_info info{};
+      info.first_node = node;
+      info.num_nodes  = 1;
+      info.categories = nodes[node].category;
+      return info;
+    });
+  auto const columns_end =
+    thrust::reduce_by_key(rmm::exec_policy(stream),
+                          paths.begin(),
+                          paths.end(),
+                          node_infos,
+                          column_paths.begin(),
+                          columns.begin(),
+                          thrust::equal_to<uint32_t>{},
+                          [] __device__(nested_column_info lhs, nested_column_info const &rhs) {
+                            lhs.first_node = min(lhs.first_node, rhs.first_node);
+                            lhs.num_nodes += rhs.num_nodes;
+                            lhs.categories |= rhs.categories;
+                            return lhs;
+                          });
+  auto const num_columns = columns_end.first - column_paths.begin();
+  column_paths.resize(num_columns, stream);
+  columns.resize(num_columns, stream);
+
+  // The name, depth and parent of a path are those of any of its nodes
+  thrust::transform(rmm::exec_policy(stream),
+                    column_paths.begin(),
+                    column_paths.end(),
+                    columns.begin(),
+                    columns.begin(),
+                    [nodes] __device__(uint32_t path, nested_column_info info) {
+                      auto const &node = nodes[info.first_node];
+                      info.path_hash   = path;
+                      info.parent_path_hash =
+                        (node.parent < 0) ? record_path_hash : nodes[node.parent].path_hash;
+                      info.name_offset = node.key_offset;
+                      info.name_length = node.key_length;
+                      info.depth       = node.depth;
+                      return info;
+                    });
+
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      column_paths.begin(),
+                      column_paths.end(),
+                      node_paths,
+                      node_paths + num_nodes,
+                      node_columns.begin());
+
+  // Count the value types of the scalar nodes of each path
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_nodes,
+    [options, data, nodes, node_columns, columns = columns.data()] __device__(size_type idx) {
+      auto const &node = nodes[idx];
+      auto &stats      = columns[node_columns[idx]].stats;
+      if (node.category == node_category::null) {
+        atomicAdd(&stats.null_count, 1);
+      } else if (node.category == node_category::value) {
+        auto const value_begin = data.begin() + node.value_offset;
+        auto const trimmed =
+          trim_whitespaces_quotes(value_begin, value_begin + node.value_length, options.quotechar);
+        atomicAdd(value_type_counter(options, trimmed.first, trimmed.second, stats), 1);
+      }
+    });
+
+  return cudf::detail::make_std_vector_sync(columns, stream);
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::set_nested_node_rows
+ */
+void set_nested_node_rows(device_span<json_node> nodes,
+                          device_span<size_type const> node_columns,
+                          int depth,
+                          device_span<size_type *const> list_offsets,
+                          rmm::cuda_stream_view stream)
+{
+  thrust::for_each(rmm::exec_policy(stream),
+                   nodes.begin(),
+                   nodes.end(),
+                   [nodes, node_columns, depth, list_offsets] __device__(json_node & node) {
+                     if (node.depth != depth) return;
+                     auto const &parent = nodes[node.parent];
+                     auto const offsets = list_offsets[node_columns[node.parent]];
+                     node.row =
+                       (offsets == nullptr) ? parent.row : offsets[parent.row] + node.list_index;
+                   });
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::set_nested_list_sizes
+ */
+void set_nested_list_sizes(device_span<json_node const> nodes,
+                           device_span<size_type const> node_columns,
+                           int depth,
+                           device_span<size_type *const> list_offsets,
+                           rmm::cuda_stream_view stream)
+{
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    nodes.size(),
+    [nodes, node_columns, depth, list_offsets] __device__(size_type idx) {
+      auto const &node = nodes[idx];
+      if (node.depth != depth || node.category != node_category::array) return;
+      list_offsets[node_columns[idx]][node.row] = node.num_children;
+    });
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::convert_nested_json_to_columns
+ */
+void convert_nested_json_to_columns(parse_options_view const &options,
+                                    device_span<char const> const data,
+                                    device_span<json_node const> const nodes,
+                                    device_span<size_type const> const node_columns,
+                                    device_span<data_type const> const column_types,
+                                    device_span<void *const> const output_columns,
+                                    device_span<bitmask_type *const> const valid_fields,
+                                    device_span<cudf::size_type> num_valid_fields,
+                                    rmm::cuda_stream_view stream)
+{
+  int block_size;
+  int min_grid_size;
+  CUDA_TRY(cudaOccupancyMaxPotentialBlockSize(
+    &min_grid_size, &block_size, convert_nested_values_kernel));
+
+  const int grid_size = (nodes.size() + block_size - 1) / block_size;
+
+  convert_nested_values_kernel<<<grid_size, block_size, 0, stream.value()>>>(options,
+                                                                            data,
+                                                                            nodes,
+                                                                            node_columns,
+                                                                            column_types,
+                                                                            output_columns,
+                                                                            valid_fields,
+                                                                            num_valid_fields);
+
+  CUDA_TRY(cudaGetLastError());
+}
+
 }  // namespace gpu
 }  // namespace json
 }  // namespace io
@@ -26,6 +26,7 @@
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 
 #include <thrust/optional.h>
 
@@ -100,6 +101,152 @@ void collect_keys_info(parse_options_view const &options,
                        thrust::optional<mutable_table_device_view> keys_info,
                        rmm::cuda_stream_view stream);
 
+/**
+ * @brief Kinds of values in nested JSON records.
+ *
+ * Bit flags, so that the kinds of all values at a path can be combined.
+ */
+namespace node_category {
+enum : uint8_t {
+  object = 1,  ///< JSON object, read as a struct
+  array  = 2,  ///< JSON array, read as a list
+  value  = 4,  ///< number, string, or boolean
+  null   = 8,  ///< `null` literal or empty value
+};
+}  // namespace node_category
+
+/**
+ * @brief Maximum depth of nested objects and arrays in a record, including the record itself.
+ */
+constexpr int max_nesting_depth = 32;
+
+/**
+ * @brief A value in a nested JSON record; the record itself, an object member or an array
+ * element.
+ */
+struct json_node {
+  uint64_t value_offset;   ///< Offset of the value in the data
+  uint64_t key_offset;     ///< Offset of the member name in the data; unused for array elements
+  uint32_t value_length;   ///< Length of the value; unused for objects and arrays
+  uint32_t path_hash;      ///< Hash of the member names and array levels from the record
+  size_type parent;        ///< Index of the enclosing object or array node; -1 for records
+  size_type list_index;    ///< Index of the node in the enclosing array; 0 in objects
+  size_type num_children;  ///< Number of elements, for array nodes
+  size_type row;           ///< Row of the node in the column of its path
+  uint16_t key_length;     ///< Length of the member name
+  uint16_t depth;          ///< Number of enclosing objects and arrays; 0 for records
+  uint8_t category;        ///< One of `node_category`
+};
+
+/**
+ * @brief Summary of the nodes that share a path, from which the column of the path is inferred.
+ */
+struct nested_column_info {
+  uint32_t path_hash;         ///< Hash of the path
+  uint32_t parent_path_hash;  ///< Hash of the path of the enclosing column; unused for records
+  size_type first_node;       ///< Index of the first node with the path
+  size_type num_nodes;        ///< Number of nodes with the path
+  uint64_t name_offset;       ///< Offset of the member name in the data
+  uint16_t name_length;       ///< Length of the member name; 0 for array elements
+  uint16_t depth;             ///< Depth of the nodes
+  uint8_t categories;         ///< Bitwise OR of the categories of the nodes
+  cudf::io::column_type_histogram stats;  ///< Value types, for columns of scalar values
+};
+
+/**
+ * @brief Splits JSON Lines records into their values, without flattening nested objects and
+ * arrays.
+ *
+ * Each record is processed by a single thread. Nodes are output in document order, so a parent
+ * node always precedes its children. The `row` of each record node is set to the record index.
+ *
+ * @param[in] options A set of parsing options
+ * @param[in] data Input data buffer
+ * @param[in] row_offsets The offset of each record in the input
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns The nodes of all records
+ */
+rmm::device_uvector<json_node> tokenize_nested_records(parse_options_view const &options,
+                                                       device_span<char const> data,
+                                                       device_span<uint64_t const> row_offsets,
+                                                       rmm::cuda_stream_view stream);
+
+/**
+ * @brief Groups nodes by their path and gathers the statistics to infer column types from.
+ *
+ * @param[in] options A set of parsing options
+ * @param[in] data Input data buffer
+ * @param[in] nodes The nodes of all records
+ * @param[out] node_columns Index of the column of each node in the returned vector
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns One entry per distinct path, ordered by path hash
+ */
+std::vector<nested_column_info> infer_nested_columns(parse_options_view const &options,
+                                                     device_span<char const> data,
+                                                     device_span<json_node const> nodes,
+                                                     device_span<size_type> node_columns,
+                                                     rmm::cuda_stream_view stream);
+
+/**
+ * @brief Sets the row of each node at the given depth, from the row of its parent node.
+ *
+ * Members of an object share the row of the object; elements of an array are placed at the
+ * offset of the array in its list column.
+ *
+ * @param[in,out] nodes The nodes of all records; rows of the shallower nodes must be set
+ * @param[in] node_columns Index of the column of each node
+ * @param[in] depth Depth of the nodes to set the row of
+ * @param[in] list_offsets Offsets of each list column; nullptr for other columns
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void set_nested_node_rows(device_span<json_node> nodes,
+                          device_span<size_type const> node_columns,
+                          int depth,
+                          device_span<size_type *const> list_offsets,
+                          rmm::cuda_stream_view stream);
+
+/**
+ * @brief Writes the number of elements of the array nodes at the given depth to the offsets of
+ * their list columns, at the row of the node.
+ *
+ * @param[in] nodes The nodes of all records; rows of the nodes at `depth` must be set
+ * @param[in] node_columns Index of the column of each node
+ * @param[in] depth Depth of the nodes to write the sizes of
+ * @param[out] list_offsets Offsets of each list column, zero-initialized; nullptr for other
+ * columns
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void set_nested_list_sizes(device_span<json_node const> nodes,
+                           device_span<size_type const> node_columns,
+                           int depth,
+                           device_span<size_type *const> list_offsets,
+                           rmm::cuda_stream_view stream);
+
+/**
+ * @brief Converts the scalar nodes to column data, and sets the validity of all nodes.
+ *
+ * @param[in] options A set of parsing options
+ * @param[in] data Input data buffer
+ * @param[in] nodes The nodes of all records, with their rows set
+ * @param[in] node_columns Index of the column of each node
+ * @param[in] column_types The data type of each column
+ * @param[out] output_columns The output column data; unused for struct and list columns
+ * @param[out] valid_fields The bitmaps indicating whether column fields are valid
+ * @param[out] num_valid_fields The numbers of valid fields in columns
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void convert_nested_json_to_columns(parse_options_view const &options,
+                                    device_span<char const> data,
+                                    device_span<json_node const> nodes,
+                                    device_span<size_type const> node_columns,
+                                    device_span<data_type const> column_types,
+                                    device_span<void *const> output_columns,
+                                    device_span<bitmask_type *const> valid_fields,
+                                    device_span<cudf::size_type> num_valid_fields,
+                                    rmm::cuda_stream_view stream);
+
 }  // namespace gpu
 }  // namespace json
 }  // namespace io
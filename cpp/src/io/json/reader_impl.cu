@@ -26,6 +26,7 @@
 #include <io/utilities/type_conversion.cuh>
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/trie.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/groupby.hpp>
@@ -42,6 +43,10 @@
 
 #include <thrust/optional.h>
 
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+
 using cudf::host_span;
 
 namespace cudf {
@@ -74,6 +79,133 @@ constexpr size_t calculate_max_row_size(int num_columns = 0) noexcept
                num_columns * column_bytes;  // Expand size based on the # of columns, if available
 }
 
+/**
+ * @brief Returns the data type of a column, based on the histogram of its value types.
+ *
+ * @param[in] cinfo Histogram of the column's value types
+ * @param[in] num_rows Number of rows in the column, including the ones without a value
+ *
+ * @return Inferred data type
+ */
+data_type infer_data_type(cudf::io::column_type_histogram const &cinfo, size_t num_rows)
+{
+  auto int_count_total =
+    cinfo.big_int_count + cinfo.negative_small_int_count + cinfo.positive_small_int_count;
+  if (cinfo.null_count == static_cast<int>(num_rows)) {
+    // Entire column is NULL; allocate the smallest amount of memory
+    return data_type{type_id::INT8};
+  } else if (cinfo.string_count > 0) {
+    return data_type{type_id::STRING};
+  } else if (cinfo.datetime_count > 0) {
+    return data_type{type_id::TIMESTAMP_MILLISECONDS};
+  } else if (cinfo.float_count > 0 || (int_count_total > 0 && cinfo.null_count > 0)) {
+    return data_type{type_id::FLOAT64};
+  } else if (cinfo.big_int_count == 0 && int_count_total != 0) {
+    return data_type{type_id::INT64};
+  } else if (cinfo.big_int_count != 0 && cinfo.negative_small_int_count != 0) {
+    return data_type{type_id::STRING};
+  } else if (cinfo.big_int_count != 0) {
+    return data_type{type_id::UINT64};
+  } else if (cinfo.bool_count > 0) {
+    return data_type{type_id::BOOL8};
+  } else {
+    CUDF_FAIL("Data type detection failed.\n");
+  }
+}
+
+/**
+ * @brief Replaces the escape sequences in a strings column with the characters they represent.
+ */
+std::unique_ptr<column> remove_escapes(column_view const &strings,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource *mr)
+{
+  static std::vector<char> const target_chars{
+    '\\', '"', '\\', '\\', '\\', 't', '\\', 'r', '\\', 'b'};
+  static std::vector<size_type> const target_offsets{0, 2, 4, 6, 8, 10};
+
+  static std::vector<char> const repl_chars{'"', '\\', '\t', '\r', '\b'};
+  static std::vector<size_type> const repl_offsets{0, 1, 2, 3, 4, 5};
+
+  auto target = make_strings_column(cudf::detail::make_device_uvector_async(target_chars, stream),
+                                    cudf::detail::make_device_uvector_async(target_offsets, stream),
+                                    {},
+                                    0,
+                                    stream);
+  auto repl   = make_strings_column(cudf::detail::make_device_uvector_async(repl_chars, stream),
+                                  cudf::detail::make_device_uvector_async(repl_offsets, stream),
+                                  {},
+                                  0,
+                                  stream);
+  return cudf::strings::detail::replace(strings, target->view(), repl->view(), stream, mr);
+}
+
+/**
+ * @brief Creates the column of a nested JSON path, with the columns of its child paths.
+ *
+ * @param[in] col Index of the column
+ * @param[in,out] buffers Buffers of all columns; the buffers of the created columns are consumed
+ * @param[in] children Indices of the child columns of each column
+ * @param[out] schema_info Names of the created column and its children
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ */
+std::unique_ptr<column> make_nested_column(size_type col,
+                                           std::vector<column_buffer> &buffers,
+                                           std::vector<std::vector<size_type>> const &children,
+                                           column_name_info &schema_info,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource *mr)
+{
+  auto &buffer     = buffers[col];
+  schema_info.name = buffer.name;
+
+  switch (buffer.type.id()) {
+    case type_id::LIST: {
+      auto offsets =
+        std::make_unique<column>(data_type{type_id::INT32}, buffer.size, std::move(buffer._data));
+      schema_info.children.emplace_back("offsets");
+      schema_info.children.emplace_back("");
+      // Arrays that are all empty have no element column
+      auto child = children[col].empty()
+                     ? make_empty_column(data_type{type_id::INT8})
+                     : make_nested_column(children[col].front(),
+                                          buffers,
+                                          children,
+                                          schema_info.children.back(),
+                                          stream,
+                                          mr);
+      // Size is the number of offsets; there is one less row
+      return make_lists_column(buffer.size - 1,
+                               std::move(offsets),
+                               std::move(child),
+                               buffer._null_count,
+                               std::move(buffer._null_mask),
+                               stream,
+                               mr);
+    }
+    case type_id::STRUCT: {
+      std::vector<std::unique_ptr<column>> child_columns;
+      for (auto const child : children[col]) {
+        schema_info.children.emplace_back("");
+        child_columns.emplace_back(make_nested_column(
+          child, buffers, children, schema_info.children.back(), stream, mr));
+      }
+      return make_structs_column(buffer.size,
+                                 std::move(child_columns),
+                                 buffer._null_count,
+                                 std::move(buffer._null_mask),
+                                 stream,
+                                 mr);
+    }
+    case type_id::STRING: {
+      auto out_column = make_column(buffer, &schema_info, stream, mr);
+      return remove_escapes(out_column->view(), stream, mr);
+    }
+    default: return make_column(buffer, &schema_info, stream, mr);
+  }
+}
+
 }  // anonymous namespace
 
 /**
@@ -228,7 +360,7 @@ std::pair<std::vector<std::string>, col_map_ptr_type> reader::impl::get_json_obj
 /**
  * @brief Ingest input JSON file/buffer, without decompression.
  *
- * Sets the source_, byte_range_offset_, and byte_range_size_ data members
+ * Sets the sources_, byte_range_offset_, and byte_range_size_ data members
  *
  * @param[in] range_offset Number of bytes offset from the start
  * @param[in] range_size Bytes to read; use `0` for all remaining data
@@ -242,14 +374,15 @@ void reader::impl::ingest_raw_input(size_t range_offset, size_t range_size)
 
   // Support delayed opening of the file if using memory mapping datasource
   // This allows only mapping of a subset of the file if using byte range
-  if (source_ == nullptr) {
-    assert(!filepath_.empty());
-    source_ = datasource::create(filepath_, range_offset, map_range_size);
+  if (sources_.empty()) {
+    assert(!filepaths_.empty());
+    sources_.emplace_back(datasource::create(filepaths_[0], range_offset, map_range_size));
   }
 
-  if (!source_->is_empty()) {
-    auto data_size = (map_range_size != 0) ? map_range_size : source_->size();
-    buffer_        = source_->host_read(range_offset, data_size);
+  auto &source = sources_[0];
+  if (!source->is_empty()) {
+    auto data_size = (map_range_size != 0) ? map_range_size : source->size();
+    buffer_        = source->host_read(range_offset, data_size);
   }
 
   byte_range_offset_ = range_offset;
@@ -267,12 +400,29 @@ void reader::impl::decompress_input(rmm::cuda_stream_view stream)
 {
   const auto compression_type =
     infer_compression_type(options_.get_compression(),
-                           filepath_,
+                           filepaths_.empty() ? std::string{} : filepaths_[0],
                            {{"gz", "gzip"}, {"zip", "zip"}, {"bz2", "bz2"}, {"xz", "xz"}});
+  std::optional<rmm::device_uvector<char>> d_uncomp_data;
+  if (compression_type == "gzip" && load_whole_file_) {
+    d_uncomp_data = gpu_uncompress_gzip(
+      host_span<char const>(reinterpret_cast<const char *>(buffer_->data()), buffer_->size()),
+      stream);
+  }
   if (compression_type == "none") {
     // Do not use the owner vector here to avoid extra copy
     uncomp_data_ = reinterpret_cast<const char *>(buffer_->data());
     uncomp_size_ = buffer_->size();
+  } else if (d_uncomp_data.has_value()) {
+    // Decompressed on the GPU; the host copy is only used to locate records and keys
+    uncomp_data_owner_.resize(d_uncomp_data->size());
+    CUDA_TRY(cudaMemcpyAsync(uncomp_data_owner_.data(),
+                             d_uncomp_data->data(),
+                             d_uncomp_data->size(),
+                             cudaMemcpyDeviceToHost,
+                             stream.value()));
+    stream.synchronize();
+    uncomp_data_ = uncomp_data_owner_.data();
+    uncomp_size_ = uncomp_data_owner_.size();
   } else {
     uncomp_data_owner_ = get_uncompressed_data(  //
       host_span<char const>(                     //
@@ -283,7 +433,68 @@ void reader::impl::decompress_input(rmm::cuda_stream_view stream)
     uncomp_data_ = uncomp_data_owner_.data();
     uncomp_size_ = uncomp_data_owner_.size();
   }
-  if (load_whole_file_) data_ = rmm::device_buffer(uncomp_data_, uncomp_size_, stream);
+  if (d_uncomp_data.has_value()) {
+    data_ = d_uncomp_data->release();
+  } else if (load_whole_file_) {
+    data_ = rmm::device_buffer(uncomp_data_, uncomp_size_, stream);
+  }
+}
+
+/**
+ * @brief Ingest and decompress all input sources into a single host buffer
+ *
+ * Sets the uncomp_data_, uncomp_size_, byte_range_offset_, and byte_range_size_ data members
+ * Loads the data into device memory if byte range parameters are not used
+ */
+void reader::impl::ingest_multiple_sources(size_t range_offset,
+                                           size_t range_size,
+                                           rmm::cuda_stream_view stream)
+{
+  stage_range range{"json::read_sources", -1};
+  auto const num_sources = std::max(sources_.size(), filepaths_.size());
+
+  uncomp_data_owner_.clear();
+  for (size_t src = 0; src < num_sources; ++src) {
+    if (sources_.size() <= src) { sources_.emplace_back(datasource::create(filepaths_[src])); }
+    auto const &source = sources_[src];
+    if (source->is_empty()) { continue; }
+
+    auto const buffer = source->host_read(0, source->size());
+    auto const raw_data =
+      host_span<char const>(reinterpret_cast<const char *>(buffer->data()), buffer->size());
+    auto const compression_type =
+      infer_compression_type(options_.get_compression(),
+                             src < filepaths_.size() ? filepaths_[src] : std::string{},
+                             {{"gz", "gzip"}, {"zip", "zip"}, {"bz2", "bz2"}, {"xz", "xz"}});
+    if (compression_type == "none") {
+      uncomp_data_owner_.insert(uncomp_data_owner_.end(), raw_data.begin(), raw_data.end());
+    } else {
+      auto const uncomp_data = get_uncompressed_data(raw_data, compression_type);
+      uncomp_data_owner_.insert(uncomp_data_owner_.end(), uncomp_data.begin(), uncomp_data.end());
+    }
+    // Records never span sources; terminate the last record of each source
+    if (!uncomp_data_owner_.empty() && uncomp_data_owner_.back() != opts_.terminator) {
+      uncomp_data_owner_.push_back(opts_.terminator);
+    }
+  }
+  CUDF_EXPECTS(range_offset <= uncomp_data_owner_.size(),
+               "Byte range offset is past the end of the input data.\n");
+
+  byte_range_offset_ = range_offset;
+  byte_range_size_   = range_size;
+  load_whole_file_   = byte_range_offset_ == 0 && byte_range_size_ == 0;
+
+  // Keep the same view of the data as a single source read would have: the byte range plus enough
+  // of the following data to complete the last record that starts within the range
+  auto const remaining_size = uncomp_data_owner_.size() - range_offset;
+  uncomp_data_              = uncomp_data_owner_.data() + range_offset;
+  uncomp_size_              = remaining_size;
+  if (range_size != 0) {
+    uncomp_size_ = std::min(
+      range_size + calculate_max_row_size(options_.get_dtypes().size()), remaining_size);
+  }
+
+  if (load_whole_file_) { data_ = rmm::device_buffer(uncomp_data_, uncomp_size_, stream); }
 }
 
 /**
@@ -295,6 +506,7 @@ void reader::impl::decompress_input(rmm::cuda_stream_view stream)
  */
 void reader::impl::set_record_starts(rmm::cuda_stream_view stream)
 {
+  stage_range range{"json::find_records", static_cast<int64_t>(uncomp_size_)};
   std::vector<char> chars_to_count{'\n'};
   // Currently, ignoring lineterminations within quotes is handled by recording the records of both,
   // and then filtering out the records that is a quotechar or a linetermination within a quotechar
@@ -519,35 +731,10 @@ void reader::impl::set_data_types(rmm::cuda_stream_view stream)
       get_column_map_device_ptr(),
       stream);
 
-    auto get_type_id = [&](auto const &cinfo) {
-      auto int_count_total =
-        cinfo.big_int_count + cinfo.negative_small_int_count + cinfo.positive_small_int_count;
-      if (cinfo.null_count == static_cast<int>(rec_starts_.size())) {
-        // Entire column is NULL; allocate the smallest amount of memory
-        return type_id::INT8;
-      } else if (cinfo.string_count > 0) {
-        return type_id::STRING;
-      } else if (cinfo.datetime_count > 0) {
-        return type_id::TIMESTAMP_MILLISECONDS;
-      } else if (cinfo.float_count > 0 || (int_count_total > 0 && cinfo.null_count > 0)) {
-        return type_id::FLOAT64;
-      } else if (cinfo.big_int_count == 0 && int_count_total != 0) {
-        return type_id::INT64;
-      } else if (cinfo.big_int_count != 0 && cinfo.negative_small_int_count != 0) {
-        return type_id::STRING;
-      } else if (cinfo.big_int_count != 0) {
-        return type_id::UINT64;
-      } else if (cinfo.bool_count > 0) {
-        return type_id::BOOL8;
-      } else {
-        CUDF_FAIL("Data type detection failed.\n");
-      }
-    };
-
     std::transform(std::cbegin(h_column_infos),
                    std::cend(h_column_infos),
                    std::back_inserter(dtypes_),
-                   [&](auto const &cinfo) { return data_type{get_type_id(cinfo)}; });
+                   [&](auto const &cinfo) { return infer_data_type(cinfo, rec_starts_.size()); });
   }
 }  // namespace json
 
@@ -562,6 +749,9 @@ table_with_metadata reader::impl::convert_data_to_table(rmm::cuda_stream_view st
 {
   const auto num_columns = dtypes_.size();
   const auto num_records = rec_starts_.size();
+  stage_range range{"json::convert_data",
+                    static_cast<int64_t>(uncomp_size_),
+                    static_cast<int64_t>(num_records)};
 
   // alloc output buffers.
   std::vector<column_buffer> out_buffers;
@@ -598,23 +788,6 @@ table_with_metadata reader::impl::convert_data_to_table(rmm::cuda_stream_view st
   stream.synchronize();
 
   // postprocess columns
-  auto target_chars   = std::vector<char>{'\\', '"', '\\', '\\', '\\', 't', '\\', 'r', '\\', 'b'};
-  auto target_offsets = std::vector<size_type>{0, 2, 4, 6, 8, 10};
-
-  auto repl_chars   = std::vector<char>{'"', '\\', '\t', '\r', '\b'};
-  auto repl_offsets = std::vector<size_type>{0, 1, 2, 3, 4, 5};
-
-  auto target = make_strings_column(cudf::detail::make_device_uvector_async(target_chars, stream),
-                                    cudf::detail::make_device_uvector_async(target_offsets, stream),
-                                    {},
-                                    0,
-                                    stream);
-  auto repl   = make_strings_column(cudf::detail::make_device_uvector_async(repl_chars, stream),
-                                  cudf::detail::make_device_uvector_async(repl_offsets, stream),
-                                  {},
-                                  0,
-                                  stream);
-
   thrust::host_vector<cudf::size_type> h_valid_counts = d_valid_counts;
   std::vector<std::unique_ptr<column>> out_columns;
   for (size_t i = 0; i < num_columns; ++i) {
@@ -623,27 +796,202 @@ table_with_metadata reader::impl::convert_data_to_table(rmm::cuda_stream_view st
     auto out_column = make_column(out_buffers[i], nullptr, stream, mr_);
     if (out_column->type().id() == type_id::STRING) {
       // Need to remove escape character in case of '\"' and '\\'
-      out_columns.emplace_back(cudf::strings::detail::replace(
-        out_column->view(), target->view(), repl->view(), stream, mr_));
+      out_columns.emplace_back(remove_escapes(out_column->view(), stream, mr_));
     } else {
       out_columns.emplace_back(std::move(out_column));
     }
   }
 
-  // This is to ensure the stream-ordered make_stream_column calls above complete before
-  // the temporary std::vectors are destroyed on exit from this function.
-  stream.synchronize();
+  CUDF_EXPECTS(!out_columns.empty(), "No columns created from json input");
 
+  return table_with_metadata{std::make_unique<table>(std::move(out_columns)), metadata_};
+}
+
+/**
+ * @brief Parse the input data as nested records and store results a table
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return table_with_metadata struct
+ */
+table_with_metadata reader::impl::read_nested(rmm::cuda_stream_view stream)
+{
+  stage_range range{"json::read_nested", static_cast<int64_t>(uncomp_size_)};
+  namespace node_category = cudf::io::json::gpu::node_category;
+  CUDF_EXPECTS(options_.get_dtypes().empty(),
+               "Data types cannot be specified when reading nested JSON.\n");
+
+  auto const data = device_span<char const>(static_cast<char const *>(data_.data()), data_.size());
+  auto const num_records = rec_starts_.size();
+
+  auto nodes =
+    cudf::io::json::gpu::tokenize_nested_records(opts_.view(), data, rec_starts_, stream);
+  rmm::device_uvector<size_type> node_columns(nodes.size(), stream);
+  auto const columns = cudf::io::json::gpu::infer_nested_columns(
+    opts_.view(), data, nodes, node_columns, stream);
+  auto const num_columns = columns.size();
+  CUDF_EXPECTS(num_columns != 0, "Input data does not contain any JSON records.\n");
+
+  // Parent and children of each column; children are ordered by their first appearance
+  std::vector<size_type> document_order(num_columns);
+  std::iota(document_order.begin(), document_order.end(), 0);
+  std::sort(document_order.begin(), document_order.end(), [&](auto lhs, auto rhs) {
+    return columns[lhs].first_node < columns[rhs].first_node;
+  });
+  std::unordered_map<uint32_t, size_type> path_columns;
+  for (size_t col = 0; col < num_columns; ++col) {
+    path_columns[columns[col].path_hash] = col;
+  }
+  std::vector<size_type> parents(num_columns, -1);
+  std::vector<std::vector<size_type>> children(num_columns);
+  size_type record_column = -1;
+  int max_depth           = 0;
+  for (auto const col : document_order) {
+    auto const &info = columns[col];
+    auto const kinds = info.categories & ~node_category::null;
+    CUDF_EXPECTS(kinds == 0 || kinds == node_category::object ||
+                   kinds == node_category::array || kinds == node_category::value,
+                 "Nested JSON values at the same path must all be objects, arrays or scalars.\n");
+    if (info.depth == 0) {
+      record_column = col;
+    } else {
+      parents[col] = path_columns.at(info.parent_path_hash);
+      children[parents[col]].push_back(col);
+    }
+    max_depth = std::max<int>(max_depth, info.depth);
+  }
+  CUDF_EXPECTS(record_column != -1, "Input data does not contain any JSON records.\n");
+
+  auto is_list = [&](size_type col) {
+    return (columns[col].categories & node_category::array) != 0;
+  };
+
+  // Resolve the rows of the nodes one depth at a time, since the rows of array elements depend on
+  // the sizes of all arrays before them in their column
+  std::vector<size_type> column_sizes(num_columns, 0);
+  std::vector<size_type> num_elements(num_columns, 0);
+  std::vector<column_buffer> buffers(num_columns);
+  std::vector<size_type *> h_list_offsets(num_columns, nullptr);
+  rmm::device_uvector<size_type *> d_list_offsets(num_columns, stream);
+  CUDA_TRY(cudaMemsetAsync(
+    d_list_offsets.data(), 0, num_columns * sizeof(size_type *), stream.value()));
+  column_sizes[record_column] = num_records;
+  for (int depth = 0; depth <= max_depth; ++depth) {
+    std::vector<size_type> lists;
+    for (auto const col : document_order) {
+      if (columns[col].depth != depth) { continue; }
+      if (depth > 0) {
+        auto const parent = parents[col];
+        column_sizes[col] = is_list(parent) ? num_elements[parent] : column_sizes[parent];
+      }
+      if (is_list(col)) { lists.push_back(col); }
+    }
+    if (depth > 0) {
+      cudf::io::json::gpu::set_nested_node_rows(nodes, node_columns, depth, d_list_offsets, stream);
+    }
+    if (lists.empty()) { continue; }
+
+    for (auto const col : lists) {
+      buffers[col] =
+        column_buffer(data_type{type_id::LIST}, column_sizes[col] + 1, true, stream, mr_);
+      h_list_offsets[col] = static_cast<size_type *>(buffers[col].data());
+      CUDA_TRY(cudaMemsetAsync(
+        h_list_offsets[col], 0, (column_sizes[col] + 1) * sizeof(size_type), stream.value()));
+    }
+    CUDA_TRY(cudaMemcpyAsync(d_list_offsets.data(),
+                             h_list_offsets.data(),
+                             num_columns * sizeof(size_type *),
+                             cudaMemcpyHostToDevice,
+                             stream.value()));
+    cudf::io::json::gpu::set_nested_list_sizes(nodes, node_columns, depth, d_list_offsets, stream);
+
+    // Array sizes to offsets; the last offset is the number of elements
+    for (auto const col : lists) {
+      auto const offsets = h_list_offsets[col];
+      auto const size    = column_sizes[col];
+      thrust::exclusive_scan(rmm::exec_policy(stream), offsets, offsets + size + 1, offsets);
+      CUDA_TRY(cudaMemcpyAsync(&num_elements[col],
+                               offsets + size,
+                               sizeof(size_type),
+                               cudaMemcpyDeviceToHost,
+                               stream.value()));
+    }
+    stream.synchronize();
+  }
+
+  // Column types; values are missing from the rows where their member is absent
+  std::vector<data_type> column_types(num_columns, data_type{type_id::EMPTY});
+  for (size_t col = 0; col < num_columns; ++col) {
+    if (col == static_cast<size_t>(record_column)) { continue; }
+    auto const &info = columns[col];
+    if (info.categories & node_category::object) {
+      column_types[col] = data_type{type_id::STRUCT};
+      buffers[col]      = column_buffer(column_types[col], column_sizes[col], true, stream, mr_);
+    } else if (info.categories & node_category::array) {
+      column_types[col] = data_type{type_id::LIST};
+    } else {
+      auto stats = info.stats;
+      stats.null_count += column_sizes[col] - info.num_nodes;
+      column_types[col] = infer_data_type(stats, column_sizes[col]);
+      buffers[col]      = column_buffer(column_types[col], column_sizes[col], true, stream, mr_);
+    }
+    if (info.name_length != 0) {
+      buffers[col].name.resize(info.name_length);
+      CUDA_TRY(cudaMemcpyAsync(buffers[col].name.data(),
+                               data.data() + info.name_offset,
+                               info.name_length,
+                               cudaMemcpyDeviceToHost,
+                               stream.value()));
+    }
+  }
+
+  thrust::host_vector<void *> h_data(num_columns, nullptr);
+  thrust::host_vector<bitmask_type *> h_valid(num_columns, nullptr);
+  for (size_t col = 0; col < num_columns; ++col) {
+    if (col == static_cast<size_t>(record_column)) { continue; }
+    h_data[col]  = buffers[col].data();
+    h_valid[col] = buffers[col].null_mask();
+  }
+  rmm::device_uvector<cudf::size_type> d_valid_counts(num_columns, stream);
+  CUDA_TRY(cudaMemsetAsync(
+    d_valid_counts.data(), 0, num_columns * sizeof(cudf::size_type), stream.value()));
+
+  cudf::io::json::gpu::convert_nested_json_to_columns(
+    opts_.view(),
+    data,
+    nodes,
+    node_columns,
+    cudf::detail::make_device_uvector_async(column_types, stream),
+    cudf::detail::make_device_uvector_async(h_data, stream),
+    cudf::detail::make_device_uvector_async(h_valid, stream),
+    d_valid_counts,
+    stream);
+
+  auto const h_valid_counts = cudf::detail::make_std_vector_sync(d_valid_counts, stream);
+  for (size_t col = 0; col < num_columns; ++col) {
+    buffers[col].null_count() = column_sizes[col] - h_valid_counts[col];
+  }
+
+  // The members of the records are the columns of the table
+  std::vector<std::unique_ptr<column>> out_columns;
+  metadata_.column_names.clear();
+  metadata_.schema_info.clear();
+  for (auto const col : children[record_column]) {
+    metadata_.column_names.push_back(buffers[col].name);
+    metadata_.schema_info.emplace_back();
+    out_columns.emplace_back(
+      make_nested_column(col, buffers, children, metadata_.schema_info.back(), stream, mr_));
+  }
   CUDF_EXPECTS(!out_columns.empty(), "No columns created from json input");
 
   return table_with_metadata{std::make_unique<table>(std::move(out_columns)), metadata_};
 }
 
-reader::impl::impl(std::unique_ptr<datasource> source,
-                   std::string filepath,
+reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
+                   std::vector<std::string> const &filepaths,
                    json_reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
-  : options_(options), mr_(mr), source_(std::move(source)), filepath_(filepath)
+  : options_(options), mr_(mr), sources_(std::move(sources)), filepaths_(filepaths)
 {
   CUDF_EXPECTS(options_.is_enabled_lines(), "Only JSON Lines format is currently supported.\n");
 
@@ -669,10 +1017,15 @@ table_with_metadata reader::impl::read(json_reader_options const &options,
   auto range_offset = options.get_byte_range_offset();
   auto range_size   = options.get_byte_range_size();
 
-  ingest_raw_input(range_offset, range_size);
-  CUDF_EXPECTS(buffer_ != nullptr, "Ingest failed: input data is null.\n");
+  if (std::max(sources_.size(), filepaths_.size()) > 1) {
+    // All sources are parsed as one input, so the schema is only inferred once
+    ingest_multiple_sources(range_offset, range_size, stream);
+  } else {
+    ingest_raw_input(range_offset, range_size);
+    CUDF_EXPECTS(buffer_ != nullptr, "Ingest failed: input data is null.\n");
 
-  decompress_input(stream);
+    decompress_input(stream);
+  }
   CUDF_EXPECTS(uncomp_data_ != nullptr, "Ingest failed: uncompressed input data is null.\n");
   CUDF_EXPECTS(uncomp_size_ != 0, "Ingest failed: uncompressed input data has zero size.\n");
 
@@ -696,10 +1049,11 @@ reader::reader(std::vector<std::string> const &filepaths,
                json_reader_options const &options,
                rmm::mr::device_memory_resource *mr)
 {
-  CUDF_EXPECTS(filepaths.size() == 1, "Only a single source is currently supported.");
+  CUDF_EXPECTS(!filepaths.empty(), "At least one source is required.");
   // Delay actual instantiation of data source until read to allow for
   // partial memory mapping of file using byte ranges
-  _impl = std::make_unique<impl>(nullptr, filepaths[0], options, mr);
+  _impl = std::make_unique<impl>(
+    std::vector<std::unique_ptr<cudf::io::datasource>>{}, filepaths, options, mr);
 }
 
 // Forward to implementation
@@ -707,8 +1061,8 @@ reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
                json_reader_options const &options,
                rmm::mr::device_memory_resource *mr)
 {
-  CUDF_EXPECTS(sources.size() == 1, "Only a single source is currently supported.");
-  _impl = std::make_unique<impl>(std::move(sources[0]), "", options, mr);
+  CUDF_EXPECTS(!sources.empty(), "At least one source is required.");
+  _impl = std::make_unique<impl>(std::move(sources), std::vector<std::string>{}, options, mr);
 }
 
 // Destructor within this translation unit
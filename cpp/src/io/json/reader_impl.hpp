@@ -57,8 +57,8 @@ class reader::impl {
 
   rmm::mr::device_memory_resource *mr_ = nullptr;
 
-  std::unique_ptr<datasource> source_;
-  std::string filepath_;
+  std::vector<std::unique_ptr<datasource>> sources_;
+  std::vector<std::string> filepaths_;
   std::unique_ptr<datasource::buffer> buffer_;
 
   const char *uncomp_data_ = nullptr;
@@ -107,13 +107,29 @@ class reader::impl {
   /**
    * @brief Ingest input JSON file/buffer, without decompression
    *
-   * Sets the source_, byte_range_offset_, and byte_range_size_ data members
+   * Sets the sources_, byte_range_offset_, and byte_range_size_ data members
    *
    * @param[in] range_offset Number of bytes offset from the start
    * @param[in] range_size Bytes to read; use `0` for all remaining data
    */
   void ingest_raw_input(size_t range_offset, size_t range_size);
 
+  /**
+   * @brief Ingest and decompress all input sources into a single host buffer
+   *
+   * Each source is terminated with a newline so that no record spans two sources. The byte range
+   * applies to the concatenated data. Sets the uncomp_data_, uncomp_size_, byte_range_offset_, and
+   * byte_range_size_ data members, and loads the data into device memory if byte range
+   * parameters are not used.
+   *
+   * @param[in] range_offset Number of bytes offset from the start of the concatenated data
+   * @param[in] range_size Bytes to read; use `0` for all remaining data
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void ingest_multiple_sources(size_t range_offset,
+                               size_t range_size,
+                               rmm::cuda_stream_view stream);
+
   /**
    * @brief Extract the JSON objects keys from the input file with object rows.
    *
@@ -174,12 +190,26 @@ class reader::impl {
    */
   table_with_metadata convert_data_to_table(rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Parse the input data as nested records and store results a table
+   *
+   * Objects and arrays are read as struct and list columns. The schema is inferred from all
+   * records.
+   *
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Table and its metadata
+   */
+  table_with_metadata read_nested(rmm::cuda_stream_view stream);
+
  public:
   /**
-   * @brief Constructor from a dataset source with reader options.
+   * @brief Constructor from dataset sources or file paths with reader options.
+   *
+   * File paths are opened when reading, so only one of `sources` and `filepaths` is non-empty.
    */
-  explicit impl(std::unique_ptr<datasource> source,
-                std::string filepath,
+  explicit impl(std::vector<std::unique_ptr<datasource>> &&sources,
+                std::vector<std::string> const &filepaths,
                 json_reader_options const &options,
                 rmm::mr::device_memory_resource *mr);
 
@@ -0,0 +1,663 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file writer_impl.cu
+ * @brief cuDF-IO JSON writer class implementation
+ */
+
+#include "writer_impl.hpp"
+
+#include <io/utilities/pinned_memory_pool.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/detail/converters.hpp>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/tabulate.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <string>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace json {
+
+namespace {
+
+/**
+ * @brief Writes a character escaped for a JSON string, returning the number of bytes written.
+ *
+ * Only counts the bytes if `d_buffer` is null. Bytes of multi-byte UTF-8 characters are written
+ * unchanged.
+ */
+CUDA_HOST_DEVICE_CALLABLE size_type write_escaped_char(char chr, char* d_buffer)
+{
+  char escaped = 0;
+  switch (chr) {
+    case '\"': escaped = '\"'; break;
+    case '\\': escaped = '\\'; break;
+    case '\b': escaped = 'b'; break;
+    case '\f': escaped = 'f'; break;
+    case '\n': escaped = 'n'; break;
+    case '\r': escaped = 'r'; break;
+    case '\t': escaped = 't'; break;
+    default: break;
+  }
+  if (escaped != 0) {
+    if (d_buffer) {
+      d_buffer[0] = '\\';
+      d_buffer[1] = escaped;
+    }
+    return 2;
+  }
+  auto const byte = static_cast<unsigned char>(chr);
+  if (byte < 0x20) {
+    // Other control characters have no short escape sequence
+    if (d_buffer) {
+      auto const low = byte & 0xf;
+      memcpy(d_buffer, "\\u00", 4);
+      d_buffer[4] = '0' + (byte >> 4);
+      d_buffer[5] = low < 10 ? '0' + low : 'a' + low - 10;
+    }
+    return 6;
+  }
+  if (d_buffer) d_buffer[0] = chr;
+  return 1;
+}
+
+__device__ size_type write_string(string_view const& d_str, char* d_buffer)
+{
+  if (d_buffer) memcpy(d_buffer, d_str.data(), d_str.size_bytes());
+  return d_str.size_bytes();
+}
+
+__device__ size_type write_char(char chr, char* d_buffer)
+{
+  if (d_buffer) d_buffer[0] = chr;
+  return 1;
+}
+
+/**
+ * @brief Functor to escape and quote the strings of a column as JSON strings.
+ */
+struct escape_strings_fn {
+  column_device_view const d_column;
+  offset_type* d_offsets{};
+  char* d_chars{};
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_column.is_null(idx)) {
+      if (!d_chars) d_offsets[idx] = 0;
+      return;
+    }
+
+    auto const d_str  = d_column.element<string_view>(idx);
+    char* d_buffer    = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    offset_type bytes = 0;
+
+    bytes += write_char('\"', d_buffer);
+    for (size_type i = 0; i < d_str.size_bytes(); ++i) {
+      bytes += write_escaped_char(d_str.data()[i], d_buffer ? d_buffer + bytes : nullptr);
+    }
+    bytes += write_char('\"', d_buffer ? d_buffer + bytes : nullptr);
+
+    if (!d_chars) d_offsets[idx] = bytes;
+  }
+};
+
+/**
+ * @brief Functor to format the rows of a set of fields as JSON objects.
+ *
+ * The fields are expected to be already converted to JSON text. Null fields are skipped unless
+ * `include_nulls` is set, in which case they are written as `na_rep`. Null rows, if the objects
+ * have a null mask, are left empty. Each row is preceded by the row separator, starting with
+ * `first_separated_row`, and followed by the row terminator.
+ */
+struct format_objects_fn {
+  table_device_view const d_fields;
+  char const* d_key_chars;
+  size_type const* d_key_offsets;
+  bitmask_type const* d_null_mask;
+  size_type const mask_offset;
+  string_view const d_na_rep;
+  bool const include_nulls;
+  string_view const d_row_separator;
+  size_type const first_separated_row;
+  string_view const d_row_terminator;
+  offset_type* d_offsets{};
+  char* d_chars{};
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_null_mask && !bit_is_set(d_null_mask, mask_offset + idx)) {
+      if (!d_chars) d_offsets[idx] = 0;
+      return;
+    }
+
+    char* d_buffer    = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    offset_type bytes = 0;
+
+    if (idx >= first_separated_row) bytes += write_string(d_row_separator, d_buffer);
+    bytes += write_char('{', d_buffer ? d_buffer + bytes : nullptr);
+    bool first_field = true;
+    for (size_type col = 0; col < d_fields.num_columns(); ++col) {
+      auto const& d_field = d_fields.column(col);
+      auto const is_null  = d_field.is_null(idx);
+      if (is_null && !include_nulls) continue;
+
+      if (!first_field) bytes += write_char(',', d_buffer ? d_buffer + bytes : nullptr);
+      first_field = false;
+      auto const d_key =
+        string_view{d_key_chars + d_key_offsets[col], d_key_offsets[col + 1] - d_key_offsets[col]};
+      bytes += write_string(d_key, d_buffer ? d_buffer + bytes : nullptr);
+      bytes += write_string(is_null ? d_na_rep : d_field.element<string_view>(idx),
+                            d_buffer ? d_buffer + bytes : nullptr);
+    }
+    bytes += write_char('}', d_buffer ? d_buffer + bytes : nullptr);
+    bytes += write_string(d_row_terminator, d_buffer ? d_buffer + bytes : nullptr);
+
+    if (!d_chars) d_offsets[idx] = bytes;
+  }
+};
+
+/**
+ * @brief Functor to format the rows of a list column as JSON arrays.
+ *
+ * The elements are expected to be already converted to JSON text; null elements are written as
+ * `na_rep` to keep their positions. Null rows are left empty.
+ */
+struct format_lists_fn {
+  column_device_view const d_elements;
+  offset_type const* d_list_offsets;
+  bitmask_type const* d_null_mask;
+  size_type const mask_offset;
+  string_view const d_na_rep;
+  offset_type* d_offsets{};
+  char* d_chars{};
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_null_mask && !bit_is_set(d_null_mask, mask_offset + idx)) {
+      if (!d_chars) d_offsets[idx] = 0;
+      return;
+    }
+
+    char* d_buffer    = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    offset_type bytes = 0;
+
+    // The elements start at the first offset of the (possibly sliced) column
+    auto const begin = d_list_offsets[idx] - d_list_offsets[0];
+    auto const end   = d_list_offsets[idx + 1] - d_list_offsets[0];
+    bytes += write_char('[', d_buffer);
+    for (auto element = begin; element < end; ++element) {
+      if (element > begin) bytes += write_char(',', d_buffer ? d_buffer + bytes : nullptr);
+      bytes += write_string(
+        d_elements.is_null(element) ? d_na_rep : d_elements.element<string_view>(element),
+        d_buffer ? d_buffer + bytes : nullptr);
+    }
+    bytes += write_char(']', d_buffer ? d_buffer + bytes : nullptr);
+
+    if (!d_chars) d_offsets[idx] = bytes;
+  }
+};
+
+/**
+ * @brief Returns valid for the non-null, finite values of a floating point column.
+ *
+ * JSON has no representation for NaN and infinity, so these values are written as nulls.
+ */
+template <typename T>
+struct is_finite_fn {
+  column_device_view const d_column;
+
+  __device__ bool operator()(size_type idx) const
+  {
+    return d_column.is_valid(idx) && isfinite(d_column.element<T>(idx));
+  }
+};
+
+/**
+ * @brief Returns the strings of a column escaped and quoted as JSON strings
+ */
+std::unique_ptr<column> escape_strings(column_view const& column, rmm::cuda_stream_view stream)
+{
+  auto d_column = column_device_view::create(column, stream);
+  auto children = cudf::strings::detail::make_strings_children(
+    escape_strings_fn{*d_column}, column.size(), stream);
+
+  return make_strings_column(column.size(),
+                             std::move(children.first),
+                             std::move(children.second),
+                             column.null_count(),
+                             cudf::detail::copy_bitmask(column, stream),
+                             stream);
+}
+
+/**
+ * @brief Functor to convert a column of a non-nested type to JSON text, one string per row.
+ *
+ * Null rows are left null; the caller decides how to write them.
+ */
+struct column_to_strings_fn {
+  template <typename column_type>
+  constexpr static bool is_not_handled()
+  {
+    return not((std::is_same<column_type, cudf::string_view>::value) ||
+               (std::is_integral<column_type>::value) ||
+               (std::is_floating_point<column_type>::value) ||
+               (cudf::is_fixed_point<column_type>()) || (cudf::is_timestamp<column_type>()) ||
+               (cudf::is_duration<column_type>()));
+  }
+
+  explicit column_to_strings_fn(rmm::cuda_stream_view stream) : stream_(stream) {}
+
+  // bools:
+  //
+  template <typename column_type>
+  std::enable_if_t<std::is_same<column_type, bool>::value, std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    return cudf::strings::detail::from_booleans(column,
+                                                string_scalar{"true", true, stream_},
+                                                string_scalar{"false", true, stream_},
+                                                stream_,
+                                                rmm::mr::get_current_device_resource());
+  }
+
+  // strings:
+  //
+  template <typename column_type>
+  std::enable_if_t<std::is_same<column_type, cudf::string_view>::value, std::unique_ptr<column>>
+  operator()(column_view const& column) const
+  {
+    return escape_strings(column, stream_);
+  }
+
+  // ints:
+  //
+  template <typename column_type>
+  std::enable_if_t<std::is_integral<column_type>::value && !std::is_same<column_type, bool>::value,
+                   std::unique_ptr<column>>
+  operator()(column_view const& column) const
+  {
+    return cudf::strings::detail::from_integers(
+      column, stream_, rmm::mr::get_current_device_resource());
+  }
+
+  // floats:
+  //
+  template <typename column_type>
+  std::enable_if_t<std::is_floating_point<column_type>::value, std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    auto result = cudf::strings::detail::from_floats(
+      column, stream_, rmm::mr::get_current_device_resource());
+
+    auto d_column = column_device_view::create(column, stream_);
+    auto valid    = cudf::detail::valid_if(thrust::make_counting_iterator<size_type>(0),
+                                        thrust::make_counting_iterator<size_type>(column.size()),
+                                        is_finite_fn<column_type>{*d_column},
+                                        stream_);
+    result->set_null_mask(std::move(valid.first), valid.second);
+    return result;
+  }
+
+  // decimals:
+  //
+  template <typename column_type>
+  std::enable_if_t<cudf::is_fixed_point<column_type>(), std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    return cudf::strings::detail::from_fixed_point(
+      column, stream_, rmm::mr::get_current_device_resource());
+  }
+
+  // timestamps:
+  //
+  template <typename column_type>
+  std::enable_if_t<cudf::is_timestamp<column_type>(), std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    std::string format = [&]() {
+      if (std::is_same<cudf::timestamp_s, column_type>::value) {
+        return std::string{"%Y-%m-%dT%H:%M:%SZ"};
+      } else if (std::is_same<cudf::timestamp_ms, column_type>::value) {
+        return std::string{"%Y-%m-%dT%H:%M:%S.%3fZ"};
+      } else if (std::is_same<cudf::timestamp_us, column_type>::value) {
+        return std::string{"%Y-%m-%dT%H:%M:%S.%6fZ"};
+      } else if (std::is_same<cudf::timestamp_ns, column_type>::value) {
+        return std::string{"%Y-%m-%dT%H:%M:%S.%9fZ"};
+      } else {
+        return std::string{"%Y-%m-%d"};
+      }
+    }();
+
+    auto const timestamps = cudf::strings::detail::from_timestamps(
+      column, format, stream_, rmm::mr::get_current_device_resource());
+    return escape_strings(timestamps->view(), stream_);
+  }
+
+  // durations are written as the number of ticks of the column's resolution:
+  //
+  template <typename column_type>
+  std::enable_if_t<cudf::is_duration<column_type>(), std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    auto const ticks = column_view{data_type{type_to_id<typename column_type::rep>()},
+                                   column.size(),
+                                   column.head(),
+                                   column.null_mask(),
+                                   column.null_count(),
+                                   column.offset()};
+    return cudf::strings::detail::from_integers(
+      ticks, stream_, rmm::mr::get_current_device_resource());
+  }
+
+  // unsupported type of column:
+  //
+  template <typename column_type>
+  std::enable_if_t<is_not_handled<column_type>(), std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    CUDF_FAIL("Unsupported column type.");
+  }
+
+ private:
+  rmm::cuda_stream_view stream_;
+};
+
+/**
+ * @brief Returns the `"name":` keys of the given fields, escaped for JSON
+ */
+field_keys make_field_keys(std::vector<std::string> const& names, rmm::cuda_stream_view stream)
+{
+  std::vector<char> chars;
+  std::vector<size_type> offsets{0};
+  for (auto const& name : names) {
+    chars.push_back('\"');
+    for (auto chr : name) {
+      char escaped[6];
+      auto const size = write_escaped_char(chr, escaped);
+      chars.insert(chars.end(), escaped, escaped + size);
+    }
+    chars.insert(chars.end(), {'\"', ':'});
+    offsets.push_back(chars.size());
+  }
+  return {cudf::detail::make_device_uvector_async(chars, stream),
+          cudf::detail::make_device_uvector_async(offsets, stream)};
+}
+
+/**
+ * @brief Returns the name information of the child of a nested column at the given index.
+ *
+ * Falls back to the index as the name if the metadata does not name the child.
+ */
+column_name_info child_name_info(column_name_info const& parent, size_type index)
+{
+  return static_cast<size_t>(index) < parent.children.size()
+           ? parent.children[index]
+           : column_name_info{std::to_string(index)};
+}
+
+/**
+ * @brief Formats the rows of a set of fields that are already converted to JSON text as objects.
+ */
+std::unique_ptr<column> format_objects(table_view const& fields,
+                                       field_keys const& keys,
+                                       column_view const* parent,
+                                       string_view d_na_rep,
+                                       bool include_nulls,
+                                       rmm::cuda_stream_view stream,
+                                       string_view d_row_separator   = string_view{},
+                                       size_type first_separated_row = 0,
+                                       string_view d_row_terminator  = string_view{})
+{
+  auto const num_rows = parent != nullptr ? parent->size() : fields.num_rows();
+  auto d_fields       = table_device_view::create(fields, stream);
+  format_objects_fn fn{*d_fields,
+                       keys.chars.data(),
+                       keys.offsets.data(),
+                       parent != nullptr ? parent->null_mask() : nullptr,
+                       parent != nullptr ? parent->offset() : 0,
+                       d_na_rep,
+                       include_nulls,
+                       d_row_separator,
+                       first_separated_row,
+                       d_row_terminator};
+  auto children = cudf::strings::detail::make_strings_children(fn, num_rows, stream);
+
+  return make_strings_column(num_rows,
+                             std::move(children.first),
+                             std::move(children.second),
+                             parent != nullptr ? parent->null_count() : 0,
+                             parent != nullptr ? cudf::detail::copy_bitmask(*parent, stream)
+                                               : rmm::device_buffer{},
+                             stream);
+}
+
+/**
+ * @brief Converts a column to JSON text, one string per row.
+ *
+ * Struct columns are formatted as objects and list columns as arrays, after converting their
+ * children. Null rows are left null.
+ */
+std::unique_ptr<column> to_json_strings(column_view const& column,
+                                        column_name_info const& name_info,
+                                        string_view d_na_rep,
+                                        bool include_nulls,
+                                        rmm::cuda_stream_view stream)
+{
+  if (column.type().id() == type_id::STRUCT) {
+    structs_column_view const structs{column};
+    std::vector<std::unique_ptr<cudf::column>> fields;
+    std::vector<column_view> field_views;
+    std::vector<std::string> names;
+    for (size_type i = 0; i < structs.num_children(); ++i) {
+      auto const child_info = child_name_info(name_info, i);
+      fields.push_back(to_json_strings(
+        structs.get_sliced_child(i), child_info, d_na_rep, include_nulls, stream));
+      field_views.push_back(fields.back()->view());
+      names.push_back(child_info.name);
+    }
+    auto const keys = make_field_keys(names, stream);
+    return format_objects(
+      table_view{field_views}, keys, &column, d_na_rep, include_nulls, stream);
+  }
+
+  if (column.type().id() == type_id::LIST) {
+    lists_column_view const lists{column};
+    // The element metadata follows the offsets in the list's children
+    auto const element_info = child_name_info(name_info, lists_column_view::child_column_index);
+    auto const elements     = to_json_strings(
+      lists.get_sliced_child(stream), element_info, d_na_rep, include_nulls, stream);
+    auto d_elements = column_device_view::create(elements->view(), stream);
+    format_lists_fn fn{
+      *d_elements, lists.offsets_begin(), column.null_mask(), column.offset(), d_na_rep};
+    auto children = cudf::strings::detail::make_strings_children(fn, column.size(), stream);
+
+    return make_strings_column(column.size(),
+                               std::move(children.first),
+                               std::move(children.second),
+                               column.null_count(),
+                               cudf::detail::copy_bitmask(column, stream),
+                               stream);
+  }
+
+  return cudf::type_dispatcher(column.type(), column_to_strings_fn{stream}, column);
+}
+
+}  // unnamed namespace
+
+// Forward to implementation
+writer::writer(std::unique_ptr<data_sink> sink,
+               json_writer_options const& options,
+               rmm::mr::device_memory_resource* mr)
+  : _impl(std::make_unique<impl>(std::move(sink), options, mr))
+{
+}
+
+// Destructor within this translation unit
+writer::~writer() = default;
+
+writer::impl::impl(std::unique_ptr<data_sink> sink,
+                   json_writer_options const& options,
+                   rmm::mr::device_memory_resource* mr)
+  : out_sink_(std::move(sink)), mr_(mr), options_(options)
+{
+}
+
+std::unique_ptr<column> writer::impl::format_rows(table_view const& table,
+                                                  host_span<column_name_info const> column_names,
+                                                  field_keys const& keys,
+                                                  bool first_chunk,
+                                                  rmm::cuda_stream_view stream)
+{
+  string_scalar na_rep{options_.get_na_rep(), true, stream};
+  auto const d_na_rep      = na_rep.value(stream);
+  auto const include_nulls = options_.is_enabled_include_nulls();
+
+  std::vector<std::unique_ptr<column>> fields;
+  std::vector<column_view> field_views;
+  for (size_type i = 0; i < table.num_columns(); ++i) {
+    fields.push_back(
+      to_json_strings(table.column(i), column_names[i], d_na_rep, include_nulls, stream));
+    field_views.push_back(fields.back()->view());
+  }
+
+  // JSON Lines terminates each row; otherwise rows are elements of a single array
+  string_scalar separator{options_.is_enabled_lines() ? "" : ",", true, stream};
+  string_scalar terminator{options_.is_enabled_lines() ? "\n" : "", true, stream};
+  return format_objects(table_view{field_views},
+                        keys,
+                        nullptr,
+                        d_na_rep,
+                        include_nulls,
+                        stream,
+                        separator.value(stream),
+                        first_chunk ? 1 : 0,
+                        terminator.value(stream));
+}
+
+void writer::impl::write_to_sink(device_span<char const> data, rmm::cuda_stream_view stream)
+{
+  if (data.empty()) return;
+  if (out_sink_->is_device_write_preferred(data.size())) {
+    out_sink_->device_write(data.data(), data.size(), stream);
+  } else {
+    pinned_buffer<char> h_data(data.size());
+    CUDA_TRY(cudaMemcpyAsync(
+      h_data.get(), data.data(), data.size(), cudaMemcpyDeviceToHost, stream.value()));
+    stream.synchronize();
+    out_sink_->host_write(h_data.get(), data.size());
+  }
+}
+
+void writer::impl::write(table_view const& table,
+                         table_metadata const* metadata,
+                         rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(table.num_columns() > 0, "Empty table.");
+
+  // Column names, in order of preference, come from the schema information, the column names, or
+  // the column indices
+  std::vector<column_name_info> column_names;
+  for (size_type i = 0; i < table.num_columns(); ++i) {
+    if (metadata != nullptr &&
+        metadata->schema_info.size() == static_cast<size_t>(table.num_columns())) {
+      column_names.push_back(metadata->schema_info[i]);
+    } else if (metadata != nullptr &&
+               metadata->column_names.size() == static_cast<size_t>(table.num_columns())) {
+      column_names.emplace_back(metadata->column_names[i]);
+    } else {
+      column_names.emplace_back(std::to_string(i));
+    }
+  }
+  std::vector<std::string> names;
+  std::transform(column_names.cbegin(),
+                 column_names.cend(),
+                 std::back_inserter(names),
+                 [](auto const& info) { return info.name; });
+  auto const keys = make_field_keys(names, stream);
+
+  auto const is_lines = options_.is_enabled_lines();
+  if (!is_lines) out_sink_->host_write("[", 1);
+
+  if (table.num_rows() > 0) {
+    auto const n_rows_per_chunk = options_.get_rows_per_chunk();
+    CUDF_EXPECTS(n_rows_per_chunk > 0, "write_json: invalid chunk_rows; must be positive");
+
+    auto const num_rows = table.num_rows();
+    std::vector<table_view> vector_views;
+
+    if (num_rows <= n_rows_per_chunk) {
+      vector_views.push_back(table);
+    } else {
+      std::vector<size_type> splits((num_rows - 1) / n_rows_per_chunk);
+      thrust::tabulate(splits.begin(), splits.end(), [n_rows_per_chunk](auto idx) {
+        return (idx + 1) * n_rows_per_chunk;
+      });
+
+      // split table_view into chunks:
+      vector_views = cudf::split(table, splits);
+    }
+
+    bool first_chunk = true;
+    for (auto&& sub_view : vector_views) {
+      auto const rows  = format_rows(sub_view, column_names, keys, first_chunk, stream);
+      auto const chars = strings_column_view{rows->view()}.chars();
+      write_to_sink(
+        device_span<char const>{chars.data<char>(), static_cast<size_t>(chars.size())}, stream);
+      first_chunk = false;
+    }
+  }
+
+  if (!is_lines) out_sink_->host_write("]", 1);
+}
+
+void writer::write(table_view const& table,
+                   table_metadata const* metadata,
+                   rmm::cuda_stream_view stream)
+{
+  _impl->write(table, metadata, stream);
+}
+
+}  // namespace json
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/detail/json.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace json {
+
+using namespace cudf::io;
+
+/**
+ * @brief The `"name":` keys of the fields of a JSON object, concatenated in device memory
+ */
+struct field_keys {
+  rmm::device_uvector<char> chars;
+  rmm::device_uvector<size_type> offsets;  // num_fields + 1 offsets into `chars`
+};
+
+/**
+ * @brief Implementation for JSON writer
+ */
+class writer::impl {
+ public:
+  /**
+   * @brief Constructor with writer options.
+   *
+   * @param sink Output sink
+   * @param options Settings for controlling behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  impl(std::unique_ptr<data_sink> sink,
+       json_writer_options const& options,
+       rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Write an entire dataset to JSON format.
+   *
+   * @param table The set of columns
+   * @param metadata The metadata associated with the table
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void write(table_view const& table,
+             table_metadata const* metadata = nullptr,
+             rmm::cuda_stream_view stream   = rmm::cuda_stream_default);
+
+ private:
+  /**
+   * @brief Formats the rows of a table as JSON objects, including the separators between rows.
+   *
+   * @param table The set of columns
+   * @param column_names Names of the columns and their children
+   * @param keys Keys of the top-level columns
+   * @param first_chunk Whether the table holds the first rows of the output
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Strings column holding the formatted rows
+   */
+  std::unique_ptr<column> format_rows(table_view const& table,
+                                      host_span<column_name_info const> column_names,
+                                      field_keys const& keys,
+                                      bool first_chunk,
+                                      rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Writes a buffer of device data to the sink.
+   */
+  void write_to_sink(device_span<char const> data, rmm::cuda_stream_view stream);
+
+  std::unique_ptr<data_sink> out_sink_;
+  rmm::mr::device_memory_resource* mr_ = nullptr;
+  json_writer_options const options_;
+};
+
+}  // namespace json
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
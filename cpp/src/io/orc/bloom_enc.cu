@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bloom_filter.cuh"
+#include "orc_gpu.h"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace io {
+namespace orc {
+namespace gpu {
+constexpr unsigned int bloom_block_size = 256;
+
+/**
+ * @brief Returns the ORC bloom filter hash of a non-null element
+ */
+__device__ uint64_t bloom_element_hash(column_device_view const &col, size_type row)
+{
+  switch (col.type().id()) {
+    case type_id::INT8: return bloom_long_hash(col.element<int8_t>(row));
+    case type_id::INT16: return bloom_long_hash(col.element<int16_t>(row));
+    case type_id::INT32: return bloom_long_hash(col.element<int32_t>(row));
+    case type_id::INT64: return bloom_long_hash(col.element<int64_t>(row));
+    case type_id::FLOAT32: return bloom_double_hash(col.element<float>(row));
+    case type_id::FLOAT64: return bloom_double_hash(col.element<double>(row));
+    case type_id::TIMESTAMP_DAYS:
+      return bloom_long_hash(col.element<timestamp_D>(row).time_since_epoch().count());
+    case type_id::STRING: {
+      auto const str = col.element<string_view>(row);
+      return bloom_bytes_hash(reinterpret_cast<uint8_t const *>(str.data()), str.size_bytes());
+    }
+    default: return 0;
+  }
+}
+
+/**
+ * @brief Adds the values of each rowgroup to its bloom filter
+ *
+ * @param[in,out] bitsets Zero-initialized bloom filters [column][rowgroup][word]
+ * @param[in] view Table being written
+ * @param[in] column_indexes Indexes of the columns in `view` [column]
+ * @param[in] row_index_stride Rowgroup size in rows
+ * @param[in] params Size and number of hash functions of each bloom filter
+ */
+__global__ void __launch_bounds__(bloom_block_size)
+  gpu_build_bloom_filters(uint64_t *bitsets,
+                          table_device_view view,
+                          size_type const *column_indexes,
+                          uint32_t row_index_stride,
+                          bloom_filter_params params)
+{
+  auto const rowgroup = blockIdx.x;
+  auto const col      = view.column(column_indexes[blockIdx.y]);
+  auto const num_bits = params.num_words * 64;
+  auto const bitset =
+    bitsets + (static_cast<size_t>(blockIdx.y) * gridDim.x + rowgroup) * params.num_words;
+  auto const start_row = rowgroup * row_index_stride;
+  auto const end_row   = min(start_row + row_index_stride, static_cast<uint32_t>(col.size()));
+
+  for (auto row = start_row + threadIdx.x; row < end_row; row += blockDim.x) {
+    if (col.is_null(row)) { continue; }
+    auto const hash = bloom_element_hash(col, row);
+    for (uint32_t i = 1; i <= params.num_hash_functions; ++i) {
+      auto const pos = bloom_bit_position(hash, i, num_bits);
+      atomicOr(reinterpret_cast<unsigned long long *>(bitset + pos / 64), 1ull << (pos % 64));
+    }
+  }
+}
+
+void BuildBloomFilters(uint64_t *bitsets,
+                       table_device_view const &view,
+                       size_type const *column_indexes,
+                       uint32_t num_columns,
+                       uint32_t num_rowgroups,
+                       uint32_t row_index_stride,
+                       bloom_filter_params params,
+                       rmm::cuda_stream_view stream)
+{
+  CUDA_TRY(cudaMemsetAsync(bitsets,
+                           0,
+                           sizeof(uint64_t) * params.num_words * num_rowgroups * num_columns,
+                           stream.value()));
+  dim3 dim_grid(num_rowgroups, num_columns);
+  gpu_build_bloom_filters<<<dim_grid, bloom_block_size, 0, stream.value()>>>(
+    bitsets, view, column_indexes, row_index_stride, params);
+}
+
+}  // namespace gpu
+}  // namespace orc
+}  // namespace io
+}  // namespace cudf
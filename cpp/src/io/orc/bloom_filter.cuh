@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file bloom_filter.cuh
+ * @brief ORC bloom filter hashing, compatible with the BLOOM_FILTER_UTF8 streams of the Java and
+ * C++ ORC libraries
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdint.h>
+#include <string.h>
+
+namespace cudf {
+namespace io {
+namespace orc {
+
+// False positive probability of the written bloom filters (ORC's `orc.bloom.filter.fpp` default)
+constexpr double bloom_filter_fpp = 0.01;
+
+/**
+ * @brief Size and number of hash functions of a bloom filter
+ */
+struct bloom_filter_params {
+  uint32_t num_words;           // number of 64-bit words of the bitset
+  uint32_t num_hash_functions;  // number of bits set per value
+};
+
+/**
+ * @brief Returns the parameters ORC uses for a bloom filter of `expected_entries` values
+ */
+inline bloom_filter_params get_bloom_filter_params(size_t expected_entries)
+{
+  auto const n    = static_cast<double>(std::max<size_t>(expected_entries, 1));
+  auto const log2 = std::log(2.0);
+  auto const bits = static_cast<int64_t>(-n * std::log(bloom_filter_fpp) / (log2 * log2));
+  // Rounded up to a multiple of 64, adding a full word if already aligned, as ORC does
+  auto const num_bits = bits + (64 - bits % 64);
+  auto const num_hash = std::max<int64_t>(1, std::llround(num_bits / n * log2));
+  return {static_cast<uint32_t>(num_bits / 64), static_cast<uint32_t>(num_hash)};
+}
+
+/**
+ * @brief Arithmetic right shift, as Java's `>>` on `long`
+ */
+CUDA_HOST_DEVICE_CALLABLE uint64_t bloom_sar(uint64_t v, int shift)
+{
+  return static_cast<uint64_t>(static_cast<int64_t>(v) >> shift);
+}
+
+CUDA_HOST_DEVICE_CALLABLE uint64_t bloom_rotl(uint64_t v, int shift)
+{
+  return (v << shift) | (v >> (64 - shift));
+}
+
+/**
+ * @brief Thomas Wang's 64-bit integer hash, used by ORC for integer, date and floating-point values
+ */
+CUDA_HOST_DEVICE_CALLABLE uint64_t bloom_long_hash(int64_t value)
+{
+  auto key = static_cast<uint64_t>(value);
+  key      = ~key + (key << 21);
+  key ^= bloom_sar(key, 24);
+  key = key + (key << 3) + (key << 8);
+  key ^= bloom_sar(key, 14);
+  key = key + (key << 2) + (key << 4);
+  key ^= bloom_sar(key, 28);
+  key += key << 31;
+  return key;
+}
+
+/**
+ * @brief Hash of a floating-point value; the hash of its bits, with NaNs made canonical
+ */
+CUDA_HOST_DEVICE_CALLABLE uint64_t bloom_double_hash(double value)
+{
+  int64_t bits = INT64_C(0x7ff8000000000000);
+  if (value == value) { memcpy(&bits, &value, sizeof(bits)); }
+  return bloom_long_hash(bits);
+}
+
+/**
+ * @brief 64-bit Murmur3 variant of Hive and ORC, used for string values
+ */
+CUDA_HOST_DEVICE_CALLABLE uint64_t bloom_bytes_hash(uint8_t const *data, uint32_t length)
+{
+  constexpr uint64_t c1 = 0x87c37b91114253d5ull;
+  constexpr uint64_t c2 = 0x4cf5ad432745937full;
+  uint64_t hash         = 104729;  // ORC's seed
+
+  auto const num_blocks = length >> 3;
+  for (uint32_t i = 0; i < num_blocks; ++i) {
+    uint64_t k = 0;
+    for (int b = 7; b >= 0; --b) {
+      k = (k << 8) | data[i * 8 + b];
+    }
+    k    = bloom_rotl(k * c1, 31) * c2;
+    hash = bloom_rotl(hash ^ k, 27) * 5 + 0x52dce729;
+  }
+  auto const tail_len = length & 7;
+  if (tail_len != 0) {
+    uint64_t k = 0;
+    for (int b = tail_len - 1; b >= 0; --b) {
+      k = (k << 8) | data[num_blocks * 8 + b];
+    }
+    hash ^= bloom_rotl(k * c1, 31) * c2;
+  }
+
+  hash ^= length;
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ull;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+/**
+ * @brief Returns the bit set by the hash function `i` (1-based) for a value hash
+ */
+CUDA_HOST_DEVICE_CALLABLE uint32_t bloom_bit_position(uint64_t hash, uint32_t i, uint32_t num_bits)
+{
+  auto combined = static_cast<int32_t>(static_cast<uint32_t>(hash) +
+                                       i * static_cast<uint32_t>(hash >> 32));
+  if (combined < 0) { combined = ~combined; }
+  return static_cast<uint32_t>(combined) % num_bits;
+}
+
+/**
+ * @brief Tests whether a value hash may have been added to a bloom filter
+ *
+ * @param bitset Bloom filter words; bit `n` is bit `n % 64` of word `n / 64`
+ * @param num_words Number of words in `bitset`
+ * @param num_hash_functions Number of hash functions of the filter
+ * @param hash Value hash
+ *
+ * @return false if the value is definitely not in the filter
+ */
+CUDA_HOST_DEVICE_CALLABLE bool bloom_filter_may_contain(uint64_t const *bitset,
+                                                        uint32_t num_words,
+                                                        uint32_t num_hash_functions,
+                                                        uint64_t hash)
+{
+  auto const num_bits = num_words * 64;
+  for (uint32_t i = 1; i <= num_hash_functions; ++i) {
+    auto const pos = bloom_bit_position(hash, i, num_bits);
+    if (!(bitset[pos / 64] & (1ull << (pos % 64)))) { return false; }
+  }
+  return true;
+}
+
+}  // namespace orc
+}  // namespace io
+}  // namespace cudf
@@ -19,6 +19,8 @@
 #include "orc_field_reader.hpp"
 #include "orc_field_writer.hpp"
 
+#include <cudf/detail/nvtx/ranges.hpp>
+
 namespace cudf {
 namespace io {
 namespace orc {
@@ -201,6 +203,33 @@ void ProtobufReader::read(Metadata &s, size_t maxlen)
   function_builder(s, maxlen, op);
 }
 
+void ProtobufReader::read(RowIndexEntry &s, size_t maxlen)
+{
+  auto op = std::make_tuple(make_packed_field_reader(1, s.positions),
+                            make_field_reader(2, s.statistics));
+  function_builder(s, maxlen, op);
+}
+
+void ProtobufReader::read(RowIndex &s, size_t maxlen)
+{
+  auto op = std::make_tuple(make_field_reader(1, s.entry));
+  function_builder(s, maxlen, op);
+}
+
+void ProtobufReader::read(BloomFilter &s, size_t maxlen)
+{
+  auto op = std::make_tuple(make_field_reader(1, s.numHashFunctions),
+                            make_fixed64_field_reader(2, s.bitset),
+                            make_field_reader(3, s.utf8bitset));
+  function_builder(s, maxlen, op);
+}
+
+void ProtobufReader::read(BloomFilterIndex &s, size_t maxlen)
+{
+  auto op = std::make_tuple(make_field_reader(1, s.bloomFilter));
+  function_builder(s, maxlen, op);
+}
+
 /**
  * @Brief Add a single rowIndexEntry, negative input values treated as not present
  */
@@ -346,6 +375,24 @@ size_t ProtobufWriter::write(const Metadata &s)
   return w.value();
 }
 
+size_t ProtobufWriter::write(const BloomFilter &s)
+{
+  ProtobufFieldWriter w(this);
+  w.field_uint(1, s.numHashFunctions);
+  for (auto const word : s.bitset) {
+    w.field_fixed64(2, word);
+  }
+  if (!s.utf8bitset.empty()) { w.field_string(3, s.utf8bitset); }
+  return w.value();
+}
+
+size_t ProtobufWriter::write(const BloomFilterIndex &s)
+{
+  ProtobufFieldWriter w(this);
+  w.field_repeated_struct(1, s.bloomFilter);
+  return w.value();
+}
+
 OrcDecompressor::OrcDecompressor(CompressionKind kind, uint32_t blockSize)
   : m_kind(kind), m_blockSize(blockSize)
 {
@@ -451,6 +498,9 @@ metadata::metadata(datasource *const src) : source(src)
   // If no compressed is used, the decompressor is simply a pass-through
   decompressor = std::make_unique<OrcDecompressor>(ps.compression, ps.compressionBlockSize);
 
+  stage_range range{"orc::parse_footer",
+                    static_cast<int64_t>(ps.footerLength + ps.metadataLength)};
+
   // Read compressed filefooter section
   buffer           = source->host_read(len - ps_length - 1 - ps.footerLength, ps.footerLength);
   size_t ff_length = 0;
@@ -130,6 +130,25 @@ struct Metadata {
   std::vector<StripeStatistics> stripeStats;
 };
 
+struct RowIndexEntry {
+  std::vector<uint64_t> positions;  // positions of the row group start within each stream
+  column_statistics statistics;     // statistics of the row group
+};
+
+struct RowIndex {
+  std::vector<RowIndexEntry> entry;  // one entry per row group of the stripe
+};
+
+struct BloomFilter {
+  uint32_t numHashFunctions = 0;  // number of bits set per value
+  std::vector<uint64_t> bitset;   // filter words, as written by older writers
+  std::string utf8bitset;         // filter words in little-endian byte order
+};
+
+struct BloomFilterIndex {
+  std::vector<BloomFilter> bloomFilter;  // one filter per row group of the stripe
+};
+
 /**
  * @brief Class for parsing Orc's Protocol Buffers encoded metadata
  */
@@ -161,6 +180,10 @@ class ProtobufReader {
   void read(column_statistics &, size_t maxlen);
   void read(StripeStatistics &, size_t maxlen);
   void read(Metadata &, size_t maxlen);
+  void read(RowIndexEntry &, size_t maxlen);
+  void read(RowIndex &, size_t maxlen);
+  void read(BloomFilter &, size_t maxlen);
+  void read(BloomFilterIndex &, size_t maxlen);
 
  private:
   template <int index>
@@ -385,6 +408,27 @@ class ProtobufReader {
     }
   };
 
+  template <typename T>
+  struct fixed64_field_reader {
+    int const encoded_field_number;
+    T &output_value;
+
+    fixed64_field_reader(int field_number, T &field_value)
+      : encoded_field_number((field_number * 8) + PB_TYPE_FIXED64), output_value(field_value)
+    {
+    }
+
+    inline void operator()(ProtobufReader *pbr, const uint8_t *end)
+    {
+      uint64_t value = 0;
+      for (int i = 7; i >= 0; --i) {
+        value = (value << 8) | ((pbr->m_cur + i < end) ? pbr->m_cur[i] : 0);
+      }
+      pbr->skip_bytes(8);
+      output_value.push_back(value);
+    }
+  };
+
   const uint8_t *const m_base;
   const uint8_t *m_cur;
   const uint8_t *const m_end;
@@ -433,6 +477,20 @@ class ProtobufReader {
   {
     return raw_field_reader<T>(field_number, field_value);
   }
+
+  /**
+   * @brief Returns a reader object for repeated, non-packed `fixed64` fields.
+   *
+   * @tparam Type of the field (inferred from `field_value` type)
+   * @param field_number The field number of the field to be read
+   * @param field_value Reference to the container the values are appended to
+   * @return the fixed64 field reader object
+   */
+  template <typename T>
+  static auto make_fixed64_field_reader(int field_number, T &field_value)
+  {
+    return fixed64_field_reader<T>(field_number, field_value);
+  }
 };
 
 template <>
@@ -525,6 +583,8 @@ class ProtobufWriter {
   size_t write(const ColumnEncoding &);
   size_t write(const StripeStatistics &);
   size_t write(const Metadata &);
+  size_t write(const BloomFilter &);
+  size_t write(const BloomFilterIndex &);
 
  protected:
   std::vector<uint8_t> *m_buf;
@@ -65,6 +65,15 @@ struct ProtobufWriter::ProtobufFieldWriter {
     (*(p->m_buf))[lpos] = static_cast<uint8_t>(sz);
   }
 
+  /**
+   * @brief Function to write a fixed-size 64-bit value to the internal buffer
+   */
+  void field_fixed64(int field, uint64_t value)
+  {
+    struct_size += p->put_uint(field * 8 + PB_TYPE_FIXED64) + 8;
+    for (int i = 0; i < 8; i++) p->putb(static_cast<uint8_t>(value >> (8 * i)));
+  }
+
   /**
    * @brief Function to write a string to the internal buffer
    */
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "bloom_filter.cuh"
 #include "timezone.cuh"
 
 #include <io/comp/gpuinflate.h>
@@ -436,6 +437,27 @@ void orc_encode_statistics(uint8_t *blob_bfr,
                            uint32_t statistics_count,
                            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
+/**
+ * @brief Launches kernel to build the bloom filters of each rowgroup of the given columns
+ *
+ * @param[out] bitsets Bloom filters [column][rowgroup][params.num_words]
+ * @param[in] view Table being written
+ * @param[in] column_indexes Device array of the indexes of the columns in `view` [num_columns]
+ * @param[in] num_columns Number of columns with bloom filters
+ * @param[in] num_rowgroups Number of rowgroups
+ * @param[in] row_index_stride Rowgroup size in rows
+ * @param[in] params Size and number of hash functions of each bloom filter
+ * @param[in] stream CUDA stream to use, default `rmm::cuda_stream_default`
+ */
+void BuildBloomFilters(uint64_t *bitsets,
+                       table_device_view const &view,
+                       size_type const *column_indexes,
+                       uint32_t num_columns,
+                       uint32_t num_rowgroups,
+                       uint32_t row_index_stride,
+                       bloom_filter_params params,
+                       rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
 }  // namespace gpu
 }  // namespace orc
 }  // namespace io
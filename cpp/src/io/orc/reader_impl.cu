@@ -23,11 +23,21 @@
 #include "timezone.cuh"
 
 #include <io/comp/gpuinflate.h>
+#include <io/utilities/batched_read.hpp>
+#include <io/utilities/stats_filter.hpp>
 #include "orc.h"
 
+#include <cudf/ast/detail/transform.cuh>
+#include <cudf/column/column.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/stream_pool.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/io/memory_resource.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
@@ -35,6 +45,10 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <exception>
+#include <future>
+#include <numeric>
 
 namespace cudf {
 namespace io {
@@ -185,6 +199,11 @@ size_t gather_stream_info(const size_t stripe_index,
         }
       }
     }
+    if (stream.kind == orc::BLOOM_FILTER || stream.kind == orc::BLOOM_FILTER_UTF8) {
+      // Bloom filters are only read on the host, when filtering stripes
+      src_offset += stream.length;
+      continue;
+    }
     if (col != -1) {
       if (src_offset >= stripeinfo->indexLength || use_index) {
         // NOTE: skip_count field is temporarily used to track index ordering
@@ -213,6 +232,536 @@ size_t gather_stream_info(const size_t stripe_index,
   return dst_offset;
 }
 
+// Parsed statistics of a column, as opposed to the public `cudf::io::column_statistics`
+using orc_column_statistics = cudf::io::orc::column_statistics;
+
+/**
+ * @brief Functor that builds the min and max statistics columns of one output column
+ *
+ * Missing statistics are replaced by the widest range of the output type so that the stripe or
+ * row group is never skipped.
+ */
+struct stats_columns_builder {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return (cudf::is_numeric<T>() and not std::is_same<T, bool>::value) or
+           cudf::is_timestamp<T>();
+  }
+
+  template <typename T>
+  static thrust::optional<std::pair<T, T>> get_min_max(orc_column_statistics const *stats)
+  {
+    if (stats == nullptr) { return thrust::nullopt; }
+    if constexpr (std::is_integral<T>::value) {
+      auto const &s = stats->int_stats;
+      if (s && s->has_minimum() && s->has_maximum()) {
+        return std::make_pair(static_cast<T>(*s->minimum()), static_cast<T>(*s->maximum()));
+      }
+    } else if constexpr (std::is_floating_point<T>::value) {
+      auto const &s = stats->double_stats;
+      if (s && s->has_minimum() && s->has_maximum()) {
+        return std::make_pair(static_cast<T>(*s->minimum()), static_cast<T>(*s->maximum()));
+      }
+    } else {
+      // Only DATE columns map to timestamps that statistics are evaluated on
+      auto const &s = stats->date_stats;
+      if (s && s->has_minimum() && s->has_maximum()) {
+        return std::make_pair(T{cudf::duration_D{*s->minimum()}},
+                              T{cudf::duration_D{*s->maximum()}});
+      }
+    }
+    return thrust::nullopt;
+  }
+
+  template <typename T, std::enable_if_t<is_supported<T>()> * = nullptr>
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> operator()(
+    data_type dtype,
+    std::vector<orc_column_statistics const *> const &stats,
+    rmm::cuda_stream_view stream)
+  {
+    std::vector<T> min_values;
+    std::vector<T> max_values;
+    min_values.reserve(stats.size());
+    max_values.reserve(stats.size());
+    auto const unbounded = unbounded_stats_range<T>();
+    for (auto const s : stats) {
+      auto const min_max = get_min_max<T>(s);
+      min_values.push_back(min_max.has_value() ? min_max->first : unbounded.first);
+      max_values.push_back(min_max.has_value() ? min_max->second : unbounded.second);
+    }
+    auto make_stats_column = [&](std::vector<T> const &values) {
+      auto d_values = cudf::detail::make_device_uvector_async(values, stream);
+      return std::make_unique<column>(
+        dtype, static_cast<size_type>(values.size()), d_values.release());
+    };
+    return {make_stats_column(min_values), make_stats_column(max_values)};
+  }
+
+  template <typename T, std::enable_if_t<!is_supported<T>()> * = nullptr>
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> operator()(
+    data_type, std::vector<orc_column_statistics const *> const &, rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Unsupported statistics column type");
+  }
+};
+
+/**
+ * @brief Evaluates a filter converted by `stats_expression_converter` on a set of statistics
+ *
+ * @param stats_filter Converted filter expression
+ * @param stats_types Output types of the statistics columns
+ * @param stats Statistics of each statistics column, one per evaluated stripe or row group
+ * @param num_stats_rows Number of evaluated stripes or row groups
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Whether each stripe or row group may contain matching data
+ */
+std::vector<uint8_t> evaluate_stats_filter(
+  ast::expression const &stats_filter,
+  std::vector<data_type> const &stats_types,
+  std::vector<std::vector<orc_column_statistics const *>> const &stats,
+  size_type num_stats_rows,
+  rmm::cuda_stream_view stream)
+{
+  std::vector<std::unique_ptr<column>> stats_table;
+  auto d_always_true =
+    cudf::detail::make_device_uvector_async(std::vector<uint8_t>(num_stats_rows, 1), stream);
+  stats_table.push_back(
+    std::make_unique<column>(data_type{type_id::BOOL8}, num_stats_rows, d_always_true.release()));
+  for (size_t i = 0; i < stats_types.size(); ++i) {
+    auto min_max = type_dispatcher(
+      stats_types[i], stats_columns_builder{}, stats_types[i], stats[i], stream);
+    stats_table.push_back(std::move(min_max.first));
+    stats_table.push_back(std::move(min_max.second));
+  }
+
+  auto const stats_view = table{std::move(stats_table)};
+  auto const result = cudf::ast::detail::compute_column(stats_view.view(), stats_filter, stream);
+  return cudf::detail::make_std_vector_sync(
+    device_span<uint8_t const>(result->view().data<uint8_t>(), num_stats_rows), stream);
+}
+
+/**
+ * @brief Reads and parses an index stream, such as the row index, of a column within a stripe
+ *
+ * @return The parsed index, or an empty optional if the stripe has no such stream for the column
+ */
+template <typename IndexType>
+thrust::optional<IndexType> read_index_stream(cudf::io::orc::metadata &md,
+                                              datasource &source,
+                                              orc::StripeInformation const &stripe,
+                                              orc::StripeFooter const &footer,
+                                              uint32_t column_id,
+                                              orc::StreamKind kind)
+{
+  uint64_t offset = stripe.offset;
+  for (auto const &stream : footer.streams) {
+    if (stream.kind == kind && stream.column_id.value_or(0) == column_id) {
+      if (stream.length == 0 || offset + stream.length > source.size()) { break; }
+      auto const buffer   = source.host_read(offset, stream.length);
+      size_t index_length = 0;
+      auto const index_data =
+        md.decompressor->Decompress(buffer->data(), stream.length, &index_length);
+      IndexType index;
+      ProtobufReader(index_data, index_length).read(index);
+      return index;
+    }
+    offset += stream.length;
+  }
+  return thrust::nullopt;
+}
+
+/**
+ * @brief Reads the bloom filters of a column within a stripe, with their words in `bitset`
+ */
+std::vector<orc::BloomFilter> read_bloom_filters(cudf::io::orc::metadata &md,
+                                                 datasource &source,
+                                                 orc::StripeInformation const &stripe,
+                                                 orc::StripeFooter const &footer,
+                                                 uint32_t column_id)
+{
+  auto index = read_index_stream<orc::BloomFilterIndex>(
+    md, source, stripe, footer, column_id, orc::BLOOM_FILTER_UTF8);
+  if (!index.has_value()) { return {}; }
+  for (auto &filter : index->bloomFilter) {
+    if (!filter.utf8bitset.empty()) {
+      auto const &bytes = filter.utf8bitset;
+      filter.bitset.assign(bytes.size() / sizeof(uint64_t), 0);
+      for (size_t i = 0; i < filter.bitset.size() * sizeof(uint64_t); ++i) {
+        filter.bitset[i / sizeof(uint64_t)] |= static_cast<uint64_t>(static_cast<uint8_t>(bytes[i]))
+                                               << (8 * (i % sizeof(uint64_t)));
+      }
+      filter.utf8bitset.clear();
+    }
+  }
+  return std::move(index->bloomFilter);
+}
+
+/**
+ * @brief Returns the bloom filter hash of a literal compared with a column of the given ORC type
+ *
+ * @return The hash, or an empty optional if the literal cannot be tested against the filters
+ */
+thrust::optional<uint64_t> literal_bloom_hash(ast::literal const &lit, orc::TypeKind kind)
+{
+  auto const &value = lit.get_scalar();
+  if (!value.is_valid()) { return thrust::nullopt; }
+  auto const get = [&](auto type_tag) {
+    using T = decltype(type_tag);
+    return static_cast<numeric_scalar<T> const &>(value).value();
+  };
+  switch (kind) {
+    case orc::BYTE:
+    case orc::SHORT:
+    case orc::INT:
+    case orc::LONG:
+      switch (value.type().id()) {
+        case type_id::INT8: return bloom_long_hash(get(int8_t{}));
+        case type_id::INT16: return bloom_long_hash(get(int16_t{}));
+        case type_id::INT32: return bloom_long_hash(get(int32_t{}));
+        case type_id::INT64: return bloom_long_hash(get(int64_t{}));
+        case type_id::UINT8: return bloom_long_hash(get(uint8_t{}));
+        case type_id::UINT16: return bloom_long_hash(get(uint16_t{}));
+        case type_id::UINT32: return bloom_long_hash(get(uint32_t{}));
+        default: return thrust::nullopt;
+      }
+    // Floating-point values are hashed as doubles; only same-width literals compare exactly
+    case orc::FLOAT:
+      if (value.type().id() != type_id::FLOAT32) { return thrust::nullopt; }
+      return bloom_double_hash(get(float{}));
+    case orc::DOUBLE:
+      if (value.type().id() != type_id::FLOAT64) { return thrust::nullopt; }
+      return bloom_double_hash(get(double{}));
+    case orc::DATE:
+      if (value.type().id() != type_id::TIMESTAMP_DAYS) { return thrust::nullopt; }
+      return bloom_long_hash(static_cast<timestamp_scalar<timestamp_D> const &>(value)
+                               .value()
+                               .time_since_epoch()
+                               .count());
+    default: return thrust::nullopt;
+  }
+}
+
+/**
+ * @brief Tests a filter against the bloom filters of a row group
+ *
+ * Equality comparisons between a column and a literal are tested against the column's bloom
+ * filter; IN-lists, written as disjunctions of equalities, are tested term by term. Any other
+ * subexpression, or a column without a bloom filter, may match.
+ *
+ * @param node Filter expression referencing the output columns by index
+ * @param columns Output column indexes of `filters` and `kinds`
+ * @param filters Bloom filter of the row group for each column, or nullptr
+ * @param kinds ORC type of each column
+ *
+ * @return false if no row of the row group can satisfy the filter
+ */
+bool bloom_filters_may_match(ast::detail::node const &node,
+                             std::vector<size_type> const &columns,
+                             std::vector<orc::BloomFilter const *> const &filters,
+                             std::vector<orc::TypeKind> const &kinds)
+{
+  auto const expr = dynamic_cast<ast::expression const *>(&node);
+  if (expr == nullptr) { return true; }
+
+  auto const op       = expr->get_operator();
+  auto const operands = expr->get_operands();
+  if (op == ast::ast_operator::LOGICAL_AND) {
+    return bloom_filters_may_match(operands[0].get(), columns, filters, kinds) &&
+           bloom_filters_may_match(operands[1].get(), columns, filters, kinds);
+  }
+  if (op == ast::ast_operator::LOGICAL_OR) {
+    return bloom_filters_may_match(operands[0].get(), columns, filters, kinds) ||
+           bloom_filters_may_match(operands[1].get(), columns, filters, kinds);
+  }
+  if (op != ast::ast_operator::EQUAL || operands.size() != 2) { return true; }
+
+  auto col = dynamic_cast<ast::column_reference const *>(&operands[0].get());
+  auto lit = dynamic_cast<ast::literal const *>(&operands[1].get());
+  if (col == nullptr && lit == nullptr) {
+    col = dynamic_cast<ast::column_reference const *>(&operands[1].get());
+    lit = dynamic_cast<ast::literal const *>(&operands[0].get());
+  }
+  if (col == nullptr || lit == nullptr || col->get_table_source() != ast::table_reference::LEFT) {
+    return true;
+  }
+  auto const it = std::find(columns.begin(), columns.end(), col->get_column_index());
+  if (it == columns.end()) { return true; }
+  auto const idx    = std::distance(columns.begin(), it);
+  auto const filter = filters[idx];
+  if (filter == nullptr || filter->bitset.empty() || filter->numHashFunctions == 0) {
+    return true;
+  }
+  auto const hash = literal_bloom_hash(*lit, kinds[idx]);
+  return !hash.has_value() || bloom_filter_may_contain(filter->bitset.data(),
+                                                       filter->bitset.size(),
+                                                       filter->numHashFunctions,
+                                                       hash.value());
+}
+
+/**
+ * @brief Reduces a selection of stripes to those whose statistics may satisfy a filter
+ *
+ * Stripes are first tested against the stripe statistics, then against the statistics of their
+ * row index entries when `use_index` is set; a stripe is kept if any of its row groups may match.
+ *
+ * @param md ORC file metadata
+ * @param source Dataset source
+ * @param stripes Selected stripes
+ * @param filter Expression referencing the output columns by index
+ * @param selected_columns ORC column ids of the output columns
+ * @param column_types Output column types
+ * @param use_index Whether to test the row index statistics
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return The stripes that may contain matching rows
+ */
+template <typename StripeInfo>
+std::vector<StripeInfo> filter_stripes(cudf::io::orc::metadata &md,
+                                       datasource &source,
+                                       std::vector<StripeInfo> const &stripes,
+                                       ast::expression const &filter,
+                                       std::vector<int> const &selected_columns,
+                                       std::vector<data_type> const &column_types,
+                                       bool use_index,
+                                       rmm::cuda_stream_view stream)
+{
+  std::vector<size_type> referenced;
+  collect_column_references(filter, referenced);
+  std::vector<size_type> stats_columns;
+  for (auto const col_idx : referenced) {
+    CUDF_EXPECTS(col_idx >= 0 && col_idx < static_cast<size_type>(column_types.size()),
+                 "Filter references an invalid column index");
+    auto const kind = md.ff.types[selected_columns[col_idx]].kind;
+    switch (kind) {
+      case orc::BYTE:
+      case orc::SHORT:
+      case orc::INT:
+      case orc::LONG:
+      case orc::FLOAT:
+      case orc::DOUBLE:
+      case orc::DATE: stats_columns.push_back(col_idx); break;
+      default: break;
+    }
+  }
+  stats_expression_converter const converter(filter, stats_columns);
+  auto const stats_filter = converter.get_expression();
+  if (stats_filter == nullptr || stripes.empty()) { return stripes; }
+
+  std::vector<data_type> stats_types;
+  std::transform(stats_columns.cbegin(),
+                 stats_columns.cend(),
+                 std::back_inserter(stats_types),
+                 [&](auto col_idx) { return column_types[col_idx]; });
+
+  // Test the stripe statistics, one row per stripe
+  std::vector<std::vector<orc_column_statistics>> stripe_stats(stats_columns.size());
+  std::vector<std::vector<orc_column_statistics const *>> stripe_stats_ptrs(stats_columns.size());
+  for (size_t i = 0; i < stats_columns.size(); ++i) {
+    auto const column_id = selected_columns[stats_columns[i]];
+    stripe_stats[i].resize(stripes.size());
+    for (size_t s = 0; s < stripes.size(); ++s) {
+      auto const stripe_idx = static_cast<size_t>(stripes[s].first - md.ff.stripes.data());
+      if (stripe_idx < md.md.stripeStats.size() &&
+          static_cast<size_t>(column_id) < md.md.stripeStats[stripe_idx].colStats.size()) {
+        auto const &blob = md.md.stripeStats[stripe_idx].colStats[column_id];
+        ProtobufReader(blob.data(), blob.size()).read(stripe_stats[i][s]);
+        stripe_stats_ptrs[i].push_back(&stripe_stats[i][s]);
+      } else {
+        stripe_stats_ptrs[i].push_back(nullptr);
+      }
+    }
+  }
+  auto const keep_stripe = evaluate_stats_filter(*stats_filter,
+                                                 stats_types,
+                                                 stripe_stats_ptrs,
+                                                 static_cast<size_type>(stripes.size()),
+                                                 stream);
+  std::vector<StripeInfo> selection;
+  for (size_t s = 0; s < stripes.size(); ++s) {
+    if (keep_stripe[s]) { selection.push_back(stripes[s]); }
+  }
+
+  auto const stride = static_cast<size_t>(md.get_row_index_stride());
+  if (!use_index || stride == 0 || selection.empty()) { return selection; }
+
+  // Test the row index statistics of the remaining stripes, one row per row group
+  std::vector<size_t> first_row_group{0};
+  for (auto const &stripe : selection) {
+    first_row_group.push_back(first_row_group.back() +
+                              (stripe.first->numberOfRows + stride - 1) / stride);
+  }
+  auto const num_row_groups = first_row_group.back();
+  std::vector<std::vector<orc::RowIndex>> row_indexes(stats_columns.size());
+  std::vector<std::vector<orc_column_statistics const *>> row_group_stats(stats_columns.size());
+  for (size_t i = 0; i < stats_columns.size(); ++i) {
+    auto const column_id = static_cast<uint32_t>(selected_columns[stats_columns[i]]);
+    row_indexes[i].resize(selection.size());
+    row_group_stats[i].reserve(num_row_groups);
+    for (size_t s = 0; s < selection.size(); ++s) {
+      auto index = read_index_stream<orc::RowIndex>(
+        md, source, *selection[s].first, *selection[s].second, column_id, orc::ROW_INDEX);
+      if (index.has_value()) { row_indexes[i][s] = std::move(index.value()); }
+      auto const &entries = row_indexes[i][s].entry;
+      for (size_t rg = 0; rg < first_row_group[s + 1] - first_row_group[s]; ++rg) {
+        row_group_stats[i].push_back(rg < entries.size() ? &entries[rg].statistics : nullptr);
+      }
+    }
+  }
+  auto keep_row_group = evaluate_stats_filter(
+    *stats_filter, stats_types, row_group_stats, static_cast<size_type>(num_row_groups), stream);
+
+  // Test the row groups that may match against the bloom filters of the columns that have them
+  std::vector<orc::TypeKind> kinds;
+  std::transform(stats_columns.cbegin(),
+                 stats_columns.cend(),
+                 std::back_inserter(kinds),
+                 [&](auto col_idx) { return md.ff.types[selected_columns[col_idx]].kind; });
+  for (size_t s = 0; s < selection.size(); ++s) {
+    auto const first = keep_row_group.begin() + first_row_group[s];
+    auto const last  = keep_row_group.begin() + first_row_group[s + 1];
+    if (std::none_of(first, last, [](auto keep) { return keep != 0; })) { continue; }
+    std::vector<std::vector<orc::BloomFilter>> bloom_filters;
+    for (auto const col_idx : stats_columns) {
+      bloom_filters.push_back(read_bloom_filters(md,
+                                                 source,
+                                                 *selection[s].first,
+                                                 *selection[s].second,
+                                                 selected_columns[col_idx]));
+    }
+    if (std::all_of(bloom_filters.cbegin(), bloom_filters.cend(), [](auto const &f) {
+          return f.empty();
+        })) {
+      continue;
+    }
+    std::vector<orc::BloomFilter const *> row_group_filters(stats_columns.size());
+    for (size_t rg = 0; rg < first_row_group[s + 1] - first_row_group[s]; ++rg) {
+      if (!first[rg]) { continue; }
+      for (size_t i = 0; i < stats_columns.size(); ++i) {
+        row_group_filters[i] = rg < bloom_filters[i].size() ? &bloom_filters[i][rg] : nullptr;
+      }
+      if (!bloom_filters_may_match(filter, stats_columns, row_group_filters, kinds)) {
+        first[rg] = 0;
+      }
+    }
+  }
+
+  std::vector<StripeInfo> result;
+  for (size_t s = 0; s < selection.size(); ++s) {
+    if (std::any_of(keep_row_group.begin() + first_row_group[s],
+                    keep_row_group.begin() + first_row_group[s + 1],
+                    [](auto keep) { return keep != 0; })) {
+      result.push_back(selection[s]);
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Coalesced read of consecutive stripe streams into device memory
+ */
+struct stripe_read_task {
+  size_t offset;  // offset in file
+  size_t length;  // number of bytes to read
+  uint8_t *dst;   // device destination
+};
+
+/**
+ * @brief Reads one coalesced range of stripe streams to the device.
+ *
+ * The host buffer of a host read must outlive the copy, so the stream is synchronized after it.
+ */
+void read_stripe_range(datasource &source,
+                       stripe_read_task const &task,
+                       rmm::cuda_stream_view stream)
+{
+  if (source.is_device_read_preferred(task.length)) {
+    CUDF_EXPECTS(source.device_read(task.offset, task.length, task.dst, stream) == task.length,
+                 "Unexpected discrepancy in bytes read.");
+  } else {
+    const auto buffer = source.host_read(task.offset, task.length);
+    CUDF_EXPECTS(buffer->size() == task.length, "Unexpected discrepancy in bytes read.");
+    CUDA_TRY(cudaMemcpyAsync(
+      task.dst, buffer->data(), task.length, cudaMemcpyHostToDevice, stream.value()));
+    stream.synchronize();
+  }
+}
+
+/**
+ * @brief Reads the stripe streams to the device, using up to `num_streams` CUDA streams.
+ *
+ * With a single stream, the reads are issued as one batch through the source's batched read API.
+ * With more than one stream, a pool of host threads takes the reads in order, each issuing its
+ * copies on its own stream of the global stream pool, so file reads and transfers of different
+ * ranges overlap. The pool streams are forked from and joined back into `stream`.
+ *
+ * @param source Dataset source
+ * @param tasks Coalesced reads of all selected stripes
+ * @param num_streams Maximum number of streams to read on
+ * @param stream CUDA stream on which the stripe data is consumed
+ */
+void read_stripe_data(datasource &source,
+                      std::vector<stripe_read_task> const &tasks,
+                      size_type num_streams,
+                      rmm::cuda_stream_view stream)
+{
+  int64_t total_bytes = 0;
+  for (auto const &task : tasks) {
+    total_bytes += task.length;
+  }
+  stage_range range{"orc::read_stripe_data", total_bytes};
+
+  auto const num_workers = std::min<size_t>(std::max(num_streams, 1), tasks.size());
+  if (num_workers <= 1) {
+    // Issue all of the reads as one batch, which the source coalesces and dispatches concurrently
+    std::vector<datasource::read_request> requests;
+    size_t expected_bytes = 0;
+    for (auto const &task : tasks) {
+      requests.push_back({task.offset, task.length, task.dst});
+      expected_bytes += task.length;
+    }
+    CUDF_EXPECTS(read_to_device_async(source, std::move(requests), stream).get() == expected_bytes,
+                 "Unexpected discrepancy in bytes read.");
+    return;
+  }
+
+  // The pool streams wait for the allocation of the destinations queued on `stream`
+  auto const streams = cudf::detail::fork_streams(stream, num_workers);
+
+  int device_id;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  std::atomic<size_t> next_task{0};
+  auto const read_worker = [&](rmm::cuda_stream_view worker_stream) {
+    CUDA_TRY(cudaSetDevice(device_id));
+    for (auto t = next_task++; t < tasks.size(); t = next_task++) {
+      read_stripe_range(source, tasks[t], worker_stream);
+    }
+  };
+  std::vector<std::future<void>> workers;
+  for (auto worker_stream : streams) {
+    workers.push_back(std::async(std::launch::async, read_worker, worker_stream));
+  }
+  // Wait for all workers before rethrowing the first failure
+  std::exception_ptr error;
+  for (auto &worker : workers) {
+    try {
+      worker.get();
+    } catch (...) {
+      if (!error) { error = std::current_exception(); }
+    }
+  }
+  if (error) {
+    // Reads still in flight must not outlive the destination buffers
+    for (auto worker_stream : streams) {
+      cudaStreamSynchronize(worker_stream.value());
+    }
+    std::rethrow_exception(error);
+  }
+
+  cudf::detail::join_streams(streams, stream);
+}
+
 }  // namespace
 
 rmm::device_buffer reader::impl::decompress_stripe_data(
@@ -225,6 +774,12 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
   size_t row_index_stride,
   rmm::cuda_stream_view stream)
 {
+  int64_t compressed_bytes = 0;
+  for (auto const &data : stripe_data) {
+    compressed_bytes += data.size();
+  }
+  stage_range range{"orc::decompress", compressed_bytes};
+
   // Parse the columns' compressed info
   hostdevice_vector<gpu::CompressedStreamInfo> compinfo(0, stream_info.size(), stream);
   for (const auto &info : stream_info) {
@@ -251,7 +806,7 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
   }
   CUDF_EXPECTS(total_decomp_size > 0, "No decompressible data found");
 
-  rmm::device_buffer decomp_data(total_decomp_size, stream);
+  rmm::device_buffer decomp_data(total_decomp_size, stream, get_temporary_memory_resource());
   rmm::device_uvector<gpu_inflate_input_s> inflate_in(
     num_compressed_blocks + num_uncompressed_blocks, stream);
   rmm::device_uvector<gpu_inflate_status_s> inflate_out(num_compressed_blocks, stream);
@@ -289,6 +844,9 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
       case orc::SNAPPY:
         CUDA_TRY(gpu_unsnap(inflate_in.data(), inflate_out.data(), num_compressed_blocks, stream));
         break;
+      case orc::ZSTD:
+        CUDA_TRY(gpu_unzstd(inflate_in.data(), inflate_out.data(), num_compressed_blocks, stream));
+        break;
       default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
     }
   }
@@ -344,6 +902,7 @@ void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks
                                       std::vector<column_buffer> &out_buffers,
                                       rmm::cuda_stream_view stream)
 {
+  stage_range range{"orc::decode_streams", -1, static_cast<int64_t>(num_rows)};
   const auto num_columns = out_buffers.size();
   const auto num_stripes = chunks.size() / out_buffers.size();
 
@@ -403,12 +962,16 @@ reader::impl::impl(std::unique_ptr<datasource> source,
 
   // Enable or disable the conversion to numpy-compatible dtypes
   _use_np_dtypes = options.is_enabled_use_np_dtypes();
+
+  _num_read_streams = options.get_num_read_streams();
 }
 
-table_with_metadata reader::impl::read(size_type skip_rows,
-                                       size_type num_rows,
-                                       const std::vector<size_type> &stripes,
-                                       rmm::cuda_stream_view stream)
+table_with_metadata reader::impl::read(
+  size_type skip_rows,
+  size_type num_rows,
+  const std::vector<size_type> &stripes,
+  thrust::optional<std::reference_wrapper<ast::expression const>> const &filter,
+  rmm::cuda_stream_view stream)
 {
   std::vector<std::unique_ptr<column>> out_columns;
   table_metadata out_metadata;
@@ -416,9 +979,6 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   // There are no columns in table
   if (_selected_columns.size() == 0) return {std::make_unique<table>(), std::move(out_metadata)};
 
-  // Select only stripes required (aka row groups)
-  const auto selected_stripes = _metadata->select_stripes(stripes, skip_rows, num_rows);
-
   // Association between each ORC column and its cudf::column
   std::vector<int32_t> orc_col_map(_metadata->get_num_columns(), -1);
 
@@ -441,6 +1001,25 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     orc_col_map[col] = column_types.size() - 1;
   }
 
+  // Select only stripes required (aka row groups)
+  auto selected_stripes = _metadata->select_stripes(stripes, skip_rows, num_rows);
+
+  // Skip the stripes whose statistics rule out every row
+  if (filter.has_value()) {
+    selected_stripes = filter_stripes(*_metadata,
+                                      *_source,
+                                      selected_stripes,
+                                      filter.value().get(),
+                                      _selected_columns,
+                                      column_types,
+                                      _use_index,
+                                      stream);
+    num_rows         = std::accumulate(
+      selected_stripes.cbegin(), selected_stripes.cend(), 0, [](auto sum, auto const &stripe) {
+        return sum + static_cast<size_type>(stripe.first->numberOfRows);
+      });
+  }
+
   // If no rows or stripes to read, return empty columns
   if (num_rows <= 0 || selected_stripes.empty()) {
     std::transform(column_types.cbegin(),
@@ -469,6 +1048,9 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     // Tracker for eventually deallocating compressed and uncompressed data
     std::vector<rmm::device_buffer> stripe_data;
 
+    // Reads of all selected stripes, issued once the destinations are allocated
+    std::vector<stripe_read_task> read_tasks;
+
     size_t stripe_start_row = 0;
     size_t num_dict_entries = 0;
     size_t num_rowgroups    = 0;
@@ -489,7 +1071,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                                                       stream_info);
       CUDF_EXPECTS(total_data_size > 0, "Expected streams data within stripe");
 
-      stripe_data.emplace_back(total_data_size, stream);
+      stripe_data.emplace_back(total_data_size, stream, get_temporary_memory_resource());
       auto dst_base = static_cast<uint8_t *>(stripe_data.back().data());
 
       // Coalesce consecutive streams into one read
@@ -504,16 +1086,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           len += stream_info[stream_count].length;
           stream_count++;
         }
-        if (_source->is_device_read_preferred(len)) {
-          CUDF_EXPECTS(_source->device_read(offset, len, d_dst, stream) == len,
-                       "Unexpected discrepancy in bytes read.");
-        } else {
-          const auto buffer = _source->host_read(offset, len);
-          CUDF_EXPECTS(buffer->size() == len, "Unexpected discrepancy in bytes read.");
-          CUDA_TRY(
-            cudaMemcpyAsync(d_dst, buffer->data(), len, cudaMemcpyHostToDevice, stream.value()));
-          stream.synchronize();
-        }
+        read_tasks.push_back({offset, len, d_dst});
       }
 
       // Update chunks to reference streams pointers
@@ -542,6 +1115,8 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       }
     }
 
+    read_stripe_data(*_source, read_tasks, _num_read_streams, stream);
+
     // Process dataset chunk pages into output columns
     if (stripe_data.size() != 0) {
       // Setup row group descriptors if using indexes
@@ -574,8 +1149,8 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       // Setup table for converting timestamp columns from local to UTC time
       auto const tz_table =
         _has_timestamp_column
-          ? build_timezone_transition_table(selected_stripes[0].second->writerTimezone, stream)
-          : timezone_table{};
+          ? get_timezone_table(selected_stripes[0].second->writerTimezone, stream)
+          : timezone_table_view{};
 
       std::vector<column_buffer> out_buffers;
       for (size_t i = 0; i < column_types.size(); ++i) {
@@ -593,12 +1168,13 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                          num_dict_entries,
                          skip_rows,
                          num_rows,
-                         tz_table.view(),
+                         tz_table,
                          row_groups,
                          _metadata->get_row_index_stride(),
                          out_buffers,
                          stream);
 
+      stage_range range{"orc::make_columns", -1, num_rows};
       for (size_t i = 0; i < column_types.size(); ++i) {
         out_columns.emplace_back(make_column(out_buffers[i], nullptr, stream, _mr));
       }
@@ -618,6 +1194,132 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
 }
 
+void reader::impl::setup_chunking(orc_reader_options const &options,
+                                  std::size_t chunk_read_limit,
+                                  rmm::cuda_stream_view stream)
+{
+  _chunk_read_info.clear();
+  _current_chunk = 0;
+
+  auto skip_rows = options.get_skip_rows();
+  auto num_rows  = options.get_num_rows();
+  std::vector<std::pair<const orc::StripeInformation *, const orc::StripeFooter *>> selection;
+  if (!_selected_columns.empty()) {
+    selection = _metadata->select_stripes(options.get_stripes(), skip_rows, num_rows);
+  }
+
+  std::vector<data_type> column_types;
+  std::transform(_selected_columns.cbegin(),
+                 _selected_columns.cend(),
+                 std::back_inserter(column_types),
+                 [&](auto col) {
+                   return data_type{
+                     to_type_id(_metadata->ff.types[col], _use_np_dtypes, _timestamp_type.id())};
+                 });
+  if (options.get_filter().has_value()) {
+    selection = filter_stripes(*_metadata,
+                               *_source,
+                               selection,
+                               options.get_filter().value().get(),
+                               _selected_columns,
+                               column_types,
+                               _use_index,
+                               stream);
+  }
+
+  // Global first row of each stripe of the file
+  std::vector<size_type> stripe_start_rows(_metadata->get_num_stripes() + 1, 0);
+  for (int i = 0; i < _metadata->get_num_stripes(); ++i) {
+    stripe_start_rows[i + 1] =
+      stripe_start_rows[i] + static_cast<size_type>(_metadata->ff.stripes[i].numberOfRows);
+  }
+
+  // Estimates the decoded size of a whole stripe from the column types and string statistics
+  auto estimate_stripe_size = [&](size_t stripe_idx) {
+    auto const &stripe = _metadata->ff.stripes[stripe_idx];
+    auto const rows    = static_cast<std::size_t>(stripe.numberOfRows);
+    std::size_t size   = 0;
+    for (size_t j = 0; j < column_types.size(); ++j) {
+      if (column_types[j].id() == type_id::STRING) {
+        std::size_t chars_size = stripe.dataLength;
+        auto const column_id   = static_cast<size_t>(_selected_columns[j]);
+        if (stripe_idx < _metadata->md.stripeStats.size() &&
+            column_id < _metadata->md.stripeStats[stripe_idx].colStats.size()) {
+          auto const &blob = _metadata->md.stripeStats[stripe_idx].colStats[column_id];
+          orc_column_statistics stats;
+          ProtobufReader(blob.data(), blob.size()).read(stats);
+          if (stats.string_stats && stats.string_stats->has_sum()) {
+            chars_size = *stats.string_stats->sum();
+          }
+        }
+        size += chars_size + rows * sizeof(size_type);
+      } else {
+        size += rows * size_of(column_types[j]);
+      }
+      size += (rows + 7) / 8;
+    }
+    return size;
+  };
+
+  // Greedily group consecutive whole stripes until the limit would be exceeded. Partially
+  // selected stripes and stripes that alone exceed the limit are read as row windows, split at
+  // row group boundaries.
+  auto const stride = static_cast<size_type>(_metadata->get_row_index_stride());
+  std::vector<size_type> group;
+  std::size_t group_size = 0;
+  auto flush             = [&]() {
+    if (group.empty()) { return; }
+    _chunk_read_info.push_back(chunk_read_info{std::move(group), 0, -1});
+    group.clear();
+    group_size = 0;
+  };
+  size_type remaining = num_rows;
+  for (size_t i = 0; i < selection.size() && remaining > 0; ++i) {
+    auto const stripe_idx =
+      static_cast<size_type>(selection[i].first - _metadata->ff.stripes.data());
+    auto const stripe_rows = static_cast<size_type>(selection[i].first->numberOfRows);
+    auto const row_begin   = (i == 0) ? skip_rows : 0;
+    auto const row_end     = std::min(stripe_rows, row_begin + remaining);
+    if (row_begin >= row_end) { continue; }
+    remaining -= row_end - row_begin;
+
+    auto const size = estimate_stripe_size(stripe_idx) * (row_end - row_begin) /
+                      std::max<std::size_t>(stripe_rows, 1);
+    auto const fits = chunk_read_limit == 0 || size <= chunk_read_limit;
+    if (fits && row_begin == 0 && row_end == stripe_rows) {
+      if (chunk_read_limit > 0 && group_size + size > chunk_read_limit) { flush(); }
+      group.push_back(stripe_idx);
+      group_size += size;
+      continue;
+    }
+
+    flush();
+    auto rows_per_chunk = row_end - row_begin;
+    if (!fits) {
+      rows_per_chunk = static_cast<size_type>(std::max<std::size_t>(
+        1, static_cast<std::size_t>(rows_per_chunk) * chunk_read_limit / size));
+      if (stride > 0) { rows_per_chunk = std::max(stride, rows_per_chunk / stride * stride); }
+    }
+    for (auto r = row_begin; r < row_end; r += rows_per_chunk) {
+      _chunk_read_info.push_back(chunk_read_info{
+        {}, stripe_start_rows[stripe_idx] + r, std::min(rows_per_chunk, row_end - r)});
+    }
+  }
+  flush();
+
+  // Always produce at least one (possibly empty) table
+  if (_chunk_read_info.empty()) { _chunk_read_info.push_back(chunk_read_info{{}, 0, 0}); }
+}
+
+table_with_metadata reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(has_next(), "No more chunks to read");
+  auto const &chunk = _chunk_read_info[_current_chunk++];
+  return read(chunk.skip_rows, chunk.num_rows, chunk.stripes, thrust::nullopt, stream);
+}
+
+reader::reader() = default;
+
 // Forward to implementation
 reader::reader(std::vector<std::string> const &filepaths,
                orc_reader_options const &options,
@@ -642,9 +1344,33 @@ reader::~reader() = default;
 // Forward to implementation
 table_with_metadata reader::read(orc_reader_options const &options, rmm::cuda_stream_view stream)
 {
-  return _impl->read(
-    options.get_skip_rows(), options.get_num_rows(), options.get_stripes(), stream);
+  return _impl->read(options.get_skip_rows(),
+                     options.get_num_rows(),
+                     options.get_stripes(),
+                     options.get_filter(),
+                     stream);
 }
+
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::vector<std::unique_ptr<datasource>> &&sources,
+                               orc_reader_options const &options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource *mr)
+  : _stream(stream)
+{
+  CUDF_EXPECTS(sources.size() == 1, "Only a single source is currently supported.");
+  _impl = std::make_unique<impl>(std::move(sources[0]), options, mr);
+  _impl->setup_chunking(options, chunk_read_limit, stream);
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk() { return _impl->read_chunk(_stream); }
 }  // namespace orc
 }  // namespace detail
 }  // namespace io
@@ -68,14 +68,42 @@ class reader::impl {
    * @param skip_rows Number of rows to skip from the start
    * @param num_rows Number of rows to read
    * @param stripes Indices of individual stripes to load if non-empty
+   * @param filter Optional expression used to skip stripes based on their statistics
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return The set of columns along with metadata
    */
-  table_with_metadata read(size_type skip_rows,
-                           size_type num_rows,
-                           const std::vector<size_type> &stripes,
-                           rmm::cuda_stream_view stream);
+  table_with_metadata read(
+    size_type skip_rows,
+    size_type num_rows,
+    const std::vector<size_type> &stripes,
+    thrust::optional<std::reference_wrapper<ast::expression const>> const &filter,
+    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Splits the rows selected by the options into chunks that respect the given limit
+   *
+   * @param options Settings for controlling reading behavior
+   * @param chunk_read_limit Limit on the estimated decoded size of each chunk; 0 for no limit
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void setup_chunking(orc_reader_options const &options,
+                      std::size_t chunk_read_limit,
+                      rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns true if there are chunks left to read.
+   */
+  bool has_next() const { return _current_chunk < _chunk_read_info.size(); }
+
+  /**
+   * @brief Reads the next chunk computed by `setup_chunking()`.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
 
  private:
   /**
@@ -133,7 +161,22 @@ class reader::impl {
   bool _use_index            = true;
   bool _use_np_dtypes        = true;
   bool _has_timestamp_column = false;
+  size_type _num_read_streams = 1;
   data_type _timestamp_type{type_id::EMPTY};
+
+  /**
+   * @brief Stripes or row window read by a single chunk
+   *
+   * A chunk reads either the whole `stripes`, or, when `stripes` is empty, `num_rows` rows
+   * starting at row `skip_rows` of the file.
+   */
+  struct chunk_read_info {
+    std::vector<size_type> stripes;
+    size_type skip_rows;
+    size_type num_rows;
+  };
+  std::vector<chunk_read_info> _chunk_read_info;
+  std::size_t _current_chunk = 0;
 };
 
 }  // namespace orc
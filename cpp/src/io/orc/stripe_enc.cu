@@ -51,7 +51,14 @@ struct intrle_enc_state_s {
   uint32_t literal_w;
   uint32_t hdr_bytes;
   uint32_t pl_bytes;
+  uint32_t delta_bits;   // max bit width of the deltas in a literal run
+  uint32_t patch_w;      // patched base data width (0 if the run has no patches)
+  uint32_t patch_len;    // patch list length
+  uint32_t patch_pw;     // patch width
+  uint32_t patch_gw;     // patch gap width
   volatile uint32_t delta_map[(512 / 32) + 1];
+  uint32_t offset_hist[65];  // number of values per bit width of the offset from the minimum
+  uint64_t patch_vals[32];   // patched values, shifted right by the patched base data width
 };
 
 struct strdata_enc_state_s {
@@ -321,9 +328,71 @@ static inline __device__ void StoreBitsBigEndian(
   }
 }
 
+/**
+ * @brief Returns the number of significant bits in a value
+ */
+static inline __device__ uint32_t BitLength(uint32_t v) { return 32 - __clz(v); }
+static inline __device__ uint32_t BitLength(uint64_t v) { return 64 - __clzll(v); }
+
+/**
+ * @brief Returns the number of bytes needed to encode a value as a varint
+ */
+static inline __device__ uint32_t VarintLength(uint64_t v)
+{
+  return 1 + (63 - min(__clzll(v), 63)) / 7;
+}
+
+/**
+ * @brief Rounds a bit width up to the closest width that RLEv2 can represent
+ */
+static inline __device__ uint32_t ClosestFixedBits(uint32_t w)
+{
+  return (w <= 24) ? max(w, 1u) : (w <= 32) ? (w + 1) & ~1 : (w + 7) & ~7;
+}
+
+/**
+ * @brief Maps a RLEv2 bit width to its 5-bit length code
+ */
+static inline __device__ uint32_t EncodeBitWidth(uint32_t w)
+{
+  return (w <= 24) ? w - 1 : (w <= 32) ? 23 + ((w - 24) >> 1) : 27 + ((w - 32) >> 3);
+}
+
+/**
+ * @brief Store the w low bits of a value at an arbitrary bit position, most significant bit
+ * first (destination bytes must be zero-initialized)
+ */
+static inline __device__ void StoreBitsAt(uint8_t *dst, uint32_t bitpos, uint64_t v, uint32_t w)
+{
+  while (w > 0) {
+    uint32_t const bit_ofs = bitpos & 7;
+    uint32_t const n       = min(8 - bit_ofs, w);
+    uint32_t const bits    = static_cast<uint32_t>(v >> (w - n)) & ((1u << n) - 1);
+    dst[bitpos >> 3] |= bits << (8 - bit_ofs - n);
+    bitpos += n;
+    w -= n;
+  }
+}
+
+/**
+ * @brief Returns the width in bytes of the patched base value (sign-magnitude)
+ */
+template <class T, bool is_signed>
+static inline __device__ uint32_t PatchedBaseWidth(T vmin)
+{
+  uint32_t bv_scale = (is_signed) ? 0 : 1;
+  T v               = (is_signed) ? ((vmin < 0) ? -vmin : vmin) * 2 : vmin;
+  return (sizeof(T) > 4) ? (8 - min(CountLeadingBytes64(v << bv_scale), 7))
+                         : (4 - min(CountLeadingBytes32(v << bv_scale), 3));
+}
+
 /**
  * @brief Integer RLEv2 encoder
  *
+ * Literal runs are encoded as DIRECT, PATCHED_BASE (with a patch list for runs where a few
+ * outliers would otherwise widen every value) or, for monotonic runs, DELTA with bit-packed
+ * deltas, whichever is smallest.
+ *
  * @param[in] cid stream type (strm_pos[cid] will be updated and output stored at
  *streams[cid]+strm_pos[cid])
  * @param[in] s encoder state
@@ -395,17 +464,36 @@ static __device__ uint32_t IntegerRLE(orcenc_state_s *s,
     literal_run = s->u.intrle.literal_run;
     // Find minimum and maximum values
     if (literal_run > 0) {
+      using U = typename std::make_unsigned<T>::type;
       // Find min & max
       T vmin = (t < literal_run) ? v0 : std::numeric_limits<T>::max();
       T vmax = (t < literal_run) ? v0 : std::numeric_limits<T>::min();
       uint32_t literal_mode, literal_w;
       vmin = block_reduce(temp_storage).Reduce(vmin, cub::Min());
+      if (t == 0) {
+        block_vmin             = static_cast<uint64_t>(vmin);
+        s->u.intrle.delta_bits = 0;
+      }
+      if (t <= 64) { s->u.intrle.offset_hist[t] = 0; }
       __syncthreads();
       vmax = block_reduce(temp_storage).Reduce(vmax, cub::Max());
+      // Histogram of the offset widths from the minimum (to size patched base patch lists) and
+      // bit width of the deltas (for delta encoding of monotonic runs)
+      U const ofs = (t < literal_run) ? static_cast<U>(v0) - static_cast<U>(block_vmin) : 0;
+      if (t < literal_run) { atomicAdd(&s->u.intrle.offset_hist[BitLength(ofs)], 1); }
+      int64_t const delta =
+        static_cast<int64_t>(static_cast<uint64_t>(v1) - static_cast<uint64_t>(v0));
+      int64_t const delta2 =
+        static_cast<int64_t>(static_cast<uint64_t>(v2) - static_cast<uint64_t>(v1));
+      uint64_t const delta2_abs =
+        (t + 2 < literal_run) ? ((delta2 < 0) ? 0 - static_cast<uint64_t>(delta2) : delta2) : 0;
+      if (delta2_abs != 0) { atomicMax(&s->u.intrle.delta_bits, BitLength(delta2_abs)); }
+      int const is_inc = __syncthreads_and(t + 1 >= literal_run || delta >= 0);
+      int const is_dec = __syncthreads_and(t + 1 >= literal_run || delta <= 0);
+      uint32_t best_size = 0, bw = 1, patch_w = 0, patch_max_w = 0;
       if (t == 0) {
         uint32_t mode1_w, mode2_w;
-        typename std::make_unsigned<T>::type vrange_mode1, vrange_mode2;
-        block_vmin = static_cast<uint64_t>(vmin);
+        U vrange_mode1, vrange_mode2;
         if (sizeof(T) > 4) {
           vrange_mode1 = (is_signed) ? max(zigzag(vmin), zigzag(vmax)) : vmax;
           vrange_mode2 = vmax - vmin;
@@ -425,26 +513,110 @@ static __device__ uint32_t IntegerRLE(orcenc_state_s *s,
           dst[0]           = 0xC0 + ((literal_run - 1) >> 8);
           dst[1]           = (literal_run - 1) & 0xff;
           bytecnt += StoreVarint(dst + 2, vrange_mode1);
-          dst[bytecnt++]           = 0;  // Zero delta
-          s->u.intrle.literal_mode = 3;
-          s->u.intrle.literal_w    = bytecnt;
+          dst[bytecnt++] = 0;  // Zero delta
+          literal_mode   = 3;
+          literal_w      = bytecnt;
         } else {
           uint32_t range, w;
+          bw = PatchedBaseWidth<T, is_signed>(vmin);
           if (mode1_w > mode2_w && (literal_run - 1) * (mode1_w - mode2_w) > 4) {
-            s->u.intrle.literal_mode = 2;
-            w                        = mode2_w;
-            range                    = (uint32_t)vrange_mode2;
+            literal_mode = 2;
+            w            = mode2_w;
+            range        = (uint32_t)vrange_mode2;
           } else {
-            s->u.intrle.literal_mode = 1;
-            w                        = mode1_w;
-            range                    = (uint32_t)vrange_mode1;
+            literal_mode = 1;
+            w            = mode1_w;
+            range        = (uint32_t)vrange_mode1;
           }
           if (w == 1)
             w = (range >= 16) ? w << 3 : (range >= 4) ? 4 : (range >= 2) ? 2 : 1;
           else
             w <<= 3;  // bytes -> bits
-          s->u.intrle.literal_w = w;
+          literal_w = w;
+          best_size = (literal_mode == 1) ? 2 + ((literal_run * w + 7) >> 3)
+                                          : 4 + bw + ((literal_run * w + 7) >> 3) +
+                                              ((zero_pll_war) ? 2 : 0);
+          // Monotonic runs: delta encoding with bit-packed deltas
+          if (literal_run >= 3 && ((delta >= 0) ? is_inc : is_dec)) {
+            uint32_t const delta_bits = s->u.intrle.delta_bits;
+            uint32_t const delta_w    = (delta_bits <= 2)   ? 2
+                                        : (delta_bits <= 4) ? 4
+                                                            : (delta_bits + 7) & ~7;
+            uint32_t const size = 2 + VarintLength(zigzag(v0)) + VarintLength(zigzag(delta)) +
+                                  (((literal_run - 2) * delta_w + 7) >> 3);
+            if (size < best_size) {
+              literal_mode = 4;
+              literal_w    = delta_w;
+              best_size    = size;
+            }
+          }
+          // Values with a few large outliers: patched base, with the outliers' high bits stored
+          // in the patch list (assumes the widest patch gap, checked once positions are known)
+          patch_max_w = sizeof(T) * 8;
+          while (patch_max_w > 0 && s->u.intrle.offset_hist[patch_max_w] == 0) {
+            patch_max_w--;
+          }
+          for (uint32_t c = patch_max_w - 1, num_patches = 0; c > 0 && patch_max_w > 1; c--) {
+            num_patches += s->u.intrle.offset_hist[c + 1];
+            if (num_patches > 31) break;
+            if (c > 2 && c != 4 && (c & 7) != 0) continue;  // Widths supported by the packers
+            uint32_t const pw = ClosestFixedBits(patch_max_w - c);
+            if (pw >= sizeof(T) * 8 || pw + 8 > 64) continue;
+            uint32_t const size = 4 + bw + ((literal_run * c + 7) >> 3) +
+                                  ((num_patches * ClosestFixedBits(pw + 8) + 7) >> 3);
+            if (size < best_size) {
+              patch_w   = c;
+              best_size = size;
+            }
+          }
         }
+        s->u.intrle.patch_w = patch_w;
+      }
+      __syncthreads();
+      if (s->u.intrle.patch_w != 0) {
+        // Gather the high bits of the patched values, ordered by position
+        uint32_t const patched_w = s->u.intrle.patch_w;
+        bool const is_patch      = (t < literal_run && BitLength(ofs) > patched_w);
+        uint32_t const patch_map = ballot(is_patch);
+        if (!(t & 0x1f)) s->u.intrle.delta_map[t >> 5] = patch_map;
+        __syncthreads();
+        if (is_patch) {
+          uint32_t patch_idx = __popc(patch_map & ((1u << (t & 0x1f)) - 1));
+          for (uint32_t i = 0; i < (t >> 5); i++) {
+            patch_idx += __popc(s->u.intrle.delta_map[i]);
+          }
+          s->u.intrle.patch_vals[patch_idx] = static_cast<uint64_t>(ofs >> patched_w);
+        }
+        if (t == 0) {
+          // Gaps wider than 255 need additional zero patches
+          uint32_t pll = 0, max_gap = 0, prev_pos = 0;
+          for (uint32_t i = 0; i < (literal_run + 31) >> 5; i++) {
+            for (uint32_t m = s->u.intrle.delta_map[i]; m != 0; m &= m - 1) {
+              uint32_t const pos = i * 32 + __ffs(m) - 1;
+              uint32_t const gap = pos - prev_pos;
+              pll += 1 + ((gap > 0) ? (gap - 1) / 255 : 0);
+              max_gap  = max(max_gap, gap);
+              prev_pos = pos;
+            }
+          }
+          uint32_t const pgw  = max(BitLength(min(max_gap, 255u)), 1u);
+          uint32_t const pw   = ClosestFixedBits(patch_max_w - patch_w);
+          uint32_t const size = 4 + bw + ((literal_run * patch_w + 7) >> 3) +
+                                ((pll * ClosestFixedBits(pw + pgw) + 7) >> 3);
+          if (pll <= 31 && size <= best_size) {
+            literal_mode          = 2;
+            literal_w             = patch_w;
+            s->u.intrle.patch_len = pll;
+            s->u.intrle.patch_pw  = pw;
+            s->u.intrle.patch_gw  = pgw;
+          } else {
+            s->u.intrle.patch_w = 0;
+          }
+        }
+      }
+      if (t == 0) {
+        s->u.intrle.literal_mode = literal_mode;
+        s->u.intrle.literal_w    = literal_w;
       }
       __syncthreads();
       vmin         = static_cast<T>(block_vmin);
@@ -460,7 +632,7 @@ static __device__ uint32_t IntegerRLE(orcenc_state_s *s,
         }
         dst += 2;
 
-        typename std::make_unsigned<T>::type zzv0 = v0;
+        U zzv0 = v0;
         if (t < literal_run) { zzv0 = zigzag(v0); }
         if (literal_w < 8) {
           StoreBitsBigEndian(dst, zzv0, literal_w, literal_run, t);
@@ -470,15 +642,38 @@ static __device__ uint32_t IntegerRLE(orcenc_state_s *s,
       } else if (literal_mode == 2) {
         // Patched base mode
         if (!t) {
-          uint32_t bw, pw = 1, pll, pgw = 1, bv_scale = (is_signed) ? 0 : 1;
-          vmax = (is_signed) ? ((vmin < 0) ? -vmin : vmin) * 2 : vmin;
-          bw   = (sizeof(T) > 4) ? (8 - min(CountLeadingBytes64(vmax << bv_scale), 7))
-                               : (4 - min(CountLeadingBytes32(vmax << bv_scale), 3));
-          if (zero_pll_war) {
+          uint32_t pw = 8, pll, pgw = 1;
+          uint8_t *patch_list = dst + 4 + bw + ((literal_run * literal_w + 7) >> 3);
+          if (s->u.intrle.patch_w != 0) {
+            // Patch list entries: gap from the previous patch position, followed by the
+            // bits of the value above the patched width
+            uint32_t prev_pos = 0, entry_w, bitpos = 0;
+            pll     = s->u.intrle.patch_len;
+            pw      = s->u.intrle.patch_pw;
+            pgw     = s->u.intrle.patch_gw;
+            entry_w = ClosestFixedBits(pw + pgw);
+            for (uint32_t i = 0; i < (pll * entry_w + 7) >> 3; i++) {
+              patch_list[i] = 0;
+            }
+            for (uint32_t i = 0, patch_idx = 0; i < (literal_run + 31) >> 5; i++) {
+              for (uint32_t m = s->u.intrle.delta_map[i]; m != 0; m &= m - 1) {
+                uint32_t const pos = i * 32 + __ffs(m) - 1;
+                uint32_t gap       = pos - prev_pos;
+                for (; gap > 255; gap -= 255, bitpos += entry_w) {
+                  StoreBitsAt(patch_list, bitpos, static_cast<uint64_t>(255) << pw, entry_w);
+                }
+                uint64_t const entry =
+                  (static_cast<uint64_t>(gap) << pw) | s->u.intrle.patch_vals[patch_idx++];
+                StoreBitsAt(patch_list, bitpos, entry, entry_w);
+                bitpos += entry_w;
+                prev_pos = pos;
+              }
+            }
+          } else if (zero_pll_war) {
             // Insert a dummy zero patch
-            pll                                                    = 1;
-            dst[4 + bw + ((literal_run * literal_w + 7) >> 3) + 0] = 0;
-            dst[4 + bw + ((literal_run * literal_w + 7) >> 3) + 1] = 0;
+            pll           = 1;
+            patch_list[0] = 0;
+            patch_list[1] = 0;
           } else {
             pll = 0;
           }
@@ -486,15 +681,13 @@ static __device__ uint32_t IntegerRLE(orcenc_state_s *s,
                    ((literal_w < 8) ? literal_w - 1 : kByteLengthToRLEv2_W[literal_w >> 3]) * 2 +
                    ((literal_run - 1) >> 8);
           dst[1] = (literal_run - 1) & 0xff;
-          dst[2] = ((bw - 1) << 5) | kByteLengthToRLEv2_W[pw];
+          dst[2] = ((bw - 1) << 5) | EncodeBitWidth(pw);
           dst[3] = ((pgw - 1) << 5) | pll;
-          if (is_signed) {
-            vmax >>= 1;
-            vmax |= vmin & ((T)1 << (bw * 8 - 1));
-          }
+          vmax   = (is_signed) ? ((vmin < 0) ? -vmin : vmin) : vmin;
+          if (is_signed) { vmax |= vmin & ((T)1 << (bw * 8 - 1)); }
           StoreBytesBigEndian(dst + 4, vmax, bw);
           s->u.intrle.hdr_bytes = 4 + bw;
-          s->u.intrle.pl_bytes  = (pll * (pw * 8 + pgw) + 7) >> 3;
+          s->u.intrle.pl_bytes  = (pll * ClosestFixedBits(pw + pgw) + 7) >> 3;
         }
         __syncthreads();
         dst += s->u.intrle.hdr_bytes;
@@ -504,6 +697,27 @@ static __device__ uint32_t IntegerRLE(orcenc_state_s *s,
         else if (t < literal_run)
           StoreBytesBigEndian(dst + t * (literal_w >> 3), v0, (literal_w >> 3));
         dst += s->u.intrle.pl_bytes;
+      } else if (literal_mode == 4) {
+        // Delta mode with bit-packed deltas
+        if (!t) {
+          uint32_t bytecnt = 2;
+          dst[0]           = 0xC0 +
+                   ((literal_w < 8) ? literal_w - 1 : kByteLengthToRLEv2_W[literal_w >> 3]) * 2 +
+                   ((literal_run - 1) >> 8);
+          dst[1] = (literal_run - 1) & 0xff;
+          bytecnt += StoreVarint(dst + bytecnt, zigzag(v0));
+          bytecnt += StoreVarint(dst + bytecnt, zigzag(delta));
+          s->u.intrle.hdr_bytes = bytecnt;
+        }
+        __syncthreads();
+        dst += s->u.intrle.hdr_bytes;
+        if (literal_w < 8) {
+          StoreBitsBigEndian(dst, (uint32_t)delta2_abs, literal_w, literal_run - 2, t);
+        } else if (t + 2 < literal_run) {
+          StoreBytesBigEndian(dst + t * (literal_w >> 3), delta2_abs, (literal_w >> 3));
+        }
+        dst += ((literal_run - 2) * literal_w + 7) >> 3;
+        literal_w = 0;
       } else {
         // Delta mode
         dst += literal_w;
@@ -1236,7 +1450,13 @@ void CompressOrcDataStreams(uint8_t *compressed_data,
   dim3 dim_grid(strm_desc.size().first, strm_desc.size().second);
   gpuInitCompressionBlocks<<<dim_grid, dim_block_init, 0, stream.value()>>>(
     strm_desc, enc_streams, comp_in, comp_out, compressed_data, comp_blk_size);
-  if (compression == SNAPPY) { gpu_snap(comp_in, comp_out, num_compressed_blocks, stream); }
+  if (compression == SNAPPY) {
+    gpu_snap(comp_in, comp_out, num_compressed_blocks, stream);
+  } else if (compression == ZLIB) {
+    gpu_deflate(comp_in, comp_out, num_compressed_blocks, 0, stream);
+  } else if (compression == ZSTD) {
+    gpu_zstd(comp_in, comp_out, num_compressed_blocks, stream);
+  }
   dim3 dim_block_compact(1024, 1);
   gpuCompactCompressedBlocks<<<dim_grid, dim_block_compact, 0, stream.value()>>>(
     strm_desc, comp_in, comp_out, compressed_data, comp_blk_size);
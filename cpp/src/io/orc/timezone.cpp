@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,9 @@
 
 #include <algorithm>
 #include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
 
 namespace cudf {
 namespace io {
@@ -478,5 +481,33 @@ timezone_table build_timezone_transition_table(std::string const &timezone_name,
   return {gmt_offset, std::move(d_ttimes), std::move(d_offsets)};
 }
 
+timezone_table_view get_timezone_table(std::string const &timezone_name,
+                                       rmm::cuda_stream_view stream)
+{
+  if (timezone_name == "UTC" || timezone_name.empty()) { return {}; }
+
+  int device_id;
+  CUDA_TRY(cudaGetDevice(&device_id));
+
+  using cache_key = std::pair<int, std::string>;
+  static std::mutex tables_mutex{};
+  // Intentionally leaked; device memory must not be released after the CUDA context is destroyed
+  static auto &tables = *new std::map<cache_key, std::unique_ptr<timezone_table>>();
+
+  std::lock_guard<std::mutex> tables_lock(tables_mutex);
+
+  auto const key = cache_key{device_id, timezone_name};
+  auto table     = tables.find(key);
+  if (table == tables.end()) {
+    // The build synchronizes the stream, so the table is usable from any stream once cached
+    table = tables
+              .emplace(key,
+                       std::make_unique<timezone_table>(
+                         build_timezone_transition_table(timezone_name, stream)))
+              .first;
+  }
+  return table->second->view();
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -133,5 +133,20 @@ struct timezone_table {
 timezone_table build_timezone_transition_table(std::string const &timezone_name,
                                                rmm::cuda_stream_view stream);
 
+/**
+ * @brief Returns a view of the cached transition table for the given timezone.
+ *
+ * The table is built with `build_timezone_transition_table` on first use and kept on the current
+ * device until the process exits; later calls with the same timezone name do not read the TZif
+ * file or copy any data. The device memory comes from the resource that is current at first use.
+ *
+ * @param timezone_name standard timezone name (for example, "US/Pacific")
+ * @param stream CUDA stream used to build the table if it is not cached yet
+ *
+ * @return View of the transition table for the given timezone; empty view for UTC
+ */
+timezone_table_view get_timezone_table(std::string const &timezone_name,
+                                       rmm::cuda_stream_view stream);
+
 }  // namespace io
 }  // namespace cudf
@@ -22,7 +22,11 @@
 #include "writer_impl.hpp"
 
 #include <io/utilities/column_utils.cuh>
+#include <io/utilities/pinned_memory_pool.hpp>
 
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/io/memory_resource.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/span.hpp>
@@ -51,12 +55,6 @@ struct row_group_index_info {
 };
 
 namespace {
-/**
- * @brief Helper for pinned host memory
- */
-template <typename T>
-using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
-
 /**
  * @brief Function that translates GDF compression to ORC compression
  */
@@ -65,6 +63,8 @@ orc::CompressionKind to_orc_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return orc::CompressionKind::SNAPPY;
+    case compression_type::ZLIB: return orc::CompressionKind::ZLIB;
+    case compression_type::ZSTD: return orc::CompressionKind::ZSTD;
     case compression_type::NONE: return orc::CompressionKind::NONE;
     default: CUDF_EXPECTS(false, "Unsupported compression type"); return orc::CompressionKind::NONE;
   }
@@ -548,12 +548,14 @@ encoded_data writer::impl::encode_columns(const table_device_view &view,
                                           host_span<stripe_rowgroups const> stripe_bounds,
                                           orc_streams const &streams)
 {
+  stage_range range{"orc::encode_columns", -1, view.num_rows()};
   auto const num_columns   = columns.size();
   auto const num_rowgroups = stripes_size(stripe_bounds);
   hostdevice_2dvector<gpu::EncChunk> chunks(num_columns, num_rowgroups, stream);
   hostdevice_2dvector<gpu::encoder_chunk_streams> chunk_streams(num_columns, num_rowgroups, stream);
   auto const stream_offsets = streams.compute_offsets(columns, num_rowgroups);
-  rmm::device_uvector<uint8_t> encoded_data(stream_offsets.data_size(), stream);
+  rmm::device_uvector<uint8_t> encoded_data(
+    stream_offsets.data_size(), stream, get_temporary_memory_resource());
 
   // Initialize column chunks' descriptions
   std::map<size_type, segmented_valid_cnt_input> validity_check_inputs;
@@ -920,22 +922,75 @@ void writer::impl::write_index_stream(int32_t stripe_id,
   stripe->indexLength += buffer_.size();
 }
 
-void writer::impl::write_data_stream(gpu::StripeStream const &strm_desc,
-                                     gpu::encoder_chunk_streams const &enc_stream,
-                                     uint8_t const *compressed_data,
-                                     uint8_t *stream_out,
-                                     StripeInformation *stripe,
-                                     orc_streams *streams)
+std::vector<uint64_t> writer::impl::build_bloom_filters(table_device_view const &table,
+                                                        size_t num_rowgroups,
+                                                        bloom_filter_params params)
+{
+  auto const d_columns = cudf::detail::make_device_uvector_async(bloom_filter_columns_, stream);
+  rmm::device_uvector<uint64_t> bitsets(
+    bloom_filter_columns_.size() * num_rowgroups * params.num_words, stream);
+  gpu::BuildBloomFilters(bitsets.data(),
+                         table,
+                         d_columns.data(),
+                         bloom_filter_columns_.size(),
+                         num_rowgroups,
+                         row_index_stride_,
+                         params,
+                         stream);
+  return cudf::detail::make_std_vector_sync(bitsets, stream);
+}
+
+Stream writer::impl::write_bloom_filter_stream(orc_column_view const &column,
+                                               host_span<uint64_t const> bitsets,
+                                               bloom_filter_params params,
+                                               stripe_rowgroups const &rowgroups_range,
+                                               StripeInformation *stripe,
+                                               ProtobufWriter *pbw)
+{
+  BloomFilterIndex index;
+  index.bloomFilter.resize(rowgroups_range.size);
+  for (uint32_t i = 0; i < rowgroups_range.size; ++i) {
+    auto const words        = bitsets.data() + (rowgroups_range.first + i) * params.num_words;
+    auto &filter            = index.bloomFilter[i];
+    filter.numHashFunctions = params.num_hash_functions;
+    filter.utf8bitset.resize(params.num_words * sizeof(uint64_t));
+    for (uint32_t w = 0; w < params.num_words; ++w) {
+      for (uint32_t b = 0; b < sizeof(uint64_t); ++b) {
+        filter.utf8bitset[w * sizeof(uint64_t) + b] = static_cast<char>(words[w] >> (8 * b));
+      }
+    }
+  }
+
+  buffer_.resize((compression_kind_ != NONE) ? 3 : 0);
+  pbw->write(index);
+  add_uncompressed_block_headers(buffer_);
+  out_sink_->host_write(buffer_.data(), buffer_.size());
+  stripe->indexLength += buffer_.size();
+
+  Stream bloom_stream;
+  bloom_stream.kind      = BLOOM_FILTER_UTF8;
+  bloom_stream.column_id = column.id();
+  bloom_stream.length    = buffer_.size();
+  return bloom_stream;
+}
+
+std::future<void> writer::impl::write_data_stream(gpu::StripeStream const &strm_desc,
+                                                  gpu::encoder_chunk_streams const &enc_stream,
+                                                  uint8_t const *compressed_data,
+                                                  uint8_t *stream_out,
+                                                  StripeInformation *stripe,
+                                                  orc_streams *streams)
 {
   const auto length                                        = strm_desc.stream_size;
   (*streams)[enc_stream.ids[strm_desc.stream_type]].length = length;
-  if (length == 0) { return; }
+  if (length == 0) { return {}; }
 
   const auto *stream_in = (compression_kind_ == NONE) ? enc_stream.data_ptrs[strm_desc.stream_type]
                                                       : (compressed_data + strm_desc.bfr_offset);
 
+  std::future<void> device_write;
   if (out_sink_->is_device_write_preferred(length)) {
-    out_sink_->device_write(stream_in, length, stream);
+    device_write = out_sink_->device_write_async(stream_in, length, stream);
   } else {
     CUDA_TRY(
       cudaMemcpyAsync(stream_out, stream_in, length, cudaMemcpyDeviceToHost, stream.value()));
@@ -944,6 +999,7 @@ void writer::impl::write_data_stream(gpu::StripeStream const &strm_desc,
     out_sink_->host_write(stream_out, length);
   }
   stripe->dataLength += length;
+  return device_write;
 }
 
 void writer::impl::add_uncompressed_block_headers(std::vector<uint8_t> &v)
@@ -973,6 +1029,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
                    rmm::cuda_stream_view stream)
   : compression_kind_(to_orc_compression(options.get_compression())),
     enable_statistics_(options.enable_statistics()),
+    bloom_filter_columns_(options.get_bloom_filter_columns()),
     out_sink_(std::move(sink)),
     single_write_mode(mode == SingleWriteMode::YES),
     user_metadata(options.get_metadata()),
@@ -989,6 +1046,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
                    rmm::cuda_stream_view stream)
   : compression_kind_(to_orc_compression(options.get_compression())),
     enable_statistics_(options.enable_statistics()),
+    bloom_filter_columns_(options.get_bloom_filter_columns()),
     out_sink_(std::move(sink)),
     single_write_mode(mode == SingleWriteMode::YES),
     stream(stream),
@@ -1026,9 +1084,12 @@ rmm::device_uvector<size_type> get_string_column_ids(const table_device_view &vi
   return string_column_ids;
 }
 
-void writer::impl::write(table_view const &table)
+void writer::impl::write(table_view const &input)
 {
   CUDF_EXPECTS(not closed, "Data has already been flushed to out and closed");
+  // Dictionary columns are written as their decoded values
+  auto const decoded     = decode_dictionary_columns(input, stream);
+  auto const &table      = decoded.first;
   auto const num_columns = table.num_columns();
   auto const num_rows    = table.num_rows();
 
@@ -1039,6 +1100,21 @@ void writer::impl::write(table_view const &table)
       "be specified");
   }
 
+  for (auto const col_idx : bloom_filter_columns_) {
+    CUDF_EXPECTS(col_idx >= 0 && col_idx < num_columns, "Invalid bloom filter column index");
+    switch (table.column(col_idx).type().id()) {
+      case type_id::INT8:
+      case type_id::INT16:
+      case type_id::INT32:
+      case type_id::INT64:
+      case type_id::FLOAT32:
+      case type_id::FLOAT64:
+      case type_id::TIMESTAMP_DAYS:
+      case type_id::STRING: break;
+      default: CUDF_FAIL("Unsupported bloom filter column type");
+    }
+  }
+
   auto device_columns    = table_device_view::create(table, stream);
   auto string_column_ids = get_string_column_ids(*device_columns, stream);
 
@@ -1055,8 +1131,10 @@ void writer::impl::write(table_view const &table)
     if (orc_columns.back().is_string()) { str_col_ids.push_back(current_id); }
   }
 
-  rmm::device_uvector<uint32_t> dict_data(str_col_ids.size() * num_rows, stream);
-  rmm::device_uvector<uint32_t> dict_index(str_col_ids.size() * num_rows, stream);
+  rmm::device_uvector<uint32_t> dict_data(
+    str_col_ids.size() * num_rows, stream, get_temporary_memory_resource());
+  rmm::device_uvector<uint32_t> dict_index(
+    str_col_ids.size() * num_rows, stream, get_temporary_memory_resource());
 
   // Build per-column dictionary indices
   const auto num_rowgroups   = div_by_rowgroups<size_t>(num_rows);
@@ -1098,6 +1176,13 @@ void writer::impl::write(table_view const &table)
   auto stripes =
     gather_stripes(num_rows, num_index_streams, stripe_bounds, &enc_data.streams, &strm_descs);
 
+  // Build the bloom filters of every rowgroup
+  auto const bloom_params = get_bloom_filter_params(row_index_stride_);
+  std::vector<uint64_t> bloom_bitsets;
+  if (!bloom_filter_columns_.empty() && num_rows > 0) {
+    bloom_bitsets = build_bloom_filters(*device_columns, num_rowgroups, bloom_params);
+  }
+
   // Gather column statistics
   std::vector<std::vector<uint8_t>> column_stats;
   if (enable_statistics_ && num_columns > 0 && num_rows > 0) {
@@ -1130,23 +1215,16 @@ void writer::impl::write(table_view const &table)
       }
     }
 
-    if (all_device_write) {
-      return pinned_buffer<uint8_t>{nullptr, cudaFreeHost};
-    } else {
-      return pinned_buffer<uint8_t>{[](size_t size) {
-                                      uint8_t *ptr = nullptr;
-                                      CUDA_TRY(cudaMallocHost(&ptr, size));
-                                      return ptr;
-                                    }(max_stream_size),
-                                    cudaFreeHost};
-    }
+    return all_device_write ? pinned_buffer<uint8_t>{} : pinned_buffer<uint8_t>{max_stream_size};
   }();
 
   // Compress the data streams
-  rmm::device_buffer compressed_data(compressed_bfr_size, stream);
+  rmm::device_buffer compressed_data(
+    compressed_bfr_size, stream, get_temporary_memory_resource());
   hostdevice_vector<gpu_inflate_status_s> comp_out(num_compressed_blocks, stream);
   hostdevice_vector<gpu_inflate_input_s> comp_in(num_compressed_blocks, stream);
   if (compression_kind_ != NONE) {
+    stage_range range{"orc::compress", static_cast<int64_t>(compressed_bfr_size)};
     strm_descs.host_to_device(stream);
     gpu::CompressOrcDataStreams(static_cast<uint8_t *>(compressed_data.data()),
                                 num_compressed_blocks,
@@ -1163,10 +1241,15 @@ void writer::impl::write(table_view const &table)
 
   ProtobufWriter pbw_(&buffer_);
 
+  // Device writes stay in flight while the following streams and stripes are written; they read
+  // from the encoded and compressed buffers, which outlive this vector
+  std::vector<std::future<void>> pending_writes;
+
   // Write stripes
   for (size_t stripe_id = 0; stripe_id < stripes.size(); ++stripe_id) {
     auto const &rowgroup_range = stripe_bounds[stripe_id];
     auto &stripe               = stripes[stripe_id];
+    stage_range range{"orc::write_stripe", -1, stripe.numberOfRows};
 
     stripe.offset = out_sink_->bytes_written();
 
@@ -1184,19 +1267,38 @@ void writer::impl::write(table_view const &table)
                          &pbw_);
     }
 
+    // Bloom filter streams follow the row index streams
+    std::vector<Stream> bloom_streams;
+    if (!bloom_bitsets.empty()) {
+      auto const column_bitsets = num_rowgroups * bloom_params.num_words;
+      for (size_t i = 0; i < bloom_filter_columns_.size(); ++i) {
+        bloom_streams.push_back(write_bloom_filter_stream(
+          orc_columns[bloom_filter_columns_[i]],
+          host_span<uint64_t const>(bloom_bitsets.data() + i * column_bitsets, column_bitsets),
+          bloom_params,
+          rowgroup_range,
+          &stripe,
+          &pbw_));
+      }
+    }
+
     // Column data consisting one or more separate streams
     for (auto const &strm_desc : strm_descs[stripe_id]) {
-      write_data_stream(strm_desc,
-                        enc_data.streams[strm_desc.column_id][rowgroup_range.first],
-                        static_cast<uint8_t *>(compressed_data.data()),
-                        stream_output.get(),
-                        &stripe,
-                        &streams);
+      auto device_write =
+        write_data_stream(strm_desc,
+                          enc_data.streams[strm_desc.column_id][rowgroup_range.first],
+                          static_cast<uint8_t *>(compressed_data.data()),
+                          stream_output.get(),
+                          &stripe,
+                          &streams);
+      if (device_write.valid()) { pending_writes.push_back(std::move(device_write)); }
     }
 
     // Write stripefooter consisting of stream information
     StripeFooter sf;
     sf.streams = streams;
+    sf.streams.insert(
+      sf.streams.begin() + num_index_streams, bloom_streams.begin(), bloom_streams.end());
     sf.columns.resize(num_columns + 1);
     sf.columns[0].kind = DIRECT;
     for (size_t i = 1; i < sf.columns.size(); ++i) {
@@ -1217,6 +1319,9 @@ void writer::impl::write(table_view const &table)
     }
     out_sink_->host_write(buffer_.data(), buffer_.size());
   }
+  for (auto &device_write : pending_writes) {
+    device_write.get();
+  }
 
   if (column_stats.size() != 0) {
     // File-level statistics
@@ -33,6 +33,7 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -318,6 +319,38 @@ class writer::impl {
                           orc_streams* streams,
                           ProtobufWriter* pbw);
 
+  /**
+   * @brief Builds the bloom filters of every rowgroup of the bloom filter columns.
+   *
+   * @param table Table information to be written
+   * @param num_rowgroups Total number of rowgroups
+   * @param params Size and number of hash functions of each bloom filter
+   *
+   * @return Host copy of the bloom filters [bloom filter column][rowgroup][params.num_words]
+   */
+  std::vector<uint64_t> build_bloom_filters(table_device_view const& table,
+                                            size_t num_rowgroups,
+                                            bloom_filter_params params);
+
+  /**
+   * @brief Writes the BLOOM_FILTER_UTF8 stream of a column within a stripe.
+   *
+   * @param[in] column Column the bloom filters belong to
+   * @param[in] bitsets Bloom filters of the column's rowgroups [rowgroup][params.num_words]
+   * @param[in] params Size and number of hash functions of each bloom filter
+   * @param[in] rowgroups_range Indexes of rowgroups in the stripe
+   * @param[in,out] stripe Stream's parent stripe
+   * @param[in,out] pbw Protobuf writer
+   *
+   * @return The stream to list in the stripe footer
+   */
+  Stream write_bloom_filter_stream(orc_column_view const& column,
+                                   host_span<uint64_t const> bitsets,
+                                   bloom_filter_params params,
+                                   stripe_rowgroups const& rowgroups_range,
+                                   StripeInformation* stripe,
+                                   ProtobufWriter* pbw);
+
   /**
    * @brief Write the specified column's data streams
    *
@@ -327,8 +360,10 @@ class writer::impl {
    * @param[in,out] stream_out Temporary host output buffer
    * @param[in,out] stripe Stream's parent stripe
    * @param[in,out] streams List of all streams
+   *
+   * @return Future of the device write; invalid if the stream was written through the host
    */
-  void write_data_stream(gpu::StripeStream const& strm_desc,
+  std::future<void> write_data_stream(gpu::StripeStream const& strm_desc,
                          gpu::encoder_chunk_streams const& enc_stream,
                          uint8_t const* compressed_data,
                          uint8_t* stream_out,
@@ -378,6 +413,7 @@ class writer::impl {
 
   bool enable_dictionary_ = true;
   bool enable_statistics_ = true;
+  std::vector<size_type> bloom_filter_columns_;
 
   // Overall file metadata.  Filled in during the process and written during write_chunked_end()
   cudf::io::orc::FileFooter ff;
@@ -117,6 +117,86 @@ size_t CompactProtocolWriter::write(const ColumnChunkMetaData &s)
   if (s.index_page_offset != 0) { c.field_int(10, s.index_page_offset); }
   if (s.dictionary_page_offset != 0) { c.field_int(11, s.dictionary_page_offset); }
   if (s.statistics_blob.size() != 0) { c.field_struct_blob(12, s.statistics_blob); }
+  if (s.bloom_filter_length != 0) {
+    c.field_int(14, s.bloom_filter_offset);
+    c.field_int(15, s.bloom_filter_length);
+  }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const PageLocation &s)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_int(1, s.offset);
+  c.field_int(2, s.compressed_page_size);
+  c.field_int(3, s.first_row_index);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const OffsetIndex &s)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_struct_list(1, s.page_locations);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const ColumnIndex &s)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_bool_list(1, s.null_pages);
+  c.field_binary_list(2, s.min_values);
+  c.field_binary_list(3, s.max_values);
+  c.field_int(4, s.boundary_order);
+  if (s.null_counts.size() != 0) { c.field_int64_list(5, s.null_counts); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const SplitBlockAlgorithm &)
+{
+  CompactProtocolFieldWriter c(*this);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const XxHash &)
+{
+  CompactProtocolFieldWriter c(*this);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterUncompressed &)
+{
+  CompactProtocolFieldWriter c(*this);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterAlgorithm &s)
+{
+  CompactProtocolFieldWriter c(*this);
+  if (s.isset_BLOCK) { c.field_struct(1, s.BLOCK); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterHash &s)
+{
+  CompactProtocolFieldWriter c(*this);
+  if (s.isset_XXHASH) { c.field_struct(1, s.XXHASH); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterCompression &s)
+{
+  CompactProtocolFieldWriter c(*this);
+  if (s.isset_UNCOMPRESSED) { c.field_struct(1, s.UNCOMPRESSED); }
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterHeader &s)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_int(1, s.num_bytes);
+  c.field_struct(2, s.algorithm);
+  c.field_struct(3, s.hash);
+  c.field_struct(4, s.compression);
   return c.value();
 }
 
@@ -179,6 +259,24 @@ inline void CompactProtocolFieldWriter::field_int_list(int field, const std::vec
   current_field_value = field;
 }
 
+inline void CompactProtocolFieldWriter::field_int64_list(int field, const std::vector<int64_t> &val)
+{
+  put_field_header(field, current_field_value, ST_FLD_LIST);
+  put_byte((uint8_t)((std::min(val.size(), (size_t)0xfu) << 4) | ST_FLD_I64));
+  if (val.size() >= 0xf) put_uint(val.size());
+  for (auto &v : val) { put_int(v); }
+  current_field_value = field;
+}
+
+inline void CompactProtocolFieldWriter::field_bool_list(int field, const std::vector<bool> &val)
+{
+  put_field_header(field, current_field_value, ST_FLD_LIST);
+  put_byte((uint8_t)((std::min(val.size(), (size_t)0xfu) << 4) | ST_FLD_TRUE));
+  if (val.size() >= 0xf) put_uint(val.size());
+  for (bool v : val) { put_byte(v ? ST_FLD_TRUE : ST_FLD_FALSE); }
+  current_field_value = field;
+}
+
 template <typename T>
 inline void CompactProtocolFieldWriter::field_struct(int field, const T &val)
 {
@@ -235,6 +333,19 @@ inline void CompactProtocolFieldWriter::field_string_list(int field,
   current_field_value = field;
 }
 
+inline void CompactProtocolFieldWriter::field_binary_list(
+  int field, const std::vector<std::vector<uint8_t>> &val)
+{
+  put_field_header(field, current_field_value, ST_FLD_LIST);
+  put_byte((uint8_t)((std::min(val.size(), (size_t)0xfu) << 4) | ST_FLD_BINARY));
+  if (val.size() >= 0xf) put_uint(val.size());
+  for (auto &v : val) {
+    put_uint(v.size());
+    put_byte(v.data(), (uint32_t)v.size());
+  }
+  current_field_value = field;
+}
+
 inline int CompactProtocolFieldWriter::current_field() { return current_field_value; }
 
 inline void CompactProtocolFieldWriter::set_current_field(const int &field)
@@ -44,6 +44,16 @@ class CompactProtocolWriter {
   size_t write(const KeyValue &);
   size_t write(const ColumnChunk &);
   size_t write(const ColumnChunkMetaData &);
+  size_t write(const PageLocation &);
+  size_t write(const OffsetIndex &);
+  size_t write(const ColumnIndex &);
+  size_t write(const SplitBlockAlgorithm &);
+  size_t write(const XxHash &);
+  size_t write(const BloomFilterUncompressed &);
+  size_t write(const BloomFilterAlgorithm &);
+  size_t write(const BloomFilterHash &);
+  size_t write(const BloomFilterCompression &);
+  size_t write(const BloomFilterHeader &);
 
  protected:
   std::vector<uint8_t> &m_buf;
@@ -78,6 +88,10 @@ class CompactProtocolFieldWriter {
   template <typename Enum>
   inline void field_int_list(int field, const std::vector<Enum> &val);
 
+  inline void field_int64_list(int field, const std::vector<int64_t> &val);
+
+  inline void field_bool_list(int field, const std::vector<bool> &val);
+
   template <typename T>
   inline void field_struct(int field, const T &val);
 
@@ -92,6 +106,8 @@ class CompactProtocolFieldWriter {
 
   inline void field_string_list(int field, const std::vector<std::string> &val);
 
+  inline void field_binary_list(int field, const std::vector<std::vector<uint8_t>> &val);
+
   inline int current_field();
 
   inline void set_current_field(const int &field);
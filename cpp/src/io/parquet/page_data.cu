@@ -44,6 +44,23 @@ namespace io {
 namespace parquet {
 namespace gpu {
 
+/**
+ * @brief State of a DELTA_BINARY_PACKED stream decoder
+ */
+struct delta_binary_state_s {
+  const uint8_t *cur;        // current read position (start of the current miniblock)
+  const uint8_t *end;        // end of the encoded data
+  const uint8_t *mb_widths;  // bit widths of the miniblocks in the current block
+  uint64_t last_value;       // last decoded value
+  uint64_t min_delta;        // minimum delta of the current block
+  uint32_t values_per_mb;    // number of values per miniblock
+  uint32_t mb_count;         // number of miniblocks per block
+  int32_t value_count;       // total number of values in the stream
+  int32_t pos;               // number of values decoded so far
+  uint32_t mb_idx;           // current miniblock within the block (mb_count: start of a new block)
+  uint32_t mb_pos;           // number of values decoded in the current miniblock
+};
+
 struct page_state_s {
   const uint8_t *data_start;
   const uint8_t *data_end;
@@ -74,6 +91,15 @@ struct page_state_s {
   uint32_t dict_idx[non_zero_buffer_size];  // Dictionary index, boolean, or string offset values
   uint32_t str_len[non_zero_buffer_size];   // String length for plain encoding of strings
 
+  // DELTA_BINARY_PACKED and DELTA_*_BYTE_ARRAY decoding
+  delta_binary_state_s delta;         // values, string lengths or string suffix lengths
+  delta_binary_state_s delta_prefix;  // string prefix lengths (DELTA_BYTE_ARRAY only)
+  const uint8_t *str_src;             // string suffix data (DELTA_BYTE_ARRAY only)
+  int32_t str_src_size;               // size of the string suffix data
+  int32_t str_src_pos;                // read position in the string suffix data
+  int32_t str_prev_ofs;               // scratch offset of the last reconstructed string
+  int64_t delta_val[non_zero_buffer_size];  // decoded DELTA_BINARY_PACKED values
+
   // repetition/definition level decoding
   int32_t input_value_count;                  // how many values of the input we've processed
   int32_t input_row_count;                    // how many rows of the input we've processed
@@ -167,6 +193,201 @@ inline __device__ uint32_t get_vlq32(const uint8_t *&cur, const uint8_t *end)
   return v;
 }
 
+/**
+ * @brief Read a 64-bit varint integer
+ *
+ * @param[in,out] cur The current data position, updated after the read
+ * @param[in] end The end data position
+ *
+ * @return The 64-bit value read
+ */
+inline __device__ uint64_t get_vlq64(const uint8_t *&cur, const uint8_t *end)
+{
+  uint64_t v = 0;
+  for (uint32_t l = 0; cur < end && l < 64; l += 7) {
+    uint64_t c = *cur++;
+    v |= (c & 0x7f) << l;
+    if (c < 0x80) break;
+  }
+  return v;
+}
+
+/**
+ * @brief Read a 64-bit zigzag-encoded varint integer
+ *
+ * @param[in,out] cur The current data position, updated after the read
+ * @param[in] end The end data position
+ *
+ * @return The 64-bit value read, as a two's complement bit pattern
+ */
+inline __device__ uint64_t get_zigzag64(const uint8_t *&cur, const uint8_t *end)
+{
+  uint64_t u = get_vlq64(cur, end);
+  return (u >> 1u) ^ -(u & 1);
+}
+
+/**
+ * @brief Parse the header of a DELTA_BINARY_PACKED stream
+ *
+ * @param[out] d The decoder state to initialize
+ * @param[in] cur The start of the stream
+ * @param[in] end The end of the data
+ *
+ * @return false if the header is invalid
+ */
+__device__ bool InitDeltaBinary(delta_binary_state_s *d, const uint8_t *cur, const uint8_t *end)
+{
+  uint32_t block_size = (cur < end) ? get_vlq32(cur, end) : 0;
+  uint32_t mb_count   = (cur < end) ? get_vlq32(cur, end) : 0;
+  d->value_count      = (cur < end) ? get_vlq32(cur, end) : 0;
+  d->last_value       = get_zigzag64(cur, end);
+  d->min_delta        = 0;
+  d->mb_count         = mb_count;
+  d->values_per_mb    = (mb_count > 0) ? block_size / mb_count : 0;
+  d->mb_widths        = nullptr;
+  d->mb_idx           = mb_count;
+  d->mb_pos           = 0;
+  d->pos              = 0;
+  d->cur              = cur;
+  d->end              = end;
+  // the miniblock size must be a multiple of 32 values
+  return cur <= end && d->values_per_mb > 0 && (d->values_per_mb & 0x1f) == 0 &&
+         d->values_per_mb * mb_count == block_size;
+}
+
+/**
+ * @brief Find the end of a DELTA_BINARY_PACKED stream without decoding the values
+ *
+ * @param[in] cur The start of the stream
+ * @param[in] end The end of the data
+ *
+ * @return The position following the stream
+ */
+__device__ const uint8_t *SkipDeltaBinary(const uint8_t *cur, const uint8_t *end)
+{
+  delta_binary_state_s d;
+  if (!InitDeltaBinary(&d, cur, end)) { return end; }
+  cur = d.cur;
+  // the last block only stores the miniblocks it needs, but all of its bit widths
+  for (int32_t remaining = d.value_count - 1; remaining > 0 && cur < end;) {
+    get_zigzag64(cur, end);
+    const uint8_t *mb_widths = cur;
+    cur += d.mb_count;
+    if (cur > end) { return end; }
+    for (uint32_t i = 0; i < d.mb_count && remaining > 0; i++) {
+      cur += (d.values_per_mb * mb_widths[i]) >> 3;
+      remaining -= d.values_per_mb;
+    }
+  }
+  return min(cur, end);
+}
+
+/**
+ * @brief Returns the number of values the next call to DecodeDeltaBinaryBatch will decode
+ *
+ * @param[in] d The decoder state
+ * @param[in] max_count Maximum number of values to decode
+ *
+ * @return The batch size, zero at the end of the stream
+ */
+inline __device__ int DeltaBinaryBatchSize(volatile delta_binary_state_s *d, int max_count)
+{
+  int32_t pos = d->pos;
+  if (pos == 0) { return min(min(d->value_count, 1), max(max_count, 0)); }
+  // a new miniblock is started once the current one is exhausted
+  int mb_left = (d->mb_pos == d->values_per_mb) ? d->values_per_mb : d->values_per_mb - d->mb_pos;
+  return max(min(min(min(32, mb_left), d->value_count - pos), max_count), 0);
+}
+
+/**
+ * @brief Decode the next batch of up to 32 DELTA_BINARY_PACKED values, one value per lane
+ *
+ * The deltas of a miniblock are unpacked in parallel and turned into values with a warp-wide
+ * inclusive prefix sum. Must be called by all lanes of the warp.
+ *
+ * @param[in,out] d The decoder state
+ * @param[in] max_count Maximum number of values to decode
+ * @param[in] t Warp lane id
+ * @param[out] batch_len Number of values decoded, zero at the end of the stream
+ *
+ * @return The value for this lane, as a two's complement bit pattern
+ */
+__device__ uint64_t DecodeDeltaBinaryBatch(volatile delta_binary_state_s *d,
+                                           int max_count,
+                                           int t,
+                                           int &batch_len)
+{
+  int32_t pos = d->pos;
+  batch_len   = DeltaBinaryBatchSize(d, max_count);
+  if (batch_len == 0) { return 0; }
+  if (pos == 0) {
+    // the first value is stored in the header
+    uint64_t v = d->last_value;
+    __syncwarp();
+    if (!t) { d->pos = 1; }
+    __syncwarp();
+    return v;
+  }
+  if (!t) {
+    const uint8_t *cur = d->cur;
+    const uint8_t *end = d->end;
+    if (d->mb_pos == d->values_per_mb) {
+      uint32_t width = d->mb_widths[d->mb_idx];
+      cur += (d->values_per_mb * width) >> 3;
+      d->mb_idx = d->mb_idx + 1;
+      d->mb_pos = 0;
+    }
+    if (d->mb_idx >= d->mb_count) {
+      // start of a new block: minimum delta followed by the miniblock bit widths
+      d->min_delta = get_zigzag64(cur, end);
+      d->mb_widths = cur;
+      cur += d->mb_count;
+      d->mb_idx = 0;
+      d->mb_pos = 0;
+    }
+    d->cur = cur;
+  }
+  __syncwarp();
+  const uint8_t *cur = d->cur;
+  const uint8_t *end = d->end;
+  uint32_t mb_pos    = d->mb_pos;
+  uint32_t width     = (d->mb_widths + d->mb_idx < end) ? d->mb_widths[d->mb_idx] : 0;
+  if (cur > end || width > 64) { width = 0; }
+
+  uint64_t delta = 0;
+  if (t < batch_len) {
+    delta = d->min_delta;
+    if (width > 0) {
+      uint64_t bit_pos = static_cast<uint64_t>(mb_pos + t) * width;
+      const uint8_t *p = cur + (bit_pos >> 3);
+      uint32_t shift   = bit_pos & 7;
+      uint64_t v       = 0;
+      for (uint32_t i = 0; i < 8 && p + i < end; i++) {
+        v |= static_cast<uint64_t>(p[i]) << (i * 8);
+      }
+      v >>= shift;
+      if (shift + width > 64 && p + 8 < end) { v |= static_cast<uint64_t>(p[8]) << (64 - shift); }
+      if (width < 64) { v &= (UINT64_C(1) << width) - 1; }
+      delta += v;
+    }
+  }
+  // inclusive prefix sum of the deltas
+  for (int i = 1; i < 32; i <<= 1) {
+    uint64_t tmp = __shfl_up_sync(~0, delta, i);
+    if (t >= i) { delta += tmp; }
+  }
+  uint64_t v    = d->last_value + delta;
+  uint64_t last = shuffle(v, batch_len - 1);
+  __syncwarp();
+  if (!t) {
+    d->last_value = last;
+    d->pos        = pos + batch_len;
+    d->mb_pos     = mb_pos + batch_len;
+  }
+  __syncwarp();
+  return v;
+}
+
 /**
  * @brief Parse the beginning of the level section (definition or repetition),
  * initializes the initial RLE run & value, and returns the section length
@@ -193,6 +414,27 @@ __device__ uint32_t InitLevelSection(page_state_s *s,
     s->initial_rle_run[lvl]   = s->page.num_input_values * 2;  // repeated value
     s->initial_rle_value[lvl] = 0;
     s->lvl_start[lvl]         = cur;
+  } else if (encoding == Encoding::RLE && (s->page.flags & PAGEINFO_FLAGS_V2)) {
+    // V2 pages store the level section size in the page header
+    len = s->page.lvl_bytes[lvl];
+    if (len > 0 && cur + len <= end) {
+      const uint8_t *lvl_end  = cur + len;
+      uint32_t run            = get_vlq32(cur, lvl_end);
+      s->initial_rle_run[lvl] = run;
+      if (!(run & 1)) {
+        int v = (cur < lvl_end) ? cur[0] : 0;
+        cur++;
+        if (level_bits > 8) {
+          v |= ((cur < lvl_end) ? cur[0] : 0) << 8;
+          cur++;
+        }
+        s->initial_rle_value[lvl] = v;
+      }
+      s->lvl_start[lvl] = cur;
+    } else {
+      len      = 0;
+      s->error = 2;
+    }
   } else if (encoding == Encoding::RLE) {
     if (cur + 4 < end) {
       uint32_t run;
@@ -504,6 +746,143 @@ __device__ void gpuInitStringDescriptors(volatile page_state_s *s, int target_po
   }
 }
 
+/**
+ * @brief Decodes DELTA_BINARY_PACKED values
+ *
+ * @param[in,out] s Page state input/output
+ * @param[in] target_pos Target output position
+ * @param[in] t Warp lane id
+ *
+ * @return The new output position
+ */
+__device__ int gpuDecodeDeltaValues(volatile page_state_s *s, int target_pos, int t)
+{
+  int pos = s->delta.pos;
+  while (pos < target_pos) {
+    int batch_len;
+    uint64_t v = DecodeDeltaBinaryBatch(&s->delta, target_pos - pos, t, batch_len);
+    if (batch_len == 0) {
+      // fewer values than the levels indicate
+      if (!t) { s->error = 0x20; }
+      return target_pos;
+    }
+    if (t < batch_len) { s->delta_val[rolling_index(pos + t)] = static_cast<int64_t>(v); }
+    pos += batch_len;
+  }
+  return pos;
+}
+
+/**
+ * @brief Parses the length and position of DELTA_LENGTH_BYTE_ARRAY strings
+ *
+ * @param[in,out] s Page state input/output
+ * @param[in] target_pos Target output position
+ * @param[in] t Warp lane id
+ *
+ * @return The new output position
+ */
+__device__ int gpuDecodeDeltaLengthStrings(volatile page_state_s *s, int target_pos, int t)
+{
+  int pos = s->delta.pos;
+  while (pos < target_pos) {
+    int batch_len;
+    int32_t len =
+      static_cast<int32_t>(DecodeDeltaBinaryBatch(&s->delta, target_pos - pos, t, batch_len));
+    if (batch_len == 0) {
+      if (!t) { s->error = 0x20; }
+      return target_pos;
+    }
+    if (t >= batch_len || len < 0) { len = 0; }
+    // string offsets are the exclusive prefix sum of the lengths
+    int32_t end_ofs = WarpReducePos32(len, t) + s->dict_val;
+    int32_t ofs     = end_ofs - len;
+    if (t < batch_len) {
+      s->dict_idx[rolling_index(pos + t)] = ofs;
+      s->str_len[rolling_index(pos + t)]  = (end_ofs <= s->dict_size) ? len : 0;
+    }
+    end_ofs = shuffle(end_ofs, batch_len - 1);
+    __syncwarp();
+    if (!t) { s->dict_val = end_ofs; }
+    __syncwarp();
+    pos += batch_len;
+  }
+  return pos;
+}
+
+/**
+ * @brief Reconstructs DELTA_BYTE_ARRAY strings into the scratch memory of the page
+ *
+ * Each string is the prefix of the previous string followed by its own suffix, so strings are
+ * reconstructed one after another, with the lanes of the warp copying the bytes of each string.
+ *
+ * @param[in,out] s Page state input/output
+ * @param[in] target_pos Target output position
+ * @param[in] t Warp lane id
+ *
+ * @return The new output position
+ */
+__device__ int gpuDecodeDeltaByteArray(volatile page_state_s *s, int target_pos, int t)
+{
+  uint8_t *str_data    = s->page.str_data;
+  const uint8_t *src   = s->str_src;
+  int32_t const max_sz = s->dict_size;
+  int pos              = s->delta.pos;
+  while (pos < target_pos) {
+    // the two streams may use different miniblock sizes
+    int batch_len = min(DeltaBinaryBatchSize(&s->delta_prefix, target_pos - pos),
+                        DeltaBinaryBatchSize(&s->delta, target_pos - pos));
+    int prefix_batch_len;
+    int32_t prefix_len = static_cast<int32_t>(
+      DecodeDeltaBinaryBatch(&s->delta_prefix, batch_len, t, prefix_batch_len));
+    int32_t suffix_len =
+      static_cast<int32_t>(DecodeDeltaBinaryBatch(&s->delta, batch_len, t, batch_len));
+    if (batch_len == 0) {
+      if (!t) { s->error = 0x20; }
+      return target_pos;
+    }
+    if (t >= batch_len || prefix_len < 0 || suffix_len < 0) {
+      prefix_len = 0;
+      suffix_len = 0;
+    }
+    int32_t len         = prefix_len + suffix_len;
+    int32_t end_ofs     = WarpReducePos32(len, t) + s->dict_val;
+    int32_t src_end_ofs = WarpReducePos32(suffix_len, t) + s->str_src_pos;
+    int32_t ofs         = end_ofs - len;
+    int32_t src_ofs     = src_end_ofs - suffix_len;
+    if (t < batch_len) {
+      s->dict_idx[rolling_index(pos + t)] = ofs;
+      s->str_len[rolling_index(pos + t)]  = (end_ofs <= max_sz) ? len : 0;
+    }
+    // reconstruct the strings of the batch in order
+    for (int i = 0; i < batch_len; i++) {
+      int32_t str_ofs  = shuffle(ofs, i);
+      int32_t str_plen = shuffle(prefix_len, i);
+      int32_t str_slen = shuffle(suffix_len, i);
+      int32_t str_sofs = shuffle(src_ofs, i);
+      int32_t prev_ofs = (i > 0) ? shuffle(ofs, i - 1) : s->str_prev_ofs;
+      if (str_ofs + str_plen + str_slen <= max_sz && str_sofs + str_slen <= s->str_src_size) {
+        for (int k = t; k < str_plen; k += 32) { str_data[str_ofs + k] = str_data[prev_ofs + k]; }
+        for (int k = t; k < str_slen; k += 32) {
+          str_data[str_ofs + str_plen + k] = src[str_sofs + k];
+        }
+      }
+      __syncwarp();
+    }
+    int32_t last_ofs = shuffle(ofs, batch_len - 1);
+    end_ofs          = shuffle(end_ofs, batch_len - 1);
+    src_end_ofs      = shuffle(src_end_ofs, batch_len - 1);
+    __syncwarp();
+    if (!t) {
+      s->dict_val     = end_ofs;
+      s->str_src_pos  = src_end_ofs;
+      s->str_prev_ofs = last_ofs;
+    }
+    __syncwarp();
+    pos += batch_len;
+  }
+  return pos;
+}
+
 /**
  * @brief Output a string descriptor
  *
@@ -618,6 +997,53 @@ inline __device__ void gpuStoreOutput(uint2 *dst,
   *dst = v;
 }
 
+/**
+ * @brief Output a DELTA_BINARY_PACKED value
+ *
+ * @param[in,out] s Page state input/output
+ * @param[in] src_pos Source position
+ * @param[in] dst Pointer to row output data
+ */
+inline __device__ void gpuOutputDeltaValue(volatile page_state_s *s, int src_pos, void *dst)
+{
+  int64_t val = s->delta_val[rolling_index(src_pos)];
+  switch (s->dtype_len) {
+    case 1: *static_cast<int8_t *>(dst) = static_cast<int8_t>(val); break;
+    case 2: *static_cast<int16_t *>(dst) = static_cast<int16_t>(val); break;
+    case 4: *static_cast<int32_t *>(dst) = static_cast<int32_t>(val); break;
+    default:
+      // Output to desired clock rate
+      if (s->ts_scale < 0) {
+        // round towards negative infinity
+        int sign = (val < 0);
+        val      = ((val + sign) / -s->ts_scale) + sign;
+      } else if (s->ts_scale > 0) {
+        val *= s->ts_scale;
+      }
+      *static_cast<int64_t *>(dst) = val;
+      break;
+  }
+}
+
+/**
+ * @brief Output a BYTE_STREAM_SPLIT value by gathering its bytes from each of the streams
+ *
+ * @param[in,out] s Page state input/output
+ * @param[in] src_pos Source position
+ * @param[in] dst8 Pointer to row output data
+ */
+inline __device__ void gpuOutputByteStreamSplit(volatile page_state_s *s,
+                                                int src_pos,
+                                                uint8_t *dst8)
+{
+  uint32_t const len    = s->dtype_len_in;
+  uint32_t const stride = s->dict_size / len;
+  uint32_t const pos    = src_pos;
+  for (unsigned int i = 0; i < len; i++) {
+    dst8[i] = (pos < stride) ? s->data_start[i * stride + pos] : 0;
+  }
+}
+
 /**
  * @brief Convert an INT96 Spark timestamp to 64-bit timestamp
  *
@@ -1112,13 +1538,56 @@ static __device__ bool setupLocalPageInfo(page_state_s *const s,
           if ((s->col.data_type & 7) == BOOLEAN) { s->dict_run = s->dict_size * 2 + 1; }
           break;
         case Encoding::RLE: s->dict_run = 0; break;
+        case Encoding::DELTA_BINARY_PACKED:
+          // only valid for 32-bit and 64-bit integers
+          if ((data_type != INT32 && data_type != INT64) ||
+              !InitDeltaBinary(&s->delta, cur, end)) {
+            s->error = 1;
+          }
+          s->dict_size = static_cast<int32_t>(end - cur);
+          break;
+        case Encoding::BYTE_STREAM_SPLIT:
+          // one stream per byte of the value, only valid for floating-point
+          if (data_type != FLOAT && data_type != DOUBLE) { s->error = 1; }
+          s->dict_size = static_cast<int32_t>(end - cur);
+          break;
+        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+          // DELTA_BINARY_PACKED string lengths followed by the concatenated strings
+          if (data_type == BYTE_ARRAY && InitDeltaBinary(&s->delta, cur, end)) {
+            cur = SkipDeltaBinary(cur, end);
+          } else {
+            s->error = 1;
+          }
+          s->dict_size = static_cast<int32_t>(end - cur);
+          s->dict_val  = 0;
+          break;
+        case Encoding::DELTA_BYTE_ARRAY:
+          // DELTA_BINARY_PACKED prefix lengths followed by DELTA_LENGTH_BYTE_ARRAY suffixes. The
+          // strings are reconstructed into the scratch memory of the page.
+          if (data_type == BYTE_ARRAY && InitDeltaBinary(&s->delta_prefix, cur, end)) {
+            cur = SkipDeltaBinary(cur, end);
+            if (InitDeltaBinary(&s->delta, cur, end)) {
+              cur = SkipDeltaBinary(cur, end);
+            } else {
+              s->error = 1;
+            }
+          } else {
+            s->error = 1;
+          }
+          s->str_src      = cur;
+          s->str_src_size = static_cast<int32_t>(end - cur);
+          s->str_src_pos  = 0;
+          s->str_prev_ofs = 0;
+          s->dict_size    = s->page.str_bytes;
+          s->dict_val     = 0;
+          break;
         default:
           s->error = 1;  // Unsupported encoding
           break;
       }
       if (cur > end) { s->error = 1; }
       s->lvl_end    = cur;
-      s->data_start = cur;
+      s->data_start = (s->page.encoding == Encoding::DELTA_BYTE_ARRAY) ? s->page.str_data : cur;
       s->data_end   = end;
     } else {
       s->error = 1;
@@ -1693,8 +2162,13 @@ extern "C" __global__ void __launch_bounds__(block_size)
 
   if (!setupLocalPageInfo(s, &pages[page_idx], chunks, min_row, num_rows, num_chunks)) { return; }
 
+  bool const is_delta = s->page.encoding == Encoding::DELTA_BINARY_PACKED ||
+                        s->page.encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY ||
+                        s->page.encoding == Encoding::DELTA_BYTE_ARRAY;
   if (s->dict_base) {
     out_thread0 = (s->dict_bits > 0) ? 64 : 32;
+  } else if (is_delta) {
+    out_thread0 = 64;
   } else {
     out_thread0 =
       ((s->col.data_type & 7) == BOOLEAN || (s->col.data_type & 7) == BYTE_ARRAY) ? 64 : 32;
@@ -1727,6 +2201,12 @@ extern "C" __global__ void __launch_bounds__(block_size)
       // WARP1: Decode dictionary indices, booleans or string positions
       if (s->dict_base) {
         src_target_pos = gpuDecodeDictionaryIndices(s, src_target_pos, t & 0x1f);
+      } else if (s->page.encoding == Encoding::DELTA_BINARY_PACKED) {
+        src_target_pos = gpuDecodeDeltaValues(s, src_target_pos, t & 0x1f);
+      } else if (s->page.encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+        src_target_pos = gpuDecodeDeltaLengthStrings(s, src_target_pos, t & 0x1f);
+      } else if (s->page.encoding == Encoding::DELTA_BYTE_ARRAY) {
+        src_target_pos = gpuDecodeDeltaByteArray(s, src_target_pos, t & 0x1f);
       } else if ((s->col.data_type & 7) == BOOLEAN) {
         src_target_pos = gpuDecodeRleBooleans(s, src_target_pos, t & 0x1f);
       } else if ((s->col.data_type & 7) == BYTE_ARRAY) {
@@ -1771,6 +2251,10 @@ extern "C" __global__ void __launch_bounds__(block_size)
           s->page.nesting[leaf_level_index].data_out + static_cast<size_t>(dst_pos) * dtype_len;
         if (dtype == BYTE_ARRAY) {
           gpuOutputString(s, val_src_pos, dst);
+        } else if (is_delta) {
+          gpuOutputDeltaValue(s, val_src_pos, dst);
+        } else if (s->page.encoding == Encoding::BYTE_STREAM_SPLIT) {
+          gpuOutputByteStreamSplit(s, val_src_pos, static_cast<uint8_t *>(dst));
         } else if (dtype == BOOLEAN) {
           gpuOutputBoolean(s, val_src_pos, static_cast<uint8_t *>(dst));
         } else if (s->col.converted_type == DECIMAL) {
@@ -1807,6 +2291,48 @@ extern "C" __global__ void __launch_bounds__(block_size)
   }
 }
 
+/**
+ * @brief Kernel for computing the size of the strings reconstructed from DELTA_BYTE_ARRAY pages
+ *
+ * @param[in,out] pages List of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] num_chunks Number of column chunks
+ */
+// blockDim {block_size,1,1}
+extern "C" __global__ void __launch_bounds__(block_size)
+  gpuComputeDeltaStringSizes(PageInfo *pages, ColumnChunkDesc const *chunks, int32_t num_chunks)
+{
+  __shared__ __align__(16) page_state_s state_g;
+
+  page_state_s *const s = &state_g;
+  int page_idx          = blockIdx.x;
+  int t                 = threadIdx.x;
+
+  if (pages[page_idx].encoding != Encoding::DELTA_BYTE_ARRAY ||
+      !setupLocalPageInfo(s, &pages[page_idx], chunks, 0, INT_MAX, num_chunks)) {
+    return;
+  }
+
+  if (t < 32) {
+    // every string is its prefix followed by its suffix
+    int64_t str_bytes = 0;
+    while (!s->error) {
+      int batch_len =
+        min(DeltaBinaryBatchSize(&s->delta_prefix, 32), DeltaBinaryBatchSize(&s->delta, 32));
+      if (batch_len == 0) { break; }
+      auto prefix_len = static_cast<int32_t>(
+        DecodeDeltaBinaryBatch(&s->delta_prefix, batch_len, t, batch_len));
+      auto suffix_len =
+        static_cast<int32_t>(DecodeDeltaBinaryBatch(&s->delta, batch_len, t, batch_len));
+      if (t < batch_len) { str_bytes += max(prefix_len, 0) + max(suffix_len, 0); }
+    }
+    for (int i = 16; i > 0; i >>= 1) { str_bytes += shuffle_xor(str_bytes, i); }
+    if (!t) {
+      pages[page_idx].str_bytes = static_cast<int32_t>(min(str_bytes, INT64_C(INT_MAX)));
+    }
+  }
+}
+
 struct chunk_row_output_iter {
   PageInfo *p;
   using value_type        = size_type;
@@ -2002,6 +2528,20 @@ void __host__ DecodePageData(hostdevice_vector<PageInfo> &pages,
     pages.device_ptr(), chunks.device_ptr(), min_row, num_rows, chunks.size());
 }
 
+/**
+ * @copydoc cudf::io::parquet::gpu::ComputeDeltaStringSizes
+ */
+void __host__ ComputeDeltaStringSizes(hostdevice_vector<PageInfo> &pages,
+                                      hostdevice_vector<ColumnChunkDesc> const &chunks,
+                                      rmm::cuda_stream_view stream)
+{
+  dim3 dim_block(block_size, 1);
+  dim3 dim_grid(pages.size(), 1);  // 1 threadblock per page
+
+  gpuComputeDeltaStringSizes<<<dim_grid, dim_block, 0, stream.value()>>>(
+    pages.device_ptr(), chunks.device_ptr(), chunks.size());
+}
+
 }  // namespace gpu
 }  // namespace parquet
 }  // namespace io
@@ -150,7 +150,7 @@ __device__ void GenerateDictionaryIndices(dict_state_s *s, uint32_t t)
 // blockDim(1024, 1, 1)
 template <int block_size>
 __global__ void __launch_bounds__(block_size, 1)
-  gpuBuildChunkDictionaries(EncColumnChunk *chunks, uint32_t *dev_scratch)
+  gpuBuildChunkDictionaries(EncColumnChunk *chunks, uint32_t *dev_scratch, uint32_t max_dict_size)
 {
   __shared__ __align__(8) dict_state_s state_g;
   using block_reduce = cub::BlockReduce<uint32_t, block_size>;
@@ -290,7 +290,7 @@ __global__ void __launch_bounds__(block_size, 1)
     num_dict_entries = s->num_dict_entries;
     frag_dict_size   = s->frag_dict_size;
     if (s->total_dict_entries + num_dict_entries > 65536 ||
-        (s->dictionary_size != 0 && s->dictionary_size + frag_dict_size > 512 * 1024)) {
+        (s->dictionary_size != 0 && s->dictionary_size + frag_dict_size > max_dict_size)) {
       break;
     }
     __syncthreads();
@@ -322,17 +322,20 @@ __global__ void __launch_bounds__(block_size, 1)
  * @param[in,out] chunks Column chunks
  * @param[in] dev_scratch Device scratch data (kDictScratchSize per dictionary)
  * @param[in] num_chunks Number of column chunks
+ * @param[in] max_dict_size Dictionary size in bytes past which no more fragments are added
  * @param[in] stream CUDA stream to use, default 0
  */
 void BuildChunkDictionaries(EncColumnChunk *chunks,
                             uint32_t *dev_scratch,
                             size_t scratch_size,
                             uint32_t num_chunks,
+                            uint32_t max_dict_size,
                             rmm::cuda_stream_view stream)
 {
   if (num_chunks > 0 && scratch_size > 0) {  // zero scratch size implies no dictionaries
     CUDA_TRY(cudaMemsetAsync(dev_scratch, 0, scratch_size, stream.value()));
-    gpuBuildChunkDictionaries<1024><<<num_chunks, 1024, 0, stream.value()>>>(chunks, dev_scratch);
+    gpuBuildChunkDictionaries<1024>
+      <<<num_chunks, 1024, 0, stream.value()>>>(chunks, dev_scratch, max_dict_size);
   }
 }
 
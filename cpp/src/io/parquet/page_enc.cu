@@ -29,6 +29,8 @@
 #include <cub/cub.cuh>
 #include <cuda/std/chrono>
 
+#include <limits>
+
 namespace cudf {
 namespace io {
 namespace parquet {
@@ -43,6 +45,10 @@ constexpr bool enable_bool_rle = false;
 constexpr int init_hash_bits       = 12;
 constexpr uint32_t rle_buffer_size = (1 << 9);
 
+// DELTA_BINARY_PACKED block layout: one miniblock of 32 values per warp
+constexpr uint32_t delta_block_size     = 128;
+constexpr uint32_t delta_num_miniblocks = 4;
+
 struct frag_init_state_s {
   parquet_column_device_view col;
   PageFragment frag;
@@ -66,14 +72,21 @@ struct page_enc_state_s {
   uint32_t rle_lit_count;
   uint32_t rle_rpt_count;
   uint32_t page_start_val;
+  uint32_t enc_count;    //!< valid values encoded so far (DELTA_BINARY_PACKED, BYTE_STREAM_SPLIT)
+  uint32_t delta_count;  //!< values buffered for the next DELTA_BINARY_PACKED block
+  int64_t delta_prev;    //!< last value preceding the buffered block
   volatile uint32_t rpt_map[4];
   volatile uint32_t scratch_red[32];
+  volatile int64_t delta_min[delta_num_miniblocks];
+  uint32_t delta_widths[delta_num_miniblocks];
   EncPage page;
   EncColumnChunk ck;
   parquet_column_device_view col;
   gpu_inflate_input_s comp_in;
   gpu_inflate_status_s comp_out;
   uint16_t vals[rle_buffer_size];
+  int64_t delta_buf[2 * delta_block_size];
+  uint32_t delta_bits[2 * delta_block_size];  //!< bit-packed miniblocks (128 values x 64 bits)
 };
 
 /**
@@ -108,6 +121,7 @@ inline __device__ uint32_t uint64_init_hash(uint64_t v)
  *
  * @param[in] frag Fragment array [fragment_id][column_id]
  * @param[in] col_desc Column description array [column_id]
+ * @param[in] fragment_starts First row of each fragment, followed by the number of rows
  * @param[in] num_fragments Number of fragments per column
  * @param[in] num_columns Number of columns
  */
@@ -116,10 +130,9 @@ template <int block_size>
 __global__ void __launch_bounds__(block_size)
   gpuInitPageFragments(PageFragment *frag,
                        const parquet_column_device_view *col_desc,
+                       const uint32_t *fragment_starts,
                        int32_t num_fragments,
-                       int32_t num_columns,
-                       uint32_t fragment_size,
-                       uint32_t max_num_rows)
+                       int32_t num_columns)
 {
   __shared__ __align__(16) frag_init_state_s state_g;
 
@@ -139,11 +152,11 @@ __global__ void __launch_bounds__(block_size)
     if (i + t < sizeof(s->map) / sizeof(uint32_t)) s->map.u32[i + t] = 0;
   }
   __syncthreads();
-  start_row = blockIdx.y * fragment_size;
+  start_row = fragment_starts[blockIdx.y];
   if (!t) {
-    // frag.num_rows = fragment_size except for the last page fragment which can be smaller.
-    // num_rows is fixed but fragment size could be larger if the data is strings or nested.
-    s->frag.num_rows           = min(fragment_size, max_num_rows - min(start_row, max_num_rows));
+    // Fragments have a fixed number of rows, except for the last fragment of each partition which
+    // can be smaller. The fragment size could be larger if the data is strings or nested.
+    s->frag.num_rows           = fragment_starts[blockIdx.y + 1] - start_row;
     s->frag.non_nulls          = 0;
     s->frag.num_dict_vals      = 0;
     s->frag.fragment_data_size = 0;
@@ -411,7 +424,8 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
                                                     statistics_merge_group *page_grstats,
                                                     statistics_merge_group *chunk_grstats,
                                                     int32_t num_rowgroups,
-                                                    int32_t num_columns)
+                                                    int32_t num_columns,
+                                                    uint32_t target_page_size)
 {
   __shared__ __align__(8) parquet_column_device_view col_g;
   __shared__ __align__(8) EncColumnChunk ck_g;
@@ -500,9 +514,9 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
         fragment_data_size = frag_g.fragment_data_size;
       }
       // TODO (dm): this convoluted logic to limit page size needs refactoring
-      max_page_size = (values_in_page * 2 >= ck_g.num_values)
-                        ? 256 * 1024
-                        : (values_in_page * 3 >= ck_g.num_values) ? 384 * 1024 : 512 * 1024;
+      max_page_size = (values_in_page * 2 >= ck_g.num_values)   ? target_page_size / 2
+                      : (values_in_page * 3 >= ck_g.num_values) ? target_page_size / 4 * 3
+                                                                : target_page_size;
       if (num_rows >= ck_g.num_rows ||
           (values_in_page > 0 &&
            (page_size + fragment_data_size > max_page_size ||
@@ -528,6 +542,10 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
           dict_bits_plus1 = dict_bits + 1;
         } else {
           dict_bits_plus1 = 0;
+          if (col_g.encoding == Encoding::DELTA_BINARY_PACKED) {
+            // Page header, padding of the last miniblock and min_delta + bit widths per block
+            page_size += 25 + 256 + 14 * ((leaf_values_in_page + delta_block_size - 1) >> 7);
+          }
         }
         if (!t) {
           page_g.num_fragments   = fragments_in_chunk - page_start;
@@ -638,6 +656,19 @@ inline __device__ uint8_t *VlqEncode(uint8_t *p, uint32_t v)
   return p;
 }
 
+/**
+ * @brief Variable-length encode a 64-bit integer
+ */
+inline __device__ uint8_t *VlqEncode64(uint8_t *p, uint64_t v)
+{
+  while (v > 0x7f) {
+    *p++ = (v | 0x80);
+    v >>= 7;
+  }
+  *p++ = v;
+  return p;
+}
+
 /**
  * @brief Pack literal values in output bitstream (1,2,4,8,12 or 16 bits per value)
  */
@@ -893,6 +924,117 @@ static __device__ void PlainBoolEncode(page_enc_state_s *s,
   }
 }
 
+/**
+ * @brief Zigzag-encode a signed integer
+ */
+inline __device__ uint64_t ZigZagEncode(int64_t v)
+{
+  return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+}
+
+/**
+ * @brief Write the DELTA_BINARY_PACKED page header
+ *
+ * @param[in] p Output pointer
+ * @param[in] num_values Total count of encoded values
+ * @param[in] first_value First value of the page
+ *
+ * @return Pointer past the header
+ */
+inline __device__ uint8_t *DeltaEncodeHeader(uint8_t *p, uint32_t num_values, int64_t first_value)
+{
+  p = VlqEncode(p, delta_block_size);
+  p = VlqEncode(p, delta_num_miniblocks);
+  p = VlqEncode(p, num_values);
+  return VlqEncode64(p, ZigZagEncode(first_value));
+}
+
+/**
+ * @brief DELTA_BINARY_PACKED block encoder
+ *
+ * Encodes the first `numvals` buffered values as one block at `s->cur`. Each warp computes the
+ * bit width of its miniblock; miniblocks holding no values are given a zero width and no body.
+ *
+ * @param[in,out] s Page encode state
+ * @param[in] numvals Count of buffered values in the block (1..128)
+ * @param[in] is_int32 true if deltas wrap around as 32-bit integers
+ * @param[in] t thread id (0..127)
+ */
+static __device__ void DeltaEncodeBlock(page_enc_state_s *s,
+                                        uint32_t numvals,
+                                        bool is_int32,
+                                        uint32_t t)
+{
+  uint32_t const lane = t & 0x1f;
+  uint32_t const mb   = t >> 5;
+  int64_t delta       = 0;
+  if (t < numvals) {
+    int64_t const prev = (t == 0) ? s->delta_prev : s->delta_buf[t - 1];
+    int64_t const cur  = s->delta_buf[t];
+    if (is_int32) {
+      delta = static_cast<int32_t>(static_cast<uint32_t>(cur) - static_cast<uint32_t>(prev));
+    } else {
+      delta = static_cast<int64_t>(static_cast<uint64_t>(cur) - static_cast<uint64_t>(prev));
+    }
+  }
+  int64_t min_delta = (t < numvals) ? delta : std::numeric_limits<int64_t>::max();
+  for (uint32_t i = 1; i < 32; i <<= 1) {
+    min_delta = min(min_delta, shuffle_xor(min_delta, i));
+  }
+  if (lane == 0) { s->delta_min[mb] = min_delta; }
+  s->delta_bits[t]                    = 0;
+  s->delta_bits[t + delta_block_size] = 0;
+  __syncthreads();
+  min_delta = min(min(s->delta_min[0], s->delta_min[1]), min(s->delta_min[2], s->delta_min[3]));
+  uint64_t rel = 0;
+  if (t < numvals) {
+    rel = (is_int32) ? static_cast<uint32_t>(delta - min_delta)
+                     : static_cast<uint64_t>(delta) - static_cast<uint64_t>(min_delta);
+  }
+  uint64_t const rel_or = WarpReduceOr32(rel);
+  uint32_t const width  = (rel_or != 0) ? 64 - __clzll(rel_or) : 0;
+  if (lane == 0) { s->delta_widths[mb] = width; }
+  __syncthreads();
+  uint32_t mb_bits = 0;
+  for (uint32_t i = 0; i < mb; i++) {
+    mb_bits += s->delta_widths[i] * 32;
+  }
+  if (width != 0) {
+    uint32_t const bit   = mb_bits + lane * width;
+    uint32_t const word  = bit >> 5;
+    uint32_t const shift = bit & 0x1f;
+    atomicOr(&s->delta_bits[word], static_cast<uint32_t>(rel << shift));
+    if (shift + width > 32) {
+      atomicOr(&s->delta_bits[word + 1], static_cast<uint32_t>(rel >> (32 - shift)));
+    }
+    if (shift + width > 64) {
+      atomicOr(&s->delta_bits[word + 2], static_cast<uint32_t>(rel >> (64 - shift)));
+    }
+  }
+  if (t == 0) {
+    uint8_t *dst = VlqEncode64(s->cur, ZigZagEncode(min_delta));
+    for (uint32_t i = 0; i < delta_num_miniblocks; i++) {
+      dst[i] = s->delta_widths[i];
+    }
+    s->rle_out = dst + delta_num_miniblocks;
+  }
+  __syncthreads();
+  uint8_t *dst        = s->rle_out;
+  uint32_t body_bytes = 0;
+  for (uint32_t i = 0; i < delta_num_miniblocks; i++) {
+    body_bytes += s->delta_widths[i] * 4;
+  }
+  for (uint32_t i = t; i < body_bytes; i += delta_block_size) {
+    dst[i] = s->delta_bits[i >> 2] >> ((i & 3) * 8);
+  }
+  __syncthreads();
+  if (t == 0) {
+    s->cur        = dst + body_bytes;
+    s->delta_prev = s->delta_buf[numvals - 1];
+  }
+  __syncthreads();
+}
+
 constexpr auto julian_calendar_epoch_diff()
 {
   using namespace cuda::std::chrono;
@@ -920,6 +1062,29 @@ convert_nanoseconds(cuda::std::chrono::sys_time<cuda::std::chrono::nanoseconds>
   return {last_day_ticks, julian_days};
 }
 
+/**
+ * @brief Returns an INT32 or INT64 leaf value as written to the page, with timestamps rescaled
+ */
+inline __device__ int64_t GetIntegerValue(parquet_column_device_view const &col,
+                                          uint32_t dtype_len_in,
+                                          size_type val_idx)
+{
+  if (col.physical_type == INT32) {
+    if (dtype_len_in == 4) { return col.leaf_column->element<int32_t>(val_idx); }
+    if (dtype_len_in == 2) { return col.leaf_column->element<int16_t>(val_idx); }
+    return col.leaf_column->element<int8_t>(val_idx);
+  }
+  int64_t v = col.leaf_column->element<int64_t>(val_idx);
+  if (col.ts_scale != 0) {
+    if (col.ts_scale < 0) {
+      v /= -col.ts_scale;
+    } else {
+      v *= col.ts_scale;
+    }
+  }
+  return v;
+}
+
 // blockDim(128, 1, 1)
 template <int block_size>
 __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
@@ -1064,12 +1229,17 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
     dtype_len_in = dtype_len_out;
   }
   dict_bits = (dtype == BOOLEAN) ? 1 : (s->page.dict_bits_plus1 - 1);
+  Encoding const encoding = (s->page.page_type == PageType::DICTIONARY_PAGE || dict_bits >= 0)
+                              ? Encoding::PLAIN
+                              : s->col.encoding;
   if (t == 0) {
     uint8_t *dst   = s->cur;
     s->rle_run     = 0;
     s->rle_pos     = 0;
     s->rle_numvals = 0;
     s->rle_out     = dst;
+    s->enc_count   = 0;
+    s->delta_count = 0;
     if (dict_bits >= 0 && dtype != BOOLEAN) {
       dst[0]     = dict_bits;
       s->rle_out = dst + 1;
@@ -1092,6 +1262,20 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
     }
   }
   __syncthreads();
+  // DELTA_BINARY_PACKED and BYTE_STREAM_SPLIT both need the count of non-null values upfront
+  uint32_t num_valid = 0;
+  if (encoding != Encoding::PLAIN) {
+    for (uint32_t i = 0; i < s->page.num_leaf_values; i += block_size) {
+      uint32_t const val_idx = s->page_start_val + i + t;
+      num_valid += __syncthreads_count(val_idx < s->col.leaf_column->size() &&
+                                       i + t < s->page.num_leaf_values &&
+                                       s->col.leaf_column->is_valid(val_idx));
+    }
+    if (t == 0 && encoding == Encoding::DELTA_BINARY_PACKED && num_valid == 0) {
+      s->cur = DeltaEncodeHeader(s->cur, 0, 0);
+    }
+    __syncthreads();
+  }
   for (uint32_t cur_val_idx = 0; cur_val_idx < s->page.num_leaf_values;) {
     uint32_t nvals   = min(s->page.num_leaf_values - cur_val_idx, 128);
     uint32_t val_idx = s->page_start_val + cur_val_idx + t;
@@ -1133,6 +1317,58 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
       }
       if (t == 0) { s->cur = s->rle_out; }
       __syncthreads();
+    } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+      uint32_t num_valid_in_block;
+      block_scan(temp_storage).ExclusiveSum(is_valid, pos, num_valid_in_block);
+      uint32_t const enc_count = s->enc_count;
+      if (is_valid) {
+        int64_t const v = GetIntegerValue(s->col, dtype_len_in, val_idx);
+        if (enc_count + pos == 0) {
+          // The first value of the page goes in the header
+          s->delta_prev = v;
+          s->cur        = DeltaEncodeHeader(s->cur, num_valid, v);
+        } else {
+          s->delta_buf[s->delta_count + pos - (enc_count == 0)] = v;
+        }
+      }
+      __syncthreads();
+      if (t == 0) {
+        s->enc_count += num_valid_in_block;
+        s->delta_count += num_valid_in_block - (enc_count == 0 && num_valid_in_block != 0);
+      }
+      __syncthreads();
+      while (s->delta_count >= delta_block_size ||
+             (cur_val_idx == s->page.num_leaf_values && s->delta_count != 0)) {
+        uint32_t const numvals = min(s->delta_count, delta_block_size);
+        uint32_t const numleft = s->delta_count - numvals;
+        DeltaEncodeBlock(s, numvals, dtype == INT32, t);
+        if (t < numleft) { s->delta_buf[t] = s->delta_buf[numvals + t]; }
+        __syncthreads();
+        if (t == 0) { s->delta_count = numleft; }
+        __syncthreads();
+      }
+    } else if (encoding == Encoding::BYTE_STREAM_SPLIT) {
+      // Byte k of the i-th value goes to stream k at offset i; s->cur stays at the first stream
+      uint32_t num_valid_in_block;
+      block_scan(temp_storage).ExclusiveSum(is_valid, pos, num_valid_in_block);
+      if (is_valid) {
+        uint8_t *dst = s->cur + s->enc_count + pos;
+        if (dtype == FLOAT) {
+          uint32_t const v = __float_as_uint(s->col.leaf_column->element<float>(val_idx));
+          for (uint32_t k = 0; k < 4; k++) {
+            dst[k * num_valid] = v >> (k * 8);
+          }
+        } else {
+          auto const v = static_cast<uint64_t>(
+            __double_as_longlong(s->col.leaf_column->element<double>(val_idx)));
+          for (uint32_t k = 0; k < 8; k++) {
+            dst[k * num_valid] = v >> (k * 8);
+          }
+        }
+      }
+      __syncthreads();
+      if (t == 0) { s->enc_count += num_valid_in_block; }
+      __syncthreads();
     } else {
       // Non-dictionary encoding
       uint8_t *dst = s->cur;
@@ -1247,6 +1483,7 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
     }
   }
   if (t == 0) {
+    if (encoding == Encoding::BYTE_STREAM_SPLIT) { s->cur += num_valid * dtype_len_out; }
     uint8_t *base                = s->page.page_data + s->page.max_hdr_size;
     uint32_t actual_data_size    = static_cast<uint32_t>(s->cur - base);
     uint32_t compressed_bfr_size = GetMaxCompressedBfrSize(actual_data_size);
@@ -1524,12 +1761,12 @@ __global__ void __launch_bounds__(128) gpuEncodePageHeaders(EncPage *pages,
       encoding = (col_g.physical_type != BOOLEAN)
                    ? (page_type == PageType::DICTIONARY_PAGE || page_g.dict_bits_plus1 != 0)
                        ? Encoding::PLAIN_DICTIONARY
-                       : Encoding::PLAIN
+                       : col_g.encoding
                    : Encoding::RLE;
     } else {
       encoding = (page_type == PageType::DICTIONARY_PAGE || page_g.dict_bits_plus1 != 0)
                    ? Encoding::PLAIN_DICTIONARY
-                   : Encoding::PLAIN;
+                   : col_g.encoding;
     }
     encoder.field_int32(1, page_type);
     encoder.field_int32(2, uncompressed_page_size);
@@ -1611,6 +1848,50 @@ __global__ void __launch_bounds__(1024) gpuGatherPages(EncColumnChunk *chunks, c
   }
 }
 
+// blockDim(128, 1, 1)
+__global__ void __launch_bounds__(128) gpuBuildBloomFilters(const EncColumnChunk *chunks)
+{
+  auto const &ck = chunks[blockIdx.x];
+  if (ck.bloom_filter == nullptr) { return; }
+
+  auto const &col         = *ck.col_desc;
+  auto const dtype_len_in = GetDtypeLogicalLen(col.leaf_column);
+  for (uint32_t i = threadIdx.x; i < ck.num_rows; i += blockDim.x) {
+    auto const val_idx = static_cast<size_type>(ck.start_row + i);
+    if (val_idx >= col.leaf_column->size() || !col.leaf_column->is_valid(val_idx)) { continue; }
+    // Hash the PLAIN encoding of the value, as written to the pages
+    uint64_t hash;
+    switch (col.physical_type) {
+      case INT32: {
+        auto const v = static_cast<int32_t>(GetIntegerValue(col, dtype_len_in, val_idx));
+        hash         = XxHash64(reinterpret_cast<uint8_t const *>(&v), sizeof(v));
+      } break;
+      case INT64: {
+        auto const v = GetIntegerValue(col, dtype_len_in, val_idx);
+        hash         = XxHash64(reinterpret_cast<uint8_t const *>(&v), sizeof(v));
+      } break;
+      case FLOAT: {
+        auto const v = col.leaf_column->element<uint32_t>(val_idx);
+        hash         = XxHash64(reinterpret_cast<uint8_t const *>(&v), sizeof(v));
+      } break;
+      case DOUBLE: {
+        auto const v = col.leaf_column->element<uint64_t>(val_idx);
+        hash         = XxHash64(reinterpret_cast<uint8_t const *>(&v), sizeof(v));
+      } break;
+      case BYTE_ARRAY: {
+        auto const str = col.leaf_column->element<string_view>(val_idx);
+        hash           = XxHash64(reinterpret_cast<uint8_t const *>(str.data()), str.size_bytes());
+      } break;
+      default: return;
+    }
+    auto const block =
+      ck.bloom_filter + BloomFilterBlock(hash, ck.bloom_num_blocks) * bloom_filter_block_words;
+    for (uint32_t w = 0; w < bloom_filter_block_words; w++) {
+      atomicOr(block + w, BloomFilterMask(hash, w));
+    }
+  }
+}
+
 /**
  * @brief Functor to get definition level value for a nested struct column until the leaf level or
  * the first list level.
@@ -2086,21 +2367,21 @@ dremel_data get_dremel_data(column_view h_col,
  *
  * @param[in,out] frag Fragment array [column_id][fragment_id]
  * @param[in] col_desc Column description array [column_id]
+ * @param[in] fragment_starts First row of each fragment, followed by the number of rows
  * @param[in] num_fragments Number of fragments per column
  * @param[in] num_columns Number of columns
  * @param[in] stream CUDA stream to use, default 0
  */
 void InitPageFragments(PageFragment *frag,
                        const parquet_column_device_view *col_desc,
+                       const uint32_t *fragment_starts,
                        int32_t num_fragments,
                        int32_t num_columns,
-                       uint32_t fragment_size,
-                       uint32_t num_rows,
                        rmm::cuda_stream_view stream)
 {
   dim3 dim_grid(num_columns, num_fragments);  // 1 threadblock per fragment
   gpuInitPageFragments<512><<<dim_grid, 512, 0, stream.value()>>>(
-    frag, col_desc, num_fragments, num_columns, fragment_size, num_rows);
+    frag, col_desc, fragment_starts, num_fragments, num_columns);
 }
 
 /**
@@ -2144,13 +2425,20 @@ void InitEncoderPages(EncColumnChunk *chunks,
                       const parquet_column_device_view *col_desc,
                       int32_t num_rowgroups,
                       int32_t num_columns,
+                      uint32_t max_page_size,
                       statistics_merge_group *page_grstats,
                       statistics_merge_group *chunk_grstats,
                       rmm::cuda_stream_view stream)
 {
   dim3 dim_grid(num_columns, num_rowgroups);  // 1 threadblock per rowgroup
-  gpuInitPages<<<dim_grid, 128, 0, stream.value()>>>(
-    chunks, pages, col_desc, page_grstats, chunk_grstats, num_rowgroups, num_columns);
+  gpuInitPages<<<dim_grid, 128, 0, stream.value()>>>(chunks,
+                                                     pages,
+                                                     col_desc,
+                                                     page_grstats,
+                                                     chunk_grstats,
+                                                     num_rowgroups,
+                                                     num_columns,
+                                                     max_page_size);
 }
 
 /**
@@ -2239,6 +2527,20 @@ void GatherPages(EncColumnChunk *chunks,
   gpuGatherPages<<<num_chunks, 1024, 0, stream.value()>>>(chunks, pages);
 }
 
+/**
+ * @brief Launches kernel to insert the values of each column chunk into its bloom filter
+ *
+ * @param[in] chunks Column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[in] stream CUDA stream to use, default 0
+ */
+void BuildBloomFilters(EncColumnChunk const *chunks,
+                       uint32_t num_chunks,
+                       rmm::cuda_stream_view stream)
+{
+  gpuBuildBloomFilters<<<num_chunks, 128, 0, stream.value()>>>(chunks);
+}
+
 }  // namespace gpu
 }  // namespace parquet
 }  // namespace io
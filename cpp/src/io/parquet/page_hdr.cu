@@ -306,11 +306,15 @@ struct gpuParseDictionaryPageHeader {
 struct gpuParseDataPageHeaderV2 {
   __device__ bool operator()(byte_stream_s *bs)
   {
-    auto op = thrust::make_tuple(ParquetFieldInt32(1, bs->page.num_input_values),
-                                 ParquetFieldInt32(3, bs->page.num_rows),
-                                 ParquetFieldEnum<Encoding>(4, bs->page.encoding),
-                                 ParquetFieldEnum<Encoding>(5, bs->page.definition_level_encoding),
-                                 ParquetFieldEnum<Encoding>(6, bs->page.repetition_level_encoding));
+    auto op = thrust::make_tuple(
+      ParquetFieldInt32(1, bs->page.num_input_values),
+      ParquetFieldInt32(3, bs->page.num_rows),
+      ParquetFieldEnum<Encoding>(4, bs->page.encoding),
+      ParquetFieldInt32(5, bs->page.lvl_bytes[level_type::DEFINITION]),
+      ParquetFieldInt32(6, bs->page.lvl_bytes[level_type::REPETITION]));
+    // V2 pages always store levels with the RLE hybrid encoding and without a length prefix
+    bs->page.definition_level_encoding = Encoding::RLE;
+    bs->page.repetition_level_encoding = Encoding::RLE;
     return parse_header(op, bs);
   }
 };
@@ -365,7 +369,7 @@ extern "C" __global__ void __launch_bounds__(128)
       // they will be recomputed in the preprocess step by examining repetition and
       // definition levels
       bs->page.chunk_row = 0;
-      bs->page.num_rows  = 0;
+      bs->page.num_rows                          = 0;
     }
     num_values     = bs->ck.num_values;
     page_info      = bs->ck.page_info;
@@ -381,7 +385,11 @@ extern "C" __global__ void __launch_bounds__(128)
         // they will be recomputed in the preprocess step by examining repetition and
         // definition levels
         bs->page.chunk_row += bs->page.num_rows;
-        bs->page.num_rows = 0;
+        bs->page.num_rows                          = 0;
+        bs->page.lvl_bytes[level_type::DEFINITION] = 0;
+        bs->page.lvl_bytes[level_type::REPETITION] = 0;
+        bs->page.str_data                          = nullptr;
+        bs->page.str_bytes                         = 0;
         if (parse_page_header(bs) && bs->page.compressed_page_size >= 0) {
           switch (bs->page_type) {
             case PageType::DATA_PAGE:
@@ -392,7 +400,7 @@ extern "C" __global__ void __launch_bounds__(128)
             case PageType::DATA_PAGE_V2:
               index_out = num_dict_pages + data_page_count;
               data_page_count++;
-              bs->page.flags = 0;
+              bs->page.flags = (bs->page_type == PageType::DATA_PAGE_V2) ? PAGEINFO_FLAGS_V2 : 0;
               values_found += bs->page.num_input_values;
               break;
             case PageType::DICTIONARY_PAGE:
@@ -207,6 +207,22 @@ struct SchemaElement {
   }
 };
 
+/**
+ * @brief Thrift-derived struct describing column chunk statistics
+ *
+ * Values are PLAIN-encoded according to the physical type of the column. The deprecated `min` and
+ * `max` fields use signed comparison order; `min_value` and `max_value` use the sort order of the
+ * logical type and take precedence whenever present.
+ */
+struct Statistics {
+  std::vector<uint8_t> max;        // deprecated max value in signed comparison order
+  std::vector<uint8_t> min;        // deprecated min value in signed comparison order
+  int64_t null_count     = -1;     // count of null values in the column chunk
+  int64_t distinct_count = -1;     // count of distinct values in the column chunk
+  std::vector<uint8_t> max_value;  // max value of the column chunk
+  std::vector<uint8_t> min_value;  // min value of the column chunk
+};
+
 /**
  * @brief Thrift-derived struct describing a column chunk
  */
@@ -225,6 +241,8 @@ struct ColumnChunkMetaData {
   int64_t dictionary_page_offset =
     0;  // Byte offset from the beginning of file to first (only) dictionary page
   std::vector<uint8_t> statistics_blob;  // Encoded chunk-level statistics as binary blob
+  int64_t bloom_filter_offset = 0;       // File offset of the bloom filter header, if any
+  int32_t bloom_filter_length = 0;       // Size of the bloom filter header and bitset, in bytes
 };
 
 /**
@@ -293,6 +311,7 @@ struct DataPageHeader {
   Encoding encoding                  = Encoding::PLAIN;  // Encoding used for this data page
   Encoding definition_level_encoding = Encoding::PLAIN;  // Encoding used for definition levels
   Encoding repetition_level_encoding = Encoding::PLAIN;  // Encoding used for repetition levels
+  Statistics statistics;                                 // Optional statistics for the page
 };
 
 /**
@@ -303,6 +322,16 @@ struct DictionaryPageHeader {
   Encoding encoding  = Encoding::PLAIN;  // Encoding using this dictionary page
 };
 
+/**
+ * @brief Thrift-derived struct describing the header for a V2 data page
+ */
+struct DataPageHeaderV2 {
+  int32_t num_values = 0;                // Number of values, including NULLs, in this data page.
+  int32_t num_nulls  = 0;                // Number of NULL values in this data page
+  int32_t num_rows   = 0;                // Number of rows in this data page
+  Encoding encoding  = Encoding::PLAIN;  // Encoding used for this data page
+};
+
 /**
  * @brief Thrift-derived struct describing the page header
  *
@@ -319,6 +348,83 @@ struct PageHeader {
   int32_t compressed_page_size   = 0;  // Compressed page size in bytes (not including the header)
   DataPageHeader data_page_header;
   DictionaryPageHeader dictionary_page_header;
+  DataPageHeaderV2 data_page_header_v2;
+};
+
+/**
+ * @brief Thrift-derived struct describing the location of a data page in the file
+ */
+struct PageLocation {
+  int64_t offset               = 0;  // File offset of the page header
+  int32_t compressed_page_size = 0;  // Size of the page, including the header, in bytes
+  int64_t first_row_index      = 0;  // Index of the first row of the page in the row group
+};
+
+/**
+ * @brief Thrift-derived struct describing the page locations of a column chunk
+ *
+ * Part of the page index, stored between the last row group and the footer.
+ */
+struct OffsetIndex {
+  std::vector<PageLocation> page_locations;
+};
+
+/**
+ * @brief Thrift-derived struct describing the per-page statistics of a column chunk
+ *
+ * Part of the page index. One entry per data page in the order of the OffsetIndex; min and max
+ * values of pages that only contain nulls are empty.
+ */
+struct ColumnIndex {
+  std::vector<bool> null_pages;                  // true for pages that only contain nulls
+  std::vector<std::vector<uint8_t>> min_values;  // PLAIN-encoded min value of each page
+  std::vector<std::vector<uint8_t>> max_values;  // PLAIN-encoded max value of each page
+  BoundaryOrder boundary_order = UNORDERED;      // ordering of the min/max values across pages
+  std::vector<int64_t> null_counts;              // optional count of nulls in each page
+};
+
+// Members of the bloom filter header unions; the format defines exactly one of each
+struct SplitBlockAlgorithm {
+};
+struct XxHash {
+};
+struct BloomFilterUncompressed {
+};
+
+/**
+ * @brief Thrift-derived union of the bloom filter algorithms
+ */
+struct BloomFilterAlgorithm {
+  bool isset_BLOCK = false;
+  SplitBlockAlgorithm BLOCK;
+};
+
+/**
+ * @brief Thrift-derived union of the hash functions applied to the values of a bloom filter
+ */
+struct BloomFilterHash {
+  bool isset_XXHASH = false;
+  XxHash XXHASH;
+};
+
+/**
+ * @brief Thrift-derived union of the bloom filter compression codecs
+ */
+struct BloomFilterCompression {
+  bool isset_UNCOMPRESSED = false;
+  BloomFilterUncompressed UNCOMPRESSED;
+};
+
+/**
+ * @brief Thrift-derived struct describing a bloom filter
+ *
+ * The header is immediately followed by the `num_bytes` bytes of the filter bitset.
+ */
+struct BloomFilterHeader {
+  int32_t num_bytes = 0;  // Size of the bitset, in bytes
+  BloomFilterAlgorithm algorithm;
+  BloomFilterHash hash;
+  BloomFilterCompression compression;
 };
 
 /**
@@ -426,7 +532,16 @@ class CompactProtocolReader {
   bool read(PageHeader *p);
   bool read(DataPageHeader *d);
   bool read(DictionaryPageHeader *d);
+  bool read(DataPageHeaderV2 *d);
   bool read(KeyValue *k);
+  bool read(Statistics *s);
+  bool read(PageLocation *p);
+  bool read(OffsetIndex *o);
+  bool read(ColumnIndex *c);
+  bool read(BloomFilterAlgorithm *a);
+  bool read(BloomFilterHash *h);
+  bool read(BloomFilterCompression *c);
+  bool read(BloomFilterHeader *b);
 
  public:
   static int NumRequiredBits(uint32_t max_level) noexcept
@@ -454,6 +569,7 @@ class CompactProtocolReader {
   template <typename T>
   friend class ParquetFieldStructListFunctor;
   friend class ParquetFieldString;
+  friend class ParquetFieldBinary;
   template <typename T>
   friend class ParquetFieldStructFunctor;
   template <typename T, bool>
@@ -464,6 +580,9 @@ class CompactProtocolReader {
   friend class ParquetFieldEnumListFunctor;
   friend class ParquetFieldStringList;
   friend class ParquetFieldStructBlob;
+  friend class ParquetFieldBoolList;
+  friend class ParquetFieldInt64List;
+  friend class ParquetFieldBinaryList;
 };
 
 /**
@@ -618,6 +737,35 @@ class ParquetFieldString {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to read a binary blob from CompactProtocolReader
+ *
+ * @return True if field type mismatches or if size of the blob exceeds bounds
+ * of the CompactProtocolReader
+ */
+class ParquetFieldBinary {
+  int field_val;
+  std::vector<uint8_t> &val;
+
+ public:
+  ParquetFieldBinary(int f, std::vector<uint8_t> &v) : field_val(f), val(v) {}
+
+  inline bool operator()(CompactProtocolReader *cpr, int field_type)
+  {
+    if (field_type != ST_FLD_BINARY) return true;
+    uint32_t n = cpr->get_u32();
+    if (n <= (size_t)(cpr->m_end - cpr->m_cur)) {
+      val.assign(cpr->m_cur, cpr->m_cur + n);
+      cpr->m_cur += n;
+      return false;
+    } else {
+      return true;
+    }
+  }
+
+  int field() { return field_val; }
+};
+
 /**
  * @brief Functor to read a structure from CompactProtocolReader
  *
@@ -794,6 +942,92 @@ class ParquetFieldStringList {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to read a vector of bools from CompactProtocolReader
+ *
+ * @return True if field types mismatch
+ */
+class ParquetFieldBoolList {
+  int field_val;
+  std::vector<bool> &val;
+
+ public:
+  ParquetFieldBoolList(int f, std::vector<bool> &v) : field_val(f), val(v) {}
+  inline bool operator()(CompactProtocolReader *cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_TRUE && (current_byte & 0xf) != ST_FLD_FALSE) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) { val[i] = (cpr->getb() == ST_FLD_TRUE); }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
+/**
+ * @brief Functor to read a vector of 64 bit integers from CompactProtocolReader
+ *
+ * @return True if field types mismatch
+ */
+class ParquetFieldInt64List {
+  int field_val;
+  std::vector<int64_t> &val;
+
+ public:
+  ParquetFieldInt64List(int f, std::vector<int64_t> &v) : field_val(f), val(v) {}
+  inline bool operator()(CompactProtocolReader *cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) < ST_FLD_I16 || (current_byte & 0xf) > ST_FLD_I64) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) { val[i] = cpr->get_i64(); }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
+/**
+ * @brief Functor to read a vector of binary blobs from CompactProtocolReader
+ *
+ * @return True if field types mismatch or if the size of a blob exceeds bounds of the
+ * CompactProtocolReader
+ */
+class ParquetFieldBinaryList {
+  int field_val;
+  std::vector<std::vector<uint8_t>> &val;
+
+ public:
+  ParquetFieldBinaryList(int f, std::vector<std::vector<uint8_t>> &v) : field_val(f), val(v) {}
+  inline bool operator()(CompactProtocolReader *cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_BINARY) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) {
+      uint32_t l = cpr->get_u32();
+      if (l <= (size_t)(cpr->m_end - cpr->m_cur)) {
+        val[i].assign(cpr->m_cur, cpr->m_cur + l);
+        cpr->m_cur += l;
+      } else
+        return true;
+    }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
 /**
  * @brief Functor to read a struct from CompactProtocolReader
  *
@@ -60,6 +60,7 @@ namespace gpu {
  */
 enum {
   PAGEINFO_FLAGS_DICTIONARY = (1 << 0),  // Indicates a dictionary page
+  PAGEINFO_FLAGS_V2         = (1 << 1),  // Indicates a V2 data page (uncompressed levels)
 };
 
 /**
@@ -122,6 +123,12 @@ struct PageInfo {
   Encoding encoding;       // Encoding for data or dictionary page
   Encoding definition_level_encoding;  // Encoding used for definition levels (data page)
   Encoding repetition_level_encoding;  // Encoding used for repetition levels (data page)
+  // size of the uncompressed definition/repetition level data (V2 data pages only)
+  int32_t lvl_bytes[level_type::NUM_LEVEL_TYPES];
+
+  // scratch memory for strings reconstructed from DELTA_BYTE_ARRAY-encoded data
+  uint8_t *str_data;
+  int32_t str_bytes;
 
   // for nested types, we run a preprocess step in order to determine output
   // column sizes. Because of this, we can jump directly to the position in the
@@ -239,6 +246,7 @@ struct parquet_column_device_view : stats_column_desc {
   uint8_t *nullability;  //!< Array of nullability of each nesting level. e.g. nullable[0] is
                          //!< nullability of parent_column. May be different from col.nullable() in
                          //!< case of chunked writing.
+  Encoding encoding;     //!< Encoding of the data pages that don't use the dictionary
 };
 
 constexpr int max_page_fragment_size = 5000;  //!< Max number of rows in a page fragment
@@ -298,11 +306,99 @@ inline uint32_t __device__ GetDtypeLogicalLen(column_device_view *col)
 
 /**
  * @brief Return worst-case compressed size of compressed data given the uncompressed size
+ *
+ * The per-page overhead leaves room for a gzip header and trailer.
  */
 inline size_t __device__ __host__ GetMaxCompressedBfrSize(size_t uncomp_size,
                                                           uint32_t num_pages = 1)
 {
-  return uncomp_size + (uncomp_size >> 7) + num_pages * 8;
+  return uncomp_size + (uncomp_size >> 7) + num_pages * 32;
+}
+
+/**
+ * @brief Computes the 64-bit xxHash (seed 0) of a byte range, the hash used by bloom filters
+ */
+inline uint64_t __device__ __host__ XxHash64(uint8_t const *data, size_t len)
+{
+  constexpr uint64_t p1 = 11400714785074694791ull;
+  constexpr uint64_t p2 = 14029467366897019727ull;
+  constexpr uint64_t p3 = 1609587929392839161ull;
+  constexpr uint64_t p4 = 9650029242287828579ull;
+  constexpr uint64_t p5 = 2870177450012600261ull;
+
+  auto rotl  = [](uint64_t x, int r) { return (x << r) | (x >> (64 - r)); };
+  auto load  = [](uint8_t const *p, int n) {
+    uint64_t v = 0;
+    for (int i = 0; i < n; i++) { v |= static_cast<uint64_t>(p[i]) << (8 * i); }
+    return v;
+  };
+  auto round = [&](uint64_t acc, uint64_t input) { return rotl(acc + input * p2, 31) * p1; };
+
+  uint8_t const *const end = data + len;
+  uint64_t h;
+  if (len >= 32) {
+    uint64_t v1 = p1 + p2;
+    uint64_t v2 = p2;
+    uint64_t v3 = 0;
+    uint64_t v4 = 0 - p1;
+    for (; data + 32 <= end; data += 32) {
+      v1 = round(v1, load(data, 8));
+      v2 = round(v2, load(data + 8, 8));
+      v3 = round(v3, load(data + 16, 8));
+      v4 = round(v4, load(data + 24, 8));
+    }
+    h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+    h = (h ^ round(0, v1)) * p1 + p4;
+    h = (h ^ round(0, v2)) * p1 + p4;
+    h = (h ^ round(0, v3)) * p1 + p4;
+    h = (h ^ round(0, v4)) * p1 + p4;
+  } else {
+    h = p5;
+  }
+  h += len;
+  for (; data + 8 <= end; data += 8) { h = rotl(h ^ round(0, load(data, 8)), 27) * p1 + p4; }
+  if (data + 4 <= end) {
+    h = rotl(h ^ (load(data, 4) * p1), 23) * p2 + p3;
+    data += 4;
+  }
+  for (; data < end; data++) { h = rotl(h ^ (*data * p5), 11) * p1; }
+  h ^= h >> 33;
+  h *= p2;
+  h ^= h >> 29;
+  h *= p3;
+  h ^= h >> 32;
+  return h;
+}
+
+// Split block bloom filters are made of 256-bit blocks of eight 32-bit words
+constexpr uint32_t bloom_filter_block_words = 8;
+constexpr size_t bloom_filter_max_bytes     = 128 * 1024 * 1024;
+
+/**
+ * @brief Returns the block of a split block bloom filter that holds a hash
+ */
+inline uint32_t __device__ __host__ BloomFilterBlock(uint64_t hash, uint32_t num_blocks)
+{
+  return static_cast<uint32_t>(((hash >> 32) * num_blocks) >> 32);
+}
+
+/**
+ * @brief Returns the bit set by a hash in a word of its split block bloom filter block
+ */
+inline uint32_t __device__ __host__ BloomFilterMask(uint64_t hash, uint32_t word)
+{
+  uint32_t salt = 0;
+  switch (word) {
+    case 0: salt = 0x47b6137bu; break;
+    case 1: salt = 0x44974d91u; break;
+    case 2: salt = 0x8824ad5bu; break;
+    case 3: salt = 0xa2b7289du; break;
+    case 4: salt = 0x705495c7u; break;
+    case 5: salt = 0x2df1424bu; break;
+    case 6: salt = 0x9efc4947u; break;
+    default: salt = 0x5c6bfb31u; break;
+  }
+  return 1u << ((static_cast<uint32_t>(hash) * salt) >> 27);
 }
 
 /**
@@ -329,6 +425,8 @@ struct EncColumnChunk {
   uint32_t dictionary_size;     //!< Size of dictionary
   uint32_t total_dict_entries;  //!< Total number of entries in dictionary
   uint32_t ck_stat_size;        //!< Size of chunk-level statistics (included in 1st page header)
+  uint32_t *bloom_filter;       //!< Bloom filter bitset, nullptr if the chunk has none
+  uint32_t bloom_num_blocks;    //!< Number of blocks in the bloom filter
 };
 
 /**
@@ -352,6 +450,20 @@ void BuildStringDictionaryIndex(ColumnChunkDesc *chunks,
                                 int32_t num_chunks,
                                 rmm::cuda_stream_view stream);
 
+/**
+ * @brief Launches kernel for computing the size of the strings reconstructed from
+ * DELTA_BYTE_ARRAY-encoded pages
+ *
+ * The result is stored in `PageInfo::str_bytes` and is zero for all other pages.
+ *
+ * @param[in,out] pages All pages to be decoded
+ * @param[in] chunks All chunks to be decoded
+ * @param[in] stream CUDA stream to use, default 0
+ */
+void ComputeDeltaStringSizes(hostdevice_vector<PageInfo> &pages,
+                             hostdevice_vector<ColumnChunkDesc> const &chunks,
+                             rmm::cuda_stream_view stream);
+
 /**
  * @brief Preprocess column information for nested schemas.
  *
@@ -440,18 +552,17 @@ dremel_data get_dremel_data(column_view h_col,
  *
  * @param[out] frag Fragment array [column_id][fragment_id]
  * @param[in] col_desc Column description array [column_id]
+ * @param[in] fragment_starts First row of each fragment, followed by the number of rows; the
+ * fragments of a partition never extend into the next one
  * @param[in] num_fragments Number of fragments per column
  * @param[in] num_columns Number of columns
- * @param[in] fragment_size Number of rows per fragment
- * @param[in] num_rows Number of rows per column
  * @param[in] stream CUDA stream to use, default 0
  */
 void InitPageFragments(PageFragment *frag,
                        const parquet_column_device_view *col_desc,
+                       const uint32_t *fragment_starts,
                        int32_t num_fragments,
                        int32_t num_columns,
-                       uint32_t fragment_size,
-                       uint32_t num_rows,
                        rmm::cuda_stream_view stream);
 
 /**
@@ -481,6 +592,7 @@ void InitFragmentStatistics(statistics_group *groups,
  * @param[in] col_desc Column description array [column_id]
  * @param[in] num_rowgroups Number of fragments per column
  * @param[in] num_columns Number of columns
+ * @param[in] max_page_size Target size in bytes of the uncompressed data pages
  * @param[in] page_grstats Setup for page-level stats
  * @param[in] chunk_grstats Setup for chunk-level stats
  * @param[in] stream CUDA stream to use, default 0
@@ -490,6 +602,7 @@ void InitEncoderPages(EncColumnChunk *chunks,
                       const parquet_column_device_view *col_desc,
                       int32_t num_rowgroups,
                       int32_t num_columns,
+                      uint32_t max_page_size,
                       statistics_merge_group *page_grstats  = nullptr,
                       statistics_merge_group *chunk_grstats = nullptr,
                       rmm::cuda_stream_view stream          = rmm::cuda_stream_default);
@@ -565,6 +678,19 @@ void GatherPages(EncColumnChunk *chunks,
                  uint32_t num_chunks,
                  rmm::cuda_stream_view stream);
 
+/**
+ * @brief Launches kernel to insert the values of each column chunk into its bloom filter
+ *
+ * The bloom filter bitsets must be zero-initialized. Chunks without a bloom filter are skipped.
+ *
+ * @param[in] chunks Column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[in] stream CUDA stream to use, default 0
+ */
+void BuildBloomFilters(EncColumnChunk const *chunks,
+                       uint32_t num_chunks,
+                       rmm::cuda_stream_view stream);
+
 /**
  * @brief Launches kernel for building chunk dictionaries
  *
@@ -572,12 +698,14 @@ void GatherPages(EncColumnChunk *chunks,
  * @param[in] dev_scratch Device scratch data (kDictScratchSize bytes per dictionary)
  * @param[in] scratch_size size of scratch data in bytes
  * @param[in] num_chunks Number of column chunks
+ * @param[in] max_dict_size Dictionary size in bytes past which no more fragments are added
  * @param[in] stream CUDA stream to use, default 0
  */
 void BuildChunkDictionaries(EncColumnChunk *chunks,
                             uint32_t *dev_scratch,
                             size_t scratch_size,
                             uint32_t num_chunks,
+                            uint32_t max_dict_size,
                             rmm::cuda_stream_view stream);
 
 }  // namespace gpu
@@ -22,20 +22,54 @@
 #include "reader_impl.hpp"
 
 #include <io/comp/gpuinflate.h>
-
+#include <io/utilities/batched_read.hpp>
+
+#include <cudf/ast/detail/transform.cuh>
+#include <cudf/ast/linearizer.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/io/memory_resource.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
+#include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/device_vector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
 
 #include <algorithm>
 #include <array>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <regex>
+#include <tuple>
+
+#include <sys/stat.h>
 
 namespace cudf {
 namespace io {
@@ -230,6 +264,422 @@ std::tuple<int32_t, int32_t, int8_t> conversion_info(type_id column_type_id,
   return std::make_tuple(type_width, clock_rate, converted_type);
 }
 
+/**
+ * @brief Converts a PLAIN-encoded statistics value to the output column type
+ *
+ * @return The decoded value, or an empty optional if the value is missing or malformed
+ */
+template <typename T>
+thrust::optional<T> decode_stats_value(std::vector<uint8_t> const &value, parquet::Type physical)
+{
+  auto convert = [](auto v) {
+    if constexpr (cudf::is_timestamp<T>()) {
+      return T{typename T::duration{static_cast<typename T::rep>(v)}};
+    } else if constexpr (cudf::is_duration<T>()) {
+      return T{static_cast<typename T::rep>(v)};
+    } else {
+      return static_cast<T>(v);
+    }
+  };
+  auto load = [&](auto v) -> thrust::optional<T> {
+    if (value.size() != sizeof(v)) { return thrust::nullopt; }
+    std::memcpy(&v, value.data(), sizeof(v));
+    return convert(v);
+  };
+  switch (physical) {
+    case parquet::BOOLEAN: return load(uint8_t{});
+    case parquet::INT32: return load(int32_t{});
+    case parquet::INT64: return load(int64_t{});
+    case parquet::FLOAT: return load(float{});
+    case parquet::DOUBLE: return load(double{});
+    default: return thrust::nullopt;
+  }
+}
+
+/**
+ * @brief Functor that builds the min and max statistics columns of one input column
+ */
+struct stats_columns_builder {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return cudf::is_numeric<T>() or cudf::is_chrono<T>();
+  }
+
+  template <typename T, std::enable_if_t<is_supported<T>()> * = nullptr>
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> operator()(
+    data_type dtype,
+    parquet::Type physical,
+    bool is_signed,
+    std::vector<Statistics> const &stats,
+    rmm::cuda_stream_view stream)
+  {
+    std::vector<T> min_values;
+    std::vector<T> max_values;
+    min_values.reserve(stats.size());
+    max_values.reserve(stats.size());
+    auto const unbounded = unbounded_stats_range<T>();
+    for (auto const &s : stats) {
+      // The deprecated fields use signed comparison order and are only valid for signed types
+      auto min_value = decode_stats_value<T>(s.min_value, physical);
+      auto max_value = decode_stats_value<T>(s.max_value, physical);
+      if (is_signed && (!min_value.has_value() || !max_value.has_value())) {
+        min_value = decode_stats_value<T>(s.min, physical);
+        max_value = decode_stats_value<T>(s.max, physical);
+      }
+      if (min_value.has_value() && max_value.has_value()) {
+        min_values.push_back(min_value.value());
+        max_values.push_back(max_value.value());
+      } else {
+        min_values.push_back(unbounded.first);
+        max_values.push_back(unbounded.second);
+      }
+    }
+    auto make_stats_column = [&](std::vector<T> const &values) {
+      auto d_values = cudf::detail::make_device_uvector_async(values, stream);
+      return std::make_unique<column>(
+        dtype, static_cast<size_type>(values.size()), d_values.release());
+    };
+    return {make_stats_column(min_values), make_stats_column(max_values)};
+  }
+
+  template <typename T, std::enable_if_t<!is_supported<T>()> * = nullptr>
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> operator()(
+    data_type, parquet::Type, bool, std::vector<Statistics> const &, rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Unsupported statistics column type");
+  }
+};
+
+/**
+ * @brief Reads and parses a page index structure (OffsetIndex or ColumnIndex) from a source
+ *
+ * @return The parsed structure, or an empty optional if it is missing or malformed
+ */
+template <typename T>
+thrust::optional<T> read_page_index(datasource &source, int64_t offset, int32_t length)
+{
+  if (offset <= 0 || length <= 0 || static_cast<size_t>(offset + length) > source.size()) {
+    return thrust::nullopt;
+  }
+  auto const buffer = source.host_read(offset, length);
+  CompactProtocolReader cp(buffer->data(), buffer->size());
+  T index;
+  if (!cp.read(&index)) { return thrust::nullopt; }
+  return index;
+}
+
+/**
+ * @brief Part of a column chunk that holds the pages overlapping a row window
+ */
+struct chunk_page_range {
+  std::pair<size_t, size_t> skip;  // Skipped bytes, as a pair of offset in the chunk and size
+  size_t read_size;                // Number of bytes to read from the chunk
+  int64_t first_row;               // First row of the first read page, relative to the row group
+};
+
+/**
+ * @brief Uses the offset index of a flat column chunk to select the pages overlapping the rows
+ * [first_row, last_row) of its row group
+ *
+ * The bytes ahead of the first data page (the dictionary page) are always read.
+ *
+ * @return The part of the chunk to read, or an empty optional if the whole chunk must be read
+ */
+thrust::optional<chunk_page_range> select_pages(thrust::optional<OffsetIndex> const &offset_index,
+                                                size_t chunk_offset,
+                                                size_t chunk_size,
+                                                int64_t first_row,
+                                                int64_t last_row)
+{
+  if (!offset_index.has_value() || offset_index->page_locations.empty() ||
+      offset_index->page_locations.front().first_row_index != 0) {
+    return thrust::nullopt;
+  }
+  auto const &locations = offset_index->page_locations;
+  // Only trust an index that describes pages in order and within the chunk
+  for (size_t p = 0; p < locations.size(); ++p) {
+    auto const &loc = locations[p];
+    if (loc.offset < static_cast<int64_t>(chunk_offset) || loc.compressed_page_size <= 0 ||
+        loc.offset + loc.compressed_page_size > static_cast<int64_t>(chunk_offset + chunk_size) ||
+        (p > 0 && (loc.offset < locations[p - 1].offset + locations[p - 1].compressed_page_size ||
+                   loc.first_row_index <= locations[p - 1].first_row_index))) {
+      return thrust::nullopt;
+    }
+  }
+  auto const by_first_row = [](auto const &loc, int64_t row) { return loc.first_row_index < row; };
+  auto const begin = std::prev(
+    std::lower_bound(locations.begin() + 1, locations.end(), first_row + 1, by_first_row));
+  auto const end = std::lower_bound(begin, locations.end(), last_row, by_first_row);
+  if (begin == locations.begin() && end == locations.end()) { return thrust::nullopt; }
+
+  auto const &last     = *std::prev(end);
+  auto const prefix    = static_cast<size_t>(locations.front().offset - chunk_offset);
+  auto const skip_size = static_cast<size_t>(begin->offset - locations.front().offset);
+  auto const read_end  = last.offset + last.compressed_page_size;
+  auto const span      = static_cast<size_t>(read_end - begin->offset);
+  return chunk_page_range{{prefix, skip_size}, prefix + span, begin->first_row_index};
+}
+
+/**
+ * @brief Sizes of the pages of a flat column chunk, read from the page headers
+ */
+struct chunk_page_sizes {
+  OffsetIndex offset_index;                // Location and first row of each data page
+  std::vector<size_t> uncompressed_sizes;  // Uncompressed size of each data page
+  size_t dict_compressed_size   = 0;       // Size of the pages ahead of the first data page
+  size_t dict_uncompressed_size = 0;       // Uncompressed size of the dictionary page
+  size_t dict_num_values        = 0;       // Number of entries of the dictionary page
+};
+
+/**
+ * @brief Walks the page headers of a flat column chunk, only reading the bytes of the headers
+ *
+ * The first row of each data page is the number of values of the data pages ahead of it.
+ *
+ * @return The sizes of the pages, or an empty optional if the headers are invalid or their
+ * values do not add up to `num_rows`
+ */
+thrust::optional<chunk_page_sizes> read_page_sizes(datasource &source,
+                                                   size_t chunk_offset,
+                                                   size_t chunk_size,
+                                                   int64_t num_rows)
+{
+  // Enough for the headers of most pages; longer headers (large statistics) are read again
+  constexpr size_t initial_header_read_size = 256;
+
+  chunk_page_sizes sizes;
+  auto const chunk_end = std::min(chunk_offset + chunk_size, source.size());
+  int64_t first_row    = 0;
+  for (auto offset = chunk_offset; offset < chunk_end;) {
+    PageHeader header;
+    size_t header_size = 0;
+    auto read_size     = std::min(initial_header_read_size, chunk_end - offset);
+    while (true) {
+      auto const buffer = source.host_read(offset, read_size);
+      CompactProtocolReader cp(buffer->data(), buffer->size());
+      header            = PageHeader{};
+      auto const parsed = cp.read(&header);
+      header_size       = cp.bytecount();
+      // A header that ends at the end of the buffer may be truncated
+      if (read_size == chunk_end - offset) {
+        if (!parsed) { return thrust::nullopt; }
+        break;
+      }
+      if (parsed && header_size < buffer->size()) { break; }
+      read_size = std::min(2 * read_size, chunk_end - offset);
+    }
+    auto const page_size = header_size + static_cast<size_t>(header.compressed_page_size);
+    if (header.compressed_page_size < 0 || header.uncompressed_page_size < 0 ||
+        offset + page_size > chunk_end) {
+      return thrust::nullopt;
+    }
+
+    if (header.type == PageType::DATA_PAGE || header.type == PageType::DATA_PAGE_V2) {
+      auto const num_values = (header.type == PageType::DATA_PAGE)
+                                ? header.data_page_header.num_values
+                                : header.data_page_header_v2.num_values;
+      if (num_values <= 0) { return thrust::nullopt; }
+      sizes.offset_index.page_locations.push_back(
+        {static_cast<int64_t>(offset), static_cast<int32_t>(page_size), first_row});
+      sizes.uncompressed_sizes.push_back(header.uncompressed_page_size);
+      first_row += num_values;
+    } else if (sizes.offset_index.page_locations.empty()) {
+      sizes.dict_compressed_size += page_size;
+      if (header.type == PageType::DICTIONARY_PAGE) {
+        sizes.dict_uncompressed_size += header.uncompressed_page_size;
+        sizes.dict_num_values += std::max(header.dictionary_page_header.num_values, 0);
+      }
+    }
+    offset += page_size;
+  }
+  if (sizes.offset_index.page_locations.empty() || first_row != num_rows) {
+    return thrust::nullopt;
+  }
+  return sizes;
+}
+
+/**
+ * @brief Functor that returns the PLAIN encoded bytes of an equality literal, as hashed into the
+ * bloom filter of a column with the given physical type
+ *
+ * Returns an empty vector when the literal cannot be probed: non-numeric literals, and 8 and 16-bit
+ * unsigned literals whose INT32 representation depends on the writer.
+ */
+struct bloom_filter_key_builder {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return std::is_floating_point<T>::value ||
+           (std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+            !(std::is_unsigned<T>::value && sizeof(T) < 4));
+  }
+
+  template <typename T, std::enable_if_t<is_supported<T>()> * = nullptr>
+  std::vector<uint8_t> operator()(ast::literal const &lit,
+                                  parquet::Type physical_type,
+                                  rmm::cuda_stream_view stream)
+  {
+    using plain_type = std::conditional_t<std::is_floating_point<T>::value,
+                                          T,
+                                          std::conditional_t<(sizeof(T) <= 4), int32_t, int64_t>>;
+    auto const expected_type = std::is_same<plain_type, float>::value     ? parquet::FLOAT
+                               : std::is_same<plain_type, double>::value  ? parquet::DOUBLE
+                               : std::is_same<plain_type, int32_t>::value ? parquet::INT32
+                                                                          : parquet::INT64;
+    if (physical_type != expected_type) { return {}; }
+
+    auto const &value = static_cast<numeric_scalar<T> const &>(lit.get_scalar());
+    auto const plain  = static_cast<plain_type>(value.value(stream));
+    std::vector<uint8_t> key(sizeof(plain));
+    std::memcpy(key.data(), &plain, sizeof(plain));
+    return key;
+  }
+
+  template <typename T, std::enable_if_t<!is_supported<T>()> * = nullptr>
+  std::vector<uint8_t> operator()(ast::literal const &, parquet::Type, rmm::cuda_stream_view)
+  {
+    return {};
+  }
+};
+
+/**
+ * @brief Reads the bitset of the bloom filter of a column chunk
+ *
+ * @return The bitset, or an empty optional if the chunk has no bloom filter this reader can probe
+ */
+thrust::optional<std::vector<uint8_t>> read_bloom_filter(datasource &source,
+                                                         ColumnChunkMetaData const &col_meta)
+{
+  if (col_meta.bloom_filter_offset <= 0 ||
+      static_cast<size_t>(col_meta.bloom_filter_offset) >= source.size()) {
+    return thrust::nullopt;
+  }
+  // Without a length, read enough for any header; the bitset is read separately
+  constexpr size_t max_header_size = 64;
+  auto const available = source.size() - col_meta.bloom_filter_offset;
+  auto const read_size = col_meta.bloom_filter_length > 0
+                           ? static_cast<size_t>(col_meta.bloom_filter_length)
+                           : std::min(max_header_size, available);
+  if (read_size > available) { return thrust::nullopt; }
+  auto const buffer = source.host_read(col_meta.bloom_filter_offset, read_size);
+
+  CompactProtocolReader cp(buffer->data(), buffer->size());
+  BloomFilterHeader header;
+  if (!cp.read(&header) || !header.algorithm.isset_BLOCK || !header.hash.isset_XXHASH ||
+      !header.compression.isset_UNCOMPRESSED || header.num_bytes <= 0 ||
+      header.num_bytes % (gpu::bloom_filter_block_words * sizeof(uint32_t)) != 0) {
+    return thrust::nullopt;
+  }
+  auto const header_size = static_cast<size_t>(cp.bytecount());
+  auto const num_bytes   = static_cast<size_t>(header.num_bytes);
+  if (col_meta.bloom_filter_length > 0) {
+    if (header_size + num_bytes > buffer->size()) { return thrust::nullopt; }
+    return std::vector<uint8_t>(buffer->data() + header_size,
+                                buffer->data() + header_size + num_bytes);
+  }
+  if (header_size + num_bytes > available) { return thrust::nullopt; }
+  auto const bitset = source.host_read(col_meta.bloom_filter_offset + header_size, num_bytes);
+  return std::vector<uint8_t>(bitset->data(), bitset->data() + bitset->size());
+}
+
+/**
+ * @brief Checks whether a value with the given hash may have been inserted into a bloom filter
+ */
+bool bloom_filter_may_contain(std::vector<uint8_t> const &bitset, uint64_t hash)
+{
+  constexpr auto block_size = gpu::bloom_filter_block_words * sizeof(uint32_t);
+  auto const num_blocks     = static_cast<uint32_t>(bitset.size() / block_size);
+  auto const block          = bitset.data() + gpu::BloomFilterBlock(hash, num_blocks) * block_size;
+  for (uint32_t w = 0; w < gpu::bloom_filter_block_words; ++w) {
+    uint32_t word;
+    std::memcpy(&word, block + w * sizeof(uint32_t), sizeof(word));
+    if ((word & gpu::BloomFilterMask(hash, w)) == 0) { return false; }
+  }
+  return true;
+}
+
+/**
+ * @brief Creates a dictionary column from string descriptors that all point to string dictionary
+ * entries
+ *
+ * @param strings Descriptors of the rows; null rows have a null pointer
+ * @param entries Descriptors of the dictionary entries the rows point to
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @return Dictionary column with UINT32 indices
+ */
+std::unique_ptr<column> make_dictionary_from_entries(
+  device_span<string_index_pair const> strings,
+  device_span<string_index_pair const> entries,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource *mr)
+{
+  // Sort and deduplicate the entries, which are few compared to the rows
+  auto const entry_strings = make_strings_column(entries, stream);
+  auto const encoded =
+    cudf::dictionary::detail::encode(entry_strings->view(), data_type{type_id::UINT32}, stream);
+  auto const encoded_view = dictionary_column_view(encoded->view());
+
+  // Order the entries by address, so that each row finds its entry by binary search
+  auto const num_entries = static_cast<size_type>(entries.size());
+  rmm::device_uvector<char const *> entry_ptrs(num_entries, stream);
+  rmm::device_uvector<uint32_t> entry_keys(num_entries, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    entries.begin(),
+                    entries.end(),
+                    entry_ptrs.begin(),
+                    [] __device__(string_index_pair const &entry) { return entry.first; });
+  thrust::copy(rmm::exec_policy(stream),
+               encoded_view.indices().begin<uint32_t>(),
+               encoded_view.indices().end<uint32_t>(),
+               entry_keys.begin());
+  thrust::sort_by_key(
+    rmm::exec_policy(stream), entry_ptrs.begin(), entry_ptrs.end(), entry_keys.begin());
+
+  auto indices = make_numeric_column(data_type{type_id::UINT32},
+                                     static_cast<size_type>(strings.size()),
+                                     mask_state::UNALLOCATED,
+                                     stream,
+                                     mr);
+  thrust::transform(
+    rmm::exec_policy(stream),
+    strings.begin(),
+    strings.end(),
+    indices->mutable_view().begin<uint32_t>(),
+    [ptrs = entry_ptrs.data(), keys = entry_keys.data(), num_entries] __device__(
+      string_index_pair const &str) {
+      if (str.first == nullptr || num_entries == 0) { return 0u; }
+      auto const it = thrust::lower_bound(thrust::seq, ptrs, ptrs + num_entries, str.first);
+      return (it != ptrs + num_entries && *it == str.first) ? keys[it - ptrs] : 0u;
+    });
+  auto null_mask = cudf::detail::valid_if(
+    strings.begin(),
+    strings.end(),
+    [] __device__(string_index_pair const &str) { return str.first != nullptr; },
+    stream,
+    mr);
+
+  auto keys = std::make_unique<column>(encoded_view.keys(), stream, mr);
+  return make_dictionary_column(
+    std::move(keys), std::move(indices), std::move(null_mask.first), null_mask.second);
+}
+
+/**
+ * @brief Returns the total size of the column chunks in `[begin, end)`, as read from the sources
+ */
+size_t total_compressed_size(hostdevice_vector<gpu::ColumnChunkDesc> const &chunks,
+                             size_t begin,
+                             size_t end)
+{
+  size_t size = 0;
+  for (auto c = begin; c < end; ++c) {
+    size += chunks[c].compressed_size;
+  }
+  return size;
+}
+
 }  // namespace
 
 std::string name_from_path(const std::vector<std::string> &path_in_schema)
@@ -289,6 +739,7 @@ struct metadata : public FileMetaData {
     CUDF_EXPECTS(ender->footer_len != 0 && ender->footer_len <= (len - header_len - ender_len),
                  "Incorrect footer length");
 
+    stage_range range{"parquet::parse_footer", ender->footer_len};
     const auto buffer = source->host_read(len - ender->footer_len - ender_len, ender->footer_len);
     CompactProtocolReader cp(buffer->data(), ender->footer_len);
     CUDF_EXPECTS(cp.read(this), "Cannot parse metadata");
@@ -296,24 +747,136 @@ struct metadata : public FileMetaData {
   }
 };
 
-class aggregate_metadata {
-  std::vector<metadata> const per_file_metadata;
-  std::map<std::string, std::string> const agg_keyval_map;
-  size_type const num_rows;
-  size_type const num_row_groups;
+}  // namespace parquet
+}  // namespace detail
+
+/**
+ * @brief Parsed footer shared by `parquet_metadata` handles and the footer cache
+ */
+struct parquet_metadata::impl : public detail::parquet::metadata {
+  using detail::parquet::metadata::metadata;
+};
+
+size_type parquet_metadata::num_rows() const { return _impl->num_rows; }
+
+size_type parquet_metadata::num_row_groups() const
+{
+  return static_cast<size_type>(_impl->row_groups.size());
+}
+
+namespace detail {
+namespace parquet {
+namespace {
+
+/**
+ * @brief Process-wide LRU cache of parsed footers, keyed by file path, size and modification time
+ */
+class metadata_cache {
+ public:
+  static metadata_cache &instance()
+  {
+    static metadata_cache cache;
+    return cache;
+  }
+
+  void set_capacity(std::size_t capacity)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _capacity = capacity;
+    evict();
+  }
+
   /**
-   * @brief Create a metadata object from each element in the source vector
+   * @brief Returns the cached footer of a file, parsing and caching it on a miss
    */
-  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const &sources)
+  std::shared_ptr<parquet_metadata::impl const> get(std::string const &path, datasource *source)
   {
-    std::vector<metadata> metadatas;
-    std::transform(
-      sources.cbegin(), sources.cend(), std::back_inserter(metadatas), [](auto const &source) {
-        return metadata(source.get());
-      });
-    return metadatas;
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) { return std::make_shared<parquet_metadata::impl>(source); }
+    auto const key = key_type{path,
+                              static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000 +
+                                st.st_mtim.tv_nsec,
+                              static_cast<size_t>(st.st_size)};
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_capacity == 0) { return std::make_shared<parquet_metadata::impl>(source); }
+      auto const it = _index.find(key);
+      if (it != _index.end()) {
+        _entries.splice(_entries.begin(), _entries, it->second);
+        return it->second->second;
+      }
+    }
+
+    // Parse without holding the lock; a concurrent miss on the same file keeps the first entry
+    auto footer = std::make_shared<parquet_metadata::impl const>(source);
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_capacity != 0 && _index.find(key) == _index.end()) {
+      _entries.emplace_front(key, footer);
+      _index.emplace(key, _entries.begin());
+      evict();
+    }
+    return footer;
   }
 
+ private:
+  using key_type = std::tuple<std::string, int64_t, size_t>;
+
+  void evict()
+  {
+    while (_entries.size() > _capacity) {
+      _index.erase(_entries.back().first);
+      _entries.pop_back();
+    }
+  }
+
+  std::mutex _mutex;
+  std::size_t _capacity = 0;
+  // Most recently used first
+  std::list<std::pair<key_type, std::shared_ptr<parquet_metadata::impl const>>> _entries;
+  std::map<key_type, decltype(_entries)::iterator> _index;
+};
+
+/**
+ * @brief Parses the footers of a set of sources, going through the footer cache for sources with
+ * a path
+ */
+std::vector<std::shared_ptr<parquet_metadata::impl const>> parse_footers(
+  std::vector<std::unique_ptr<datasource>> const &sources,
+  std::vector<std::string> const &filepaths)
+{
+  std::vector<std::shared_ptr<parquet_metadata::impl const>> footers;
+  footers.reserve(sources.size());
+  for (size_t i = 0; i < sources.size(); ++i) {
+    footers.push_back(i < filepaths.size()
+                        ? metadata_cache::instance().get(filepaths[i], sources[i].get())
+                        : std::make_shared<parquet_metadata::impl const>(sources[i].get()));
+  }
+  return footers;
+}
+
+}  // namespace
+
+std::vector<parquet_metadata> read_metadata(std::vector<std::unique_ptr<datasource>> const &sources,
+                                            std::vector<std::string> const &filepaths)
+{
+  auto const footers = parse_footers(sources, filepaths);
+  std::vector<parquet_metadata> metadata;
+  std::transform(footers.cbegin(), footers.cend(), std::back_inserter(metadata), [](auto const &f) {
+    return parquet_metadata{f};
+  });
+  return metadata;
+}
+
+void set_metadata_cache_size(std::size_t max_entries)
+{
+  metadata_cache::instance().set_capacity(max_entries);
+}
+
+class aggregate_metadata {
+  std::vector<std::shared_ptr<metadata const>> const per_file_metadata;
+  std::map<std::string, std::string> const agg_keyval_map;
+  size_type const num_rows;
+  size_type const num_row_groups;
   /**
    * @brief Merge the keyvalue maps from each per-file metadata object into a single map.
    */
@@ -322,7 +885,7 @@ class aggregate_metadata {
     std::map<std::string, std::string> merged;
     // merge key/value maps TODO: warn/throw if there are mismatches?
     for (auto const &pfm : per_file_metadata) {
-      for (auto const &kv : pfm.key_value_metadata) { merged[kv.key] = kv.value; }
+      for (auto const &kv : pfm->key_value_metadata) { merged[kv.key] = kv.value; }
     }
     return merged;
   }
@@ -334,7 +897,7 @@ class aggregate_metadata {
   {
     return std::accumulate(
       per_file_metadata.begin(), per_file_metadata.end(), 0, [](auto &sum, auto &pfm) {
-        return sum + pfm.num_rows;
+        return sum + pfm->num_rows;
       });
   }
 
@@ -345,13 +908,13 @@ class aggregate_metadata {
   {
     return std::accumulate(
       per_file_metadata.begin(), per_file_metadata.end(), 0, [](auto &sum, auto &pfm) {
-        return sum + pfm.row_groups.size();
+        return sum + pfm->row_groups.size();
       });
   }
 
  public:
-  aggregate_metadata(std::vector<std::unique_ptr<datasource>> const &sources)
-    : per_file_metadata(metadatas_from_sources(sources)),
+  aggregate_metadata(std::vector<std::shared_ptr<metadata const>> metadatas)
+    : per_file_metadata(std::move(metadatas)),
       agg_keyval_map(merge_keyval_metadata()),
       num_rows(calc_num_rows()),
       num_row_groups(calc_num_row_groups())
@@ -359,17 +922,17 @@ class aggregate_metadata {
     // Verify that the input files have matching numbers of columns
     size_type num_cols = -1;
     for (auto const &pfm : per_file_metadata) {
-      if (pfm.row_groups.size() != 0) {
+      if (pfm->row_groups.size() != 0) {
         if (num_cols == -1)
-          num_cols = pfm.row_groups[0].columns.size();
+          num_cols = pfm->row_groups[0].columns.size();
         else
-          CUDF_EXPECTS(num_cols == static_cast<size_type>(pfm.row_groups[0].columns.size()),
+          CUDF_EXPECTS(num_cols == static_cast<size_type>(pfm->row_groups[0].columns.size()),
                        "All sources must have the same number of columns");
       }
     }
     // Verify that the input files have matching schemas
     for (auto const &pfm : per_file_metadata) {
-      CUDF_EXPECTS(per_file_metadata[0].schema == pfm.schema,
+      CUDF_EXPECTS(per_file_metadata[0]->schema == pfm->schema,
                    "All sources must have the same schemas");
     }
   }
@@ -378,27 +941,32 @@ class aggregate_metadata {
   {
     CUDF_EXPECTS(src_idx >= 0 && src_idx < static_cast<size_type>(per_file_metadata.size()),
                  "invalid source index");
-    return per_file_metadata[src_idx].row_groups[row_group_index];
+    return per_file_metadata[src_idx]->row_groups[row_group_index];
   }
 
-  auto const &get_column_metadata(size_type row_group_index,
-                                  size_type src_idx,
-                                  int schema_idx) const
+  auto const &get_column_chunk(size_type row_group_index, size_type src_idx, int schema_idx) const
   {
     auto col = std::find_if(
-      per_file_metadata[src_idx].row_groups[row_group_index].columns.begin(),
-      per_file_metadata[src_idx].row_groups[row_group_index].columns.end(),
+      per_file_metadata[src_idx]->row_groups[row_group_index].columns.begin(),
+      per_file_metadata[src_idx]->row_groups[row_group_index].columns.end(),
       [schema_idx](ColumnChunk const &col) { return col.schema_idx == schema_idx ? true : false; });
-    CUDF_EXPECTS(col != std::end(per_file_metadata[src_idx].row_groups[row_group_index].columns),
+    CUDF_EXPECTS(col != std::end(per_file_metadata[src_idx]->row_groups[row_group_index].columns),
                  "Found no metadata for schema index");
-    return col->meta_data;
+    return *col;
+  }
+
+  auto const &get_column_metadata(size_type row_group_index,
+                                  size_type src_idx,
+                                  int schema_idx) const
+  {
+    return get_column_chunk(row_group_index, src_idx, schema_idx).meta_data;
   }
 
   auto get_num_rows() const { return num_rows; }
 
   auto get_num_row_groups() const { return num_row_groups; }
 
-  auto const &get_schema(int schema_idx) const { return per_file_metadata[0].schema[schema_idx]; }
+  auto const &get_schema(int schema_idx) const { return per_file_metadata[0]->schema[schema_idx]; }
 
   auto const &get_key_value_metadata() const { return agg_keyval_map; }
 
@@ -416,8 +984,8 @@ class aggregate_metadata {
 
     // walk upwards, skipping repeated fields
     while (schema_index > 0) {
-      if (!pfm.schema[schema_index].is_stub()) { depth++; }
-      schema_index = pfm.schema[schema_index].parent_idx;
+      if (!pfm->schema[schema_index].is_stub()) { depth++; }
+      schema_index = pfm->schema[schema_index].parent_idx;
     }
     return depth;
   }
@@ -480,6 +1048,19 @@ class aggregate_metadata {
     }
   }
 
+  /**
+   * @brief Returns the indices of all row groups, one list per source
+   */
+  std::vector<std::vector<size_type>> get_all_row_groups() const
+  {
+    std::vector<std::vector<size_type>> row_groups(per_file_metadata.size());
+    for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
+      row_groups[src_idx].resize(per_file_metadata[src_idx]->row_groups.size());
+      std::iota(row_groups[src_idx].begin(), row_groups[src_idx].end(), 0);
+    }
+    return row_groups;
+  }
+
   struct row_group_info {
     size_type const index;
     size_t const start_row;  // TODO source index
@@ -493,6 +1074,9 @@ class aggregate_metadata {
   /**
    * @brief Filters and reduces down to a selection of row groups
    *
+   * When row groups are listed, `row_start` and `row_count` are relative to the concatenation of
+   * the listed row groups; by default all of their rows are selected.
+   *
    * @param row_groups Lists of row group to reads, one per source
    * @param row_start Starting row of the selection
    * @param row_count Total number of rows selected
@@ -508,18 +1092,35 @@ class aggregate_metadata {
       CUDF_EXPECTS(row_groups.size() == per_file_metadata.size(),
                    "Must specify row groups for each source");
 
-      row_count = 0;
+      size_type total_rows = 0;
       for (size_t src_idx = 0; src_idx < row_groups.size(); ++src_idx) {
         for (auto const &rowgroup_idx : row_groups[src_idx]) {
           CUDF_EXPECTS(
             rowgroup_idx >= 0 &&
-              rowgroup_idx < static_cast<size_type>(per_file_metadata[src_idx].row_groups.size()),
+              rowgroup_idx < static_cast<size_type>(per_file_metadata[src_idx]->row_groups.size()),
             "Invalid rowgroup index");
-          selection.emplace_back(rowgroup_idx, row_count, src_idx);
-          row_count += get_row_group(rowgroup_idx, src_idx).num_rows;
+          selection.emplace_back(rowgroup_idx, total_rows, src_idx);
+          total_rows += get_row_group(rowgroup_idx, src_idx).num_rows;
         }
       }
-      return selection;
+      if (row_start == 0 && row_count < 0) {
+        row_count = total_rows;
+        return selection;
+      }
+
+      // Keep only the row groups overlapping the requested window
+      row_start = std::max(row_start, 0);
+      CUDF_EXPECTS(row_start <= total_rows, "Invalid row start");
+      row_count = (row_count < 0) ? total_rows - row_start : min(row_count, total_rows - row_start);
+      std::vector<row_group_info> window;
+      for (auto const &rg : selection) {
+        auto const rg_end = rg.start_row + get_row_group(rg.index, rg.source_index).num_rows;
+        if (rg_end > static_cast<size_t>(row_start) &&
+            rg.start_row < static_cast<size_t>(row_start + row_count)) {
+          window.emplace_back(rg.index, rg.start_row, rg.source_index);
+        }
+      }
+      return window;
     }
 
     row_start = std::max(row_start, 0);
@@ -534,7 +1135,7 @@ class aggregate_metadata {
     std::vector<row_group_info> selection;
     size_type count = 0;
     for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
-      for (size_t rg_idx = 0; rg_idx < per_file_metadata[src_idx].row_groups.size(); ++rg_idx) {
+      for (size_t rg_idx = 0; rg_idx < per_file_metadata[src_idx]->row_groups.size(); ++rg_idx) {
         auto const chunk_start_row = count;
         count += get_row_group(rg_idx, src_idx).num_rows;
         if (count > row_start || count == 0) {
@@ -547,6 +1148,179 @@ class aggregate_metadata {
     return selection;
   }
 
+  /**
+   * @brief Returns the filter columns whose statistics can be compared against the filter
+   *
+   * Only flat columns whose statistics decode directly to the output type can be used.
+   *
+   * @param filter Expression referencing the output columns by index
+   * @param output_columns Output column structure (resulting cudf columns)
+   * @param output_column_schemas Schema indices of the output columns
+   * @param strings_to_categorical Type conversion parameter
+   * @param strict_decimal_types True if it is an error to load an unsupported decimal type
+   *
+   * @return Indices of the output columns usable as statistics columns
+   */
+  std::vector<size_type> get_stats_columns(ast::expression const &filter,
+                                           std::vector<column_buffer> const &output_columns,
+                                           std::vector<int> const &output_column_schemas,
+                                           bool strings_to_categorical,
+                                           bool strict_decimal_types) const
+  {
+    std::vector<size_type> referenced;
+    collect_column_references(filter, referenced);
+    std::vector<size_type> stats_columns;
+    for (auto const col_idx : referenced) {
+      CUDF_EXPECTS(col_idx >= 0 && col_idx < static_cast<size_type>(output_columns.size()),
+                   "Filter references an invalid column index");
+      auto const &schema = get_schema(output_column_schemas[col_idx]);
+      auto const dtype   = output_columns[col_idx].type;
+      auto const natural_type =
+        to_type_id(schema, strings_to_categorical, type_id::EMPTY, strict_decimal_types);
+      if (schema.num_children == 0 && schema.max_repetition_level == 0 &&
+          schema.type != parquet::INT96 && dtype.id() == natural_type &&
+          (is_numeric(dtype) || is_chrono(dtype))) {
+        stats_columns.push_back(col_idx);
+      }
+    }
+    return stats_columns;
+  }
+
+  /**
+   * @brief Evaluates a filter converted by `stats_expression_converter` on a set of statistics
+   *
+   * @param stats_filter Converted filter expression
+   * @param stats_columns Indices of the output columns the statistics belong to
+   * @param stats Statistics of each entry of `stats_columns`, one per evaluated row
+   * @param num_stats_rows Number of evaluated rows
+   * @param output_columns Output column structure (resulting cudf columns)
+   * @param output_column_schemas Schema indices of the output columns
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Whether each row may contain matching data
+   */
+  std::vector<uint8_t> evaluate_stats_filter(ast::expression const &stats_filter,
+                                             std::vector<size_type> const &stats_columns,
+                                             std::vector<std::vector<Statistics>> const &stats,
+                                             size_type num_stats_rows,
+                                             std::vector<column_buffer> const &output_columns,
+                                             std::vector<int> const &output_column_schemas,
+                                             rmm::cuda_stream_view stream) const
+  {
+    std::vector<std::unique_ptr<column>> stats_table;
+    auto d_always_true =
+      cudf::detail::make_device_uvector_async(std::vector<uint8_t>(num_stats_rows, 1), stream);
+    stats_table.push_back(std::make_unique<column>(
+      data_type{type_id::BOOL8}, num_stats_rows, d_always_true.release()));
+    for (size_t i = 0; i < stats_columns.size(); ++i) {
+      auto const col_idx   = stats_columns[i];
+      auto const &schema   = get_schema(output_column_schemas[col_idx]);
+      auto const is_signed = !(schema.converted_type == parquet::UINT_8 ||
+                               schema.converted_type == parquet::UINT_16 ||
+                               schema.converted_type == parquet::UINT_32 ||
+                               schema.converted_type == parquet::UINT_64 ||
+                               (schema.logical_type.isset.INTEGER &&
+                                !schema.logical_type.INTEGER.isSigned));
+      auto const dtype     = output_columns[col_idx].type;
+      auto min_max         = type_dispatcher(
+        dtype, stats_columns_builder{}, dtype, schema.type, is_signed, stats[i], stream);
+      stats_table.push_back(std::move(min_max.first));
+      stats_table.push_back(std::move(min_max.second));
+    }
+
+    auto const stats_view = table{std::move(stats_table)};
+    auto const result = cudf::ast::detail::compute_column(stats_view.view(), stats_filter, stream);
+    return cudf::detail::make_std_vector_sync(
+      device_span<uint8_t const>(result->view().data<uint8_t>(), num_stats_rows), stream);
+  }
+
+  /**
+   * @brief Reduces a selection of row groups to those whose statistics may satisfy a filter
+   *
+   * @param row_groups Lists of row groups to read, one per source; empty selects all row groups
+   * @param filter Expression referencing the output columns by index
+   * @param output_columns Output column structure (resulting cudf columns)
+   * @param output_column_schemas Schema indices of the output columns
+   * @param strings_to_categorical Type conversion parameter
+   * @param strict_decimal_types True if it is an error to load an unsupported decimal type
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Lists of row groups that may contain matching rows, one per source
+   */
+  std::vector<std::vector<size_type>> filter_row_groups(
+    std::vector<std::vector<size_type>> const &row_groups,
+    ast::expression const &filter,
+    std::vector<column_buffer> const &output_columns,
+    std::vector<int> const &output_column_schemas,
+    bool strings_to_categorical,
+    bool strict_decimal_types,
+    rmm::cuda_stream_view stream) const
+  {
+    // Start from the requested row groups, or from all of them
+    auto const candidates = row_groups.empty() ? get_all_row_groups() : row_groups;
+    CUDF_EXPECTS(candidates.size() == per_file_metadata.size(),
+                 "Must specify row groups for each source");
+    size_type const num_candidates = std::accumulate(
+      candidates.cbegin(), candidates.cend(), 0, [](auto sum, auto const &rgs) {
+        return sum + static_cast<size_type>(rgs.size());
+      });
+    if (num_candidates == 0) { return candidates; }
+
+    auto const stats_columns = get_stats_columns(
+      filter, output_columns, output_column_schemas, strings_to_categorical, strict_decimal_types);
+    stats_expression_converter const converter(filter, stats_columns);
+    auto const stats_filter = converter.get_expression();
+    if (stats_filter == nullptr) { return candidates; }
+
+    // Gather the chunk statistics, one row per candidate row group
+    std::vector<std::vector<Statistics>> stats(stats_columns.size());
+    for (size_t i = 0; i < stats_columns.size(); ++i) {
+      auto const schema_idx = output_column_schemas[stats_columns[i]];
+      stats[i].reserve(num_candidates);
+      for (size_t src_idx = 0; src_idx < candidates.size(); ++src_idx) {
+        for (auto const rg_idx : candidates[src_idx]) {
+          stats[i].push_back(get_chunk_statistics(rg_idx, src_idx, schema_idx));
+        }
+      }
+    }
+
+    // Evaluate the converted filter and keep the row groups that may match
+    auto const keep = evaluate_stats_filter(*stats_filter,
+                                            stats_columns,
+                                            stats,
+                                            num_candidates,
+                                            output_columns,
+                                            output_column_schemas,
+                                            stream);
+
+    std::vector<std::vector<size_type>> selection(candidates.size());
+    size_t row_idx = 0;
+    for (size_t src_idx = 0; src_idx < candidates.size(); ++src_idx) {
+      for (auto const rg_idx : candidates[src_idx]) {
+        if (keep[row_idx++]) { selection[src_idx].push_back(rg_idx); }
+      }
+    }
+    return selection;
+  }
+
+  /**
+   * @brief Decodes the statistics of a column chunk
+   *
+   * @return The chunk statistics, or empty statistics if they are missing or malformed
+   */
+  Statistics get_chunk_statistics(size_type row_group_index,
+                                  size_type src_idx,
+                                  int schema_idx) const
+  {
+    auto const &col_meta = get_column_metadata(row_group_index, src_idx, schema_idx);
+    Statistics chunk_stats;
+    if (!col_meta.statistics_blob.empty()) {
+      CompactProtocolReader cp(col_meta.statistics_blob.data(), col_meta.statistics_blob.size());
+      if (!cp.read(&chunk_stats)) { chunk_stats = Statistics{}; }
+    }
+    return chunk_stats;
+  }
+
   /**
    * @brief Build input and output column structures based on schema input. Recursive.
    *
@@ -658,8 +1432,8 @@ class aggregate_metadata {
     std::vector<int> output_column_schemas;
     if (use_names.empty()) {
       // walk the schema and choose all top level columns
-      for (size_t schema_idx = 1; schema_idx < pfm.schema.size(); schema_idx++) {
-        auto const &schema = pfm.schema[schema_idx];
+      for (size_t schema_idx = 1; schema_idx < pfm->schema.size(); schema_idx++) {
+        auto const &schema = pfm->schema[schema_idx];
         if (schema.parent_idx == 0) { output_column_schemas.push_back(schema_idx); }
       }
     } else {
@@ -667,8 +1441,8 @@ class aggregate_metadata {
       std::vector<std::string> local_use_names = use_names;
       if (include_index) { add_pandas_index_names(local_use_names); }
       for (const auto &use_name : local_use_names) {
-        for (size_t schema_idx = 1; schema_idx < pfm.schema.size(); schema_idx++) {
-          auto const &schema = pfm.schema[schema_idx];
+        for (size_t schema_idx = 1; schema_idx < pfm->schema.size(); schema_idx++) {
+          auto const &schema = pfm->schema[schema_idx];
           // We select only top level columns by name. Selecting nested columns by name is not
           // supported. Top level columns are identified by their parent being the root (idx == 0)
           if (use_name == schema.name and schema.parent_idx == 0) {
@@ -827,20 +1601,54 @@ void reader::impl::read_column_chunks(
   size_t begin_chunk,
   size_t end_chunk,
   const std::vector<size_t> &column_chunk_offsets,
+  std::vector<std::pair<size_t, size_t>> const &column_chunk_skips,
   std::vector<size_type> const &chunk_source_map,
   rmm::cuda_stream_view stream)
 {
+  stage_range range{"parquet::read_column_chunks",
+                    static_cast<int64_t>(total_compressed_size(chunks, begin_chunk, end_chunk))};
+  // Reads of each source, issued together once all of the destinations are allocated
+  std::map<size_type, std::vector<datasource::read_request>> source_reads;
+  size_t expected_bytes = 0;
+  auto const add_read   = [&](size_type source_index, size_t offset, size_t size, uint8_t *dst) {
+    if (size == 0) { return; }
+    if (auto const prefetched = find_prefetched(source_index, offset, size)) {
+      CUDA_TRY(cudaMemcpyAsync(dst, prefetched, size, cudaMemcpyHostToDevice, stream.value()));
+    } else {
+      source_reads[source_index].push_back({offset, size, dst});
+      expected_bytes += size;
+    }
+  };
+
   // Transfer chunk data, coalescing adjacent chunks
   for (size_t chunk = begin_chunk; chunk < end_chunk;) {
     const size_t io_offset   = column_chunk_offsets[chunk];
     size_t io_size           = chunks[chunk].compressed_size;
     size_t next_chunk        = chunk + 1;
     const bool is_compressed = (chunks[chunk].codec != parquet::Compression::UNCOMPRESSED);
+    auto const skip          = column_chunk_skips[chunk];
+    if (skip.second != 0) {
+      // Chunk with skipped pages: read the dictionary and the selected pages back to back
+      if (io_size != 0) {
+        rmm::device_buffer buffer(io_size, stream, get_temporary_memory_resource());
+        auto const dst = static_cast<uint8_t *>(buffer.data());
+        add_read(chunk_source_map[chunk], io_offset, skip.first, dst);
+        add_read(chunk_source_map[chunk],
+                 io_offset + skip.first + skip.second,
+                 io_size - skip.first,
+                 dst + skip.first);
+        page_data[chunk]              = datasource::buffer::create(std::move(buffer));
+        chunks[chunk].compressed_data = page_data[chunk]->data();
+      }
+      chunk = next_chunk;
+      continue;
+    }
     while (next_chunk < end_chunk) {
       const size_t next_offset = column_chunk_offsets[next_chunk];
       const bool is_next_compressed =
         (chunks[next_chunk].codec != parquet::Compression::UNCOMPRESSED);
-      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed) {
+      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed ||
+          column_chunk_skips[next_chunk].second != 0) {
         // Can't merge if not contiguous or mixing compressed and uncompressed
         // Not coalescing uncompressed with compressed chunks is so that compressed buffers can be
         // freed earlier (immediately after decompression stage) to limit peak memory requirements
@@ -850,15 +1658,11 @@ void reader::impl::read_column_chunks(
       next_chunk++;
     }
     if (io_size != 0) {
-      auto &source = _sources[chunk_source_map[chunk]];
-      if (source->is_device_read_preferred(io_size)) {
-        page_data[chunk] = source->device_read(io_offset, io_size, stream);
-      } else {
-        auto const buffer = source->host_read(io_offset, io_size);
-        page_data[chunk] =
-          datasource::buffer::create(rmm::device_buffer(buffer->data(), buffer->size(), stream));
-      }
-      auto d_compdata = page_data[chunk]->data();
+      rmm::device_buffer buffer(io_size, stream, get_temporary_memory_resource());
+      add_read(
+        chunk_source_map[chunk], io_offset, io_size, static_cast<uint8_t *>(buffer.data()));
+      page_data[chunk] = datasource::buffer::create(std::move(buffer));
+      auto d_compdata  = page_data[chunk]->data();
       do {
         chunks[chunk].compressed_data = d_compdata;
         d_compdata += chunks[chunk].compressed_size;
@@ -867,6 +1671,34 @@ void reader::impl::read_column_chunks(
       chunk = next_chunk;
     }
   }
+
+  // Issue the reads of all sources before waiting on any of them
+  std::vector<std::future<size_t>> pending_reads;
+  for (auto &reads : source_reads) {
+    pending_reads.push_back(
+      read_to_device_async(*_sources[reads.first], std::move(reads.second), stream));
+  }
+  size_t bytes_read = 0;
+  for (auto &pending : pending_reads) {
+    bytes_read += pending.get();
+  }
+  CUDF_EXPECTS(bytes_read == expected_bytes, "Unexpected discrepancy in bytes read.");
+}
+
+uint8_t const *reader::impl::find_prefetched(size_type source_index,
+                                             size_t offset,
+                                             size_t size) const
+{
+  // Find the last chunk of the source starting at or before the offset
+  auto it = _prefetched_chunks.upper_bound(std::make_pair(source_index, offset));
+  if (it == _prefetched_chunks.begin()) { return nullptr; }
+  --it;
+  auto const chunk_offset = it->first.second;
+  auto const &buffer      = it->second;
+  if (it->first.first != source_index || offset + size > chunk_offset + buffer->size()) {
+    return nullptr;
+  }
+  return buffer->data() + (offset - chunk_offset);
 }
 
 /**
@@ -875,6 +1707,8 @@ void reader::impl::read_column_chunks(
 size_t reader::impl::count_page_headers(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
                                         rmm::cuda_stream_view stream)
 {
+  stage_range range{"parquet::count_page_headers",
+                    static_cast<int64_t>(total_compressed_size(chunks, 0, chunks.size()))};
   size_t total_pages = 0;
 
   chunks.host_to_device(stream);
@@ -895,6 +1729,8 @@ void reader::impl::decode_page_headers(hostdevice_vector<gpu::ColumnChunkDesc> &
                                        hostdevice_vector<gpu::PageInfo> &pages,
                                        rmm::cuda_stream_view stream)
 {
+  stage_range range{"parquet::decode_page_headers",
+                    static_cast<int64_t>(total_compressed_size(chunks, 0, chunks.size()))};
   // IMPORTANT : if you change how pages are stored within a chunk (dist pages, then data pages),
   // please update preprocess_nested_columns to reflect this.
   for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
@@ -927,14 +1763,15 @@ rmm::device_buffer reader::impl::decompress_page_data(
   };
 
   // Brotli scratch memory for decompressing
-  rmm::device_buffer debrotli_scratch;
+  rmm::device_buffer debrotli_scratch(0, stream, get_temporary_memory_resource());
 
   // Count the exact number of compressed pages
   size_t num_comp_pages    = 0;
   size_t total_decomp_size = 0;
-  std::array<std::pair<parquet::Compression, size_t>, 3> codecs{std::make_pair(parquet::GZIP, 0),
+  std::array<std::pair<parquet::Compression, size_t>, 4> codecs{std::make_pair(parquet::GZIP, 0),
                                                                 std::make_pair(parquet::SNAPPY, 0),
-                                                                std::make_pair(parquet::BROTLI, 0)};
+                                                                std::make_pair(parquet::BROTLI, 0),
+                                                                std::make_pair(parquet::ZSTD, 0)};
 
   for (auto &codec : codecs) {
     for_each_codec_page(codec.first, [&](size_t page) {
@@ -947,8 +1784,11 @@ rmm::device_buffer reader::impl::decompress_page_data(
     }
   }
 
+  // Payload is the decompressed size, which the throughput of the codecs depends on
+  stage_range range{"parquet::decompress", static_cast<int64_t>(total_decomp_size)};
+
   // Dispatch batches of pages to decompress for each codec
-  rmm::device_buffer decomp_pages(total_decomp_size, stream);
+  rmm::device_buffer decomp_pages(total_decomp_size, stream, get_temporary_memory_resource());
   hostdevice_vector<gpu_inflate_input_s> inflate_in(0, num_comp_pages, stream);
   hostdevice_vector<gpu_inflate_status_s> inflate_out(0, num_comp_pages, stream);
 
@@ -959,18 +1799,27 @@ rmm::device_buffer reader::impl::decompress_page_data(
       int32_t start_pos = argc;
 
       for_each_codec_page(codec.first, [&](size_t page) {
-        auto dst_base              = static_cast<uint8_t *>(decomp_pages.data());
-        inflate_in[argc].srcDevice = pages[page].page_data;
-        inflate_in[argc].srcSize   = pages[page].compressed_page_size;
-        inflate_in[argc].dstDevice = dst_base + decomp_offset;
-        inflate_in[argc].dstSize   = pages[page].uncompressed_page_size;
+        auto dst_base = static_cast<uint8_t *>(decomp_pages.data()) + decomp_offset;
+        // the level data of V2 pages is stored uncompressed in front of the compressed values
+        auto const lvl_bytes = (pages[page].flags & gpu::PAGEINFO_FLAGS_V2)
+                                 ? pages[page].lvl_bytes[gpu::level_type::DEFINITION] +
+                                     pages[page].lvl_bytes[gpu::level_type::REPETITION]
+                                 : 0;
+        if (lvl_bytes > 0) {
+          CUDA_TRY(cudaMemcpyAsync(
+            dst_base, pages[page].page_data, lvl_bytes, cudaMemcpyDeviceToDevice, stream.value()));
+        }
+        inflate_in[argc].srcDevice = pages[page].page_data + lvl_bytes;
+        inflate_in[argc].srcSize   = pages[page].compressed_page_size - lvl_bytes;
+        inflate_in[argc].dstDevice = dst_base + lvl_bytes;
+        inflate_in[argc].dstSize   = pages[page].uncompressed_page_size - lvl_bytes;
 
         inflate_out[argc].bytes_written = 0;
         inflate_out[argc].status        = static_cast<uint32_t>(-1000);
         inflate_out[argc].reserved      = 0;
 
-        pages[page].page_data = static_cast<uint8_t *>(inflate_in[argc].dstDevice);
-        decomp_offset += inflate_in[argc].dstSize;
+        pages[page].page_data = dst_base;
+        decomp_offset += pages[page].uncompressed_page_size;
         argc++;
       });
 
@@ -1006,6 +1855,12 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                 argc - start_pos,
                                 stream));
           break;
+        case parquet::ZSTD:
+          CUDA_TRY(gpu_unzstd(inflate_in.device_ptr(start_pos),
+                              inflate_out.device_ptr(start_pos),
+                              argc - start_pos,
+                              stream));
+          break;
         default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
       }
       CUDA_TRY(cudaMemcpyAsync(inflate_out.host_ptr(start_pos),
@@ -1152,6 +2007,9 @@ void reader::impl::preprocess_columns(hostdevice_vector<gpu::ColumnChunkDesc> &c
                                       bool has_lists,
                                       rmm::cuda_stream_view stream)
 {
+  stage_range range{"parquet::preprocess_columns",
+                    static_cast<int64_t>(total_compressed_size(chunks, 0, chunks.size())),
+                    static_cast<int64_t>(total_rows)};
   // TODO : we should be selectively preprocessing only columns that have
   // lists in them instead of doing them all if even one contains lists.
 
@@ -1178,13 +2036,21 @@ void reader::impl::preprocess_columns(hostdevice_vector<gpu::ColumnChunkDesc> &c
 /**
  * @copydoc cudf::io::detail::parquet::decode_page_data
  */
-void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
-                                    hostdevice_vector<gpu::PageInfo> &pages,
-                                    hostdevice_vector<gpu::PageNestingInfo> &page_nesting,
-                                    size_t min_row,
-                                    size_t total_rows,
-                                    rmm::cuda_stream_view stream)
+rmm::device_buffer reader::impl::decode_page_data(
+  hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+  hostdevice_vector<gpu::PageInfo> &pages,
+  hostdevice_vector<gpu::PageNestingInfo> &page_nesting,
+  size_t min_row,
+  size_t total_rows,
+  rmm::device_vector<string_index_pair> &str_dict_index,
+  rmm::cuda_stream_view stream)
 {
+  int64_t page_bytes = 0;
+  for (size_t p = 0; p < pages.size(); ++p) {
+    page_bytes += pages[p].uncompressed_page_size;
+  }
+  stage_range range{"parquet::decode_pages", page_bytes, static_cast<int64_t>(total_rows)};
+
   auto is_dict_chunk = [](const gpu::ColumnChunkDesc &chunk) {
     return (chunk.data_type & 0x7) == BYTE_ARRAY && chunk.num_dict_pages > 0;
   };
@@ -1199,7 +2065,7 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
 
   // Build index for string dictionaries since they can't be indexed
   // directly due to variable-sized elements
-  rmm::device_vector<string_index_pair> str_dict_index;
+  str_dict_index.clear();
   if (total_str_dict_indexes > 0) { str_dict_index.resize(total_str_dict_indexes); }
 
   // TODO (dm): hd_vec should have begin and end iterator members
@@ -1304,6 +2170,28 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
     gpu::BuildStringDictionaryIndex(chunks.device_ptr(), chunks.size(), stream);
   }
 
+  // Strings of DELTA_BYTE_ARRAY pages are reconstructed from the prefix of the previous string,
+  // so they are written into scratch memory that the string columns are later built from
+  rmm::device_buffer delta_str_data;
+  if (std::any_of(pages.host_ptr(), pages.host_ptr(pages.size()), [](auto const &page) {
+        return page.encoding == Encoding::DELTA_BYTE_ARRAY;
+      })) {
+    gpu::ComputeDeltaStringSizes(pages, chunks, stream);
+    pages.device_to_host(stream, true);
+
+    size_t total_str_bytes = 0;
+    for (size_t p = 0; p < pages.size(); p++) { total_str_bytes += pages[p].str_bytes; }
+    delta_str_data =
+      rmm::device_buffer(total_str_bytes, stream, get_temporary_memory_resource());
+
+    auto str_data = static_cast<uint8_t *>(delta_str_data.data());
+    for (size_t p = 0; p < pages.size(); p++) {
+      pages[p].str_data = str_data;
+      str_data += pages[p].str_bytes;
+    }
+    pages.host_to_device(stream);
+  }
+
   gpu::DecodePageData(pages, chunks, total_rows, min_row, stream);
   pages.device_to_host(stream);
   page_nesting.device_to_host(stream);
@@ -1366,15 +2254,91 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
   }
 
   stream.synchronize();
+
+  return delta_str_data;
+}
+
+std::unique_ptr<column> reader::impl::make_dictionary_output(
+  size_t out_col_idx,
+  hostdevice_vector<gpu::ColumnChunkDesc> const &chunks,
+  hostdevice_vector<gpu::PageInfo> const &pages,
+  column_name_info *schema_info,
+  rmm::cuda_stream_view stream)
+{
+  auto &buffer      = _output_columns[out_col_idx];
+  schema_info->name = buffer.name;
+
+  auto const input_col =
+    std::find_if(_input_columns.cbegin(), _input_columns.cend(), [&](auto const &col) {
+      return col.nesting_depth() == 1 && col.nesting[0] == static_cast<int>(out_col_idx);
+    });
+  auto const input_col_idx = std::distance(_input_columns.cbegin(), input_col);
+
+  // Locate the dictionary entries of the chunks of the column, as long as every data page only
+  // refers to its dictionary
+  std::vector<std::pair<string_index_pair const *, size_t>> chunk_entries;
+  bool all_dictionary = input_col != _input_columns.cend();
+  for (size_t c = 0, page_count = 0; all_dictionary && c < chunks.size();
+       page_count += chunks[c++].max_num_pages) {
+    if (chunks[c].src_col_index != input_col_idx) { continue; }
+    if ((chunks[c].data_type & 0x7) != BYTE_ARRAY || chunks[c].num_dict_pages == 0 ||
+        chunks[c].str_dict_index == nullptr) {
+      all_dictionary = false;
+      break;
+    }
+    for (auto p = page_count; p < page_count + chunks[c].max_num_pages; ++p) {
+      if ((pages[p].flags & gpu::PAGEINFO_FLAGS_DICTIONARY) == 0 &&
+          pages[p].encoding != Encoding::PLAIN_DICTIONARY &&
+          pages[p].encoding != Encoding::RLE_DICTIONARY) {
+        all_dictionary = false;
+      }
+    }
+    chunk_entries.emplace_back(chunks[c].str_dict_index, pages[page_count].num_input_values);
+  }
+  if (!all_dictionary) {
+    auto const strings = make_column(buffer, nullptr, stream);
+    return cudf::dictionary::detail::encode(
+      strings->view(), data_type{type_id::UINT32}, stream, _mr);
+  }
+
+  // Gather the entries of all the chunks
+  auto const num_entries = std::accumulate(
+    chunk_entries.cbegin(), chunk_entries.cend(), size_t{0}, [](auto sum, auto const &entries) {
+      return sum + entries.second;
+    });
+  rmm::device_uvector<string_index_pair> entries(num_entries, stream);
+  size_t entry_offset = 0;
+  for (auto const &chunk : chunk_entries) {
+    CUDA_TRY(cudaMemcpyAsync(entries.data() + entry_offset,
+                             chunk.first,
+                             chunk.second * sizeof(string_index_pair),
+                             cudaMemcpyDeviceToDevice,
+                             stream.value()));
+    entry_offset += chunk.second;
+  }
+  return make_dictionary_from_entries(*buffer._strings, entries, stream, _mr);
 }
 
 reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
+                   std::vector<std::string> const &filepaths,
                    parquet_reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
   : _mr(mr), _sources(std::move(sources))
 {
-  // Open and parse the source dataset metadata
-  _metadata = std::make_unique<aggregate_metadata>(_sources);
+  // Open and parse the source dataset metadata, unless it was parsed ahead of the read
+  auto const &parsed = options.get_metadata();
+  std::vector<std::shared_ptr<metadata const>> metadatas;
+  if (parsed.empty()) {
+    auto footers = parse_footers(_sources, filepaths);
+    metadatas.assign(footers.begin(), footers.end());
+  } else {
+    CUDF_EXPECTS(parsed.size() == _sources.size(), "Must specify metadata for each source");
+    for (auto const &md : parsed) {
+      CUDF_EXPECTS(md.get_impl() != nullptr, "Metadata holds no parsed footer");
+      metadatas.push_back(md.get_impl());
+    }
+  }
+  _metadata = std::make_unique<aggregate_metadata>(std::move(metadatas));
 
   // Override output timestamp resolution if requested
   if (options.get_timestamp_type().id() != type_id::EMPTY) {
@@ -1383,8 +2347,9 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
 
   _strict_decimal_types = options.is_enabled_strict_decimal_types();
 
-  // Strings may be returned as either string or categorical columns
+  // Strings may be returned as either string, categorical or dictionary columns
   _strings_to_categorical = options.is_enabled_convert_strings_to_categories();
+  _strings_to_dictionary  = options.is_enabled_convert_strings_to_dictionary();
 
   // Select only columns required by the options
   std::tie(_input_columns, _output_columns, _output_column_schemas) =
@@ -1395,36 +2360,281 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
                               _strict_decimal_types);
 }
 
-table_with_metadata reader::impl::read(size_type skip_rows,
-                                       size_type num_rows,
-                                       std::vector<std::vector<size_type>> const &row_group_list,
-                                       rmm::cuda_stream_view stream)
+std::vector<std::vector<size_type>> reader::impl::filter_pages(
+  std::vector<std::vector<size_type>> const &row_groups,
+  ast::expression const &filter,
+  size_type &skip_rows,
+  size_type &num_rows,
+  rmm::cuda_stream_view stream)
+{
+  auto const stats_columns = _metadata->get_stats_columns(filter,
+                                                          _output_columns,
+                                                          _output_column_schemas,
+                                                          _strings_to_categorical,
+                                                          _strict_decimal_types);
+  stats_expression_converter const converter(filter, stats_columns);
+  auto const stats_filter = converter.get_expression();
+  if (stats_filter == nullptr) { return row_groups; }
+
+  // Split each row group into segments at the page boundaries of all the statistics columns. The
+  // statistics of a segment come from the column index of the pages covering it, or from the
+  // chunk statistics for columns without a column index.
+  struct segment_info {
+    int64_t first_row;  // relative to the row group
+    int64_t end_row;
+  };
+  std::vector<segment_info> segments;
+  std::vector<size_t> row_group_segments{0};  // first segment of each row group
+  std::vector<std::vector<Statistics>> stats(stats_columns.size());
+  for (size_t src_idx = 0; src_idx < row_groups.size(); ++src_idx) {
+    auto &source = *_sources[src_idx];
+    for (auto const rg_idx : row_groups[src_idx]) {
+      auto const rg_rows = _metadata->get_row_group(rg_idx, src_idx).num_rows;
+      std::vector<thrust::optional<OffsetIndex>> offset_indexes(stats_columns.size());
+      std::vector<thrust::optional<ColumnIndex>> column_indexes(stats_columns.size());
+      std::vector<int64_t> boundaries{0};
+      for (size_t i = 0; i < stats_columns.size(); ++i) {
+        auto const &col_chunk = _metadata->get_column_chunk(
+          rg_idx, src_idx, _output_column_schemas[stats_columns[i]]);
+        auto offset_index = read_page_index<OffsetIndex>(
+          source, col_chunk.offset_index_offset, col_chunk.offset_index_length);
+        auto column_index = read_page_index<ColumnIndex>(
+          source, col_chunk.column_index_offset, col_chunk.column_index_length);
+        if (!offset_index.has_value() || !column_index.has_value()) { continue; }
+        auto const num_pages = offset_index->page_locations.size();
+        if (num_pages == 0 || column_index->min_values.size() != num_pages ||
+            column_index->max_values.size() != num_pages) {
+          continue;
+        }
+        for (auto const &loc : offset_index->page_locations) {
+          boundaries.push_back(loc.first_row_index);
+        }
+        offset_indexes[i] = std::move(offset_index);
+        column_indexes[i] = std::move(column_index);
+      }
+      std::sort(boundaries.begin(), boundaries.end());
+      boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+      auto const is_outside = [&](int64_t row) { return row < 0 || (row > 0 && row >= rg_rows); };
+      boundaries.erase(std::remove_if(boundaries.begin(), boundaries.end(), is_outside),
+                       boundaries.end());
+
+      for (size_t b = 0; b < boundaries.size(); ++b) {
+        auto const first_row = boundaries[b];
+        segments.push_back({first_row, b + 1 < boundaries.size() ? boundaries[b + 1] : rg_rows});
+        for (size_t i = 0; i < stats_columns.size(); ++i) {
+          if (column_indexes[i].has_value()) {
+            // The page covering the segment is the last one starting at or before it
+            auto const &locations = offset_indexes[i]->page_locations;
+            auto const page       = std::distance(
+              locations.begin(),
+              std::upper_bound(
+                locations.begin(), locations.end(), first_row, [](int64_t row, auto const &loc) {
+                  return row < loc.first_row_index;
+                }));
+            Statistics page_stats;
+            if (page > 0) {
+              page_stats.min_value = column_indexes[i]->min_values[page - 1];
+              page_stats.max_value = column_indexes[i]->max_values[page - 1];
+            }
+            stats[i].push_back(std::move(page_stats));
+          } else {
+            stats[i].push_back(_metadata->get_chunk_statistics(
+              rg_idx, src_idx, _output_column_schemas[stats_columns[i]]));
+          }
+        }
+      }
+      row_group_segments.push_back(segments.size());
+    }
+  }
+  if (segments.empty()) { return row_groups; }
+
+  auto const keep = _metadata->evaluate_stats_filter(*stats_filter,
+                                                     stats_columns,
+                                                     stats,
+                                                     static_cast<size_type>(segments.size()),
+                                                     _output_columns,
+                                                     _output_column_schemas,
+                                                     stream);
+
+  // Drop the row groups without matching segments, and trim the rows ahead of the first and
+  // after the last matching segment
+  std::vector<std::vector<size_type>> selection(row_groups.size());
+  int64_t selected_rows = 0;
+  int64_t first_match   = -1;
+  int64_t match_end     = 0;
+  size_t rg_pos         = 0;
+  for (size_t src_idx = 0; src_idx < row_groups.size(); ++src_idx) {
+    for (auto const rg_idx : row_groups[src_idx]) {
+      int64_t rg_first = -1;
+      int64_t rg_end   = 0;
+      for (auto seg = row_group_segments[rg_pos]; seg < row_group_segments[rg_pos + 1]; ++seg) {
+        if (keep[seg]) {
+          if (rg_first < 0) { rg_first = segments[seg].first_row; }
+          rg_end = segments[seg].end_row;
+        }
+      }
+      ++rg_pos;
+      if (rg_first < 0) { continue; }
+      selection[src_idx].push_back(rg_idx);
+      if (first_match < 0) { first_match = selected_rows + rg_first; }
+      match_end = selected_rows + rg_end;
+      selected_rows += _metadata->get_row_group(rg_idx, src_idx).num_rows;
+    }
+  }
+  if (first_match >= 0) {
+    skip_rows = static_cast<size_type>(first_match);
+    num_rows  = static_cast<size_type>(match_end - first_match);
+  }
+  return selection;
+}
+
+std::vector<std::vector<size_type>> reader::impl::filter_bloom_filters(
+  std::vector<std::vector<size_type>> const &row_groups,
+  ast::expression const &filter,
+  rmm::cuda_stream_view stream)
 {
+  auto const stats_columns = _metadata->get_stats_columns(filter,
+                                                          _output_columns,
+                                                          _output_column_schemas,
+                                                          _strings_to_categorical,
+                                                          _strict_decimal_types);
+
+  // Hash the literal of each `column == literal` predicate reached through AND and OR only
+  struct bloom_probe {
+    size_type column_index;
+    uint64_t hash;
+  };
+  std::map<ast::expression const *, bloom_probe> probes;
+  std::function<void(ast::detail::node const &)> collect_probes =
+    [&](ast::detail::node const &node) {
+      auto const expr = dynamic_cast<ast::expression const *>(&node);
+      if (expr == nullptr) { return; }
+      auto const op       = expr->get_operator();
+      auto const operands = expr->get_operands();
+      if (op == ast::ast_operator::LOGICAL_AND || op == ast::ast_operator::LOGICAL_OR) {
+        collect_probes(operands[0].get());
+        collect_probes(operands[1].get());
+        return;
+      }
+      if (op != ast::ast_operator::EQUAL || operands.size() != 2) { return; }
+      auto col = dynamic_cast<ast::column_reference const *>(&operands[0].get());
+      auto lit = dynamic_cast<ast::literal const *>(&operands[1].get());
+      if (col == nullptr && lit == nullptr) {
+        col = dynamic_cast<ast::column_reference const *>(&operands[1].get());
+        lit = dynamic_cast<ast::literal const *>(&operands[0].get());
+      }
+      if (col == nullptr || lit == nullptr ||
+          col->get_table_source() != ast::table_reference::LEFT ||
+          std::find(stats_columns.begin(), stats_columns.end(), col->get_column_index()) ==
+            stats_columns.end()) {
+        return;
+      }
+      auto const &schema = _metadata->get_schema(_output_column_schemas[col->get_column_index()]);
+      auto const key     = type_dispatcher(
+        lit->get_data_type(), bloom_filter_key_builder{}, *lit, schema.type, stream);
+      if (!key.empty()) {
+        auto const hash = gpu::XxHash64(key.data(), key.size());
+        probes.emplace(expr, bloom_probe{col->get_column_index(), hash});
+      }
+    };
+  collect_probes(filter);
+  if (probes.empty()) { return row_groups; }
+
+  std::vector<std::vector<size_type>> selection(row_groups.size());
+  for (size_t src_idx = 0; src_idx < row_groups.size(); ++src_idx) {
+    for (auto const rg_idx : row_groups[src_idx]) {
+      // Read the bloom filter of each probed column at most once per row group
+      std::map<size_type, thrust::optional<std::vector<uint8_t>>> bitsets;
+      auto const get_bitset =
+        [&](size_type col_idx) -> thrust::optional<std::vector<uint8_t>> const & {
+          auto it = bitsets.find(col_idx);
+          if (it == bitsets.end()) {
+            auto const &col_meta =
+              _metadata->get_column_metadata(rg_idx, src_idx, _output_column_schemas[col_idx]);
+            it = bitsets.emplace(col_idx, read_bloom_filter(*_sources[src_idx], col_meta)).first;
+          }
+          return it->second;
+        };
+      std::function<bool(ast::detail::node const &)> may_match =
+        [&](ast::detail::node const &node) {
+          auto const expr = dynamic_cast<ast::expression const *>(&node);
+          if (expr == nullptr) { return true; }
+          auto const op       = expr->get_operator();
+          auto const operands = expr->get_operands();
+          if (op == ast::ast_operator::LOGICAL_AND) {
+            return may_match(operands[0].get()) && may_match(operands[1].get());
+          }
+          if (op == ast::ast_operator::LOGICAL_OR) {
+            return may_match(operands[0].get()) || may_match(operands[1].get());
+          }
+          auto const probe = probes.find(expr);
+          if (probe == probes.end()) { return true; }
+          auto const &bitset = get_bitset(probe->second.column_index);
+          return !bitset.has_value() || bloom_filter_may_contain(*bitset, probe->second.hash);
+        };
+      if (may_match(filter)) { selection[src_idx].push_back(rg_idx); }
+    }
+  }
+  return selection;
+}
+
+void reader::impl::load_pass(
+  size_type skip_rows,
+  size_type num_rows,
+  std::vector<std::vector<size_type>> const &row_group_list,
+  thrust::optional<std::reference_wrapper<ast::expression const>> filter,
+  rmm::cuda_stream_view stream)
+{
+  // Skip row groups whose statistics show they cannot satisfy the filter
+  auto filtered_row_groups =
+    filter.has_value() ? _metadata->filter_row_groups(row_group_list,
+                                                      filter.value().get(),
+                                                      _output_columns,
+                                                      _output_column_schemas,
+                                                      _strings_to_categorical,
+                                                      _strict_decimal_types,
+                                                      stream)
+                       : row_group_list;
+  // Skip row groups whose bloom filters show they cannot hold a value tested for equality
+  if (filter.has_value()) {
+    filtered_row_groups =
+      filter_bloom_filters(filtered_row_groups, filter.value().get(), stream);
+  }
+  // Without an explicit row window, also skip the leading and trailing pages that cannot satisfy
+  // the filter
+  if (filter.has_value() && skip_rows == 0 && num_rows < 0) {
+    filtered_row_groups =
+      filter_pages(filtered_row_groups, filter.value().get(), skip_rows, num_rows, stream);
+  }
+
   // Select only row groups required
   const auto selected_row_groups =
-    _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
+    _metadata->select_row_groups(filtered_row_groups, skip_rows, num_rows);
 
-  table_metadata out_metadata;
-
-  // output cudf columns as determined by the top level schema
-  std::vector<std::unique_ptr<column>> out_columns;
-  out_columns.reserve(_output_columns.size());
+  _pass            = std::make_unique<pass_data>();
+  _pass->skip_rows = skip_rows;
+  _pass->num_rows  = num_rows;
 
   if (selected_row_groups.size() != 0 && _input_columns.size() != 0) {
     // Descriptors for all the chunks that make up the selected columns
     const auto num_input_columns = _input_columns.size();
     const auto num_chunks        = selected_row_groups.size() * num_input_columns;
-    hostdevice_vector<gpu::ColumnChunkDesc> chunks(0, num_chunks, stream);
+    _pass->chunks = hostdevice_vector<gpu::ColumnChunkDesc>(0, num_chunks, stream);
+    auto &chunks  = _pass->chunks;
 
     // Association between each column chunk and its source
     std::vector<size_type> chunk_source_map(num_chunks);
 
     // Tracker for eventually deallocating compressed and uncompressed data
-    std::vector<std::unique_ptr<datasource::buffer>> page_data(num_chunks);
+    auto &page_data = _pass->page_data;
+    page_data.resize(num_chunks);
 
     // Keep track of column chunk file offsets
     std::vector<size_t> column_chunk_offsets(num_chunks);
 
+    // Byte ranges of the column chunks that are not read, as (offset in chunk, size) pairs
+    std::vector<std::pair<size_t, size_t>> column_chunk_skips(num_chunks);
+
     // if there are lists present, we need to preprocess
     bool has_lists = false;
 
@@ -1437,6 +2647,12 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       auto const row_group_source = rg.source_index;
       auto const row_group_rows   = std::min<int>(remaining_rows, row_group.num_rows);
       auto const io_chunk_idx     = chunks.size();
+      // Rows of the row group within the selected window
+      auto const row_group_first_row =
+        std::max<int64_t>(skip_rows - static_cast<int64_t>(row_group_start), 0);
+      auto const row_group_last_row = std::min<int64_t>(
+        static_cast<int64_t>(skip_rows) + num_rows - static_cast<int64_t>(row_group_start),
+        row_group.num_rows);
 
       // generate ColumnChunkDesc objects for everything to be decoded (all input columns)
       for (size_t i = 0; i < num_input_columns; ++i) {
@@ -1466,17 +2682,48 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           schema.converted_type,
           schema.type_length);
 
-        column_chunk_offsets[chunks.size()] =
+        auto const chunk_offset =
           (col_meta.dictionary_page_offset != 0)
             ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
             : col_meta.data_page_offset;
+        column_chunk_offsets[chunks.size()] = chunk_offset;
+
+        // Use the page locations walked by `setup_chunking()`, or else the offset index, if any,
+        // to only read the pages overlapping the selected rows
+        size_t chunk_size      = col_meta.total_compressed_size;
+        size_t chunk_start_row = row_group_start;
+        if (schema.max_repetition_level == 0 &&
+            (row_group_first_row > 0 || row_group_last_row < row_group.num_rows)) {
+          auto const walked = _page_locations.find(
+            std::make_tuple(row_group_source, rg.index, col.schema_idx));
+          auto const &col_chunk =
+            _metadata->get_column_chunk(rg.index, rg.source_index, col.schema_idx);
+          auto const offset_index =
+            (walked != _page_locations.end())
+              ? thrust::optional<OffsetIndex>{walked->second}
+              : read_page_index<OffsetIndex>(*_sources[row_group_source],
+                                             col_chunk.offset_index_offset,
+                                             col_chunk.offset_index_length);
+          auto const page_range = select_pages(
+            offset_index, chunk_offset, chunk_size, row_group_first_row, row_group_last_row);
+          if (page_range.has_value()) {
+            if (page_range->skip.first == 0) {
+              // No dictionary page, the chunk simply starts at the first selected page
+              column_chunk_offsets[chunks.size()] += page_range->skip.second;
+            } else {
+              column_chunk_skips[chunks.size()] = page_range->skip;
+            }
+            chunk_size = page_range->read_size;
+            chunk_start_row += page_range->first_row;
+          }
+        }
 
-        chunks.insert(gpu::ColumnChunkDesc(col_meta.total_compressed_size,
+        chunks.insert(gpu::ColumnChunkDesc(chunk_size,
                                            nullptr,
                                            col_meta.num_values,
                                            schema.type,
                                            type_width,
-                                           row_group_start,
+                                           chunk_start_row,
                                            row_group_rows,
                                            schema.max_definition_level,
                                            schema.max_repetition_level,
@@ -1503,23 +2750,25 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                          io_chunk_idx,
                          chunks.size(),
                          column_chunk_offsets,
+                         column_chunk_skips,
                          chunk_source_map,
                          stream);
 
       remaining_rows -= row_group.num_rows;
     }
     assert(remaining_rows <= 0);
+    _pass->has_lists = has_lists;
 
     // Process dataset chunk pages into output columns
     const auto total_pages = count_page_headers(chunks, stream);
     if (total_pages > 0) {
-      hostdevice_vector<gpu::PageInfo> pages(total_pages, total_pages, stream);
-      rmm::device_buffer decomp_page_data;
+      _pass->pages = hostdevice_vector<gpu::PageInfo>(total_pages, total_pages, stream);
+      auto &pages  = _pass->pages;
 
       // decoding of column/page information
       decode_page_headers(chunks, pages, stream);
       if (total_decompressed_size > 0) {
-        decomp_page_data = decompress_page_data(chunks, pages, stream);
+        _pass->decomp_page_data = decompress_page_data(chunks, pages, stream);
         // Free compressed data
         for (size_t c = 0; c < chunks.size(); c++) {
           if (chunks[c].codec != parquet::Compression::UNCOMPRESSED) { page_data[c].reset(); }
@@ -1543,26 +2792,62 @@ table_with_metadata reader::impl::read(size_type skip_rows,
 
       // nesting information (sizes, etc) stored -per page-
       // note : even for flat schemas, we allocate 1 level of "nesting" info
-      hostdevice_vector<gpu::PageNestingInfo> page_nesting_info;
-      allocate_nesting_info(chunks, pages, page_nesting_info, stream);
-
-      // - compute column sizes and allocate output buffers.
-      //   important:
-      //   for nested schemas, we have to do some further preprocessing to determine:
-      //    - real column output sizes per level of nesting (in a flat schema, there's only 1 level
-      //    of
-      //      nesting and it's size is the row count)
-      //
-      // - for nested schemas, output buffer offset values per-page, per nesting-level for the
-      // purposes of decoding.
-      preprocess_columns(chunks, pages, skip_rows, num_rows, has_lists, stream);
-
-      // decoding of column data itself
-      decode_page_data(chunks, pages, page_nesting_info, skip_rows, num_rows, stream);
-
-      // create the final output cudf columns
-      for (size_t i = 0; i < _output_columns.size(); ++i) {
-        out_metadata.schema_info.push_back(column_name_info{""});
+      allocate_nesting_info(chunks, pages, _pass->page_nesting_info, stream);
+    }
+  }
+}
+
+table_with_metadata reader::impl::decode_pass(size_type min_row,
+                                              size_type num_rows,
+                                              rmm::cuda_stream_view stream)
+{
+  // Clear any per-read state left in the output buffers by a previous read
+  std::function<void(std::vector<column_buffer> &)> reset_buffers =
+    [&](std::vector<column_buffer> &cols) {
+      for (auto &col : cols) {
+        col.user_data    = 0;
+        col.null_count() = 0;
+        reset_buffers(col.children);
+      }
+    };
+  reset_buffers(_output_columns);
+
+  table_metadata out_metadata;
+
+  // output cudf columns as determined by the top level schema
+  std::vector<std::unique_ptr<column>> out_columns;
+  out_columns.reserve(_output_columns.size());
+
+  if (_pass->pages.size() > 0) {
+    auto &chunks = _pass->chunks;
+    auto &pages  = _pass->pages;
+
+    // - compute column sizes and allocate output buffers.
+    //   important:
+    //   for nested schemas, we have to do some further preprocessing to determine:
+    //    - real column output sizes per level of nesting (in a flat schema, there's only 1 level
+    //    of
+    //      nesting and it's size is the row count)
+    //
+    // - for nested schemas, output buffer offset values per-page, per nesting-level for the
+    // purposes of decoding.
+    preprocess_columns(chunks, pages, min_row, num_rows, _pass->has_lists, stream);
+
+    // decoding of column data itself
+    rmm::device_vector<string_index_pair> str_dict_index;
+    auto const delta_str_data = decode_page_data(
+      chunks, pages, _pass->page_nesting_info, min_row, num_rows, str_dict_index, stream);
+
+    // create the final output cudf columns, assembling the strings and the nested columns
+    stage_range range{"parquet::make_columns",
+                      static_cast<int64_t>(total_compressed_size(chunks, 0, chunks.size())),
+                      num_rows};
+    for (size_t i = 0; i < _output_columns.size(); ++i) {
+      out_metadata.schema_info.push_back(column_name_info{""});
+      if (_strings_to_dictionary && _output_columns[i].type.id() == type_id::STRING) {
+        out_columns.emplace_back(
+          make_dictionary_output(i, chunks, pages, &out_metadata.schema_info.back(), stream));
+      } else {
         out_columns.emplace_back(
           make_column(_output_columns[i], &out_metadata.schema_info.back(), stream, _mr));
       }
@@ -1572,7 +2857,13 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   // Create empty columns as needed (this can happen if we've ended up with no actual data to read)
   for (size_t i = out_columns.size(); i < _output_columns.size(); ++i) {
     out_metadata.schema_info.push_back(column_name_info{""});
-    out_columns.emplace_back(make_empty_column(_output_columns[i].type));
+    if (_strings_to_dictionary && _output_columns[i].type.id() == type_id::STRING) {
+      auto const keys    = make_empty_column(data_type{type_id::STRING});
+      auto const indices = make_empty_column(data_type{type_id::UINT32});
+      out_columns.emplace_back(cudf::make_dictionary_column(keys->view(), indices->view()));
+    } else {
+      out_columns.emplace_back(make_empty_column(_output_columns[i].type));
+    }
   }
 
   // Return column names (must match order of returned columns)
@@ -1588,11 +2879,356 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
 }
 
+table_with_metadata reader::impl::read(
+  size_type skip_rows,
+  size_type num_rows,
+  std::vector<std::vector<size_type>> const &row_group_list,
+  thrust::optional<std::reference_wrapper<ast::expression const>> filter,
+  rmm::cuda_stream_view stream)
+{
+  load_pass(skip_rows, num_rows, row_group_list, filter, stream);
+  auto result = decode_pass(_pass->skip_rows, _pass->num_rows, stream);
+  _pass.reset();
+  return result;
+}
+
+void reader::impl::setup_chunking(parquet_reader_options const &options,
+                                  std::size_t chunk_read_limit,
+                                  std::size_t pass_read_limit,
+                                  rmm::cuda_stream_view stream)
+{
+  auto const &requested_row_groups = options.get_row_groups();
+  auto row_groups =
+    options.get_filter().has_value()
+      ? _metadata->filter_row_groups(requested_row_groups,
+                                     options.get_filter().value().get(),
+                                     _output_columns,
+                                     _output_column_schemas,
+                                     _strings_to_categorical,
+                                     _strict_decimal_types,
+                                     stream)
+      : (requested_row_groups.empty() ? _metadata->get_all_row_groups() : requested_row_groups);
+  if (options.get_filter().has_value()) {
+    row_groups = filter_bloom_filters(row_groups, options.get_filter().value().get(), stream);
+  }
+
+  // Estimated decoded size of `num_values` values of a column
+  auto const estimate_output_size = [](type_id col_type,
+                                       SchemaElement const &schema,
+                                       std::size_t num_values,
+                                       std::size_t string_size) {
+    std::size_t size = 0;
+    if (col_type == type_id::STRING) {
+      size += string_size + num_values * sizeof(size_type);
+    } else if (is_fixed_width(data_type{col_type})) {
+      size += num_values * size_of(data_type{col_type});
+    }
+    if (schema.max_definition_level > 0) { size += (num_values + 7) / 8; }
+    if (schema.max_repetition_level > 0) { size += num_values * sizeof(size_type); }
+    return size;
+  };
+
+  // Describe each column chunk by the pages covering its row group, from the page headers. A
+  // column chunk that cannot be split at page boundaries is a single page of all its rows.
+  struct page_estimate {
+    int64_t first_row;        // First row of the page, relative to the row group
+    int64_t num_rows;         // Number of rows of the page
+    std::size_t output_size;  // Estimated decoded size of the rows of the page
+    std::size_t temp_size;    // Compressed and decompressed size of the page
+  };
+  struct column_chunk_estimate {
+    std::vector<page_estimate> pages;
+    std::size_t fixed_temp_size;  // Size of the pages read along with any data page
+  };
+  struct row_group_estimate {
+    size_type source_index;
+    size_type index;
+    size_type start_row;
+    size_type num_rows;
+    std::vector<column_chunk_estimate> columns;
+  };
+  _page_locations.clear();
+  std::vector<row_group_estimate> estimates;
+  size_type total_rows = 0;
+  for (size_t src_idx = 0; src_idx < row_groups.size(); ++src_idx) {
+    for (auto const rg_idx : row_groups[src_idx]) {
+      auto const &row_group = _metadata->get_row_group(rg_idx, src_idx);
+      auto const num_rows   = static_cast<size_type>(row_group.num_rows);
+      row_group_estimate rg_est{static_cast<size_type>(src_idx), rg_idx, total_rows, num_rows, {}};
+      for (auto const &col : _input_columns) {
+        auto const &col_meta = _metadata->get_column_metadata(rg_idx, src_idx, col.schema_idx);
+        auto const &schema   = _metadata->get_schema(col.schema_idx);
+        auto const col_type  = to_type_id(
+          schema, _strings_to_categorical, _timestamp_type.id(), _strict_decimal_types);
+        auto const is_compressed = col_meta.codec != parquet::Compression::UNCOMPRESSED;
+        auto const chunk_offset  = static_cast<size_t>(
+          (col_meta.dictionary_page_offset != 0)
+            ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
+            : col_meta.data_page_offset);
+
+        // Only the pages of flat columns are selected by rows
+        auto page_sizes =
+          (schema.max_repetition_level == 0)
+            ? read_page_sizes(
+                *_sources[src_idx], chunk_offset, col_meta.total_compressed_size, num_rows)
+            : thrust::optional<chunk_page_sizes>{};
+        column_chunk_estimate chunk_est{{}, 0};
+        if (page_sizes.has_value()) {
+          auto const &locations = page_sizes->offset_index.page_locations;
+          // Dictionary encoded strings are as long as the average dictionary entry
+          auto const dict_entry_size =
+            (page_sizes->dict_num_values > 0)
+              ? page_sizes->dict_uncompressed_size / page_sizes->dict_num_values
+              : 0;
+          chunk_est.fixed_temp_size =
+            page_sizes->dict_compressed_size +
+            (is_compressed ? page_sizes->dict_uncompressed_size : 0);
+          for (size_t p = 0; p < locations.size(); ++p) {
+            auto const next_row =
+              (p + 1 < locations.size()) ? locations[p + 1].first_row_index : num_rows;
+            auto const rows         = next_row - locations[p].first_row_index;
+            auto const uncompressed = page_sizes->uncompressed_sizes[p];
+            auto const string_size  = (dict_entry_size > 0) ? rows * dict_entry_size : uncompressed;
+            chunk_est.pages.push_back(
+              {locations[p].first_row_index,
+               rows,
+               estimate_output_size(col_type, schema, rows, string_size),
+               locations[p].compressed_page_size + (is_compressed ? uncompressed : 0)});
+          }
+          _page_locations.emplace(
+            std::make_tuple(static_cast<size_type>(src_idx), rg_idx, col.schema_idx),
+            std::move(page_sizes->offset_index));
+        } else {
+          auto const num_values = static_cast<std::size_t>(col_meta.num_values);
+          chunk_est.pages.push_back(
+            {0,
+             num_rows,
+             estimate_output_size(col_type, schema, num_values, col_meta.total_uncompressed_size),
+             static_cast<std::size_t>(col_meta.total_compressed_size) +
+               (is_compressed ? col_meta.total_uncompressed_size : 0)});
+        }
+        rg_est.columns.push_back(std::move(chunk_est));
+      }
+      estimates.push_back(std::move(rg_est));
+      total_rows += num_rows;
+    }
+  }
+
+  // The user row bounds are relative to the concatenation of the selected row groups
+  auto const window_begin = std::max(options.get_skip_rows(), 0);
+  auto const window_end   = (options.get_num_rows() < 0)
+                            ? total_rows
+                            : std::min(total_rows, window_begin + options.get_num_rows());
+
+  // Split the window into units at the first rows of all pages. A pass that starts a row group at
+  // a unit reads the dictionaries and the pages overlapping the unit, while a pass that continues
+  // into a unit of the same row group only reads the pages starting at the unit.
+  struct row_unit {
+    size_t rg;                // Index of the row group in `estimates`
+    size_type begin;          // First row, relative to the selected row groups
+    size_type end;            // Row after the last row
+    std::size_t output_size;  // Estimated decoded size of the rows
+    std::size_t start_temp_size;
+    std::size_t continue_temp_size;
+  };
+  std::vector<row_unit> units;
+  for (size_t rg = 0; rg < estimates.size(); ++rg) {
+    auto const &est     = estimates[rg];
+    auto const rg_begin = std::max(est.start_row, window_begin) - est.start_row;
+    auto const rg_end   = std::min(est.start_row + est.num_rows, window_end) - est.start_row;
+    if (rg_begin >= rg_end) { continue; }
+    std::vector<int64_t> bounds{rg_begin, rg_end};
+    for (auto const &col : est.columns) {
+      for (auto const &page : col.pages) {
+        if (page.first_row > rg_begin && page.first_row < rg_end) {
+          bounds.push_back(page.first_row);
+        }
+      }
+    }
+    std::sort(bounds.begin(), bounds.end());
+    bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+    for (size_t b = 0; b + 1 < bounds.size(); ++b) {
+      row_unit unit{rg,
+                    static_cast<size_type>(est.start_row + bounds[b]),
+                    static_cast<size_type>(est.start_row + bounds[b + 1]),
+                    0,
+                    0,
+                    0};
+      for (auto const &col : est.columns) {
+        auto const page = std::prev(std::upper_bound(
+          col.pages.begin(), col.pages.end(), bounds[b], [](int64_t row, auto const &p) {
+            return row < p.first_row;
+          }));
+        unit.output_size += page->output_size * (bounds[b + 1] - bounds[b]) / page->num_rows;
+        unit.start_temp_size += col.fixed_temp_size + page->temp_size;
+        if (page->first_row == bounds[b]) { unit.continue_temp_size += page->temp_size; }
+      }
+      units.push_back(unit);
+    }
+  }
+
+  // Greedily group consecutive units into passes within the pass limit, and the units of each
+  // pass into chunks within the chunk limit. A unit that alone exceeds the chunk limit is split
+  // into row windows; one that alone exceeds the pass limit is read on its own.
+  _pass_read_info.clear();
+  _pass.reset();
+  _current_pass  = 0;
+  _current_chunk = 0;
+  auto const make_pass = [&](size_t first_unit, size_t last_unit) {
+    auto const first_rg  = units[first_unit].rg;
+    auto const pass_base = estimates[first_rg].start_row;
+    pass_read_info pass{std::vector<std::vector<size_type>>(row_groups.size()),
+                        units[first_unit].begin - pass_base,
+                        units[last_unit - 1].end - units[first_unit].begin,
+                        {}};
+    for (auto rg = first_rg; rg <= units[last_unit - 1].rg; ++rg) {
+      pass.row_groups[estimates[rg].source_index].push_back(estimates[rg].index);
+    }
+    size_type chunk_begin = 0;
+    size_type chunk_end   = 0;
+    std::size_t chunk_out = 0;
+    auto const flush      = [&]() {
+      if (chunk_begin == chunk_end) { return; }
+      pass.chunks.emplace_back(chunk_begin - pass_base, chunk_end - chunk_begin);
+      chunk_begin = chunk_end;
+      chunk_out   = 0;
+    };
+    for (auto u = first_unit; u < last_unit; ++u) {
+      auto const &unit = units[u];
+      if (chunk_read_limit > 0 && chunk_out + unit.output_size > chunk_read_limit) { flush(); }
+      if (chunk_begin == chunk_end) { chunk_begin = chunk_end = unit.begin; }
+      if (chunk_read_limit > 0 && unit.output_size > chunk_read_limit) {
+        auto const rows           = unit.end - unit.begin;
+        auto const rows_per_chunk = static_cast<size_type>(std::max<std::size_t>(
+          1, static_cast<std::size_t>(rows) * chunk_read_limit / unit.output_size));
+        for (auto r = unit.begin; r < unit.end; r += rows_per_chunk) {
+          chunk_begin = r;
+          chunk_end   = std::min(r + rows_per_chunk, unit.end);
+          flush();
+        }
+        continue;
+      }
+      chunk_end = unit.end;
+      chunk_out += unit.output_size;
+    }
+    flush();
+    _pass_read_info.push_back(std::move(pass));
+  };
+  size_t first_unit     = 0;
+  std::size_t pass_temp = 0;
+  for (size_t u = 0; u < units.size(); ++u) {
+    auto const temp_size = (u == first_unit || units[u].rg != units[u - 1].rg)
+                             ? units[u].start_temp_size
+                             : units[u].continue_temp_size;
+    if (u > first_unit && pass_read_limit > 0 && pass_temp + temp_size > pass_read_limit) {
+      make_pass(first_unit, u);
+      first_unit = u;
+      pass_temp  = units[u].start_temp_size;
+    } else {
+      pass_temp += temp_size;
+    }
+  }
+  if (!units.empty()) { make_pass(first_unit, units.size()); }
+
+  // Always produce at least one (possibly empty) table
+  if (_pass_read_info.empty()) {
+    _pass_read_info.push_back(
+      pass_read_info{std::vector<std::vector<size_type>>(row_groups.size()), 0, 0, {{0, 0}}});
+  }
+}
+
+table_with_metadata reader::impl::read_pipelined(parquet_reader_options const &options,
+                                                 std::size_t pass_read_limit,
+                                                 rmm::cuda_stream_view stream)
+{
+  setup_chunking(options, 0, pass_read_limit, stream);
+
+  // Reads the column chunks of the row groups a batch reads whole to host memory. Chunks the
+  // sources prefer to read to device memory directly, and the pages of row groups split across
+  // batches, are left to `read_column_chunks`.
+  auto const prefetch = [this](pass_read_info const &batch) {
+    std::map<std::pair<size_type, size_t>, std::unique_ptr<datasource::buffer>> prefetched;
+    size_type rg_start = 0;
+    for (size_t src_idx = 0; src_idx < batch.row_groups.size(); ++src_idx) {
+      auto &source = *_sources[src_idx];
+      for (auto const rg_idx : batch.row_groups[src_idx]) {
+        auto const rg_rows =
+          static_cast<size_type>(_metadata->get_row_group(rg_idx, src_idx).num_rows);
+        auto const is_whole = batch.skip_rows <= rg_start &&
+                              rg_start + rg_rows <= batch.skip_rows + batch.num_rows;
+        rg_start += rg_rows;
+        if (!is_whole) { continue; }
+        for (auto const &col : _input_columns) {
+          auto const &col_meta = _metadata->get_column_metadata(rg_idx, src_idx, col.schema_idx);
+          auto const offset    = static_cast<size_t>(
+            (col_meta.dictionary_page_offset != 0)
+              ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
+              : col_meta.data_page_offset);
+          auto const size = static_cast<size_t>(col_meta.total_compressed_size);
+          if (size == 0 || offset + size > source.size() || source.is_device_read_preferred(size)) {
+            continue;
+          }
+          prefetched.emplace(std::make_pair(static_cast<size_type>(src_idx), offset),
+                             source.host_read(offset, size));
+        }
+      }
+    }
+    return prefetched;
+  };
+
+  // Read batch N + 1 on a host thread while batch N is decompressed and decoded
+  std::vector<std::unique_ptr<table>> tables;
+  table_metadata out_metadata;
+  auto next_batch = std::async(std::launch::async, prefetch, std::cref(_pass_read_info.front()));
+  while (has_next()) {
+    _prefetched_chunks = next_batch.get();
+    auto const &batch  = _pass_read_info[_current_pass++];
+    if (has_next()) {
+      next_batch =
+        std::async(std::launch::async, prefetch, std::cref(_pass_read_info[_current_pass]));
+    }
+    auto result = read(batch.skip_rows, batch.num_rows, batch.row_groups, thrust::nullopt, stream);
+    // The host copies must outlive the transfers queued on the stream
+    stream.synchronize();
+    _prefetched_chunks.clear();
+    tables.push_back(std::move(result.tbl));
+    out_metadata = std::move(result.metadata);
+  }
+
+  if (tables.size() == 1) { return {std::move(tables.front()), std::move(out_metadata)}; }
+  std::vector<table_view> views;
+  views.reserve(tables.size());
+  std::transform(tables.cbegin(), tables.cend(), std::back_inserter(views), [](auto const &tbl) {
+    return tbl->view();
+  });
+  return {cudf::detail::concatenate(views, stream, _mr), std::move(out_metadata)};
+}
+
+table_with_metadata reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(has_next(), "No more chunks to read");
+  auto const &pass = _pass_read_info[_current_pass];
+  // The pages of a pass are read and decompressed once, for its first chunk
+  if (_current_chunk == 0) {
+    load_pass(pass.skip_rows, pass.num_rows, pass.row_groups, thrust::nullopt, stream);
+  }
+  auto const &chunk = pass.chunks[_current_chunk++];
+  auto result       = decode_pass(chunk.first, chunk.second, stream);
+  if (_current_chunk == pass.chunks.size()) {
+    _pass.reset();
+    _current_chunk = 0;
+    ++_current_pass;
+  }
+  return result;
+}
+
+reader::reader() = default;
+
 // Forward to implementation
 reader::reader(std::vector<std::string> const &filepaths,
                parquet_reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(datasource::create(filepaths), options, mr))
+  : _impl(std::make_unique<impl>(datasource::create(filepaths), filepaths, options, mr))
 {
 }
 
@@ -1600,7 +3236,7 @@ reader::reader(std::vector<std::string> const &filepaths,
 reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
                parquet_reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(std::move(sources), options, mr))
+  : _impl(std::make_unique<impl>(std::move(sources), std::vector<std::string>{}, options, mr))
 {
 }
 
@@ -1611,10 +3247,37 @@ reader::~reader() = default;
 table_with_metadata reader::read(parquet_reader_options const &options,
                                  rmm::cuda_stream_view stream)
 {
-  return _impl->read(
-    options.get_skip_rows(), options.get_num_rows(), options.get_row_groups(), stream);
+  if (options.get_pipeline_read_limit() > 0) {
+    return _impl->read_pipelined(options, options.get_pipeline_read_limit(), stream);
+  }
+  return _impl->read(options.get_skip_rows(),
+                     options.get_num_rows(),
+                     options.get_row_groups(),
+                     options.get_filter(),
+                     stream);
+}
+
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::size_t pass_read_limit,
+                               std::vector<std::unique_ptr<datasource>> &&sources,
+                               parquet_reader_options const &options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource *mr)
+  : _stream(stream)
+{
+  _impl = std::make_unique<impl>(std::move(sources), std::vector<std::string>{}, options, mr);
+  _impl->setup_chunking(options, chunk_read_limit, pass_read_limit, stream);
 }
 
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk() { return _impl->read_chunk(_stream); }
+
 }  // namespace parquet
 }  // namespace detail
 }  // namespace io
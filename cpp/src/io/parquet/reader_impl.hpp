@@ -32,9 +32,13 @@
 #include <cudf/io/parquet.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_vector.hpp>
 
+#include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -57,10 +61,12 @@ class reader::impl {
    * @brief Constructor from an array of dataset sources with reader options.
    *
    * @param sources Dataset sources
+   * @param filepaths Paths of the sources, used as footer cache keys; empty bypasses the cache
    * @param options Settings for controlling reading behavior
    * @param mr Device memory resource to use for device memory allocation
    */
   explicit impl(std::vector<std::unique_ptr<datasource>> &&sources,
+                std::vector<std::string> const &filepaths,
                 parquet_reader_options const &options,
                 rmm::mr::device_memory_resource *mr);
 
@@ -70,6 +76,7 @@ class reader::impl {
    * @param skip_rows Number of rows to skip from the start
    * @param num_rows Number of rows to read
    * @param row_group_indices TODO
+   * @param filter Optional expression used to skip row groups based on their statistics
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return The set of columns along with metadata
@@ -77,9 +84,138 @@ class reader::impl {
   table_with_metadata read(size_type skip_rows,
                            size_type num_rows,
                            std::vector<std::vector<size_type>> const &row_group_indices,
+                           thrust::optional<std::reference_wrapper<ast::expression const>> filter,
                            rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Reads the rows selected by the options in batches, reading the column chunks of the
+   * next batch from the sources while the current batch is decoded
+   *
+   * @param options Settings for controlling reading behavior
+   * @param pass_read_limit Limit on the compressed and decompressed page data of each batch
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_pipelined(parquet_reader_options const &options,
+                                     std::size_t pass_read_limit,
+                                     rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Splits the rows selected by the options into passes and chunks that respect the given
+   * limits
+   *
+   * The sizes of the pages are read from their headers. The pages of a pass are read and
+   * decompressed at once, and its chunks are decoded from them; a row group that exceeds the pass
+   * limit is split at page boundaries.
+   *
+   * @param options Settings for controlling reading behavior
+   * @param chunk_read_limit Limit on the estimated decoded size of each chunk; 0 for no limit
+   * @param pass_read_limit Limit on the compressed and decompressed page data of each pass; 0 for
+   * no limit
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void setup_chunking(parquet_reader_options const &options,
+                      std::size_t chunk_read_limit,
+                      std::size_t pass_read_limit,
+                      rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns true if there are chunks left to read.
+   */
+  bool has_next() const { return _current_pass < _pass_read_info.size(); }
+
+  /**
+   * @brief Reads the next chunk computed by `setup_chunking()`.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
+
  private:
+  /**
+   * @brief Reduces a selection of row groups and rows to the pages whose statistics may satisfy
+   * a filter
+   *
+   * Uses the column index of the filter columns to split each row group at page boundaries.
+   * Row groups without a matching page are dropped, and the rows ahead of the first and after
+   * the last matching page are excluded from the row window.
+   *
+   * @param row_groups Lists of row groups to read, one per source
+   * @param filter Expression referencing the output columns by index
+   * @param[out] skip_rows Number of rows to skip from the start of the returned row groups
+   * @param[out] num_rows Number of rows to read from the returned row groups
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Lists of row groups that may contain matching rows, one per source
+   */
+  std::vector<std::vector<size_type>> filter_pages(
+    std::vector<std::vector<size_type>> const &row_groups,
+    ast::expression const &filter,
+    size_type &skip_rows,
+    size_type &num_rows,
+    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Reduces a selection of row groups to those whose bloom filters may hold the values
+   * tested for equality by a filter
+   *
+   * Only `column == literal` predicates on numeric columns are probed; row groups without a bloom
+   * filter for the column are kept.
+   *
+   * @param row_groups Lists of row groups to read, one per source
+   * @param filter Expression referencing the output columns by index
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Lists of row groups that may contain matching rows, one per source
+   */
+  std::vector<std::vector<size_type>> filter_bloom_filters(
+    std::vector<std::vector<size_type>> const &row_groups,
+    ast::expression const &filter,
+    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Reads and decompresses the pages of the row groups and rows selected by the arguments
+   * of `read()` into `_pass`
+   *
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read
+   * @param row_group_indices Lists of row groups to read, one per source
+   * @param filter Optional expression used to skip row groups based on their statistics
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void load_pass(size_type skip_rows,
+                 size_type num_rows,
+                 std::vector<std::vector<size_type>> const &row_group_indices,
+                 thrust::optional<std::reference_wrapper<ast::expression const>> filter,
+                 rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Decodes a row window of the pages loaded by `load_pass()` into columns
+   *
+   * @param min_row First row to decode, in the row numbering of the pass
+   * @param num_rows Number of rows to decode
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata decode_pass(size_type min_row,
+                                  size_type num_rows,
+                                  rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns the host copy of a byte range of a source read ahead by a pipelined read
+   *
+   * @param source_index Index of the source
+   * @param offset File offset of the range
+   * @param size Size of the range, in bytes
+   *
+   * @return Pointer to the data of the range, or nullptr if it was not read ahead
+   */
+  uint8_t const *find_prefetched(size_type source_index, size_t offset, size_t size) const;
+
   /**
    * @brief Reads compressed page data to device memory
    *
@@ -88,6 +224,8 @@ class reader::impl {
    * @param begin_chunk Index of first column chunk to read
    * @param end_chunk Index after the last column chunk to read
    * @param column_chunk_offsets File offset for all chunks
+   * @param column_chunk_skips Byte range of each chunk that is not read, as a pair of offset in
+   * the chunk and size; the bytes before and after it are read back to back
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    */
@@ -96,6 +234,7 @@ class reader::impl {
                           size_t begin_chunk,
                           size_t end_chunk,
                           const std::vector<size_t> &column_chunk_offsets,
+                          std::vector<std::pair<size_t, size_t>> const &column_chunk_skips,
                           std::vector<size_type> const &chunk_source_map,
                           rmm::cuda_stream_view stream);
 
@@ -187,14 +326,42 @@ class reader::impl {
    * @param page_nesting Page nesting array
    * @param min_row Minimum number of rows from start
    * @param total_rows Number of rows to output
+   * @param[out] str_dict_index Index of the entries of the string dictionaries of all chunks,
+   * pointed to by the chunk descriptors
    * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Device buffer holding the strings reconstructed from DELTA_BYTE_ARRAY pages; it
+   * must outlive the creation of the output columns
+   */
+  rmm::device_buffer decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+                                      hostdevice_vector<gpu::PageInfo> &pages,
+                                      hostdevice_vector<gpu::PageNestingInfo> &page_nesting,
+                                      size_t min_row,
+                                      size_t total_rows,
+                                      rmm::device_vector<string_index_pair> &str_dict_index,
+                                      rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Creates a dictionary column from a decoded top-level string column
+   *
+   * When every data page of the column is dictionary encoded, the keys are built from the
+   * dictionary entries of its chunks and the rows are mapped to them without building a strings
+   * column.
+   *
+   * @param out_col_idx Index of the output column
+   * @param chunks List of column chunk descriptors
+   * @param pages List of page information
+   * @param schema_info Output column name information
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The dictionary column
    */
-  void decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
-                        hostdevice_vector<gpu::PageInfo> &pages,
-                        hostdevice_vector<gpu::PageNestingInfo> &page_nesting,
-                        size_t min_row,
-                        size_t total_rows,
-                        rmm::cuda_stream_view stream);
+  std::unique_ptr<column> make_dictionary_output(
+    size_t out_col_idx,
+    hostdevice_vector<gpu::ColumnChunkDesc> const &chunks,
+    hostdevice_vector<gpu::PageInfo> const &pages,
+    column_name_info *schema_info,
+    rmm::cuda_stream_view stream);
 
  private:
   rmm::mr::device_memory_resource *_mr = nullptr;
@@ -209,8 +376,47 @@ class reader::impl {
   std::vector<int> _output_column_schemas;
 
   bool _strings_to_categorical = false;
+  bool _strings_to_dictionary  = false;
   data_type _timestamp_type{type_id::EMPTY};
   bool _strict_decimal_types = false;
+
+  /**
+   * @brief Row groups and row window whose pages are read and decompressed by a single pass, and
+   * the row windows of the chunks decoded from them
+   *
+   * All row windows are relative to the first row of the first row group in `row_groups`.
+   */
+  struct pass_read_info {
+    std::vector<std::vector<size_type>> row_groups;
+    size_type skip_rows;
+    size_type num_rows;
+    std::vector<std::pair<size_type, size_type>> chunks;  // skip_rows and num_rows of each chunk
+  };
+  std::vector<pass_read_info> _pass_read_info;
+  std::size_t _current_pass  = 0;
+  std::size_t _current_chunk = 0;  // Index of the next chunk within the current pass
+
+  /**
+   * @brief Column chunks and decompressed pages loaded by `load_pass()`
+   */
+  struct pass_data {
+    hostdevice_vector<gpu::ColumnChunkDesc> chunks;
+    hostdevice_vector<gpu::PageInfo> pages;
+    hostdevice_vector<gpu::PageNestingInfo> page_nesting_info;
+    std::vector<std::unique_ptr<datasource::buffer>> page_data;
+    rmm::device_buffer decomp_page_data;
+    bool has_lists      = false;
+    size_type skip_rows = 0;  // Row window of the pass, as selected by `select_row_groups()`
+    size_type num_rows  = 0;
+  };
+  std::unique_ptr<pass_data> _pass;
+
+  // Page locations of the flat column chunks walked by `setup_chunking()`, by source index, row
+  // group index and schema index; used instead of the offset index of the file
+  std::map<std::tuple<size_type, size_type, int>, OffsetIndex> _page_locations;
+
+  // Column chunks of the current batch of a pipelined read, by source index and file offset
+  std::map<std::pair<size_type, size_t>, std::unique_ptr<datasource::buffer>> _prefetched_chunks;
 };
 
 }  // namespace parquet
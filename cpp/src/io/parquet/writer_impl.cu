@@ -22,22 +22,40 @@
 #include "writer_impl.hpp"
 
 #include <io/utilities/column_utils.cuh>
+#include <io/utilities/pinned_memory_pool.hpp>
 #include "compact_protocol_writer.hpp"
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/io/memory_resource.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
 
 #include <algorithm>
+#include <cmath>
+#include <cstdio>
 #include <cstring>
+#include <future>
+#include <limits>
 #include <numeric>
 #include <utility>
 
@@ -49,12 +67,6 @@ using namespace cudf::io::parquet;
 using namespace cudf::io;
 
 namespace {
-/**
- * @brief Helper for pinned host memory
- */
-template <typename T>
-using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
-
 /**
  * @brief Function that translates GDF compression to parquet compression
  */
@@ -63,6 +75,8 @@ parquet::Compression to_parquet_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return parquet::Compression::SNAPPY;
+    case compression_type::GZIP: return parquet::Compression::GZIP;
+    case compression_type::ZSTD: return parquet::Compression::ZSTD;
     case compression_type::NONE: return parquet::Compression::UNCOMPRESSED;
     default:
       CUDF_EXPECTS(false, "Unsupported compression type");
@@ -70,6 +84,130 @@ parquet::Compression to_parquet_compression(compression_type compression)
   }
 }
 
+/**
+ * @brief Returns whether a row of sorted keys starts a partition.
+ */
+struct is_partition_start {
+  row_equality_comparator<true> equal;
+
+  __device__ bool operator()(size_type row) const { return row == 0 or not equal(row, row - 1); }
+};
+
+/**
+ * @brief Returns the first row of each partition of the sorted `keys`.
+ */
+std::vector<size_type> partition_starts(table_view const &keys, rmm::cuda_stream_view stream)
+{
+  auto const d_keys = table_device_view::create(keys, stream);
+  rmm::device_uvector<size_type> d_starts(keys.num_rows(), stream);
+  auto const starts_end = thrust::copy_if(rmm::exec_policy(stream),
+                                          thrust::make_counting_iterator<size_type>(0),
+                                          thrust::make_counting_iterator(keys.num_rows()),
+                                          d_starts.begin(),
+                                          is_partition_start{{*d_keys, *d_keys, true}});
+  d_starts.resize(thrust::distance(d_starts.begin(), starts_end), stream);
+  return cudf::detail::make_std_vector_sync(d_starts, stream);
+}
+
+/**
+ * @brief Converts partition keys to their strings.
+ */
+struct partition_values_fn {
+  template <typename T>
+  std::unique_ptr<column> operator()(column_view const &keys, rmm::cuda_stream_view stream)
+  {
+    auto const mr = rmm::mr::get_current_device_resource();
+    if constexpr (std::is_same<T, bool>::value) {
+      return cudf::strings::detail::from_booleans(
+        keys, string_scalar("true"), string_scalar("false"), stream, mr);
+    } else if constexpr (std::is_integral<T>::value) {
+      return cudf::strings::detail::from_integers(keys, stream, mr);
+    } else if constexpr (std::is_same<T, string_view>::value) {
+      return std::make_unique<column>(keys, stream, mr);
+    } else {
+      CUDF_FAIL("Unsupported partition column type");
+    }
+  }
+};
+
+/**
+ * @brief Escapes the characters of a partition value that are special in paths, as Hive does.
+ */
+std::string escape_partition_value(std::string const &value)
+{
+  // Hive writes null and empty values as the default partition
+  if (value.empty()) { return "__HIVE_DEFAULT_PARTITION__"; }
+  constexpr char special_chars[] = "\"#%'*/:=?\\{[]^";
+  std::string escaped;
+  for (unsigned char const c : value) {
+    if (c < 0x20 or c == 0x7F or std::strchr(special_chars, c) != nullptr) {
+      char hex[4];
+      std::snprintf(hex, sizeof(hex), "%%%02X", c);
+      escaped += hex;
+    } else {
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
+/**
+ * @brief Returns the path of the file of each partition, relative to the root of the dataset.
+ *
+ * @param keys Sorted partition keys
+ * @param starts First row of each partition
+ * @param names Names of the partition columns
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::vector<std::string> partition_paths(table_view const &keys,
+                                         std::vector<size_type> const &starts,
+                                         std::vector<std::string> const &names,
+                                         rmm::cuda_stream_view stream)
+{
+  if (starts.empty()) { return {}; }
+  auto const num_partitions = static_cast<size_type>(starts.size());
+  auto const d_starts       = cudf::detail::make_device_uvector_async(starts, stream);
+  auto const partition_keys =
+    cudf::detail::gather(keys,
+                         column_view(data_type{type_id::INT32}, num_partitions, d_starts.data()),
+                         out_of_bounds_policy::DONT_CHECK,
+                         cudf::detail::negative_index_policy::NOT_ALLOWED,
+                         stream,
+                         rmm::mr::get_current_device_resource());
+
+  std::vector<std::string> paths(num_partitions);
+  for (size_type c = 0; c < keys.num_columns(); ++c) {
+    auto const key_column = partition_keys->get_column(c).view();
+    auto const values =
+      type_dispatcher(key_column.type(), partition_values_fn{}, key_column, stream);
+    strings_column_view const strings(values->view());
+    auto const offsets = cudf::detail::make_std_vector_async(
+      device_span<offset_type const>(strings.offsets().data<offset_type>(), num_partitions + 1),
+      stream);
+    auto const chars = cudf::detail::make_std_vector_async(
+      device_span<char const>(strings.chars().data<char>(), strings.chars_size()), stream);
+    auto const null_mask =
+      values->nullable()
+        ? cudf::detail::make_std_vector_sync(
+            device_span<bitmask_type const>(values->view().null_mask(),
+                                            num_bitmask_words(num_partitions)),
+            stream)
+        : std::vector<bitmask_type>{};
+    stream.synchronize();
+    for (size_type p = 0; p < num_partitions; ++p) {
+      auto const is_null = not null_mask.empty() and not bit_is_set(null_mask.data(), p);
+      auto const value   = is_null ? std::string{}
+                                   : std::string(chars.begin() + offsets[p],
+                                                 chars.begin() + offsets[p + 1]);
+      paths[p] += names[c] + "=" + escape_partition_value(value) + "/";
+    }
+  }
+  for (auto &path : paths) {
+    path += "part-0.parquet";
+  }
+  return paths;
+}
+
 }  // namespace
 
 struct linked_column_view;
@@ -135,6 +273,8 @@ struct schema_tree_node : public SchemaElement {
   LinkedColPtr leaf_column;
   statistics_dtype stats_dtype;
   int32_t ts_scale;
+  column_encoding requested_encoding = column_encoding::AUTO;
+  bool bloom_filter                  = false;
 
   // TODO(fut): Think about making schema a class that holds a vector of schema_tree_nodes. The
   // function construct_schema_tree could be its constructor. It can have method to get the per
@@ -359,7 +499,7 @@ struct leaf_schema_fn {
   template <typename T>
   std::enable_if_t<cudf::is_dictionary<T>(), void> operator()()
   {
-    CUDF_FAIL("Dictionary columns are not supported for writing");
+    CUDF_FAIL("Dictionary columns nested in lists or structs are not supported for writing");
   }
 };
 
@@ -470,6 +610,27 @@ std::vector<schema_tree_node> construct_schema_tree(LinkedColVector const &linke
         cudf::type_dispatcher(col->type(),
                               leaf_schema_fn{col_schema, col, col_meta, timestamp_is_int96});
 
+        col_schema.requested_encoding = col_meta.get_encoding();
+        switch (col_schema.requested_encoding) {
+          case column_encoding::DICTIONARY:
+            CUDF_EXPECTS(col_schema.type != Type::BOOLEAN,
+                         "Dictionary encoding is not supported for boolean columns");
+            break;
+          case column_encoding::DELTA_BINARY_PACKED:
+            CUDF_EXPECTS(col_schema.type == Type::INT32 || col_schema.type == Type::INT64,
+                         "DELTA_BINARY_PACKED encoding is only supported for integer columns");
+            break;
+          case column_encoding::BYTE_STREAM_SPLIT:
+            CUDF_EXPECTS(col_schema.type == Type::FLOAT || col_schema.type == Type::DOUBLE,
+                         "BYTE_STREAM_SPLIT encoding is only supported for float columns");
+            break;
+          default: break;
+        }
+        col_schema.bloom_filter = col_meta.is_enabled_bloom_filter();
+        CUDF_EXPECTS(not col_schema.bloom_filter or
+                       (col_schema.type != Type::BOOLEAN and col_schema.type != Type::INT96),
+                     "Bloom filters are not supported for boolean and INT96 columns");
+
         col_schema.repetition_type = col_nullable ? OPTIONAL : REQUIRED;
         col_schema.name = (schema[parent_idx].name == "list") ? "element" : col_meta.get_name();
         col_schema.parent_idx  = parent_idx;
@@ -516,6 +677,9 @@ struct parquet_column_view {
   uint8_t max_rep_level() const noexcept { return _max_rep_level; }
   bool is_list() const noexcept { return _is_list; }
 
+  column_encoding requested_encoding() const noexcept { return schema_node.requested_encoding; }
+  bool bloom_filter() const noexcept { return schema_node.bloom_filter; }
+
   // Dictionary related member functions
   uint32_t *get_dict_data() { return (_dict_data.size()) ? _dict_data.data() : nullptr; }
   uint32_t *get_dict_index() { return (_dict_index.size()) ? _dict_index.data() : nullptr; }
@@ -689,8 +853,16 @@ gpu::parquet_column_device_view parquet_column_view::get_device_view(rmm::cuda_s
   desc.stats_dtype = schema_node.stats_dtype;
   desc.ts_scale    = schema_node.ts_scale;
 
+  switch (requested_encoding()) {
+    case column_encoding::DELTA_BINARY_PACKED: desc.encoding = Encoding::DELTA_BINARY_PACKED; break;
+    case column_encoding::BYTE_STREAM_SPLIT: desc.encoding = Encoding::BYTE_STREAM_SPLIT; break;
+    default: desc.encoding = Encoding::PLAIN; break;
+  }
+
   // TODO (dm): Enable dictionary for list and struct after refactor
-  if (physical_type() != BOOLEAN && physical_type() != UNDEFINED_TYPE &&
+  bool const allow_dictionary = requested_encoding() == column_encoding::AUTO ||
+                                requested_encoding() == column_encoding::DICTIONARY;
+  if (allow_dictionary && physical_type() != BOOLEAN && physical_type() != UNDEFINED_TYPE &&
       !is_nested(cudf_col.type())) {
     alloc_dictionary(_data_count, stream);
     desc.dict_index = get_dict_index();
@@ -717,19 +889,96 @@ gpu::parquet_column_device_view parquet_column_view::get_device_view(rmm::cuda_s
   return desc;
 }
 
+/**
+ * @brief Builds the OffsetIndex of an encoded column chunk
+ *
+ * @param pages Encoded pages of the column chunk, dictionary page first
+ * @param ck Encoded column chunk
+ * @param chunk_offset File offset of the column chunk
+ *
+ * @return The page locations of the data pages of the column chunk
+ */
+OffsetIndex build_offset_index(gpu::EncPage const *pages,
+                               gpu::EncColumnChunk const &ck,
+                               size_t chunk_offset)
+{
+  OffsetIndex offset_index;
+  auto page_offset = static_cast<int64_t>(chunk_offset);
+  for (uint32_t p = 0; p < ck.num_pages; p++) {
+    auto const page_size = static_cast<int32_t>(pages[p].hdr_size + pages[p].max_data_size);
+    if (pages[p].page_type == PageType::DATA_PAGE) {
+      offset_index.page_locations.push_back(
+        PageLocation{page_offset, page_size, pages[p].start_row - ck.start_row});
+    }
+    page_offset += page_size;
+  }
+  return offset_index;
+}
+
+/**
+ * @brief Builds the ColumnIndex of an encoded column chunk from the statistics in its page headers
+ *
+ * @param pages Encoded pages of the column chunk, dictionary page first
+ * @param ck Encoded column chunk
+ * @param chunk_data Host copy of the column chunk as written to the file
+ *
+ * @return The per-page statistics, or an empty ColumnIndex if a page has no min/max statistics
+ */
+ColumnIndex build_column_index(gpu::EncPage const *pages,
+                               gpu::EncColumnChunk const &ck,
+                               uint8_t const *chunk_data)
+{
+  ColumnIndex column_index;
+  size_t page_offset = 0;
+  for (uint32_t p = 0; p < ck.num_pages; p++) {
+    if (pages[p].page_type == PageType::DATA_PAGE) {
+      PageHeader header;
+      CompactProtocolReader cp(chunk_data + page_offset, pages[p].hdr_size);
+      if (!cp.read(&header)) { return ColumnIndex{}; }
+      auto &stats          = header.data_page_header.statistics;
+      bool const null_page = stats.null_count >= static_cast<int64_t>(pages[p].num_leaf_values);
+      // A page with values but without min/max can't be described by the index
+      if (!null_page && stats.min_value.empty() && stats.max_value.empty()) {
+        return ColumnIndex{};
+      }
+      column_index.null_pages.push_back(null_page);
+      column_index.min_values.push_back(null_page ? std::vector<uint8_t>{} : stats.min_value);
+      column_index.max_values.push_back(null_page ? std::vector<uint8_t>{} : stats.max_value);
+      column_index.null_counts.push_back(std::max<int64_t>(stats.null_count, 0));
+    }
+    page_offset += pages[p].hdr_size + pages[p].max_data_size;
+  }
+  return column_index;
+}
+
+/**
+ * @brief Returns the number of blocks of a split block bloom filter sized for a number of
+ * distinct values and a false positive probability
+ */
+uint32_t bloom_filter_num_blocks(size_t num_distinct, double fpp)
+{
+  // Optimal number of bits with the eight hash functions of split block filters
+  auto const num_bits   = -8.0 * num_distinct / std::log(1.0 - std::pow(fpp, 1.0 / 8));
+  auto const block_bits = 8.0 * gpu::bloom_filter_block_words * sizeof(uint32_t);
+  auto const max_blocks = 8.0 * gpu::bloom_filter_max_bytes / block_bits;
+  auto const num_blocks = std::max(std::ceil(num_bits / block_bits), 1.0);
+  return static_cast<uint32_t>(std::min(num_blocks, max_blocks));
+}
+
 void writer::impl::init_page_fragments(hostdevice_vector<gpu::PageFragment> &frag,
                                        hostdevice_vector<gpu::parquet_column_device_view> &col_desc,
+                                       hostdevice_vector<uint32_t> &fragment_starts,
                                        uint32_t num_columns,
                                        uint32_t num_fragments,
-                                       uint32_t num_rows,
-                                       uint32_t fragment_size)
+                                       uint32_t num_rows)
 {
+  stage_range range{"parquet::init_page_fragments", -1, num_rows};
+  fragment_starts.host_to_device(stream);
   gpu::InitPageFragments(frag.device_ptr(),
                          col_desc.device_ptr(),
+                         fragment_starts.device_ptr(),
                          num_fragments,
                          num_columns,
-                         fragment_size,
-                         num_rows,
                          stream);
   frag.device_to_host(stream, true);
 }
@@ -763,6 +1012,7 @@ void writer::impl::build_chunk_dictionaries(
   uint32_t num_columns,
   uint32_t num_dictionaries)
 {
+  stage_range range{"parquet::build_dictionaries", -1};
   size_t dict_scratch_size = (size_t)num_dictionaries * gpu::kDictScratchSize;
   auto dict_scratch        = cudf::detail::make_zeroed_device_uvector_async<uint32_t>(
     dict_scratch_size / sizeof(uint32_t), stream);
@@ -771,12 +1021,15 @@ void writer::impl::build_chunk_dictionaries(
                               dict_scratch.data(),
                               dict_scratch_size,
                               num_rowgroups * num_columns,
+                              static_cast<uint32_t>(std::min<size_t>(
+                                max_dictionary_size_, std::numeric_limits<uint32_t>::max())),
                               stream);
   gpu::InitEncoderPages(chunks.device_ptr(),
                         nullptr,
                         col_desc.device_ptr(),
                         num_rowgroups,
                         num_columns,
+                        static_cast<uint32_t>(target_page_size_),
                         nullptr,
                         nullptr,
                         stream);
@@ -800,6 +1053,7 @@ void writer::impl::init_encoder_pages(hostdevice_vector<gpu::EncColumnChunk> &ch
                    col_desc.device_ptr(),
                    num_rowgroups,
                    num_columns,
+                   static_cast<uint32_t>(target_page_size_),
                    (num_stats_bfr) ? page_stats_mrg.data() : nullptr,
                    (num_stats_bfr > num_pages) ? page_stats_mrg.data() + num_pages : nullptr,
                    stream);
@@ -828,12 +1082,24 @@ void writer::impl::encode_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
                                 const statistics_chunk *page_stats,
                                 const statistics_chunk *chunk_stats)
 {
+  auto const first_chunk = first_rowgroup * num_columns;
+  int64_t batch_bytes     = 0;
+  for (auto c = first_chunk; c < first_chunk + rowgroups_in_batch * num_columns; ++c) {
+    batch_bytes += chunks[c].bfr_size;
+  }
+  stage_range range{"parquet::encode_pages", batch_bytes};
   gpu::EncodePages(
     pages, chunks.device_ptr(), pages_in_batch, first_page_in_batch, comp_in, comp_out, stream);
   switch (compression_) {
     case parquet::Compression::SNAPPY:
       CUDA_TRY(gpu_snap(comp_in, comp_out, pages_in_batch, stream));
       break;
+    case parquet::Compression::GZIP:
+      CUDA_TRY(gpu_deflate(comp_in, comp_out, pages_in_batch, 1, stream));
+      break;
+    case parquet::Compression::ZSTD:
+      CUDA_TRY(gpu_zstd(comp_in, comp_out, pages_in_batch, stream));
+      break;
     default: break;
   }
   // TBD: Not clear if the official spec actually allows dynamically turning off compression at the
@@ -874,13 +1140,16 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     compression_(to_parquet_compression(options.get_compression())),
     stats_granularity_(options.get_stats_level()),
     int96_timestamps(options.is_enabled_int96_timestamps()),
-    out_sink_(std::move(sink)),
+    bloom_filter_fpp_(options.get_bloom_filter_fpp()),
+    max_dictionary_size_(options.get_max_dictionary_size()),
+    target_page_size_(
+      std::min<size_t>(options.get_max_page_size_bytes(), std::numeric_limits<uint32_t>::max())),
     single_write_mode(mode == SingleWriteMode::YES)
 {
   if (options.get_metadata()) {
     table_meta = std::make_unique<table_input_metadata>(*options.get_metadata());
   }
-  init_state();
+  add_file(std::move(sink));
 }
 
 writer::impl::impl(std::unique_ptr<data_sink> sink,
@@ -893,30 +1162,120 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     compression_(to_parquet_compression(options.get_compression())),
     stats_granularity_(options.get_stats_level()),
     int96_timestamps(options.is_enabled_int96_timestamps()),
+    bloom_filter_fpp_(options.get_bloom_filter_fpp()),
+    max_dictionary_size_(options.get_max_dictionary_size()),
+    target_page_size_(
+      std::min<size_t>(options.get_max_page_size_bytes(), std::numeric_limits<uint32_t>::max())),
     single_write_mode(mode == SingleWriteMode::YES),
-    out_sink_(std::move(sink))
+    partition_columns_(options.get_partition_columns()),
+    partition_sinks_(options.get_partition_sinks())
 {
   if (options.get_metadata()) {
     table_meta = std::make_unique<table_input_metadata>(*options.get_metadata());
   }
-  init_state();
+  if (partition_columns_.empty()) {
+    add_file(std::move(sink));
+    return;
+  }
+
+  CUDF_EXPECTS(partition_sinks_ != nullptr,
+               "Partitioned writing requires a partition sink factory");
+  auto sorted_columns = partition_columns_;
+  std::sort(sorted_columns.begin(), sorted_columns.end());
+  CUDF_EXPECTS(sorted_columns.front() >= 0 and
+                 std::adjacent_find(sorted_columns.begin(), sorted_columns.end()) ==
+                   sorted_columns.end(),
+               "Invalid partition columns");
+  // The metadata describes all the columns, but the partition columns are not written to the files
+  for (auto const col : partition_columns_) {
+    std::string name;
+    if (table_meta) {
+      CUDF_EXPECTS(static_cast<size_t>(col) < table_meta->column_metadata.size(),
+                   "Partition column index out of range of the metadata");
+      name = table_meta->column_metadata[col].get_name();
+    }
+    partition_names_.push_back(name.empty() ? "_col" + std::to_string(col) : name);
+  }
+  if (table_meta) {
+    std::for_each(sorted_columns.rbegin(), sorted_columns.rend(), [&](auto col) {
+      table_meta->column_metadata.erase(table_meta->column_metadata.begin() + col);
+    });
+  }
 }
 
 writer::impl::~impl() { close(); }
 
-void writer::impl::init_state()
+void writer::impl::add_file(std::unique_ptr<data_sink> sink)
 {
   // Write file header
   file_header_s fhdr;
   fhdr.magic = parquet_magic;
-  out_sink_->host_write(&fhdr, sizeof(fhdr));
-  current_chunk_offset = sizeof(file_header_s);
+  sink->host_write(&fhdr, sizeof(fhdr));
+  files_.emplace_back();
+  files_.back().sink                 = std::move(sink);
+  files_.back().current_chunk_offset = sizeof(file_header_s);
 }
 
-void writer::impl::write(table_view const &table)
+void writer::impl::write(table_view const &input)
 {
   CUDF_EXPECTS(not closed, "Data has already been flushed to out and closed");
 
+  // Dictionary columns are written as their decoded values
+  auto const decoded = decode_dictionary_columns(input, stream);
+  auto const &table  = decoded.first;
+
+  if (partition_columns_.empty()) {
+    write_partitions(table, {{0, 0, table.num_rows()}});
+  } else {
+    write_partitioned(table);
+  }
+}
+
+void writer::impl::write_partitioned(table_view const &table)
+{
+  CUDF_EXPECTS(std::all_of(partition_columns_.begin(),
+                           partition_columns_.end(),
+                           [&](auto col) { return col < table.num_columns(); }),
+               "Partition column index out of range");
+  std::vector<size_type> value_columns;
+  for (size_type i = 0; i < table.num_columns(); ++i) {
+    if (std::find(partition_columns_.begin(), partition_columns_.end(), i) ==
+        partition_columns_.end()) {
+      value_columns.push_back(i);
+    }
+  }
+  CUDF_EXPECTS(not value_columns.empty(), "All the columns cannot be partition columns");
+
+  // Sort the rows once, so that each partition is a range of rows
+  stage_range range{"parquet::partition", -1, table.num_rows()};
+  auto const order  = cudf::detail::stable_sorted_order(
+    table.select(partition_columns_), {}, {}, stream, rmm::mr::get_current_device_resource());
+  auto const sorted = cudf::detail::gather(table,
+                                           order->view(),
+                                           out_of_bounds_policy::DONT_CHECK,
+                                           cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                           stream,
+                                           rmm::mr::get_current_device_resource());
+  auto const keys   = sorted->select(partition_columns_);
+  auto const starts = partition_starts(keys, stream);
+  auto const paths  = partition_paths(keys, starts, partition_names_, stream);
+
+  std::vector<partition_rows> partitions;
+  for (size_t p = 0; p < starts.size(); ++p) {
+    auto file_it = partition_files_.find(paths[p]);
+    if (file_it == partition_files_.end()) {
+      add_file(partition_sinks_(paths[p]));
+      file_it = partition_files_.emplace(paths[p], files_.size() - 1).first;
+    }
+    auto const end_row = p + 1 < starts.size() ? starts[p + 1] : table.num_rows();
+    partitions.push_back({file_it->second, starts[p], end_row - starts[p]});
+  }
+  write_partitions(sorted->select(value_columns), partitions);
+}
+
+void writer::impl::write_partitions(table_view const &table,
+                                    std::vector<partition_rows> const &partitions)
+{
   size_type num_rows = table.num_rows();
 
   if (not table_meta) { table_meta = std::make_unique<table_input_metadata>(table); }
@@ -941,6 +1300,12 @@ void writer::impl::write(table_view const &table)
   for (schema_tree_node const &schema_node : schema_tree) {
     if (schema_node.leaf_column) { parquet_columns.emplace_back(schema_node, schema_tree, stream); }
   }
+  for (auto const &pcol : parquet_columns) {
+    CUDF_EXPECTS(not pcol.bloom_filter() or pcol.max_rep_level() == 0,
+                 "Bloom filters are not supported for columns nested in lists");
+    CUDF_EXPECTS(not pcol.bloom_filter() or (bloom_filter_fpp_ > 0 and bloom_filter_fpp_ < 1),
+                 "Bloom filter false positive probability must be between 0 and 1");
+  }
 
   // Mass allocation of column_device_views for each parquet_column_view
   std::vector<column_view> cudf_cols;
@@ -951,25 +1316,28 @@ void writer::impl::write(table_view const &table)
 
   std::vector<SchemaElement> this_table_schema(schema_tree.begin(), schema_tree.end());
 
-  if (md.version == 0) {
-    md.version  = 1;
-    md.num_rows = num_rows;
-    md.column_order_listsize =
-      (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? num_columns : 0;
-    std::transform(table_meta->user_data.begin(),
-                   table_meta->user_data.end(),
-                   std::back_inserter(md.key_value_metadata),
-                   [](auto const &kv) {
-                     return KeyValue{kv.first, kv.second};
-                   });
-    md.schema = this_table_schema;
-  } else {
-    // verify the user isn't passing mismatched tables
-    CUDF_EXPECTS(md.schema == this_table_schema,
-                 "Mismatch in schema between multiple calls to write_chunk");
+  for (auto const &partition : partitions) {
+    auto &md = files_[partition.file].md;
+    if (md.version == 0) {
+      md.version  = 1;
+      md.num_rows = partition.num_rows;
+      md.column_order_listsize =
+        (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? num_columns : 0;
+      std::transform(table_meta->user_data.begin(),
+                     table_meta->user_data.end(),
+                     std::back_inserter(md.key_value_metadata),
+                     [](auto const &kv) {
+                       return KeyValue{kv.first, kv.second};
+                     });
+      md.schema = this_table_schema;
+    } else {
+      // verify the user isn't passing mismatched tables
+      CUDF_EXPECTS(md.schema == this_table_schema,
+                   "Mismatch in schema between multiple calls to write_chunk");
 
-    // increment num rows
-    md.num_rows += num_rows;
+      // increment num rows
+      md.num_rows += partition.num_rows;
+    }
   }
   // Create table_device_view so that corresponding column_device_view data
   // can be written into col_desc members
@@ -996,7 +1364,18 @@ void writer::impl::write(table_view const &table)
   static_assert(fragment_size <= max_page_fragment_size,
                 "fragment size cannot be greater than max_page_fragment_size");
 
-  uint32_t num_fragments = (uint32_t)((num_rows + fragment_size - 1) / fragment_size);
+  // Fragments never span two partitions, so that row groups can end at partition boundaries
+  uint32_t num_fragments = 0;
+  for (auto const &partition : partitions) {
+    num_fragments += (partition.num_rows + fragment_size - 1) / fragment_size;
+  }
+  hostdevice_vector<uint32_t> fragment_starts(num_fragments + 1, stream);
+  for (uint32_t p = 0, f = 0; p < partitions.size(); p++) {
+    for (size_type row = 0; row < partitions[p].num_rows; row += fragment_size) {
+      fragment_starts[f++] = partitions[p].start_row + row;
+    }
+  }
+  fragment_starts[num_fragments] = num_rows;
   hostdevice_vector<gpu::PageFragment> fragments(num_columns * num_fragments, stream);
 
   if (fragments.size() != 0) {
@@ -1005,38 +1384,49 @@ void writer::impl::write(table_view const &table)
     leaf_column_views = create_leaf_column_device_views<gpu::parquet_column_device_view>(
       col_desc, *parent_column_table_device_view, stream);
 
-    init_page_fragments(fragments, col_desc, num_columns, num_fragments, num_rows, fragment_size);
+    init_page_fragments(fragments, col_desc, fragment_starts, num_columns, num_fragments, num_rows);
   }
 
-  size_t global_rowgroup_base = md.row_groups.size();
+  // The row groups written by this call, in the order they are encoded
+  struct rowgroup_info {
+    size_t file;              // index of the output file
+    size_t index;             // index of the row group in the output file
+    uint32_t first_fragment;  // first fragment of the row group
+    uint32_t num_fragments;   // number of fragments of the row group
+  };
+  std::vector<rowgroup_info> rowgroups;
+  auto const add_rowgroup = [&](size_t file, uint32_t first_fragment, uint32_t end_fragment) {
+    auto &md = files_[file].md;
+    rowgroups.push_back(
+      {file, md.row_groups.size(), first_fragment, end_fragment - first_fragment});
+    // update schema
+    md.row_groups.resize(md.row_groups.size() + 1);
+    md.row_groups.back().num_rows =
+      fragment_starts[end_fragment] - fragment_starts[first_fragment];
+  };
 
-  // Decide row group boundaries based on uncompressed data size
-  size_t rowgroup_size   = 0;
-  uint32_t num_rowgroups = 0;
-  for (uint32_t f = 0, global_r = global_rowgroup_base, rowgroup_start = 0; f < num_fragments;
-       f++) {
-    size_t fragment_data_size = 0;
-    // Replace with STL algorithm to transform and sum
-    for (auto i = 0; i < num_columns; i++) {
-      fragment_data_size += fragments[i * num_fragments + f].fragment_data_size;
-    }
-    if (f > rowgroup_start && (rowgroup_size + fragment_data_size > max_rowgroup_size_ ||
-                               (f + 1 - rowgroup_start) * fragment_size > max_rowgroup_rows_)) {
-      // update schema
-      md.row_groups.resize(md.row_groups.size() + 1);
-      md.row_groups[global_r++].num_rows = (f - rowgroup_start) * fragment_size;
-      num_rowgroups++;
-      rowgroup_start = f;
-      rowgroup_size  = 0;
-    }
-    rowgroup_size += fragment_data_size;
-    if (f + 1 == num_fragments) {
-      // update schema
-      md.row_groups.resize(md.row_groups.size() + 1);
-      md.row_groups[global_r++].num_rows = num_rows - rowgroup_start * fragment_size;
-      num_rowgroups++;
+  // Decide row group boundaries based on uncompressed data size, within each partition
+  for (uint32_t p = 0, f = 0; p < partitions.size(); p++) {
+    uint32_t const end_fragment =
+      f + (partitions[p].num_rows + fragment_size - 1) / fragment_size;
+    size_t rowgroup_size = 0;
+    for (uint32_t rowgroup_start = f; f < end_fragment; f++) {
+      size_t fragment_data_size = 0;
+      // Replace with STL algorithm to transform and sum
+      for (auto i = 0; i < num_columns; i++) {
+        fragment_data_size += fragments[i * num_fragments + f].fragment_data_size;
+      }
+      if (f > rowgroup_start && (rowgroup_size + fragment_data_size > max_rowgroup_size_ ||
+                                 (f + 1 - rowgroup_start) * fragment_size > max_rowgroup_rows_)) {
+        add_rowgroup(partitions[p].file, rowgroup_start, f);
+        rowgroup_start = f;
+        rowgroup_size  = 0;
+      }
+      rowgroup_size += fragment_data_size;
+      if (f + 1 == end_fragment) { add_rowgroup(partitions[p].file, rowgroup_start, f + 1); }
     }
   }
+  uint32_t num_rowgroups = rowgroups.size();
 
   // Allocate column chunks and gather fragment statistics
   rmm::device_uvector<statistics_chunk> frag_stats(0, stream);
@@ -1051,12 +1441,13 @@ void writer::impl::write(table_view const &table)
   uint32_t num_chunks = num_rowgroups * num_columns;
   hostdevice_vector<gpu::EncColumnChunk> chunks(num_chunks, stream);
   uint32_t num_dictionaries = 0;
-  for (uint32_t r = 0, global_r = global_rowgroup_base, f = 0, start_row = 0; r < num_rowgroups;
-       r++, global_r++) {
-    uint32_t fragments_in_chunk =
-      (uint32_t)((md.row_groups[global_r].num_rows + fragment_size - 1) / fragment_size);
-    md.row_groups[global_r].total_byte_size = 0;
-    md.row_groups[global_r].columns.resize(num_columns);
+  for (uint32_t r = 0; r < num_rowgroups; r++) {
+    auto &row_group             = files_[rowgroups[r].file].md.row_groups[rowgroups[r].index];
+    uint32_t const f            = rowgroups[r].first_fragment;
+    uint32_t fragments_in_chunk = rowgroups[r].num_fragments;
+    uint32_t const start_row    = fragment_starts[f];
+    row_group.total_byte_size   = 0;
+    row_group.columns.resize(num_columns);
     for (int i = 0; i < num_columns; i++) {
       gpu::EncColumnChunk *ck = &chunks[r * num_columns + i];
       bool dict_enable        = false;
@@ -1069,7 +1460,7 @@ void writer::impl::write(table_view const &table)
       ck->fragments        = fragments.device_ptr() + i * num_fragments + f;
       ck->stats = (frag_stats.size() != 0) ? frag_stats.data() + i * num_fragments + f : nullptr;
       ck->start_row      = start_row;
-      ck->num_rows       = (uint32_t)md.row_groups[global_r].num_rows;
+      ck->num_rows       = (uint32_t)row_group.num_rows;
       ck->first_fragment = i * num_fragments + f;
       ck->num_values =
         std::accumulate(fragments.host_ptr(i * num_fragments + f),
@@ -1081,37 +1472,57 @@ void writer::impl::write(table_view const &table)
       ck->is_compressed = 0;
       ck->dictionary_id = num_dictionaries;
       ck->ck_stat_size  = 0;
+
+      ck->bloom_filter     = nullptr;
+      ck->bloom_num_blocks = 0;
       if (col_desc[i].dict_data) {
         const gpu::PageFragment *ck_frag = &fragments[i * num_fragments + f];
         size_t plain_size                = 0;
         size_t dict_size                 = 1;
+        size_t dict_data_size            = 0;
         uint32_t num_dict_vals           = 0;
-        for (uint32_t j = 0; j < fragments_in_chunk && num_dict_vals < 65536; j++) {
+        // Only the fragments that fit in the dictionary are dictionary encoded; the estimate
+        // stops where BuildChunkDictionaries would stop adding fragments
+        for (uint32_t j = 0; j < fragments_in_chunk && num_dict_vals < 65536 &&
+                             (j == 0 || dict_data_size + ck_frag[j].dict_data_size <=
+                                          max_dictionary_size_);
+             j++) {
           plain_size += ck_frag[j].fragment_data_size;
           dict_size +=
             ck_frag[j].dict_data_size + ((num_dict_vals > 256) ? 2 : 1) * ck_frag[j].non_nulls;
+          dict_data_size += ck_frag[j].dict_data_size;
           num_dict_vals += ck_frag[j].num_dict_vals;
         }
-        if (dict_size < plain_size) {
+        // Fall back to plain encoding before building the dictionary when the estimated
+        // dictionary does not fit, or does not make the encoded chunk smaller
+        bool const dict_fits = dict_data_size <= max_dictionary_size_;
+        if ((dict_fits && dict_size < plain_size) ||
+            parquet_columns[i].requested_encoding() == column_encoding::DICTIONARY) {
           parquet_columns[i].use_dictionary(true);
           dict_enable = true;
           num_dictionaries++;
         }
       }
-      ck->has_dictionary                                     = dict_enable;
-      md.row_groups[global_r].columns[i].meta_data.type      = parquet_columns[i].physical_type();
-      md.row_groups[global_r].columns[i].meta_data.encodings = {Encoding::PLAIN, Encoding::RLE};
+      ck->has_dictionary                       = dict_enable;
+      row_group.columns[i].meta_data.type      = parquet_columns[i].physical_type();
+      row_group.columns[i].meta_data.encodings = {Encoding::PLAIN, Encoding::RLE};
+      if (col_desc[i].encoding != Encoding::PLAIN) {
+        row_group.columns[i].meta_data.encodings.push_back(col_desc[i].encoding);
+      }
       if (dict_enable) {
-        md.row_groups[global_r].columns[i].meta_data.encodings.push_back(
-          Encoding::PLAIN_DICTIONARY);
+        row_group.columns[i].meta_data.encodings.push_back(Encoding::PLAIN_DICTIONARY);
       }
-      md.row_groups[global_r].columns[i].meta_data.path_in_schema =
-        parquet_columns[i].get_path_in_schema();
-      md.row_groups[global_r].columns[i].meta_data.codec      = UNCOMPRESSED;
-      md.row_groups[global_r].columns[i].meta_data.num_values = ck->num_values;
+      row_group.columns[i].meta_data.path_in_schema = parquet_columns[i].get_path_in_schema();
+      row_group.columns[i].meta_data.codec          = UNCOMPRESSED;
+      row_group.columns[i].meta_data.num_values     = ck->num_values;
     }
-    f += fragments_in_chunk;
-    start_row += (uint32_t)md.row_groups[global_r].num_rows;
+  }
+
+  for (auto &file : files_) {
+    auto const file_rowgroups = file.md.row_groups.size();
+    file.offset_indexes.resize(file_rowgroups, std::vector<OffsetIndex>(num_columns));
+    file.column_indexes.resize(file_rowgroups, std::vector<ColumnIndex>(num_columns));
+    file.bloom_filters.resize(file_rowgroups, std::vector<std::vector<uint8_t>>(num_columns));
   }
 
   // Free unused dictionaries
@@ -1122,6 +1533,26 @@ void writer::impl::write(table_view const &table)
     build_chunk_dictionaries(chunks, col_desc, num_rowgroups, num_columns, num_dictionaries);
   }
 
+  // Size the bloom filters for the number of distinct values in each chunk, which is known for
+  // chunks with a dictionary and bounded by the number of values otherwise
+  size_t bloom_filter_words = 0;
+  for (uint32_t c = 0; c < num_chunks; c++) {
+    gpu::EncColumnChunk *ck = &chunks[c];
+    if (parquet_columns[c % num_columns].bloom_filter() && ck->num_values != 0) {
+      ck->bloom_num_blocks = bloom_filter_num_blocks(
+        ck->has_dictionary ? ck->total_dict_entries : ck->num_values, bloom_filter_fpp_);
+      bloom_filter_words += size_t{ck->bloom_num_blocks} * gpu::bloom_filter_block_words;
+    }
+  }
+  auto bloom_filter_data =
+    cudf::detail::make_zeroed_device_uvector_async<uint32_t>(bloom_filter_words, stream);
+  for (size_t c = 0, offset = 0; c < num_chunks; c++) {
+    if (chunks[c].bloom_num_blocks != 0) {
+      chunks[c].bloom_filter = bloom_filter_data.data() + offset;
+      offset += size_t{chunks[c].bloom_num_blocks} * gpu::bloom_filter_block_words;
+    }
+  }
+
   // Initialize batches of rowgroups to encode (mainly to limit peak memory usage)
   std::vector<uint32_t> batch_list;
   uint32_t num_pages          = 0;
@@ -1168,15 +1599,22 @@ void writer::impl::write(table_view const &table)
     (compression_ != parquet::Compression::UNCOMPRESSED) ? max_pages_in_batch : 0;
   uint32_t num_stats_bfr =
     (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? num_pages + num_chunks : 0;
-  rmm::device_buffer uncomp_bfr(max_uncomp_bfr_size, stream);
-  rmm::device_buffer comp_bfr(max_comp_bfr_size, stream);
+  // With multiple batches, the batches alternate between two sets of buffers, so that a batch can
+  // be encoded while the device writes of the previous one are in flight
+  auto const num_bfr_sets = std::min<size_t>(batch_list.size(), 2);
+  std::vector<rmm::device_buffer> uncomp_bfr;
+  std::vector<rmm::device_buffer> comp_bfr;
+  for (size_t i = 0; i < num_bfr_sets; ++i) {
+    uncomp_bfr.emplace_back(max_uncomp_bfr_size, stream, get_temporary_memory_resource());
+    comp_bfr.emplace_back(max_comp_bfr_size, stream, get_temporary_memory_resource());
+  }
   rmm::device_uvector<gpu_inflate_input_s> comp_in(max_comp_pages, stream);
   rmm::device_uvector<gpu_inflate_status_s> comp_out(max_comp_pages, stream);
   rmm::device_uvector<gpu::EncPage> pages(num_pages, stream);
   rmm::device_uvector<statistics_chunk> page_stats(num_stats_bfr, stream);
   for (uint32_t b = 0, r = 0; b < (uint32_t)batch_list.size(); b++) {
-    uint8_t *bfr   = static_cast<uint8_t *>(uncomp_bfr.data());
-    uint8_t *bfr_c = static_cast<uint8_t *>(comp_bfr.data());
+    uint8_t *bfr   = static_cast<uint8_t *>(uncomp_bfr[b % num_bfr_sets].data());
+    uint8_t *bfr_c = static_cast<uint8_t *>(comp_bfr[b % num_bfr_sets].data());
     for (uint32_t j = 0; j < batch_list[b]; j++, r++) {
       for (int i = 0; i < num_columns; i++) {
         gpu::EncColumnChunk *ck = &chunks[r * num_columns + i];
@@ -1200,11 +1638,34 @@ void writer::impl::write(table_view const &table)
                        num_stats_bfr);
   }
 
-  pinned_buffer<uint8_t> host_bfr{nullptr, cudaFreeHost};
+  // Build the bloom filters and keep them on the host until they are written by close()
+  if (bloom_filter_words != 0) {
+    gpu::BuildBloomFilters(chunks.device_ptr(), num_chunks, stream);
+    auto const h_bloom_filter_data = cudf::detail::make_std_vector_sync(bloom_filter_data, stream);
+    auto const *bitset = reinterpret_cast<uint8_t const *>(h_bloom_filter_data.data());
+    for (uint32_t r = 0; r < num_rowgroups; r++) {
+      auto &rowgroup_filters = files_[rowgroups[r].file].bloom_filters[rowgroups[r].index];
+      for (int i = 0; i < num_columns; i++) {
+        auto const num_bytes = chunks[r * num_columns + i].bloom_num_blocks *
+                               gpu::bloom_filter_block_words * sizeof(uint32_t);
+        rowgroup_filters[i].assign(bitset, bitset + num_bytes);
+        bitset += num_bytes;
+      }
+    }
+  }
+
+  pinned_buffer<uint8_t> host_bfr;
+  // Device writes in flight from each set of buffers; declared after the buffers, so that the
+  // writes complete before the buffers are released
+  std::vector<std::vector<std::future<void>>> pending_writes(num_bfr_sets);
 
   // Encode row groups in batches
-  for (uint32_t b = 0, r = 0, global_r = global_rowgroup_base; b < (uint32_t)batch_list.size();
-       b++) {
+  for (uint32_t b = 0, r = 0; b < (uint32_t)batch_list.size(); b++) {
+    // The buffers of this batch are free once the writes from two batches ago are complete
+    for (auto &write : pending_writes[b % num_bfr_sets]) {
+      write.get();
+    }
+    pending_writes[b % num_bfr_sets].clear();
     // Count pages in this batch
     uint32_t rnext               = r + batch_list[b];
     uint32_t first_page_in_batch = chunks[r * num_columns].first_page;
@@ -1224,40 +1685,58 @@ void writer::impl::write(table_view const &table)
       (stats_granularity_ == statistics_freq::STATISTICS_PAGE) ? page_stats.data() : nullptr,
       (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? page_stats.data() + num_pages
                                                                : nullptr);
-    for (; r < rnext; r++, global_r++) {
+    // Page sizes and first rows for the page index
+    auto const batch_pages = cudf::detail::make_std_vector_sync(
+      device_span<gpu::EncPage const>(pages.data() + first_page_in_batch, pages_in_batch), stream);
+    int64_t batch_bytes = 0;
+    for (auto c = r * num_columns; c < rnext * num_columns; ++c) {
+      batch_bytes += chunks[c].compressed_size;
+    }
+    stage_range range{"parquet::write_chunks", batch_bytes};
+    for (; r < rnext; r++) {
+      // Each row group is written to the file of its partition
+      auto &file      = files_[rowgroups[r].file];
+      auto &row_group = file.md.row_groups[rowgroups[r].index];
       for (auto i = 0; i < num_columns; i++) {
         gpu::EncColumnChunk *ck = &chunks[r * num_columns + i];
+        // The column index is built from the statistics in the page headers
+        bool const need_page_headers = stats_granularity_ == statistics_freq::STATISTICS_PAGE;
         uint8_t *dev_bfr;
         if (ck->is_compressed) {
-          md.row_groups[global_r].columns[i].meta_data.codec = compression_;
-          dev_bfr                                            = ck->compressed_bfr;
+          row_group.columns[i].meta_data.codec = compression_;
+          dev_bfr                              = ck->compressed_bfr;
         } else {
           dev_bfr = ck->uncompressed_bfr;
         }
 
-        if (out_sink_->is_device_write_preferred(ck->compressed_size)) {
+        auto const alloc_host_bfr = [&]() {
+          if (!host_bfr) { host_bfr = pinned_buffer<uint8_t>{max_chunk_bfr_size}; }
+        };
+        if (file.sink->is_device_write_preferred(ck->compressed_size)) {
           // let the writer do what it wants to retrieve the data from the gpu.
-          out_sink_->device_write(dev_bfr + ck->ck_stat_size, ck->compressed_size, stream);
+          pending_writes[b % num_bfr_sets].push_back(
+            file.sink->device_write_async(dev_bfr + ck->ck_stat_size, ck->compressed_size, stream));
+          if (need_page_headers) {
+            alloc_host_bfr();
+            CUDA_TRY(cudaMemcpyAsync(host_bfr.get(),
+                                     dev_bfr,
+                                     ck->ck_stat_size + ck->compressed_size,
+                                     cudaMemcpyDeviceToHost,
+                                     stream.value()));
+            stream.synchronize();
+          }
           // we still need to do a (much smaller) memcpy for the statistics.
           if (ck->ck_stat_size != 0) {
-            md.row_groups[global_r].columns[i].meta_data.statistics_blob.resize(ck->ck_stat_size);
-            CUDA_TRY(
-              cudaMemcpyAsync(md.row_groups[global_r].columns[i].meta_data.statistics_blob.data(),
-                              dev_bfr,
-                              ck->ck_stat_size,
-                              cudaMemcpyDeviceToHost,
-                              stream.value()));
+            row_group.columns[i].meta_data.statistics_blob.resize(ck->ck_stat_size);
+            CUDA_TRY(cudaMemcpyAsync(row_group.columns[i].meta_data.statistics_blob.data(),
+                                     dev_bfr,
+                                     ck->ck_stat_size,
+                                     cudaMemcpyDeviceToHost,
+                                     stream.value()));
             stream.synchronize();
           }
         } else {
-          if (!host_bfr) {
-            host_bfr = pinned_buffer<uint8_t>{[](size_t size) {
-                                                uint8_t *ptr = nullptr;
-                                                CUDA_TRY(cudaMallocHost(&ptr, size));
-                                                return ptr;
-                                              }(max_chunk_bfr_size),
-                                              cudaFreeHost};
-          }
+          alloc_host_bfr();
           // copy the full data
           CUDA_TRY(cudaMemcpyAsync(host_bfr.get(),
                                    dev_bfr,
@@ -1265,43 +1744,119 @@ void writer::impl::write(table_view const &table)
                                    cudaMemcpyDeviceToHost,
                                    stream.value()));
           stream.synchronize();
-          out_sink_->host_write(host_bfr.get() + ck->ck_stat_size, ck->compressed_size);
+          file.sink->host_write(host_bfr.get() + ck->ck_stat_size, ck->compressed_size);
           if (ck->ck_stat_size != 0) {
-            md.row_groups[global_r].columns[i].meta_data.statistics_blob.resize(ck->ck_stat_size);
-            memcpy(md.row_groups[global_r].columns[i].meta_data.statistics_blob.data(),
+            row_group.columns[i].meta_data.statistics_blob.resize(ck->ck_stat_size);
+            memcpy(row_group.columns[i].meta_data.statistics_blob.data(),
                    host_bfr.get(),
                    ck->ck_stat_size);
           }
         }
-        md.row_groups[global_r].total_byte_size += ck->compressed_size;
-        md.row_groups[global_r].columns[i].meta_data.data_page_offset =
-          current_chunk_offset + ((ck->has_dictionary) ? ck->dictionary_size : 0);
-        md.row_groups[global_r].columns[i].meta_data.dictionary_page_offset =
-          (ck->has_dictionary) ? current_chunk_offset : 0;
-        md.row_groups[global_r].columns[i].meta_data.total_uncompressed_size = ck->bfr_size;
-        md.row_groups[global_r].columns[i].meta_data.total_compressed_size   = ck->compressed_size;
-        current_chunk_offset += ck->compressed_size;
+        file.offset_indexes[rowgroups[r].index][i] = build_offset_index(
+          &batch_pages[ck->first_page - first_page_in_batch], *ck, file.current_chunk_offset);
+        if (need_page_headers) {
+          file.column_indexes[rowgroups[r].index][i] =
+            build_column_index(&batch_pages[ck->first_page - first_page_in_batch],
+                               *ck,
+                               host_bfr.get() + ck->ck_stat_size);
+        }
+        row_group.total_byte_size += ck->compressed_size;
+        row_group.columns[i].meta_data.data_page_offset =
+          file.current_chunk_offset + ((ck->has_dictionary) ? ck->dictionary_size : 0);
+        row_group.columns[i].meta_data.dictionary_page_offset =
+          (ck->has_dictionary) ? file.current_chunk_offset : 0;
+        row_group.columns[i].meta_data.total_uncompressed_size = ck->bfr_size;
+        row_group.columns[i].meta_data.total_compressed_size   = ck->compressed_size;
+        file.current_chunk_offset += ck->compressed_size;
       }
     }
   }
+  for (auto &writes : pending_writes) {
+    for (auto &write : writes) {
+      write.get();
+    }
+  }
 }
 
-std::unique_ptr<std::vector<uint8_t>> writer::impl::close(
-  std::string const &column_chunks_file_path)
+void writer::impl::close_file(output_file &file)
 {
-  if (closed) { return nullptr; }
-  closed = true;
+  auto &md                   = file.md;
+  auto &current_chunk_offset = file.current_chunk_offset;
+  auto const &bloom_filters  = file.bloom_filters;
+  auto const &column_indexes = file.column_indexes;
+  auto const &offset_indexes = file.offset_indexes;
   CompactProtocolWriter cpw(&buffer_);
   file_ender_s fendr;
+
+  // Write the bloom filters after the last row group, each header followed by its bitset
+  for (size_t r = 0; r < bloom_filters.size(); r++) {
+    for (size_t i = 0; i < bloom_filters[r].size(); i++) {
+      if (bloom_filters[r][i].empty()) { continue; }
+      auto &col_meta = md.row_groups[r].columns[i].meta_data;
+      BloomFilterHeader header;
+      header.num_bytes                      = static_cast<int32_t>(bloom_filters[r][i].size());
+      header.algorithm.isset_BLOCK          = true;
+      header.hash.isset_XXHASH              = true;
+      header.compression.isset_UNCOMPRESSED = true;
+      buffer_.resize(0);
+      cpw.write(header);
+      buffer_.insert(buffer_.end(), bloom_filters[r][i].begin(), bloom_filters[r][i].end());
+      col_meta.bloom_filter_offset = current_chunk_offset;
+      col_meta.bloom_filter_length = static_cast<int32_t>(buffer_.size());
+      file.sink->host_write(buffer_.data(), buffer_.size());
+      current_chunk_offset += buffer_.size();
+    }
+  }
+
+  // Write the page index between the bloom filters and the footer: all column indexes first,
+  // then all offset indexes
+  for (size_t r = 0; r < column_indexes.size(); r++) {
+    for (size_t i = 0; i < column_indexes[r].size(); i++) {
+      if (column_indexes[r][i].null_pages.empty()) { continue; }
+      auto &col = md.row_groups[r].columns[i];
+      buffer_.resize(0);
+      col.column_index_offset = current_chunk_offset;
+      col.column_index_length = static_cast<int32_t>(cpw.write(column_indexes[r][i]));
+      file.sink->host_write(buffer_.data(), buffer_.size());
+      current_chunk_offset += buffer_.size();
+    }
+  }
+  for (size_t r = 0; r < offset_indexes.size(); r++) {
+    for (size_t i = 0; i < offset_indexes[r].size(); i++) {
+      if (offset_indexes[r][i].page_locations.empty()) { continue; }
+      auto &col = md.row_groups[r].columns[i];
+      buffer_.resize(0);
+      col.offset_index_offset = current_chunk_offset;
+      col.offset_index_length = static_cast<int32_t>(cpw.write(offset_indexes[r][i]));
+      file.sink->host_write(buffer_.data(), buffer_.size());
+      current_chunk_offset += buffer_.size();
+    }
+  }
   buffer_.resize(0);
   fendr.footer_len = static_cast<uint32_t>(cpw.write(md));
   fendr.magic      = parquet_magic;
-  out_sink_->host_write(buffer_.data(), buffer_.size());
-  out_sink_->host_write(&fendr, sizeof(fendr));
-  out_sink_->flush();
+  file.sink->host_write(buffer_.data(), buffer_.size());
+  file.sink->host_write(&fendr, sizeof(fendr));
+  file.sink->flush();
+}
+
+std::unique_ptr<std::vector<uint8_t>> writer::impl::close(
+  std::string const &column_chunks_file_path)
+{
+  if (closed) { return nullptr; }
+  closed = true;
+  CUDF_EXPECTS(column_chunks_file_path.empty() or partition_columns_.empty(),
+               "Column chunks file path is not supported with partitioned writing");
+  for (auto &file : files_) {
+    close_file(file);
+  }
 
   // Optionally output raw file metadata with the specified column chunk file path
   if (column_chunks_file_path.length() > 0) {
+    auto &md = files_.front().md;
+    CompactProtocolWriter cpw(&buffer_);
+    file_ender_s fendr;
+    fendr.magic        = parquet_magic;
     file_header_s fhdr = {parquet_magic};
     buffer_.resize(0);
     buffer_.insert(buffer_.end(),
@@ -35,6 +35,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -96,15 +97,13 @@ class writer::impl {
    */
   ~impl();
 
-  /**
-   * @brief Initializes the states before writing.
-   */
-  void init_state();
-
   /**
    * @brief Writes a single subtable as part of a larger parquet file/table write,
    * normally used for chunked writing.
    *
+   * In partitioned mode, the rows of each partition of the table are written to the file of the
+   * partition.
+   *
    * @param[in] table The table information to be written
    */
   void write(table_view const& table);
@@ -119,22 +118,77 @@ class writer::impl {
   std::unique_ptr<std::vector<uint8_t>> close(std::string const& column_chunks_file_path = "");
 
  private:
+  /**
+   * @brief An output file, completed by close()
+   */
+  struct output_file {
+    std::unique_ptr<data_sink> sink;
+    // Overall file metadata.  Filled in during the process and written during write_chunked_end()
+    cudf::io::parquet::FileMetaData md;
+    // current write position for rowgroups/chunks
+    std::size_t current_chunk_offset = 0;
+    // page index of each column chunk, one list of columns per row group; written by close()
+    std::vector<std::vector<OffsetIndex>> offset_indexes;
+    std::vector<std::vector<ColumnIndex>> column_indexes;
+    // bloom filter bitset of each column chunk, empty if none; written by close()
+    std::vector<std::vector<std::vector<uint8_t>>> bloom_filters;
+  };
+
+  /**
+   * @brief A range of rows of the written table that goes to a single file
+   */
+  struct partition_rows {
+    std::size_t file;     // index of the output file
+    size_type start_row;  // first row of the partition
+    size_type num_rows;   // number of rows of the partition
+  };
+
+  /**
+   * @brief Adds an output file and writes its header.
+   *
+   * @param sink The sink of the file
+   */
+  void add_file(std::unique_ptr<data_sink> sink);
+
+  /**
+   * @brief Sorts the rows of `table` by partition and writes each partition to its file.
+   *
+   * @param table The table to be written, including the partition columns
+   */
+  void write_partitioned(table_view const& table);
+
+  /**
+   * @brief Encodes the row groups of all the partitions of `table` together and writes each one to
+   * the file of its partition. Row groups never span two partitions.
+   *
+   * @param table The table to be written
+   * @param partitions Consecutive ranges of rows covering `table`, and their files
+   */
+  void write_partitions(table_view const& table, std::vector<partition_rows> const& partitions);
+
+  /**
+   * @brief Writes the bloom filters, the page index and the footer of `file`.
+   *
+   * @param file The file to complete
+   */
+  void close_file(output_file& file);
+
   /**
    * @brief Gather page fragments
    *
    * @param frag Destination page fragments
    * @param col_desc column description array
+   * @param fragment_starts First row of each fragment, followed by the number of rows
    * @param num_columns Total number of columns
    * @param num_fragments Total number of fragments per column
    * @param num_rows Total number of rows
-   * @param fragment_size Number of rows per fragment
    */
   void init_page_fragments(hostdevice_vector<gpu::PageFragment>& frag,
                            hostdevice_vector<gpu::parquet_column_device_view>& col_desc,
+                           hostdevice_vector<uint32_t>& fragment_starts,
                            uint32_t num_columns,
                            uint32_t num_fragments,
-                           uint32_t num_rows,
-                           uint32_t fragment_size);
+                           uint32_t num_rows);
 
   /**
    * @brief Gather per-fragment statistics
@@ -221,24 +275,28 @@ class writer::impl {
 
   size_t max_rowgroup_size_          = DEFAULT_ROWGROUP_MAXSIZE;
   size_t max_rowgroup_rows_          = DEFAULT_ROWGROUP_MAXROWS;
-  size_t target_page_size_           = DEFAULT_TARGET_PAGE_SIZE;
   Compression compression_           = Compression::UNCOMPRESSED;
   statistics_freq stats_granularity_ = statistics_freq::STATISTICS_NONE;
   bool int96_timestamps              = false;
-  // Overall file metadata.  Filled in during the process and written during write_chunked_end()
-  cudf::io::parquet::FileMetaData md;
+  double bloom_filter_fpp_           = 0.01;
+  size_t max_dictionary_size_        = 512 * 1024;
+  size_t target_page_size_           = DEFAULT_TARGET_PAGE_SIZE;
   // optional user metadata
   std::unique_ptr<table_input_metadata> table_meta;
   // to track if the output has been written to sink
   bool closed = false;
-  // current write position for rowgroups/chunks
-  std::size_t current_chunk_offset;
   // special parameter only used by detail::write() to indicate that we are guaranteeing
   // a single table write.  this enables some internal optimizations.
   bool const single_write_mode = true;
 
   std::vector<uint8_t> buffer_;
-  std::unique_ptr<data_sink> out_sink_;
+  // the single output file, or the files of the partitions in the order they were created
+  std::vector<output_file> files_;
+  // partitioned mode: partition columns, their names, and the file index of each partition path
+  std::vector<size_type> partition_columns_;
+  std::vector<std::string> partition_names_;
+  partition_sink_factory partition_sinks_;
+  std::map<std::string, std::size_t> partition_files_;
 };
 
 }  // namespace parquet
@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "column_stats.h"
+
+#include <io/utilities/hostdevice_vector.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/io/statistics.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/pair.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <tuple>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+
+// Rows gathered by one block of the statistics kernel, as in the ORC row index
+constexpr size_type max_group_rows = 10000;
+
+statistics_dtype to_statistics_dtype(data_type type)
+{
+  switch (type.id()) {
+    case type_id::BOOL8: return dtype_bool;
+    case type_id::INT8: return dtype_int8;
+    case type_id::INT16: return dtype_int16;
+    case type_id::INT32:
+    case type_id::DURATION_DAYS:
+    case type_id::DECIMAL32: return dtype_int32;
+    case type_id::TIMESTAMP_DAYS: return dtype_date32;
+    case type_id::INT64:
+    case type_id::DURATION_SECONDS:
+    case type_id::DURATION_MILLISECONDS:
+    case type_id::DURATION_MICROSECONDS:
+    case type_id::DURATION_NANOSECONDS: return dtype_int64;
+    case type_id::TIMESTAMP_SECONDS:
+    case type_id::TIMESTAMP_MILLISECONDS:
+    case type_id::TIMESTAMP_MICROSECONDS:
+    case type_id::TIMESTAMP_NANOSECONDS: return dtype_timestamp64;
+    case type_id::DECIMAL64: return dtype_decimal64;
+    case type_id::FLOAT32: return dtype_float32;
+    case type_id::FLOAT64: return dtype_float64;
+    case type_id::STRING: return dtype_string;
+    default: CUDF_FAIL("Unsupported column type for statistics");
+  }
+}
+
+struct null_count_fn {
+  __device__ size_type operator()(statistics_chunk const &ck) const { return ck.null_count; }
+};
+
+struct has_minmax_fn {
+  __device__ bool operator()(statistics_chunk const &ck) const { return ck.has_minmax != 0; }
+};
+
+struct has_sum_fn {
+  __device__ bool operator()(statistics_chunk const &ck) const { return ck.has_sum != 0; }
+};
+
+/**
+ * @brief Returns the minimum or maximum of a chunk in the representation of the column type.
+ */
+template <typename Rep>
+struct minmax_value_fn {
+  bool is_max;
+  __device__ Rep operator()(statistics_chunk const &ck) const
+  {
+    auto const &value = is_max ? ck.max_value : ck.min_value;
+    if constexpr (std::is_floating_point<Rep>::value) {
+      return static_cast<Rep>(value.fp_val);
+    } else {
+      return static_cast<Rep>(value.i_val);
+    }
+  }
+};
+
+struct string_value_fn {
+  bool is_max;
+  __device__ thrust::pair<char const *, size_type> operator()(statistics_chunk const &ck) const
+  {
+    if (not ck.has_minmax) { return {nullptr, 0}; }
+    auto const &value = is_max ? ck.max_value.str_val : ck.min_value.str_val;
+    // a null pointer would make an empty minimum or maximum null
+    return {value.ptr != nullptr ? value.ptr : "", static_cast<size_type>(value.length)};
+  }
+};
+
+template <typename Rep>
+struct sum_value_fn {
+  __device__ Rep operator()(statistics_chunk const &ck) const
+  {
+    if constexpr (std::is_floating_point<Rep>::value) {
+      return ck.sum.fp_val;
+    } else {
+      return ck.sum.i_val;
+    }
+  }
+};
+
+template <typename Rep, typename ValueFn, typename ValidFn>
+std::unique_ptr<column> make_statistics_column(data_type type,
+                                               device_span<statistics_chunk const> chunks,
+                                               ValueFn value_fn,
+                                               ValidFn valid_fn,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource *mr)
+{
+  auto result = make_fixed_width_column(
+    type, static_cast<size_type>(chunks.size()), mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    chunks.begin(),
+                    chunks.end(),
+                    result->mutable_view().data<Rep>(),
+                    value_fn);
+  auto mask = cudf::detail::valid_if(chunks.begin(), chunks.end(), valid_fn, stream, mr);
+  if (mask.second != 0) { result->set_null_mask(std::move(mask.first), mask.second); }
+  return result;
+}
+
+std::unique_ptr<column> make_minmax_column(data_type type,
+                                           device_span<statistics_chunk const> chunks,
+                                           bool is_max,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource *mr)
+{
+  if (type.id() == type_id::STRING) {
+    rmm::device_uvector<thrust::pair<char const *, size_type>> strings(chunks.size(), stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      chunks.begin(),
+                      chunks.end(),
+                      strings.begin(),
+                      string_value_fn{is_max});
+    return make_strings_column(strings, stream, mr);
+  }
+  if (type.id() == type_id::FLOAT32) {
+    return make_statistics_column<float>(
+      type, chunks, minmax_value_fn<float>{is_max}, has_minmax_fn{}, stream, mr);
+  }
+  if (type.id() == type_id::FLOAT64) {
+    return make_statistics_column<double>(
+      type, chunks, minmax_value_fn<double>{is_max}, has_minmax_fn{}, stream, mr);
+  }
+  // the other types are stored as integers of their size
+  switch (size_of(type)) {
+    case 1:
+      return make_statistics_column<int8_t>(
+        type, chunks, minmax_value_fn<int8_t>{is_max}, has_minmax_fn{}, stream, mr);
+    case 2:
+      return make_statistics_column<int16_t>(
+        type, chunks, minmax_value_fn<int16_t>{is_max}, has_minmax_fn{}, stream, mr);
+    case 4:
+      return make_statistics_column<int32_t>(
+        type, chunks, minmax_value_fn<int32_t>{is_max}, has_minmax_fn{}, stream, mr);
+    default:
+      return make_statistics_column<int64_t>(
+        type, chunks, minmax_value_fn<int64_t>{is_max}, has_minmax_fn{}, stream, mr);
+  }
+}
+
+std::unique_ptr<column> make_sum_column(data_type type,
+                                        device_span<statistics_chunk const> chunks,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource *mr)
+{
+  if (type.id() == type_id::FLOAT32 or type.id() == type_id::FLOAT64) {
+    return make_statistics_column<double>(
+      data_type{type_id::FLOAT64}, chunks, sum_value_fn<double>{}, has_sum_fn{}, stream, mr);
+  }
+  auto const sum_type = is_fixed_point(type) ? data_type{type_id::DECIMAL64, type.scale()}
+                                             : data_type{type_id::INT64};
+  return make_statistics_column<int64_t>(
+    sum_type, chunks, sum_value_fn<int64_t>{}, has_sum_fn{}, stream, mr);
+}
+
+}  // namespace
+
+std::vector<chunk_statistics> compute_column_statistics(table_view const &table,
+                                                        size_type chunk_rows,
+                                                        rmm::cuda_stream_view stream,
+                                                        rmm::mr::device_memory_resource *mr)
+{
+  CUDF_EXPECTS(chunk_rows > 0, "The number of rows of a chunk must be positive");
+  auto const num_columns = table.num_columns();
+  auto const num_rows    = table.num_rows();
+  auto const num_chunks  = (num_rows + chunk_rows - 1) / chunk_rows;
+  // large chunks are gathered in groups of rows, that are merged into the chunks
+  auto const groups_per_chunk = (std::min(chunk_rows, num_rows) + max_group_rows - 1) /
+                                max_group_rows;
+  auto const group_rows = groups_per_chunk > 1
+                            ? (chunk_rows + groups_per_chunk - 1) / groups_per_chunk
+                            : chunk_rows;
+  auto const num_groups = num_chunks * groups_per_chunk;
+
+  hostdevice_vector<stats_column_desc> stat_desc(num_columns, stream);
+  for (size_type c = 0; c < num_columns; ++c) {
+    auto &desc       = stat_desc[c];
+    desc.stats_dtype = to_statistics_dtype(table.column(c).type());
+    desc.num_rows    = num_rows;
+    desc.num_values  = num_rows;
+    // timestamps are kept in the units of the column
+    desc.ts_scale      = 0;
+    desc.parent_column = nullptr;
+  }
+
+  std::vector<chunk_statistics> results(num_columns);
+  if (num_chunks == 0) {
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const type        = table.column(c).type();
+      results[c].null_counts = make_empty_column(data_type{type_id::INT32});
+      results[c].min_values  = make_empty_column(type);
+      results[c].max_values  = make_empty_column(type);
+      results[c].sums        = make_sum_column(type, {}, stream, mr);
+    }
+    return results;
+  }
+
+  auto device_views    = contiguous_copy_column_device_views<column_device_view>(table, stream);
+  auto const d_columns = std::get<1>(device_views);
+  for (size_type c = 0; c < num_columns; ++c) {
+    stat_desc[c].leaf_column = d_columns + c;
+  }
+  stat_desc.host_to_device(stream);
+
+  hostdevice_vector<statistics_group> groups(num_columns * num_groups, stream);
+  for (size_type c = 0; c < num_columns; ++c) {
+    for (size_type g = 0; g < num_groups; ++g) {
+      auto const chunk     = g / groups_per_chunk;
+      auto const chunk_end = std::min(num_rows, (chunk + 1) * chunk_rows);
+      auto const start_row =
+        std::min(chunk_end, chunk * chunk_rows + (g % groups_per_chunk) * group_rows);
+      auto &group     = groups[c * num_groups + g];
+      group.col       = stat_desc.device_ptr(c);
+      group.start_row = start_row;
+      group.num_rows  = std::min(chunk_end - start_row, group_rows);
+    }
+  }
+  groups.host_to_device(stream);
+
+  rmm::device_uvector<statistics_chunk> group_stats(groups.size(), stream);
+  GatherColumnStatistics(group_stats.data(), groups.device_ptr(), groups.size(), stream);
+
+  rmm::device_uvector<statistics_chunk> chunk_stats(0, stream);
+  if (groups_per_chunk > 1) {
+    hostdevice_vector<statistics_merge_group> merge_groups(num_columns * num_chunks, stream);
+    for (size_type c = 0; c < num_columns; ++c) {
+      for (size_type k = 0; k < num_chunks; ++k) {
+        auto &group       = merge_groups[c * num_chunks + k];
+        group.col         = stat_desc.device_ptr(c);
+        group.start_chunk = (c * num_chunks + k) * groups_per_chunk;
+        group.num_chunks  = groups_per_chunk;
+      }
+    }
+    merge_groups.host_to_device(stream);
+    chunk_stats = rmm::device_uvector<statistics_chunk>(merge_groups.size(), stream);
+    MergeColumnStatistics(chunk_stats.data(),
+                          group_stats.data(),
+                          merge_groups.device_ptr(),
+                          merge_groups.size(),
+                          stream);
+  } else {
+    chunk_stats = std::move(group_stats);
+  }
+
+  for (size_type c = 0; c < num_columns; ++c) {
+    auto const type = table.column(c).type();
+    device_span<statistics_chunk const> const chunks(chunk_stats.data() + c * num_chunks,
+                                                     num_chunks);
+    results[c].null_counts = make_fixed_width_column(
+      data_type{type_id::INT32}, num_chunks, mask_state::UNALLOCATED, stream, mr);
+    thrust::transform(rmm::exec_policy(stream),
+                      chunks.begin(),
+                      chunks.end(),
+                      results[c].null_counts->mutable_view().data<size_type>(),
+                      null_count_fn{});
+    results[c].min_values = make_minmax_column(type, chunks, false, stream, mr);
+    results[c].max_values = make_minmax_column(type, chunks, true, stream, mr);
+    results[c].sums       = make_sum_column(type, chunks, stream, mr);
+  }
+  return results;
+}
+
+}  // namespace detail
+
+std::vector<chunk_statistics> compute_column_statistics(table_view const &table,
+                                                        size_type chunk_rows,
+                                                        rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_column_statistics(table, chunk_rows, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <future>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Reads ranges of a source into device memory, issuing all of the reads up front.
+ *
+ * The ranges for which the source prefers direct device reads are read with one batch of
+ * `device_read_async`. The other ranges are read with one batch of `host_read_async` into a host
+ * staging buffer, which is then copied to the device.
+ *
+ * @param source Dataset source; must remain valid until the returned future is ready
+ * @param requests Ranges to read and their destinations in device memory
+ * @param stream CUDA stream used for device reads and host-to-device copies
+ *
+ * @return Future of the total number of bytes read
+ */
+std::future<size_t> read_to_device_async(datasource &source,
+                                         std::vector<datasource::read_request> requests,
+                                         rmm::cuda_stream_view stream);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
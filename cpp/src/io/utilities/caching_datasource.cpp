@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/io/datasource.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace cudf {
+namespace io {
+
+datasource_block_cache::datasource_block_cache(size_t capacity, size_t block_size, location loc)
+  : _capacity{capacity}, _block_size{block_size}, _location{loc}
+{
+  CUDF_EXPECTS(_block_size > 0, "Cache block size must be positive");
+}
+
+std::shared_ptr<datasource_block_cache::block const> datasource_block_cache::find(
+  std::string const &key, size_t block_idx)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto const it = _entries.find({key, block_idx});
+  if (it == _entries.end()) { return nullptr; }
+  _lru.splice(_lru.begin(), _lru, it->second.lru_pos);
+  return it->second.data;
+}
+
+void datasource_block_cache::insert(std::string const &key,
+                                    size_t block_idx,
+                                    std::shared_ptr<block const> data)
+{
+  if (data->size > _capacity) { return; }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  block_key entry_key{key, block_idx};
+  // Another reader may have cached the same block in the meantime
+  if (_entries.count(entry_key) != 0) { return; }
+
+  // Evicted blocks stay alive until the reads that still use them are done
+  while (_size + data->size > _capacity) {
+    auto const evicted = _entries.find(_lru.back());
+    _size -= evicted->second.data->size;
+    _entries.erase(evicted);
+    _lru.pop_back();
+  }
+  _lru.push_front(entry_key);
+  _size += data->size;
+  _entries.emplace(std::move(entry_key), entry{std::move(data), _lru.begin()});
+}
+
+size_t datasource_block_cache::size() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _size;
+}
+
+void datasource_block_cache::clear()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _entries.clear();
+  _lru.clear();
+  _size = 0;
+}
+
+caching_source::caching_source(std::unique_ptr<datasource> source,
+                               std::string cache_key,
+                               std::shared_ptr<datasource_block_cache> cache)
+  : _source(std::move(source)), _cache_key(std::move(cache_key)), _cache(std::move(cache))
+{
+  CUDF_EXPECTS(_source != nullptr, "Cannot cache a null datasource");
+  CUDF_EXPECTS(_cache != nullptr, "Cannot cache into a null cache");
+}
+
+std::unique_ptr<datasource::buffer> caching_source::host_read(size_t offset, size_t size)
+{
+  std::vector<uint8_t> data(std::min(size, this->size() - std::min(offset, this->size())));
+  data.resize(read(offset, data.size(), data.data(), false, rmm::cuda_stream_default));
+  return buffer::create(std::move(data));
+}
+
+size_t caching_source::host_read(size_t offset, size_t size, uint8_t *dst)
+{
+  return read(offset, size, dst, false, rmm::cuda_stream_default);
+}
+
+std::unique_ptr<datasource::buffer> caching_source::device_read(size_t offset,
+                                                                size_t size,
+                                                                rmm::cuda_stream_view stream)
+{
+  rmm::device_buffer data(std::min(size, this->size() - std::min(offset, this->size())), stream);
+  data.resize(read(offset, data.size(), static_cast<uint8_t *>(data.data()), true, stream), stream);
+  return buffer::create(std::move(data));
+}
+
+size_t caching_source::device_read(size_t offset,
+                                   size_t size,
+                                   uint8_t *dst,
+                                   rmm::cuda_stream_view stream)
+{
+  return read(offset, size, dst, true, stream);
+}
+
+std::vector<std::shared_ptr<datasource_block_cache::block const>> caching_source::read_blocks(
+  size_t first_block, size_t num_blocks, rmm::cuda_stream_view stream)
+{
+  auto const block_size = _cache->block_size();
+  auto const begin      = first_block * block_size;
+  auto const end        = std::min(size(), (first_block + num_blocks) * block_size);
+  auto const on_device  = _cache->memory_location() == datasource_block_cache::location::DEVICE;
+
+  // Read the whole run with a single call, then split it into blocks
+  auto const run_on_device = on_device && _source->is_device_read_preferred(end - begin);
+  std::vector<uint8_t> h_run;
+  rmm::device_buffer d_run;
+  uint8_t *run_data = nullptr;
+  if (run_on_device) {
+    d_run    = rmm::device_buffer(end - begin, stream);
+    run_data = static_cast<uint8_t *>(d_run.data());
+  } else {
+    h_run.resize(end - begin);
+    run_data = h_run.data();
+  }
+  auto const run_size = run_on_device ? _source->device_read(begin, end - begin, run_data, stream)
+                                      : _source->host_read(begin, end - begin, run_data);
+  auto const copy_kind = run_on_device ? cudaMemcpyDeviceToDevice : cudaMemcpyHostToDevice;
+
+  std::vector<std::shared_ptr<datasource_block_cache::block const>> blocks;
+  for (size_t pos = 0; pos < run_size; pos += block_size) {
+    auto blk  = std::make_shared<datasource_block_cache::block>();
+    blk->size = std::min(block_size, run_size - pos);
+    if (on_device) {
+      blk->device_data = rmm::device_buffer(blk->size, stream);
+      CUDA_TRY(cudaMemcpyAsync(
+        blk->device_data.data(), run_data + pos, blk->size, copy_kind, stream.value()));
+    } else {
+      blk->host_data.assign(run_data + pos, run_data + pos + blk->size);
+    }
+    blocks.push_back(std::move(blk));
+  }
+  // Cached blocks are read on other streams
+  if (on_device) { stream.synchronize(); }
+  return blocks;
+}
+
+size_t caching_source::read(
+  size_t offset, size_t size, uint8_t *dst, bool dst_on_device, rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(offset <= this->size(), "Offset is past the end of the source");
+  auto const read_size = std::min(size, this->size() - offset);
+  if (read_size == 0) { return 0; }
+
+  auto const block_size  = _cache->block_size();
+  auto const first_block = offset / block_size;
+  auto const num_blocks  = (offset + read_size - 1) / block_size - first_block + 1;
+
+  std::vector<std::shared_ptr<datasource_block_cache::block const>> blocks(num_blocks);
+  for (size_t b = 0; b < num_blocks; ++b) {
+    blocks[b] = _cache->find(_cache_key, first_block + b);
+  }
+  // Read each run of missing blocks from the source
+  for (size_t b = 0; b < num_blocks;) {
+    if (blocks[b] != nullptr) {
+      ++b;
+      continue;
+    }
+    auto run_end = b;
+    while (run_end < num_blocks && blocks[run_end] == nullptr) {
+      ++run_end;
+    }
+    auto run = read_blocks(first_block + b, run_end - b, stream);
+    for (size_t r = 0; r < run.size(); ++r) {
+      _cache->insert(_cache_key, first_block + b + r, run[r]);
+      blocks[b + r] = std::move(run[r]);
+    }
+    // A short read from the source ends the range
+    if (b + run.size() < run_end) { break; }
+    b = run_end;
+  }
+
+  auto const src_on_device = _cache->memory_location() == datasource_block_cache::location::DEVICE;
+  auto const copy_kind     = src_on_device
+                               ? (dst_on_device ? cudaMemcpyDeviceToDevice : cudaMemcpyDeviceToHost)
+                               : (dst_on_device ? cudaMemcpyHostToDevice : cudaMemcpyHostToHost);
+  size_t bytes_read = 0;
+  for (size_t b = 0; b < num_blocks && blocks[b] != nullptr; ++b) {
+    auto const block_begin = (first_block + b) * block_size;
+    auto const copy_begin  = std::max(offset, block_begin);
+    auto const copy_end    = std::min(offset + read_size, block_begin + blocks[b]->size);
+    if (copy_begin >= copy_end) { break; }
+    auto const src = blocks[b]->data(_cache->memory_location()) + (copy_begin - block_begin);
+    if (copy_kind == cudaMemcpyHostToHost) {
+      std::memcpy(dst + bytes_read, src, copy_end - copy_begin);
+    } else {
+      CUDA_TRY(
+        cudaMemcpyAsync(dst + bytes_read, src, copy_end - copy_begin, copy_kind, stream.value()));
+    }
+    bytes_read += copy_end - copy_begin;
+    if (copy_end < block_begin + block_size) { break; }
+  }
+  // The blocks may be evicted and released once this function returns
+  if (copy_kind != cudaMemcpyHostToHost) { stream.synchronize(); }
+  return bytes_read;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -16,9 +16,13 @@
 
 #pragma once
 
+#include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/span.hpp>
 
@@ -28,6 +32,10 @@
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 
+#include <memory>
+#include <utility>
+#include <vector>
+
 namespace cudf {
 namespace io {
 
@@ -79,5 +87,33 @@ rmm::device_uvector<column_device_view> create_leaf_column_device_views(
   return leaf_column_views;
 }
 
+/**
+ * @brief Replaces the dictionary columns of a table with their decoded values
+ *
+ * The writers encode columns from their values, so a dictionary column is written as a column of
+ * the type of its keys.
+ *
+ * @param table Table to write
+ * @param stream CUDA stream to use
+ *
+ * @return The table with its dictionary columns decoded, and the decoded columns it views
+ */
+inline std::pair<table_view, std::vector<std::unique_ptr<column>>> decode_dictionary_columns(
+  table_view const &table, rmm::cuda_stream_view stream)
+{
+  std::vector<std::unique_ptr<column>> decoded_columns;
+  std::vector<column_view> columns;
+  for (auto const &col : table) {
+    if (col.type().id() == type_id::DICTIONARY32) {
+      decoded_columns.push_back(
+        cudf::dictionary::detail::decode(dictionary_column_view(col), stream));
+      columns.push_back(decoded_columns.back()->view());
+    } else {
+      columns.push_back(col);
+    }
+  }
+  return {table_view(columns), std::move(decoded_columns)};
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -15,6 +15,8 @@
  */
 
 #include <fstream>
+#include <future>
+#include <optional>
 
 #include <cudf/io/data_sink.hpp>
 #include <cudf/utilities/error.hpp>
@@ -64,6 +66,24 @@ class file_sink : public data_sink {
     _bytes_written += size;
   }
 
+  std::future<void> device_write_async(void const* gpu_data,
+                                       size_t size,
+                                       rmm::cuda_stream_view stream) override
+  {
+    if (!supports_device_write()) CUDF_FAIL("Device writes are not supported for this file.");
+
+    // The range in the file is reserved now, so later writes can be issued right away
+    auto const offset = _bytes_written;
+    _bytes_written += size;
+    int device_id;
+    CUDA_TRY(cudaGetDevice(&device_id));
+    return std::async(std::launch::async, [=, cufile_out = _cufile_out.get()]() {
+      CUDA_TRY(cudaSetDevice(device_id));
+      stream.synchronize();
+      cufile_out->write(gpu_data, offset, size);
+    });
+  }
+
  private:
   std::ofstream _output_stream;
   size_t _bytes_written = 0;
@@ -81,16 +101,47 @@ class host_buffer_sink : public data_sink {
 
   void host_write(void const* data, size_t size) override
   {
+    wait_for_copies();
     auto char_array = static_cast<char const*>(data);
     buffer_->insert(buffer_->end(), char_array, char_array + size);
   }
 
-  void flush() override {}
+  bool supports_device_write() const override { return true; }
+
+  void device_write(void const* gpu_data, size_t size, rmm::cuda_stream_view stream) override
+  {
+    device_write_async(gpu_data, size, stream).get();
+  }
+
+  std::future<void> device_write_async(void const* gpu_data,
+                                       size_t size,
+                                       rmm::cuda_stream_view stream) override
+  {
+    // Growing the vector would move the destination of a copy that is still in flight
+    wait_for_copies();
+    auto const offset = buffer_->size();
+    buffer_->resize(offset + size);
+    CUDA_TRY(cudaMemcpyAsync(
+      buffer_->data() + offset, gpu_data, size, cudaMemcpyDeviceToHost, stream.value()));
+    _copy_stream = stream;
+    return std::async(std::launch::deferred, [stream]() { stream.synchronize(); });
+  }
+
+  void flush() override { wait_for_copies(); }
 
   size_t bytes_written() override { return buffer_->size(); }
 
  private:
+  void wait_for_copies()
+  {
+    if (_copy_stream.has_value()) {
+      _copy_stream->synchronize();
+      _copy_stream.reset();
+    }
+  }
+
   std::vector<char>* buffer_;
+  std::optional<rmm::cuda_stream_view> _copy_stream;  ///< Stream of the last device copy
 };
 
 /**
@@ -136,6 +187,15 @@ class user_sink_wrapper : public data_sink {
     user_sink->device_write(gpu_data, size, stream);
   }
 
+  std::future<void> device_write_async(void const* gpu_data,
+                                       size_t size,
+                                       rmm::cuda_stream_view stream) override
+  {
+    CUDF_EXPECTS(user_sink->supports_device_write(),
+                 "device_write_async() being called on a data_sink that doesn't support it");
+    return user_sink->device_write_async(gpu_data, size, stream);
+  }
+
   void flush() override { user_sink->flush(); }
 
   size_t bytes_written() override { return user_sink->bytes_written(); }
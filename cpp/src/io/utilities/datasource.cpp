@@ -21,12 +21,122 @@
 #include <unistd.h>
 
 #include <cudf/utilities/error.hpp>
+#include "batched_read.hpp"
 #include "file_io_utilities.hpp"
+#include "pinned_memory_pool.hpp"
+
+#include <rmm/device_buffer.hpp>
+
+#include <arrow/filesystem/filesystem.h>
+#include <arrow/util/config.h>
+#ifdef ARROW_S3
+#include <arrow/filesystem/s3fs.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
 
 namespace cudf {
 namespace io {
 namespace {
 
+/**
+ * @brief Maximum number of threads a batched read is dispatched on
+ */
+constexpr size_t max_concurrent_reads = 8;
+
+/**
+ * @brief A single read from the source that covers one or more requests
+ */
+struct coalesced_read {
+  size_t offset;
+  size_t size;
+  std::vector<datasource::read_request> parts;
+
+  /**
+   * @brief Whether the parts are back to back both in the source and in the destination memory,
+   * so the read can go straight to the destination
+   */
+  bool is_contiguous() const
+  {
+    for (size_t i = 1; i < parts.size(); ++i) {
+      if (parts[i].offset != parts[i - 1].offset + parts[i - 1].size ||
+          parts[i].dst != parts[i - 1].dst + parts[i - 1].size) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief Merges the requests that are at most `gap` bytes apart in the source
+ */
+std::vector<coalesced_read> coalesce_requests(std::vector<datasource::read_request> requests,
+                                              size_t gap)
+{
+  std::sort(requests.begin(), requests.end(), [](auto const &lhs, auto const &rhs) {
+    return lhs.offset < rhs.offset;
+  });
+  std::vector<coalesced_read> reads;
+  for (auto const &request : requests) {
+    if (request.size == 0) { continue; }
+    if (!reads.empty() && request.offset <= reads.back().offset + reads.back().size + gap) {
+      auto &read = reads.back();
+      read.size  = std::max(read.offset + read.size, request.offset + request.size) - read.offset;
+      read.parts.push_back(request);
+    } else {
+      reads.push_back({request.offset, request.size, {request}});
+    }
+  }
+  return reads;
+}
+
+/**
+ * @brief Runs `num_tasks` tasks on up to `max_workers` threads
+ *
+ * @return The sum of the values returned by the tasks
+ */
+size_t parallel_sum(size_t num_tasks,
+                    size_t max_workers,
+                    std::function<size_t(size_t)> const &task_fn)
+{
+  std::atomic<size_t> next_task{0};
+  std::atomic<size_t> sum{0};
+  auto const worker_fn = [&]() {
+    for (auto t = next_task++; t < num_tasks; t = next_task++) {
+      sum += task_fn(t);
+    }
+  };
+
+  auto const num_workers = std::min(max_workers, num_tasks);
+  if (num_workers <= 1) {
+    worker_fn();
+    return sum;
+  }
+  std::vector<std::future<void>> workers;
+  for (size_t w = 0; w < num_workers; ++w) {
+    workers.push_back(std::async(std::launch::async, worker_fn));
+  }
+  // Wait for all workers before rethrowing the first failure
+  std::exception_ptr error;
+  for (auto &worker : workers) {
+    try {
+      worker.get();
+    } catch (...) {
+      if (!error) { error = std::current_exception(); }
+    }
+  }
+  if (error) { std::rethrow_exception(error); }
+  return sum;
+}
+
 /**
  * @brief Base class for file input. Only implements direct device reads.
  */
@@ -41,7 +151,9 @@ class file_source : public datasource {
 
   bool supports_device_read() const override { return _cufile_in != nullptr; }
 
-  bool is_device_read_preferred(size_t size) const
+  bool supports_concurrent_reads() const override { return true; }
+
+  bool is_device_read_preferred(size_t size) const override
   {
     return _cufile_in != nullptr && _cufile_in->is_cufile_io_preferred(size);
   }
@@ -81,17 +193,34 @@ class file_source : public datasource {
  *
  * Unlike Arrow's memory mapped IO class, this implementation allows memory mapping a subset of the
  * file where the starting offset may not be zero.
+ *
+ * The ranges of batched reads are passed to `madvise(MADV_WILLNEED)` before any of them is read,
+ * so that the kernel reads them ahead instead of faulting them in page by page. Two optional
+ * behaviors are controlled through environment variables:
+ * - `LIBCUDF_MMAP_HUGE_PAGES=ON` asks for the mapping to be backed by transparent huge pages.
+ * - `LIBCUDF_MMAP_REGISTER=ON` registers the mapping with `cudaHostRegister`. Device reads are then
+ *   DMA copies straight from the mapping, without staging through another host buffer. This reads
+ *   the whole mapped range into memory up front, so it only pays off for files that are mostly
+ *   read.
  */
 class memory_mapped_source : public file_source {
  public:
   explicit memory_mapped_source(const char *filepath, size_t offset, size_t size)
     : file_source(filepath)
   {
-    if (_file.size() != 0) map(_file.desc(), offset, size);
+    if (_file.size() != 0) {
+      map(_file.desc(), offset, size);
+      if (detail::getenv_or("LIBCUDF_MMAP_HUGE_PAGES", "OFF") == "ON") {
+        // Only a hint; kernels without huge page support for file mappings ignore it
+        madvise(_map_addr, _map_size, MADV_HUGEPAGE);
+      }
+      if (detail::getenv_or("LIBCUDF_MMAP_REGISTER", "OFF") == "ON") { register_mapping(); }
+    }
   }
 
   virtual ~memory_mapped_source()
   {
+    if (_is_registered) { cudaHostUnregister(_map_addr); }
     if (_map_addr != nullptr) { munmap(_map_addr, _map_size); }
   }
 
@@ -118,6 +247,56 @@ class memory_mapped_source : public file_source {
     return read_size;
   }
 
+  bool supports_device_read() const override
+  {
+    return _is_registered || file_source::supports_device_read();
+  }
+
+  bool is_device_read_preferred(size_t size) const override
+  {
+    return _is_registered || file_source::is_device_read_preferred(size);
+  }
+
+  std::unique_ptr<datasource::buffer> device_read(size_t offset,
+                                                  size_t size,
+                                                  rmm::cuda_stream_view stream) override
+  {
+    if (!_is_registered) { return file_source::device_read(offset, size, stream); }
+
+    CUDF_EXPECTS(offset >= _map_offset, "Requested offset is outside mapping");
+    rmm::device_buffer out_data(std::min(size, _map_size - (offset - _map_offset)), stream);
+    device_read(offset, out_data.size(), static_cast<uint8_t *>(out_data.data()), stream);
+    return datasource::buffer::create(std::move(out_data));
+  }
+
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t *dst,
+                     rmm::cuda_stream_view stream) override
+  {
+    if (!_is_registered) { return file_source::device_read(offset, size, dst, stream); }
+
+    CUDF_EXPECTS(offset >= _map_offset, "Requested offset is outside mapping");
+    auto const read_size = std::min(size, _map_size - (offset - _map_offset));
+    auto const src       = static_cast<uint8_t *>(_map_addr) + (offset - _map_offset);
+    CUDA_TRY(cudaMemcpyAsync(dst, src, read_size, cudaMemcpyHostToDevice, stream.value()));
+    return read_size;
+  }
+
+  std::future<size_t> host_read_async(std::vector<read_request> requests) override
+  {
+    advise_willneed(requests);
+    return datasource::host_read_async(std::move(requests));
+  }
+
+  std::future<size_t> device_read_async(std::vector<read_request> requests,
+                                        rmm::cuda_stream_view stream) override
+  {
+    // Registered pages are already resident
+    if (!_is_registered) { advise_willneed(requests); }
+    return datasource::device_read_async(std::move(requests), stream);
+  }
+
  private:
   void map(int fd, size_t offset, size_t size)
   {
@@ -136,10 +315,45 @@ class memory_mapped_source : public file_source {
     CUDF_EXPECTS(_map_addr != MAP_FAILED, "Cannot create memory mapping");
   }
 
+  /**
+   * @brief Pins the mapped range; on failure, the source falls back to staged device reads.
+   */
+  void register_mapping()
+  {
+    unsigned int flags = cudaHostRegisterDefault;
+#if CUDART_VERSION >= 11010
+    // The mapping is read-only
+    flags |= cudaHostRegisterReadOnly;
+#endif
+    if (cudaHostRegister(_map_addr, _map_size, flags) == cudaSuccess) {
+      _is_registered = true;
+    } else {
+      // Clear the error so that it is not reported by a later, unrelated CUDA call
+      cudaGetLastError();
+    }
+  }
+
+  /**
+   * @brief Starts the kernel readahead of the requested ranges
+   */
+  void advise_willneed(std::vector<read_request> const &requests) const
+  {
+    auto const page_mask = ~static_cast<size_t>(sysconf(_SC_PAGESIZE) - 1);
+    for (auto const &request : requests) {
+      if (request.size == 0 || request.offset < _map_offset) { continue; }
+      auto const begin = (request.offset - _map_offset) & page_mask;
+      auto const end   = std::min(request.offset - _map_offset + request.size, _map_size);
+      if (begin >= end) { continue; }
+      // Only a hint; failures do not affect the reads
+      madvise(static_cast<uint8_t *>(_map_addr) + begin, end - begin, MADV_WILLNEED);
+    }
+  }
+
  private:
-  size_t _map_size   = 0;
-  size_t _map_offset = 0;
-  void *_map_addr    = nullptr;
+  size_t _map_size    = 0;
+  size_t _map_offset  = 0;
+  void *_map_addr     = nullptr;
+  bool _is_registered = false;
 };
 
 /**
@@ -154,24 +368,21 @@ class direct_read_source : public file_source {
 
   std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
   {
-    lseek(_file.desc(), offset, SEEK_SET);
-
     // Clamp length to available data
     ssize_t const read_size = std::min(size, _file.size() - offset);
 
     std::vector<uint8_t> v(read_size);
-    CUDF_EXPECTS(read(_file.desc(), v.data(), read_size) == read_size, "read failed");
+    CUDF_EXPECTS(pread(_file.desc(), v.data(), read_size, offset) == read_size, "read failed");
     return buffer::create(std::move(v));
   }
 
   size_t host_read(size_t offset, size_t size, uint8_t *dst) override
   {
-    lseek(_file.desc(), offset, SEEK_SET);
-
     // Clamp length to available data
     auto const read_size = std::min(size, _file.size() - offset);
 
-    CUDF_EXPECTS(read(_file.desc(), dst, read_size) == static_cast<ssize_t>(read_size),
+    // `pread` leaves the file offset unchanged, so that concurrent reads are safe
+    CUDF_EXPECTS(pread(_file.desc(), dst, read_size, offset) == static_cast<ssize_t>(read_size),
                  "read failed");
     return read_size;
   }
@@ -215,6 +426,21 @@ class user_datasource_wrapper : public datasource {
     return source->device_read(offset, size, stream);
   }
 
+  bool supports_concurrent_reads() const override { return source->supports_concurrent_reads(); }
+
+  size_t read_coalesce_gap() const override { return source->read_coalesce_gap(); }
+
+  std::future<size_t> host_read_async(std::vector<read_request> requests) override
+  {
+    return source->host_read_async(std::move(requests));
+  }
+
+  std::future<size_t> device_read_async(std::vector<read_request> requests,
+                                        rmm::cuda_stream_view stream) override
+  {
+    return source->device_read_async(std::move(requests), stream);
+  }
+
   size_t size() const override { return source->size(); }
 
  private:
@@ -227,14 +453,21 @@ std::unique_ptr<datasource> datasource::create(const std::string &filepath,
                                                size_t offset,
                                                size_t size)
 {
+  if (remote_source::is_remote_uri(filepath)) {
+    CUDF_EXPECTS(offset == 0 && size == 0, "Byte ranges are not supported for remote sources");
+    return std::make_unique<remote_source>(filepath);
+  }
+  // file:// URIs are read as local files
+  auto const local_path =
+    filepath.compare(0, 7, "file://") == 0 ? filepath.substr(7) : std::string{filepath};
 #ifdef CUFILE_FOUND
   if (detail::cufile_config::instance()->is_required()) {
     // avoid mmap as GDS is expected to be used for most reads
-    return std::make_unique<direct_read_source>(filepath.c_str());
+    return std::make_unique<direct_read_source>(local_path.c_str());
   }
 #endif
   // Use our own memory mapping implementation for direct file reads
-  return std::make_unique<memory_mapped_source>(filepath.c_str(), offset, size);
+  return std::make_unique<memory_mapped_source>(local_path.c_str(), offset, size);
 }
 
 std::unique_ptr<datasource> datasource::create(host_buffer const &buffer)
@@ -250,5 +483,254 @@ std::unique_ptr<datasource> datasource::create(datasource *source)
   return std::make_unique<user_datasource_wrapper>(source);
 }
 
+std::future<size_t> datasource::host_read_async(std::vector<read_request> requests)
+{
+  return std::async(std::launch::async, [this, requests = std::move(requests)]() {
+    auto const max_workers = supports_concurrent_reads() ? max_concurrent_reads : 1;
+    auto const reads       = coalesce_requests(requests, read_coalesce_gap());
+    return parallel_sum(reads.size(), max_workers, [this, &reads](size_t r) -> size_t {
+      auto const &read = reads[r];
+      if (read.is_contiguous()) {
+        return host_read(read.offset, read.size, read.parts.front().dst);
+      }
+      // Read the whole range once and hand out the requested parts
+      auto const buffer = host_read(read.offset, read.size);
+      size_t bytes_read = 0;
+      for (auto const &part : read.parts) {
+        auto const begin = part.offset - read.offset;
+        if (begin >= buffer->size()) { continue; }
+        auto const len = std::min(part.size, buffer->size() - begin);
+        std::memcpy(part.dst, buffer->data() + begin, len);
+        bytes_read += len;
+      }
+      return bytes_read;
+    });
+  });
+}
+
+std::future<size_t> datasource::device_read_async(std::vector<read_request> requests,
+                                                   rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(supports_device_read(), "Device reads are not supported for this source.");
+  int device_id;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  auto read_batch = [this, device_id, stream, requests = std::move(requests)]() {
+    auto const max_workers = supports_concurrent_reads() ? max_concurrent_reads : 1;
+    auto const reads       = coalesce_requests(requests, read_coalesce_gap());
+    return parallel_sum(reads.size(), max_workers, [&](size_t r) -> size_t {
+      auto const &read = reads[r];
+      CUDA_TRY(cudaSetDevice(device_id));
+      if (read.is_contiguous()) {
+        return device_read(read.offset, read.size, read.parts.front().dst, stream);
+      }
+      // Read the whole range once and copy out the requested parts
+      rmm::device_buffer buffer(read.size, stream);
+      auto const read_size =
+        device_read(read.offset, read.size, static_cast<uint8_t *>(buffer.data()), stream);
+      size_t bytes_read = 0;
+      for (auto const &part : read.parts) {
+        auto const begin = part.offset - read.offset;
+        if (begin >= read_size) { continue; }
+        auto const len = std::min(part.size, read_size - begin);
+        CUDA_TRY(cudaMemcpyAsync(part.dst,
+                                 static_cast<uint8_t *>(buffer.data()) + begin,
+                                 len,
+                                 cudaMemcpyDeviceToDevice,
+                                 stream.value()));
+        bytes_read += len;
+      }
+      // The copies must complete before the intermediate buffer is released
+      stream.synchronize();
+      return bytes_read;
+    });
+  };
+  return std::async(std::launch::async, std::move(read_batch));
+}
+
+remote_source::remote_source(std::string const &uri, remote_source_options const &options)
+  : _options(options)
+{
+  CUDF_EXPECTS(_options.part_size > 0, "Remote source part size must be positive");
+  CUDF_EXPECTS(_options.max_requests > 0, "Remote source request count must be positive");
+#ifdef ARROW_S3
+  if (uri.compare(0, 5, "s3://") == 0) {
+    static std::once_flag s3_initialized;
+    std::call_once(s3_initialized, []() {
+      CUDF_EXPECTS(arrow::fs::InitializeS3({arrow::fs::S3LogLevel::Fatal}).ok(),
+                   "Cannot initialize the S3 filesystem");
+    });
+  }
+#endif
+  std::string path;
+  auto const filesystem = arrow::fs::FileSystemFromUri(uri, &path);
+  CUDF_EXPECTS(filesystem.ok(), "Unsupported remote URI: " + uri);
+  auto const file = filesystem.ValueOrDie()->OpenInputFile(path);
+  CUDF_EXPECTS(file.ok(), "Cannot open remote object: " + uri);
+  _file = file.ValueOrDie();
+
+  auto const file_size = _file->GetSize();
+  CUDF_EXPECTS(file_size.ok(), "Cannot get remote object size");
+  _size = file_size.ValueOrDie();
+}
+
+remote_source::remote_source(std::shared_ptr<arrow::io::RandomAccessFile> file,
+                             remote_source_options const &options)
+  : _file(std::move(file)), _options(options)
+{
+  CUDF_EXPECTS(_file != nullptr, "Remote source file must not be null");
+  CUDF_EXPECTS(_options.part_size > 0, "Remote source part size must be positive");
+  CUDF_EXPECTS(_options.max_requests > 0, "Remote source request count must be positive");
+  auto const file_size = _file->GetSize();
+  CUDF_EXPECTS(file_size.ok(), "Cannot get remote object size");
+  _size = file_size.ValueOrDie();
+}
+
+bool remote_source::is_remote_uri(std::string const &path)
+{
+  auto const scheme_end = path.find("://");
+  if (scheme_end == std::string::npos || scheme_end == 0) { return false; }
+  auto const scheme         = path.substr(0, scheme_end);
+  auto const is_scheme_char = [](char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '+' || c == '-' || c == '.';
+  };
+  return std::all_of(scheme.cbegin(), scheme.cend(), is_scheme_char) && scheme != "file";
+}
+
+size_t remote_source::fetch(size_t offset, size_t size, uint8_t *dst)
+{
+  auto const num_parts = (size + _options.part_size - 1) / _options.part_size;
+  return parallel_sum(num_parts, _options.max_requests, [&](size_t p) -> size_t {
+    auto const part_offset = p * _options.part_size;
+    auto const part_size   = std::min(_options.part_size, size - part_offset);
+    // A request may return fewer bytes than asked for; the rest of the part is requested again
+    // so that the parts after it are not shifted
+    size_t bytes_read = 0;
+    while (bytes_read < part_size) {
+      auto const result = _file->ReadAt(offset + part_offset + bytes_read,
+                                        part_size - bytes_read,
+                                        dst + part_offset + bytes_read);
+      CUDF_EXPECTS(result.ok(), "Cannot read remote object data");
+      CUDF_EXPECTS(result.ValueOrDie() > 0, "Unexpected end of remote object data");
+      bytes_read += result.ValueOrDie();
+    }
+    return bytes_read;
+  });
+}
+
+std::shared_ptr<std::vector<uint8_t>> remote_source::window_for(size_t offset,
+                                                                size_t size,
+                                                                size_t &window_offset)
+{
+  {
+    std::lock_guard<std::mutex> lock(_window_mutex);
+    if (_window != nullptr && offset >= _window_offset &&
+        offset + size <= _window_offset + _window->size()) {
+      window_offset = _window_offset;
+      return _window;
+    }
+  }
+  // Fetch outside of the lock so that reads served by the current window are not blocked
+  auto const fetch_size = std::min(std::max(size, _options.prefetch_size), _size - offset);
+  auto window           = std::make_shared<std::vector<uint8_t>>(fetch_size);
+  window->resize(fetch(offset, fetch_size, window->data()));
+
+  std::lock_guard<std::mutex> lock(_window_mutex);
+  _window        = window;
+  _window_offset = offset;
+  window_offset  = offset;
+  return window;
+}
+
+std::unique_ptr<datasource::buffer> remote_source::host_read(size_t offset, size_t size)
+{
+  CUDF_EXPECTS(offset <= _size, "Offset is past the end of the remote object");
+  auto const read_size = std::min(size, _size - offset);
+  if (read_size >= _options.prefetch_size) {
+    std::vector<uint8_t> data(read_size);
+    data.resize(fetch(offset, read_size, data.data()));
+    return buffer::create(std::move(data));
+  }
+
+  size_t window_offset = 0;
+  auto window          = window_for(offset, read_size, window_offset);
+  auto const begin     = offset - window_offset;
+  auto const data      = window->data() + begin;
+  auto const data_size = std::min(read_size, window->size() - begin);
+  return std::make_unique<owning_buffer<std::shared_ptr<std::vector<uint8_t>>>>(
+    std::move(window), data, data_size);
+}
+
+size_t remote_source::host_read(size_t offset, size_t size, uint8_t *dst)
+{
+  CUDF_EXPECTS(offset <= _size, "Offset is past the end of the remote object");
+  auto const read_size = std::min(size, _size - offset);
+  if (read_size >= _options.prefetch_size) { return fetch(offset, read_size, dst); }
+
+  size_t window_offset = 0;
+  auto const window    = window_for(offset, read_size, window_offset);
+  auto const begin     = offset - window_offset;
+  auto const data_size = std::min(read_size, window->size() - begin);
+  std::memcpy(dst, window->data() + begin, data_size);
+  return data_size;
+}
+
+namespace detail {
+
+std::future<size_t> read_to_device_async(datasource &source,
+                                         std::vector<datasource::read_request> requests,
+                                         rmm::cuda_stream_view stream)
+{
+  int device_id;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  return std::async(
+    std::launch::async, [&source, device_id, stream, requests = std::move(requests)]() {
+      CUDA_TRY(cudaSetDevice(device_id));
+      std::vector<datasource::read_request> device_requests;
+      std::vector<datasource::read_request> host_requests;
+      size_t staging_size = 0;
+      for (auto const &request : requests) {
+        if (source.is_device_read_preferred(request.size)) {
+          device_requests.push_back(request);
+        } else {
+          host_requests.push_back(request);
+          staging_size += request.size;
+        }
+      }
+
+      // Host reads land in a pinned staging buffer, at the same position as their requests in the
+      // batch, so that the copies to the device are asynchronous
+      pinned_buffer<uint8_t> staging(staging_size);
+      std::vector<datasource::read_request> staging_requests;
+      for (size_t i = 0, staging_pos = 0; i < host_requests.size(); ++i) {
+        staging_requests.push_back(
+          {host_requests[i].offset, host_requests[i].size, staging.data() + staging_pos});
+        staging_pos += host_requests[i].size;
+      }
+
+      // Issue both batches before waiting on either
+      std::future<size_t> device_reads;
+      if (!device_requests.empty()) {
+        device_reads = source.device_read_async(std::move(device_requests), stream);
+      }
+      auto host_reads  = source.host_read_async(std::move(staging_requests));
+      size_t bytes_read = host_reads.get();
+      if (device_reads.valid()) { bytes_read += device_reads.get(); }
+
+      for (size_t i = 0, staging_pos = 0; i < host_requests.size(); ++i) {
+        CUDA_TRY(cudaMemcpyAsync(host_requests[i].dst,
+                                 staging.data() + staging_pos,
+                                 host_requests[i].size,
+                                 cudaMemcpyHostToDevice,
+                                 stream.value()));
+        staging_pos += host_requests[i].size;
+      }
+      // The copies must complete before the staging buffer is released
+      if (!host_requests.empty()) { stream.synchronize(); }
+      return bytes_read;
+    });
+}
+
+}  // namespace detail
+
 }  // namespace io
 }  // namespace cudf
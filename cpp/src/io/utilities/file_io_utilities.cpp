@@ -19,7 +19,10 @@
 
 #include <dlfcn.h>
 
+#include <algorithm>
+#include <exception>
 #include <fstream>
+#include <vector>
 
 namespace cudf {
 namespace io {
@@ -52,9 +55,40 @@ std::string getenv_or(std::string const &env_var_name, std::string const &defaul
   return (env_val == nullptr) ? default_val : std::string(env_val);
 }
 
+std::vector<file_slice> make_file_slices(size_t offset, size_t size, size_t slice_size)
+{
+  CUDF_EXPECTS(slice_size > 0, "Slice size must be positive");
+  std::vector<file_slice> slices;
+  slices.reserve(size / slice_size + 2);
+  for (size_t pos = offset; pos < offset + size;) {
+    auto const slice_end = std::min(offset + size, (pos / slice_size + 1) * slice_size);
+    slices.push_back({pos, slice_end - pos});
+    pos = slice_end;
+  }
+  return slices;
+}
+
 #ifdef CUFILE_FOUND
 
-cufile_config::cufile_config() : policy{getenv_or("LIBCUDF_CUFILE_POLICY", default_policy)}
+/**
+ * @brief Returns the positive integer value of an environment variable, or the default value if
+ * the variable is not set.
+ */
+size_t getenv_or(std::string const &env_var_name, size_t default_val)
+{
+  auto const env_val = std::getenv(env_var_name.c_str());
+  if (env_val == nullptr) { return default_val; }
+  auto const value = std::stoll(env_val);
+  CUDF_EXPECTS(value > 0, env_var_name + " must be a positive integer");
+  return static_cast<size_t>(value);
+}
+
+cufile_config::cufile_config()
+  : policy{getenv_or("LIBCUDF_CUFILE_POLICY", default_policy)},
+    _thread_count{getenv_or("LIBCUDF_CUFILE_THREAD_COUNT", default_thread_count)},
+    _slice_size{(getenv_or("LIBCUDF_CUFILE_SLICE_SIZE", default_slice_size) +
+                 cufile_slice_alignment - 1) /
+                cufile_slice_alignment * cufile_slice_alignment}
 {
   if (is_enabled()) {
     // Modify the config file based on the policy
@@ -166,7 +200,9 @@ void cufile_registered_file::register_handle()
 cufile_registered_file::~cufile_registered_file() { shim->handle_deregister(cf_handle); }
 
 cufile_input_impl::cufile_input_impl(std::string const &filepath)
-  : shim{cufile_shim::instance()}, cf_file(shim, filepath, O_RDONLY | O_DIRECT)
+  : shim{cufile_shim::instance()},
+    cf_file(shim, filepath, O_RDONLY | O_DIRECT),
+    pool(cufile_config::instance()->thread_count())
 {
 }
 
@@ -175,8 +211,7 @@ std::unique_ptr<datasource::buffer> cufile_input_impl::read(size_t offset,
                                                             rmm::cuda_stream_view stream)
 {
   rmm::device_buffer out_data(size, stream);
-  CUDF_EXPECTS(shim->read(cf_file.handle(), out_data.data(), size, offset, 0) != -1,
-               "cuFile error reading from a file");
+  read(offset, size, static_cast<uint8_t *>(out_data.data()), stream);
 
   return datasource::buffer::create(std::move(out_data));
 }
@@ -186,10 +221,44 @@ size_t cufile_input_impl::read(size_t offset,
                                uint8_t *dst,
                                rmm::cuda_stream_view stream)
 {
-  CUDF_EXPECTS(shim->read(cf_file.handle(), dst, size, offset, 0) != -1,
-               "cuFile error reading from a file");
-  // always read the requested size for now
-  return size;
+  return read_async(offset, size, dst, stream).get();
+}
+
+std::future<size_t> cufile_input_impl::read_async(size_t offset,
+                                                  size_t size,
+                                                  uint8_t *dst,
+                                                  rmm::cuda_stream_view stream)
+{
+  int device_id;
+  CUDA_TRY(cudaGetDevice(&device_id));
+
+  std::vector<std::future<size_t>> slices;
+  for (auto const &slice :
+       make_file_slices(offset, size, cufile_config::instance()->slice_size())) {
+    slices.push_back(pool.submit([=]() -> size_t {
+      CUDA_TRY(cudaSetDevice(device_id));
+      auto const bytes_read = shim->read(
+        cf_file.handle(), dst + (slice.offset - offset), slice.size, slice.offset, 0);
+      CUDF_EXPECTS(bytes_read != -1, "cuFile error reading from a file");
+      // always read the requested size for now
+      return slice.size;
+    }));
+  }
+
+  return std::async(std::launch::deferred, [slices = std::move(slices)]() mutable {
+    // Wait for all slices before rethrowing the first failure
+    size_t bytes_read = 0;
+    std::exception_ptr error;
+    for (auto &slice : slices) {
+      try {
+        bytes_read += slice.get();
+      } catch (...) {
+        if (!error) { error = std::current_exception(); }
+      }
+    }
+    if (error) { std::rethrow_exception(error); }
+    return bytes_read;
+  });
 }
 
 cufile_output_impl::cufile_output_impl(std::string const &filepath)
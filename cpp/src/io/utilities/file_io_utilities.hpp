@@ -21,17 +21,43 @@
 #include <cudf_test/file_utilities.hpp>
 #endif
 
+#include "thread_pool.hpp"
+
 #include <rmm/cuda_stream_view.hpp>
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <future>
 #include <string>
+#include <vector>
 
 namespace cudf {
 namespace io {
 namespace detail {
 
+/**
+ * @brief Returns the value of an environment variable, or the default value if the variable is not
+ * set.
+ */
+std::string getenv_or(std::string const &env_var_name, std::string const &default_val);
+
+/**
+ * @brief Range of bytes in a file.
+ */
+struct file_slice {
+  size_t offset;
+  size_t size;
+};
+
+/**
+ * @brief Splits the range of `size` bytes at `offset` into slices that end at multiples of
+ * `slice_size` in the file.
+ *
+ * Only the first and the last slice can be shorter than `slice_size`.
+ */
+std::vector<file_slice> make_file_slices(size_t offset, size_t size, size_t slice_size);
+
 /**
  * @brief Class that provides RAII for file handling.
  */
@@ -106,6 +132,23 @@ class cufile_input : public cufile_io_base {
    * @return The number of bytes read
    */
   virtual size_t read(size_t offset, size_t size, uint8_t *dst, rmm::cuda_stream_view stream) = 0;
+
+  /**
+   * @brief Asynchronously reads into existing device memory.
+   *
+   *  @throws cudf::logic_error on cuFile error
+   *
+   * @param offset Number of bytes from the start
+   * @param size Number of bytes to read
+   * @param dst Address of the existing device memory
+   * @param stream CUDA stream to use
+   *
+   * @return Future of the number of bytes read; the data is available once the future is ready
+   */
+  virtual std::future<size_t> read_async(size_t offset,
+                                         size_t size,
+                                         uint8_t *dst,
+                                         rmm::cuda_stream_view stream) = 0;
 };
 
 /**
@@ -129,6 +172,12 @@ class cufile_output : public cufile_io_base {
 
 class cufile_shim;
 
+/**
+ * @brief Alignment of the slices that cuFile reads are split into, so that each slice can use
+ * `O_DIRECT` transfers
+ */
+constexpr size_t cufile_slice_alignment = 4 << 10;
+
 /**
  * @brief Class that manages cuFile configuration.
  */
@@ -136,7 +185,12 @@ class cufile_config {
   std::string const default_policy    = "OFF";
   std::string const json_path_env_var = "CUFILE_ENV_PATH_JSON";
 
+  static constexpr size_t default_thread_count = 16;
+  static constexpr size_t default_slice_size   = 4 << 20;
+
   std::string const policy = default_policy;
+  size_t const _thread_count;
+  size_t const _slice_size;
   temp_directory tmp_config_dir{"cudf_cufile_config"};
 
   cufile_config();
@@ -152,6 +206,18 @@ class cufile_config {
    */
   bool is_required() const { return policy == "ALWAYS"; }
 
+  /**
+   * @brief Returns the number of threads that issue the slices of each cuFile read.
+   */
+  size_t thread_count() const { return _thread_count; }
+
+  /**
+   * @brief Returns the size of the slices that cuFile reads are split into, in bytes.
+   *
+   * Always a multiple of `cufile_slice_alignment`.
+   */
+  size_t slice_size() const { return _slice_size; }
+
   static cufile_config const *instance();
 };
 
@@ -190,7 +256,9 @@ struct cufile_registered_file {
 /**
  * @brief Adapter for the `cuFileRead` API.
  *
- * Exposes APIs to read directly from a file into device memory.
+ * Exposes APIs to read directly from a file into device memory. Reads larger than the configured
+ * slice size are split into aligned slices that are read concurrently, so that a single read can
+ * use the bandwidth of multiple drives.
  */
 class cufile_input_impl final : public cufile_input {
  public:
@@ -202,9 +270,15 @@ class cufile_input_impl final : public cufile_input {
 
   size_t read(size_t offset, size_t size, uint8_t *dst, rmm::cuda_stream_view stream) override;
 
+  std::future<size_t> read_async(size_t offset,
+                                 size_t size,
+                                 uint8_t *dst,
+                                 rmm::cuda_stream_view stream) override;
+
  private:
   cufile_shim const *shim = nullptr;
   cufile_registered_file const cf_file;
+  thread_pool pool;
 };
 
 /**
@@ -237,6 +311,14 @@ class cufile_input_impl final : public cufile_input {
   {
     CUDF_FAIL("Only used to compile without cufile library, should not be called");
   }
+
+  std::future<size_t> read_async(size_t offset,
+                                 size_t size,
+                                 uint8_t *dst,
+                                 rmm::cuda_stream_view stream) override
+  {
+    CUDF_FAIL("Only used to compile without cufile library, should not be called");
+  }
 };
 
 class cufile_output_impl final : public cufile_output {
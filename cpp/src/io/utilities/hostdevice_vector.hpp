@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "pinned_memory_pool.hpp"
+
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
 
@@ -26,6 +28,9 @@
  * @brief A helper class that wraps fixed-length device memory for the GPU, and
  * a mirror host pinned memory for the CPU.
  *
+ * The host memory comes from the pinned memory pool, so short-lived vectors do not pay for a
+ * pinned allocation.
+ *
  * This abstraction allocates a specified fixed chunk of device memory that can
  * initialized upfront, or gradually initialized as required.
  * The host-side memory can be used to manipulate data on the CPU before and
@@ -57,7 +62,8 @@ class hostdevice_vector {
     : num_elements(initial_size), max_elements(max_size)
   {
     if (max_elements != 0) {
-      CUDA_TRY(cudaMallocHost(&h_data, sizeof(T) * max_elements));
+      h_data = static_cast<T *>(
+        cudf::io::detail::pinned_memory_pool::instance().allocate(sizeof(T) * max_elements));
       d_data.resize(sizeof(T) * max_elements, stream);
     }
   }
@@ -65,8 +71,8 @@ class hostdevice_vector {
   ~hostdevice_vector()
   {
     if (max_elements != 0) {
-      auto const free_result = cudaFreeHost(h_data);
-      assert(free_result == cudaSuccess);
+      cudf::io::detail::pinned_memory_pool::instance().deallocate(h_data,
+                                                                  sizeof(T) * max_elements);
     }
   }
 
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pinned_memory_pool.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstdlib>
+#include <string>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+namespace {
+
+size_t max_cached_bytes_from_env()
+{
+  auto const env_val = std::getenv("LIBCUDF_PINNED_POOL_SIZE");
+  return (env_val == nullptr) ? size_t{1} << 30 : std::stoull(env_val);
+}
+
+}  // namespace
+
+pinned_memory_pool::pinned_memory_pool() : _max_cached_bytes{max_cached_bytes_from_env()} {}
+
+pinned_memory_pool &pinned_memory_pool::instance()
+{
+  // Never destroyed; freeing pinned memory during static destruction can race the CUDA teardown
+  static auto *_instance = new pinned_memory_pool();
+  return *_instance;
+}
+
+int pinned_memory_pool::size_class(size_t size)
+{
+  int bits = min_class_bits;
+  while (bits <= max_class_bits && (size_t{1} << bits) < size) {
+    ++bits;
+  }
+  return bits <= max_class_bits ? bits - min_class_bits : -1;
+}
+
+void *pinned_memory_pool::allocate(size_t size)
+{
+  auto const cls = size_class(size);
+  if (cls >= 0) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto &blocks = _free_blocks[cls];
+    if (!blocks.empty()) {
+      auto ptr = blocks.back();
+      blocks.pop_back();
+      _cached_bytes -= size_t{1} << (cls + min_class_bits);
+      return ptr;
+    }
+  }
+
+  void *ptr = nullptr;
+  CUDA_TRY(cudaMallocHost(&ptr, cls >= 0 ? size_t{1} << (cls + min_class_bits) : size));
+  return ptr;
+}
+
+void pinned_memory_pool::deallocate(void *ptr, size_t size)
+{
+  auto const cls = size_class(size);
+  if (cls >= 0) {
+    auto const block_size = size_t{1} << (cls + min_class_bits);
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_cached_bytes + block_size <= _max_cached_bytes) {
+      _free_blocks[cls].push_back(ptr);
+      _cached_bytes += block_size;
+      return;
+    }
+  }
+  cudaFreeHost(ptr);
+}
+
+void pinned_memory_pool::release()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  for (auto &blocks : _free_blocks) {
+    for (auto ptr : blocks) {
+      cudaFreeHost(ptr);
+    }
+    blocks.clear();
+  }
+  _cached_bytes = 0;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
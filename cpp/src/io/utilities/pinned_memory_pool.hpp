@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Process-wide cache of pinned host memory blocks.
+ *
+ * Requests are rounded up to a power-of-two size class, and freed blocks are kept for reuse by
+ * later requests of the same class, so that repeated staging of host-device transfers does not pay
+ * for `cudaMallocHost`. The total size of the cached blocks is capped by the
+ * `LIBCUDF_PINNED_POOL_SIZE` environment variable (in bytes, 1 GiB by default); blocks freed past
+ * the cap, and requests larger than the largest size class, go straight back to CUDA.
+ */
+class pinned_memory_pool {
+ public:
+  pinned_memory_pool(pinned_memory_pool const &) = delete;
+  pinned_memory_pool &operator=(pinned_memory_pool const &) = delete;
+
+  /**
+   * @brief Returns the pool shared by all cuIO readers and writers.
+   */
+  static pinned_memory_pool &instance();
+
+  /**
+   * @brief Returns a pinned host block of at least `size` bytes.
+   *
+   *  @throws cudf::cuda_error if the allocation fails
+   */
+  void *allocate(size_t size);
+
+  /**
+   * @brief Returns a block to the pool.
+   *
+   * @param ptr Block returned by `allocate`
+   * @param size The size passed to `allocate`
+   */
+  void deallocate(void *ptr, size_t size);
+
+  /**
+   * @brief Frees all cached blocks.
+   */
+  void release();
+
+ private:
+  pinned_memory_pool();
+
+  static constexpr int min_class_bits = 12;  // 4 KiB
+  static constexpr int max_class_bits = 28;  // 256 MiB
+
+  /**
+   * @brief Returns the index of the size class that holds `size` bytes, or -1 if the size is
+   * larger than all classes.
+   */
+  static int size_class(size_t size);
+
+  size_t const _max_cached_bytes;
+  std::mutex _mutex;
+  size_t _cached_bytes = 0;
+  std::array<std::vector<void *>, max_class_bits - min_class_bits + 1> _free_blocks;
+};
+
+/**
+ * @brief Owning handle to a buffer from the pinned memory pool.
+ *
+ * @tparam T Element type
+ */
+template <typename T>
+class pinned_buffer {
+ public:
+  pinned_buffer() = default;
+
+  /**
+   * @brief Allocates a buffer of `size` elements.
+   */
+  explicit pinned_buffer(size_t size)
+    : _data(size != 0 ? static_cast<T *>(pinned_memory_pool::instance().allocate(size * sizeof(T)))
+                      : nullptr),
+      _size(size)
+  {
+  }
+
+  pinned_buffer(pinned_buffer &&other) noexcept
+    : _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0))
+  {
+  }
+
+  pinned_buffer &operator=(pinned_buffer &&other) noexcept
+  {
+    if (this != &other) {
+      reset();
+      _data = std::exchange(other._data, nullptr);
+      _size = std::exchange(other._size, 0);
+    }
+    return *this;
+  }
+
+  ~pinned_buffer() { reset(); }
+
+  T *get() const noexcept { return _data; }
+  T *data() const noexcept { return _data; }
+  size_t size() const noexcept { return _size; }
+  explicit operator bool() const noexcept { return _data != nullptr; }
+
+  /**
+   * @brief Returns the buffer to the pool.
+   */
+  void reset() noexcept
+  {
+    if (_data != nullptr) { pinned_memory_pool::instance().deallocate(_data, _size * sizeof(T)); }
+    _data = nullptr;
+    _size = 0;
+  }
+
+ private:
+  T *_data     = nullptr;
+  size_t _size = 0;
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/ast/linearizer.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Returns the widest [min, max] range representable by the output column type
+ *
+ * Used in place of missing statistics so that the block is never skipped.
+ */
+template <typename T>
+std::pair<T, T> unbounded_stats_range()
+{
+  if constexpr (cudf::is_chrono<T>()) {
+    using rep = typename T::rep;
+    return {T{typename T::duration{std::numeric_limits<rep>::lowest()}},
+            T{typename T::duration{std::numeric_limits<rep>::max()}}};
+  } else if constexpr (std::is_floating_point<T>::value) {
+    return {-std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity()};
+  } else {
+    return {std::numeric_limits<T>::lowest(), std::numeric_limits<T>::max()};
+  }
+}
+
+/**
+ * @brief Rewrites a filter on table columns into a filter on the statistics of row blocks, such
+ * as Parquet row groups or ORC stripes.
+ *
+ * The statistics table holds an all-true BOOL8 column at index 0, followed by a min and a max
+ * column for each entry of `stats_columns`. A comparison between a column and a literal is
+ * replaced by the equivalent test against that column's [min, max] range. Any subexpression that
+ * cannot be evaluated from statistics is replaced by the all-true column, so the converted
+ * expression never rejects a block that may contain a matching row.
+ */
+class stats_expression_converter {
+ public:
+  stats_expression_converter(ast::expression const &expr,
+                             std::vector<size_type> const &stats_columns)
+    : _stats_columns(stats_columns), _root(convert(expr))
+  {
+  }
+
+  /**
+   * @brief Returns the converted expression, or nullptr if no block can be skipped.
+   */
+  ast::expression const *get_expression() const
+  {
+    return dynamic_cast<ast::expression const *>(&_root);
+  }
+
+ private:
+  ast::detail::node const &always_true() { return _always_true; }
+
+  ast::detail::node const &make_expression(ast::ast_operator op,
+                                           ast::detail::node const &left,
+                                           ast::detail::node const &right)
+  {
+    return _expressions.emplace_back(op, left, right);
+  }
+
+  ast::detail::node const &convert(ast::detail::node const &node)
+  {
+    auto const expr = dynamic_cast<ast::expression const *>(&node);
+    if (expr == nullptr) { return always_true(); }
+
+    auto const op       = expr->get_operator();
+    auto const operands = expr->get_operands();
+    if (op == ast::ast_operator::LOGICAL_AND || op == ast::ast_operator::LOGICAL_OR) {
+      return make_expression(op, convert(operands[0].get()), convert(operands[1].get()));
+    }
+    if (operands.size() != 2) { return always_true(); }
+
+    // Normalize to `column op literal`
+    auto col = dynamic_cast<ast::column_reference const *>(&operands[0].get());
+    auto lit = dynamic_cast<ast::literal const *>(&operands[1].get());
+    auto cmp = op;
+    if (col == nullptr && lit == nullptr) {
+      col = dynamic_cast<ast::column_reference const *>(&operands[1].get());
+      lit = dynamic_cast<ast::literal const *>(&operands[0].get());
+      switch (op) {
+        case ast::ast_operator::LESS: cmp = ast::ast_operator::GREATER; break;
+        case ast::ast_operator::GREATER: cmp = ast::ast_operator::LESS; break;
+        case ast::ast_operator::LESS_EQUAL: cmp = ast::ast_operator::GREATER_EQUAL; break;
+        case ast::ast_operator::GREATER_EQUAL: cmp = ast::ast_operator::LESS_EQUAL; break;
+        default: break;
+      }
+    }
+    if (col == nullptr || lit == nullptr ||
+        col->get_table_source() != ast::table_reference::LEFT) {
+      return always_true();
+    }
+    auto const it =
+      std::find(_stats_columns.begin(), _stats_columns.end(), col->get_column_index());
+    if (it == _stats_columns.end()) { return always_true(); }
+
+    auto const stats_idx = static_cast<size_type>(std::distance(_stats_columns.begin(), it));
+    auto const &min_col  = _column_refs.emplace_back(2 * stats_idx + 1);
+    auto const &max_col  = _column_refs.emplace_back(2 * stats_idx + 2);
+    switch (cmp) {
+      case ast::ast_operator::EQUAL:
+        return make_expression(ast::ast_operator::LOGICAL_AND,
+                               make_expression(ast::ast_operator::LESS_EQUAL, min_col, *lit),
+                               make_expression(ast::ast_operator::GREATER_EQUAL, max_col, *lit));
+      case ast::ast_operator::NOT_EQUAL:
+        return make_expression(ast::ast_operator::LOGICAL_OR,
+                               make_expression(ast::ast_operator::NOT_EQUAL, min_col, *lit),
+                               make_expression(ast::ast_operator::NOT_EQUAL, max_col, *lit));
+      case ast::ast_operator::LESS:
+      case ast::ast_operator::LESS_EQUAL: return make_expression(cmp, min_col, *lit);
+      case ast::ast_operator::GREATER:
+      case ast::ast_operator::GREATER_EQUAL: return make_expression(cmp, max_col, *lit);
+      default: return always_true();
+    }
+  }
+
+  std::vector<size_type> const &_stats_columns;
+  ast::column_reference const _always_true{0};
+  // std::list keeps node addresses stable as the tree grows
+  std::list<ast::column_reference> _column_refs;
+  std::list<ast::expression> _expressions;
+  ast::detail::node const &_root;
+};
+
+/**
+ * @brief Collects the indices of all columns referenced by an expression
+ */
+inline void collect_column_references(ast::detail::node const &node,
+                                      std::vector<size_type> &columns)
+{
+  if (auto const col = dynamic_cast<ast::column_reference const *>(&node)) {
+    if (std::find(columns.begin(), columns.end(), col->get_column_index()) == columns.end()) {
+      columns.push_back(col->get_column_index());
+    }
+  } else if (auto const expr = dynamic_cast<ast::expression const *>(&node)) {
+    for (auto const &operand : expr->get_operands()) {
+      collect_column_references(operand.get(), columns);
+    }
+  }
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/error.hpp>
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief A fixed set of threads that run the submitted tasks in submission order.
+ *
+ * Exceptions thrown by a task are stored in its future. The destructor waits for the tasks that
+ * were already submitted.
+ */
+class thread_pool {
+ public:
+  /**
+   * @brief Starts `num_threads` threads.
+   */
+  explicit thread_pool(size_t num_threads)
+  {
+    CUDF_EXPECTS(num_threads > 0, "Thread pool needs at least one thread");
+    _threads.reserve(num_threads);
+    for (size_t t = 0; t < num_threads; ++t) {
+      _threads.emplace_back([this]() { worker(); });
+    }
+  }
+
+  thread_pool(thread_pool const &) = delete;
+  thread_pool &operator=(thread_pool const &) = delete;
+
+  ~thread_pool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _task_available.notify_all();
+    for (auto &thread : _threads) {
+      thread.join();
+    }
+  }
+
+  /**
+   * @brief Returns the number of threads in the pool.
+   */
+  size_t size() const noexcept { return _threads.size(); }
+
+  /**
+   * @brief Queues a task for execution.
+   *
+   * @param task Callable with no parameters
+   *
+   * @return Future of the value returned by the task
+   */
+  template <typename F>
+  auto submit(F &&task) -> std::future<std::invoke_result_t<F>>
+  {
+    auto packaged = std::make_shared<std::packaged_task<std::invoke_result_t<F>()>>(
+      std::forward<F>(task));
+    auto result = packaged->get_future();
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _tasks.emplace([packaged]() { (*packaged)(); });
+    }
+    _task_available.notify_one();
+    return result;
+  }
+
+ private:
+  void worker()
+  {
+    while (true) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _task_available.wait(lock, [this]() { return _stop || !_tasks.empty(); });
+        if (_tasks.empty()) { return; }
+        task = std::move(_tasks.front());
+        _tasks.pop();
+      }
+      task();
+    }
+  }
+
+  std::vector<std::thread> _threads;
+  std::queue<std::function<void()>> _tasks;
+  std::mutex _mutex;
+  std::condition_variable _task_available;
+  bool _stop = false;
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
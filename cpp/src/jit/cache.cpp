@@ -14,12 +14,25 @@
  * limitations under the License.
  */
 
+#include <io/utilities/thread_pool.hpp>
+#include <jit/cache.hpp>
+
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/jit_cache.hpp>
 
 #include <cuda.h>
 #include <boost/filesystem.hpp>
 #include <jitify2.hpp>
 
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <string>
+#include <unordered_set>
+
 namespace cudf {
 namespace jit {
 
@@ -102,6 +115,16 @@ std::string get_program_cache_dir()
 #endif
 }
 
+/**
+ * @brief Returns the value of the environment variable `name` parsed as a number, or
+ * `default_value` if it is not defined.
+ */
+std::size_t get_env_limit(char const* name, std::size_t default_value)
+{
+  auto const value = std::getenv(name);
+  return value != nullptr ? std::stoull(value) : default_value;
+}
+
 jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData preprog)
 {
   static std::mutex caches_mutex{};
@@ -112,9 +135,15 @@ jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData prep
   auto existing_cache = caches.find(preprog.name());
 
   if (existing_cache == caches.end()) {
-    auto res = caches.insert(
+    // Least recently used kernels are evicted from either cache once it holds its limit
+    auto const memory_limit = get_env_limit("LIBCUDF_KERNEL_CACHE_LIMIT_PER_PROCESS", 100);
+    auto const disk_limit   = get_env_limit("LIBCUDF_KERNEL_CACHE_LIMIT_DISK", 10'000);
+    // jitify2 would default a disk limit of 0 to the memory limit, so 0 disables the disk cache
+    auto const cache_dir = disk_limit == 0 ? std::string{} : get_program_cache_dir();
+    auto res             = caches.insert(
       {preprog.name(),
-       std::make_unique<jitify2::ProgramCache<>>(100, preprog, nullptr, get_program_cache_dir())});
+       std::make_unique<jitify2::ProgramCache<>>(
+         memory_limit, preprog, nullptr, cache_dir, disk_limit)});
 
     existing_cache = res.first;
   }
@@ -122,5 +151,103 @@ jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData prep
   return *(existing_cache->second);
 }
 
+namespace {
+
+struct kernel_lookup_counters {
+  std::mutex mutex;
+  std::unordered_set<std::size_t> used_kernels;
+  jit_cache_statistics statistics;
+};
+
+kernel_lookup_counters& get_kernel_lookup_counters()
+{
+  static kernel_lookup_counters counters{};
+  return counters;
+}
+
+}  // namespace
+
+void record_kernel_lookup(std::string const& program,
+                          std::string const& kernel,
+                          std::unordered_map<std::string, std::string> const& extra_sources,
+                          std::chrono::nanoseconds duration)
+{
+  auto key = program + '\n' + kernel;
+  for (auto const& source : extra_sources) {
+    key += '\n' + source.first + '\n' + source.second;
+  }
+  auto const key_hash = std::hash<std::string>{}(key);
+
+  auto& counters = get_kernel_lookup_counters();
+  std::lock_guard<std::mutex> lock(counters.mutex);
+  ++counters.statistics.lookups;
+  if (counters.used_kernels.insert(key_hash).second) {
+    ++counters.statistics.misses;
+    counters.statistics.miss_duration += duration;
+  }
+}
+
+namespace {
+
+io::detail::thread_pool& get_compile_pool()
+{
+  static io::detail::thread_pool pool(get_env_limit(
+    "LIBCUDF_JIT_COMPILE_THREADS", std::max(1u, std::thread::hardware_concurrency())));
+  return pool;
+}
+
+}  // namespace
+
+std::future<kernel_type> get_kernel_async(
+  jitify2::PreprocessedProgramData preprog,
+  std::string const& name,
+  std::unordered_map<std::string, std::string> const& extra_sources)
+{
+  // The kernel is compiled for the architecture of the device current in the calling thread
+  int device;
+  CUDA_TRY(cudaGetDevice(&device));
+  return get_compile_pool().submit([preprog, name, extra_sources, device]() {
+    CUDA_TRY(cudaSetDevice(device));
+    return get_kernel(preprog, name, extra_sources);
+  });
+}
+
+std::future<void> prewarm_kernels_async(jitify2::PreprocessedProgramData preprog,
+                                        std::vector<std::string> const& names)
+{
+  auto kernels = std::make_shared<std::vector<std::future<kernel_type>>>();
+  kernels->reserve(names.size());
+  for (auto const& name : names) {
+    kernels->push_back(get_kernel_async(preprog, name));
+  }
+  // Deferred, so waiting runs in the thread getting the future instead of occupying a worker
+  return std::async(std::launch::deferred, [kernels]() {
+    for (auto& kernel : *kernels) {
+      kernel.get();
+    }
+  });
+}
+
+void prewarm_kernels(jitify2::PreprocessedProgramData preprog,
+                     std::vector<std::string> const& names)
+{
+  prewarm_kernels_async(preprog, names).get();
+}
+
 }  // namespace jit
+
+jit_cache_statistics get_jit_cache_statistics()
+{
+  auto& counters = jit::get_kernel_lookup_counters();
+  std::lock_guard<std::mutex> lock(counters.mutex);
+  return counters.statistics;
+}
+
+void reset_jit_cache_statistics()
+{
+  auto& counters = jit::get_kernel_lookup_counters();
+  std::lock_guard<std::mutex> lock(counters.mutex);
+  counters.statistics = jit_cache_statistics{};
+}
+
 }  // namespace cudf
@@ -17,12 +17,95 @@
 #pragma once
 
 #include <jitify2.hpp>
+
+#include <chrono>
+#include <future>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 namespace jit {
 
 jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData preprog);
 
+/**
+ * @brief Records a kernel lookup in the counters returned by `get_jit_cache_statistics`.
+ *
+ * @param program Name of the program of the kernel
+ * @param kernel Name of the kernel
+ * @param extra_sources Generated headers compiled with the program, by file name
+ * @param duration Time spent getting the kernel from the caches or compiling it
+ */
+void record_kernel_lookup(std::string const& program,
+                          std::string const& kernel,
+                          std::unordered_map<std::string, std::string> const& extra_sources,
+                          std::chrono::nanoseconds duration);
+
+/**
+ * @brief Returns the kernel `name` of the program `preprog`, taken from the kernel caches or
+ * compiled for the current device.
+ *
+ * @param preprog The preprocessed program defining the kernel
+ * @param name Name of the kernel, with its template arguments
+ * @param extra_sources Generated headers compiled with the program, by file name
+ */
+inline auto get_kernel(jitify2::PreprocessedProgramData preprog,
+                       std::string const& name,
+                       std::unordered_map<std::string, std::string> const& extra_sources = {})
+{
+  auto const start = std::chrono::steady_clock::now();
+  auto kernel = get_program_cache(preprog).get_kernel(name, {}, extra_sources, {"-arch=sm_."});
+  record_kernel_lookup(
+    preprog.name(), name, extra_sources, std::chrono::steady_clock::now() - start);
+  return kernel;
+}
+
+/**
+ * @brief Type of the kernels returned by `get_kernel`.
+ */
+using kernel_type = decltype(get_kernel(std::declval<jitify2::PreprocessedProgramData>(), {}));
+
+/**
+ * @brief Returns the kernel `name` of the program `preprog` without waiting for it to be taken
+ * from the kernel caches or compiled.
+ *
+ * The lookup runs on a pool of compilation threads, of `LIBCUDF_JIT_COMPILE_THREADS` threads
+ * (default: the number of hardware threads), for the device current in the calling thread.
+ *
+ * @param preprog The preprocessed program defining the kernel
+ * @param name Name of the kernel, with its template arguments
+ * @param extra_sources Generated headers compiled with the program, by file name
+ *
+ * @return Future of the kernel, holding the compilation error if it failed
+ */
+std::future<kernel_type> get_kernel_async(
+  jitify2::PreprocessedProgramData preprog,
+  std::string const& name,
+  std::unordered_map<std::string, std::string> const& extra_sources = {});
+
+/**
+ * @brief Loads or compiles the kernels `names` of the program `preprog` ahead of their first use,
+ * concurrently on the compilation threads of `get_kernel_async`.
+ *
+ * @param preprog The preprocessed program defining the kernels
+ * @param names Names of the kernels, with their template arguments
+ *
+ * @return Future that waits for all the kernels, rethrowing the first compilation error
+ */
+std::future<void> prewarm_kernels_async(jitify2::PreprocessedProgramData preprog,
+                                        std::vector<std::string> const& names);
+
+/**
+ * @brief Loads or compiles the kernels `names` of the program `preprog` ahead of their first use.
+ *
+ * @param preprog The preprocessed program defining the kernels
+ * @param names Names of the kernels, with their template arguments
+ */
+void prewarm_kernels(jitify2::PreprocessedProgramData preprog,
+                     std::vector<std::string> const& names);
+
 }  // namespace jit
 }  // namespace cudf
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <join/join_common_utils.hpp>
+#include <structs/utilities.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the distance from `lower` to `upper`, where `lower` is not greater than `upper`.
+ */
+template <typename T>
+__device__ double on_distance(T lower, T upper)
+{
+  if constexpr (cudf::is_timestamp<T>()) {
+    return static_cast<double>(upper.time_since_epoch().count() -
+                               lower.time_since_epoch().count());
+  } else if constexpr (cudf::is_duration<T>()) {
+    return static_cast<double>(upper.count() - lower.count());
+  } else if constexpr (std::is_floating_point_v<T>) {
+    return static_cast<double>(upper) - static_cast<double>(lower);
+  } else {
+    return static_cast<double>(upper - lower);
+  }
+}
+
+/**
+ * @brief Matches each left row to the nearest right row with equal `by` keys.
+ */
+struct asof_join_functor {
+  template <typename T, std::enable_if_t<cudf::is_numeric<T>() or cudf::is_chrono<T>()>* = nullptr>
+  void operator()(table_view const& left_by,
+                  table_view const& right_by,
+                  table_view const& left_keys,
+                  table_view const& right_keys,
+                  column_view const& sorted_right,
+                  asof_direction direction,
+                  std::optional<double> tolerance,
+                  null_equality compare_nulls,
+                  rmm::device_uvector<size_type>& output,
+                  rmm::cuda_stream_view stream)
+  {
+    auto const left_by_device    = table_device_view::create(left_by, stream);
+    auto const right_by_device   = table_device_view::create(right_by, stream);
+    auto const left_keys_device  = table_device_view::create(left_keys, stream);
+    auto const right_keys_device = table_device_view::create(right_keys, stream);
+    auto const on_index          = left_keys.num_columns() - 1;
+    auto const has_tolerance     = tolerance.has_value();
+    auto const max_distance      = tolerance.value_or(0.0);
+    auto const search_backward   = direction != asof_direction::FORWARD;
+    auto const search_forward    = direction != asof_direction::BACKWARD;
+    auto const num_right_rows    = right_keys.num_rows();
+
+    thrust::transform(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(left_keys.num_rows()),
+      output.begin(),
+      [left_on    = left_keys_device->column(on_index),
+       right_on   = right_keys_device->column(on_index),
+       left_less  = row_lexicographic_comparator<true>{*left_keys_device, *right_keys_device},
+       right_less = row_lexicographic_comparator<true>{*right_keys_device, *left_keys_device},
+       equal_by   = row_equality_comparator<true>{
+         *left_by_device, *right_by_device, compare_nulls == null_equality::EQUAL},
+       order = sorted_right.data<size_type>(),
+       num_right_rows,
+       search_backward,
+       search_forward,
+       has_tolerance,
+       max_distance] __device__(size_type row) {
+        if (left_on.is_null(row)) { return static_cast<size_type>(JoinNoneValue); }
+        auto const value = left_on.element<T>(row);
+
+        // Right rows are sorted on their `by` keys then on their `on` value, so the right rows
+        // of the left row's group that are not greater than it end where the greater rows begin
+        size_type begin = 0;
+        size_type end   = num_right_rows;
+        while (begin < end) {
+          auto const mid = begin + (end - begin) / 2;
+          if (left_less(row, order[mid])) {
+            end = mid;
+          } else {
+            begin = mid + 1;
+          }
+        }
+        auto const upper = begin;
+
+        size_type match = JoinNoneValue;
+        double distance = 0.0;
+        if (search_backward && upper > 0) {
+          auto const right_row = order[upper - 1];
+          if (equal_by(row, right_row) && right_on.is_valid(right_row)) {
+            match    = right_row;
+            distance = on_distance(right_on.element<T>(right_row), value);
+          }
+        }
+        if (search_forward) {
+          // The first right row not less than the left row is at or before `upper`
+          begin = 0;
+          end   = upper;
+          while (begin < end) {
+            auto const mid = begin + (end - begin) / 2;
+            if (right_less(order[mid], row)) {
+              begin = mid + 1;
+            } else {
+              end = mid;
+            }
+          }
+          // An exact match is found backward as well, and is preferred
+          auto const lower = begin;
+          if (lower < num_right_rows && (match == JoinNoneValue || distance > 0.0)) {
+            auto const right_row = order[lower];
+            if (equal_by(row, right_row) && right_on.is_valid(right_row)) {
+              auto const forward_distance = on_distance(value, right_on.element<T>(right_row));
+              if (match == JoinNoneValue || forward_distance < distance) {
+                match    = right_row;
+                distance = forward_distance;
+              }
+            }
+          }
+        }
+        return (match != JoinNoneValue && has_tolerance && distance > max_distance)
+                 ? static_cast<size_type>(JoinNoneValue)
+                 : match;
+      });
+  }
+
+  template <typename T,
+            std::enable_if_t<not(cudf::is_numeric<T>() or cudf::is_chrono<T>())>* = nullptr>
+  void operator()(table_view const&,
+                  table_view const&,
+                  table_view const&,
+                  table_view const&,
+                  column_view const&,
+                  asof_direction,
+                  std::optional<double>,
+                  null_equality,
+                  rmm::device_uvector<size_type>&,
+                  rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("As-of join values must be numeric, timestamps or durations");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<rmm::device_uvector<size_type>> asof_join(table_view const& left_by,
+                                                          table_view const& right_by,
+                                                          column_view const& left_on,
+                                                          column_view const& right_on,
+                                                          asof_direction direction,
+                                                          std::optional<double> tolerance,
+                                                          null_equality compare_nulls,
+                                                          rmm::cuda_stream_view stream,
+                                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(left_by.num_columns() == right_by.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(left_by.num_rows() == left_on.size(),
+               "Mismatch in number of rows of the left keys and values");
+  CUDF_EXPECTS(right_by.num_rows() == right_on.size(),
+               "Mismatch in number of rows of the right keys and values");
+  CUDF_EXPECTS(left_on.type() == right_on.type(), "Mismatch in joining column data types");
+  CUDF_EXPECTS(!tolerance || *tolerance >= 0, "As-of join tolerance must not be negative");
+
+  auto flattened_left_by = structs::detail::flatten_nested_columns(
+    left_by, {}, {}, structs::detail::column_nullability::FORCE);
+  auto flattened_right_by = structs::detail::flatten_nested_columns(
+    right_by, {}, {}, structs::detail::column_nullability::FORCE);
+  auto const left_by_table  = std::get<0>(flattened_left_by);
+  auto const right_by_table = std::get<0>(flattened_right_by);
+  CUDF_EXPECTS(std::equal(left_by_table.begin(),
+                          left_by_table.end(),
+                          right_by_table.begin(),
+                          right_by_table.end(),
+                          [](auto const& l, auto const& r) { return l.type() == r.type(); }),
+               "Mismatch in joining column data types");
+
+  // The `on` values order the rows of each group of equal `by` keys
+  std::vector<column_view> left_columns(left_by_table.begin(), left_by_table.end());
+  std::vector<column_view> right_columns(right_by_table.begin(), right_by_table.end());
+  left_columns.push_back(left_on);
+  right_columns.push_back(right_on);
+  auto const left_keys  = table_view{left_columns};
+  auto const right_keys = table_view{right_columns};
+
+  auto result = std::make_unique<rmm::device_uvector<size_type>>(left_on.size(), stream, mr);
+  if (left_on.is_empty()) { return result; }
+
+  auto const sorted_right = detail::sorted_order(right_keys, {}, {}, stream);
+  type_dispatcher(left_on.type(),
+                  asof_join_functor{},
+                  left_by_table,
+                  right_by_table,
+                  left_keys,
+                  right_keys,
+                  sorted_right->view(),
+                  direction,
+                  tolerance,
+                  compare_nulls,
+                  *result,
+                  stream);
+  return result;
+}
+
+}  // namespace detail
+
+std::unique_ptr<rmm::device_uvector<size_type>> asof_join(cudf::table_view const& left_by,
+                                                          cudf::table_view const& right_by,
+                                                          cudf::column_view const& left_on,
+                                                          cudf::column_view const& right_on,
+                                                          asof_direction direction,
+                                                          std::optional<double> tolerance,
+                                                          null_equality compare_nulls,
+                                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::asof_join(left_by,
+                           right_by,
+                           left_on,
+                           right_on,
+                           direction,
+                           tolerance,
+                           compare_nulls,
+                           rmm::cuda_stream_default,
+                           mr);
+}
+
+}  // namespace cudf
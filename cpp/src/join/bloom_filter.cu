@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <join/join_common_utils.hpp>
+#include <structs/utilities.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+constexpr int MAX_BLOOM_FILTER_HASHES = 6;  // Each hash uses 5 bits of a 32-bit hash value
+
+/**
+ * @brief Returns the filter word of a row hash and the bits of that word set by the row.
+ */
+__device__ inline thrust::pair<std::size_t, bitmask_type> bloom_filter_bits(hash_value_type hash,
+                                                                            std::size_t num_words,
+                                                                            int num_hashes)
+{
+  // The bits within the word are chosen by a remix of the hash, which is uncorrelated with the
+  // low bits that choose the word
+  auto bit_hash = hash;
+  bit_hash ^= bit_hash >> 16;
+  bit_hash *= 0x85ebca6b;
+  bit_hash ^= bit_hash >> 13;
+  bit_hash *= 0xc2b2ae35;
+  bit_hash ^= bit_hash >> 16;
+
+  bitmask_type pattern = 0;
+  for (int i = 0; i < num_hashes; ++i) {
+    pattern |= bitmask_type{1} << ((bit_hash >> (5 * i)) & 31);
+  }
+  return {hash % num_words, pattern};
+}
+
+/**
+ * @brief Returns the number of 32-bit words of a filter over `num_rows` keys.
+ */
+std::size_t num_filter_words(size_type num_rows, int bits_per_key)
+{
+  CUDF_EXPECTS(bits_per_key > 0, "Number of bits per key must be positive");
+  auto const num_bits = static_cast<std::size_t>(num_rows) * bits_per_key;
+  return std::max<std::size_t>(
+    1, (num_bits + size_in_bits<bitmask_type>() - 1) / size_in_bits<bitmask_type>());
+}
+
+/**
+ * @brief Flattens the struct columns of a key table, so that equal rows hash to equal values.
+ */
+auto flatten_keys(table_view const& keys)
+{
+  return structs::detail::flatten_nested_columns(
+    keys, {}, {}, structs::detail::column_nullability::FORCE);
+}
+
+/**
+ * @brief Returns the validity of each row of `keys`, or an empty buffer if null rows are kept.
+ */
+rmm::device_buffer row_validity(table_view const& keys,
+                                null_equality compare_nulls,
+                                rmm::cuda_stream_view stream)
+{
+  return (compare_nulls == null_equality::UNEQUAL and has_nulls(keys))
+           ? cudf::detail::bitmask_and(keys, stream).first
+           : rmm::device_buffer{0, stream};
+}
+
+/**
+ * @brief Sets the filter bits of every row of `keys` in `words`.
+ */
+void insert_keys(table_view const& keys,
+                 null_equality compare_nulls,
+                 int num_hashes,
+                 rmm::device_uvector<bitmask_type>& words,
+                 rmm::cuda_stream_view stream)
+{
+  thrust::fill(rmm::exec_policy(stream), words.begin(), words.end(), bitmask_type{0});
+  if (keys.num_rows() == 0) { return; }
+
+  auto const keys_device = table_device_view::create(keys, stream);
+  auto const row_bitmask = row_validity(keys, compare_nulls, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     keys.num_rows(),
+                     [hash_keys = row_hash{*keys_device},
+                      row_valid = static_cast<bitmask_type const*>(row_bitmask.data()),
+                      words     = words.data(),
+                      num_words = words.size(),
+                      num_hashes] __device__(size_type row) {
+                       if (row_valid != nullptr and not bit_is_set(row_valid, row)) { return; }
+                       auto const bits = bloom_filter_bits(hash_keys(row), num_words, num_hashes);
+                       // Skip the atomic when the bits are already set, as for duplicate keys
+                       if ((words[bits.first] & bits.second) != bits.second) {
+                         atomicOr(&words[bits.first], bits.second);
+                       }
+                     });
+  // The key table may be released on return
+  stream.synchronize();
+}
+
+}  // namespace
+}  // namespace detail
+
+join_bloom_filter::~join_bloom_filter() = default;
+join_bloom_filter::join_bloom_filter(join_bloom_filter&&) = default;
+join_bloom_filter& join_bloom_filter::operator=(join_bloom_filter&&) = default;
+
+join_bloom_filter::join_bloom_filter(cudf::table_view const& keys,
+                                     null_equality compare_nulls,
+                                     int bits_per_key,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  : _compare_nulls{compare_nulls},
+    _num_hashes{std::clamp(static_cast<int>(std::lround(bits_per_key * std::log(2.0))),
+                           1,
+                           detail::MAX_BLOOM_FILTER_HASHES)},
+    _words(detail::num_filter_words(keys.num_rows(), bits_per_key), stream, mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(0 != keys.num_columns(), "Bloom filter key table is empty");
+
+  auto flattened_keys  = detail::flatten_keys(keys);
+  auto const flattened = std::get<0>(flattened_keys);
+  std::transform(flattened.begin(), flattened.end(), std::back_inserter(_key_types), [](auto c) {
+    return c.type();
+  });
+
+  detail::insert_keys(flattened, compare_nulls, _num_hashes, _words, stream);
+}
+
+std::unique_ptr<cudf::column> join_bloom_filter::contains(cudf::table_view const& probe,
+                                                          rmm::cuda_stream_view stream,
+                                                          rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  auto flattened_probe = detail::flatten_keys(probe);
+  auto const flattened = std::get<0>(flattened_probe);
+  CUDF_EXPECTS(std::equal(_key_types.begin(),
+                          _key_types.end(),
+                          flattened.begin(),
+                          flattened.end(),
+                          [](auto const& type, auto const& col) { return type == col.type(); }),
+               "Mismatch in joining column data types");
+
+  auto result = make_fixed_width_column(
+    data_type{type_id::BOOL8}, flattened.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  if (flattened.num_rows() == 0) { return result; }
+
+  auto const probe_device = table_device_view::create(flattened, stream);
+  auto const row_bitmask  = detail::row_validity(flattened, _compare_nulls, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(flattened.num_rows()),
+                    result->mutable_view().begin<bool>(),
+                    [hash_probe = detail::row_hash{*probe_device},
+                     row_valid  = static_cast<bitmask_type const*>(row_bitmask.data()),
+                     words      = _words.data(),
+                     num_words  = _words.size(),
+                     num_hashes = _num_hashes] __device__(size_type row) {
+                      if (row_valid != nullptr and not bit_is_set(row_valid, row)) {
+                        return false;
+                      }
+                      auto const bits =
+                        detail::bloom_filter_bits(hash_probe(row), num_words, num_hashes);
+                      return (words[bits.first] & bits.second) == bits.second;
+                    });
+  return result;
+}
+
+std::size_t join_bloom_filter::size_bytes() const { return _words.size() * sizeof(bitmask_type); }
+
+}  // namespace cudf
@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <join/conditional_join_kernels.cuh>
+#include <join/hash_join.cuh>
+
+#include <cudf/ast/detail/transform.cuh>
+#include <cudf/ast/linearizer.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/join.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+using join_indices = std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                               std::unique_ptr<rmm::device_uvector<size_type>>>;
+
+/**
+ * @brief Linearizes a join predicate and copies the plan to the device.
+ */
+ast::detail::device_ast_plan make_predicate_plan(ast::expression const& binary_predicate,
+                                                 table_view const& left,
+                                                 table_view const& right,
+                                                 rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(not has_nulls(left) and not has_nulls(right),
+               "Conditional joins do not support tables with nulls");
+  auto const predicate_linearizer = ast::detail::linearizer(binary_predicate, left, right);
+  CUDF_EXPECTS(predicate_linearizer.root_data_type() == data_type{type_id::BOOL8},
+               "The join predicate must return a boolean");
+  return ast::detail::device_ast_plan(predicate_linearizer, stream);
+}
+
+join_predicate make_join_predicate(ast::detail::device_ast_plan const& plan)
+{
+  return join_predicate{plan.data_references,
+                        plan.literals,
+                        plan.operators,
+                        plan.operator_source_indices,
+                        plan.num_operators};
+}
+
+/**
+ * @brief Returns the block size of the kernels that evaluate a predicate with
+ * `num_intermediates` intermediates per thread in shared memory.
+ *
+ * The block size is a multiple of the warp size, so that it can be split into probing tiles.
+ */
+int predicate_block_size(size_type num_intermediates)
+{
+  auto const shmem_size_per_thread = static_cast<int>(sizeof(std::int64_t) * num_intermediates);
+  int device_id;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  int shmem_limit_per_block;
+  CUDA_TRY(
+    cudaDeviceGetAttribute(&shmem_limit_per_block, cudaDevAttrMaxSharedMemoryPerBlock, device_id));
+  auto constexpr MAX_BLOCK_SIZE = 128;
+  auto const block_size = std::min(MAX_BLOCK_SIZE, shmem_limit_per_block / shmem_size_per_thread);
+  CUDF_EXPECTS(block_size >= detail::warp_size, "The join predicate is too complex");
+  return block_size - block_size % detail::warp_size;
+}
+
+/**
+ * @brief Converts the per-row output counts to offsets and allocates the join output.
+ *
+ * @throw cudf::logic_error if the output size overflows cudf::size_type
+ */
+join_indices allocate_join_output(rmm::device_uvector<size_type>& row_counts,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  // Use a 64-bit sum to detect overflow
+  auto const counts_begin = thrust::make_transform_iterator(
+    row_counts.begin(), [] __device__(size_type count) { return static_cast<int64_t>(count); });
+  auto const join_size = thrust::reduce(rmm::exec_policy(stream),
+                                        counts_begin,
+                                        counts_begin + row_counts.size(),
+                                        int64_t{0},
+                                        thrust::plus<int64_t>{});
+  CUDF_EXPECTS(join_size <= std::numeric_limits<size_type>::max(),
+               "The output size of the join overflows cudf::size_type");
+
+  // The counts are replaced by the offset of the first output row of each left row
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), row_counts.begin(), row_counts.end(), row_counts.begin());
+  return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr),
+                        std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr));
+}
+
+template <join_kind JoinKind>
+join_indices compute_conditional_join(table_view const& left,
+                                      table_view const& right,
+                                      ast::expression const& binary_predicate,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  if (left.num_rows() == 0 || (JoinKind == join_kind::INNER_JOIN && right.num_rows() == 0)) {
+    return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                          std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+  if (right.num_rows() == 0) { return get_trivial_left_join_indices(left, stream, mr); }
+
+  auto const plan              = make_predicate_plan(binary_predicate, left, right, stream);
+  auto const predicate         = make_join_predicate(plan);
+  auto const left_device       = table_device_view::create(left, stream);
+  auto const right_device      = table_device_view::create(right, stream);
+  auto const num_intermediates = std::max(plan.num_intermediates, 1);
+  auto const block_size        = predicate_block_size(num_intermediates);
+  detail::grid_1d const config(left.num_rows(), block_size);
+  auto const shmem_size_per_block = sizeof(std::int64_t) * num_intermediates * block_size;
+
+  rmm::device_uvector<size_type> row_offsets(left.num_rows(), stream);
+  compute_conditional_join_row_counts<JoinKind>
+    <<<config.num_blocks, block_size, shmem_size_per_block, stream.value()>>>(
+      *left_device, *right_device, predicate, num_intermediates, row_offsets.data());
+  auto join_output = allocate_join_output(row_offsets, stream, mr);
+
+  conditional_join<JoinKind>
+    <<<config.num_blocks, block_size, shmem_size_per_block, stream.value()>>>(
+      *left_device,
+      *right_device,
+      predicate,
+      num_intermediates,
+      row_offsets.data(),
+      join_output.first->data(),
+      join_output.second->data());
+  CHECK_CUDA(stream.value());
+  return join_output;
+}
+
+template <join_kind JoinKind>
+join_indices compute_mixed_join(table_view const& left_equality,
+                                table_view const& right_equality,
+                                table_view const& left_conditional,
+                                table_view const& right_conditional,
+                                ast::expression const& binary_predicate,
+                                null_equality compare_nulls,
+                                rmm::cuda_stream_view stream,
+                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(left_equality.num_columns() != 0 && right_equality.num_columns() != 0,
+               "Mixed joins need at least one equality column");
+  CUDF_EXPECTS(left_equality.num_columns() == right_equality.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(left_equality.num_rows() == left_conditional.num_rows() &&
+                 right_equality.num_rows() == right_conditional.num_rows(),
+               "The equality and conditional tables must have the same number of rows");
+
+  if (left_equality.num_rows() == 0 ||
+      (JoinKind == join_kind::INNER_JOIN && right_equality.num_rows() == 0)) {
+    return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                          std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+  if (right_equality.num_rows() == 0) {
+    return get_trivial_left_join_indices(left_equality, stream, mr);
+  }
+
+  auto const plan =
+    make_predicate_plan(binary_predicate, left_conditional, right_conditional, stream);
+  auto const predicate                = make_join_predicate(plan);
+  auto const left_conditional_device  = table_device_view::create(left_conditional, stream);
+  auto const right_conditional_device = table_device_view::create(right_conditional, stream);
+  auto const left_equality_device     = table_device_view::create(left_equality, stream);
+  auto const right_equality_device    = table_device_view::create(right_equality, stream);
+  auto const hash_table = build_join_hash_table(right_equality, compare_nulls, stream);
+
+  auto const num_intermediates = std::max(plan.num_intermediates, 1);
+  auto const block_size        = predicate_block_size(num_intermediates);
+  // Each left row is probed by a tile of threads
+  detail::grid_1d const config(left_equality.num_rows(), block_size / multimap_type::cg_size);
+  auto const shmem_size_per_block = sizeof(std::int64_t) * num_intermediates * block_size;
+
+  row_hash const hash_probe{*left_equality_device};
+  row_equality const equality{
+    *left_equality_device, *right_equality_device, compare_nulls == null_equality::EQUAL};
+
+  rmm::device_uvector<size_type> row_offsets(left_equality.num_rows(), stream);
+  compute_mixed_join_row_counts<JoinKind, multimap_type>
+    <<<config.num_blocks, block_size, shmem_size_per_block, stream.value()>>>(
+      hash_table->get_device_view(),
+      hash_probe,
+      equality,
+      *left_conditional_device,
+      *right_conditional_device,
+      predicate,
+      num_intermediates,
+      row_offsets.data());
+  auto join_output = allocate_join_output(row_offsets, stream, mr);
+
+  mixed_join<JoinKind, multimap_type>
+    <<<config.num_blocks, block_size, shmem_size_per_block, stream.value()>>>(
+      hash_table->get_device_view(),
+      hash_probe,
+      equality,
+      *left_conditional_device,
+      *right_conditional_device,
+      predicate,
+      num_intermediates,
+      row_offsets.data(),
+      join_output.first->data(),
+      join_output.second->data());
+  CHECK_CUDA(stream.value());
+  return join_output;
+}
+
+}  // namespace
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+conditional_inner_join(table_view const& left,
+                       table_view const& right,
+                       ast::expression const& binary_predicate,
+                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_conditional_join<detail::join_kind::INNER_JOIN>(
+    left, right, binary_predicate, rmm::cuda_stream_default, mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+conditional_left_join(table_view const& left,
+                      table_view const& right,
+                      ast::expression const& binary_predicate,
+                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_conditional_join<detail::join_kind::LEFT_JOIN>(
+    left, right, binary_predicate, rmm::cuda_stream_default, mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_inner_join(table_view const& left_equality,
+                 table_view const& right_equality,
+                 table_view const& left_conditional,
+                 table_view const& right_conditional,
+                 ast::expression const& binary_predicate,
+                 null_equality compare_nulls,
+                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_mixed_join<detail::join_kind::INNER_JOIN>(left_equality,
+                                                           right_equality,
+                                                           left_conditional,
+                                                           right_conditional,
+                                                           binary_predicate,
+                                                           compare_nulls,
+                                                           rmm::cuda_stream_default,
+                                                           mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_left_join(table_view const& left_equality,
+                table_view const& right_equality,
+                table_view const& left_conditional,
+                table_view const& right_conditional,
+                ast::expression const& binary_predicate,
+                null_equality compare_nulls,
+                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_mixed_join<detail::join_kind::LEFT_JOIN>(left_equality,
+                                                          right_equality,
+                                                          left_conditional,
+                                                          right_conditional,
+                                                          binary_predicate,
+                                                          compare_nulls,
+                                                          rmm::cuda_stream_default,
+                                                          mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/ast/detail/transform.cuh>
+#include <cudf/table/table_device_view.cuh>
+
+#include "join_common_utils.hpp"
+#include "join_kernels.cuh"
+
+#include <cooperative_groups.h>
+
+#include <cstring>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Device view of a linearized boolean expression on a pair of rows of two tables.
+ */
+struct join_predicate {
+  const ast::detail::device_data_reference* data_references;
+  const cudf::ast::detail::generic_scalar_device_view* literals;
+  const ast::ast_operator* operators;
+  const cudf::size_type* operator_source_indices;
+  cudf::size_type num_operators;
+
+  /**
+   * @brief Evaluates the predicate on row `left_row_index` of the left table and row
+   * `right_row_index` of the right table.
+   *
+   * @param evaluator Evaluator of the calling thread, without an output column
+   * @param thread_intermediate_storage Intermediate storage of `evaluator`
+   */
+  __device__ bool operator()(ast::detail::row_evaluator const& evaluator,
+                             std::int64_t const* thread_intermediate_storage,
+                             cudf::size_type left_row_index,
+                             cudf::size_type right_row_index) const
+  {
+    ast::detail::evaluate_row_expression(evaluator,
+                                         data_references,
+                                         operators,
+                                         operator_source_indices,
+                                         num_operators,
+                                         left_row_index,
+                                         right_row_index);
+    // The result of the root node is stored in the first intermediate
+    bool result;
+    memcpy(&result, thread_intermediate_storage, sizeof(result));
+    return result;
+  }
+};
+
+/**
+ * @brief Computes the exclusive prefix sum and the total of `value` over the threads of `tile`.
+ */
+template <typename Tile>
+__device__ cudf::size_type tile_exclusive_sum(Tile const& tile,
+                                              cudf::size_type value,
+                                              cudf::size_type& total)
+{
+  cudf::size_type prefix = 0;
+  total                  = 0;
+  for (unsigned int rank = 0; rank < tile.size(); ++rank) {
+    auto const rank_value = tile.shfl(value, rank);
+    if (rank < tile.thread_rank()) { prefix += rank_value; }
+    total += rank_value;
+  }
+  return prefix;
+}
+
+/**
+ * @brief Counts the output rows of each left row of a conditional join.
+ *
+ * Every pair of rows of the left and right tables is tested with the predicate.
+ *
+ * @tparam JoinKind The type of join to be performed
+ *
+ * @param[in] left_table The left table
+ * @param[in] right_table The right table
+ * @param[in] predicate The join predicate
+ * @param[in] num_intermediates Number of intermediates of each thread in shared memory
+ * @param[out] row_counts The number of output rows of each left row
+ */
+template <join_kind JoinKind>
+__global__ void compute_conditional_join_row_counts(table_device_view left_table,
+                                                    table_device_view right_table,
+                                                    join_predicate predicate,
+                                                    cudf::size_type num_intermediates,
+                                                    cudf::size_type* row_counts)
+{
+  extern __shared__ std::int64_t intermediate_storage[];
+  auto thread_intermediate_storage = &intermediate_storage[threadIdx.x * num_intermediates];
+  auto const evaluator             = ast::detail::row_evaluator(
+    left_table, right_table, predicate.literals, thread_intermediate_storage, nullptr);
+
+  const cudf::size_type start_idx      = threadIdx.x + blockIdx.x * blockDim.x;
+  const cudf::size_type stride         = blockDim.x * gridDim.x;
+  const cudf::size_type right_num_rows = right_table.num_rows();
+
+  for (cudf::size_type left_row_index = start_idx; left_row_index < left_table.num_rows();
+       left_row_index += stride) {
+    cudf::size_type count = 0;
+    for (cudf::size_type right_row_index = 0; right_row_index < right_num_rows; ++right_row_index) {
+      if (predicate(evaluator, thread_intermediate_storage, left_row_index, right_row_index)) {
+        ++count;
+      }
+    }
+    // Left joins always have an entry in the output
+    row_counts[left_row_index] = (JoinKind == join_kind::LEFT_JOIN && count == 0) ? 1 : count;
+  }
+}
+
+/**
+ * @brief Writes the output of a conditional join.
+ *
+ * The output rows of each left row are written in order of the right rows, starting at the offset
+ * of the left row.
+ *
+ * @tparam JoinKind The type of join to be performed
+ *
+ * @param[in] left_table The left table
+ * @param[in] right_table The right table
+ * @param[in] predicate The join predicate
+ * @param[in] num_intermediates Number of intermediates of each thread in shared memory
+ * @param[in] row_offsets The offset of the first output row of each left row
+ * @param[out] join_output_l The left result of the join operation
+ * @param[out] join_output_r The right result of the join operation
+ */
+template <join_kind JoinKind>
+__global__ void conditional_join(table_device_view left_table,
+                                 table_device_view right_table,
+                                 join_predicate predicate,
+                                 cudf::size_type num_intermediates,
+                                 cudf::size_type const* row_offsets,
+                                 cudf::size_type* join_output_l,
+                                 cudf::size_type* join_output_r)
+{
+  extern __shared__ std::int64_t intermediate_storage[];
+  auto thread_intermediate_storage = &intermediate_storage[threadIdx.x * num_intermediates];
+  auto const evaluator             = ast::detail::row_evaluator(
+    left_table, right_table, predicate.literals, thread_intermediate_storage, nullptr);
+
+  const cudf::size_type start_idx      = threadIdx.x + blockIdx.x * blockDim.x;
+  const cudf::size_type stride         = blockDim.x * gridDim.x;
+  const cudf::size_type right_num_rows = right_table.num_rows();
+
+  for (cudf::size_type left_row_index = start_idx; left_row_index < left_table.num_rows();
+       left_row_index += stride) {
+    auto const row_offset = row_offsets[left_row_index];
+    auto output_index     = row_offset;
+    for (cudf::size_type right_row_index = 0; right_row_index < right_num_rows; ++right_row_index) {
+      if (predicate(evaluator, thread_intermediate_storage, left_row_index, right_row_index)) {
+        join_output_l[output_index] = left_row_index;
+        join_output_r[output_index] = right_row_index;
+        ++output_index;
+      }
+    }
+    // If performing a LEFT join and no match was found, insert a Null into the output
+    if (JoinKind == join_kind::LEFT_JOIN && output_index == row_offset) {
+      join_output_l[output_index] = left_row_index;
+      join_output_r[output_index] = static_cast<cudf::size_type>(JoinNoneValue);
+    }
+  }
+}
+
+/**
+ * @brief Counts the output rows of each left row of a mixed join.
+ *
+ * The hash table built on the equality columns of the right table is probed with the equality
+ * columns of the left table, and the predicate is only evaluated on the pairs of rows with equal
+ * keys. Each left row is looked up by a tile of `multimap_type::cg_size` threads.
+ *
+ * @tparam JoinKind The type of join to be performed
+ * @tparam multimap_type The type of the hash table
+ *
+ * @param[in] multi_map The hash table built on the right equality table
+ * @param[in] hash_probe Row hasher for the left equality table
+ * @param[in] check_row_equality Equality comparator of the left and right equality tables
+ * @param[in] left_conditional The left table of the predicate
+ * @param[in] right_conditional The right table of the predicate
+ * @param[in] predicate The join predicate
+ * @param[in] num_intermediates Number of intermediates of each thread in shared memory
+ * @param[out] row_counts The number of output rows of each left row
+ */
+template <join_kind JoinKind, typename multimap_type>
+__global__ void compute_mixed_join_row_counts(typename multimap_type::device_view multi_map,
+                                              row_hash hash_probe,
+                                              row_equality check_row_equality,
+                                              table_device_view left_conditional,
+                                              table_device_view right_conditional,
+                                              join_predicate predicate,
+                                              cudf::size_type num_intermediates,
+                                              cudf::size_type* row_counts)
+{
+  extern __shared__ std::int64_t intermediate_storage[];
+  auto thread_intermediate_storage = &intermediate_storage[threadIdx.x * num_intermediates];
+  auto const evaluator             = ast::detail::row_evaluator(
+    left_conditional, right_conditional, predicate.literals, thread_intermediate_storage, nullptr);
+
+  auto const tile = cooperative_groups::tiled_partition<multimap_type::cg_size>(
+    cooperative_groups::this_thread_block());
+  const cudf::size_type start_idx =
+    (threadIdx.x + blockIdx.x * blockDim.x) / multimap_type::cg_size;
+  const cudf::size_type stride = (blockDim.x * gridDim.x) / multimap_type::cg_size;
+
+  for (cudf::size_type left_row_index = start_idx; left_row_index < left_conditional.num_rows();
+       left_row_index += stride) {
+    auto const probe_row_hash_value =
+      remap_sentinel_hash(hash_probe(left_row_index), multi_map.get_empty_key_sentinel());
+
+    auto window           = multi_map.initial_window(probe_row_hash_value);
+    bool running          = true;
+    cudf::size_type count = 0;
+    while (running) {
+      running = !multi_map.probe_window(
+        tile, window, probe_row_hash_value, [&](cudf::size_type right_row_index) {
+          if (check_row_equality(left_row_index, right_row_index) &&
+              predicate(evaluator, thread_intermediate_storage, left_row_index, right_row_index)) {
+            ++count;
+          }
+        });
+    }
+
+    cudf::size_type total;
+    tile_exclusive_sum(tile, count, total);
+    if (0 == tile.thread_rank()) {
+      // Left joins always have an entry in the output
+      row_counts[left_row_index] = (JoinKind == join_kind::LEFT_JOIN && total == 0) ? 1 : total;
+    }
+  }
+}
+
+/**
+ * @brief Writes the output of a mixed join.
+ *
+ * @see compute_mixed_join_row_counts
+ *
+ * @tparam JoinKind The type of join to be performed
+ * @tparam multimap_type The type of the hash table
+ *
+ * @param[in] multi_map The hash table built on the right equality table
+ * @param[in] hash_probe Row hasher for the left equality table
+ * @param[in] check_row_equality Equality comparator of the left and right equality tables
+ * @param[in] left_conditional The left table of the predicate
+ * @param[in] right_conditional The right table of the predicate
+ * @param[in] predicate The join predicate
+ * @param[in] num_intermediates Number of intermediates of each thread in shared memory
+ * @param[in] row_offsets The offset of the first output row of each left row
+ * @param[out] join_output_l The left result of the join operation
+ * @param[out] join_output_r The right result of the join operation
+ */
+template <join_kind JoinKind, typename multimap_type>
+__global__ void mixed_join(typename multimap_type::device_view multi_map,
+                           row_hash hash_probe,
+                           row_equality check_row_equality,
+                           table_device_view left_conditional,
+                           table_device_view right_conditional,
+                           join_predicate predicate,
+                           cudf::size_type num_intermediates,
+                           cudf::size_type const* row_offsets,
+                           cudf::size_type* join_output_l,
+                           cudf::size_type* join_output_r)
+{
+  extern __shared__ std::int64_t intermediate_storage[];
+  auto thread_intermediate_storage = &intermediate_storage[threadIdx.x * num_intermediates];
+  auto const evaluator             = ast::detail::row_evaluator(
+    left_conditional, right_conditional, predicate.literals, thread_intermediate_storage, nullptr);
+
+  auto const tile = cooperative_groups::tiled_partition<multimap_type::cg_size>(
+    cooperative_groups::this_thread_block());
+  const cudf::size_type start_idx =
+    (threadIdx.x + blockIdx.x * blockDim.x) / multimap_type::cg_size;
+  const cudf::size_type stride = (blockDim.x * gridDim.x) / multimap_type::cg_size;
+
+  for (cudf::size_type left_row_index = start_idx; left_row_index < left_conditional.num_rows();
+       left_row_index += stride) {
+    auto const probe_row_hash_value =
+      remap_sentinel_hash(hash_probe(left_row_index), multi_map.get_empty_key_sentinel());
+
+    auto const row_offset = row_offsets[left_row_index];
+    auto output_index     = row_offset;
+    auto window           = multi_map.initial_window(probe_row_hash_value);
+    bool running          = true;
+    while (running) {
+      // Each thread finds at most one match per slot it loads from the window
+      cudf::size_type matches[multimap_type::vector_width];
+      cudf::size_type num_matches = 0;
+      running                     = !multi_map.probe_window(
+        tile, window, probe_row_hash_value, [&](cudf::size_type right_row_index) {
+          if (check_row_equality(left_row_index, right_row_index) &&
+              predicate(evaluator, thread_intermediate_storage, left_row_index, right_row_index)) {
+            matches[num_matches++] = right_row_index;
+          }
+        });
+
+      cudf::size_type total;
+      auto const thread_offset = output_index + tile_exclusive_sum(tile, num_matches, total);
+      for (cudf::size_type i = 0; i < num_matches; ++i) {
+        join_output_l[thread_offset + i] = left_row_index;
+        join_output_r[thread_offset + i] = matches[i];
+      }
+      output_index += total;
+    }
+
+    // If performing a LEFT join and no match was found, insert a Null into the output
+    if (JoinKind == join_kind::LEFT_JOIN && output_index == row_offset &&
+        0 == tile.thread_rank()) {
+      join_output_l[output_index] = left_row_index;
+      join_output_r[output_index] = static_cast<cudf::size_type>(JoinNoneValue);
+    }
+  }
+}
+
+}  // namespace detail
+}  // namespace cudf
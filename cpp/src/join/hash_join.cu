@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,9 +14,11 @@
  * limitations under the License.
  */
 #include <thrust/uninitialized_fill.h>
+#include <hash/helper_functions.cuh>
 #include <join/hash_join.cuh>
 #include <structs/utilities.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/detail/concatenate.cuh>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
@@ -25,6 +27,11 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/transform.h>
+
 #include <iostream>
 #include <numeric>
 
@@ -167,8 +174,9 @@ get_left_join_indices_complement(
  *
  * @return Built hash table.
  */
-std::unique_ptr<multimap_type, std::function<void(multimap_type *)>> build_join_hash_table(
-  cudf::table_view const &build, null_equality compare_nulls, rmm::cuda_stream_view stream)
+std::unique_ptr<multimap_type> build_join_hash_table(cudf::table_view const &build,
+                                                     null_equality compare_nulls,
+                                                     rmm::cuda_stream_view stream)
 {
   auto build_device_table = cudf::table_device_view::create(build, stream);
 
@@ -178,22 +186,18 @@ std::unique_ptr<multimap_type, std::function<void(multimap_type *)>> build_join_
   size_type const build_table_num_rows{build_device_table->num_rows()};
   size_t const hash_table_size = compute_hash_table_size(build_table_num_rows);
 
-  auto hash_table = multimap_type::create(hash_table_size,
-                                          stream,
-                                          true,
-                                          multimap_type::hasher(),
-                                          multimap_type::key_equal(),
-                                          multimap_type::allocator_type());
+  auto hash_table = std::make_unique<multimap_type>(hash_table_size, stream);
 
   row_hash hash_build{*build_device_table};
   rmm::device_scalar<int> failure(0, stream);
   constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
-  detail::grid_1d config(build_table_num_rows, block_size);
+  // Each row is inserted by a tile of threads
+  detail::grid_1d config(build_table_num_rows, block_size / multimap_type::cg_size);
   auto const row_bitmask = (compare_nulls == null_equality::EQUAL)
                              ? rmm::device_buffer{0, stream}
-                             : cudf::detail::bitmask_and(build, stream);
-  build_hash_table<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
-    *hash_table,
+                             : cudf::detail::bitmask_and(build, stream).first;
+  build_hash_table<multimap_type><<<config.num_blocks, block_size, 0, stream.value()>>>(
+    hash_table->get_device_mutable_view(),
     hash_build,
     build_table_num_rows,
     static_cast<bitmask_type const *>(row_bitmask.data()),
@@ -214,6 +218,7 @@ std::unique_ptr<multimap_type, std::function<void(multimap_type *)>> build_join_
  * @param probe_table Table of probe side columns to join.
  * @param hash_table Hash table built from `build_table`.
  * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param output_size Optional exact output size. If not given, the output size is estimated.
  * @param stream CUDA stream used for device memory operations and kernel launches.
  *
  * @return Join output indices vector pair.
@@ -225,11 +230,16 @@ probe_join_hash_table(cudf::table_device_view build_table,
                       cudf::table_device_view probe_table,
                       multimap_type const &hash_table,
                       null_equality compare_nulls,
+                      std::optional<std::size_t> output_size,
                       rmm::cuda_stream_view stream,
                       rmm::mr::device_memory_resource *mr)
 {
-  size_type estimated_size = estimate_join_output_size<JoinKind, multimap_type>(
-    build_table, probe_table, hash_table, compare_nulls, stream);
+  CUDF_EXPECTS(!output_size || *output_size <= std::numeric_limits<size_type>::max(),
+               "Maximum join output size exceeded");
+  size_type estimated_size =
+    output_size ? static_cast<size_type>(*output_size)
+                : estimate_join_output_size<JoinKind, multimap_type>(
+                    build_table, probe_table, hash_table, compare_nulls, stream);
 
   // If the estimated output size is zero, return immediately
   if (estimated_size == 0) {
@@ -237,8 +247,9 @@ probe_join_hash_table(cudf::table_device_view build_table,
                           std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
   }
 
-  // Because we are approximating the number of joined elements, our approximation
-  // might be incorrect and we might have underestimated the number of joined elements.
+  // Unless the output size is given, we are approximating the number of joined elements. Our
+  // approximation might be incorrect and we might have underestimated the number of joined
+  // elements.
   // As such we will need to de-allocate memory and re-allocate memory to ensure
   // that the final output is correct.
   rmm::device_scalar<size_type> write_index(0, stream);
@@ -253,14 +264,15 @@ probe_join_hash_table(cudf::table_device_view build_table,
     right_indices->resize(estimated_size, stream);
 
     constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
-    detail::grid_1d config(probe_table.num_rows(), block_size);
+    // Each probe row is looked up by a tile of threads
+    detail::grid_1d config(probe_table.num_rows(), block_size / multimap_type::cg_size);
     write_index.set_value_zero(stream);
 
     row_hash hash_probe{probe_table};
     row_equality equality{probe_table, build_table, compare_nulls == null_equality::EQUAL};
     probe_hash_table<JoinKind, multimap_type, block_size, DEFAULT_JOIN_CACHE_SIZE>
-      <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
-        hash_table,
+      <<<config.num_blocks, block_size, 0, stream.value()>>>(
+        hash_table.get_device_view(),
         build_table,
         probe_table,
         hash_probe,
@@ -315,29 +327,34 @@ hash_join::hash_join_impl::hash_join_impl(cudf::table_view const &build,
 
   if (0 == build.num_rows()) { return; }
 
-  _hash_table = build_join_hash_table(_build, compare_nulls, stream);
+  _hash_table    = build_join_hash_table(_build, compare_nulls, stream);
+  _heavy_hitters = find_heavy_hitters(_build, compare_nulls, stream);
 }
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::hash_join_impl::inner_join(cudf::table_view const &probe,
                                       null_equality compare_nulls,
+                                      std::optional<std::size_t> output_size,
                                       rmm::cuda_stream_view stream,
                                       rmm::mr::device_memory_resource *mr) const
 {
   CUDF_FUNC_RANGE();
-  return compute_hash_join<cudf::detail::join_kind::INNER_JOIN>(probe, compare_nulls, stream, mr);
+  return compute_hash_join<cudf::detail::join_kind::INNER_JOIN>(
+    probe, compare_nulls, output_size, stream, mr);
 }
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::hash_join_impl::left_join(cudf::table_view const &probe,
                                      null_equality compare_nulls,
+                                     std::optional<std::size_t> output_size,
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource *mr) const
 {
   CUDF_FUNC_RANGE();
-  return compute_hash_join<cudf::detail::join_kind::LEFT_JOIN>(probe, compare_nulls, stream, mr);
+  return compute_hash_join<cudf::detail::join_kind::LEFT_JOIN>(
+    probe, compare_nulls, output_size, stream, mr);
 }
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
@@ -348,7 +365,62 @@ hash_join::hash_join_impl::full_join(cudf::table_view const &probe,
                                      rmm::mr::device_memory_resource *mr) const
 {
   CUDF_FUNC_RANGE();
-  return compute_hash_join<cudf::detail::join_kind::FULL_JOIN>(probe, compare_nulls, stream, mr);
+  return compute_hash_join<cudf::detail::join_kind::FULL_JOIN>(
+    probe, compare_nulls, std::nullopt, stream, mr);
+}
+
+std::size_t hash_join::hash_join_impl::inner_join_size(cudf::table_view const &probe,
+                                                       null_equality compare_nulls,
+                                                       rmm::cuda_stream_view stream) const
+{
+  CUDF_FUNC_RANGE();
+  return compute_join_size<cudf::detail::join_kind::INNER_JOIN>(probe, compare_nulls, stream);
+}
+
+std::size_t hash_join::hash_join_impl::left_join_size(cudf::table_view const &probe,
+                                                      null_equality compare_nulls,
+                                                      rmm::cuda_stream_view stream) const
+{
+  CUDF_FUNC_RANGE();
+  return compute_join_size<cudf::detail::join_kind::LEFT_JOIN>(probe, compare_nulls, stream);
+}
+
+std::tuple<std::unique_ptr<rmm::device_uvector<size_type>>,
+           std::unique_ptr<rmm::device_uvector<size_type>>,
+           size_type>
+hash_join::hash_join_impl::inner_join_chunk(cudf::table_view const &probe,
+                                            size_type probe_row_begin,
+                                            std::size_t max_output_rows,
+                                            null_equality compare_nulls,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource *mr) const
+{
+  CUDF_FUNC_RANGE();
+  return compute_join_chunk<cudf::detail::join_kind::INNER_JOIN>(
+    probe, probe_row_begin, max_output_rows, compare_nulls, stream, mr);
+}
+
+std::tuple<std::unique_ptr<rmm::device_uvector<size_type>>,
+           std::unique_ptr<rmm::device_uvector<size_type>>,
+           size_type>
+hash_join::hash_join_impl::left_join_chunk(cudf::table_view const &probe,
+                                           size_type probe_row_begin,
+                                           std::size_t max_output_rows,
+                                           null_equality compare_nulls,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource *mr) const
+{
+  CUDF_FUNC_RANGE();
+  return compute_join_chunk<cudf::detail::join_kind::LEFT_JOIN>(
+    probe, probe_row_begin, max_output_rows, compare_nulls, stream, mr);
+}
+
+join_bloom_filter hash_join::hash_join_impl::bloom_filter(null_equality compare_nulls,
+                                                          int bits_per_key,
+                                                          rmm::cuda_stream_view stream,
+                                                          rmm::mr::device_memory_resource *mr) const
+{
+  return join_bloom_filter(_build, compare_nulls, bits_per_key, stream, mr);
 }
 
 template <cudf::detail::join_kind JoinKind>
@@ -356,8 +428,108 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::hash_join_impl::compute_hash_join(cudf::table_view const &probe,
                                              null_equality compare_nulls,
+                                             std::optional<std::size_t> output_size,
                                              rmm::cuda_stream_view stream,
                                              rmm::mr::device_memory_resource *mr) const
+{
+  auto flattened_probe             = flatten_probe(probe);
+  auto const flattened_probe_table = std::get<0>(flattened_probe);
+
+  if (is_trivial_join(flattened_probe_table, _build, JoinKind)) {
+    return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                          std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  return probe_join_indices<JoinKind>(
+    flattened_probe_table, compare_nulls, output_size, stream, mr);
+}
+
+template <cudf::detail::join_kind JoinKind>
+std::size_t hash_join::hash_join_impl::compute_join_size(cudf::table_view const &probe,
+                                                         null_equality compare_nulls,
+                                                         rmm::cuda_stream_view stream) const
+{
+  auto flattened_probe             = flatten_probe(probe);
+  auto const flattened_probe_table = std::get<0>(flattened_probe);
+
+  if (is_trivial_join(flattened_probe_table, _build, JoinKind)) { return 0; }
+  // Trivial left join case: every probe row is paired with a null
+  if (!_hash_table) { return flattened_probe_table.num_rows(); }
+
+  auto build_table = cudf::table_device_view::create(_build, stream);
+  auto probe_table = cudf::table_device_view::create(flattened_probe_table, stream);
+  return cudf::detail::count_join_output_size<JoinKind>(*build_table,
+                                                        *probe_table,
+                                                        *_hash_table,
+                                                        compare_nulls,
+                                                        flattened_probe_table.num_rows(),
+                                                        stream);
+}
+
+template <cudf::detail::join_kind JoinKind>
+std::tuple<std::unique_ptr<rmm::device_uvector<size_type>>,
+           std::unique_ptr<rmm::device_uvector<size_type>>,
+           size_type>
+hash_join::hash_join_impl::compute_join_chunk(cudf::table_view const &probe,
+                                              size_type probe_row_begin,
+                                              std::size_t max_output_rows,
+                                              null_equality compare_nulls,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource *mr) const
+{
+  auto flattened_probe             = flatten_probe(probe);
+  auto const flattened_probe_table = std::get<0>(flattened_probe);
+  auto const probe_num_rows        = flattened_probe_table.num_rows();
+
+  CUDF_EXPECTS(probe_row_begin >= 0 && probe_row_begin <= probe_num_rows,
+               "First probe row of the join chunk is out of bounds");
+  CUDF_EXPECTS(max_output_rows > 0, "Join chunk must allow at least one output row");
+
+  if (probe_row_begin == probe_num_rows ||
+      is_trivial_join(flattened_probe_table, _build, JoinKind)) {
+    return std::make_tuple(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                           std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                           probe_num_rows);
+  }
+
+  // No more than `max_output_rows` probe rows are counted, which bounds the work of a chunk and
+  // covers a whole chunk of a left join, where every probe row has an output row
+  auto const window_size = static_cast<size_type>(
+    std::min<std::size_t>(probe_num_rows - probe_row_begin, max_output_rows));
+  auto const window =
+    cudf::slice(flattened_probe_table, {probe_row_begin, probe_row_begin + window_size})[0];
+
+  // Trivial left join case: every probe row is paired with a null
+  std::pair<size_type, int64_t> chunk_size{window_size, window_size};
+  if (_hash_table) {
+    auto build_table = cudf::table_device_view::create(_build, stream);
+    auto probe_table = cudf::table_device_view::create(window, stream);
+    chunk_size       = cudf::detail::join_chunk_size<JoinKind>(
+      *build_table, *probe_table, *_hash_table, compare_nulls, max_output_rows, stream);
+  }
+
+  auto join_indices = probe_join_indices<JoinKind>(cudf::slice(window, {0, chunk_size.first})[0],
+                                                   compare_nulls,
+                                                   static_cast<std::size_t>(chunk_size.second),
+                                                   stream,
+                                                   mr);
+  // The probe indices are relative to the first probe row of the chunk
+  thrust::transform(rmm::exec_policy(stream),
+                    join_indices.first->begin(),
+                    join_indices.first->end(),
+                    thrust::make_constant_iterator(probe_row_begin),
+                    join_indices.first->begin(),
+                    thrust::plus<size_type>{});
+  return std::make_tuple(std::move(join_indices.first),
+                         std::move(join_indices.second),
+                         probe_row_begin + chunk_size.first);
+}
+
+std::tuple<cudf::table_view,
+           std::vector<order>,
+           std::vector<null_order>,
+           std::vector<std::unique_ptr<column>>>
+hash_join::hash_join_impl::flatten_probe(cudf::table_view const &probe) const
 {
   CUDF_EXPECTS(0 != probe.num_columns(), "Hash join probe table is empty");
   CUDF_EXPECTS(probe.num_rows() < cudf::detail::MAX_JOIN_SIZE,
@@ -369,20 +541,13 @@ hash_join::hash_join_impl::compute_hash_join(cudf::table_view const &probe,
 
   CUDF_EXPECTS(_build.num_columns() == flattened_probe_table.num_columns(),
                "Mismatch in number of columns to be joined on");
-
-  if (is_trivial_join(flattened_probe_table, _build, JoinKind)) {
-    return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
-                          std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
-  }
-
   CUDF_EXPECTS(std::equal(std::cbegin(_build),
                           std::cend(_build),
                           std::cbegin(flattened_probe_table),
                           std::cend(flattened_probe_table),
                           [](const auto &b, const auto &p) { return b.type() == p.type(); }),
                "Mismatch in joining column data types");
-
-  return probe_join_indices<JoinKind>(flattened_probe_table, compare_nulls, stream, mr);
+  return flattened_probe;
 }
 
 template <cudf::detail::join_kind JoinKind>
@@ -390,6 +555,7 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::hash_join_impl::probe_join_indices(cudf::table_view const &probe,
                                               null_equality compare_nulls,
+                                              std::optional<std::size_t> output_size,
                                               rmm::cuda_stream_view stream,
                                               rmm::mr::device_memory_resource *mr) const
 {
@@ -406,8 +572,12 @@ hash_join::hash_join_impl::probe_join_indices(cudf::table_view const &probe,
   constexpr cudf::detail::join_kind ProbeJoinKind = (JoinKind == cudf::detail::join_kind::FULL_JOIN)
                                                       ? cudf::detail::join_kind::LEFT_JOIN
                                                       : JoinKind;
-  auto join_indices = cudf::detail::probe_join_hash_table<ProbeJoinKind>(
-    *build_table, *probe_table, *_hash_table, compare_nulls, stream, mr);
+  // Heavy hitter keys are only probed with the null equality they were found with
+  auto join_indices =
+    _heavy_hitters && _heavy_hitters->compare_nulls == compare_nulls
+      ? probe_join_light_rows<ProbeJoinKind>(probe, compare_nulls, output_size, stream, mr)
+      : cudf::detail::probe_join_hash_table<ProbeJoinKind>(
+          *build_table, *probe_table, *_hash_table, compare_nulls, output_size, stream, mr);
 
   if (JoinKind == cudf::detail::join_kind::FULL_JOIN) {
     auto complement_indices = detail::get_left_join_indices_complement(
@@ -417,4 +587,46 @@ hash_join::hash_join_impl::probe_join_indices(cudf::table_view const &probe,
   return join_indices;
 }
 
+template <cudf::detail::join_kind JoinKind>
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+hash_join::hash_join_impl::probe_join_light_rows(cudf::table_view const &probe,
+                                                 null_equality compare_nulls,
+                                                 std::optional<std::size_t> output_size,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource *mr) const
+{
+  auto [heavy_indices, light_rows] =
+    cudf::detail::join_heavy_hitters(*_heavy_hitters, probe, stream, mr);
+  CUDF_EXPECTS(!output_size || *output_size >= heavy_indices.first->size(),
+               "Join output size is smaller than the output of its heavy hitter keys");
+  auto const light_output_size =
+    output_size ? std::optional<std::size_t>{*output_size - heavy_indices.first->size()}
+                : std::nullopt;
+
+  auto const light_rows_view = cudf::column_view(
+    data_type{type_id::INT32}, static_cast<size_type>(light_rows.size()), light_rows.data());
+  auto const light_probe = cudf::detail::gather(probe,
+                                                light_rows_view,
+                                                cudf::out_of_bounds_policy::DONT_CHECK,
+                                                cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                                stream);
+  auto build_table = cudf::table_device_view::create(_build, stream);
+  auto probe_table = cudf::table_device_view::create(light_probe->view(), stream);
+
+  auto light_indices = cudf::detail::probe_join_hash_table<JoinKind>(
+    *build_table, *probe_table, *_hash_table, compare_nulls, light_output_size, stream, mr);
+
+  // Map the rows of the light probe table back to the rows of the probe table
+  auto probe_indices =
+    std::make_unique<rmm::device_uvector<size_type>>(light_indices.first->size(), stream, mr);
+  thrust::gather(rmm::exec_policy(stream),
+                 light_indices.first->begin(),
+                 light_indices.first->end(),
+                 light_rows.begin(),
+                 probe_indices->begin());
+  light_indices.first = std::move(probe_indices);
+  return cudf::detail::concatenate_vector_pairs(light_indices, heavy_indices, stream);
+}
+
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -31,12 +31,128 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
 #include <thrust/sequence.h>
 
+#include <algorithm>
 #include <limits>
+#include <optional>
+#include <tuple>
 
 namespace cudf {
 namespace detail {
+/**
+ * @brief Counts the output rows of joining the first `probe_num_rows` rows of the probe table.
+ *
+ * The hash table is probed without writing any output.
+ *
+ * @tparam JoinKind The type of join to be performed
+ * @tparam multimap_type The type of the hash table
+ *
+ * @param build_table The right hand table
+ * @param probe_table The left hand table
+ * @param hash_table A hash table built on the build table that maps the index
+ * of every row to the hash value of that row.
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param probe_num_rows The number of rows of the probe table to join
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return The number of output rows
+ */
+template <join_kind JoinKind, typename multimap_type>
+int64_t count_join_output_size(table_device_view build_table,
+                               table_device_view probe_table,
+                               multimap_type const& hash_table,
+                               null_equality compare_nulls,
+                               size_type probe_num_rows,
+                               rmm::cuda_stream_view stream)
+{
+  constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+  int numBlocks{-1};
+
+  CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+    &numBlocks, compute_join_output_size<JoinKind, multimap_type, block_size>, block_size, 0));
+
+  int dev_id{-1};
+  CUDA_TRY(cudaGetDevice(&dev_id));
+
+  int num_sms{-1};
+  CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, dev_id));
+
+  rmm::device_scalar<int64_t> size(0, stream);
+  row_hash hash_probe{probe_table};
+  row_equality equality{probe_table, build_table, compare_nulls == null_equality::EQUAL};
+  // Probe the hash table without actually building the output to simply
+  // find what the size of the output will be.
+  compute_join_output_size<JoinKind, multimap_type, block_size>
+    <<<numBlocks * num_sms, block_size, 0, stream.value()>>>(hash_table.get_device_view(),
+                                                             build_table,
+                                                             probe_table,
+                                                             hash_probe,
+                                                             equality,
+                                                             probe_num_rows,
+                                                             size.data());
+  CHECK_CUDA(stream.value());
+  return size.value(stream);
+}
+
+/**
+ * @brief Finds the longest run of leading probe rows whose join output fits in
+ * `max_output_rows` rows.
+ *
+ * @tparam JoinKind The type of join to be performed
+ * @tparam multimap_type The type of the hash table
+ *
+ * @param build_table The right hand table
+ * @param probe_table The left hand table
+ * @param hash_table A hash table built on the build table that maps the index
+ * of every row to the hash value of that row.
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param max_output_rows The maximum number of output rows of the run
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return The number of probe rows of the run, which is at least one even if the output of the
+ * first probe row does not fit, and their number of output rows
+ */
+template <join_kind JoinKind, typename multimap_type>
+std::pair<size_type, int64_t> join_chunk_size(table_device_view build_table,
+                                              table_device_view probe_table,
+                                              multimap_type const& hash_table,
+                                              null_equality compare_nulls,
+                                              std::size_t max_output_rows,
+                                              rmm::cuda_stream_view stream)
+{
+  auto const probe_num_rows = probe_table.num_rows();
+  rmm::device_uvector<size_type> row_counts(probe_num_rows, stream);
+
+  constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+  // Each probe row is looked up by a tile of threads
+  detail::grid_1d config(probe_num_rows, block_size / multimap_type::cg_size);
+  row_hash hash_probe{probe_table};
+  row_equality equality{probe_table, build_table, compare_nulls == null_equality::EQUAL};
+  compute_join_row_counts<JoinKind, multimap_type>
+    <<<config.num_blocks, block_size, 0, stream.value()>>>(
+      hash_table.get_device_view(), hash_probe, equality, probe_num_rows, row_counts.data());
+  CHECK_CUDA(stream.value());
+
+  // Use 64-bit running sums to detect overflow
+  rmm::device_uvector<int64_t> row_ends(probe_num_rows, stream);
+  auto const counts_begin = thrust::make_transform_iterator(
+    row_counts.begin(), [] __device__(size_type count) { return static_cast<int64_t>(count); });
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), counts_begin, counts_begin + probe_num_rows, row_ends.begin());
+
+  auto const max_rows = static_cast<int64_t>(
+    std::min<std::size_t>(max_output_rows, std::numeric_limits<int64_t>::max()));
+  auto const fit_end =
+    thrust::upper_bound(rmm::exec_policy(stream), row_ends.begin(), row_ends.end(), max_rows);
+  auto const num_rows =
+    std::max<size_type>(1, static_cast<size_type>(thrust::distance(row_ends.begin(), fit_end)));
+  return {num_rows, row_ends.element(num_rows - 1, stream)};
+}
+
 /**
  * @brief Gives an estimate of the size of the join output produced when
  * joining two tables together.
@@ -99,23 +215,7 @@ size_type estimate_join_output_size(table_device_view build_table,
   constexpr size_type MAX_RATIO{5};
   if (probe_to_build_ratio > MAX_RATIO) { sample_probe_num_rows = build_table_num_rows; }
 
-  // Allocate storage for the counter used to get the size of the join output
   estimate_size_type h_size_estimate{0};
-  rmm::device_scalar<estimate_size_type> size_estimate(0, stream);
-
-  CHECK_CUDA(stream.value());
-
-  constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
-  int numBlocks{-1};
-
-  CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
-    &numBlocks, compute_join_output_size<JoinKind, multimap_type, block_size>, block_size, 0));
-
-  int dev_id{-1};
-  CUDA_TRY(cudaGetDevice(&dev_id));
-
-  int num_sms{-1};
-  CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, dev_id));
 
   // Continue probing with a subset of the probe table until either:
   // a non-zero output size estimate is found OR
@@ -123,29 +223,16 @@ size_type estimate_join_output_size(table_device_view build_table,
   do {
     sample_probe_num_rows = std::min(sample_probe_num_rows, probe_table_num_rows);
 
-    size_estimate.set_value_zero(stream);
-
-    row_hash hash_probe{probe_table};
-    row_equality equality{probe_table, build_table, compare_nulls == null_equality::EQUAL};
-    // Probe the hash table without actually building the output to simply
-    // find what the size of the output will be.
-    compute_join_output_size<JoinKind, multimap_type, block_size>
-      <<<numBlocks * num_sms, block_size, 0, stream.value()>>>(hash_table,
-                                                               build_table,
-                                                               probe_table,
-                                                               hash_probe,
-                                                               equality,
-                                                               sample_probe_num_rows,
-                                                               size_estimate.data());
-    CHECK_CUDA(stream.value());
+    auto const sample_size = count_join_output_size<JoinKind>(
+      build_table, probe_table, hash_table, compare_nulls, sample_probe_num_rows, stream);
 
     // Only in case subset of probe table is chosen,
     // increase the estimated output size by a factor of the ratio between the
     // probe and build tables
     if (sample_probe_num_rows < probe_table_num_rows) {
-      h_size_estimate = size_estimate.value(stream) * probe_to_build_ratio;
+      h_size_estimate = sample_size * probe_to_build_ratio;
     } else {
-      h_size_estimate = size_estimate.value(stream);
+      h_size_estimate = sample_size;
     }
 
     // Detect overflow
@@ -201,12 +288,101 @@ get_trivial_left_join_indices(
   return std::make_pair(std::move(left_indices), std::move(right_indices));
 }
 
+/**
+ * @brief Builds the hash table of the rows of `build` used by the join kernels.
+ *
+ * Rows with nulls in any column are not inserted when `compare_nulls` is UNEQUAL.
+ *
+ * @throw cudf::logic_error if `build` has no columns or no rows.
+ *
+ * @param build Table of columns used to build join hash.
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Built hash table.
+ */
+std::unique_ptr<multimap_type> build_join_hash_table(cudf::table_view const& build,
+                                                     null_equality compare_nulls,
+                                                     rmm::cuda_stream_view stream);
+
+/**
+ * @brief The build rows of the heavy hitter keys of a hash join, grouped by key.
+ *
+ * Probing the hash table for a key with many build rows walks a long chain of windows on a single
+ * tile while the other tiles of its warp idle. The probe rows of heavy hitter keys are instead
+ * joined to the group of build rows of their key with one thread per output row.
+ */
+struct heavy_hitters {
+  std::unique_ptr<table> keys;                ///< One build row of each heavy hitter key
+  std::unique_ptr<multimap_type> hash_table;  ///< Hash table of `keys`
+  rmm::device_uvector<size_type> offsets;     ///< Offsets of the group of each key in `rows`
+  rmm::device_uvector<size_type> rows;        ///< Build rows of the heavy hitter keys by key
+  null_equality compare_nulls;                ///< Whether null keys were grouped together
+};
+
+/**
+ * @brief Finds the keys of `build` with many rows from a sample of its rows.
+ *
+ * A key is a heavy hitter if it is estimated to have at least `HEAVY_HITTER_MIN_ROWS` rows.
+ *
+ * @param build Table of columns used to build join hash.
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return The heavy hitters of `build`, or nullptr if it has none.
+ */
+std::unique_ptr<heavy_hitters> find_heavy_hitters(table_view const& build,
+                                                  null_equality compare_nulls,
+                                                  rmm::cuda_stream_view stream);
+
+/**
+ * @brief Joins the probe rows with a heavy hitter key to the build rows of their key.
+ *
+ * Probe keys are compared with the null equality the heavy hitters were found with.
+ *
+ * @param heavy The heavy hitters of the build table.
+ * @param probe Table of probe side columns to join.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned join indices.
+ *
+ * @return The join indices of the probe rows with a heavy hitter key, and the other probe rows.
+ */
+std::pair<VectorPair, rmm::device_uvector<size_type>> join_heavy_hitters(
+  heavy_hitters const& heavy,
+  table_view const& probe,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
 std::pair<std::unique_ptr<table>, std::unique_ptr<table>> get_empty_joined_table(
   table_view const& probe, table_view const& build);
 
 std::unique_ptr<cudf::table> combine_table_pair(std::unique_ptr<cudf::table>&& left,
                                                 std::unique_ptr<cudf::table>&& right);
 
+std::unique_ptr<table> inner_join(table_view const& left_input,
+                                  table_view const& right_input,
+                                  std::vector<size_type> const& left_on,
+                                  std::vector<size_type> const& right_on,
+                                  null_equality compare_nulls,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr);
+
+std::unique_ptr<table> left_join(table_view const& left_input,
+                                 table_view const& right_input,
+                                 std::vector<size_type> const& left_on,
+                                 std::vector<size_type> const& right_on,
+                                 null_equality compare_nulls,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr);
+
+std::unique_ptr<table> full_join(table_view const& left_input,
+                                 table_view const& right_input,
+                                 std::vector<size_type> const& left_on,
+                                 std::vector<size_type> const& right_on,
+                                 null_equality compare_nulls,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr);
+
 }  // namespace detail
 
 struct hash_join::hash_join_impl {
@@ -221,8 +397,8 @@ struct hash_join::hash_join_impl {
  private:
   cudf::table_view _build;
   std::vector<std::unique_ptr<cudf::column>> _created_null_columns;
-  std::unique_ptr<cudf::detail::multimap_type, std::function<void(cudf::detail::multimap_type*)>>
-    _hash_table;
+  std::unique_ptr<cudf::detail::multimap_type> _hash_table;
+  std::unique_ptr<cudf::detail::heavy_hitters> _heavy_hitters;
 
  public:
   /**
@@ -242,6 +418,7 @@ struct hash_join::hash_join_impl {
             std::unique_ptr<rmm::device_uvector<size_type>>>
   inner_join(cudf::table_view const& probe,
              null_equality compare_nulls,
+             std::optional<std::size_t> output_size,
              rmm::cuda_stream_view stream,
              rmm::mr::device_memory_resource* mr) const;
 
@@ -249,6 +426,7 @@ struct hash_join::hash_join_impl {
             std::unique_ptr<rmm::device_uvector<size_type>>>
   left_join(cudf::table_view const& probe,
             null_equality compare_nulls,
+            std::optional<std::size_t> output_size,
             rmm::cuda_stream_view stream,
             rmm::mr::device_memory_resource* mr) const;
 
@@ -259,15 +437,89 @@ struct hash_join::hash_join_impl {
             rmm::cuda_stream_view stream,
             rmm::mr::device_memory_resource* mr) const;
 
+  std::size_t inner_join_size(cudf::table_view const& probe,
+                              null_equality compare_nulls,
+                              rmm::cuda_stream_view stream) const;
+
+  std::size_t left_join_size(cudf::table_view const& probe,
+                             null_equality compare_nulls,
+                             rmm::cuda_stream_view stream) const;
+
+  std::tuple<std::unique_ptr<rmm::device_uvector<size_type>>,
+             std::unique_ptr<rmm::device_uvector<size_type>>,
+             size_type>
+  inner_join_chunk(cudf::table_view const& probe,
+                   size_type probe_row_begin,
+                   std::size_t max_output_rows,
+                   null_equality compare_nulls,
+                   rmm::cuda_stream_view stream,
+                   rmm::mr::device_memory_resource* mr) const;
+
+  std::tuple<std::unique_ptr<rmm::device_uvector<size_type>>,
+             std::unique_ptr<rmm::device_uvector<size_type>>,
+             size_type>
+  left_join_chunk(cudf::table_view const& probe,
+                  size_type probe_row_begin,
+                  std::size_t max_output_rows,
+                  null_equality compare_nulls,
+                  rmm::cuda_stream_view stream,
+                  rmm::mr::device_memory_resource* mr) const;
+
+  join_bloom_filter bloom_filter(null_equality compare_nulls,
+                                 int bits_per_key,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr) const;
+
  private:
   template <cudf::detail::join_kind JoinKind>
   std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
             std::unique_ptr<rmm::device_uvector<size_type>>>
   compute_hash_join(cudf::table_view const& probe,
                     null_equality compare_nulls,
+                    std::optional<std::size_t> output_size,
                     rmm::cuda_stream_view stream,
                     rmm::mr::device_memory_resource* mr) const;
 
+  /**
+   * @brief Counts the output rows of a join of `probe` with the build table by probing the
+   * hash table without writing any output.
+   */
+  template <cudf::detail::join_kind JoinKind>
+  std::size_t compute_join_size(cudf::table_view const& probe,
+                                null_equality compare_nulls,
+                                rmm::cuda_stream_view stream) const;
+
+  /**
+   * @brief Computes the next chunk of the output of a join of `probe` with the build table.
+   *
+   * The output rows of each probe row in a window of at most `max_output_rows` probe rows are
+   * counted, and the chunk holds the longest run of probe rows whose output fits in
+   * `max_output_rows` rows, or the first probe row if its output alone does not fit.
+   */
+  template <cudf::detail::join_kind JoinKind>
+  std::tuple<std::unique_ptr<rmm::device_uvector<size_type>>,
+             std::unique_ptr<rmm::device_uvector<size_type>>,
+             size_type>
+  compute_join_chunk(cudf::table_view const& probe,
+                     size_type probe_row_begin,
+                     std::size_t max_output_rows,
+                     null_equality compare_nulls,
+                     rmm::cuda_stream_view stream,
+                     rmm::mr::device_memory_resource* mr) const;
+
+  /**
+   * @brief Flattens the struct columns of `probe` and checks that it can be joined with the build
+   * table.
+   *
+   * @throw cudf::logic_error if `probe` has no columns or too many rows.
+   * @throw cudf::logic_error if the columns of `probe` do not match those of the build table.
+   */
+  std::tuple<cudf::table_view,
+             std::vector<order>,
+             std::vector<null_order>,
+             std::vector<std::unique_ptr<column>>>
+  flatten_probe(cudf::table_view const& probe) const;
+
   /**
    * @brief Probes the `_hash_table` built from `_build` for tuples in `probe_table`,
    * and returns the output indices of `build_table` and `probe_table` as a combined table,
@@ -279,6 +531,7 @@ struct hash_join::hash_join_impl {
    *
    * @param probe_table Table of probe side columns to join.
    * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param output_size Optional exact output size. If not given, the output size is estimated.
    * @param stream CUDA stream used for device memory operations and kernel launches.
    * @param mr Device memory resource used to allocate the returned vectors.
    *
@@ -289,8 +542,32 @@ struct hash_join::hash_join_impl {
             std::unique_ptr<rmm::device_uvector<size_type>>>
   probe_join_indices(cudf::table_view const& probe,
                      null_equality compare_nulls,
+                     std::optional<std::size_t> output_size,
                      rmm::cuda_stream_view stream,
                      rmm::mr::device_memory_resource* mr) const;
+
+  /**
+   * @brief Probes the hash table with the probe rows without a heavy hitter key, and joins the
+   * other probe rows to the grouped build rows of their key.
+   *
+   * @tparam JoinKind The type of join to be performed, either INNER_JOIN or LEFT_JOIN.
+   *
+   * @param probe_table Table of probe side columns to join.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param output_size Optional exact output size. If not given, the output size is estimated.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource used to allocate the returned vectors.
+   *
+   * @return Join output indices vector pair.
+   */
+  template <cudf::detail::join_kind JoinKind>
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  probe_join_light_rows(cudf::table_view const& probe,
+                        null_equality compare_nulls,
+                        std::optional<std::size_t> output_size,
+                        rmm::cuda_stream_view stream,
+                        rmm::mr::device_memory_resource* mr) const;
 };
 
 }  // namespace cudf
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <join/hash_join.cuh>
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/partition.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+constexpr size_type HEAVY_HITTER_MIN_ROWS{1024};        // Build rows of a heavy hitter key
+constexpr size_type HEAVY_HITTER_SAMPLE_SIZE{1 << 16};  // Build rows sampled to find heavy hitters
+constexpr size_type HEAVY_HITTER_MIN_SAMPLES{4};        // Sampled rows of a heavy hitter key
+
+/**
+ * @brief Finds the row of `keys` equal to each row of `probe`.
+ *
+ * @param hash_table The hash table built on `keys`, which has no duplicate rows
+ *
+ * @return The row of `keys` equal to each row of `probe`, or `JoinNoneValue` if there is none
+ */
+rmm::device_uvector<size_type> find_keys(multimap_type const& hash_table,
+                                         table_view const& keys,
+                                         table_view const& probe,
+                                         null_equality compare_nulls,
+                                         rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<size_type> matches(probe.num_rows(), stream);
+  if (probe.num_rows() == 0) { return matches; }
+
+  auto const keys_table  = table_device_view::create(keys, stream);
+  auto const probe_table = table_device_view::create(probe, stream);
+
+  constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+  // Each probe row is looked up by a tile of threads
+  detail::grid_1d config(probe.num_rows(), block_size / multimap_type::cg_size);
+  row_hash hash_probe{*probe_table};
+  row_equality equality{*probe_table, *keys_table, compare_nulls == null_equality::EQUAL};
+  find_unique_matches<multimap_type><<<config.num_blocks, block_size, 0, stream.value()>>>(
+    hash_table.get_device_view(), hash_probe, equality, probe.num_rows(), matches.data());
+  CHECK_CUDA(stream.value());
+  return matches;
+}
+
+/**
+ * @brief Samples evenly spaced rows of `build` and returns a build row of each key sampled often
+ * enough to be estimated to have at least `HEAVY_HITTER_MIN_ROWS` rows.
+ */
+rmm::device_uvector<size_type> sample_heavy_hitters(table_view const& build,
+                                                    null_equality compare_nulls,
+                                                    rmm::cuda_stream_view stream)
+{
+  auto const num_rows    = build.num_rows();
+  auto const stride      = std::max<size_type>(1, num_rows / HEAVY_HITTER_SAMPLE_SIZE);
+  auto const num_samples = util::div_rounding_up_safe(num_rows, stride);
+  // A key must be sampled a few times for its estimated number of rows to be meaningful
+  auto const min_samples =
+    std::max(HEAVY_HITTER_MIN_SAMPLES, util::div_rounding_up_safe(HEAVY_HITTER_MIN_ROWS, stride));
+  if (num_samples < min_samples) { return rmm::device_uvector<size_type>(0, stream); }
+
+  rmm::device_uvector<size_type> sample_rows(num_samples, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_samples),
+                    sample_rows.begin(),
+                    [stride] __device__(size_type index) { return index * stride; });
+  auto const sample = detail::gather(
+    build,
+    column_view{data_type{type_id::INT32}, num_samples, sample_rows.data()},
+    out_of_bounds_policy::DONT_CHECK,
+    negative_index_policy::NOT_ALLOWED,
+    stream);
+
+  // The sampled rows of each key are consecutive in sorted order, so a key has at least
+  // `min_samples` sampled rows if its first one is equal to the one `min_samples - 1` after it
+  auto const sorted_rows  = detail::sorted_order(sample->view(), {}, {}, stream);
+  auto const order        = sorted_rows->view().data<size_type>();
+  auto const sample_table = table_device_view::create(sample->view(), stream);
+  auto const num_starts   = num_samples - min_samples + 1;
+  auto const build_rows   = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [order, stride] __device__(size_type index) { return order[index] * stride; });
+
+  rmm::device_uvector<size_type> heavy_rows(num_starts, stream);
+  auto const heavy_end = thrust::copy_if(
+    rmm::exec_policy(stream),
+    build_rows,
+    build_rows + num_starts,
+    thrust::make_counting_iterator<size_type>(0),
+    heavy_rows.begin(),
+    [equal = row_equality{*sample_table, *sample_table, compare_nulls == null_equality::EQUAL},
+     order,
+     min_samples] __device__(size_type index) {
+      return (index == 0 or not equal(order[index - 1], order[index])) and
+             equal(order[index], order[index + min_samples - 1]);
+    });
+  heavy_rows.resize(thrust::distance(heavy_rows.begin(), heavy_end), stream);
+  return heavy_rows;
+}
+
+}  // namespace
+
+std::unique_ptr<heavy_hitters> find_heavy_hitters(table_view const& build,
+                                                  null_equality compare_nulls,
+                                                  rmm::cuda_stream_view stream)
+{
+  if (build.num_rows() < HEAVY_HITTER_MIN_ROWS) { return nullptr; }
+  auto const heavy_rows = sample_heavy_hitters(build, compare_nulls, stream);
+  if (heavy_rows.is_empty()) { return nullptr; }
+
+  auto const heavy_rows_view = column_view{
+    data_type{type_id::INT32}, static_cast<size_type>(heavy_rows.size()), heavy_rows.data()};
+  auto keys = detail::gather(build,
+                             heavy_rows_view,
+                             out_of_bounds_policy::DONT_CHECK,
+                             negative_index_policy::NOT_ALLOWED,
+                             stream);
+
+  auto hash_table = build_join_hash_table(keys->view(), compare_nulls, stream);
+
+  // Group the build rows of the heavy hitter keys by key
+  auto const build_keys = find_keys(*hash_table, keys->view(), build, compare_nulls, stream);
+  rmm::device_uvector<size_type> rows(build.num_rows(), stream);
+  auto const rows_end = thrust::copy_if(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(build.num_rows()),
+    build_keys.begin(),
+    rows.begin(),
+    [] __device__(size_type key) { return key != JoinNoneValue; });
+  rows.resize(thrust::distance(rows.begin(), rows_end), stream);
+
+  rmm::device_uvector<size_type> row_keys(rows.size(), stream);
+  thrust::gather(
+    rmm::exec_policy(stream), rows.begin(), rows.end(), build_keys.begin(), row_keys.begin());
+  thrust::stable_sort_by_key(
+    rmm::exec_policy(stream), row_keys.begin(), row_keys.end(), rows.begin());
+
+  rmm::device_uvector<size_type> offsets(keys->num_rows() + 1, stream);
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      row_keys.begin(),
+                      row_keys.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(offsets.size()),
+                      offsets.begin());
+  return std::make_unique<heavy_hitters>(
+    heavy_hitters{
+      std::move(keys), std::move(hash_table), std::move(offsets), std::move(rows), compare_nulls});
+}
+
+std::pair<VectorPair, rmm::device_uvector<size_type>> join_heavy_hitters(
+  heavy_hitters const& heavy,
+  table_view const& probe,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const probe_keys =
+    find_keys(*heavy.hash_table, heavy.keys->view(), probe, heavy.compare_nulls, stream);
+
+  rmm::device_uvector<size_type> heavy_rows(probe.num_rows(), stream);
+  rmm::device_uvector<size_type> light_rows(probe.num_rows(), stream);
+  auto const ends = thrust::partition_copy(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(probe.num_rows()),
+    probe_keys.begin(),
+    heavy_rows.begin(),
+    light_rows.begin(),
+    [] __device__(size_type key) { return key != JoinNoneValue; });
+  heavy_rows.resize(thrust::distance(heavy_rows.begin(), ends.first), stream);
+  light_rows.resize(thrust::distance(light_rows.begin(), ends.second), stream);
+
+  // Every probe row with a heavy hitter key is joined to all the build rows of its key
+  rmm::device_uvector<size_type> row_offsets(heavy_rows.size(), stream);
+  thrust::transform(
+    rmm::exec_policy(stream),
+    heavy_rows.begin(),
+    heavy_rows.end(),
+    row_offsets.begin(),
+    [keys = probe_keys.data(), offsets = heavy.offsets.data()] __device__(size_type row) {
+      return offsets[keys[row] + 1] - offsets[keys[row]];
+    });
+
+  // Use a 64-bit sum to detect overflow
+  auto const counts_begin = thrust::make_transform_iterator(
+    row_offsets.begin(), [] __device__(size_type count) { return static_cast<int64_t>(count); });
+  auto const join_size = thrust::reduce(rmm::exec_policy(stream),
+                                        counts_begin,
+                                        counts_begin + row_offsets.size(),
+                                        int64_t{0},
+                                        thrust::plus<int64_t>{});
+  CUDF_EXPECTS(join_size <= std::numeric_limits<size_type>::max(),
+               "The output size of the join overflows cudf::size_type");
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), row_offsets.begin(), row_offsets.end(), row_offsets.begin());
+
+  // Every output row looks up its probe row, so that the rows of a key do not serialize on a tile
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  thrust::upper_bound(rmm::exec_policy(stream),
+                      row_offsets.begin(),
+                      row_offsets.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(join_size),
+                      left_indices->begin());
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     join_size,
+                     [keys        = probe_keys.data(),
+                      offsets     = heavy.offsets.data(),
+                      build_rows  = heavy.rows.data(),
+                      heavy_rows  = heavy_rows.data(),
+                      row_offsets = row_offsets.data(),
+                      left        = left_indices->data(),
+                      right       = right_indices->data()] __device__(size_type position) {
+                       auto const index = left[position] - 1;
+                       auto const row   = heavy_rows[index];
+                       left[position]   = row;
+                       right[position] =
+                         build_rows[offsets[keys[row]] + (position - row_offsets[index])];
+                     });
+  return std::make_pair(std::make_pair(std::move(left_indices), std::move(right_indices)),
+                        std::move(light_rows));
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -41,20 +41,19 @@ inner_join(table_view const& left_input,
     stream,
     rmm::mr::get_current_device_resource());  // temporary objects returned
 
-  // now rebuild the table views with the updated ones
-  auto const left  = matched.second.front();
-  auto const right = matched.second.back();
+  // with matched keys the dictionary columns are joined on their indices
+  auto const [left, right] = dictionary_indices(matched.second.front(), matched.second.back());
 
   // For `inner_join`, we can freely choose either the `left` or `right` table to use for
   // building/probing the hash map. Because building is typically more expensive than probing, we
   // build the hash map from the smaller table.
   if (right.num_rows() > left.num_rows()) {
     cudf::hash_join hj_obj(left, compare_nulls, stream);
-    auto result = hj_obj.inner_join(right, compare_nulls, stream, mr);
+    auto result = hj_obj.inner_join(right, compare_nulls, std::nullopt, stream, mr);
     return std::make_pair(std::move(result.second), std::move(result.first));
   } else {
     cudf::hash_join hj_obj(right, compare_nulls, stream);
-    return hj_obj.inner_join(left, compare_nulls, stream, mr);
+    return hj_obj.inner_join(left, compare_nulls, std::nullopt, stream, mr);
   }
 }
 
@@ -107,12 +106,11 @@ left_join(table_view const& left_input,
     {left_input, right_input},  // these should match
     stream,
     rmm::mr::get_current_device_resource());  // temporary objects returned
-  // now rebuild the table views with the updated ones
-  table_view const left  = matched.second.front();
-  table_view const right = matched.second.back();
+  // with matched keys the dictionary columns are joined on their indices
+  auto const [left, right] = dictionary_indices(matched.second.front(), matched.second.back());
 
   cudf::hash_join hj_obj(right, compare_nulls, stream);
-  return hj_obj.left_join(left, compare_nulls, stream, mr);
+  return hj_obj.left_join(left, compare_nulls, std::nullopt, stream, mr);
 }
 
 std::unique_ptr<table> left_join(table_view const& left_input,
@@ -170,9 +168,8 @@ full_join(table_view const& left_input,
     {left_input, right_input},  // these should match
     stream,
     rmm::mr::get_current_device_resource());  // temporary objects returned
-  // now rebuild the table views with the updated ones
-  table_view const left  = matched.second.front();
-  table_view const right = matched.second.back();
+  // with matched keys the dictionary columns are joined on their indices
+  auto const [left, right] = dictionary_indices(matched.second.front(), matched.second.back());
 
   cudf::hash_join hj_obj(right, compare_nulls, stream);
   return hj_obj.full_join(left, compare_nulls, stream, mr);
@@ -234,20 +231,22 @@ std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::inner_join(cudf::table_view const& probe,
                       null_equality compare_nulls,
+                      std::optional<std::size_t> output_size,
                       rmm::cuda_stream_view stream,
                       rmm::mr::device_memory_resource* mr) const
 {
-  return impl->inner_join(probe, compare_nulls, stream, mr);
+  return impl->inner_join(probe, compare_nulls, output_size, stream, mr);
 }
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::left_join(cudf::table_view const& probe,
                      null_equality compare_nulls,
+                     std::optional<std::size_t> output_size,
                      rmm::cuda_stream_view stream,
                      rmm::mr::device_memory_resource* mr) const
 {
-  return impl->left_join(probe, compare_nulls, stream, mr);
+  return impl->left_join(probe, compare_nulls, output_size, stream, mr);
 }
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
@@ -260,6 +259,54 @@ hash_join::full_join(cudf::table_view const& probe,
   return impl->full_join(probe, compare_nulls, stream, mr);
 }
 
+std::size_t hash_join::inner_join_size(cudf::table_view const& probe,
+                                       null_equality compare_nulls,
+                                       rmm::cuda_stream_view stream) const
+{
+  return impl->inner_join_size(probe, compare_nulls, stream);
+}
+
+std::size_t hash_join::left_join_size(cudf::table_view const& probe,
+                                      null_equality compare_nulls,
+                                      rmm::cuda_stream_view stream) const
+{
+  return impl->left_join_size(probe, compare_nulls, stream);
+}
+
+std::tuple<std::unique_ptr<rmm::device_uvector<size_type>>,
+           std::unique_ptr<rmm::device_uvector<size_type>>,
+           size_type>
+hash_join::inner_join_chunk(cudf::table_view const& probe,
+                            size_type probe_row_begin,
+                            std::size_t max_output_rows,
+                            null_equality compare_nulls,
+                            rmm::cuda_stream_view stream,
+                            rmm::mr::device_memory_resource* mr) const
+{
+  return impl->inner_join_chunk(probe, probe_row_begin, max_output_rows, compare_nulls, stream, mr);
+}
+
+std::tuple<std::unique_ptr<rmm::device_uvector<size_type>>,
+           std::unique_ptr<rmm::device_uvector<size_type>>,
+           size_type>
+hash_join::left_join_chunk(cudf::table_view const& probe,
+                           size_type probe_row_begin,
+                           std::size_t max_output_rows,
+                           null_equality compare_nulls,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr) const
+{
+  return impl->left_join_chunk(probe, probe_row_begin, max_output_rows, compare_nulls, stream, mr);
+}
+
+join_bloom_filter hash_join::bloom_filter(null_equality compare_nulls,
+                                          int bits_per_key,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr) const
+{
+  return impl->bloom_filter(compare_nulls, bits_per_key, stream, mr);
+}
+
 // external APIs
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,14 +16,17 @@
 #pragma once
 
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_view.hpp>
 
 #include <rmm/device_uvector.hpp>
 
-#include <hash/concurrent_unordered_multimap.cuh>
+#include <hash/static_multimap.cuh>
 
 #include <limits>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -36,15 +39,10 @@ constexpr size_type JoinNoneValue     = std::numeric_limits<size_type>::min();
 using VectorPair = std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
                              std::unique_ptr<rmm::device_uvector<size_type>>>;
 
-using multimap_type =
-  concurrent_unordered_multimap<hash_value_type,
-                                size_type,
-                                size_t,
-                                std::numeric_limits<hash_value_type>::max(),
-                                std::numeric_limits<size_type>::max(),
-                                default_hash<hash_value_type>,
-                                equal_to<hash_value_type>,
-                                default_allocator<thrust::pair<hash_value_type, size_type>>>;
+using multimap_type = static_multimap<hash_value_type,
+                                      size_type,
+                                      std::numeric_limits<hash_value_type>::max(),
+                                      std::numeric_limits<size_type>::max()>;
 
 using row_hash = cudf::row_hasher<default_hash>;
 
@@ -72,6 +70,37 @@ inline bool is_trivial_join(table_view const& left, table_view const& right, joi
   return false;
 }
 
+/**
+ * @brief Replaces the dictionary columns of two tables with their indices.
+ *
+ * The dictionaries are expected to have matched key sets, see
+ * `cudf::dictionary::detail::match_dictionaries`. Two rows then have equal keys exactly when
+ * they have equal indices, so the join hashes and compares the integers instead of the keys.
+ * A pair of dictionary columns whose indices types differ is left as is.
+ *
+ * @param left Left table with matched dictionary columns
+ * @param right Right table with matched dictionary columns
+ * @return The updated left and right table views
+ */
+inline std::pair<table_view, table_view> dictionary_indices(table_view const& left,
+                                                            table_view const& right)
+{
+  std::vector<column_view> left_columns(left.begin(), left.end());
+  std::vector<column_view> right_columns(right.begin(), right.end());
+  for (std::size_t i = 0; i < left_columns.size() && i < right_columns.size(); ++i) {
+    if (left_columns[i].type().id() != type_id::DICTIONARY32 ||
+        right_columns[i].type().id() != type_id::DICTIONARY32) {
+      continue;
+    }
+    auto const left_indices  = dictionary_column_view(left_columns[i]).get_indices_annotated();
+    auto const right_indices = dictionary_column_view(right_columns[i]).get_indices_annotated();
+    if (left_indices.type() != right_indices.type()) { continue; }
+    left_columns[i]  = left_indices;
+    right_columns[i] = right_indices;
+  }
+  return {table_view{left_columns}, table_view{right_columns}};
+}
+
 }  // namespace detail
 
 }  // namespace cudf
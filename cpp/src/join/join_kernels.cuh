@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,8 @@
 
 #include "join_common_utils.hpp"
 
+#include <cooperative_groups.h>
+
 namespace cudf {
 namespace detail {
 /**
@@ -67,6 +69,8 @@ constexpr auto remap_sentinel_hash(H hash, S sentinel)
  * @brief Builds a hash table from a row hasher that maps the hash
  * values of each row to its respective row index.
  *
+ * Each row is inserted by a tile of `multimap_type::cg_size` threads.
+ *
  * @tparam multimap_type The type of the hash table
  *
  * @param[in,out] multi_map The hash table to be built to insert rows into
@@ -77,29 +81,32 @@ constexpr auto remap_sentinel_hash(H hash, S sentinel)
  * @param[out] error Pointer used to set an error code if the insert fails
  */
 template <typename multimap_type>
-__global__ void build_hash_table(multimap_type multi_map,
+__global__ void build_hash_table(typename multimap_type::device_mutable_view multi_map,
                                  row_hash hash_build,
                                  const cudf::size_type build_table_num_rows,
                                  bitmask_type const* row_bitmask,
                                  int* error)
 {
-  cudf::size_type i = threadIdx.x + blockIdx.x * blockDim.x;
+  auto const tile = cooperative_groups::tiled_partition<multimap_type::cg_size>(
+    cooperative_groups::this_thread_block());
+  cudf::size_type i            = (threadIdx.x + blockIdx.x * blockDim.x) / multimap_type::cg_size;
+  const cudf::size_type stride = (blockDim.x * gridDim.x) / multimap_type::cg_size;
 
   while (i < build_table_num_rows) {
     if (!row_bitmask || cudf::bit_is_set(row_bitmask, i)) {
       // Compute the hash value of this row
-      auto const row_hash_value = remap_sentinel_hash(hash_build(i), multi_map.get_unused_key());
+      auto const row_hash_value =
+        remap_sentinel_hash(hash_build(i), multi_map.get_empty_key_sentinel());
 
       // Insert the (row hash value, row index) into the map
       // using the row hash value to determine the location in the
       // hash map where the new pair should be inserted
-      auto const insert_location =
-        multi_map.insert(thrust::make_pair(row_hash_value, i), true, row_hash_value);
+      auto const inserted = multi_map.insert(tile, row_hash_value, i);
 
       // If the insert failed, set the error code accordingly
-      if (multi_map.end() == insert_location) { *error = 1; }
+      if (!inserted && 0 == tile.thread_rank()) { *error = 1; }
     }
-    i += blockDim.x * gridDim.x;
+    i += stride;
   }
 }
 
@@ -107,6 +114,8 @@ __global__ void build_hash_table(multimap_type multi_map,
  * @brief Computes the output size of joining the probe table to the build table
  * by probing the hash map with the probe table and counting the number of matches.
  *
+ * Each probe row is looked up by a tile of `multimap_type::cg_size` threads.
+ *
  * @tparam JoinKind The type of join to be performed
  * @tparam multimap_type The datatype of the hash table
  * @tparam block_size The number of threads per block for this kernel
@@ -123,7 +132,7 @@ template <join_kind JoinKind,
           typename multimap_type,
           int block_size,
           typename estimate_size_type = int64_t>
-__global__ void compute_join_output_size(multimap_type multi_map,
+__global__ void compute_join_output_size(typename multimap_type::device_view multi_map,
                                          table_device_view build_table,
                                          table_device_view probe_table,
                                          row_hash hash_probe,
@@ -137,59 +146,40 @@ __global__ void compute_join_output_size(multimap_type multi_map,
   // thread, this implementation improves performance by reducing atomic adds to the shared memory
   // counter.
 
+  auto const tile = cooperative_groups::tiled_partition<multimap_type::cg_size>(
+    cooperative_groups::this_thread_block());
+
   cudf::size_type thread_counter{0};
-  const cudf::size_type start_idx = threadIdx.x + blockIdx.x * blockDim.x;
-  const cudf::size_type stride    = blockDim.x * gridDim.x;
-  const auto unused_key           = multi_map.get_unused_key();
-  const auto end                  = multi_map.end();
+  const cudf::size_type start_idx =
+    (threadIdx.x + blockIdx.x * blockDim.x) / multimap_type::cg_size;
+  const cudf::size_type stride = (blockDim.x * gridDim.x) / multimap_type::cg_size;
 
   for (cudf::size_type probe_row_index = start_idx; probe_row_index < probe_table_num_rows;
        probe_row_index += stride) {
     // Search the hash map for the hash value of the probe row using the row's
     // hash value to determine the location where to search for the row in the hash map
-    auto const probe_row_hash_value = remap_sentinel_hash(hash_probe(probe_row_index), unused_key);
-
-    auto found = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
+    auto const probe_row_hash_value =
+      remap_sentinel_hash(hash_probe(probe_row_index), multi_map.get_empty_key_sentinel());
 
-    // for left-joins we always need to add an output
-    bool running     = (JoinKind == join_kind::LEFT_JOIN) || (end != found);
+    auto window      = multi_map.initial_window(probe_row_hash_value);
+    bool running     = true;
     bool found_match = false;
-
+    // Continue searching for matching rows until a window with an empty entry is probed
     while (running) {
-      // TODO Simplify this logic...
-
-      // Left joins always have an entry in the output
-      if (JoinKind == join_kind::LEFT_JOIN && (end == found)) {
-        running = false;
-      }
-      // Stop searching after encountering an empty hash table entry
-      else if (unused_key == found->first) {
-        running = false;
-      }
-      // First check that the hash values of the two rows match
-      else if (found->first == probe_row_hash_value) {
-        // If the hash values are equal, check that the rows are equal
-        if (check_row_equality(probe_row_index, found->second)) {
-          // If the rows are equal, then we have found a true match
-          found_match = true;
-          ++thread_counter;
-        }
-        // Continue searching for matching rows until you hit an empty hash map entry
-        ++found;
-        // If you hit the end of the hash map, wrap around to the beginning
-        if (end == found) found = multi_map.begin();
-        // Next entry is empty, stop searching
-        if (unused_key == found->first) running = false;
-      } else {
-        // Continue searching for matching rows until you hit an empty hash table entry
-        ++found;
-        // If you hit the end of the hash map, wrap around to the beginning
-        if (end == found) found = multi_map.begin();
-        // Next entry is empty, stop searching
-        if (unused_key == found->first) running = false;
-      }
+      running = !multi_map.probe_window(
+        tile, window, probe_row_hash_value, [&](cudf::size_type build_row_index) {
+          // The hash values are equal, check that the rows are equal
+          if (check_row_equality(probe_row_index, build_row_index)) {
+            found_match = true;
+            ++thread_counter;
+          }
+        });
+    }
 
-      if ((JoinKind == join_kind::LEFT_JOIN) && (!running) && (!found_match)) { ++thread_counter; }
+    // Left joins always have an entry in the output
+    if ((JoinKind == join_kind::LEFT_JOIN) && (!tile.any(found_match)) &&
+        (0 == tile.thread_rank())) {
+      ++thread_counter;
     }
   }
 
@@ -201,6 +191,107 @@ __global__ void compute_join_output_size(multimap_type multi_map,
   if (threadIdx.x == 0) atomicAdd(output_size, block_counter);
 }
 
+/**
+ * @brief Counts the output rows of each probe row of joining the probe table to the build table.
+ *
+ * Each probe row is looked up by a tile of `multimap_type::cg_size` threads.
+ *
+ * @tparam JoinKind The type of join to be performed
+ * @tparam multimap_type The datatype of the hash table
+ *
+ * @param[in] multi_map The hash table built on the build table
+ * @param[in] hash_probe Row hasher for the probe table
+ * @param[in] check_row_equality The row equality comparator
+ * @param[in] probe_table_num_rows The number of rows in the probe table
+ * @param[out] row_counts The number of output rows of each probe row
+ */
+template <join_kind JoinKind, typename multimap_type>
+__global__ void compute_join_row_counts(typename multimap_type::device_view multi_map,
+                                        row_hash hash_probe,
+                                        row_equality check_row_equality,
+                                        const cudf::size_type probe_table_num_rows,
+                                        cudf::size_type* row_counts)
+{
+  auto const tile = cooperative_groups::tiled_partition<multimap_type::cg_size>(
+    cooperative_groups::this_thread_block());
+  const cudf::size_type start_idx =
+    (threadIdx.x + blockIdx.x * blockDim.x) / multimap_type::cg_size;
+  const cudf::size_type stride = (blockDim.x * gridDim.x) / multimap_type::cg_size;
+
+  for (cudf::size_type probe_row_index = start_idx; probe_row_index < probe_table_num_rows;
+       probe_row_index += stride) {
+    auto const probe_row_hash_value =
+      remap_sentinel_hash(hash_probe(probe_row_index), multi_map.get_empty_key_sentinel());
+
+    auto window           = multi_map.initial_window(probe_row_hash_value);
+    bool running          = true;
+    cudf::size_type count = 0;
+    while (running) {
+      running = !multi_map.probe_window(
+        tile, window, probe_row_hash_value, [&](cudf::size_type build_row_index) {
+          if (check_row_equality(probe_row_index, build_row_index)) { ++count; }
+        });
+    }
+
+    for (unsigned int offset = tile.size() / 2; offset > 0; offset /= 2) {
+      count += tile.shfl_down(count, offset);
+    }
+    if (0 == tile.thread_rank()) {
+      // Left joins always have an entry in the output
+      row_counts[probe_row_index] = (JoinKind == join_kind::LEFT_JOIN && count == 0) ? 1 : count;
+    }
+  }
+}
+
+/**
+ * @brief Finds the build row equal to each probe row, for a build table without duplicate keys.
+ *
+ * Each probe row is looked up by a tile of `multimap_type::cg_size` threads.
+ *
+ * @tparam multimap_type The datatype of the hash table
+ *
+ * @param[in] multi_map The hash table built on the build table
+ * @param[in] hash_probe Row hasher for the probe table
+ * @param[in] check_row_equality The row equality comparator
+ * @param[in] probe_table_num_rows The number of rows in the probe table
+ * @param[out] matches The build row equal to each probe row, or `JoinNoneValue` if there is none
+ */
+template <typename multimap_type>
+__global__ void find_unique_matches(typename multimap_type::device_view multi_map,
+                                    row_hash hash_probe,
+                                    row_equality check_row_equality,
+                                    const cudf::size_type probe_table_num_rows,
+                                    cudf::size_type* matches)
+{
+  auto const tile = cooperative_groups::tiled_partition<multimap_type::cg_size>(
+    cooperative_groups::this_thread_block());
+  const cudf::size_type start_idx =
+    (threadIdx.x + blockIdx.x * blockDim.x) / multimap_type::cg_size;
+  const cudf::size_type stride = (blockDim.x * gridDim.x) / multimap_type::cg_size;
+
+  for (cudf::size_type probe_row_index = start_idx; probe_row_index < probe_table_num_rows;
+       probe_row_index += stride) {
+    auto const probe_row_hash_value =
+      remap_sentinel_hash(hash_probe(probe_row_index), multi_map.get_empty_key_sentinel());
+
+    auto window           = multi_map.initial_window(probe_row_hash_value);
+    bool running          = true;
+    cudf::size_type match = JoinNoneValue;
+    while (running) {
+      running = !multi_map.probe_window(
+        tile, window, probe_row_hash_value, [&](cudf::size_type build_row_index) {
+          if (check_row_equality(probe_row_index, build_row_index)) { match = build_row_index; }
+        });
+    }
+
+    // At most one thread of the tile finds the match, and `JoinNoneValue` is the lowest index
+    for (unsigned int offset = tile.size() / 2; offset > 0; offset /= 2) {
+      match = max(match, tile.shfl_down(match, offset));
+    }
+    if (0 == tile.thread_rank()) { matches[probe_row_index] = match; }
+  }
+}
+
 /**
  * @brief Computes the output size of joining the left table to the right table.
  *
@@ -283,6 +374,9 @@ __device__ void flush_output_cache(const unsigned int activemask,
  * between the probe and hash table and generate the output for the desired
  * Join operation.
  *
+ * Each probe row is looked up by a tile of `multimap_type::cg_size` threads, so the kernel must
+ * be launched with `multimap_type::cg_size` threads per probe row.
+ *
  * @tparam JoinKind The type of join to be performed
  * @tparam multimap_type The type of the hash table
  * @tparam block_size The number of threads per block for this kernel
@@ -303,7 +397,7 @@ template <join_kind JoinKind,
           typename multimap_type,
           cudf::size_type block_size,
           cudf::size_type output_cache_size>
-__global__ void probe_hash_table(multimap_type multi_map,
+__global__ void probe_hash_table(typename multimap_type::device_view multi_map,
                                  table_device_view build_table,
                                  table_device_view probe_table,
                                  row_hash hash_probe,
@@ -314,10 +408,16 @@ __global__ void probe_hash_table(multimap_type multi_map,
                                  const cudf::size_type max_size)
 {
   constexpr int num_warps = block_size / detail::warp_size;
+  // Each thread adds at most one pair per slot it loads from a window
+  constexpr int max_pairs_per_iteration = detail::warp_size * multimap_type::vector_width;
+  static_assert(max_pairs_per_iteration <= output_cache_size,
+                "Output cache cannot hold the pairs of one probe iteration");
   __shared__ size_type current_idx_shared[num_warps];
   __shared__ size_type join_shared_l[num_warps][output_cache_size];
   __shared__ size_type join_shared_r[num_warps][output_cache_size];
 
+  auto const tile = cooperative_groups::tiled_partition<multimap_type::cg_size>(
+    cooperative_groups::this_thread_block());
   const int warp_id                          = threadIdx.x / detail::warp_size;
   const int lane_id                          = threadIdx.x % detail::warp_size;
   const cudf::size_type probe_table_num_rows = probe_table.num_rows();
@@ -326,65 +426,39 @@ __global__ void probe_hash_table(multimap_type multi_map,
 
   __syncwarp();
 
-  size_type probe_row_index = threadIdx.x + blockIdx.x * blockDim.x;
+  size_type probe_row_index = (threadIdx.x + blockIdx.x * blockDim.x) / multimap_type::cg_size;
 
   const unsigned int activemask = __ballot_sync(0xffffffff, probe_row_index < probe_table_num_rows);
   if (probe_row_index < probe_table_num_rows) {
-    const auto unused_key = multi_map.get_unused_key();
-    const auto end        = multi_map.end();
-
     // Search the hash map for the hash value of the probe row using the row's
     // hash value to determine the location where to search for the row in the hash map
-    auto const probe_row_hash_value = remap_sentinel_hash(hash_probe(probe_row_index), unused_key);
-
-    auto found = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
+    auto const probe_row_hash_value =
+      remap_sentinel_hash(hash_probe(probe_row_index), multi_map.get_empty_key_sentinel());
 
-    bool running = (JoinKind == join_kind::LEFT_JOIN) ||
-                   (end != found);  // for left-joins we always need to add an output
+    auto window      = multi_map.initial_window(probe_row_hash_value);
+    bool running     = true;
     bool found_match = false;
     while (__any_sync(activemask, running)) {
       if (running) {
-        // TODO Simplify this logic...
-
-        // Left joins always have an entry in the output
-        if ((JoinKind == join_kind::LEFT_JOIN) && (end == found)) {
-          running = false;
-        }
-        // Stop searching after encountering an empty hash table entry
-        else if (unused_key == found->first) {
-          running = false;
-        }
-        // First check that the hash values of the two rows match
-        else if (found->first == probe_row_hash_value) {
-          // If the hash values are equal, check that the rows are equal
-          // TODO : REMOVE : if(row_equal{probe_table, build_table}(probe_row_index, found->second))
-          if (check_row_equality(probe_row_index, found->second)) {
-            // If the rows are equal, then we have found a true match
-            found_match = true;
-            add_pair_to_cache(probe_row_index,
-                              found->second,
-                              current_idx_shared,
-                              warp_id,
-                              join_shared_l[warp_id],
-                              join_shared_r[warp_id]);
-          }
-          // Continue searching for matching rows until you hit an empty hash map entry
-          ++found;
-          // If you hit the end of the hash map, wrap around to the beginning
-          if (end == found) found = multi_map.begin();
-          // Next entry is empty, stop searching
-          if (unused_key == found->first) running = false;
-        } else {
-          // Continue searching for matching rows until you hit an empty hash table entry
-          ++found;
-          // If you hit the end of the hash map, wrap around to the beginning
-          if (end == found) found = multi_map.begin();
-          // Next entry is empty, stop searching
-          if (unused_key == found->first) running = false;
-        }
+        // Stop searching after probing a window with an empty hash table entry
+        running = !multi_map.probe_window(
+          tile, window, probe_row_hash_value, [&](cudf::size_type build_row_index) {
+            // The hash values are equal, check that the rows are equal
+            if (check_row_equality(probe_row_index, build_row_index)) {
+              // If the rows are equal, then we have found a true match
+              found_match = true;
+              add_pair_to_cache(probe_row_index,
+                                build_row_index,
+                                current_idx_shared,
+                                warp_id,
+                                join_shared_l[warp_id],
+                                join_shared_r[warp_id]);
+            }
+          });
 
         // If performing a LEFT join and no match was found, insert a Null into the output
-        if ((JoinKind == join_kind::LEFT_JOIN) && (!running) && (!found_match)) {
+        if ((JoinKind == join_kind::LEFT_JOIN) && (!running) && (!tile.any(found_match)) &&
+            (0 == tile.thread_rank())) {
           add_pair_to_cache(probe_row_index,
                             static_cast<size_type>(JoinNoneValue),
                             current_idx_shared,
@@ -396,7 +470,7 @@ __global__ void probe_hash_table(multimap_type multi_map,
 
       __syncwarp(activemask);
       // flush output cache if next iteration does not fit
-      if (current_idx_shared[warp_id] + detail::warp_size >= output_cache_size) {
+      if (current_idx_shared[warp_id] + max_pairs_per_iteration > output_cache_size) {
         flush_output_cache<num_warps, output_cache_size>(activemask,
                                                          max_size,
                                                          warp_id,
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <join/hash_join.cuh>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/join.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace cudf {
+
+struct partitioned_join::partitioned_join_impl {
+  /**
+   * @brief The rows of one chunk that fall into one partition, packed in host memory.
+   */
+  struct host_chunk {
+    std::unique_ptr<packed_columns::metadata> metadata;
+    std::vector<uint8_t> data;
+  };
+
+  /**
+   * @brief The partitions of the left or right table.
+   */
+  struct partitioned_table {
+    std::vector<size_type> on;
+    std::unique_ptr<table> empty;  // Columns of the table, used when a partition has no rows
+    std::vector<std::vector<host_chunk>> partitions;
+  };
+
+  partitioned_join_impl(std::vector<size_type> const& left_on,
+                        std::vector<size_type> const& right_on,
+                        int num_partitions,
+                        null_equality compare_nulls)
+    : _num_partitions{num_partitions}, _compare_nulls{compare_nulls}
+  {
+    CUDF_EXPECTS(left_on.size() == right_on.size(),
+                 "Mismatch in number of columns to be joined on");
+    CUDF_EXPECTS(not left_on.empty(), "Partitioned join needs at least one join key");
+    CUDF_EXPECTS(num_partitions > 0, "Number of partitions must be positive");
+    _left.on  = left_on;
+    _right.on = right_on;
+    _left.partitions.resize(num_partitions);
+    _right.partitions.resize(num_partitions);
+  }
+
+  void add(partitioned_table& side, table_view const& chunk, rmm::cuda_stream_view stream)
+  {
+    auto const is_dictionary = [&](size_type i) {
+      return chunk.column(i).type().id() == type_id::DICTIONARY32;
+    };
+    CUDF_EXPECTS(std::none_of(side.on.begin(), side.on.end(), is_dictionary),
+                 "Dictionary join keys are not supported by partitioned_join");
+    if (side.empty == nullptr) { side.empty = empty_like(chunk); }
+    if (chunk.num_rows() == 0) { return; }
+
+    auto const partitioned = hash_partition(
+      chunk, side.on, _num_partitions, hash_id::HASH_MURMUR3, DEFAULT_HASH_SEED, stream);
+    std::vector<size_type> const splits(partitioned.second.begin() + 1, partitioned.second.end());
+    auto const packed = cudf::detail::contiguous_split(partitioned.first->view(), splits, stream);
+
+    for (int p = 0; p < _num_partitions; ++p) {
+      if (packed[p].table.num_rows() == 0) { continue; }
+      auto const& gpu_data = *packed[p].data.gpu_data;
+      host_chunk spilled{std::make_unique<packed_columns::metadata>(*packed[p].data.metadata_),
+                         std::vector<uint8_t>(gpu_data.size())};
+      CUDA_TRY(cudaMemcpyAsync(spilled.data.data(),
+                               gpu_data.data(),
+                               gpu_data.size(),
+                               cudaMemcpyDeviceToHost,
+                               stream.value()));
+      side.partitions[p].push_back(std::move(spilled));
+    }
+    // The device copies of the partitions are freed on return
+    stream.synchronize();
+  }
+
+  /**
+   * @brief Copies the rows of one partition back to the device.
+   */
+  std::unique_ptr<table> load(partitioned_table const& side,
+                              int partition,
+                              rmm::cuda_stream_view stream) const
+  {
+    auto const& chunks = side.partitions[partition];
+    if (chunks.empty()) { return std::make_unique<table>(side.empty->view(), stream); }
+
+    std::vector<rmm::device_buffer> device_data;
+    std::vector<table_view> views;
+    device_data.reserve(chunks.size());
+    for (auto const& chunk : chunks) {
+      device_data.emplace_back(chunk.data.data(), chunk.data.size(), stream);
+      views.push_back(
+        unpack(chunk.metadata->data(), static_cast<uint8_t const*>(device_data.back().data())));
+    }
+    return cudf::detail::concatenate(views, stream);
+  }
+
+  template <cudf::detail::join_kind JoinKind>
+  std::unique_ptr<table> join(int partition,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr) const
+  {
+    CUDF_EXPECTS(_left.empty != nullptr && _right.empty != nullptr,
+                 "No rows were added to the left or right table");
+    CUDF_EXPECTS(partition >= 0 && partition < _num_partitions, "Partition index out of range");
+
+    auto const left  = load(_left, partition, stream);
+    auto const right = load(_right, partition, stream);
+    switch (JoinKind) {
+      case cudf::detail::join_kind::INNER_JOIN:
+        return cudf::detail::inner_join(
+          left->view(), right->view(), _left.on, _right.on, _compare_nulls, stream, mr);
+      case cudf::detail::join_kind::LEFT_JOIN:
+        return cudf::detail::left_join(
+          left->view(), right->view(), _left.on, _right.on, _compare_nulls, stream, mr);
+      case cudf::detail::join_kind::FULL_JOIN:
+        return cudf::detail::full_join(
+          left->view(), right->view(), _left.on, _right.on, _compare_nulls, stream, mr);
+      default: CUDF_FAIL("Unsupported join type");
+    }
+  }
+
+  int const _num_partitions;
+  null_equality const _compare_nulls;
+  partitioned_table _left;
+  partitioned_table _right;
+};
+
+partitioned_join::~partitioned_join() = default;
+
+partitioned_join::partitioned_join(std::vector<size_type> const& left_on,
+                                   std::vector<size_type> const& right_on,
+                                   int num_partitions,
+                                   null_equality compare_nulls)
+  : impl{std::make_unique<partitioned_join_impl>(left_on, right_on, num_partitions, compare_nulls)}
+{
+}
+
+void partitioned_join::add_left(cudf::table_view const& chunk, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  impl->add(impl->_left, chunk, stream);
+}
+
+void partitioned_join::add_right(cudf::table_view const& chunk, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  impl->add(impl->_right, chunk, stream);
+}
+
+int partitioned_join::num_partitions() const { return impl->_num_partitions; }
+
+std::unique_ptr<cudf::table> partitioned_join::inner_join(int partition,
+                                                          rmm::cuda_stream_view stream,
+                                                          rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->join<cudf::detail::join_kind::INNER_JOIN>(partition, stream, mr);
+}
+
+std::unique_ptr<cudf::table> partitioned_join::left_join(int partition,
+                                                         rmm::cuda_stream_view stream,
+                                                         rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->join<cudf::detail::join_kind::LEFT_JOIN>(partition, stream, mr);
+}
+
+std::unique_ptr<cudf::table> partitioned_join::full_join(int partition,
+                                                         rmm::cuda_stream_view stream,
+                                                         rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->join<cudf::detail::join_kind::FULL_JOIN>(partition, stream, mr);
+}
+
+}  // namespace cudf
@@ -34,75 +34,92 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <tuple>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 
-template <join_kind JoinKind>
-std::unique_ptr<rmm::device_uvector<cudf::size_type>> left_semi_anti_join(
-  cudf::table_view const& left_keys,
-  cudf::table_view const& right_keys,
-  null_equality compare_nulls,
-  rmm::cuda_stream_view stream,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
-{
-  CUDF_EXPECTS(0 != left_keys.num_columns(), "Left table is empty");
-  CUDF_EXPECTS(0 != right_keys.num_columns(), "Right table is empty");
+// Only care about existence, so we'll use an unordered map (other joins need a multimap)
+using semi_join_hash_table =
+  concurrent_unordered_map<cudf::size_type, bool, row_hash, row_equality>;
 
-  if (is_trivial_join(left_keys, right_keys, JoinKind)) {
-    return std::make_unique<rmm::device_uvector<cudf::size_type>>(0, stream, mr);
-  }
-  if ((join_kind::LEFT_ANTI_JOIN == JoinKind) && (0 == right_keys.num_rows())) {
-    auto result =
-      std::make_unique<rmm::device_uvector<cudf::size_type>>(left_keys.num_rows(), stream, mr);
-    thrust::sequence(thrust::cuda::par.on(stream.value()), result->begin(), result->end());
-    return result;
-  }
-
-  auto const left_num_rows  = left_keys.num_rows();
-  auto const right_num_rows = right_keys.num_rows();
-
-  // flatten structs for the right and left and use that for the hash table
-  auto right_flattened_tables = structs::detail::flatten_nested_columns(
-    right_keys, {}, {}, structs::detail::column_nullability::FORCE);
-  auto left_flattened_tables = structs::detail::flatten_nested_columns(
-    left_keys, {}, {}, structs::detail::column_nullability::FORCE);
-
-  auto right_flattened_keys = std::get<0>(right_flattened_tables);
-  auto left_flattened_keys  = std::get<0>(left_flattened_tables);
-
-  // Only care about existence, so we'll use an unordered map (other joins need a multimap)
-  using hash_table_type = concurrent_unordered_map<cudf::size_type, bool, row_hash, row_equality>;
-
-  // Create hash table containing all keys found in right table
-  auto right_rows_d            = table_device_view::create(right_flattened_keys, stream);
-  size_t const hash_table_size = compute_hash_table_size(right_num_rows);
-  row_hash hash_build{*right_rows_d};
-  row_equality equality_build{*right_rows_d, *right_rows_d, compare_nulls == null_equality::EQUAL};
-
-  // Going to join it with left table
-  auto left_rows_d = table_device_view::create(left_flattened_keys, stream);
-  row_hash hash_probe{*left_rows_d};
-  row_equality equality_probe{*left_rows_d, *right_rows_d, compare_nulls == null_equality::EQUAL};
-
-  auto hash_table_ptr = hash_table_type::create(hash_table_size,
-                                                stream,
-                                                std::numeric_limits<bool>::max(),
-                                                std::numeric_limits<cudf::size_type>::max(),
-                                                hash_build,
-                                                equality_build);
+/**
+ * @brief Builds a hash table containing the distinct rows of `right_keys`.
+ */
+std::unique_ptr<semi_join_hash_table, std::function<void(semi_join_hash_table*)>>
+build_semi_join_hash_table(table_device_view right_keys,
+                           null_equality compare_nulls,
+                           rmm::cuda_stream_view stream)
+{
+  size_t const hash_table_size = compute_hash_table_size(right_keys.num_rows());
+  row_hash hash_build{right_keys};
+  row_equality equality_build{right_keys, right_keys, compare_nulls == null_equality::EQUAL};
+
+  auto hash_table_ptr = semi_join_hash_table::create(hash_table_size,
+                                                     stream,
+                                                     std::numeric_limits<bool>::max(),
+                                                     std::numeric_limits<cudf::size_type>::max(),
+                                                     hash_build,
+                                                     equality_build);
   auto hash_table     = *hash_table_ptr;
 
   thrust::for_each_n(rmm::exec_policy(stream),
                      thrust::make_counting_iterator<size_type>(0),
-                     right_num_rows,
+                     right_keys.num_rows(),
                      [hash_table] __device__(size_type idx) mutable {
                        hash_table.insert(thrust::make_pair(idx, true));
                      });
+  return hash_table_ptr;
+}
 
-  //
-  // Now we have a hash table, we need to iterate over the rows of the left table
-  // and check to see if they are contained in the hash table
-  //
+/**
+ * @brief Writes whether each row of `left_keys` is contained in the hash table of `right_keys`.
+ */
+void semi_join_contains(semi_join_hash_table const& hash_table,
+                        table_device_view left_keys,
+                        table_device_view right_keys,
+                        null_equality compare_nulls,
+                        bool* output,
+                        rmm::cuda_stream_view stream)
+{
+  row_hash hash_probe{left_keys};
+  row_equality equality_probe{left_keys, right_keys, compare_nulls == null_equality::EQUAL};
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(left_keys.num_rows()),
+                    output,
+                    [hash_table, hash_probe, equality_probe] __device__(size_type idx) {
+                      return hash_table.find(idx, hash_probe, equality_probe) != hash_table.end();
+                    });
+}
+
+/**
+ * @brief Returns the rows of `left_keys` that are (semi join) or are not (anti join) contained
+ * in the hash table of `right_keys`.
+ */
+template <join_kind JoinKind>
+std::unique_ptr<rmm::device_uvector<cudf::size_type>> probe_semi_join_hash_table(
+  semi_join_hash_table const& hash_table,
+  table_device_view left_keys,
+  table_device_view right_keys,
+  null_equality compare_nulls,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const left_num_rows = left_keys.num_rows();
+  row_hash hash_probe{left_keys};
+  row_equality equality_probe{left_keys, right_keys, compare_nulls == null_equality::EQUAL};
 
   // For semi join we want contains to be true, for anti join we want contains to be false
   bool join_type_boolean = (JoinKind == join_kind::LEFT_SEMI_JOIN);
@@ -126,6 +143,32 @@ std::unique_ptr<rmm::device_uvector<cudf::size_type>> left_semi_anti_join(
   return gather_map;
 }
 
+template <join_kind JoinKind>
+std::unique_ptr<rmm::device_uvector<cudf::size_type>> left_semi_anti_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  null_equality compare_nulls,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  CUDF_EXPECTS(0 != left_keys.num_columns(), "Left table is empty");
+  CUDF_EXPECTS(0 != right_keys.num_columns(), "Right table is empty");
+
+  if (is_trivial_join(left_keys, right_keys, JoinKind)) {
+    return std::make_unique<rmm::device_uvector<cudf::size_type>>(0, stream, mr);
+  }
+  if ((join_kind::LEFT_ANTI_JOIN == JoinKind) && (0 == right_keys.num_rows())) {
+    auto result =
+      std::make_unique<rmm::device_uvector<cudf::size_type>>(left_keys.num_rows(), stream, mr);
+    thrust::sequence(thrust::cuda::par.on(stream.value()), result->begin(), result->end());
+    return result;
+  }
+
+  cudf::semi_join const right(right_keys, compare_nulls, stream);
+  return (JoinKind == join_kind::LEFT_SEMI_JOIN) ? right.left_semi_join(left_keys, stream, mr)
+                                                 : right.left_anti_join(left_keys, stream, mr);
+}
+
 /**
  * @brief  Performs a left semi or anti join on the specified columns of two
  * tables (left, right)
@@ -192,8 +235,9 @@ std::unique_ptr<cudf::table> left_semi_anti_join(
   auto const left_selected  = matched.second.front();
   auto const right_selected = matched.second.back();
 
-  auto gather_map =
-    left_semi_anti_join<JoinKind>(left_selected, right_selected, compare_nulls, stream);
+  // with matched keys the dictionary columns are joined on their indices
+  auto const [left_keys, right_keys] = dictionary_indices(left_selected, right_selected);
+  auto gather_map = left_semi_anti_join<JoinKind>(left_keys, right_keys, compare_nulls, stream);
 
   auto const left_updated = scatter_columns(left_selected, left_on, left);
   return cudf::detail::gather(left_updated,
@@ -206,6 +250,144 @@ std::unique_ptr<cudf::table> left_semi_anti_join(
 
 }  // namespace detail
 
+struct semi_join::semi_join_impl {
+ public:
+  semi_join_impl(cudf::table_view const& right_keys,
+                 null_equality compare_nulls,
+                 rmm::cuda_stream_view stream)
+    : _compare_nulls{compare_nulls}
+  {
+    CUDF_EXPECTS(0 != right_keys.num_columns(), "Right table is empty");
+    CUDF_EXPECTS(right_keys.num_rows() < cudf::detail::MAX_JOIN_SIZE,
+                 "Right table is too big for semi join");
+
+    auto flattened_right = structs::detail::flatten_nested_columns(
+      right_keys, {}, {}, structs::detail::column_nullability::FORCE);
+    _right = std::get<0>(flattened_right);
+    // need to store off the owning structures for some of the views in _right
+    _created_null_columns = std::move(std::get<3>(flattened_right));
+    _right_device         = table_device_view::create(_right, stream);
+
+    if (0 == _right.num_rows()) { return; }
+    _hash_table = detail::build_semi_join_hash_table(*_right_device, compare_nulls, stream);
+  }
+
+  std::unique_ptr<cudf::column> contains(cudf::table_view const& left_keys,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr) const
+  {
+    auto flattened_left   = flatten_left(left_keys);
+    auto const left_table = std::get<0>(flattened_left);
+
+    auto result = make_numeric_column(
+      data_type{type_id::BOOL8}, left_table.num_rows(), mask_state::UNALLOCATED, stream, mr);
+    auto const output = result->mutable_view().begin<bool>();
+    if (!_hash_table || 0 == left_table.num_rows()) {
+      thrust::fill(rmm::exec_policy(stream), output, output + left_table.num_rows(), false);
+      return result;
+    }
+
+    auto const left_device = table_device_view::create(left_table, stream);
+    detail::semi_join_contains(
+      *_hash_table, *left_device, *_right_device, _compare_nulls, output, stream);
+    return result;
+  }
+
+  template <detail::join_kind JoinKind>
+  std::unique_ptr<rmm::device_uvector<size_type>> left_join_indices(
+    cudf::table_view const& left_keys,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr) const
+  {
+    auto flattened_left   = flatten_left(left_keys);
+    auto const left_table = std::get<0>(flattened_left);
+
+    if (JoinKind == detail::join_kind::LEFT_SEMI_JOIN && !_hash_table) {
+      return std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr);
+    }
+    if (!_hash_table) {
+      auto result =
+        std::make_unique<rmm::device_uvector<size_type>>(left_table.num_rows(), stream, mr);
+      thrust::sequence(rmm::exec_policy(stream), result->begin(), result->end());
+      return result;
+    }
+
+    auto const left_device = table_device_view::create(left_table, stream);
+    return detail::probe_semi_join_hash_table<JoinKind>(
+      *_hash_table, *left_device, *_right_device, _compare_nulls, stream, mr);
+  }
+
+ private:
+  /**
+   * @brief Flattens the struct columns of `left_keys` and checks that it can be joined with the
+   * right table.
+   */
+  std::tuple<cudf::table_view,
+             std::vector<order>,
+             std::vector<null_order>,
+             std::vector<std::unique_ptr<column>>>
+  flatten_left(cudf::table_view const& left_keys) const
+  {
+    CUDF_EXPECTS(0 != left_keys.num_columns(), "Left table is empty");
+    auto flattened_left = structs::detail::flatten_nested_columns(
+      left_keys, {}, {}, structs::detail::column_nullability::FORCE);
+    auto const left_table = std::get<0>(flattened_left);
+
+    CUDF_EXPECTS(_right.num_columns() == left_table.num_columns(),
+                 "Mismatch in number of columns to be joined on");
+    CUDF_EXPECTS(std::equal(std::cbegin(_right),
+                            std::cend(_right),
+                            std::cbegin(left_table),
+                            std::cend(left_table),
+                            [](auto const& r, auto const& l) { return r.type() == l.type(); }),
+                 "Mismatch in joining column data types");
+    return flattened_left;
+  }
+
+  cudf::table_view _right;
+  std::vector<std::unique_ptr<cudf::column>> _created_null_columns;
+  null_equality _compare_nulls;
+  std::unique_ptr<table_device_view, std::function<void(table_device_view*)>> _right_device;
+  std::unique_ptr<detail::semi_join_hash_table,
+                  std::function<void(detail::semi_join_hash_table*)>>
+    _hash_table;
+};
+
+semi_join::~semi_join() = default;
+
+semi_join::semi_join(cudf::table_view const& right_keys,
+                     null_equality compare_nulls,
+                     rmm::cuda_stream_view stream)
+  : impl{std::make_unique<const semi_join_impl>(right_keys, compare_nulls, stream)}
+{
+}
+
+std::unique_ptr<cudf::column> semi_join::contains(cudf::table_view const& left_keys,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->contains(left_keys, stream, mr);
+}
+
+std::unique_ptr<rmm::device_uvector<size_type>> semi_join::left_semi_join(
+  cudf::table_view const& left_keys,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->left_join_indices<detail::join_kind::LEFT_SEMI_JOIN>(left_keys, stream, mr);
+}
+
+std::unique_ptr<rmm::device_uvector<size_type>> semi_join::left_anti_join(
+  cudf::table_view const& left_keys,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->left_join_indices<detail::join_kind::LEFT_ANTI_JOIN>(left_keys, stream, mr);
+}
+
 std::unique_ptr<cudf::table> left_semi_join(cudf::table_view const& left,
                                             cudf::table_view const& right,
                                             std::vector<cudf::size_type> const& left_on,
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <join/hash_join.cuh>
+
+#include <cudf/detail/merge.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <limits>
+
+namespace cudf {
+namespace detail {
+
+using join_indices = std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                               std::unique_ptr<rmm::device_uvector<size_type>>>;
+
+/**
+ * @brief Computes the position of every left row in `merged_indices`, minus its index.
+ *
+ * This is the number of rows of the other table merged before the left row.
+ *
+ * @param merged_indices The merged indices of the left table and the other table
+ * @param left_side The side of the left table in `merged_indices`
+ * @param bounds The output of size `left_keys.num_rows()`
+ */
+void merged_bounds(index_vector const& merged_indices,
+                   side left_side,
+                   rmm::device_uvector<size_type>& bounds,
+                   rmm::cuda_stream_view stream)
+{
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     merged_indices.size(),
+                     [merged = merged_indices.data(), left_side, bounds = bounds.data()] __device__(
+                       size_type position) {
+                       auto const index = merged[position];
+                       if (thrust::get<0>(index) == left_side) {
+                         auto const row = thrust::get<1>(index);
+                         bounds[row]    = position - row;
+                       }
+                     });
+}
+
+template <join_kind JoinKind>
+join_indices sort_merge_join(table_view const& left_keys,
+                             table_view const& right_keys,
+                             std::vector<order> const& column_order,
+                             std::vector<null_order> const& null_precedence,
+                             null_equality compare_nulls,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(0 != left_keys.num_columns(), "Sort-merge join needs at least one join key");
+  CUDF_EXPECTS(column_order.empty() or column_order.size() == size_t(left_keys.num_columns()),
+               "Mismatch between number of columns and column order.");
+  CUDF_EXPECTS(
+    null_precedence.empty() or null_precedence.size() == size_t(left_keys.num_columns()),
+    "Mismatch between number of columns and null precedence.");
+
+  if (left_keys.num_rows() == 0 ||
+      (JoinKind == join_kind::INNER_JOIN && right_keys.num_rows() == 0)) {
+    return std::make_pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                          std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+  if (right_keys.num_rows() == 0) { return get_trivial_left_join_indices(left_keys, stream, mr); }
+
+  auto const num_columns = left_keys.num_columns();
+  auto const orders =
+    column_order.empty() ? std::vector<order>(num_columns, order::ASCENDING) : column_order;
+  auto const null_orders = null_precedence.empty()
+                             ? std::vector<null_order>(num_columns, null_order::BEFORE)
+                             : null_precedence;
+  auto const nullable = has_nulls(left_keys) or has_nulls(right_keys);
+
+  // Equivalent rows of the first table precede those of the second in the merged order, so the
+  // right rows merged before a left row are those less than it when the left table comes first,
+  // and those not greater than it when the right table comes first.
+  auto const num_left_rows = left_keys.num_rows();
+  rmm::device_uvector<size_type> lower_bounds(num_left_rows, stream);
+  rmm::device_uvector<size_type> upper_bounds(num_left_rows, stream);
+  merged_bounds(
+    generate_merged_indices(left_keys, right_keys, orders, null_orders, nullable, stream),
+    side::LEFT,
+    lower_bounds,
+    stream);
+  merged_bounds(
+    generate_merged_indices(right_keys, left_keys, orders, null_orders, nullable, stream),
+    side::RIGHT,
+    upper_bounds,
+    stream);
+
+  // A left row with a null key matches no right row when nulls are unequal. The right rows
+  // equivalent to a left row without nulls have no nulls either.
+  auto const row_bitmask = (compare_nulls == null_equality::UNEQUAL and has_nulls(left_keys))
+                             ? cudf::detail::bitmask_and(left_keys, stream).first
+                             : rmm::device_buffer{0, stream};
+  auto const row_valid   = static_cast<bitmask_type const*>(row_bitmask.data());
+  auto const num_matches = [row_valid,
+                            lower = lower_bounds.data(),
+                            upper = upper_bounds.data()] __device__(size_type row) {
+    return (row_valid == nullptr or bit_is_set(row_valid, row)) ? upper[row] - lower[row] : 0;
+  };
+
+  rmm::device_uvector<size_type> row_offsets(num_left_rows, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_left_rows),
+                    row_offsets.begin(),
+                    [num_matches] __device__(size_type row) {
+                      auto const count = num_matches(row);
+                      // Left joins always have an entry in the output
+                      return (JoinKind == join_kind::LEFT_JOIN && count == 0) ? 1 : count;
+                    });
+
+  // Use a 64-bit sum to detect overflow
+  auto const counts_begin = thrust::make_transform_iterator(
+    row_offsets.begin(), [] __device__(size_type count) { return static_cast<int64_t>(count); });
+  auto const join_size = thrust::reduce(rmm::exec_policy(stream),
+                                        counts_begin,
+                                        counts_begin + num_left_rows,
+                                        int64_t{0},
+                                        thrust::plus<int64_t>{});
+  CUDF_EXPECTS(join_size <= std::numeric_limits<size_type>::max(),
+               "The output size of the join overflows cudf::size_type");
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), row_offsets.begin(), row_offsets.end(), row_offsets.begin());
+
+  // Every output row looks up its left row, so that skewed keys do not serialize on one thread
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  thrust::upper_bound(rmm::exec_policy(stream),
+                      row_offsets.begin(),
+                      row_offsets.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(join_size),
+                      left_indices->begin());
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     join_size,
+                     [num_matches,
+                      offsets = row_offsets.data(),
+                      lower   = lower_bounds.data(),
+                      left    = left_indices->data(),
+                      right   = right_indices->data()] __device__(size_type position) {
+                       auto const row  = left[position] - 1;
+                       left[position]  = row;
+                       right[position] = num_matches(row) == 0
+                                           ? static_cast<size_type>(JoinNoneValue)
+                                           : lower[row] + (position - offsets[row]);
+                     });
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_inner_join(table_view const& left_keys,
+                      table_view const& right_keys,
+                      std::vector<order> const& column_order,
+                      std::vector<null_order> const& null_precedence,
+                      null_equality compare_nulls,
+                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sort_merge_join<detail::join_kind::INNER_JOIN>(left_keys,
+                                                                right_keys,
+                                                                column_order,
+                                                                null_precedence,
+                                                                compare_nulls,
+                                                                rmm::cuda_stream_default,
+                                                                mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_left_join(table_view const& left_keys,
+                     table_view const& right_keys,
+                     std::vector<order> const& column_order,
+                     std::vector<null_order> const& null_precedence,
+                     null_equality compare_nulls,
+                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sort_merge_join<detail::join_kind::LEFT_JOIN>(left_keys,
+                                                               right_keys,
+                                                               column_order,
+                                                               null_precedence,
+                                                               compare_nulls,
+                                                               rmm::cuda_stream_default,
+                                                               mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/join.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scatter.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Copies the elements of `source` at `source_rows` into `target` at `target_rows`, in
+ * place.
+ */
+struct update_in_place_fn {
+  template <typename T, CUDF_ENABLE_IF(is_rep_layout_compatible<T>())>
+  void operator()(mutable_column_view& target,
+                  column_view const& source,
+                  device_span<size_type const> target_rows,
+                  device_span<size_type const> source_rows,
+                  rmm::cuda_stream_view stream)
+  {
+    auto const d_target = mutable_column_device_view::create(target, stream);
+    auto const d_source = column_device_view::create(source, stream);
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       target_rows.size(),
+                       [target      = *d_target,
+                        source      = *d_source,
+                        target_rows = target_rows.data(),
+                        source_rows = source_rows.data()] __device__(size_type i) {
+                         auto const target_row = target_rows[i];
+                         auto const source_row = source_rows[i];
+                         target.element<T>(target_row) = source.element<T>(source_row);
+                         if (target.nullable()) {
+                           // the bits are set atomically since neighboring rows share a word,
+                           // and are indexed from the start of the mask
+                           auto const bit = target_row + target.offset();
+                           source.is_valid(source_row) ? target.set_valid(bit)
+                                                       : target.set_null(bit);
+                         }
+                       });
+    if (target.nullable()) {
+      target.set_null_count(cudf::count_unset_bits(
+        target.null_mask(), target.offset(), target.offset() + target.size()));
+    }
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_rep_layout_compatible<T>()> operator()(Args&&...)
+  {
+    CUDF_FAIL("Upsert requires fixed-width non-key columns.");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<table> upsert(mutable_table_view& target,
+                              table_view const& updates,
+                              std::vector<size_type> const& key_columns,
+                              null_equality compare_nulls,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(target.num_columns() == updates.num_columns(), "Mismatch in number of columns.");
+  CUDF_EXPECTS(
+    std::equal(target.begin(),
+               target.end(),
+               updates.begin(),
+               [](auto const& lhs, auto const& rhs) { return lhs.type() == rhs.type(); }),
+    "Mismatch in column types.");
+  CUDF_EXPECTS(not key_columns.empty(), "Upsert requires at least one key column.");
+  CUDF_EXPECTS(std::all_of(key_columns.begin(),
+                           key_columns.end(),
+                           [&](auto index) { return index >= 0 and index < target.num_columns(); }),
+               "Key column index out of bounds.");
+
+  std::vector<size_type> value_columns;
+  for (size_type i = 0; i < target.num_columns(); ++i) {
+    if (std::find(key_columns.begin(), key_columns.end(), i) != key_columns.end()) { continue; }
+    CUDF_EXPECTS(is_fixed_width(target.column(i).type()),
+                 "Upsert requires fixed-width non-key columns.");
+    CUDF_EXPECTS(target.column(i).nullable() or not updates.column(i).has_nulls(),
+                 "Cannot update a non-nullable column with nulls.");
+    value_columns.push_back(i);
+  }
+
+  if (updates.num_rows() == 0 or target.num_rows() == 0) {
+    return std::make_unique<table>(updates, stream, mr);
+  }
+
+  // The hash table is built on the updates, and probed with the target rows
+  auto const target_keys = table_view{target}.select(key_columns);
+  hash_join const update_rows_table(updates.select(key_columns), compare_nulls, stream);
+  auto const [target_rows, update_rows] =
+    update_rows_table.inner_join(target_keys, compare_nulls, {}, stream);
+
+  for (auto const i : value_columns) {
+    type_dispatcher<dispatch_storage_type>(target.column(i).type(),
+                                           update_in_place_fn{},
+                                           target.column(i),
+                                           updates.column(i),
+                                           *target_rows,
+                                           *update_rows,
+                                           stream);
+  }
+
+  // The unmatched update rows are returned to be appended
+  rmm::device_uvector<bool> matched(updates.num_rows(), stream);
+  thrust::fill(rmm::exec_policy(stream), matched.begin(), matched.end(), false);
+  thrust::scatter(rmm::exec_policy(stream),
+                  thrust::make_constant_iterator(true),
+                  thrust::make_constant_iterator(true) + update_rows->size(),
+                  update_rows->begin(),
+                  matched.begin());
+  rmm::device_uvector<size_type> appended_rows(updates.num_rows(), stream);
+  auto const appended_end = thrust::copy_if(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(updates.num_rows()),
+    appended_rows.begin(),
+    [matched = matched.data()] __device__(size_type row) { return not matched[row]; });
+  return detail::gather(updates,
+                        appended_rows.begin(),
+                        appended_end,
+                        out_of_bounds_policy::DONT_CHECK,
+                        stream,
+                        mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> upsert(mutable_table_view& target,
+                              table_view const& updates,
+                              std::vector<size_type> const& key_columns,
+                              null_equality compare_nulls,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::upsert(target, updates, key_columns, compare_nulls, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
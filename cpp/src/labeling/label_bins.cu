@@ -19,6 +19,10 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/label_bins.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/labeling/label_bins.hpp>
 #include <cudf/types.hpp>
@@ -35,10 +39,13 @@
 #include <thrust/binary_search.h>
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
 #include <thrust/functional.h>
 #include <thrust/pair.h>
 
+#include <cmath>
 #include <limits>
+#include <type_traits>
 
 namespace cudf {
 namespace detail {
@@ -102,6 +109,175 @@ struct filter_null_sentinel {
   __device__ bool operator()(size_type i) { return i != NULL_VALUE; }
 };
 
+// Maximum size in bytes of the shared memory holding the edges, and the counts of `histogram`.
+constexpr std::size_t max_shared_memory_size = 32 * 1024;
+constexpr size_type bin_block_size           = 256;
+constexpr size_type bin_elements_per_thread  = 8;
+
+/**
+ * @brief Describes bins that are contiguous and of nearly equal width, for which the bin of a
+ * value can be computed arithmetically instead of searched.
+ */
+struct uniform_bins {
+  bool enabled{false};
+  double first_edge{0};     // left edge of the first bin
+  double inverse_width{0};  // inverse of the average width of a bin
+};
+
+/**
+ * @brief Returns the description of the bins if they are uniform, or a disabled one.
+ *
+ * The computed bin is only a guess that is checked against the edges, so rounding errors in the
+ * widths never produce a wrong label.
+ */
+template <typename T>
+uniform_bins find_uniform_bins(column_view const& left_edges,
+                               column_view const& right_edges,
+                               rmm::cuda_stream_view stream)
+{
+  if constexpr (not std::is_arithmetic<T>::value or std::is_same<T, bool>::value) {
+    return {};
+  } else {
+    auto const num_bins = left_edges.size();
+    if (num_bins < 2) { return {}; }
+    auto const left =
+      make_std_vector_sync(device_span<T const>(left_edges.data<T>(), num_bins), stream);
+    auto const right =
+      make_std_vector_sync(device_span<T const>(right_edges.data<T>(), num_bins), stream);
+
+    auto const first_edge = static_cast<double>(left.front());
+    auto const width      = (static_cast<double>(right.back()) - first_edge) / num_bins;
+    if (not(width > 0) or not std::isfinite(width)) { return {}; }
+    for (size_type i = 0; i < num_bins; ++i) {
+      if (i + 1 < num_bins and right[i] != left[i + 1]) { return {}; }
+      if (std::abs(static_cast<double>(left[i]) - (first_edge + i * width)) > width / 2) {
+        return {};
+      }
+    }
+    return {true, first_edge, 1 / width};
+  }
+}
+
+/**
+ * @brief Returns the offset of the edges in the shared memory of `shared_edges_bin_kernel`, after
+ * the counts of the bins when they are counted.
+ */
+CUDA_HOST_DEVICE_CALLABLE std::size_t shared_edges_offset(size_type num_counts)
+{
+  return ((num_counts * sizeof(size_type) + 15) / 16) * 16;
+}
+
+/**
+ * @brief Labels and/or counts the elements of `input` by bin, with the edges of the bins staged
+ * in shared memory.
+ *
+ * @param labels Output label of each element, or `nullptr` if the labels are not needed
+ * @param counts Output number of elements of each bin, or `nullptr` if the bins are not counted
+ */
+template <typename T, typename LeftComparator, typename RightComparator, bool has_nulls>
+__global__ void shared_edges_bin_kernel(column_device_view input,
+                                        T const* __restrict__ left_edges,
+                                        T const* __restrict__ right_edges,
+                                        size_type num_bins,
+                                        uniform_bins uniform,
+                                        size_type* __restrict__ labels,
+                                        int64_t* __restrict__ counts)
+{
+  extern __shared__ __align__(16) char shared_memory[];
+  auto const block_counts = reinterpret_cast<size_type*>(shared_memory);
+  auto const block_left =
+    reinterpret_cast<T*>(shared_memory + shared_edges_offset(counts != nullptr ? num_bins : 0));
+  auto const block_right = block_left + num_bins;
+  for (size_type i = threadIdx.x; i < num_bins; i += blockDim.x) {
+    block_left[i]  = left_edges[i];
+    block_right[i] = right_edges[i];
+    if (counts != nullptr) { block_counts[i] = 0; }
+  }
+  __syncthreads();
+
+  LeftComparator const left_comp{};
+  RightComparator const right_comp{};
+  bin_finder<T, T const*, LeftComparator, RightComparator> const finder(
+    block_left, block_left + num_bins, block_right);
+  for (size_type i = threadIdx.x + blockIdx.x * blockDim.x; i < input.size();
+       i += blockDim.x * gridDim.x) {
+    auto label = NULL_VALUE;
+    if (not has_nulls or input.is_valid_nocheck(i)) {
+      auto const value = input.element<T>(i);
+      if constexpr (std::is_arithmetic<T>::value) {
+        if (uniform.enabled) {
+          // NaN values fail the range check and are left to the search
+          auto const position =
+            (static_cast<double>(value) - uniform.first_edge) * uniform.inverse_width;
+          if (position >= 0 and position < num_bins) {
+            auto const guess = static_cast<size_type>(position);
+            if (left_comp(block_left[guess], value) and right_comp(value, block_right[guess])) {
+              label = guess;
+            }
+          }
+        }
+      }
+      if (label == NULL_VALUE) { label = finder(thrust::make_pair(value, true)); }
+    }
+    if (labels != nullptr) { labels[i] = label; }
+    if (counts != nullptr and label != NULL_VALUE) { atomicAdd(block_counts + label, 1); }
+  }
+
+  if (counts != nullptr) {
+    __syncthreads();
+    for (size_type i = threadIdx.x; i < num_bins; i += blockDim.x) {
+      if (block_counts[i] != 0) { atomicAdd(counts + i, static_cast<int64_t>(block_counts[i])); }
+    }
+  }
+}
+
+/**
+ * @brief Returns whether the edges, and the counts if `with_counts`, fit in the shared memory of
+ * `shared_edges_bin_kernel`.
+ */
+template <typename T>
+bool fits_shared_edges(size_type num_bins, bool with_counts)
+{
+  if constexpr (not is_rep_layout_compatible<T>()) {
+    return false;
+  } else {
+    return shared_edges_offset(with_counts ? num_bins : 0) + 2 * num_bins * sizeof(T) <=
+           max_shared_memory_size;
+  }
+}
+
+/**
+ * @brief Launches `shared_edges_bin_kernel` on `input`.
+ */
+template <typename T, typename LeftComparator, typename RightComparator>
+void shared_edges_bin(column_view const& input,
+                      column_view const& left_edges,
+                      column_view const& right_edges,
+                      size_type* labels,
+                      int64_t* counts,
+                      rmm::cuda_stream_view stream)
+{
+  auto const num_bins = left_edges.size();
+  auto const uniform  = find_uniform_bins<T>(left_edges, right_edges, stream);
+  auto const shared_size =
+    shared_edges_offset(counts != nullptr ? num_bins : 0) + 2 * num_bins * sizeof(T);
+  auto const input_device_view = column_device_view::create(input, stream);
+  cudf::detail::grid_1d const grid{input.size(), bin_block_size, bin_elements_per_thread};
+
+  auto const kernel = input.has_nulls()
+                        ? shared_edges_bin_kernel<T, LeftComparator, RightComparator, true>
+                        : shared_edges_bin_kernel<T, LeftComparator, RightComparator, false>;
+  kernel<<<grid.num_blocks, grid.num_threads_per_block, shared_size, stream.value()>>>(
+    *input_device_view,
+    left_edges.data<T>(),
+    right_edges.data<T>(),
+    num_bins,
+    uniform,
+    labels,
+    counts);
+  CHECK_CUDA(stream.value());
+}
+
 // Bin the input by the edges in left_edges and right_edges.
 template <typename T, typename LeftComparator, typename RightComparator>
 std::unique_ptr<column> label_bins(column_view const& input,
@@ -116,34 +292,41 @@ std::unique_ptr<column> label_bins(column_view const& input,
   auto output_begin        = output_mutable_view.begin<size_type>();
   auto output_end          = output_mutable_view.end<size_type>();
 
-  // These device column views are necessary for creating iterators that work
-  // for columns of compound types. The column_view iterators fail for compound
-  // types because they return raw pointers to the start of the data. The output
-  // does not require these iterators because it's always a primitive type.
-  auto input_device_view       = column_device_view::create(input, stream);
-  auto left_edges_device_view  = column_device_view::create(left_edges, stream);
-  auto right_edges_device_view = column_device_view::create(right_edges, stream);
-
-  auto left_begin  = left_edges_device_view->begin<T>();
-  auto left_end    = left_edges_device_view->end<T>();
-  auto right_begin = right_edges_device_view->begin<T>();
-
-  using RandomAccessIterator = decltype(left_edges_device_view->begin<T>());
-
-  if (input.has_nulls()) {
-    thrust::transform(rmm::exec_policy(stream),
-                      input_device_view->pair_begin<T, true>(),
-                      input_device_view->pair_end<T, true>(),
-                      output_begin,
-                      bin_finder<T, RandomAccessIterator, LeftComparator, RightComparator>(
-                        left_begin, left_end, right_begin));
+  if (fits_shared_edges<T>(left_edges.size(), false)) {
+    if constexpr (is_rep_layout_compatible<T>()) {
+      shared_edges_bin<T, LeftComparator, RightComparator>(
+        input, left_edges, right_edges, output_begin, nullptr, stream);
+    }
   } else {
-    thrust::transform(rmm::exec_policy(stream),
-                      input_device_view->pair_begin<T, false>(),
-                      input_device_view->pair_end<T, false>(),
-                      output_begin,
-                      bin_finder<T, RandomAccessIterator, LeftComparator, RightComparator>(
-                        left_begin, left_end, right_begin));
+    // These device column views are necessary for creating iterators that work
+    // for columns of compound types. The column_view iterators fail for compound
+    // types because they return raw pointers to the start of the data. The output
+    // does not require these iterators because it's always a primitive type.
+    auto input_device_view       = column_device_view::create(input, stream);
+    auto left_edges_device_view  = column_device_view::create(left_edges, stream);
+    auto right_edges_device_view = column_device_view::create(right_edges, stream);
+
+    auto left_begin  = left_edges_device_view->begin<T>();
+    auto left_end    = left_edges_device_view->end<T>();
+    auto right_begin = right_edges_device_view->begin<T>();
+
+    using RandomAccessIterator = decltype(left_edges_device_view->begin<T>());
+
+    if (input.has_nulls()) {
+      thrust::transform(rmm::exec_policy(stream),
+                        input_device_view->pair_begin<T, true>(),
+                        input_device_view->pair_end<T, true>(),
+                        output_begin,
+                        bin_finder<T, RandomAccessIterator, LeftComparator, RightComparator>(
+                          left_begin, left_end, right_begin));
+    } else {
+      thrust::transform(rmm::exec_policy(stream),
+                        input_device_view->pair_begin<T, false>(),
+                        input_device_view->pair_end<T, false>(),
+                        output_begin,
+                        bin_finder<T, RandomAccessIterator, LeftComparator, RightComparator>(
+                          left_begin, left_end, right_begin));
+    }
   }
 
   const auto mask_and_count = valid_if(output_begin, output_end, filter_null_sentinel());
@@ -152,12 +335,45 @@ std::unique_ptr<column> label_bins(column_view const& input,
   return output;
 }
 
+// Count the elements of the input in each of the bins given by left_edges and right_edges.
+template <typename T, typename LeftComparator, typename RightComparator>
+std::unique_ptr<column> histogram(column_view const& input,
+                                  column_view const& left_edges,
+                                  column_view const& right_edges,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  auto output = make_numeric_column(
+    data_type(type_id::INT64), left_edges.size(), mask_state::UNALLOCATED, stream, mr);
+  auto const counts = output->mutable_view().data<int64_t>();
+  CUDA_TRY(cudaMemsetAsync(counts, 0, left_edges.size() * sizeof(int64_t), stream.value()));
+  if (input.is_empty() or left_edges.is_empty()) { return output; }
+
+  if (fits_shared_edges<T>(left_edges.size(), true)) {
+    if constexpr (is_rep_layout_compatible<T>()) {
+      shared_edges_bin<T, LeftComparator, RightComparator>(
+        input, left_edges, right_edges, nullptr, counts, stream);
+    }
+  } else {
+    auto const labels = label_bins<T, LeftComparator, RightComparator>(
+      input, left_edges, right_edges, stream, rmm::mr::get_current_device_resource());
+    thrust::for_each(rmm::exec_policy(stream),
+                     labels->view().begin<size_type>(),
+                     labels->view().end<size_type>(),
+                     [counts] __device__(size_type label) {
+                       if (label != NULL_VALUE) { atomicAdd(counts + label, int64_t{1}); }
+                     });
+  }
+  return output;
+}
+
 template <typename T>
 constexpr auto is_supported_bin_type()
 {
   return cudf::is_relationally_comparable<T, T>() && cudf::is_equality_comparable<T, T>();
 }
 
+template <bool counts>
 struct bin_type_dispatcher {
   template <typename T, typename... Args>
   std::enable_if_t<not detail::is_supported_bin_type<T>(), std::unique_ptr<column>> operator()(
@@ -166,6 +382,19 @@ struct bin_type_dispatcher {
     CUDF_FAIL("Type not support for cudf::bin");
   }
 
+  template <typename T, typename LeftComparator, typename RightComparator>
+  std::unique_ptr<column> bin(column_view const& input,
+                              column_view const& left_edges,
+                              column_view const& right_edges,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+  {
+    return counts ? histogram<T, LeftComparator, RightComparator>(
+                      input, left_edges, right_edges, stream, mr)
+                  : label_bins<T, LeftComparator, RightComparator>(
+                      input, left_edges, right_edges, stream, mr);
+  }
+
   template <typename T>
   std::enable_if_t<detail::is_supported_bin_type<T>(), std::unique_ptr<column>> operator()(
     column_view const& input,
@@ -177,17 +406,16 @@ struct bin_type_dispatcher {
     rmm::mr::device_memory_resource* mr)
   {
     if ((left_inclusive == inclusive::YES) && (right_inclusive == inclusive::YES))
-      return label_bins<T, thrust::less_equal<T>, thrust::less_equal<T>>(
+      return bin<T, thrust::less_equal<T>, thrust::less_equal<T>>(
         input, left_edges, right_edges, stream, mr);
     if ((left_inclusive == inclusive::YES) && (right_inclusive == inclusive::NO))
-      return label_bins<T, thrust::less_equal<T>, thrust::less<T>>(
+      return bin<T, thrust::less_equal<T>, thrust::less<T>>(
         input, left_edges, right_edges, stream, mr);
     if ((left_inclusive == inclusive::NO) && (right_inclusive == inclusive::YES))
-      return label_bins<T, thrust::less<T>, thrust::less_equal<T>>(
+      return bin<T, thrust::less<T>, thrust::less_equal<T>>(
         input, left_edges, right_edges, stream, mr);
     if ((left_inclusive == inclusive::NO) && (right_inclusive == inclusive::NO))
-      return label_bins<T, thrust::less<T>, thrust::less<T>>(
-        input, left_edges, right_edges, stream, mr);
+      return bin<T, thrust::less<T>, thrust::less<T>>(input, left_edges, right_edges, stream, mr);
 
     CUDF_FAIL("Undefined inclusive setting.");
   }
@@ -216,7 +444,35 @@ std::unique_ptr<column> label_bins(column_view const& input,
   if (input.is_empty()) { return make_empty_column(data_type(type_to_id<size_type>())); }
 
   return type_dispatcher<dispatch_storage_type>(input.type(),
-                                                detail::bin_type_dispatcher{},
+                                                detail::bin_type_dispatcher<false>{},
+                                                input,
+                                                left_edges,
+                                                left_inclusive,
+                                                right_edges,
+                                                right_inclusive,
+                                                stream,
+                                                mr);
+}
+
+/// Count the elements of the input in each of the bins given by left_edges and right_edges.
+std::unique_ptr<column> histogram(column_view const& input,
+                                  column_view const& left_edges,
+                                  inclusive left_inclusive,
+                                  column_view const& right_edges,
+                                  inclusive right_inclusive,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE()
+  CUDF_EXPECTS((input.type() == left_edges.type()) && (input.type() == right_edges.type()),
+               "The input and edge columns must have the same types.");
+  CUDF_EXPECTS(left_edges.size() == right_edges.size(),
+               "The left and right edge columns must be of the same length.");
+  CUDF_EXPECTS(!left_edges.has_nulls() && !right_edges.has_nulls(),
+               "The left and right edge columns cannot contain nulls.");
+
+  return type_dispatcher<dispatch_storage_type>(input.type(),
+                                                detail::bin_type_dispatcher<true>{},
                                                 input,
                                                 left_edges,
                                                 left_inclusive,
@@ -239,4 +495,16 @@ std::unique_ptr<column> label_bins(column_view const& input,
   return detail::label_bins(
     input, left_edges, left_inclusive, right_edges, right_inclusive, rmm::cuda_stream_default, mr);
 }
+
+/// Count the elements of the input in each of the bins given by left_edges and right_edges.
+std::unique_ptr<column> histogram(column_view const& input,
+                                  column_view const& left_edges,
+                                  inclusive left_inclusive,
+                                  column_view const& right_edges,
+                                  inclusive right_inclusive,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  return detail::histogram(
+    input, left_edges, left_inclusive, right_edges, right_inclusive, rmm::cuda_stream_default, mr);
+}
 }  // namespace cudf
@@ -14,8 +14,12 @@
  * limitations under the License.
  */
 
+#include <thrust/binary_search.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/logical.h>
+#include <thrust/transform.h>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/valid_if.cuh>
@@ -27,7 +31,9 @@
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/utilities/type_dispatcher.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
+#include <limits>
 #include <type_traits>
 
 namespace cudf {
@@ -35,6 +41,26 @@ namespace lists {
 
 namespace {
 
+// Position returned by index_of for a list row that does not contain its key
+constexpr size_type not_found = -1;
+
+// Positions of the key in a list row that does not contain it, while searching for the first or
+// last occurrence
+constexpr size_type absent_first = std::numeric_limits<size_type>::max();
+constexpr size_type absent_last  = not_found;
+
+/**
+ * @brief Returns whether the key of a list row was found in it.
+ */
+struct is_found_fn {
+  size_type const* positions;
+
+  __device__ bool operator()(size_type row_index) const
+  {
+    return positions[row_index] != absent_first && positions[row_index] != absent_last;
+  }
+};
+
 auto get_search_keys_device_iterable_view(cudf::column_view const& search_keys,
                                           rmm::cuda_stream_view stream)
 {
@@ -46,8 +72,16 @@ auto get_search_keys_device_iterable_view(cudf::scalar const& search_key, rmm::c
   return &search_key;
 }
 
+// Lists at least this long on average are searched one entry per thread rather than one row per
+// thread, so that a few long lists do not leave most threads idle
+constexpr size_type long_list_length = 32;
+
 /**
  * @brief Functor to search each list row for the specified search keys.
+ *
+ * Finds the position of the key of each row within its list, or `absent` if the list does not
+ * contain it, along with whether the list has null entries. The result is either the BOOL8
+ * `contains` column or the INT32 `index_of` column built from these positions.
  */
 template <bool search_keys_have_nulls>
 struct lookup_functor {
@@ -66,69 +100,109 @@ struct lookup_functor {
       "lists::contains() is only supported on numeric types, decimals, chrono types, and strings.");
   }
 
-  std::pair<rmm::device_buffer, size_type> construct_null_mask(lists_column_view const& input_lists,
-                                                               column_view const& result_validity,
-                                                               rmm::cuda_stream_view stream,
-                                                               rmm::mr::device_memory_resource* mr)
-  {
-    if (!search_keys_have_nulls && !input_lists.has_nulls() && !input_lists.child().has_nulls()) {
-      return {rmm::device_buffer{0, stream, mr}, size_type{0}};
-    } else {
-      return cudf::detail::valid_if(result_validity.begin<bool>(),
-                                    result_validity.end<bool>(),
-                                    thrust::identity<bool>{},
-                                    stream,
-                                    mr);
-    }
-  }
-
+  /**
+   * @brief Searches each list row with one thread.
+   *
+   * The entries of a row are compared with its key from the front for `FIND_FIRST` and from the
+   * back for `FIND_LAST`, stopping at the first match.
+   */
   template <typename ElementType, typename SearchKeyPairIter>
-  void search_each_list_row(cudf::detail::lists_column_device_view const& d_lists,
+  void search_each_list_row(column_device_view const& d_lists,
+                            offset_type const* offsets,
+                            column_device_view const& d_child,
                             SearchKeyPairIter search_key_pair_iter,
-                            cudf::mutable_column_device_view mutable_ret_bools,
-                            cudf::mutable_column_device_view mutable_ret_validity,
-                            rmm::cuda_stream_view stream,
-                            rmm::mr::device_memory_resource* mr)
+                            bool find_first,
+                            size_type* d_positions,
+                            bool* d_has_nulls,
+                            rmm::cuda_stream_view stream)
   {
-    thrust::for_each(
+    thrust::for_each_n(
       rmm::exec_policy(stream),
       thrust::make_counting_iterator(0),
-      thrust::make_counting_iterator(d_lists.size()),
+      d_lists.size(),
       [d_lists,
+       offsets,
+       d_child,
        search_key_pair_iter,
-       d_bools    = mutable_ret_bools.data<bool>(),
-       d_validity = mutable_ret_validity.data<bool>()] __device__(auto row_index) {
-        auto search_key_and_validity    = search_key_pair_iter[row_index];
-        auto const& search_key_is_valid = search_key_and_validity.second;
-
-        if (search_keys_have_nulls && !search_key_is_valid) {
-          d_bools[row_index]    = false;
-          d_validity[row_index] = false;
-          return;
+       find_first,
+       d_positions,
+       d_has_nulls] __device__(size_type row_index) {
+        d_has_nulls[row_index] = false;
+        d_positions[row_index] = find_first ? absent_first : absent_last;
+
+        auto const search_key_and_validity = search_key_pair_iter[row_index];
+        if (search_keys_have_nulls && !search_key_and_validity.second) { return; }
+        if (d_lists.is_null(row_index)) { return; }
+
+        auto const search_key = search_key_and_validity.first;
+        auto const begin      = offsets[row_index];
+        auto const end        = offsets[row_index + 1];
+        for (auto i = begin; i < end; ++i) {
+          auto const entry = find_first ? i : end - 1 - (i - begin);
+          if (d_child.is_null(entry)) {
+            d_has_nulls[row_index] = true;
+          } else if (cudf::equality_compare(d_child.element<ElementType>(entry), search_key)) {
+            d_positions[row_index] = entry - begin;
+            return;
+          }
         }
+      });
+  }
 
-        auto list = cudf::list_device_view(d_lists, row_index);
-        if (list.is_null()) {
-          d_bools[row_index]    = false;
-          d_validity[row_index] = false;
-          return;
+  /**
+   * @brief Searches every list entry with one thread.
+   *
+   * Each entry is compared with the key of its row, and the first or last matching position of
+   * each row is kept with atomics.
+   */
+  template <typename ElementType, typename SearchKeyPairIter>
+  void search_each_list_entry(column_device_view const& d_lists,
+                              offset_type const* offsets,
+                              size_type num_entries,
+                              column_device_view const& d_child,
+                              SearchKeyPairIter search_key_pair_iter,
+                              bool find_first,
+                              size_type* d_positions,
+                              bool* d_has_nulls,
+                              rmm::cuda_stream_view stream)
+  {
+    auto const num_rows = d_lists.size();
+    thrust::fill_n(rmm::exec_policy(stream),
+                   d_positions,
+                   num_rows,
+                   find_first ? absent_first : absent_last);
+    thrust::fill_n(rmm::exec_policy(stream), d_has_nulls, num_rows, false);
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator(0),
+      num_entries,
+      [d_lists,
+       offsets,
+       d_child,
+       search_key_pair_iter,
+       find_first,
+       d_positions,
+       d_has_nulls] __device__(size_type idx) {
+        auto const entry     = offsets[0] + idx;
+        auto const row_index = static_cast<size_type>(thrust::distance(
+          offsets + 1,
+          thrust::upper_bound(thrust::seq, offsets + 1, offsets + d_lists.size() + 1, entry)));
+
+        auto const search_key_and_validity = search_key_pair_iter[row_index];
+        if (search_keys_have_nulls && !search_key_and_validity.second) { return; }
+        if (d_lists.is_null(row_index)) { return; }
+
+        if (d_child.is_null(entry)) {
+          d_has_nulls[row_index] = true;
+        } else if (cudf::equality_compare(d_child.element<ElementType>(entry),
+                                          search_key_and_validity.first)) {
+          auto const position = entry - offsets[row_index];
+          if (find_first) {
+            atomicMin(&d_positions[row_index], position);
+          } else {
+            atomicMax(&d_positions[row_index], position);
+          }
         }
-
-        auto search_key = search_key_and_validity.first;
-        d_bools[row_index] =
-          thrust::find_if(thrust::seq,
-                          list.pair_rep_begin<ElementType>(),
-                          list.pair_rep_end<ElementType>(),
-                          [search_key] __device__(auto element_and_validity) {
-                            return element_and_validity.second &&
-                                   cudf::equality_compare(element_and_validity.first, search_key);
-                          }) != list.pair_rep_end<ElementType>();
-        d_validity[row_index] =
-          d_bools[row_index] ||
-          thrust::none_of(thrust::seq,
-                          thrust::make_counting_iterator(size_type{0}),
-                          thrust::make_counting_iterator(list.size()),
-                          [&list] __device__(auto const& i) { return list.is_null(i); });
       });
   }
 
@@ -136,6 +210,8 @@ struct lookup_functor {
   std::enable_if_t<is_supported<ElementType>::value, std::unique_ptr<column>> operator()(
     cudf::lists_column_view const& lists,
     SearchKeyType const& search_key,
+    bool find_index,
+    duplicate_find_option find_option,
     rmm::cuda_stream_view stream,
     rmm::mr::device_memory_resource* mr)
   {
@@ -149,9 +225,11 @@ struct lookup_functor {
     CUDF_EXPECTS(search_key.type().id() != type_id::EMPTY, "Type cannot be empty.");
 
     auto constexpr search_key_is_scalar = std::is_same<SearchKeyType, cudf::scalar>::value;
+    auto const result_type              = data_type{find_index ? type_id::INT32 : type_id::BOOL8};
 
+    if (lists.is_empty()) { return make_empty_column(result_type); }
     if (search_keys_have_nulls && search_key_is_scalar) {
-      return make_fixed_width_column(data_type(type_id::BOOL8),
+      return make_fixed_width_column(result_type,
                                      lists.size(),
                                      cudf::create_null_mask(lists.size(), mask_state::ALL_NULL, mr),
                                      lists.size(),
@@ -159,34 +237,77 @@ struct lookup_functor {
                                      mr);
     }
 
-    auto const device_view = column_device_view::create(lists.parent(), stream);
-    auto const d_lists     = lists_column_device_view(*device_view);
-    auto const d_skeys     = get_search_keys_device_iterable_view(search_key, stream);
-
-    auto const lists_column_has_nulls = lists.has_nulls() || lists.child().has_nulls();
-
-    auto result_validity = make_fixed_width_column(
-      data_type{type_id::BOOL8}, lists.size(), cudf::mask_state::UNALLOCATED, stream, mr);
-    auto result_bools = make_fixed_width_column(
-      data_type{type_id::BOOL8}, lists.size(), cudf::mask_state::UNALLOCATED, stream, mr);
-    auto mutable_result_bools =
-      mutable_column_device_view::create(result_bools->mutable_view(), stream);
-    auto mutable_result_validity =
-      mutable_column_device_view::create(result_validity->mutable_view(), stream);
-    auto search_key_iter =
+    auto const d_lists         = column_device_view::create(lists.parent(), stream);
+    auto const d_child         = column_device_view::create(lists.child(), stream);
+    auto const d_skeys         = get_search_keys_device_iterable_view(search_key, stream);
+    auto const search_key_iter =
       cudf::detail::make_pair_rep_iterator<ElementType, search_keys_have_nulls>(*d_skeys);
+    auto const offsets     = lists.offsets_begin();
+    auto const num_entries = lists.get_sliced_child(stream).size();
+    auto const find_first  = find_option == duplicate_find_option::FIND_FIRST;
+
+    rmm::device_uvector<size_type> positions(lists.size(), stream);
+    rmm::device_uvector<bool> has_nulls(lists.size(), stream);
+    if (num_entries / long_list_length >= lists.size()) {
+      search_each_list_entry<ElementType>(*d_lists,
+                                          offsets,
+                                          num_entries,
+                                          *d_child,
+                                          search_key_iter,
+                                          find_first,
+                                          positions.data(),
+                                          has_nulls.data(),
+                                          stream);
+    } else {
+      search_each_list_row<ElementType>(*d_lists,
+                                        offsets,
+                                        *d_child,
+                                        search_key_iter,
+                                        find_first,
+                                        positions.data(),
+                                        has_nulls.data(),
+                                        stream);
+    }
 
-    search_each_list_row<ElementType>(
-      d_lists, search_key_iter, *mutable_result_bools, *mutable_result_validity, stream, mr);
-
-    rmm::device_buffer null_mask;
-    size_type num_nulls;
-
-    std::tie(null_mask, num_nulls) =
-      construct_null_mask(lists, result_validity->view(), stream, mr);
-    result_bools->set_null_mask(std::move(null_mask), num_nulls);
+    auto result = make_fixed_width_column(
+      result_type, lists.size(), cudf::mask_state::UNALLOCATED, stream, mr);
+    auto const d_positions = positions.data();
+    auto const d_has_nulls = has_nulls.data();
+    auto const is_found    = is_found_fn{d_positions};
+    if (find_index) {
+      thrust::transform(rmm::exec_policy(stream),
+                        thrust::make_counting_iterator(0),
+                        thrust::make_counting_iterator(lists.size()),
+                        result->mutable_view().begin<size_type>(),
+                        [is_found, d_positions] __device__(size_type row_index) {
+                          return is_found(row_index) ? d_positions[row_index] : not_found;
+                        });
+    } else {
+      thrust::transform(rmm::exec_policy(stream),
+                        thrust::make_counting_iterator(0),
+                        thrust::make_counting_iterator(lists.size()),
+                        result->mutable_view().begin<bool>(),
+                        is_found);
+    }
 
-    return result_bools;
+    // The result of a row is null if its key or list is null. The contains result is also null
+    // if the list does not contain the key but has null entries.
+    if (search_keys_have_nulls || lists.has_nulls() ||
+        (!find_index && lists.child().has_nulls())) {
+      auto null_mask = cudf::detail::valid_if(
+        thrust::make_counting_iterator(0),
+        thrust::make_counting_iterator(lists.size()),
+        [d_lists = *d_lists, search_key_iter, is_found, d_has_nulls, find_index] __device__(
+          size_type row_index) {
+          if (search_keys_have_nulls && !search_key_iter[row_index].second) { return false; }
+          if (d_lists.is_null(row_index)) { return false; }
+          return find_index || is_found(row_index) || !d_has_nulls[row_index];
+        },
+        stream,
+        mr);
+      result->set_null_mask(std::move(null_mask.first), null_mask.second);
+    }
+    return result;
   }
 };
 
@@ -200,10 +321,22 @@ std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
                                  rmm::mr::device_memory_resource* mr)
 {
   return search_key.is_valid(stream)
-           ? cudf::type_dispatcher(
-               search_key.type(), lookup_functor<false>{}, lists, search_key, stream, mr)
-           : cudf::type_dispatcher(
-               search_key.type(), lookup_functor<true>{}, lists, search_key, stream, mr);
+           ? cudf::type_dispatcher(search_key.type(),
+                                   lookup_functor<false>{},
+                                   lists,
+                                   search_key,
+                                   false,
+                                   duplicate_find_option::FIND_FIRST,
+                                   stream,
+                                   mr)
+           : cudf::type_dispatcher(search_key.type(),
+                                   lookup_functor<true>{},
+                                   lists,
+                                   search_key,
+                                   false,
+                                   duplicate_find_option::FIND_FIRST,
+                                   stream,
+                                   mr);
 }
 
 std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
@@ -214,11 +347,74 @@ std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
   CUDF_EXPECTS(search_keys.size() == lists.size(),
                "Number of search keys must match list column size.");
 
-  return search_keys.has_nulls()
-           ? cudf::type_dispatcher(
-               search_keys.type(), lookup_functor<true>{}, lists, search_keys, stream, mr)
-           : cudf::type_dispatcher(
-               search_keys.type(), lookup_functor<false>{}, lists, search_keys, stream, mr);
+  return search_keys.has_nulls() ? cudf::type_dispatcher(search_keys.type(),
+                                                         lookup_functor<true>{},
+                                                         lists,
+                                                         search_keys,
+                                                         false,
+                                                         duplicate_find_option::FIND_FIRST,
+                                                         stream,
+                                                         mr)
+                                 : cudf::type_dispatcher(search_keys.type(),
+                                                         lookup_functor<false>{},
+                                                         lists,
+                                                         search_keys,
+                                                         false,
+                                                         duplicate_find_option::FIND_FIRST,
+                                                         stream,
+                                                         mr);
+}
+
+std::unique_ptr<column> index_of(cudf::lists_column_view const& lists,
+                                 cudf::scalar const& search_key,
+                                 duplicate_find_option find_option,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  return search_key.is_valid(stream)
+           ? cudf::type_dispatcher(search_key.type(),
+                                   lookup_functor<false>{},
+                                   lists,
+                                   search_key,
+                                   true,
+                                   find_option,
+                                   stream,
+                                   mr)
+           : cudf::type_dispatcher(search_key.type(),
+                                   lookup_functor<true>{},
+                                   lists,
+                                   search_key,
+                                   true,
+                                   find_option,
+                                   stream,
+                                   mr);
+}
+
+std::unique_ptr<column> index_of(cudf::lists_column_view const& lists,
+                                 cudf::column_view const& search_keys,
+                                 duplicate_find_option find_option,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(search_keys.size() == lists.size(),
+               "Number of search keys must match list column size.");
+
+  return search_keys.has_nulls() ? cudf::type_dispatcher(search_keys.type(),
+                                                         lookup_functor<true>{},
+                                                         lists,
+                                                         search_keys,
+                                                         true,
+                                                         find_option,
+                                                         stream,
+                                                         mr)
+                                 : cudf::type_dispatcher(search_keys.type(),
+                                                         lookup_functor<false>{},
+                                                         lists,
+                                                         search_keys,
+                                                         true,
+                                                         find_option,
+                                                         stream,
+                                                         mr);
 }
 
 }  // namespace detail
@@ -239,5 +435,23 @@ std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
   return detail::contains(lists, search_keys, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> index_of(cudf::lists_column_view const& lists,
+                                 cudf::scalar const& search_key,
+                                 duplicate_find_option find_option,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::index_of(lists, search_key, find_option, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> index_of(cudf::lists_column_view const& lists,
+                                 cudf::column_view const& search_keys,
+                                 duplicate_find_option find_option,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::index_of(lists, search_keys, find_option, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace lists
 }  // namespace cudf
@@ -14,19 +14,29 @@
  * limitations under the License.
  */
 
-#include <algorithm>
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/concatenate.cuh>
-#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/table_device_view.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <limits>
 #include <memory>
 
 namespace cudf {
@@ -36,52 +46,74 @@ namespace detail {
 namespace {
 
 /**
- * @brief Merges the offsets child columns of multiple list columns into one.
- *
- * Since offsets are all relative to the start of their respective column,
- * all offsets are shifted to account for the new starting position
+ * @brief Copies the offsets and the null masks of all the input lists columns to the output with
+ * a single pass, shifting the offsets of each input by the position of its first child row in
+ * the concatenated child column.
  *
- * @param[in] columns               Vector of lists columns to concatenate
- * @param[in] total_list_count      Total number of lists contained in the columns
- * @param[in] stream                CUDA stream used for device memory operations
- * and kernel launches.
- * @param[in] mr                    Device memory resource used to allocate the
- * returned column's device memory.
+ * @param input_views Array of the input lists columns
+ * @param input_offsets Prefix sum of the sizes of the input columns
+ * @param child_offsets Prefix sum of the sizes of the sliced children of the input columns
+ * @param num_input_views Number of input columns
+ * @param output_size Number of lists of the output column
+ * @param output_data The `output_size + 1` merged offsets
+ * @param output_mask The output null mask, or null if no input has nulls
+ * @param out_valid_count Number of valid output lists
  */
-std::unique_ptr<column> merge_offsets(host_span<lists_column_view const> columns,
-                                      size_type total_list_count,
-                                      rmm::cuda_stream_view stream,
-                                      rmm::mr::device_memory_resource* mr)
+template <size_type block_size, bool Nullable>
+__global__ void fused_concatenate_list_offsets_kernel(column_device_view const* input_views,
+                                                     size_t const* input_offsets,
+                                                     size_t const* child_offsets,
+                                                     size_type const num_input_views,
+                                                     size_type const output_size,
+                                                     size_type* output_data,
+                                                     bitmask_type* output_mask,
+                                                     size_type* out_valid_count)
 {
-  // outgoing offsets
-  auto merged_offsets = cudf::make_fixed_width_column(
-    data_type{type_id::INT32}, total_list_count + 1, mask_state::UNALLOCATED, stream, mr);
-  mutable_column_device_view d_merged_offsets(*merged_offsets, 0, 0);
-
-  // merge offsets
-  // TODO : this could probably be done as a single gpu operation if done as a kernel.
-  size_type shift = 0;
-  size_type count = 0;
-  std::for_each(columns.begin(), columns.end(), [&](lists_column_view const& c) {
-    if (c.size() > 0) {
-      // handle sliced columns
-      int const local_shift =
-        shift -
-        (c.offset() > 0 ? cudf::detail::get_value<size_type>(c.offsets(), c.offset(), stream) : 0);
-      column_device_view offsets(c.offsets(), nullptr, nullptr);
-      thrust::transform(
-        rmm::exec_policy(stream),
-        offsets.begin<size_type>() + c.offset(),
-        offsets.begin<size_type>() + c.offset() + c.size() + 1,
-        d_merged_offsets.begin<size_type>() + count,
-        [local_shift] __device__(size_type offset) { return offset + local_shift; });
-
-      shift += c.get_sliced_child(stream).size();
-      count += c.size();
+  size_type output_index     = threadIdx.x + blockIdx.x * blockDim.x;
+  size_type warp_valid_count = 0;
+
+  unsigned active_mask;
+  if (Nullable) { active_mask = __ballot_sync(0xFFFF'FFFF, output_index < output_size); }
+  while (output_index < output_size) {
+    // Lookup input index by searching for output index in offsets
+    auto const offset_it =
+      -1 + thrust::upper_bound(
+             thrust::seq, input_offsets, input_offsets + num_input_views, output_index);
+    size_type const partition_index = offset_it - input_offsets;
+
+    auto const offset_index      = output_index - *offset_it;
+    auto const& input_view       = input_views[partition_index];
+    constexpr auto offsets_child = lists_column_view::offsets_column_index;
+    auto const* input_data       = input_view.child(offsets_child).data<size_type>();
+    output_data[output_index] =
+      input_data[offset_index + input_view.offset()]  // handle parent offset
+      - input_data[input_view.offset()]               // subtract first offset if non-zero
+      + child_offsets[partition_index];               // add offset of source child
+
+    if (Nullable) {
+      bool const bit_is_set       = input_view.is_valid(offset_index);
+      bitmask_type const new_word = __ballot_sync(active_mask, bit_is_set);
+
+      // First thread writes bitmask word
+      if (threadIdx.x % cudf::detail::warp_size == 0) {
+        output_mask[word_index(output_index)] = new_word;
+      }
+
+      warp_valid_count += __popc(new_word);
     }
-  });
 
-  return merged_offsets;
+    output_index += blockDim.x * gridDim.x;
+    if (Nullable) { active_mask = __ballot_sync(active_mask, output_index < output_size); }
+  }
+
+  // Fill final offsets index with total size of the child
+  if (output_index == output_size) { output_data[output_size] = child_offsets[num_input_views]; }
+
+  if (Nullable) {
+    using cudf::detail::single_lane_block_sum_reduce;
+    auto block_valid_count = single_lane_block_sum_reduce<block_size, 0>(warp_valid_count);
+    if (threadIdx.x == 0) { atomicAdd(out_valid_count, block_valid_count); }
+  }
 }
 
 }  // namespace
@@ -94,43 +126,93 @@ std::unique_ptr<column> concatenate(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
-  std::vector<lists_column_view> lists_columns;
-  lists_columns.reserve(columns.size());
-  std::transform(
-    columns.begin(), columns.end(), std::back_inserter(lists_columns), [](column_view const& c) {
-      return lists_column_view(c);
-    });
-
-  // concatenate children. also prep data needed for offset merging
+  auto const num_columns = static_cast<size_type>(columns.size());
+
+  // Assemble contiguous array of device views
+  std::unique_ptr<rmm::device_buffer> device_view_owners;
+  column_device_view* d_views;
+  std::tie(device_view_owners, d_views) =
+    contiguous_copy_column_device_views<column_device_view>(columns, stream);
+
+  // Fetch the bounds of the children of all the columns with a single copy to host memory
+  rmm::device_uvector<size_type> d_child_bounds(2 * columns.size(), stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_columns,
+                     [d_views, d_bounds = d_child_bounds.data()] __device__(size_type idx) {
+                       auto const& col = d_views[idx];
+                       // empty columns may not have children
+                       auto const offsets =
+                         col.size() > 0
+                           ? col.child(lists_column_view::offsets_column_index).data<size_type>()
+                           : nullptr;
+                       d_bounds[2 * idx]     = offsets ? offsets[col.offset()] : 0;
+                       d_bounds[2 * idx + 1] = offsets ? offsets[col.offset() + col.size()] : 0;
+                     });
+  auto const child_bounds = cudf::detail::make_std_vector_sync(d_child_bounds, stream);
+
+  // Slice the children and compute the partition offsets of the lists and of the children
+  // Note: Using 64-bit size_t so we can detect overflow of 32-bit size_type
   std::vector<column_view> children;
   children.reserve(columns.size());
-  size_type total_list_count = 0;
-  std::for_each(lists_columns.begin(),
-                lists_columns.end(),
-                [&total_list_count, &children, stream](lists_column_view const& l) {
-                  // count total # of lists
-                  total_list_count += l.size();
-                  children.push_back(l.get_sliced_child(stream));
-                });
-  auto data = cudf::detail::concatenate(children, stream, mr);
+  auto input_offsets = std::vector<size_t>(columns.size() + 1);
+  auto child_offsets = std::vector<size_t>(columns.size() + 1);
+  for (size_type i = 0; i < num_columns; ++i) {
+    auto const& col      = columns[i];
+    auto const begin     = child_bounds[2 * i];
+    auto const end       = child_bounds[2 * i + 1];
+    input_offsets[i + 1] = input_offsets[i] + col.size();
+    child_offsets[i + 1] = child_offsets[i] + (end - begin);
+    if (col.size() > 0) {
+      auto const child = col.child(lists_column_view::child_column_index);
+      children.push_back(cudf::detail::slice(child, begin, end));
+    }
+  }
+  auto const total_list_count = static_cast<size_type>(input_offsets.back());
+  CUDF_EXPECTS(child_offsets.back() <= static_cast<size_t>(std::numeric_limits<size_type>::max()),
+               "Total number of concatenated list elements exceeds size_type range");
 
-  // merge offsets
-  auto offsets = merge_offsets(lists_columns, total_list_count, stream, mr);
+  // concatenate children
+  auto data = cudf::detail::concatenate(children, stream, mr);
 
   // if any of the input columns have nulls, construct the output mask
   bool const has_nulls =
     std::any_of(columns.begin(), columns.end(), [](auto const& col) { return col.has_nulls(); });
-  rmm::device_buffer null_mask = create_null_mask(
-    total_list_count, has_nulls ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED);
+  rmm::device_buffer null_mask{0, stream, mr};
   if (has_nulls) {
-    cudf::detail::concatenate_masks(columns, static_cast<bitmask_type*>(null_mask.data()), stream);
+    null_mask =
+      cudf::detail::create_null_mask(total_list_count, mask_state::UNINITIALIZED, stream, mr);
   }
 
+  // merge offsets and null masks with a single kernel launch
+  auto offsets = make_numeric_column(
+    data_type{type_id::INT32}, total_list_count + 1, mask_state::UNALLOCATED, stream, mr);
+  auto const d_input_offsets = cudf::detail::make_device_uvector_async(input_offsets, stream);
+  auto const d_child_offsets = cudf::detail::make_device_uvector_async(child_offsets, stream);
+  rmm::device_scalar<size_type> d_valid_count(0, stream);
+
+  constexpr size_type block_size{256};
+  cudf::detail::grid_1d config(total_list_count + 1, block_size);
+  auto const kernel = has_nulls ? fused_concatenate_list_offsets_kernel<block_size, true>
+                                : fused_concatenate_list_offsets_kernel<block_size, false>;
+  kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+    d_views,
+    d_input_offsets.data(),
+    d_child_offsets.data(),
+    num_columns,
+    total_list_count,
+    offsets->mutable_view().data<size_type>(),
+    static_cast<bitmask_type*>(null_mask.data()),
+    d_valid_count.data());
+  CHECK_CUDA(stream.value());
+
+  auto const null_count = has_nulls ? total_list_count - d_valid_count.value(stream) : 0;
+
   // assemble into outgoing list column
   return make_lists_column(total_list_count,
                            std::move(offsets),
                            std::move(data),
-                           has_nulls ? UNKNOWN_NULL_COUNT : 0,
+                           null_count,
                            std::move(null_mask),
                            stream,
                            mr);
@@ -14,12 +14,17 @@
  * limitations under the License.
  */
 
+#include <hash/concurrent_unordered_map.cuh>
+#include <hash/helper_functions.cuh>
+
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/lists/detail/drop_list_duplicates.hpp>
 #include <cudf/lists/detail/sorting.hpp>
 #include <cudf/lists/drop_list_duplicates.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -29,108 +34,17 @@
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
 #include <thrust/transform.h>
 
+#include <limits>
+
 namespace cudf {
 namespace lists {
 namespace detail {
 namespace {
-template <typename Type>
-struct has_negative_nans {
-  column_device_view const d_entries;
-  bool const has_nulls;
-
-  __device__ Type operator()(size_type idx) const noexcept
-  {
-    if (has_nulls && d_entries.is_null_nocheck(idx)) { return false; }
-
-    auto const val = d_entries.element<Type>(idx);
-    return std::isnan(val) && std::signbit(val);  // std::signbit(x) == true if x is negative
-  }
-};
-
-/**
- * @brief A structure to be used along with type_dispatcher to check if a
- * `column_view` has any negative NaN entry
- */
-struct has_negative_nans_fn {
-  template <typename Type, std::enable_if_t<cuda::std::is_floating_point_v<Type>>* = nullptr>
-  bool operator()(column_view const& lists_entries, rmm::cuda_stream_view stream) const noexcept
-  {
-    auto const d_entries = column_device_view::create(lists_entries, stream);
-    return thrust::count_if(rmm::exec_policy(stream),
-                            thrust::make_counting_iterator(0),
-                            thrust::make_counting_iterator(lists_entries.size()),
-                            detail::has_negative_nans<Type>{*d_entries, lists_entries.has_nulls()});
-  }
-
-  template <typename Type, std::enable_if_t<not cuda::std::is_floating_point_v<Type>>* = nullptr>
-  bool operator()(column_view const&, rmm::cuda_stream_view) const noexcept
-  {
-    // Columns of non floating-point data will never contain NaN
-    return false;
-  }
-};
-
-template <typename Type>
-struct replace_negative_nans {
-  __device__ Type operator()(Type val) const noexcept
-  {
-    return std::isnan(val) ? std::numeric_limits<Type>::quiet_NaN() : val;
-  }
-};
-
-/**
- * @brief A structure to be used along with type_dispatcher to replace -NaN by NaN for all entries
- * of a floating-point data column
- */
-struct replace_negative_nans_fn {
-  template <typename Type, std::enable_if_t<not cuda::std::is_floating_point_v<Type>>* = nullptr>
-  void operator()(column_view const&, mutable_column_view const&, rmm::cuda_stream_view) const
-  {
-    CUDF_FAIL("Cannot operate on a type that is not floating-point.");
-  }
-
-  template <typename Type, std::enable_if_t<cuda::std::is_floating_point_v<Type>>* = nullptr>
-  void operator()(column_view const& lists_entries,
-                  mutable_column_view const& new_entries,
-                  rmm::cuda_stream_view stream) const noexcept
-  {
-    // Do not care whether an entry is null or not, just consider it as a floating-point value
-    thrust::transform(rmm::exec_policy(stream),
-                      lists_entries.begin<Type>(),
-                      lists_entries.end<Type>(),
-                      new_entries.begin<Type>(),
-                      detail::replace_negative_nans<Type>{});
-  }
-};
-
-/**
- * @brief Transform a given lists column to a new lists column in which all the list entries holding
- * -NaN value are replaced by (positive) NaN
- */
-std::unique_ptr<column> replace_negative_nans_entries(column_view const& lists_entries,
-                                                      lists_column_view const& lists_column,
-                                                      rmm::cuda_stream_view stream)
-{
-  auto new_offsets = std::make_unique<column>(lists_column.offsets());
-  auto new_entries = std::make_unique<column>(lists_entries);
-
-  type_dispatcher(lists_entries.type(),
-                  detail::replace_negative_nans_fn{},
-                  lists_entries,
-                  new_entries->mutable_view(),
-                  stream);
-
-  return make_lists_column(
-    lists_column.size(),
-    std::move(new_offsets),
-    std::move(new_entries),
-    lists_column.null_count(),
-    cudf::detail::copy_bitmask(
-      lists_column.parent(), stream, rmm::mr::get_current_device_resource()));
-}
-
 /**
  * @brief Generate a 0-based offset column for a lists column
  *
@@ -286,6 +200,107 @@ class list_entry_comparator {
   bool has_nulls;
 };
 
+
+/**
+ * @brief Computes the hash value of an entry in a lists column, combined with the hash value of
+ * the list containing it so that equal entries of different lists rarely collide
+ *
+ * Floating-point zeros and NaNs are normalized by the hash function so that the entries considered
+ * equal by `list_entry_comparator` hash equally.
+ *
+ * @tparam Type The data type of entries
+ */
+template <class Type>
+struct list_entry_hasher {
+  offset_type const* list_offsets;
+  column_device_view d_view;
+  bool has_nulls;
+
+  __device__ hash_value_type operator()(size_type i) const noexcept
+  {
+    auto const list_hash  = cudf::detail::MurmurHash3_32<offset_type>{}(list_offsets[i]);
+    auto const entry_hash = has_nulls and d_view.is_null_nocheck(i)
+                              ? std::numeric_limits<hash_value_type>::max()
+                              : cudf::detail::MurmurHash3_32<Type>{}(d_view.element<Type>(i));
+    return cudf::detail::MurmurHash3_32<Type>{}.hash_combine(list_hash, entry_hash);
+  }
+};
+
+/**
+ * @brief Inserts each entry into the set of unique list entries, and stores the entry of the set
+ * that it duplicates, or itself if it was inserted.
+ */
+template <typename Map>
+struct insert_entry_fn {
+  Map map;
+  size_type* representatives;
+
+  __device__ void operator()(size_type i)
+  {
+    representatives[i] = map.insert(thrust::make_pair(i, i)).first->second;
+  }
+};
+
+/**
+ * @brief Copy the indices of the first occurrence of each unique entry within its list, in
+ * increasing order
+ *
+ * All entries are inserted into one open-addressing hash set keyed by the pair of the list
+ * containing the entry and the entry value, so no list needs to be sorted. The first occurrence of
+ * each set of duplicates is then found with atomics, since the entry inserted into the set may be
+ * any of them.
+ *
+ * @return The end of the output indices
+ */
+template <class Type, bool nans_equal>
+offset_type* copy_unique_entries(offset_type const* list_offsets,
+                                 column_device_view const& d_view,
+                                 size_type num_entries,
+                                 offset_type* output_begin,
+                                 null_equality nulls_equal,
+                                 bool has_nulls,
+                                 rmm::cuda_stream_view stream)
+{
+  size_type constexpr unused_key{std::numeric_limits<size_type>::max()};
+  using hasher_type     = list_entry_hasher<Type>;
+  using comparator_type = list_entry_comparator<Type, nans_equal>;
+  using map_type = concurrent_unordered_map<size_type, size_type, hasher_type, comparator_type>;
+
+  auto const map = map_type::create(compute_hash_table_size(num_entries),
+                                    stream,
+                                    unused_key,
+                                    unused_key,
+                                    hasher_type{list_offsets, d_view, has_nulls},
+                                    comparator_type{list_offsets, d_view, nulls_equal, has_nulls},
+                                    typename map_type::allocator_type());
+
+  rmm::device_uvector<size_type> representatives(num_entries, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator(0),
+                     num_entries,
+                     insert_entry_fn<map_type>{*map, representatives.data()});
+
+  // The first occurrence of the duplicates of each representative entry
+  rmm::device_uvector<size_type> first_entries(num_entries, stream);
+  thrust::fill(rmm::exec_policy(stream), first_entries.begin(), first_entries.end(), num_entries);
+  auto const d_representatives = representatives.data();
+  auto const d_first_entries   = first_entries.data();
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator(0),
+                     num_entries,
+                     [d_representatives, d_first_entries] __device__(size_type i) {
+                       atomicMin(&d_first_entries[d_representatives[i]], i);
+                     });
+
+  return thrust::copy_if(rmm::exec_policy(stream),
+                         thrust::make_counting_iterator(0),
+                         thrust::make_counting_iterator(num_entries),
+                         output_begin,
+                         [d_representatives, d_first_entries] __device__(size_type i) {
+                           return d_first_entries[d_representatives[i]] == i;
+                         });
+}
+
 /**
  *  @brief Construct type-dispatched function object for copying indices of the list entries
  * ignoring duplicates
@@ -312,23 +327,13 @@ struct get_unique_entries_fn {
                           null_equality nulls_equal,
                           nan_equality nans_equal,
                           bool has_nulls,
-                          rmm::cuda_stream_view stream) const noexcept
+                          rmm::cuda_stream_view stream) const
   {
-    if (nans_equal == nan_equality::ALL_EQUAL) {
-      list_entry_comparator<Type, true> const comp{list_offsets, d_view, nulls_equal, has_nulls};
-      return thrust::unique_copy(rmm::exec_policy(stream),
-                                 thrust::make_counting_iterator(0),
-                                 thrust::make_counting_iterator(num_entries),
-                                 output_begin,
-                                 comp);
-    } else {
-      list_entry_comparator<Type, false> const comp{list_offsets, d_view, nulls_equal, has_nulls};
-      return thrust::unique_copy(rmm::exec_policy(stream),
-                                 thrust::make_counting_iterator(0),
-                                 thrust::make_counting_iterator(num_entries),
-                                 output_begin,
-                                 comp);
-    }
+    return nans_equal == nan_equality::ALL_EQUAL
+             ? copy_unique_entries<Type, true>(
+                 list_offsets, d_view, num_entries, output_begin, nulls_equal, has_nulls, stream)
+             : copy_unique_entries<Type, false>(
+                 list_offsets, d_view, num_entries, output_begin, nulls_equal, has_nulls, stream);
   }
 };
 
@@ -451,15 +456,15 @@ void generate_offsets(size_type num_entries,
 }  // anonymous namespace
 
 /**
- * @copydoc cudf::lists::drop_list_duplicates
+ * @copydoc cudf::lists::distinct
  *
  * @param stream CUDA stream used for device memory operations and kernel launches
  */
-std::unique_ptr<column> drop_list_duplicates(lists_column_view const& lists_column,
-                                             null_equality nulls_equal,
-                                             nan_equality nans_equal,
-                                             rmm::cuda_stream_view stream,
-                                             rmm::mr::device_memory_resource* mr)
+std::unique_ptr<column> distinct(lists_column_view const& lists_column,
+                                 null_equality nulls_equal,
+                                 nan_equality nans_equal,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
 {
   if (lists_column.is_empty()) return cudf::empty_like(lists_column.parent());
   if (cudf::is_nested(lists_column.child().type())) {
@@ -469,37 +474,16 @@ std::unique_ptr<column> drop_list_duplicates(lists_column_view const& lists_colu
   // Flatten all entries (depth = 1) of the lists column
   auto const lists_entries = lists_column.get_sliced_child(stream);
 
-  // sorted_lists will store the results of the original lists after calling segmented_sort
-  auto const sorted_lists = [&]() {
-    // If nans_equal == ALL_EQUAL and the column contains lists of floating-point data type,
-    // we need to replace -NaN by NaN before sorting
-    auto const replace_negative_nan =
-      nans_equal == nan_equality::ALL_EQUAL and
-      type_dispatcher(lists_entries.type(), detail::has_negative_nans_fn{}, lists_entries, stream);
-    if (replace_negative_nan) {
-      // The column new_lists_column is temporary, thus we will not pass in `mr`
-      auto const new_lists_column =
-        detail::replace_negative_nans_entries(lists_entries, lists_column, stream);
-      return detail::sort_lists(
-        lists_column_view(new_lists_column->view()), order::ASCENDING, null_order::AFTER, stream);
-    } else {
-      return detail::sort_lists(lists_column, order::ASCENDING, null_order::AFTER, stream);
-    }
-  }();
-
-  auto const sorted_lists_entries =
-    lists_column_view(sorted_lists->view()).get_sliced_child(stream);
-
   // Generate a 0-based offset column
   auto lists_offsets = detail::generate_clean_offsets(lists_column, stream, mr);
 
   // Generate a mapping from list entries to offsets of the lists containing those entries
   auto const entries_list_offsets =
-    detail::generate_entry_list_offsets(sorted_lists_entries.size(), lists_offsets->view(), stream);
+    detail::generate_entry_list_offsets(lists_entries.size(), lists_offsets->view(), stream);
 
   // Copy non-duplicated entries (along with their list offsets) to new arrays
   auto unique_entries_and_list_offsets = detail::get_unique_entries_and_list_offsets(
-    sorted_lists_entries, entries_list_offsets->view(), nulls_equal, nans_equal, stream, mr);
+    lists_entries, entries_list_offsets->view(), nulls_equal, nans_equal, stream, mr);
 
   // Generate offsets for the new lists column
   detail::generate_offsets(unique_entries_and_list_offsets.front()->size(),
@@ -519,6 +503,24 @@ std::unique_ptr<column> drop_list_duplicates(lists_column_view const& lists_colu
                            cudf::detail::copy_bitmask(lists_column.parent(), stream, mr));
 }
 
+/**
+ * @copydoc cudf::lists::drop_list_duplicates
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::unique_ptr<column> drop_list_duplicates(lists_column_view const& lists_column,
+                                             null_equality nulls_equal,
+                                             nan_equality nans_equal,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  // Only the unique entries are sorted, and since NaNs are unique within each list when
+  // nans_equal == ALL_EQUAL, -NaN need not be replaced by NaN before sorting
+  auto const unique_lists = detail::distinct(lists_column, nulls_equal, nans_equal, stream);
+  return detail::sort_lists(
+    lists_column_view(unique_lists->view()), order::ASCENDING, null_order::AFTER, stream, mr);
+}
+
 }  // namespace detail
 
 /**
@@ -534,5 +536,17 @@ std::unique_ptr<column> drop_list_duplicates(lists_column_view const& lists_colu
     lists_column, nulls_equal, nans_equal, rmm::cuda_stream_default, mr);
 }
 
+/**
+ * @copydoc cudf::lists::distinct
+ */
+std::unique_ptr<column> distinct(lists_column_view const& lists_column,
+                                 null_equality nulls_equal,
+                                 nan_equality nans_equal,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::distinct(lists_column, nulls_equal, nans_equal, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace lists
 }  // namespace cudf
@@ -100,16 +100,19 @@ std::unique_ptr<table> build_table(
 
   return std::make_unique<table>(std::move(columns));
 }
-}  // namespace
 
-std::unique_ptr<table> explode(table_view const& input_table,
-                               size_type const explode_column_idx,
-                               rmm::cuda_stream_view stream,
-                               rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Returns the index of the list containing each entry of the sliced child of
+ * `explode_col`, and writes the position of each entry within its list to `position` if it is
+ * not null.
+ */
+rmm::device_uvector<size_type> generate_gather_map(lists_column_view const& explode_col,
+                                                   size_type num_entries,
+                                                   size_type* position,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
 {
-  lists_column_view explode_col{input_table.column(explode_column_idx)};
-  auto sliced_child = explode_col.get_sliced_child(stream);
-  rmm::device_uvector<size_type> gather_map(sliced_child.size(), stream);
+  rmm::device_uvector<size_type> gather_map(num_entries, stream, mr);
 
   // Sliced columns may require rebasing of the offsets.
   auto offsets = explode_col.offsets_begin();
@@ -121,12 +124,44 @@ std::unique_ptr<table> explode(table_view const& input_table,
   // This looks like an off-by-one bug, but what is going on here is that we need to reduce each
   // result from `lower_bound` by 1 to build the correct gather map. This can be accomplished by
   // skipping the first entry and using the result of `lower_bound` directly.
-  thrust::lower_bound(rmm::exec_policy(stream),
-                      offsets_minus_one,
-                      offsets_minus_one + explode_col.size(),
-                      counting_iter,
-                      counting_iter + gather_map.size(),
-                      gather_map.begin());
+  if (position == nullptr) {
+    thrust::lower_bound(rmm::exec_policy(stream),
+                        offsets_minus_one,
+                        offsets_minus_one + explode_col.size(),
+                        counting_iter,
+                        counting_iter + gather_map.size(),
+                        gather_map.begin());
+    return gather_map;
+  }
+
+  thrust::transform(
+    rmm::exec_policy(stream),
+    counting_iter,
+    counting_iter + gather_map.size(),
+    gather_map.begin(),
+    [position_array = position,
+     offsets_minus_one,
+     offsets,
+     offset_size = explode_col.size()] __device__(auto idx) -> size_type {
+      auto lb_idx = thrust::distance(
+        offsets_minus_one,
+        thrust::lower_bound(thrust::seq, offsets_minus_one, offsets_minus_one + offset_size, idx));
+      position_array[idx] = idx - (offsets[lb_idx] - offsets[0]);
+      return lb_idx;
+    });
+  return gather_map;
+}
+}  // namespace
+
+std::unique_ptr<table> explode(table_view const& input_table,
+                               size_type const explode_column_idx,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  lists_column_view explode_col{input_table.column(explode_column_idx)};
+  auto sliced_child     = explode_col.get_sliced_child(stream);
+  auto const gather_map = generate_gather_map(
+    explode_col, sliced_child.size(), nullptr, stream, rmm::mr::get_current_device_resource());
 
   return build_table(input_table,
                      explode_column_idx,
@@ -145,35 +180,9 @@ std::unique_ptr<table> explode_position(table_view const& input_table,
 {
   lists_column_view explode_col{input_table.column(explode_column_idx)};
   auto sliced_child = explode_col.get_sliced_child(stream);
-  rmm::device_uvector<size_type> gather_map(sliced_child.size(), stream);
-
-  // Sliced columns may require rebasing of the offsets.
-  auto offsets = explode_col.offsets_begin();
-  // offsets + 1 here to skip the 0th offset, which removes a - 1 operation later.
-  auto offsets_minus_one = thrust::make_transform_iterator(
-    offsets + 1, [offsets] __device__(auto i) { return (i - offsets[0]) - 1; });
-  auto counting_iter = thrust::make_counting_iterator(0);
-
   rmm::device_uvector<size_type> pos(sliced_child.size(), stream, mr);
-
-  // This looks like an off-by-one bug, but what is going on here is that we need to reduce each
-  // result from `lower_bound` by 1 to build the correct gather map. This can be accomplished by
-  // skipping the first entry and using the result of `lower_bound` directly.
-  thrust::transform(
-    rmm::exec_policy(stream),
-    counting_iter,
-    counting_iter + gather_map.size(),
-    gather_map.begin(),
-    [position_array = pos.data(),
-     offsets_minus_one,
-     offsets,
-     offset_size = explode_col.size()] __device__(auto idx) -> size_type {
-      auto lb_idx = thrust::distance(
-        offsets_minus_one,
-        thrust::lower_bound(thrust::seq, offsets_minus_one, offsets_minus_one + offset_size, idx));
-      position_array[idx] = idx - (offsets[lb_idx] - offsets[0]);
-      return lb_idx;
-    });
+  auto const gather_map = generate_gather_map(
+    explode_col, sliced_child.size(), pos.data(), stream, rmm::mr::get_current_device_resource());
 
   return build_table(input_table,
                      explode_column_idx,
@@ -185,6 +194,30 @@ std::unique_ptr<table> explode_position(table_view const& input_table,
                      mr);
 }
 
+std::unique_ptr<table> explode_gather_map(column_view const& explode_column,
+                                          bool include_position,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  lists_column_view explode_col{explode_column};
+  auto sliced_child      = explode_col.get_sliced_child(stream);
+  auto const num_entries = sliced_child.size();
+
+  rmm::device_uvector<size_type> pos(include_position ? num_entries : 0, stream, mr);
+  auto gather_map = generate_gather_map(
+    explode_col, num_entries, include_position ? pos.data() : nullptr, stream, mr);
+
+  std::vector<std::unique_ptr<column>> columns;
+  columns.push_back(std::make_unique<column>(
+    data_type(type_to_id<size_type>()), num_entries, gather_map.release()));
+  if (include_position) {
+    columns.push_back(
+      std::make_unique<column>(data_type(type_to_id<size_type>()), num_entries, pos.release()));
+  }
+  columns.push_back(std::make_unique<column>(sliced_child, stream, mr));
+  return std::make_unique<table>(std::move(columns));
+}
+
 std::unique_ptr<table> explode_outer(table_view const& input_table,
                                      size_type const explode_column_idx,
                                      bool include_position,
@@ -308,6 +341,19 @@ std::unique_ptr<table> explode_position(table_view const& input_table,
   return detail::explode_position(input_table, explode_column_idx, rmm::cuda_stream_default, mr);
 }
 
+/**
+ * @copydoc
+ * cudf::explode_gather_map(explode_column,include_position,rmm::mr::device_memory_resource)
+ */
+std::unique_ptr<table> explode_gather_map(column_view const& explode_column,
+                                          bool include_position,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(explode_column.type().id() == type_id::LIST, "Unsupported non-list column");
+  return detail::explode_gather_map(explode_column, include_position, rmm::cuda_stream_default, mr);
+}
+
 /**
  * @copydoc cudf::explode_outer(input_table,explode_column_idx,rmm::mr::device_memory_resource)
  */
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction_functions.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/lists/reduction.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+namespace cudf {
+namespace lists {
+namespace detail {
+
+/**
+ * @copydoc cudf::lists::reduce
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> reduce(lists_column_view const& input,
+                               std::unique_ptr<aggregation> const& agg,
+                               data_type output_dtype,
+                               null_policy null_handling,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  if (input.is_empty()) { return make_empty_column(output_dtype); }
+
+  // The offsets of a sliced lists column index into its whole child column
+  auto const offsets = device_span<size_type const>(input.offsets_begin(), input.size() + 1);
+  auto result        = cudf::detail::segmented_reduce(
+    input.child(), offsets, agg, output_dtype, null_handling, stream, mr);
+
+  // A null list may still have entries, so its reduction is made null here
+  if (input.has_nulls()) {
+    auto const d_input  = column_device_view::create(input.parent(), stream);
+    auto const d_result = column_device_view::create(result->view(), stream);
+    auto null_mask      = cudf::detail::valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(input.size()),
+      [d_input = *d_input, d_result = *d_result] __device__(size_type row) {
+        return d_input.is_valid(row) and d_result.is_valid(row);
+      },
+      stream,
+      mr);
+    result->set_null_mask(std::move(null_mask.first), null_mask.second);
+  }
+  return result;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> reduce(lists_column_view const& input,
+                               std::unique_ptr<aggregation> const& agg,
+                               data_type output_dtype,
+                               null_policy null_handling,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce(input, agg, output_dtype, null_handling, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace lists
+}  // namespace cudf
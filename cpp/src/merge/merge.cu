@@ -13,31 +13,40 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/merge.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/string_prefixes.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/dictionary/detail/merge.hpp>
 #include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/strings/detail/merge.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/merge.h>
 #include <thrust/pair.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
 
-#include <queue>
+#include <algorithm>
 #include <vector>
-#include "cudf/utilities/traits.hpp"
 
 namespace cudf {
 namespace detail {
@@ -151,29 +160,14 @@ struct side_index_generator {
   __device__ index_type operator()(size_type i) const noexcept { return index_type{_side, i}; }
 };
 
-/**
- * @brief Generates the row indices and source side (left or right) in accordance with the index
- * columns.
- *
- *
- * @tparam index_type Indicates the type to be used to collect index and side information;
- * @param[in] left_table The left table_view to be merged
- * @param[in] right_table The right table_view to be merged
- * @param[in] column_order Sort order types of index columns
- * @param[in] null_precedence Array indicating the order of nulls with respect to non-nulls for the
- * index columns
- * @param[in] nullable Flag indicating if at least one of the table_view arguments has nulls
- * (defaults to true)
- * @param[in] stream CUDA stream used for device memory operations and kernel launches.
- *
- * @return A device_uvector of merged indices
- */
+}  // namespace
+
 index_vector generate_merged_indices(table_view const& left_table,
                                      table_view const& right_table,
                                      std::vector<order> const& column_order,
                                      std::vector<null_order> const& null_precedence,
-                                     bool nullable                = true,
-                                     rmm::cuda_stream_view stream = rmm::cuda_stream_default)
+                                     bool nullable,
+                                     rmm::cuda_stream_view stream)
 {
   const size_type left_size  = left_table.num_rows();
   const size_type right_size = right_table.num_rows();
@@ -191,11 +185,19 @@ index_vector generate_merged_indices(table_view const& left_table,
 
   auto d_column_order = cudf::detail::make_device_uvector_async(column_order, stream);
 
+  // strings are compared by their cached prefixes before their characters
+  auto const left_prefixes  = detail::table_string_prefixes(left_table, stream);
+  auto const right_prefixes = detail::table_string_prefixes(right_table, stream);
+
   if (nullable) {
     auto d_null_precedence = cudf::detail::make_device_uvector_async(null_precedence, stream);
 
-    auto ineq_op = detail::row_lexicographic_tagged_comparator<true>(
-      *lhs_device_view, *rhs_device_view, d_column_order.data(), d_null_precedence.data());
+    auto ineq_op = detail::row_lexicographic_tagged_comparator<true>(*lhs_device_view,
+                                                                     *rhs_device_view,
+                                                                     d_column_order.data(),
+                                                                     d_null_precedence.data(),
+                                                                     left_prefixes.data(),
+                                                                     right_prefixes.data());
     thrust::merge(rmm::exec_policy(stream),
                   left_begin,
                   left_begin + left_size,
@@ -204,8 +206,12 @@ index_vector generate_merged_indices(table_view const& left_table,
                   merged_indices.begin(),
                   ineq_op);
   } else {
-    auto ineq_op = detail::row_lexicographic_tagged_comparator<false>(
-      *lhs_device_view, *rhs_device_view, d_column_order.data());
+    auto ineq_op = detail::row_lexicographic_tagged_comparator<false>(*lhs_device_view,
+                                                                      *rhs_device_view,
+                                                                      d_column_order.data(),
+                                                                      nullptr,
+                                                                      left_prefixes.data(),
+                                                                      right_prefixes.data());
     thrust::merge(rmm::exec_policy(stream),
                   left_begin,
                   left_begin + left_size,
@@ -220,8 +226,6 @@ index_vector generate_merged_indices(table_view const& left_table,
   return merged_indices;
 }
 
-}  // namespace
-
 /**
  * @brief Generate merged column given row-order of merged tables
  *  (ordered according to indices of key_cols) and the 2 columns to merge.
@@ -370,7 +374,7 @@ table_ptr_type merge(cudf::table_view const& left_table,
   // extract merged row order according to indices:
   //
   auto const merged_indices = generate_merged_indices(
-    index_left_view, index_right_view, column_order, null_precedence, nullable);
+    index_left_view, index_right_view, column_order, null_precedence, nullable, stream);
 
   // create merged table:
   //
@@ -391,28 +395,200 @@ table_ptr_type merge(cudf::table_view const& left_table,
   return std::make_unique<cudf::table>(std::move(merged_cols));
 }
 
-struct merge_queue_item {
-  table_view view;
-  table_ptr_type table;
-  // Priority is a separate member to ensure that moving from an object
-  // does not change its priority (which would ruin the queue invariant)
-  cudf::size_type priority = 0;
+/**
+ * @brief Returns the merged order of the rows of sorted runs, as indices into the concatenation
+ * `keys` of their key columns, where the rows of run `i` are `[run_offsets[i], run_offsets[i+1])`.
+ *
+ * The runs are merged pairwise with their neighbors, so that equivalent rows keep the order of
+ * their runs. Each of the log2(number of runs) passes moves only the indices: the keys are
+ * compared in place and the other columns are not read.
+ */
+template <bool has_nulls>
+rmm::device_uvector<size_type> generate_k_way_merged_indices(
+  table_view const& keys,
+  std::vector<size_type> run_offsets,
+  std::vector<cudf::order> const& column_order,
+  std::vector<cudf::null_order> const& null_precedence,
+  rmm::cuda_stream_view stream)
+{
+  auto const d_keys            = table_device_view::create(keys, stream);
+  auto const d_column_order    = make_device_uvector_async(column_order, stream);
+  auto const d_null_precedence = make_device_uvector_async(null_precedence, stream);
+  auto const prefixes          = detail::table_string_prefixes(keys, stream);
+  auto const comparator        = row_lexicographic_comparator<has_nulls>(
+    *d_keys,
+    *d_keys,
+    d_column_order.data(),
+    null_precedence.empty() ? nullptr : d_null_precedence.data(),
+    prefixes.data(),
+    prefixes.data());
+
+  rmm::device_uvector<size_type> indices(keys.num_rows(), stream);
+  rmm::device_uvector<size_type> merged(keys.num_rows(), stream);
+  thrust::sequence(rmm::exec_policy(stream), indices.begin(), indices.end());
+
+  while (run_offsets.size() > 2) {
+    auto const num_runs = run_offsets.size() - 1;
+    std::vector<size_type> merged_offsets;
+    for (std::size_t run = 0; run < num_runs; run += 2) {
+      auto const begin = run_offsets[run];
+      auto const mid   = run_offsets[run + 1];
+      merged_offsets.push_back(begin);
+      if (run + 1 == num_runs) {
+        // the last run of an odd number of runs is merged in the next pass
+        thrust::copy(rmm::exec_policy(stream),
+                     indices.begin() + begin,
+                     indices.begin() + mid,
+                     merged.begin() + begin);
+        continue;
+      }
+      auto const end = run_offsets[run + 2];
+      thrust::merge(rmm::exec_policy(stream),
+                    indices.begin() + begin,
+                    indices.begin() + mid,
+                    indices.begin() + mid,
+                    indices.begin() + end,
+                    merged.begin() + begin,
+                    comparator);
+    }
+    merged_offsets.push_back(run_offsets.back());
+    std::swap(indices, merged);
+    run_offsets = std::move(merged_offsets);
+  }
+  return indices;
+}
+
+/**
+ * @brief Finds the run, and the row within the run, of an index into the concatenated runs.
+ */
+struct run_locator {
+  size_type const* offsets;
+  size_type num_runs;
+
+  __device__ thrust::pair<size_type, size_type> operator()(size_type index) const
+  {
+    auto const run = static_cast<size_type>(
+      thrust::upper_bound(thrust::seq, offsets, offsets + num_runs + 1, index) - offsets - 1);
+    return {run, index - offsets[run]};
+  }
+};
 
-  merge_queue_item(table_view const& view, table_ptr_type&& table)
-    : view{view}, table{std::move(table)}, priority{-view.num_rows()}
+/**
+ * @brief Generates a merged column from the columns of the runs and their merged order.
+ *
+ * Fixed-width rows are read from the runs directly, so that each output row is written once.
+ * Other columns are concatenated and then gathered.
+ */
+struct k_way_column_merger {
+  template <typename Element, CUDF_ENABLE_IF(not is_rep_layout_compatible<Element>())>
+  std::unique_ptr<column> operator()(std::vector<column_view> const& columns,
+                                     std::vector<size_type> const&,
+                                     column_view const& merged_indices,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr) const
   {
+    auto const concatenated = detail::concatenate(columns, stream);
+    auto gathered           = detail::gather(table_view{{concatenated->view()}},
+                                   merged_indices,
+                                   out_of_bounds_policy::DONT_CHECK,
+                                   negative_index_policy::NOT_ALLOWED,
+                                   stream,
+                                   mr);
+    return std::move(gathered->release().front());
   }
 
-  bool operator<(merge_queue_item const& other) const { return priority < other.priority; }
+  template <typename Element, CUDF_ENABLE_IF(is_rep_layout_compatible<Element>())>
+  std::unique_ptr<column> operator()(std::vector<column_view> const& columns,
+                                     std::vector<size_type> const& run_offsets,
+                                     column_view const& merged_indices,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr) const
+  {
+    std::vector<decltype(column_device_view::create(columns.front(), stream))> view_owners;
+    std::vector<column_device_view> views;
+    for (auto const& col : columns) {
+      view_owners.push_back(column_device_view::create(col, stream));
+      views.push_back(*view_owners.back());
+    }
+    auto const d_views       = make_device_uvector_async(views, stream);
+    auto const d_run_offsets = make_device_uvector_async(run_offsets, stream);
+
+    auto const locate = run_locator{d_run_offsets.data(), static_cast<size_type>(columns.size())};
+
+    auto const num_rows = merged_indices.size();
+    auto merged_col     = make_fixed_width_column(
+      columns.front().type(), num_rows, mask_state::UNALLOCATED, stream, mr);
+    thrust::transform(rmm::exec_policy(stream),
+                      merged_indices.begin<size_type>(),
+                      merged_indices.end<size_type>(),
+                      merged_col->mutable_view().begin<Element>(),
+                      [views = d_views.data(), locate] __device__(size_type index) {
+                        auto const location = locate(index);
+                        return views[location.first].element<Element>(location.second);
+                      });
+
+    if (std::any_of(columns.begin(), columns.end(), [](auto const& col) {
+          return col.has_nulls();
+        })) {
+      auto mask = valid_if(
+        merged_indices.begin<size_type>(),
+        merged_indices.end<size_type>(),
+        [views = d_views.data(), locate] __device__(size_type index) {
+          auto const location = locate(index);
+          return views[location.first].is_valid(location.second);
+        },
+        stream,
+        mr);
+      merged_col->set_null_mask(std::move(mask.first), mask.second);
+    }
+    return merged_col;
+  }
 };
 
-// Helper function to ensure that moving out of the priority_queue is "atomic"
-template <typename T>
-T top_and_pop(std::priority_queue<T>& q)
+/**
+ * @brief Merges more than two non-empty sorted tables in a single pass over their columns.
+ */
+table_ptr_type k_way_merge(std::vector<table_view> const& tables,
+                           std::vector<cudf::size_type> const& key_cols,
+                           std::vector<cudf::order> const& column_order,
+                           std::vector<cudf::null_order> const& null_precedence,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr)
 {
-  auto moved = std::move(const_cast<T&>(q.top()));
-  q.pop();
-  return moved;
+  std::vector<size_type> run_offsets{0};
+  std::vector<table_view> keys;
+  for (auto const& tbl : tables) {
+    run_offsets.push_back(run_offsets.back() + tbl.num_rows());
+    keys.push_back(tbl.select(key_cols));
+  }
+
+  // only the key columns are copied to compute the merged order
+  auto const concatenated_keys = detail::concatenate(keys, stream);
+  auto const merged_indices =
+    cudf::has_nulls(concatenated_keys->view())
+      ? generate_k_way_merged_indices<true>(
+          concatenated_keys->view(), run_offsets, column_order, null_precedence, stream)
+      : generate_k_way_merged_indices<false>(
+          concatenated_keys->view(), run_offsets, column_order, null_precedence, stream);
+  auto const merged_indices_view = column_view(data_type{type_to_id<size_type>()},
+                                               static_cast<size_type>(merged_indices.size()),
+                                               merged_indices.data());
+
+  std::vector<std::unique_ptr<column>> merged_cols;
+  for (size_type i = 0; i < tables.front().num_columns(); ++i) {
+    std::vector<column_view> columns;
+    std::transform(tables.begin(), tables.end(), std::back_inserter(columns), [i](auto const& tbl) {
+      return tbl.column(i);
+    });
+    merged_cols.push_back(cudf::type_dispatcher<dispatch_storage_type>(columns.front().type(),
+                                                                       k_way_column_merger{},
+                                                                       columns,
+                                                                       run_offsets,
+                                                                       merged_indices_view,
+                                                                       stream,
+                                                                       mr));
+  }
+  return std::make_unique<cudf::table>(std::move(merged_cols));
 }
 
 }  // namespace
@@ -449,43 +625,30 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
   // It will return any new dictionary columns created as well as updated table_views.
   auto matched = cudf::dictionary::detail::match_dictionaries(
     tables_to_merge, stream, rmm::mr::get_current_device_resource());
-  auto merge_tables = matched.second;
+  auto const& merge_tables = matched.second;
 
-  // A queue of (table view, table) pairs
-  std::priority_queue<merge_queue_item> merge_queue;
-  // The table pointer is null if we do not own the table (input tables)
-  std::for_each(merge_tables.begin(), merge_tables.end(), [&](auto const& table) {
-    if (table.num_rows() > 0) merge_queue.emplace(table, table_ptr_type());
-  });
+  std::vector<table_view> non_empty_tables;
+  std::copy_if(merge_tables.begin(),
+               merge_tables.end(),
+               std::back_inserter(non_empty_tables),
+               [](auto const& tbl) { return tbl.num_rows() > 0; });
 
-  // If there is only one non-empty table_view, return its copy
-  if (merge_queue.size() == 1) { return std::make_unique<cudf::table>(merge_queue.top().view); }
   // No inputs have rows, return a table with same columns as the first one
-  if (merge_queue.empty()) { return empty_like(first_table); }
-
-  // Pick the two smallest tables and merge them
-  // Until there is only one table left in the queue
-  while (merge_queue.size() > 1) {
-    // To delete the intermediate table at the end of the block
-    auto const left_table = top_and_pop(merge_queue);
-    // Deallocated at the end of the block
-    auto const right_table = top_and_pop(merge_queue);
-
-    // Only use mr for the output table
-    auto const& new_tbl_mr = merge_queue.empty() ? mr : rmm::mr::get_current_device_resource();
-    auto merged_table      = merge(left_table.view,
-                              right_table.view,
-                              key_cols,
-                              column_order,
-                              null_precedence,
-                              stream,
-                              new_tbl_mr);
-
-    auto const merged_table_view = merged_table->view();
-    merge_queue.emplace(merged_table_view, std::move(merged_table));
+  if (non_empty_tables.empty()) { return empty_like(first_table); }
+  // If there is only one non-empty table_view, return its copy
+  if (non_empty_tables.size() == 1) {
+    return std::make_unique<cudf::table>(non_empty_tables.front(), stream, mr);
   }
-
-  return std::move(top_and_pop(merge_queue).table);
+  if (non_empty_tables.size() == 2) {
+    return merge(non_empty_tables[0],
+                 non_empty_tables[1],
+                 key_cols,
+                 column_order,
+                 null_precedence,
+                 stream,
+                 mr);
+  }
+  return k_way_merge(non_empty_tables, key_cols, column_order, null_precedence, stream, mr);
 }
 
 }  // namespace detail
@@ -17,18 +17,35 @@
 #include <cub/cub.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/scatter.cuh>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/partitioning.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+
 namespace cudf {
 namespace {
 // Launch configuration for optimized hash partition
@@ -442,23 +459,125 @@ struct copy_block_partitions_dispatcher {
   }
 };
 
-// NOTE hash_has_nulls must be true if table_to_hash has nulls
-template <template <typename> class hash_function, bool hash_has_nulls>
-std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
+/**
+ * @brief Computes the partition number of a row from the hash value of the row.
+ */
+template <typename row_hasher_t, typename partitioner_type>
+struct row_partition_number_fn {
+  row_hasher_t hasher;
+  partitioner_type partitioner;
+
+  __device__ size_type operator()(size_type row) const { return partitioner(hasher(row)); }
+};
+
+/**
+ * @brief Partitions the rows of `input` into a large number of partitions by radix sorting the
+ * partition numbers of the rows.
+ *
+ * Each pass of the radix sort partitions the rows on a few bits of the partition numbers with
+ * shared-memory histograms, which keeps the histograms small however many partitions there are,
+ * where computing a histogram of every partition in each thread block would need
+ * `num_partitions` counters per block. The radix sort is stable, so the rows of each partition
+ * keep their order in `input`.
+ */
+template <typename row_hasher_t, typename partitioner_type>
+std::pair<std::unique_ptr<table>, std::vector<size_type>> radix_partition_table(
   table_view const& input,
-  table_view const& table_to_hash,
+  row_hasher_t const& hasher,
+  partitioner_type const& partitioner,
+  size_type num_partitions,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = input.num_rows();
+
+  rmm::device_uvector<size_type> row_partition_numbers(num_rows, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(num_rows),
+                    row_partition_numbers.begin(),
+                    row_partition_number_fn<row_hasher_t, partitioner_type>{hasher, partitioner});
+  rmm::device_uvector<size_type> rows(num_rows, stream);
+  thrust::sequence(rmm::exec_policy(stream), rows.begin(), rows.end(), 0);
+
+  // Only the bits that can be set in a partition number are sorted
+  int key_bits = 0;
+  while ((size_type{1} << key_bits) < num_partitions) { ++key_bits; }
+
+  rmm::device_uvector<size_type> sorted_partition_numbers(num_rows, stream);
+  rmm::device_uvector<size_type> gather_map(num_rows, stream);
+  rmm::device_buffer d_temp_storage;
+  size_t temp_storage_bytes = 0;
+  cub::DeviceRadixSort::SortPairs(d_temp_storage.data(),
+                                  temp_storage_bytes,
+                                  row_partition_numbers.data(),
+                                  sorted_partition_numbers.data(),
+                                  rows.data(),
+                                  gather_map.data(),
+                                  num_rows,
+                                  0,
+                                  key_bits,
+                                  stream.value());
+  d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
+  cub::DeviceRadixSort::SortPairs(d_temp_storage.data(),
+                                  temp_storage_bytes,
+                                  row_partition_numbers.data(),
+                                  sorted_partition_numbers.data(),
+                                  rows.data(),
+                                  gather_map.data(),
+                                  num_rows,
+                                  0,
+                                  key_bits,
+                                  stream.value());
+
+  rmm::device_uvector<size_type> offsets(num_partitions, stream);
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      sorted_partition_numbers.begin(),
+                      sorted_partition_numbers.end(),
+                      thrust::make_counting_iterator(0),
+                      thrust::make_counting_iterator(num_partitions),
+                      offsets.begin());
+
+  auto output = detail::gather(
+    input, gather_map.begin(), gather_map.end(), out_of_bounds_policy::DONT_CHECK, stream, mr);
+  return std::make_pair(std::move(output), make_std_vector_sync(offsets, stream));
+}
+
+/**
+ * @brief Partitions the rows of `input` by the hash values of its rows given by `hasher`.
+ *
+ * @tparam row_hasher_t Callable returning the `hash_value_type` hash value of a row index
+ */
+template <typename row_hasher_t>
+std::pair<std::unique_ptr<table>, std::vector<size_type>> partition_table_by_row_hash(
+  table_view const& input,
+  row_hasher_t const& hasher,
   size_type num_partitions,
-  uint32_t seed,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
-  auto const num_rows = table_to_hash.num_rows();
+  auto const num_rows = input.num_rows();
+
+  // Large fanouts are partitioned by radix sorting the partition numbers
+  if (num_partitions > THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL) {
+    return is_power_two(num_partitions)
+             ? radix_partition_table(input,
+                                     hasher,
+                                     bitwise_partitioner<hash_value_type>(num_partitions),
+                                     num_partitions,
+                                     stream,
+                                     mr)
+             : radix_partition_table(input,
+                                     hasher,
+                                     modulo_partitioner<hash_value_type>(num_partitions),
+                                     num_partitions,
+                                     stream,
+                                     mr);
+  }
 
-  bool const use_optimization{num_partitions <= THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL};
-  auto const block_size = use_optimization ? OPTIMIZED_BLOCK_SIZE : FALLBACK_BLOCK_SIZE;
-  auto const rows_per_thread =
-    use_optimization ? OPTIMIZED_ROWS_PER_THREAD : FALLBACK_ROWS_PER_THREAD;
-  auto const rows_per_block = block_size * rows_per_thread;
+  auto const block_size      = OPTIMIZED_BLOCK_SIZE;
+  auto const rows_per_thread = OPTIMIZED_ROWS_PER_THREAD;
+  auto const rows_per_block  = block_size * rows_per_thread;
 
   // NOTE grid_size is non-const to workaround lambda capture bug in gcc 5.4
   auto grid_size = util::div_rounding_up_safe(num_rows, rows_per_block);
@@ -481,9 +600,6 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
 
   auto row_partition_offset = rmm::device_vector<size_type>(num_rows);
 
-  auto const device_input = table_device_view::create(table_to_hash, stream);
-  auto const hasher       = row_hasher<hash_function, hash_has_nulls>(*device_input, seed);
-
   // If the number of partitions is a power of two, we can compute the partition
   // number of each row more efficiently with bitwise operations
   if (is_power_two(num_partitions)) {
@@ -553,69 +669,64 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
                            cudaMemcpyDeviceToHost,
                            stream.value()));
 
-  // When the number of partitions is less than a threshold, we can apply an
-  // optimization using shared memory to copy values to the output buffer.
-  // Otherwise, fallback to using scatter.
-  if (use_optimization) {
-    std::vector<std::unique_ptr<column>> output_cols(input.num_columns());
-
-    // NOTE these pointers are non-const to workaround lambda capture bug in
-    // gcc 5.4
-    auto row_partition_numbers_ptr{row_partition_numbers.data().get()};
-    auto row_partition_offset_ptr{row_partition_offset.data().get()};
-    auto block_partition_sizes_ptr{block_partition_sizes.data().get()};
-    auto scanned_block_partition_sizes_ptr{scanned_block_partition_sizes.data().get()};
-
-    // Copy input to output by partition per column
-    std::transform(input.begin(), input.end(), output_cols.begin(), [=](auto const& col) {
-      return cudf::type_dispatcher<dispatch_storage_type>(col.type(),
-                                                          copy_block_partitions_dispatcher{},
-                                                          col,
-                                                          num_partitions,
-                                                          row_partition_numbers_ptr,
-                                                          row_partition_offset_ptr,
-                                                          block_partition_sizes_ptr,
-                                                          scanned_block_partition_sizes_ptr,
-                                                          grid_size,
-                                                          stream,
-                                                          mr);
-    });
-
-    if (has_nulls(input)) {
-      // Use copy_block_partitions to compute a gather map
-      auto gather_map = compute_gather_map(num_rows,
-                                           num_partitions,
-                                           row_partition_numbers_ptr,
-                                           row_partition_offset_ptr,
-                                           block_partition_sizes_ptr,
-                                           scanned_block_partition_sizes_ptr,
-                                           grid_size,
-                                           stream);
-
-      // Handle bitmask using gather to take advantage of ballot_sync
-      detail::gather_bitmask(
-        input, gather_map.begin(), output_cols, detail::gather_bitmask_op::DONT_CHECK, stream, mr);
-    }
+  // Copy values to the output buffer through shared memory
+  std::vector<std::unique_ptr<column>> output_cols(input.num_columns());
+
+  // NOTE these pointers are non-const to workaround lambda capture bug in
+  // gcc 5.4
+  auto row_partition_numbers_ptr{row_partition_numbers.data().get()};
+  auto row_partition_offset_ptr{row_partition_offset.data().get()};
+  auto block_partition_sizes_ptr{block_partition_sizes.data().get()};
+  auto scanned_block_partition_sizes_ptr{scanned_block_partition_sizes.data().get()};
+
+  // Copy input to output by partition per column
+  std::transform(input.begin(), input.end(), output_cols.begin(), [=](auto const& col) {
+    return cudf::type_dispatcher<dispatch_storage_type>(col.type(),
+                                                        copy_block_partitions_dispatcher{},
+                                                        col,
+                                                        num_partitions,
+                                                        row_partition_numbers_ptr,
+                                                        row_partition_offset_ptr,
+                                                        block_partition_sizes_ptr,
+                                                        scanned_block_partition_sizes_ptr,
+                                                        grid_size,
+                                                        stream,
+                                                        mr);
+  });
+
+  if (has_nulls(input)) {
+    // Use copy_block_partitions to compute a gather map
+    auto gather_map = compute_gather_map(num_rows,
+                                         num_partitions,
+                                         row_partition_numbers_ptr,
+                                         row_partition_offset_ptr,
+                                         block_partition_sizes_ptr,
+                                         scanned_block_partition_sizes_ptr,
+                                         grid_size,
+                                         stream);
 
-    auto output{std::make_unique<table>(std::move(output_cols))};
-    return std::make_pair(std::move(output), std::move(partition_offsets));
-  } else {
-    // Compute a scatter map from input to output such that the output rows are
-    // sorted by partition number
-    auto row_output_locations{row_partition_numbers.data().get()};
-    auto scanned_block_partition_sizes_ptr{scanned_block_partition_sizes.data().get()};
-    compute_row_output_locations<<<grid_size,
-                                   block_size,
-                                   num_partitions * sizeof(size_type),
-                                   stream.value()>>>(
-      row_output_locations, num_rows, num_partitions, scanned_block_partition_sizes_ptr);
-
-    // Use the resulting scatter map to materialize the output
-    auto output = detail::scatter(
-      input, row_partition_numbers.begin(), row_partition_numbers.end(), input, false, stream, mr);
-
-    return std::make_pair(std::move(output), std::move(partition_offsets));
+    // Handle bitmask using gather to take advantage of ballot_sync
+    detail::gather_bitmask(
+      input, gather_map.begin(), output_cols, detail::gather_bitmask_op::DONT_CHECK, stream, mr);
   }
+
+  auto output{std::make_unique<table>(std::move(output_cols))};
+  return std::make_pair(std::move(output), std::move(partition_offsets));
+}
+
+// NOTE hash_has_nulls must be true if table_to_hash has nulls
+template <template <typename> class hash_function, bool hash_has_nulls>
+std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
+  table_view const& input,
+  table_view const& table_to_hash,
+  size_type num_partitions,
+  uint32_t seed,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const device_input = table_device_view::create(table_to_hash, stream);
+  auto const hasher       = row_hasher<hash_function, hash_has_nulls>(*device_input, seed);
+  return partition_table_by_row_hash(input, hasher, num_partitions, stream, mr);
 }
 
 struct dispatch_map_type {
@@ -717,6 +828,235 @@ struct dispatch_map_type {
     CUDF_FAIL("Unexpected, non-integral partition map.");
   }
 };
+
+// Alignment of the column buffers within a packed partition, matching `contiguous_split`
+constexpr std::size_t PACKED_BUFFER_ALIGNMENT = 64;
+
+/**
+ * @brief Scatters the rows of the fixed-width columns of `input` directly into the packed buffer
+ * of the partition each row belongs to.
+ *
+ * @param[in] input The fixed-width columns to scatter
+ * @param[in] row_partition_numbers Array that holds which partition each row belongs to
+ * @param[in] row_output_locations Array that holds the location of each row in the partitioned
+ * order of all the rows
+ * @param[in] partition_offsets The location of the first row of each partition
+ * @param[in] element_sizes The size in bytes of the elements of each column
+ * @param[in] partition_buffers The packed buffer of each partition, with zeroed validity
+ * @param[in] buffer_offsets The offsets of the data and validity of each column in the packed
+ * buffer of each partition, i.e., { {partition0 column0 data, partition0 column0 validity, ...},
+ *                                   {partition1 column0 data, partition1 column0 validity, ...},
+ *                                   ... }
+ * @param[out] null_counts The number of nulls of each column in each partition
+ */
+__global__ void scatter_to_packed_partitions(table_device_view input,
+                                             size_type const* __restrict__ row_partition_numbers,
+                                             size_type const* __restrict__ row_output_locations,
+                                             size_type const* __restrict__ partition_offsets,
+                                             size_type const* __restrict__ element_sizes,
+                                             uint8_t* const* __restrict__ partition_buffers,
+                                             std::size_t const* __restrict__ buffer_offsets,
+                                             size_type* __restrict__ null_counts)
+{
+  auto const num_columns = input.num_columns();
+
+  size_type row_number = threadIdx.x + blockIdx.x * blockDim.x;
+  while (row_number < input.num_rows()) {
+    auto const partition_number = row_partition_numbers[row_number];
+    auto const output_row = row_output_locations[row_number] - partition_offsets[partition_number];
+    auto const buffer     = partition_buffers[partition_number];
+    auto const offsets    = buffer_offsets + 2 * num_columns * partition_number;
+
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const& col = input.column(c);
+      auto const data = buffer + offsets[2 * c];
+      switch (element_sizes[c]) {
+        case 1: reinterpret_cast<int8_t*>(data)[output_row] = col.data<int8_t>()[row_number]; break;
+        case 2:
+          reinterpret_cast<int16_t*>(data)[output_row] = col.data<int16_t>()[row_number];
+          break;
+        case 4:
+          reinterpret_cast<int32_t*>(data)[output_row] = col.data<int32_t>()[row_number];
+          break;
+        default:
+          reinterpret_cast<int64_t*>(data)[output_row] = col.data<int64_t>()[row_number];
+      }
+      if (col.nullable()) {
+        if (col.is_valid_nocheck(row_number)) {
+          set_bit(reinterpret_cast<bitmask_type*>(buffer + offsets[2 * c + 1]), output_row);
+        } else {
+          atomicAdd(&null_counts[num_columns * partition_number + c], size_type{1});
+        }
+      }
+    }
+
+    row_number += blockDim.x * gridDim.x;
+  }
+}
+
+/**
+ * @brief Hash partitions the fixed-width columns of `input`, writing each partition directly
+ * into a contiguous buffer laid out like the buffers of `contiguous_split`.
+ *
+ * The partition numbers and output locations of the rows are computed as in
+ * `hash_partition_table`, but rather than gathering the partitioned table and then copying its
+ * partitions with `contiguous_split`, the rows are scattered straight into the packed buffers.
+ */
+template <template <typename> class hash_function, bool hash_has_nulls>
+std::vector<packed_table> hash_partition_and_pack_table(table_view const& input,
+                                                        table_view const& table_to_hash,
+                                                        size_type num_partitions,
+                                                        uint32_t seed,
+                                                        rmm::cuda_stream_view stream,
+                                                        rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows    = table_to_hash.num_rows();
+  auto const num_columns = input.num_columns();
+  auto const grid_size =
+    util::div_rounding_up_safe(num_rows, FALLBACK_BLOCK_SIZE * FALLBACK_ROWS_PER_THREAD);
+
+  rmm::device_uvector<size_type> row_partition_numbers(num_rows, stream);
+  // Holds the offset of each row in its partition of the thread block, then its output location
+  rmm::device_uvector<size_type> row_output_locations(num_rows, stream);
+  rmm::device_uvector<size_type> block_partition_sizes(grid_size * num_partitions, stream);
+  // Holds the total number of rows in each partition, then the offset of each partition
+  rmm::device_uvector<size_type> partition_offsets(num_partitions, stream);
+  CUDA_TRY(cudaMemsetAsync(
+    partition_offsets.data(), 0, num_partitions * sizeof(size_type), stream.value()));
+
+  auto const device_input = table_device_view::create(table_to_hash, stream);
+  auto const hasher       = row_hasher<hash_function, hash_has_nulls>(*device_input, seed);
+
+  if (is_power_two(num_partitions)) {
+    compute_row_partition_numbers<<<grid_size,
+                                    FALLBACK_BLOCK_SIZE,
+                                    num_partitions * sizeof(size_type),
+                                    stream.value()>>>(
+      hasher,
+      num_rows,
+      num_partitions,
+      bitwise_partitioner<hash_value_type>(num_partitions),
+      row_partition_numbers.data(),
+      row_output_locations.data(),
+      block_partition_sizes.data(),
+      partition_offsets.data());
+  } else {
+    compute_row_partition_numbers<<<grid_size,
+                                    FALLBACK_BLOCK_SIZE,
+                                    num_partitions * sizeof(size_type),
+                                    stream.value()>>>(
+      hasher,
+      num_rows,
+      num_partitions,
+      modulo_partitioner<hash_value_type>(num_partitions),
+      row_partition_numbers.data(),
+      row_output_locations.data(),
+      block_partition_sizes.data(),
+      partition_offsets.data());
+  }
+
+  // The offset of each partition of each block in the partitioned order of all the rows
+  thrust::exclusive_scan(rmm::exec_policy(stream),
+                         block_partition_sizes.begin(),
+                         block_partition_sizes.end(),
+                         block_partition_sizes.begin());
+  thrust::exclusive_scan(rmm::exec_policy(stream),
+                         partition_offsets.begin(),
+                         partition_offsets.end(),
+                         partition_offsets.begin());
+
+  thrust::copy(rmm::exec_policy(stream),
+               row_partition_numbers.begin(),
+               row_partition_numbers.end(),
+               row_output_locations.begin());
+  compute_row_output_locations<<<grid_size,
+                                 FALLBACK_BLOCK_SIZE,
+                                 num_partitions * sizeof(size_type),
+                                 stream.value()>>>(
+    row_output_locations.data(), num_rows, num_partitions, block_partition_sizes.data());
+
+  auto h_partition_offsets = make_std_vector_sync(partition_offsets, stream);
+  h_partition_offsets.push_back(num_rows);
+
+  // Lay out the validity and data of each column in the buffer of each partition
+  std::vector<size_type> h_element_sizes(num_columns);
+  std::transform(input.begin(), input.end(), h_element_sizes.begin(), [](auto const& col) {
+    return static_cast<size_type>(size_of(col.type()));
+  });
+  std::vector<std::size_t> h_buffer_offsets(2 * num_columns * num_partitions);
+  std::vector<std::size_t> h_buffer_sizes(num_partitions, 0);
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto const partition_size = h_partition_offsets[p + 1] - h_partition_offsets[p];
+    auto offsets              = h_buffer_offsets.begin() + 2 * num_columns * p;
+    auto& buffer_size         = h_buffer_sizes[p];
+    for (size_type c = 0; c < num_columns; ++c) {
+      if (input.column(c).nullable()) {
+        offsets[2 * c + 1] = buffer_size;
+        buffer_size += bitmask_allocation_size_bytes(partition_size, PACKED_BUFFER_ALIGNMENT);
+      }
+      offsets[2 * c] = buffer_size;
+      buffer_size += util::round_up_safe(
+        static_cast<std::size_t>(partition_size) * h_element_sizes[c], PACKED_BUFFER_ALIGNMENT);
+    }
+  }
+
+  bool const has_nullable =
+    std::any_of(input.begin(), input.end(), [](auto const& col) { return col.nullable(); });
+  std::vector<rmm::device_buffer> buffers;
+  std::vector<uint8_t*> h_partition_buffers;
+  for (size_type p = 0; p < num_partitions; ++p) {
+    buffers.emplace_back(h_buffer_sizes[p], stream, mr);
+    if (has_nullable) {
+      CUDA_TRY(cudaMemsetAsync(buffers.back().data(), 0, h_buffer_sizes[p], stream.value()));
+    }
+    h_partition_buffers.push_back(static_cast<uint8_t*>(buffers.back().data()));
+  }
+
+  auto const d_element_sizes     = make_device_uvector_async(h_element_sizes, stream);
+  auto const d_buffer_offsets    = make_device_uvector_async(h_buffer_offsets, stream);
+  auto const d_partition_buffers = make_device_uvector_async(h_partition_buffers, stream);
+  rmm::device_uvector<size_type> null_counts(num_columns * num_partitions, stream);
+  CUDA_TRY(cudaMemsetAsync(
+    null_counts.data(), 0, null_counts.size() * sizeof(size_type), stream.value()));
+
+  auto const device_columns = table_device_view::create(input, stream);
+  scatter_to_packed_partitions<<<grid_size, FALLBACK_BLOCK_SIZE, 0, stream.value()>>>(
+    *device_columns,
+    row_partition_numbers.data(),
+    row_output_locations.data(),
+    partition_offsets.data(),
+    d_element_sizes.data(),
+    d_partition_buffers.data(),
+    d_buffer_offsets.data(),
+    null_counts.data());
+
+  auto const h_null_counts = make_std_vector_sync(null_counts, stream);
+
+  std::vector<packed_table> result;
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto const partition_size = h_partition_offsets[p + 1] - h_partition_offsets[p];
+    auto const base           = static_cast<uint8_t const*>(buffers[p].data());
+    auto const offsets        = h_buffer_offsets.begin() + 2 * num_columns * p;
+    std::vector<column_view> columns;
+    for (size_type c = 0; c < num_columns; ++c) {
+      bool const has_mask = input.column(c).nullable() && partition_size > 0;
+      columns.emplace_back(
+        input.column(c).type(),
+        partition_size,
+        partition_size > 0 ? base + offsets[2 * c] : nullptr,
+        has_mask ? reinterpret_cast<bitmask_type const*>(base + offsets[2 * c + 1]) : nullptr,
+        has_mask ? h_null_counts[num_columns * p + c] : 0);
+    }
+    table_view const partition{columns};
+    auto metadata = std::make_unique<packed_columns::metadata>(
+      pack_metadata(partition, base, h_buffer_sizes[p]));
+    result.push_back(packed_table{
+      partition,
+      packed_columns{std::move(metadata),
+                     std::make_unique<rmm::device_buffer>(std::move(buffers[p]))}});
+  }
+  return result;
+}
 }  // namespace
 
 namespace detail {
@@ -745,6 +1085,63 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
       input, table_to_hash, num_partitions, seed, stream, mr);
   }
 }
+
+std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_by_hashes(
+  table_view const& input,
+  column_view const& row_hashes,
+  int num_partitions,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(row_hashes.type().id() == type_id::INT32 ||
+                 row_hashes.type().id() == type_id::UINT32,
+               "Row hashes must be an INT32 or UINT32 column");
+  CUDF_EXPECTS(not row_hashes.has_nulls(), "Row hashes must not have nulls");
+  CUDF_EXPECTS(row_hashes.size() == input.num_rows(),
+               "Row hashes must have a hash value for each row");
+
+  // Return empty result if there are no partitions or nothing to partition
+  if (num_partitions <= 0 || input.num_rows() == 0) {
+    return std::make_pair(empty_like(input), std::vector<size_type>{});
+  }
+
+  auto const hasher = precomputed_row_hasher(row_hashes.data<hash_value_type>());
+  return partition_table_by_row_hash(input, hasher, num_partitions, stream, mr);
+}
+
+template <template <typename> class hash_function>
+std::vector<packed_table> hash_partition_and_pack(table_view const& input,
+                                                  std::vector<size_type> const& columns_to_hash,
+                                                  int num_partitions,
+                                                  uint32_t seed,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  auto table_to_hash = input.select(columns_to_hash);
+
+  // Return empty result if there are no partitions or nothing to hash
+  if (num_partitions <= 0 || table_to_hash.num_columns() == 0) { return {}; }
+
+  bool const all_fixed_width = std::all_of(
+    input.begin(), input.end(), [](auto const& col) { return is_fixed_width(col.type()); });
+  if (input.num_rows() > 0 && all_fixed_width) {
+    if (has_nulls(table_to_hash)) {
+      return hash_partition_and_pack_table<hash_function, true>(
+        input, table_to_hash, num_partitions, seed, stream, mr);
+    } else {
+      return hash_partition_and_pack_table<hash_function, false>(
+        input, table_to_hash, num_partitions, seed, stream, mr);
+    }
+  }
+
+  // Other tables are partitioned and then copied into packed buffers by `contiguous_split`
+  auto const partitioned = hash_partition<hash_function>(
+    input, columns_to_hash, num_partitions, seed, stream, rmm::mr::get_current_device_resource());
+  auto const& offsets = partitioned.second;
+  std::vector<size_type> splits(num_partitions - 1, 0);
+  if (not offsets.empty()) { std::copy(offsets.begin() + 1, offsets.end(), splits.begin()); }
+  return detail::contiguous_split(partitioned.first->view(), splits, stream, mr);
+}
 }  // namespace local
 
 std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
@@ -765,6 +1162,68 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   return cudf::type_dispatcher(
     partition_map.type(), dispatch_map_type{}, t, partition_map, num_partitions, stream, mr);
 }
+
+std::tuple<std::unique_ptr<table>, std::vector<size_type>, std::unique_ptr<table>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  std::vector<order> const& column_order,
+  size_type num_partitions,
+  size_type sample_size,
+  std::vector<null_order> const& null_precedence,
+  int64_t seed,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(num_partitions > 0, "num_partitions must be positive");
+  CUDF_EXPECTS(sample_size > 0, "sample_size must be positive");
+  CUDF_EXPECTS(not key_columns.empty(), "range_partition requires key columns");
+  CUDF_EXPECTS(column_order.size() == key_columns.size(),
+               "Mismatch between number of key columns and column_order.");
+
+  auto const keys = input.select(key_columns);
+  if (input.num_rows() == 0) {
+    return std::make_tuple(empty_like(input), std::vector<size_type>{}, empty_like(keys));
+  }
+
+  // Choose evenly spaced rows of the sorted sample as splitters
+  auto const num_samples = std::min(sample_size, input.num_rows());
+  auto const samples =
+    detail::sample(keys, num_samples, sample_with_replacement::FALSE, seed, stream);
+  auto const sorted_samples = detail::sorted_order(samples->view(),
+                                                   column_order,
+                                                   null_precedence,
+                                                   stream,
+                                                   rmm::mr::get_current_device_resource());
+  auto const d_sorted_samples = sorted_samples->view().data<size_type>();
+  rmm::device_uvector<size_type> splitter_rows(num_partitions - 1, stream);
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator(1),
+    thrust::make_counting_iterator(num_partitions),
+    splitter_rows.begin(),
+    [d_sorted_samples, num_samples, num_partitions] __device__(size_type i) {
+      return d_sorted_samples[static_cast<int64_t>(i) * num_samples / num_partitions];
+    });
+  auto splitters = detail::gather(samples->view(),
+                                  column_view(data_type{type_to_id<size_type>()},
+                                              num_partitions - 1,
+                                              splitter_rows.data()),
+                                  out_of_bounds_policy::DONT_CHECK,
+                                  detail::negative_index_policy::NOT_ALLOWED,
+                                  stream,
+                                  mr);
+
+  // The partition of each row is the number of splitters ordered before or equal to it
+  auto const partition_map = detail::upper_bound(splitters->view(),
+                                                 keys,
+                                                 column_order,
+                                                 null_precedence,
+                                                 stream,
+                                                 rmm::mr::get_current_device_resource());
+  auto partitioned = detail::partition(input, partition_map->view(), num_partitions, stream, mr);
+  return std::make_tuple(
+    std::move(partitioned.first), std::move(partitioned.second), std::move(splitters));
+}
 }  // namespace detail
 
 // Partition based on hash values
@@ -794,6 +1253,66 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   }
 }
 
+// Partition based on precomputed hash values
+std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_by_hashes(
+  table_view const& input,
+  column_view const& row_hashes,
+  int num_partitions,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::local::hash_partition_by_hashes(input, row_hashes, num_partitions, stream, mr);
+}
+
+std::vector<packed_table> hash_partition_and_pack(table_view const& input,
+                                                  std::vector<size_type> const& columns_to_hash,
+                                                  int num_partitions,
+                                                  hash_id hash_function,
+                                                  uint32_t seed,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  switch (hash_function) {
+    case (hash_id::HASH_IDENTITY):
+      for (const size_type& column_id : columns_to_hash) {
+        if (!is_numeric(input.column(column_id).type()))
+          CUDF_FAIL("IdentityHash does not support this data type");
+      }
+      return detail::local::hash_partition_and_pack<IdentityHash>(
+        input, columns_to_hash, num_partitions, seed, stream, mr);
+    case (hash_id::HASH_MURMUR3):
+      return detail::local::hash_partition_and_pack<MurmurHash3_32>(
+        input, columns_to_hash, num_partitions, seed, stream, mr);
+    default: CUDF_FAIL("Unsupported hash function in hash_partition_and_pack");
+  }
+}
+
+// Partition based on ranges of sampled splitters
+std::tuple<std::unique_ptr<table>, std::vector<size_type>, std::unique_ptr<table>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  std::vector<order> const& column_order,
+  size_type num_partitions,
+  size_type sample_size,
+  std::vector<null_order> const& null_precedence,
+  int64_t seed,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::range_partition(input,
+                                 key_columns,
+                                 column_order,
+                                 num_partitions,
+                                 sample_size,
+                                 null_precedence,
+                                 seed,
+                                 rmm::cuda_stream_default,
+                                 mr);
+}
+
 // Partition based on an explicit partition map
 std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   table_view const& t,
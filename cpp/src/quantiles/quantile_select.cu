@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <quantiles/quantiles_util.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/quantiles.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+constexpr int radix_bits                      = 8;
+constexpr int radix_size                      = 1 << radix_bits;
+constexpr std::size_t max_selected_ranks      = 8;
+constexpr size_type radix_block_size          = 256;
+constexpr size_type radix_elements_per_thread = 16;
+
+template <typename T>
+using radix_key_type = std::conditional_t<(sizeof(T) > 4), uint64_t, uint32_t>;
+
+template <typename T>
+constexpr int radix_key_bits = sizeof(T) * 8;
+
+/**
+ * @brief Maps `value` to an unsigned key with the same order.
+ */
+template <typename T, std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+CUDA_HOST_DEVICE_CALLABLE radix_key_type<T> to_radix_key(T value)
+{
+  using U         = std::make_unsigned_t<T>;
+  auto const bits = static_cast<U>(value);
+  // flipping the sign bit orders the negative values before the positive ones
+  return std::is_signed<T>::value ? static_cast<U>(bits ^ (U{1} << (radix_key_bits<T> - 1)))
+                                  : bits;
+}
+
+template <typename T, std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+CUDA_HOST_DEVICE_CALLABLE T from_radix_key(radix_key_type<T> key)
+{
+  using U         = std::make_unsigned_t<T>;
+  auto const bits = static_cast<U>(key);
+  return static_cast<T>(std::is_signed<T>::value
+                          ? static_cast<U>(bits ^ (U{1} << (radix_key_bits<T> - 1)))
+                          : bits);
+}
+
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+CUDA_HOST_DEVICE_CALLABLE radix_key_type<T> to_radix_key(T value)
+{
+  using Key          = radix_key_type<T>;
+  constexpr Key sign = Key{1} << (radix_key_bits<T> - 1);
+  // NaNs are ordered after all other values, as when sorting
+  if (std::isnan(value)) { return ~Key{0}; }
+  Key bits;
+  std::memcpy(&bits, &value, sizeof(T));
+  // negative values are ordered by decreasing magnitude
+  return (bits & sign) ? ~bits : bits | sign;
+}
+
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+CUDA_HOST_DEVICE_CALLABLE T from_radix_key(radix_key_type<T> key)
+{
+  using Key          = radix_key_type<T>;
+  constexpr Key sign = Key{1} << (radix_key_bits<T> - 1);
+  Key const bits     = (key & sign) ? key ^ sign : ~key;
+  T value;
+  std::memcpy(&value, &bits, sizeof(T));
+  return value;
+}
+
+/**
+ * @brief Counts the values of each digit at `shift` of the keys of the valid elements of
+ * `input`, separately for each rank, among the keys whose digits above `shift` are the prefix
+ * selected so far for the rank.
+ *
+ * Each block counts in shared memory and adds its counts to `histograms`, which holds
+ * `radix_size` counts per rank.
+ */
+template <typename T, bool has_nulls>
+__global__ void radix_histogram_kernel(column_device_view input,
+                                       radix_key_type<T> const* __restrict__ prefixes,
+                                       int num_ranks,
+                                       int shift,
+                                       size_type* __restrict__ histograms)
+{
+  using Key = radix_key_type<T>;
+  __shared__ size_type block_histograms[max_selected_ranks * radix_size];
+  __shared__ Key block_prefixes[max_selected_ranks];
+  for (int i = threadIdx.x; i < num_ranks * radix_size; i += blockDim.x) {
+    block_histograms[i] = 0;
+  }
+  if (threadIdx.x < static_cast<unsigned>(num_ranks)) {
+    block_prefixes[threadIdx.x] = prefixes[threadIdx.x];
+  }
+  __syncthreads();
+
+  auto const high_bits  = shift + radix_bits;
+  Key const prefix_mask = high_bits < radix_key_bits<T> ? ~Key{0} << high_bits : Key{0};
+  for (size_type i = threadIdx.x + blockIdx.x * blockDim.x; i < input.size();
+       i += blockDim.x * gridDim.x) {
+    if (has_nulls and input.is_null_nocheck(i)) { continue; }
+    auto const key   = to_radix_key(input.element<T>(i));
+    auto const digit = static_cast<int>((key >> shift) & (radix_size - 1));
+    for (int r = 0; r < num_ranks; ++r) {
+      if ((key & prefix_mask) == block_prefixes[r]) {
+        atomicAdd(&block_histograms[r * radix_size + digit], 1);
+      }
+    }
+  }
+  __syncthreads();
+
+  for (int i = threadIdx.x; i < num_ranks * radix_size; i += blockDim.x) {
+    if (block_histograms[i] != 0) { atomicAdd(&histograms[i], block_histograms[i]); }
+  }
+}
+
+/**
+ * @brief Returns the valid values of `input` at `ranks` in sorted order, by selecting one digit
+ * of their keys per pass over `input`, from the most significant one.
+ */
+template <typename T>
+std::vector<T> radix_select(column_view const& input,
+                            std::vector<size_type> const& ranks,
+                            rmm::cuda_stream_view stream)
+{
+  using Key            = radix_key_type<T>;
+  auto const num_ranks = static_cast<int>(ranks.size());
+  auto const d_input   = column_device_view::create(input, stream);
+  cudf::detail::grid_1d const grid{input.size(), radix_block_size, radix_elements_per_thread};
+
+  std::vector<Key> prefixes(num_ranks, 0);
+  std::vector<size_type> remaining(ranks);
+  rmm::device_uvector<size_type> d_histograms(num_ranks * radix_size, stream);
+  for (int shift = radix_key_bits<T> - radix_bits; shift >= 0; shift -= radix_bits) {
+    auto const d_prefixes = make_device_uvector_async(prefixes, stream);
+    CUDA_TRY(cudaMemsetAsync(
+      d_histograms.data(), 0, d_histograms.size() * sizeof(size_type), stream.value()));
+    auto const kernel = input.has_nulls() ? radix_histogram_kernel<T, true>
+                                          : radix_histogram_kernel<T, false>;
+    kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+      *d_input, d_prefixes.data(), num_ranks, shift, d_histograms.data());
+    CHECK_CUDA(stream.value());
+
+    auto const histograms = make_std_vector_sync(d_histograms, stream);
+    for (int r = 0; r < num_ranks; ++r) {
+      auto const histogram = histograms.data() + r * radix_size;
+      int digit            = 0;
+      while (remaining[r] >= histogram[digit]) {
+        remaining[r] -= histogram[digit++];
+      }
+      prefixes[r] |= static_cast<Key>(digit) << shift;
+    }
+  }
+
+  std::vector<T> values(num_ranks);
+  std::transform(prefixes.begin(), prefixes.end(), values.begin(), [](Key key) {
+    return from_radix_key<T>(key);
+  });
+  return values;
+}
+
+template <typename T, bool exact>
+std::unique_ptr<column> quantile_by_selection(column_view const& input,
+                                              std::vector<double> const& q,
+                                              interpolation interp,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  using StorageType   = cudf::device_storage_type_t<T>;
+  using ExactResult   = std::conditional_t<exact and not cudf::is_fixed_point<T>(), double, T>;
+  using StorageResult = cudf::device_storage_type_t<ExactResult>;
+
+  auto const type =
+    is_fixed_point(input.type()) ? input.type() : data_type{type_to_id<StorageResult>()};
+  auto const num_values = input.size() - input.null_count();
+  if (num_values == 0) {
+    return make_fixed_width_column(type, q.size(), mask_state::ALL_NULL, stream, mr);
+  }
+
+  // the ranks of the values that the quantiles are interpolated from
+  std::vector<size_type> ranks;
+  for (auto const quantile : q) {
+    quantile_index const idx(num_values, quantile);
+    switch (interp) {
+      case interpolation::LOWER: ranks.push_back(idx.lower); break;
+      case interpolation::HIGHER: ranks.push_back(idx.higher); break;
+      case interpolation::NEAREST: ranks.push_back(idx.nearest); break;
+      default:
+        ranks.push_back(idx.lower);
+        ranks.push_back(idx.higher);
+        break;
+    }
+  }
+  std::sort(ranks.begin(), ranks.end());
+  ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+  CUDF_EXPECTS(ranks.size() <= max_selected_ranks, "Too many quantiles to select");
+
+  auto const values   = radix_select<StorageType>(input, ranks, stream);
+  auto const value_at = [&](size_type rank) {
+    return values[std::lower_bound(ranks.begin(), ranks.end(), rank) - ranks.begin()];
+  };
+  std::vector<StorageResult> results(q.size());
+  std::transform(q.begin(), q.end(), results.begin(), [&](double quantile) {
+    return select_quantile<StorageResult>(value_at, num_values, quantile, interp);
+  });
+
+  auto d_results = make_device_uvector_sync(results, stream, mr);
+  return std::make_unique<column>(type, q.size(), d_results.release());
+}
+
+struct quantile_by_selection_functor {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return (std::is_arithmetic<T>::value and not std::is_same<T, bool>::value) or
+           cudf::is_fixed_point<T>();
+  }
+
+  template <typename T, std::enable_if_t<is_supported<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     std::vector<double> const& q,
+                                     interpolation interp,
+                                     bool exact,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    return exact ? quantile_by_selection<T, true>(input, q, interp, stream, mr)
+                 : quantile_by_selection<T, false>(input, q, interp, stream, mr);
+  }
+
+  template <typename T, std::enable_if_t<not is_supported<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     std::vector<double> const&,
+                                     interpolation,
+                                     bool,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Unsupported type for quantile selection");
+  }
+};
+
+struct is_quantile_by_selection_supported_fn {
+  template <typename T>
+  bool operator()()
+  {
+    return quantile_by_selection_functor::is_supported<T>();
+  }
+};
+
+}  // namespace
+
+bool is_quantile_by_selection_supported(data_type type,
+                                        std::vector<double> const& q,
+                                        interpolation interp)
+{
+  auto const ranks_per_quantile =
+    interp == interpolation::LINEAR or interp == interpolation::MIDPOINT ? 2 : 1;
+  return q.size() * ranks_per_quantile <= max_selected_ranks and
+         type_dispatcher(type, is_quantile_by_selection_supported_fn{});
+}
+
+std::unique_ptr<column> quantile_by_selection(column_view const& input,
+                                              std::vector<double> const& q,
+                                              interpolation interp,
+                                              bool exact,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  return type_dispatcher(
+    input.type(), quantile_by_selection_functor{}, input, q, interp, exact, stream, mr);
+}
+
+}  // namespace detail
+}  // namespace cudf
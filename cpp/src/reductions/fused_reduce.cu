@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/reduction_functions.hpp>
+#include <cudf/detail/reduction_operators.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <cub/device/device_reduce.cuh>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace cudf {
+namespace reduction {
+namespace {
+
+/// Alignment of the summary of each column in the buffer of all the summaries
+constexpr std::size_t SUMMARY_ALIGNMENT = 16;
+
+/**
+ * @brief Returns whether the aggregation `k` is computed from the summary of a column.
+ */
+bool is_summary_aggregation(aggregation::Kind k)
+{
+  switch (k) {
+    case aggregation::SUM:
+    case aggregation::PRODUCT:
+    case aggregation::MIN:
+    case aggregation::MAX:
+    case aggregation::SUM_OF_SQUARES:
+    case aggregation::MEAN:
+    case aggregation::VARIANCE:
+    case aggregation::STD:
+    case aggregation::ANY:
+    case aggregation::ALL:
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL: return true;
+    default: return false;
+  }
+}
+
+/**
+ * @brief The partial reductions of a column of type `T` from which all the summary aggregations
+ * of the column are computed.
+ *
+ * The sums and product are accumulated in the `target_type` of `SUM` and `PRODUCT`, and the
+ * moments used for mean, variance and standard deviation in `double`, as the single column
+ * reductions do.
+ */
+template <typename T>
+struct column_summary {
+  using sum_type = std::conditional_t<std::is_integral<T>::value, int64_t, T>;
+
+  size_type valid_count;
+  sum_type sum;
+  sum_type product;
+  sum_type sum_of_squares;
+  T min;
+  T max;
+  bool any;
+  bool all;
+  var_std<double> moments;
+
+  static CUDA_HOST_DEVICE_CALLABLE column_summary identity()
+  {
+    return column_summary{0,
+                          sum_type{0},
+                          sum_type{1},
+                          sum_type{0},
+                          cudf::DeviceMin::identity<T>(),
+                          cudf::DeviceMax::identity<T>(),
+                          false,
+                          true,
+                          var_std<double>{}};
+  }
+};
+
+/**
+ * @brief Computes the summary of a single element of a column.
+ */
+template <typename T>
+struct element_summary_fn {
+  column_device_view d_col;
+
+  __device__ column_summary<T> operator()(size_type index) const
+  {
+    if (d_col.is_null(index)) { return column_summary<T>::identity(); }
+    using sum_type          = typename column_summary<T>::sum_type;
+    auto const value        = d_col.element<T>(index);
+    auto const sum_value    = static_cast<sum_type>(value);
+    auto const double_value = static_cast<double>(value);
+    return column_summary<T>{1,
+                             sum_value,
+                             sum_value,
+                             sum_value * sum_value,
+                             value,
+                             value,
+                             static_cast<bool>(value),
+                             static_cast<bool>(value),
+                             var_std<double>{double_value, double_value * double_value}};
+  }
+};
+
+/**
+ * @brief Combines the summaries of two ranges of a column.
+ */
+template <typename T>
+struct combine_summaries_fn {
+  __device__ column_summary<T> operator()(column_summary<T> const& lhs,
+                                          column_summary<T> const& rhs) const
+  {
+    return column_summary<T>{lhs.valid_count + rhs.valid_count,
+                             lhs.sum + rhs.sum,
+                             lhs.product * rhs.product,
+                             lhs.sum_of_squares + rhs.sum_of_squares,
+                             cudf::DeviceMin{}(lhs.min, rhs.min),
+                             cudf::DeviceMax{}(lhs.max, rhs.max),
+                             lhs.any || rhs.any,
+                             lhs.all && rhs.all,
+                             lhs.moments + rhs.moments};
+  }
+};
+
+/**
+ * @brief Returns the size of the summary of a column, or 0 for columns that are not summarized.
+ */
+struct summary_size_fn {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  std::size_t operator()()
+  {
+    return sizeof(column_summary<T>);
+  }
+
+  template <typename T, std::enable_if_t<not std::is_arithmetic<T>::value>* = nullptr>
+  std::size_t operator()()
+  {
+    return 0;
+  }
+};
+
+/**
+ * @brief Reduces a column to its summary in device memory.
+ */
+struct summarize_column_fn {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  void operator()(column_view const& col, void* d_summary, rmm::cuda_stream_view stream)
+  {
+    auto const d_col = column_device_view::create(col, stream);
+    auto d_in        = thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                element_summary_fn<T>{*d_col});
+    auto d_out       = static_cast<column_summary<T>*>(d_summary);
+    auto identity    = column_summary<T>::identity();
+
+    rmm::device_buffer d_temp_storage;
+    size_t temp_storage_bytes = 0;
+    cub::DeviceReduce::Reduce(d_temp_storage.data(),
+                              temp_storage_bytes,
+                              d_in,
+                              d_out,
+                              col.size(),
+                              combine_summaries_fn<T>{},
+                              identity,
+                              stream.value());
+    d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
+    cub::DeviceReduce::Reduce(d_temp_storage.data(),
+                              temp_storage_bytes,
+                              d_in,
+                              d_out,
+                              col.size(),
+                              combine_summaries_fn<T>{},
+                              identity,
+                              stream.value());
+  }
+
+  template <typename T, std::enable_if_t<not std::is_arithmetic<T>::value>* = nullptr>
+  void operator()(column_view const&, void*, rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Only numeric columns are summarized");
+  }
+};
+
+/**
+ * @brief Computes the summary aggregations of a column from its summary copied to the host.
+ *
+ * The scalars of the aggregations that are not computed from the summary are null.
+ */
+struct make_summary_scalars_fn {
+  template <typename T, std::enable_if_t<std::is_arithmetic<T>::value>* = nullptr>
+  std::vector<std::unique_ptr<scalar>> operator()(
+    uint8_t const* h_summary,
+    column_view const& col,
+    std::vector<std::unique_ptr<aggregation>> const& aggs,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr)
+  {
+    using sum_type = typename column_summary<T>::sum_type;
+    column_summary<T> summary;
+    std::memcpy(&summary, h_summary, sizeof(summary));
+
+    auto const count    = summary.valid_count;
+    auto const is_valid = count > 0;
+    auto make_sum       = [&](sum_type value) {
+      return std::make_unique<numeric_scalar<sum_type>>(value, is_valid, stream, mr);
+    };
+    auto make_element = [&](T value) {
+      return std::make_unique<numeric_scalar<T>>(value, is_valid, stream, mr);
+    };
+    auto make_double = [&](double value) {
+      return std::make_unique<numeric_scalar<double>>(value, is_valid, stream, mr);
+    };
+    auto make_bool = [&](bool value) {
+      return std::make_unique<numeric_scalar<bool>>(value, is_valid, stream, mr);
+    };
+    auto make_count = [&](size_type value) {
+      return std::make_unique<numeric_scalar<size_type>>(value, true, stream, mr);
+    };
+
+    std::vector<std::unique_ptr<scalar>> results;
+    for (auto const& agg : aggs) {
+      switch (agg->kind) {
+        case aggregation::SUM: results.push_back(make_sum(summary.sum)); break;
+        case aggregation::PRODUCT: results.push_back(make_sum(summary.product)); break;
+        case aggregation::SUM_OF_SQUARES:
+          results.push_back(make_sum(summary.sum_of_squares));
+          break;
+        case aggregation::MIN: results.push_back(make_element(summary.min)); break;
+        case aggregation::MAX: results.push_back(make_element(summary.max)); break;
+        case aggregation::MEAN:
+          results.push_back(make_double(
+            op::mean::intermediate<double>::compute_result(summary.moments.value, count, 0)));
+          break;
+        case aggregation::VARIANCE: {
+          auto const ddof = static_cast<cudf::detail::var_aggregation const*>(agg.get())->_ddof;
+          results.push_back(make_double(
+            op::variance::intermediate<double>::compute_result(summary.moments, count, ddof)));
+        } break;
+        case aggregation::STD: {
+          auto const ddof = static_cast<cudf::detail::std_aggregation const*>(agg.get())->_ddof;
+          using std_result = op::standard_deviation::intermediate<double>;
+          results.push_back(make_double(std_result::compute_result(summary.moments, count, ddof)));
+        } break;
+        case aggregation::ANY: results.push_back(make_bool(summary.any)); break;
+        case aggregation::ALL: results.push_back(make_bool(summary.all)); break;
+        case aggregation::COUNT_VALID: results.push_back(make_count(count)); break;
+        case aggregation::COUNT_ALL: results.push_back(make_count(col.size())); break;
+        default: results.push_back(nullptr);
+      }
+    }
+    return results;
+  }
+
+  template <typename T, std::enable_if_t<not std::is_arithmetic<T>::value>* = nullptr>
+  std::vector<std::unique_ptr<scalar>> operator()(uint8_t const*,
+                                                  column_view const&,
+                                                  std::vector<std::unique_ptr<aggregation>> const&,
+                                                  rmm::cuda_stream_view,
+                                                  rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Only numeric columns are summarized");
+  }
+};
+
+}  // namespace
+
+std::vector<std::vector<std::unique_ptr<scalar>>> fused_reduce(
+  table_view const& input,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  std::vector<std::vector<std::unique_ptr<scalar>>> results(input.num_columns());
+  bool const has_summary_aggregation = std::any_of(
+    aggs.begin(), aggs.end(), [](auto const& agg) { return is_summary_aggregation(agg->kind); });
+
+  // The summaries of all the numeric columns are laid out in a single buffer
+  std::vector<std::size_t> summary_offsets(input.num_columns() + 1, 0);
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const type = input.column(i).type();
+    auto const size = has_summary_aggregation && is_numeric(type)
+                        ? type_dispatcher(type, summary_size_fn{})
+                        : std::size_t{0};
+    summary_offsets[i + 1] =
+      summary_offsets[i] + (size + SUMMARY_ALIGNMENT - 1) / SUMMARY_ALIGNMENT * SUMMARY_ALIGNMENT;
+  }
+
+  rmm::device_buffer d_summaries(summary_offsets.back(), stream);
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    if (summary_offsets[i + 1] == summary_offsets[i]) { continue; }
+    type_dispatcher(input.column(i).type(),
+                    summarize_column_fn{},
+                    input.column(i),
+                    static_cast<uint8_t*>(d_summaries.data()) + summary_offsets[i],
+                    stream);
+  }
+
+  // All the summaries are copied to the host with a single transfer
+  std::vector<uint8_t> h_summaries(summary_offsets.back());
+  CUDA_TRY(cudaMemcpyAsync(h_summaries.data(),
+                           d_summaries.data(),
+                           h_summaries.size(),
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  stream.synchronize();
+
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    if (summary_offsets[i + 1] == summary_offsets[i]) {
+      results[i].resize(aggs.size());
+      continue;
+    }
+    results[i] = type_dispatcher(input.column(i).type(),
+                                 make_summary_scalars_fn{},
+                                 h_summaries.data() + summary_offsets[i],
+                                 input.column(i),
+                                 aggs,
+                                 stream,
+                                 mr);
+  }
+  return results;
+}
+
+}  // namespace reduction
+}  // namespace cudf
@@ -18,6 +18,8 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction_functions.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/device_operators.cuh>
 #include <cudf/dictionary/dictionary_column_view.hpp>
@@ -74,7 +76,8 @@ rmm::device_scalar<OutputType> reduce_device(InputIterator d_in,
                                              rmm::cuda_stream_view stream)
 {
   OutputType identity{};
-  rmm::device_scalar<OutputType> result{identity, stream};
+  // The result is written by the reduction, so it is not initialized from the host
+  rmm::device_scalar<OutputType> result{stream};
 
   // Allocate temporary storage
   size_t storage_bytes = 0;
@@ -244,8 +247,57 @@ struct minmax_functor {
   }
 };
 
+/**
+ * @brief Dispatch functor for the minmax operation into existing scalars.
+ *
+ * The minimum and maximum are copied to the scalars by a kernel and their validity set by
+ * memsets, so nothing is copied between host and device memory.
+ */
+struct minmax_into_functor {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return cudf::is_fixed_width<T>() and !cudf::is_fixed_point<T>() and !cudf::is_dictionary<T>();
+  }
+
+  template <typename T, std::enable_if_t<is_supported<T>()> * = nullptr>
+  void operator()(cudf::column_view const &col,
+                  scalar &minimum,
+                  scalar &maximum,
+                  rmm::cuda_stream_view stream)
+  {
+    using ScalarType = cudf::scalar_type_t<T>;
+    auto dev_result  = minmax_functor{}.template reduce<T>(col, stream);
+    device_single_thread(
+      minmax_functor::assign_min_max<T>{dev_result.data(),
+                                        static_cast<ScalarType &>(minimum).data(),
+                                        static_cast<ScalarType &>(maximum).data()},
+      stream);
+
+    auto const is_valid = col.null_count() < col.size();
+    CUDA_TRY(cudaMemsetAsync(minimum.validity_data(), is_valid, sizeof(bool), stream.value()));
+    CUDA_TRY(cudaMemsetAsync(maximum.validity_data(), is_valid, sizeof(bool), stream.value()));
+  }
+
+  template <typename T, std::enable_if_t<!is_supported<T>()> * = nullptr>
+  void operator()(cudf::column_view const &, scalar &, scalar &, rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("type not supported for minmax_into() operation");
+  }
+};
+
 }  // namespace
 
+void minmax_into(cudf::column_view const &col,
+                 scalar &minimum,
+                 scalar &maximum,
+                 rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(minimum.type() == col.type() && maximum.type() == col.type(),
+               "minmax_into() operation requires matching output types");
+  type_dispatcher(col.type(), minmax_into_functor{}, col, minimum, maximum, stream);
+}
+
 std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>> minmax(
   cudf::column_view const &col, rmm::cuda_stream_view stream, rmm::mr::device_memory_resource *mr)
 {
@@ -269,4 +321,16 @@ std::pair<std::unique_ptr<scalar>, std::unique_ptr<scalar>> minmax(
   return detail::minmax(col, rmm::cuda_stream_default, mr);
 }
 
+/**
+ * @copydoc cudf::minmax_into
+ */
+void minmax_into(const column_view &col,
+                 scalar &minimum,
+                 scalar &maximum,
+                 rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  detail::minmax_into(col, minimum, maximum, stream);
+}
+
 }  // namespace cudf
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction_functions.hpp>
+#include <cudf/detail/reduction_operators.cuh>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <cub/device/device_reduce.cuh>
+
+#include <thrust/iterator/transform_iterator.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Dispatcher for reducing a column into an existing scalar with the reduction operator
+ * `Op`.
+ *
+ * The result is written by the reduction kernel and the validity by a memset, so nothing is
+ * copied from host memory, which would synchronize the stream.
+ *
+ * @tparam Op The reduction operator of `cudf::reduction::op`
+ * @tparam same_result_type Whether the result type must match the element type, as it must for
+ * `min` and `max`
+ */
+template <typename Op, bool same_result_type>
+struct reduce_into_dispatcher {
+  template <typename ElementType, typename ResultType>
+  static constexpr bool is_supported()
+  {
+    if (same_result_type) {
+      return std::is_same<ElementType, ResultType>::value && cudf::is_fixed_width<ElementType>() &&
+             not cudf::is_fixed_point<ElementType>();
+    }
+    return std::is_arithmetic<ElementType>::value && std::is_arithmetic<ResultType>::value;
+  }
+
+  template <typename ElementType,
+            typename ResultType,
+            std::enable_if_t<is_supported<ElementType, ResultType>()>* = nullptr>
+  void operator()(column_view const& col, scalar& output, rmm::cuda_stream_view stream)
+  {
+    auto const d_col = column_device_view::create(col, stream);
+    auto d_out       = static_cast<scalar_type_t<ResultType>&>(output).data();
+    auto simple_op   = Op{};
+    auto binary_op   = simple_op.get_binary_op();
+    auto identity    = simple_op.template get_identity<ResultType>();
+
+    auto reduce = [&](auto d_in) {
+      rmm::device_buffer d_temp_storage;
+      size_t temp_storage_bytes = 0;
+      cub::DeviceReduce::Reduce(d_temp_storage.data(),
+                                temp_storage_bytes,
+                                d_in,
+                                d_out,
+                                col.size(),
+                                binary_op,
+                                identity,
+                                stream.value());
+      d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
+      cub::DeviceReduce::Reduce(d_temp_storage.data(),
+                                temp_storage_bytes,
+                                d_in,
+                                d_out,
+                                col.size(),
+                                binary_op,
+                                identity,
+                                stream.value());
+    };
+
+    if (col.has_nulls()) {
+      auto f = simple_op.template get_null_replacing_element_transformer<ResultType>();
+      reduce(thrust::make_transform_iterator(d_col->pair_begin<ElementType, true>(), f));
+    } else {
+      auto f = simple_op.template get_element_transformer<ResultType>();
+      reduce(thrust::make_transform_iterator(d_col->begin<ElementType>(), f));
+    }
+
+    CUDA_TRY(cudaMemsetAsync(
+      output.validity_data(), col.null_count() < col.size(), sizeof(bool), stream.value()));
+  }
+
+  template <typename ElementType,
+            typename ResultType,
+            std::enable_if_t<not is_supported<ElementType, ResultType>()>* = nullptr>
+  void operator()(column_view const&, scalar&, rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Reduction operator not supported for this type");
+  }
+};
+
+template <typename Op, bool same_result_type>
+void reduce_into_with_op(column_view const& col, scalar& output, rmm::cuda_stream_view stream)
+{
+  double_type_dispatcher(col.type(),
+                         output.type(),
+                         reduce_into_dispatcher<Op, same_result_type>{},
+                         col,
+                         output,
+                         stream);
+}
+
+}  // namespace
+
+void reduce_into(column_view const& col,
+                 std::unique_ptr<aggregation> const& agg,
+                 scalar& output,
+                 rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(not is_dictionary(col.type()), "Dictionary columns are not supported");
+
+  switch (agg->kind) {
+    case aggregation::SUM:
+      return reduce_into_with_op<reduction::op::sum, false>(col, output, stream);
+    case aggregation::PRODUCT:
+      return reduce_into_with_op<reduction::op::product, false>(col, output, stream);
+    case aggregation::SUM_OF_SQUARES:
+      return reduce_into_with_op<reduction::op::sum_of_squares, false>(col, output, stream);
+    case aggregation::MIN:
+      CUDF_EXPECTS(col.type() == output.type(), "min() operation requires matching output type");
+      return reduce_into_with_op<reduction::op::min, true>(col, output, stream);
+    case aggregation::MAX:
+      CUDF_EXPECTS(col.type() == output.type(), "max() operation requires matching output type");
+      return reduce_into_with_op<reduction::op::max, true>(col, output, stream);
+    case aggregation::ANY:
+      CUDF_EXPECTS(output.type().id() == type_id::BOOL8,
+                   "any() operation can be applied with output type `bool8` only");
+      return reduce_into_with_op<reduction::op::max, false>(col, output, stream);
+    case aggregation::ALL:
+      CUDF_EXPECTS(output.type().id() == type_id::BOOL8,
+                   "all() operation can be applied with output type `bool8` only");
+      return reduce_into_with_op<reduction::op::min, false>(col, output, stream);
+    default: CUDF_FAIL("Unsupported reduction operator for reduce_into");
+  }
+}
+
+}  // namespace detail
+
+void reduce_into(column_view const& col,
+                 std::unique_ptr<aggregation> const& agg,
+                 scalar& output,
+                 rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  detail::reduce_into(col, agg, output, stream);
+}
+
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,16 +16,22 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/aggregation/hyperloglog.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/quantiles.hpp>
 #include <cudf/detail/reduction_functions.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/reduction.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -43,6 +49,14 @@ struct reduce_dispatch_functor {
   {
   }
 
+  /// Labels all the elements of the column as one group
+  rmm::device_uvector<size_type> all_zero_labels() const
+  {
+    rmm::device_uvector<size_type> labels(col.size(), stream);
+    CUDA_TRY(cudaMemsetAsync(labels.data(), 0, labels.size() * sizeof(size_type), stream.value()));
+    return labels;
+  }
+
   template <aggregation::Kind k>
   std::unique_ptr<scalar> operator()(std::unique_ptr<aggregation> const &agg)
   {
@@ -66,6 +80,11 @@ struct reduce_dispatch_functor {
         return reduction::standard_deviation(col, output_dtype, var_agg->_ddof, stream, mr);
       } break;
       case aggregation::MEDIAN: {
+        if (is_quantile_by_selection_supported(col.type(), {0.5}, interpolation::LINEAR)) {
+          auto col_ptr =
+            quantile_by_selection(col, {0.5}, interpolation::LINEAR, true, stream, mr);
+          return get_element(*col_ptr, 0, stream, mr);
+        }
         auto sorted_indices = sorted_order(table_view{{col}}, {}, {null_order::AFTER}, stream, mr);
         auto valid_sorted_indices = split(*sorted_indices, {col.size() - col.null_count()})[0];
         auto col_ptr =
@@ -76,6 +95,12 @@ struct reduce_dispatch_functor {
         auto quantile_agg = static_cast<quantile_aggregation const *>(agg.get());
         CUDF_EXPECTS(quantile_agg->_quantiles.size() == 1,
                      "Reduction quantile accepts only one quantile value");
+        if (is_quantile_by_selection_supported(
+              col.type(), quantile_agg->_quantiles, quantile_agg->_interpolation)) {
+          auto col_ptr = quantile_by_selection(
+            col, quantile_agg->_quantiles, quantile_agg->_interpolation, true, stream, mr);
+          return get_element(*col_ptr, 0, stream, mr);
+        }
         auto sorted_indices = sorted_order(table_view{{col}}, {}, {null_order::AFTER}, stream, mr);
         auto valid_sorted_indices = split(*sorted_indices, {col.size() - col.null_count()})[0];
 
@@ -100,6 +125,27 @@ struct reduce_dispatch_functor {
         auto nth_agg = static_cast<nth_element_aggregation const *>(agg.get());
         return reduction::nth_element(col, nth_agg->_n, nth_agg->_null_handling, stream, mr);
       } break;
+      case aggregation::APPROX_COUNT_DISTINCT: {
+        CUDF_EXPECTS(output_dtype.id() == type_id::INT64,
+                     "APPROX_COUNT_DISTINCT reduction requires an INT64 output type");
+        auto hll_agg = static_cast<hll_aggregation const *>(agg.get());
+        auto estimate =
+          group_approx_count_distinct(col, all_zero_labels(), 1, hll_agg->_precision, stream, mr);
+        return get_element(*estimate, 0, stream, mr);
+      } break;
+      case aggregation::HLL_SKETCH: {
+        auto hll_agg = static_cast<hll_aggregation const *>(agg.get());
+        auto sketch  = group_hll_sketch(col, all_zero_labels(), 1, hll_agg->_precision, stream, mr);
+        return std::make_unique<list_scalar>(
+          lists_column_view(*sketch).child(), true, stream, mr);
+      } break;
+      case aggregation::MERGE_HLL_SKETCH: {
+        auto const offsets       = std::vector<size_type>{0, col.size()};
+        auto const group_offsets = make_device_uvector_sync(offsets, stream);
+        auto sketch = group_merge_hll_sketch(col, group_offsets, 1, stream, mr);
+        return std::make_unique<list_scalar>(
+          lists_column_view(*sketch).child(), true, stream, mr);
+      } break;
       default: CUDF_FAIL("Unsupported reduction operator");
     }
   }
@@ -122,6 +168,25 @@ std::unique_ptr<scalar> reduce(
     aggregation_dispatcher(agg->kind, reduce_dispatch_functor{col, output_dtype, stream, mr}, agg);
   return result;
 }
+
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce(
+  table_view const &input,
+  std::vector<std::unique_ptr<aggregation>> const &aggs,
+  rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource())
+{
+  auto results = reduction::fused_reduce(input, aggs, stream, mr);
+
+  // The aggregations not computed in a single pass are reduced one at a time
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const col = input.column(i);
+    for (std::size_t j = 0; j < aggs.size(); ++j) {
+      if (results[i][j]) { continue; }
+      results[i][j] = reduce(col, aggs[j], target_type(col.type(), aggs[j]->kind), stream, mr);
+    }
+  }
+  return results;
+}
 }  // namespace detail
 
 std::unique_ptr<scalar> reduce(column_view const &col,
@@ -133,4 +198,13 @@ std::unique_ptr<scalar> reduce(column_view const &col,
   return detail::reduce(col, agg, output_dtype, rmm::cuda_stream_default, mr);
 }
 
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce(
+  table_view const &input,
+  std::vector<std::unique_ptr<aggregation>> const &aggs,
+  rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce(input, aggs, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
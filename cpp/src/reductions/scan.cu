@@ -21,6 +21,7 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/rank_scan.cuh>
 #include <cudf/detail/utilities/device_operators.cuh>
 #include <cudf/null_mask.hpp>
 #include <cudf/reduction.hpp>
@@ -33,6 +34,80 @@
 
 namespace cudf {
 namespace detail {
+namespace {
+
+/**
+ * @brief Returns the position of the first null element of `input_view`, or its size if it has
+ * no nulls.
+ */
+size_type first_null_position(column_view const& input_view, rmm::cuda_stream_view stream)
+{
+  if (not input_view.has_nulls()) { return input_view.size(); }
+  auto d_input = column_device_view::create(input_view, stream);
+  auto v       = detail::make_validity_iterator(*d_input);
+  return thrust::find_if_not(
+           rmm::exec_policy(stream), v, v + input_view.size(), thrust::identity<bool>{}) -
+         v;
+}
+
+/**
+ * @brief Returns the position of the first valid element of `input_view`, or its size if it has
+ * none.
+ */
+size_type first_valid_position(column_view const& input_view, rmm::cuda_stream_view stream)
+{
+  if (not input_view.has_nulls()) { return 0; }
+  auto d_input = column_device_view::create(input_view, stream);
+  auto v       = detail::make_validity_iterator(*d_input);
+  return thrust::find(rmm::exec_policy(stream), v, v + input_view.size(), true) - v;
+}
+
+/**
+ * @brief Returns whether the string scan result of a row is valid.
+ *
+ * Only the rows in [valid_begin, valid_end) may be valid. When `check_input` is set, which is
+ * the case for `null_policy::EXCLUDE`, a null input row is also a null result row.
+ */
+struct string_scan_validity_fn {
+  column_device_view d_input;
+  bool check_input;
+  size_type valid_begin;
+  size_type valid_end;
+
+  __device__ bool operator()(size_type index) const
+  {
+    return index >= valid_begin && index < valid_end &&
+           (not check_input || d_input.is_valid(index));
+  }
+};
+
+/**
+ * @brief Makes a strings column of the scan results of a strings column.
+ *
+ * The null rows are set from the input validity by `is_valid`, rather than by comparing the
+ * results with the scan identity, since a valid result can be the identity itself. This is the
+ * case for the empty string and a max scan.
+ */
+std::unique_ptr<column> make_string_scan_column(device_span<string_view const> results,
+                                                string_scan_validity_fn is_valid,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  rmm::device_uvector<thrust::pair<char const*, size_type>> strings(results.size(), stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(results.size()),
+                    strings.begin(),
+                    [results = results.data(), is_valid] __device__(size_type index) {
+                      return is_valid(index)
+                               ? thrust::make_pair(results[index].data(),
+                                                   results[index].size_bytes())
+                               : thrust::make_pair<char const*, size_type>(nullptr, 0);
+                    });
+  return cudf::make_strings_column(strings, stream, mr);
+}
+
+}  // namespace
 
 /**
  * @brief Dispatcher for running Scan operation on input column
@@ -93,7 +168,26 @@ struct scan_dispatcher {
                                          rmm::cuda_stream_view stream,
                                          rmm::mr::device_memory_resource* mr)
   {
-    CUDF_FAIL("String types supports only inclusive min/max for `cudf::scan`");
+    const size_type size = input_view.size();
+    rmm::device_uvector<T> result(size, stream);
+
+    auto d_input        = column_device_view::create(input_view, stream);
+    auto const identity = Op::template identity<T>();
+
+    auto input = make_null_replacement_iterator(*d_input, identity, input_view.has_nulls());
+    thrust::exclusive_scan(
+      rmm::exec_policy(stream), input, input + size, result.data(), identity, Op{});
+
+    // A row is null when no valid element precedes it, or for null_policy::INCLUDE when a null
+    // precedes it
+    bool const check_input = null_handling == null_policy::EXCLUDE;
+    auto const valid_end =
+      check_input ? size : std::min(first_null_position(input_view, stream) + 1, size);
+    auto const valid_begin = first_valid_position(input_view, stream) + 1;
+
+    CHECK_CUDA(stream.value());
+    return make_string_scan_column(
+      result, string_scan_validity_fn{*d_input, check_input, valid_begin, valid_end}, stream, mr);
   }
 
   rmm::device_buffer mask_inclusive_scan(const column_view& input_view,
@@ -102,16 +196,10 @@ struct scan_dispatcher {
   {
     rmm::device_buffer mask =
       detail::create_null_mask(input_view.size(), mask_state::UNINITIALIZED, stream, mr);
-    auto d_input = column_device_view::create(input_view, stream);
-    auto v       = detail::make_validity_iterator(*d_input);
-    auto first_null_position =
-      thrust::find_if_not(
-        rmm::exec_policy(stream), v, v + input_view.size(), thrust::identity<bool>{}) -
-      v;
-    cudf::set_null_mask(
-      static_cast<cudf::bitmask_type*>(mask.data()), 0, first_null_position, true);
+    auto const first_null = first_null_position(input_view, stream);
+    cudf::set_null_mask(static_cast<cudf::bitmask_type*>(mask.data()), 0, first_null, true);
     cudf::set_null_mask(
-      static_cast<cudf::bitmask_type*>(mask.data()), first_null_position, input_view.size(), false);
+      static_cast<cudf::bitmask_type*>(mask.data()), first_null, input_view.size(), false);
     return mask;
   }
 
@@ -162,20 +250,14 @@ struct scan_dispatcher {
       make_null_replacement_iterator(*d_input, Op::template identity<T>(), input_view.has_nulls());
     thrust::inclusive_scan(rmm::exec_policy(stream), input, input + size, result.data(), Op{});
 
-    CHECK_CUDA(stream.value());
+    // A row is null when it is null for null_policy::EXCLUDE, or when it or a preceding row is
+    // null for null_policy::INCLUDE
+    bool const check_input = null_handling == null_policy::EXCLUDE;
+    auto const valid_end   = check_input ? size : first_null_position(input_view, stream);
 
-    auto output_column =
-      cudf::make_strings_column(result, Op::template identity<string_view>(), stream, mr);
-    if (null_handling == null_policy::EXCLUDE) {
-      output_column->set_null_mask(detail::copy_bitmask(input_view, stream, mr),
-                                   input_view.null_count());
-    } else {
-      if (input_view.nullable()) {
-        output_column->set_null_mask(mask_inclusive_scan(input_view, stream, mr),
-                                     cudf::UNKNOWN_NULL_COUNT);
-      }
-    }
-    return output_column;
+    CHECK_CUDA(stream.value());
+    return make_string_scan_column(
+      result, string_scan_validity_fn{*d_input, check_input, 0, valid_end}, stream, mr);
   }
 
  public:
@@ -201,7 +283,10 @@ struct scan_dispatcher {
                     ? inclusive_scan<T>(input, null_handling, stream, mr)
                     : exclusive_scan<T>(input, null_handling, stream, mr);
 
-    if (null_handling == null_policy::EXCLUDE) {
+    // An exclusive string scan also nulls the rows not preceded by any valid element
+    bool const is_string_exclusive =
+      std::is_same<T, string_view>::value && inclusive == scan_type::EXCLUSIVE;
+    if (null_handling == null_policy::EXCLUDE && not is_string_exclusive) {
       CUDF_EXPECTS(input.null_count() == output->null_count(),
                    "Input / output column null count mismatch");
     }
@@ -228,6 +313,19 @@ std::unique_ptr<column> scan(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
+  if (agg->kind == aggregation::RANK || agg->kind == aggregation::DENSE_RANK) {
+    CUDF_EXPECTS(inclusive == scan_type::INCLUSIVE,
+                 "Rank aggregations are only supported for inclusive scans");
+    bool const dense = agg->kind == aggregation::DENSE_RANK;
+    // The whole column is a single group
+    return rank_generator(input,
+                          thrust::make_constant_iterator<size_type>(0),
+                          thrust::make_constant_iterator<size_type>(0),
+                          dense,
+                          stream,
+                          mr);
+  }
+
   CUDF_EXPECTS(
     is_numeric(input.type()) || is_compound(input.type()) || is_fixed_point(input.type()),
     "Unexpected non-numeric or non-string type.");
@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction_functions.hpp>
+#include <cudf/detail/reduction_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/reduction.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cub/device/device_segmented_reduce.cuh>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Reduces each segment of `d_in` defined by `offsets` into `d_out`.
+ */
+template <typename InputIterator, typename OutputType, typename BinaryOp>
+void reduce_segments(InputIterator d_in,
+                     device_span<size_type const> offsets,
+                     OutputType* d_out,
+                     BinaryOp binary_op,
+                     OutputType identity,
+                     rmm::cuda_stream_view stream)
+{
+  auto const num_segments = static_cast<int>(offsets.size()) - 1;
+
+  rmm::device_buffer d_temp_storage;
+  size_t temp_storage_bytes = 0;
+  cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(),
+                                     temp_storage_bytes,
+                                     d_in,
+                                     d_out,
+                                     num_segments,
+                                     offsets.data(),
+                                     offsets.data() + 1,
+                                     binary_op,
+                                     identity,
+                                     stream.value());
+  d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
+  cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(),
+                                     temp_storage_bytes,
+                                     d_in,
+                                     d_out,
+                                     num_segments,
+                                     offsets.data(),
+                                     offsets.data() + 1,
+                                     binary_op,
+                                     identity,
+                                     stream.value());
+}
+
+/**
+ * @brief Returns 1 for a valid element of a column and 0 for a null element.
+ */
+struct valid_element_count_fn {
+  column_device_view d_col;
+
+  __device__ size_type operator()(size_type index) const
+  {
+    return static_cast<size_type>(d_col.is_valid_nocheck(index));
+  }
+};
+
+/**
+ * @brief Returns the number of valid elements of each segment of `d_col`.
+ */
+rmm::device_uvector<size_type> segment_valid_counts(column_device_view const& d_col,
+                                                    device_span<size_type const> offsets,
+                                                    rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<size_type> valid_counts(offsets.size() - 1, stream);
+  auto valid_elements = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0), valid_element_count_fn{d_col});
+  reduce_segments(
+    valid_elements, offsets, valid_counts.data(), cudf::DeviceSum{}, size_type{0}, stream);
+  return valid_counts;
+}
+
+/**
+ * @brief Determines whether the reduction of a segment is valid.
+ *
+ * An empty segment reduces to null. Otherwise the reduction of a segment is null if all of its
+ * elements are null for `null_policy::EXCLUDE`, or if any of them is for `null_policy::INCLUDE`.
+ */
+struct segment_is_valid_fn {
+  size_type const* offsets;
+  size_type const* valid_counts;  ///< Valid elements of each segment, or null if there are no nulls
+  null_policy null_handling;
+
+  __device__ bool operator()(size_type segment) const
+  {
+    auto const segment_size = offsets[segment + 1] - offsets[segment];
+    auto const valid_count  = valid_counts != nullptr ? valid_counts[segment] : segment_size;
+    return null_handling == null_policy::EXCLUDE
+             ? valid_count > 0
+             : segment_size > 0 && valid_count == segment_size;
+  }
+};
+
+/**
+ * @brief Dispatcher for running a segmented reduction of the reduction operator `Op`.
+ *
+ * @tparam Op The reduction operator of `cudf::reduction::op`
+ * @tparam same_result_type Whether the result type must match the element type, as it must for
+ * `min` and `max`
+ */
+template <typename Op, bool same_result_type>
+struct segmented_reduce_dispatcher {
+  template <typename ElementType, typename ResultType>
+  static constexpr bool is_supported()
+  {
+    if (same_result_type) {
+      return std::is_same<ElementType, ResultType>::value && cudf::is_fixed_width<ElementType>() &&
+             not cudf::is_fixed_point<ElementType>();
+    }
+    return std::is_arithmetic<ElementType>::value && std::is_arithmetic<ResultType>::value;
+  }
+
+  template <typename ElementType,
+            typename ResultType,
+            std::enable_if_t<is_supported<ElementType, ResultType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& col,
+                                     device_span<size_type const> offsets,
+                                     null_policy null_handling,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    auto const num_segments = static_cast<size_type>(offsets.size()) - 1;
+    auto result             = make_fixed_width_column(
+      data_type{type_to_id<ResultType>()}, num_segments, mask_state::UNALLOCATED, stream, mr);
+    auto const d_col = column_device_view::create(col, stream);
+    auto simple_op   = Op{};
+    auto identity    = simple_op.template get_identity<ResultType>();
+
+    if (col.has_nulls()) {
+      auto f  = simple_op.template get_null_replacing_element_transformer<ResultType>();
+      auto it = thrust::make_transform_iterator(d_col->pair_begin<ElementType, true>(), f);
+      reduce_segments(it,
+                      offsets,
+                      result->mutable_view().data<ResultType>(),
+                      simple_op.get_binary_op(),
+                      identity,
+                      stream);
+    } else {
+      auto f  = simple_op.template get_element_transformer<ResultType>();
+      auto it = thrust::make_transform_iterator(d_col->begin<ElementType>(), f);
+      reduce_segments(it,
+                      offsets,
+                      result->mutable_view().data<ResultType>(),
+                      simple_op.get_binary_op(),
+                      identity,
+                      stream);
+    }
+
+    // The valid elements of each segment are counted only when there are nulls
+    auto const valid_counts = col.has_nulls() ? segment_valid_counts(*d_col, offsets, stream)
+                                              : rmm::device_uvector<size_type>(0, stream);
+
+    auto null_mask = detail::valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_segments),
+      segment_is_valid_fn{
+        offsets.data(), col.has_nulls() ? valid_counts.data() : nullptr, null_handling},
+      stream,
+      mr);
+    result->set_null_mask(std::move(null_mask.first), null_mask.second);
+    return result;
+  }
+
+  template <typename ElementType,
+            typename ResultType,
+            std::enable_if_t<not is_supported<ElementType, ResultType>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     device_span<size_type const>,
+                                     null_policy,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Segmented reduction operator not supported for this type");
+  }
+};
+
+template <typename Op, bool same_result_type>
+std::unique_ptr<column> segmented_reduce_with_op(column_view const& segmented_values,
+                                                 device_span<size_type const> offsets,
+                                                 data_type output_dtype,
+                                                 null_policy null_handling,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  return double_type_dispatcher(segmented_values.type(),
+                                output_dtype,
+                                segmented_reduce_dispatcher<Op, same_result_type>{},
+                                segmented_values,
+                                offsets,
+                                null_handling,
+                                stream,
+                                mr);
+}
+
+/**
+ * @brief Divides the sum of each segment by its number of valid elements, in place.
+ */
+struct divide_by_count_fn {
+  template <typename ResultType,
+            std::enable_if_t<std::is_floating_point<ResultType>::value>* = nullptr>
+  void operator()(mutable_column_view const& sums,
+                  size_type const* counts,
+                  rmm::cuda_stream_view stream) const
+  {
+    thrust::transform(rmm::exec_policy(stream),
+                      sums.begin<ResultType>(),
+                      sums.end<ResultType>(),
+                      counts,
+                      sums.begin<ResultType>(),
+                      [] __device__(ResultType sum, size_type count) {
+                        // segments without valid elements are null
+                        return count > 0 ? sum / count : sum;
+                      });
+  }
+
+  template <typename ResultType,
+            std::enable_if_t<not std::is_floating_point<ResultType>::value>* = nullptr>
+  void operator()(mutable_column_view const&, size_type const*, rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("Segmented mean can be applied with a floating-point output type only");
+  }
+};
+
+/**
+ * @brief Computes the mean of each segment as its sum divided by its number of valid elements.
+ */
+std::unique_ptr<column> segmented_mean(column_view const& segmented_values,
+                                       device_span<size_type const> offsets,
+                                       data_type output_dtype,
+                                       null_policy null_handling,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_floating_point(output_dtype),
+               "Segmented mean can be applied with a floating-point output type only");
+  auto result = segmented_reduce_with_op<reduction::op::sum, false>(
+    segmented_values, offsets, output_dtype, null_handling, stream, mr);
+
+  auto const d_values = column_device_view::create(segmented_values, stream);
+  auto const counts   = segment_valid_counts(*d_values, offsets, stream);
+  type_dispatcher(
+    output_dtype, divide_by_count_fn{}, result->mutable_view(), counts.data(), stream);
+  return result;
+}
+
+}  // namespace
+
+std::unique_ptr<column> segmented_reduce(column_view const& segmented_values,
+                                         device_span<size_type const> offsets,
+                                         std::unique_ptr<aggregation> const& agg,
+                                         data_type output_dtype,
+                                         null_policy null_handling,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(offsets.size() > 0, "Segment offsets must have at least one element");
+  CUDF_EXPECTS(not is_dictionary(segmented_values.type()),
+               "Segmented reduction does not support dictionary columns");
+
+  if (offsets.size() == 1) { return make_empty_column(output_dtype); }
+
+  switch (agg->kind) {
+    case aggregation::SUM:
+      return segmented_reduce_with_op<reduction::op::sum, false>(
+        segmented_values, offsets, output_dtype, null_handling, stream, mr);
+    case aggregation::PRODUCT:
+      return segmented_reduce_with_op<reduction::op::product, false>(
+        segmented_values, offsets, output_dtype, null_handling, stream, mr);
+    case aggregation::MIN:
+      CUDF_EXPECTS(segmented_values.type() == output_dtype,
+                   "Segmented min requires matching output type");
+      return segmented_reduce_with_op<reduction::op::min, true>(
+        segmented_values, offsets, output_dtype, null_handling, stream, mr);
+    case aggregation::MAX:
+      CUDF_EXPECTS(segmented_values.type() == output_dtype,
+                   "Segmented max requires matching output type");
+      return segmented_reduce_with_op<reduction::op::max, true>(
+        segmented_values, offsets, output_dtype, null_handling, stream, mr);
+    case aggregation::ANY:
+      CUDF_EXPECTS(output_dtype.id() == type_id::BOOL8,
+                   "Segmented any can be applied with output type `bool8` only");
+      return segmented_reduce_with_op<reduction::op::max, false>(
+        segmented_values, offsets, output_dtype, null_handling, stream, mr);
+    case aggregation::ALL:
+      CUDF_EXPECTS(output_dtype.id() == type_id::BOOL8,
+                   "Segmented all can be applied with output type `bool8` only");
+      return segmented_reduce_with_op<reduction::op::min, false>(
+        segmented_values, offsets, output_dtype, null_handling, stream, mr);
+    case aggregation::MEAN:
+      return segmented_mean(segmented_values, offsets, output_dtype, null_handling, stream, mr);
+    default: CUDF_FAIL("Unsupported aggregation operator for segmented reduction");
+  }
+}
+}  // namespace detail
+
+std::unique_ptr<column> segmented_reduce(column_view const& segmented_values,
+                                         device_span<size_type const> offsets,
+                                         std::unique_ptr<aggregation> const& agg,
+                                         data_type output_dtype,
+                                         null_policy null_handling,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_reduce(
+    segmented_values, offsets, agg, output_dtype, null_handling, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
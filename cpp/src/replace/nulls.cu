@@ -26,6 +26,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/replace.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/detail/replace.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/null_mask.hpp>
@@ -34,7 +35,9 @@
 #include <cudf/strings/detail/replace.hpp>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -43,9 +46,14 @@
 
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/reverse_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <map>
+
 namespace {  // anonymous
 
 static constexpr int BLOCK_SIZE = 256;
@@ -410,6 +418,279 @@ std::unique_ptr<cudf::column> replace_nulls_policy_impl(cudf::column_view const&
   return std::move(output->release()[0]);
 }
 
+/**
+ * @brief Device data of a fixed-width column of a table whose null values are replaced, with the
+ *        elements accessed as `Word`s of the same size.
+ */
+template <typename Word>
+struct replace_nulls_column_data {
+  Word const* input;                    // first element of the column
+  cudf::bitmask_type const* null_mask;  // null mask of the column
+  cudf::size_type offset;               // index of the first element in `null_mask`
+  Word const* replacement;              // value of the scalar replacing the nulls
+  cudf::size_type const* gather_map;    // rows of the values replacing the nulls
+  Word* output;
+  cudf::bitmask_type* output_mask;
+};
+
+// Maximum number of columns processed by the blocks of one row range
+static constexpr cudf::size_type MAX_GRID_COLUMNS = 65535;
+// Maximum number of entries of the gather maps of the columns of a table filled by a policy
+static constexpr std::size_t MAX_GATHER_MAP_SIZE = std::size_t{1} << 28;
+
+/**
+ * @brief Replaces the null values of each of the `columns` with its `replacement` scalar.
+ *
+ * Blocks along the y dimension of the grid process different columns.
+ */
+template <typename Word>
+__global__ void replace_nulls_scalar_table(replace_nulls_column_data<Word> const* columns,
+                                           cudf::size_type num_columns,
+                                           cudf::size_type num_rows)
+{
+  for (cudf::size_type c = blockIdx.y; c < num_columns; c += gridDim.y) {
+    auto const column = columns[c];
+    for (cudf::size_type i = blockIdx.x * blockDim.x + threadIdx.x; i < num_rows;
+         i += blockDim.x * gridDim.x) {
+      column.output[i] = cudf::bit_is_set(column.null_mask, column.offset + i)
+                           ? column.input[i]
+                           : *column.replacement;
+    }
+  }
+}
+
+/**
+ * @brief Gathers the rows of each of the `columns` at its `gather_map`, writing the output null
+ *        mask and adding the number of nulls of each column to `null_counts`.
+ *
+ * Blocks along the y dimension of the grid process different columns.
+ */
+template <typename Word>
+__global__ void replace_nulls_policy_table(replace_nulls_column_data<Word> const* columns,
+                                           cudf::size_type num_columns,
+                                           cudf::size_type num_rows,
+                                           cudf::size_type* null_counts)
+{
+  auto const lane_id{threadIdx.x % cudf::detail::warp_size};
+  for (cudf::size_type c = blockIdx.y; c < num_columns; c += gridDim.y) {
+    auto const column = columns[c];
+    cudf::size_type null_count{0};
+
+    cudf::size_type i    = blockIdx.x * blockDim.x + threadIdx.x;
+    uint32_t active_mask = __ballot_sync(0xffffffff, i < num_rows);
+    while (i < num_rows) {
+      auto const source   = column.gather_map[i];
+      auto const is_valid = cudf::bit_is_set(column.null_mask, column.offset + source);
+      column.output[i]    = column.input[source];
+
+      uint32_t const bitmask = __ballot_sync(active_mask, is_valid);
+      if (0 == lane_id) {
+        column.output_mask[cudf::word_index(i)] = bitmask;
+        null_count += __popc(active_mask) - __popc(bitmask);
+      }
+
+      i += blockDim.x * gridDim.x;
+      active_mask = __ballot_sync(active_mask, i < num_rows);
+    }
+    if (0 == lane_id && null_count > 0) { atomicAdd(null_counts + c, null_count); }
+  }
+}
+
+/**
+ * @brief Returns the device pointer to the value of a fixed-width scalar.
+ */
+struct scalar_data_functor {
+  template <typename T, CUDF_ENABLE_IF(cudf::is_fixed_width<T>())>
+  void const* operator()(cudf::scalar const& s)
+  {
+    return static_cast<cudf::scalar_type_t<T> const&>(s).data();
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not cudf::is_fixed_width<T>())>
+  void const* operator()(cudf::scalar const&)
+  {
+    CUDF_FAIL("No specialization exists for the given type.");
+  }
+};
+
+/**
+ * @brief Calls `f` with a value of the unsigned integer type of `size` bytes.
+ */
+template <typename Functor>
+void dispatch_word_size(std::size_t size, Functor f)
+{
+  switch (size) {
+    case 1: f(uint8_t{}); break;
+    case 2: f(uint16_t{}); break;
+    case 4: f(uint32_t{}); break;
+    case 8: f(uint64_t{}); break;
+    default: CUDF_FAIL("Unsupported element size");
+  }
+}
+
+dim3 replace_nulls_table_grid(cudf::size_type num_rows, std::size_t num_columns)
+{
+  cudf::detail::grid_1d const grid{num_rows, BLOCK_SIZE};
+  return dim3(grid.num_blocks,
+              static_cast<unsigned>(std::min<std::size_t>(num_columns, MAX_GRID_COLUMNS)));
+}
+
+/**
+ * @brief Replaces the null values of the `indices` columns of `input`, whose elements are all
+ *        `Word`-sized, with their `replacements` in a single kernel launch.
+ */
+template <typename Word>
+void replace_nulls_scalar_group(
+  cudf::table_view const& input,
+  std::vector<cudf::size_type> const& indices,
+  std::vector<std::reference_wrapper<cudf::scalar const>> const& replacements,
+  std::vector<std::unique_ptr<cudf::column>>& output,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  std::vector<replace_nulls_column_data<Word>> columns;
+  for (auto const i : indices) {
+    auto const& col         = input.column(i);
+    auto const& replacement = replacements[i].get();
+    output[i]               = cudf::make_fixed_width_column(
+      col.type(), col.size(), cudf::mask_state::UNALLOCATED, stream, mr);
+    auto const replacement_data =
+      cudf::type_dispatcher(replacement.type(), scalar_data_functor{}, replacement);
+    columns.push_back({col.data<Word>(),
+                       col.null_mask(),
+                       col.offset(),
+                       static_cast<Word const*>(replacement_data),
+                       nullptr,
+                       output[i]->mutable_view().data<Word>(),
+                       nullptr});
+  }
+  auto const d_columns = cudf::detail::make_device_uvector_async(columns, stream);
+
+  auto const grid = replace_nulls_table_grid(input.num_rows(), columns.size());
+  replace_nulls_scalar_table<<<grid, BLOCK_SIZE, 0, stream.value()>>>(
+    d_columns.data(), static_cast<cudf::size_type>(columns.size()), input.num_rows());
+  CHECK_CUDA(stream.value());
+}
+
+/**
+ * @brief Returns the validity of the row at a position of the concatenated rows of the columns
+ *        filled by a policy, along with its row index in its column.
+ */
+struct policy_row_validity {
+  cudf::bitmask_type const* const* null_masks;
+  cudf::size_type const* offsets;
+  cudf::size_type num_rows;
+
+  __device__ thrust::tuple<cudf::size_type, bool> operator()(std::size_t position) const
+  {
+    auto const c   = position / num_rows;
+    auto const row = static_cast<cudf::size_type>(position % num_rows);
+    return thrust::make_tuple(row, cudf::bit_is_set(null_masks[c], offsets[c] + row));
+  }
+};
+
+struct policy_row_column {
+  cudf::size_type num_rows;
+
+  __device__ std::size_t operator()(std::size_t position) const { return position / num_rows; }
+};
+
+/**
+ * @brief Returns the concatenated gather maps of the `indices` columns of `input`, filled by
+ *        `replace_policy`, computed with a single scan segmented by column.
+ */
+rmm::device_uvector<cudf::size_type> replace_policy_gather_maps(
+  cudf::table_view const& input,
+  std::vector<cudf::size_type> const& indices,
+  cudf::replace_policy const& replace_policy,
+  rmm::cuda_stream_view stream)
+{
+  auto const num_rows = input.num_rows();
+  std::vector<cudf::bitmask_type const*> null_masks;
+  std::vector<cudf::size_type> offsets;
+  for (auto const i : indices) {
+    null_masks.push_back(input.column(i).null_mask());
+    offsets.push_back(input.column(i).offset());
+  }
+  auto const d_null_masks = cudf::detail::make_device_uvector_async(null_masks, stream);
+  auto const d_offsets    = cudf::detail::make_device_uvector_async(offsets, stream);
+
+  auto const size = indices.size() * static_cast<std::size_t>(num_rows);
+  rmm::device_uvector<cudf::size_type> gather_maps(size, stream);
+
+  auto const position = thrust::make_counting_iterator<std::size_t>(0);
+  auto const keys     = thrust::make_transform_iterator(position, policy_row_column{num_rows});
+  auto const values   = thrust::make_transform_iterator(
+    position, policy_row_validity{d_null_masks.data(), d_offsets.data(), num_rows});
+  auto const gm_begin = thrust::make_zip_iterator(
+    thrust::make_tuple(gather_maps.begin(), thrust::make_discard_iterator()));
+
+  auto func = replace_policy_functor();
+  if (replace_policy == cudf::replace_policy::PRECEDING) {
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                  keys,
+                                  keys + size,
+                                  values,
+                                  gm_begin,
+                                  thrust::equal_to<std::size_t>{},
+                                  func);
+  } else {
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                  thrust::make_reverse_iterator(keys + size),
+                                  thrust::make_reverse_iterator(keys),
+                                  thrust::make_reverse_iterator(values + size),
+                                  thrust::make_reverse_iterator(gm_begin + size),
+                                  thrust::equal_to<std::size_t>{},
+                                  func);
+  }
+  return gather_maps;
+}
+
+/**
+ * @brief Gathers the `positions` columns of `batch` of `input`, whose elements are all
+ *        `Word`-sized, at their gather maps in `gather_maps` in a single kernel launch.
+ */
+template <typename Word>
+void replace_nulls_policy_group(cudf::table_view const& input,
+                                std::vector<cudf::size_type> const& batch,
+                                std::vector<std::size_t> const& positions,
+                                cudf::size_type const* gather_maps,
+                                std::vector<std::unique_ptr<cudf::column>>& output,
+                                rmm::cuda_stream_view stream,
+                                rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = input.num_rows();
+  std::vector<replace_nulls_column_data<Word>> columns;
+  for (auto const b : positions) {
+    auto const& col = input.column(batch[b]);
+    auto& out       = output[batch[b]];
+    out             = cudf::make_fixed_width_column(
+      col.type(), num_rows, cudf::mask_state::UNINITIALIZED, stream, mr);
+    auto const out_view = out->mutable_view();
+    columns.push_back({col.data<Word>(),
+                       col.null_mask(),
+                       col.offset(),
+                       nullptr,
+                       gather_maps + b * num_rows,
+                       out_view.data<Word>(),
+                       out_view.null_mask()});
+  }
+  auto const d_columns = cudf::detail::make_device_uvector_async(columns, stream);
+  rmm::device_uvector<cudf::size_type> null_counts(columns.size(), stream);
+  CUDA_TRY(cudaMemsetAsync(
+    null_counts.data(), 0, null_counts.size() * sizeof(cudf::size_type), stream.value()));
+
+  auto const grid = replace_nulls_table_grid(num_rows, columns.size());
+  replace_nulls_policy_table<<<grid, BLOCK_SIZE, 0, stream.value()>>>(
+    d_columns.data(), static_cast<cudf::size_type>(columns.size()), num_rows, null_counts.data());
+  CHECK_CUDA(stream.value());
+
+  auto const h_null_counts = cudf::detail::make_std_vector_sync(null_counts, stream);
+  for (std::size_t k = 0; k < positions.size(); ++k) {
+    output[batch[positions[k]]]->set_null_count(h_null_counts[k]);
+  }
+}
+
 }  // end anonymous namespace
 
 namespace cudf {
@@ -454,6 +735,91 @@ std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
   return replace_nulls_policy_impl(input, replace_policy, stream, mr);
 }
 
+std::unique_ptr<table> replace_nulls(
+  table_view const& input,
+  std::vector<std::reference_wrapper<scalar const>> const& replacements,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(replacements.size() == static_cast<std::size_t>(input.num_columns()),
+               "Number of replacements must match the number of columns");
+
+  std::vector<std::unique_ptr<column>> output(input.num_columns());
+  // the fixed-width columns with nulls to replace, by element size
+  std::map<std::size_t, std::vector<size_type>> groups;
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const& col         = input.column(i);
+    auto const& replacement = replacements[i].get();
+    CUDF_EXPECTS(col.type() == replacement.type(), "Data type mismatch");
+    if (col.has_nulls() && replacement.is_valid() && is_fixed_width(col.type())) {
+      groups[size_of(col.type())].push_back(i);
+    } else {
+      output[i] = replace_nulls(col, replacement, stream, mr);
+    }
+  }
+
+  for (auto const& group : groups) {
+    dispatch_word_size(group.first, [&](auto word) {
+      replace_nulls_scalar_group<decltype(word)>(
+        input, group.second, replacements, output, stream, mr);
+    });
+  }
+  return std::make_unique<table>(std::move(output));
+}
+
+std::unique_ptr<table> replace_nulls(table_view const& input,
+                                     replace_policy const& replace_policy,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  std::vector<std::unique_ptr<column>> output(input.num_columns());
+  std::vector<size_type> nullable_columns;
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    if (input.column(i).has_nulls()) {
+      nullable_columns.push_back(i);
+    } else {
+      output[i] = std::make_unique<column>(input.column(i), stream, mr);
+    }
+  }
+  if (nullable_columns.empty()) { return std::make_unique<table>(std::move(output)); }
+
+  // the columns are processed in batches to bound the memory used by their gather maps
+  auto const num_rows   = input.num_rows();
+  auto const batch_size = std::max<std::size_t>(1, MAX_GATHER_MAP_SIZE / num_rows);
+  for (std::size_t begin = 0; begin < nullable_columns.size(); begin += batch_size) {
+    auto const end = std::min(begin + batch_size, nullable_columns.size());
+    std::vector<size_type> const batch(nullable_columns.begin() + begin,
+                                       nullable_columns.begin() + end);
+    auto const gather_maps = replace_policy_gather_maps(input, batch, replace_policy, stream);
+
+    // the fixed-width columns, by element size
+    std::map<std::size_t, std::vector<std::size_t>> groups;
+    for (std::size_t b = 0; b < batch.size(); ++b) {
+      auto const& col = input.column(batch[b]);
+      if (is_fixed_width(col.type())) {
+        groups[size_of(col.type())].push_back(b);
+        continue;
+      }
+      auto const gather_map = gather_maps.data() + b * num_rows;
+      auto gathered         = cudf::detail::gather(table_view({col}),
+                                           gather_map,
+                                           gather_map + num_rows,
+                                           out_of_bounds_policy::DONT_CHECK,
+                                           stream,
+                                           mr);
+      output[batch[b]]      = std::move(gathered->release()[0]);
+    }
+
+    for (auto const& group : groups) {
+      dispatch_word_size(group.first, [&](auto word) {
+        replace_nulls_policy_group<decltype(word)>(
+          input, batch, group.second, gather_maps.data(), output, stream, mr);
+      });
+    }
+  }
+  return std::make_unique<table>(std::move(output));
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
@@ -480,4 +846,21 @@ std::unique_ptr<cudf::column> replace_nulls(column_view const& input,
   return cudf::detail::replace_nulls(input, replace_policy, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<table> replace_nulls(
+  table_view const& input,
+  std::vector<std::reference_wrapper<scalar const>> const& replacements,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return cudf::detail::replace_nulls(input, replacements, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<table> replace_nulls(table_view const& input,
+                                     replace_policy const& replace_policy,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return cudf::detail::replace_nulls(input, replace_policy, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
@@ -16,7 +16,9 @@
 
 #include <cudf/copying.hpp>
 #include <cudf/detail/gather.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reshape.hpp>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
@@ -131,8 +133,8 @@ struct interleave_columns_functor {
     auto output_size = input.num_columns() * input.num_rows();
     auto output =
       allocate_like(arch_column, output_size, mask_allocation_policy::NEVER, stream, mr);
-    auto device_input  = table_device_view::create(input);
-    auto device_output = mutable_column_device_view::create(*output);
+    auto device_input  = table_device_view::create(input, stream);
+    auto device_output = mutable_column_device_view::create(*output, stream);
     auto index_begin   = thrust::make_counting_iterator<size_type>(0);
     auto index_end     = thrust::make_counting_iterator<size_type>(output_size);
 
@@ -141,10 +143,15 @@ struct interleave_columns_functor {
       return input.column(idx % divisor).element<T>(idx / divisor);
     };
 
-    if (not create_mask) {
+    // nullable columns without nulls need no per-row validity
+    auto const has_nulls =
+      std::any_of(input.begin(), input.end(), [](auto const& col) { return col.has_nulls(); });
+    if (not has_nulls) {
       thrust::transform(
         rmm::exec_policy(stream), index_begin, index_end, device_output->begin<T>(), func_value);
-
+      if (create_mask) {
+        output->set_null_mask(create_null_mask(output_size, mask_state::ALL_VALID, stream, mr), 0);
+      }
       return output;
     }
 
@@ -172,12 +179,11 @@ struct interleave_columns_functor {
 };
 
 }  // anonymous namespace
-}  // namespace detail
 
 std::unique_ptr<column> interleave_columns(table_view const& input,
+                                           rmm::cuda_stream_view stream,
                                            rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
   CUDF_EXPECTS(input.num_columns() > 0, "input must have at least one column to determine dtype.");
 
   auto const dtype = input.column(0).type();
@@ -194,8 +200,17 @@ std::unique_ptr<column> interleave_columns(table_view const& input,
                                                 detail::interleave_columns_functor{},
                                                 input,
                                                 output_needs_mask,
-                                                rmm::cuda_stream_default,
+                                                stream,
                                                 mr);
 }
 
+}  // namespace detail
+
+std::unique_ptr<column> interleave_columns(table_view const& input,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::interleave_columns(input, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace cudf
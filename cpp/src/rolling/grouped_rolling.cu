@@ -273,20 +273,18 @@ std::unique_ptr<column> expand_to_column(Calculator const& calc,
   return window_column;
 }
 
-/// Time-range window computation, with
+/// Time-range window sizes computation, with
 ///   1. no grouping keys specified
 ///   2. timetamps in ASCENDING order.
 /// Treat as one single group.
-std::unique_ptr<column> time_range_window_ASC(column_view const& input,
-                                              column_view const& timestamp_column,
-                                              TimeT preceding_window,
-                                              bool preceding_window_is_unbounded,
-                                              TimeT following_window,
-                                              bool following_window_is_unbounded,
-                                              size_type min_periods,
-                                              std::unique_ptr<aggregation> const& aggr,
-                                              rmm::cuda_stream_view stream,
-                                              rmm::mr::device_memory_resource* mr)
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> time_range_window_ASC(
+  column_view const& timestamp_column,
+  TimeT preceding_window,
+  bool preceding_window_is_unbounded,
+  TimeT following_window,
+  bool following_window_is_unbounded,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
 {
   size_type nulls_begin_idx, nulls_end_idx;
   std::tie(nulls_begin_idx, nulls_end_idx) = get_null_bounds_for_timestamp_column(timestamp_column);
@@ -323,12 +321,13 @@ std::unique_ptr<column> time_range_window_ASC(column_view const& input,
            1;  // Add 1, for `preceding` to account for current row.
   };
 
-  auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
+  auto preceding_column =
+    expand_to_column(preceding_calculator, timestamp_column.size(), stream, mr);
 
   auto following_calculator =
     [nulls_begin_idx,
      nulls_end_idx,
-     num_rows     = input.size(),
+     num_rows     = timestamp_column.size(),
      d_timestamps = timestamp_column.data<TimeT>(),
      following_window,
      following_window_is_unbounded] __device__(size_type idx) -> size_type {
@@ -356,10 +355,10 @@ std::unique_ptr<column> time_range_window_ASC(column_view const& input,
            1;
   };
 
-  auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
+  auto following_column =
+    expand_to_column(following_calculator, timestamp_column.size(), stream, mr);
 
-  return cudf::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, mr);
+  return std::make_pair(std::move(preceding_column), std::move(following_column));
 }
 
 /// Given a timestamp column grouped as specified in group_offsets,
@@ -432,9 +431,8 @@ get_null_bounds_for_timestamp_column(column_view const& timestamp_column,
   return std::make_tuple(std::move(null_start), std::move(null_end));
 }
 
-// Time-range window computation, for timestamps in ASCENDING order.
-std::unique_ptr<column> time_range_window_ASC(
-  column_view const& input,
+// Time-range window sizes computation, for timestamps in ASCENDING order.
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> time_range_window_ASC(
   column_view const& timestamp_column,
   rmm::device_uvector<cudf::size_type> const& group_offsets,
   rmm::device_uvector<cudf::size_type> const& group_labels,
@@ -442,8 +440,6 @@ std::unique_ptr<column> time_range_window_ASC(
   bool preceding_window_is_unbounded,
   TimeT following_window,
   bool following_window_is_unbounded,
-  size_type min_periods,
-  std::unique_ptr<aggregation> const& aggr,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
@@ -489,7 +485,8 @@ std::unique_ptr<column> time_range_window_ASC(
            1;  // Add 1, for `preceding` to account for current row.
   };
 
-  auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
+  auto preceding_column =
+    expand_to_column(preceding_calculator, timestamp_column.size(), stream, mr);
 
   auto following_calculator =
     [d_group_offsets = group_offsets.data(),
@@ -533,26 +530,24 @@ std::unique_ptr<column> time_range_window_ASC(
            1;
   };
 
-  auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
+  auto following_column =
+    expand_to_column(following_calculator, timestamp_column.size(), stream, mr);
 
-  return cudf::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, mr);
+  return std::make_pair(std::move(preceding_column), std::move(following_column));
 }
 
-/// Time-range window computation, with
+/// Time-range window sizes computation, with
 ///   1. no grouping keys specified
 ///   2. timetamps in DESCENDING order.
 /// Treat as one single group.
-std::unique_ptr<column> time_range_window_DESC(column_view const& input,
-                                               column_view const& timestamp_column,
-                                               TimeT preceding_window,
-                                               bool preceding_window_is_unbounded,
-                                               TimeT following_window,
-                                               bool following_window_is_unbounded,
-                                               size_type min_periods,
-                                               std::unique_ptr<aggregation> const& aggr,
-                                               rmm::cuda_stream_view stream,
-                                               rmm::mr::device_memory_resource* mr)
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> time_range_window_DESC(
+  column_view const& timestamp_column,
+  TimeT preceding_window,
+  bool preceding_window_is_unbounded,
+  TimeT following_window,
+  bool following_window_is_unbounded,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
 {
   size_type nulls_begin_idx, nulls_end_idx;
   std::tie(nulls_begin_idx, nulls_end_idx) = get_null_bounds_for_timestamp_column(timestamp_column);
@@ -591,12 +586,13 @@ std::unique_ptr<column> time_range_window_DESC(column_view const& input,
            1;  // Add 1, for `preceding` to account for current row.
   };
 
-  auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
+  auto preceding_column =
+    expand_to_column(preceding_calculator, timestamp_column.size(), stream, mr);
 
   auto following_calculator =
     [nulls_begin_idx,
      nulls_end_idx,
-     num_rows     = input.size(),
+     num_rows     = timestamp_column.size(),
      d_timestamps = timestamp_column.data<TimeT>(),
      following_window,
      following_window_is_unbounded] __device__(size_type idx) -> size_type {
@@ -625,15 +621,14 @@ std::unique_ptr<column> time_range_window_DESC(column_view const& input,
            1;
   };
 
-  auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
+  auto following_column =
+    expand_to_column(following_calculator, timestamp_column.size(), stream, mr);
 
-  return cudf::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, mr);
+  return std::make_pair(std::move(preceding_column), std::move(following_column));
 }
 
-// Time-range window computation, for timestamps in DESCENDING order.
-std::unique_ptr<column> time_range_window_DESC(
-  column_view const& input,
+// Time-range window sizes computation, for timestamps in DESCENDING order.
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> time_range_window_DESC(
   column_view const& timestamp_column,
   rmm::device_uvector<cudf::size_type> const& group_offsets,
   rmm::device_uvector<cudf::size_type> const& group_labels,
@@ -641,8 +636,6 @@ std::unique_ptr<column> time_range_window_DESC(
   bool preceding_window_is_unbounded,
   TimeT following_window,
   bool following_window_is_unbounded,
-  size_type min_periods,
-  std::unique_ptr<aggregation> const& aggr,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
@@ -690,7 +683,8 @@ std::unique_ptr<column> time_range_window_DESC(
            1;  // Add 1, for `preceding` to account for current row.
   };
 
-  auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
+  auto preceding_column =
+    expand_to_column(preceding_calculator, timestamp_column.size(), stream, mr);
 
   auto following_calculator =
     [d_group_offsets = group_offsets.data(),
@@ -733,18 +727,14 @@ std::unique_ptr<column> time_range_window_DESC(
            1;
   };
 
-  auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
+  auto following_column =
+    expand_to_column(following_calculator, timestamp_column.size(), stream, mr);
 
-  if (aggr->kind == aggregation::CUDA || aggr->kind == aggregation::PTX) {
-    CUDF_FAIL("Time ranged rolling window does NOT (yet) support UDF.");
-  } else {
-    return cudf::rolling_window(
-      input, preceding_column->view(), following_column->view(), min_periods, aggr, mr);
-  }
+  return std::make_pair(std::move(preceding_column), std::move(following_column));
 }
 
-std::unique_ptr<column> grouped_time_range_rolling_window_impl(
-  column_view const& input,
+/// Computes the preceding and following window sizes of every row of a time-range window.
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> time_range_window_sizes(
   column_view const& timestamp_column,
   cudf::order const& timestamp_ordering,
   rmm::device_uvector<cudf::size_type> const& group_offsets,
@@ -752,8 +742,6 @@ std::unique_ptr<column> grouped_time_range_rolling_window_impl(
   window_bounds preceding_window_in_days,  // TODO: Consider taking offset-type as type_id. Assumes
                                            // days for now.
   window_bounds following_window_in_days,
-  size_type min_periods,
-  std::unique_ptr<aggregation> const& aggr,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
@@ -761,50 +749,38 @@ std::unique_ptr<column> grouped_time_range_rolling_window_impl(
 
   if (timestamp_ordering == cudf::order::ASCENDING) {
     return group_offsets.is_empty()
-             ? time_range_window_ASC(input,
-                                     timestamp_column,
+             ? time_range_window_ASC(timestamp_column,
                                      preceding_window_in_days.value * mult_factor,
                                      preceding_window_in_days.is_unbounded,
                                      following_window_in_days.value * mult_factor,
                                      following_window_in_days.is_unbounded,
-                                     min_periods,
-                                     aggr,
                                      stream,
                                      mr)
-             : time_range_window_ASC(input,
-                                     timestamp_column,
+             : time_range_window_ASC(timestamp_column,
                                      group_offsets,
                                      group_labels,
                                      preceding_window_in_days.value * mult_factor,
                                      preceding_window_in_days.is_unbounded,
                                      following_window_in_days.value * mult_factor,
                                      following_window_in_days.is_unbounded,
-                                     min_periods,
-                                     aggr,
                                      stream,
                                      mr);
   } else {
     return group_offsets.is_empty()
-             ? time_range_window_DESC(input,
-                                      timestamp_column,
+             ? time_range_window_DESC(timestamp_column,
                                       preceding_window_in_days.value * mult_factor,
                                       preceding_window_in_days.is_unbounded,
                                       following_window_in_days.value * mult_factor,
                                       following_window_in_days.is_unbounded,
-                                      min_periods,
-                                      aggr,
                                       stream,
                                       mr)
-             : time_range_window_DESC(input,
-                                      timestamp_column,
+             : time_range_window_DESC(timestamp_column,
                                       group_offsets,
                                       group_labels,
                                       preceding_window_in_days.value * mult_factor,
                                       preceding_window_in_days.is_unbounded,
                                       following_window_in_days.value * mult_factor,
                                       following_window_in_days.is_unbounded,
-                                      min_periods,
-                                      aggr,
                                       stream,
                                       mr);
   }
@@ -812,33 +788,35 @@ std::unique_ptr<column> grouped_time_range_rolling_window_impl(
 
 }  // namespace
 
-namespace detail {
-
-std::unique_ptr<column> grouped_time_range_rolling_window(table_view const& group_keys,
-                                                          column_view const& timestamp_column,
-                                                          cudf::order const& timestamp_order,
-                                                          column_view const& input,
-                                                          window_bounds preceding_window_in_days,
-                                                          window_bounds following_window_in_days,
-                                                          size_type min_periods,
-                                                          std::unique_ptr<aggregation> const& aggr,
-                                                          rmm::cuda_stream_view stream,
-                                                          rmm::mr::device_memory_resource* mr)
+rolling_window_spec::rolling_window_spec(std::unique_ptr<column>&& preceding_window,
+                                         std::unique_ptr<column>&& following_window)
+  : _preceding_window{std::move(preceding_window)}, _following_window{std::move(following_window)}
 {
-  CUDF_FUNC_RANGE();
-
-  if (input.is_empty()) return empty_like(input);
+  CUDF_EXPECTS(_preceding_window->type().id() == type_id::INT32 &&
+                 _following_window->type().id() == type_id::INT32,
+               "preceding_window/following_window must have type_id::INT32 type");
+  CUDF_EXPECTS(_preceding_window->size() == _following_window->size(),
+               "preceding_window/following_window size mismatch");
+}
 
-  CUDF_EXPECTS((group_keys.num_columns() == 0 || group_keys.num_rows() == input.size()),
-               "Size mismatch between group_keys and input vector.");
+namespace detail {
 
-  CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
+rolling_window_spec make_grouped_time_range_window_spec(table_view const& group_keys,
+                                                        column_view const& timestamp_column,
+                                                        cudf::order const& timestamp_order,
+                                                        window_bounds preceding_window_in_days,
+                                                        window_bounds following_window_in_days,
+                                                        rmm::cuda_stream_view stream,
+                                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS((group_keys.num_columns() == 0 || group_keys.num_rows() == timestamp_column.size()),
+               "Size mismatch between group_keys and timestamp column.");
 
   using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
   using index_vector        = sort_groupby_helper::index_vector;
 
   index_vector group_offsets(0, stream), group_labels(0, stream);
-  if (group_keys.num_columns() > 0) {
+  if (group_keys.num_columns() > 0 && timestamp_column.size() > 0) {
     sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES};
     group_offsets = index_vector(helper.group_offsets(stream), stream);
     group_labels  = index_vector(helper.group_labels(stream), stream);
@@ -850,8 +828,7 @@ std::unique_ptr<column> grouped_time_range_rolling_window(table_view const& grou
 
   auto is_timestamp_in_days = timestamp_column.type().id() == cudf::type_id::TIMESTAMP_DAYS;
 
-  return grouped_time_range_rolling_window_impl(
-    input,
+  auto window_sizes = time_range_window_sizes(
     is_timestamp_in_days
       ? cudf::cast(timestamp_column, cudf::data_type(cudf::type_id::TIMESTAMP_SECONDS), mr)->view()
       : timestamp_column,
@@ -860,14 +837,71 @@ std::unique_ptr<column> grouped_time_range_rolling_window(table_view const& grou
     group_labels,
     preceding_window_in_days,
     following_window_in_days,
-    min_periods,
-    aggr,
     stream,
     mr);
+  return rolling_window_spec{std::move(window_sizes.first), std::move(window_sizes.second)};
+}
+
+std::unique_ptr<column> grouped_time_range_rolling_window(table_view const& group_keys,
+                                                          column_view const& timestamp_column,
+                                                          cudf::order const& timestamp_order,
+                                                          column_view const& input,
+                                                          window_bounds preceding_window_in_days,
+                                                          window_bounds following_window_in_days,
+                                                          size_type min_periods,
+                                                          std::unique_ptr<aggregation> const& aggr,
+                                                          rmm::cuda_stream_view stream,
+                                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  if (input.is_empty()) return empty_like(input);
+
+  CUDF_EXPECTS((group_keys.num_columns() == 0 || group_keys.num_rows() == input.size()),
+               "Size mismatch between group_keys and input vector.");
+
+  CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
+
+  if (group_keys.num_columns() > 0 && timestamp_order == cudf::order::DESCENDING &&
+      (aggr->kind == aggregation::CUDA || aggr->kind == aggregation::PTX)) {
+    CUDF_FAIL("Time ranged rolling window does NOT (yet) support UDF.");
+  }
+
+  auto const window_spec = make_grouped_time_range_window_spec(group_keys,
+                                                               timestamp_column,
+                                                               timestamp_order,
+                                                               preceding_window_in_days,
+                                                               following_window_in_days,
+                                                               stream,
+                                                               mr);
+
+  return cudf::rolling_window(input,
+                              window_spec.preceding_window(),
+                              window_spec.following_window(),
+                              min_periods,
+                              aggr,
+                              mr);
 }
 
 }  // namespace detail
 
+rolling_window_spec make_grouped_time_range_window_spec(table_view const& group_keys,
+                                                        column_view const& timestamp_column,
+                                                        cudf::order const& timestamp_order,
+                                                        window_bounds preceding_window_in_days,
+                                                        window_bounds following_window_in_days,
+                                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::make_grouped_time_range_window_spec(group_keys,
+                                                     timestamp_column,
+                                                     timestamp_order,
+                                                     preceding_window_in_days,
+                                                     following_window_in_days,
+                                                     rmm::cuda_stream_default,
+                                                     mr);
+}
+
 std::unique_ptr<column> grouped_time_range_rolling_window(table_view const& group_keys,
                                                           column_view const& timestamp_column,
                                                           cudf::order const& timestamp_order,
@@ -15,6 +15,12 @@
  */
 
 #include "rolling_detail.cuh"
+#include "sliding_window.hpp"
+
+#include <algorithm>
+#include <array>
+#include <future>
+#include <iterator>
 
 namespace cudf {
 
@@ -62,6 +68,10 @@ std::unique_ptr<column> rolling_window(column_view const& input,
                                             agg,
                                             stream,
                                             mr);
+  } else if (default_outputs.is_empty() and
+             is_sliding_window_supported(input, preceding_window, following_window, agg->kind)) {
+    return sliding_window(
+      input, preceding_window, following_window, min_periods, agg->kind, stream, mr);
   } else {
     auto preceding_window_begin = thrust::make_constant_iterator(preceding_window);
     auto following_window_begin = thrust::make_constant_iterator(following_window);
@@ -122,6 +132,34 @@ std::unique_ptr<column> rolling_window(column_view const& input,
   }
 }
 
+// Applies several rolling window functions over the same precomputed windows.
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  rolling_window_spec const& window_spec,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  CUDF_EXPECTS(window_spec.size() == input.size(),
+               "rolling_window_spec size must match input size");
+
+  std::vector<std::unique_ptr<column>> results;
+  results.reserve(aggs.size());
+  std::transform(aggs.cbegin(), aggs.cend(), std::back_inserter(results), [&](auto const& agg) {
+    return rolling_window(input,
+                          window_spec.preceding_window(),
+                          window_spec.following_window(),
+                          min_periods,
+                          agg,
+                          stream,
+                          mr);
+  });
+  return results;
+}
+
 }  // namespace detail
 
 // Applies a fixed-size rolling window function to the values in a column.
@@ -155,4 +193,45 @@ std::unique_ptr<column> rolling_window(column_view const& input,
     input, preceding_window, following_window, min_periods, agg, rmm::cuda_stream_default, mr);
 }
 
+// Applies several rolling window functions over the same precomputed windows.
+std::vector<std::unique_ptr<column>> rolling_window(
+  column_view const& input,
+  rolling_window_spec const& window_spec,
+  size_type min_periods,
+  std::vector<std::unique_ptr<aggregation>> const& aggs,
+  rmm::mr::device_memory_resource* mr)
+{
+  return detail::rolling_window(
+    input, window_spec, min_periods, aggs, rmm::cuda_stream_default, mr);
+}
+
+// Compiles the kernels of a rolling window UDF aggregation on a background thread.
+std::future<void> precompile_rolling_window_udf(data_type input_type,
+                                                std::unique_ptr<aggregation> const& agg)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(agg->kind == aggregation::CUDA || agg->kind == aggregation::PTX,
+               "Only UDF aggregations can be precompiled");
+
+  int device;
+  CUDA_TRY(cudaGetDevice(&device));
+
+  // Compiles on the caller's device from a copy of `agg`, which may not outlive this call
+  auto compile = [device, input_type](std::unique_ptr<aggregation> agg) {
+    CUDA_TRY(cudaSetDevice(device));
+    auto const& udf_agg = static_cast<detail::udf_aggregation const&>(*agg);
+    // The window type names of the fixed-size, variable-size and grouped rolling windows
+    std::array<std::pair<char const*, char const*>, 3> const window_types{
+      {{"cudf::size_type", "cudf::size_type"},
+       {"cudf::size_type*", "cudf::size_type*"},
+       {"cudf::detail::preceding_window_wrapper", "cudf::detail::following_window_wrapper"}}};
+    for (auto const& window_type : window_types) {
+      // Dereferencing the kernel throws if its compilation failed
+      detail::get_rolling_udf_kernel(input_type, udf_agg, window_type.first, window_type.second)
+        ->function();
+    }
+  };
+  return std::async(std::launch::async, compile, agg->clone());
+}
+
 }  // namespace cudf
@@ -1239,6 +1239,49 @@ struct dispatch_rolling {
 
 }  // namespace
 
+/**
+ * @brief Returns the CUDA source of the device function of a rolling window UDF aggregation.
+ */
+inline std::string rolling_udf_cuda_source(udf_aggregation const& udf_agg)
+{
+  switch (udf_agg.kind) {
+    case aggregation::Kind::PTX:
+      return cudf::jit::parse_single_function_ptx(udf_agg._source,
+                                                  udf_agg._function_name,
+                                                  cudf::jit::get_type_name(udf_agg._output_type),
+                                                  {0, 5});  // args 0 and 5 are pointers.
+    case aggregation::Kind::CUDA:
+      return cudf::jit::parse_single_function_cuda(udf_agg._source, udf_agg._function_name);
+    default: CUDF_FAIL("Unsupported UDF type.");
+  }
+}
+
+/**
+ * @brief Returns the rolling window UDF kernel compiled for `input_type` and the window types
+ * named by `preceding_window_str` and `following_window_str`.
+ *
+ * Kernels are compiled by jitify on first use and kept in the program cache, in memory and in
+ * the on-disk kernel cache, so later requests for the same kernel skip compilation.
+ */
+inline auto get_rolling_udf_kernel(data_type input_type,
+                                   udf_aggregation const& udf_agg,
+                                   std::string const& preceding_window_str,
+                                   std::string const& following_window_str)
+{
+  std::string kernel_name =
+    jitify2::reflection::Template("cudf::rolling::jit::gpu_rolling_new")  //
+      .instantiate(cudf::jit::get_type_name(input_type),  // list of template arguments
+                   cudf::jit::get_type_name(udf_agg._output_type),
+                   udf_agg._operator_name,
+                   preceding_window_str.c_str(),
+                   following_window_str.c_str());
+
+  return cudf::jit::get_kernel(
+    *rolling_jit_kernel_cu_jit,
+    kernel_name,
+    {{"rolling/jit/operation-udf.hpp", rolling_udf_cuda_source(udf_agg)}});
+}
+
 // Applies a user-defined rolling window function to the values in a column.
 template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
 std::unique_ptr<column> rolling_window_udf(column_view const& input,
@@ -1261,23 +1304,8 @@ std::unique_ptr<column> rolling_window_udf(column_view const& input,
 
   auto udf_agg = static_cast<udf_aggregation*>(agg.get());
 
-  std::string hash = "prog_rolling." + std::to_string(std::hash<std::string>{}(udf_agg->_source));
-
-  std::string cuda_source;
-  switch (udf_agg->kind) {
-    case aggregation::Kind::PTX:
-      cuda_source +=
-        cudf::jit::parse_single_function_ptx(udf_agg->_source,
-                                             udf_agg->_function_name,
-                                             cudf::jit::get_type_name(udf_agg->_output_type),
-                                             {0, 5});  // args 0 and 5 are pointers.
-      break;
-    case aggregation::Kind::CUDA:
-      cuda_source +=
-        cudf::jit::parse_single_function_cuda(udf_agg->_source, udf_agg->_function_name);
-      break;
-    default: CUDF_FAIL("Unsupported UDF type.");
-  }
+  auto kernel =
+    get_rolling_udf_kernel(input.type(), *udf_agg, preceding_window_str, following_window_str);
 
   std::unique_ptr<column> output = make_numeric_column(
     udf_agg->_output_type, input.size(), cudf::mask_state::UNINITIALIZED, stream, mr);
@@ -1285,18 +1313,7 @@ std::unique_ptr<column> rolling_window_udf(column_view const& input,
   auto output_view = output->mutable_view();
   rmm::device_scalar<size_type> device_valid_count{0, stream};
 
-  std::string kernel_name =
-    jitify2::reflection::Template("cudf::rolling::jit::gpu_rolling_new")  //
-      .instantiate(cudf::jit::get_type_name(input.type()),  // list of template arguments
-                   cudf::jit::get_type_name(output->type()),
-                   udf_agg->_operator_name,
-                   preceding_window_str.c_str(),
-                   following_window_str.c_str());
-
-  cudf::jit::get_program_cache(*rolling_jit_kernel_cu_jit)
-    .get_kernel(
-      kernel_name, {}, {{"rolling/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})  //
-    ->configure_1d_max_occupancy(0, 0, 0, stream.value())                                 //
+  kernel->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
     ->launch(input.size(),
              cudf::jit::get_data_ptr(input),
              input.null_mask(),
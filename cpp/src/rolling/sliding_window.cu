@@ -0,0 +1,465 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sliding_window.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/reverse_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Bounds `[start, end)` of the fixed-size window of every row, clamped to the column.
+ */
+struct window_bounds {
+  size_type num_rows;
+  size_type preceding_window;
+  size_type following_window;
+
+  __device__ size_type start(size_type index) const
+  {
+    return min(num_rows, max(0, index - preceding_window + 1));
+  }
+
+  __device__ size_type end(size_type index) const
+  {
+    return min(num_rows, max(0, index + following_window + 1));
+  }
+};
+
+/**
+ * @brief Returns 1 for a valid element of a column and 0 for a null element.
+ */
+struct valid_element_fn {
+  column_device_view d_input;
+
+  __device__ size_type operator()(size_type index) const
+  {
+    return static_cast<size_type>(d_input.is_valid_nocheck(index));
+  }
+};
+
+/**
+ * @brief Counts the valid elements in the window of a row.
+ */
+struct window_valid_count_fn {
+  window_bounds bounds;
+  size_type const* valid_prefix;  ///< Valid elements before each row, or null if there are none
+
+  __device__ size_type operator()(size_type index) const
+  {
+    auto const start = bounds.start(index);
+    auto const end   = bounds.end(index);
+    return valid_prefix != nullptr ? valid_prefix[end] - valid_prefix[start] : end - start;
+  }
+};
+
+/**
+ * @brief Determines whether the window of a row has at least `min_periods` observations.
+ */
+struct window_is_valid_fn {
+  window_valid_count_fn count;
+  size_type min_periods;
+
+  __device__ bool operator()(size_type index) const { return count(index) >= min_periods; }
+};
+
+/**
+ * @brief Returns an element of a column as `ResultType`, or zero if it is null.
+ */
+template <typename T, typename ResultType>
+struct element_or_zero_fn {
+  column_device_view d_input;
+
+  __device__ ResultType operator()(size_type index) const
+  {
+    return d_input.is_valid(index) ? static_cast<ResultType>(d_input.element<T>(index))
+                                   : ResultType{0};
+  }
+};
+
+/**
+ * @brief Sum of doubles that carries the rounding error of its additions.
+ */
+struct compensated_sum {
+  double sum;
+  double error;
+};
+
+/**
+ * @brief Adds two compensated sums, keeping the rounding error of the addition with TwoSum.
+ */
+struct compensated_sum_op {
+  __device__ compensated_sum operator()(compensated_sum const& lhs,
+                                        compensated_sum const& rhs) const
+  {
+    double const sum      = lhs.sum + rhs.sum;
+    double const rhs_part = sum - lhs.sum;
+    double const error    = (lhs.sum - (sum - rhs_part)) + (rhs.sum - rhs_part);
+    return {sum, lhs.error + rhs.error + error};
+  }
+};
+
+/**
+ * @brief Returns an element of a column as a compensated sum, or zero if it is null.
+ */
+template <typename T>
+struct compensated_element_fn {
+  column_device_view d_input;
+
+  __device__ compensated_sum operator()(size_type index) const
+  {
+    auto const value = d_input.is_valid(index) ? static_cast<double>(d_input.element<T>(index))
+                                               : 0.0;
+    return {value, 0.0};
+  }
+};
+
+/**
+ * @brief Computes the sum of the window of a row from exact integral prefix sums.
+ */
+template <typename OutputType>
+struct window_integral_sum_fn {
+  window_bounds bounds;
+  int64_t const* prefix;
+
+  __device__ OutputType operator()(size_type index) const
+  {
+    return static_cast<OutputType>(prefix[bounds.end(index)] - prefix[bounds.start(index)]);
+  }
+};
+
+/**
+ * @brief Computes the sum, or the mean if `is_mean`, of the window of a row from compensated
+ * prefix sums.
+ */
+template <typename OutputType, bool is_mean>
+struct window_compensated_sum_fn {
+  window_bounds bounds;
+  compensated_sum const* prefix;
+  window_valid_count_fn count;
+
+  __device__ OutputType operator()(size_type index) const
+  {
+    auto const& upper = prefix[bounds.end(index)];
+    auto const& lower = prefix[bounds.start(index)];
+    double const sum  = (upper.sum - lower.sum) + (upper.error - lower.error);
+    return static_cast<OutputType>(is_mean ? sum / count(index) : sum);
+  }
+};
+
+/**
+ * @brief Returns the element of a column at a position shifted by `offset`, or `identity` if the
+ * position is outside of the column or the element is null.
+ */
+template <typename T>
+struct padded_element_fn {
+  column_device_view d_input;
+  size_type offset;
+  T identity;
+
+  __device__ T operator()(size_type index) const
+  {
+    auto const row = index - offset;
+    return row >= 0 && row < d_input.size() && d_input.is_valid(row) ? d_input.element<T>(row)
+                                                                      : identity;
+  }
+};
+
+/**
+ * @brief Maps a position to the block of `block_size` positions it belongs to.
+ */
+struct block_index_fn {
+  size_type block_size;
+
+  __device__ size_type operator()(size_type index) const { return index / block_size; }
+};
+
+/**
+ * @brief Combines the block suffix at the first position of a window with the block prefix at
+ * its last position.
+ */
+template <typename T, typename Op>
+struct window_extremum_fn {
+  T const* block_suffix;
+  T const* block_prefix;
+  size_type window_size;
+
+  __device__ T operator()(size_type index) const
+  {
+    return Op{}(block_suffix[index], block_prefix[index + window_size - 1]);
+  }
+};
+
+/**
+ * @brief Builds a rolling window output column from the value and the validity of every row.
+ */
+template <typename OutputType, typename ValueFn>
+std::unique_ptr<column> make_window_column(size_type num_rows,
+                                           ValueFn value_fn,
+                                           window_is_valid_fn is_valid_fn,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  auto result = make_fixed_width_column(
+    data_type{type_to_id<OutputType>()}, num_rows, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    result->mutable_view().data<OutputType>(),
+                    value_fn);
+  auto null_mask = detail::valid_if(thrust::make_counting_iterator<size_type>(0),
+                                    thrust::make_counting_iterator<size_type>(num_rows),
+                                    is_valid_fn,
+                                    stream,
+                                    mr);
+  result->set_null_mask(std::move(null_mask.first), null_mask.second);
+  return result;
+}
+
+/**
+ * @brief Computes an inclusive scan of `size` elements into `prefix[1, size]`, with
+ * `prefix[0] = 0`.
+ */
+template <typename InputIterator, typename T, typename BinaryOp>
+void prefix_scan(InputIterator input,
+                 size_type size,
+                 rmm::device_uvector<T>& prefix,
+                 BinaryOp op,
+                 rmm::cuda_stream_view stream)
+{
+  CUDA_TRY(cudaMemsetAsync(prefix.data(), 0, sizeof(T), stream.value()));
+  thrust::inclusive_scan(rmm::exec_policy(stream), input, input + size, prefix.data() + 1, op);
+}
+
+struct sliding_window_dispatch {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return cudf::is_numeric<T>();
+  }
+
+  template <typename T,
+            aggregation::Kind k,
+            std::enable_if_t<std::is_floating_point<T>::value or k == aggregation::MEAN>* = nullptr>
+  std::unique_ptr<column> window_sum(column_device_view const& d_input,
+                                     window_bounds bounds,
+                                     window_is_valid_fn is_valid_fn,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    using OutputType = target_type_t<T, k>;
+    rmm::device_uvector<compensated_sum> prefix(bounds.num_rows + 1, stream);
+    prefix_scan(thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                compensated_element_fn<T>{d_input}),
+                bounds.num_rows,
+                prefix,
+                compensated_sum_op{},
+                stream);
+    auto const value_fn = window_compensated_sum_fn<OutputType, k == aggregation::MEAN>{
+      bounds, prefix.data(), is_valid_fn.count};
+    return make_window_column<OutputType>(bounds.num_rows, value_fn, is_valid_fn, stream, mr);
+  }
+
+  template <typename T,
+            aggregation::Kind k,
+            std::enable_if_t<not std::is_floating_point<T>::value and k == aggregation::SUM>* =
+              nullptr>
+  std::unique_ptr<column> window_sum(column_device_view const& d_input,
+                                     window_bounds bounds,
+                                     window_is_valid_fn is_valid_fn,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    using OutputType = target_type_t<T, k>;
+    rmm::device_uvector<int64_t> prefix(bounds.num_rows + 1, stream);
+    prefix_scan(thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                element_or_zero_fn<T, int64_t>{d_input}),
+                bounds.num_rows,
+                prefix,
+                thrust::plus<int64_t>{},
+                stream);
+    auto const value_fn = window_integral_sum_fn<OutputType>{bounds, prefix.data()};
+    return make_window_column<OutputType>(bounds.num_rows, value_fn, is_valid_fn, stream, mr);
+  }
+
+  template <typename T, typename Op>
+  std::unique_ptr<column> window_extremum(column_device_view const& d_input,
+                                          window_bounds bounds,
+                                          window_is_valid_fn is_valid_fn,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+  {
+    // Rows are padded with the identity so that every window spans `window_size` positions,
+    // and the window of row `i` starts at padded position `i`
+    auto const window_size = bounds.preceding_window + bounds.following_window;
+    auto const padded_size = bounds.num_rows + window_size - 1;
+
+    auto const values = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      padded_element_fn<T>{d_input, bounds.preceding_window - 1, Op::template identity<T>()});
+    auto const blocks = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0), block_index_fn{window_size});
+
+    rmm::device_uvector<T> block_prefix(padded_size, stream);
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                  blocks,
+                                  blocks + padded_size,
+                                  values,
+                                  block_prefix.begin(),
+                                  thrust::equal_to<size_type>{},
+                                  Op{});
+
+    rmm::device_uvector<T> block_suffix(padded_size, stream);
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                  thrust::make_reverse_iterator(blocks + padded_size),
+                                  thrust::make_reverse_iterator(blocks),
+                                  thrust::make_reverse_iterator(values + padded_size),
+                                  thrust::make_reverse_iterator(block_suffix.end()),
+                                  thrust::equal_to<size_type>{},
+                                  Op{});
+
+    auto const value_fn =
+      window_extremum_fn<T, Op>{block_suffix.data(), block_prefix.data(), window_size};
+    return make_window_column<T>(bounds.num_rows, value_fn, is_valid_fn, stream, mr);
+  }
+
+  template <typename T, std::enable_if_t<is_supported<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_device_view const& d_input,
+                                     window_bounds bounds,
+                                     window_is_valid_fn is_valid_fn,
+                                     aggregation::Kind kind,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    switch (kind) {
+      case aggregation::SUM:
+        return window_sum<T, aggregation::SUM>(d_input, bounds, is_valid_fn, stream, mr);
+      case aggregation::MEAN:
+        return window_sum<T, aggregation::MEAN>(d_input, bounds, is_valid_fn, stream, mr);
+      case aggregation::MIN:
+        return window_extremum<T, DeviceMin>(d_input, bounds, is_valid_fn, stream, mr);
+      case aggregation::MAX:
+        return window_extremum<T, DeviceMax>(d_input, bounds, is_valid_fn, stream, mr);
+      default: CUDF_FAIL("Unsupported aggregation for sliding window");
+    }
+  }
+
+  template <typename T, std::enable_if_t<not is_supported<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_device_view const&,
+                                     window_bounds,
+                                     window_is_valid_fn,
+                                     aggregation::Kind,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Unsupported type for sliding window");
+  }
+};
+
+}  // namespace
+
+bool is_sliding_window_supported(column_view const& input,
+                                 size_type preceding_window,
+                                 size_type following_window,
+                                 aggregation::Kind kind)
+{
+  if (preceding_window < 0 or following_window < 0 or
+      static_cast<int64_t>(preceding_window) + following_window < sliding_window_min_size) {
+    return false;
+  }
+  switch (kind) {
+    case aggregation::COUNT_VALID: return true;
+    case aggregation::SUM:
+    case aggregation::MEAN:
+      return is_numeric(input.type()) and input.type().id() != type_id::BOOL8;
+    case aggregation::MIN:
+    case aggregation::MAX: return is_numeric(input.type());
+    default: return false;
+  }
+}
+
+std::unique_ptr<column> sliding_window(column_view const& input,
+                                       size_type preceding_window,
+                                       size_type following_window,
+                                       size_type min_periods,
+                                       aggregation::Kind kind,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_sliding_window_supported(input, preceding_window, following_window, kind),
+               "Unsupported sliding window");
+
+  // Windows reaching past either end of the column are clamped, so clamping the window sizes to
+  // the column size leaves every window unchanged
+  auto const num_rows = input.size();
+  window_bounds const bounds{
+    num_rows, std::min(preceding_window, num_rows), std::min(following_window, num_rows)};
+
+  auto const d_input = column_device_view::create(input, stream);
+
+  // The valid elements before each row are counted only when there are nulls
+  rmm::device_uvector<size_type> valid_prefix(input.has_nulls() ? num_rows + 1 : 0, stream);
+  if (input.has_nulls()) {
+    prefix_scan(thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                valid_element_fn{*d_input}),
+                num_rows,
+                valid_prefix,
+                thrust::plus<size_type>{},
+                stream);
+  }
+  window_valid_count_fn const valid_count{bounds,
+                                          input.has_nulls() ? valid_prefix.data() : nullptr};
+
+  // COUNT_VALID, like the loop kernel, requires `min_periods` elements rather than valid elements
+  if (kind == aggregation::COUNT_VALID) {
+    window_is_valid_fn const is_valid_fn{window_valid_count_fn{bounds, nullptr}, min_periods};
+    return make_window_column<size_type>(num_rows, valid_count, is_valid_fn, stream, mr);
+  }
+
+  return type_dispatcher(input.type(),
+                         sliding_window_dispatch{},
+                         *d_input,
+                         bounds,
+                         window_is_valid_fn{valid_count, min_periods},
+                         kind,
+                         stream,
+                         mr);
+}
+
+}  // namespace detail
+}  // namespace cudf
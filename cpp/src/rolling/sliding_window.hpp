@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <memory>
+
+/** @internal @file Internal API in this file computes fixed-size rolling windows in time
+ * independent of the window size.
+ */
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Smallest window, in rows, for which `sliding_window` is used instead of the kernel that
+ * loops over every row of every window.
+ *
+ * Neighbouring windows overlap almost entirely, so the loop kernel is served from cache and is
+ * competitive for small windows; the sliding-window algorithms pay for a few extra passes over
+ * the column instead.
+ */
+constexpr size_type sliding_window_min_size = 128;
+
+/**
+ * @brief Returns whether the fixed-size rolling window of `kind` on `input` is computed by
+ * `sliding_window`.
+ *
+ * COUNT_VALID on any column, SUM and MEAN on non-boolean numeric columns, and MIN and MAX on
+ * numeric columns are supported, for non-negative window sizes spanning at least
+ * `sliding_window_min_size` rows.
+ */
+bool is_sliding_window_supported(column_view const& input,
+                                 size_type preceding_window,
+                                 size_type following_window,
+                                 aggregation::Kind kind);
+
+/**
+ * @brief Computes a fixed-size rolling window aggregation in time independent of the window
+ * size.
+ *
+ * SUM, MEAN and COUNT_VALID are the differences of prefix sums at the window bounds. Integral
+ * sums are exact since their prefix sums wrap around like the sums themselves; floating-point
+ * prefix sums are compensated so the difference of two large prefixes keeps the precision of the
+ * window sum. MIN and MAX split the padded column into blocks of the window size and combine a
+ * suffix scan and a prefix scan of the blocks, since every window spans at most two blocks.
+ *
+ * The output matches `rolling_window`: a row is null if its window has fewer than
+ * `min_periods` valid elements, or fewer than `min_periods` elements for COUNT_VALID.
+ *
+ * @param input The input column
+ * @param preceding_window The static rolling window size in the backward direction
+ * @param following_window The static rolling window size in the forward direction
+ * @param min_periods Minimum number of observations in window required to have a value
+ * @param kind The aggregation, which must satisfy `is_sliding_window_supported`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The rolling window aggregation of every row
+ */
+std::unique_ptr<column> sliding_window(column_view const& input,
+                                       size_type preceding_window,
+                                       size_type following_window,
+                                       size_type min_periods,
+                                       aggregation::Kind kind,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr);
+
+}  // namespace detail
+}  // namespace cudf
@@ -16,8 +16,10 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/merge.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/search.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/detail/search.hpp>
 #include <cudf/dictionary/detail/update_keys.hpp>
@@ -35,6 +37,10 @@
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/merge.h>
+
+#include <cmath>
 
 namespace cudf {
 namespace {
@@ -70,11 +76,185 @@ void launch_search(DataIterator it_data,
   }
 }
 
+/**
+ * @brief Returns whether co-iterating sorted values with the table reads fewer rows than a binary
+ * search per value.
+ */
+bool is_merge_search_cheaper(size_type num_rows, size_type num_values)
+{
+  auto const search_steps =
+    static_cast<int64_t>(num_values) * (1 + static_cast<int64_t>(std::log2(num_rows)));
+  return static_cast<int64_t>(num_rows) + num_values < search_steps;
+}
+
+/**
+ * @brief Searches sorted values by merging them with the table, in O(rows + values).
+ *
+ * Equivalent rows of the first input of a merge precede those of the second, so the values are
+ * the first input for a lower bound and the second one for an upper bound. The bound of a value
+ * is the number of rows of the table before it in the merged order.
+ */
+template <bool has_nulls>
+void merge_search(table_device_view const& t,
+                  table_device_view const& values,
+                  size_type* output,
+                  bool find_first,
+                  order const* column_order,
+                  null_order const* null_precedence,
+                  rmm::cuda_stream_view stream)
+{
+  auto const values_side = find_first ? detail::side::LEFT : detail::side::RIGHT;
+  auto const& left       = find_first ? values : t;
+  auto const& right      = find_first ? t : values;
+  auto const comp        = detail::row_lexicographic_tagged_comparator<has_nulls>(
+    left, right, column_order, null_precedence);
+
+  auto const left_begin = detail::make_counting_transform_iterator(
+    0, [] __device__(size_type i) { return detail::index_type{detail::side::LEFT, i}; });
+  auto const right_begin = detail::make_counting_transform_iterator(
+    0, [] __device__(size_type i) { return detail::index_type{detail::side::RIGHT, i}; });
+  detail::index_vector merged(left.num_rows() + right.num_rows(), stream);
+  thrust::merge(rmm::exec_policy(stream),
+                left_begin,
+                left_begin + left.num_rows(),
+                right_begin,
+                right_begin + right.num_rows(),
+                merged.begin(),
+                comp);
+
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    merged.size(),
+    [merged = merged.data(), output, values_side] __device__(size_type position) {
+      auto const entry = merged[position];
+      if (entry.first == values_side) {
+        auto const value_index = entry.second;
+        output[value_index]    = position - value_index;
+      }
+    });
+}
+
+constexpr int cached_search_levels        = 10;
+constexpr size_type cached_search_threads = 256;
+
+/**
+ * @brief Binary searches in which the pivots of the first `cached_search_levels` levels of the
+ * search tree, which every search reads, are loaded once per block into shared memory.
+ *
+ * Node `k` of the tree, in breadth-first order, is the pivot of the range reached by the path
+ * given by the bits of `k + 1` below its leading bit, 1 for the right half.
+ */
+template <typename T, bool find_first, bool ascending>
+__global__ void cached_search_kernel(T const* __restrict__ haystack,
+                                     size_type haystack_size,
+                                     T const* __restrict__ needles,
+                                     size_type num_needles,
+                                     size_type* __restrict__ output)
+{
+  constexpr int cache_size = (1 << cached_search_levels) - 1;
+  __shared__ T cache[cache_size];
+  for (int node = threadIdx.x; node < cache_size; node += blockDim.x) {
+    size_type lo     = 0;
+    size_type hi     = haystack_size;
+    auto const path  = node + 1;
+    auto const depth = 31 - __clz(path);
+    for (int level = depth - 1; level >= 0 and lo < hi; --level) {
+      auto const mid = lo + (hi - lo) / 2;
+      if ((path >> level) & 1) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    if (lo < hi) { cache[node] = haystack[lo + (hi - lo) / 2]; }
+  }
+  __syncthreads();
+
+  // whether the bound of `needle` is after `pivot`
+  auto const goes_right = [](T const& pivot, T const& needle) {
+    if (find_first) { return ascending ? pivot < needle : needle < pivot; }
+    return ascending ? not(needle < pivot) : not(pivot < needle);
+  };
+
+  for (size_type i = threadIdx.x + blockIdx.x * blockDim.x; i < num_needles;
+       i += blockDim.x * gridDim.x) {
+    auto const needle = needles[i];
+    size_type lo      = 0;
+    size_type hi      = haystack_size;
+    int node          = 0;
+    for (int level = 0; level < cached_search_levels and lo < hi; ++level) {
+      auto const mid = lo + (hi - lo) / 2;
+      if (goes_right(cache[node], needle)) {
+        lo   = mid + 1;
+        node = 2 * node + 2;
+      } else {
+        hi   = mid;
+        node = 2 * node + 1;
+      }
+    }
+    while (lo < hi) {
+      auto const mid = lo + (hi - lo) / 2;
+      if (goes_right(haystack[mid], needle)) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    output[i] = lo;
+  }
+}
+
+/**
+ * @brief Searches the values of a column without nulls in another one with the cached kernel, for
+ * the types ordered by `operator<`. Returns false for the other types.
+ */
+struct cached_search_dispatch {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return (cudf::is_integral<T>() and not std::is_same<T, bool>::value) or cudf::is_chrono<T>();
+  }
+
+  template <typename T, std::enable_if_t<is_supported<T>()>* = nullptr>
+  bool operator()(column_view const& haystack,
+                  column_view const& needles,
+                  size_type* output,
+                  bool find_first,
+                  bool ascending,
+                  rmm::cuda_stream_view stream)
+  {
+    auto const kernel = find_first ? (ascending ? cached_search_kernel<T, true, true>
+                                                : cached_search_kernel<T, true, false>)
+                                   : (ascending ? cached_search_kernel<T, false, true>
+                                                : cached_search_kernel<T, false, false>);
+    // several searches per thread amortize the loading of the cache
+    constexpr size_type searches_per_thread = 8;
+    cudf::detail::grid_1d grid{needles.size(), cached_search_threads, searches_per_thread};
+    kernel<<<grid.num_blocks, cached_search_threads, 0, stream.value()>>>(
+      haystack.data<T>(), haystack.size(), needles.data<T>(), needles.size(), output);
+    CHECK_CUDA(stream.value());
+    return true;
+  }
+
+  template <typename T, std::enable_if_t<not is_supported<T>()>* = nullptr>
+  bool operator()(column_view const&,
+                  column_view const&,
+                  size_type*,
+                  bool,
+                  bool,
+                  rmm::cuda_stream_view)
+  {
+    return false;
+  }
+};
+
 std::unique_ptr<column> search_ordered(table_view const& t,
                                        table_view const& values,
                                        bool find_first,
                                        std::vector<order> const& column_order,
                                        std::vector<null_order> const& null_precedence,
+                                       sorted values_sorted,
                                        rmm::cuda_stream_view stream,
                                        rmm::mr::device_memory_resource* mr)
 {
@@ -96,6 +276,28 @@ std::unique_ptr<column> search_ordered(table_view const& t,
     return result;
   }
 
+  if (values.num_rows() == 0) { return result; }
+
+  auto const use_merge_search = values_sorted == sorted::YES and
+                                is_merge_search_cheaper(t.num_rows(), values.num_rows());
+
+  // a single column without nulls is searched with the upper levels of the tree cached
+  if (not use_merge_search and t.num_columns() == 1 and
+      t.column(0).type() == values.column(0).type() and not has_nulls(t) and
+      not has_nulls(values)) {
+    auto const ascending = column_order.empty() or column_order.front() == order::ASCENDING;
+    if (type_dispatcher(t.column(0).type(),
+                        cached_search_dispatch{},
+                        t.column(0),
+                        values.column(0),
+                        result_out,
+                        find_first,
+                        ascending,
+                        stream)) {
+      return result;
+    }
+  }
+
   // This utility will ensure all corresponding dictionary columns have matching keys.
   // It will return any new dictionary columns created as well as updated table_views.
   auto const matched = dictionary::detail::match_dictionaries({t, values}, stream);
@@ -117,6 +319,27 @@ std::unique_ptr<column> search_ordered(table_view const& t,
   auto const null_precedence_dv =
     detail::make_device_uvector_async(null_precedence_flattened, stream);
 
+  if (use_merge_search) {
+    if (has_nulls(t) or has_nulls(values)) {
+      merge_search<true>(*t_d,
+                         *values_d,
+                         result_out,
+                         find_first,
+                         column_order_dv.data(),
+                         null_precedence_dv.data(),
+                         stream);
+    } else {
+      merge_search<false>(*t_d,
+                          *values_d,
+                          result_out,
+                          find_first,
+                          column_order_dv.data(),
+                          null_precedence_dv.data(),
+                          stream);
+    }
+    return result;
+  }
+
   auto const count_it = thrust::make_counting_iterator<size_type>(0);
   if (has_nulls(t) or has_nulls(values)) {
     auto const comp = row_lexicographic_comparator<true>(
@@ -324,7 +547,20 @@ std::unique_ptr<column> lower_bound(table_view const& t,
                                     rmm::cuda_stream_view stream,
                                     rmm::mr::device_memory_resource* mr)
 {
-  return search_ordered(t, values, true, column_order, null_precedence, stream, mr);
+  return search_ordered(
+    t, values, true, column_order, null_precedence, sorted::NO, stream, mr);
+}
+
+std::unique_ptr<column> lower_bound(table_view const& t,
+                                    table_view const& values,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    sorted values_sorted,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  return search_ordered(
+    t, values, true, column_order, null_precedence, values_sorted, stream, mr);
 }
 
 std::unique_ptr<column> upper_bound(table_view const& t,
@@ -334,7 +570,20 @@ std::unique_ptr<column> upper_bound(table_view const& t,
                                     rmm::cuda_stream_view stream,
                                     rmm::mr::device_memory_resource* mr)
 {
-  return search_ordered(t, values, false, column_order, null_precedence, stream, mr);
+  return search_ordered(
+    t, values, false, column_order, null_precedence, sorted::NO, stream, mr);
+}
+
+std::unique_ptr<column> upper_bound(table_view const& t,
+                                    table_view const& values,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    sorted values_sorted,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  return search_ordered(
+    t, values, false, column_order, null_precedence, values_sorted, stream, mr);
 }
 
 }  // namespace detail
@@ -352,6 +601,18 @@ std::unique_ptr<column> lower_bound(table_view const& t,
     t, values, column_order, null_precedence, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> lower_bound(table_view const& t,
+                                    table_view const& values,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    sorted values_sorted,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::lower_bound(
+    t, values, column_order, null_precedence, values_sorted, rmm::cuda_stream_default, mr);
+}
+
 std::unique_ptr<column> upper_bound(table_view const& t,
                                     table_view const& values,
                                     std::vector<order> const& column_order,
@@ -363,6 +624,18 @@ std::unique_ptr<column> upper_bound(table_view const& t,
     t, values, column_order, null_precedence, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<column> upper_bound(table_view const& t,
+                                    table_view const& values,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    sorted values_sorted,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::upper_bound(
+    t, values, column_order, null_precedence, values_sorted, rmm::cuda_stream_default, mr);
+}
+
 bool contains(column_view const& col, scalar const& value)
 {
   CUDF_FUNC_RANGE();
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/merge.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief A block of a sorted run, spilled to host memory or to a file.
+ */
+struct spilled_block {
+  std::vector<uint8_t> metadata;
+  std::vector<uint8_t> data;  // empty if the block is spilled to a file
+  std::string path;           // empty if the block is kept in host memory
+  std::size_t data_size{};
+};
+
+/**
+ * @brief The rows of a run that are not merged yet: the rest of its loaded block, followed by its
+ * spilled blocks.
+ */
+struct run_cursor {
+  std::deque<spilled_block> blocks;
+  rmm::device_buffer head_data;
+  table_view head;
+};
+
+/**
+ * @brief Copies a packed block to host memory, then to the file `path` if it is not empty.
+ */
+spilled_block spill_block(packed_columns const& packed,
+                          std::string const& path,
+                          rmm::cuda_stream_view stream)
+{
+  spilled_block block;
+  block.metadata.assign(packed.metadata_->data(),
+                        packed.metadata_->data() + packed.metadata_->size());
+  block.data_size = packed.gpu_data->size();
+  block.data.resize(block.data_size);
+  CUDA_TRY(cudaMemcpyAsync(block.data.data(),
+                           packed.gpu_data->data(),
+                           block.data_size,
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  stream.synchronize();
+  if (not path.empty()) {
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<char const*>(block.data.data()), block.data_size);
+    CUDF_EXPECTS(file.good(), "Cannot write spill file " + path);
+    block.data = std::vector<uint8_t>{};
+    block.path = path;
+  }
+  return block;
+}
+
+/**
+ * @brief Copies the next spilled block of `run` to the device as its head.
+ */
+void load_next_block(run_cursor& run, rmm::cuda_stream_view stream)
+{
+  auto block = std::move(run.blocks.front());
+  run.blocks.pop_front();
+  if (not block.path.empty()) {
+    block.data.resize(block.data_size);
+    {
+      std::ifstream file(block.path, std::ios::binary);
+      file.read(reinterpret_cast<char*>(block.data.data()), block.data_size);
+      CUDF_EXPECTS(file.good(), "Cannot read spill file " + block.path);
+    }
+    std::remove(block.path.c_str());
+  }
+  run.head_data = rmm::device_buffer(block.data.data(), block.data_size, stream);
+  // The host copy of the block is released on return
+  stream.synchronize();
+  run.head = unpack(block.metadata.data(), static_cast<uint8_t const*>(run.head_data.data()));
+}
+
+}  // namespace
+
+void external_sort(std::function<std::unique_ptr<table>()> const& read_chunk,
+                   std::function<void(std::unique_ptr<table>&&)> const& write_chunk,
+                   std::vector<size_type> const& key_cols,
+                   std::vector<order> const& column_order,
+                   std::vector<null_order> const& null_precedence,
+                   size_type block_rows,
+                   std::string const& spill_directory,
+                   rmm::cuda_stream_view stream,
+                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(!key_cols.empty(), "Empty key_cols");
+  CUDF_EXPECTS(key_cols.size() == column_order.size(),
+               "Mismatched size between key_cols and column_order");
+  CUDF_EXPECTS(null_precedence.empty() or key_cols.size() == null_precedence.size(),
+               "Mismatched size between key_cols and null_precedence");
+  CUDF_EXPECTS(block_rows > 0, "block_rows must be positive");
+  auto const key_null_precedence = null_precedence.empty()
+                                     ? std::vector<null_order>(key_cols.size(), null_order::BEFORE)
+                                     : null_precedence;
+
+  // Sort each chunk into a run, spilled in blocks of `block_rows` rows
+  std::vector<run_cursor> runs;
+  std::unique_ptr<table> empty_input;
+  while (auto chunk = read_chunk()) {
+    auto const input = chunk->view();
+    if (empty_input == nullptr) {
+      CUDF_EXPECTS(key_cols.size() <= static_cast<size_t>(input.num_columns()),
+                   "Too many values in key_cols");
+      empty_input = empty_like(input);
+    } else {
+      CUDF_EXPECTS(have_same_types(empty_input->view(), input), "Mismatched column types");
+    }
+    if (input.num_rows() == 0) { continue; }
+
+    auto const sorted = detail::sort_by_key(input,
+                                            input.select(key_cols),
+                                            column_order,
+                                            key_null_precedence,
+                                            stream,
+                                            rmm::mr::get_current_device_resource());
+    chunk.reset();
+    std::vector<size_type> splits;
+    for (int64_t row = block_rows; row < sorted->num_rows(); row += block_rows) {
+      splits.push_back(static_cast<size_type>(row));
+    }
+    auto const blocks = detail::contiguous_split(
+      sorted->view(), splits, stream, rmm::mr::get_current_device_resource());
+
+    run_cursor run;
+    for (auto const& block : blocks) {
+      auto const path = spill_directory.empty()
+                          ? std::string{}
+                          : spill_directory + "/external_sort_run" + std::to_string(runs.size()) +
+                              "_block" + std::to_string(run.blocks.size()) + ".bin";
+      run.blocks.push_back(spill_block(block.data, path, stream));
+    }
+    runs.push_back(std::move(run));
+  }
+
+  // Merge the runs in rounds, each round producing one output chunk
+  while (true) {
+    for (auto& run : runs) {
+      if (run.head.num_rows() == 0 and not run.blocks.empty()) { load_next_block(run, stream); }
+    }
+
+    // Rows after the last loaded row of a run with spilled blocks may be preceded by rows of its
+    // next block, so only the rows up to the smallest of these last rows are merged
+    table_view bound;
+    for (auto const& run : runs) {
+      if (run.blocks.empty()) { continue; }
+      auto const num_rows = run.head.num_rows();
+      auto const last_row =
+        cudf::slice(run.head.select(key_cols), {num_rows - 1, num_rows}).front();
+      if (bound.num_columns() == 0 or
+          get_value<size_type>(
+            detail::lower_bound(bound, last_row, column_order, key_null_precedence, stream)->view(),
+            0,
+            stream) == 0) {
+        bound = last_row;
+      }
+    }
+
+    std::vector<table_view> merged_rows;
+    for (auto& run : runs) {
+      if (run.head.num_rows() == 0) { continue; }
+      auto const num_merged =
+        bound.num_columns() == 0
+          ? run.head.num_rows()
+          : get_value<size_type>(
+              detail::upper_bound(
+                run.head.select(key_cols), bound, column_order, key_null_precedence, stream)
+                ->view(),
+              0,
+              stream);
+      if (num_merged == 0) { continue; }
+      auto const parts = cudf::split(run.head, {num_merged});
+      merged_rows.push_back(parts.front());
+      run.head = parts.back();
+    }
+    if (merged_rows.empty()) { break; }
+
+    write_chunk(
+      detail::merge(merged_rows, key_cols, column_order, key_null_precedence, stream, mr));
+  }
+}
+
+}  // namespace detail
+
+void external_sort(std::function<std::unique_ptr<table>()> const& read_chunk,
+                   std::function<void(std::unique_ptr<table>&&)> const& write_chunk,
+                   std::vector<size_type> const& key_cols,
+                   std::vector<order> const& column_order,
+                   std::vector<null_order> const& null_precedence,
+                   size_type block_rows,
+                   std::string const& spill_directory,
+                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail::external_sort(read_chunk,
+                        write_chunk,
+                        key_cols,
+                        column_order,
+                        null_precedence,
+                        block_rows,
+                        spill_directory,
+                        rmm::cuda_stream_default,
+                        mr);
+}
+
+}  // namespace cudf
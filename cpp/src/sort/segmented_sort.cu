@@ -19,6 +19,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
@@ -26,6 +27,8 @@
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/table/table_device_view.cuh>
 
+#include <sort/sort_impl.cuh>
+
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
@@ -35,10 +38,15 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/logical.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+#include <cub/device/device_segmented_radix_sort.cuh>
 
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <numeric>
 #include <type_traits>
 
 namespace cudf {
@@ -65,6 +73,90 @@ rmm::device_uvector<size_type> get_segment_indices(size_type num_rows,
   return segment_ids;
 }
 
+namespace {
+
+// The average segment size from which segments are sorted by a segmented radix sort rather than
+// by a radix sort of their segment ids and keys
+constexpr size_type MIN_AVG_SEGMENT_SIZE_FOR_SEGMENTED_RADIX_SORT{100};
+
+/**
+ * @brief Sorts the rows of each segment by their normalized keys with a segmented radix sort,
+ * which launches a block per segment over the `key_bits` bits of the keys. The sort is stable.
+ */
+template <typename Key>
+void segmented_radix_sort(table_view const& keys,
+                          std::vector<normalized_key_digit> const& digits,
+                          int key_bits,
+                          std::vector<order> const& column_order,
+                          std::vector<null_order> const& null_precedence,
+                          column_view const& segment_offsets,
+                          mutable_column_view& indices,
+                          rmm::cuda_stream_view stream)
+{
+  auto const num_rows = keys.num_rows();
+  auto const orders   = column_order.empty()
+                        ? std::vector<order>(keys.num_columns(), order::ASCENDING)
+                        : column_order;
+  auto const null_orders = null_precedence.empty()
+                             ? std::vector<null_order>(keys.num_columns(), null_order::BEFORE)
+                             : null_precedence;
+  auto const d_keys            = table_device_view::create(keys, stream);
+  auto const d_digits          = make_device_uvector_async(digits, stream);
+  auto const d_column_order    = make_device_uvector_async(orders, stream);
+  auto const d_null_precedence = make_device_uvector_async(null_orders, stream);
+
+  rmm::device_uvector<Key> row_keys(num_rows, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(num_rows),
+                    row_keys.begin(),
+                    normalized_key_fn<Key>{*d_keys,
+                                           d_digits.data(),
+                                           d_column_order.data(),
+                                           d_null_precedence.data(),
+                                           0,
+                                           static_cast<size_type>(digits.size())});
+  rmm::device_uvector<Key> sorted_keys(num_rows, stream);
+  rmm::device_uvector<size_type> rows(num_rows, stream);
+  thrust::sequence(rmm::exec_policy(stream), rows.begin(), rows.end(), 0);
+
+  auto const num_segments = segment_offsets.size() - 1;
+  auto const offsets      = segment_offsets.begin<size_type>();
+  rmm::device_buffer d_temp_storage;
+  size_t temp_storage_bytes = 0;
+  cub::DeviceSegmentedRadixSort::SortPairs(d_temp_storage.data(),
+                                           temp_storage_bytes,
+                                           row_keys.data(),
+                                           sorted_keys.data(),
+                                           rows.data(),
+                                           indices.begin<size_type>(),
+                                           num_rows,
+                                           num_segments,
+                                           offsets,
+                                           offsets + 1,
+                                           0,
+                                           key_bits,
+                                           stream.value());
+  d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
+  cub::DeviceSegmentedRadixSort::SortPairs(d_temp_storage.data(),
+                                           temp_storage_bytes,
+                                           row_keys.data(),
+                                           sorted_keys.data(),
+                                           rows.data(),
+                                           indices.begin<size_type>(),
+                                           num_rows,
+                                           num_segments,
+                                           offsets,
+                                           offsets + 1,
+                                           0,
+                                           key_bits,
+                                           stream.value());
+  // protection for temporary device vectors
+  stream.synchronize();
+}
+
+}  // namespace
+
 std::unique_ptr<column> segmented_sorted_order(table_view const& keys,
                                                column_view const& segment_offsets,
                                                std::vector<order> const& column_order,
@@ -74,6 +166,44 @@ std::unique_ptr<column> segmented_sorted_order(table_view const& keys,
 {
   CUDF_EXPECTS(segment_offsets.type() == data_type(type_to_id<size_type>()),
                "segment offsets should be size_type");
+
+  // Long segments of fixed-width keys are sorted separately by a segmented radix sort
+  auto const num_segments = std::max(segment_offsets.size() - 1, 0);
+  auto const digits       = normalized_key_digits(keys);
+  auto const key_bits =
+    std::accumulate(digits.begin(), digits.end(), 0, [](int bits, auto const& digit) {
+      return bits + digit.bits;
+    });
+  // The segmented radix sort leaves the rows outside of the segments unsorted, so the segments
+  // must cover all rows
+  auto const covers_all_rows = [&] {
+    return get_value<size_type>(segment_offsets, 0, stream) == 0 and
+           get_value<size_type>(segment_offsets, num_segments, stream) == keys.num_rows();
+  };
+  if (not digits.empty() and key_bits <= 64 and num_segments > 0 and
+      keys.num_rows() / num_segments >= MIN_AVG_SEGMENT_SIZE_FOR_SEGMENTED_RADIX_SORT and
+      covers_all_rows()) {
+    if (not column_order.empty()) {
+      CUDF_EXPECTS(static_cast<std::size_t>(keys.num_columns()) == column_order.size(),
+                   "Mismatch between number of columns and column order.");
+    }
+    if (not null_precedence.empty()) {
+      CUDF_EXPECTS(static_cast<std::size_t>(keys.num_columns()) == null_precedence.size(),
+                   "Mismatch between number of columns and null_precedence size.");
+    }
+    auto sorted_indices = make_numeric_column(
+      data_type(type_to_id<size_type>()), keys.num_rows(), mask_state::UNALLOCATED, stream, mr);
+    auto indices = sorted_indices->mutable_view();
+    if (key_bits <= 32) {
+      segmented_radix_sort<uint32_t>(
+        keys, digits, key_bits, column_order, null_precedence, segment_offsets, indices, stream);
+    } else {
+      segmented_radix_sort<uint64_t>(
+        keys, digits, key_bits, column_order, null_precedence, segment_offsets, indices, stream);
+    }
+    return sorted_indices;
+  }
+
   // Get segment id of each element in all segments.
   auto segment_ids = get_segment_indices(keys.num_rows(), segment_offsets, stream);
 
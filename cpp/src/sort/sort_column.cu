@@ -131,6 +131,12 @@ std::unique_ptr<column> sorted_order<false>(column_view const& input,
   mutable_column_view indices_view = sorted_indices->mutable_view();
   thrust::sequence(
     rmm::exec_policy(stream), indices_view.begin<size_type>(), indices_view.end<size_type>(), 0);
+  // Strings are radix sorted by their prefixes before the ties are compared
+  if (input.type().id() == type_id::STRING) {
+    prefix_sorted_order(
+      input, column_order == order::ASCENDING, null_precedence, indices_view, stream);
+    return sorted_indices;
+  }
   cudf::type_dispatcher<dispatch_storage_type>(input.type(),
                                                column_sorted_order_fn{},
                                                input,
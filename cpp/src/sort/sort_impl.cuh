@@ -18,7 +18,10 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/string_prefixes.cuh>
+#include <cudf/detail/utilities/assert.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/strings/string_view.cuh>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/error.hpp>
@@ -30,8 +33,24 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/partition.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
 #include <thrust/sequence.h>
 #include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -62,6 +81,380 @@ struct simple_comparator {
   null_order null_precedence{};
 };
 
+/**
+ * @brief Returns the bits of a fixed-width element as an unsigned integer that orders like the
+ * element.
+ *
+ * The sign bit of signed integers is flipped. Positive floating-point values get their sign bit
+ * set and negative ones are inverted. NaNs are normalized to a positive NaN and negative zeros to
+ * zero, which orders them like `relational_compare`.
+ */
+struct normalize_element_fn {
+  template <typename T, std::enable_if_t<std::is_same<T, bool>::value>* = nullptr>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row) const noexcept
+  {
+    return col.element<bool>(row) ? 1 : 0;
+  }
+
+  template <typename T, std::enable_if_t<cudf::is_index_type<T>()>* = nullptr>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row) const noexcept
+  {
+    using U      = std::make_unsigned_t<T>;
+    auto const u = static_cast<U>(col.element<T>(row));
+    return std::is_signed<T>::value ? static_cast<U>(u ^ (U{1} << (sizeof(U) * 8 - 1))) : u;
+  }
+
+  template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row) const noexcept
+  {
+    using U    = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    auto value = col.element<T>(row);
+    if (isnan(value)) { value = std::numeric_limits<T>::quiet_NaN(); }
+    if (value == T{0}) { value = T{0}; }
+    U bits;
+    memcpy(&bits, &value, sizeof(U));
+    auto const sign = U{1} << (sizeof(U) * 8 - 1);
+    return (bits & sign) ? static_cast<U>(~bits) : static_cast<U>(bits | sign);
+  }
+
+  template <typename T, std::enable_if_t<cudf::is_chrono<T>()>* = nullptr>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row) const noexcept
+  {
+    return operator()<typename T::rep>(col, row);
+  }
+
+  template <typename T, std::enable_if_t<cudf::is_fixed_point<T>()>* = nullptr>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row) const noexcept
+  {
+    return operator()<device_storage_type_t<T>>(col, row);
+  }
+
+  template <typename T,
+            std::enable_if_t<not cudf::is_numeric<T>() and not cudf::is_chrono<T>() and
+                             not cudf::is_fixed_point<T>()>* = nullptr>
+  __device__ uint64_t operator()(column_device_view const&, size_type) const noexcept
+  {
+    cudf_assert(false and "Only fixed-width elements can be normalized.");
+    return 0;
+  }
+};
+
+/**
+ * @brief Indicates whether the elements of columns of `type` can be normalized by
+ * `normalize_element_fn`.
+ */
+inline bool is_normalizable(data_type type)
+{
+  return cudf::is_numeric(type) or cudf::is_chrono(type) or cudf::is_fixed_point(type);
+}
+
+/**
+ * @brief A digit of the normalized key of a row: the null indicator or the normalized element of a
+ * key column.
+ */
+struct normalized_key_digit {
+  size_type column;
+  int bits;
+  bool null_indicator;
+};
+
+/**
+ * @brief Packs a range of digits of the normalized key of a row into an unsigned integer that
+ * orders like the row in the lexicographic order of the columns of these digits.
+ *
+ * The first digit takes the most significant bits. The element of a column with nulls has a null
+ * indicator digit followed by its normalized bits, and the other columns only have the latter. The
+ * indicator is set for valid elements if nulls come before them, and for null elements otherwise.
+ * Null elements have no other bits set. The digits of descending columns are inverted, as
+ * `row_lexicographic_comparator` flips the whole element order, nulls included.
+ *
+ * @tparam Key The unsigned integer that holds the bits of all digits of the range
+ */
+template <typename Key>
+struct normalized_key_fn {
+  table_device_view keys;
+  normalized_key_digit const* digits;
+  order const* column_order;
+  null_order const* null_precedence;
+  size_type first_digit;
+  size_type last_digit;
+
+  __device__ Key operator()(size_type row) const noexcept
+  {
+    Key key = 0;
+    for (size_type d = first_digit; d < last_digit; ++d) {
+      auto const digit   = digits[d];
+      auto const& col    = keys.column(digit.column);
+      auto const is_null = col.is_null(row);
+      Key value          = 0;
+      if (digit.null_indicator) {
+        value = is_null == (null_precedence[digit.column] == null_order::AFTER);
+      } else if (not is_null) {
+        value = static_cast<Key>(type_dispatcher(col.type(), normalize_element_fn{}, col, row));
+      }
+      auto const full_width = digit.bits == static_cast<int>(sizeof(Key) * 8);
+      if (column_order[digit.column] == order::DESCENDING) {
+        value = full_width ? static_cast<Key>(~value) : value ^ ((Key{1} << digit.bits) - 1);
+      }
+      key = full_width ? value : (key << digit.bits) | value;
+    }
+    return key;
+  }
+};
+
+/**
+ * @brief Sorts `indices` by the digits `[first_digit, last_digit)` of the normalized keys of their
+ * rows with a stable radix sort.
+ *
+ * The keys of the rows are computed in the current order of `indices`, so that sorting the ranges
+ * of digits from the last to the first is a least significant digit radix sort of the rows.
+ */
+template <typename Key>
+void radix_sort_pass(table_device_view const& keys,
+                     normalized_key_digit const* digits,
+                     order const* column_order,
+                     null_order const* null_precedence,
+                     size_type first_digit,
+                     size_type last_digit,
+                     mutable_column_view& indices,
+                     rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<Key> row_keys(indices.size(), stream);
+  thrust::transform(
+    rmm::exec_policy(stream),
+    indices.begin<size_type>(),
+    indices.end<size_type>(),
+    row_keys.begin(),
+    normalized_key_fn<Key>{
+      keys, digits, column_order, null_precedence, first_digit, last_digit});
+  thrust::stable_sort_by_key(
+    rmm::exec_policy(stream), row_keys.begin(), row_keys.end(), indices.begin<size_type>());
+}
+
+/**
+ * @brief Returns the digits of the normalized keys of the rows of `input`, or an empty vector if
+ * `input` has columns that cannot be normalized.
+ */
+inline std::vector<normalized_key_digit> normalized_key_digits(table_view const& input)
+{
+  if (not std::all_of(input.begin(), input.end(), [](column_view const& col) {
+        return is_normalizable(col.type());
+      })) {
+    return {};
+  }
+  std::vector<normalized_key_digit> digits;
+  for (size_type c = 0; c < input.num_columns(); ++c) {
+    if (input.column(c).has_nulls()) { digits.push_back({c, 1, true}); }
+    digits.push_back({c, static_cast<int>(cudf::size_of(input.column(c).type()) * 8), false});
+  }
+  return digits;
+}
+
+/**
+ * @brief Sorts `indices` by the rows of `input` with radix sorts of their normalized keys, if all
+ * columns of `input` are fixed-width.
+ *
+ * Consecutive digits of the normalized keys are packed into unsigned integers of up to 64 bits,
+ * which are radix sorted from the last to the first. Keys of up to 64 bits in total, e.g. two
+ * 32-bit columns without nulls, take a single radix sort. The sort is stable.
+ *
+ * @return true if `indices` are sorted, false if `input` has columns that cannot be normalized
+ */
+inline bool radix_sorted_order(table_view const& input,
+                               std::vector<order> const& column_order,
+                               std::vector<null_order> const& null_precedence,
+                               mutable_column_view& indices,
+                               rmm::cuda_stream_view stream)
+{
+  auto const digits = normalized_key_digits(input);
+  if (digits.empty()) { return false; }
+
+  // Consecutive digits that fit in 64 bits are packed together
+  std::vector<std::pair<size_type, int>> ranges;  // the first digit and bits of each range
+  for (size_type d = 0; d < static_cast<size_type>(digits.size()); ++d) {
+    if (ranges.empty() or ranges.back().second + digits[d].bits > 64) {
+      ranges.emplace_back(d, 0);
+    }
+    ranges.back().second += digits[d].bits;
+  }
+
+  auto const orders = column_order.empty()
+                        ? std::vector<order>(input.num_columns(), order::ASCENDING)
+                        : column_order;
+  auto const null_orders = null_precedence.empty()
+                             ? std::vector<null_order>(input.num_columns(), null_order::BEFORE)
+                             : null_precedence;
+  auto const d_input           = table_device_view::create(input, stream);
+  auto const d_digits          = make_device_uvector_async(digits, stream);
+  auto const d_column_order    = make_device_uvector_async(orders, stream);
+  auto const d_null_precedence = make_device_uvector_async(null_orders, stream);
+
+  for (auto range = ranges.size(); range-- > 0;) {
+    auto const first_digit = ranges[range].first;
+    auto const last_digit  = range + 1 < ranges.size() ? ranges[range + 1].first
+                                                       : static_cast<size_type>(digits.size());
+    if (ranges[range].second <= 32) {
+      radix_sort_pass<uint32_t>(*d_input,
+                                d_digits.data(),
+                                d_column_order.data(),
+                                d_null_precedence.data(),
+                                first_digit,
+                                last_digit,
+                                indices,
+                                stream);
+    } else {
+      radix_sort_pass<uint64_t>(*d_input,
+                                d_digits.data(),
+                                d_column_order.data(),
+                                d_null_precedence.data(),
+                                first_digit,
+                                last_digit,
+                                indices,
+                                stream);
+    }
+  }
+  // protection for temporary device vectors
+  stream.synchronize();
+  return true;
+}
+
+/**
+ * @brief Returns the first 8 bytes of a string as a big-endian unsigned integer padded with zeros,
+ * inverted for a descending order.
+ *
+ * Strings with different prefixes order like their prefixes, strings with equal prefixes need a
+ * full comparison. Null rows have a zero prefix.
+ */
+struct string_prefix_fn {
+  column_device_view strings;
+  bool ascending;
+
+  __device__ uint64_t operator()(size_type row) const noexcept
+  {
+    if (strings.is_null(row)) { return 0; }
+    auto const prefix = make_string_prefix(strings.element<string_view>(row)).bytes;
+    return ascending ? prefix : ~prefix;
+  }
+};
+
+/**
+ * @brief Orders the positions of rows with equal prefixes by their range of equal prefixes, then
+ * by their strings.
+ */
+struct string_tie_comparator {
+  column_device_view strings;
+  size_type const* indices;
+  size_type const* tie_range_begins;
+  bool ascending;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const noexcept
+  {
+    if (tie_range_begins[lhs] != tie_range_begins[rhs]) {
+      return tie_range_begins[lhs] < tie_range_begins[rhs];
+    }
+    auto const result = strings.element<string_view>(indices[lhs])
+                          .compare(strings.element<string_view>(indices[rhs]));
+    return ascending ? result < 0 : result > 0;
+  }
+};
+
+/**
+ * @brief Sorts `indices` by a strings column, radix sorting the rows by their 8-byte prefixes
+ * before comparing the full strings of the rows with equal prefixes only.
+ *
+ * The sort is stable.
+ */
+inline void prefix_sorted_order(column_view const& input,
+                                bool ascending,
+                                null_order null_precedence,
+                                mutable_column_view& indices,
+                                rmm::cuda_stream_view stream)
+{
+  auto const num_rows = input.size();
+  if (num_rows == 0) { return; }
+  auto const d_input   = column_device_view::create(input, stream);
+  auto const prefix    = string_prefix_fn{*d_input, ascending};
+  auto const d_indices = indices.begin<size_type>();
+
+  rmm::device_uvector<uint64_t> prefixes(num_rows, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(num_rows),
+                    prefixes.begin(),
+                    prefix);
+  thrust::stable_sort_by_key(rmm::exec_policy(stream), prefixes.begin(), prefixes.end(), d_indices);
+  if (input.has_nulls()) {
+    auto const nulls_first = (null_precedence == null_order::BEFORE) == ascending;
+    thrust::stable_partition(rmm::exec_policy(stream),
+                             d_indices,
+                             d_indices + num_rows,
+                             [d_input = *d_input, nulls_first] __device__(size_type row) {
+                               return d_input.is_null(row) == nulls_first;
+                             });
+    thrust::transform(
+      rmm::exec_policy(stream), d_indices, d_indices + num_rows, prefixes.begin(), prefix);
+  }
+
+  // Positions of valid rows whose prefix equals a neighbor's, in ranges of equal prefixes
+  auto const is_tie = [d_input   = *d_input,
+                       d_indices = static_cast<size_type const*>(d_indices),
+                       prefixes  = prefixes.data(),
+                       num_rows] __device__(size_type pos) {
+    auto const equal_to = [&](size_type other) {
+      return other >= 0 and other < num_rows and prefixes[other] == prefixes[pos] and
+             d_input.is_valid(d_indices[other]);
+    };
+    return d_input.is_valid(d_indices[pos]) and (equal_to(pos - 1) or equal_to(pos + 1));
+  };
+  rmm::device_uvector<size_type> tie_positions(num_rows, stream);
+  auto const num_ties = static_cast<size_type>(
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(num_rows),
+                    tie_positions.begin(),
+                    is_tie) -
+    tie_positions.begin());
+  if (num_ties == 0) { return; }
+  tie_positions.resize(num_ties, stream);
+
+  // The first position of the range of equal prefixes of each position
+  auto const range_begins = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(0), [prefixes = prefixes.data()] __device__(size_type pos) {
+      return pos == 0 or prefixes[pos] != prefixes[pos - 1] ? pos : 0;
+    });
+  rmm::device_uvector<size_type> tie_range_begins(num_rows, stream);
+  thrust::inclusive_scan(rmm::exec_policy(stream),
+                         range_begins,
+                         range_begins + num_rows,
+                         tie_range_begins.begin(),
+                         thrust::maximum<size_type>());
+
+  // Each range of ties is sorted by the full strings within its own positions
+  rmm::device_uvector<size_type> sorted_tie_positions(num_ties, stream);
+  thrust::copy(rmm::exec_policy(stream),
+               tie_positions.begin(),
+               tie_positions.end(),
+               sorted_tie_positions.begin());
+  thrust::stable_sort(
+    rmm::exec_policy(stream),
+    sorted_tie_positions.begin(),
+    sorted_tie_positions.end(),
+    string_tie_comparator{*d_input, d_indices, tie_range_begins.data(), ascending});
+  rmm::device_uvector<size_type> sorted_tie_rows(num_ties, stream);
+  thrust::gather(rmm::exec_policy(stream),
+                 sorted_tie_positions.begin(),
+                 sorted_tie_positions.end(),
+                 d_indices,
+                 sorted_tie_rows.begin());
+  thrust::scatter(rmm::exec_policy(stream),
+                  sorted_tie_rows.begin(),
+                  sorted_tie_rows.end(),
+                  tie_positions.begin(),
+                  d_indices);
+  // protection for temporary device vectors
+  stream.synchronize();
+}
+
 /**
  * @brief Sort indices of a single column.
  *
@@ -126,13 +519,29 @@ std::unique_ptr<column> sorted_order(table_view input,
 
   auto flattened = structs::detail::flatten_nested_columns(input, column_order, null_precedence);
   auto& input_flattened     = std::get<0>(flattened);
+
+  // Fixed-width keys are radix sorted by their normalized bits rather than by the comparator
+  if (radix_sorted_order(input_flattened,
+                         std::get<1>(flattened),
+                         std::get<2>(flattened),
+                         mutable_indices_view,
+                         stream)) {
+    return sorted_indices;
+  }
+
   auto device_table         = table_device_view::create(input_flattened, stream);
   auto const d_column_order = make_device_uvector_async(std::get<1>(flattened), stream);
+  // Strings are compared by their cached prefixes before their characters
+  auto const prefixes = table_string_prefixes(input_flattened, stream);
 
   if (has_nulls(input_flattened)) {
     auto const d_null_precedence = make_device_uvector_async(std::get<2>(flattened), stream);
-    auto const comparator        = row_lexicographic_comparator<true>(
-      *device_table, *device_table, d_column_order.data(), d_null_precedence.data());
+    auto const comparator        = row_lexicographic_comparator<true>(*device_table,
+                                                                      *device_table,
+                                                                      d_column_order.data(),
+                                                                      d_null_precedence.data(),
+                                                                      prefixes.data(),
+                                                                      prefixes.data());
     if (stable) {
       thrust::stable_sort(rmm::exec_policy(stream),
                           mutable_indices_view.begin<size_type>(),
@@ -147,8 +556,12 @@ std::unique_ptr<column> sorted_order(table_view input,
     // protection for temporary d_column_order and d_null_precedence
     stream.synchronize();
   } else {
-    auto const comparator =
-      row_lexicographic_comparator<false>(*device_table, *device_table, d_column_order.data());
+    auto const comparator = row_lexicographic_comparator<false>(*device_table,
+                                                                *device_table,
+                                                                d_column_order.data(),
+                                                                nullptr,
+                                                                prefixes.data(),
+                                                                prefixes.data());
     if (stable) {
       thrust::stable_sort(rmm::exec_policy(stream),
                           mutable_indices_view.begin<size_type>(),
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <sort/sort_impl.cuh>
+#include <structs/utilities.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <numeric>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// Number of bits of the normalized keys selected in each pass of the radix select
+constexpr int RADIX_SELECT_BITS{16};
+constexpr uint64_t RADIX_SELECT_DIGIT_MASK{(uint64_t{1} << RADIX_SELECT_BITS) - 1};
+
+/**
+ * @brief Returns the normalized key of the `rank`-th smallest of `keys`, counting from 0.
+ *
+ * Each pass counts the keys that match the digits selected so far by their next
+ * `RADIX_SELECT_BITS` bits, and selects the digit whose bucket holds the key of `rank`.
+ */
+uint64_t radix_select(device_span<uint64_t const> keys,
+                      size_type rank,
+                      int key_bits,
+                      rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<size_type> histogram(RADIX_SELECT_DIGIT_MASK + 1, stream);
+  uint64_t prefix = 0;
+  for (int shift = cudf::util::round_up_safe(key_bits, RADIX_SELECT_BITS) - RADIX_SELECT_BITS;
+       shift >= 0;
+       shift -= RADIX_SELECT_BITS) {
+    auto const high_mask =
+      shift + RADIX_SELECT_BITS >= 64 ? uint64_t{0} : ~uint64_t{0} << (shift + RADIX_SELECT_BITS);
+    thrust::fill(rmm::exec_policy(stream), histogram.begin(), histogram.end(), 0);
+    thrust::for_each(rmm::exec_policy(stream),
+                     keys.begin(),
+                     keys.end(),
+                     [histogram = histogram.data(), prefix, high_mask, shift] __device__(
+                       uint64_t key) {
+                       if ((key & high_mask) != prefix) { return; }
+                       atomicAdd(&histogram[(key >> shift) & RADIX_SELECT_DIGIT_MASK], 1);
+                     });
+    thrust::inclusive_scan(
+      rmm::exec_policy(stream), histogram.begin(), histogram.end(), histogram.begin());
+    // The bucket of `rank` is the first whose cumulative count exceeds it
+    auto const bucket = static_cast<size_type>(thrust::upper_bound(rmm::exec_policy(stream),
+                                                                   histogram.begin(),
+                                                                   histogram.end(),
+                                                                   rank) -
+                                               histogram.begin());
+    if (bucket > 0) { rank -= histogram.element(bucket - 1, stream); }
+    prefix |= static_cast<uint64_t>(bucket) << shift;
+  }
+  return prefix;
+}
+
+/**
+ * @brief Selects the first `k` rows of `keys` with a radix select of their normalized keys, then
+ * sorts only these rows.
+ *
+ * Rows whose key is smaller than the `k`-th key are selected, followed by the first rows in row
+ * order whose key equals it, which keeps the result stable.
+ */
+std::unique_ptr<column> radix_top_k(table_view const& keys,
+                                    std::vector<normalized_key_digit> const& digits,
+                                    int key_bits,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = keys.num_rows();
+  auto const orders   = column_order.empty()
+                        ? std::vector<order>(keys.num_columns(), order::ASCENDING)
+                        : column_order;
+  auto const null_orders = null_precedence.empty()
+                             ? std::vector<null_order>(keys.num_columns(), null_order::BEFORE)
+                             : null_precedence;
+  auto const d_keys            = table_device_view::create(keys, stream);
+  auto const d_digits          = make_device_uvector_async(digits, stream);
+  auto const d_column_order    = make_device_uvector_async(orders, stream);
+  auto const d_null_precedence = make_device_uvector_async(null_orders, stream);
+
+  rmm::device_uvector<uint64_t> row_keys(num_rows, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(num_rows),
+                    row_keys.begin(),
+                    normalized_key_fn<uint64_t>{*d_keys,
+                                                d_digits.data(),
+                                                d_column_order.data(),
+                                                d_null_precedence.data(),
+                                                0,
+                                                static_cast<size_type>(digits.size())});
+  auto const kth_key = radix_select(row_keys, k - 1, key_bits, stream);
+
+  auto result = make_numeric_column(
+    data_type(type_to_id<size_type>()), k, mask_state::UNALLOCATED, stream, mr);
+  auto const indices = result->mutable_view().begin<size_type>();
+  auto const d_row_keys = row_keys.data();
+  auto const num_smaller = static_cast<size_type>(
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(num_rows),
+                    indices,
+                    [d_row_keys, kth_key] __device__(size_type row) {
+                      return d_row_keys[row] < kth_key;
+                    }) -
+    indices);
+  rmm::device_uvector<size_type> equal_rows(num_rows - num_smaller, stream);
+  thrust::copy_if(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator(0),
+                  thrust::make_counting_iterator(num_rows),
+                  equal_rows.begin(),
+                  [d_row_keys, kth_key] __device__(size_type row) {
+                    return d_row_keys[row] == kth_key;
+                  });
+  thrust::copy(rmm::exec_policy(stream),
+               equal_rows.begin(),
+               equal_rows.begin() + (k - num_smaller),
+               indices + num_smaller);
+
+  // Only the selected rows are sorted, by their keys
+  rmm::device_uvector<uint64_t> selected_keys(k, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    indices,
+                    indices + k,
+                    selected_keys.begin(),
+                    [d_row_keys] __device__(size_type row) { return d_row_keys[row]; });
+  thrust::stable_sort_by_key(
+    rmm::exec_policy(stream), selected_keys.begin(), selected_keys.end(), indices);
+  return result;
+}
+
+}  // namespace
+
+std::unique_ptr<column> top_k(table_view const& keys,
+                              size_type k,
+                              std::vector<order> const& column_order,
+                              std::vector<null_order> const& null_precedence,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(k >= 0, "k must not be negative.");
+  if (not column_order.empty()) {
+    CUDF_EXPECTS(static_cast<std::size_t>(keys.num_columns()) == column_order.size(),
+                 "Mismatch between number of columns and column order.");
+  }
+  if (not null_precedence.empty()) {
+    CUDF_EXPECTS(static_cast<std::size_t>(keys.num_columns()) == null_precedence.size(),
+                 "Mismatch between number of columns and null_precedence size.");
+  }
+
+  k = std::min(k, keys.num_rows());
+  if (k == 0 or keys.num_columns() == 0) {
+    return make_numeric_column(
+      data_type(type_to_id<size_type>()), 0, mask_state::UNALLOCATED, stream, mr);
+  }
+
+  auto flattened   = structs::detail::flatten_nested_columns(keys, column_order, null_precedence);
+  auto& flat_keys  = std::get<0>(flattened);
+  auto const digits = normalized_key_digits(flat_keys);
+  auto const key_bits =
+    std::accumulate(digits.begin(), digits.end(), 0, [](int bits, auto const& digit) {
+      return bits + digit.bits;
+    });
+  if (not digits.empty() and key_bits <= 64 and k < keys.num_rows()) {
+    return radix_top_k(flat_keys,
+                       digits,
+                       key_bits,
+                       k,
+                       std::get<1>(flattened),
+                       std::get<2>(flattened),
+                       stream,
+                       mr);
+  }
+
+  // Otherwise all rows are sorted
+  auto sorted = detail::stable_sorted_order(
+    keys, column_order, null_precedence, stream, rmm::mr::get_current_device_resource());
+  return std::make_unique<column>(cudf::slice(sorted->view(), {0, k}).front(), stream, mr);
+}
+
+std::unique_ptr<column> segmented_top_k(table_view const& keys,
+                                        column_view const& segment_offsets,
+                                        size_type k,
+                                        std::vector<order> const& column_order,
+                                        std::vector<null_order> const& null_precedence,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(segment_offsets.type() == data_type(type_to_id<size_type>()),
+               "segment offsets should be size_type");
+  CUDF_EXPECTS(k >= 0, "k must not be negative.");
+  auto const num_segments = std::max(segment_offsets.size() - 1, 0);
+
+  auto const sorted = detail::segmented_sorted_order(keys,
+                                                     segment_offsets,
+                                                     column_order,
+                                                     null_precedence,
+                                                     stream,
+                                                     rmm::mr::get_current_device_resource());
+
+  // The first min(k, size) sorted rows of each segment are selected
+  auto offsets = make_numeric_column(
+    data_type(type_to_id<size_type>()), num_segments + 1, mask_state::UNALLOCATED, stream, mr);
+  auto const d_offsets         = offsets->mutable_view().begin<size_type>();
+  auto const d_segment_offsets = segment_offsets.begin<size_type>();
+  thrust::fill_n(rmm::exec_policy(stream), d_offsets, 1, 0);
+  auto const selected_sizes = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(0), [d_segment_offsets, k] __device__(size_type segment) {
+      return min(k, d_segment_offsets[segment + 1] - d_segment_offsets[segment]);
+    });
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), selected_sizes, selected_sizes + num_segments, d_offsets + 1);
+
+  auto const num_selected = get_value<size_type>(offsets->view(), num_segments, stream);
+  auto indices            = make_numeric_column(
+    data_type(type_to_id<size_type>()), num_selected, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(num_selected),
+                    indices->mutable_view().begin<size_type>(),
+                    [d_offsets,
+                     d_segment_offsets,
+                     num_segments,
+                     d_sorted = sorted->view().begin<size_type>()] __device__(size_type i) {
+                      auto const segment =
+                        thrust::upper_bound(thrust::seq, d_offsets, d_offsets + num_segments, i) -
+                        d_offsets - 1;
+                      return d_sorted[d_segment_offsets[segment] + (i - d_offsets[segment])];
+                    });
+
+  return make_lists_column(
+    num_segments, std::move(offsets), std::move(indices), 0, rmm::device_buffer{}, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> top_k(table_view const& keys,
+                              size_type k,
+                              std::vector<order> const& column_order,
+                              std::vector<null_order> const& null_precedence,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k(keys, k, column_order, null_precedence, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> segmented_top_k(table_view const& keys,
+                                        column_view const& segment_offsets,
+                                        size_type k,
+                                        std::vector<order> const& column_order,
+                                        std::vector<null_order> const& null_precedence,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_top_k(
+    keys, segment_offsets, k, column_order, null_precedence, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
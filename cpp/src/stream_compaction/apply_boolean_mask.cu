@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/copy_if.cuh>
@@ -82,6 +83,30 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
   }
 }
 
+
+/*
+ * Computes the indices of the rows passing a boolean mask.
+ *
+ * calls copy_if_gather_map() with the `boolean_mask_filter` functor.
+ */
+std::unique_ptr<column> boolean_mask_gather_map(column_view const& boolean_mask,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(boolean_mask.type().id() == type_id::BOOL8, "Mask must be Boolean type");
+
+  auto device_boolean_mask = cudf::column_device_view::create(boolean_mask, stream);
+  auto gather_map =
+    boolean_mask.has_nulls()
+      ? detail::copy_if_gather_map(
+          boolean_mask.size(), boolean_mask_filter<true>{*device_boolean_mask}, stream, mr)
+      : detail::copy_if_gather_map(
+          boolean_mask.size(), boolean_mask_filter<false>{*device_boolean_mask}, stream, mr);
+
+  auto const size = static_cast<size_type>(gather_map.size());
+  return std::make_unique<column>(data_type{type_id::INT32}, size, gather_map.release());
+}
+
 }  // namespace detail
 
 /*
@@ -94,4 +119,14 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
   CUDF_FUNC_RANGE();
   return detail::apply_boolean_mask(input, boolean_mask, rmm::cuda_stream_default, mr);
 }
+
+/*
+ * Computes the indices of the rows passing a boolean mask.
+ */
+std::unique_ptr<column> boolean_mask_gather_map(column_view const& boolean_mask,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::boolean_mask_gather_map(boolean_mask, rmm::cuda_stream_default, mr);
+}
 }  // namespace cudf
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <hash/concurrent_unordered_map.cuh>
+#include <hash/helper_functions.cuh>
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <limits>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Inserts each row into the set of distinct rows, and stores the row of the set that it
+ * duplicates, or itself if it was inserted.
+ */
+template <typename Map>
+struct insert_row_fn {
+  Map map;
+  size_type* representatives;
+
+  __device__ void operator()(size_type row)
+  {
+    representatives[row] = map.insert(thrust::make_pair(row, row)).first->second;
+  }
+};
+
+/**
+ * @brief Returns the indices of the rows of `keys` to keep, in increasing order.
+ *
+ * The rows are inserted into an open-addressing hash set of row indices, which gives each row the
+ * index of the first row inserted among its duplicates. For `KEEP_FIRST`, `KEEP_LAST` and
+ * `KEEP_NONE`, the minimum index, maximum index, or count of the duplicates of each of these
+ * representative rows is then reduced with atomics.
+ */
+template <bool has_nulls>
+rmm::device_uvector<size_type> distinct_indices(table_view const& keys,
+                                                duplicate_keep_option keep,
+                                                null_equality nulls_equal,
+                                                rmm::cuda_stream_view stream)
+{
+  size_type constexpr unused_key{std::numeric_limits<size_type>::max()};
+  using map_type = concurrent_unordered_map<size_type,
+                                            size_type,
+                                            row_hasher<default_hash, has_nulls>,
+                                            row_equality_comparator<has_nulls>>;
+
+  auto const num_rows = keys.num_rows();
+  auto const d_keys   = table_device_view::create(keys, stream);
+  row_hasher<default_hash, has_nulls> hasher{*d_keys};
+  row_equality_comparator<has_nulls> rows_equal{
+    *d_keys, *d_keys, nulls_equal == null_equality::EQUAL};
+  auto const map = map_type::create(compute_hash_table_size(num_rows),
+                                    stream,
+                                    unused_key,
+                                    unused_key,
+                                    hasher,
+                                    rows_equal,
+                                    typename map_type::allocator_type());
+
+  rmm::device_uvector<size_type> representatives(num_rows, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator(0),
+                     num_rows,
+                     insert_row_fn<map_type>{*map, representatives.data()});
+
+  // The row to keep, or the number of duplicates for `KEEP_NONE`, of each representative row
+  rmm::device_uvector<size_type> kept_rows(
+    keep == duplicate_keep_option::KEEP_ANY ? 0 : num_rows, stream);
+  auto const d_representatives = representatives.data();
+  auto const d_kept_rows       = kept_rows.data();
+  if (keep != duplicate_keep_option::KEEP_ANY) {
+    thrust::fill(rmm::exec_policy(stream),
+                 kept_rows.begin(),
+                 kept_rows.end(),
+                 keep == duplicate_keep_option::KEEP_FIRST  ? num_rows
+                 : keep == duplicate_keep_option::KEEP_LAST ? -1
+                                                            : 0);
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator(0),
+      num_rows,
+      [d_representatives, d_kept_rows, keep] __device__(size_type row) {
+        auto const kept_row = &d_kept_rows[d_representatives[row]];
+        switch (keep) {
+          case duplicate_keep_option::KEEP_FIRST: atomicMin(kept_row, row); break;
+          case duplicate_keep_option::KEEP_LAST: atomicMax(kept_row, row); break;
+          default: atomicAdd(kept_row, 1);
+        }
+      });
+  }
+
+  // Copying the kept rows in increasing order preserves the order of the input
+  rmm::device_uvector<size_type> indices(num_rows, stream);
+  auto const indices_end = thrust::copy_if(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator(0),
+    thrust::make_counting_iterator(num_rows),
+    indices.begin(),
+    [d_representatives, d_kept_rows, keep] __device__(size_type row) {
+      auto const representative = d_representatives[row];
+      switch (keep) {
+        case duplicate_keep_option::KEEP_ANY: return representative == row;
+        case duplicate_keep_option::KEEP_NONE: return d_kept_rows[representative] == 1;
+        default: return d_kept_rows[representative] == row;
+      }
+    });
+  indices.resize(thrust::distance(indices.begin(), indices_end), stream);
+  return indices;
+}
+
+}  // namespace
+
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                duplicate_keep_option keep,
+                                null_equality nulls_equal,
+                                rmm::cuda_stream_view stream,
+                                rmm::mr::device_memory_resource* mr)
+{
+  if (0 == input.num_rows() || 0 == input.num_columns() || 0 == keys.size()) {
+    return empty_like(input);
+  }
+
+  auto const keys_view = input.select(keys);
+  auto const indices   = cudf::has_nulls(keys_view)
+                         ? distinct_indices<true>(keys_view, keep, nulls_equal, stream)
+                         : distinct_indices<false>(keys_view, keep, nulls_equal, stream);
+
+  return detail::gather(input,
+                        column_view(data_type{type_id::INT32},
+                                    static_cast<size_type>(indices.size()),
+                                    indices.data()),
+                        out_of_bounds_policy::DONT_CHECK,
+                        detail::negative_index_policy::NOT_ALLOWED,
+                        stream,
+                        mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                duplicate_keep_option keep,
+                                null_equality nulls_equal,
+                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::distinct(input, keys, keep, nulls_equal, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,31 +14,103 @@
  * limitations under the License.
  */
 
+#include <hash/concurrent_unordered_map.cuh>
+#include <hash/helper_functions.cuh>
+
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/hyperloglog.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/count.h>
 #include <thrust/execution_policy.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <vector>
 
 namespace cudf {
 namespace detail {
 
+namespace {
+
+/**
+ * @brief Inserts a row into the hash set of distinct rows, returns true if no equal row was
+ * inserted before.
+ */
+template <typename Map>
+struct insert_distinct_row_fn {
+  Map map;
+
+  __device__ bool operator()(size_type row)
+  {
+    return map.insert(thrust::make_pair(row, row)).second;
+  }
+};
+
+/**
+ * @brief Counts the distinct rows of `keys` by inserting them into an open-addressing hash set
+ * of row indices.
+ */
+template <bool has_nulls>
+cudf::size_type hash_distinct_count(table_view const& keys,
+                                    null_equality nulls_equal,
+                                    rmm::cuda_stream_view stream)
+{
+  size_type constexpr unused_key{std::numeric_limits<size_type>::max()};
+  using map_type = concurrent_unordered_map<size_type,
+                                            size_type,
+                                            row_hasher<default_hash, has_nulls>,
+                                            row_equality_comparator<has_nulls>>;
+
+  auto const d_keys = table_device_view::create(keys, stream);
+  row_hasher<default_hash, has_nulls> hasher{*d_keys};
+  row_equality_comparator<has_nulls> rows_equal{
+    *d_keys, *d_keys, nulls_equal == null_equality::EQUAL};
+  auto const map = map_type::create(compute_hash_table_size(keys.num_rows()),
+                                    stream,
+                                    unused_key,
+                                    unused_key,
+                                    hasher,
+                                    rows_equal,
+                                    typename map_type::allocator_type());
+  return thrust::count_if(rmm::exec_policy(stream),
+                          thrust::counting_iterator<cudf::size_type>(0),
+                          thrust::counting_iterator<cudf::size_type>(keys.num_rows()),
+                          insert_distinct_row_fn<map_type>{*map});
+}
+
+}  // namespace
+
 cudf::size_type distinct_count(table_view const& keys,
                                null_equality nulls_equal,
                                rmm::cuda_stream_view stream)
 {
+  if (keys.num_rows() == 0) { return 0; }
+
+  // Rows without nested columns are counted by a hash set rather than sorted
+  if (std::none_of(
+        keys.begin(), keys.end(), [](auto const& col) { return cudf::is_nested(col.type()); })) {
+    return cudf::has_nulls(keys) ? hash_distinct_count<true>(keys, nulls_equal, stream)
+                                 : hash_distinct_count<false>(keys, nulls_equal, stream);
+  }
+
   // sort only indices
   auto sorted_indices = sorted_order(keys,
                                      std::vector<order>{},
@@ -179,6 +251,28 @@ cudf::size_type distinct_count(column_view const& input,
     return count;
 }
 
+cudf::size_type approx_distinct_count(column_view const& input,
+                                      double max_relative_error,
+                                      null_policy null_handling,
+                                      rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(max_relative_error > 0, "max_relative_error must be positive");
+  if (0 == input.size()) { return 0; }
+
+  // The relative standard error of a sketch with 2^precision registers is 1.04 / 2^(precision / 2)
+  auto const min_registers = std::pow(1.04 / max_relative_error, 2);
+  auto const precision =
+    std::min(std::max(static_cast<int>(std::ceil(std::log2(min_registers))), 4), 18);
+
+  rmm::device_uvector<size_type> labels(input.size(), stream);
+  CUDA_TRY(cudaMemsetAsync(labels.data(), 0, labels.size() * sizeof(size_type), stream.value()));
+  auto const estimate = group_approx_count_distinct(
+    input, labels, 1, precision, stream, rmm::mr::get_current_device_resource());
+  auto const count = static_cast<size_type>(get_value<int64_t>(estimate->view(), 0, stream));
+
+  return null_handling == null_policy::INCLUDE and input.has_nulls() ? count + 1 : count;
+}
+
 }  // namespace detail
 
 cudf::size_type distinct_count(column_view const& input,
@@ -195,4 +289,12 @@ cudf::size_type distinct_count(table_view const& input, null_equality nulls_equa
   return detail::distinct_count(input, nulls_equal);
 }
 
+cudf::size_type approx_distinct_count(column_view const& input,
+                                      double max_relative_error,
+                                      null_policy null_handling)
+{
+  CUDF_FUNC_RANGE();
+  return detail::approx_distinct_count(input, max_relative_error, null_handling);
+}
+
 }  // namespace cudf
@@ -192,6 +192,8 @@ std::unique_ptr<table> drop_duplicates(table_view const& input,
   }
 
   auto keys_view = input.select(keys);
+  // The first of the sorted duplicate rows is as good as any
+  if (keep == duplicate_keep_option::KEEP_ANY) { keep = duplicate_keep_option::KEEP_FIRST; }
 
   // The values will be filled into this column
   auto unique_indices = cudf::make_numeric_column(
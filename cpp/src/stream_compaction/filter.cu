@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/detail/transform.cuh>
+#include <cudf/ast/linearizer.hpp>
+#include <cudf/ast/transform.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/detail/copy_if.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Largest number of intermediates of a predicate evaluated by `ast_filter`.
+ *
+ * The intermediates of every thread are kept in local arrays of this size, since the stream
+ * compaction kernels have no shared memory to hold them. Predicates needing more intermediates are
+ * evaluated with `ast::compute_column` instead.
+ */
+constexpr size_type ast_filter_max_intermediates = 16;
+
+/**
+ * @brief Filter functor returning whether a linearized boolean expression is non-null and true
+ * for a row.
+ *
+ * @tparam has_nulls Whether the expression may be null, in which case the validity of its
+ * intermediates is tracked
+ */
+template <bool has_nulls>
+struct ast_filter {
+  table_device_view table;
+  ast::detail::generic_scalar_device_view const* literals;
+  ast::detail::device_data_reference const* data_references;
+  ast::ast_operator const* operators;
+  size_type const* operator_source_indices;
+  size_type num_operators;
+
+  __device__ bool operator()(size_type row_index) const
+  {
+    std::int64_t intermediate_storage[ast_filter_max_intermediates];
+    bool intermediate_validity[ast_filter_max_intermediates];
+    auto const evaluator = ast::detail::row_evaluator(table,
+                                                      literals,
+                                                      intermediate_storage,
+                                                      nullptr,
+                                                      has_nulls ? intermediate_validity : nullptr);
+    ast::detail::evaluate_row_expression(
+      evaluator, data_references, operators, operator_source_indices, num_operators, row_index);
+    // The result of the root node is stored in the first intermediate
+    bool result;
+    memcpy(&result, intermediate_storage, sizeof(result));
+    return result && (not has_nulls || intermediate_validity[0]);
+  }
+};
+
+/**
+ * @brief Computes the gather map of the rows of `input` passing `predicate`.
+ *
+ * The predicate is evaluated twice per row, once to count and once to write the passing rows,
+ * instead of being written to and read back from a boolean column.
+ *
+ * @return The gather map, or an empty optional if the predicate needs more than
+ * `ast_filter_max_intermediates` intermediates and must be evaluated by `compute_column`
+ */
+std::optional<rmm::device_uvector<size_type>> ast_filter_gather_map(
+  table_view const& input,
+  ast::expression const& predicate,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const expr_linearizer = ast::detail::linearizer(predicate, input);
+  CUDF_EXPECTS(expr_linearizer.root_data_type().id() == type_id::BOOL8,
+               "The predicate must produce a boolean value.");
+  if (expr_linearizer.intermediate_count() > ast_filter_max_intermediates) { return std::nullopt; }
+
+  auto const plan         = ast::detail::device_ast_plan(expr_linearizer, stream);
+  auto const table_device = table_device_view::create(input, stream);
+  auto gather_map         = [&](auto has_nulls) {
+    auto const filter = ast_filter<decltype(has_nulls)::value>{*table_device,
+                                                               plan.literals,
+                                                               plan.data_references,
+                                                               plan.operators,
+                                                               plan.operator_source_indices,
+                                                               plan.num_operators};
+    return copy_if_gather_map(input.num_rows(), filter, stream, mr);
+  };
+  return ast::detail::may_produce_nulls(expr_linearizer, input, stream)
+           ? gather_map(std::true_type{})
+           : gather_map(std::false_type{});
+}
+
+}  // namespace
+
+std::unique_ptr<table> filter(table_view const& input,
+                              ast::expression const& predicate,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  if (input.num_rows() == 0) { return empty_like(input); }
+
+  auto const gather_map = ast_filter_gather_map(
+    input, predicate, stream, rmm::mr::get_current_device_resource());
+  if (not gather_map.has_value()) {
+    auto const boolean_mask = ast::detail::compute_column(input, predicate, stream);
+    return detail::apply_boolean_mask(input, boolean_mask->view(), stream, mr);
+  }
+
+  if (static_cast<size_type>(gather_map->size()) == input.num_rows()) {
+    return std::make_unique<table>(input, stream, mr);
+  }
+  return fused_gather(input, *gather_map, stream, mr);
+}
+
+std::unique_ptr<column> filter_gather_map(table_view const& input,
+                                          ast::expression const& predicate,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  auto gather_map = ast_filter_gather_map(input, predicate, stream, mr);
+  if (not gather_map.has_value()) {
+    auto const boolean_mask = ast::detail::compute_column(input, predicate, stream);
+    return detail::boolean_mask_gather_map(boolean_mask->view(), stream, mr);
+  }
+
+  auto const size = static_cast<size_type>(gather_map->size());
+  return std::make_unique<column>(data_type{type_id::INT32}, size, gather_map->release());
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> filter(table_view const& input,
+                              ast::expression const& predicate,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::filter(input, predicate, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> filter_gather_map(table_view const& input,
+                                          ast::expression const& predicate,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::filter_gather_map(input, predicate, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
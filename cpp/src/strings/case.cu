@@ -20,6 +20,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/case.hpp>
@@ -35,6 +36,12 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <cstdint>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -111,6 +118,103 @@ struct upper_lower_fn {
   }
 };
 
+/**
+ * @brief Converts the case of the letters in 4 bytes of ASCII characters.
+ *
+ * The high bit of a byte is set by adding the distance from the first letter to 0x80 and is
+ * cleared by adding the distance from the last letter to 0x7F. No sum carries into the next byte
+ * since every byte is below 0x80.
+ */
+__device__ uint32_t convert_ascii_case(uint32_t word, bool upper_to_lower, bool lower_to_upper)
+{
+  auto const is_upper = (word + 0x3f3f3f3fu) & ~(word + 0x25252525u) & 0x80808080u;  // A-Z
+  auto const is_lower = (word + 0x1f1f1f1fu) & ~(word + 0x05050505u) & 0x80808080u;  // a-z
+  auto const flips    = (upper_to_lower ? is_upper : 0u) | (lower_to_upper ? is_lower : 0u);
+  // the case of an ASCII letter is its 0x20 bit
+  return word ^ (flips >> 2);
+}
+
+/**
+ * @brief Converts the case of 4 bytes of ASCII characters per call.
+ */
+struct ascii_case_fn {
+  char const* d_input;  // first byte of the input strings
+  bool input_aligned;   // whether `d_input` is aligned to 4 bytes
+  char* d_output;       // first byte of the output chars, aligned to 4 bytes
+  size_type bytes;      // number of bytes to convert
+  bool upper_to_lower;
+  bool lower_to_upper;
+
+  __device__ void operator()(size_type word) const
+  {
+    auto const pos = word * 4;
+    uint32_t value = 0;
+    if (pos + 4 <= bytes) {
+      if (input_aligned) {
+        value = *reinterpret_cast<uint32_t const*>(d_input + pos);
+      } else {
+        memcpy(&value, d_input + pos, 4);
+      }
+      *reinterpret_cast<uint32_t*>(d_output + pos) =
+        convert_ascii_case(value, upper_to_lower, lower_to_upper);
+      return;
+    }
+    // the last bytes are converted with zeros after them
+    memcpy(&value, d_input + pos, bytes - pos);
+    value = convert_ascii_case(value, upper_to_lower, lower_to_upper);
+    memcpy(d_output + pos, &value, bytes - pos);
+  }
+};
+
+/**
+ * @brief Converts the case of a strings column with only ASCII characters 4 bytes at a time.
+ *
+ * Each ASCII character keeps its size so the output offsets are the input offsets and no
+ * character needs to be decoded.
+ */
+std::unique_ptr<column> convert_ascii_case(strings_column_view const& strings,
+                                           character_flags_table_type case_flag,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  auto const strings_count = strings.size();
+  auto const offsets       = strings.offsets();
+  auto const last          = strings.offset() + strings_count;
+  auto const begin         = cudf::detail::get_value<int32_t>(offsets, strings.offset(), stream);
+  auto const end           = cudf::detail::get_value<int32_t>(offsets, last, stream);
+
+  auto offsets_column = make_numeric_column(
+    data_type{type_id::INT32}, strings_count + 1, mask_state::UNALLOCATED, stream, mr);
+  auto const d_offsets = offsets.data<int32_t>() + strings.offset();
+  thrust::transform(rmm::exec_policy(stream),
+                    d_offsets,
+                    d_offsets + strings_count + 1,
+                    offsets_column->mutable_view().data<int32_t>(),
+                    [begin] __device__(auto offset) { return offset - begin; });
+
+  auto const bytes   = end - begin;
+  auto chars_column  = create_chars_child_column(strings_count, bytes, stream, mr);
+  auto const d_input = strings.chars().data<char>() + begin;
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    (bytes + 3) / 4,
+    ascii_case_fn{d_input,
+                  reinterpret_cast<std::uintptr_t>(d_input) % sizeof(uint32_t) == 0,
+                  chars_column->mutable_view().data<char>(),
+                  bytes,
+                  IS_UPPER(case_flag) != 0,
+                  IS_LOWER(case_flag) != 0});
+
+  return make_strings_column(strings_count,
+                             std::move(offsets_column),
+                             std::move(chars_column),
+                             strings.null_count(),
+                             cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                             stream,
+                             mr);
+}
+
 /**
  * @brief Utility method for converting upper and lower case characters
  * in a strings column.
@@ -128,6 +232,10 @@ std::unique_ptr<column> convert_case(strings_column_view const& strings,
 {
   if (strings.is_empty()) return detail::make_empty_strings_column(stream, mr);
 
+  if (strings.offsets().type().id() == type_id::INT32 && is_ascii(strings, stream)) {
+    return convert_ascii_case(strings, case_flag, stream, mr);
+  }
+
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_column       = *strings_column;
 
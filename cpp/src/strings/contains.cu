@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -44,6 +44,8 @@ namespace {
  * There are three call types based on the number of regex instructions in the given pattern.
  * Small to medium instruction lengths can use the stack effectively though smaller executes faster.
  * Longer patterns require global memory.
+ *
+ * Patterns compiled to a DFA skip the stack entirely on ASCII strings.
  */
 template <size_t stack_size>
 struct contains_fn {
@@ -54,10 +56,14 @@ struct contains_fn {
   __device__ bool operator()(size_type idx)
   {
     if (d_strings.is_null(idx)) return 0;
+    string_view d_str = d_strings.element<string_view>(idx);
+    if (prog.has_dfa()) {
+      auto const result = prog.dfa_find(d_str);
+      if (result >= 0) return static_cast<bool>(result);
+    }
     u_char data1[stack_size], data2[stack_size];
     prog.set_stack_mem(data1, data2);
-    string_view d_str = d_strings.element<string_view>(idx);
-    int32_t begin     = 0;
+    int32_t begin = 0;
     int32_t end       = bmatch ? 1  // match only the beginning of the string;
                          : -1;      // this handles empty strings too
     return static_cast<bool>(prog.find(idx, d_str, begin, end));
@@ -77,7 +83,10 @@ std::unique_ptr<column> contains_util(
   auto d_column       = *strings_column;
 
   // compile regex into device object
-  auto prog   = reprog_device::create(pattern, get_character_flags_table(), strings_count, stream);
+  auto const dfa_mode = beginning_only ? regex_dfa_mode::MATCHES : regex_dfa_mode::CONTAINS;
+
+  auto prog   = reprog_device::create(
+    pattern, get_character_flags_table(), strings_count, stream, dfa_mode);
   auto d_prog = *prog;
 
   // create the output column
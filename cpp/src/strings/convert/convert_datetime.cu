@@ -99,6 +99,20 @@ struct alignas(4) format_item {
   }
 };
 
+/**
+ * @brief Fixed ISO-8601 layouts parsed with specialized code.
+ *
+ * Each layout starts with `%Y-%m-%d`, with any literals between the specifiers, and may be
+ * followed by `%H:%M:%S` with an optional fraction `.%f` and an optional `%z` or trailing
+ * literal such as `Z`.
+ */
+enum class iso_layout : int8_t {
+  NONE,           ///< any other format
+  DATE,           ///< `%Y-%m-%d`
+  DATETIME,       ///< `%Y-%m-%dT%H:%M:%S[.%f][Z]`
+  DATETIME_ZONE,  ///< `%Y-%m-%dT%H:%M:%S[.%f]%z`
+};
+
 /**
  * @brief The format_compiler parses a timestamp format string into a vector of
  * format_items.
@@ -161,6 +175,7 @@ struct format_compiler {
       items.push_back(format_item::new_specifier(ch, spec_length));
       template_string.append((size_t)spec_length, ch);
     }
+    detect_iso_layout(items);
     // create program in device memory
     d_items.resize(items.size(), stream);
     CUDA_TRY(cudaMemcpyAsync(d_items.data(),
@@ -174,16 +189,65 @@ struct format_compiler {
   size_type template_bytes() const { return static_cast<size_type>(template_string.size()); }
   size_type items_count() const { return static_cast<size_type>(d_items.size()); }
   int8_t subsecond_precision() const { return specifier_lengths.at('f'); }
+  iso_layout layout() const { return iso_layout_; }
+  int8_t iso_subsecond_digits() const { return iso_subsecond_digits_; }
+
+ private:
+  iso_layout iso_layout_{iso_layout::NONE};
+  int8_t iso_subsecond_digits_{0};
+
+  /**
+   * @brief Sets the ISO-8601 layout matched by the format items, if any.
+   */
+  void detect_iso_layout(std::vector<format_item> const& items)
+  {
+    auto is_specifier = [&items](std::size_t idx, char value) {
+      return idx < items.size() && items[idx].item_type == format_char_type::specifier &&
+             items[idx].value == value;
+    };
+    auto is_literal = [&items](std::size_t idx) {
+      return idx < items.size() && items[idx].item_type == format_char_type::literal;
+    };
+    if (!is_specifier(0, 'Y') || !is_literal(1) || !is_specifier(2, 'm') || !is_literal(3) ||
+        !is_specifier(4, 'd'))
+      return;
+    if (items.size() == 5) {
+      iso_layout_ = iso_layout::DATE;
+      return;
+    }
+    if (!is_literal(5) || !is_specifier(6, 'H') || !is_literal(7) || !is_specifier(8, 'M') ||
+        !is_literal(9) || !is_specifier(10, 'S'))
+      return;
+    std::size_t idx = 11;
+    int8_t digits   = 0;
+    if (is_literal(idx) && is_specifier(idx + 1, 'f') && items[idx + 1].length > 0) {
+      digits = items[idx + 1].length;
+      idx += 2;
+    }
+    auto layout = iso_layout::DATETIME;
+    if (is_specifier(idx, 'z')) {
+      layout = iso_layout::DATETIME_ZONE;
+      ++idx;
+    } else if (is_literal(idx)) {
+      ++idx;
+    }
+    if (idx != items.size()) return;
+    iso_layout_           = layout;
+    iso_subsecond_digits_ = digits;
+  }
 };
 
 // this parses date/time characters into a timestamp integer
-template <typename T>  // timestamp type
+template <typename T,  // timestamp type
+          iso_layout layout = iso_layout::NONE>
 struct parse_datetime {
   column_device_view const d_strings;
   format_item const* d_format_items;
   size_type items_count;
   timestamp_units units;
   int8_t subsecond_precision;
+  size_type template_bytes{};     // used only for an ISO-8601 layout
+  int8_t iso_subsecond_digits{};  // used only for an ISO-8601 layout
 
   /**
    * @brief Return power of ten value given an exponent.
@@ -278,6 +342,53 @@ struct parse_datetime {
     return 0;
   }
 
+  /**
+   * @brief Reads the `count` digits at `ptr` into `value`.
+   *
+   * @return false if any of the characters is not a digit
+   */
+  __device__ bool read_digits(const char* ptr, int32_t count, int32_t& value)
+  {
+    value = 0;
+    for (int32_t idx = 0; idx < count; ++idx) {
+      auto const digit = static_cast<int32_t>(ptr[idx] - '0');
+      if (digit < 0 || digit > 9) return false;
+      value = (value * 10) + digit;
+    }
+    return true;
+  }
+
+  // Read the fixed positions of the ISO-8601 `layout` from a string of exactly
+  // `template_bytes` bytes. Returns false if a field is not all digits so that the
+  // generic parser can handle it.
+  __device__ bool parse_iso_into_parts(string_view const& d_string, int32_t* timeparts)
+  {
+    auto const ptr = d_string.data();
+    if (!read_digits(ptr, 4, timeparts[TP_YEAR]) || !read_digits(ptr + 5, 2, timeparts[TP_MONTH]) ||
+        !read_digits(ptr + 8, 2, timeparts[TP_DAY]))
+      return false;
+    if constexpr (layout != iso_layout::DATE) {
+      if (!read_digits(ptr + 11, 2, timeparts[TP_HOUR]) ||
+          !read_digits(ptr + 14, 2, timeparts[TP_MINUTE]) ||
+          !read_digits(ptr + 17, 2, timeparts[TP_SECOND]))
+        return false;
+      auto zone_pos = 19;
+      if (iso_subsecond_digits > 0) {
+        if (!read_digits(ptr + 20, iso_subsecond_digits, timeparts[TP_SUBSECOND])) return false;
+        zone_pos += 1 + iso_subsecond_digits;
+      }
+      if constexpr (layout == iso_layout::DATETIME_ZONE) {
+        int32_t hh = 0;
+        int32_t mm = 0;
+        if (!read_digits(ptr + zone_pos + 1, 2, hh) || !read_digits(ptr + zone_pos + 3, 2, mm))
+          return false;
+        int sign                 = ptr[zone_pos] == '-' ? 1 : -1;  // revert timezone back to UTC
+        timeparts[TP_TZ_MINUTES] = sign * ((hh * 60) + mm);
+      }
+    }
+    return true;
+  }
+
   __device__ int64_t timestamp_from_parts(int32_t const* timeparts, timestamp_units units)
   {
     auto year = timeparts[TP_YEAR];
@@ -327,6 +438,11 @@ struct parse_datetime {
     string_view d_str = d_strings.element<string_view>(idx);
     if (d_str.empty()) return epoch_time;
     //
+    if constexpr (layout != iso_layout::NONE) {
+      int32_t iso_parts[TP_ARRAYSIZE] = {1970, 1, 1};
+      if (d_str.size_bytes() == template_bytes && parse_iso_into_parts(d_str, iso_parts))
+        return T{T::duration(timestamp_from_parts(iso_parts, units))};
+    }
     int32_t timeparts[TP_ARRAYSIZE] = {1970, 1, 1};             // month and day are 1-based
     if (parse_into_parts(d_str, timeparts)) return epoch_time;  // unexpected parse case
     //
@@ -371,6 +487,28 @@ timestamp_units dispatch_timestamp_to_units_fn::operator()<cudf::timestamp_ns>()
 
 // dispatch operator to map timestamp to native fixed-width-type
 struct dispatch_to_timestamps_fn {
+  template <typename T, iso_layout layout>
+  void parse(column_device_view const& d_strings,
+             format_compiler& compiler,
+             timestamp_units units,
+             mutable_column_view& results_view,
+             rmm::cuda_stream_view stream) const
+  {
+    auto d_results = results_view.data<T>();
+    parse_datetime<T, layout> pfn{d_strings,
+                                  compiler.format_items(),
+                                  compiler.items_count(),
+                                  units,
+                                  compiler.subsecond_precision(),
+                                  compiler.template_bytes(),
+                                  compiler.iso_subsecond_digits()};
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(results_view.size()),
+                      d_results,
+                      pfn);
+  }
+
   template <typename T, std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
   void operator()(column_device_view const& d_strings,
                   std::string const& format,
@@ -379,15 +517,18 @@ struct dispatch_to_timestamps_fn {
                   rmm::cuda_stream_view stream) const
   {
     format_compiler compiler(format.c_str(), stream);
-    auto d_items   = compiler.format_items();
-    auto d_results = results_view.data<T>();
-    parse_datetime<T> pfn{
-      d_strings, d_items, compiler.items_count(), units, compiler.subsecond_precision()};
-    thrust::transform(rmm::exec_policy(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(results_view.size()),
-                      d_results,
-                      pfn);
+    switch (compiler.layout()) {
+      case iso_layout::DATE:
+        parse<T, iso_layout::DATE>(d_strings, compiler, units, results_view, stream);
+        break;
+      case iso_layout::DATETIME:
+        parse<T, iso_layout::DATETIME>(d_strings, compiler, units, results_view, stream);
+        break;
+      case iso_layout::DATETIME_ZONE:
+        parse<T, iso_layout::DATETIME_ZONE>(d_strings, compiler, units, results_view, stream);
+        break;
+      default: parse<T, iso_layout::NONE>(d_strings, compiler, units, results_view, stream);
+    }
   }
   template <typename T, std::enable_if_t<not cudf::is_timestamp<T>()>* = nullptr>
   void operator()(column_device_view const&,
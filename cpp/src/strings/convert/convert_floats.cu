@@ -35,7 +35,9 @@
 #include <thrust/transform.h>
 
 #include <cmath>
+#include <cstdint>
 #include <limits>
+#include <type_traits>
 
 namespace cudf {
 namespace strings {
@@ -216,251 +218,327 @@ std::unique_ptr<column> to_floats(strings_column_view const& strings,
 
 namespace detail {
 namespace {
+// Cached powers of ten `10^(-348 + 8i) ~= cached_powers_f[i] * 2^cached_powers_e[i]`
+static const __device__ __constant__ uint64_t cached_powers_f[] = {
+  0xfa8fd5a0081c0288, 0xbaaee17fa23ebf76, 0x8b16fb203055ac76, 0xcf42894a5dce35ea,
+  0x9a6bb0aa55653b2d, 0xe61acf033d1a45df, 0xab70fe17c79ac6ca, 0xff77b1fcbebcdc4f,
+  0xbe5691ef416bd60c, 0x8dd01fad907ffc3c, 0xd3515c2831559a83, 0x9d71ac8fada6c9b5,
+  0xea9c227723ee8bcb, 0xaecc49914078536d, 0x823c12795db6ce57, 0xc21094364dfb5637,
+  0x9096ea6f3848984f, 0xd77485cb25823ac7, 0xa086cfcd97bf97f4, 0xef340a98172aace5,
+  0xb23867fb2a35b28e, 0x84c8d4dfd2c63f3b, 0xc5dd44271ad3cdba, 0x936b9fcebb25c996,
+  0xdbac6c247d62a584, 0xa3ab66580d5fdaf6, 0xf3e2f893dec3f126, 0xb5b5ada8aaff80b8,
+  0x87625f056c7c4a8b, 0xc9bcff6034c13053, 0x964e858c91ba2655, 0xdff9772470297ebd,
+  0xa6dfbd9fb8e5b88f, 0xf8a95fcf88747d94, 0xb94470938fa89bcf, 0x8a08f0f8bf0f156b,
+  0xcdb02555653131b6, 0x993fe2c6d07b7fac, 0xe45c10c42a2b3b06, 0xaa242499697392d3,
+  0xfd87b5f28300ca0e, 0xbce5086492111aeb, 0x8cbccc096f5088cc, 0xd1b71758e219652c,
+  0x9c40000000000000, 0xe8d4a51000000000, 0xad78ebc5ac620000, 0x813f3978f8940984,
+  0xc097ce7bc90715b3, 0x8f7e32ce7bea5c70, 0xd5d238a4abe98068, 0x9f4f2726179a2245,
+  0xed63a231d4c4fb27, 0xb0de65388cc8ada8, 0x83c7088e1aab65db, 0xc45d1df942711d9a,
+  0x924d692ca61be758, 0xda01ee641a708dea, 0xa26da3999aef774a, 0xf209787bb47d6b85,
+  0xb454e4a179dd1877, 0x865b86925b9bc5c2, 0xc83553c5c8965d3d, 0x952ab45cfa97a0b3,
+  0xde469fbd99a05fe3, 0xa59bc234db398c25, 0xf6c69a72a3989f5c, 0xb7dcbf5354e9bece,
+  0x88fcf317f22241e2, 0xcc20ce9bd35c78a5, 0x98165af37b2153df, 0xe2a0b5dc971f303a,
+  0xa8d9d1535ce3b396, 0xfb9b7cd9a4a7443c, 0xbb764c4ca7a44410, 0x8bab8eefb6409c1a,
+  0xd01fef10a657842c, 0x9b10a4e5e9913129, 0xe7109bfba19c0c9d, 0xac2820d9623bf429,
+  0x80444b5e7aa7cf85, 0xbf21e44003acdd2d, 0x8e679c2f5e44ff8f, 0xd433179d9c8cb841,
+  0x9e19db92b4e31ba9, 0xeb96bf6ebadf77d9, 0xaf87023b9bf0ee6b};
+static const __device__ __constant__ int16_t cached_powers_e[] = {
+  -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980, -954, -927, -901, -874, -847,
+  -821, -794, -768, -741, -715, -688, -661, -635, -608, -582, -555, -529, -502, -475, -449, -422,
+  -396, -369, -343, -316, -289, -263, -236, -210, -183, -157, -130, -103, -77, -50, -24, 3, 30, 56,
+  83, 109, 136, 162, 189, 216, 242, 269, 295, 322, 348, 375, 402, 428, 455, 481, 508, 534, 561, 588,
+  614, 641, 667, 694, 720, 747, 774, 800, 827, 853, 880, 907, 933, 960, 986, 1013, 1039, 1066};
+
 /**
  * @brief Code logic for converting float value into a string.
  *
- * The floating point components are dissected and used to fill an
- * existing output char array.
+ * The digits are the shortest ones that read back as the same value, found with the Grisu2
+ * algorithm of Florian Loitsch, "Printing Floating-Point Numbers Quickly and Accurately with
+ * Integers". Grisu2 always round-trips and finds the shortest digits for nearly all values.
+ * Values from 1e-4 up to 1e9 are written in fixed notation and the others in scientific
+ * notation.
  */
+template <typename FloatType>
 struct ftos_converter {
-  // significant digits is independent of scientific notation range
-  // digits more than this may require using long values instead of ints
-  static constexpr unsigned int significant_digits = 10;
-  // maximum power-of-10 that will fit in 32-bits
-  static constexpr unsigned int nine_digits = 1000000000;  // 1x10^9
-  // Range of numbers here is for normalizing the value.
-  // If the value is above or below the following limits, the output is converted to
-  // scientific notation in order to show (at most) the number of significant digits.
-  static constexpr double upper_limit = 1000000000;  // max is 1x10^9
-  static constexpr double lower_limit = 0.0001;      // printf uses scientific notation below this
-  // Tables for doing normalization: converting to exponent form
-  // IEEE double float has maximum exponent of 305 so these should cover everthing
-  const double upper10[9]  = {10, 100, 10000, 1e8, 1e16, 1e32, 1e64, 1e128, 1e256};
-  const double lower10[9]  = {.1, .01, .0001, 1e-8, 1e-16, 1e-32, 1e-64, 1e-128, 1e-256};
-  const double blower10[9] = {1.0, .1, .001, 1e-7, 1e-15, 1e-31, 1e-63, 1e-127, 1e-255};
-
-  // utility for quickly converting known integer range to character array
-  __device__ char* int2str(int value, char* output)
+  // digits of a float never exceed 9 and of a double 17
+  static constexpr int max_digits = std::is_same<FloatType, float>::value ? 9 : 17;
+  // output need not be more than max_digits plus the sign, the decimal point, up to 4 zeros
+  // after it in fixed notation or the exponent 'e±ddd' in scientific notation
+  static constexpr int max_size = max_digits + 7;
+
+  /**
+   * @brief Floating point value `f * 2^e` with a 64-bit significand.
+   */
+  struct diy_fp {
+    uint64_t f;
+    int e;
+
+    __device__ diy_fp operator-(diy_fp const& rhs) const { return diy_fp{f - rhs.f, e}; }
+
+    // product rounded to the upper 64 bits
+    __device__ diy_fp operator*(diy_fp const& rhs) const
+    {
+      auto const hi = __umul64hi(f, rhs.f);
+      auto const lo = f * rhs.f;
+      return diy_fp{hi + (lo >> 63), e + rhs.e + 64};
+    }
+
+    __device__ diy_fp normalize() const
+    {
+      auto const shift = __clzll(static_cast<long long>(f));
+      return diy_fp{f << shift, e - shift};
+    }
+  };
+
+  /**
+   * @brief Returns the significand and exponent of a positive finite value.
+   */
+  __device__ diy_fp to_diy_fp(FloatType value)
   {
-    if (value == 0) {
-      *output++ = '0';
-      return output;
+    constexpr int mantissa_bits = std::numeric_limits<FloatType>::digits - 1;
+    constexpr int exponent_bias = std::numeric_limits<FloatType>::max_exponent - 1 + mantissa_bits;
+    uint64_t bits;
+    if constexpr (std::is_same<FloatType, float>::value) {
+      bits = static_cast<uint32_t>(__float_as_int(value));
+    } else {
+      bits = static_cast<uint64_t>(__double_as_longlong(value));
     }
-    char buffer[significant_digits];  // should be big-enough for significant digits
-    char* ptr = buffer;
-    while (value > 0) {
-      *ptr++ = (char)('0' + (value % 10));
-      value /= 10;
+    auto const mantissa = bits & ((uint64_t{1} << mantissa_bits) - 1);
+    auto const exponent = static_cast<int>(bits >> mantissa_bits);
+    // subnormal values have no hidden bit
+    return exponent ? diy_fp{mantissa | (uint64_t{1} << mantissa_bits), exponent - exponent_bias}
+                    : diy_fp{mantissa, 1 - exponent_bias};
+  }
+
+  /**
+   * @brief Rounds the last digit towards `w` while the digits stay within the boundaries.
+   */
+  __device__ void grisu_round(
+    char* digits, int length, uint64_t delta, uint64_t rest, uint64_t ten_kappa, uint64_t wp_w)
+  {
+    while (rest < wp_w && delta - rest >= ten_kappa &&
+           (rest + ten_kappa < wp_w || wp_w - rest > rest + ten_kappa - wp_w)) {
+      --digits[length - 1];
+      rest += ten_kappa;
     }
-    while (ptr != buffer) *output++ = *--ptr;  // 54321 -> 12345
-    return output;
   }
 
   /**
-   * @brief Dissect a float value into integer, decimal, and exponent components.
+   * @brief Generates the digits of `w` within `delta` of the upper boundary `mp`.
    *
-   * @return The number of decimal places.
+   * @return Number of digits written; `k` is adjusted to the exponent of the last digit.
    */
-  __device__ int dissect_value(double value,
-                               unsigned int& integer,
-                               unsigned int& decimal,
-                               int& exp10)
+  __device__ int generate_digits(diy_fp w, diy_fp mp, uint64_t delta, char* digits, int& k)
   {
-    int decimal_places = significant_digits - 1;
-    // normalize step puts value between lower-limit and upper-limit
-    // by adjusting the exponent up or down
-    exp10 = 0;
-    if (value > upper_limit) {
-      int fx = 256;
-      for (int idx = 8; idx >= 0; --idx) {
-        if (value >= upper10[idx]) {
-          value *= lower10[idx];
-          exp10 += fx;
-        }
-        fx = fx >> 1;
-      }
-    } else if ((value > 0.0) && (value < lower_limit)) {
-      int fx = 256;
-      for (int idx = 8; idx >= 0; --idx) {
-        if (value < blower10[idx]) {
-          value *= upper10[idx];
-          exp10 -= fx;
-        }
-        fx = fx >> 1;
-      }
+    constexpr uint64_t powers_of_ten[] = {1,
+                                          10,
+                                          100,
+                                          1000,
+                                          10000,
+                                          100000,
+                                          1000000,
+                                          10000000,
+                                          100000000,
+                                          1000000000,
+                                          10000000000,
+                                          100000000000,
+                                          1000000000000,
+                                          10000000000000,
+                                          100000000000000,
+                                          1000000000000000,
+                                          10000000000000000,
+                                          100000000000000000,
+                                          1000000000000000000,
+                                          10000000000000000000u};
+    diy_fp const one{uint64_t{1} << -mp.e, mp.e};
+    auto const wp_w = mp - w;
+    auto p1         = static_cast<uint32_t>(mp.f >> -one.e);
+    auto p2         = mp.f & (one.f - 1);
+    int kappa       = 1;
+    while (kappa < 10 && p1 >= powers_of_ten[kappa]) {
+      ++kappa;
     }
-    //
-    unsigned int max_digits = nine_digits;
-    integer                 = (unsigned int)value;
-    for (unsigned int i = integer; i >= 10; i /= 10) {
-      --decimal_places;
-      max_digits /= 10;
-    }
-    double remainder = (value - (double)integer) * (double)max_digits;
-    decimal          = (unsigned int)remainder;
-    remainder -= (double)decimal;
-    decimal += (unsigned int)(2.0 * remainder);
-    if (decimal >= max_digits) {
-      decimal = 0;
-      ++integer;
-      if (exp10 && (integer >= 10)) {
-        ++exp10;
-        integer = 1;
+
+    int length = 0;
+    // integer part of the scaled upper boundary
+    while (kappa > 0) {
+      auto const divisor = static_cast<uint32_t>(powers_of_ten[kappa - 1]);
+      auto const digit   = p1 / divisor;
+      p1 %= divisor;
+      if (digit || length) { digits[length++] = static_cast<char>('0' + digit); }
+      --kappa;
+      auto const rest = (static_cast<uint64_t>(p1) << -one.e) + p2;
+      if (rest <= delta) {
+        k += kappa;
+        grisu_round(digits, length, delta, rest, powers_of_ten[kappa] << -one.e, wp_w.f);
+        return length;
       }
     }
-    //
-    while ((decimal % 10) == 0 && (decimal_places > 0)) {
-      decimal /= 10;
-      --decimal_places;
+    // fractional part
+    while (true) {
+      p2 *= 10;
+      delta *= 10;
+      auto const digit = static_cast<char>(p2 >> -one.e);
+      if (digit || length) { digits[length++] = static_cast<char>('0' + digit); }
+      p2 &= one.f - 1;
+      --kappa;
+      if (p2 < delta) {
+        k += kappa;
+        auto const unit = -kappa < 20 ? powers_of_ten[-kappa] : 0;
+        grisu_round(digits, length, delta, p2, one.f, wp_w.f * unit);
+        return length;
+      }
     }
-    return decimal_places;
   }
 
   /**
-   * @brief Main kernel method for converting float value to char output array.
+   * @brief Computes the shortest digits of a positive finite value.
    *
-   * Output need not be more than (significant_digits + 7) bytes:
-   * 7 = 1 sign, 1 decimal point, 1 exponent ('e'), 1 exponent-sign, 3 digits for exponent
+   * @return Number of digits written; the value is `digits * 10^k`.
+   */
+  __device__ int grisu2(FloatType value, char* digits, int& k)
+  {
+    auto const v = to_diy_fp(value);
+    // boundaries halfway to the neighboring values, the lower one is closer at a power of two
+    auto const mp         = diy_fp{(v.f << 1) + 1, v.e - 1}.normalize();
+    auto const hidden_bit = uint64_t{1} << (std::numeric_limits<FloatType>::digits - 1);
+    auto mm               = (v.f == hidden_bit) ? diy_fp{(v.f << 2) - 1, v.e - 2}
+                                                : diy_fp{(v.f << 1) - 1, v.e - 1};
+    mm.f <<= mm.e - mp.e;
+    mm.e = mp.e;
+
+    // cached power of ten bringing the exponent of the upper boundary into [-59, -32]
+    auto const kc    = static_cast<int>(ceil((-61 - mp.e) * 0.30102999566398114 + 347));
+    auto const index = (kc >> 3) + 1;
+    k                = -(-348 + index * 8);
+    diy_fp const c_mk{cached_powers_f[index], cached_powers_e[index]};
+
+    auto const w = v.normalize() * c_mk;
+    auto wp      = mp * c_mk;
+    auto wm      = mm * c_mk;
+    ++wm.f;
+    --wp.f;
+    return generate_digits(w, wp, wp.f - wm.f, digits, k);
+  }
+
+  /**
+   * @brief Writes a non-negative integer and returns the end of the output.
+   */
+  __device__ char* int2str(int value, char* output)
+  {
+    char buffer[10];
+    char* ptr = buffer;
+    do {
+      *ptr++ = static_cast<char>('0' + (value % 10));
+      value /= 10;
+    } while (value > 0);
+    while (ptr != buffer) *output++ = *--ptr;  // 54321 -> 12345
+    return output;
+  }
+
+  /**
+   * @brief Main kernel method for converting float value to char output array.
    *
    * @param value Float value to convert.
-   * @param output Memory to write output characters.
+   * @param output Memory to write output characters, at least `max_size` bytes.
    * @return Number of bytes written.
    */
-  __device__ int float_to_string(double value, char* output)
+  __device__ int float_to_string(FloatType value, char* output)
   {
     // check for valid value
     if (std::isnan(value)) {
       memcpy(output, "NaN", 3);
       return 3;
     }
-    bool bneg = false;
+    char* ptr = output;
     if (signbit(value)) {  // handles -0.0 too
-      value = -value;
-      bneg  = true;
+      value  = -value;
+      *ptr++ = '-';
     }
     if (std::isinf(value)) {
-      if (bneg)
-        memcpy(output, "-Inf", 4);
-      else
-        memcpy(output, "Inf", 3);
-      return bneg ? 4 : 3;
+      memcpy(ptr, "Inf", 3);
+      return static_cast<int>(ptr - output) + 3;
+    }
+    if (value == 0) {
+      memcpy(ptr, "0.0", 3);
+      return static_cast<int>(ptr - output) + 3;
     }
 
-    // dissect value into components
-    unsigned int integer = 0, decimal = 0;
-    int exp10          = 0;
-    int decimal_places = dissect_value(value, integer, decimal, exp10);
-    //
-    // now build the string from the
-    // components: sign, integer, decimal, exp10, decimal_places
-    //
-    // sign
-    char* ptr = output;
-    if (bneg) *ptr++ = '-';
-    // integer
-    ptr = int2str(integer, ptr);
-    // decimal
-    *ptr++ = '.';
-    if (decimal_places) {
-      char buffer[10];
-      char* pb = buffer;
-      while (decimal_places--) {
-        *pb++ = (char)('0' + (decimal % 10));
-        decimal /= 10;
+    char digits[max_digits + 1];
+    int k            = 0;
+    auto const count = grisu2(value, digits, k);
+    // exponent of the first digit
+    auto const exp10 = count + k - 1;
+
+    if (exp10 >= -4 && exp10 < 9) {
+      if (exp10 < 0) {
+        // 0.000ddd
+        *ptr++ = '0';
+        *ptr++ = '.';
+        for (int i = exp10 + 1; i < 0; ++i) {
+          *ptr++ = '0';
+        }
+        memcpy(ptr, digits, count);
+        ptr += count;
+      } else if (exp10 + 1 >= count) {
+        // ddd000.0
+        memcpy(ptr, digits, count);
+        ptr += count;
+        for (int i = count; i <= exp10; ++i) {
+          *ptr++ = '0';
+        }
+        *ptr++ = '.';
+        *ptr++ = '0';
+      } else {
+        // ddd.ddd
+        memcpy(ptr, digits, exp10 + 1);
+        ptr += exp10 + 1;
+        *ptr++ = '.';
+        memcpy(ptr, digits + exp10 + 1, count - exp10 - 1);
+        ptr += count - exp10 - 1;
+      }
+    } else {
+      // d.ddde±dd
+      *ptr++ = digits[0];
+      *ptr++ = '.';
+      if (count > 1) {
+        memcpy(ptr, digits + 1, count - 1);
+        ptr += count - 1;
+      } else {
+        *ptr++ = '0';
       }
-      while (pb != buffer)  // reverses the digits
-        *ptr++ = *--pb;     // e.g. 54321 -> 12345
-    } else
-      *ptr++ = '0';  // always include at least .0
-    // exponent
-    if (exp10) {
       *ptr++ = 'e';
-      if (exp10 < 0) {
-        *ptr++ = '-';
-        exp10  = -exp10;
-      } else
-        *ptr++ = '+';
-      if (exp10 < 10) *ptr++ = '0';  // extra zero-pad
-      ptr = int2str(exp10, ptr);
+      *ptr++ = exp10 < 0 ? '-' : '+';
+      auto const exp_abs = exp10 < 0 ? -exp10 : exp10;
+      if (exp_abs < 10) *ptr++ = '0';  // extra zero-pad
+      ptr = int2str(exp_abs, ptr);
     }
-    // done
-    return (int)(ptr - output);  // number of bytes written
-  }
-
-  /**
-   * @brief Compute how man bytes are needed to hold the output string.
-   *
-   * @param value Float value to convert.
-   * @return Number of bytes required.
-   */
-  __device__ int compute_ftos_size(double value)
-  {
-    if (std::isnan(value)) return 3;  // NaN
-    bool bneg = false;
-    if (signbit(value)) {  // handles -0.0 too
-      value = -value;
-      bneg  = true;
-    }
-    if (std::isinf(value)) return 3 + (int)bneg;  // Inf
-
-    // dissect float into parts
-    unsigned int integer = 0, decimal = 0;
-    int exp10          = 0;
-    int decimal_places = dissect_value(value, integer, decimal, exp10);
-    // now count up the components
-    // sign
-    int count = (int)bneg;
-    // integer
-    count += (int)(integer == 0);
-    while (integer > 0) {
-      integer /= 10;
-      ++count;
-    }  // log10(integer)
-    // decimal
-    ++count;  // decimal point
-    if (decimal_places)
-      count += decimal_places;
-    else
-      ++count;  // always include .0
-    // exponent
-    if (exp10) {
-      count += 2;  // 'e±'
-      if (exp10 < 0) exp10 = -exp10;
-      count += (int)(exp10 < 10);  // padding
-      while (exp10 > 0) {
-        exp10 /= 10;
-        ++count;
-      }  // log10(exp10)
-    }
-    return count;
+    return static_cast<int>(ptr - output);  // number of bytes written
   }
 };
 
+/**
+ * @brief Upper bound of the size of each output string.
+ */
 template <typename FloatType>
 struct float_to_string_size_fn {
   column_device_view d_column;
 
-  __device__ size_type operator()(size_type idx)
+  __device__ size_type operator()(size_type idx) const
   {
-    if (d_column.is_null(idx)) return 0;
-    FloatType value = d_column.element<FloatType>(idx);
-    ftos_converter fts;
-    return static_cast<size_type>(fts.compute_ftos_size(static_cast<double>(value)));
+    return d_column.is_null(idx) ? 0 : ftos_converter<FloatType>::max_size;
   }
 };
 
 template <typename FloatType>
 struct float_to_string_fn {
-  const column_device_view d_column;
-  const int32_t* d_offsets;
-  char* d_chars;
+  column_device_view d_column;
 
-  __device__ void operator()(size_type idx)
+  __device__ size_type operator()(size_type idx, char* d_output) const
   {
-    if (d_column.is_null(idx)) return;
-    FloatType value = d_column.element<FloatType>(idx);
-    ftos_converter fts;
-    fts.float_to_string(static_cast<double>(value), d_chars + d_offsets[idx]);
+    if (d_column.is_null(idx)) return 0;
+    ftos_converter<FloatType> fts;
+    return fts.float_to_string(d_column.element<FloatType>(idx), d_output);
   }
 };
 
@@ -482,23 +560,13 @@ struct dispatch_from_floats_fn {
 
     // copy the null mask
     rmm::device_buffer null_mask = cudf::detail::copy_bitmask(floats, stream, mr);
-    // build offsets column
-    auto offsets_transformer_itr = thrust::make_transform_iterator(
-      thrust::make_counting_iterator<int32_t>(0), float_to_string_size_fn<FloatType>{d_column});
-    auto offsets_column = detail::make_offsets_child_column(
-      offsets_transformer_itr, offsets_transformer_itr + strings_count, stream, mr);
-    auto offsets_view = offsets_column->view();
-    auto d_offsets    = offsets_view.template data<int32_t>();
-
-    // build chars column
-    auto const bytes  = cudf::detail::get_value<int32_t>(offsets_view, strings_count, stream);
-    auto chars_column = detail::create_chars_child_column(strings_count, bytes, stream, mr);
-    auto chars_view   = chars_column->mutable_view();
-    auto d_chars      = chars_view.template data<char>();
-    thrust::for_each_n(rmm::exec_policy(stream),
-                       thrust::make_counting_iterator<size_type>(0),
-                       strings_count,
-                       float_to_string_fn<FloatType>{d_column, d_offsets, d_chars});
+    // each value is converted once into an upper bound of its size and then compacted
+    auto [offsets_column, chars_column] =
+      make_strings_children_single_pass(float_to_string_size_fn<FloatType>{d_column},
+                                        float_to_string_fn<FloatType>{d_column},
+                                        strings_count,
+                                        stream,
+                                        mr);
     //
     return make_strings_column(strings_count,
                                std::move(offsets_column),
@@ -16,20 +16,26 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/find.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/transform.h>
 
+#include <type_traits>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -51,6 +57,113 @@ namespace {
  * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return New integer column with character position values.
  */
+/**
+ * @brief Threshold on the average number of bytes per string above which each string is searched
+ * by a warp instead of a thread.
+ */
+constexpr size_type AVG_CHAR_BYTES_THRESHOLD = 64;
+
+/**
+ * @brief Returns true if the strings are long enough on average to be searched by a warp each.
+ */
+bool is_warp_parallel(strings_column_view const& strings, rmm::cuda_stream_view stream)
+{
+  if (strings.size() == 0) return false;
+  auto const offsets = strings.offsets();
+  auto const bytes =
+    cudf::detail::get_value<size_type>(offsets, strings.offset() + strings.size(), stream) -
+    cudf::detail::get_value<size_type>(offsets, strings.offset(), stream);
+  return bytes / strings.size() >= AVG_CHAR_BYTES_THRESHOLD;
+}
+
+/**
+ * @brief Searches `d_target` in each string with a warp per string.
+ *
+ * The lanes compare the target at consecutive byte positions, a warp of positions at a time from
+ * the beginning of the string, or from its end if `forward` is false, and the warp stops at the
+ * first positions where a lane matches. For integer results, the byte position of the match is
+ * then converted to a character position by counting the characters before it, also a warp of
+ * bytes at a time.
+ *
+ * @tparam forward Whether to return the first or the last match
+ * @tparam ResultType `bool` to return whether the target is found, `int32_t` for its position
+ */
+template <bool forward, typename ResultType>
+__global__ void find_warp_parallel_kernel(column_device_view const d_strings,
+                                          string_view const d_target,
+                                          ResultType* d_results)
+{
+  auto const idx     = static_cast<std::size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  auto const str_idx = static_cast<size_type>(idx / cudf::detail::warp_size);
+  if (str_idx >= d_strings.size()) return;  // the whole warp returns
+  auto const lane = static_cast<size_type>(idx % cudf::detail::warp_size);
+  if (d_strings.is_null(str_idx)) {
+    if (lane == 0) { d_results[str_idx] = std::is_same<ResultType, bool>::value ? 0 : -1; }
+    return;
+  }
+
+  auto const d_str    = d_strings.element<string_view>(str_idx);
+  auto const tgt_size = d_target.size_bytes();
+  auto const last     = d_str.size_bytes() - tgt_size;  // last byte position of a match
+  size_type position  = -1;
+  for (size_type base = 0; base <= last; base += cudf::detail::warp_size) {
+    auto const pos    = forward ? base + lane : last - base - lane;
+    auto const found  = (pos >= 0) && (pos <= last) &&
+                       (d_target.compare(d_str.data() + pos, tgt_size) == 0);
+    auto const ballot = __ballot_sync(0xffffffff, found);
+    if (ballot != 0) {
+      // the lowest matching lane has the first position, or the last one going backward
+      auto const first_lane = __ffs(ballot) - 1;
+      position              = forward ? base + first_lane : last - base - first_lane;
+      break;
+    }
+  }
+
+  if constexpr (std::is_same<ResultType, bool>::value) {
+    if (lane == 0) { d_results[str_idx] = position >= 0; }
+  } else {
+    size_type chars = 0;
+    for (auto i = lane; i < position; i += cudf::detail::warp_size) {
+      chars += is_begin_utf8_char(static_cast<uint8_t>(d_str.data()[i]));
+    }
+    for (auto offset = cudf::detail::warp_size / 2; offset > 0; offset /= 2) {
+      chars += __shfl_down_sync(0xffffffff, chars, offset);
+    }
+    if (lane == 0) { d_results[str_idx] = position >= 0 ? chars : -1; }
+  }
+}
+
+/**
+ * @brief Returns the results of `find_warp_parallel_kernel` for all the strings.
+ *
+ * Null string entries return corresponding null output column entries.
+ */
+template <bool forward, typename ResultType>
+std::unique_ptr<column> find_warp_parallel(strings_column_view const& strings,
+                                           string_scalar const& target,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  auto d_target       = string_view(target.data(), target.size());
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto strings_count  = strings.size();
+  auto results        = make_numeric_column(data_type{type_to_id<ResultType>()},
+                                     strings_count,
+                                     cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                     strings.null_count(),
+                                     stream,
+                                     mr);
+
+  constexpr int block_size = 256;
+  auto const num_blocks    = cudf::util::div_rounding_up_safe<std::size_t>(
+    static_cast<std::size_t>(strings_count) * cudf::detail::warp_size, block_size);
+  find_warp_parallel_kernel<forward, ResultType>
+    <<<num_blocks, block_size, 0, stream.value()>>>(
+      *strings_column, d_target, results->mutable_view().data<ResultType>());
+  CHECK_CUDA(stream.value());
+  return results;
+}
+
 template <typename FindFunction>
 std::unique_ptr<column> find_fn(strings_column_view const& strings,
                                 string_scalar const& target,
@@ -103,6 +216,11 @@ std::unique_ptr<column> find(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
+  if (start == 0 && stop < 0 && target.is_valid() && target.size() > 0 &&
+      is_warp_parallel(strings, stream)) {
+    return find_warp_parallel<true, int32_t>(strings, target, stream, mr);
+  }
+
   auto pfn = [] __device__(
                string_view d_string, string_view d_target, size_type start, size_type stop) {
     size_type length = d_string.length();
@@ -123,6 +241,11 @@ std::unique_ptr<column> rfind(
   rmm::cuda_stream_view stream        = rmm::cuda_stream_default,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
+  if (start == 0 && stop < 0 && target.is_valid() && target.size() > 0 &&
+      is_warp_parallel(strings, stream)) {
+    return find_warp_parallel<false, int32_t>(strings, target, stream, mr);
+  }
+
   auto pfn = [] __device__(
                string_view d_string, string_view d_target, size_type start, size_type stop) {
     size_type length = d_string.length();
@@ -290,6 +413,10 @@ std::unique_ptr<column> contains(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
+  if (target.is_valid() && target.size() > 0 && is_warp_parallel(strings, stream)) {
+    return find_warp_parallel<true, bool>(strings, target, stream, mr);
+  }
+
   auto pfn = [] __device__(string_view d_string, string_view d_target) {
     return d_string.find(d_target) >= 0;
   };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,20 +16,199 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/strings/find_multiple.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/for_each.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <queue>
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
+namespace {
+
+/**
+ * @brief Aho-Corasick automaton finding all the targets in a string in one pass over its bytes.
+ *
+ * Each state is a prefix of some targets. Bytes not found in any target share a byte class, and
+ * the transitions already follow the failure links, so every byte is a single table lookup.
+ */
+struct aho_corasick_device {
+  uint8_t const* byte_classes;      // byte class of each byte value
+  size_type classes_count;          // number of byte classes
+  size_type const* transitions;     // next state by [state * classes_count + class]
+  size_type const* output_offsets;  // offsets into outputs, per state
+  size_type const* outputs;         // targets ending at each state, ordered by target index
+  size_type const* target_lengths;  // length in characters of each target
+
+  /**
+   * @brief Calls `on_match(target, position)` for each occurrence of a target in `d_str`, in the
+   * order the occurrences end, where `position` is the character position of the occurrence.
+   *
+   * The scan stops when `on_match` returns false.
+   */
+  template <typename OnMatch>
+  __device__ void for_each_match(string_view const& d_str, OnMatch on_match) const
+  {
+    size_type state = 0;
+    size_type chars = 0;  // characters read so far
+    auto report     = [&]() {
+      for (auto output = output_offsets[state]; output < output_offsets[state + 1]; ++output) {
+        auto const target = outputs[output];
+        if (not on_match(target, chars - target_lengths[target])) { return false; }
+      }
+      return true;
+    };
+    if (not report()) { return; }
+    for (auto itr = d_str.data(); itr < d_str.data() + d_str.size_bytes(); ++itr) {
+      auto const byte = static_cast<uint8_t>(*itr);
+      chars += is_begin_utf8_char(byte);
+      state = transitions[state * classes_count + byte_classes[byte]];
+      if (not report()) { return; }
+    }
+  }
+};
+
+/**
+ * @brief Owns the device memory of an `aho_corasick_device`.
+ */
+struct aho_corasick {
+  rmm::device_uvector<uint8_t> byte_classes;
+  size_type classes_count;
+  rmm::device_uvector<size_type> transitions;
+  rmm::device_uvector<size_type> output_offsets;
+  rmm::device_uvector<size_type> outputs;
+  rmm::device_uvector<size_type> target_lengths;
+
+  aho_corasick_device view() const
+  {
+    return aho_corasick_device{byte_classes.data(),
+                               classes_count,
+                               transitions.data(),
+                               output_offsets.data(),
+                               outputs.data(),
+                               target_lengths.data()};
+  }
+};
+
+/**
+ * @brief Builds the Aho-Corasick automaton of `targets` on the host and copies it to the device.
+ */
+aho_corasick create_aho_corasick(strings_column_view const& targets, rmm::cuda_stream_view stream)
+{
+  auto const targets_count = targets.size();
+  auto const h_offsets     = cudf::detail::make_std_vector_sync(
+    device_span<size_type const>(targets.offsets().data<size_type>() + targets.offset(),
+                                 targets_count + 1),
+    stream);
+  auto const h_chars = cudf::detail::make_std_vector_sync(
+    device_span<char const>(targets.chars().data<char>() + h_offsets.front(),
+                            h_offsets.back() - h_offsets.front()),
+    stream);
+
+  // the bytes found in the targets have a class each, all the other bytes share class 0
+  std::vector<size_type> byte_classes(256, 0);
+  size_type classes_count = 1;
+  for (auto const ch : h_chars) {
+    auto& byte_class = byte_classes[static_cast<uint8_t>(ch)];
+    if (byte_class == 0) { byte_class = classes_count++; }
+  }
+  if (classes_count > 256) {
+    // every byte value is found in the targets, so class 0 is not needed
+    std::for_each(byte_classes.begin(), byte_classes.end(), [](auto& cls) { --cls; });
+    --classes_count;
+  }
+
+  // trie of the targets
+  std::vector<size_type> transitions(classes_count, -1);
+  std::vector<std::vector<size_type>> outputs(1);
+  std::vector<size_type> target_lengths(targets_count);
+  for (size_type target = 0; target < targets_count; ++target) {
+    size_type state = 0;
+    for (auto idx = h_offsets[target]; idx < h_offsets[target + 1]; ++idx) {
+      auto const byte = static_cast<uint8_t>(h_chars[idx - h_offsets.front()]);
+      auto& next      = transitions[state * classes_count + byte_classes[byte]];
+      if (next < 0) {
+        next = static_cast<size_type>(outputs.size());
+        outputs.emplace_back();
+        transitions.resize(transitions.size() + classes_count, -1);
+      }
+      state = transitions[state * classes_count + byte_classes[byte]];
+      target_lengths[target] += is_begin_utf8_char(byte);
+    }
+    outputs[state].push_back(target);
+  }
+
+  // breadth-first completion of the transitions along the failure links
+  auto const states_count = static_cast<size_type>(outputs.size());
+  std::vector<size_type> failure(states_count, 0);
+  std::queue<size_type> states;
+  for (size_type cls = 0; cls < classes_count; ++cls) {
+    auto& next = transitions[cls];
+    if (next < 0) {
+      next = 0;
+    } else {
+      states.push(next);
+    }
+  }
+  while (not states.empty()) {
+    auto const state = states.front();
+    states.pop();
+    // the targets ending at the longest proper suffix of this state end here too
+    auto const& suffix_outputs = outputs[failure[state]];
+    outputs[state].insert(outputs[state].end(), suffix_outputs.begin(), suffix_outputs.end());
+    std::sort(outputs[state].begin(), outputs[state].end());
+    for (size_type cls = 0; cls < classes_count; ++cls) {
+      auto& next    = transitions[state * classes_count + cls];
+      auto fallback = transitions[failure[state] * classes_count + cls];
+      if (next < 0) {
+        next = fallback;
+      } else {
+        failure[next] = fallback;
+        states.push(next);
+      }
+    }
+  }
+
+  std::vector<size_type> output_offsets(states_count + 1, 0);
+  std::vector<size_type> flat_outputs;
+  for (size_type state = 0; state < states_count; ++state) {
+    flat_outputs.insert(flat_outputs.end(), outputs[state].begin(), outputs[state].end());
+    output_offsets[state + 1] = static_cast<size_type>(flat_outputs.size());
+  }
+
+  return aho_corasick{cudf::detail::make_device_uvector_async(
+                        std::vector<uint8_t>(byte_classes.begin(), byte_classes.end()), stream),
+                      classes_count,
+                      cudf::detail::make_device_uvector_async(transitions, stream),
+                      cudf::detail::make_device_uvector_async(output_offsets, stream),
+                      cudf::detail::make_device_uvector_async(flat_outputs, stream),
+                      cudf::detail::make_device_uvector_sync(target_lengths, stream)};
+}
+
+void validate_targets(strings_column_view const& targets)
+{
+  CUDF_EXPECTS(targets.size() > 0, "Must include at least one search target");
+  CUDF_EXPECTS(!targets.has_nulls(), "Search targets cannot contain null strings");
+}
+
+}  // namespace
+
 std::unique_ptr<column> find_multiple(
   strings_column_view const& strings,
   strings_column_view const& targets,
@@ -39,13 +218,12 @@ std::unique_ptr<column> find_multiple(
   auto strings_count = strings.size();
   if (strings_count == 0) return make_empty_column(data_type{type_id::INT32});
   auto targets_count = targets.size();
-  CUDF_EXPECTS(targets_count > 0, "Must include at least one search target");
-  CUDF_EXPECTS(!targets.has_nulls(), "Search targets cannot contain null strings");
+  validate_targets(targets);
 
-  auto strings_column = column_device_view::create(strings.parent(), stream);
-  auto d_strings      = *strings_column;
-  auto targets_column = column_device_view::create(targets.parent(), stream);
-  auto d_targets      = *targets_column;
+  auto strings_column    = column_device_view::create(strings.parent(), stream);
+  auto d_strings         = *strings_column;
+  auto const automaton   = create_aho_corasick(targets, stream);
+  auto const d_automaton = automaton.view();
 
   // create output column
   auto total_count  = strings_count * targets_count;
@@ -57,19 +235,120 @@ std::unique_ptr<column> find_multiple(
                                      mr);  // no nulls
   auto results_view = results->mutable_view();
   auto d_results    = results_view.data<int32_t>();
-  // fill output column with position values
+  // fill output column with the position of the first occurrence of each target
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    strings_count,
+    [d_strings, d_automaton, targets_count, d_results] __device__(size_type str_idx) {
+      auto d_positions = d_results + str_idx * targets_count;
+      for (size_type target = 0; target < targets_count; ++target) {
+        d_positions[target] = -1;
+      }
+      if (d_strings.is_null(str_idx)) return;
+      size_type found = 0;
+      d_automaton.for_each_match(d_strings.element<string_view>(str_idx),
+                                 [&](size_type target, size_type position) {
+                                   if (d_positions[target] < 0) {
+                                     d_positions[target] = position;
+                                     ++found;
+                                   }
+                                   return found < targets_count;
+                                 });
+    });
+  results->set_null_count(0);
+  return results;
+}
+
+std::unique_ptr<table> contains_multiple(
+  strings_column_view const& strings,
+  strings_column_view const& targets,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  validate_targets(targets);
+  auto const strings_count = strings.size();
+  auto const targets_count = targets.size();
+
+  std::vector<std::unique_ptr<column>> results;
+  std::vector<bool*> h_results;
+  for (size_type target = 0; target < targets_count; ++target) {
+    results.push_back(make_numeric_column(data_type{type_id::BOOL8},
+                                          strings_count,
+                                          cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                          strings.null_count(),
+                                          stream,
+                                          mr));
+    h_results.push_back(results.back()->mutable_view().data<bool>());
+  }
+  if (strings_count == 0) return std::make_unique<table>(std::move(results));
+
+  auto strings_column    = column_device_view::create(strings.parent(), stream);
+  auto d_strings         = *strings_column;
+  auto const automaton   = create_aho_corasick(targets, stream);
+  auto const d_automaton = automaton.view();
+  auto const d_results   = cudf::detail::make_device_uvector_async(h_results, stream);
+
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    strings_count,
+    [d_strings, d_automaton, targets_count, d_results = d_results.data()] __device__(
+      size_type str_idx) {
+      for (size_type target = 0; target < targets_count; ++target) {
+        d_results[target][str_idx] = false;
+      }
+      if (d_strings.is_null(str_idx)) return;
+      size_type found = 0;
+      d_automaton.for_each_match(d_strings.element<string_view>(str_idx),
+                                 [&](size_type target, size_type) {
+                                   if (not d_results[target][str_idx]) {
+                                     d_results[target][str_idx] = true;
+                                     ++found;
+                                   }
+                                   return found < targets_count;
+                                 });
+    });
+  return std::make_unique<table>(std::move(results));
+}
+
+std::unique_ptr<column> find_first_target(
+  strings_column_view const& strings,
+  strings_column_view const& targets,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  validate_targets(targets);
+  auto const strings_count = strings.size();
+  if (strings_count == 0) return make_empty_column(data_type{type_id::INT32});
+  auto const targets_count = targets.size();
+
+  auto strings_column    = column_device_view::create(strings.parent(), stream);
+  auto d_strings         = *strings_column;
+  auto const automaton   = create_aho_corasick(targets, stream);
+  auto const d_automaton = automaton.view();
+
+  auto results   = make_numeric_column(data_type{type_id::INT32},
+                                     strings_count,
+                                     cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                     strings.null_count(),
+                                     stream,
+                                     mr);
+  auto d_results = results->mutable_view().data<size_type>();
   thrust::transform(rmm::exec_policy(stream),
                     thrust::make_counting_iterator<size_type>(0),
-                    thrust::make_counting_iterator<size_type>(total_count),
+                    thrust::make_counting_iterator<size_type>(strings_count),
                     d_results,
-                    [d_strings, d_targets, targets_count] __device__(size_type idx) {
-                      size_type str_idx = idx / targets_count;
-                      if (d_strings.is_null(str_idx)) return -1;
-                      string_view d_str = d_strings.element<string_view>(str_idx);
-                      string_view d_tgt = d_targets.element<string_view>(idx % targets_count);
-                      return d_str.find(d_tgt);
+                    [d_strings, d_automaton, targets_count] __device__(size_type str_idx) {
+                      if (d_strings.is_null(str_idx)) return size_type{-1};
+                      size_type first = targets_count;
+                      d_automaton.for_each_match(d_strings.element<string_view>(str_idx),
+                                                 [&](size_type target, size_type) {
+                                                   first = min(first, target);
+                                                   return first > 0;
+                                                 });
+                      return first < targets_count ? first : size_type{-1};
                     });
-  results->set_null_count(0);
   return results;
 }
 
@@ -84,5 +363,21 @@ std::unique_ptr<column> find_multiple(strings_column_view const& strings,
   return detail::find_multiple(strings, targets, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<table> contains_multiple(strings_column_view const& strings,
+                                         strings_column_view const& targets,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains_multiple(strings, targets, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<column> find_first_target(strings_column_view const& strings,
+                                          strings_column_view const& targets,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::find_first_target(strings, targets, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
@@ -21,6 +21,7 @@
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/types.hpp>
@@ -34,6 +35,9 @@
 
 #include <thrust/optional.h>
 
+#include <tuple>
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -302,6 +306,12 @@ class json_state : private parser {
     return result;
   }
 
+  // name of the current element, if it is a field of an object
+  __device__ string_view const& current_name() const { return cur_el_name; }
+
+  // type of the current element
+  __device__ json_element_type current_type() const { return cur_el_type; }
+
   // return the next element that matches the specified name.
   __device__ parse_result next_matching_element(string_view const& name, bool inclusive)
   {
@@ -540,9 +550,10 @@ class path_state : private parser {
  *
  * @param json_path The incoming json path
  * @param stream Cuda stream to perform any gpu actions on
- * @returns A pair containing the command buffer, and maximum stack depth required.
+ * @returns A tuple containing the command buffer, the maximum stack depth required and whether
+ * the path starts with a named child (`$.name`).
  */
-std::pair<thrust::optional<rmm::device_uvector<path_operator>>, int> build_command_buffer(
+std::tuple<thrust::optional<rmm::device_uvector<path_operator>>, int, bool> build_command_buffer(
   cudf::string_scalar const& json_path, rmm::cuda_stream_view stream)
 {
   std::string h_json_path = json_path.to_string(stream);
@@ -576,11 +587,13 @@ std::pair<thrust::optional<rmm::device_uvector<path_operator>>, int> build_comma
   } while (op.type != path_operator_type::END);
 
   auto const is_empty = h_operators.size() == 1 && h_operators[0].type == path_operator_type::END;
+  auto const is_keyed = h_operators.size() > 1 && h_operators[1].type == path_operator_type::CHILD;
   return is_empty
-           ? std::make_pair(thrust::nullopt, 0)
-           : std::make_pair(
+           ? std::make_tuple(thrust::nullopt, 0, false)
+           : std::make_tuple(
                thrust::make_optional(cudf::detail::make_device_uvector_sync(h_operators, stream)),
-               max_stack_depth);
+               max_stack_depth,
+               is_keyed);
 }
 
 #define PARSE_TRY(_x)                                                       \
@@ -934,9 +947,253 @@ std::unique_ptr<cudf::column> get_json_object(cudf::strings_column_view const& c
                              mr);
 }
 
+/**
+ * @brief Buffers of one JSONPath query for `get_json_objects_kernel`.
+ */
+struct json_path_output {
+  path_operator const* commands;  // command buffer, nullptr if the path is empty
+  bool keyed;                     // whether the path starts with a named child `$.name`
+  offset_type* offsets;           // output sizes on the first pass and offsets on the second
+  char* chars;                    // output chars, nullptr on the first pass
+  bitmask_type* validity;         // output validity, nullptr on the first pass
+  size_type* valid_count;         // output count of valid rows, nullptr on the first pass
+};
+
+// number of paths sharing one scan of the top-level fields of a json string
+constexpr size_type paths_per_scan = 32;
+
+/**
+ * @brief Applies the JSONPath queries `[first, last)` to a single json string.
+ *
+ * The top-level fields are scanned once for all the queries starting with a named child, and
+ * each of them is applied from the first field with its name, as `parse_json_path` would after
+ * making the same scan on its own. The other queries are applied to the whole string.
+ *
+ * @returns A mask with bit `i` set if query `first + i` produced a valid output.
+ */
+__device__ uint32_t get_json_objects_single(string_view const& str,
+                                            json_path_output const* paths,
+                                            size_type first,
+                                            size_type last,
+                                            size_type row)
+{
+  uint32_t valid_mask = 0;
+  auto apply          = [&](size_type p, json_state j_state, path_operator const* commands) {
+    auto const& path = paths[p];
+    char* dst        = path.chars != nullptr ? path.chars + path.offsets[row] : nullptr;
+    size_t const dst_size =
+      path.chars != nullptr ? path.offsets[row + 1] - path.offsets[row] : 0;
+    json_output output{dst_size, dst};
+    auto const result = parse_json_path<max_command_stack_depth>(j_state, commands, output);
+    if (output.output_len.has_value() && result == parse_result::SUCCESS) {
+      valid_mask |= 1u << (p - first);
+    }
+    // the sizes are filled in only on the first pass
+    if (path.chars == nullptr) {
+      path.offsets[row] = static_cast<offset_type>(output.output_len.value_or(0));
+    }
+  };
+  auto set_null = [&](size_type p) {
+    if (paths[p].chars == nullptr) { paths[p].offsets[row] = 0; }
+  };
+
+  uint32_t pending = 0;
+  for (auto p = first; p < last; ++p) {
+    if (str.size_bytes() == 0 || paths[p].commands == nullptr) {
+      set_null(p);
+    } else if (paths[p].keyed) {
+      pending |= 1u << (p - first);
+    } else {
+      apply(p, json_state(str.data(), str.size_bytes()), paths[p].commands);
+    }
+  }
+  if (pending == 0) { return valid_mask; }
+
+  // a single scan of the top-level fields for all the named children
+  json_state fields(str.data(), str.size_bytes());
+  if (fields.next_element() != parse_result::ERROR && fields.current_type() == OBJECT) {
+    auto result = fields.child_element(OBJECT);
+    while (pending != 0 && result == parse_result::SUCCESS) {
+      for (auto bits = pending; bits != 0; bits &= bits - 1) {
+        auto const p = first + __ffs(bits) - 1;
+        // commands are ROOT, CHILD(name) and the remainder of the query
+        if (fields.current_name() == paths[p].commands[1].name) {
+          apply(p, fields, paths[p].commands + 2);
+          pending &= ~(1u << (p - first));
+        }
+      }
+      result = fields.next_element();
+    }
+  }
+  // the fields of the remaining queries were not found or the json is invalid
+  for (; pending != 0; pending &= pending - 1) {
+    set_null(first + __ffs(pending) - 1);
+  }
+  return valid_mask;
+}
+
+/**
+ * @brief Kernel for running several JSONPath queries on each row.
+ *
+ * Like `get_json_object_kernel` this runs twice, first for the output sizes of every query and
+ * then to fill in the output chars and validities.
+ *
+ * @param col Device view of the incoming strings
+ * @param paths Buffers of each query
+ * @param num_paths Number of queries
+ */
+template <int block_size>
+__launch_bounds__(block_size) __global__
+  void get_json_objects_kernel(column_device_view col,
+                               json_path_output const* paths,
+                               size_type num_paths)
+{
+  size_type tid    = threadIdx.x + (blockDim.x * blockIdx.x);
+  size_type stride = blockDim.x * gridDim.x;
+
+  auto active_threads = __ballot_sync(0xffffffff, tid < col.size());
+  while (tid < col.size()) {
+    string_view const str = col.element<string_view>(tid);
+    for (size_type first = 0; first < num_paths; first += paths_per_scan) {
+      auto const last       = std::min(first + paths_per_scan, num_paths);
+      auto const valid_mask = get_json_objects_single(str, paths, first, last, tid);
+
+      // validity filled in only during the output step
+      for (auto p = first; p < last; ++p) {
+        if (paths[p].validity == nullptr) { continue; }
+        uint32_t mask = __ballot_sync(active_threads, valid_mask & (1u << (p - first)));
+        // 0th lane of the warp writes the validity
+        if (!(tid % cudf::detail::warp_size)) {
+          paths[p].validity[cudf::word_index(tid)] = mask;
+          atomicAdd(paths[p].valid_count, __popc(mask));
+        }
+      }
+    }
+
+    tid += stride;
+    active_threads = __ballot_sync(active_threads, tid < col.size());
+  }
+}
+
 }  // namespace
+
+/**
+ * @copydoc cudf::strings::detail::get_json_object(cudf::strings_column_view const&,
+ * std::vector<cudf::string_scalar> const&, rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
+ */
+std::vector<std::unique_ptr<cudf::column>> get_json_object(
+  cudf::strings_column_view const& col,
+  std::vector<cudf::string_scalar> const& json_paths,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const num_paths = static_cast<size_type>(json_paths.size());
+
+  // preprocess the json_paths into command buffers
+  std::vector<thrust::optional<rmm::device_uvector<path_operator>>> commands;
+  std::vector<json_path_output> h_paths;
+  std::vector<std::unique_ptr<column>> offsets;
+  commands.reserve(num_paths);
+  for (auto const& json_path : json_paths) {
+    auto preprocess = build_command_buffer(json_path, stream);
+    CUDF_EXPECTS(std::get<1>(preprocess) <= max_command_stack_depth,
+                 "Encountered JSONPath string that is too complex");
+    commands.push_back(std::move(std::get<0>(preprocess)));
+    offsets.push_back(cudf::make_fixed_width_column(
+      data_type{type_id::INT32}, col.size() + 1, mask_state::UNALLOCATED, stream, mr));
+    auto const d_commands = commands.back().has_value() ? commands.back()->data() : nullptr;
+    h_paths.push_back(json_path_output{d_commands,
+                                       std::get<2>(preprocess),
+                                       offsets.back()->mutable_view().head<offset_type>(),
+                                       nullptr,
+                                       nullptr,
+                                       nullptr});
+  }
+
+  std::vector<std::unique_ptr<column>> results;
+  if (col.is_empty() || num_paths == 0) {
+    for (size_type p = 0; p < num_paths; ++p) {
+      results.push_back(make_empty_strings_column(stream, mr));
+    }
+    return results;
+  }
+
+  constexpr int block_size = 512;
+  cudf::detail::grid_1d const grid{col.size(), block_size};
+
+  auto cdv = column_device_view::create(col.parent(), stream);
+
+  // preprocess sizes (returned in the offsets buffers)
+  auto d_paths = cudf::detail::make_device_uvector_async(h_paths, stream);
+  get_json_objects_kernel<block_size>
+    <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+      *cdv, d_paths.data(), num_paths);
+
+  // convert sizes to offsets and allocate the outputs
+  std::vector<std::unique_ptr<column>> chars;
+  std::vector<rmm::device_buffer> validities;
+  rmm::device_uvector<size_type> valid_counts(num_paths, stream);
+  CUDA_TRY(cudaMemsetAsync(
+    valid_counts.data(), 0, valid_counts.size() * sizeof(size_type), stream.value()));
+  for (size_type p = 0; p < num_paths; ++p) {
+    auto d_offsets = h_paths[p].offsets;
+    thrust::exclusive_scan(
+      rmm::exec_policy(stream), d_offsets, d_offsets + col.size() + 1, d_offsets, 0);
+    size_type const output_size =
+      cudf::detail::get_value<offset_type>(offsets[p]->view(), col.size(), stream);
+    chars.push_back(cudf::make_fixed_width_column(
+      data_type{type_id::INT8}, output_size, mask_state::UNALLOCATED, stream, mr));
+    validities.push_back(
+      cudf::detail::create_null_mask(col.size(), mask_state::UNINITIALIZED, stream, mr));
+    h_paths[p].chars       = chars.back()->mutable_view().head<char>();
+    h_paths[p].validity    = static_cast<bitmask_type*>(validities.back().data());
+    h_paths[p].valid_count = valid_counts.data() + p;
+  }
+
+  // compute results
+  d_paths = cudf::detail::make_device_uvector_async(h_paths, stream);
+  get_json_objects_kernel<block_size>
+    <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+      *cdv, d_paths.data(), num_paths);
+  auto const h_valid_counts = cudf::detail::make_std_vector_sync(valid_counts, stream);
+
+  for (size_type p = 0; p < num_paths; ++p) {
+    // an empty query returns a strings column containing all nulls
+    if (h_paths[p].commands == nullptr) {
+      results.push_back(std::make_unique<column>(
+        data_type{type_id::STRING},
+        col.size(),
+        rmm::device_buffer{0, stream, mr},  // no data
+        cudf::detail::create_null_mask(col.size(), mask_state::ALL_NULL, stream, mr),
+        col.size()));  // null count
+      continue;
+    }
+    results.push_back(make_strings_column(col.size(),
+                                          std::move(offsets[p]),
+                                          std::move(chars[p]),
+                                          col.size() - h_valid_counts[p],
+                                          std::move(validities[p]),
+                                          stream,
+                                          mr));
+  }
+  return results;
+}
+
 }  // namespace detail
 
+/**
+ * @copydoc cudf::strings::get_json_object(cudf::strings_column_view const&,
+ * std::vector<cudf::string_scalar> const&, rmm::mr::device_memory_resource*)
+ */
+std::vector<std::unique_ptr<cudf::column>> get_json_object(
+  cudf::strings_column_view const& col,
+  std::vector<cudf::string_scalar> const& json_paths,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::get_json_object(col, json_paths, rmm::cuda_stream_default, mr);
+}
+
 /**
  * @copydoc cudf::strings::get_json_object
  */
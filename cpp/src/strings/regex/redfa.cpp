@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <strings/char_types/is_flags.h>
+#include <strings/regex/regcomp.h>
+
+#include <algorithm>
+#include <map>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+
+/**
+ * @brief Host version of `reclass_device::is_match` for an ASCII character.
+ */
+bool is_class_match(reclass const& cls, char32_t ch, uint8_t const* ascii_flags)
+{
+  for (std::size_t i = 0; i + 1 < cls.literals.size(); i += 2) {
+    if ((ch >= cls.literals[i]) && (ch <= cls.literals[i + 1])) return true;
+  }
+  auto const fl = ascii_flags[ch];
+  if ((cls.builtins & 1) && ((ch == '_') || IS_ALPHANUM(fl))) return true;                  // \w
+  if ((cls.builtins & 2) && IS_SPACE(fl)) return true;                                      // \s
+  if ((cls.builtins & 4) && IS_DIGIT(fl)) return true;                                      // \d
+  if ((cls.builtins & 8) && ((ch != '\n') && (ch != '_') && !IS_ALPHANUM(fl))) return true;  // \W
+  if ((cls.builtins & 16) && !IS_SPACE(fl)) return true;                                    // \S
+  if ((cls.builtins & 32) && ((ch != '\n') && !IS_DIGIT(fl))) return true;                  // \D
+  return false;
+}
+
+/**
+ * @brief Returns whether the instruction `id` consumes the ASCII character `ch`.
+ */
+bool is_match(reprog& prog, int32_t id, char32_t ch, uint8_t const* ascii_flags)
+{
+  auto const& inst = prog.inst_at(id);
+  switch (inst.type) {
+    case CHAR: return inst.u1.c == ch;
+    case ANY: return ch != '\n';
+    case ANYNL: return true;
+    case CCLASS: return is_class_match(prog.class_at(inst.u1.cls_id), ch, ascii_flags);
+    case NCCLASS: return !is_class_match(prog.class_at(inst.u1.cls_id), ch, ascii_flags);
+    default: return false;
+  }
+}
+
+/**
+ * @brief Returns the sorted ids of the character, class and END instructions reached from the
+ * instructions `ids` through groups and alternations.
+ */
+std::vector<int32_t> closure(reprog& prog, std::vector<int32_t> const& ids)
+{
+  std::vector<bool> visited(prog.insts_count(), false);
+  std::vector<int32_t> stack(ids.rbegin(), ids.rend());
+  std::vector<int32_t> result;
+  while (!stack.empty()) {
+    auto const id = stack.back();
+    stack.pop_back();
+    if (visited[id]) continue;
+    visited[id]      = true;
+    auto const& inst = prog.inst_at(id);
+    switch (inst.type) {
+      case LBRA:
+      case RBRA: stack.push_back(inst.u2.next_id); break;
+      case OR:
+        stack.push_back(inst.u1.right_id);
+        stack.push_back(inst.u2.left_id);
+        break;
+      default: result.push_back(id);
+    }
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+}  // namespace
+
+std::optional<redfa> create_dfa(reprog& prog, uint8_t const* ascii_flags, bool anchored)
+{
+  auto const insts_count = prog.insts_count();
+  for (int32_t id = 0; id < insts_count; ++id) {
+    switch (prog.inst_at(id).type) {
+      case CHAR:
+      case ANY:
+      case ANYNL:
+      case CCLASS:
+      case NCCLASS:
+      case LBRA:
+      case RBRA:
+      case OR:
+      case END: break;
+      default: return std::nullopt;
+    }
+  }
+
+  redfa dfa;
+  // characters consumed by the same instructions share a class
+  std::map<std::vector<bool>, int32_t> classes;
+  std::vector<std::vector<bool>> class_matches;
+  for (char32_t ch = 0; ch < 128; ++ch) {
+    std::vector<bool> matches(insts_count);
+    for (int32_t id = 0; id < insts_count; ++id) {
+      matches[id] = is_match(prog, id, ch, ascii_flags);
+    }
+    auto const inserted = classes.insert({matches, static_cast<int32_t>(classes.size())});
+    if (inserted.second) { class_matches.push_back(matches); }
+    dfa.char_classes[ch] = static_cast<uint8_t>(inserted.first->second);
+  }
+  dfa.classes_count = static_cast<int32_t>(classes.size());
+
+  std::vector<int32_t> start_ids;
+  for (auto ids = prog.starts_data(); *ids >= 0; ++ids) {
+    start_ids.push_back(*ids);
+  }
+
+  // subset construction: each state is the set of instructions active before a character
+  std::map<std::vector<int32_t>, int32_t> state_ids;
+  std::vector<std::vector<int32_t>> states;
+  auto add_state = [&](std::vector<int32_t>&& insts) {
+    auto const inserted = state_ids.insert({insts, static_cast<int32_t>(states.size())});
+    if (inserted.second) { states.push_back(std::move(insts)); }
+    return inserted.first->second;
+  };
+  add_state(closure(prog, start_ids));
+
+  for (int32_t state = 0; state < static_cast<int32_t>(states.size()); ++state) {
+    if (static_cast<int32_t>(states.size()) > MAX_DFA_STATES) return std::nullopt;
+    auto const insts     = states[state];
+    auto const accepting = std::any_of(
+      insts.begin(), insts.end(), [&prog](auto id) { return prog.inst_at(id).type == END; });
+    dfa.accepting.push_back(accepting);
+    if (insts.empty()) { dfa.dead_state = state; }
+
+    for (int32_t cls = 0; cls < dfa.classes_count; ++cls) {
+      // a match is final, so the following characters are not needed
+      if (accepting) {
+        dfa.transitions.push_back(static_cast<int16_t>(state));
+        continue;
+      }
+      // matching anywhere starts a new match at every character
+      auto next = anchored ? std::vector<int32_t>{} : start_ids;
+      for (auto const id : insts) {
+        if (class_matches[cls][id]) { next.push_back(prog.inst_at(id).u2.next_id); }
+      }
+      dfa.transitions.push_back(static_cast<int16_t>(add_state(closure(prog, next))));
+    }
+  }
+  return dfa;
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 #pragma once
+#include <array>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -123,6 +125,41 @@ class reprog {
   int32_t _num_capturing_groups;
 };
 
+/**
+ * @brief Deterministic automaton equivalent to a regex program on ASCII strings.
+ *
+ * ASCII characters behaving the same for every instruction of the program share a character class.
+ * State 0 is the start state.
+ */
+struct redfa {
+  std::array<uint8_t, 128> char_classes{};  // character class of each ASCII character
+  int32_t classes_count{};
+  int32_t dead_state{-1};            // state never reaching a match, or -1
+  std::vector<int16_t> transitions;  // next state by [state * classes_count + class]
+  std::vector<uint8_t> accepting;    // whether each state is a match
+
+  int32_t states_count() const { return static_cast<int32_t>(accepting.size()); }
+};
+
+/**
+ * @brief Largest number of states of a DFA built by `create_dfa`.
+ */
+constexpr int32_t MAX_DFA_STATES = 1024;
+
+/**
+ * @brief Builds the DFA telling whether a program matches an ASCII string.
+ *
+ * Only programs made of characters, classes, groups and alternations are supported. Programs
+ * using `^`, `$`, `\b` or `\B` need the position in the string and are not.
+ *
+ * @param prog The compiled regex program.
+ * @param ascii_flags The code-point flags of the 128 ASCII characters.
+ * @param anchored True to match only at the beginning of the string, false to match anywhere.
+ * @return The DFA, or an empty optional if the program is not supported or needs more than
+ * `MAX_DFA_STATES` states.
+ */
+std::optional<redfa> create_dfa(reprog& prog, uint8_t const* ascii_flags, bool anchored);
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
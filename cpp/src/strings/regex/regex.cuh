@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.  All rights reserved.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.  All rights reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,9 +18,11 @@
 #include <strings/regex/regcomp.h>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
 
 #include <functional>
 #include <memory>
+#include <string>
 
 namespace cudf {
 
@@ -33,6 +35,15 @@ struct reljunk;
 struct reinst;
 class reprog;
 
+/**
+ * @brief Kind of match a DFA is built for by `reprog_device::create`.
+ */
+enum class regex_dfa_mode {
+  NONE,      ///< No DFA is built
+  CONTAINS,  ///< DFA telling whether the pattern matches anywhere in a string
+  MATCHES    ///< DFA telling whether the pattern matches at the beginning of a string
+};
+
 /**
  * @brief Regex class stored on the device and executed by reprog_device.
  *
@@ -68,19 +79,25 @@ class reprog_device {
    * The number of strings is needed to compute the state data size required when evaluating the
    * regex.
    *
+   * Compiled programs are cached by pattern, DFA mode and device, so the pattern is parsed and
+   * copied to the device only the first time it is used. The cache holds at most
+   * `LIBCUDF_REGEX_CACHE_LIMIT` programs (default 128, 0 disables it).
+   *
    * @param pattern The regex pattern to compile.
    * @param cp_flags The code-point lookup table for character types.
    * @param strings_count Number of strings that will be evaluated.
    * @param stream CUDA stream for asynchronous memory allocations. To ensure correct
    * synchronization on destruction, the same stream should be used for all operations with the
    * created objects.
+   * @param dfa_mode Kind of match to build a DFA for, used by `dfa_find` when the pattern allows.
    * @return The program device object.
    */
   static std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> create(
     std::string const& pattern,
     const uint8_t* cp_flags,
     int32_t strings_count,
-    rmm::cuda_stream_view stream);
+    rmm::cuda_stream_view stream,
+    regex_dfa_mode dfa_mode = regex_dfa_mode::NONE);
   /**
    * @brief Called automatically by the unique_ptr returned from create().
    */
@@ -96,6 +113,11 @@ class reprog_device {
    */
   __device__ bool is_empty() const { return insts_counts() == 0 || get_inst(0)->type == END; }
 
+  /**
+   * @brief Returns true if a DFA was built for this program.
+   */
+  __host__ __device__ bool has_dfa() const { return _dfa_transitions != nullptr; }
+
   /**
    * @brief Returns the number of regex groups found in the expression.
    */
@@ -158,6 +180,18 @@ class reprog_device {
   __device__ inline int32_t extract(
     int32_t idx, string_view const& d_str, int32_t& begin, int32_t& end, int32_t column);
 
+  /**
+   * @brief Evaluates the DFA built for this program on the given string.
+   *
+   * The DFA reads one byte per character, so strings with non-ASCII characters are left to
+   * `find`.
+   *
+   * @param d_str The string to search.
+   * @return 1 if the pattern matches as selected by the `regex_dfa_mode` of `create`, 0 if it does
+   * not, and -1 if the string is not ASCII.
+   */
+  __device__ inline int32_t dfa_find(string_view const& d_str) const;
+
  private:
   int32_t _startinst_id, _num_capturing_groups;
   int32_t _insts_count, _starts_count, _classes_count;
@@ -168,6 +202,11 @@ class reprog_device {
   void* _relists_mem{};               // runtime relist memory for regexec
   u_char* _stack_mem1{};              // memory for relist object 1
   u_char* _stack_mem2{};              // memory for relist object 2
+  int32_t _dfa_classes_count{};       // number of DFA character classes
+  int32_t _dfa_dead_state{-1};        // DFA state never reaching a match
+  const uint8_t* _dfa_classes{};      // DFA character class of each ASCII character
+  const uint8_t* _dfa_accepting{};    // whether each DFA state is a match
+  const int16_t* _dfa_transitions{};  // next DFA state by state and character class
 
   /**
    * @brief Executes the regex pattern on the given string.
@@ -182,6 +221,17 @@ class reprog_device {
     int32_t idx, string_view const& d_str, int32_t& begin, int32_t& end, int32_t groupid = 0);
 
   reprog_device(reprog&);  // must use create()
+
+  /**
+   * @brief Compiles a regex pattern into a program with its data allocated from `mr`.
+   *
+   * The program has no execution memory, which `create` allocates for each use.
+   */
+  static std::shared_ptr<reprog_device> compile(std::string const& pattern,
+                                                const uint8_t* cp_flags,
+                                                regex_dfa_mode dfa_mode,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr);
 };
 
 // 10128 ≈ 1000 instructions
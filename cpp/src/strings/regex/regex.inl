@@ -387,6 +387,20 @@ __device__ inline int32_t reprog_device::extract(
   return call_regexec(idx, dstr, begin, end, group_id + 1);
 }
 
+__device__ inline int32_t reprog_device::dfa_find(string_view const& dstr) const
+{
+  int32_t state = 0;
+  for (auto itr = dstr.data(); itr < dstr.data() + dstr.size_bytes(); ++itr) {
+    if (_dfa_accepting[state]) return 1;
+    auto const byte = static_cast<uint8_t>(*itr);
+    if (byte == 0) return 0;  // regexec stops at a null character too
+    if (byte >= 128) return -1;
+    state = _dfa_transitions[state * _dfa_classes_count + _dfa_classes[byte]];
+    if (state == _dfa_dead_state) return 0;
+  }
+  return _dfa_accepting[state];
+}
+
 __device__ inline int32_t reprog_device::call_regexec(
   int32_t idx, string_view const& dstr, int32_t& begin, int32_t& end, int32_t group_id)
 {
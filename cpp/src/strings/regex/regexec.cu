@@ -21,8 +21,18 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/cuda_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
 
 namespace cudf {
 namespace strings {
@@ -59,6 +69,78 @@ std::vector<char32_t> string_to_char32_vector(std::string const& pattern)
   return result;
 }
 
+/**
+ * @brief Bounded cache of the regex programs compiled by `reprog_device::create`, evicting the
+ * least recently used programs.
+ *
+ * Holds at most `LIBCUDF_REGEX_CACHE_LIMIT` programs (default 128, 0 disables the cache). The
+ * cached programs are allocated from a `cuda_memory_resource`, since the current device resource
+ * may be replaced while they are cached.
+ */
+class program_cache {
+ public:
+  using program_ptr = std::shared_ptr<reprog_device const>;
+
+  program_cache()
+  {
+    auto const limit = std::getenv("LIBCUDF_REGEX_CACHE_LIMIT");
+    _limit           = limit != nullptr ? std::stoull(limit) : 128;
+  }
+
+  std::size_t limit() const { return _limit; }
+
+  rmm::mr::device_memory_resource* memory_resource() { return &_mr; }
+
+  /**
+   * @brief Returns the program cached under `key`, or the program returned by `compile` after
+   * caching it.
+   *
+   * Programs are compiled without holding the lock, so concurrent calls compile different
+   * patterns in parallel.
+   */
+  template <typename Compile>
+  program_ptr get_or_compile(std::string const& key, Compile compile)
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (auto const program = find(key)) { return program; }
+    }
+    program_ptr compiled = compile();
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (auto const program = find(key)) { return program; }
+    _programs.emplace_front(key, compiled);
+    _index[key] = _programs.begin();
+    if (_programs.size() > _limit) {
+      _index.erase(_programs.back().first);
+      _programs.pop_back();
+    }
+    return compiled;
+  }
+
+ private:
+  program_ptr find(std::string const& key)
+  {
+    auto const found = _index.find(key);
+    if (found == _index.end()) { return nullptr; }
+    _programs.splice(_programs.begin(), _programs, found->second);
+    return found->second->second;
+  }
+
+  std::size_t _limit;
+  std::mutex _mutex;
+  std::list<std::pair<std::string, program_ptr>> _programs;  // most recently used first
+  std::unordered_map<std::string, std::list<std::pair<std::string, program_ptr>>::iterator> _index;
+  rmm::mr::cuda_memory_resource _mr;
+};
+
+// Never destroyed: the device memory of the cached programs cannot be freed once the CUDA context
+// is torn down at exit
+program_cache& get_program_cache()
+{
+  static auto* cache = new program_cache();
+  return *cache;
+}
+
 }  // namespace
 
 // Copy reprog primitive values
@@ -74,12 +156,12 @@ reprog_device::reprog_device(reprog& prog)
 {
 }
 
-// Create instance of the reprog that can be passed into a device kernel
-std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_device::create(
-  std::string const& pattern,
-  uint8_t const* codepoint_flags,
-  int32_t strings_count,
-  rmm::cuda_stream_view stream)
+// Compile the pattern into a reprog with its data in device memory
+std::shared_ptr<reprog_device> reprog_device::compile(std::string const& pattern,
+                                                      uint8_t const* codepoint_flags,
+                                                      regex_dfa_mode dfa_mode,
+                                                      rmm::cuda_stream_view stream,
+                                                      rmm::mr::device_memory_resource* mr)
 {
   std::vector<char32_t> pattern32 = string_to_char32_vector(pattern);
   // compile pattern into host object
@@ -97,18 +179,12 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
     cudf::util::round_up_safe<size_t>(classes_count * sizeof(_classes[0]), sizeof(size_t));
   for (int32_t idx = 0; idx < classes_count; ++idx)
     classes_size += static_cast<int32_t>((h_prog.class_at(idx).literals.size()) * sizeof(char32_t));
-  size_t memsize  = insts_size + startids_size + classes_size;
-  size_t rlm_size = 0;
-  // check memory size needed for executing regex
-  if (insts_count > MAX_STACK_INSTS) {
-    auto relist_alloc_size = relist::alloc_size(insts_count);
-    rlm_size               = relist_alloc_size * 2L * strings_count;  // reljunk has 2 relist ptrs
-  }
+  size_t memsize = insts_size + startids_size + classes_size;
 
   // allocate memory to store prog data
   std::vector<u_char> h_buffer(memsize);
   u_char* h_ptr  = h_buffer.data();  // running pointer
-  auto* d_buffer = new rmm::device_buffer(memsize, stream);
+  auto* d_buffer = new rmm::device_buffer(memsize, stream, mr);
   u_char* d_ptr  = reinterpret_cast<u_char*>(d_buffer->data());  // running device pointer
   // put everything into a flat host buffer first
   reprog_device* d_prog = new reprog_device(h_prog);
@@ -147,20 +223,93 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
   d_prog->_starts_count    = starts_count;
   d_prog->_classes_count   = classes_count;
   d_prog->_codepoint_flags = codepoint_flags;
-  // allocate execute memory if needed
-  rmm::device_buffer* d_relists{};
-  if (rlm_size > 0) {
-    d_relists            = new rmm::device_buffer(rlm_size, stream);
-    d_prog->_relists_mem = d_relists->data();
-  }
 
   // copy flat prog to device memory
   CUDA_TRY(cudaMemcpyAsync(
     d_buffer->data(), h_buffer.data(), memsize, cudaMemcpyHostToDevice, stream.value()));
+  // build the DFA if the pattern allows one
+  rmm::device_buffer* d_dfa{};
+  if (dfa_mode != regex_dfa_mode::NONE) {
+    std::array<uint8_t, 128> ascii_flags;
+    CUDA_TRY(cudaMemcpyAsync(ascii_flags.data(),
+                             codepoint_flags,
+                             ascii_flags.size(),
+                             cudaMemcpyDeviceToHost,
+                             stream.value()));
+    stream.synchronize();
+    auto const dfa = create_dfa(h_prog, ascii_flags.data(), dfa_mode == regex_dfa_mode::MATCHES);
+    if (dfa.has_value()) {
+      // copy the DFA tables into flat memory: [char classes][accepting states][transitions]
+      auto const classes_size     = dfa->char_classes.size();
+      auto const accepting_size   = cudf::util::round_up_safe<size_t>(dfa->accepting.size(), 8);
+      auto const transitions_size = dfa->transitions.size() * sizeof(dfa->transitions[0]);
+      std::vector<u_char> h_dfa(classes_size + accepting_size + transitions_size);
+      memcpy(h_dfa.data(), dfa->char_classes.data(), classes_size);
+      memcpy(h_dfa.data() + classes_size, dfa->accepting.data(), dfa->accepting.size());
+      memcpy(
+        h_dfa.data() + classes_size + accepting_size, dfa->transitions.data(), transitions_size);
+      d_dfa       = new rmm::device_buffer(h_dfa.data(), h_dfa.size(), stream, mr);
+      auto d_data = reinterpret_cast<u_char const*>(d_dfa->data());
+
+      d_prog->_dfa_classes_count = dfa->classes_count;
+      d_prog->_dfa_dead_state    = dfa->dead_state;
+      d_prog->_dfa_classes       = d_data;
+      d_prog->_dfa_accepting     = d_data + classes_size;
+      d_prog->_dfa_transitions   = reinterpret_cast<int16_t const*>(d_prog->_dfa_accepting +
+                                                                  accepting_size);
+      stream.synchronize();  // h_dfa is released on return
+    }
+  }
   //
-  auto deleter = [d_buffer, d_relists](reprog_device* t) {
+  auto deleter = [d_buffer, d_dfa](reprog_device* t) {
     t->destroy();
     delete d_buffer;
+    delete d_dfa;
+  };
+  return std::shared_ptr<reprog_device>(d_prog, deleter);
+}
+
+// Create instance of the reprog that can be passed into a device kernel
+std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_device::create(
+  std::string const& pattern,
+  uint8_t const* codepoint_flags,
+  int32_t strings_count,
+  rmm::cuda_stream_view stream,
+  regex_dfa_mode dfa_mode)
+{
+  auto& cache = get_program_cache();
+  std::shared_ptr<reprog_device const> compiled;
+  if (cache.limit() == 0) {
+    compiled = compile(
+      pattern, codepoint_flags, dfa_mode, stream, rmm::mr::get_current_device_resource());
+  } else {
+    int device;
+    CUDA_TRY(cudaGetDevice(&device));
+    auto const key = pattern + '\0' + std::to_string(static_cast<int32_t>(dfa_mode)) + '\0' +
+                     std::to_string(device) + '\0' +
+                     std::to_string(reinterpret_cast<std::uintptr_t>(codepoint_flags));
+    compiled = cache.get_or_compile(key, [&]() {
+      auto program =
+        compile(pattern, codepoint_flags, dfa_mode, stream, cache.memory_resource());
+      // the cached program is used by any stream
+      stream.synchronize();
+      return program;
+    });
+  }
+
+  reprog_device* d_prog = new reprog_device(*compiled);
+  // allocate execute memory if needed
+  rmm::device_buffer* d_relists{};
+  auto const insts_count = d_prog->insts_counts();
+  if (insts_count > MAX_STACK_INSTS) {
+    auto relist_alloc_size = relist::alloc_size(insts_count);
+    auto rlm_size          = relist_alloc_size * 2L * strings_count;  // reljunk has 2 relist ptrs
+    d_relists              = new rmm::device_buffer(rlm_size, stream);
+    d_prog->_relists_mem   = d_relists->data();
+  }
+  // the compiled program is kept alive by the deleter
+  auto deleter = [compiled, d_relists](reprog_device* t) {
+    t->destroy();
     delete d_relists;
   };
   return std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>(d_prog, deleter);
@@ -30,6 +30,8 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <thrust/extrema.h>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -79,7 +81,7 @@ struct replace_multi_regex_fn {
     size_type ch_pos      = 0;
     // initialize the working ranges memory to -1's
     thrust::fill(thrust::seq, d_ranges, d_ranges + number_of_patterns, found_range{-1, 1});
-    // process string one character at a time
+    // process the string one match at a time
     while (ch_pos < nchars) {
       // this minimizes the regex-find calls by only calling it for stale patterns
       // -- those that have not previously matched up to this point (ch_pos)
@@ -96,29 +98,28 @@ struct replace_multi_regex_fn {
           d_ranges[ptn_idx] = found_range{nchars, nchars};  // this pattern is done
       }
       // all the ranges have been updated from each regex match;
-      // look for any that match at this character position (ch_pos)
-      auto itr =
-        thrust::find_if(thrust::seq, d_ranges, d_ranges + number_of_patterns, [ch_pos](auto range) {
-          return range.first == ch_pos;
+      // the earliest one is replaced next, the first pattern wins a tie
+      auto itr = thrust::min_element(
+        thrust::seq, d_ranges, d_ranges + number_of_patterns, [](auto lhs, auto rhs) {
+          return lhs.first < rhs.first;
         });
-      if (itr != d_ranges + number_of_patterns) {
-        // match found, compute and replace the string in the output
-        size_type ptn_idx  = static_cast<size_type>(itr - d_ranges);
-        size_type begin    = d_ranges[ptn_idx].first;
-        size_type end      = d_ranges[ptn_idx].second;
-        string_view d_repl = d_repls.size() > 1 ? d_repls.element<string_view>(ptn_idx)
-                                                : d_repls.element<string_view>(0);
-        auto spos = d_str.byte_offset(begin);
-        auto epos = d_str.byte_offset(end);
-        nbytes += d_repl.size_bytes() - (epos - spos);
-        if (out_ptr) {  // copy unmodified content plus new replacement string
-          out_ptr = copy_and_increment(out_ptr, in_ptr + lpos, spos - lpos);
-          out_ptr = copy_string(out_ptr, d_repl);
-          lpos    = epos;
-        }
-        ch_pos = end - 1;
+      if (itr->first >= nchars) break;  // no pattern matches the rest of the string
+      // compute and replace the string in the output
+      size_type ptn_idx  = static_cast<size_type>(itr - d_ranges);
+      size_type begin    = itr->first;
+      size_type end      = itr->second;
+      string_view d_repl = d_repls.size() > 1 ? d_repls.element<string_view>(ptn_idx)
+                                              : d_repls.element<string_view>(0);
+      auto spos = d_str.byte_offset(begin);
+      auto epos = d_str.byte_offset(end);
+      nbytes += d_repl.size_bytes() - (epos - spos);
+      if (out_ptr) {  // copy unmodified content plus new replacement string
+        out_ptr = copy_and_increment(out_ptr, in_ptr + lpos, spos - lpos);
+        out_ptr = copy_string(out_ptr, d_repl);
+        lpos    = epos;
       }
-      ++ch_pos;
+      // an empty match is replaced once before moving past its character
+      ch_pos = end > begin ? end : begin + 1;
     }
     if (out_ptr)  // copy the remainder
       memcpy(out_ptr, in_ptr + lpos, d_str.size_bytes() - lpos);
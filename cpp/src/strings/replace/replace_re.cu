@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -57,12 +57,12 @@ struct replace_regex_fn {
   int32_t* d_offsets{};
   char* d_chars{};
 
-  __device__ void operator()(size_type idx)
+  /**
+   * @brief Replaces the matches in string `idx`, writing the result to `out_ptr` if it is not
+   * null, and returns the size of the result in bytes.
+   */
+  __device__ size_type replace(size_type idx, char* out_ptr)
   {
-    if (d_strings.is_null(idx)) {
-      if (!d_chars) d_offsets[idx] = 0;
-      return;
-    }
     u_char data1[stack_size];
     u_char data2[stack_size];
     prog.set_stack_mem(data1, data2);
@@ -71,7 +71,6 @@ struct replace_regex_fn {
     auto nbytes       = d_str.size_bytes();              // number of bytes in input string
     auto mxn          = maxrepl < 0 ? nchars : maxrepl;  // max possible replaces for this string
     auto in_ptr       = d_str.data();                    // input pointer (i)
-    auto out_ptr      = d_chars ? d_chars + d_offsets[idx] : nullptr;  // output pointer (o)
     size_type lpos    = 0;
     int32_t begin     = 0;
     int32_t end       = static_cast<int32_t>(nchars);
@@ -94,11 +93,63 @@ struct replace_regex_fn {
     }
     if (out_ptr)                                                  // copy the remainder
       memcpy(out_ptr, in_ptr + lpos, d_str.size_bytes() - lpos);  // o:bbbbrrrrrreeee
-    else
-      d_offsets[idx] = static_cast<int32_t>(nbytes);
+    return nbytes;
+  }
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_strings.is_null(idx)) {
+      if (!d_chars) d_offsets[idx] = 0;
+      return;
+    }
+    auto const nbytes = replace(idx, d_chars ? d_chars + d_offsets[idx] : nullptr);
+    if (!d_chars) d_offsets[idx] = static_cast<int32_t>(nbytes);
+  }
+
+  /**
+   * @brief Writes the result for string `idx` to `d_output` for
+   * `make_strings_children_single_pass`.
+   *
+   * Only valid when the replacement does not lengthen the string.
+   */
+  __device__ size_type operator()(size_type idx, char* d_output)
+  {
+    return d_strings.is_null(idx) ? 0 : replace(idx, d_output);
   }
 };
 
+/**
+ * @brief Upper bound of the output size of each string when the replacement is empty.
+ */
+struct input_size_fn {
+  column_device_view const d_strings;
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    return d_strings.is_null(idx) ? 0 : d_strings.element<string_view>(idx).size_bytes();
+  }
+};
+
+/**
+ * @brief Creates the child columns with `replace_regex_fn`.
+ *
+ * Removing the matches cannot lengthen a string, so the input sizes bound the output and the
+ * pattern is evaluated only once per string.
+ */
+template <size_t stack_size>
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> make_replace_children(
+  replace_regex_fn<stack_size> fn,
+  size_type strings_count,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  if (fn.d_repl.empty()) {
+    return make_strings_children_single_pass(
+      input_size_fn{fn.d_strings}, fn, strings_count, stream, mr);
+  }
+  return make_strings_children(fn, strings_count, stream, mr);
+}
+
 }  // namespace
 
 //
@@ -133,19 +184,19 @@ std::unique_ptr<column> replace_re(
   // instructions
   if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
     children =
-      make_strings_children(replace_regex_fn<RX_STACK_SMALL>{d_strings, d_prog, d_repl, maxrepl},
+      make_replace_children(replace_regex_fn<RX_STACK_SMALL>{d_strings, d_prog, d_repl, maxrepl},
                             strings_count,
                             stream,
                             mr);
   else if (regex_insts <= RX_MEDIUM_INSTS)
     children =
-      make_strings_children(replace_regex_fn<RX_STACK_MEDIUM>{d_strings, d_prog, d_repl, maxrepl},
+      make_replace_children(replace_regex_fn<RX_STACK_MEDIUM>{d_strings, d_prog, d_repl, maxrepl},
                             strings_count,
                             stream,
                             mr);
   else
     children =
-      make_strings_children(replace_regex_fn<RX_STACK_LARGE>{d_strings, d_prog, d_repl, maxrepl},
+      make_replace_children(replace_regex_fn<RX_STACK_LARGE>{d_strings, d_prog, d_repl, maxrepl},
                             strings_count,
                             stream,
                             mr);
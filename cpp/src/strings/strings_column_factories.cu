@@ -123,6 +123,9 @@ std::unique_ptr<column> make_strings_column(size_type num_strings,
   if (null_count > 0) CUDF_EXPECTS(null_mask.size() > 0, "Column with nulls must be nullable.");
   CUDF_EXPECTS(num_strings == offsets_column->size() - 1,
                "Invalid offsets column size for strings column.");
+  // Strings consumers read the offsets as size_type, so INT64 offsets are not supported yet
+  CUDF_EXPECTS(offsets_column->type().id() == type_id::INT32,
+               "Offsets column must be INT32 for strings column.");
   CUDF_EXPECTS(offsets_column->null_count() == 0, "Offsets column should not contain nulls");
   CUDF_EXPECTS(chars_column->null_count() == 0, "Chars column should not contain nulls");
 
@@ -28,9 +28,13 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform_reduce.h>
 #include <thrust/transform_scan.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
 
 namespace cudf {
@@ -120,6 +124,56 @@ std::unique_ptr<column> make_empty_strings_column(rmm::cuda_stream_view stream,
                                   0);  // nulls
 }
 
+namespace {
+/**
+ * @brief Returns true if a 4-byte word of the chars within `[begin, end)` has a non-ASCII byte.
+ */
+struct has_non_ascii_fn {
+  uint8_t const* d_chars;  // chars of the strings column
+  bool aligned;            // whether `d_chars` is aligned to 4 bytes
+  int64_t begin;           // first byte of the strings
+  int64_t end;             // end of the last byte of the strings
+
+  __device__ bool operator()(int64_t word) const
+  {
+    auto const pos = word * 4;
+    uint32_t bits  = 0;
+    if (aligned && pos >= begin && pos + 4 <= end) {
+      bits = reinterpret_cast<uint32_t const*>(d_chars)[word];
+    } else {
+      for (int64_t idx = std::max(pos, begin); idx < std::min(pos + 4, end); ++idx) {
+        bits |= d_chars[idx];
+      }
+    }
+    return (bits & 0x80808080u) != 0;
+  }
+};
+
+}  // namespace
+
+bool is_ascii(strings_column_view const& strings, rmm::cuda_stream_view stream)
+{
+  if (strings.is_empty() || strings.chars_size() == 0) return true;
+  auto const offsets   = strings.offsets();
+  auto const is_int64  = offsets.type().id() == type_id::INT64;
+  auto const offset_at = [&](size_type idx) {
+    return is_int64 ? cudf::detail::get_value<int64_t>(offsets, idx, stream)
+                    : static_cast<int64_t>(cudf::detail::get_value<int32_t>(offsets, idx, stream));
+  };
+  auto const begin = offset_at(strings.offset());
+  auto const end   = offset_at(strings.offset() + strings.size());
+  if (begin == end) return true;
+
+  auto const d_chars = strings.chars().data<uint8_t>();
+  auto const aligned = reinterpret_cast<std::uintptr_t>(d_chars) % sizeof(uint32_t) == 0;
+  return !thrust::transform_reduce(rmm::exec_policy(stream),
+                                   thrust::make_counting_iterator<int64_t>(begin / 4),
+                                   thrust::make_counting_iterator<int64_t>((end + 3) / 4),
+                                   has_non_ascii_fn{d_chars, aligned, begin, end},
+                                   false,
+                                   thrust::logical_or<bool>());
+}
+
 namespace {
 // The device variables are created here to avoid using a singleton that may cause issues
 // with RMM initialize/finalize. See PR #3159 for details on this approach.
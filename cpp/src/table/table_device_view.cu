@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
@@ -72,8 +73,20 @@ bool is_relationally_comparable(TableView const& lhs, TableView const& rhs)
                         [lhs, rhs] __device__(auto const i) {
                           // Simplified this for compile time. (Ideally use double_type_dispatcher)
                           // TODO: possible to implement without double type dispatcher.
-                          return lhs.column(i).type() == rhs.column(i).type() and
-                                 type_dispatcher(lhs.column(i).type(),
+                          auto const lhs_col = lhs.column(i);
+                          auto const rhs_col = rhs.column(i);
+                          if (lhs_col.type() != rhs_col.type()) { return false; }
+                          // lists are ordered by their elements, which must not be nested
+                          if (lhs_col.type().id() == type_id::LIST) {
+                            auto const lhs_child =
+                              lhs_col.child(lists_column_view::child_column_index);
+                            auto const rhs_child =
+                              rhs_col.child(lists_column_view::child_column_index);
+                            return lhs_child.type() == rhs_child.type() and
+                                   type_dispatcher(lhs_child.type(),
+                                                   is_relationally_comparable_impl{});
+                          }
+                          return type_dispatcher(lhs_col.type(),
                                                  is_relationally_comparable_impl{});
                         });
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -28,13 +28,84 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
 #include <thrust/transform.h>
 #include <thrust/transform_scan.h>
 
+#include <limits>
+
 namespace nvtext {
 namespace detail {
 namespace {
 
+// pairs whose shorter string has at most this many characters are computed without a buffer
+constexpr cudf::size_type max_local_length = 64;
+// the distance limit used when computing exact distances
+constexpr int32_t no_max_distance = std::numeric_limits<int32_t>::max() - 1;
+
+/**
+ * @brief Returns the number of int16 values of the temporary buffer needed to compute the
+ * edit-distance of two strings, which is 0 if the pair is computed by `compute_local_distance`.
+ */
+__device__ int32_t compute_buffer_size(cudf::string_view const& d_str,
+                                       cudf::string_view const& d_tgt)
+{
+  auto const min_length = std::min(d_str.length(), d_tgt.length());
+  // just need 3 int16's for each character of the shorter string
+  return min_length <= max_local_length ? 0 : static_cast<int32_t>(min_length * 3);
+}
+
+/**
+ * @brief Compute the edit-distance between two strings keeping a single row of the
+ * computation in thread-local memory.
+ *
+ * The shorter string must have at most `max_local_length` characters. Each row of the
+ * computation is for one character of the longer string. Since the distance never decreases
+ * along the computation, this stops as soon as all the values of a row exceed `max_distance`.
+ *
+ * @param d_str First string
+ * @param d_tgt Second string
+ * @param max_distance Distances above this value are returned as `max_distance + 1`
+ * @return Edit distance value
+ */
+__device__ int32_t compute_local_distance(cudf::string_view const& d_str,
+                                          cudf::string_view const& d_tgt,
+                                          int32_t max_distance)
+{
+  auto const str_length = d_str.length();
+  auto const tgt_length = d_tgt.length();
+  auto const d_short    = str_length < tgt_length ? d_str : d_tgt;
+  auto const d_long     = str_length < tgt_length ? d_tgt : d_str;
+  auto const lengths    = std::minmax(str_length, tgt_length);
+  if (lengths.second - lengths.first > max_distance) return max_distance + 1;
+  if (lengths.first == 0) return lengths.second;
+
+  cudf::char_utf8 short_chars[max_local_length];
+  thrust::copy(thrust::seq, d_short.begin(), d_short.end(), short_chars);
+  int32_t row[max_local_length + 1];
+  for (cudf::size_type x = 0; x <= lengths.first; ++x) {
+    row[x] = x;
+  }
+
+  int32_t y = 0;
+  for (auto itr = d_long.begin(); itr != d_long.end(); ++itr) {
+    auto const chr   = *itr;
+    auto diagonal    = row[0];
+    row[0]           = ++y;
+    auto row_minimum = row[0];
+    for (cudf::size_type x = 1; x <= lengths.first; ++x) {
+      auto const above = row[x];
+      // add 1 if characters do not match
+      auto const substitution = diagonal + static_cast<int32_t>(short_chars[x - 1] != chr);
+      row[x]                  = std::min(std::min(above, row[x - 1]) + 1, substitution);
+      diagonal                = above;
+      row_minimum             = std::min(row_minimum, row[x]);
+    }
+    if (row_minimum > max_distance) return max_distance + 1;
+  }
+  return std::min(row[lengths.first], max_distance + 1);
+}
+
 /**
  * @brief Compute the edit-distance between two strings
  *
@@ -89,6 +160,30 @@ __device__ int32_t compute_distance(cudf::string_view const& d_str,
   return static_cast<int32_t>(line0[lengths.first - 1]);
 }
 
+/**
+ * @brief Compute the edit-distance between two strings using the temporary buffer only
+ * if the shorter string has more than `max_local_length` characters.
+ *
+ * @param d_str First string
+ * @param d_tgt Second string
+ * @param buffer Temporary memory buffer of `compute_buffer_size` values
+ * @param max_distance Distances above this value are returned as `max_distance + 1`
+ * @return Edit distance value
+ */
+__device__ int32_t compute_distance(cudf::string_view const& d_str,
+                                    cudf::string_view const& d_tgt,
+                                    int16_t* buffer,
+                                    int32_t max_distance)
+{
+  auto const str_length = d_str.length();
+  auto const tgt_length = d_tgt.length();
+  if (std::min(str_length, tgt_length) <= max_local_length)
+    return compute_local_distance(d_str, d_tgt, max_distance);
+  auto const lengths = std::minmax(str_length, tgt_length);
+  if (lengths.second - lengths.first > max_distance) return max_distance + 1;
+  return std::min(compute_distance(d_str, d_tgt, buffer), max_distance + 1);
+}
+
 /**
  * @brief Compute the Levenshtein distance for each string.
  *
@@ -100,6 +195,7 @@ struct edit_distance_levenshtein_algorithm {
   cudf::column_device_view d_targets;  // against these;
   int16_t* d_buffer;                   // compute buffer for each string
   int32_t* d_results;                  // input is buffer offset; output is edit distance
+  int32_t max_distance;                // larger distances are max_distance + 1
 
   __device__ void operator()(cudf::size_type idx)
   {
@@ -110,7 +206,7 @@ struct edit_distance_levenshtein_algorithm {
       return d_targets.size() == 1 ? d_targets.element<cudf::string_view>(0)
                                    : d_targets.element<cudf::string_view>(idx);
     }();
-    d_results[idx] = compute_distance(d_str, d_tgt, d_buffer + d_results[idx]);
+    d_results[idx] = compute_distance(d_str, d_tgt, d_buffer + d_results[idx], max_distance);
   }
 };
 
@@ -119,6 +215,7 @@ struct edit_distance_matrix_levenshtein_algorithm {
   int16_t* d_buffer;                   // compute buffer for each string
   int32_t const* d_offsets;            // locate sub-buffer for each string
   int32_t* d_results;                  // edit distance values
+  int32_t max_distance;                // larger distances are max_distance + 1
 
   __device__ void operator()(cudf::size_type idx)
   {
@@ -131,7 +228,8 @@ struct edit_distance_matrix_levenshtein_algorithm {
     cudf::string_view d_str2 =
       d_strings.is_null(col) ? cudf::string_view{} : d_strings.element<cudf::string_view>(col);
     auto work_buffer       = d_buffer + d_offsets[idx - ((row + 1) * (row + 2)) / 2];
-    int32_t const distance = (row == col) ? 0 : compute_distance(d_str1, d_str2, work_buffer);
+    int32_t const distance =
+      (row == col) ? 0 : compute_distance(d_str1, d_str2, work_buffer, max_distance);
     d_results[idx]         = distance;                // top half of matrix
     d_results[col * strings_count + row] = distance;  // bottom half of matrix
   }
@@ -144,9 +242,12 @@ struct edit_distance_matrix_levenshtein_algorithm {
  */
 std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& strings,
                                             cudf::strings_column_view const& targets,
+                                            int32_t max_distance,
                                             rmm::cuda_stream_view stream,
                                             rmm::mr::device_memory_resource* mr)
 {
+  CUDF_EXPECTS(max_distance >= 0 && max_distance <= no_max_distance,
+               "max_distance must not be negative");
   cudf::size_type strings_count = strings.size();
   if (strings_count == 0) return cudf::make_empty_column(cudf::data_type{cudf::type_id::INT32});
   if (targets.size() > 1)
@@ -178,8 +279,7 @@ std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& str
                       auto d_tgt = d_targets.size() == 1
                                      ? d_targets.element<cudf::string_view>(0)
                                      : d_targets.element<cudf::string_view>(idx);
-                      // just need 3 int16's for each character of the shorter string
-                      return static_cast<int32_t>(std::min(d_str.length(), d_tgt.length()) * 3);
+                      return compute_buffer_size(d_str, d_tgt);
                     });
 
   // get the total size of the temporary compute buffer
@@ -198,7 +298,7 @@ std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& str
     rmm::exec_policy(stream),
     thrust::make_counting_iterator<cudf::size_type>(0),
     strings_count,
-    edit_distance_levenshtein_algorithm{d_strings, d_targets, d_buffer, d_results});
+    edit_distance_levenshtein_algorithm{d_strings, d_targets, d_buffer, d_results, max_distance});
   return results;
 }
 
@@ -206,9 +306,12 @@ std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& str
  * @copydoc nvtext::edit_distance_matrix
  */
 std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view const& strings,
+                                                   int32_t max_distance,
                                                    rmm::cuda_stream_view stream,
                                                    rmm::mr::device_memory_resource* mr)
 {
+  CUDF_EXPECTS(max_distance >= 0 && max_distance <= no_max_distance,
+               "max_distance must not be negative");
   cudf::size_type strings_count = strings.size();
   if (strings_count == 0) return cudf::make_empty_column(cudf::data_type{cudf::type_id::INT32});
   CUDF_EXPECTS(strings_count > 1, "the input strings must include at least 2 strings");
@@ -241,7 +344,7 @@ std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view con
         d_strings.is_null(col) ? cudf::string_view{} : d_strings.element<cudf::string_view>(col);
       if (d_str1.empty() || d_str2.empty()) return;
       // the temp size needed is 3 int16s per character of the shorter string
-      d_offsets[idx - ((row + 1) * (row + 2)) / 2] = std::min(d_str1.length(), d_str2.length()) * 3;
+      d_offsets[idx - ((row + 1) * (row + 2)) / 2] = compute_buffer_size(d_str1, d_str2);
     });
 
   // get the total size for the compute buffer
@@ -265,7 +368,8 @@ std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view con
     rmm::exec_policy(stream),
     thrust::make_counting_iterator<cudf::size_type>(0),
     strings_count * strings_count,
-    edit_distance_matrix_levenshtein_algorithm{d_strings, d_buffer, d_offsets, d_results});
+    edit_distance_matrix_levenshtein_algorithm{
+      d_strings, d_buffer, d_offsets, d_results, max_distance});
 
   // build a lists column of the results
   auto offsets_column = cudf::make_fixed_width_column(cudf::data_type{cudf::type_id::INT32},
@@ -303,7 +407,21 @@ std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& str
                                             rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::edit_distance(strings, targets, rmm::cuda_stream_default, mr);
+  return detail::edit_distance(
+    strings, targets, detail::no_max_distance, rmm::cuda_stream_default, mr);
+}
+
+/**
+ * @copydoc nvtext::edit_distance(cudf::strings_column_view const&,cudf::strings_column_view
+ * const&,int32_t,rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& strings,
+                                            cudf::strings_column_view const& targets,
+                                            int32_t max_distance,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::edit_distance(strings, targets, max_distance, rmm::cuda_stream_default, mr);
 }
 
 /**
@@ -313,7 +431,20 @@ std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view con
                                                    rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::edit_distance_matrix(strings, rmm::cuda_stream_default, mr);
+  return detail::edit_distance_matrix(
+    strings, detail::no_max_distance, rmm::cuda_stream_default, mr);
+}
+
+/**
+ * @copydoc nvtext::edit_distance_matrix(cudf::strings_column_view const&,int32_t,
+ * rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view const& strings,
+                                                   int32_t max_distance,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::edit_distance_matrix(strings, max_distance, rmm::cuda_stream_default, mr);
 }
 
 }  // namespace nvtext
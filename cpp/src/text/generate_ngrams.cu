@@ -14,17 +14,23 @@
  * limitations under the License.
  */
 
+#include <hash/concurrent_unordered_map.cuh>
+#include <hash/helper_functions.cuh>
+
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy_if.cuh>
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
 
@@ -33,8 +39,14 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/transform_scan.h>
 
+#include <limits>
+
 namespace nvtext {
 namespace detail {
 namespace {
@@ -157,6 +169,32 @@ std::unique_ptr<cudf::column> generate_ngrams(cudf::strings_column_view const& s
 namespace detail {
 namespace {
 
+/**
+ * @brief Returns the offsets of the character ngrams of each string within all the ngrams.
+ *
+ * Null strings and strings with fewer than `ngrams` characters have no ngrams.
+ */
+rmm::device_uvector<int32_t> character_ngram_offsets(cudf::column_device_view const& d_strings,
+                                                     cudf::size_type ngrams,
+                                                     rmm::cuda_stream_view stream)
+{
+  auto const strings_count = d_strings.size();
+  rmm::device_uvector<int32_t> ngram_offsets(strings_count + 1, stream);
+  thrust::transform_exclusive_scan(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(strings_count + 1),
+    ngram_offsets.begin(),
+    [d_strings, strings_count, ngrams] __device__(auto idx) {
+      if (d_strings.is_null(idx) || (idx == strings_count)) return 0;
+      auto const length = d_strings.element<cudf::string_view>(idx).length();
+      return std::max(0, static_cast<int32_t>(length + 1 - ngrams));
+    },
+    cudf::size_type{0},
+    thrust::plus<cudf::size_type>());
+  return ngram_offsets;
+}
+
 struct character_ngram_generator_fn {
   cudf::column_device_view const d_strings;
   cudf::size_type ngrams;
@@ -203,19 +241,7 @@ std::unique_ptr<cudf::column> generate_character_ngrams(cudf::strings_column_vie
   auto const d_strings      = *strings_column;
 
   // create a vector of ngram offsets for each string
-  rmm::device_uvector<int32_t> ngram_offsets(strings_count + 1, stream);
-  thrust::transform_exclusive_scan(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator<cudf::size_type>(0),
-    thrust::make_counting_iterator<cudf::size_type>(strings_count + 1),
-    ngram_offsets.begin(),
-    [d_strings, strings_count, ngrams] __device__(auto idx) {
-      if (d_strings.is_null(idx) || (idx == strings_count)) return 0;
-      auto const length = d_strings.element<cudf::string_view>(idx).length();
-      return std::max(0, static_cast<int32_t>(length + 1 - ngrams));
-    },
-    cudf::size_type{0},
-    thrust::plus<cudf::size_type>());
+  auto ngram_offsets = character_ngram_offsets(d_strings, ngrams, stream);
 
   // total ngrams count is the last entry
   cudf::size_type const total_ngrams = ngram_offsets.back_element(stream);
@@ -260,6 +286,179 @@ std::unique_ptr<cudf::column> generate_character_ngrams(cudf::strings_column_vie
                                    mr);
 }
 
+namespace {
+
+/**
+ * @brief Calls `fn` with the hash of each of the `ngram_count` character ngrams of a string.
+ */
+template <typename Function>
+__device__ void for_each_character_ngram_hash(cudf::string_view const& d_str,
+                                              cudf::size_type ngrams,
+                                              cudf::size_type ngram_count,
+                                              Function fn)
+{
+  if (ngram_count == 0) return;
+  cudf::detail::MurmurHash3_32<cudf::string_view> const hasher;
+  auto begin = d_str.begin();
+  auto end   = begin + ngrams;
+  for (cudf::size_type n = 0; n < ngram_count; ++n, ++begin, ++end) {
+    auto const offset = begin.byte_offset();
+    fn(hasher(cudf::string_view(d_str.data() + offset, end.byte_offset() - offset)));
+  }
+}
+
+struct character_ngram_hash_fn {
+  cudf::column_device_view const d_strings;
+  cudf::size_type ngrams;
+  int32_t const* d_ngram_offsets;
+  uint32_t* d_hashes;
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    if (d_strings.is_null(idx)) return;
+    auto const ngram_offset = d_ngram_offsets[idx];
+    auto d_output           = d_hashes + ngram_offset;
+    for_each_character_ngram_hash(d_strings.element<cudf::string_view>(idx),
+                                  ngrams,
+                                  d_ngram_offsets[idx + 1] - ngram_offset,
+                                  [&d_output](uint32_t hash) { *d_output++ = hash; });
+  }
+};
+
+/**
+ * @brief Adds 1 to the count of the hash of each character ngram of a string.
+ */
+template <typename Map>
+struct count_character_ngram_hashes_fn {
+  cudf::column_device_view const d_strings;
+  cudf::size_type ngrams;
+  int32_t const* d_ngram_offsets;
+  Map map;
+
+  __device__ void operator()(cudf::size_type idx)
+  {
+    if (d_strings.is_null(idx)) return;
+    for_each_character_ngram_hash(
+      d_strings.element<cudf::string_view>(idx),
+      ngrams,
+      d_ngram_offsets[idx + 1] - d_ngram_offsets[idx],
+      [this](uint32_t hash) {
+        auto const result = map.insert(thrust::make_pair(static_cast<uint64_t>(hash), 0));
+        atomicAdd(&(result.first->second), 1);
+      });
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<cudf::column> hash_character_ngrams(cudf::strings_column_view const& strings,
+                                                    cudf::size_type ngrams,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(ngrams > 1, "Parameter ngrams should be an integer value of 2 or greater");
+
+  auto const strings_count = strings.size();
+  if (strings_count == 0) return cudf::make_empty_column(cudf::data_type{cudf::type_id::LIST});
+
+  auto const strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  auto const d_strings      = *strings_column;
+
+  // the ngram offsets of each string are the offsets of its list of hashes
+  auto ngram_offsets = character_ngram_offsets(d_strings, ngrams, stream);
+  cudf::size_type const total_ngrams = ngram_offsets.back_element(stream);
+
+  auto hashes = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                          total_ngrams,
+                                          cudf::mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count,
+                     character_ngram_hash_fn{d_strings,
+                                             ngrams,
+                                             ngram_offsets.data(),
+                                             hashes->mutable_view().data<uint32_t>()});
+
+  auto offsets_column = std::make_unique<cudf::column>(
+    cudf::data_type{cudf::type_id::INT32}, strings_count + 1, ngram_offsets.release());
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets_column),
+                                 std::move(hashes),
+                                 strings.null_count(),
+                                 cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
+std::unique_ptr<cudf::table> count_character_ngrams(cudf::strings_column_view const& strings,
+                                                    cudf::size_type ngrams,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(ngrams > 1, "Parameter ngrams should be an integer value of 2 or greater");
+
+  auto const strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  auto const d_strings      = *strings_column;
+  auto const ngram_offsets  = character_ngram_offsets(d_strings, ngrams, stream);
+  cudf::size_type const total_ngrams = ngram_offsets.back_element(stream);
+  if (total_ngrams == 0) {
+    std::vector<std::unique_ptr<cudf::column>> columns;
+    columns.push_back(cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}));
+    columns.push_back(cudf::make_empty_column(cudf::data_type{cudf::type_id::INT32}));
+    return std::make_unique<cudf::table>(std::move(columns));
+  }
+
+  // the hashes are 32 bits so a 64-bit key leaves the unused key free for them
+  using map_type = concurrent_unordered_map<uint64_t, cudf::size_type>;
+  auto const map = map_type::create(compute_hash_table_size(total_ngrams),
+                                    stream,
+                                    std::numeric_limits<cudf::size_type>::max(),
+                                    std::numeric_limits<uint64_t>::max());
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    strings.size(),
+    count_character_ngram_hashes_fn<map_type>{d_strings, ngrams, ngram_offsets.data(), *map});
+
+  // copy the used entries of the map into the output columns
+  auto const d_entries = map->data();
+  auto const capacity  = static_cast<cudf::size_type>(map->capacity());
+  auto const is_used   = [unused_key = map->get_unused_key()] __device__(auto const& entry) {
+    return entry.first != unused_key;
+  };
+  auto const distinct_count = static_cast<cudf::size_type>(
+    thrust::count_if(rmm::exec_policy(stream), d_entries, d_entries + capacity, is_used));
+
+  auto hashes = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                          distinct_count,
+                                          cudf::mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+  auto counts = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                          distinct_count,
+                                          cudf::mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+  auto const entries = thrust::make_transform_iterator(d_entries, [] __device__(auto const& entry) {
+    return thrust::make_tuple(static_cast<uint32_t>(entry.first), entry.second);
+  });
+  thrust::copy_if(rmm::exec_policy(stream),
+                  entries,
+                  entries + capacity,
+                  d_entries,
+                  thrust::make_zip_iterator(
+                    thrust::make_tuple(hashes->mutable_view().data<uint32_t>(),
+                                       counts->mutable_view().data<cudf::size_type>())),
+                  is_used);
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(std::move(hashes));
+  columns.push_back(std::move(counts));
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> generate_character_ngrams(cudf::strings_column_view const& strings,
@@ -270,4 +469,20 @@ std::unique_ptr<cudf::column> generate_character_ngrams(cudf::strings_column_vie
   return detail::generate_character_ngrams(strings, ngrams, rmm::cuda_stream_default, mr);
 }
 
+std::unique_ptr<cudf::column> hash_character_ngrams(cudf::strings_column_view const& strings,
+                                                    cudf::size_type ngrams,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_character_ngrams(strings, ngrams, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<cudf::table> count_character_ngrams(cudf::strings_column_view const& strings,
+                                                    cudf::size_type ngrams,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::count_character_ngrams(strings, ngrams, rmm::cuda_stream_default, mr);
+}
+
 }  // namespace nvtext
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <text/utilities/tokenize_ops.cuh>
+
+#include <nvtext/minhash.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <limits>
+
+namespace nvtext {
+namespace detail {
+namespace {
+
+/**
+ * @brief Calls `fn(begin, end)` with the byte positions of each ngram of `width` characters.
+ */
+template <typename Function>
+__device__ void for_each_character_ngram(cudf::string_view const& d_str,
+                                         cudf::size_type width,
+                                         Function fn)
+{
+  auto const data  = d_str.data();
+  auto const bytes = d_str.size_bytes();
+  auto const next  = [data, bytes](cudf::size_type pos) {
+    auto const chr_width =
+      cudf::strings::detail::bytes_in_utf8_byte(static_cast<uint8_t>(data[pos]));
+    return std::min(pos + std::max(chr_width, 1), bytes);
+  };
+
+  cudf::size_type begin = 0;
+  cudf::size_type end   = 0;
+  for (cudf::size_type count = 0; count < width && end < bytes; ++count) {
+    end = next(end);
+  }
+  fn(begin, end);
+  // slide the ngram one character at a time
+  while (end < bytes) {
+    begin = next(begin);
+    end   = next(end);
+    fn(begin, end);
+  }
+}
+
+/**
+ * @brief Calls `fn(begin, end)` with the byte positions of each ngram of `width` words.
+ */
+template <typename Function>
+__device__ void for_each_word_ngram(cudf::string_view const& d_str,
+                                    cudf::size_type width,
+                                    Function fn)
+{
+  characters_tokenizer first(d_str);
+  characters_tokenizer last(d_str);
+  if (!first.next_token()) {
+    fn(0, 0);  // no words
+    return;
+  }
+  last.next_token();
+  auto end = last.token_byte_positions().second;
+  for (cudf::size_type count = 1; count < width && last.next_token(); ++count) {
+    end = last.token_byte_positions().second;
+  }
+  fn(first.token_byte_positions().first, end);
+  // slide the ngram one word at a time
+  while (last.next_token()) {
+    first.next_token();
+    fn(first.token_byte_positions().first, last.token_byte_positions().second);
+  }
+}
+
+/**
+ * @brief Computes one value of the signature of a string.
+ *
+ * Each thread hashes all the ngrams of a string with one seed and keeps the minimum.
+ */
+template <bool word_ngrams>
+struct minhash_fn {
+  cudf::column_device_view const d_strings;
+  uint32_t const* d_seeds;
+  cudf::size_type num_hashes;
+  cudf::size_type width;
+  int32_t const* d_offsets;
+  uint32_t* d_output;
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    auto const row = idx / num_hashes;
+    if (d_strings.is_null(row)) return;
+    auto const seed_idx = idx % num_hashes;
+    auto const d_str    = d_strings.element<cudf::string_view>(row);
+    cudf::detail::MurmurHash3_32<cudf::string_view> const hasher(d_seeds[seed_idx]);
+
+    auto min_hash      = std::numeric_limits<uint32_t>::max();
+    auto const hash_fn = [&](cudf::size_type begin, cudf::size_type end) {
+      auto const hash = hasher(cudf::string_view(d_str.data() + begin, end - begin));
+      min_hash        = std::min(min_hash, hash);
+    };
+    if constexpr (word_ngrams) {
+      for_each_word_ngram(d_str, width, hash_fn);
+    } else {
+      for_each_character_ngram(d_str, width, hash_fn);
+    }
+    d_output[d_offsets[row] + seed_idx] = min_hash;
+  }
+};
+
+template <bool word_ngrams>
+std::unique_ptr<cudf::column> compute_minhash(cudf::strings_column_view const& strings,
+                                              cudf::column_view const& seeds,
+                                              cudf::size_type width,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(width >= 1, "Parameter width should be an integer value of 1 or greater");
+  CUDF_EXPECTS(!seeds.is_empty(), "Parameter seeds cannot be empty");
+  CUDF_EXPECTS(seeds.type().id() == cudf::type_id::UINT32 && !seeds.has_nulls(),
+               "Parameter seeds must be UINT32 without nulls");
+  auto const strings_count = strings.size();
+  if (strings_count == 0) return cudf::make_empty_column(cudf::data_type{cudf::type_id::LIST});
+
+  auto const d_strings  = cudf::column_device_view::create(strings.parent(), stream);
+  auto const num_hashes = seeds.size();
+
+  // null rows have no signature
+  auto sizes_itr = cudf::detail::make_counting_transform_iterator(
+    0, [d_strings = *d_strings, num_hashes] __device__(cudf::size_type idx) {
+      return d_strings.is_null(idx) ? 0 : num_hashes;
+    });
+  auto offsets_column = cudf::strings::detail::make_offsets_child_column(
+    sizes_itr, sizes_itr + strings_count, stream, mr);
+  auto const d_offsets = offsets_column->view().data<int32_t>();
+
+  auto hashes = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                          (strings_count - strings.null_count()) * num_hashes,
+                                          cudf::mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count * num_hashes,
+                     minhash_fn<word_ngrams>{*d_strings,
+                                             seeds.data<uint32_t>(),
+                                             num_hashes,
+                                             width,
+                                             d_offsets,
+                                             hashes->mutable_view().data<uint32_t>()});
+
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets_column),
+                                 std::move(hashes),
+                                 strings.null_count(),
+                                 cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
+}  // namespace
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& strings,
+                                      cudf::column_view const& seeds,
+                                      cudf::size_type width,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  return compute_minhash<false>(strings, seeds, width, stream, mr);
+}
+
+std::unique_ptr<cudf::column> word_minhash(cudf::strings_column_view const& strings,
+                                           cudf::column_view const& seeds,
+                                           cudf::size_type width,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  return compute_minhash<true>(strings, seeds, width, stream, mr);
+}
+
+}  // namespace detail
+
+// external APIs
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& strings,
+                                      cudf::column_view const& seeds,
+                                      cudf::size_type width,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash(strings, seeds, width, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<cudf::column> word_minhash(cudf::strings_column_view const& strings,
+                                           cudf::column_view const& seeds,
+                                           cudf::size_type width,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::word_minhash(strings, seeds, width, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace nvtext
@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <strings/utf8.cuh>
+#include <text/subword/detail/hash_utils.cuh>
+
+#include <nvtext/bpe_tokenize.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+namespace nvtext {
+namespace detail {
+namespace {
+
+/**
+ * @brief Adds the code points of the UTF-8 characters in `[begin, end)` to the sdbm hash.
+ *
+ * This matches the hash of the code points used for the vocabulary table.
+ */
+__host__ __device__ uint64_t sdbm_hash_utf8(char const* begin,
+                                            char const* end,
+                                            uint64_t hash_value = 0)
+{
+  while (begin < end) {
+    cudf::char_utf8 chr  = 0;
+    auto const chr_width = cudf::strings::detail::to_char_utf8(begin, chr);
+    hash_value = sdbm_hash_step(hash_value, cudf::strings::detail::utf8_to_codepoint(chr));
+    begin += chr_width > 0 ? chr_width : 1;
+  }
+  return hash_value;
+}
+
+/**
+ * @brief Merges the characters of each word of a string into its byte-pair-encoding symbols
+ * and counts the symbols.
+ *
+ * The symbols are recorded in `d_ends`: at the position of the first byte of each symbol it
+ * holds the position after the symbol, relative to the start of the string.
+ */
+struct bpe_merge_fn {
+  cudf::column_device_view const d_strings;
+  char const* d_chars;  // chars of all the strings
+  uint64_t const* d_keys;
+  int32_t const* d_ranks;
+  cudf::size_type keys_count;
+  cudf::size_type* d_ends;
+  cudf::size_type* d_counts;
+
+  /**
+   * @brief Returns the rank of the merge pair of the symbols `[begin, middle)` and
+   * `[middle, end)` or the maximum rank if they are not a merge pair.
+   */
+  __device__ int32_t merge_rank(char const* data,
+                                cudf::size_type begin,
+                                cudf::size_type middle,
+                                cudf::size_type end) const
+  {
+    auto key = sdbm_hash_utf8(data + begin, data + middle);
+    key      = sdbm_hash_step(key, ' ');
+    key      = sdbm_hash_utf8(data + middle, data + end, key);
+
+    auto const keys_end = d_keys + keys_count;
+    auto const itr      = thrust::lower_bound(thrust::seq, d_keys, keys_end, key);
+    return (itr != keys_end && *itr == key) ? d_ranks[thrust::distance(d_keys, itr)]
+                                            : std::numeric_limits<int32_t>::max();
+  }
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    if (d_strings.is_null(idx)) {
+      d_counts[idx] = 0;
+      return;
+    }
+    auto const d_str = d_strings.element<cudf::string_view>(idx);
+    auto const data  = d_str.data();
+    auto const bytes = d_str.size_bytes();
+    auto const ends  = d_ends + thrust::distance(d_chars, data);
+
+    cudf::size_type count = 0;
+    cudf::size_type pos   = 0;
+    while (pos < bytes) {
+      if (data[pos] == ' ') {
+        ++pos;
+        continue;
+      }
+      auto word_end = pos;
+      while (word_end < bytes && data[word_end] != ' ') {
+        ++word_end;
+      }
+      // each character starts as its own symbol
+      for (auto itr = pos; itr < word_end; itr = ends[itr]) {
+        auto const chr_width =
+          cudf::strings::detail::bytes_in_utf8_byte(static_cast<uint8_t>(data[itr]));
+        ends[itr] = std::min(itr + std::max(chr_width, 1), word_end);
+      }
+      // merge the adjacent pair with the lowest rank until no adjacent pair can be merged
+      while (true) {
+        auto min_rank = std::numeric_limits<int32_t>::max();
+        auto min_pos  = word_end;
+        for (auto itr = pos; ends[itr] < word_end; itr = ends[itr]) {
+          auto const rank = merge_rank(data, itr, ends[itr], ends[ends[itr]]);
+          if (rank < min_rank) {
+            min_rank = rank;
+            min_pos  = itr;
+          }
+        }
+        if (min_pos == word_end) break;
+        ends[min_pos] = ends[ends[min_pos]];
+      }
+      for (auto itr = pos; itr < word_end; itr = ends[itr]) {
+        ++count;
+      }
+      pos = word_end;
+    }
+    d_counts[idx] = count;
+  }
+};
+
+/**
+ * @brief Writes the token-id of each symbol recorded by `bpe_merge_fn`.
+ */
+struct bpe_token_ids_fn {
+  cudf::column_device_view const d_strings;
+  char const* d_chars;  // chars of all the strings
+  cudf::size_type const* d_ends;
+  int32_t const* d_offsets;
+  uint32_t outer_hash_a;
+  uint32_t outer_hash_b;
+  uint16_t num_bins;
+  uint64_t const* hash_table;
+  uint64_t const* bin_coefficients;
+  uint16_t const* bin_offsets;
+  uint32_t unknown_token_id;
+  uint32_t* d_token_ids;
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    if (d_strings.is_null(idx)) return;
+    auto const d_str = d_strings.element<cudf::string_view>(idx);
+    auto const data  = d_str.data();
+    auto const bytes = d_str.size_bytes();
+    auto const ends  = d_ends + thrust::distance(d_chars, data);
+    auto d_output    = d_token_ids + d_offsets[idx];
+
+    cudf::size_type pos = 0;
+    while (pos < bytes) {
+      if (data[pos] == ' ') {
+        ++pos;
+        continue;
+      }
+      // symbols never include a space so they end at the end of the word
+      auto const key = sdbm_hash_utf8(data + pos, data + ends[pos]);
+      auto const id  = retrieve(
+        key, outer_hash_a, outer_hash_b, num_bins, hash_table, bin_coefficients, bin_offsets);
+      *d_output++ = id >= 0 ? static_cast<uint32_t>(id) : unknown_token_id;
+      pos         = ends[pos];
+    }
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<bpe_merge_pairs> load_merge_pairs_file(std::string const& filename_merges,
+                                                       rmm::cuda_stream_view stream,
+                                                       rmm::mr::device_memory_resource* mr)
+{
+  std::ifstream merges_file(filename_merges);
+  CUDF_EXPECTS(merges_file.good(), "Could not open " + filename_merges);
+
+  // the hash of each merge pair line with its rank
+  std::vector<std::pair<uint64_t, int32_t>> pairs;
+  std::string line;
+  while (std::getline(merges_file, line)) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    if (line.empty() || line.front() == '#') continue;
+    CUDF_EXPECTS(line.find(' ') != line.npos, "invalid merges file format: " + line);
+    auto const rank = static_cast<int32_t>(pairs.size());
+    pairs.emplace_back(sdbm_hash_utf8(line.data(), line.data() + line.size()), rank);
+  }
+  // sort by hash and keep the lowest rank of duplicate pairs
+  std::sort(pairs.begin(), pairs.end());
+  pairs.erase(std::unique(pairs.begin(),
+                          pairs.end(),
+                          [](auto const& lhs, auto const& rhs) { return lhs.first == rhs.first; }),
+              pairs.end());
+
+  std::vector<uint64_t> keys(pairs.size());
+  std::vector<int32_t> ranks(pairs.size());
+  std::transform(pairs.begin(), pairs.end(), keys.begin(), [](auto const& p) { return p.first; });
+  std::transform(pairs.begin(), pairs.end(), ranks.begin(), [](auto const& p) { return p.second; });
+
+  bpe_merge_pairs result;
+  result.keys = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT64},
+                                          keys.size(),
+                                          cudf::mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+  CUDA_TRY(cudaMemcpyAsync(result.keys->mutable_view().data<uint64_t>(),
+                           keys.data(),
+                           keys.size() * sizeof(uint64_t),
+                           cudaMemcpyHostToDevice,
+                           stream.value()));
+
+  result.ranks = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                           ranks.size(),
+                                           cudf::mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  CUDA_TRY(cudaMemcpyAsync(result.ranks->mutable_view().data<int32_t>(),
+                           ranks.data(),
+                           ranks.size() * sizeof(int32_t),
+                           cudaMemcpyHostToDevice,
+                           stream.value()));
+  stream.synchronize();
+
+  return std::make_unique<bpe_merge_pairs>(std::move(result));
+}
+
+std::unique_ptr<cudf::column> byte_pair_encoding(cudf::strings_column_view const& strings,
+                                                 bpe_merge_pairs const& merge_pairs,
+                                                 hashed_vocabulary const& vocabulary_table,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  auto const strings_count = strings.size();
+  if (strings_count == 0) return cudf::make_empty_column(cudf::data_type{cudf::type_id::LIST});
+
+  auto const d_strings = cudf::column_device_view::create(strings.parent(), stream);
+  auto const d_chars   = strings.chars().data<char>();
+
+  // merge the characters of each word into symbols and count the symbols of each string
+  rmm::device_uvector<cudf::size_type> ends(strings.chars_size(), stream);
+  rmm::device_uvector<cudf::size_type> counts(strings_count, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count,
+                     bpe_merge_fn{*d_strings,
+                                  d_chars,
+                                  merge_pairs.keys->view().data<uint64_t>(),
+                                  merge_pairs.ranks->view().data<int32_t>(),
+                                  merge_pairs.keys->size(),
+                                  ends.data(),
+                                  counts.data()});
+
+  auto offsets_column = cudf::strings::detail::make_offsets_child_column(
+    counts.begin(), counts.end(), stream, mr);
+  auto const d_offsets = offsets_column->view().data<int32_t>();
+
+  auto const total_tokens =
+    cudf::detail::get_value<int32_t>(offsets_column->view(), strings_count, stream);
+
+  // look up the token-id of each symbol
+  auto token_ids = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                             total_tokens,
+                                             cudf::mask_state::UNALLOCATED,
+                                             stream,
+                                             mr);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    strings_count,
+    bpe_token_ids_fn{*d_strings,
+                     d_chars,
+                     ends.data(),
+                     d_offsets,
+                     vocabulary_table.outer_hash_a,
+                     vocabulary_table.outer_hash_b,
+                     vocabulary_table.num_bins,
+                     vocabulary_table.table->view().data<uint64_t>(),
+                     vocabulary_table.bin_coefficients->view().data<uint64_t>(),
+                     vocabulary_table.bin_offsets->view().data<uint16_t>(),
+                     vocabulary_table.unknown_token_id,
+                     token_ids->mutable_view().data<uint32_t>()});
+
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets_column),
+                                 std::move(token_ids),
+                                 strings.null_count(),
+                                 cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<bpe_merge_pairs> load_merge_pairs_file(std::string const& filename_merges,
+                                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::load_merge_pairs_file(filename_merges, rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<cudf::column> byte_pair_encoding(cudf::strings_column_view const& strings,
+                                                 bpe_merge_pairs const& merge_pairs,
+                                                 hashed_vocabulary const& vocabulary_table,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::byte_pair_encoding(
+    strings, merge_pairs, vocabulary_table, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace nvtext
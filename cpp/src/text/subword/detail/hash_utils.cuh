@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -54,6 +54,20 @@ __device__ uint64_t mul_mod_48(uint64_t num_48bit, uint64_t num)
   return result;
 }
 
+/**
+ * @brief Adds one value to the sdbm hash `hash_value`.
+ *
+ * @param hash_value The hash of the values before `value`
+ * @param value Next value to hash
+ * @return The hash of the values followed by `value`
+ */
+__host__ __device__ inline uint64_t sdbm_hash_step(uint64_t hash_value, uint32_t value)
+{
+  constexpr uint64_t mask = (1ULL << 48) - 1;
+  hash_value              = ((hash_value << 6) + (hash_value << 16) - hash_value) & mask;
+  return (hash_value + (value & mask)) & mask;
+}
+
 /**
  * @brief Computes the sdbm hash for the sequence starting at sequence_start up to length sequences.
  *
@@ -72,12 +86,10 @@ __device__ uint64_t sdbm_hash(uint32_t const* sequence_start,
   // This expression computes h_{i} = (65599*h{i-1} + new_val) mod 2^48 and was obtained from here:
   // http://www.cse.yorku.ca/~oz/hash.html
 
-  constexpr uint64_t mask = (1ULL << 48) - 1;
-  uint64_t hash_value     = start_value;
+  uint64_t hash_value = start_value;
 
   for (int i = 0; i < length; ++i) {
-    hash_value = ((hash_value << 6) + (hash_value << 16) - hash_value) & mask;
-    hash_value = (hash_value + (sequence_start[i] & mask)) & mask;
+    hash_value = sdbm_hash_step(hash_value, sequence_start[i]);
   }
 
   return hash_value;
@@ -121,44 +121,40 @@ __global__ void kernel_compute_tensor_metadata(
   }
 }
 
-}  // namespace
+/**
+ * @brief Token-ids of the strings and the output tensor rows they fill.
+ */
+struct tokenized_rows {
+  uvector_pair tokens;                                  // token-ids and their offsets per string
+  rmm::device_uvector<uint32_t> row2tensor;             // string of each output row
+  rmm::device_uvector<uint32_t> row2row_within_tensor;  // row of each output row in its string
+};
 
-tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
-                                  hashed_vocabulary const& vocab_table,
-                                  uint32_t max_sequence_length,
-                                  uint32_t stride,
-                                  bool do_lower_case,
-                                  bool do_truncate,
-                                  uint32_t max_rows_tensor,
-                                  rmm::cuda_stream_view stream,
-                                  rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Tokenizes the strings and maps each output tensor row to its string.
+ */
+tokenized_rows tokenize_rows(cudf::strings_column_view const& strings,
+                             hashed_vocabulary const& vocab_table,
+                             uint32_t max_sequence_length,
+                             uint32_t stride,
+                             bool do_lower_case,
+                             bool do_truncate,
+                             uint32_t max_rows_tensor,
+                             rmm::cuda_stream_view stream)
 {
-  CUDF_EXPECTS(stride <= max_sequence_length,
-               "stride must be less than or equal to max_sequence_length");
-  CUDF_EXPECTS(max_sequence_length * max_rows_tensor <
-                 static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
-               "max_sequence_length x max_rows_tensor is too large for cudf output column size");
   auto const strings_count = strings.size();
-  if (strings_count == 0 || strings.chars_size() == 0)
-    return tokenizer_result{0,
-                            max_sequence_length,
-                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
-                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
-                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32})};
-
-  auto const offsets   = strings.offsets();
-  auto const d_offsets = offsets.data<uint32_t>() + strings.offset();
-  auto const offset    = cudf::detail::get_value<int32_t>(offsets, strings.offset(), stream);
-  auto const d_chars   = strings.chars().data<char>() + offset;
+  auto const offsets       = strings.offsets();
+  auto const d_offsets     = offsets.data<uint32_t>() + strings.offset();
+  auto const offset        = cudf::detail::get_value<int32_t>(offsets, strings.offset(), stream);
+  auto const d_chars       = strings.chars().data<char>() + offset;
 
   // Create tokenizer
   wordpiece_tokenizer tokenizer(
     vocab_table, max_rows_tensor, max_sequence_length, stride, do_truncate, do_lower_case, stream);
   // Run tokenizer
-  auto const tokens = tokenizer.tokenize(d_chars, d_offsets, strings_count, stream);
+  auto tokens = tokenizer.tokenize(d_chars, d_offsets, strings_count, stream);
   // assign output components
-  uint32_t const* device_token_ids = tokens.first->data();
-  uint32_t const* device_offsets   = tokens.second->data();
+  uint32_t const* device_offsets = tokens.second->data();
 
   // Format output from tokenizer
   // Each string can create 1 or more tensor entries.
@@ -200,6 +196,79 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
       }
     });
 
+  return tokenized_rows{std::move(tokens), std::move(row2tensor), std::move(row2row_within_tensor)};
+}
+
+/**
+ * @brief Writes the final tensor of token-ids, the attention mask, and the metadata of the rows.
+ */
+void write_tensor(tokenized_rows const& rows,
+                  uint32_t max_sequence_length,
+                  uint32_t stride,
+                  bool do_truncate,
+                  uint32_t* tensor_token_ids,
+                  uint32_t* tensor_attention_mask,
+                  uint32_t* tensor_metadata,
+                  rmm::cuda_stream_view stream)
+{
+  auto const nrows_tensor_token_ids = static_cast<uint32_t>(rows.row2tensor.size());
+  if (nrows_tensor_token_ids == 0) return;
+
+  // compute final-tensor, mask, and metadata
+  constexpr int block_size = 256;
+  cudf::detail::grid_1d const grid{
+    static_cast<cudf::size_type>(nrows_tensor_token_ids * max_sequence_length), block_size};
+  kernel_compute_tensor_metadata<<<grid.num_blocks,
+                                   grid.num_threads_per_block,
+                                   0,
+                                   stream.value()>>>(rows.tokens.first->data(),
+                                                     rows.tokens.second->data(),
+                                                     rows.row2tensor.data(),
+                                                     rows.row2row_within_tensor.data(),
+                                                     max_sequence_length,
+                                                     nrows_tensor_token_ids,
+                                                     stride,
+                                                     do_truncate,
+                                                     tensor_token_ids,
+                                                     tensor_attention_mask,
+                                                     tensor_metadata);
+}
+
+}  // namespace
+
+tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
+                                  hashed_vocabulary const& vocab_table,
+                                  uint32_t max_sequence_length,
+                                  uint32_t stride,
+                                  bool do_lower_case,
+                                  bool do_truncate,
+                                  uint32_t max_rows_tensor,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(stride <= max_sequence_length,
+               "stride must be less than or equal to max_sequence_length");
+  CUDF_EXPECTS(max_sequence_length * max_rows_tensor <
+                 static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
+               "max_sequence_length x max_rows_tensor is too large for cudf output column size");
+  auto const strings_count = strings.size();
+  if (strings_count == 0 || strings.chars_size() == 0)
+    return tokenizer_result{0,
+                            max_sequence_length,
+                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
+                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
+                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32})};
+
+  auto const rows = tokenize_rows(strings,
+                                  vocab_table,
+                                  max_sequence_length,
+                                  stride,
+                                  do_lower_case,
+                                  do_truncate,
+                                  max_rows_tensor,
+                                  stream);
+  auto const nrows_tensor_token_ids = static_cast<uint32_t>(rows.row2tensor.size());
+
   // create output data columns
   auto tensor_token_ids = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
                                                     nrows_tensor_token_ids * max_sequence_length,
@@ -218,25 +287,14 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                                                    stream,
                                                    mr);
 
-  // compute final-tensor, mask, and metadata
-  constexpr int block_size = 256;
-  cudf::detail::grid_1d const grid{
-    static_cast<cudf::size_type>(nrows_tensor_token_ids * max_sequence_length), block_size};
-  kernel_compute_tensor_metadata<<<grid.num_blocks,
-                                   grid.num_threads_per_block,
-                                   0,
-                                   stream.value()>>>(
-    device_token_ids,
-    device_offsets,
-    d_row2tensor,
-    d_row2row_within_tensor,
-    max_sequence_length,
-    nrows_tensor_token_ids,
-    stride,
-    do_truncate,
-    tensor_token_ids->mutable_view().data<uint32_t>(),
-    tensor_attention_mask->mutable_view().data<uint32_t>(),
-    tensor_metadata->mutable_view().data<uint32_t>());
+  write_tensor(rows,
+               max_sequence_length,
+               stride,
+               do_truncate,
+               tensor_token_ids->mutable_view().data<uint32_t>(),
+               tensor_attention_mask->mutable_view().data<uint32_t>(),
+               tensor_metadata->mutable_view().data<uint32_t>(),
+               stream);
 
   return tokenizer_result{nrows_tensor_token_ids,
                           max_sequence_length,
@@ -245,6 +303,56 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                           std::move(tensor_metadata)};
 }
 
+uint32_t subword_tokenize(cudf::strings_column_view const& strings,
+                          hashed_vocabulary const& vocab_table,
+                          uint32_t max_sequence_length,
+                          uint32_t stride,
+                          bool do_lower_case,
+                          bool do_truncate,
+                          cudf::mutable_column_view& tensor_token_ids,
+                          cudf::mutable_column_view& tensor_attention_mask,
+                          cudf::mutable_column_view& tensor_metadata,
+                          rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(stride <= max_sequence_length,
+               "stride must be less than or equal to max_sequence_length");
+  auto const is_uint32 = [](cudf::mutable_column_view const& col) {
+    return col.type().id() == cudf::type_id::UINT32 && !col.nullable();
+  };
+  CUDF_EXPECTS(is_uint32(tensor_token_ids) && is_uint32(tensor_attention_mask) &&
+                 is_uint32(tensor_metadata),
+               "Output columns must be UINT32 without a null mask");
+  // the output columns hold as many rows as the metadata column
+  auto const max_rows_tensor = static_cast<uint32_t>(tensor_metadata.size() / 3);
+  CUDF_EXPECTS(static_cast<std::size_t>(tensor_token_ids.size()) ==
+                   std::size_t{max_rows_tensor} * max_sequence_length &&
+                 tensor_attention_mask.size() == tensor_token_ids.size(),
+               "Output column sizes do not match the number of rows of the metadata column");
+  if (strings.size() == 0 || strings.chars_size() == 0) return 0;
+
+  auto const rows = tokenize_rows(strings,
+                                  vocab_table,
+                                  max_sequence_length,
+                                  stride,
+                                  do_lower_case,
+                                  do_truncate,
+                                  max_rows_tensor,
+                                  stream);
+  auto const nrows_tensor_token_ids = static_cast<uint32_t>(rows.row2tensor.size());
+  CUDF_EXPECTS(nrows_tensor_token_ids <= max_rows_tensor,
+               "Output columns are too small for the tokens of the strings");
+
+  write_tensor(rows,
+               max_sequence_length,
+               stride,
+               do_truncate,
+               tensor_token_ids.data<uint32_t>(),
+               tensor_attention_mask.data<uint32_t>(),
+               tensor_metadata.data<uint32_t>(),
+               stream);
+  return nrows_tensor_token_ids;
+}
+
 }  // namespace detail
 
 tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
@@ -290,4 +398,27 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                                   mr);
 }
 
+uint32_t subword_tokenize(cudf::strings_column_view const& strings,
+                          hashed_vocabulary const& vocabulary_table,
+                          uint32_t max_sequence_length,
+                          uint32_t stride,
+                          bool do_lower_case,
+                          bool do_truncate,
+                          cudf::mutable_column_view& tensor_token_ids,
+                          cudf::mutable_column_view& tensor_attention_mask,
+                          cudf::mutable_column_view& tensor_metadata)
+{
+  CUDF_FUNC_RANGE();
+  return detail::subword_tokenize(strings,
+                                  vocabulary_table,
+                                  max_sequence_length,
+                                  stride,
+                                  do_lower_case,
+                                  do_truncate,
+                                  tensor_token_ids,
+                                  tensor_attention_mask,
+                                  tensor_metadata,
+                                  rmm::cuda_stream_default);
+}
+
 }  // namespace nvtext
@@ -17,18 +17,27 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/optional.h>
+#include <thrust/scan.h>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 
@@ -528,6 +537,52 @@ std::unique_ptr<column> row_bit_count(table_view const& t,
   return output;
 }
 
+/**
+ * @copydoc cudf::detail::split_by_size
+ *
+ */
+std::vector<size_type> split_by_size(table_view const& t,
+                                     std::size_t max_bytes,
+                                     rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(max_bytes > 0, "The maximum batch size must be positive");
+  if (t.num_rows() == 0) { return {}; }
+
+  auto const row_bits = row_bit_count(t, stream);
+
+  // cumulative_bits[i] is the size of rows [0, i]
+  rmm::device_uvector<int64_t> cumulative_bits(t.num_rows(), stream);
+  auto const row_bits_begin = thrust::make_transform_iterator(
+    row_bits->view().begin<size_type>(),
+    [] __device__(size_type bits) { return static_cast<int64_t>(bits); });
+  thrust::inclusive_scan(rmm::exec_policy(stream),
+                         row_bits_begin,
+                         row_bits_begin + t.num_rows(),
+                         cumulative_bits.begin());
+
+  auto const max_bits = static_cast<int64_t>(
+    std::min<std::size_t>(max_bytes, std::numeric_limits<int64_t>::max() / 8) * 8);
+
+  // each batch ends before the first row that does not fit in the budget after its start, and a
+  // row larger than the budget is a batch on its own
+  std::vector<size_type> splits;
+  size_type batch_begin = 0;
+  int64_t begin_bits    = 0;  // size of the rows before `batch_begin`
+  while (true) {
+    auto const it = thrust::upper_bound(rmm::exec_policy(stream),
+                                        cumulative_bits.begin() + batch_begin,
+                                        cumulative_bits.end(),
+                                        begin_bits + max_bits);
+    auto const batch_end =
+      std::max<size_type>(thrust::distance(cumulative_bits.begin(), it), batch_begin + 1);
+    if (batch_end >= t.num_rows()) { break; }
+    splits.push_back(batch_end);
+    batch_begin = batch_end;
+    begin_bits  = cumulative_bits.element(batch_end - 1, stream);
+  }
+  return splits;
+}
+
 }  // namespace detail
 
 /**
@@ -539,4 +594,10 @@ std::unique_ptr<column> row_bit_count(table_view const& t, rmm::mr::device_memor
   return detail::row_bit_count(t, rmm::cuda_stream_default, mr);
 }
 
+std::vector<size_type> split_by_size(table_view const& t, std::size_t max_bytes)
+{
+  CUDF_FUNC_RANGE();
+  return detail::split_by_size(t, max_bytes, rmm::cuda_stream_default);
+}
+
 }  // namespace cudf
@@ -54,11 +54,10 @@ void unary_operation(mutable_column_view output,
            : cudf::jit::parse_single_function_cuda(udf,  //
                                                    "GENERIC_UNARY_OP");
 
-  cudf::jit::get_program_cache(*transform_jit_kernel_cu_jit)
-    .get_kernel(
-      kernel_name, {}, {{"transform/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})  //
-    ->configure_1d_max_occupancy(0, 0, 0, stream.value())                                   //
-    ->launch(output.size(),                                                                 //
+  cudf::jit::get_kernel(
+    *transform_jit_kernel_cu_jit, kernel_name, {{"transform/jit/operation-udf.hpp", cuda_source}})
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
+    ->launch(output.size(),                                //
              cudf::jit::get_data_ptr(output),
              cudf::jit::get_data_ptr(input));
 }
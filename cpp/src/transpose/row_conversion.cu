@@ -0,0 +1,607 @@
+/*
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/row_conversion.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/row_conversion.hpp>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/detail/utilities.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+constexpr size_type row_alignment    = sizeof(int64_t);
+constexpr size_type string_slot_size = 2 * sizeof(size_type);
+// the shared memory a block can use without opting in to more
+constexpr size_type max_shared_memory = 48 * 1024;
+
+CUDA_HOST_DEVICE_CALLABLE int64_t align_offset(int64_t offset, int64_t alignment)
+{
+  return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+/**
+ * @brief The positions of the columns in the fixed width section of each row
+ */
+struct row_layout {
+  std::vector<size_type> column_starts;
+  std::vector<size_type> column_sizes;
+  size_type validity_start;
+  size_type fixed_size;  // padded to `row_alignment`
+  bool has_strings;
+};
+
+/**
+ * @brief The device copy of a `row_layout`
+ */
+struct device_row_layout {
+  size_type const* column_starts;
+  size_type const* column_sizes;
+  size_type num_columns;
+  size_type validity_start;
+  size_type fixed_size;
+};
+
+row_layout compute_row_layout(std::vector<data_type> const& schema)
+{
+  CUDF_EXPECTS(not schema.empty(), "Cannot convert a table without columns to rows");
+  row_layout layout{};
+  int64_t at_offset = 0;
+  for (auto const& type : schema) {
+    auto const is_string = type.id() == type_id::STRING;
+    CUDF_EXPECTS(is_string or is_fixed_width(type),
+                 "Only fixed width and string columns can be converted to rows");
+    auto const size = is_string ? string_slot_size : static_cast<size_type>(size_of(type));
+    at_offset       = align_offset(at_offset, is_string ? sizeof(size_type) : size);
+    layout.column_starts.push_back(at_offset);
+    layout.column_sizes.push_back(size);
+    at_offset += size;
+    layout.has_strings = layout.has_strings or is_string;
+  }
+  layout.validity_start = at_offset;
+  layout.fixed_size     = align_offset(at_offset + (schema.size() + 7) / 8, row_alignment);
+  return layout;
+}
+
+/**
+ * @brief Returns whether rows of `row_size` bytes fit a warp of rows in shared memory
+ */
+bool fits_tile(size_type row_size) { return row_size <= max_shared_memory / warp_size; }
+
+/**
+ * @brief Returns the block dimensions and the shared memory size of the tiled kernels
+ */
+std::pair<dim3, size_type> tile_dims(size_type num_columns, size_type row_size)
+{
+  // a thread copies up to 4 columns of its row, beyond which the copies get slower, and a block
+  // keeps a multiple of a warp of rows in the x dimension for coalescing
+  auto const y_size    = std::min((num_columns + 3) / 4, warp_size);
+  auto const x_threads = 1024 / y_size;
+  auto const x_size    = std::min(x_threads, max_shared_memory / row_size) / warp_size * warp_size;
+  return {dim3(x_size, y_size), x_size * row_size};
+}
+
+/**
+ * @brief Returns the number of blocks of the tiled kernels, each of which loops over tiles.
+ */
+int tile_blocks(size_type num_rows, int tile_rows)
+{
+  // a few hundred blocks already saturate the memory bandwidth, and more only add overhead
+  return std::max(1, std::min((num_rows + tile_rows - 1) / tile_rows, 10240));
+}
+
+__device__ inline void copy_value(int8_t const* src, int8_t* dst, size_type size)
+{
+  switch (size) {
+    case 1: *dst = *src; break;
+    case 2: *reinterpret_cast<int16_t*>(dst) = *reinterpret_cast<int16_t const*>(src); break;
+    case 4: *reinterpret_cast<int32_t*>(dst) = *reinterpret_cast<int32_t const*>(src); break;
+    case 8: *reinterpret_cast<int64_t*>(dst) = *reinterpret_cast<int64_t const*>(src); break;
+    default:
+      for (size_type b = 0; b < size; ++b) {
+        dst[b] = src[b];
+      }
+  }
+}
+
+__device__ inline int8_t const* element_ptr(column_device_view const& col,
+                                            size_type row,
+                                            size_type size)
+{
+  return col.head<int8_t>() + static_cast<int64_t>(col.offset() + row) * size;
+}
+
+/**
+ * @brief Copies rows `[start_row, start_row + num_rows)` of `input`, which has only fixed width
+ * columns, into `output` as rows of `layout.fixed_size` bytes.
+ *
+ * Each block assembles a tile of `blockDim.x` rows in shared memory, with a thread per row
+ * copying every `blockDim.y`-th column, and then writes the whole tile with coalesced 64-bit
+ * stores.
+ */
+__global__ void copy_to_fixed_width_rows(table_device_view input,
+                                         size_type start_row,
+                                         size_type num_rows,
+                                         device_row_layout layout,
+                                         int8_t* output)
+{
+  extern __shared__ int64_t shared_tile[];
+  auto const tile_rows   = static_cast<size_type>(blockDim.x);
+  auto const row_words   = layout.fixed_size / row_alignment;
+  auto const thread_id   = static_cast<size_type>(threadIdx.y * blockDim.x + threadIdx.x);
+  auto const num_threads = static_cast<size_type>(blockDim.x * blockDim.y);
+  auto const row_tmp = reinterpret_cast<int8_t*>(shared_tile) + threadIdx.x * layout.fixed_size;
+
+  for (size_type tile_start = blockIdx.x * tile_rows; tile_start < num_rows;
+       tile_start += gridDim.x * tile_rows) {
+    auto const tile_words = min(tile_rows, num_rows - tile_start) * row_words;
+    // clears the validity bits and the padding
+    for (auto i = thread_id; i < tile_words; i += num_threads) {
+      shared_tile[i] = 0;
+    }
+    __syncthreads();
+
+    if (tile_start + static_cast<size_type>(threadIdx.x) < num_rows) {
+      auto const row = start_row + tile_start + threadIdx.x;
+      for (size_type c = threadIdx.y; c < layout.num_columns; c += blockDim.y) {
+        auto const& col = input.column(c);
+        auto const size = layout.column_sizes[c];
+        copy_value(element_ptr(col, row, size), row_tmp + layout.column_starts[c], size);
+        if (col.is_valid(row)) {
+          // other threads set the bits of the other columns in the same word
+          auto const byte = layout.validity_start + c / 8;
+          atomicOr(reinterpret_cast<uint32_t*>(row_tmp + (byte & ~3)),
+                   1u << ((byte & 3) * 8 + c % 8));
+        }
+      }
+    }
+    __syncthreads();
+
+    auto const output_tile = reinterpret_cast<int64_t*>(output) + tile_start * row_words;
+    for (auto i = thread_id; i < tile_words; i += num_threads) {
+      output_tile[i] = shared_tile[i];
+    }
+    __syncthreads();
+  }
+}
+
+/**
+ * @brief Copies `num_rows` consecutive rows of `layout.fixed_size` bytes starting at `input` into
+ * the fixed width columns `output`, a tile of rows at a time like `copy_to_fixed_width_rows`.
+ */
+__global__ void copy_from_fixed_width_rows(int8_t const* input,
+                                           size_type num_rows,
+                                           device_row_layout layout,
+                                           int8_t* const* output)
+{
+  extern __shared__ int64_t shared_tile[];
+  auto const tile_rows   = static_cast<size_type>(blockDim.x);
+  auto const row_words   = layout.fixed_size / row_alignment;
+  auto const thread_id   = static_cast<size_type>(threadIdx.y * blockDim.x + threadIdx.x);
+  auto const num_threads = static_cast<size_type>(blockDim.x * blockDim.y);
+  auto const row_tmp = reinterpret_cast<int8_t*>(shared_tile) + threadIdx.x * layout.fixed_size;
+
+  for (size_type tile_start = blockIdx.x * tile_rows; tile_start < num_rows;
+       tile_start += gridDim.x * tile_rows) {
+    auto const tile_words = min(tile_rows, num_rows - tile_start) * row_words;
+    auto const input_tile = reinterpret_cast<int64_t const*>(input) + tile_start * row_words;
+    for (auto i = thread_id; i < tile_words; i += num_threads) {
+      shared_tile[i] = input_tile[i];
+    }
+    __syncthreads();
+
+    auto const row = tile_start + static_cast<size_type>(threadIdx.x);
+    if (row < num_rows) {
+      for (size_type c = threadIdx.y; c < layout.num_columns; c += blockDim.y) {
+        auto const size = layout.column_sizes[c];
+        copy_value(row_tmp + layout.column_starts[c],
+                   output[c] + static_cast<int64_t>(row) * size,
+                   size);
+      }
+    }
+    __syncthreads();
+  }
+}
+
+/**
+ * @brief Copies rows `[start_row, start_row + num_rows)` of `input` into rows of any size starting
+ * at `row_offsets`, with a warp per row.
+ *
+ * The lanes copy the fixed width values and the validity bytes in parallel, and then the
+ * characters of each string column in turn.
+ */
+__global__ void copy_to_variable_width_rows(table_device_view input,
+                                            size_type start_row,
+                                            size_type num_rows,
+                                            device_row_layout layout,
+                                            size_type const* row_offsets,
+                                            int8_t* output)
+{
+  auto const lane      = static_cast<size_type>(threadIdx.x % warp_size);
+  auto const num_warps = static_cast<size_type>(gridDim.x * blockDim.x / warp_size);
+  auto const validity_bytes = (layout.num_columns + 7) / 8;
+
+  for (size_type i = (blockIdx.x * blockDim.x + threadIdx.x) / warp_size; i < num_rows;
+       i += num_warps) {
+    auto const row      = start_row + i;
+    auto const row_data = output + row_offsets[i];
+    auto const row_size = row_offsets[i + 1] - row_offsets[i];
+
+    for (auto b = lane; b < layout.fixed_size; b += warp_size) {
+      row_data[b] = 0;
+    }
+    __syncwarp();
+
+    for (auto c = lane; c < layout.num_columns; c += warp_size) {
+      auto const& col = input.column(c);
+      if (col.type().id() != type_id::STRING) {
+        auto const size = layout.column_sizes[c];
+        copy_value(element_ptr(col, row, size), row_data + layout.column_starts[c], size);
+      }
+    }
+    for (auto b = lane; b < validity_bytes; b += warp_size) {
+      uint8_t bits = 0;
+      for (size_type c = b * 8; c < min(b * 8 + 8, layout.num_columns); ++c) {
+        if (input.column(c).is_valid(row)) { bits |= 1 << (c % 8); }
+      }
+      row_data[layout.validity_start + b] = bits;
+    }
+
+    size_type chars_offset = layout.fixed_size;
+    for (size_type c = 0; c < layout.num_columns; ++c) {
+      auto const& col = input.column(c);
+      if (col.type().id() != type_id::STRING) { continue; }
+      auto const str = col.is_valid(row) ? col.element<string_view>(row) : string_view{};
+      if (lane == 0) {
+        auto const slot = reinterpret_cast<size_type*>(row_data + layout.column_starts[c]);
+        slot[0]         = chars_offset;
+        slot[1]         = str.size_bytes();
+      }
+      for (auto b = lane; b < str.size_bytes(); b += warp_size) {
+        row_data[chars_offset + b] = str.data()[b];
+      }
+      chars_offset += str.size_bytes();
+    }
+    for (auto b = chars_offset + lane; b < row_size; b += warp_size) {
+      row_data[b] = 0;
+    }
+  }
+}
+
+/**
+ * @brief Copies the rows starting at `row_offsets` into the columns `output`, with a warp per row
+ * like `copy_to_variable_width_rows`.
+ *
+ * `string_offsets[c]` holds the offsets of the characters of column `c` in `output[c]` if it is a
+ * STRING column, and is null otherwise.
+ */
+__global__ void copy_from_variable_width_rows(int8_t const* input,
+                                              size_type const* row_offsets,
+                                              size_type num_rows,
+                                              device_row_layout layout,
+                                              int8_t* const* output,
+                                              size_type const* const* string_offsets)
+{
+  auto const lane      = static_cast<size_type>(threadIdx.x % warp_size);
+  auto const num_warps = static_cast<size_type>(gridDim.x * blockDim.x / warp_size);
+
+  for (size_type row = (blockIdx.x * blockDim.x + threadIdx.x) / warp_size; row < num_rows;
+       row += num_warps) {
+    auto const row_data = input + row_offsets[row];
+    for (auto c = lane; c < layout.num_columns; c += warp_size) {
+      if (string_offsets[c] == nullptr) {
+        auto const size = layout.column_sizes[c];
+        copy_value(row_data + layout.column_starts[c],
+                   output[c] + static_cast<int64_t>(row) * size,
+                   size);
+      }
+    }
+    for (size_type c = 0; c < layout.num_columns; ++c) {
+      if (string_offsets[c] == nullptr) { continue; }
+      auto const slot  = reinterpret_cast<size_type const*>(row_data + layout.column_starts[c]);
+      auto const chars = output[c] + string_offsets[c][row];
+      for (auto b = lane; b < slot[1]; b += warp_size) {
+        chars[b] = row_data[slot[0] + b];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Returns the number of blocks of the warp per row kernels.
+ */
+int warp_blocks(size_type num_rows, int block_size)
+{
+  auto const warps_per_block = block_size / warp_size;
+  return std::max(1, (num_rows + warps_per_block - 1) / warps_per_block);
+}
+
+constexpr int warp_kernel_block_size = 256;
+
+std::unique_ptr<column> make_rows_column(size_type num_rows,
+                                         std::unique_ptr<column>&& offsets,
+                                         std::unique_ptr<column>&& data,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  return make_lists_column(num_rows,
+                           std::move(offsets),
+                           std::move(data),
+                           0,
+                           rmm::device_buffer{0, stream, mr},
+                           stream,
+                           mr);
+}
+
+}  // namespace
+
+std::vector<std::unique_ptr<column>> convert_to_rows(table_view const& input,
+                                                     size_type max_batch_bytes,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  std::vector<data_type> schema(input.num_columns());
+  std::transform(input.begin(), input.end(), schema.begin(), [](auto const& col) {
+    return col.type();
+  });
+  auto const layout   = compute_row_layout(schema);
+  auto const num_rows = input.num_rows();
+
+  auto layout_data = layout.column_starts;
+  layout_data.insert(layout_data.end(), layout.column_sizes.begin(), layout.column_sizes.end());
+  auto const d_layout_data = make_device_uvector_async(layout_data, stream);
+  device_row_layout const d_layout{d_layout_data.data(),
+                                   d_layout_data.data() + input.num_columns(),
+                                   input.num_columns(),
+                                   layout.validity_start,
+                                   layout.fixed_size};
+  auto const d_input = table_device_view::create(input, stream);
+
+  std::vector<std::unique_ptr<column>> batches;
+  auto make_batch = [&](size_type batch_rows, int64_t batch_bytes) {
+    auto offsets = make_numeric_column(
+      data_type{type_id::INT32}, batch_rows + 1, mask_state::UNALLOCATED, stream, mr);
+    auto data = make_numeric_column(data_type{type_id::INT8},
+                                    static_cast<size_type>(batch_bytes),
+                                    mask_state::UNALLOCATED,
+                                    stream,
+                                    mr);
+    return std::make_pair(std::move(offsets), std::move(data));
+  };
+
+  if (not layout.has_strings and fits_tile(layout.fixed_size)) {
+    CUDF_EXPECTS(layout.fixed_size <= max_batch_bytes, "A row is larger than a batch of rows");
+    auto const max_batch_rows = max_batch_bytes / layout.fixed_size;
+    auto const dims           = tile_dims(input.num_columns(), layout.fixed_size);
+    size_type start_row       = 0;
+    do {
+      auto const batch_rows = std::min(max_batch_rows, num_rows - start_row);
+      auto batch            = make_batch(batch_rows, int64_t{batch_rows} * layout.fixed_size);
+      auto const d_offsets = batch.first->mutable_view().data<size_type>();
+      thrust::sequence(
+        rmm::exec_policy(stream), d_offsets, d_offsets + batch_rows + 1, 0, layout.fixed_size);
+      if (batch_rows > 0) {
+        copy_to_fixed_width_rows<<<tile_blocks(batch_rows, dims.first.x),
+                                   dims.first,
+                                   dims.second,
+                                   stream.value()>>>(*d_input,
+                                                     start_row,
+                                                     batch_rows,
+                                                     d_layout,
+                                                     batch.second->mutable_view().data<int8_t>());
+      }
+      batches.push_back(
+        make_rows_column(batch_rows, std::move(batch.first), std::move(batch.second), stream, mr));
+      start_row += batch_rows;
+    } while (start_row < num_rows);
+    return batches;
+  }
+
+  // rows of different sizes, or too large for the tiles
+  rmm::device_uvector<int64_t> row_offsets(num_rows + 1, stream);
+  auto row_sizes = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [d_input = *d_input, fixed_size = layout.fixed_size] __device__(size_type row) {
+      int64_t size = fixed_size;
+      for (auto const& col : d_input) {
+        if (col.type().id() == type_id::STRING and col.is_valid(row)) {
+          size += col.element<string_view>(row).size_bytes();
+        }
+      }
+      return align_offset(size, row_alignment);
+    });
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), row_sizes, row_sizes + num_rows, row_offsets.begin() + 1);
+  CUDA_TRY(cudaMemsetAsync(row_offsets.data(), 0, sizeof(int64_t), stream.value()));
+
+  size_type start_row = 0;
+  do {
+    auto const base = row_offsets.element(start_row, stream);
+    // the batch ends before the first row ending past `max_batch_bytes`
+    auto const end = thrust::upper_bound(rmm::exec_policy(stream),
+                                         row_offsets.begin() + start_row + 1,
+                                         row_offsets.end(),
+                                         base + max_batch_bytes);
+    auto const end_row = static_cast<size_type>(thrust::distance(row_offsets.begin(), end)) - 1;
+    CUDF_EXPECTS(end_row > start_row or num_rows == 0, "A row is larger than a batch of rows");
+    auto const batch_rows = end_row - start_row;
+    auto batch = make_batch(batch_rows, row_offsets.element(end_row, stream) - base);
+    auto const d_offsets = batch.first->mutable_view().data<size_type>();
+    thrust::transform(rmm::exec_policy(stream),
+                      row_offsets.begin() + start_row,
+                      row_offsets.begin() + end_row + 1,
+                      d_offsets,
+                      [base] __device__(int64_t offset) {
+                        return static_cast<size_type>(offset - base);
+                      });
+    if (batch_rows > 0) {
+      copy_to_variable_width_rows<<<warp_blocks(batch_rows, warp_kernel_block_size),
+                                    warp_kernel_block_size,
+                                    0,
+                                    stream.value()>>>(*d_input,
+                                                      start_row,
+                                                      batch_rows,
+                                                      d_layout,
+                                                      d_offsets,
+                                                      batch.second->mutable_view().data<int8_t>());
+    }
+    batches.push_back(
+      make_rows_column(batch_rows, std::move(batch.first), std::move(batch.second), stream, mr));
+    start_row = end_row;
+  } while (start_row < num_rows);
+  return batches;
+}
+
+std::unique_ptr<table> convert_from_rows(lists_column_view const& input,
+                                         std::vector<data_type> const& schema,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  auto const list_type = input.child().type().id();
+  CUDF_EXPECTS(list_type == type_id::INT8 or list_type == type_id::UINT8,
+               "Only a list of bytes is supported as input");
+  auto const layout      = compute_row_layout(schema);
+  auto const num_rows    = input.size();
+  auto const num_columns = static_cast<size_type>(schema.size());
+  auto const rows        = input.child().data<int8_t>();
+  auto const row_offsets = input.offsets_begin();
+  if (num_rows == 0) {
+    std::vector<std::unique_ptr<column>> columns(num_columns);
+    std::transform(schema.begin(), schema.end(), columns.begin(), [](auto const& type) {
+      return make_empty_column(type);
+    });
+    return std::make_unique<table>(std::move(columns));
+  }
+
+  auto layout_data = layout.column_starts;
+  layout_data.insert(layout_data.end(), layout.column_sizes.begin(), layout.column_sizes.end());
+  auto const d_layout_data = make_device_uvector_async(layout_data, stream);
+  device_row_layout const d_layout{d_layout_data.data(),
+                                   d_layout_data.data() + num_columns,
+                                   num_columns,
+                                   layout.validity_start,
+                                   layout.fixed_size};
+
+  std::vector<std::unique_ptr<column>> columns;
+  std::vector<int8_t*> output_data;
+  std::vector<size_type const*> string_offsets;
+  for (size_type c = 0; c < num_columns; ++c) {
+    auto null_mask = valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_rows),
+      [rows, row_offsets, byte = layout.validity_start + c / 8, bit = c % 8] __device__(
+        size_type row) { return (rows[row_offsets[row] + byte] >> bit) & 1; },
+      stream,
+      mr);
+    if (null_mask.second == 0) { null_mask.first = rmm::device_buffer{0, stream, mr}; }
+
+    if (schema[c].id() == type_id::STRING) {
+      auto lengths = thrust::make_transform_iterator(
+        thrust::make_counting_iterator<size_type>(0),
+        [rows, row_offsets, start = layout.column_starts[c]] __device__(size_type row) {
+          return reinterpret_cast<size_type const*>(rows + row_offsets[row] + start)[1];
+        });
+      auto offsets =
+        strings::detail::make_offsets_child_column(lengths, lengths + num_rows, stream, mr);
+      auto const bytes = get_value<size_type>(offsets->view(), num_rows, stream);
+      auto chars       = strings::detail::create_chars_child_column(num_rows, bytes, stream, mr);
+      output_data.push_back(chars->mutable_view().data<int8_t>());
+      string_offsets.push_back(offsets->view().data<size_type>());
+      columns.push_back(make_strings_column(num_rows,
+                                            std::move(offsets),
+                                            std::move(chars),
+                                            null_mask.second,
+                                            std::move(null_mask.first),
+                                            stream,
+                                            mr));
+    } else {
+      auto col = make_fixed_width_column(schema[c], num_rows, mask_state::UNALLOCATED, stream, mr);
+      col->set_null_mask(std::move(null_mask.first), null_mask.second);
+      output_data.push_back(col->mutable_view().data<int8_t>());
+      string_offsets.push_back(nullptr);
+      columns.push_back(std::move(col));
+    }
+  }
+
+  auto const d_output_data    = make_device_uvector_async(output_data, stream);
+  auto const d_string_offsets = make_device_uvector_async(string_offsets, stream);
+
+  // the tiles need consecutive rows of the fixed size, aligned for the 64-bit loads
+  auto const offsets      = input.offsets();
+  auto const first_offset = get_value<size_type>(offsets, input.offset(), stream);
+  auto const last_offset  = get_value<size_type>(offsets, input.offset() + num_rows, stream);
+  auto const first_row    = rows + first_offset;
+  if (not layout.has_strings and fits_tile(layout.fixed_size) and
+      last_offset - first_offset == int64_t{num_rows} * layout.fixed_size and
+      reinterpret_cast<uintptr_t>(first_row) % row_alignment == 0) {
+    auto const dims = tile_dims(num_columns, layout.fixed_size);
+    copy_from_fixed_width_rows<<<tile_blocks(num_rows, dims.first.x),
+                                 dims.first,
+                                 dims.second,
+                                 stream.value()>>>(
+      first_row, num_rows, d_layout, d_output_data.data());
+  } else {
+    copy_from_variable_width_rows<<<warp_blocks(num_rows, warp_kernel_block_size),
+                                    warp_kernel_block_size,
+                                    0,
+                                    stream.value()>>>(
+      rows, row_offsets, num_rows, d_layout, d_output_data.data(), d_string_offsets.data());
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace detail
+
+std::vector<std::unique_ptr<column>> convert_to_rows(table_view const& input,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_to_rows(
+    input, std::numeric_limits<size_type>::max(), rmm::cuda_stream_default, mr);
+}
+
+std::unique_ptr<table> convert_from_rows(lists_column_view const& input,
+                                         std::vector<data_type> const& schema,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_from_rows(input, schema, rmm::cuda_stream_default, mr);
+}
+
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -13,21 +13,148 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reshape.hpp>
 #include <cudf/detail/transpose.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/reshape.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/transpose.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
 namespace cudf {
 namespace detail {
+namespace {
+
+constexpr int tile_dim          = 32;
+constexpr int tile_thread_rows  = 8;
+constexpr int max_row_tile_grid = 65535;
+
+/**
+ * @brief Interleaves the columns of `input` into `output` through tiles of `tile_dim` x
+ * `tile_dim` elements in shared memory, so that both the reads of the columns and the writes of
+ * the output are coalesced.
+ *
+ * Blocks of `tile_dim` x `tile_thread_rows` threads loop over the row tiles of the columns of
+ * their column tile. The validity of the output is written one warp ballot at a time, into the
+ * one or two words of `output_mask` that each output row of a tile spans, which must be zeroed.
+ */
+template <typename T, bool has_nulls>
+__global__ void tiled_transpose_kernel(table_device_view input,
+                                       T* __restrict__ output,
+                                       bitmask_type* __restrict__ output_mask)
+{
+  __shared__ T tile[tile_dim][tile_dim + 1];  // padded against bank conflicts
+  __shared__ bool tile_valid[tile_dim][tile_dim + 1];
+
+  auto const num_rows      = input.num_rows();
+  auto const num_columns   = input.num_columns();
+  auto const num_row_tiles = (num_rows + tile_dim - 1) / tile_dim;
+  auto const column_begin  = static_cast<size_type>(blockIdx.x) * tile_dim;
+
+  for (size_type row_tile = blockIdx.y; row_tile < num_row_tiles; row_tile += gridDim.y) {
+    auto const row_begin = row_tile * tile_dim;
+
+    // the threads of a warp read consecutive rows of a column
+    for (int j = threadIdx.y; j < tile_dim; j += blockDim.y) {
+      auto const col = column_begin + j;
+      auto const row = row_begin + static_cast<size_type>(threadIdx.x);
+      if (col < num_columns and row < num_rows) {
+        auto const& column   = input.column(col);
+        tile[j][threadIdx.x] = column.element<T>(row);
+        if (has_nulls) { tile_valid[j][threadIdx.x] = column.is_valid(row); }
+      }
+    }
+    __syncthreads();
+
+    // the threads of a warp write consecutive columns of an output row
+    for (int j = threadIdx.y; j < tile_dim; j += blockDim.y) {
+      auto const row       = row_begin + j;
+      auto const col       = column_begin + static_cast<size_type>(threadIdx.x);
+      auto const in_bounds = row < num_rows and col < num_columns;
+      if (in_bounds) {
+        output[static_cast<int64_t>(row) * num_columns + col] = tile[threadIdx.x][j];
+      }
+      if (has_nulls) {
+        auto const valid_lanes =
+          __ballot_sync(0xffffffff, in_bounds and tile_valid[threadIdx.x][j]);
+        if (threadIdx.x == 0 and valid_lanes != 0) {
+          auto const first = static_cast<int64_t>(row) * num_columns + column_begin;
+          auto const word  = first / size_in_bits<bitmask_type>();
+          auto const shift = static_cast<int>(first % size_in_bits<bitmask_type>());
+          atomicOr(&output_mask[word], valid_lanes << shift);
+          if (shift != 0 and (valid_lanes >> (32 - shift)) != 0) {
+            atomicOr(&output_mask[word + 1], valid_lanes >> (32 - shift));
+          }
+        }
+      }
+    }
+    __syncthreads();
+  }
+}
+
+struct tiled_transpose_fn {
+  template <typename T, std::enable_if_t<cudf::is_fixed_width<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(table_view const& input,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    auto const output_size = static_cast<int64_t>(input.num_rows()) * input.num_columns();
+    CUDF_EXPECTS(output_size <= std::numeric_limits<size_type>::max(),
+                 "Size of the transposed table exceeds the column size limit");
+    auto const nullable =
+      std::any_of(input.begin(), input.end(), [](auto const& col) { return col.nullable(); });
+    auto const null_count = std::accumulate(
+      input.begin(), input.end(), size_type{0}, [](auto count, auto const& col) {
+        return count + col.null_count();
+      });
+
+    // the kernel sets the valid bits of a zeroed mask
+    auto const mask_init = not nullable     ? mask_state::UNALLOCATED
+                           : null_count > 0 ? mask_state::ALL_NULL
+                                            : mask_state::ALL_VALID;
+    auto output = make_fixed_width_column(
+      input.column(0).type(), static_cast<size_type>(output_size), mask_init, stream, mr);
+    auto const output_view = output->mutable_view();
+
+    auto const d_input = table_device_view::create(input, stream);
+    dim3 const grid((input.num_columns() + tile_dim - 1) / tile_dim,
+                    std::min((input.num_rows() + tile_dim - 1) / tile_dim, max_row_tile_grid));
+    dim3 const block(tile_dim, tile_thread_rows);
+    if (null_count > 0) {
+      tiled_transpose_kernel<T, true><<<grid, block, 0, stream.value()>>>(
+        *d_input, output_view.data<T>(), output_view.null_mask());
+    } else {
+      tiled_transpose_kernel<T, false><<<grid, block, 0, stream.value()>>>(
+        *d_input, output_view.data<T>(), nullptr);
+    }
+    CHECK_CUDA(stream.value());
+    if (nullable) { output->set_null_count(null_count); }
+    return output;
+  }
+
+  template <typename T, std::enable_if_t<not cudf::is_fixed_width<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(table_view const& input,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    return detail::interleave_columns(input, stream, mr);
+  }
+};
+
+}  // namespace
+
 std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input,
                                                          rmm::cuda_stream_view stream,
                                                          rmm::mr::device_memory_resource* mr)
@@ -44,7 +171,9 @@ std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input
       input.begin(), input.end(), [dtype](auto const& col) { return dtype == col.type(); }),
     "Column type mismatch");
 
-  auto output_column = cudf::interleave_columns(input, mr);
+  // fixed-width tables are transposed through shared memory tiles
+  auto output_column = type_dispatcher<dispatch_storage_type>(
+    dtype, tiled_transpose_fn{}, input, stream, mr);
   auto one_iter      = thrust::make_counting_iterator<size_type>(1);
   auto splits_iter   = thrust::make_transform_iterator(
     one_iter, [width = input.num_columns()](size_type idx) { return idx * width; });
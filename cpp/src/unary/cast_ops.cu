@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,6 +22,7 @@
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/unary.hpp>
 #include <cudf/utilities/traits.hpp>
 
@@ -368,6 +369,97 @@ struct dispatch_unary_cast_from {
     CUDF_FAIL("Column type must be numeric or chrono or decimal32/64");
   }
 };
+/**
+ * @brief Casts the data of `input` into the data of a preallocated column of type `TargetT`.
+ *
+ * Rescaling between `fixed_point` types is not supported, since it is a binary operation.
+ */
+template <typename _SourceT>
+struct dispatch_unary_cast_into_to {
+  column_view input;
+
+  template <
+    typename TargetT,
+    typename SourceT                                                                  = _SourceT,
+    typename std::enable_if_t<is_supported_non_fixed_point_cast<SourceT, TargetT>()>* = nullptr>
+  void operator()(mutable_column_view& output, rmm::cuda_stream_view stream)
+  {
+    thrust::transform(rmm::exec_policy(stream),
+                      input.begin<SourceT>(),
+                      input.end<SourceT>(),
+                      output.begin<TargetT>(),
+                      unary_cast<TargetT>{});
+  }
+
+  template <typename TargetT,
+            typename SourceT                                        = _SourceT,
+            typename std::enable_if_t<cudf::is_fixed_point<SourceT>() &&
+                                      cudf::is_numeric<TargetT>()>* = nullptr>
+  void operator()(mutable_column_view& output, rmm::cuda_stream_view stream)
+  {
+    using DeviceT    = device_storage_type_t<SourceT>;
+    auto const scale = numeric::scale_type{input.type().scale()};
+
+    thrust::transform(rmm::exec_policy(stream),
+                      input.begin<DeviceT>(),
+                      input.end<DeviceT>(),
+                      output.begin<TargetT>(),
+                      fixed_point_unary_cast<SourceT, TargetT>{scale});
+  }
+
+  template <typename TargetT,
+            typename SourceT                                            = _SourceT,
+            typename std::enable_if_t<cudf::is_numeric<SourceT>() &&
+                                      cudf::is_fixed_point<TargetT>()>* = nullptr>
+  void operator()(mutable_column_view& output, rmm::cuda_stream_view stream)
+  {
+    using DeviceT    = device_storage_type_t<TargetT>;
+    auto const scale = numeric::scale_type{output.type().scale()};
+
+    thrust::transform(rmm::exec_policy(stream),
+                      input.begin<SourceT>(),
+                      input.end<SourceT>(),
+                      output.begin<DeviceT>(),
+                      fixed_point_unary_cast<SourceT, TargetT>{scale});
+  }
+
+  template <typename TargetT,
+            typename SourceT = _SourceT,
+            typename std::enable_if_t<not is_supported_non_fixed_point_cast<SourceT, TargetT>() &&
+                                      not(cudf::is_fixed_point<SourceT>() &&
+                                          cudf::is_numeric<TargetT>()) &&
+                                      not(cudf::is_numeric<SourceT>() &&
+                                          cudf::is_fixed_point<TargetT>())>* = nullptr>
+  void operator()(mutable_column_view&, rmm::cuda_stream_view)
+  {
+    if (cudf::is_fixed_point<SourceT>() && cudf::is_fixed_point<TargetT>())
+      CUDF_FAIL("Casting between decimal32/64 columns into a preallocated column is not supported");
+    else if (!cudf::is_fixed_width<TargetT>())
+      CUDF_FAIL("Column type must be numeric or chrono or decimal32/64");
+    else if (cudf::is_fixed_point<SourceT>())
+      CUDF_FAIL("Currently only decimal32/64 to floating point/integral is supported");
+    else if (cudf::is_timestamp<SourceT>() && is_numeric<TargetT>())
+      CUDF_FAIL("Timestamps can be created only from duration");
+    else
+      CUDF_FAIL("Timestamps cannot be converted to numeric without converting it to a duration");
+  }
+};
+
+struct dispatch_unary_cast_into_from {
+  column_view input;
+
+  template <typename T, typename std::enable_if_t<cudf::is_fixed_width<T>()>* = nullptr>
+  void operator()(mutable_column_view& output, rmm::cuda_stream_view stream)
+  {
+    type_dispatcher(output.type(), dispatch_unary_cast_into_to<T>{input}, output, stream);
+  }
+
+  template <typename T, typename std::enable_if_t<!cudf::is_fixed_width<T>()>* = nullptr>
+  void operator()(mutable_column_view&, rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Column type must be numeric or chrono or decimal32/64");
+  }
+};
 }  // anonymous namespace
 
 std::unique_ptr<column> cast(column_view const& input,
@@ -380,6 +472,15 @@ std::unique_ptr<column> cast(column_view const& input,
   return type_dispatcher(input.type(), detail::dispatch_unary_cast_from{input}, type, stream, mr);
 }
 
+void cast(column_view const& input, mutable_column_view& output, rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(is_fixed_width(output.type()), "Unary cast type must be fixed-width.");
+  CUDF_EXPECTS(output.size() == input.size(), "Mismatch in output size");
+
+  type_dispatcher(input.type(), detail::dispatch_unary_cast_into_from{input}, output, stream);
+  inplace_bitmask_and(output, table_view{{input}}, stream);
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> cast(column_view const& input,
@@ -390,4 +491,10 @@ std::unique_ptr<column> cast(column_view const& input,
   return detail::cast(input, type, rmm::cuda_stream_default, mr);
 }
 
+void cast(column_view const& input, mutable_column_view& output)
+{
+  CUDF_FUNC_RANGE();
+  detail::cast(input, output, rmm::cuda_stream_default);
+}
+
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,7 @@
 #include <cudf/detail/unary.hpp>
 #include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/detail/iterator.cuh>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -560,6 +561,40 @@ struct FixedPointOpDispatcher {
   }
 };
 
+/**
+ * @brief Computes `UFN` of the elements of a non-dictionary column into a preallocated column of
+ * the type of the result: `BOOL8` for a logical operation, and the input type otherwise.
+ */
+template <typename UFN, bool is_logical = false>
+struct transform_into_dispatcher {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return std::is_same<UFN, DeviceInvert>::value ? std::is_integral<T>::value
+                                                  : std::is_arithmetic<T>::value;
+  }
+
+  template <typename T, typename std::enable_if_t<is_supported<T>()>* = nullptr>
+  void operator()(cudf::column_view const& input,
+                  cudf::mutable_column_view& output,
+                  rmm::cuda_stream_view stream)
+  {
+    using OutputType = std::conditional_t<is_logical, bool, T>;
+    CUDF_EXPECTS(output.type() == data_type{type_to_id<OutputType>()}, "Mismatch in output type");
+    thrust::transform(rmm::exec_policy(stream),
+                      input.begin<T>(),
+                      input.end<T>(),
+                      output.begin<OutputType>(),
+                      UFN{});
+  }
+
+  template <typename T, typename std::enable_if_t<!is_supported<T>()>* = nullptr>
+  void operator()(cudf::column_view const&, cudf::mutable_column_view&, rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Unsupported datatype for operation");
+  }
+};
+
 }  // namespace
 
 std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
@@ -644,6 +679,73 @@ std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
   }
 }
 
+void unary_operation(cudf::column_view const& input,
+                     cudf::unary_operator op,
+                     cudf::mutable_column_view& output,
+                     rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(not cudf::is_fixed_point(input.type()) and
+                 input.type().id() != type_id::DICTIONARY32,
+               "Unsupported datatype for a preallocated output column");
+  CUDF_EXPECTS(output.size() == input.size(), "Mismatch in output size");
+
+  inplace_bitmask_and(output, table_view{{input}}, stream);
+
+  auto const dispatch = [&](auto dispatcher) {
+    cudf::type_dispatcher(input.type(), dispatcher, input, output, stream);
+  };
+  switch (op) {
+    case cudf::unary_operator::SIN:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceSin>{});
+    case cudf::unary_operator::COS:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceCos>{});
+    case cudf::unary_operator::TAN:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceTan>{});
+    case cudf::unary_operator::ARCSIN:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceArcSin>{});
+    case cudf::unary_operator::ARCCOS:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceArcCos>{});
+    case cudf::unary_operator::ARCTAN:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceArcTan>{});
+    case cudf::unary_operator::SINH:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceSinH>{});
+    case cudf::unary_operator::COSH:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceCosH>{});
+    case cudf::unary_operator::TANH:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceTanH>{});
+    case cudf::unary_operator::ARCSINH:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceArcSinH>{});
+    case cudf::unary_operator::ARCCOSH:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceArcCosH>{});
+    case cudf::unary_operator::ARCTANH:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceArcTanH>{});
+    case cudf::unary_operator::EXP:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceExp>{});
+    case cudf::unary_operator::LOG:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceLog>{});
+    case cudf::unary_operator::SQRT:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceSqrt>{});
+    case cudf::unary_operator::CBRT:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceCbrt>{});
+    case cudf::unary_operator::CEIL:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceCeil>{});
+    case cudf::unary_operator::FLOOR:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceFloor>{});
+    case cudf::unary_operator::ABS:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceAbs>{});
+    case cudf::unary_operator::RINT:
+      CUDF_EXPECTS(
+        (input.type().id() == type_id::FLOAT32) or (input.type().id() == type_id::FLOAT64),
+        "rint expects floating point values");
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceRInt>{});
+    case cudf::unary_operator::BIT_INVERT:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceInvert>{});
+    case cudf::unary_operator::NOT:
+      return dispatch(detail::transform_into_dispatcher<detail::DeviceNot, true>{});
+    default: CUDF_FAIL("Undefined unary operation");
+  }
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
@@ -654,4 +756,12 @@ std::unique_ptr<cudf::column> unary_operation(cudf::column_view const& input,
   return detail::unary_operation(input, op, rmm::cuda_stream_default, mr);
 }
 
+void unary_operation(cudf::column_view const& input,
+                     cudf::unary_operator op,
+                     cudf::mutable_column_view& output)
+{
+  CUDF_FUNC_RANGE();
+  detail::unary_operation(input, op, output, rmm::cuda_stream_default);
+}
+
 }  // namespace cudf
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/metrics.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/mr/device/statistics_resource_adaptor.hpp>
+
+#include <cuda_runtime.h>
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace cudf {
+namespace metrics {
+namespace detail {
+
+std::atomic<int> active_scopes{0};
+
+namespace {
+
+using statistics_adaptor = rmm::mr::statistics_resource_adaptor<rmm::mr::device_memory_resource>;
+
+std::mutex registry_mutex;
+std::map<int, callback> registry;
+int next_id = 0;
+
+/**
+ * @brief The operation recorded on a thread.
+ */
+struct thread_state {
+  int depth = 0;  // number of nested `begin_operation` calls
+  operation_metrics metrics{};
+  statistics_adaptor::counter bytes_begin{};
+  cudaEvent_t start = nullptr;
+  cudaEvent_t stop  = nullptr;
+
+  ~thread_state()
+  {
+    // the errors at process exit, after the CUDA context is destroyed, are ignored
+    if (start != nullptr) { cudaEventDestroy(start); }
+    if (stop != nullptr) { cudaEventDestroy(stop); }
+  }
+};
+
+thread_local thread_state state;
+
+statistics_adaptor* current_statistics()
+{
+  return dynamic_cast<statistics_adaptor*>(rmm::mr::get_current_device_resource());
+}
+
+}  // namespace
+
+void begin_operation(char const* name)
+{
+  if (state.depth++ > 0) { return; }
+  if (state.start == nullptr) {
+    cudaEventCreate(&state.start);
+    cudaEventCreate(&state.stop);
+  }
+  state.metrics = operation_metrics{name, 0, 0, -1, -1};
+  if (auto const stats = current_statistics(); stats != nullptr) {
+    state.bytes_begin = stats->get_bytes_counter();
+  }
+  cudaEventRecord(state.start, rmm::cuda_stream_default.value());
+}
+
+void end_operation()
+{
+  if (--state.depth > 0) { return; }
+  cudaEventRecord(state.stop, rmm::cuda_stream_default.value());
+  if (cudaEventSynchronize(state.stop) != cudaSuccess or
+      cudaEventElapsedTime(&state.metrics.elapsed_ms, state.start, state.stop) != cudaSuccess) {
+    cudaGetLastError();  // clears the error, which the next libcudf call reports if sticky
+    state.metrics.elapsed_ms = 0;
+  }
+  if (auto const stats = current_statistics(); stats != nullptr) {
+    auto const bytes              = stats->get_bytes_counter();
+    state.metrics.allocated_bytes = bytes.total - state.bytes_begin.total;
+    state.metrics.peak_bytes =
+      bytes.peak > state.bytes_begin.peak ? bytes.peak - state.bytes_begin.value : 0;
+  }
+
+  std::vector<callback> callbacks;
+  {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    for (auto const& entry : registry) {
+      callbacks.push_back(entry.second);
+    }
+  }
+  for (auto const& cb : callbacks) {
+    cb(state.metrics);
+  }
+}
+
+void add_bytes_processed(int64_t bytes)
+{
+  if (state.depth > 0) { state.metrics.bytes_processed += bytes; }
+}
+
+}  // namespace detail
+
+scope::scope(callback cb)
+{
+  std::lock_guard<std::mutex> lock(detail::registry_mutex);
+  _id = detail::next_id++;
+  detail::registry.emplace(_id, std::move(cb));
+  ++detail::active_scopes;
+}
+
+scope::~scope()
+{
+  std::lock_guard<std::mutex> lock(detail::registry_mutex);
+  detail::registry.erase(_id);
+  --detail::active_scopes;
+}
+
+}  // namespace metrics
+}  // namespace cudf
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/file_io_utilities.hpp>
+#include <io/utilities/pinned_memory_pool.hpp>
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/spill.hpp>
+
+#include <rmm/detail/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+namespace cudf {
+
+/**
+ * @brief The data of a spilled table, either in pinned host memory or in a spill file.
+ */
+class spillable_table::spilled_data {
+ public:
+  explicit spilled_data(io::detail::pinned_buffer<uint8_t>&& host) : _host(std::move(host)) {}
+  explicit spilled_data(std::string path) : _path(std::move(path)) {}
+  spilled_data(spilled_data const&) = delete;
+  spilled_data& operator=(spilled_data const&) = delete;
+  ~spilled_data()
+  {
+    if (not _path.empty()) { std::remove(_path.c_str()); }
+  }
+
+  /**
+   * @brief Copies the spilled data to `dst` in device memory.
+   */
+  void restore(uint8_t* dst, std::size_t size, rmm::cuda_stream_view stream) const
+  {
+    if (_path.empty()) {
+      CUDA_TRY(cudaMemcpyAsync(dst, _host.data(), size, cudaMemcpyHostToDevice, stream.value()));
+      stream.synchronize();
+      return;
+    }
+    if (auto const cufile_in = io::detail::make_cufile_input(_path)) {
+      CUDF_EXPECTS(cufile_in->read(0, size, dst, stream) == size, "Failed to read a spill file");
+      return;
+    }
+    io::detail::pinned_buffer<uint8_t> staging(size);
+    std::ifstream file(_path, std::ios::binary);
+    CUDF_EXPECTS(file.read(reinterpret_cast<char*>(staging.data()), size),
+                 "Failed to read a spill file");
+    CUDA_TRY(cudaMemcpyAsync(dst, staging.data(), size, cudaMemcpyHostToDevice, stream.value()));
+    stream.synchronize();
+  }
+
+ private:
+  io::detail::pinned_buffer<uint8_t> _host;
+  std::string _path;
+};
+
+spill_manager::spill_manager(spill_target target, std::string spill_directory)
+  : _target{target}, _spill_directory{std::move(spill_directory)}
+{
+  CUDF_EXPECTS(target != spill_target::DISK or not _spill_directory.empty(),
+               "Spilling to disk requires a spill directory");
+}
+
+spill_manager::~spill_manager() = default;
+
+std::size_t spill_manager::spill(std::size_t bytes, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  std::lock_guard<std::mutex> lock(_mutex);
+  std::size_t freed = 0;
+  for (auto const table : _tables) {
+    if (freed >= bytes) { break; }
+    // a table that is locked by another thread, or that is being restored, is in use
+    std::unique_lock<std::mutex> table_lock(table->_mutex, std::try_to_lock);
+    if (not table_lock.owns_lock() or table->_lock_count > 0 or table->_spilled) { continue; }
+    freed += table->spill(stream);
+  }
+  return freed;
+}
+
+void spill_manager::register_table(spillable_table* table)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _tables.push_back(table);
+}
+
+void spill_manager::unregister_table(spillable_table* table)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _tables.remove(table);
+}
+
+void spill_manager::touch(spillable_table* table)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto const it = std::find(_tables.begin(), _tables.end(), table);
+  if (it != _tables.end()) { _tables.splice(_tables.end(), _tables, it); }
+}
+
+spillable_table::spillable_table(table_view const& input,
+                                 spill_manager& manager,
+                                 rmm::mr::device_memory_resource* mr)
+  : _manager{manager}, _mr{mr}
+{
+  auto packed  = pack(input, mr);
+  _metadata    = std::move(packed.metadata_);
+  _device_data = std::move(packed.gpu_data);
+  _size        = _device_data->size();
+  // the data must be complete before it can be spilled on another stream
+  rmm::cuda_stream_default.synchronize();
+  _manager.register_table(this);
+}
+
+spillable_table::~spillable_table()
+{
+  // the manager must not spill the table while it is destroyed
+  _manager.unregister_table(this);
+  if (_spilled) { _manager._spilled_bytes -= _size; }
+}
+
+spillable_table::locked_view spillable_table::lock(rmm::cuda_stream_view stream)
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  if (_spilled) {
+    CUDF_FUNC_RANGE();
+    // the allocation may spill other tables, but not this one since `_mutex` is held
+    auto restored = std::make_unique<rmm::device_buffer>(_size, stream, _mr);
+    _spilled->restore(static_cast<uint8_t*>(restored->data()), _size, stream);
+    _device_data = std::move(restored);
+    _spilled.reset();
+    _manager._spilled_bytes -= _size;
+  }
+  ++_lock_count;
+  auto const view = unpack(_metadata->data(), static_cast<uint8_t const*>(_device_data->data()));
+  lock.unlock();
+
+  _manager.touch(this);
+  return locked_view{this, view};
+}
+
+bool spillable_table::is_spilled() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _spilled != nullptr;
+}
+
+std::size_t spillable_table::spill(rmm::cuda_stream_view stream)
+{
+  if (_size == 0) { return 0; }
+  auto const d_data = static_cast<uint8_t const*>(_device_data->data());
+  if (_manager.target() == spill_target::HOST) {
+    io::detail::pinned_buffer<uint8_t> host(_size);
+    CUDA_TRY(cudaMemcpyAsync(host.data(), d_data, _size, cudaMemcpyDeviceToHost, stream.value()));
+    stream.synchronize();
+    _spilled = std::make_unique<spilled_data>(std::move(host));
+  } else {
+    auto const path = _manager._spill_directory + "/cudf_spill_" + std::to_string(getpid()) + "_" +
+                      std::to_string(_manager._next_file_id++) + ".bin";
+    if (auto const cufile_out = io::detail::make_cufile_output(path)) {
+      cufile_out->write(d_data, 0, _size);
+    } else {
+      io::detail::pinned_buffer<uint8_t> staging(_size);
+      CUDA_TRY(
+        cudaMemcpyAsync(staging.data(), d_data, _size, cudaMemcpyDeviceToHost, stream.value()));
+      stream.synchronize();
+      std::ofstream file(path, std::ios::binary);
+      CUDF_EXPECTS(file.write(reinterpret_cast<char const*>(staging.data()), _size),
+                   "Failed to write a spill file");
+    }
+    _spilled = std::make_unique<spilled_data>(path);
+  }
+  _device_data.reset();
+  _manager._spilled_bytes += _size;
+  return _size;
+}
+
+void spillable_table::unlock()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  --_lock_count;
+}
+
+spillable_table::locked_view::~locked_view()
+{
+  if (_table != nullptr) { _table->unlock(); }
+}
+
+spilling_resource_adaptor::spilling_resource_adaptor(rmm::mr::device_memory_resource* upstream,
+                                                     spill_manager& manager)
+  : _upstream{upstream}, _manager{manager}
+{
+  CUDF_EXPECTS(upstream != nullptr, "Unexpected null upstream resource");
+}
+
+void* spilling_resource_adaptor::do_allocate(std::size_t bytes, rmm::cuda_stream_view stream)
+{
+  while (true) {
+    try {
+      return _upstream->allocate(bytes, stream);
+    } catch (rmm::bad_alloc const&) {
+      // retry as long as spilling frees memory; the freed memory may not be contiguous
+      if (_manager.spill(bytes, stream) == 0) { throw; }
+    }
+  }
+}
+
+void spilling_resource_adaptor::do_deallocate(void* ptr,
+                                              std::size_t bytes,
+                                              rmm::cuda_stream_view stream)
+{
+  _upstream->deallocate(ptr, bytes, stream);
+}
+
+}  // namespace cudf
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/stream_pool.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/stream_pool.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace cudf {
+namespace {
+
+std::size_t initial_pool_size()
+{
+  auto const env_val = std::getenv("LIBCUDF_STREAM_POOL_SIZE");
+  if (env_val == nullptr) { return 16; }
+  auto const size = std::stoll(env_val);
+  CUDF_EXPECTS(size > 0, "LIBCUDF_STREAM_POOL_SIZE must be a positive integer");
+  return static_cast<std::size_t>(size);
+}
+
+/**
+ * @brief Non-blocking streams shared by all threads, created on first use on each device and never
+ * destroyed.
+ */
+class stream_pool {
+ public:
+  std::size_t size() const { return _size; }
+
+  void resize(std::size_t size)
+  {
+    CUDF_EXPECTS(size > 0, "The stream pool must have at least one stream");
+    _size = size;
+  }
+
+  /**
+   * @brief Returns the next `count` streams of the pool of the current device, in round-robin
+   * order.
+   */
+  std::vector<rmm::cuda_stream_view> get_streams(std::size_t count)
+  {
+    int device_id;
+    CUDA_TRY(cudaGetDevice(&device_id));
+    auto const size = this->size();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& streams = _streams[device_id];
+    while (streams.size() < size) {
+      cudaStream_t stream;
+      CUDA_TRY(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+      streams.push_back(stream);
+    }
+    std::vector<rmm::cuda_stream_view> result;
+    for (std::size_t i = 0; i < count; ++i) {
+      result.emplace_back(streams[_next++ % size]);
+    }
+    return result;
+  }
+
+ private:
+  std::atomic<std::size_t> _size{initial_pool_size()};
+  std::mutex _mutex;
+  std::map<int, std::vector<cudaStream_t>> _streams;  // streams of each device
+  std::size_t _next = 0;                               // next stream to hand out
+};
+
+stream_pool& global_stream_pool()
+{
+  static stream_pool pool;
+  return pool;
+}
+
+}  // namespace
+
+std::size_t get_stream_pool_size() { return global_stream_pool().size(); }
+
+void set_stream_pool_size(std::size_t size) { global_stream_pool().resize(size); }
+
+namespace detail {
+
+std::vector<rmm::cuda_stream_view> fork_streams(rmm::cuda_stream_view stream, std::size_t count)
+{
+  count = std::min(count, global_stream_pool().size());
+  if (count <= 1) { return {stream}; }
+
+  auto const streams = global_stream_pool().get_streams(count);
+  cudaEvent_t event;
+  CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+  CUDA_TRY(cudaEventRecord(event, stream.value()));
+  for (auto const forked : streams) {
+    CUDA_TRY(cudaStreamWaitEvent(forked.value(), event, 0));
+  }
+  // the event is released once the work it waits for completes
+  CUDA_TRY(cudaEventDestroy(event));
+  return streams;
+}
+
+void join_streams(host_span<rmm::cuda_stream_view const> forked_streams,
+                  rmm::cuda_stream_view stream)
+{
+  for (auto const forked : forked_streams) {
+    if (forked.value() == stream.value()) { continue; }
+    cudaEvent_t event;
+    CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    CUDA_TRY(cudaEventRecord(event, forked.value()));
+    CUDA_TRY(cudaStreamWaitEvent(stream.value(), event, 0));
+    CUDA_TRY(cudaEventDestroy(event));
+  }
+}
+
+}  // namespace detail
+}  // namespace cudf
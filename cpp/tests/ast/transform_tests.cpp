@@ -245,6 +245,58 @@ TEST_F(TransformTest, StringComparison)
   cudf::test::expect_columns_equal(expected, result->view(), true);
 }
 
+TEST_F(TransformTest, StringLiteralComparison)
+{
+  auto c_0   = cudf::test::strings_column_wrapper({"Austin", "Boston", "Madrid", "Zurich"});
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto literal_value = cudf::string_scalar("M");
+  auto literal       = cudf::ast::literal(literal_value);
+
+  auto expression = cudf::ast::expression(cudf::ast::ast_operator::LESS, col_ref_0, literal);
+
+  auto expected = column_wrapper<bool>{true, true, false, false};
+  auto result   = cudf::ast::compute_column(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), true);
+}
+
+TEST_F(TransformTest, StringEqualityWithNulls)
+{
+  auto c_0   = cudf::test::strings_column_wrapper({"x", "y", "x", ""}, {1, 1, 0, 1});
+  auto c_1   = column_wrapper<int32_t>{1, 2, 3, 4};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto col_ref_1     = cudf::ast::column_reference(1);
+  auto literal_value = cudf::string_scalar("x");
+  auto literal       = cudf::ast::literal(literal_value);
+  auto ten_value     = cudf::numeric_scalar<int32_t>(10);
+  auto ten           = cudf::ast::literal(ten_value);
+
+  // name = 'x' AND c_1 < 10
+  auto is_x       = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, col_ref_0, literal);
+  auto is_small   = cudf::ast::expression(cudf::ast::ast_operator::LESS, col_ref_1, ten);
+  auto expression = cudf::ast::expression(cudf::ast::ast_operator::LOGICAL_AND, is_x, is_small);
+
+  auto expected = column_wrapper<bool>{{true, false, false, false}, {1, 1, 0, 1}};
+  auto result   = cudf::ast::compute_column(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), true);
+}
+
+TEST_F(TransformTest, StringOutputFailure)
+{
+  auto c_0   = cudf::test::strings_column_wrapper({"a", "bb", "ccc", "dddd"});
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto expression = cudf::ast::expression(cudf::ast::ast_operator::IDENTITY, col_ref_0);
+
+  EXPECT_THROW(cudf::ast::compute_column(table, expression), cudf::logic_error);
+}
+
 TEST_F(TransformTest, CopyColumn)
 {
   auto c_0   = column_wrapper<int32_t>{3, 0, 1, 50};
@@ -343,4 +395,319 @@ TEST_F(TransformTest, PyMod)
   cudf::test::expect_columns_equal(expected, result->view(), true);
 }
 
+TEST_F(TransformTest, NullPropagation)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 0, 1, 1}};
+  auto c_1   = column_wrapper<int32_t>{{10, 7, 20, 0}, {1, 1, 0, 1}};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(1);
+  auto expression = cudf::ast::expression(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+
+  auto result   = cudf::ast::compute_column(table, expression);
+  auto expected = column_wrapper<int32_t>{{13, 0, 0, 50}, {1, 0, 0, 1}};
+
+  cudf::test::expect_columns_equal(expected, result->view(), true);
+  EXPECT_EQ(result->null_count(), 2);
+}
+
+TEST_F(TransformTest, NullLiteral)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto literal_value = cudf::numeric_scalar<int32_t>(42, false);
+  auto literal       = cudf::ast::literal(literal_value);
+  auto expression    = cudf::ast::expression(cudf::ast::ast_operator::ADD, col_ref_0, literal);
+
+  auto result   = cudf::ast::compute_column(table, expression);
+  auto expected = column_wrapper<int32_t>{{0, 0, 0, 0}, {0, 0, 0, 0}};
+
+  cudf::test::expect_columns_equal(expected, result->view(), true);
+}
+
+TEST_F(TransformTest, IsNull)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 0, 1, 0}};
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto expression = cudf::ast::expression(cudf::ast::ast_operator::IS_NULL, col_ref_0);
+
+  auto result   = cudf::ast::compute_column(table, expression);
+  auto expected = column_wrapper<bool>{false, true, false, true};
+
+  cudf::test::expect_columns_equal(expected, result->view(), true);
+}
+
+TEST_F(TransformTest, NullEqual)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 0, 1, 0}};
+  auto c_1   = column_wrapper<int32_t>{{3, 7, 2, 0}, {1, 0, 1, 1}};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto expression =
+    cudf::ast::expression(cudf::ast::ast_operator::NULL_EQUAL, col_ref_0, col_ref_1);
+
+  auto result   = cudf::ast::compute_column(table, expression);
+  auto expected = column_wrapper<bool>{true, true, false, false};
+
+  cudf::test::expect_columns_equal(expected, result->view(), true);
+}
+
+TEST_F(TransformTest, Coalesce)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 0, 0, 1}};
+  auto c_1   = column_wrapper<int32_t>{{10, 7, 20, 0}, {1, 1, 0, 0}};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(1);
+  auto expression = cudf::ast::expression(cudf::ast::ast_operator::COALESCE, col_ref_0, col_ref_1);
+
+  auto result   = cudf::ast::compute_column(table, expression);
+  auto expected = column_wrapper<int32_t>{{3, 7, 0, 50}, {1, 1, 0, 1}};
+
+  cudf::test::expect_columns_equal(expected, result->view(), true);
+}
+
+TEST_F(TransformTest, IfElse)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 1, 0, 1}};
+  auto c_1   = column_wrapper<int32_t>{{10, 7, 20, 0}, {1, 0, 1, 1}};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(1);
+  auto condition  = cudf::ast::expression(cudf::ast::ast_operator::LESS, col_ref_0, col_ref_1);
+  auto expression = cudf::ast::expression(
+    cudf::ast::ast_operator::IF_ELSE, condition, col_ref_0, col_ref_1);
+
+  auto result = cudf::ast::compute_column(table, expression);
+  // A null condition selects the else operand
+  auto expected = column_wrapper<int32_t>{{3, 7, 20, 0}, {1, 0, 1, 1}};
+
+  cudf::test::expect_columns_equal(expected, result->view(), true);
+}
+
+TEST_F(TransformTest, CaseWhen)
+{
+  auto c_0   = column_wrapper<int32_t>{-5, 0, 7, 50};
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0   = cudf::ast::column_reference(0);
+  auto zero_value  = cudf::numeric_scalar<int32_t>(0);
+  auto ten_value   = cudf::numeric_scalar<int32_t>(10);
+  auto minus_value = cudf::numeric_scalar<int32_t>(-1);
+  auto one_value   = cudf::numeric_scalar<int32_t>(1);
+  auto zero        = cudf::ast::literal(zero_value);
+  auto ten         = cudf::ast::literal(ten_value);
+  auto minus_one   = cudf::ast::literal(minus_value);
+  auto one         = cudf::ast::literal(one_value);
+
+  // CASE WHEN c_0 < 0 THEN -1 WHEN c_0 < 10 THEN c_0 ELSE 1 END
+  auto is_negative = cudf::ast::expression(cudf::ast::ast_operator::LESS, col_ref_0, zero);
+  auto is_small    = cudf::ast::expression(cudf::ast::ast_operator::LESS, col_ref_0, ten);
+  auto inner = cudf::ast::expression(cudf::ast::ast_operator::IF_ELSE, is_small, col_ref_0, one);
+  auto expression =
+    cudf::ast::expression(cudf::ast::ast_operator::IF_ELSE, is_negative, minus_one, inner);
+
+  auto result   = cudf::ast::compute_column(table, expression);
+  auto expected = column_wrapper<int32_t>{-1, 0, 7, 1};
+
+  cudf::test::expect_columns_equal(expected, result->view(), true);
+  cudf::test::expect_columns_equal(
+    expected, cudf::ast::compute_column_jit(table, expression)->view(), true);
+}
+
+TEST_F(TransformTest, IfElseNonBooleanConditionFailure)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto expression = cudf::ast::expression(
+    cudf::ast::ast_operator::IF_ELSE, col_ref_0, col_ref_0, col_ref_0);
+
+  EXPECT_THROW(cudf::ast::compute_column(table, expression), cudf::logic_error);
+}
+
+TEST_F(TransformTest, CommonSubexpressionElimination)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+
+  // (c_0 * c_1 + c_0 * c_1) * (c_0 * c_1), with distinct but equal product nodes
+  auto product      = cudf::ast::expression(cudf::ast::ast_operator::MUL, col_ref_0, col_ref_1);
+  auto product_copy = cudf::ast::expression(cudf::ast::ast_operator::MUL, col_ref_0, col_ref_1);
+  auto sum = cudf::ast::expression(cudf::ast::ast_operator::ADD, product, product_copy);
+  auto expression_tree = cudf::ast::expression(cudf::ast::ast_operator::MUL, sum, product);
+
+  auto const expr_linearizer = cudf::ast::detail::linearizer(expression_tree, table);
+  EXPECT_EQ(expr_linearizer.operators().size(), 3u);
+  EXPECT_EQ(expr_linearizer.intermediate_count(), 2);
+
+  auto expected = column_wrapper<int32_t>{1800, 39200, 800, 0};
+  cudf::test::expect_columns_equal(
+    expected, cudf::ast::compute_column(table, expression_tree)->view(), true);
+  cudf::test::expect_columns_equal(
+    expected, cudf::ast::compute_column_jit(table, expression_tree)->view(), true);
+}
+
+TEST_F(TransformTest, CastMixedTypes)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto c_1   = column_wrapper<double>{0.5, 1.5, -2.0, 0.25};
+  auto c_2   = column_wrapper<int64_t>{1, 2, 3, 4};
+  auto table = cudf::table_view{{c_0, c_1, c_2}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto col_ref_2 = cudf::ast::column_reference(2);
+
+  // c_0 * c_1 - c_2, fused into one kernel by casting every operand to double
+  auto cast_0  = cudf::ast::expression(cudf::ast::ast_operator::CAST_TO_FLOAT64, col_ref_0);
+  auto cast_2  = cudf::ast::expression(cudf::ast::ast_operator::CAST_TO_FLOAT64, col_ref_2);
+  auto product = cudf::ast::expression(cudf::ast::ast_operator::MUL, cast_0, col_ref_1);
+  auto expression_tree = cudf::ast::expression(cudf::ast::ast_operator::SUB, product, cast_2);
+
+  auto expected = column_wrapper<double>{0.5, 28.0, -5.0, 8.5};
+  cudf::test::expect_columns_equal(
+    expected, cudf::ast::compute_column(table, expression_tree)->view(), true);
+  cudf::test::expect_columns_equal(
+    expected, cudf::ast::compute_column_jit(table, expression_tree)->view(), true);
+}
+
+TEST_F(TransformTest, CastToIntegers)
+{
+  auto c_0   = column_wrapper<double>{2.9, -2.9, 0.0, 7.5};
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto to_int64  = cudf::ast::expression(cudf::ast::ast_operator::CAST_TO_INT64, col_ref_0);
+  auto to_uint64 = cudf::ast::expression(cudf::ast::ast_operator::CAST_TO_UINT64, to_int64);
+
+  auto expected_int64 = column_wrapper<int64_t>{2, -2, 0, 7};
+  cudf::test::expect_columns_equal(
+    expected_int64, cudf::ast::compute_column(table, to_int64)->view(), true);
+
+  auto expected_uint64 = column_wrapper<uint64_t>{2, static_cast<uint64_t>(-2), 0, 7};
+  cudf::test::expect_columns_equal(
+    expected_uint64, cudf::ast::compute_column(table, to_uint64)->view(), true);
+}
+
+TEST_F(TransformTest, JitMultiLevelTreeArithmetic)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto c_2   = column_wrapper<int32_t>{-3, 66, 2, -99};
+  auto table = cudf::table_view{{c_0, c_1, c_2}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto col_ref_2 = cudf::ast::column_reference(2);
+
+  auto expression_left_subtree =
+    cudf::ast::expression(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+
+  auto expression_right_subtree =
+    cudf::ast::expression(cudf::ast::ast_operator::SUB, col_ref_2, col_ref_0);
+
+  auto expression_tree = cudf::ast::expression(
+    cudf::ast::ast_operator::ADD, expression_left_subtree, expression_right_subtree);
+
+  auto result   = cudf::ast::compute_column_jit(table, expression_tree);
+  auto expected = column_wrapper<int32_t>{7, 73, 22, -99};
+
+  cudf::test::expect_columns_equal(expected, result->view(), true);
+}
+
+TEST_F(TransformTest, JitLiteralComparison)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+
+  // Expressions differing only in their literal values share a kernel
+  for (int32_t value : {41, 2}) {
+    auto literal_value = cudf::numeric_scalar<int32_t>(value);
+    auto literal       = cudf::ast::literal(literal_value);
+
+    auto expression = cudf::ast::expression(cudf::ast::ast_operator::GREATER, col_ref_0, literal);
+
+    auto result   = cudf::ast::compute_column_jit(table, expression);
+    auto expected = cudf::ast::compute_column(table, expression);
+
+    cudf::test::expect_columns_equal(expected->view(), result->view(), true);
+  }
+}
+
+TEST_F(TransformTest, JitMixedOperators)
+{
+  auto c_0   = column_wrapper<double>{3.0, 0.0, -1.0, -50.0};
+  auto c_1   = column_wrapper<int64_t>{7, -4, 13, 0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto col_ref_1     = cudf::ast::column_reference(1);
+  auto double_value  = cudf::numeric_scalar<double>(2.0);
+  auto double_lit    = cudf::ast::literal(double_value);
+  auto integer_value = cudf::numeric_scalar<int64_t>(3);
+  auto integer_lit   = cudf::ast::literal(integer_value);
+
+  auto pymod_0  = cudf::ast::expression(cudf::ast::ast_operator::PYMOD, col_ref_0, double_lit);
+  auto sin_0    = cudf::ast::expression(cudf::ast::ast_operator::SIN, pymod_0);
+  auto pymod_1  = cudf::ast::expression(cudf::ast::ast_operator::PYMOD, col_ref_1, integer_lit);
+  auto abs_1    = cudf::ast::expression(cudf::ast::ast_operator::ABS, pymod_1);
+  auto less     = cudf::ast::expression(cudf::ast::ast_operator::LESS, pymod_1, abs_1);
+  auto positive = cudf::ast::expression(cudf::ast::ast_operator::GREATER, sin_0, double_lit);
+  auto either   = cudf::ast::expression(cudf::ast::ast_operator::LOGICAL_OR, less, positive);
+
+  auto result   = cudf::ast::compute_column_jit(table, either);
+  auto expected = cudf::ast::compute_column(table, either);
+
+  cudf::test::expect_columns_equal(expected->view(), result->view(), true);
+}
+
+TEST_F(TransformTest, JitFallbackTimestamps)
+{
+  auto c_0   = column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{3, 20, 1, 50};
+  auto c_1   = column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{10, 7, 20, 0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(1);
+  auto expression = cudf::ast::expression(cudf::ast::ast_operator::LESS, col_ref_0, col_ref_1);
+
+  auto result   = cudf::ast::compute_column_jit(table, expression);
+  auto expected = column_wrapper<bool>{true, false, true, false};
+
+  cudf::test::expect_columns_equal(expected, result->view(), true);
+}
+
+TEST_F(TransformTest, JitFallbackNulls)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 0, 1, 1}};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(1);
+  auto expression = cudf::ast::expression(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+
+  auto result   = cudf::ast::compute_column_jit(table, expression);
+  auto expected = column_wrapper<int32_t>{{13, 0, 21, 50}, {1, 0, 1, 1}};
+
+  cudf::test::expect_columns_equal(expected, result->view(), true);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -23,6 +23,7 @@
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/types.hpp>
 #include <cudf/unary.hpp>
+#include <cudf/utilities/jit_cache.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <cudf_test/column_utilities.hpp>
@@ -33,6 +34,8 @@
 #include <tests/binaryop/binop-fixture.hpp>
 #include "cudf/utilities/error.hpp"
 
+#include <limits>
+
 namespace cudf {
 namespace test {
 namespace binop {
@@ -2013,6 +2016,106 @@ TEST_F(BinaryOperationIntegrationTest, ATan2_Vector_Vector_FP64_SI32_SI64)
   ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, ATAN2(), NearEqualComparator<TypeOut>{2});
 }
 
+TEST_F(BinaryOperationIntegrationTest, Add_Vector_Vector_SI64_SI32_SI32_Widened)
+{
+  // The sum is computed in the common type of the output and the operands
+  auto lhs = fixed_width_column_wrapper<int32_t>{std::numeric_limits<int32_t>::max(), -1};
+  auto rhs = fixed_width_column_wrapper<int32_t>{1, std::numeric_limits<int32_t>::min()};
+  auto out =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::ADD, data_type(type_id::INT64));
+
+  auto expected = fixed_width_column_wrapper<int64_t>{2147483648L, -2147483649L};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*out, expected);
+}
+
+TEST_F(BinaryOperationIntegrationTest, BitwiseAnd_Vector_Scalar_B8_SI32_SI32)
+{
+  // Bitwise operators convert the operands to the output type first
+  auto lhs = fixed_width_column_wrapper<int32_t>{2, 1, 0, 3};
+  auto rhs = cudf::numeric_scalar<int32_t>(1);
+  auto out = cudf::binary_operation(
+    lhs, rhs, cudf::binary_operator::BITWISE_AND, data_type(type_id::BOOL8));
+
+  auto expected = fixed_width_column_wrapper<bool>{true, true, false, true};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*out, expected);
+}
+
+TEST_F(BinaryOperationIntegrationTest, Add_Scalar_Vector_TSS_DurationS_TSS)
+{
+  auto lhs = cudf::duration_scalar<cudf::duration_s>(cudf::duration_s{60}, true);
+  auto rhs = fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>(
+    {0, 100, 0}, {true, true, false});
+  auto out = cudf::binary_operation(
+    lhs, rhs, cudf::binary_operator::ADD, data_type(type_id::TIMESTAMP_SECONDS));
+
+  auto expected = fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>(
+    {60, 160, 0}, {true, true, false});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*out, expected);
+}
+
+TEST_F(BinaryOperationIntegrationTest, Sub_Vector_Vector_DurationMS_TSS_TSMS)
+{
+  auto lhs = fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{2, 5};
+  auto rhs = fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep>{500, 7000};
+  auto out = cudf::binary_operation(
+    lhs, rhs, cudf::binary_operator::SUB, data_type(type_id::DURATION_MILLISECONDS));
+
+  auto expected =
+    fixed_width_column_wrapper<cudf::duration_ms, cudf::duration_ms::rep>{1500, -2000};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*out, expected);
+}
+
+TEST_F(BinaryOperationIntegrationTest, ShiftLeft_Vector_Vector_SI32_SI32_SI32_NotPrecompiled)
+{
+  // Operators without a precompiled kernel are computed by the JIT kernels
+  auto lhs = fixed_width_column_wrapper<int32_t>{1, 3, 5};
+  auto rhs = fixed_width_column_wrapper<int32_t>{1, 2, 3};
+  auto out = cudf::binary_operation(
+    lhs, rhs, cudf::binary_operator::SHIFT_LEFT, data_type(type_id::INT32));
+
+  auto expected = fixed_width_column_wrapper<int32_t>{2, 12, 40};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*out, expected);
+}
+
+TEST_F(BinaryOperationIntegrationTest, PrewarmJitKernels)
+{
+  auto const int32_type = data_type(type_id::INT32);
+  cudf::reset_jit_cache_statistics();
+
+  // ADD is precompiled and skipped, SHIFT_LEFT has three JIT kernels
+  cudf::prewarm_binary_operations(
+    {{cudf::binary_operator::ADD, int32_type, int32_type, int32_type},
+     {cudf::binary_operator::SHIFT_LEFT, int32_type, int32_type, int32_type}});
+  EXPECT_EQ(cudf::get_jit_cache_statistics().lookups, 3u);
+
+  auto lhs = fixed_width_column_wrapper<int32_t>{1, 3, 5};
+  auto rhs = fixed_width_column_wrapper<int32_t>{1, 2, 3};
+  cudf::binary_operation(lhs, rhs, cudf::binary_operator::SHIFT_LEFT, int32_type);
+
+  // The prewarmed kernel is not missed again
+  auto const statistics = cudf::get_jit_cache_statistics();
+  EXPECT_EQ(statistics.lookups, 4u);
+  EXPECT_LE(statistics.misses, 3u);
+}
+
+TEST_F(BinaryOperationIntegrationTest, PrewarmJitKernelsAsync)
+{
+  auto const int64_type = data_type(type_id::INT64);
+  cudf::reset_jit_cache_statistics();
+
+  auto prewarmed = cudf::prewarm_binary_operations_async(
+    {{cudf::binary_operator::SHIFT_RIGHT, int64_type, int64_type, int64_type},
+     {cudf::binary_operator::SHIFT_RIGHT_UNSIGNED, int64_type, int64_type, int64_type}});
+  prewarmed.get();
+  EXPECT_EQ(cudf::get_jit_cache_statistics().lookups, 6u);
+
+  auto lhs = fixed_width_column_wrapper<int64_t>{8, 16, 32};
+  auto rhs = fixed_width_column_wrapper<int64_t>{1, 2, 3};
+  auto out = cudf::binary_operation(lhs, rhs, cudf::binary_operator::SHIFT_RIGHT, int64_type);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*out, fixed_width_column_wrapper<int64_t>{4, 4, 4});
+  EXPECT_LE(cudf::get_jit_cache_statistics().misses, 6u);
+}
+
 template <typename T>
 struct FixedPointTestBothReps : public cudf::test::BaseFixture {
 };
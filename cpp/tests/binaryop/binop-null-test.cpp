@@ -18,8 +18,11 @@
  */
 
 #include <cudf/binaryop.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
 
+#include <cudf_test/column_utilities.hpp>
+
 #include <tests/binaryop/assert-binops.h>
 #include <tests/binaryop/binop-fixture.hpp>
 
@@ -192,6 +195,32 @@ TEST_F(BinaryOperationNullTest, Vector_NonNullable_Vector_NonNullable)
   ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, ADD());
 }
 
+TEST_F(BinaryOperationNullTest, Vector_Null_Vector_Valid_Preallocated)
+{
+  using TypeOut = int32_t;
+  using TypeLhs = int32_t;
+  using TypeRhs = int32_t;
+
+  auto lhs = make_random_wrapped_column<TypeLhs>(100, mask_state::ALL_NULL);
+  auto rhs = make_random_wrapped_column<TypeRhs>(100, mask_state::ALL_VALID);
+
+  auto const out_type = data_type(type_to_id<TypeOut>());
+  auto expected       = cudf::binary_operation(lhs, rhs, cudf::binary_operator::ADD, out_type);
+
+  auto out      = cudf::make_fixed_width_column(out_type, 100, mask_state::UNINITIALIZED);
+  auto out_view = out->mutable_view();
+  cudf::binary_operation(lhs, rhs, cudf::binary_operator::ADD, out_view);
+
+  EXPECT_EQ(100, out_view.null_count());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, out_view);
+
+  // the output must have a null mask since lhs has nulls
+  auto not_nullable      = cudf::make_fixed_width_column(out_type, 100);
+  auto not_nullable_view = not_nullable->mutable_view();
+  EXPECT_THROW(cudf::binary_operation(lhs, rhs, cudf::binary_operator::ADD, not_nullable_view),
+               cudf::logic_error);
+}
+
 }  // namespace binop
 }  // namespace test
 }  // namespace cudf
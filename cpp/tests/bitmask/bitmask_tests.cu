@@ -15,6 +15,7 @@
  */
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
@@ -550,4 +551,33 @@ TEST_F(MergeBitmaskTest, TestBitmaskOr)
   EXPECT_EQ(nullptr, result3.data());
 }
 
+TEST_F(MergeBitmaskTest, TestBitmaskNullCount)
+{
+  // sliced inputs whose size is not a multiple of the word size
+  constexpr cudf::size_type num_rows = 1000;
+  auto values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto valid1 = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  auto valid2 = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(values, values + num_rows, valid1);
+  cudf::test::fixed_width_column_wrapper<int32_t> col2(values, values + num_rows, valid2);
+  auto const input = cudf::slice(cudf::table_view({col1, col2}), {7, 7 + 901}).front();
+
+  auto const and_result = cudf::detail::bitmask_and(input, rmm::cuda_stream_default);
+  EXPECT_EQ(and_result.second,
+            cudf::count_unset_bits(
+              static_cast<cudf::bitmask_type const*>(and_result.first.data()), 0, 901));
+
+  auto const or_result = cudf::detail::bitmask_or(input, rmm::cuda_stream_default);
+  EXPECT_EQ(or_result.second,
+            cudf::count_unset_bits(
+              static_cast<cudf::bitmask_type const*>(or_result.first.data()), 0, 901));
+
+  // no nullable columns gives no mask and no nulls
+  cudf::test::fixed_width_column_wrapper<int32_t> col3(values, values + num_rows);
+  auto const no_nulls =
+    cudf::detail::bitmask_and(cudf::table_view({col3}), rmm::cuda_stream_default);
+  EXPECT_EQ(nullptr, no_nulls.first.data());
+  EXPECT_EQ(0, no_nulls.second);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
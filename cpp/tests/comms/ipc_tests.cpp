@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/comms/ipc.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <rmm/mr/device/cuda_memory_resource.hpp>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+// CUDA IPC handles cannot be opened by the process that created them, so only the exporting side
+// is tested here
+struct IpcTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(IpcTest, PackedTableIsShared)
+{
+  fixed_width_column_wrapper<int32_t> col0({1, 2, 3, 4}, {1, 0, 1, 1});
+  strings_column_wrapper col1({"a", "bb", "", "dddd"});
+  rmm::mr::cuda_memory_resource cuda_mr;
+  auto const packed = cudf::pack(cudf::table_view{{col0, col1}}, &cuda_mr);
+
+  auto const exported = cudf::comms::export_ipc(cudf::unpack(packed));
+  EXPECT_FALSE(exported.is_copy());
+  EXPECT_GT(exported.message().size(), packed.metadata_->size());
+}
+
+TEST_F(IpcTest, SlicedTableIsCopied)
+{
+  fixed_width_column_wrapper<int32_t> col0({1, 2, 3, 4});
+  strings_column_wrapper col1({"a", "bb", "", "dddd"});
+  auto const sliced = cudf::slice(cudf::table_view{{col0, col1}}, {1, 3})[0];
+
+  auto const exported = cudf::comms::export_ipc(sliced);
+  EXPECT_TRUE(exported.is_copy());
+}
+
+TEST_F(IpcTest, EmptyTable)
+{
+  fixed_width_column_wrapper<int32_t> col0{};
+  auto const exported = cudf::comms::export_ipc(cudf::table_view{{col0}});
+  EXPECT_FALSE(exported.is_copy());
+}
+
+TEST_F(IpcTest, InvalidMessage)
+{
+  EXPECT_THROW(cudf::comms::import_ipc(std::vector<uint8_t>(8)), cudf::logic_error);
+}
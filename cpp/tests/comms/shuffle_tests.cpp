@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/comms/shuffle.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+namespace {
+
+// Transport of a group whose ranks all hold the same rows, so that each rank receives from every
+// rank the partition it sent to itself
+class mirror_transport : public cudf::comms::shuffle_transport {
+ public:
+  mirror_transport(int num_ranks) : num_ranks_{num_ranks} {}
+
+  int rank() const override { return 0; }
+  int num_ranks() const override { return num_ranks_; }
+  std::vector<cudf::packed_columns> all_to_all(std::vector<cudf::packed_columns>&& partitions,
+                                               rmm::cuda_stream_view) override
+  {
+    ++num_exchanges;
+    std::vector<cudf::packed_columns> received;
+    for (int r = 0; r < num_ranks_; ++r) {
+      auto const& own = partitions[rank()];
+      std::vector<uint8_t> metadata(own.metadata_->data(),
+                                    own.metadata_->data() + own.metadata_->size());
+      received.push_back(
+        cudf::packed_columns{std::make_unique<cudf::packed_columns::metadata>(std::move(metadata)),
+                             std::make_unique<rmm::device_buffer>(own.gpu_data->data(),
+                                                                  own.gpu_data->size())});
+    }
+    return received;
+  }
+  int64_t all_reduce_max(int64_t value) override { return value; }
+
+  int num_exchanges = 0;
+
+ private:
+  int num_ranks_;
+};
+
+}  // namespace
+
+class ShuffleTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ShuffleTest, Loopback)
+{
+  fixed_width_column_wrapper<int32_t> keys({5, 1, 9, 3, 7, 2, 8, 4, 6, 0},
+                                           {1, 1, 0, 1, 1, 1, 1, 0, 1, 1});
+  strings_column_wrapper values({"5", "1", "9", "3", "7", "2", "8", "4", "6", "0"});
+  auto input = cudf::table_view({keys, values});
+
+  cudf::comms::loopback_transport transport;
+  auto const result =
+    cudf::comms::shuffle(input, cudf::comms::hash_partitioner({0}), transport, 3);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::sort(input)->view(), cudf::sort(result->view())->view());
+}
+
+TEST_F(ShuffleTest, ReceivesOwnPartitionFromEachRank)
+{
+  auto const size = 1000;
+  auto rows       = thrust::make_counting_iterator(0);
+  fixed_width_column_wrapper<int32_t> keys(rows, rows + size);
+  auto input = cudf::table_view({keys});
+
+  mirror_transport transport(3);
+  auto const result =
+    cudf::comms::shuffle(input, cudf::comms::hash_partitioner({0}), transport, 300);
+  EXPECT_EQ(4, transport.num_exchanges);
+
+  // Every rank sent the rows of partition 0 of each chunk, so expect them three times
+  std::vector<std::unique_ptr<cudf::table>> partitioned_chunks;
+  std::vector<cudf::table_view> expected;
+  for (cudf::size_type begin = 0; begin < size; begin += 300) {
+    auto const chunk = cudf::slice(input, {begin, std::min(begin + 300, size)}).front();
+    auto partitioned = cudf::hash_partition(chunk, {0}, 3);
+    auto const own   = cudf::slice(partitioned.first->view(), {0, partitioned.second[1]}).front();
+    expected.insert(expected.end(), 3, own);
+    partitioned_chunks.push_back(std::move(partitioned.first));
+  }
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::sort(cudf::concatenate(expected)->view())->view(),
+                                cudf::sort(result->view())->view());
+}
+
+TEST_F(ShuffleTest, EmptyInput)
+{
+  fixed_width_column_wrapper<int32_t> keys({});
+  auto input = cudf::table_view({keys});
+
+  cudf::comms::loopback_transport transport;
+  auto const result = cudf::comms::shuffle(input, cudf::comms::hash_partitioner({0}), transport);
+
+  EXPECT_EQ(0, result->num_rows());
+  EXPECT_EQ(1, result->num_columns());
+}
+
+TEST_F(ShuffleTest, InvalidChunkRows)
+{
+  fixed_width_column_wrapper<int32_t> keys({1, 2, 3});
+  auto input = cudf::table_view({keys});
+
+  cudf::comms::loopback_transport transport;
+  EXPECT_THROW(cudf::comms::shuffle(input, cudf::comms::hash_partitioner({0}), transport, 0),
+               cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+namespace {
+
+constexpr int num_threads = 8;
+constexpr int repetitions = 4;
+
+/**
+ * @brief Calls `fn` `repetitions` times on each of `num_threads` threads at once, and returns all
+ * the results. Rethrows the first exception thrown on a thread.
+ */
+template <typename Fn>
+std::vector<std::unique_ptr<cudf::table>> run_concurrently(Fn fn)
+{
+  std::vector<std::unique_ptr<cudf::table>> results(num_threads * repetitions);
+  std::vector<std::exception_ptr> errors(num_threads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&, t]() {
+      try {
+        for (int r = 0; r < repetitions; ++r) {
+          results[t * repetitions + r] = fn();
+        }
+      } catch (...) {
+        errors[t] = std::current_exception();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (auto const& error : errors) {
+    if (error) { std::rethrow_exception(error); }
+  }
+  return results;
+}
+
+std::vector<int32_t> make_keys(int32_t num_rows, int32_t num_keys)
+{
+  std::vector<int32_t> keys(num_rows);
+  for (int32_t i = 0; i < num_rows; ++i) {
+    keys[i] = (i * 7919) % num_keys;
+  }
+  return keys;
+}
+
+}  // namespace
+
+struct ConcurrentOperationsTest : public cudf::test::BaseFixture {
+  static constexpr int32_t num_rows = 10'000;
+};
+
+TEST_F(ConcurrentOperationsTest, InnerJoin)
+{
+  auto const left_keys  = make_keys(num_rows, 1000);
+  auto const right_keys = make_keys(num_rows / 2, 2000);
+  fixed_width_column_wrapper<int32_t> left_col(left_keys.begin(), left_keys.end());
+  fixed_width_column_wrapper<int32_t> right_col(right_keys.begin(), right_keys.end());
+  cudf::table_view const left({left_col});
+  cudf::table_view const right({right_col});
+
+  // the order of the joined rows is unspecified
+  std::vector<cudf::size_type> const on{0};
+  auto const join     = [&]() { return cudf::sort(cudf::inner_join(left, right, on, on)->view()); };
+  auto const expected = join();
+  for (auto const& result : run_concurrently(join)) {
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, *result);
+  }
+}
+
+TEST_F(ConcurrentOperationsTest, Groupby)
+{
+  auto const keys = make_keys(num_rows, 100);
+  std::vector<int64_t> values(num_rows);
+  std::iota(values.begin(), values.end(), 0);
+  fixed_width_column_wrapper<int32_t> keys_col(keys.begin(), keys.end());
+  fixed_width_column_wrapper<int64_t> values_col(values.begin(), values.end());
+
+  auto const groupby = [&]() {
+    cudf::groupby::groupby gb{cudf::table_view{{keys_col}}};
+    std::vector<cudf::groupby::aggregation_request> requests(1);
+    requests[0].values = values_col;
+    requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+    auto result = gb.aggregate(requests);
+
+    // the order of the groups is unspecified
+    auto columns = result.first->release();
+    columns.push_back(std::move(result.second.front().results.front()));
+    cudf::table const grouped(std::move(columns));
+    return cudf::sort(grouped.view());
+  };
+  auto const expected = groupby();
+  for (auto const& result : run_concurrently(groupby)) {
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, *result);
+  }
+}
+
+TEST_F(ConcurrentOperationsTest, ReadParquet)
+{
+  auto const keys = make_keys(num_rows, 100);
+  std::vector<std::string> strings(num_rows);
+  std::transform(keys.begin(), keys.end(), strings.begin(), [](auto key) {
+    return std::to_string(key);
+  });
+  fixed_width_column_wrapper<int32_t> keys_col(keys.begin(), keys.end());
+  strings_column_wrapper strings_col(strings.begin(), strings.end());
+  cudf::table_view const expected({keys_col, strings_col});
+
+  std::vector<char> buffer;
+  cudf::io::write_parquet(
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&buffer}, expected).build());
+
+  auto const read = [&]() {
+    return cudf::io::read_parquet(cudf::io::parquet_reader_options::builder(
+                                    cudf::io::source_info{buffer.data(), buffer.size()})
+                                    .build())
+      .tbl;
+  };
+  for (auto const& result : run_concurrently(read)) {
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, *result);
+  }
+}
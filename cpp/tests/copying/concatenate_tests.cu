@@ -34,6 +34,7 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/sequence.h>
 
+#include <numeric>
 #include <string>
 
 template <typename T>
@@ -330,6 +331,28 @@ TEST_F(TableTest, ConcatenateTablesWithOffsetsAndNulls)
   }
 }
 
+TEST_F(TableTest, ConcatenateManySmallTables)
+{
+  constexpr cudf::size_type num_rows = 3000;
+  auto const sequence                = thrust::make_counting_iterator(0);
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  auto const strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 5, 'a' + i % 26); });
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(sequence, sequence + num_rows, valids);
+  cudf::test::strings_column_wrapper col2(strings, strings + num_rows, valids);
+  cudf::table_view const expected{{col1, col2}};
+
+  // concatenate one table per row
+  std::vector<cudf::size_type> splits(num_rows - 1);
+  std::iota(splits.begin(), splits.end(), 1);
+  auto const tables = cudf::split(expected, splits);
+  auto const result = cudf::concatenate(tables);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result->view(), expected);
+}
+
 TEST_F(TableTest, SizeOverflowTest)
 {
   // primitive column
@@ -1134,6 +1157,39 @@ TEST_F(ListsColumnTest, SlicedColumnsWithNulls)
   }
 }
 
+TEST_F(ListsColumnTest, ManySmallColumns)
+{
+  constexpr cudf::size_type num_rows = 3000;
+  auto const list_valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+
+  // null lists are empty, the others have `i % 4` elements
+  std::vector<cudf::size_type> offsets(num_rows + 1, 0);
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    offsets[i + 1] = offsets[i] + (list_valids[i] ? i % 4 : 0);
+  }
+  auto const sequence = thrust::make_counting_iterator(0);
+  auto const child_valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  cudf::test::fixed_width_column_wrapper<int32_t> child(
+    sequence, sequence + offsets.back(), child_valids);
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets_w(offsets.begin(), offsets.end());
+  auto const expected = cudf::make_lists_column(
+    num_rows,
+    offsets_w.release(),
+    child.release(),
+    cudf::UNKNOWN_NULL_COUNT,
+    cudf::test::detail::make_null_mask(list_valids, list_valids + num_rows));
+
+  // concatenate one column per row
+  std::vector<cudf::size_type> splits(num_rows - 1);
+  std::iota(splits.begin(), splits.end(), 1);
+  auto const result = cudf::concatenate(cudf::split(*expected, splits));
+
+  cudf::test::expect_columns_equivalent(*result, *expected);
+  EXPECT_EQ(result->null_count(), expected->null_count());
+}
+
 TEST_F(ListsColumnTest, ListOfStructs)
 {
   using namespace cudf::test;
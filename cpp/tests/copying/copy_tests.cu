@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -260,6 +260,28 @@ TYPED_TEST(CopyTest, CopyIfElseMixedInputValidity4)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(out->view(), expected_w);
 }
 
+TYPED_TEST(CopyTest, CopyIfElseIntoPreallocated)
+{
+  using T = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<bool> mask_w{{1, 0, 0, 0, 0, 0, 1}, {1, 1, 1, 1, 1, 1, 0}};
+
+  wrapper<T, int32_t> lhs_w({5, 5, 5, 5, 5, 5, 5}, {1, 1, 1, 1, 1, 1, 1});
+  wrapper<T, int32_t> rhs_w({6, 6, 6, 6, 6, 6, 6}, {1, 0, 0, 0, 0, 0, 1});
+  wrapper<T, int32_t> expected_w({5, 6, 6, 6, 6, 6, 6}, {1, 0, 0, 0, 0, 0, 1});
+
+  auto out      = cudf::allocate_like(lhs_w, cudf::mask_allocation_policy::ALWAYS);
+  auto out_view = out->mutable_view();
+  cudf::copy_if_else(lhs_w, rhs_w, mask_w, out_view);
+  EXPECT_EQ(5, out_view.null_count());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(out_view, expected_w);
+
+  // the output must have a null mask since the inputs have nulls
+  auto not_nullable      = cudf::allocate_like(lhs_w, cudf::mask_allocation_policy::NEVER);
+  auto not_nullable_view = not_nullable->mutable_view();
+  EXPECT_THROW(cudf::copy_if_else(lhs_w, rhs_w, mask_w, not_nullable_view), cudf::logic_error);
+}
+
 TYPED_TEST(CopyTest, CopyIfElseBadInputLength)
 {
   using T = TypeParam;
@@ -28,6 +28,9 @@
 
 #include <rmm/device_uvector.hpp>
 
+#include <string>
+#include <vector>
+
 class GatherTestStr : public cudf::test::BaseFixture {
 };
 
@@ -108,6 +111,41 @@ TEST_F(GatherTestStr, Gather)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view().column(0), expected);
 }
 
+TEST_F(GatherTestStr, GatherLongStrings)
+{
+  // long strings of any alignment, split between warps, with runs of empty and null rows
+  std::vector<std::string> h_strings(500);
+  for (std::size_t i = 0; i < h_strings.size(); ++i) {
+    auto const length = (i % 7 == 0) ? 0 : (i * 397) % 9001;
+    for (std::size_t c = 0; c < length; ++c) {
+      h_strings[i].push_back(static_cast<char>('a' + (i + c) % 26));
+    }
+  }
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  cudf::table_view source_table({strings});
+
+  std::vector<int32_t> h_map;
+  for (int32_t i = 0; i < 2000; ++i) {
+    h_map.push_back(i % 11 < 3 ? 600 : (i * 7919) % 500);
+  }
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(h_map.begin(), h_map.end());
+  auto results = cudf::detail::gather(source_table,
+                                      gather_map,
+                                      cudf::out_of_bounds_policy::NULLIFY,
+                                      cudf::detail::negative_index_policy::NOT_ALLOWED);
+
+  std::vector<std::string> h_expected;
+  std::vector<int32_t> expected_validity;
+  for (auto const index : h_map) {
+    auto const valid = index < static_cast<int32_t>(h_strings.size());
+    h_expected.push_back(valid ? h_strings[index] : "");
+    expected_validity.push_back(valid);
+  }
+  cudf::test::strings_column_wrapper expected(
+    h_expected.begin(), h_expected.end(), expected_validity.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view().column(0), expected);
+}
+
 TEST_F(GatherTestStr, GatherDontCheckOutOfBounds)
 {
   std::vector<const char*> h_strings{"eee", "bb", "", "aa", "bbb", "ééé"};
@@ -15,6 +15,7 @@
  */
 #include <tests/strings/utilities.h>
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/gather.cuh>
@@ -246,3 +247,74 @@ TYPED_TEST(GatherTest, MultiColNulls)
     CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_column, result->view().column(i));
   }
 }
+
+TYPED_TEST(GatherTest, NullableWithoutNulls)
+{
+  constexpr cudf::size_type source_size{1000};
+
+  auto data     = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto all_true = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return true; });
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 2; });
+
+  // The first column is nullable without nulls, the second one has nulls
+  cudf::test::fixed_width_column_wrapper<TypeParam> no_nulls(data, data + source_size, all_true);
+  cudf::test::fixed_width_column_wrapper<TypeParam> nulls(data, data + source_size, validity);
+
+  auto reversed_data =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return source_size - 1 - i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(reversed_data,
+                                                             reversed_data + source_size);
+
+  auto result = cudf::gather(cudf::table_view{{no_nulls, nulls}}, gather_map);
+
+  auto expect_data =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return source_size - i - 1; });
+  auto expect_valid =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return (i + 1) % 2; });
+  cudf::test::fixed_width_column_wrapper<TypeParam> expect_no_nulls(
+    expect_data, expect_data + source_size, all_true);
+  cudf::test::fixed_width_column_wrapper<TypeParam> expect_nulls(
+    expect_data, expect_data + source_size, expect_valid);
+
+  EXPECT_TRUE(result->view().column(0).nullable());
+  EXPECT_EQ(0, result->view().column(0).null_count());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_no_nulls, result->view().column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_nulls, result->view().column(1));
+}
+
+TYPED_TEST(GatherTest, IntoPreallocated)
+{
+  constexpr cudf::size_type source_size{1000};
+
+  auto data     = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 2; });
+
+  cudf::test::fixed_width_column_wrapper<TypeParam> no_nulls(data, data + source_size);
+  cudf::test::fixed_width_column_wrapper<TypeParam> nulls(data, data + source_size, validity);
+  cudf::table_view const source_table{{no_nulls, nulls}};
+
+  auto reversed_data =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return source_size - 1 - i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(reversed_data,
+                                                             reversed_data + source_size);
+
+  auto const expected = cudf::gather(source_table, gather_map);
+
+  auto const type = cudf::data_type{cudf::type_to_id<TypeParam>()};
+  auto out_no_nulls =
+    cudf::make_fixed_width_column(type, source_size, cudf::mask_state::UNINITIALIZED);
+  auto out_nulls =
+    cudf::make_fixed_width_column(type, source_size, cudf::mask_state::UNINITIALIZED);
+  cudf::mutable_table_view output{{out_no_nulls->mutable_view(), out_nulls->mutable_view()}};
+  cudf::gather(source_table, gather_map, output);
+
+  EXPECT_EQ(0, output.column(0).null_count());
+  EXPECT_EQ(source_size / 2, output.column(1).null_count());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected->view().column(0), output.column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view().column(1), output.column(1));
+
+  // the gathered rows of the second column can be null
+  auto not_nullable = cudf::make_fixed_width_column(type, source_size);
+  cudf::mutable_table_view bad_output{{out_no_nulls->mutable_view(), not_nullable->mutable_view()}};
+  EXPECT_THROW(cudf::gather(source_table, gather_map, bad_output), cudf::logic_error);
+}
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_wrapper.hpp>
@@ -421,5 +422,45 @@ TEST_F(PackUnpackTest, NestedEmpty)
 }
 // clang-format on
 
+TEST_F(PackUnpackTest, Compressed)
+{
+  cudf::size_type const num_rows = 200000;
+
+  auto const values =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  auto const strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 10, 'a' + i % 3); });
+  fixed_width_column_wrapper<int32_t> col1(values, values + num_rows, valids);
+  fixed_width_column_wrapper<double, int32_t> col2(values, values + num_rows);
+  strings_column_wrapper col3(strings, strings + num_rows, valids);
+  cudf::table_view t{{col1, col2, col3}};
+
+  auto const uncompressed = pack(t);
+  for (auto compression :
+       {pack_compression::SNAPPY, pack_compression::DEFLATE, pack_compression::ZSTD}) {
+    auto const packed = pack(t, compression);
+    EXPECT_LT(packed.gpu_data->size(), uncompressed.gpu_data->size());
+    EXPECT_THROW(unpack(packed), cudf::logic_error);
+
+    auto const decompressed = decompress_packed(packed);
+    EXPECT_EQ(uncompressed.metadata_->size(), decompressed.metadata_->size());
+    EXPECT_TRUE(std::equal(decompressed.metadata_->data(),
+                           decompressed.metadata_->data() + decompressed.metadata_->size(),
+                           uncompressed.metadata_->data()));
+    cudf::test::expect_tables_equal(t, unpack(decompressed));
+  }
+}
+
+TEST_F(PackUnpackTest, CompressedEmpty)
+{
+  fixed_width_column_wrapper<int32_t> col1{};
+  cudf::table_view t{{col1}};
+
+  auto const packed = pack(t, pack_compression::SNAPPY);
+  cudf::test::expect_tables_equal(t, unpack(decompress_packed(packed)));
+}
+
 }  // namespace test
 }  // namespace cudf
@@ -27,6 +27,9 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
+#include <algorithm>
+#include <functional>
+
 struct SampleTest : public cudf::test::BaseFixture {
 };
 
@@ -82,6 +85,51 @@ TEST_F(SampleTest, TestReproducibilityWithSeed)
   }
 }
 
+TEST_F(SampleTest, SmallSampleWithoutReplacement)
+{
+  cudf::size_type const table_size = 100000;
+  cudf::size_type const n_samples  = 100;
+  auto data = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(data, data + table_size);
+
+  cudf::table_view input({col1});
+  for (int i = 0; i < 10; i++) {
+    auto out_table = cudf::sample(input, n_samples, cudf::sample_with_replacement::FALSE, i);
+    ASSERT_EQ(out_table->num_rows(), n_samples);
+
+    // the sampled rows are distinct
+    auto const sorted_out = cudf::sort(out_table->view());
+    auto const values     = cudf::test::to_host<int32_t>(sorted_out->get_column(0)).first;
+    EXPECT_TRUE(std::adjacent_find(values.begin(), values.end()) == values.end());
+  }
+
+  auto const expected = cudf::sample(input, n_samples, cudf::sample_with_replacement::FALSE, 1);
+  auto const out      = cudf::sample(input, n_samples, cudf::sample_with_replacement::FALSE, 1);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), out->view());
+}
+
+TEST_F(SampleTest, BernoulliSample)
+{
+  cudf::size_type const table_size = 10000;
+  auto data = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(data, data + table_size);
+  cudf::table_view input({col1});
+
+  auto const out_table = cudf::bernoulli_sample(input, 0.1, 1);
+  // 1000 rows are expected, with a standard deviation of 30
+  EXPECT_GT(out_table->num_rows(), 800);
+  EXPECT_LT(out_table->num_rows(), 1200);
+
+  // the sampled rows are distinct and in the order of the input
+  auto const values = cudf::test::to_host<int32_t>(out_table->get_column(0)).first;
+  EXPECT_TRUE(std::is_sorted(values.begin(), values.end(), std::less_equal<int32_t>{}));
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(out_table->view(), cudf::bernoulli_sample(input, 0.1, 1)->view());
+  EXPECT_EQ(cudf::bernoulli_sample(input, 0.0, 1)->num_rows(), 0);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, cudf::bernoulli_sample(input, 1.0, 1)->view());
+  EXPECT_THROW(cudf::bernoulli_sample(input, 1.5, 1), cudf::logic_error);
+}
+
 struct SampleBasicTest : public SampleTest,
                          public ::testing::WithParamInterface<
                            std::tuple<cudf::size_type, cudf::sample_with_replacement>> {
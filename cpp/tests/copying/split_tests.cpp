@@ -1807,3 +1807,70 @@ TEST_F(ContiguousSplitNestedTypesTest, ListOfStruct)
     cudf::test::expect_columns_equivalent(expected[index], result[index].table.column(0));
   }
 }
+
+struct ChunkedContiguousSplitTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ChunkedContiguousSplitTest, PackIntoBounceBuffers)
+{
+  cudf::size_type const num_rows = 1000;
+
+  auto const values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto const strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 5, 'a' + i % 26); });
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(values, values + num_rows, valids);
+  cudf::test::fixed_width_column_wrapper<double, int32_t> col2(values, values + num_rows);
+  cudf::test::strings_column_wrapper col3(strings, strings + num_rows, valids);
+  cudf::table_view input{{col1, col2, col3}};
+  std::vector<cudf::size_type> splits{0, 10, 400, 401, 700};
+
+  std::vector<rmm::device_buffer> bounce_buffers;
+  bounce_buffers.emplace_back(8192, rmm::cuda_stream_default);
+  bounce_buffers.emplace_back(8192, rmm::cuda_stream_default);
+  std::vector<cudf::device_span<uint8_t>> buffers;
+  for (auto& buffer : bounce_buffers) {
+    buffers.emplace_back(static_cast<uint8_t*>(buffer.data()), buffer.size());
+  }
+
+  // rebuild the contiguous buffer of each partition from its regions
+  std::vector<rmm::device_buffer> partitions(splits.size() + 1);
+  std::size_t num_packed_buffers = 0;
+  auto const metadata            = cudf::chunked_contiguous_split(
+    input, splits, buffers, [&](std::size_t buffer_index, auto const& regions) {
+      EXPECT_EQ(num_packed_buffers++ % buffers.size(), buffer_index);
+      for (auto const& region : regions) {
+        auto& partition = partitions[region.partition];
+        if (partition.size() != region.partition_size) {
+          partition = rmm::device_buffer(region.partition_size, rmm::cuda_stream_default);
+        }
+        CUDA_TRY(cudaMemcpy(static_cast<uint8_t*>(partition.data()) + region.partition_offset,
+                            buffers[buffer_index].data() + region.buffer_offset,
+                            region.size,
+                            cudaMemcpyDeviceToDevice));
+      }
+    });
+  EXPECT_GT(num_packed_buffers, buffers.size());
+
+  auto const expected = cudf::contiguous_split(input, splits);
+  ASSERT_EQ(expected.size(), metadata.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    auto const result =
+      cudf::unpack(metadata[i].data(), static_cast<uint8_t const*>(partitions[i].data()));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected[i].table, result);
+  }
+}
+
+TEST_F(ChunkedContiguousSplitTest, BufferTooSmall)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> col{{1, 2, 3, 4, 5, 6, 7, 8, 9, 10}};
+  cudf::table_view input{{col}};
+
+  rmm::device_buffer bounce_buffer(64, rmm::cuda_stream_default);
+  std::vector<cudf::device_span<uint8_t>> buffers{
+    {static_cast<uint8_t*>(bounce_buffer.data()), bounce_buffer.size()}};
+
+  EXPECT_THROW(cudf::chunked_contiguous_split(input, {}, buffers, [](auto, auto const&) {}),
+               cudf::logic_error);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,7 @@
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
 #include <cudf_test/timestamp_utilities.cuh>
 #include <cudf_test/type_lists.hpp>
 
@@ -59,6 +60,9 @@ TYPED_TEST(NonTimestampTest, TestThrowsOnNonTimestamp)
     add_calendrical_months(
       col, cudf::column{cudf::data_type{cudf::type_id::INT16}, 0, rmm::device_buffer{0}}),
     cudf::logic_error);
+  EXPECT_THROW(convert_utc_to_timezone(col, "America/Los_Angeles"), cudf::logic_error);
+  EXPECT_THROW(extract_datetime_components(col, {datetime_component::YEAR}), cudf::logic_error);
+  EXPECT_THROW(convert_timezone(col, "America/Los_Angeles", "UTC"), cudf::logic_error);
 }
 
 struct BasicDatetimeOpsTest : public cudf::test::BaseFixture {
@@ -169,6 +173,9 @@ TYPED_TEST(TypedDatetimeOpsTest, TestEmptyColumns)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*extract_hour(timestamps), int16s);
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*extract_minute(timestamps), int16s);
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*extract_second(timestamps), int16s);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(
+    *extract_datetime_components(timestamps, {datetime_component::YEAR, datetime_component::DAY}),
+    cudf::table_view({int16s, int16s}));
 }
 
 TYPED_TEST(TypedDatetimeOpsTest, TestExtractingGeneratedDatetimeComponents)
@@ -262,6 +269,25 @@ TYPED_TEST(TypedDatetimeOpsTest, TestExtractingGeneratedNullableDatetimeComponen
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*extract_hour(timestamps), expected_hours);
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*extract_minute(timestamps), expected_minutes);
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*extract_second(timestamps), expected_seconds);
+
+  auto const components = extract_datetime_components(timestamps,
+                                                      {datetime_component::SECOND,
+                                                       datetime_component::YEAR,
+                                                       datetime_component::MONTH,
+                                                       datetime_component::DAY,
+                                                       datetime_component::WEEKDAY,
+                                                       datetime_component::HOUR,
+                                                       datetime_component::MINUTE,
+                                                       datetime_component::YEAR});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*components,
+                                cudf::table_view({expected_seconds,
+                                                  expected_years,
+                                                  expected_months,
+                                                  expected_days,
+                                                  expected_weekdays,
+                                                  expected_hours,
+                                                  expected_minutes,
+                                                  expected_years}));
 }
 
 TEST_F(BasicDatetimeOpsTest, TestLastDayOfMonthWithSeconds)
@@ -533,4 +559,73 @@ TEST_F(BasicDatetimeOpsTest, TestAddMonthsWithSecondsAndNullValues)
     true);
 }
 
+TEST_F(BasicDatetimeOpsTest, TestConvertUtcToTimezone)
+{
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+  using namespace cuda::std::chrono;
+
+  auto timestamps_s =
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+      {1577836800L,  // 2020-01-01 00:00:00 GMT
+       1593561600L,  // 2020-07-01 00:00:00 GMT
+       0L,
+       4102444800L},  // 2100-01-01 00:00:00 GMT - past the transitions in the TZif file
+      {true, true, false, true}};
+
+  // Repeated calls reuse the cached transition table
+  for (int i = 0; i < 2; ++i) {
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      *convert_utc_to_timezone(timestamps_s, "America/Los_Angeles"),
+      cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+        {1577808000L,  // 2019-12-31 16:00:00 PST
+         1593536400L,  // 2020-06-30 17:00:00 PDT
+         0L,
+         4102416000L},  // 2099-12-31 16:00:00 PST
+        {true, true, false, true}});
+  }
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*convert_utc_to_timezone(timestamps_s, "UTC"), timestamps_s);
+}
+
+TEST_F(BasicDatetimeOpsTest, TestConvertTimezone)
+{
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+  using namespace cuda::std::chrono;
+
+  auto timestamps_s =
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+      {1577836800L,  // 2020-01-01 00:00:00 PST
+       1593561600L,  // 2020-07-01 00:00:00 PDT
+       0L,
+       1604194200L,   // 2020-11-01 01:30:00 - occurs twice, taken as PDT
+       1583634600L},  // 2020-03-08 02:30:00 - skipped, taken as 03:30:00 PDT
+      {true, true, false, true, true}};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *convert_timezone(timestamps_s, "America/Los_Angeles", "UTC"),
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+      {1577865600L,  // 2020-01-01 08:00:00 GMT
+       1593586800L,  // 2020-07-01 07:00:00 GMT
+       0L,
+       1604219400L,   // 2020-11-01 08:30:00 GMT
+       1583663400L},  // 2020-03-08 10:30:00 GMT
+      {true, true, false, true, true}});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *convert_timezone(timestamps_s, "America/Los_Angeles", "America/New_York"),
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+      {1577847600L,  // 2020-01-01 03:00:00 EST
+       1593572400L,  // 2020-07-01 03:00:00 EDT
+       0L,
+       1604201400L,   // 2020-11-01 03:30:00 EST
+       1583649000L},  // 2020-03-08 06:30:00 EDT
+      {true, true, false, true, true}});
+
+  // From UTC, the conversion is the same as convert_utc_to_timezone
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*convert_timezone(timestamps_s, "UTC", "America/Los_Angeles"),
+                                 *convert_utc_to_timezone(timestamps_s, "America/Los_Angeles"));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
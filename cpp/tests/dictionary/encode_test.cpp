@@ -14,12 +14,15 @@
  * limitations under the License.
  */
 
+#include <cudf/detail/iterator.cuh>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/encode.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 
+#include <algorithm>
+#include <string>
 #include <vector>
 
 struct DictionaryEncodeTest : public cudf::test::BaseFixture {
@@ -69,6 +72,53 @@ TEST_F(DictionaryEncodeTest, EncodeWithNull)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.indices(), expected);
 }
 
+TEST_F(DictionaryEncodeTest, EncodeLowCardinality)
+{
+  auto const values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "key" + std::to_string((i * 7) % 13); });
+  cudf::test::strings_column_wrapper input(values, values + 1000);
+
+  auto dictionary = cudf::dictionary::encode(input, cudf::data_type{cudf::type_id::UINT8});
+  cudf::dictionary_column_view view(dictionary->view());
+
+  std::vector<std::string> keys;
+  for (int i = 0; i < 13; ++i) {
+    keys.push_back("key" + std::to_string(i));
+  }
+  std::sort(keys.begin(), keys.end());
+  cudf::test::strings_column_wrapper keys_expected(keys.begin(), keys.end());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.keys(), keys_expected);
+
+  auto const indices = cudf::detail::make_counting_transform_iterator(0, [&keys](auto i) {
+    auto const key = "key" + std::to_string((i * 7) % 13);
+    return std::distance(keys.begin(), std::lower_bound(keys.begin(), keys.end(), key));
+  });
+  cudf::test::fixed_width_column_wrapper<uint8_t> indices_expected(indices, indices + 1000);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.indices(), indices_expected);
+}
+
+TEST_F(DictionaryEncodeTest, EncodeAllNulls)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{{1, 2, 3}, {0, 0, 0}};
+
+  auto dictionary = cudf::dictionary::encode(input);
+  cudf::dictionary_column_view view(dictionary->view());
+
+  EXPECT_EQ(view.keys_size(), 0);
+  EXPECT_EQ(dictionary->null_count(), 3);
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected{0, 0, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.indices(), expected);
+}
+
+TEST_F(DictionaryEncodeTest, EncodeEmpty)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{};
+
+  auto dictionary = cudf::dictionary::encode(input);
+  EXPECT_EQ(dictionary->size(), 0);
+  EXPECT_EQ(dictionary->type().id(), cudf::type_id::DICTIONARY32);
+}
+
 TEST_F(DictionaryEncodeTest, InvalidEncode)
 {
   cudf::test::fixed_width_column_wrapper<int16_t> input{0, 1, 2, 3, -1, -2, -3};
@@ -428,6 +428,46 @@ TEST_F(FixedPointTest, OverflowDecimal64)
 #endif
 }
 
+TEST_F(FixedPointTest, Decimal128Math)
+{
+  using scaled = scaled_integer<__int128_t>;
+
+  // 10^20 and 10^-15 are outside of the range of decimal64 at a common scale
+  decimal128 const big{scaled{__int128_t{100000000000} * 1000000000, scale_type{0}}};
+  decimal128 const small{scaled{1, scale_type{-15}}};
+  decimal128 const one{1, scale_type{0}};
+
+  EXPECT_EQ(std::string(big), "100000000000000000000");
+  EXPECT_EQ(std::string(small), "0.000000000000001");
+  EXPECT_EQ(std::string(big + small), "100000000000000000000.000000000000001");
+  EXPECT_EQ(std::string(small - big), "-99999999999999999999.999999999999999");
+  EXPECT_EQ(big * small, decimal128(100000, scale_type{0}));
+  EXPECT_EQ(std::string(big * decimal128{1000000000000000000, scale_type{0}}),
+            "100000000000000000000000000000000000000");
+  EXPECT_EQ((big + one) / one, big + one);
+  EXPECT_TRUE(small < one);
+  EXPECT_TRUE(big > one);
+  EXPECT_EQ(static_cast<int64_t>(big / decimal128{100, scale_type{0}}), 1000000000000000000);
+  EXPECT_EQ(static_cast<double>(small), 1e-15);
+}
+
+TEST_F(FixedPointTest, Decimal128Rescaled)
+{
+  using scaled = scaled_integer<__int128_t>;
+
+  decimal128 const num{scaled{__int128_t{123456789012345678} * 1000, scale_type{-21}}};
+  EXPECT_EQ(std::string(num), "0.123456789012345678000");
+  EXPECT_EQ(std::string(num.rescaled(scale_type{-7})), "0.1234567");
+  EXPECT_EQ(num.rescaled(scale_type{-21}), num);
+}
+
+TEST_F(FixedPointTest, Decimal128HasNoColumnType)
+{
+  // decimal128 is only a value type, so it is not mapped to a column type
+  static_assert(cudf::type_to_id<decimal128>() == cudf::type_id::EMPTY);
+  static_assert(not cudf::is_fixed_point<decimal128>());
+}
+
 template <typename ValueType, typename Binop>
 void integer_vector_test(ValueType const initial_value,
                          int32_t const size,
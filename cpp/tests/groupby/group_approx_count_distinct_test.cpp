@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <cmath>
+#include <vector>
+
+namespace cudf {
+namespace test {
+template <typename V>
+struct groupby_approx_count_distinct_test : public cudf::test::BaseFixture {
+};
+
+using keys_col   = fixed_width_column_wrapper<int32_t>;
+using counts_col = fixed_width_column_wrapper<int64_t>;
+
+TYPED_TEST_CASE(groupby_approx_count_distinct_test, cudf::test::NumericTypes);
+
+TYPED_TEST(groupby_approx_count_distinct_test, basic)
+{
+  using V = TypeParam;
+
+  keys_col keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<V, int> vals{0, 1, 2, 3, 1, 5, 0, 2, 1, 1};
+
+  // {1: [0, 3, 0], 2: [1, 1, 5, 1], 3: [2, 2, 1]}
+  keys_col expect_keys{1, 2, 3};
+  counts_col expect_vals = std::is_same<V, bool>::value ? counts_col{2, 1, 1} : counts_col{2, 2, 2};
+
+  test_single_agg(
+    keys, vals, expect_keys, expect_vals, cudf::make_approx_count_distinct_aggregation());
+}
+
+TYPED_TEST(groupby_approx_count_distinct_test, null_values)
+{
+  using V = TypeParam;
+
+  keys_col keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<V, int> vals({0, 1, 2, 3, 1, 5, 0, 2, 1, 1},
+                                          {1, 1, 0, 0, 1, 1, 1, 0, 0, 1});
+
+  // {1: [0, null, 0], 2: [1, 1, 5, 1], 3: [null, null, null]}
+  keys_col expect_keys{1, 2, 3};
+  counts_col expect_vals = std::is_same<V, bool>::value ? counts_col{1, 1, 0} : counts_col{1, 2, 0};
+
+  test_single_agg(
+    keys, vals, expect_keys, expect_vals, cudf::make_approx_count_distinct_aggregation());
+}
+
+struct groupby_hll_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_hll_test, strings)
+{
+  keys_col keys{1, 2, 1, 1, 2, 3};
+  strings_column_wrapper vals{"a", "b", "a", "c", "b", "d"};
+
+  keys_col expect_keys{1, 2, 3};
+  counts_col expect_vals{2, 1, 1};
+
+  test_single_agg(
+    keys, vals, expect_keys, expect_vals, cudf::make_approx_count_distinct_aggregation());
+}
+
+TEST_F(groupby_hll_test, large_cardinality)
+{
+  // Group 0 has 20000 distinct values, group 1 has 500 distinct values repeated
+  auto const num_rows = 40000;
+  auto const key_it   = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                      [](auto i) { return i % 2; });
+  auto const val_it   = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                      [](auto i) { return i % 2 ? i % 1000 : i; });
+  keys_col keys(key_it, key_it + num_rows);
+  fixed_width_column_wrapper<int32_t> vals(val_it, val_it + num_rows);
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_approx_count_distinct_aggregation(14));
+  groupby::groupby gb_obj(table_view({keys}));
+  auto const result = gb_obj.aggregate(requests);
+
+  auto const estimates = to_host<int64_t>(result.second[0].results[0]->view()).first;
+  ASSERT_EQ(estimates.size(), 2u);
+  // The relative standard error is about 1.04 / sqrt(2^14) < 1%
+  EXPECT_LT(std::abs(estimates[0] - 20000), 20000 * 0.05);
+  EXPECT_LT(std::abs(estimates[1] - 500), 500 * 0.05);
+}
+
+TEST_F(groupby_hll_test, sketch_size)
+{
+  keys_col keys{1, 2, 1};
+  fixed_width_column_wrapper<int32_t> vals{1, 2, 3};
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_hll_sketch_aggregation(4));
+  groupby::groupby gb_obj(table_view({keys}));
+  auto const result = gb_obj.aggregate(requests);
+
+  auto const sketches = lists_column_view(result.second[0].results[0]->view());
+  EXPECT_EQ(sketches.size(), 2);
+  EXPECT_EQ(sketches.child().type().id(), type_id::UINT8);
+  EXPECT_EQ(sketches.child().size(), 2 * 16);
+}
+
+TEST_F(groupby_hll_test, merge_sketches_of_partitions)
+{
+  keys_col keys{1, 2, 1, 2, 1, 1, 2, 3, 3, 2};
+  fixed_width_column_wrapper<int32_t> vals({1, 4, 3, 4, 1, 7, 0, 8, 9, 5},
+                                           {1, 1, 1, 1, 1, 1, 0, 1, 1, 1});
+
+  // Compute the sketches of two halves, then merge them
+  auto sketch = [](column_view const& keys, column_view const& vals) {
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(cudf::make_hll_sketch_aggregation());
+    groupby::groupby gb_obj(table_view({keys}));
+    auto result = gb_obj.aggregate(requests);
+    return std::make_pair(std::move(result.first->release()[0]),
+                          std::move(result.second[0].results[0]));
+  };
+  auto const first  = sketch(cudf::slice(keys, {0, 5})[0], cudf::slice(vals, {0, 5})[0]);
+  auto const second = sketch(cudf::slice(keys, {5, 10})[0], cudf::slice(vals, {5, 10})[0]);
+  auto const sketch_keys =
+    cudf::concatenate(std::vector<column_view>{first.first->view(), second.first->view()});
+  auto const sketches =
+    cudf::concatenate(std::vector<column_view>{first.second->view(), second.second->view()});
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = *sketches;
+  requests[0].aggregations.push_back(cudf::make_merge_hll_sketch_aggregation());
+  groupby::groupby gb_obj(table_view({*sketch_keys}));
+  auto const merged = gb_obj.aggregate(requests);
+
+  // {1: [1, 3, 1, 7], 2: [4, 4, null, 5], 3: [8, 9]}
+  keys_col expect_keys{1, 2, 3};
+  counts_col expect_vals{3, 2, 2};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_keys, merged.first->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    expect_vals, *approx_distinct_count(lists_column_view(merged.second[0].results[0]->view())));
+
+  // Merging the sketches of the partitions gives the sketch of the whole data
+  std::vector<groupby::aggregation_request> whole_requests(1);
+  whole_requests[0].values = vals;
+  whole_requests[0].aggregations.push_back(cudf::make_hll_sketch_aggregation());
+  groupby::groupby whole_gb_obj(table_view({keys}));
+  auto const whole = whole_gb_obj.aggregate(whole_requests);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*whole.second[0].results[0], *merged.second[0].results[0]);
+}
+
+TEST_F(groupby_hll_test, invalid_inputs)
+{
+  EXPECT_THROW(cudf::make_approx_count_distinct_aggregation(3), cudf::logic_error);
+  EXPECT_THROW(cudf::make_hll_sketch_aggregation(19), cudf::logic_error);
+
+  keys_col keys{1, 2};
+  lists_column_wrapper<int32_t> not_sketches{{1, 2}, {3}};
+  EXPECT_THROW(test_single_agg(
+                 keys, not_sketches, keys, not_sketches, cudf::make_merge_hll_sketch_aggregation()),
+               cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
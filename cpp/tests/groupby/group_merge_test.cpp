@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace test {
+struct groupby_merge_test : public cudf::test::BaseFixture {
+};
+
+using keys_col    = fixed_width_column_wrapper<int32_t>;
+using counts_col  = fixed_width_column_wrapper<size_type>;
+using doubles_col = fixed_width_column_wrapper<double>;
+using lists_col   = lists_column_wrapper<int32_t>;
+
+TEST_F(groupby_merge_test, merge_m2)
+{
+  // Partial states of the groups {1: [1, 3] + [5, 7], 2: [-3, -2, -1] + [], 3: [] + []}
+  keys_col keys{1, 2, 3, 1, 2, 3};
+  counts_col counts{2, 3, 0, 2, 0, 0};
+  doubles_col means{{2.0, -2.0, 0.0, 6.0, 0.0, 0.0}, {1, 1, 0, 1, 0, 0}};
+  doubles_col m2s{{2.0, 2.0, 0.0, 2.0, 0.0, 0.0}, {1, 1, 0, 1, 0, 0}};
+  structs_column_wrapper vals{{counts, means, m2s}};
+
+  keys_col expect_keys{1, 2, 3};
+  counts_col expect_counts{4, 3, 0};
+  doubles_col expect_means{{4.0, -2.0, 0.0}, {1, 1, 0}};
+  doubles_col expect_m2s{{20.0, 2.0, 0.0}, {1, 1, 0}};
+  structs_column_wrapper expect_vals{{expect_counts, expect_means, expect_m2s}};
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_merge_m2_aggregation());
+}
+
+TEST_F(groupby_merge_test, merge_m2_of_partitions)
+{
+  keys_col keys{1, 2, 1, 2, 1, 1, 2, 2};
+  doubles_col vals{{1.0, 4.0, 3.0, 6.0, 5.0, 7.0, 0.0, 8.0}, {1, 1, 1, 1, 1, 1, 0, 1}};
+
+  // Compute the partial states of two halves, then merge them
+  auto partial_states = [](column_view const& keys, column_view const& vals) {
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(cudf::make_count_aggregation());
+    requests[0].aggregations.push_back(cudf::make_mean_aggregation());
+    requests[0].aggregations.push_back(cudf::make_m2_aggregation());
+    groupby::groupby gb_obj(table_view({keys}));
+    auto result = gb_obj.aggregate(requests);
+
+    std::vector<std::unique_ptr<column>> children;
+    for (auto& child : result.second[0].results) { children.push_back(std::move(child)); }
+    auto states = structs_column_wrapper(std::move(children)).release();
+    return std::make_pair(std::move(result.first->release()[0]), std::move(states));
+  };
+  auto const first  = partial_states(cudf::slice(keys, {0, 4})[0], cudf::slice(vals, {0, 4})[0]);
+  auto const second = partial_states(cudf::slice(keys, {4, 8})[0], cudf::slice(vals, {4, 8})[0]);
+  auto const state_keys =
+    cudf::concatenate(std::vector<column_view>{first.first->view(), second.first->view()});
+  auto const states =
+    cudf::concatenate(std::vector<column_view>{first.second->view(), second.second->view()});
+
+  // {1: [1, 3, 5, 7], 2: [4, 6, 8]}
+  keys_col expect_keys{1, 2};
+  counts_col expect_counts{4, 3};
+  doubles_col expect_means{4.0, 6.0};
+  doubles_col expect_m2s{20.0, 8.0};
+  structs_column_wrapper expect_vals{{expect_counts, expect_means, expect_m2s}};
+
+  test_single_agg(
+    *state_keys, *states, expect_keys, expect_vals, cudf::make_merge_m2_aggregation());
+}
+
+TEST_F(groupby_merge_test, merge_lists)
+{
+  keys_col keys{1, 2, 1, 3, 2};
+  lists_col vals{{1, 2}, {3}, {4, 1}, lists_col{}, {5, 6}};
+
+  keys_col expect_keys{1, 2, 3};
+  lists_col expect_vals{{1, 2, 4, 1}, {3, 5, 6}, lists_col{}};
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_merge_lists_aggregation());
+}
+
+TEST_F(groupby_merge_test, merge_sets)
+{
+  keys_col keys{1, 2, 1, 3, 2};
+  lists_col vals{{1, 2}, {3}, {4, 1}, lists_col{}, {5, 3}};
+
+  keys_col expect_keys{1, 2, 3};
+  lists_col expect_vals{{1, 2, 4}, {3, 5}, lists_col{}};
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_merge_sets_aggregation());
+}
+
+TEST_F(groupby_merge_test, invalid_inputs)
+{
+  keys_col keys{1, 2};
+  std::vector<bool> validity{true, false};
+  lists_col nullable_vals({{1, 2}, {3}}, validity.begin());
+  doubles_col doubles{1.0, 2.0};
+
+  EXPECT_THROW(test_single_agg(
+                 keys, nullable_vals, keys, nullable_vals, cudf::make_merge_lists_aggregation()),
+               cudf::logic_error);
+  EXPECT_THROW(
+    test_single_agg(keys, doubles, keys, doubles, cudf::make_merge_m2_aggregation()),
+    cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
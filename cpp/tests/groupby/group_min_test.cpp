@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -168,6 +168,25 @@ TEST_F(groupby_min_string_test, zero_valid_values)
     auto agg2 = cudf::make_min_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
+
+TEST_F(groupby_min_string_test, null_keys_and_values)
+{
+    using K = int32_t;
+
+    fixed_width_column_wrapper<K> keys(       {     1,     2,    3,     1,     2,     2,     1,    3,    3,     2,   4 },
+                                              {     1,     1,    1,     1,     1,     0,     1,    1,    1,     1,   1 });
+    strings_column_wrapper        vals(       { "año", "bit", "₹1", "aaa", "zit", "bat", "aaa", "$1", "₹1", "wut", "x" },
+                                              {     1,     1,    1,     1,     1,     1,     0,    1,    1,     1,   0 });
+
+    fixed_width_column_wrapper<K> expect_keys({     1,     2,    3,     4 }, all_valid());
+    strings_column_wrapper        expect_vals({ "aaa", "bit", "$1",    "" }, {     1,     1,    1,     0 });
+
+    auto agg = cudf::make_min_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_min_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
+}
 // clang-format on
 
 struct groupby_dictionary_min_test : public cudf::test::BaseFixture {
@@ -22,6 +22,8 @@
 
 #include <cudf/detail/aggregation/aggregation.hpp>
 
+#include <vector>
+
 namespace cudf {
 namespace test {
 template <typename V>
@@ -226,5 +228,33 @@ TYPED_TEST(groupby_nunique_test, dictionary)
     keys, vals, expect_keys, expect_vals, cudf::make_nunique_aggregation(null_policy::INCLUDE));
 }
 
+struct groupby_nunique_mixed_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_nunique_mixed_test, with_hash_aggregations)
+{
+  // SUM and MAX are computed by the hash-based groupby and NUNIQUE by the sort-based one
+  fixed_width_column_wrapper<int32_t> keys{3, 1, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<int32_t> vals{{1, 2, 2, 2, 5, 1, 7}, {1, 1, 1, 1, 1, 1, 0}};
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+  requests[0].aggregations.push_back(cudf::make_nunique_aggregation());
+  requests[0].aggregations.push_back(cudf::make_max_aggregation());
+
+  groupby::groupby gb_obj(table_view({keys}));
+  auto const result = gb_obj.aggregate(requests);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({fixed_width_column_wrapper<int32_t>{1, 2, 3}}),
+                                result.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(fixed_width_column_wrapper<int64_t>{4, 2, 7},
+                                      *result.second[0].results[0]);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(fixed_width_column_wrapper<size_type>{1, 1, 2},
+                                      *result.second[0].results[1]);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(fixed_width_column_wrapper<int32_t>{2, 2, 5},
+                                      *result.second[0].results[2]);
+}
+
 }  // namespace test
 }  // namespace cudf
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/detail/aggregation/aggregation.hpp>
+
+namespace cudf {
+namespace test {
+using K               = int32_t;
+using key_wrapper     = fixed_width_column_wrapper<K>;
+using rank_wrapper    = fixed_width_column_wrapper<size_type>;
+using percent_wrapper = fixed_width_column_wrapper<double>;
+
+template <typename T>
+struct groupby_rank_scan_test : public cudf::test::BaseFixture {
+  using value_wrapper = fixed_width_column_wrapper<T, int32_t>;
+};
+
+using supported_types = cudf::test::Concat<cudf::test::IntegralTypesNotBool,
+                                           cudf::test::FloatingPointTypes,
+                                           cudf::test::ChronoTypes>;
+
+TYPED_TEST_CASE(groupby_rank_scan_test, supported_types);
+
+TYPED_TEST(groupby_rank_scan_test, basic)
+{
+  using value_wrapper = typename TestFixture::value_wrapper;
+
+  // the values are sorted within each group
+  // clang-format off
+  key_wrapper keys  {1, 2, 1, 2, 1, 2, 3};
+  value_wrapper vals{3, 1, 3, 2, 5, 2, 7};
+
+  key_wrapper expect_keys          {1, 1, 1, 2, 2,   2,   3};
+  rank_wrapper expect_ranks        {1, 1, 3, 1, 2,   2,   1};
+  rank_wrapper expect_dense_ranks  {1, 1, 2, 1, 2,   2,   1};
+  percent_wrapper expect_percent   {0, 0, 1, 0, 0.5, 0.5, 0};
+  // clang-format on
+
+  test_single_scan(keys, vals, expect_keys, expect_ranks, cudf::make_rank_aggregation());
+  test_single_scan(
+    keys, vals, expect_keys, expect_dense_ranks, cudf::make_dense_rank_aggregation());
+  test_single_scan(keys, vals, expect_keys, expect_percent, cudf::make_percent_rank_aggregation());
+}
+
+TYPED_TEST(groupby_rank_scan_test, null_values)
+{
+  using value_wrapper = typename TestFixture::value_wrapper;
+
+  // nulls compare equal to each other and are sorted first within each group
+  // clang-format off
+  key_wrapper keys   {1, 1, 1, 2, 2};
+  value_wrapper vals({0, 0, 4, 0, 6}, {0, 0, 1, 0, 1});
+
+  key_wrapper expect_keys          {1, 1, 1, 2, 2};
+  rank_wrapper expect_ranks        {1, 1, 3, 1, 2};
+  rank_wrapper expect_dense_ranks  {1, 1, 2, 1, 2};
+  percent_wrapper expect_percent   {0, 0, 1, 0, 1};
+  // clang-format on
+
+  test_single_scan(keys, vals, expect_keys, expect_ranks, cudf::make_rank_aggregation());
+  test_single_scan(
+    keys, vals, expect_keys, expect_dense_ranks, cudf::make_dense_rank_aggregation());
+  test_single_scan(keys, vals, expect_keys, expect_percent, cudf::make_percent_rank_aggregation());
+}
+
+TYPED_TEST(groupby_rank_scan_test, empty_cols)
+{
+  using value_wrapper = typename TestFixture::value_wrapper;
+
+  key_wrapper keys{};
+  value_wrapper vals{};
+
+  key_wrapper expect_keys{};
+  rank_wrapper expect_ranks{};
+  percent_wrapper expect_percent{};
+
+  test_single_scan(keys, vals, expect_keys, expect_ranks, cudf::make_rank_aggregation());
+  test_single_scan(keys, vals, expect_keys, expect_ranks, cudf::make_dense_rank_aggregation());
+  test_single_scan(keys, vals, expect_keys, expect_percent, cudf::make_percent_rank_aggregation());
+}
+
+struct groupby_rank_scan_string_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_rank_scan_string_test, basic)
+{
+  // clang-format off
+  key_wrapper keys            {1,   2,   1,   2,   1,   2};
+  strings_column_wrapper vals{"a", "b", "a", "c", "d", "c"};
+
+  key_wrapper expect_keys          {1, 1, 1, 2, 2,   2};
+  rank_wrapper expect_ranks        {1, 1, 3, 1, 2,   2};
+  rank_wrapper expect_dense_ranks  {1, 1, 2, 1, 2,   2};
+  percent_wrapper expect_percent   {0, 0, 1, 0, 0.5, 0.5};
+  // clang-format on
+
+  test_single_scan(keys, vals, expect_keys, expect_ranks, cudf::make_rank_aggregation());
+  test_single_scan(
+    keys, vals, expect_keys, expect_dense_ranks, cudf::make_dense_rank_aggregation());
+  test_single_scan(keys, vals, expect_keys, expect_percent, cudf::make_percent_rank_aggregation());
+}
+
+}  // namespace test
+}  // namespace cudf
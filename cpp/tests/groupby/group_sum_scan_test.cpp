@@ -129,6 +129,56 @@ TYPED_TEST(groupby_sum_scan_test, null_keys_and_values)
   test_single_scan(keys, vals, expect_keys, expect_vals, std::move(agg));
 }
 
+TYPED_TEST(groupby_sum_scan_test, input_order)
+{
+  using value_wrapper  = typename TestFixture::value_wrapper;
+  using result_wrapper = typename TestFixture::result_wrapper;
+
+  // clang-format off
+  key_wrapper keys  {1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  value_wrapper vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  key_wrapper expect_keys   {1, 2, 3, 1, 2, 2,  1, 3,  3,  2};
+  result_wrapper expect_vals{0, 1, 2, 3, 5, 10, 9, 9, 17, 19};
+  // clang-format on
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+
+  groupby::groupby gb_obj(table_view({keys}));
+  auto const result = gb_obj.scan(requests, groupby::scan_order::INPUT);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), result.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_vals, *result.second[0].results[0], true);
+}
+
+TYPED_TEST(groupby_sum_scan_test, input_order_null_keys_and_values)
+{
+  using value_wrapper  = typename TestFixture::value_wrapper;
+  using result_wrapper = typename TestFixture::result_wrapper;
+
+  // clang-format off
+  key_wrapper keys(  {1, 2, 3, 1, 2, 2, 1, 3, 3, 2, 4}, {1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1});
+  value_wrapper vals({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 4}, {0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0});
+
+  //                         { 1, 2, 3, 1, 2,  2, 1, *,  3,  2,  4};
+  key_wrapper expect_keys(   { 1, 2, 3, 1, 2,  2, 1,    3,  2,  4}, all_valid());
+  result_wrapper expect_vals({-1, 1, 2, 3, 5, -1, 9,   10, 14, -1},
+                             { 0, 1, 1, 1, 1,  0, 1,    1,  1,  0});
+  // clang-format on
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+
+  groupby::groupby gb_obj(table_view({keys}));
+  auto const result = gb_obj.scan(requests, groupby::scan_order::INPUT);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), result.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_vals, *result.second[0].results[0], true);
+}
+
 template <typename T>
 struct FixedPointTestBothReps : public cudf::test::BaseFixture {
 };
@@ -22,6 +22,9 @@
 
 #include <cudf/detail/aggregation/aggregation.hpp>
 
+#include <numeric>
+#include <vector>
+
 namespace cudf {
 namespace test {
 template <typename V>
@@ -155,6 +158,37 @@ TYPED_TEST(groupby_sum_test, dictionary)
     keys, vals, expect_keys, expect_vals, cudf::make_sum_aggregation(), force_use_sort_impl::YES);
 }
 
+TYPED_TEST(groupby_sum_test, many_rows)
+{
+  using K = int32_t;
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  // Few groups are aggregated in shared memory, and many groups directly in the sparse results
+  for (auto const num_groups : {5, 5000}) {
+    constexpr int num_rows = 100000;
+    std::vector<K> key_data(num_rows);
+    std::vector<int> val_data(num_rows);
+    std::vector<bool> val_valid(num_rows);
+    std::vector<int> expect_data(num_groups, 0);
+    for (int i = 0; i < num_rows; ++i) {
+      key_data[i]  = i % num_groups;
+      val_data[i]  = i % 7;
+      val_valid[i] = i % 11 != 0;
+      if (val_valid[i]) { expect_data[key_data[i]] += val_data[i]; }
+    }
+    std::vector<K> expect_key_data(num_groups);
+    std::iota(expect_key_data.begin(), expect_key_data.end(), 0);
+
+    fixed_width_column_wrapper<K> keys(key_data.begin(), key_data.end());
+    fixed_width_column_wrapper<V, int> vals(val_data.begin(), val_data.end(), val_valid.begin());
+    fixed_width_column_wrapper<K> expect_keys(expect_key_data.begin(), expect_key_data.end());
+    fixed_width_column_wrapper<R, int> expect_vals(expect_data.begin(), expect_data.end());
+
+    test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_sum_aggregation());
+  }
+}
+
 template <typename T>
 struct FixedPointTestBothReps : public cudf::test::BaseFixture {
 };
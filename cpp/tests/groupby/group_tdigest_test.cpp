@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/quantiles.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <cmath>
+#include <vector>
+
+namespace cudf {
+namespace test {
+using keys_col    = fixed_width_column_wrapper<int32_t>;
+using doubles_col = fixed_width_column_wrapper<double>;
+using results_col = lists_column_wrapper<double>;
+
+namespace {
+/// Aggregates the values of each group with a single aggregation, returns keys and results
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> aggregate(
+  column_view const& keys, column_view const& values, std::unique_ptr<aggregation>&& agg)
+{
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(std::move(agg));
+  groupby::groupby gb_obj(table_view({keys}));
+  auto result = gb_obj.aggregate(requests);
+  return std::make_pair(std::move(result.first->release()[0]),
+                        std::move(result.second[0].results[0]));
+}
+}  // namespace
+
+template <typename V>
+struct groupby_tdigest_test : public cudf::test::BaseFixture {
+};
+
+using supported_types = cudf::test::Types<int8_t, int16_t, int32_t, int64_t, float, double>;
+
+TYPED_TEST_CASE(groupby_tdigest_test, supported_types);
+
+TYPED_TEST(groupby_tdigest_test, basic)
+{
+  using V = TypeParam;
+
+  keys_col keys{1, 2, 1, 2, 1};
+  fixed_width_column_wrapper<V, int> vals{3, 10, 1, 20, 2};
+
+  auto const digests = aggregate(keys, vals, cudf::make_tdigest_aggregation());
+
+  keys_col expect_keys{1, 2};
+  // {1: [1, 2, 3], 2: [10, 20]}
+  results_col expect_percentiles{{1.0, 2.0, 3.0}, {10.0, 15.0, 20.0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_keys, *digests.first);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_percentiles,
+                                 *percentile_approx(*digests.second, {0.0, 0.5, 1.0}));
+}
+
+TYPED_TEST(groupby_tdigest_test, null_values)
+{
+  using V = TypeParam;
+
+  keys_col keys{1, 2, 1, 2, 1, 3};
+  fixed_width_column_wrapper<V, int> vals({3, 10, 1, 20, 2, 4}, {1, 0, 1, 0, 1, 1});
+
+  auto const digests = aggregate(keys, vals, cudf::make_tdigest_aggregation());
+
+  // {1: [1, 2, 3], 2: [null, null], 3: [4]}
+  std::vector<bool> validity{true, false, true};
+  results_col expect_percentiles({{1.0, 3.0}, {}, {4.0, 4.0}}, validity.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_percentiles,
+                                 *percentile_approx(*digests.second, {0.0, 1.0}));
+}
+
+struct groupby_tdigest_merge_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_tdigest_merge_test, large_group)
+{
+  // Values [0, 10000) in a scattered order, compressed into at most 100 centroids
+  auto const num_rows = 10000;
+  auto const val_it   = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                      [](auto i) { return (i * 7919) % 10000; });
+  keys_col keys(thrust::make_constant_iterator(0), thrust::make_constant_iterator(0) + num_rows);
+  doubles_col vals(val_it, val_it + num_rows);
+
+  auto const digests = aggregate(keys, vals, cudf::make_tdigest_aggregation(100));
+  auto const centroids =
+    lists_column_view(structs_column_view(*digests.second).get_sliced_child(0));
+  EXPECT_LE(centroids.get_sliced_child(rmm::cuda_stream_default).size(), 100);
+
+  std::vector<double> const percentiles{0.0, 0.01, 0.25, 0.5, 0.75, 0.99, 1.0};
+  auto const result = percentile_approx(*digests.second, percentiles);
+  auto const values = to_host<double>(lists_column_view(*result).child()).first;
+  ASSERT_EQ(values.size(), percentiles.size());
+  EXPECT_EQ(values.front(), 0.0);
+  EXPECT_EQ(values.back(), 9999.0);
+  for (size_t i = 0; i < percentiles.size(); ++i) {
+    EXPECT_NEAR(values[i], percentiles[i] * 9999, 9999 * 0.01);
+  }
+}
+
+TEST_F(groupby_tdigest_merge_test, merge_digests_of_partitions)
+{
+  keys_col keys{1, 2, 1, 2, 1, 1, 2, 3, 3, 2};
+  doubles_col vals({1.0, 4.0, 3.0, 4.5, 0.5, 7.0, 0.0, 8.0, 9.0, 5.0},
+                   {1, 1, 1, 1, 1, 1, 0, 1, 1, 1});
+
+  // Compute the digests of two halves, then merge them
+  auto const first = aggregate(
+    cudf::slice(keys, {0, 5})[0], cudf::slice(vals, {0, 5})[0], make_tdigest_aggregation());
+  auto const second = aggregate(
+    cudf::slice(keys, {5, 10})[0], cudf::slice(vals, {5, 10})[0], make_tdigest_aggregation());
+  auto const digest_keys =
+    cudf::concatenate(std::vector<column_view>{first.first->view(), second.first->view()});
+  auto const digests =
+    cudf::concatenate(std::vector<column_view>{first.second->view(), second.second->view()});
+  auto const merged = aggregate(*digest_keys, *digests, make_merge_tdigest_aggregation());
+
+  // Without compression, merging the digests of the partitions gives the digest of the whole data
+  auto const whole = aggregate(keys, vals, make_tdigest_aggregation());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*whole.first, *merged.first);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*whole.second, *merged.second);
+
+  // {1: [0.5, 1, 3, 7], 2: [4, 4.5, 5], 3: [8, 9]}
+  results_col expect_percentiles{{0.5, 7.0}, {4.0, 5.0}, {8.0, 9.0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_percentiles, *percentile_approx(*merged.second, {0, 1}));
+}
+
+TEST_F(groupby_tdigest_merge_test, invalid_inputs)
+{
+  EXPECT_THROW(cudf::make_tdigest_aggregation(0), cudf::logic_error);
+  EXPECT_THROW(cudf::make_merge_tdigest_aggregation(-1), cudf::logic_error);
+
+  doubles_col not_digests{1.0, 2.0};
+  EXPECT_THROW(percentile_approx(not_digests, {0.5}), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,8 +20,11 @@
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/groupby.hpp>
 #include <cudf/types.hpp>
 
+#include <vector>
+
 namespace cudf {
 namespace test {
 struct groupby_group_keys_test : public BaseFixture {
@@ -89,5 +92,56 @@ TYPED_TEST(groupby_group_keys_and_values_test, some_nulls)
   test_groups(keys, expect_grouped_keys, expect_group_offsets, values, expect_grouped_values);
 }
 
+TEST_F(groupby_group_keys_test, pre_grouped_keys)
+{
+  using K = int32_t;
+
+  // Grouped but not sorted, with a null key grouped like the others
+  fixed_width_column_wrapper<K> keys({3, 3, 1, 0, 0, 2}, {1, 1, 1, 0, 0, 1});
+  fixed_width_column_wrapper<int32_t> values{1, 2, 3, 4, 5, 6};
+  std::vector<size_type> group_offsets{0, 2, 3, 5, 6};
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+
+  groupby::groupby gb(table_view({keys}), group_offsets);
+  auto const result = gb.aggregate(requests);
+
+  fixed_width_column_wrapper<K> expect_keys({3, 1, 0, 2}, {1, 1, 0, 1});
+  fixed_width_column_wrapper<int64_t> expect_vals{3, 3, 9, 6};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), result.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_vals, *result.second[0].results[0]);
+
+  EXPECT_THROW(groupby::groupby(table_view({keys}), std::vector<size_type>{0, 2, 5}),
+               cudf::logic_error);
+}
+
+TEST_F(groupby_group_keys_test, shared_grouping)
+{
+  using K = int32_t;
+
+  fixed_width_column_wrapper<K> keys{2, 1, 2, 3, 1};
+  fixed_width_column_wrapper<int32_t> values{1, 2, 3, 4, 5};
+
+  groupby::groupby first(table_view({keys}));
+  auto const groups = first.get_groups();
+
+  // The second groupby object reuses the sorted order and the groups of the first one
+  auto const grouping = first.grouping();
+  groupby::groupby second(grouping);
+  EXPECT_EQ(grouping, second.grouping());
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+  auto const result = second.aggregate(requests);
+
+  fixed_width_column_wrapper<K> expect_keys{1, 2, 3};
+  fixed_width_column_wrapper<int64_t> expect_vals{7, 4, 4};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), result.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_vals, *result.second[0].results[0]);
+}
+
 }  // namespace test
 }  // namespace cudf
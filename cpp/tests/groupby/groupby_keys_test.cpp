@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,7 +20,16 @@
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/dictionary/encode.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/unary.hpp>
+
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <limits>
 
 namespace cudf {
 namespace test {
@@ -259,6 +268,28 @@ TEST_F(groupby_string_keys_test, basic)
 }
 // clang-format on
 
+struct groupby_list_keys_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_list_keys_test, basic)
+{
+  using LCW = lists_column_wrapper<int32_t>;
+  using V   = int32_t;
+  using R   = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  // clang-format off
+  LCW                           keys        { {1, 2}, {3}, {1, 2}, {}, {3}, {1, 2}, {}};
+  fixed_width_column_wrapper<V> vals        {      0,   1,      2,  3,   4,      5,  6};
+
+  LCW                           expect_keys {     {}, {1, 2}, {3} };
+  fixed_width_column_wrapper<R> expect_vals {      9,      7,   5 };
+  // clang-format on
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_sum_aggregation());
+  test_single_agg(
+    keys, vals, expect_keys, expect_vals, cudf::make_sum_aggregation(), force_use_sort_impl::YES);
+}
+
 struct groupby_dictionary_keys_test : public cudf::test::BaseFixture {
 };
 
@@ -280,5 +311,192 @@ TEST_F(groupby_dictionary_keys_test, basic)
     keys, vals, expect_keys, expect_vals, cudf::make_sum_aggregation(), force_use_sort_impl::YES);
 }
 
+TEST_F(groupby_dictionary_keys_test, null_keys)
+{
+  using K = std::string;
+  using V = int32_t;
+  using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  // clang-format off
+  dictionary_column_wrapper<K> keys({ "b", "a", "b", "a", "c", "b", "a"}, {1, 1, 0, 1, 0, 1, 1});
+  fixed_width_column_wrapper<V> vals{   0,   1,   2,   3,   4,   5,   6};
+  // clang-format on
+
+  dictionary_column_wrapper<K> expect_keys({"a", "b"});
+  fixed_width_column_wrapper<R> expect_vals({10, 5});
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_sum_aggregation());
+
+  dictionary_column_wrapper<K> expect_keys_with_nulls({"a", "b", ""}, {1, 1, 0});
+  fixed_width_column_wrapper<R> expect_vals_with_nulls({10, 5, 6});
+  test_single_agg(keys,
+                  vals,
+                  expect_keys_with_nulls,
+                  expect_vals_with_nulls,
+                  cudf::make_sum_aggregation(),
+                  force_use_sort_impl::NO,
+                  null_policy::INCLUDE);
+}
+
+TEST_F(groupby_dictionary_keys_test, multiple_keys)
+{
+  using V = double;
+
+  // clang-format off
+  dictionary_column_wrapper<std::string> keys0({"x", "y", "x", "y", "x", "x", "y", "x"},
+                                               { 1,   1,   1,   1,   1,   0,   1,   1 });
+  dictionary_column_wrapper<int32_t>     keys1{  7,   7,   3,   7,   7,   3,   3,   7 };
+  fixed_width_column_wrapper<V>          vals{   1,   2,   3,   4,   5,   6,   7,   9 };
+  // clang-format on
+
+  // The dictionary keys are grouped by their indices, which gives the same groups as the hash map
+  // of the decoded keys
+  auto aggregate = [&](table_view const& keys, null_policy include_null_keys) {
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+    requests[0].aggregations.push_back(cudf::make_variance_aggregation());
+    requests[0].aggregations.push_back(cudf::make_argmax_aggregation());
+    groupby::groupby gb_obj(keys, include_null_keys);
+    auto result = gb_obj.aggregate(requests);
+
+    auto const sort_order = sorted_order(result.first->view(), {}, {});
+    std::vector<column_view> columns(result.first->view().begin(), result.first->view().end());
+    for (auto const& col : result.second[0].results) { columns.push_back(col->view()); }
+    return gather(table_view(columns), *sort_order);
+  };
+
+  auto const decoded0 = cudf::dictionary::decode(keys0);
+  auto const decoded1 = cudf::dictionary::decode(keys1);
+  for (auto include_null_keys : {null_policy::EXCLUDE, null_policy::INCLUDE}) {
+    auto const result   = aggregate(table_view({keys0, keys1}), include_null_keys);
+    auto const expected = aggregate(table_view({*decoded0, *decoded1}), include_null_keys);
+    EXPECT_EQ(result->num_rows(), include_null_keys == null_policy::INCLUDE ? 5 : 4);
+    for (size_type c = 0; c < 2; ++c) {
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::dictionary::decode(result->get_column(c)),
+                                     expected->get_column(c));
+    }
+    for (size_type c = 2; c < result->num_columns(); ++c) {
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(c), expected->get_column(c));
+    }
+  }
+}
+
+TEST_F(groupby_dictionary_keys_test, many_key_combinations)
+{
+  using R = cudf::detail::target_type_t<int32_t, aggregation::COUNT_VALID>;
+
+  // 400 x 400 combinations of keys are too many to group by their indices
+  auto const num_rows = 400;
+  auto const key_it   = thrust::make_counting_iterator(0);
+  auto const keys0    = cudf::dictionary::encode(fixed_width_column_wrapper<int32_t>(
+    key_it, key_it + num_rows));
+  auto const keys1    = cudf::dictionary::encode(fixed_width_column_wrapper<int32_t>(
+    key_it, key_it + num_rows));
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = *keys0;
+  requests[0].aggregations.push_back(cudf::make_count_aggregation());
+  groupby::groupby gb_obj(table_view({*keys0, *keys1}));
+  auto const result = gb_obj.aggregate(requests);
+
+  EXPECT_EQ(result.first->num_rows(), num_rows);
+  auto const ones = thrust::make_constant_iterator(1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result.second[0].results[0],
+                                 fixed_width_column_wrapper<R>(ones, ones + num_rows));
+}
+
+struct groupby_integer_keys_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_integer_keys_test, small_range)
+{
+  using R = cudf::detail::target_type_t<int32_t, aggregation::SUM>;
+
+  // clang-format off
+  fixed_width_column_wrapper<int16_t> keys({ -2,  7, -2,  3,  7, -2,  9 }, { 1, 1, 1, 1, 1, 1, 0 });
+  fixed_width_column_wrapper<int32_t> vals{   0,  1,  2,  3,  4,  5,  6 };
+  // clang-format on
+
+  fixed_width_column_wrapper<int16_t> expect_keys({-2, 3, 7}, all_valid());
+  fixed_width_column_wrapper<R> expect_vals{7, 3, 5};
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_sum_aggregation());
+
+  fixed_width_column_wrapper<int16_t> expect_keys_with_nulls({-2, 3, 7, 0}, {1, 1, 1, 0});
+  fixed_width_column_wrapper<R> expect_vals_with_nulls{7, 3, 5, 6};
+  test_single_agg(keys,
+                  vals,
+                  expect_keys_with_nulls,
+                  expect_vals_with_nulls,
+                  cudf::make_sum_aggregation(),
+                  force_use_sort_impl::NO,
+                  null_policy::INCLUDE);
+}
+
+TEST_F(groupby_integer_keys_test, wide_range)
+{
+  using R = cudf::detail::target_type_t<int32_t, aggregation::SUM>;
+
+  // Keys spread over a range much larger than the number of rows are hashed
+  fixed_width_column_wrapper<int64_t> keys{0, 1'000'000'000'000, 0, -1'000'000'000'000};
+  fixed_width_column_wrapper<int32_t> vals{1, 2, 3, 4};
+  fixed_width_column_wrapper<int64_t> expect_keys{-1'000'000'000'000, 0, 1'000'000'000'000};
+  fixed_width_column_wrapper<R> expect_vals{4, 4, 2};
+  test_single_agg(keys, vals, expect_keys, expect_vals, cudf::make_sum_aggregation());
+
+  auto const max = std::numeric_limits<uint64_t>::max();
+  fixed_width_column_wrapper<uint64_t> unsigned_keys{max, 0, max, 1};
+  fixed_width_column_wrapper<uint64_t> expect_unsigned_keys{0, 1, max};
+  fixed_width_column_wrapper<R> expect_unsigned_vals{2, 4, 4};
+  test_single_agg(unsigned_keys,
+                  vals,
+                  expect_unsigned_keys,
+                  expect_unsigned_vals,
+                  cudf::make_sum_aggregation());
+}
+
+TEST_F(groupby_integer_keys_test, mixed_with_dictionary_keys)
+{
+  // clang-format off
+  dictionary_column_wrapper<std::string> keys0({"x", "y", "x", "y", "x", "x", "y", "x", "y"},
+                                               { 1,   1,   1,   1,   1,   0,   1,   1,   1 });
+  fixed_width_column_wrapper<int8_t>     keys1({ -5,  -5,   3,  -5,  -5,   3,   3,  -5,   0 },
+                                               {  1,   1,   1,   1,   1,   1,   1,   1,   0 });
+  fixed_width_column_wrapper<double>     vals{    1,   2,   3,   4,   5,   6,   7,   9,   8 };
+  // clang-format on
+
+  // The integer and dictionary keys are grouped directly by their values, which gives the same
+  // groups as the hash map of the strings and floating-point keys
+  auto aggregate = [&](table_view const& keys, null_policy include_null_keys) {
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+    requests[0].aggregations.push_back(cudf::make_mean_aggregation());
+    requests[0].aggregations.push_back(cudf::make_std_aggregation());
+    requests[0].aggregations.push_back(cudf::make_argmin_aggregation());
+    groupby::groupby gb_obj(keys, include_null_keys);
+    auto result = gb_obj.aggregate(requests);
+
+    auto const sort_order = sorted_order(result.first->view(), {}, {});
+    std::vector<column_view> columns(result.first->view().begin(), result.first->view().end());
+    for (auto const& col : result.second[0].results) { columns.push_back(col->view()); }
+    return gather(table_view(columns), *sort_order);
+  };
+
+  auto const decoded0 = cudf::dictionary::decode(keys0);
+  auto const floats1  = cudf::cast(keys1, data_type{type_id::FLOAT64});
+  for (auto include_null_keys : {null_policy::EXCLUDE, null_policy::INCLUDE}) {
+    auto const result   = aggregate(table_view({keys0, keys1}), include_null_keys);
+    auto const expected = aggregate(table_view({*decoded0, *floats1}), include_null_keys);
+    EXPECT_EQ(result->num_rows(), include_null_keys == null_policy::INCLUDE ? 6 : 4);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::dictionary::decode(result->get_column(0)),
+                                   expected->get_column(0));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::cast(result->get_column(1), data_type{type_id::FLOAT64}),
+                                   expected->get_column(1));
+    for (size_type c = 2; c < result->num_columns(); ++c) {
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(c), expected->get_column(c));
+    }
+  }
+}
+
 }  // namespace test
 }  // namespace cudf
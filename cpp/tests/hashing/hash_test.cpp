@@ -62,6 +62,27 @@ TEST_F(HashTest, MultiValue)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(output1->view(), output2->view());
 }
 
+TEST_F(HashTest, LongStringsAtEveryAlignment)
+{
+  // The long rows start at different alignments in the chars buffer
+  strings_column_wrapper const strings_col(
+    {"a",
+     "abcdefghijklmnopqrstuvwxyz01234",
+     "abcdefghijklmnopqrstuvwxyz012345",
+     "abcdefghijklmnopqrstuvwxyz0123456",
+     "xy",
+     "https://www.example.com/some/long/path?query=string&with=parameters",
+     "{\"key\": \"value\", \"array\": [1, 2, 3], \"nested\": {\"a\": true}}"});
+
+  // Expected values of the reference MurmurHash3_x86_32 with a seed of 0
+  fixed_width_column_wrapper<int32_t> const expected(
+    {1009084850, -1153065751, -783404154, 1871145655, -611208968, 1577108548, -671312047});
+
+  auto const output = cudf::hash(cudf::table_view({strings_col}));
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, output->view());
+}
+
 TEST_F(HashTest, MultiValueNulls)
 {
   // Nulls with different values should be equal
@@ -449,6 +470,93 @@ TEST_F(SparkMurmurHash3Test, ListThrows)
     cudf::logic_error);
 }
 
+class Hash64Test : public cudf::test::BaseFixture {
+};
+
+TEST_F(Hash64Test, XXHash64KnownValues)
+{
+  fixed_width_column_wrapper<int32_t> const ints({0, 100, -1});
+  strings_column_wrapper const strings(
+    {"", "The quick brown fox", "All work and no play makes Jack a dull boy"});
+
+  fixed_width_column_wrapper<uint64_t> const ints_expected(
+    {4246796580750024372ul, 5959467639951725378ul, 9185342943168159635ul});
+  fixed_width_column_wrapper<uint64_t> const strings_expected(
+    {17241709254077376921ul, 14534496656690829792ul, 8192060544336983731ul});
+
+  auto const ints_output = cudf::hash(cudf::table_view({ints}), cudf::hash_id::HASH_XXHASH64);
+  auto const strings_output =
+    cudf::hash(cudf::table_view({strings}), cudf::hash_id::HASH_XXHASH64);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(ints_expected, ints_output->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(strings_expected, strings_output->view());
+}
+
+TEST_F(Hash64Test, MurmurHash3_64KnownValues)
+{
+  fixed_width_column_wrapper<int32_t> const ints({0, 100, -1});
+  strings_column_wrapper const strings(
+    {"", "The quick brown fox", "All work and no play makes Jack a dull boy"});
+
+  fixed_width_column_wrapper<uint64_t> const ints_expected(
+    {14961230494313510588ul, 13443495419507804445ul, 4889297221962843713ul});
+  fixed_width_column_wrapper<uint64_t> const strings_expected(
+    {0ul, 9630400972940003882ul, 13322780081508519690ul});
+
+  auto const ints_output = cudf::hash(cudf::table_view({ints}), cudf::hash_id::HASH_MURMUR3_64);
+  auto const strings_output =
+    cudf::hash(cudf::table_view({strings}), cudf::hash_id::HASH_MURMUR3_64);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(ints_expected, ints_output->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(strings_expected, strings_output->view());
+}
+
+TEST_F(Hash64Test, MultiValueSeededByPreviousColumns)
+{
+  fixed_width_column_wrapper<int32_t> const ints({0, 100, 7}, {1, 1, 0});
+  strings_column_wrapper const strings({"", "The quick brown fox", "x"}, {1, 1, 0});
+  auto const input = cudf::table_view({ints, strings});
+
+  fixed_width_column_wrapper<uint64_t> const xxhash_expected(
+    {1569708231942617325ul, 1846129098511198899ul, 0ul});
+  fixed_width_column_wrapper<uint64_t> const murmur_expected(
+    {12835758160054178114ul, 3172711225533402683ul, 0ul});
+
+  // A row of nulls keeps the seed
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(xxhash_expected,
+                                 cudf::hash(input, cudf::hash_id::HASH_XXHASH64)->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(murmur_expected,
+                                 cudf::hash(input, cudf::hash_id::HASH_MURMUR3_64)->view());
+}
+
+TEST_F(Hash64Test, ListThrows)
+{
+  lists_column_wrapper<cudf::string_view> strings_list_col({{""}, {"abc"}, {"123"}});
+  EXPECT_THROW(cudf::hash(cudf::table_view({strings_list_col}), cudf::hash_id::HASH_XXHASH64),
+               cudf::logic_error);
+}
+
+template <typename T>
+class Hash64TestFloatTyped : public cudf::test::BaseFixture {
+};
+
+TYPED_TEST_CASE(Hash64TestFloatTyped, cudf::test::FloatingPointTypes);
+
+TYPED_TEST(Hash64TestFloatTyped, NormalizesZerosAndNans)
+{
+  using T = TypeParam;
+
+  T const nan = std::numeric_limits<T>::quiet_NaN();
+  fixed_width_column_wrapper<T> const col1({T(0.0), nan, T(1.5)});
+  fixed_width_column_wrapper<T> const col2({T(-0.0), -nan, T(1.5)});
+
+  for (auto hash_function : {cudf::hash_id::HASH_XXHASH64, cudf::hash_id::HASH_MURMUR3_64}) {
+    auto const output1 = cudf::hash(cudf::table_view({col1}), hash_function);
+    auto const output2 = cudf::hash(cudf::table_view({col2}), hash_function);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(output1->view(), output2->view());
+  }
+}
+
 class MD5HashTest : public cudf::test::BaseFixture {
 };
 
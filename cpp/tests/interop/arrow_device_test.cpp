@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/dictionary/encode.hpp>
+#include <cudf/interop.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <string>
+
+struct ArrowDeviceTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+std::unique_ptr<cudf::table> make_table()
+{
+  using LCW = cudf::test::lists_column_wrapper<int64_t>;
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(
+    cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3, 4, 5}, {1, 0, 1, 1, 0}).release());
+  columns.push_back(
+    cudf::test::strings_column_wrapper({"a", "", "ccc", "dd", "e"}, {1, 1, 0, 1, 1}).release());
+  columns.push_back(LCW({LCW{1, 2}, LCW{}, LCW{3}, LCW{4, 5, 6}, LCW{7}}).release());
+  columns.push_back(
+    cudf::test::fixed_width_column_wrapper<bool>({true, false, true, true, false}, {1, 1, 1, 0, 1})
+      .release());
+  cudf::test::fixed_width_column_wrapper<double> field({1.5, 2.5, 3.5, 4.5, 5.5});
+  columns.push_back(cudf::test::structs_column_wrapper({field}, {1, 1, 0, 1, 1}).release());
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+}  // namespace
+
+TEST_F(ArrowDeviceTest, RoundTrip)
+{
+  auto input    = make_table();
+  auto expected = cudf::table(*input);
+
+  auto schema = cudf::to_arrow_schema(input->view());
+  auto array  = cudf::to_arrow_device(std::move(*input));
+  EXPECT_EQ(std::string(schema->format), "+s");
+  EXPECT_EQ(schema->n_children, 5);
+  EXPECT_EQ(array->device_type, ARROW_DEVICE_CUDA);
+  EXPECT_NE(array->sync_event, nullptr);
+  EXPECT_EQ(array->array.length, 5);
+
+  auto result = cudf::from_arrow_device(schema.get(), array.get());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected.view(), result.first);
+  // only the BOOL8 column is converted
+  EXPECT_EQ(result.second.size(), 1u);
+}
+
+TEST_F(ArrowDeviceTest, SchemaNames)
+{
+  auto input = make_table();
+  std::vector<cudf::column_metadata> metadata{{"a"}, {"b"}, {"c"}, {"d"}, {"e"}};
+  metadata[4].children_meta.emplace_back("f");
+  auto schema = cudf::to_arrow_schema(input->view(), metadata);
+  EXPECT_EQ(std::string(schema->children[0]->name), "a");
+  EXPECT_EQ(std::string(schema->children[2]->format), "+l");
+  EXPECT_EQ(std::string(schema->children[3]->format), "b");
+  EXPECT_EQ(std::string(schema->children[4]->children[0]->name), "f");
+  EXPECT_EQ(schema->children[2]->flags, 0);
+  EXPECT_EQ(schema->children[0]->flags, ARROW_FLAG_NULLABLE);
+
+  metadata.pop_back();
+  EXPECT_THROW(cudf::to_arrow_schema(input->view(), metadata), cudf::logic_error);
+}
+
+TEST_F(ArrowDeviceTest, UnsupportedType)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys({1, 2, 1});
+  auto dictionary = cudf::dictionary::encode(keys);
+  cudf::table_view input({dictionary->view()});
+  EXPECT_THROW(cudf::to_arrow_schema(input), cudf::logic_error);
+  EXPECT_THROW(cudf::to_arrow_device(cudf::table(input)), cudf::logic_error);
+}
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/copying.hpp>
 #include <cudf/interop.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -296,6 +297,68 @@ TYPED_TEST(DLPackNumericTests, ToDlpack2D)
   }
 }
 
+TYPED_TEST(DLPackNumericTests, ToDlpackView1D)
+{
+  fixed_width_column_wrapper<TypeParam> col({1, 2, 3, 4}, {1, 1, 1, 1});
+  auto const col_view = cudf::slice(col, {1, 4})[0];
+
+  cudf::table_view input({col_view});
+  unique_managed_tensor result(cudf::to_dlpack_view(input));
+
+  auto const& tensor = result->dl_tensor;
+  validate_dtype<TypeParam>(tensor.dtype);
+  EXPECT_EQ(1, tensor.ndim);
+  EXPECT_EQ(3, tensor.shape[0]);
+  EXPECT_EQ(nullptr, tensor.strides);
+  EXPECT_EQ(col_view.template data<TypeParam>(), tensor.data);
+}
+
+TYPED_TEST(DLPackNumericTests, ToDlpackViewMatrix)
+{
+  // Two columns viewing one buffer, as the columns of a column-major matrix
+  using T         = TypeParam;
+  auto const data = cudf::test::make_type_param_vector<T>({1, 2, 3, 0, 4, 5, 6, 0});
+  fixed_width_column_wrapper<T> matrix(data.cbegin(), data.cend());
+  auto const cols = cudf::slice(matrix, {0, 3, 4, 7});
+
+  cudf::table_view input(cols);
+  unique_managed_tensor result(cudf::to_dlpack_view(input));
+
+  auto const& tensor = result->dl_tensor;
+  EXPECT_EQ(2, tensor.ndim);
+  EXPECT_EQ(3, tensor.shape[0]);
+  EXPECT_EQ(2, tensor.shape[1]);
+  EXPECT_EQ(1, tensor.strides[0]);
+  EXPECT_EQ(4, tensor.strides[1]);
+  EXPECT_EQ(static_cast<cudf::column_view>(matrix).template data<T>(), tensor.data);
+}
+
+TYPED_TEST(DLPackNumericTests, ToDlpackViewRowMajor)
+{
+  // Separately allocated columns are interleaved into a row-major tensor
+  using T             = TypeParam;
+  auto const col1_tmp = cudf::test::make_type_param_vector<T>({1, 2, 3, 4});
+  auto const col2_tmp = cudf::test::make_type_param_vector<T>({4, 5, 6, 7});
+  auto const rows_tmp = cudf::test::make_type_param_vector<T>({1, 4, 2, 5, 3, 6, 4, 7});
+  fixed_width_column_wrapper<T> col1(col1_tmp.cbegin(), col1_tmp.cend());
+  fixed_width_column_wrapper<T> col2(col2_tmp.cbegin(), col2_tmp.cend());
+  fixed_width_column_wrapper<T> expected(rows_tmp.cbegin(), rows_tmp.cend());
+
+  cudf::table_view input({col1, col2});
+  unique_managed_tensor result(cudf::to_dlpack_view(input));
+
+  auto const& tensor = result->dl_tensor;
+  EXPECT_EQ(2, tensor.ndim);
+  EXPECT_EQ(4, tensor.shape[0]);
+  EXPECT_EQ(2, tensor.shape[1]);
+  EXPECT_EQ(2, tensor.strides[0]);
+  EXPECT_EQ(1, tensor.strides[1]);
+
+  constexpr cudf::data_type type{cudf::type_to_id<T>()};
+  cudf::column_view const result_view(type, 8, tensor.data);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result_view);
+}
+
 TYPED_TEST(DLPackNumericTests, FromDlpack1D)
 {
   // Use to_dlpack to generate an input tensor
@@ -326,6 +326,21 @@ TEST_F(FromArrowTest, ChunkedArray)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected_cudf_table->view(), got_cudf_table->view());
 }
 
+TEST_F(FromArrowTest, Async)
+{
+  auto tables = get_tables(10000);
+
+  auto expected_cudf_table = tables.first->view();
+  auto sliced_arrow_table  = tables.second->Slice(100, 5000);
+
+  auto got_cudf_table   = cudf::from_arrow_async(*tables.second).get();
+  auto got_sliced_table = cudf::from_arrow_async(*sliced_arrow_table).get();
+  auto expected_sliced  = cudf::table{cudf::slice(expected_cudf_table, {100, 5100})[0]};
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_cudf_table, got_cudf_table->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_sliced.view(), got_sliced_table->view());
+}
+
 struct FromArrowTestSlice
   : public FromArrowTest,
     public ::testing::WithParamInterface<std::tuple<cudf::size_type, cudf::size_type>> {
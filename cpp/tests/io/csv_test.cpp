@@ -21,6 +21,7 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/concatenate.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/io/csv.hpp>
 #include <cudf/io/datasource.hpp>
@@ -32,11 +33,15 @@
 
 #include <arrow/io/api.h>
 
+#include <rmm/device_buffer.hpp>
+
 #include <thrust/execution_policy.h>
 #include <thrust/find.h>
 #include <thrust/iterator/counting_iterator.h>
 
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <iterator>
@@ -1650,6 +1655,259 @@ TEST_F(CsvReaderTest, UserImplementedSource)
   expect_column_data_equal(int32_values, view.column(2));
 }
 
+TEST_F(CsvReaderTest, UserImplementedSourceBatchedRead)
+{
+  std::string data(256 << 10, '\0');
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<char>(i * 7);
+  }
+  TestSource source{data};
+
+  // Adjacent, nearby, overlapping and distant ranges, not sorted by offset
+  std::vector<std::pair<size_t, size_t>> const ranges{
+    {200 << 10, 1000}, {10, 20}, {30, 50}, {100, 4000}, {3000, 10}, {0, 0}};
+  std::vector<std::vector<uint8_t>> buffers;
+  std::vector<cudf::io::datasource::read_request> requests;
+  size_t expected_bytes = 0;
+  for (auto const& range : ranges) {
+    buffers.emplace_back(range.second);
+    requests.push_back({range.first, range.second, buffers.back().data()});
+    expected_bytes += range.second;
+  }
+  EXPECT_EQ(source.host_read_async(requests).get(), expected_bytes);
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    EXPECT_TRUE(std::equal(buffers[i].begin(),
+                           buffers[i].end(),
+                           reinterpret_cast<uint8_t const*>(data.data()) + ranges[i].first));
+  }
+}
+
+TEST_F(CsvReaderTest, CachingSource)
+{
+  // Counts the reads that reach the underlying source
+  struct CountingSource : public TestSource {
+    using TestSource::TestSource;
+    size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+    {
+      ++num_reads;
+      return TestSource::host_read(offset, size, dst);
+    }
+    size_t num_reads = 0;
+  };
+
+  std::ostringstream csv_data;
+  for (int i = 0; i < 1000; ++i) {
+    csv_data << i << "," << i * 2 << "\n";
+  }
+  auto const cache = std::make_shared<cudf::io::datasource_block_cache>(1 << 20, 1 << 10);
+  auto const read  = [&](CountingSource* source) {
+    cudf::io::caching_source cached{cudf::io::datasource::create(source), "data.csv", cache};
+    cudf_io::csv_reader_options in_opts =
+      cudf_io::csv_reader_options::builder(cudf_io::source_info{&cached})
+        .dtypes({"int32", "int32"})
+        .header(-1);
+    return cudf_io::read_csv(in_opts);
+  };
+
+  CountingSource first_source{csv_data.str()};
+  auto const first = read(&first_source);
+  EXPECT_GT(first_source.num_reads, 0u);
+  EXPECT_EQ(cache->size(), csv_data.str().size());
+
+  // The second reader is served entirely from the shared cache
+  CountingSource second_source{csv_data.str()};
+  auto const second = read(&second_source);
+  EXPECT_EQ(second_source.num_reads, 0u);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(first.tbl->view(), second.tbl->view());
+
+  // Least recently used blocks are evicted to stay within the capacity
+  auto const small_cache = std::make_shared<cudf::io::datasource_block_cache>(4 << 10, 1 << 10);
+  CountingSource third_source{csv_data.str()};
+  cudf::io::caching_source cached{
+    cudf::io::datasource::create(&third_source), "data.csv", small_cache};
+  std::vector<uint8_t> buffer(8 << 10);
+  EXPECT_EQ(cached.host_read(0, buffer.size(), buffer.data()), buffer.size());
+  EXPECT_EQ(small_cache->size(), 4u << 10);
+  EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), csv_data.str().begin()));
+}
+
+TEST_F(CsvReaderTest, RemoteSourceUri)
+{
+  EXPECT_TRUE(cudf_io::remote_source::is_remote_uri("s3://bucket/data.csv"));
+  EXPECT_TRUE(cudf_io::remote_source::is_remote_uri("hdfs+x://host/data.csv"));
+  EXPECT_FALSE(cudf_io::remote_source::is_remote_uri("file:///tmp/data.csv"));
+  EXPECT_FALSE(cudf_io::remote_source::is_remote_uri("/tmp/data.csv"));
+  EXPECT_FALSE(cudf_io::remote_source::is_remote_uri("://data.csv"));
+  EXPECT_FALSE(cudf_io::remote_source::is_remote_uri("/tmp/a b://data.csv"));
+}
+
+TEST_F(CsvReaderTest, RemoteSourceLocalFile)
+{
+  auto filepath = temp_env->get_temp_dir() + "RemoteSourceLocalFile.csv";
+  std::ostringstream csv_data;
+  for (int i = 0; i < 5000; ++i) {
+    csv_data << i << "\n";
+  }
+  auto const data = csv_data.str();
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << data;
+  }
+
+  // file:// URIs are read as local files
+  auto const local  = cudf_io::datasource::create("file://" + filepath);
+  auto const buffer = local->host_read(0, local->size());
+  EXPECT_EQ(std::string(reinterpret_cast<char const*>(buffer->data()), buffer->size()), data);
+
+  // Large reads are split into parts and small reads are served from a prefetch window
+  cudf_io::remote_source_options options;
+  options.part_size     = 1000;
+  options.prefetch_size = 4096;
+  options.max_requests  = 4;
+  cudf_io::remote_source remote{"file://" + filepath, options};
+  ASSERT_EQ(remote.size(), data.size());
+
+  std::vector<uint8_t> large(data.size() - 100);
+  EXPECT_EQ(remote.host_read(100, large.size(), large.data()), large.size());
+  EXPECT_TRUE(std::equal(large.begin(), large.end(), data.begin() + 100));
+
+  auto const small = remote.host_read(10, 50);
+  EXPECT_EQ(std::string(reinterpret_cast<char const*>(small->data()), small->size()),
+            data.substr(10, 50));
+  auto const tail = remote.host_read(data.size() - 10, 100);
+  EXPECT_EQ(std::string(reinterpret_cast<char const*>(tail->data()), tail->size()),
+            data.substr(data.size() - 10));
+}
+
+TEST_F(CsvReaderTest, RemoteSourceShortReads)
+{
+  // Returns at most `max_read` bytes per request, and reports `size` bytes even if it holds fewer
+  class ShortReadFile : public arrow::io::RandomAccessFile {
+   public:
+    ShortReadFile(std::string data, int64_t max_read, int64_t size)
+      : _data(std::move(data)), _max_read(max_read), _size(size)
+    {
+    }
+    arrow::Status Close() override { return arrow::Status::OK(); }
+    bool closed() const override { return false; }
+    arrow::Result<int64_t> Tell() const override { return _position; }
+    arrow::Status Seek(int64_t position) override
+    {
+      _position = position;
+      return arrow::Status::OK();
+    }
+    arrow::Result<int64_t> GetSize() override { return _size; }
+    arrow::Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override
+    {
+      auto const available = std::max<int64_t>(0, static_cast<int64_t>(_data.size()) - position);
+      auto const bytes     = std::min({nbytes, _max_read, available});
+      if (bytes > 0) { std::memcpy(out, _data.data() + position, bytes); }
+      return bytes;
+    }
+    arrow::Result<int64_t> Read(int64_t nbytes, void* out) override
+    {
+      ARROW_ASSIGN_OR_RAISE(auto bytes, ReadAt(_position, nbytes, out));
+      _position += bytes;
+      return bytes;
+    }
+    arrow::Result<std::shared_ptr<arrow::Buffer>> Read(int64_t nbytes) override
+    {
+      ARROW_ASSIGN_OR_RAISE(auto buffer, arrow::AllocateResizableBuffer(nbytes));
+      ARROW_ASSIGN_OR_RAISE(auto bytes, Read(nbytes, buffer->mutable_data()));
+      ARROW_RETURN_NOT_OK(buffer->Resize(bytes));
+      return std::shared_ptr<arrow::Buffer>(std::move(buffer));
+    }
+
+   private:
+    std::string _data;
+    int64_t _max_read;
+    int64_t _size;
+    int64_t _position = 0;
+  };
+
+  std::string data(10000, '\0');
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<char>(i % 251);
+  }
+  cudf_io::remote_source_options options;
+  options.part_size     = 2000;
+  options.prefetch_size = 4096;
+
+  // Short reads within a part are requested again instead of leaving a gap
+  cudf_io::remote_source remote{std::make_shared<ShortReadFile>(data, 700, data.size()),
+                                options};
+  std::vector<uint8_t> buffer(data.size());
+  EXPECT_EQ(remote.host_read(0, buffer.size(), buffer.data()), buffer.size());
+  EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), data.begin()));
+
+  auto const small = remote.host_read(1234, 100);
+  EXPECT_EQ(std::string(reinterpret_cast<char const*>(small->data()), small->size()),
+            data.substr(1234, 100));
+
+  // An object that ends before its reported size is an error
+  cudf_io::remote_source truncated{std::make_shared<ShortReadFile>(data, 700, data.size() + 3000),
+                                   options};
+  std::vector<uint8_t> truncated_buffer(truncated.size());
+  EXPECT_THROW(truncated.host_read(0, truncated_buffer.size(), truncated_buffer.data()),
+               cudf::logic_error);
+}
+
+TEST_F(CsvReaderTest, MemoryMappedBatchedReads)
+{
+  auto filepath = temp_env->get_temp_dir() + "MemoryMappedBatchedReads.csv";
+  std::ostringstream csv_data;
+  for (int i = 0; i < 20000; ++i) {
+    csv_data << i << "," << i * 3 << "\n";
+  }
+  auto const data = csv_data.str();
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << data;
+  }
+
+  // Ranges that are not page aligned, within a mapping that does not start at the file start
+  std::vector<std::pair<size_t, size_t>> const ranges{
+    {5001, 100}, {9000, 20000}, {data.size() - 123, 123}};
+  auto const check_reads = [&](cudf_io::datasource& source) {
+    std::vector<std::vector<uint8_t>> host_buffers;
+    std::vector<cudf_io::datasource::read_request> requests;
+    for (auto const& range : ranges) {
+      host_buffers.emplace_back(range.second);
+      requests.push_back({range.first, range.second, host_buffers.back().data()});
+    }
+    EXPECT_EQ(source.host_read_async(requests).get(), 20223u);
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      EXPECT_TRUE(std::equal(
+        host_buffers[i].begin(), host_buffers[i].end(), data.begin() + ranges[i].first));
+    }
+
+    if (not source.supports_device_read()) { return; }
+    rmm::device_buffer device_data(data.size(), rmm::cuda_stream_default);
+    auto const d_data = static_cast<uint8_t*>(device_data.data());
+    for (auto& request : requests) {
+      request.dst = d_data + request.offset;
+    }
+    EXPECT_EQ(source.device_read_async(requests, rmm::cuda_stream_default).get(), 20223u);
+    std::vector<uint8_t> copied(data.size());
+    CUDA_TRY(cudaMemcpy(copied.data(), d_data, data.size(), cudaMemcpyDeviceToHost));
+    for (auto const& range : ranges) {
+      EXPECT_TRUE(std::equal(copied.begin() + range.first,
+                             copied.begin() + range.first + range.second,
+                             data.begin() + range.first));
+    }
+  };
+
+  check_reads(*cudf_io::datasource::create(filepath, 5000, 0));
+
+  // Reads from a registered mapping are copied to the device straight from the mapping
+  setenv("LIBCUDF_MMAP_REGISTER", "ON", 1);
+  setenv("LIBCUDF_MMAP_HUGE_PAGES", "ON", 1);
+  auto registered = cudf_io::datasource::create(filepath, 5000, 0);
+  unsetenv("LIBCUDF_MMAP_REGISTER");
+  unsetenv("LIBCUDF_MMAP_HUGE_PAGES");
+  check_reads(*registered);
+}
+
 TEST_F(CsvReaderTest, DurationsWithWriter)
 {
   auto filepath = temp_env->get_temp_dir() + "DurationsWithWriter.csv";
@@ -1876,6 +2134,283 @@ TEST_F(CsvReaderTest, ReadMaxNumericValue)
   expect_column_data_equal(std::vector<uint64_t>(sequence, sequence + num_rows), view.column(0));
 }
 
+TEST_F(CsvReaderTest, MultiMemberGzip)
+{
+  // Builds a GZIP member holding a single stored (uncompressed) DEFLATE block
+  auto gzip_member = [](std::string const &text) {
+    uint32_t crc = ~0u;
+    for (unsigned char c : text) {
+      crc ^= c;
+      for (int k = 0; k < 8; k++) {
+        crc = (crc >> 1) ^ (0xedb88320u & (0 - (crc & 1)));
+      }
+    }
+    crc                 = ~crc;
+    uint32_t const len  = text.size();
+    uint32_t const nlen = ~len & 0xffffu;
+    std::string member{'\x1f', '\x8b', '\x08', '\0', '\0', '\0', '\0', '\0', '\0', '\xff'};
+    for (uint32_t v : {1u, len & 0xffu, len >> 8, nlen & 0xffu, nlen >> 8}) {
+      member.push_back(static_cast<char>(v));
+    }
+    member += text;
+    for (uint32_t v : {crc, static_cast<uint32_t>(text.size())}) {
+      for (int k = 0; k < 4; k++) {
+        member.push_back(static_cast<char>(v >> (k * 8)));
+      }
+    }
+    return member;
+  };
+
+  auto filepath = temp_env->get_temp_filepath("MultiMemberGzip.csv.gz");
+  {
+    std::ofstream out_file{filepath, std::ofstream::out | std::ofstream::binary};
+    out_file << gzip_member("a,b\n1,10\n2,20\n") << gzip_member("3,30\n4,40\n");
+  }
+
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{filepath})
+      .compression(cudf_io::compression_type::GZIP)
+      .dtypes({"int32", "int32"});
+  auto result = cudf_io::read_csv(in_opts);
+
+  const auto view = result.tbl->view();
+  ASSERT_EQ(2, view.num_columns());
+  expect_column_data_equal(std::vector<int32_t>{1, 2, 3, 4}, view.column(0));
+  expect_column_data_equal(std::vector<int32_t>{10, 20, 30, 40}, view.column(1));
+}
+
+TEST_F(CsvReaderTest, Bzip2MultipleBlocks)
+{
+  // bzip2 -1 stream of the lines "i % 10,i % 7" for i in [0, 60000); it holds three blocks,
+  // which are decoded concurrently and must be stitched back together in order
+  std::vector<uint8_t> const compressed{
+    0x42, 0x5a, 0x68, 0x31, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0x59, 0xbf,
+    0x55, 0x38, 0x00, 0x68, 0x9c, 0xd8, 0x00, 0x00, 0x10, 0x00, 0x04, 0x7f,
+    0xe0, 0x50, 0x03, 0xbe, 0x3d, 0x41, 0x4a, 0xa2, 0x95, 0x40, 0x81, 0xa0,
+    0x68, 0x10, 0x34, 0x0d, 0x02, 0x06, 0x81, 0xa0, 0x26, 0xaa, 0x55, 0x0d,
+    0xff, 0xaa, 0xa4, 0xff, 0xd5, 0x4d, 0x02, 0x95, 0x54, 0x64, 0xff, 0xd5,
+    0x47, 0xea, 0xa6, 0x7b, 0x91, 0x4f, 0x12, 0x29, 0xe6, 0x45, 0x3f, 0xa4,
+    0x53, 0x48, 0xa7, 0xa9, 0x14, 0xf7, 0x22, 0x9a, 0x45, 0x32, 0x8a, 0x69,
+    0x14, 0xd2, 0x29, 0xa4, 0x53, 0x48, 0xa6, 0x91, 0x4d, 0x22, 0x9a, 0x45,
+    0x32, 0x82, 0xc9, 0x45, 0x92, 0x8b, 0x25, 0x16, 0x4a, 0x2c, 0x94, 0x58,
+    0x8a, 0x69, 0x14, 0xca, 0x29, 0xa4, 0x53, 0x48, 0xa6, 0x91, 0x2c, 0x94,
+    0x59, 0x28, 0xb2, 0x51, 0x64, 0xa2, 0xd1, 0x45, 0x92, 0x8b, 0x25, 0x16,
+    0x4a, 0x2c, 0x94, 0x59, 0x28, 0xb2, 0x51, 0x64, 0xa2, 0xc9, 0x45, 0x92,
+    0x8b, 0xd9, 0x28, 0xb2, 0x51, 0x64, 0xa2, 0xc9, 0x45, 0x92, 0x8b, 0xe9,
+    0x28, 0xb2, 0x51, 0x64, 0xa2, 0xc9, 0x45, 0x92, 0x8b, 0x25, 0x16, 0x4a,
+    0x2c, 0x94, 0x59, 0x0a, 0x69, 0x14, 0xd2, 0x29, 0xa4, 0x53, 0x48, 0xa6,
+    0x91, 0x4c, 0x94, 0x59, 0x28, 0xb2, 0x51, 0x64, 0xa2, 0xc9, 0x45, 0x92,
+    0x8b, 0x25, 0x16, 0x4a, 0x2c, 0x94, 0x5f, 0x12, 0x8b, 0x45, 0x16, 0x91,
+    0x4d, 0x22, 0x9a, 0x45, 0x34, 0x8a, 0x69, 0x14, 0xf5, 0x20, 0xbf, 0x12,
+    0x8b, 0xe2, 0x51, 0x72, 0x51, 0x72, 0x51, 0x74, 0x51, 0x71, 0x14, 0xe9,
+    0x14, 0xe9, 0x14, 0xe9, 0x14, 0xe9, 0x14, 0xe9, 0x12, 0xe4, 0xa2, 0xe4,
+    0xa2, 0xe4, 0xa2, 0xe4, 0xa2, 0xe8, 0xa2, 0xe4, 0xa2, 0xe4, 0xa2, 0xe4,
+    0xa2, 0xe4, 0xa2, 0xe4, 0xa2, 0xe4, 0xa2, 0xe4, 0xa2, 0xe4, 0xa2, 0xe4,
+    0xa2, 0xe4, 0xa2, 0xe8, 0xa2, 0xe4, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2,
+    0x29, 0xd2, 0x29, 0xd2, 0x29, 0xc9, 0x45, 0xc9, 0x45, 0xc9, 0x45, 0xc9,
+    0x45, 0xd1, 0x45, 0xc9, 0x45, 0xc9, 0x45, 0xc9, 0x45, 0xc9, 0x45, 0xc9,
+    0x45, 0xc9, 0x45, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2,
+    0x29, 0xd2, 0x0b, 0x92, 0x8b, 0x92, 0x8b, 0x92, 0x8b, 0x92, 0x8b, 0x92,
+    0x8b, 0x88, 0xa7, 0x48, 0xa7, 0x48, 0xa7, 0x48, 0xa7, 0x48, 0xa7, 0x48,
+    0x97, 0x25, 0x17, 0xc2, 0x81, 0x3f, 0xdf, 0x0a, 0xa1, 0x5f, 0xc2, 0x81,
+    0x3d, 0x4a, 0x85, 0x78, 0xa0, 0x4f, 0x52, 0xa1, 0x5e, 0x28, 0x13, 0xd4,
+    0xa8, 0x57, 0x8a, 0x04, 0xf5, 0x2a, 0x15, 0xe9, 0x40, 0x9e, 0xa5, 0x42,
+    0xbd, 0x28, 0x13, 0xd4, 0x55, 0x0a, 0xfd, 0x31, 0x41, 0x59, 0x26, 0x53,
+    0x59, 0x1d, 0xf6, 0x43, 0xba, 0x00, 0x58, 0x92, 0x58, 0x00, 0x00, 0x10,
+    0x00, 0x04, 0x7f, 0xe0, 0x50, 0x03, 0xbe, 0x79, 0x54, 0x52, 0xaa, 0x8a,
+    0x90, 0x20, 0x68, 0x1a, 0x04, 0x0d, 0x03, 0x40, 0x81, 0xa0, 0x68, 0x09,
+    0xaa, 0x95, 0x43, 0x7f, 0xea, 0xaa, 0x3f, 0xf5, 0x45, 0x02, 0x95, 0x54,
+    0x0f, 0xfd, 0x55, 0x1f, 0xe9, 0x54, 0x7d, 0xff, 0x48, 0xa7, 0xdc, 0x8a,
+    0x7e, 0x48, 0xa7, 0xd4, 0x8a, 0x69, 0x14, 0xfd, 0x91, 0x4f, 0xe9, 0x14,
+    0xd2, 0x29, 0xa4, 0x53, 0x48, 0xa6, 0x91, 0x4c, 0x94, 0x59, 0x28, 0xb2,
+    0x51, 0x64, 0xa2, 0xc9, 0x45, 0x92, 0x8b, 0x25, 0x16, 0x4a, 0x2c, 0x94,
+    0x59, 0x28, 0xb2, 0x51, 0x69, 0x14, 0xd2, 0x29, 0xa4, 0x53, 0x48, 0xa6,
+    0x91, 0x4d, 0x20, 0xb2, 0x51, 0x64, 0xa2, 0xc9, 0x45, 0x92, 0x8b, 0x25,
+    0x16, 0x22, 0x9a, 0x45, 0x34, 0x8a, 0x69, 0x14, 0xd2, 0x29, 0xa4, 0x4b,
+    0x25, 0x16, 0x4a, 0x2c, 0x94, 0x59, 0x28, 0xb2, 0x51, 0x64, 0xa2, 0xc9,
+    0x45, 0x92, 0x8b, 0x25, 0x16, 0x8a, 0x2d, 0x14, 0x59, 0x28, 0xb2, 0x51,
+    0x64, 0xa2, 0xc9, 0x45, 0x92, 0x8b, 0x21, 0x4d, 0x22, 0x99, 0x45, 0x34,
+    0x8a, 0x69, 0x14, 0xd2, 0x29, 0x92, 0x8b, 0x25, 0x16, 0x4a, 0x2c, 0x94,
+    0x5a, 0x28, 0xb2, 0x51, 0x64, 0xa2, 0xc9, 0x45, 0x92, 0x8b, 0xf3, 0xea,
+    0x51, 0x79, 0x28, 0xb4, 0x8a, 0x69, 0x14, 0xd2, 0x29, 0xa4, 0x53, 0x48,
+    0xa7, 0xec, 0x91, 0x7c, 0x8a, 0x2f, 0xa9, 0x45, 0xc9, 0x45, 0xc9, 0x45,
+    0xc9, 0x45, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29, 0xd2, 0x29,
+    0xd2, 0x0b, 0xa2, 0x8b, 0xa2, 0x8b, 0x92, 0x8b, 0x92, 0x8b, 0x92, 0x8b,
+    0x88, 0xa7, 0x48, 0xa7, 0x48, 0xa7, 0x48, 0xa7, 0x48, 0xa7, 0x48, 0x97,
+    0x25, 0x17, 0x25, 0x17, 0x25, 0x17, 0x25, 0x17, 0x25, 0x17, 0x25, 0x17,
+    0x25, 0x17, 0x25, 0x17, 0x25, 0x17, 0x25, 0x17, 0x25, 0x17, 0x25, 0x17,
+    0x25, 0x17, 0x25, 0x17, 0x25, 0x17, 0x25, 0x17, 0x21, 0x4e, 0x91, 0x4e,
+    0x91, 0x4e, 0x91, 0x4e, 0x91, 0x4e, 0x91, 0x4e, 0x4a, 0x2e, 0x4a, 0x2e,
+    0x4a, 0x2e, 0x4a, 0x2e, 0x4a, 0x2f, 0xbf, 0x10, 0xa7, 0xa4, 0x53, 0xd2,
+    0x29, 0xe9, 0x14, 0xf4, 0x8a, 0x7a, 0x45, 0x3d, 0x22, 0x9e, 0x91, 0x4f,
+    0x48, 0xa7, 0xa4, 0x53, 0x94, 0x53, 0xa4, 0x8b, 0x92, 0x8b, 0xe1, 0x40,
+    0x9f, 0x69, 0x50, 0xaf, 0x14, 0x09, 0xe2, 0xa8, 0x57, 0x8a, 0x04, 0xf1,
+    0x54, 0x2b, 0xd2, 0x81, 0x3c, 0x55, 0x0a, 0xf4, 0xa0, 0x4f, 0x15, 0x42,
+    0xbc, 0x50, 0x27, 0x8a, 0xa1, 0x5e, 0x28, 0x13, 0xd5, 0x4a, 0x85, 0x7f,
+    0xcc, 0x50, 0x56, 0x49, 0x94, 0xd6, 0x5f, 0x71, 0x15, 0xbc, 0x00, 0x0d,
+    0x67, 0xd6, 0x00, 0x00, 0x04, 0x00, 0x01, 0x1f, 0xf8, 0x14, 0x00, 0xd7,
+    0x00, 0x00, 0x00, 0x08, 0x1a, 0x06, 0x81, 0x03, 0x40, 0xd0, 0x20, 0x68,
+    0x1a, 0x02, 0x6a, 0xa5, 0x53, 0x4d, 0xff, 0xaa, 0xa3, 0xfd, 0x55, 0x3d,
+    0x42, 0x06, 0x81, 0xa1, 0xfa, 0x15, 0x7d, 0x05, 0x5f, 0xd0, 0xab, 0xee,
+    0x15, 0x60, 0xab, 0xf0, 0x2a, 0xfd, 0x0a, 0xb0, 0x55, 0x82, 0xac, 0x15,
+    0x60, 0xab, 0x05, 0x58, 0x2a, 0xc1, 0x56, 0x0a, 0xb0, 0x55, 0x82, 0xac,
+    0x15, 0x60, 0xab, 0x05, 0x58, 0x2a, 0xfa, 0xc1, 0x56, 0x0a, 0xb0, 0x55,
+    0xf4, 0x15, 0x60, 0xab, 0x05, 0x58, 0x2a, 0xc1, 0x56, 0x0a, 0xb0, 0x55,
+    0x82, 0xac, 0x15, 0x60, 0xab, 0x05, 0x58, 0x2a, 0xc1, 0x56, 0x0a, 0xb0,
+    0x55, 0x82, 0xac, 0x15, 0x60, 0xab, 0x05, 0x58, 0x2a, 0xc1, 0x56, 0x0a,
+    0xb0, 0x55, 0x82, 0xac, 0x15, 0x60, 0xab, 0x05, 0x58, 0x2a, 0xc1, 0x56,
+    0x0a, 0xb0, 0x55, 0x82, 0xac, 0x15, 0x60, 0xab, 0x05, 0x58, 0x2a, 0xc1,
+    0x56, 0x0a, 0xb0, 0x55, 0x82, 0xac, 0x15, 0x60, 0xab, 0x05, 0x58, 0x2a,
+    0xc1, 0x56, 0x0a, 0xbe, 0x05, 0x58, 0x2a, 0xc1, 0x56, 0x0a, 0xb0, 0x55,
+    0x82, 0xac, 0x15, 0x7e, 0x05, 0x5f, 0xe0, 0xab, 0xe0, 0x55, 0xc1, 0x57,
+    0x05, 0x5c, 0x15, 0x70, 0x55, 0xc1, 0x57, 0x05, 0x5c, 0x15, 0x70, 0x55,
+    0xc1, 0x57, 0x05, 0x5d, 0x0a, 0xb8, 0x2a, 0xe0, 0xab, 0xf9, 0xc1, 0x57,
+    0x05, 0x5c, 0x15, 0x70, 0x55, 0xc1, 0x57, 0x05, 0x5c, 0x15, 0x7e, 0x05,
+    0x5d, 0x0a, 0xb8, 0x2a, 0xe0, 0xab, 0x82, 0xae, 0x0a, 0xb8, 0x2a, 0xe0,
+    0xab, 0x82, 0xae, 0x0a, 0xb8, 0x2a, 0xe0, 0xab, 0x82, 0xae, 0x0a, 0xb8,
+    0x2a, 0xe0, 0xab, 0x82, 0xae, 0x0a, 0xb8, 0x2a, 0xe0, 0xab, 0x82, 0xae,
+    0x0a, 0xb8, 0x2a, 0xe0, 0xab, 0x82, 0xae, 0x0a, 0xb8, 0x2a, 0xe0, 0xab,
+    0x82, 0xae, 0x0a, 0xb8, 0x2a, 0xe0, 0xab, 0x82, 0xae, 0x0a, 0xb8, 0x2a,
+    0xe0, 0xab, 0x82, 0xae, 0x0a, 0xb8, 0x2a, 0xe0, 0xab, 0xe4, 0x4a, 0x2f,
+    0x95, 0x20, 0xf4, 0x4a, 0x2f, 0x29, 0x07, 0xa2, 0x51, 0x79, 0x48, 0x3c,
+    0x15, 0x7b, 0xd1, 0x55, 0x2f, 0x29, 0x07, 0xa2, 0x51, 0x79, 0x48, 0x3d,
+    0x12, 0x8b, 0xca, 0x41, 0xe8, 0x94, 0x5e, 0xa5, 0x20, 0xff, 0x8b, 0xb9,
+    0x22, 0x9c, 0x28, 0x48, 0x10, 0x6a, 0xc2, 0xb2, 0x80};
+  constexpr int num_rows = 60000;
+
+  auto filepath = temp_env->get_temp_filepath("Bzip2MultipleBlocks.csv.bz2");
+  {
+    std::ofstream out_file{filepath, std::ofstream::out | std::ofstream::binary};
+    out_file.write(reinterpret_cast<char const*>(compressed.data()), compressed.size());
+  }
+
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{filepath})
+      .compression(cudf_io::compression_type::BZIP2)
+      .dtypes({"int32", "int32"})
+      .header(-1);
+  auto result = cudf_io::read_csv(in_opts);
+
+  const auto view = result.tbl->view();
+  ASSERT_EQ(2, view.num_columns());
+  std::vector<int32_t> first(num_rows);
+  std::vector<int32_t> second(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    first[i]  = i % 10;
+    second[i] = i % 7;
+  }
+  expect_column_data_equal(first, view.column(0));
+  expect_column_data_equal(second, view.column(1));
+}
+
+TEST_F(CsvReaderTest, ChunkedRead)
+{
+  // Quoted fields spanning lines, so that some chunks end inside quotes; values are fractional
+  // in every row, so the types inferred from the first chunk hold for the whole dataset
+  std::string const header = "id,text,value\n";
+  std::ostringstream data;
+  constexpr int num_rows = 200;
+  for (int i = 0; i < num_rows; ++i) {
+    data << i << ",\"line " << i << (i % 3 == 0 ? "\nmore\"" : "\"") << "," << i + 0.5 << "\n";
+  }
+  auto const contents = header + data.str();
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedRead.csv");
+  {
+    std::ofstream out_file{filepath, std::ofstream::out};
+    out_file << contents;
+  }
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{filepath});
+  auto const expected = cudf_io::read_csv(in_opts);
+
+  for (std::size_t chunk_size : {7ul, 100ul, 1000ul, contents.size(), 2 * contents.size()}) {
+    auto reader = cudf_io::csv_chunked_reader(chunk_size, in_opts);
+    std::vector<std::unique_ptr<cudf::table>> chunks;
+    while (reader.has_next()) {
+      auto chunk = reader.read_chunk();
+      EXPECT_EQ(chunk.metadata.column_names, expected.metadata.column_names);
+      chunks.push_back(std::move(chunk.tbl));
+    }
+    std::vector<cudf::table_view> views;
+    std::transform(chunks.begin(), chunks.end(), std::back_inserter(views), [](auto const &tbl) {
+      return tbl->view();
+    });
+    auto const result = cudf::concatenate(views);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), result->view());
+  }
+
+  // Row selection can't be combined with reading in chunks
+  cudf_io::csv_reader_options skip_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{filepath}).skiprows(5);
+  EXPECT_THROW(cudf_io::csv_chunked_reader(100, skip_opts), cudf::logic_error);
+}
+
+TEST_F(CsvReaderTest, SampledTypeInference)
+{
+  // Single rows break the types a small sample would infer: a float in an integer column, a
+  // string in a float column and a null in an integer column
+  std::ostringstream data;
+  data << "ints,floats,strings,nullable\n";
+  constexpr int num_rows = 1000;
+  for (int i = 0; i < num_rows; ++i) {
+    data << (i == 501 ? "1.5" : std::to_string(i)) << "," << i + 0.25 << ","
+         << (i == 777 ? "abc" : "1.0") << "," << (i == 333 ? "" : std::to_string(i)) << "\n";
+  }
+
+  auto const contents = data.str();
+
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{contents.c_str(), contents.size()});
+  auto const expected = cudf_io::read_csv(in_opts);
+  EXPECT_EQ(expected.tbl->get_column(0).type().id(), cudf::type_id::FLOAT64);
+  EXPECT_EQ(expected.tbl->get_column(1).type().id(), cudf::type_id::FLOAT64);
+  EXPECT_EQ(expected.tbl->get_column(2).type().id(), cudf::type_id::STRING);
+  EXPECT_EQ(expected.tbl->get_column(3).type().id(), cudf::type_id::FLOAT64);
+
+  for (cudf::size_type sample_rows : {1, 10, 100, num_rows, 2 * num_rows}) {
+    in_opts.set_type_inference_sample_rows(sample_rows);
+    auto const result = cudf_io::read_csv(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected.tbl->view(), result.tbl->view());
+  }
+}
+
+TEST_F(CsvReaderTest, WriteMixedTypesInChunks)
+{
+  auto const min_int = std::numeric_limits<int64_t>::min();
+
+  auto ints = column_wrapper<int64_t>{{min_int, 0, 7, -42, 100, 5, 6, 8, 9, 10},
+                                      {1, 1, 1, 0, 1, 1, 1, 1, 1, 1}};
+  auto bools =
+    column_wrapper<bool>{{true, false, true, true, false, false, true, true, false, true},
+                         {1, 1, 0, 1, 1, 1, 1, 1, 1, 1}};
+  auto strings = column_wrapper<cudf::string_view>{
+    {"a", "b,c", "d", "", "e", "f\"g", "h", "i", "j", "k"}, {1, 1, 1, 0, 1, 1, 1, 1, 1, 1}};
+  auto uints = column_wrapper<uint8_t>{0, 1, 2, 3, 4, 5, 6, 7, 255, 128};
+  cudf::table_view input_table({ints, bools, strings, uints});
+
+  std::vector<char> out_buffer;
+  cudf_io::csv_writer_options writer_options =
+    cudf_io::csv_writer_options::builder(cudf_io::sink_info(&out_buffer), input_table)
+      .include_header(false)
+      .na_rep("NA")
+      .rows_per_chunk(8);
+  cudf_io::write_csv(writer_options);
+
+  std::string const expected =
+    "-9223372036854775808,true,a,0\n"
+    "0,false,\"b,c\",1\n"
+    "7,NA,d,2\n"
+    "NA,true,NA,3\n"
+    "100,false,e,4\n"
+    "5,false,\"f\"\"g\",5\n"
+    "6,true,h,6\n"
+    "8,true,i,7\n"
+    "9,false,j,255\n"
+    "10,true,k,128\n";
+  EXPECT_EQ(expected, std::string(out_buffer.data(), out_buffer.size()));
+}
+
 TEST_F(CsvReaderTest, DefaultWriteChunkSize)
 {
   for (auto num_rows : {1, 20, 100, 1000}) {
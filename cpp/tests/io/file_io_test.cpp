@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <cuda_runtime.h>
+
+#include <io/utilities/file_io_utilities.hpp>
+#include <io/utilities/pinned_memory_pool.hpp>
+#include <io/utilities/thread_pool.hpp>
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace cudf_io = cudf::io::detail;
+
+struct FileIOTest : public cudf::test::BaseFixture {
+};
+
+void expect_slices_equal(std::vector<cudf_io::file_slice> const& slices,
+                         std::vector<std::pair<size_t, size_t>> const& expected)
+{
+  ASSERT_EQ(slices.size(), expected.size());
+  for (size_t i = 0; i < slices.size(); ++i) {
+    EXPECT_EQ(slices[i].offset, expected[i].first) << "slice " << i;
+    EXPECT_EQ(slices[i].size, expected[i].second) << "slice " << i;
+  }
+}
+
+TEST_F(FileIOTest, FileSlicesAligned)
+{
+  expect_slices_equal(cudf_io::make_file_slices(0, 4096 * 3, 4096),
+                      {{0, 4096}, {4096, 4096}, {8192, 4096}});
+  expect_slices_equal(cudf_io::make_file_slices(8192, 100, 4096), {{8192, 100}});
+}
+
+TEST_F(FileIOTest, FileSlicesUnaligned)
+{
+  // The first slice ends at the next boundary in the file, not at the slice size
+  expect_slices_equal(cudf_io::make_file_slices(1000, 10000, 4096),
+                      {{1000, 3096}, {4096, 4096}, {8192, 2808}});
+  expect_slices_equal(cudf_io::make_file_slices(4095, 2, 4096), {{4095, 1}, {4096, 1}});
+}
+
+TEST_F(FileIOTest, FileSlicesEmpty)
+{
+  EXPECT_TRUE(cudf_io::make_file_slices(1000, 0, 4096).empty());
+  EXPECT_THROW(cudf_io::make_file_slices(0, 10, 0), cudf::logic_error);
+}
+
+TEST_F(FileIOTest, ThreadPoolRunsAllTasks)
+{
+  std::atomic<int> count{0};
+  std::vector<std::future<int>> results;
+  {
+    cudf_io::thread_pool pool(4);
+    EXPECT_EQ(pool.size(), 4u);
+    for (int i = 0; i < 100; ++i) {
+      results.push_back(pool.submit([&count, i]() {
+        ++count;
+        return i;
+      }));
+    }
+  }
+  // The destructor waits for the submitted tasks
+  EXPECT_EQ(count.load(), 100);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(results[i].get(), i);
+  }
+}
+
+TEST_F(FileIOTest, ThreadPoolStoresExceptions)
+{
+  cudf_io::thread_pool pool(2);
+  auto failed    = pool.submit([]() -> int { throw std::runtime_error("task failed"); });
+  auto succeeded = pool.submit([]() { return 1; });
+  EXPECT_THROW(failed.get(), std::runtime_error);
+  EXPECT_EQ(succeeded.get(), 1);
+  EXPECT_THROW(cudf_io::thread_pool(0), cudf::logic_error);
+}
+
+bool is_pinned(void const* ptr)
+{
+  cudaPointerAttributes attributes{};
+  return cudaPointerGetAttributes(&attributes, ptr) == cudaSuccess and
+         attributes.type == cudaMemoryTypeHost;
+}
+
+TEST_F(FileIOTest, PinnedPoolReusesSizeClass)
+{
+  auto& pool = cudf_io::pinned_memory_pool::instance();
+  auto block = pool.allocate(5000);
+  EXPECT_TRUE(is_pinned(block));
+  pool.deallocate(block, 5000);
+  // 5000 and 8000 bytes are in the same 8 KiB size class
+  auto reused = pool.allocate(8000);
+  EXPECT_EQ(reused, block);
+  // 9000 bytes are not
+  auto larger = pool.allocate(9000);
+  EXPECT_NE(larger, block);
+  pool.deallocate(reused, 8000);
+  pool.deallocate(larger, 9000);
+}
+
+TEST_F(FileIOTest, PinnedPoolLargerThanSizeClasses)
+{
+  auto& pool        = cudf_io::pinned_memory_pool::instance();
+  size_t const size = (size_t{1} << 28) + 1;
+  auto block        = pool.allocate(size);
+  EXPECT_TRUE(is_pinned(block));
+  static_cast<char*>(block)[size - 1] = 1;
+  pool.deallocate(block, size);
+  pool.release();
+}
+
+TEST_F(FileIOTest, PinnedBuffer)
+{
+  cudf_io::pinned_buffer<int32_t> buffer(1000);
+  ASSERT_TRUE(buffer);
+  EXPECT_EQ(buffer.size(), 1000u);
+  EXPECT_TRUE(is_pinned(buffer.data()));
+  buffer.data()[999] = 42;
+
+  auto const data = buffer.data();
+  cudf_io::pinned_buffer<int32_t> moved(std::move(buffer));
+  EXPECT_FALSE(buffer);
+  EXPECT_EQ(moved.data(), data);
+  EXPECT_EQ(moved.data()[999], 42);
+
+  moved.reset();
+  EXPECT_FALSE(moved);
+  EXPECT_EQ(moved.size(), 0u);
+  EXPECT_FALSE(cudf_io::pinned_buffer<int32_t>(0));
+}
@@ -30,6 +30,7 @@
 #include <arrow/io/api.h>
 
 #include <fstream>
+#include <limits>
 #include <type_traits>
 
 #define wrapper cudf::test::fixed_width_column_wrapper
@@ -458,6 +459,70 @@ TEST_F(JsonReaderTest, JsonLinesFileInput)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(1), float64_wrapper{{1.1, 2.2}, validity});
 }
 
+TEST_F(JsonReaderTest, JsonLinesMultipleFileInputs)
+{
+  const std::string file1 = temp_env->get_temp_dir() + "JsonLinesMultipleFileTest1.json";
+  std::ofstream outfile(file1, std::ofstream::out);
+  outfile << "[11, 1]\n[22, 2]";
+  outfile.close();
+
+  const std::string file2 = temp_env->get_temp_dir() + "JsonLinesMultipleFileTest2.json";
+  std::ofstream outfile2(file2, std::ofstream::out);
+  outfile2 << "[33, 3.3]\n[44, 4.4]\n";
+  outfile2.close();
+
+  cudf_io::json_reader_options in_options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{{file1, file2}}).lines(true);
+
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_options);
+
+  EXPECT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.tbl->num_rows(), 4);
+
+  // The schema is inferred from all sources together
+  EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::INT64);
+  EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::type_id::FLOAT64);
+
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return true; });
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0),
+                                 int64_wrapper{{11, 22, 33, 44}, validity});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(1),
+                                 float64_wrapper{{1., 2., 3.3, 4.4}, validity});
+}
+
+TEST_F(JsonReaderTest, JsonLinesMultipleFilesByteRange)
+{
+  const std::string file1 = temp_env->get_temp_dir() + "JsonLinesMultipleByteRangeTest1.json";
+  std::ofstream outfile(file1, std::ofstream::out);
+  outfile << "[1000]\n[2000]\n[3000]";
+  outfile.close();
+
+  const std::string file2 = temp_env->get_temp_dir() + "JsonLinesMultipleByteRangeTest2.json";
+  std::ofstream outfile2(file2, std::ofstream::out);
+  outfile2 << "[4000]\n[5000]\n[6000]\n";
+  outfile2.close();
+
+  // The range starts within the second record and ends within the fourth, which is the first
+  // record of the second file
+  cudf_io::json_reader_options in_options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{{file1, file2}})
+      .lines(true)
+      .byte_range_offset(11)
+      .byte_range_size(12);
+
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_options);
+
+  EXPECT_EQ(result.tbl->num_columns(), 1);
+  EXPECT_EQ(result.tbl->num_rows(), 2);
+
+  EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::INT64);
+
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return true; });
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), int64_wrapper{{3000, 4000}, validity});
+}
+
 TEST_F(JsonReaderTest, JsonLinesByteRange)
 {
   const std::string fname = temp_env->get_temp_dir() + "JsonLinesByteRangeTest.json";
@@ -861,4 +926,139 @@ TEST_F(JsonReaderTest, ParseOutOfRangeIntegers)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(input_mixed_range_append, view.column(9));
 }
 
+TEST_F(JsonReaderTest, JsonLinesNested)
+{
+  using int64_lcw  = cudf::test::lists_column_wrapper<int64_t>;
+  using string_lcw = cudf::test::lists_column_wrapper<cudf::string_view>;
+
+  std::string const data =
+    "{\"id\": 1, \"tags\": [\"a\", \"b\\\"c\"], \"loc\": {\"x\": 1.5, \"y\": [1, 2]}}\n"
+    "{\"id\": 2, \"tags\": [], \"loc\": null}\n"
+    "{\"id\": 3, \"loc\": {\"x\": 2.5, \"y\": []}}\n";
+  cudf_io::json_reader_options in_options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{data.data(), data.size()})
+      .lines(true)
+      .nested(true);
+  auto const result = cudf_io::read_json(in_options);
+  auto const view   = result.tbl->view();
+
+  EXPECT_EQ(result.metadata.column_names, (std::vector<std::string>{"id", "tags", "loc"}));
+  ASSERT_EQ(result.metadata.schema_info.size(), 3u);
+  ASSERT_EQ(result.metadata.schema_info[2].children.size(), 2u);
+  EXPECT_EQ(result.metadata.schema_info[2].children[0].name, "x");
+  EXPECT_EQ(result.metadata.schema_info[2].children[1].name, "y");
+
+  auto const valids = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return i != 1;
+  });
+  auto const missing_last = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return i != 2;
+  });
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(int64_wrapper{1, 2, 3}, view.column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    string_lcw({string_lcw{"a", "b\"c"}, string_lcw{}, string_lcw{}}, missing_last),
+    view.column(1));
+
+  auto const loc = view.column(2);
+  ASSERT_EQ(loc.type().id(), cudf::type_id::STRUCT);
+  EXPECT_EQ(loc.null_count(), 1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(float64_wrapper({1.5, 0., 2.5}, valids), loc.child(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    int64_lcw({int64_lcw{1, 2}, int64_lcw{}, int64_lcw{}}, valids), loc.child(1));
+}
+
+TEST_F(JsonReaderTest, JsonLinesNestedMixedKinds)
+{
+  std::string const data = "{\"a\": [1]}\n{\"a\": {\"b\": 1}}\n";
+  cudf_io::json_reader_options in_options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{data.data(), data.size()})
+      .lines(true)
+      .nested(true);
+  EXPECT_THROW(cudf_io::read_json(in_options), cudf::logic_error);
+
+  std::string const unbalanced = "{\"a\": [1, {\"b\": 2]}\n";
+  cudf_io::json_reader_options unbalanced_options =
+    cudf_io::json_reader_options::builder(
+      cudf_io::source_info{unbalanced.data(), unbalanced.size()})
+      .lines(true)
+      .nested(true);
+  EXPECT_THROW(cudf_io::read_json(unbalanced_options), cudf::logic_error);
+}
+
+struct JsonWriterTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(JsonWriterTest, LinesWithNulls)
+{
+  auto const valid_ends =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 1; });
+  auto const valid_front =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 2; });
+  cudf::test::fixed_width_column_wrapper<int32_t> a{{1, 2, 3}, valid_ends};
+  cudf::test::strings_column_wrapper b{{"x", "say \"hi\"\n", ""}, valid_front};
+  cudf::test::fixed_width_column_wrapper<bool> c{true, false, true};
+  cudf::test::fixed_width_column_wrapper<double> d{
+    1.5, std::numeric_limits<double>::quiet_NaN(), 0.25};
+  cudf::table_view input{{a, b, c, d}};
+
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"a", "b", "c", "d"};
+
+  std::vector<char> out_buffer;
+  auto options = cudf_io::json_writer_options::builder(cudf_io::sink_info{&out_buffer}, input)
+                   .metadata(&metadata)
+                   .lines(true);
+  cudf_io::write_json(options);
+
+  // Null fields are skipped, and NaN is written as a null
+  std::string const expected =
+    "{\"a\":1,\"b\":\"x\",\"c\":true,\"d\":1.5}\n"
+    "{\"b\":\"say \\\"hi\\\"\\n\",\"c\":false}\n"
+    "{\"a\":3,\"c\":true,\"d\":0.25}\n";
+  EXPECT_EQ(std::string(out_buffer.data(), out_buffer.size()), expected);
+}
+
+TEST_F(JsonWriterTest, NestedColumns)
+{
+  auto const valid_first =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i == 0; });
+  cudf::test::fixed_width_column_wrapper<int32_t> x{1, 2};
+  cudf::test::lists_column_wrapper<int32_t> y{{1, 2}, cudf::test::lists_column_wrapper<int32_t>{}};
+  cudf::test::structs_column_wrapper s{{x, y}};
+  cudf::test::lists_column_wrapper<int32_t> l{{{5, 6}, {7}}, valid_first};
+  cudf::table_view input{{s, l}};
+
+  cudf_io::table_metadata metadata;
+  metadata.schema_info.emplace_back("s");
+  metadata.schema_info[0].children.emplace_back("x");
+  metadata.schema_info[0].children.emplace_back("y");
+  metadata.schema_info.emplace_back("l");
+
+  std::vector<char> out_buffer;
+  auto options = cudf_io::json_writer_options::builder(cudf_io::sink_info{&out_buffer}, input)
+                   .metadata(&metadata)
+                   .include_nulls(true);
+  cudf_io::write_json(options);
+
+  std::string const expected =
+    "[{\"s\":{\"x\":1,\"y\":[1,2]},\"l\":[5,6]},{\"s\":{\"x\":2,\"y\":[]},\"l\":null}]";
+  EXPECT_EQ(std::string(out_buffer.data(), out_buffer.size()), expected);
+}
+
+TEST_F(JsonWriterTest, RowsPerChunk)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> col{0, 1, 2, 3, 4};
+  cudf::table_view input{{col}};
+
+  std::vector<char> out_buffer;
+  auto options =
+    cudf_io::json_writer_options::builder(cudf_io::sink_info{&out_buffer}, input).rows_per_chunk(2);
+  cudf_io::write_json(options);
+
+  // Without metadata, the columns are named by their indices
+  std::string const expected = "[{\"0\":0},{\"0\":1},{\"0\":2},{\"0\":3},{\"0\":4}]";
+  EXPECT_EQ(std::string(out_buffer.data(), out_buffer.size()), expected);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
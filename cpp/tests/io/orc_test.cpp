@@ -21,11 +21,14 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/ast/linearizer.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/io/orc.hpp>
 #include <cudf/io/orc_metadata.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -508,6 +511,29 @@ TEST_F(OrcWriterTest, Strings)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(OrcWriterTest, DictionaryColumns)
+{
+  char const* keys[] = {"germany", "france", "", "spain", "italy"};
+  auto sequence =
+    cudf::detail::make_counting_transform_iterator(0, [&](auto i) { return keys[i % 5]; });
+  auto validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  constexpr cudf::size_type num_rows = 1000;
+  column_wrapper<cudf::string_view> strings(sequence, sequence + num_rows, validity);
+  auto dictionary = cudf::dictionary::encode(strings);
+
+  // Dictionary columns are written as their values
+  auto filepath = temp_env->get_temp_filepath("OrcDictionaryColumns.orc");
+  cudf_io::orc_writer_options out_opts = cudf_io::orc_writer_options::builder(
+    cudf_io::sink_info{filepath}, table_view{{dictionary->view()}});
+  cudf_io::write_orc(out_opts);
+
+  cudf_io::orc_reader_options in_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).use_index(false);
+  auto result = cudf_io::read_orc(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view{{strings}}, result.tbl->view());
+}
+
 TEST_F(OrcWriterTest, SlicedTable)
 {
   // This test checks for writing zero copy, offseted views into existing cudf tables
@@ -635,6 +661,138 @@ TEST_F(OrcWriterTest, Slice)
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(read_table.tbl->view(), tbl);
 }
 
+TEST_F(OrcWriterTest, IntegerEncodings)
+{
+  // Sorted ids with varying gaps, decreasing values, and narrow values with a few outliers
+  constexpr cudf::size_type num_rows = 20000;
+  std::vector<int64_t> sorted_ids(num_rows);
+  std::vector<int32_t> decreasing(num_rows);
+  std::vector<int32_t> outliers(num_rows);
+  std::vector<int64_t> outliers64(num_rows);
+  int64_t id = 1000000;
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    id += 1 + (i * 7) % 13;
+    sorted_ids[i] = id;
+    decreasing[i] = 5000000 - i * 3 - (i % 5);
+    outliers[i]   = (i % 97 == 0) ? 1 << 28 : (i * 31) % 100 - 50;
+    outliers64[i] = (i % 301 == 0) ? -(int64_t{1} << 50) : (i * 13) % 1000;
+  }
+  column_wrapper<int64_t> col0(sorted_ids.begin(), sorted_ids.end());
+  column_wrapper<int32_t> col1(decreasing.begin(), decreasing.end());
+  column_wrapper<int32_t> col2(outliers.begin(), outliers.end());
+  column_wrapper<int64_t> col3(outliers64.begin(), outliers64.end());
+  table_view expected({col0, col1, col2, col3});
+
+  auto filepath = temp_env->get_temp_filepath("IntegerEncodings.orc");
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected);
+  cudf_io::write_orc(out_opts);
+
+  cudf_io::orc_reader_options in_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath});
+  auto result = cudf_io::read_orc(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+struct OrcWriterCompressionTest : public OrcWriterTest,
+                                  public ::testing::WithParamInterface<cudf_io::compression_type> {
+};
+
+TEST_P(OrcWriterCompressionTest, RoundTrip)
+{
+  constexpr cudf::size_type num_rows = 50000;
+  auto sequence                      = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i % 1000); });
+  auto values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  column_wrapper<cudf::string_view> col0(sequence, sequence + num_rows);
+  column_wrapper<int32_t> col1(values, values + num_rows);
+  table_view expected({col0, col1});
+
+  auto write = [&](cudf_io::compression_type compression) {
+    std::vector<char> out_buffer;
+    cudf_io::orc_writer_options out_opts =
+      cudf_io::orc_writer_options::builder(cudf_io::sink_info{&out_buffer}, expected)
+        .compression(compression);
+    cudf_io::write_orc(out_opts);
+
+    cudf_io::orc_reader_options in_opts = cudf_io::orc_reader_options::builder(
+      cudf_io::source_info{out_buffer.data(), out_buffer.size()});
+    auto result = cudf_io::read_orc(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+    return out_buffer.size();
+  };
+
+  EXPECT_LT(write(GetParam()), write(cudf_io::compression_type::NONE));
+}
+
+INSTANTIATE_TEST_CASE_P(OrcWriter,
+                        OrcWriterCompressionTest,
+                        ::testing::Values(cudf_io::compression_type::ZLIB,
+                                          cudf_io::compression_type::ZSTD));
+
+TEST_F(OrcWriterTest, BloomFilters)
+{
+  constexpr cudf::size_type num_rows = 1000;
+  auto evens   = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return 2 * i; });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i); });
+  column_wrapper<int32_t> col0(evens, evens + num_rows);
+  column_wrapper<cudf::string_view> col1(strings, strings + num_rows);
+  table_view expected({col0, col1});
+
+  auto filepath = temp_env->get_temp_filepath("OrcBloomFilters.orc");
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .bloom_filter_columns({0, 1});
+  cudf_io::write_orc(out_opts);
+
+  auto read_filtered = [&](cudf::ast::expression const& filter) {
+    cudf_io::orc_reader_options in_opts =
+      cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+    return cudf_io::read_orc(in_opts);
+  };
+  auto col_ref = cudf::ast::column_reference(0);
+
+  {
+    cudf_io::orc_reader_options in_opts =
+      cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath});
+    auto result = cudf_io::read_orc(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  }
+
+  // An odd value is within the statistics' range, but not in the bloom filter
+  {
+    auto value  = cudf::numeric_scalar<int32_t>(501);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, col_ref, lit);
+    auto result = read_filtered(filter);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+
+  // An IN-list keeps the stripe if any of its values may be present
+  {
+    auto odd_value  = cudf::numeric_scalar<int32_t>(3);
+    auto even_value = cudf::numeric_scalar<int32_t>(500);
+    auto odd_lit    = cudf::ast::literal(odd_value);
+    auto even_lit   = cudf::ast::literal(even_value);
+    auto is_odd     = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, col_ref, odd_lit);
+    auto is_even    = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, col_ref, even_lit);
+    auto filter     = cudf::ast::expression(cudf::ast::ast_operator::LOGICAL_OR, is_odd, is_even);
+    auto result     = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  }
+
+  // Bloom filters of columns that don't exist can't be written
+  {
+    std::vector<char> out_buffer;
+    cudf_io::orc_writer_options invalid_opts =
+      cudf_io::orc_writer_options::builder(cudf_io::sink_info{&out_buffer}, expected)
+        .bloom_filter_columns({2});
+    EXPECT_THROW(cudf_io::write_orc(invalid_opts), cudf::logic_error);
+  }
+}
+
 TEST_F(OrcChunkedWriterTest, SingleTable)
 {
   srand(31337);
@@ -814,6 +972,128 @@ TEST_F(OrcChunkedWriterTest, ReadStripes)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
 }
 
+TEST_F(OrcChunkedWriterTest, ReadStripesFilter)
+{
+  // One stripe per write, each covering a disjoint range of values
+  constexpr auto num_rows = 100;
+  std::vector<std::unique_ptr<cudf::column>> stripes;
+  for (int s = 0; s < 3; ++s) {
+    auto values = cudf::detail::make_counting_transform_iterator(
+      0, [s](auto i) { return s * num_rows + i; });
+    stripes.push_back(column_wrapper<int32_t>(values, values + num_rows).release());
+  }
+  auto const table0 = table_view{{stripes[0]->view()}};
+  auto const table1 = table_view{{stripes[1]->view()}};
+  auto const table2 = table_view{{stripes[2]->view()}};
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedStripesFilter.orc");
+  cudf_io::chunked_orc_writer_options opts =
+    cudf_io::chunked_orc_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::orc_chunked_writer(opts).write(table0).write(table1).write(table2);
+
+  auto read_filtered = [&](cudf::ast::expression const& filter) {
+    cudf_io::orc_reader_options read_opts =
+      cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+    return cudf_io::read_orc(read_opts);
+  };
+  auto col0 = cudf::ast::column_reference(0);
+
+  // Only the last stripe can hold values >= 250
+  {
+    auto value  = cudf::numeric_scalar<int32_t>(250);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::expression(cudf::ast::ast_operator::GREATER_EQUAL, col0, lit);
+    auto result = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(table2, result.tbl->view());
+  }
+
+  // Equality with the literal on the left selects the middle stripe
+  {
+    auto value  = cudf::numeric_scalar<int32_t>(150);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, lit, col0);
+    auto result = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(table1, result.tbl->view());
+  }
+
+  // A value outside of every stripe selects nothing
+  {
+    auto value  = cudf::numeric_scalar<int32_t>(1000);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, col0, lit);
+    auto result = read_filtered(filter);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+    EXPECT_EQ(result.tbl->num_columns(), 1);
+  }
+
+  // A filter can't be combined with a row window
+  {
+    auto value  = cudf::numeric_scalar<int32_t>(0);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, col0, lit);
+    cudf_io::orc_reader_options read_opts =
+      cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+    EXPECT_THROW(read_opts.set_skip_rows(10), cudf::logic_error);
+  }
+}
+
+TEST_F(OrcReaderTest, ChunkedRead)
+{
+  srand(31337);
+  auto table1     = create_random_fixed_table<int>(4, 25000, true);
+  auto table2     = create_random_fixed_table<int>(4, 1000, true);
+  auto full_table = cudf::concatenate(std::vector<table_view>({*table1, *table2}));
+
+  // Each write produces its own stripe; the first one spans three row groups
+  auto filepath = temp_env->get_temp_filepath("ChunkedRead.orc");
+  cudf_io::chunked_orc_writer_options opts =
+    cudf_io::chunked_orc_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::orc_chunked_writer(opts).write(*table1).write(*table2);
+
+  cudf_io::orc_reader_options read_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath});
+
+  auto read_chunks = [&](std::size_t chunk_read_limit) {
+    auto reader = cudf_io::orc_chunked_reader(chunk_read_limit, read_opts);
+    std::vector<std::unique_ptr<table>> chunks;
+    while (reader.has_next()) { chunks.push_back(std::move(reader.read_chunk().tbl)); }
+    return chunks;
+  };
+  auto concat = [](std::vector<std::unique_ptr<table>> const& chunks) {
+    std::vector<table_view> views;
+    std::transform(chunks.begin(), chunks.end(), std::back_inserter(views), [](auto const& t) {
+      return t->view();
+    });
+    return cudf::concatenate(views);
+  };
+
+  // No limit reads everything at once
+  {
+    auto chunks = read_chunks(0);
+    ASSERT_EQ(chunks.size(), 1u);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(chunks[0]->view(), *full_table);
+  }
+
+  // A small output limit splits the large stripe at row group boundaries
+  {
+    auto chunks = read_chunks(200000);
+    ASSERT_EQ(chunks.size(), 4u);
+    for (auto const& chunk : chunks) { EXPECT_LE(chunk->num_rows(), 10000); }
+    CUDF_TEST_EXPECT_TABLES_EQUAL(chunks[3]->view(), *table2);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(concat(chunks)->view(), *full_table);
+  }
+
+  // Row bounds are honored across chunks
+  {
+    read_opts.set_skip_rows(24000);
+    read_opts.set_num_rows(1500);
+    auto chunks   = read_chunks(0);
+    auto expected = cudf::slice(full_table->view(), {24000, 25500});
+    ASSERT_EQ(chunks.size(), 2u);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(concat(chunks)->view(), expected[0]);
+  }
+}
+
 TEST_F(OrcChunkedWriterTest, ReadStripesError)
 {
   srand(31337);
@@ -925,6 +1205,33 @@ TYPED_TEST(OrcChunkedWriterNumericTypeTest, UnalignedSize2)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
 }
 
+TEST_F(OrcReaderTest, MultiStreamRead)
+{
+  srand(31337);
+  auto table1     = create_random_fixed_table<int>(3, 1000, true);
+  auto table2     = create_random_fixed_table<int>(3, 700, true);
+  auto table3     = create_random_fixed_table<int>(3, 1300, true);
+  auto full_table = cudf::concatenate(std::vector<table_view>({*table1, *table2, *table3}));
+
+  // Each write produces its own stripe
+  auto filepath = temp_env->get_temp_filepath("MultiStreamRead.orc");
+  cudf_io::chunked_orc_writer_options opts =
+    cudf_io::chunked_orc_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::orc_chunked_writer(opts).write(*table1).write(*table2).write(*table3);
+
+  for (cudf::size_type num_streams : {1, 2, 8}) {
+    cudf_io::orc_reader_options read_opts =
+      cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath})
+        .num_read_streams(num_streams);
+    auto result = cudf_io::read_orc(read_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), *full_table);
+  }
+
+  EXPECT_THROW(cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath})
+                 .num_read_streams(0),
+               cudf::logic_error);
+}
+
 TEST_F(OrcReaderTest, CombinedSkipRowTest)
 {
   SkipRowTest skip_row;
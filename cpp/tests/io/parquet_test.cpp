@@ -14,12 +14,17 @@
  * limitations under the License.
  */
 
+#include <cudf/ast/linearizer.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/data_sink.hpp>
+#include <cudf/io/memory_resource.hpp>
 #include <cudf/io/parquet.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -32,8 +37,13 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/mr/device/statistics_resource_adaptor.hpp>
 
 #include <fstream>
+#include <map>
 #include <type_traits>
 
 namespace cudf_io = cudf::io;
@@ -1123,6 +1133,32 @@ TEST_F(ParquetWriterTest, CustomDataSink)
   CUDF_TEST_EXPECT_TABLES_EQUAL(buf_tbl.tbl->view(), expected->view());
 }
 
+TEST_F(ParquetWriterTest, HostBufferSinkDeviceWrites)
+{
+  std::string const first{"first device write"};
+  std::string const second{"second device write"};
+  rmm::device_buffer d_first(first.data(), first.size(), rmm::cuda_stream_default);
+  rmm::device_buffer d_second(second.data(), second.size(), rmm::cuda_stream_default);
+
+  std::vector<char> out_buffer;
+  {
+    auto sink = cudf::io::data_sink::create(&out_buffer);
+    ASSERT_TRUE(sink->supports_device_write());
+    sink->host_write("ab", 2);
+    // Data lands in call order, even when a write is issued before the previous one is complete
+    auto first_write =
+      sink->device_write_async(d_first.data(), first.size(), rmm::cuda_stream_default);
+    auto second_write =
+      sink->device_write_async(d_second.data(), second.size(), rmm::cuda_stream_default);
+    sink->host_write("cd", 2);
+    first_write.get();
+    second_write.get();
+    sink->flush();
+    EXPECT_EQ(sink->bytes_written(), 4 + first.size() + second.size());
+  }
+  EXPECT_EQ(std::string(out_buffer.begin(), out_buffer.end()), "ab" + first + second + "cd");
+}
+
 TEST_F(ParquetWriterTest, DeviceWriteLargeishFile)
 {
   auto filepath = temp_env->get_temp_filepath("DeviceWriteLargeishFile.parquet");
@@ -1233,6 +1269,67 @@ TEST_F(ParquetChunkedWriterTest, SimpleTable)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
 }
 
+TEST_F(ParquetChunkedWriterTest, HostBuffer)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(5, 5000, true);
+  auto table2 = create_random_fixed_table<int>(5, 5000, true);
+  auto table3 = create_random_fixed_table<int>(5, 5000, true);
+
+  auto full_table = cudf::concatenate(std::vector<table_view>({*table1, *table2, *table3}));
+
+  // The host buffer sink takes device writes, which stay in flight across the written tables
+  std::vector<char> out_buffer;
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{&out_buffer});
+  cudf_io::parquet_chunked_writer(args).write(*table1).write(*table2).write(*table3);
+
+  cudf_io::parquet_reader_options read_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info{out_buffer.data(), out_buffer.size()});
+  auto result = cudf_io::read_parquet(read_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
+}
+
+TEST_F(ParquetChunkedWriterTest, PartitionedTables)
+{
+  column_wrapper<int32_t> ints{1, 2, 1, 2, 1};
+  cudf::test::strings_column_wrapper strings{"x", "x", "y/z", "x", "x"};
+  column_wrapper<int64_t> values{0, 1, 2, 3, 4};
+  table_view table({ints, strings, values});
+
+  cudf_io::table_input_metadata metadata(table);
+  metadata.column_metadata[0].set_name("i");
+  metadata.column_metadata[1].set_name("s");
+  metadata.column_metadata[2].set_name("v");
+
+  std::map<std::string, std::vector<char>> buffers;
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{})
+      .metadata(&metadata)
+      .partition_columns({0, 1})
+      .partition_sinks([&buffers](std::string const& path) {
+        return cudf_io::data_sink::create(&buffers[path]);
+      });
+  cudf_io::parquet_chunked_writer(args).write(table).write(table);
+
+  std::map<std::string, std::vector<int64_t>> const expected{
+    {"i=1/s=x/part-0.parquet", {0, 4, 0, 4}},
+    {"i=1/s=y%2Fz/part-0.parquet", {2, 2}},
+    {"i=2/s=x/part-0.parquet", {1, 3, 1, 3}}};
+  ASSERT_EQ(buffers.size(), expected.size());
+  for (auto const& file : expected) {
+    auto const& buffer = buffers.at(file.first);
+    cudf_io::parquet_reader_options read_opts = cudf_io::parquet_reader_options::builder(
+      cudf_io::source_info{buffer.data(), buffer.size()});
+    auto result = cudf_io::read_parquet(read_opts);
+
+    column_wrapper<int64_t> expected_values(file.second.begin(), file.second.end());
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), table_view({expected_values}));
+    EXPECT_EQ(result.metadata.column_names, std::vector<std::string>{"v"});
+  }
+}
+
 TEST_F(ParquetChunkedWriterTest, LargeTables)
 {
   srand(31337);
@@ -1919,6 +2016,278 @@ TEST_F(ParquetWriterTest, DecimalWrite)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table);
 }
 
+TEST_F(ParquetWriterTest, DeltaBinaryPackedEncoding)
+{
+  constexpr cudf::size_type num_rows = 1000;
+  auto col0_data                     = random_values<int8_t>(num_rows);
+  auto col1_data                     = random_values<int32_t>(num_rows);
+  auto col2_data = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int64_t>(i) * 1000 + (i % 7); });
+  auto col3_data = random_values<int64_t>(num_rows);
+
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 11 != 0; });
+
+  column_wrapper<int8_t> col0{col0_data.begin(), col0_data.end(), valids};
+  column_wrapper<int32_t> col1{col1_data.begin(), col1_data.end()};
+  column_wrapper<int64_t> col2{col2_data, col2_data + num_rows, valids};
+  column_wrapper<int64_t> col3{col3_data.begin(), col3_data.end(), valids};
+
+  auto expected = table_view{{col0, col1, col2, col3}};
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  for (auto &col_meta : expected_metadata.column_metadata) {
+    col_meta.set_encoding(cudf_io::column_encoding::DELTA_BINARY_PACKED);
+  }
+
+  auto filepath = temp_env->get_temp_filepath("DeltaBinaryPackedEncoding.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata);
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto result = cudf_io::read_parquet(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, ByteStreamSplitEncoding)
+{
+  constexpr cudf::size_type num_rows = 1000;
+  auto col0_data                     = random_values<float>(num_rows);
+  auto col1_data                     = random_values<double>(num_rows);
+
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+
+  column_wrapper<float> col0{col0_data.begin(), col0_data.end(), valids};
+  column_wrapper<double> col1{col1_data.begin(), col1_data.end()};
+
+  auto expected = table_view{{col0, col1}};
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_encoding(cudf_io::column_encoding::BYTE_STREAM_SPLIT);
+  expected_metadata.column_metadata[1].set_encoding(cudf_io::column_encoding::BYTE_STREAM_SPLIT);
+
+  auto filepath = temp_env->get_temp_filepath("ByteStreamSplitEncoding.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata);
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto result = cudf_io::read_parquet(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, InvalidColumnEncoding)
+{
+  auto col0_data = random_values<double>(10);
+  auto col1_data = random_values<int32_t>(10);
+  column_wrapper<double> col0{col0_data.begin(), col0_data.end()};
+  column_wrapper<int32_t> col1{col1_data.begin(), col1_data.end()};
+  auto table = table_view{{col0, col1}};
+
+  auto filepath = temp_env->get_temp_filepath("InvalidColumnEncoding.parquet");
+  cudf_io::table_input_metadata metadata(table);
+  cudf_io::parquet_writer_options args =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, table)
+      .metadata(&metadata);
+
+  // DELTA_BINARY_PACKED is only valid for integers
+  metadata.column_metadata[0].set_encoding(cudf_io::column_encoding::DELTA_BINARY_PACKED);
+  EXPECT_THROW(cudf_io::write_parquet(args), cudf::logic_error);
+
+  // BYTE_STREAM_SPLIT is only valid for floating-point
+  metadata.column_metadata[0].set_encoding(cudf_io::column_encoding::AUTO);
+  metadata.column_metadata[1].set_encoding(cudf_io::column_encoding::BYTE_STREAM_SPLIT);
+  EXPECT_THROW(cudf_io::write_parquet(args), cudf::logic_error);
+}
+
+TEST_F(ParquetWriterTest, DictionaryFallback)
+{
+  constexpr auto num_rows = 10000;
+  auto sequence           = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i % 16); });
+  column_wrapper<cudf::string_view> col0(sequence, sequence + num_rows);
+  auto expected = table_view{{col0}};
+
+  auto write = [&](size_t max_dictionary_size) {
+    std::vector<char> out_buffer;
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+        .compression(cudf_io::compression_type::NONE)
+        .max_dictionary_size(max_dictionary_size);
+    cudf_io::write_parquet(out_opts);
+
+    cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+      cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+    auto result = cudf_io::read_parquet(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+    return out_buffer.size();
+  };
+
+  // A dictionary size limit of zero forces plain encoding of the low cardinality column
+  auto const dict_size  = write(512 * 1024);
+  auto const plain_size = write(0);
+  EXPECT_LT(dict_size, plain_size);
+}
+
+TEST_F(ParquetWriterTest, DictionaryColumns)
+{
+  char const* keys[] = {"germany", "france", "", "spain", "italy"};
+  auto sequence =
+    cudf::detail::make_counting_transform_iterator(0, [&](auto i) { return keys[i % 5]; });
+  auto validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  constexpr cudf::size_type num_rows = 1000;
+  column_wrapper<cudf::string_view> strings(sequence, sequence + num_rows, validity);
+  auto dictionary = cudf::dictionary::encode(strings);
+
+  // Dictionary columns are written as their values
+  std::vector<char> out_buffer;
+  cudf_io::parquet_writer_options out_opts = cudf_io::parquet_writer_options::builder(
+    cudf_io::sink_info(&out_buffer), table_view{{dictionary->view()}});
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+  auto result = cudf_io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view{{strings}}, result.tbl->view());
+}
+
+struct ParquetWriterCompressionTest
+  : public ParquetWriterTest,
+    public ::testing::WithParamInterface<cudf_io::compression_type> {
+};
+
+TEST_P(ParquetWriterCompressionTest, RoundTrip)
+{
+  constexpr auto num_rows = 10000;
+  auto sequence           = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i % 1000); });
+  auto values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  column_wrapper<cudf::string_view> col0(sequence, sequence + num_rows);
+  column_wrapper<int32_t> col1(values, values + num_rows);
+  auto expected = table_view{{col0, col1}};
+
+  auto write = [&](cudf_io::compression_type compression) {
+    std::vector<char> out_buffer;
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+        .compression(compression);
+    cudf_io::write_parquet(out_opts);
+
+    cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+      cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+    auto result = cudf_io::read_parquet(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+    return out_buffer.size();
+  };
+
+  EXPECT_LT(write(GetParam()), write(cudf_io::compression_type::NONE));
+}
+
+INSTANTIATE_TEST_CASE_P(ParquetWriter,
+                        ParquetWriterCompressionTest,
+                        ::testing::Values(cudf_io::compression_type::GZIP,
+                                          cudf_io::compression_type::ZSTD));
+
+TEST_F(ParquetWriterTest, MaxPageSize)
+{
+  constexpr auto num_rows = 100000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int32_t> col(sequence, sequence + num_rows);
+  auto expected = table_view{{col}};
+
+  auto write = [&](size_t max_page_size) {
+    std::vector<char> out_buffer;
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+        .compression(cudf_io::compression_type::SNAPPY)
+        .max_page_size_bytes(max_page_size);
+    cudf_io::write_parquet(out_opts);
+
+    cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+      cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+    auto result = cudf_io::read_parquet(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+    return out_buffer.size();
+  };
+
+  // the smaller pages each add a page header
+  EXPECT_GT(write(16 * 1024), write(1024 * 1024));
+}
+
+/**
+ * @brief Resource that counts the allocations made through it.
+ */
+class counting_memory_resource final : public rmm::mr::device_memory_resource {
+ public:
+  explicit counting_memory_resource(rmm::mr::device_memory_resource* upstream)
+    : _upstream{upstream}
+  {
+  }
+
+  int allocations() const noexcept { return _allocations; }
+
+  bool supports_streams() const noexcept override { return _upstream->supports_streams(); }
+
+  bool supports_get_mem_info() const noexcept override { return false; }
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    ++_allocations;
+    return _upstream->allocate(bytes, stream);
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    _upstream->deallocate(ptr, bytes, stream);
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(rmm::cuda_stream_view) const override
+  {
+    return {0, 0};
+  }
+
+  rmm::mr::device_memory_resource* _upstream;
+  int _allocations = 0;
+};
+
+TEST_F(ParquetWriterTest, TemporaryMemoryResource)
+{
+  constexpr auto num_rows = 10000;
+  auto values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  column_wrapper<int32_t> col(values, values + num_rows);
+  auto expected = table_view{{col}};
+
+  counting_memory_resource temporary_mr{rmm::mr::get_current_device_resource()};
+  auto const previous_mr = cudf_io::set_temporary_memory_resource(&temporary_mr);
+  EXPECT_EQ(cudf_io::get_temporary_memory_resource(), &temporary_mr);
+
+  std::vector<char> out_buffer;
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+      .compression(cudf_io::compression_type::SNAPPY);
+  cudf_io::write_parquet(out_opts);
+  auto const write_allocations = temporary_mr.allocations();
+  EXPECT_GT(write_allocations, 0);
+
+  cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+  auto result = cudf_io::read_parquet(in_opts);
+  EXPECT_GT(temporary_mr.allocations(), write_allocations);
+
+  cudf_io::set_temporary_memory_resource(previous_mr);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
 TYPED_TEST(ParquetChunkedWriterNumericTypeTest, UnalignedSize)
 {
   // write out two 31 row tables and make sure they get
@@ -2861,4 +3230,580 @@ TEST_F(ParquetReaderTest, DecimalRead)
   }
 }
 
+TEST_F(ParquetReaderTest, FilterRowGroups)
+{
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto const num_rows = 10;
+  column_wrapper<int32_t> col0_rg0(sequence, sequence + num_rows);
+  column_wrapper<int32_t> col0_rg1(sequence + num_rows, sequence + 2 * num_rows);
+  column_wrapper<int32_t> col0_rg2(sequence + 2 * num_rows, sequence + 3 * num_rows);
+  column_wrapper<double> col1_rg0(sequence, sequence + num_rows);
+  column_wrapper<double> col1_rg1(sequence, sequence + num_rows);
+  column_wrapper<double> col1_rg2(sequence, sequence + num_rows);
+  auto const rg0 = table_view{{col0_rg0, col1_rg0}};
+  auto const rg1 = table_view{{col0_rg1, col1_rg1}};
+  auto const rg2 = table_view{{col0_rg2, col1_rg2}};
+
+  // Each write produces its own row group
+  auto filepath = temp_env->get_temp_filepath("FilterRowGroups.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::parquet_chunked_writer(args).write(rg0).write(rg1).write(rg2);
+
+  auto read_filtered = [&](cudf::ast::expression const& filter) {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+    return cudf_io::read_parquet(read_opts);
+  };
+
+  auto col0 = cudf::ast::column_reference(0);
+  auto col1 = cudf::ast::column_reference(1);
+
+  // Range predicate selecting only the middle row group
+  {
+    auto lower_value = cudf::numeric_scalar<int32_t>(12);
+    auto upper_value = cudf::numeric_scalar<int32_t>(15);
+    auto lower       = cudf::ast::literal(lower_value);
+    auto upper       = cudf::ast::literal(upper_value);
+    auto ge          = cudf::ast::expression(cudf::ast::ast_operator::GREATER_EQUAL, col0, lower);
+    auto lt          = cudf::ast::expression(cudf::ast::ast_operator::LESS, col0, upper);
+    auto filter      = cudf::ast::expression(cudf::ast::ast_operator::LOGICAL_AND, ge, lt);
+
+    auto result = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), rg1);
+  }
+
+  // Equality with the literal on the left-hand side
+  {
+    auto value  = cudf::numeric_scalar<int32_t>(25);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, lit, col0);
+
+    auto result = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), rg2);
+  }
+
+  // Disjunction keeps the first and last row groups
+  {
+    auto low_value  = cudf::numeric_scalar<int32_t>(5);
+    auto high_value = cudf::numeric_scalar<int32_t>(20);
+    auto low        = cudf::ast::literal(low_value);
+    auto high       = cudf::ast::literal(high_value);
+    auto lt         = cudf::ast::expression(cudf::ast::ast_operator::GREATER, low, col0);
+    auto ge         = cudf::ast::expression(cudf::ast::ast_operator::GREATER_EQUAL, col0, high);
+    auto filter     = cudf::ast::expression(cudf::ast::ast_operator::LOGICAL_OR, lt, ge);
+
+    auto result   = read_filtered(filter);
+    auto expected = cudf::concatenate(std::vector<table_view>({rg0, rg2}));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), *expected);
+  }
+
+  // No row group can match
+  {
+    auto value  = cudf::numeric_scalar<double>(100.);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::expression(cudf::ast::ast_operator::GREATER, col1, lit);
+
+    auto result = read_filtered(filter);
+    EXPECT_EQ(result.tbl->num_columns(), 2);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+
+  // Predicates that can't be evaluated from statistics keep every row group
+  {
+    auto value    = cudf::numeric_scalar<int32_t>(1);
+    auto lit      = cudf::ast::literal(value);
+    auto sum      = cudf::ast::expression(cudf::ast::ast_operator::ADD, col0, lit);
+    auto filter   = cudf::ast::expression(cudf::ast::ast_operator::LESS, sum, lit);
+    auto result   = read_filtered(filter);
+    auto expected = cudf::concatenate(std::vector<table_view>({rg0, rg1, rg2}));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), *expected);
+  }
+
+  // Filter can't be combined with row bounds
+  {
+    auto value  = cudf::numeric_scalar<int32_t>(1);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::expression(cudf::ast::ast_operator::LESS, col0, lit);
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+    EXPECT_THROW(read_opts.set_skip_rows(1), cudf::logic_error);
+    EXPECT_THROW(read_opts.set_num_rows(1), cudf::logic_error);
+  }
+}
+
+TEST_F(ParquetReaderTest, PageIndexSkipRows)
+{
+  // Enough rows for several pages per column chunk
+  constexpr cudf::size_type num_rows = 300000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto repeated = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  column_wrapper<int64_t> col0(sequence, sequence + num_rows);
+  column_wrapper<int32_t> col1(repeated, repeated + num_rows);
+  auto const expected = table_view{{col0, col1}};
+
+  auto filepath = temp_env->get_temp_filepath("PageIndexSkipRows.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .stats_level(cudf_io::statistics_freq::STATISTICS_PAGE);
+  cudf_io::write_parquet(out_opts);
+
+  auto const check_window = [&](cudf::size_type skip_rows, cudf::size_type read_rows) {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+        .skip_rows(skip_rows)
+        .num_rows(read_rows);
+    auto result = cudf_io::read_parquet(read_opts);
+    auto slice  = cudf::slice(expected, {skip_rows, skip_rows + read_rows});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), slice[0]);
+  };
+
+  check_window(150000, 1000);
+  check_window(0, 1000);
+  check_window(num_rows - 1000, 1000);
+  check_window(12345, 200000);
+}
+
+TEST_F(ParquetReaderTest, PageIndexFilter)
+{
+  constexpr cudf::size_type num_rows = 300000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int32_t> col0(sequence, sequence + num_rows);
+  column_wrapper<double> col1(sequence, sequence + num_rows);
+  auto const expected = table_view{{col0, col1}};
+
+  auto filepath = temp_env->get_temp_filepath("PageIndexFilter.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .stats_level(cudf_io::statistics_freq::STATISTICS_PAGE);
+  cudf_io::write_parquet(out_opts);
+
+  // The single row group is trimmed to the trailing pages that may match
+  auto col       = cudf::ast::column_reference(0);
+  auto min_value = cudf::numeric_scalar<int32_t>(250000);
+  auto min_lit   = cudf::ast::literal(min_value);
+  auto filter    = cudf::ast::expression(cudf::ast::ast_operator::GREATER_EQUAL, col, min_lit);
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+  auto result = cudf_io::read_parquet(read_opts);
+
+  auto const result_rows = result.tbl->num_rows();
+  EXPECT_LT(result_rows, num_rows);
+  EXPECT_GE(result_rows, num_rows - 250000);
+  auto slice = cudf::slice(expected, {num_rows - result_rows, num_rows});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), slice[0]);
+
+  // Without page statistics the whole row group is read
+  auto filepath_no_index = temp_env->get_temp_filepath("PageIndexFilterNoIndex.parquet");
+  cudf_io::parquet_writer_options no_index_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath_no_index}, expected);
+  cudf_io::write_parquet(no_index_opts);
+  cudf_io::parquet_reader_options no_index_read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath_no_index})
+      .filter(filter);
+  auto no_index_result = cudf_io::read_parquet(no_index_read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(no_index_result.tbl->view(), expected);
+}
+
+TEST_F(ParquetReaderTest, BloomFilter)
+{
+  // Interleaved keys give every row group the same statistics range
+  constexpr cudf::size_type num_rows = 1000;
+  auto keys = [](int rg) {
+    return cudf::detail::make_counting_transform_iterator(
+      0, [rg](auto i) { return static_cast<int64_t>(i) * 4 + rg; });
+  };
+  column_wrapper<int64_t> col0_rg0(keys(0), keys(0) + num_rows);
+  column_wrapper<int64_t> col0_rg1(keys(1), keys(1) + num_rows);
+  column_wrapper<int64_t> col0_rg2(keys(2), keys(2) + num_rows);
+  auto const rg0 = table_view{{col0_rg0}};
+  auto const rg1 = table_view{{col0_rg1}};
+  auto const rg2 = table_view{{col0_rg2}};
+
+  cudf_io::table_input_metadata metadata(rg0);
+  metadata.column_metadata[0].set_name("keys").enable_bloom_filter(true);
+
+  // Each write produces its own row group
+  auto filepath = temp_env->get_temp_filepath("BloomFilter.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath})
+      .bloom_filter_fpp(0.001);
+  args.set_metadata(&metadata);
+  cudf_io::parquet_chunked_writer(args).write(rg0).write(rg1).write(rg2);
+
+  auto read_filtered = [&](cudf::ast::expression const& filter) {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+    return cudf_io::read_parquet(read_opts);
+  };
+
+  auto col = cudf::ast::column_reference(0);
+
+  // Only the row group holding the key is read
+  {
+    auto value  = cudf::numeric_scalar<int64_t>(4 * 500 + 1);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, col, lit);
+
+    auto result = read_filtered(filter);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), rg1);
+  }
+
+  // Either key of a disjunction keeps its row group
+  {
+    auto value0 = cudf::numeric_scalar<int64_t>(4 * 10);
+    auto value2 = cudf::numeric_scalar<int64_t>(4 * 990 + 2);
+    auto lit0   = cudf::ast::literal(value0);
+    auto lit2   = cudf::ast::literal(value2);
+    auto eq0    = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, lit0, col);
+    auto eq2    = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, col, lit2);
+    auto filter = cudf::ast::expression(cudf::ast::ast_operator::LOGICAL_OR, eq0, eq2);
+
+    auto result   = read_filtered(filter);
+    auto expected = cudf::concatenate(std::vector<table_view>({rg0, rg2}));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), *expected);
+  }
+
+  // A key within the statistics range that was never written
+  {
+    auto value  = cudf::numeric_scalar<int64_t>(4 * 250 + 3);
+    auto lit    = cudf::ast::literal(value);
+    auto filter = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, col, lit);
+
+    auto result = read_filtered(filter);
+    EXPECT_EQ(result.tbl->num_columns(), 1);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+}
+
+TEST_F(ParquetWriterTest, BloomFilterInvalidOptions)
+{
+  column_wrapper<bool> bools{true, false, true};
+  column_wrapper<int32_t> ints{1, 2, 3};
+  auto const expected = table_view{{bools, ints}};
+  auto filepath       = temp_env->get_temp_filepath("BloomFilterInvalidOptions.parquet");
+
+  // Boolean columns can't have a bloom filter
+  {
+    cudf_io::table_input_metadata metadata(expected);
+    metadata.column_metadata[0].enable_bloom_filter(true);
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+        .metadata(&metadata);
+    EXPECT_THROW(cudf_io::write_parquet(out_opts), cudf::logic_error);
+  }
+
+  // The false positive probability must be in (0, 1)
+  {
+    cudf_io::table_input_metadata metadata(expected);
+    metadata.column_metadata[1].enable_bloom_filter(true);
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+        .metadata(&metadata)
+        .bloom_filter_fpp(1.5);
+    EXPECT_THROW(cudf_io::write_parquet(out_opts), cudf::logic_error);
+  }
+}
+
+TEST_F(ParquetReaderTest, ChunkedRead)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(4, 1000, true);
+  auto table2 = create_random_fixed_table<int>(4, 1500, true);
+  auto table3 = create_random_fixed_table<int>(4, 500, false);
+  auto full_table = cudf::concatenate(std::vector<table_view>({*table1, *table2, *table3}));
+
+  // Each write produces its own row group
+  auto filepath = temp_env->get_temp_filepath("ChunkedRead.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::parquet_chunked_writer(args).write(*table1).write(*table2).write(*table3);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+
+  auto read_chunks = [&](std::size_t chunk_read_limit, std::size_t pass_read_limit) {
+    auto reader = cudf_io::parquet_chunked_reader(chunk_read_limit, pass_read_limit, read_opts);
+    std::vector<std::unique_ptr<table>> chunks;
+    while (reader.has_next()) { chunks.push_back(std::move(reader.read_chunk().tbl)); }
+    return chunks;
+  };
+  auto concat = [](std::vector<std::unique_ptr<table>> const& chunks) {
+    std::vector<table_view> views;
+    std::transform(chunks.begin(), chunks.end(), std::back_inserter(views), [](auto const& t) {
+      return t->view();
+    });
+    return cudf::concatenate(views);
+  };
+
+  // No limits reads everything at once
+  {
+    auto chunks = read_chunks(0, 0);
+    ASSERT_EQ(chunks.size(), 1u);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(chunks[0]->view(), *full_table);
+  }
+
+  // A tight temporary memory limit reads one row group per chunk
+  {
+    auto chunks = read_chunks(0, 1);
+    ASSERT_EQ(chunks.size(), 3u);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(chunks[0]->view(), *table1);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(chunks[1]->view(), *table2);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(chunks[2]->view(), *table3);
+  }
+
+  // A small output limit splits row groups
+  {
+    auto const limit = 4 * 250 * sizeof(int);
+    auto chunks      = read_chunks(limit, 0);
+    EXPECT_GT(chunks.size(), 3u);
+    for (auto const& chunk : chunks) { EXPECT_LE(chunk->num_rows(), 250); }
+    CUDF_TEST_EXPECT_TABLES_EQUAL(concat(chunks)->view(), *full_table);
+  }
+
+  // Row bounds are honored across chunks
+  {
+    read_opts.set_skip_rows(700);
+    read_opts.set_num_rows(1600);
+    auto chunks   = read_chunks(0, 1);
+    auto expected = cudf::slice(full_table->view(), {700, 2300});
+    ASSERT_EQ(chunks.size(), 2u);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(concat(chunks)->view(), expected[0]);
+  }
+}
+
+TEST_F(ParquetReaderTest, ChunkedReadStrings)
+{
+  auto sequence = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "string" + std::to_string(i); });
+  auto validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  column_wrapper<cudf::string_view> col0(sequence, sequence + 2000, validity);
+  auto expected = table_view{{col0}};
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadStrings.parquet");
+  cudf_io::parquet_writer_options args =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected);
+  cudf_io::write_parquet(args);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto reader = cudf_io::parquet_chunked_reader(4096, read_opts);
+  std::vector<std::unique_ptr<table>> chunks;
+  while (reader.has_next()) { chunks.push_back(std::move(reader.read_chunk().tbl)); }
+  EXPECT_GT(chunks.size(), 1u);
+  std::vector<table_view> views;
+  for (auto const& chunk : chunks) { views.push_back(chunk->view()); }
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::concatenate(views)->view(), expected);
+}
+
+TEST_F(ParquetReaderTest, ChunkedReadLargeRowGroup)
+{
+  // A single row group of 8 pages of 5000 rows per column
+  srand(31337);
+  constexpr auto num_rows = 40000;
+  auto expected           = create_random_fixed_table<int>(4, num_rows, false);
+  auto filepath           = temp_env->get_temp_filepath("ChunkedReadLargeRowGroup.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, *expected)
+      .max_page_size_bytes(1024)
+      .max_dictionary_size(0);
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  using statistics_mr = rmm::mr::statistics_resource_adaptor<rmm::mr::device_memory_resource>;
+
+  // The compressed and decompressed pages are allocated from the temporary memory resource
+  statistics_mr full_mr{rmm::mr::get_current_device_resource()};
+  auto const previous_mr = cudf_io::set_temporary_memory_resource(&full_mr);
+  auto const full        = cudf_io::read_parquet(read_opts);
+  cudf_io::set_temporary_memory_resource(previous_mr);
+  auto const full_bytes = full_mr.get_bytes_counter();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(full.tbl->view(), *expected);
+
+  auto const pass_read_limit  = static_cast<std::size_t>(full_bytes.peak / 3);
+  auto const chunk_read_limit = 2000 * 4 * sizeof(int);
+  statistics_mr chunked_mr{rmm::mr::get_current_device_resource()};
+  cudf_io::set_temporary_memory_resource(&chunked_mr);
+  auto reader = cudf_io::parquet_chunked_reader(chunk_read_limit, pass_read_limit, read_opts);
+  std::vector<std::unique_ptr<table>> chunks;
+  while (reader.has_next()) { chunks.push_back(std::move(reader.read_chunk().tbl)); }
+  cudf_io::set_temporary_memory_resource(previous_mr);
+  auto const chunked_bytes = chunked_mr.get_bytes_counter();
+
+  EXPECT_GT(chunks.size(), 1u);
+  for (auto const& chunk : chunks) {
+    EXPECT_LE(chunk->num_rows() * 4 * sizeof(int), chunk_read_limit);
+  }
+  std::vector<table_view> views;
+  for (auto const& chunk : chunks) { views.push_back(chunk->view()); }
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::concatenate(views)->view(), *expected);
+
+  // Only the pages of one pass are held at a time, and each page is read and decompressed once
+  EXPECT_LE(chunked_bytes.peak, static_cast<int64_t>(pass_read_limit));
+  EXPECT_LE(chunked_bytes.total, full_bytes.total);
+}
+
+TEST_F(ParquetReaderTest, PipelinedRead)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(4, 1000, true);
+  auto table2 = create_random_fixed_table<int>(4, 1500, true);
+  auto table3 = create_random_fixed_table<int>(4, 500, false);
+  auto full_table = cudf::concatenate(std::vector<table_view>({*table1, *table2, *table3}));
+
+  // One file per table; the second one holds two row groups
+  auto const filepath1 = temp_env->get_temp_filepath("PipelinedRead1.parquet");
+  auto const filepath2 = temp_env->get_temp_filepath("PipelinedRead2.parquet");
+  auto const filepath3 = temp_env->get_temp_filepath("PipelinedRead3.parquet");
+  cudf_io::parquet_writer_options out_opts1 =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath1}, *table1);
+  cudf_io::write_parquet(out_opts1);
+  auto halves = cudf::split(*table2, {750});
+  cudf_io::chunked_parquet_writer_options out_opts2 =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath2});
+  cudf_io::parquet_chunked_writer(out_opts2).write(halves[0]).write(halves[1]);
+  cudf_io::parquet_writer_options out_opts3 =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath3}, *table3);
+  cudf_io::write_parquet(out_opts3);
+
+  auto const sources =
+    cudf_io::source_info{std::vector<std::string>{filepath1, filepath2, filepath3}};
+
+  // A tight limit reads one row group per batch
+  {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(sources).pipeline_read_limit(1);
+    auto result = cudf_io::read_parquet(read_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), *full_table);
+  }
+
+  // Row bounds are honored across batches
+  {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(sources).pipeline_read_limit(1);
+    read_opts.set_skip_rows(700);
+    read_opts.set_num_rows(1600);
+    auto result   = cudf_io::read_parquet(read_opts);
+    auto expected = cudf::slice(full_table->view(), {700, 2300});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected[0]);
+  }
+}
+
+TEST_F(ParquetReaderTest, ReuseMetadata)
+{
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int32_t> col0(sequence, sequence + 100);
+  column_wrapper<double> col1(sequence, sequence + 100);
+  auto const expected = table_view{{col0, col1}};
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("ints");
+  expected_metadata.column_metadata[1].set_name("doubles");
+
+  auto filepath = temp_env->get_temp_filepath("ReuseMetadata.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata);
+  cudf_io::write_parquet(out_opts);
+
+  auto const metadata = cudf_io::read_parquet_metadata(cudf_io::source_info{filepath});
+  ASSERT_EQ(metadata.size(), 1u);
+  EXPECT_EQ(metadata[0].num_rows(), 100);
+  EXPECT_EQ(metadata[0].num_row_groups(), 1);
+
+  // The parsed footer serves reads with different column selections
+  for (auto const& name : {"ints", "doubles"}) {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+        .columns({name})
+        .metadata(metadata);
+    auto result = cudf_io::read_parquet(read_opts);
+    auto column = std::string{name} == "ints" ? expected.column(0) : expected.column(1);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->view().column(0), column);
+  }
+
+  // One footer is needed per source
+  {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(
+        cudf_io::source_info{std::vector<std::string>{filepath, filepath}})
+        .metadata(metadata);
+    EXPECT_THROW(cudf_io::read_parquet(read_opts), cudf::logic_error);
+  }
+}
+
+TEST_F(ParquetReaderTest, MetadataCache)
+{
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int64_t> col0(sequence, sequence + 100);
+  column_wrapper<int64_t> col1(sequence, sequence + 200);
+  auto const table0 = table_view{{col0}};
+  auto const table1 = table_view{{col1}};
+
+  auto filepath = temp_env->get_temp_filepath("MetadataCache.parquet");
+  auto const write = [&](table_view const& table) {
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, table);
+    cudf_io::write_parquet(out_opts);
+  };
+  auto const read = [&]() {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+    return cudf_io::read_parquet(read_opts);
+  };
+
+  cudf_io::set_parquet_metadata_cache_size(4);
+  write(table0);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(read().tbl->view(), table0);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(read().tbl->view(), table0);
+
+  // Rewriting the file invalidates its cached footer
+  write(table1);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(read().tbl->view(), table1);
+  cudf_io::set_parquet_metadata_cache_size(0);
+}
+
+TEST_F(ParquetReaderTest, StringsToDictionary)
+{
+  char const* keys[] = {"germany", "france", "", "spain", "italy"};
+  auto sequence =
+    cudf::detail::make_counting_transform_iterator(0, [&](auto i) { return keys[i % 5]; });
+  auto validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  constexpr cudf::size_type num_rows = 1000;
+  column_wrapper<cudf::string_view> col0(sequence, sequence + num_rows, validity);
+  column_wrapper<cudf::string_view> col1(sequence, sequence + num_rows);
+  auto const expected = table_view{{col0, col1}};
+  auto halves         = cudf::split(expected, {400});
+
+  // Two row groups with their own dictionaries; the second column is PLAIN encoded
+  cudf_io::table_input_metadata metadata(expected);
+  metadata.column_metadata[1].set_encoding(cudf_io::column_encoding::PLAIN);
+  auto filepath = temp_env->get_temp_filepath("StringsToDictionary.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  args.set_metadata(&metadata);
+  cudf_io::parquet_chunked_writer(args).write(halves[0]).write(halves[1]);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .convert_strings_to_dictionary(true);
+  auto result = cudf_io::read_parquet(read_opts);
+  ASSERT_EQ(result.tbl->num_columns(), 2);
+  for (cudf::size_type i = 0; i < 2; ++i) {
+    auto const& column = result.tbl->get_column(i);
+    ASSERT_EQ(column.type().id(), cudf::type_id::DICTIONARY32);
+    auto const dictionary = cudf::dictionary_column_view(column.view());
+    EXPECT_EQ(dictionary.keys_size(), 5);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::dictionary::decode(dictionary)->view(),
+                                   expected.column(i));
+  }
+
+  // No rows still gives dictionary columns
+  read_opts.set_num_rows(0);
+  auto empty = cudf_io::read_parquet(read_opts);
+  EXPECT_EQ(empty.tbl->get_column(0).type().id(), cudf::type_id::DICTIONARY32);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/io/statistics.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <numeric>
+#include <vector>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+struct ColumnStatisticsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ColumnStatisticsTest, Chunks)
+{
+  fixed_width_column_wrapper<int32_t> ints({5, -2, 7, 1, 3, 4, 9}, {1, 1, 0, 1, 0, 0, 1});
+  fixed_width_column_wrapper<double> doubles{1.5, -0.5, 2.0, 8.0, 3.0, 0.25, -4.0};
+  strings_column_wrapper strings({"b", "abc", "", "z", "xy", "q", "c"}, {1, 1, 1, 1, 0, 0, 0});
+
+  auto const stats =
+    cudf::io::compute_column_statistics(cudf::table_view({ints, doubles, strings}), 3);
+  ASSERT_EQ(stats.size(), 3u);
+
+  fixed_width_column_wrapper<int32_t> ints_nulls{1, 2, 0};
+  fixed_width_column_wrapper<int32_t> ints_min{-2, 1, 9};
+  fixed_width_column_wrapper<int32_t> ints_max{5, 1, 9};
+  fixed_width_column_wrapper<int64_t> ints_sum{3, 1, 9};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*stats[0].null_counts, ints_nulls);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*stats[0].min_values, ints_min);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*stats[0].max_values, ints_max);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*stats[0].sums, ints_sum);
+
+  fixed_width_column_wrapper<double> doubles_min{-0.5, 0.25, -4.0};
+  fixed_width_column_wrapper<double> doubles_max{2.0, 8.0, -4.0};
+  fixed_width_column_wrapper<double> doubles_sum{3.0, 11.25, -4.0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*stats[1].min_values, doubles_min);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*stats[1].max_values, doubles_max);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*stats[1].sums, doubles_sum);
+
+  fixed_width_column_wrapper<int32_t> strings_nulls{0, 2, 1};
+  strings_column_wrapper strings_min({"", "z", ""}, {1, 1, 0});
+  strings_column_wrapper strings_max({"b", "z", ""}, {1, 1, 0});
+  fixed_width_column_wrapper<int64_t> strings_sum({4, 1, 0}, {1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*stats[2].null_counts, strings_nulls);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*stats[2].min_values, strings_min);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*stats[2].max_values, strings_max);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*stats[2].sums, strings_sum);
+}
+
+TEST_F(ColumnStatisticsTest, LargeChunks)
+{
+  // the chunks span several groups of rows that are merged
+  constexpr cudf::size_type num_rows = 50000;
+  std::vector<int16_t> values(num_rows);
+  std::iota(values.begin(), values.end(), int16_t{-20000});
+  fixed_width_column_wrapper<int16_t> col(values.begin(), values.end());
+
+  auto const stats = cudf::io::compute_column_statistics(cudf::table_view({col}), 30000);
+
+  fixed_width_column_wrapper<int32_t> nulls{0, 0};
+  fixed_width_column_wrapper<int16_t> min{-20000, 10000};
+  fixed_width_column_wrapper<int16_t> max{9999, 29999};
+  fixed_width_column_wrapper<int64_t> sum{-150015000, 399990000};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*stats[0].null_counts, nulls);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*stats[0].min_values, min);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*stats[0].max_values, max);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*stats[0].sums, sum);
+}
+
+TEST_F(ColumnStatisticsTest, UnsupportedType)
+{
+  fixed_width_column_wrapper<uint32_t> col{1, 2, 3};
+  EXPECT_THROW(cudf::io::compute_column_statistics(cudf::table_view({col}), 2),
+               cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/linearizer.hpp>
+#include <cudf/ast/operators.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+using column_wrapper = cudf::test::fixed_width_column_wrapper<int32_t>;
+using join_indices   = std::pair<std::unique_ptr<rmm::device_uvector<cudf::size_type>>,
+                               std::unique_ptr<rmm::device_uvector<cudf::size_type>>>;
+using join_pairs     = std::vector<std::pair<cudf::size_type, cudf::size_type>>;
+
+constexpr cudf::size_type None = std::numeric_limits<cudf::size_type>::min();
+
+struct ConditionalJoinTest : public cudf::test::BaseFixture {
+  /**
+   * @brief Copies the pairs of indices returned by a join to the host.
+   */
+  join_pairs to_pairs(join_indices const& result)
+  {
+    auto const to_vector = [](rmm::device_uvector<cudf::size_type> const& indices) {
+      auto const view = cudf::column_view(
+        cudf::data_type{cudf::type_id::INT32}, indices.size(), indices.data());
+      return cudf::test::to_host<cudf::size_type>(view).first;
+    };
+    auto const left  = to_vector(*result.first);
+    auto const right = to_vector(*result.second);
+    EXPECT_EQ(left.size(), right.size());
+    join_pairs pairs;
+    for (size_t i = 0; i < left.size(); ++i) {
+      pairs.emplace_back(left[i], right[i]);
+    }
+    return pairs;
+  }
+};
+
+TEST_F(ConditionalJoinTest, RangeJoin)
+{
+  // Join each value of the left table to the [begin, end) ranges of the right table containing it
+  column_wrapper value{0, 5, 10, 15};
+  column_wrapper begin{0, 4, 9, 0};
+  column_wrapper end{3, 8, 12, 6};
+  cudf::table_view left({value});
+  cudf::table_view right({begin, end});
+
+  auto const left_value  = cudf::ast::column_reference(0, cudf::ast::table_reference::LEFT);
+  auto const right_begin = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto const right_end   = cudf::ast::column_reference(1, cudf::ast::table_reference::RIGHT);
+  auto const after_begin =
+    cudf::ast::expression(cudf::ast::ast_operator::GREATER_EQUAL, left_value, right_begin);
+  auto const before_end =
+    cudf::ast::expression(cudf::ast::ast_operator::LESS, left_value, right_end);
+  auto const predicate =
+    cudf::ast::expression(cudf::ast::ast_operator::LOGICAL_AND, after_begin, before_end);
+
+  EXPECT_EQ(to_pairs(cudf::conditional_inner_join(left, right, predicate)),
+            (join_pairs{{0, 0}, {0, 3}, {1, 1}, {1, 3}, {2, 2}}));
+  EXPECT_EQ(to_pairs(cudf::conditional_left_join(left, right, predicate)),
+            (join_pairs{{0, 0}, {0, 3}, {1, 1}, {1, 3}, {2, 2}, {3, None}}));
+}
+
+TEST_F(ConditionalJoinTest, EmptyRight)
+{
+  column_wrapper left_col{0, 1, 2};
+  column_wrapper right_col{};
+  cudf::table_view left({left_col});
+  cudf::table_view right({right_col});
+
+  auto const left_ref  = cudf::ast::column_reference(0, cudf::ast::table_reference::LEFT);
+  auto const right_ref = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto const predicate = cudf::ast::expression(cudf::ast::ast_operator::LESS, left_ref, right_ref);
+
+  EXPECT_TRUE(to_pairs(cudf::conditional_inner_join(left, right, predicate)).empty());
+  EXPECT_EQ(to_pairs(cudf::conditional_left_join(left, right, predicate)),
+            (join_pairs{{0, None}, {1, None}, {2, None}}));
+}
+
+TEST_F(ConditionalJoinTest, InvalidPredicate)
+{
+  column_wrapper left_col{0, 1, 2};
+  column_wrapper right_col{1, 2, 3};
+  column_wrapper nullable_col({1, 2, 3}, {1, 0, 1});
+
+  auto const left_ref  = cudf::ast::column_reference(0, cudf::ast::table_reference::LEFT);
+  auto const right_ref = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto const sum = cudf::ast::expression(cudf::ast::ast_operator::ADD, left_ref, right_ref);
+  auto const less = cudf::ast::expression(cudf::ast::ast_operator::LESS, left_ref, right_ref);
+
+  EXPECT_THROW(cudf::conditional_inner_join(
+                 cudf::table_view({left_col}), cudf::table_view({right_col}), sum),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::conditional_inner_join(
+                 cudf::table_view({left_col}), cudf::table_view({nullable_col}), less),
+               cudf::logic_error);
+}
+
+TEST_F(ConditionalJoinTest, MixedJoin)
+{
+  column_wrapper left_key{0, 1, 2, 1};
+  column_wrapper right_key{1, 2, 3, 1};
+  column_wrapper left_value{4, 4, 4, 2};
+  column_wrapper right_value{3, 4, 5, 1};
+  cudf::table_view left_equality({left_key});
+  cudf::table_view right_equality({right_key});
+  cudf::table_view left_conditional({left_value});
+  cudf::table_view right_conditional({right_value});
+
+  auto const left_ref  = cudf::ast::column_reference(0, cudf::ast::table_reference::LEFT);
+  auto const right_ref = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto const predicate =
+    cudf::ast::expression(cudf::ast::ast_operator::GREATER, left_ref, right_ref);
+
+  auto inner = to_pairs(cudf::mixed_inner_join(
+    left_equality, right_equality, left_conditional, right_conditional, predicate));
+  std::sort(inner.begin(), inner.end());
+  EXPECT_EQ(inner, (join_pairs{{1, 0}, {1, 3}, {3, 3}}));
+
+  auto left = to_pairs(cudf::mixed_left_join(
+    left_equality, right_equality, left_conditional, right_conditional, predicate));
+  std::sort(left.begin(), left.end());
+  EXPECT_EQ(left, (join_pairs{{0, None}, {1, 0}, {1, 3}, {2, None}, {3, 3}}));
+}
+
+TEST_F(ConditionalJoinTest, MixedJoinDuplicateKeys)
+{
+  // Every left row has the same key as every right row, so only the predicate selects pairs
+  std::vector<int32_t> keys(1000, 7);
+  std::vector<int32_t> values(1000);
+  std::iota(values.begin(), values.end(), 0);
+  column_wrapper left_key(keys.begin(), keys.begin() + 10);
+  column_wrapper right_key(keys.begin(), keys.end());
+  column_wrapper left_value(values.begin(), values.begin() + 10);
+  column_wrapper right_value(values.begin(), values.end());
+
+  auto const left_ref  = cudf::ast::column_reference(0, cudf::ast::table_reference::LEFT);
+  auto const right_ref = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto const predicate =
+    cudf::ast::expression(cudf::ast::ast_operator::GREATER, left_ref, right_ref);
+
+  auto result = to_pairs(cudf::mixed_inner_join(cudf::table_view({left_key}),
+                                                cudf::table_view({right_key}),
+                                                cudf::table_view({left_value}),
+                                                cudf::table_view({right_value}),
+                                                predicate));
+  std::sort(result.begin(), result.end());
+  join_pairs expected;
+  for (cudf::size_type l = 0; l < 10; ++l) {
+    for (cudf::size_type r = 0; r < l; ++r) {
+      expected.emplace_back(l, r);
+    }
+  }
+  EXPECT_EQ(result, expected);
+}
@@ -17,11 +17,14 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/dictionary/encode.hpp>
 #include <cudf/join.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -30,10 +33,17 @@
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
 #include <limits>
+#include <numeric>
+#include <tuple>
+#include <vector>
 
 template <typename T>
 using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
@@ -805,6 +815,46 @@ TEST_F(JoinTest, InnerJoinWithStructsAndNulls)
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
 }
 
+TEST_F(JoinTest, InnerJoinWithLists)
+{
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+  using cudf::test::iterator_with_null_at;
+
+  auto const left = LCW{
+    {LCW{1, 2}, LCW{3}, LCW{}, LCW{1, 2, 3}, LCW{}, LCW{{1, 0}, iterator_with_null_at(1)}},
+    iterator_with_null_at(4)};
+  auto const right = LCW{
+    {LCW{3}, LCW{1, 2}, LCW{4}, LCW{}, LCW{}, LCW{{1, 0}, iterator_with_null_at(1)}},
+    iterator_with_null_at(4)};
+
+  auto sorted_join_result = [](auto const& result) {
+    auto const result_table =
+      cudf::table_view({cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                          static_cast<cudf::size_type>(result.first->size()),
+                                          result.first->data()},
+                        cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                          static_cast<cudf::size_type>(result.second->size()),
+                                          result.second->data()}});
+    return cudf::sort(result_table);
+  };
+
+  {
+    auto const result = cudf::inner_join(cudf::table_view{{left}}, cudf::table_view{{right}});
+    column_wrapper<int32_t> col_gold_0{{0, 1, 2, 4, 5}};
+    column_wrapper<int32_t> col_gold_1{{1, 0, 3, 4, 5}};
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({col_gold_0, col_gold_1}),
+                                  *sorted_join_result(result));
+  }
+  {
+    auto const result = cudf::inner_join(
+      cudf::table_view{{left}}, cudf::table_view{{right}}, cudf::null_equality::UNEQUAL);
+    column_wrapper<int32_t> col_gold_0{{0, 1, 2}};
+    column_wrapper<int32_t> col_gold_1{{1, 0, 3}};
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({col_gold_0, col_gold_1}),
+                                  *sorted_join_result(result));
+  }
+}
+
 // // Test to check join behaviour when join keys are null.
 TEST_F(JoinTest, InnerJoinOnNulls)
 {
@@ -1339,6 +1389,388 @@ TEST_F(JoinTest, HashJoinSequentialProbes)
   }
 }
 
+TEST_F(JoinTest, HashJoinDuplicateKeys)
+{
+  // Every build key repeats many times, so the matches of a probe row span many hash table slots
+  constexpr cudf::size_type num_build_rows = 10000;
+  constexpr cudf::size_type num_keys       = 10;
+  auto build_keys =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % num_keys; });
+  column_wrapper<int32_t> build_col(build_keys, build_keys + num_build_rows);
+  auto probe_keys = thrust::make_counting_iterator(0);
+  column_wrapper<int32_t> probe_col(probe_keys, probe_keys + 2 * num_keys);
+
+  cudf::hash_join hash_join(cudf::table_view{{build_col}}, cudf::null_equality::EQUAL);
+
+  auto const inner = hash_join.inner_join(cudf::table_view{{probe_col}});
+  EXPECT_EQ(inner.first->size(), static_cast<size_t>(num_build_rows));
+
+  auto const left = hash_join.left_join(cudf::table_view{{probe_col}});
+  EXPECT_EQ(left.first->size(), static_cast<size_t>(num_build_rows + num_keys));
+
+  // Each matched pair must have equal keys
+  auto const inner_table =
+    cudf::table_view({cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                        static_cast<cudf::size_type>(inner.first->size()),
+                                        inner.first->data()},
+                      cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                        static_cast<cudf::size_type>(inner.second->size()),
+                                        inner.second->data()}});
+  auto const probe_matches = cudf::gather(cudf::table_view{{probe_col}}, inner_table.column(0));
+  auto const build_matches = cudf::gather(cudf::table_view{{build_col}}, inner_table.column(1));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(probe_matches->get_column(0), build_matches->get_column(0));
+}
+
+TEST_F(JoinTest, HashJoinWithOutputSize)
+{
+  column_wrapper<int32_t> build_col{{0, 1, 2, 2, 3, 3, 3}, {1, 1, 1, 1, 1, 1, 0}};
+  column_wrapper<int32_t> probe_col{{3, 2, 5, 0, 3, 7}, {1, 1, 1, 1, 0, 1}};
+  cudf::table_view build{{build_col}};
+  cudf::table_view probe{{probe_col}};
+
+  cudf::hash_join hash_join(build, cudf::null_equality::EQUAL);
+
+  auto const inner_size = hash_join.inner_join_size(probe);
+  auto const inner      = hash_join.inner_join(probe);
+  EXPECT_EQ(inner_size, 6u);
+  EXPECT_EQ(inner.first->size(), inner_size);
+
+  auto const left_size = hash_join.left_join_size(probe);
+  auto const left      = hash_join.left_join(probe);
+  EXPECT_EQ(left_size, 8u);
+  EXPECT_EQ(left.first->size(), left_size);
+
+  auto const unequal_size = hash_join.inner_join_size(probe, cudf::null_equality::UNEQUAL);
+  EXPECT_EQ(unequal_size, 5u);
+
+  // Joining with the exact size gives the same result as joining with an estimated size
+  auto const sized = hash_join.inner_join(probe, cudf::null_equality::EQUAL, inner_size);
+  auto const as_table = [](auto const& indices) {
+    return cudf::table_view({cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                               static_cast<cudf::size_type>(indices.first->size()),
+                                               indices.first->data()},
+                             cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                               static_cast<cudf::size_type>(indices.second->size()),
+                                               indices.second->data()}});
+  };
+  auto const sorted = [](cudf::table_view const& t) {
+    return cudf::gather(t, *cudf::sorted_order(t));
+  };
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted(as_table(inner)), *sorted(as_table(sized)));
+}
+
+TEST_F(JoinTest, HashJoinHeavyHitters)
+{
+  // Most build rows share a single key, which is joined apart from the hash table
+  std::vector<int32_t> build_data(3000, 7);
+  std::iota(build_data.begin() + 2000, build_data.end(), 1000);
+  std::vector<int32_t> probe_data{7, 1500, 5, 7, 1999};
+  column_wrapper<int32_t> build_col(build_data.begin(), build_data.end());
+  column_wrapper<int32_t> probe_col(probe_data.begin(), probe_data.end());
+  cudf::table_view build{{build_col}};
+  cudf::table_view probe{{probe_col}};
+
+  using index_pairs = std::vector<std::pair<cudf::size_type, cudf::size_type>>;
+
+  auto const to_pairs = [](auto const& indices) {
+    auto const to_vector = [](rmm::device_uvector<cudf::size_type> const& vector) {
+      return cudf::test::to_host<cudf::size_type>(
+               cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                 static_cast<cudf::size_type>(vector.size()),
+                                 vector.data()})
+        .first;
+    };
+    auto const left  = to_vector(*indices.first);
+    auto const right = to_vector(*indices.second);
+    index_pairs pairs;
+    for (size_t i = 0; i < left.size(); ++i) {
+      pairs.emplace_back(left[i], right[i]);
+    }
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+  };
+
+  index_pairs expected;
+  for (cudf::size_type p = 0; p < static_cast<cudf::size_type>(probe_data.size()); ++p) {
+    for (cudf::size_type b = 0; b < static_cast<cudf::size_type>(build_data.size()); ++b) {
+      if (probe_data[p] == build_data[b]) { expected.emplace_back(p, b); }
+    }
+  }
+
+  cudf::hash_join hash_join(build, cudf::null_equality::EQUAL);
+  EXPECT_EQ(to_pairs(hash_join.inner_join(probe)), expected);
+
+  auto const inner_size = hash_join.inner_join_size(probe);
+  EXPECT_EQ(inner_size, expected.size());
+  EXPECT_EQ(to_pairs(hash_join.inner_join(probe, cudf::null_equality::EQUAL, inner_size)),
+            expected);
+
+  expected.emplace_back(2, std::numeric_limits<cudf::size_type>::min());
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(to_pairs(hash_join.left_join(probe)), expected);
+  EXPECT_EQ(hash_join.full_join(probe).first->size(), expected.size() + 998);
+}
+
+TEST_F(JoinTest, HashJoinHeavyHitterNulls)
+{
+  // The null key is a heavy hitter when the build table treats nulls as equal
+  constexpr cudf::size_type num_nulls = 2000;
+  auto build_values                   = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i < num_nulls ? 0 : i; });
+  auto build_valids = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i >= num_nulls; });
+  column_wrapper<int32_t> build_col(build_values, build_values + 3000, build_valids);
+  column_wrapper<int32_t> probe_col{{0, 2500}, {false, true}};
+  cudf::table_view build{{build_col}};
+  cudf::table_view probe{{probe_col}};
+
+  cudf::hash_join hash_join(build, cudf::null_equality::EQUAL);
+  EXPECT_EQ(hash_join.inner_join(probe, cudf::null_equality::EQUAL).first->size(),
+            static_cast<std::size_t>(num_nulls + 1));
+
+  // Probing with unequal nulls must not match the null key through the heavy hitters
+  auto const unequal   = hash_join.inner_join(probe, cudf::null_equality::UNEQUAL);
+  auto const as_column = [](rmm::device_uvector<cudf::size_type> const& vector) {
+    return cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                             static_cast<cudf::size_type>(vector.size()),
+                             vector.data()};
+  };
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(as_column(*unequal.first), column_wrapper<int32_t>{1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(as_column(*unequal.second), column_wrapper<int32_t>{2500});
+}
+
+TEST_F(JoinTest, HashJoinChunks)
+{
+  column_wrapper<int32_t> build_col{{1, 1, 1, 2, 3, 3}};
+  column_wrapper<int32_t> probe_col{{1, 2, 5, 3, 1, 4, 3}};
+  cudf::table_view build{{build_col}};
+  cudf::table_view probe{{probe_col}};
+
+  cudf::hash_join hash_join(build, cudf::null_equality::EQUAL);
+
+  using index_pairs = std::vector<std::pair<cudf::size_type, cudf::size_type>>;
+  auto const to_pairs = [](auto const& left, auto const& right) {
+    auto const to_vector = [](rmm::device_uvector<cudf::size_type> const& indices) {
+      return cudf::test::to_host<cudf::size_type>(
+               cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                 static_cast<cudf::size_type>(indices.size()),
+                                 indices.data()})
+        .first;
+    };
+    auto const left_host  = to_vector(left);
+    auto const right_host = to_vector(right);
+    index_pairs pairs;
+    for (size_t i = 0; i < left_host.size(); ++i) {
+      pairs.emplace_back(left_host[i], right_host[i]);
+    }
+    return pairs;
+  };
+
+  // Concatenating the chunks gives the whole join, and a chunk only exceeds the maximum size
+  // when it holds a single probe row
+  auto const join_in_chunks = [&](auto join_chunk, std::size_t max_output_rows) {
+    index_pairs pairs;
+    std::vector<std::size_t> chunk_sizes;
+    cudf::size_type probe_row = 0;
+    while (probe_row < probe.num_rows()) {
+      auto chunk       = join_chunk(probe_row, max_output_rows);
+      auto chunk_pairs = to_pairs(*std::get<0>(chunk), *std::get<1>(chunk));
+      auto next_row    = std::get<2>(chunk);
+      EXPECT_GT(next_row, probe_row);
+      EXPECT_TRUE(chunk_pairs.size() <= max_output_rows or next_row == probe_row + 1);
+      chunk_sizes.push_back(chunk_pairs.size());
+      pairs.insert(pairs.end(), chunk_pairs.begin(), chunk_pairs.end());
+      probe_row = next_row;
+    }
+    std::sort(pairs.begin(), pairs.end());
+    return std::make_pair(pairs, chunk_sizes);
+  };
+  auto const inner_chunk = [&](cudf::size_type probe_row, std::size_t max_output_rows) {
+    return hash_join.inner_join_chunk(probe, probe_row, max_output_rows);
+  };
+  auto const left_chunk = [&](cudf::size_type probe_row, std::size_t max_output_rows) {
+    return hash_join.left_join_chunk(probe, probe_row, max_output_rows);
+  };
+
+  auto const inner = hash_join.inner_join(probe);
+  auto expected    = to_pairs(*inner.first, *inner.second);
+  std::sort(expected.begin(), expected.end());
+  auto const inner_chunks = join_in_chunks(inner_chunk, 4);
+  EXPECT_EQ(inner_chunks.first, expected);
+  EXPECT_EQ(inner_chunks.second, (std::vector<std::size_t>{4, 2, 3, 2}));
+  EXPECT_EQ(join_in_chunks(inner_chunk, 1).first, expected);
+
+  auto const left = hash_join.left_join(probe);
+  expected        = to_pairs(*left.first, *left.second);
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(join_in_chunks(left_chunk, 3).first, expected);
+
+  auto const end = hash_join.inner_join_chunk(probe, probe.num_rows(), 4);
+  EXPECT_EQ(std::get<0>(end)->size(), 0u);
+  EXPECT_EQ(std::get<2>(end), probe.num_rows());
+  EXPECT_THROW(hash_join.inner_join_chunk(probe, probe.num_rows() + 1, 4), cudf::logic_error);
+  EXPECT_THROW(hash_join.inner_join_chunk(probe, 0, 0), cudf::logic_error);
+}
+
+TEST_F(JoinTest, HashJoinBloomFilter)
+{
+  std::vector<int32_t> probe_data(100);
+  std::iota(probe_data.begin(), probe_data.end(), 0);
+  column_wrapper<int32_t> build_col{{0, 2, 4, 6, 8, 2, 7}, {1, 1, 1, 1, 1, 1, 0}};
+  column_wrapper<int32_t> probe_col(probe_data.begin(), probe_data.end());
+  cudf::table_view build{{build_col}};
+  cudf::table_view probe{{probe_col}};
+
+  cudf::hash_join hash_join(build, cudf::null_equality::EQUAL);
+  auto const filter = hash_join.bloom_filter(cudf::null_equality::UNEQUAL);
+  EXPECT_GT(filter.size_bytes(), 0u);
+
+  // A bloom filter has no false negatives
+  auto const mask = filter.contains(probe);
+  auto const host = cudf::test::to_host<bool>(mask->view()).first;
+  for (auto key : {0, 2, 4, 6, 8}) {
+    EXPECT_TRUE(host[key]);
+  }
+
+  // Dropping the rows without a match from the probe table keeps the rows of the inner join
+  auto const filtered      = cudf::apply_boolean_mask(probe, *mask);
+  auto const inner_size    = hash_join.inner_join_size(probe, cudf::null_equality::UNEQUAL);
+  auto const filtered_size  = hash_join.inner_join_size(*filtered, cudf::null_equality::UNEQUAL);
+  EXPECT_EQ(inner_size, 6u);
+  EXPECT_EQ(filtered_size, inner_size);
+
+  // Null probe rows never pass a filter built with unequal nulls
+  column_wrapper<int32_t> null_col{{0, 2, 4}, {1, 0, 1}};
+  auto const null_mask = filter.contains(cudf::table_view{{null_col}});
+  column_wrapper<bool> expected{1, 0, 1};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*null_mask, expected);
+
+  column_wrapper<int64_t> wrong_type{0, 1};
+  EXPECT_THROW(filter.contains(cudf::table_view{{wrong_type}}), cudf::logic_error);
+}
+
+TEST_F(JoinTest, PartitionedJoin)
+{
+  column_wrapper<int32_t> left_keys{{3, 1, 2, 0, 3, 5, 7, 2, 9, 1}};
+  strcol_wrapper left_vals({"a", "b", "c", "d", "e", "f", "g", "h", "i", "j"});
+  column_wrapper<int32_t> right_keys{{2, 2, 0, 4, 3, 8, 1}};
+  column_wrapper<int32_t> right_vals{{10, 11, 12, 13, 14, 15, 16}};
+  cudf::table_view left{{left_keys, left_vals}};
+  cudf::table_view right{{right_keys, right_vals}};
+
+  // Add each table in two chunks
+  cudf::partitioned_join join({0}, {0}, 4);
+  for (auto const& chunk : cudf::split(left, {6})) {
+    join.add_left(chunk);
+  }
+  for (auto const& chunk : cudf::split(right, {3})) {
+    join.add_right(chunk);
+  }
+  EXPECT_EQ(join.num_partitions(), 4);
+
+  auto const sorted = [](cudf::table_view const& t) {
+    return cudf::gather(t, *cudf::sorted_order(t));
+  };
+  auto const join_all_partitions = [&](auto const& join_partition) {
+    std::vector<std::unique_ptr<cudf::table>> results;
+    std::vector<cudf::table_view> views;
+    for (int p = 0; p < join.num_partitions(); ++p) {
+      results.push_back(join_partition(p));
+      views.push_back(results.back()->view());
+    }
+    return sorted(cudf::concatenate(views)->view());
+  };
+
+  auto const inner = join_all_partitions([&](int p) { return join.inner_join(p); });
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted(cudf::inner_join(left, right, {0}, {0})->view()),
+                                     *inner);
+
+  auto const left_result = join_all_partitions([&](int p) { return join.left_join(p); });
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted(cudf::left_join(left, right, {0}, {0})->view()),
+                                     *left_result);
+
+  auto const full = join_all_partitions([&](int p) { return join.full_join(p); });
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted(cudf::full_join(left, right, {0}, {0})->view()),
+                                     *full);
+}
+
+TEST_F(JoinTest, SortMergeJoin)
+{
+  column_wrapper<int32_t> left_keys{{0, 0, 1, 1, 2}, {0, 1, 1, 1, 1}};
+  column_wrapper<int32_t> right_keys{{0, 1, 1, 2, 3}, {0, 1, 1, 1, 1}};
+  cudf::table_view left{{left_keys}};
+  cudf::table_view right{{right_keys}};
+
+  auto const as_column = [](rmm::device_uvector<cudf::size_type> const& indices) {
+    return cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                             static_cast<cudf::size_type>(indices.size()),
+                             indices.data()};
+  };
+  auto constexpr None = std::numeric_limits<cudf::size_type>::min();
+
+  // The output is ordered by left row, then by right row
+  auto const inner = cudf::sort_merge_inner_join(left, right);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(as_column(*inner.first),
+                                 column_wrapper<int32_t>{0, 2, 2, 3, 3, 4});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(as_column(*inner.second),
+                                 column_wrapper<int32_t>{0, 1, 2, 1, 2, 3});
+
+  auto const left_result =
+    cudf::sort_merge_left_join(left, right, {}, {}, cudf::null_equality::UNEQUAL);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(as_column(*left_result.first),
+                                 column_wrapper<int32_t>{0, 1, 2, 2, 3, 3, 4});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(as_column(*left_result.second),
+                                 column_wrapper<int32_t>{None, None, 1, 2, 1, 2, 3});
+
+  // Keys sorted in descending order
+  column_wrapper<int32_t> left_desc{{5, 3, 3}};
+  column_wrapper<int32_t> right_desc{{4, 3, 3, 1}};
+  auto const desc = cudf::sort_merge_inner_join(
+    cudf::table_view{{left_desc}}, cudf::table_view{{right_desc}}, {cudf::order::DESCENDING});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(as_column(*desc.first), column_wrapper<int32_t>{1, 1, 2, 2});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(as_column(*desc.second), column_wrapper<int32_t>{1, 2, 1, 2});
+}
+
+TEST_F(JoinTest, AsofJoin)
+{
+  strcol_wrapper left_by{"a", "a", "b", "a"};
+  strcol_wrapper right_by{"a", "b", "a", "a"};
+  column_wrapper<int32_t> left_on{{3, 9, 5, 4}, {1, 1, 1, 0}};
+  column_wrapper<int32_t> right_on{1, 2, 8, 4};
+  cudf::table_view left{{left_by}};
+  cudf::table_view right{{right_by}};
+
+  auto const as_column = [](rmm::device_uvector<cudf::size_type> const& indices) {
+    return cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                             static_cast<cudf::size_type>(indices.size()),
+                             indices.data()};
+  };
+  auto constexpr None = std::numeric_limits<cudf::size_type>::min();
+
+  auto const backward = cudf::asof_join(left, right, left_on, right_on);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(as_column(*backward), column_wrapper<int32_t>{0, 2, 1, None});
+
+  auto const forward =
+    cudf::asof_join(left, right, left_on, right_on, cudf::asof_direction::FORWARD);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(as_column(*forward),
+                                 column_wrapper<int32_t>{3, None, None, None});
+
+  auto const nearest =
+    cudf::asof_join(left, right, left_on, right_on, cudf::asof_direction::NEAREST, 2.0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(as_column(*nearest), column_wrapper<int32_t>{3, 2, None, None});
+
+  // An exact match is both the backward and the forward match
+  column_wrapper<int32_t> exact_on{4, 8, 2, 8};
+  auto const exact =
+    cudf::asof_join(left, right, exact_on, right_on, cudf::asof_direction::FORWARD);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(as_column(*exact), column_wrapper<int32_t>{3, 2, 1, 2});
+
+  column_wrapper<int64_t> other_on{3, 9, 5, 4};
+  EXPECT_THROW(cudf::asof_join(left, right, other_on, right_on), cudf::logic_error);
+  EXPECT_THROW(cudf::asof_join(left, right, left_on, right_on, cudf::asof_direction::NEAREST, -1.0),
+               cudf::logic_error);
+}
+
 struct JoinDictionaryTest : public cudf::test::BaseFixture {
 };
 
@@ -1535,6 +1967,30 @@ TEST_F(JoinDictionaryTest, FullJoinWithNulls)
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*gold, cudf::table_view(result_decoded));
 }
 
+TEST_F(JoinDictionaryTest, InnerJoinSameKeys)
+{
+  strcol_wrapper col0_w({"s0", "s1", "s2", "s1", "s0"}, {1, 1, 1, 0, 1});
+  strcol_wrapper col1_w({"s2", "s0", "s1", "s2"});
+  auto const col0 = cudf::dictionary::encode(col0_w);
+  auto const gold = cudf::inner_join(
+    cudf::table_view({col0_w}), cudf::table_view({col1_w}), {0}, {0}, cudf::null_equality::EQUAL);
+
+  // the key sets are identical so the dictionaries are joined as they are, on their indices
+  // when those have the same type and on their keys otherwise
+  for (auto const type_id : {cudf::type_id::INT32, cudf::type_id::UINT8}) {
+    auto const col1   = cudf::dictionary::encode(col1_w, cudf::data_type{type_id});
+    auto const result = cudf::inner_join(cudf::table_view({col0->view()}),
+                                         cudf::table_view({col1->view()}),
+                                         {0},
+                                         {0},
+                                         cudf::null_equality::EQUAL);
+    auto const decoded0 = cudf::dictionary::decode(result->get_column(0).view());
+    auto const decoded1 = cudf::dictionary::decode(result->get_column(1).view());
+    auto const sorted   = cudf::sort(cudf::table_view({decoded0->view(), decoded1->view()}));
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*cudf::sort(*gold), *sorted);
+  }
+}
+
 TEST_F(JoinTest, FullJoinWithStructsAndNulls)
 {
   column_wrapper<int32_t> col0_0{{3, 1, 2, 0, 3}};
@@ -22,6 +22,7 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
 
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -107,3 +108,45 @@ TEST_F(JoinTest, SemiJoinWithStructsAndNulls)
   auto sorted_gold     = cudf::gather(gold.view(), *gold_sort_order);
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
 }
+
+TEST_F(JoinTest, SemiJoinReusedWithManyLeftTables)
+{
+  column_wrapper<int32_t> right_col{{1, 2, 2, 5, 0}, {1, 1, 1, 1, 0}};
+  column_wrapper<int32_t> left_col{{0, 1, 2, 3, 5, 0}, {1, 1, 1, 1, 1, 0}};
+  column_wrapper<int32_t> other_left_col{{5, 5, 4}};
+  cudf::table_view right{{right_col}};
+  cudf::table_view left{{left_col}};
+  cudf::table_view other_left{{other_left_col}};
+
+  auto const as_column = [](rmm::device_uvector<cudf::size_type> const& indices) {
+    return cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                             static_cast<cudf::size_type>(indices.size()),
+                             indices.data()};
+  };
+
+  cudf::semi_join const filter(right, cudf::null_equality::EQUAL);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*filter.contains(left), column_wrapper<bool>{0, 1, 1, 0, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(as_column(*filter.left_semi_join(left)),
+                                 column_wrapper<int32_t>{1, 2, 4, 5});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(as_column(*filter.left_anti_join(left)),
+                                 column_wrapper<int32_t>{0, 3});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(as_column(*filter.left_semi_join(other_left)),
+                                 column_wrapper<int32_t>{0, 1});
+
+  // The free functions give the same result
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(as_column(*cudf::left_semi_join(left, right)),
+                                 column_wrapper<int32_t>{1, 2, 4, 5});
+
+  cudf::semi_join const unequal_nulls(right, cudf::null_equality::UNEQUAL);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*unequal_nulls.contains(left),
+                                 column_wrapper<bool>{0, 1, 1, 0, 1, 0});
+
+  column_wrapper<int64_t> wrong_type{1, 2};
+  EXPECT_THROW(filter.contains(cudf::table_view{{wrong_type}}), cudf::logic_error);
+
+  column_wrapper<int32_t> empty_col{};
+  cudf::semi_join const empty(cudf::table_view{{empty_col}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*empty.contains(other_left), column_wrapper<bool>{0, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(as_column(*empty.left_anti_join(other_left)),
+                                 column_wrapper<int32_t>{0, 1, 2});
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+using strcol_wrapper = cudf::test::strings_column_wrapper;
+
+struct UpsertTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(UpsertTest, Basic)
+{
+  column_wrapper<int32_t> target_keys{1, 2, 3, 5};
+  column_wrapper<double> target_vals{10, 20, 30, 50};
+  cudf::table target({target_keys, target_vals});
+
+  column_wrapper<int32_t> update_keys{3, 4, 1};
+  column_wrapper<double> update_vals{33, 44, 11};
+  cudf::table_view updates({update_keys, update_vals});
+
+  auto target_view  = target.mutable_view();
+  auto const result = cudf::upsert(target_view, updates, {0});
+
+  column_wrapper<int32_t> expect_keys{1, 2, 3, 5};
+  column_wrapper<double> expect_vals{11, 20, 33, 50};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(target.view(), cudf::table_view({expect_keys, expect_vals}));
+
+  column_wrapper<int32_t> appended_keys{4};
+  column_wrapper<double> appended_vals{44};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result, cudf::table_view({appended_keys, appended_vals}));
+}
+
+TEST_F(UpsertTest, NullsAndMultipleKeys)
+{
+  strcol_wrapper target_key0{"a", "a", "b", "c", "c"};
+  column_wrapper<int16_t> target_key1{1, 2, 1, 1, 2};
+  column_wrapper<int64_t> target_vals({10, 20, 30, 40, 50}, {1, 0, 1, 1, 1});
+  cudf::table target({target_key0, target_key1, target_vals});
+
+  strcol_wrapper update_key0{"c", "a", "b", "d"};
+  column_wrapper<int16_t> update_key1{2, 2, 2, 1};
+  column_wrapper<int64_t> update_vals({0, 22, 66, 77}, {0, 1, 1, 1});
+  cudf::table_view updates({update_key0, update_key1, update_vals});
+
+  auto target_view  = target.mutable_view();
+  auto const result = cudf::upsert(target_view, updates, {0, 1});
+
+  column_wrapper<int64_t> expect_vals({10, 22, 30, 40, 0}, {1, 1, 1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(target.get_column(2).view(), expect_vals);
+  EXPECT_EQ(target.get_column(2).null_count(), 1);
+
+  strcol_wrapper appended_key0{"b", "d"};
+  column_wrapper<int16_t> appended_key1{2, 1};
+  column_wrapper<int64_t> appended_vals{66, 77};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(
+    *result, cudf::table_view({appended_key0, appended_key1, appended_vals}));
+}
+
+TEST_F(UpsertTest, NoMatches)
+{
+  column_wrapper<int32_t> target_keys{1, 2};
+  column_wrapper<float> target_vals{1, 2};
+  cudf::table target({target_keys, target_vals});
+
+  column_wrapper<int32_t> update_keys{3, 4};
+  column_wrapper<float> update_vals{3, 4};
+  cudf::table_view updates({update_keys, update_vals});
+
+  auto target_view  = target.mutable_view();
+  auto const result = cudf::upsert(target_view, updates, {0});
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(target.view(), cudf::table_view({target_keys, target_vals}));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result, updates);
+}
+
+TEST_F(UpsertTest, InvalidInputs)
+{
+  column_wrapper<int32_t> target_keys{1, 2};
+  strcol_wrapper target_strings{"x", "y"};
+  column_wrapper<int32_t> target_vals{1, 2};
+  cudf::table target({target_keys, target_strings, target_vals});
+  auto target_view = target.mutable_view();
+
+  column_wrapper<int32_t> update_keys{2};
+  strcol_wrapper update_strings{"z"};
+  column_wrapper<int32_t> update_vals({0}, {0});
+  column_wrapper<int32_t> valid_update_vals{3};
+
+  // variable-width columns cannot be updated in place
+  EXPECT_THROW(
+    cudf::upsert(
+      target_view, cudf::table_view({update_keys, update_strings, valid_update_vals}), {0}),
+    cudf::logic_error);
+  // nulls cannot be written to a column without a null mask
+  EXPECT_THROW(
+    cudf::upsert(target_view, cudf::table_view({update_keys, update_strings, update_vals}), {0, 1}),
+    cudf::logic_error);
+  EXPECT_THROW(cudf::upsert(target_view, cudf::table_view({update_keys, update_strings}), {0}),
+               cudf::logic_error);
+  EXPECT_THROW(
+    cudf::upsert(
+      target_view, cudf::table_view({update_keys, update_strings, valid_update_vals}), {3}),
+    cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -17,6 +17,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/labeling/label_bins.hpp>
 #include <cudf/types.hpp>
 #include <cudf_test/base_fixture.hpp>
@@ -435,6 +436,146 @@ TEST(TestStringData, SlicedNonAsciiStringTest)
   }
 }
 
+/*
+ * Test uniform bins, which are labeled arithmetically, and the histogram.
+ */
+
+template <typename T>
+struct UniformBinTestFixture : public BinTestFixture {
+};
+
+TYPED_TEST_CASE(UniformBinTestFixture, NumericTypesNotBool);
+
+TYPED_TEST(UniformBinTestFixture, TestUniformBins)
+{
+  using T = TypeParam;
+
+  // contiguous bins [4i, 4i + 4), with the values 0 to 100 and a value past the last bin
+  constexpr cudf::size_type num_bins = 25;
+  std::vector<T> left_edge_vector(num_bins);
+  std::vector<T> right_edge_vector(num_bins);
+  for (cudf::size_type i = 0; i < num_bins; ++i) {
+    left_edge_vector[i]  = static_cast<T>(4 * i);
+    right_edge_vector[i] = static_cast<T>(4 * i + 4);
+  }
+  std::vector<T> input_vector(102);
+  std::iota(input_vector.begin(), input_vector.end(), T{0});
+  std::vector<cudf::size_type> expected_vector(input_vector.size());
+  std::vector<int64_t> expected_counts(num_bins, 4);
+  for (std::size_t i = 0; i < input_vector.size(); ++i) {
+    expected_vector[i] = i / 4;
+  }
+
+  fwc_wrapper<T> left_edges(left_edge_vector.begin(), left_edge_vector.end());
+  fwc_wrapper<T> right_edges(right_edge_vector.begin(), right_edge_vector.end());
+  fwc_wrapper<T> input(input_vector.begin(), input_vector.end());
+  auto const validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i < 100; });
+  fwc_wrapper<cudf::size_type> expected(expected_vector.begin(), expected_vector.end(), validity);
+
+  auto result =
+    cudf::label_bins(input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::NO);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+
+  auto counts =
+    cudf::histogram(input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::NO);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    fwc_wrapper<int64_t>(expected_counts.begin(), expected_counts.end()), counts->view());
+
+  // with inclusive right edges, bin i holds 4i + 1 to 4i + 4 and 0 is in no bin
+  auto counts_right =
+    cudf::histogram(input, left_edges, cudf::inclusive::NO, right_edges, cudf::inclusive::YES);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    fwc_wrapper<int64_t>(expected_counts.begin(), expected_counts.end()), counts_right->view());
+}
+
+// Bins whose widths are not exactly representable still get the labels of the search.
+TEST(UniformBinTest, TestFractionalWidths)
+{
+  constexpr cudf::size_type num_bins = 1000;
+  std::vector<double> left_edge_vector(num_bins);
+  std::vector<double> right_edge_vector(num_bins);
+  for (cudf::size_type i = 0; i < num_bins; ++i) {
+    left_edge_vector[i]  = i * 0.1;
+    right_edge_vector[i] = (i + 1) * 0.1;
+  }
+  // the edges themselves, and values in the middle of the bins
+  std::vector<double> input_vector(left_edge_vector);
+  std::vector<cudf::size_type> expected_vector(num_bins);
+  std::iota(expected_vector.begin(), expected_vector.end(), 0);
+  for (cudf::size_type i = 0; i < num_bins; ++i) {
+    input_vector.push_back((i + 0.5) * 0.1);
+    expected_vector.push_back(i);
+  }
+
+  fwc_wrapper<double> left_edges(left_edge_vector.begin(), left_edge_vector.end());
+  fwc_wrapper<double> right_edges(right_edge_vector.begin(), right_edge_vector.end());
+  fwc_wrapper<double> input(input_vector.begin(), input_vector.end());
+  fwc_wrapper<cudf::size_type> expected(expected_vector.begin(), expected_vector.end());
+
+  auto result =
+    cudf::label_bins(input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::NO);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+// Too many bins for the edges to fit in shared memory.
+TEST(HistogramTest, TestManyBins)
+{
+  constexpr cudf::size_type num_bins = 10000;
+  std::vector<int64_t> left_edge_vector(num_bins);
+  std::vector<int64_t> right_edge_vector(num_bins);
+  for (cudf::size_type i = 0; i < num_bins; ++i) {
+    left_edge_vector[i]  = 3 * i;
+    right_edge_vector[i] = 3 * i + 1;
+  }
+  // two values in every bin, and one value between every two bins
+  std::vector<int64_t> input_vector(3 * num_bins);
+  std::iota(input_vector.begin(), input_vector.end(), 0);
+  std::vector<cudf::size_type> expected_vector(input_vector.size());
+  std::vector<bool> expected_validity(input_vector.size());
+  for (std::size_t i = 0; i < input_vector.size(); ++i) {
+    expected_vector[i]   = i / 3;
+    expected_validity[i] = i % 3 != 2;
+  }
+  std::vector<int64_t> expected_counts(num_bins, 2);
+
+  fwc_wrapper<int64_t> left_edges(left_edge_vector.begin(), left_edge_vector.end());
+  fwc_wrapper<int64_t> right_edges(right_edge_vector.begin(), right_edge_vector.end());
+  fwc_wrapper<int64_t> input(input_vector.begin(), input_vector.end());
+  fwc_wrapper<cudf::size_type> expected(
+    expected_vector.begin(), expected_vector.end(), expected_validity.begin());
+
+  auto result =
+    cudf::label_bins(input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::YES);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+
+  auto counts =
+    cudf::histogram(input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::YES);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    fwc_wrapper<int64_t>(expected_counts.begin(), expected_counts.end()), counts->view());
+}
+
+TEST(HistogramTest, TestNullsAndStrings)
+{
+  fwc_wrapper<int32_t> left_edges{0, 10, 20};
+  fwc_wrapper<int32_t> right_edges{5, 15, 25};
+  fwc_wrapper<int32_t> input{{1, 2, 12, 7, 21, 22, 23, 30}, {1, 0, 1, 1, 1, 1, 0, 1}};
+  auto counts =
+    cudf::histogram(input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::NO);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fwc_wrapper<int64_t>{1, 1, 2}, counts->view());
+
+  cudf::test::strings_column_wrapper left_strings{"a", "m"};
+  cudf::test::strings_column_wrapper right_strings{"f", "z"};
+  cudf::test::strings_column_wrapper strings{"apple", "grape", "melon", "zucchini", "banana"};
+  auto string_counts = cudf::histogram(
+    strings, left_strings, cudf::inclusive::YES, right_strings, cudf::inclusive::NO);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fwc_wrapper<int64_t>{2, 1}, string_counts->view());
+
+  auto empty_counts = cudf::histogram(
+    fwc_wrapper<int32_t>{}, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::NO);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fwc_wrapper<int64_t>{0, 0, 0}, empty_counts->view());
+}
+
 }  // anonymous namespace
 
 CUDF_TEST_PROGRAM_MAIN()
@@ -16,6 +16,7 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/lists/contains.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
@@ -711,6 +712,105 @@ TYPED_TEST(TypedContainsDecimalsTest, ListContainsVector)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
 }
 
+TYPED_TEST(TypedContainsTest, IndexOfScalar)
+{
+  using T = TypeParam;
+
+  auto entries_valid =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 1; });
+  auto lists_valid =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 4; });
+  auto search_space =
+    lists_column_wrapper<T, int32_t>{{{0, 1, 2, 1},
+                                      {3, 4, 5},
+                                      {1, 1, 1},
+                                      {},
+                                      {0, 1, 2},
+                                      lists_column_wrapper<T, int32_t>{{2, 0, 1}, entries_valid}},
+                                     lists_valid}
+      .release();
+  auto search_key_one = create_scalar_search_key<T>(1);
+
+  auto actual_result = lists::index_of(search_space->view(), *search_key_one);
+  auto expected_first =
+    fixed_width_column_wrapper<size_type>{{1, -1, 0, -1, 0, 2}, {1, 1, 1, 1, 0, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_first, *actual_result);
+
+  actual_result = lists::index_of(
+    search_space->view(), *search_key_one, lists::duplicate_find_option::FIND_LAST);
+  auto expected_last =
+    fixed_width_column_wrapper<size_type>{{3, -1, 2, -1, 0, 2}, {1, 1, 1, 1, 0, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_last, *actual_result);
+
+  // A null search key makes every row null
+  actual_result = lists::index_of(search_space->view(), *create_null_search_key<T>());
+  auto expected_null =
+    fixed_width_column_wrapper<size_type>{{0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_null, *actual_result);
+}
+
+TYPED_TEST(TypedContainsTest, IndexOfVector)
+{
+  using T = TypeParam;
+
+  auto search_space =
+    lists_column_wrapper<T, int32_t>{{0, 1, 2, 1}, {3, 4, 5}, {1, 1, 1}, {}, {0, 1, 2}}.release();
+  auto keys_valid =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 2; });
+  auto search_keys = fixed_width_column_wrapper<T, int32_t>{{1, 5, 1, 0, 2}, keys_valid};
+
+  auto actual_result  = lists::index_of(search_space->view(), search_keys);
+  auto expected_first = fixed_width_column_wrapper<size_type>{{1, 2, 0, -1, 2}, {1, 1, 0, 1, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_first, *actual_result);
+
+  actual_result = lists::index_of(
+    search_space->view(), search_keys, lists::duplicate_find_option::FIND_LAST);
+  auto expected_last = fixed_width_column_wrapper<size_type>{{3, 2, 0, -1, 2}, {1, 1, 0, 1, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_last, *actual_result);
+}
+
+TEST_F(ContainsTest, LongLists)
+{
+  // Lists this long are searched one entry per thread
+  auto const list_size = 100;
+  auto const num_lists = 4;
+
+  auto list_offsets_begin = cudf::detail::make_counting_transform_iterator(
+    0, [list_size](auto i) { return i * list_size; });
+  auto offsets = fixed_width_column_wrapper<size_type>(
+    list_offsets_begin, list_offsets_begin + num_lists + 1);
+
+  // Each list is {0, 1, ..., 49, 0, 1, ..., 49} with the entries equal to 25 being null
+  auto values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 50; });
+  auto values_valid =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 50 != 25; });
+  auto child = fixed_width_column_wrapper<int32_t>(
+    values, values + num_lists * list_size, values_valid);
+  auto const search_space =
+    make_lists_column(num_lists, offsets.release(), child.release(), 0, {});
+  auto const search_keys = fixed_width_column_wrapper<int32_t>{5, 49, 100, 25};
+
+  auto actual_result   = lists::contains(search_space->view(), search_keys);
+  auto expected_result = fixed_width_column_wrapper<bool>{{1, 1, 0, 0}, {1, 1, 0, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result, *actual_result);
+
+  auto actual_index   = lists::index_of(search_space->view(), search_keys);
+  auto expected_first = fixed_width_column_wrapper<size_type>{5, 49, -1, -1};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_first, *actual_index);
+
+  actual_index = lists::index_of(
+    search_space->view(), search_keys, lists::duplicate_find_option::FIND_LAST);
+  auto expected_last = fixed_width_column_wrapper<size_type>{55, 99, -1, -1};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_last, *actual_index);
+
+  // Sliced lists
+  auto const sliced_space = cudf::slice(search_space->view(), {1, 3})[0];
+  auto const sliced_keys  = cudf::slice(search_keys, {1, 3})[0];
+  actual_index            = lists::index_of(sliced_space, sliced_keys);
+  auto expected_sliced    = fixed_width_column_wrapper<size_type>{49, -1};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_sliced, *actual_index);
+}
+
 }  // namespace test
 
 }  // namespace cudf
@@ -252,3 +252,49 @@ TYPED_TEST(DropListDuplicatesTypedTest, WithNullInputTests)
              cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i < 5; })},
     cudf::null_equality::UNEQUAL);
 }
+
+TYPED_TEST(DropListDuplicatesTypedTest, DistinctKeepsInputOrder)
+{
+  auto constexpr null = TypeParam{0};
+
+  auto const input =
+    LIST_COL{{{3, 2, 1, 3, 2, 4, 1}, {5, 5}, {}, {}, {10, 8, 9, 8}, {7, 6, 7}},
+             cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 3; })};
+  auto const expected =
+    LIST_COL{{{3, 2, 1, 4}, {5}, {}, {}, {10, 8, 9}, {7, 6}},
+             cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 3; })};
+  auto results = cudf::lists::distinct(cudf::lists_column_view{input});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected);
+
+  // Sliced input
+  auto const sliced = cudf::slice(input, {1, 5})[0];
+  results           = cudf::lists::distinct(cudf::lists_column_view{sliced});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    results->view(),
+    LIST_COL{{{5}, {}, {}, {10, 8, 9}},
+             cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 2; })});
+
+  // Null entries are kept at their first occurrence
+  auto const with_nulls =
+    LIST_COL{std::initializer_list<TypeParam>{9, 0, 1, 2, 9, 3, 1},
+             cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 2 == 0; })};
+  results = cudf::lists::distinct(cudf::lists_column_view{with_nulls});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    results->view(),
+    LIST_COL(std::initializer_list<TypeParam>{9, null, 1},
+             cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 1; })));
+}
+
+TEST_F(DropListDuplicatesTest, DistinctFloatingPointWithNaNs)
+{
+  auto const input = LIST_COL_FLT{{2, NaN, -0.0, 0.0, neg_NaN, 2, 1}, {NaN, NaN}};
+
+  auto results = cudf::lists::distinct(
+    cudf::lists_column_view{input}, cudf::null_equality::EQUAL, cudf::nan_equality::ALL_EQUAL);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), LIST_COL_FLT{{2, NaN, 0, 1}, {NaN}});
+
+  results = cudf::lists::distinct(
+    cudf::lists_column_view{input}, cudf::null_equality::EQUAL, cudf::nan_equality::UNEQUAL);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(),
+                                      LIST_COL_FLT{{2, NaN, 0, neg_NaN, 1}, {NaN, NaN}});
+}
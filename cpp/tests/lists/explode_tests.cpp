@@ -19,6 +19,7 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/lists/explode.hpp>
 
@@ -537,6 +538,51 @@ TEST_F(ExplodeTest, SlicedList)
   CUDF_TEST_EXPECT_TABLES_EQUAL(pos_ret->view(), pos_expected);
 }
 
+TEST_F(ExplodeTest, GatherMap)
+{
+  //    a
+  //    [5, 10, 15]
+  //    null
+  //    [20, null]
+  //    []
+  //    [30]
+
+  constexpr auto null = 0;
+
+  auto valids = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i % 2 == 0 ? true : false; });
+
+  LCW a({LCW{5, 10, 15}, LCW{}, LCW({20, 25}, valids), LCW{}, LCW{30}},
+        cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 1; }));
+
+  FCW expected_map{0, 0, 0, 2, 2, 4};
+  FCW expected_pos{0, 1, 2, 0, 1, 0};
+  FCW expected_values({5, 10, 15, 20, null, 30}, {1, 1, 1, 1, 0, 1});
+
+  auto ret = cudf::explode_gather_map(a);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(ret->view(), cudf::table_view({expected_map, expected_values}));
+
+  auto pos_ret = cudf::explode_gather_map(a, true);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(pos_ret->view(),
+                                cudf::table_view({expected_map, expected_pos, expected_values}));
+
+  // Gathering the other columns with the map matches explode
+  FCW b({100, 200, 300, 400, 500});
+  cudf::table_view t({a, b});
+  auto exploded = cudf::explode(t, 0);
+  auto gathered = cudf::gather(cudf::table_view({b}), ret->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(exploded->get_column(1), gathered->get_column(0));
+
+  // Sliced input
+  auto sliced = cudf::slice(a, {2, 5})[0];
+  ret         = cudf::explode_gather_map(sliced, true);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(
+    ret->view(),
+    cudf::table_view({FCW{0, 0, 2}, FCW{0, 1, 0}, FCW({20, null, 30}, {1, 0, 1})}));
+
+  EXPECT_THROW(cudf::explode_gather_map(b), cudf::logic_error);
+}
+
 TEST_F(ExplodeOuterTest, Empty)
 {
   LCW a{};
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/lists/reduction.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+using cudf::null_policy;
+using cudf::test::fixed_width_column_wrapper;
+
+namespace {
+auto null_at(cudf::size_type index)
+{
+  return cudf::detail::make_counting_transform_iterator(0, [index](auto i) { return i != index; });
+}
+}  // namespace
+
+struct ListsReduceTest : public cudf::test::BaseFixture {
+};
+
+template <typename T>
+struct ListsReduceNumericsTest : public ListsReduceTest {
+};
+
+using NumericTypesNotBool =
+  cudf::test::Concat<cudf::test::IntegralTypesNotBool, cudf::test::FloatingPointTypes>;
+TYPED_TEST_CASE(ListsReduceNumericsTest, NumericTypesNotBool);
+
+TYPED_TEST(ListsReduceNumericsTest, SumMinMax)
+{
+  using LCW = cudf::test::lists_column_wrapper<TypeParam>;
+
+  // { {1, 2, 3}, {4, null}, {}, null, {7, 5} }
+  auto const input =
+    LCW{{LCW{1, 2, 3}, LCW{{4, 0}, null_at(1)}, LCW{}, LCW{}, LCW{7, 5}}, null_at(3)};
+  auto const int64_type = cudf::data_type{cudf::type_id::INT64};
+
+  auto result = cudf::lists::reduce(
+    cudf::lists_column_view{input}, cudf::make_sum_aggregation(), int64_type, null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    fixed_width_column_wrapper<int64_t>({6, 4, 0, 0, 12}, {1, 1, 0, 0, 1}), *result);
+
+  result = cudf::lists::reduce(
+    cudf::lists_column_view{input}, cudf::make_sum_aggregation(), int64_type, null_policy::INCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    fixed_width_column_wrapper<int64_t>({6, 0, 0, 0, 12}, {1, 0, 0, 0, 1}), *result);
+
+  auto const element_type = cudf::data_type{cudf::type_to_id<TypeParam>()};
+  result                  = cudf::lists::reduce(
+    cudf::lists_column_view{input}, cudf::make_min_aggregation(), element_type);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    fixed_width_column_wrapper<TypeParam>({1, 4, 0, 0, 5}, {1, 1, 0, 0, 1}), *result);
+
+  result = cudf::lists::reduce(
+    cudf::lists_column_view{input}, cudf::make_max_aggregation(), element_type);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    fixed_width_column_wrapper<TypeParam>({3, 4, 0, 0, 7}, {1, 1, 0, 0, 1}), *result);
+
+  // Sliced input
+  auto const sliced = cudf::slice(input, {1, 5})[0];
+  result            = cudf::lists::reduce(
+    cudf::lists_column_view{sliced}, cudf::make_max_aggregation(), element_type);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    fixed_width_column_wrapper<TypeParam>({4, 0, 0, 7}, {1, 0, 0, 1}), *result);
+}
+
+TYPED_TEST(ListsReduceNumericsTest, Mean)
+{
+  using LCW = cudf::test::lists_column_wrapper<TypeParam>;
+
+  // { {1, 2, 3, 6}, {4, null, 5}, {null} }
+  auto const input = LCW{LCW{1, 2, 3, 6},
+                         LCW{{4, 0, 5}, null_at(1)},
+                         LCW{{0}, null_at(0)}};
+
+  auto const result = cudf::lists::reduce(cudf::lists_column_view{input},
+                                          cudf::make_mean_aggregation(),
+                                          cudf::data_type{cudf::type_id::FLOAT64});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<double>({3.0, 4.5, 0.0}, {1, 1, 0}),
+                                 *result);
+
+  // The mean requires a floating-point output type
+  EXPECT_THROW(cudf::lists::reduce(cudf::lists_column_view{input},
+                                   cudf::make_mean_aggregation(),
+                                   cudf::data_type{cudf::type_id::INT64}),
+               cudf::logic_error);
+}
+
+TEST_F(ListsReduceTest, AnyAll)
+{
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+
+  auto const input      = LCW{{1, 0, 2}, {3, 4}, {0, 0}, {}};
+  auto const bool8_type = cudf::data_type{cudf::type_id::BOOL8};
+
+  auto result = cudf::lists::reduce(
+    cudf::lists_column_view{input}, cudf::make_any_aggregation(), bool8_type);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    fixed_width_column_wrapper<bool>({true, true, false, false}, {1, 1, 1, 0}), *result);
+
+  result = cudf::lists::reduce(
+    cudf::lists_column_view{input}, cudf::make_all_aggregation(), bool8_type);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    fixed_width_column_wrapper<bool>({false, true, false, false}, {1, 1, 1, 0}), *result);
+}
+
+TEST_F(ListsReduceTest, EmptyInput)
+{
+  auto const input  = cudf::test::lists_column_wrapper<int32_t>{};
+  auto const result = cudf::lists::reduce(cudf::lists_column_view{input},
+                                          cudf::make_sum_aggregation(),
+                                          cudf::data_type{cudf::type_id::INT64});
+  EXPECT_EQ(result->size(), 0);
+  EXPECT_EQ(result->type().id(), cudf::type_id::INT64);
+}
@@ -15,6 +15,8 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/merge.hpp>
 #include <cudf/sorting.hpp>
@@ -30,6 +32,7 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <string>
 #include <vector>
 
 template <typename T>
@@ -727,6 +730,46 @@ TEST_F(MergeTest, KeysWithNulls)
     }
 }
 
+TEST_F(MergeTest, ManyTablesWithNulls)
+{
+  constexpr int num_tables = 5;
+  cudf::size_type nrows    = 3000;
+  std::vector<cudf::order> column_order{cudf::order::ASCENDING};
+  std::vector<cudf::null_order> null_precedence{cudf::null_order::AFTER};
+
+  // equivalent keys across the tables, with a payload identifying each input row
+  std::vector<std::unique_ptr<cudf::table>> sorted_tables;
+  std::vector<cudf::table_view> inputs;
+  for (int t = 0; t < num_tables; ++t) {
+    auto keys_iter = cudf::detail::make_counting_transform_iterator(
+      0, [t](auto row) { return (row * (t + 3)) % 500; });
+    auto valids    = cudf::detail::make_counting_transform_iterator(
+      0, [t](auto row) { return row % (t + 7) != 0; });
+    auto ids_iter  = cudf::detail::make_counting_transform_iterator(
+      0, [t, nrows](auto row) { return t * nrows + row; });
+    std::vector<std::string> names(nrows);
+    for (cudf::size_type row = 0; row < nrows; ++row) {
+      names[row] = std::to_string(t) + "_" + std::to_string(row);
+    }
+    cudf::test::fixed_width_column_wrapper<int32_t> keys(keys_iter, keys_iter + nrows, valids);
+    cudf::test::fixed_width_column_wrapper<int32_t> ids(ids_iter, ids_iter + nrows);
+    cudf::test::strings_column_wrapper strings(names.begin(), names.end());
+    cudf::table_view const input{{keys, ids, strings}};
+    auto const order = cudf::stable_sorted_order(input.select({0}), column_order, null_precedence);
+    sorted_tables.push_back(cudf::gather(input, *order));
+    inputs.push_back(sorted_tables.back()->view());
+  }
+
+  auto const result = cudf::merge(inputs, {0}, column_order, null_precedence);
+
+  // equivalent rows keep the order of their tables
+  auto const all_rows = cudf::concatenate(inputs);
+  auto const order    =
+    cudf::stable_sorted_order(all_rows->view().select({0}), column_order, null_precedence);
+  auto const expected = cudf::gather(all_rows->view(), *order);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+}
+
 template <typename T>
 struct FixedPointTestBothReps : public cudf::test::BaseFixture {
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -13,6 +13,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/hashing.hpp>
 #include <cudf/partitioning.hpp>
 #include <cudf/sorting.hpp>
@@ -353,6 +355,37 @@ TYPED_TEST(HashPartitionFixedWidth, HasNulls)
   run_fixed_width_test<TypeParam>(10, 1000, 10, cudf::hash_id::HASH_IDENTITY, true);
 }
 
+TYPED_TEST(HashPartitionFixedWidth, LargeFanout)
+{
+  run_fixed_width_test<TypeParam>(2, 20000, 4096, cudf::hash_id::HASH_MURMUR3);
+  run_fixed_width_test<TypeParam>(2, 20000, 3000, cudf::hash_id::HASH_MURMUR3, true);
+}
+
+TEST_F(HashPartition, LargeFanoutKeepsRowOrder)
+{
+  auto const size = 20000;
+  auto keys = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 997; });
+  auto rows = thrust::make_counting_iterator(0);
+  fixed_width_column_wrapper<int32_t> keys_col(keys, keys + size);
+  fixed_width_column_wrapper<int32_t> rows_col(rows, rows + size);
+  auto input = cudf::table_view({keys_col, rows_col});
+
+  for (cudf::size_type num_partitions : {2048, 1500}) {
+    std::unique_ptr<cudf::table> output;
+    std::vector<cudf::size_type> offsets;
+    std::tie(output, offsets) = cudf::hash_partition(input, {0}, num_partitions);
+    ASSERT_EQ(static_cast<std::size_t>(num_partitions), offsets.size());
+
+    // Expect the rows of each partition to be in the order of the input
+    offsets.push_back(size);
+    auto const output_rows = cudf::test::to_host<int32_t>(output->get_column(1)).first;
+    for (cudf::size_type p = 0; p < num_partitions; ++p) {
+      EXPECT_TRUE(std::is_sorted(output_rows.begin() + offsets[p],
+                                 output_rows.begin() + offsets[p + 1]));
+    }
+  }
+}
+
 TEST_F(HashPartition, FixedPointColumnsToHash)
 {
   fixed_width_column_wrapper<int32_t> to_hash({1});
@@ -376,4 +409,114 @@ TEST_F(HashPartition, FixedPointColumnsToHash)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(first_result->get_column(1).view(), first_input.column(1));
 }
 
+// Compares each packed partition with the matching partition of `hash_partition`, ignoring the
+// order of the rows within the partitions
+void expect_packed_partitions_equal(cudf::table_view const& input,
+                                    std::vector<cudf::size_type> const& columns_to_hash,
+                                    cudf::size_type num_partitions)
+{
+  auto const packed   = cudf::hash_partition_and_pack(input, columns_to_hash, num_partitions);
+  auto const expected = cudf::hash_partition(input, columns_to_hash, num_partitions);
+
+  ASSERT_EQ(static_cast<std::size_t>(num_partitions), packed.size());
+  auto const& offsets = expected.second;
+  auto const splits   = std::vector<cudf::size_type>(offsets.begin() + 1, offsets.end());
+  auto const expected_partitions = cudf::split(expected.first->view(), splits);
+  for (cudf::size_type p = 0; p < num_partitions; ++p) {
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(cudf::sort(expected_partitions[p])->view(),
+                                       cudf::sort(packed[p].table)->view());
+    auto const unpacked = cudf::unpack(packed[p].data);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(packed[p].table, unpacked);
+  }
+}
+
+TEST_F(HashPartition, PackFixedWidth)
+{
+  using cudf::detail::make_counting_transform_iterator;
+  auto const size = 1000;
+  auto keys       = make_counting_transform_iterator(0, [](auto i) { return i % 37; });
+  auto values     = make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto valids     = make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  fixed_width_column_wrapper<int32_t> col0(keys, keys + size);
+  fixed_width_column_wrapper<int8_t> col1(values, values + size, valids);
+  fixed_width_column_wrapper<double> col2(values, values + size);
+  fixed_width_column_wrapper<int16_t> col3(keys, keys + size, valids);
+  auto input = cudf::table_view({col0, col1, col2, col3});
+
+  expect_packed_partitions_equal(input, {0}, 8);
+  expect_packed_partitions_equal(input, {0, 3}, 13);
+}
+
+TEST_F(HashPartition, PackMixedColumnTypes)
+{
+  fixed_width_column_wrapper<float> floats({1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
+  fixed_width_column_wrapper<int16_t> integers({1, 2, 3, 4, 5, 6, 7, 8});
+  strings_column_wrapper strings({"a", "bb", "ccc", "d", "ee", "fff", "gg", "h"});
+  auto input = cudf::table_view({floats, integers, strings});
+
+  expect_packed_partitions_equal(input, {0, 2}, 3);
+}
+
+TEST_F(HashPartition, PackZeroRows)
+{
+  fixed_width_column_wrapper<int32_t> integers({});
+  auto input = cudf::table_view({integers});
+
+  auto const packed = cudf::hash_partition_and_pack(input, {0}, 3);
+
+  EXPECT_EQ(std::size_t{3}, packed.size());
+  for (auto const& partition : packed) {
+    EXPECT_EQ(0, partition.table.num_rows());
+    EXPECT_EQ(input.num_columns(), partition.table.num_columns());
+  }
+}
+
+TEST_F(HashPartition, PrecomputedHashes)
+{
+  fixed_width_column_wrapper<float> floats({1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
+  fixed_width_column_wrapper<int16_t> integers({1, 2, 3, 4, 5, 6, 7, 8});
+  strings_column_wrapper strings({"a", "bb", "ccc", "d", "ee", "fff", "gg", "h"});
+  auto input = cudf::table_view({floats, integers, strings});
+
+  auto columns_to_hash = std::vector<cudf::size_type>({1, 2});
+  auto const hashes    = cudf::hash(input.select(columns_to_hash));
+
+  cudf::size_type const num_partitions = 3;
+  auto const expected = cudf::hash_partition(input, columns_to_hash, num_partitions);
+  auto const result   = cudf::hash_partition_by_hashes(input, hashes->view(), num_partitions);
+
+  // Each row is assigned to the same partition as when hashing the columns
+  EXPECT_EQ(expected.second, result.second);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected.first->view(), result.first->view());
+}
+
+TEST_F(HashPartition, PrecomputedHashesLargeFanout)
+{
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  fixed_width_column_wrapper<int32_t> keys(sequence, sequence + 10000);
+  auto input = cudf::table_view({keys});
+
+  auto const hashes = cudf::hash(input);
+
+  cudf::size_type const num_partitions = 2000;
+  auto const expected = cudf::hash_partition(input, {0}, num_partitions);
+  auto const result   = cudf::hash_partition_by_hashes(input, hashes->view(), num_partitions);
+
+  EXPECT_EQ(expected.second, result.second);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected.first->view(), result.first->view());
+}
+
+TEST_F(HashPartition, PrecomputedHashesInvalid)
+{
+  fixed_width_column_wrapper<int32_t> integers({1, 2, 3, 4});
+  auto input = cudf::table_view({integers});
+
+  fixed_width_column_wrapper<int64_t> wide_hashes({1, 2, 3, 4});
+  fixed_width_column_wrapper<uint32_t> short_hashes({1, 2, 3});
+  fixed_width_column_wrapper<uint32_t> null_hashes({1, 2, 3, 4}, {1, 0, 1, 1});
+  EXPECT_THROW(cudf::hash_partition_by_hashes(input, wide_hashes, 3), cudf::logic_error);
+  EXPECT_THROW(cudf::hash_partition_by_hashes(input, short_hashes, 3), cudf::logic_error);
+  EXPECT_THROW(cudf::hash_partition_by_hashes(input, null_hashes, 3), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/detail/iterator.cuh>
+#include <cudf/partitioning.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <algorithm>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+class RangePartition : public cudf::test::BaseFixture {
+};
+
+namespace {
+
+// Checks that the keys of each partition lie between the splitters of the partition
+void expect_ranges(std::vector<int32_t> const& keys,
+                   std::vector<cudf::size_type> offsets,
+                   std::vector<int32_t> const& splitters,
+                   bool ascending)
+{
+  offsets.push_back(keys.size());
+  for (std::size_t p = 0; p + 1 < offsets.size(); ++p) {
+    for (auto row = offsets[p]; row < offsets[p + 1]; ++row) {
+      auto const key = ascending ? keys[row] : -keys[row];
+      if (p > 0) { EXPECT_GE(key, ascending ? splitters[p - 1] : -splitters[p - 1]); }
+      if (p < splitters.size()) { EXPECT_LT(key, ascending ? splitters[p] : -splitters[p]); }
+    }
+  }
+}
+
+}  // namespace
+
+TEST_F(RangePartition, Ascending)
+{
+  auto const size = 1000;
+  auto keys = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 7 % 100; });
+  auto rows = thrust::make_counting_iterator(0);
+  fixed_width_column_wrapper<int32_t> keys_col(keys, keys + size);
+  fixed_width_column_wrapper<int32_t> rows_col(rows, rows + size);
+  auto input = cudf::table_view({rows_col, keys_col});
+
+  std::unique_ptr<cudf::table> output, splitters;
+  std::vector<cudf::size_type> offsets;
+  std::tie(output, offsets, splitters) =
+    cudf::range_partition(input, {1}, {cudf::order::ASCENDING}, 4, 100);
+
+  EXPECT_EQ(std::size_t{4}, offsets.size());
+  EXPECT_EQ(0, offsets[0]);
+  EXPECT_EQ(3, splitters->num_rows());
+  EXPECT_EQ(1, splitters->num_columns());
+  CUDF_TEST_EXPECT_TABLE_PROPERTIES_EQUAL(input, output->view());
+
+  expect_ranges(cudf::test::to_host<int32_t>(output->get_column(1)).first,
+                offsets,
+                cudf::test::to_host<int32_t>(splitters->get_column(0)).first,
+                true);
+
+  // Expect the same rows as the input
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::sort(input)->view(), cudf::sort(output->view())->view());
+}
+
+TEST_F(RangePartition, Descending)
+{
+  fixed_width_column_wrapper<int32_t> keys_col({5, 1, 9, 3, 7, 2, 8, 4, 6, 0});
+  strings_column_wrapper values({"5", "1", "9", "3", "7", "2", "8", "4", "6", "0"});
+  auto input = cudf::table_view({keys_col, values});
+
+  std::unique_ptr<cudf::table> output, splitters;
+  std::vector<cudf::size_type> offsets;
+  std::tie(output, offsets, splitters) =
+    cudf::range_partition(input, {0}, {cudf::order::DESCENDING}, 3, 1000);
+
+  // The whole input is the sample, so the splitters are the keys of rank 3 and 6
+  fixed_width_column_wrapper<int32_t> expected_splitters({6, 3});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_splitters, splitters->get_column(0));
+  EXPECT_EQ((std::vector<cudf::size_type>{0, 3, 6}), offsets);
+
+  expect_ranges(cudf::test::to_host<int32_t>(output->get_column(0)).first,
+                offsets,
+                cudf::test::to_host<int32_t>(splitters->get_column(0)).first,
+                false);
+}
+
+TEST_F(RangePartition, EmptyInput)
+{
+  fixed_width_column_wrapper<int32_t> keys_col({});
+  auto input = cudf::table_view({keys_col});
+
+  std::unique_ptr<cudf::table> output, splitters;
+  std::vector<cudf::size_type> offsets;
+  std::tie(output, offsets, splitters) =
+    cudf::range_partition(input, {0}, {cudf::order::ASCENDING}, 3, 10);
+
+  EXPECT_EQ(0, output->num_rows());
+  EXPECT_TRUE(offsets.empty());
+  EXPECT_EQ(0, splitters->num_rows());
+}
+
+TEST_F(RangePartition, InvalidArguments)
+{
+  fixed_width_column_wrapper<int32_t> keys_col({1, 2, 3});
+  auto input = cudf::table_view({keys_col});
+
+  EXPECT_THROW(cudf::range_partition(input, {0}, {cudf::order::ASCENDING}, 0, 10),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::range_partition(input, {0}, {cudf::order::ASCENDING}, 2, 0),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::range_partition(input, {0}, {}, 2, 10), cudf::logic_error);
+}
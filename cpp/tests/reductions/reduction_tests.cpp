@@ -30,6 +30,8 @@
 #include <thrust/device_vector.h>
 #include <thrust/iterator/counting_iterator.h>
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <vector>
 
@@ -989,6 +991,58 @@ TYPED_TEST(ReductionTest, Quantile)
                        cudf::make_quantile_aggregation({1}, interp));
 }
 
+struct QuantileSelectionTest : public cudf::test::BaseFixture {
+  /// Checks quantile reductions of `values` against the quantiles of the sorted valid values
+  template <typename T>
+  void check_quantiles(std::vector<T> const& values, std::vector<bool> const& validity)
+  {
+    cudf::test::fixed_width_column_wrapper<T> col(
+      values.begin(), values.end(), validity.begin());
+    std::vector<double> sorted;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      if (validity[i]) { sorted.push_back(static_cast<double>(values[i])); }
+    }
+    std::sort(sorted.begin(), sorted.end());
+
+    auto const output_dtype = cudf::data_type{cudf::type_id::FLOAT64};
+    for (double q : {0.0, 0.25, 0.5, 0.99, 1.0}) {
+      double const position = q * (sorted.size() - 1);
+      auto const lower      = static_cast<std::size_t>(std::floor(position));
+      auto const higher     = static_cast<std::size_t>(std::ceil(position));
+      auto const fraction   = position - lower;
+      double const linear   = (1.0 - fraction) * sorted[lower] + fraction * sorted[higher];
+
+      auto result = cudf::reduce(
+        col, cudf::make_quantile_aggregation({q}, cudf::interpolation::LINEAR), output_dtype);
+      EXPECT_EQ(linear, static_cast<cudf::numeric_scalar<double> *>(result.get())->value());
+      result = cudf::reduce(
+        col, cudf::make_quantile_aggregation({q}, cudf::interpolation::NEAREST), output_dtype);
+      EXPECT_EQ(sorted[static_cast<std::size_t>(std::nearbyint(position))],
+                static_cast<cudf::numeric_scalar<double> *>(result.get())->value());
+    }
+  }
+};
+
+TEST_F(QuantileSelectionTest, LargeColumnsWithNulls)
+{
+  // many duplicates, and values that differ only in their low bytes
+  constexpr int num_rows = 10001;
+  std::vector<int64_t> int_values(num_rows);
+  std::vector<double> double_values(num_rows);
+  std::vector<float> float_values(num_rows);
+  std::vector<bool> validity(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    auto const value = static_cast<int64_t>((i * 7919) % 2003) - 1000;
+    int_values[i]    = value * (int64_t{1} << 40) + (i % 3);
+    double_values[i] = value * 0.125;
+    float_values[i]  = static_cast<float>(-value) / 3;
+    validity[i]      = i % 7 != 0;
+  }
+  check_quantiles(int_values, validity);
+  check_quantiles(double_values, validity);
+  check_quantiles(float_values, validity);
+}
+
 TYPED_TEST(ReductionTest, UniqueCount)
 {
   using T = TypeParam;
@@ -1023,6 +1077,37 @@ TYPED_TEST(ReductionTest, UniqueCount)
                        cudf::make_nunique_aggregation(cudf::null_policy::EXCLUDE));
 }
 
+TYPED_TEST(ReductionTest, ApproxUniqueCount)
+{
+  using T = TypeParam;
+  std::vector<int> int_values({1, -3, 1, 2, 0, 2, -4, 45});  // 6 unique values
+  std::vector<bool> host_bools({1, 1, 1, 0, 1, 1, 1, 0});
+  std::vector<T> v       = convert_values<T>(int_values);
+  auto const output_type = cudf::data_type{cudf::type_id::INT64};
+
+  // test without nulls
+  cudf::test::fixed_width_column_wrapper<T> col(v.begin(), v.end());
+  int64_t expected_value = std::is_same<T, bool>::value ? 2 : 6;
+  this->reduction_test(
+    col, expected_value, true, cudf::make_approx_count_distinct_aggregation(), output_type);
+
+  // test with nulls, which are not counted
+  cudf::test::fixed_width_column_wrapper<T> col_nulls = construct_null_column(v, host_bools);
+  int64_t expected_null_value                         = std::is_same<T, bool>::value ? 2 : 5;
+  this->reduction_test(col_nulls,
+                       expected_null_value,
+                       true,
+                       cudf::make_approx_count_distinct_aggregation(),
+                       output_type);
+
+  // the result type must be INT64
+  this->reduction_test(col,
+                       expected_value,
+                       false,
+                       cudf::make_approx_count_distinct_aggregation(),
+                       cudf::data_type{cudf::type_id::INT32});
+}
+
 template <typename T>
 struct FixedPointTestBothReps : public cudf::test::BaseFixture {
 };
@@ -1851,4 +1936,182 @@ TYPED_TEST(DictionaryReductionTest, Quantile)
                        output_type);
 }
 
+struct TableReductionTest : public cudf::test::BaseFixture {
+};
+
+template <typename T>
+T scalar_value(std::unique_ptr<cudf::scalar> const& s)
+{
+  EXPECT_EQ(cudf::type_to_id<T>(), s->type().id());
+  EXPECT_TRUE(s->is_valid());
+  return static_cast<cudf::numeric_scalar<T>*>(s.get())->value();
+}
+
+TEST_F(TableReductionTest, NumericColumns)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> integers({1, 2, 0, 4, 5}, {1, 1, 0, 1, 1});
+  cudf::test::fixed_width_column_wrapper<double> doubles({0.5, 1.5, 2.5, 3.5, 4.5});
+  auto const input = cudf::table_view({integers, doubles});
+
+  std::vector<std::unique_ptr<aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation());
+  aggs.push_back(cudf::make_min_aggregation());
+  aggs.push_back(cudf::make_max_aggregation());
+  aggs.push_back(cudf::make_mean_aggregation());
+  aggs.push_back(cudf::make_variance_aggregation());
+  aggs.push_back(cudf::make_count_aggregation(cudf::null_policy::EXCLUDE));
+  aggs.push_back(cudf::make_count_aggregation(cudf::null_policy::INCLUDE));
+  aggs.push_back(cudf::make_any_aggregation());
+  // Not computed in the single pass over each column
+  aggs.push_back(cudf::make_nunique_aggregation());
+
+  auto const results = cudf::reduce(input, aggs);
+  ASSERT_EQ(std::size_t{2}, results.size());
+  ASSERT_EQ(aggs.size(), results[0].size());
+  ASSERT_EQ(aggs.size(), results[1].size());
+
+  EXPECT_EQ(12, scalar_value<int64_t>(results[0][0]));
+  EXPECT_EQ(1, scalar_value<int32_t>(results[0][1]));
+  EXPECT_EQ(5, scalar_value<int32_t>(results[0][2]));
+  EXPECT_DOUBLE_EQ(3.0, scalar_value<double>(results[0][3]));
+  EXPECT_NEAR(10.0 / 3.0, scalar_value<double>(results[0][4]), 1e-12);
+  EXPECT_EQ(4, scalar_value<cudf::size_type>(results[0][5]));
+  EXPECT_EQ(5, scalar_value<cudf::size_type>(results[0][6]));
+  EXPECT_TRUE(scalar_value<bool>(results[0][7]));
+  EXPECT_EQ(4, scalar_value<cudf::size_type>(results[0][8]));
+
+  EXPECT_DOUBLE_EQ(12.5, scalar_value<double>(results[1][0]));
+  EXPECT_DOUBLE_EQ(0.5, scalar_value<double>(results[1][1]));
+  EXPECT_DOUBLE_EQ(4.5, scalar_value<double>(results[1][2]));
+  EXPECT_DOUBLE_EQ(2.5, scalar_value<double>(results[1][3]));
+  EXPECT_NEAR(2.5, scalar_value<double>(results[1][4]), 1e-12);
+  EXPECT_EQ(5, scalar_value<cudf::size_type>(results[1][5]));
+  EXPECT_EQ(5, scalar_value<cudf::size_type>(results[1][6]));
+  EXPECT_TRUE(scalar_value<bool>(results[1][7]));
+  EXPECT_EQ(5, scalar_value<cudf::size_type>(results[1][8]));
+}
+
+TEST_F(TableReductionTest, MatchesColumnReductions)
+{
+  cudf::test::fixed_width_column_wrapper<int16_t> shorts({-3, 7, 2, 0, 9, 4}, {1, 1, 0, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<float> floats({2.f, -1.f, 0.5f, 8.f, 3.f, 1.f});
+  cudf::test::strings_column_wrapper strings({"b", "a", "d", "c", "f", "e"});
+  auto const input = cudf::table_view({shorts, floats, strings});
+
+  std::vector<std::unique_ptr<aggregation>> aggs;
+  aggs.push_back(cudf::make_min_aggregation());
+  aggs.push_back(cudf::make_max_aggregation());
+
+  auto const results = cudf::reduce(input, aggs);
+  for (cudf::size_type i = 0; i < input.num_columns(); ++i) {
+    auto const col = input.column(i);
+    for (std::size_t j = 0; j < aggs.size(); ++j) {
+      auto const expected = cudf::reduce(col, aggs[j], col.type());
+      auto const result   = results[i][j].get();
+      ASSERT_NE(nullptr, result);
+      EXPECT_EQ(expected->is_valid(), result->is_valid());
+      EXPECT_EQ(expected->type(), result->type());
+    }
+  }
+  EXPECT_EQ(-3, scalar_value<int16_t>(results[0][0]));
+  EXPECT_EQ(9, scalar_value<int16_t>(results[0][1]));
+  EXPECT_EQ(-1.f, scalar_value<float>(results[1][0]));
+  EXPECT_EQ(8.f, scalar_value<float>(results[1][1]));
+  EXPECT_EQ("a", static_cast<cudf::string_scalar*>(results[2][0].get())->to_string());
+  EXPECT_EQ("f", static_cast<cudf::string_scalar*>(results[2][1].get())->to_string());
+}
+
+TEST_F(TableReductionTest, AllNullColumn)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> nulls({1, 2, 3}, {0, 0, 0});
+  auto const input = cudf::table_view({nulls});
+
+  std::vector<std::unique_ptr<aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation());
+  aggs.push_back(cudf::make_count_aggregation(cudf::null_policy::EXCLUDE));
+
+  auto const results = cudf::reduce(input, aggs);
+  EXPECT_FALSE(results[0][0]->is_valid());
+  EXPECT_EQ(0, scalar_value<cudf::size_type>(results[0][1]));
+}
+
+struct ReduceIntoTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ReduceIntoTest, SimpleReductions)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({6, -2, 0, 9, 4}, {1, 1, 0, 1, 1});
+
+  cudf::numeric_scalar<int64_t> sum(0, false);
+  cudf::reduce_into(col, cudf::make_sum_aggregation(), sum);
+  EXPECT_TRUE(sum.is_valid());
+  EXPECT_EQ(17, sum.value());
+
+  cudf::numeric_scalar<int32_t> min(0, false);
+  cudf::reduce_into(col, cudf::make_min_aggregation(), min);
+  EXPECT_TRUE(min.is_valid());
+  EXPECT_EQ(-2, min.value());
+
+  cudf::numeric_scalar<bool> all(false, false);
+  cudf::reduce_into(col, cudf::make_all_aggregation(), all);
+  EXPECT_TRUE(all.is_valid());
+  EXPECT_TRUE(all.value());
+
+  // The same scalar can be reduced into again
+  cudf::test::fixed_width_column_wrapper<int32_t> other({1, 2, 3});
+  cudf::reduce_into(other, cudf::make_sum_aggregation(), sum);
+  EXPECT_TRUE(sum.is_valid());
+  EXPECT_EQ(6, sum.value());
+}
+
+TEST_F(ReduceIntoTest, NullResult)
+{
+  cudf::test::fixed_width_column_wrapper<double> nulls({1.0, 2.0}, {0, 0});
+  cudf::test::fixed_width_column_wrapper<double> empty({});
+
+  cudf::numeric_scalar<double> max(1.0, true);
+  cudf::reduce_into(nulls, cudf::make_max_aggregation(), max);
+  EXPECT_FALSE(max.is_valid());
+
+  cudf::numeric_scalar<double> sum(1.0, true);
+  cudf::reduce_into(empty, cudf::make_sum_aggregation(), sum);
+  EXPECT_FALSE(sum.is_valid());
+}
+
+TEST_F(ReduceIntoTest, InvalidArguments)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({1, 2, 3});
+
+  cudf::numeric_scalar<int64_t> wide(0);
+  EXPECT_THROW(cudf::reduce_into(col, cudf::make_max_aggregation(), wide), cudf::logic_error);
+  EXPECT_THROW(cudf::reduce_into(col, cudf::make_any_aggregation(), wide), cudf::logic_error);
+  EXPECT_THROW(cudf::reduce_into(col, cudf::make_mean_aggregation(), wide), cudf::logic_error);
+
+  cudf::test::strings_column_wrapper strings({"a", "b"});
+  cudf::string_scalar string_output("");
+  EXPECT_THROW(cudf::reduce_into(strings, cudf::make_min_aggregation(), string_output),
+               cudf::logic_error);
+}
+
+TEST_F(ReduceIntoTest, MinMax)
+{
+  cudf::test::fixed_width_column_wrapper<int16_t> col({5, -7, 3, 0, 12}, {1, 1, 1, 0, 1});
+
+  cudf::numeric_scalar<int16_t> minimum(0, false);
+  cudf::numeric_scalar<int16_t> maximum(0, false);
+  cudf::minmax_into(col, minimum, maximum);
+  EXPECT_TRUE(minimum.is_valid());
+  EXPECT_TRUE(maximum.is_valid());
+  EXPECT_EQ(-7, minimum.value());
+  EXPECT_EQ(12, maximum.value());
+
+  cudf::test::fixed_width_column_wrapper<int16_t> nulls({5, 6}, {0, 0});
+  cudf::minmax_into(nulls, minimum, maximum);
+  EXPECT_FALSE(minimum.is_valid());
+  EXPECT_FALSE(maximum.is_valid());
+
+  cudf::numeric_scalar<int32_t> wrong_type(0);
+  EXPECT_THROW(cudf::minmax_into(col, minimum, wrong_type), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -419,16 +419,49 @@ TEST_F(ScanStringTest, skip_nulls)
   CUDF_TEST_EXPECT_COLUMN_PROPERTIES_EQUAL(expected2, col_out->view());
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected2, col_out->view());
 
-  // Exclusive scan string not supported.
-  CUDF_EXPECT_THROW_MESSAGE(
-    (cudf::scan(
-      col_nulls, cudf::make_min_aggregation(), scan_type::EXCLUSIVE, null_policy::EXCLUDE)),
-    "String types supports only inclusive min/max for `cudf::scan`");
+  // Exclusive scans null the rows that are not preceded by any valid element
+  cudf::test::strings_column_wrapper expected_exclude(
+    {"", "one", "one", "", "", "", "one", "one", "one"}, {0, 1, 1, 0, 0, 0, 1, 1, 1});
+  CUDF_EXPECT_NO_THROW(
+    col_out = cudf::scan(
+      col_nulls, cudf::make_min_aggregation(), scan_type::EXCLUSIVE, null_policy::EXCLUDE));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_exclude, col_out->view());
 
-  CUDF_EXPECT_THROW_MESSAGE(
-    (cudf::scan(
-      col_nulls, cudf::make_min_aggregation(), scan_type::EXCLUSIVE, null_policy::INCLUDE)),
-    "String types supports only inclusive min/max for `cudf::scan`");
+  cudf::test::strings_column_wrapper expected_include(
+    {"", "one", "one", "one", "", "", "", "", ""}, {0, 1, 1, 1, 0, 0, 0, 0, 0});
+  CUDF_EXPECT_NO_THROW(
+    col_out = cudf::scan(
+      col_nulls, cudf::make_min_aggregation(), scan_type::EXCLUSIVE, null_policy::INCLUDE));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_include, col_out->view());
+
+  cudf::test::strings_column_wrapper expected_max(
+    {"", "one", "two", "", "", "", "two", "two", "two"}, {0, 1, 1, 0, 0, 0, 1, 1, 1});
+  CUDF_EXPECT_NO_THROW(
+    col_out = cudf::scan(
+      col_nulls, cudf::make_max_aggregation(), scan_type::EXCLUSIVE, null_policy::EXCLUDE));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_max, col_out->view());
+}
+
+TEST_F(ScanStringTest, LeadingEmptyStrings)
+{
+  // The running max of leading empty strings is the empty string itself, which must stay valid
+  cudf::test::strings_column_wrapper input({"", "", "b", "", "a"});
+
+  auto col_out =
+    cudf::scan(input, cudf::make_max_aggregation(), scan_type::INCLUSIVE, null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::test::strings_column_wrapper({"", "", "b", "b", "b"}),
+                                 col_out->view());
+
+  col_out =
+    cudf::scan(input, cudf::make_max_aggregation(), scan_type::EXCLUSIVE, null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::strings_column_wrapper({"", "", "", "b", "b"}, {0, 1, 1, 1, 1}), col_out->view());
+
+  cudf::test::strings_column_wrapper input_nulls({"", "", "b", "", "a"}, {1, 1, 1, 0, 1});
+  col_out = cudf::scan(
+    input_nulls, cudf::make_max_aggregation(), scan_type::EXCLUSIVE, null_policy::INCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::strings_column_wrapper({"", "", "", "b", ""}, {0, 1, 1, 1, 0}), col_out->view());
 }
 
 TYPED_TEST(ScanTest, EmptyColumnskip_nulls)
@@ -595,3 +628,41 @@ TYPED_TEST(FixedPointTestBothReps, FixedPointScanMax)
     CUDF_TEST_EXPECT_COLUMNS_EQUAL(result_nulls->view(), with_nulls);
   }
 }
+
+struct ScanRankTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ScanRankTest, Rank)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{3, 3, 4, 5, 5, 5, 9};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected_rank{1, 1, 3, 4, 4, 4, 7};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected_dense{1, 1, 2, 3, 3, 3, 4};
+
+  auto rank = cudf::scan(col, cudf::make_rank_aggregation(), scan_type::INCLUSIVE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_rank, rank->view());
+
+  auto dense = cudf::scan(col, cudf::make_dense_rank_aggregation(), scan_type::INCLUSIVE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_dense, dense->view());
+}
+
+TEST_F(ScanRankTest, RankStringsWithNulls)
+{
+  cudf::test::strings_column_wrapper col({"", "", "a", "a", "b", "c", "c"},
+                                         {0, 0, 1, 1, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected_rank{1, 1, 3, 3, 5, 6, 6};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expected_dense{1, 1, 2, 2, 3, 4, 4};
+
+  auto rank = cudf::scan(col, cudf::make_rank_aggregation(), scan_type::INCLUSIVE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_rank, rank->view());
+
+  auto dense = cudf::scan(col, cudf::make_dense_rank_aggregation(), scan_type::INCLUSIVE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_dense, dense->view());
+}
+
+TEST_F(ScanRankTest, ExclusiveRankThrows)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{1, 2, 3};
+  CUDF_EXPECT_THROW_MESSAGE(
+    cudf::scan(col, cudf::make_rank_aggregation(), scan_type::EXCLUSIVE),
+    "Rank aggregations are only supported for inclusive scans");
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/reduction.hpp>
+
+#include <vector>
+
+using cudf::null_policy;
+using cudf::test::fixed_width_column_wrapper;
+
+template <typename T>
+struct SegmentedReductionTest : public cudf::test::BaseFixture {
+};
+
+using SegmentedReductionTypes =
+  cudf::test::Concat<cudf::test::IntegralTypesNotBool, cudf::test::FloatingPointTypes>;
+TYPED_TEST_CASE(SegmentedReductionTest, SegmentedReductionTypes);
+
+TYPED_TEST(SegmentedReductionTest, SumExcludeNulls)
+{
+  // [1, 2, 3], [1, null, 3], [1], [null], [null, null], []
+  auto const input = fixed_width_column_wrapper<TypeParam>{{1, 2, 3, 1, 0, 3, 1, 0, 0, 0},
+                                                           {1, 1, 1, 1, 0, 1, 1, 0, 0, 0}};
+  auto const offsets   = std::vector<cudf::size_type>{0, 3, 6, 7, 8, 10, 10};
+  auto const d_offsets = cudf::detail::make_device_uvector_sync(offsets);
+  auto const expected =
+    fixed_width_column_wrapper<int64_t>{{6, 4, 1, 0, 0, 0}, {1, 1, 1, 0, 0, 0}};
+
+  auto const result = cudf::segmented_reduce(input,
+                                             d_offsets,
+                                             cudf::make_sum_aggregation(),
+                                             cudf::data_type{cudf::type_id::INT64},
+                                             null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+}
+
+TYPED_TEST(SegmentedReductionTest, SumIncludeNulls)
+{
+  // [1, 2, 3], [1, null, 3], [1], [null], [null, null], []
+  auto const input = fixed_width_column_wrapper<TypeParam>{{1, 2, 3, 1, 0, 3, 1, 0, 0, 0},
+                                                           {1, 1, 1, 1, 0, 1, 1, 0, 0, 0}};
+  auto const offsets   = std::vector<cudf::size_type>{0, 3, 6, 7, 8, 10, 10};
+  auto const d_offsets = cudf::detail::make_device_uvector_sync(offsets);
+  auto const expected =
+    fixed_width_column_wrapper<int64_t>{{6, 0, 1, 0, 0, 0}, {1, 0, 1, 0, 0, 0}};
+
+  auto const result = cudf::segmented_reduce(input,
+                                             d_offsets,
+                                             cudf::make_sum_aggregation(),
+                                             cudf::data_type{cudf::type_id::INT64},
+                                             null_policy::INCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+}
+
+TYPED_TEST(SegmentedReductionTest, MinMax)
+{
+  // [3, 1, 2], [5, null, 4], [null], []
+  auto const input =
+    fixed_width_column_wrapper<TypeParam>{{3, 1, 2, 5, 0, 4, 0}, {1, 1, 1, 1, 0, 1, 0}};
+  auto const offsets   = std::vector<cudf::size_type>{0, 3, 6, 7, 7};
+  auto const d_offsets = cudf::detail::make_device_uvector_sync(offsets);
+  auto const dtype     = cudf::data_type{cudf::type_to_id<TypeParam>()};
+
+  auto const expected_min = fixed_width_column_wrapper<TypeParam>{{1, 4, 0, 0}, {1, 1, 0, 0}};
+  auto const min = cudf::segmented_reduce(
+    input, d_offsets, cudf::make_min_aggregation(), dtype, null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_min, *min);
+
+  auto const expected_max = fixed_width_column_wrapper<TypeParam>{{3, 5, 0, 0}, {1, 1, 0, 0}};
+  auto const max = cudf::segmented_reduce(
+    input, d_offsets, cudf::make_max_aggregation(), dtype, null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_max, *max);
+}
+
+TYPED_TEST(SegmentedReductionTest, AnyAll)
+{
+  // [1, 0], [0, 0], [1, 1], [1, null]
+  auto const input =
+    fixed_width_column_wrapper<TypeParam>{{1, 0, 0, 0, 1, 1, 1, 0}, {1, 1, 1, 1, 1, 1, 1, 0}};
+  auto const offsets   = std::vector<cudf::size_type>{0, 2, 4, 6, 8};
+  auto const d_offsets = cudf::detail::make_device_uvector_sync(offsets);
+  auto const dtype     = cudf::data_type{cudf::type_id::BOOL8};
+
+  auto const expected_any = fixed_width_column_wrapper<bool>{true, false, true, true};
+  auto const any = cudf::segmented_reduce(
+    input, d_offsets, cudf::make_any_aggregation(), dtype, null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_any, *any);
+
+  auto const expected_all = fixed_width_column_wrapper<bool>{false, false, true, true};
+  auto const all = cudf::segmented_reduce(
+    input, d_offsets, cudf::make_all_aggregation(), dtype, null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_all, *all);
+}
+
+TYPED_TEST(SegmentedReductionTest, Mean)
+{
+  // [1, 2, 6], [1, null, 4], [null], []
+  auto const input =
+    fixed_width_column_wrapper<TypeParam>{{1, 2, 6, 1, 0, 4, 0}, {1, 1, 1, 1, 0, 1, 0}};
+  auto const offsets   = std::vector<cudf::size_type>{0, 3, 6, 7, 7};
+  auto const d_offsets = cudf::detail::make_device_uvector_sync(offsets);
+  auto const dtype     = cudf::data_type{cudf::type_id::FLOAT64};
+
+  auto const expected = fixed_width_column_wrapper<double>{{3.0, 2.5, 0.0, 0.0}, {1, 1, 0, 0}};
+  auto const result   = cudf::segmented_reduce(
+    input, d_offsets, cudf::make_mean_aggregation(), dtype, null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+}
+
+struct SegmentedReductionErrorTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SegmentedReductionErrorTest, NoSegments)
+{
+  auto const input     = fixed_width_column_wrapper<int32_t>{1, 2, 3};
+  auto const offsets   = std::vector<cudf::size_type>{0};
+  auto const d_offsets = cudf::detail::make_device_uvector_sync(offsets);
+
+  auto const result = cudf::segmented_reduce(input,
+                                             d_offsets,
+                                             cudf::make_sum_aggregation(),
+                                             cudf::data_type{cudf::type_id::INT64},
+                                             null_policy::EXCLUDE);
+  EXPECT_EQ(0, result->size());
+  EXPECT_EQ(cudf::type_id::INT64, result->type().id());
+}
+
+TEST_F(SegmentedReductionErrorTest, InvalidArguments)
+{
+  auto const input     = fixed_width_column_wrapper<int32_t>{1, 2, 3};
+  auto const offsets   = std::vector<cudf::size_type>{0, 3};
+  auto const d_offsets = cudf::detail::make_device_uvector_sync(offsets);
+
+  // min and max require the output type to match the input type
+  EXPECT_THROW(cudf::segmented_reduce(input,
+                                      d_offsets,
+                                      cudf::make_max_aggregation(),
+                                      cudf::data_type{cudf::type_id::INT64},
+                                      null_policy::EXCLUDE),
+               cudf::logic_error);
+  // any and all require a BOOL8 output
+  EXPECT_THROW(cudf::segmented_reduce(input,
+                                      d_offsets,
+                                      cudf::make_any_aggregation(),
+                                      cudf::data_type{cudf::type_id::INT32},
+                                      null_policy::EXCLUDE),
+               cudf::logic_error);
+  // mean is not a segmented reduction
+  EXPECT_THROW(cudf::segmented_reduce(input,
+                                      d_offsets,
+                                      cudf::make_mean_aggregation(),
+                                      cudf::data_type{cudf::type_id::FLOAT64},
+                                      null_policy::EXCLUDE),
+               cudf::logic_error);
+  // offsets must have at least one element
+  auto const no_offsets = cudf::detail::make_device_uvector_sync(std::vector<cudf::size_type>{});
+  EXPECT_THROW(cudf::segmented_reduce(input,
+                                      no_offsets,
+                                      cudf::make_sum_aggregation(),
+                                      cudf::data_type{cudf::type_id::INT64},
+                                      null_policy::EXCLUDE),
+               cudf::logic_error);
+}
@@ -21,6 +21,7 @@
 
 #include <tests/groupby/groupby_test_util.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/dictionary/detail/replace.hpp>
 #include <cudf/dictionary/encode.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
@@ -31,6 +32,7 @@
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
 struct ReplaceErrorTest : public cudf::test::BaseFixture {
@@ -717,4 +719,107 @@ TEST_F(ReplaceNullsPolicyDictionaryTest, FollowingFillTrailingNulls)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected->view());
 }
 
+struct ReplaceNullsTableTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ReplaceNullsTableTest, ReplaceScalars)
+{
+  using cudf::test::fixed_width_column_wrapper;
+  fixed_width_column_wrapper<int32_t> col0({9, 1, 2, 3, 4, 5, 6}, {1, 1, 0, 1, 0, 0, 1});
+  fixed_width_column_wrapper<double> col1({9, 1.5, 2.5, 3.5, 4.5, 5.5, 6.5}, {1, 0, 1, 1, 1, 0, 1});
+  fixed_width_column_wrapper<int8_t> col2({9, 1, 2, 3, 4, 5, 6}, {1, 0, 0, 0, 1, 1, 1});
+  fixed_width_column_wrapper<int64_t> col3({9, 1, 2, 3, 4, 5, 6});
+  fixed_width_column_wrapper<int16_t> col4({9, 1, 2, 3, 4, 5, 6}, {1, 1, 0, 1, 1, 1, 1});
+  cudf::test::strings_column_wrapper col5({"z", "a", "", "c", "", "e", "f"},
+                                          {1, 1, 0, 1, 0, 1, 1});
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep> col6(
+    {9, 1, 2, 3, 4, 5, 6}, {1, 1, 1, 0, 0, 1, 1});
+  // slicing off the first row exercises the column offsets
+  auto const input = cudf::slice(cudf::table_view({col0, col1, col2, col3, col4, col5, col6}),
+                                 {1, 7})
+                       .front();
+
+  cudf::numeric_scalar<int32_t> repl0(-1);
+  cudf::numeric_scalar<double> repl1(-1.5);
+  cudf::numeric_scalar<int8_t> repl2(-2);
+  cudf::numeric_scalar<int64_t> repl3(-3);
+  cudf::numeric_scalar<int16_t> repl4(-4, false);
+  cudf::string_scalar repl5("x");
+  cudf::timestamp_scalar<cudf::timestamp_s> repl6(cudf::duration_s{-6}, true);
+  auto result = cudf::replace_nulls(input, {repl0, repl1, repl2, repl3, repl4, repl5, repl6});
+
+  fixed_width_column_wrapper<int32_t> expected0({1, -1, 3, -1, -1, 6});
+  fixed_width_column_wrapper<double> expected1({-1.5, 2.5, 3.5, 4.5, -1.5, 6.5});
+  fixed_width_column_wrapper<int8_t> expected2({-2, -2, -2, 4, 5, 6});
+  fixed_width_column_wrapper<int64_t> expected3({1, 2, 3, 4, 5, 6});
+  // an invalid scalar leaves the column unchanged
+  fixed_width_column_wrapper<int16_t> expected4({1, 2, 3, 4, 5, 6}, {1, 0, 1, 1, 1, 1});
+  cudf::test::strings_column_wrapper expected5({"a", "x", "c", "x", "e", "f"});
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep> expected6(
+    {1, 2, -6, -6, 5, 6});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(
+    result->view(),
+    cudf::table_view(
+      {expected0, expected1, expected2, expected3, expected4, expected5, expected6}));
+}
+
+TEST_F(ReplaceNullsTableTest, ReplaceScalarsErrors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col0({1, 2, 3}, {1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int64_t> col1({1, 2, 3}, {1, 0, 1});
+  cudf::table_view const input({col0, col1});
+  cudf::numeric_scalar<int32_t> repl0(-1);
+  cudf::numeric_scalar<int32_t> repl1(-1);
+
+  EXPECT_THROW(cudf::replace_nulls(input, {repl0}), cudf::logic_error);
+  EXPECT_THROW(cudf::replace_nulls(input, {repl0, repl1}), cudf::logic_error);
+}
+
+TEST_F(ReplaceNullsTableTest, PrecedingFill)
+{
+  using cudf::test::fixed_width_column_wrapper;
+  fixed_width_column_wrapper<int32_t> col0({9, 1, 2, 3, 4, 5, 6}, {0, 1, 0, 1, 0, 0, 1});
+  fixed_width_column_wrapper<double> col1({9, 1.5, 2.5, 3.5, 4.5, 5.5, 6.5}, {1, 0, 0, 1, 1, 0, 1});
+  fixed_width_column_wrapper<int8_t> col2({9, 1, 2, 3, 4, 5, 6});
+  cudf::test::strings_column_wrapper col3({"z", "a", "", "c", "", "e", ""}, {1, 1, 0, 1, 0, 1, 0});
+  fixed_width_column_wrapper<int64_t> col4({9, 1, 2, 3, 4, 5, 6}, {1, 1, 1, 0, 0, 1, 1});
+  auto const input =
+    cudf::slice(cudf::table_view({col0, col1, col2, col3, col4}), {1, 7}).front();
+
+  auto result = cudf::replace_nulls(input, cudf::replace_policy::PRECEDING);
+
+  fixed_width_column_wrapper<int32_t> expected0({1, 1, 3, 3, 3, 6}, cudf::test::all_valid());
+  // a leading null has no preceding value and stays null
+  fixed_width_column_wrapper<double> expected1({1.5, 1.5, 3.5, 4.5, 4.5, 6.5},
+                                               {0, 0, 1, 1, 1, 1});
+  fixed_width_column_wrapper<int8_t> expected2({1, 2, 3, 4, 5, 6});
+  cudf::test::strings_column_wrapper expected3({"a", "a", "c", "c", "e", "e"},
+                                               cudf::test::all_valid());
+  fixed_width_column_wrapper<int64_t> expected4({1, 2, 2, 2, 5, 6}, cudf::test::all_valid());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(
+    result->view(), cudf::table_view({expected0, expected1, expected2, expected3, expected4}));
+}
+
+TEST_F(ReplaceNullsTableTest, FollowingFill)
+{
+  using cudf::test::fixed_width_column_wrapper;
+  fixed_width_column_wrapper<int32_t> col0({1, 2, 3, 4, 5, 6}, {1, 0, 1, 0, 0, 1});
+  fixed_width_column_wrapper<double> col1({1.5, 2.5, 3.5, 4.5, 5.5, 6.5}, {0, 0, 1, 1, 1, 0});
+  cudf::test::strings_column_wrapper col2({"a", "", "c", "", "e", ""}, {1, 0, 1, 0, 1, 1});
+  fixed_width_column_wrapper<int16_t> col3({1, 2, 3, 4, 5, 6}, {0, 0, 0, 0, 0, 0});
+  cudf::table_view const input({col0, col1, col2, col3});
+
+  auto result = cudf::replace_nulls(input, cudf::replace_policy::FOLLOWING);
+
+  fixed_width_column_wrapper<int32_t> expected0({1, 3, 3, 6, 6, 6}, cudf::test::all_valid());
+  // a trailing null has no following value and stays null
+  fixed_width_column_wrapper<double> expected1({3.5, 3.5, 3.5, 4.5, 5.5, 6.5},
+                                               {1, 1, 1, 1, 1, 0});
+  cudf::test::strings_column_wrapper expected2({"a", "c", "c", "e", "e", ""},
+                                               cudf::test::all_valid());
+  fixed_width_column_wrapper<int16_t> expected3({1, 2, 3, 4, 5, 6}, {0, 0, 0, 0, 0, 0});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result->view(),
+                                cudf::table_view({expected0, expected1, expected2, expected3}));
+}
+
 CUDF_TEST_PROGRAM_MAIN()
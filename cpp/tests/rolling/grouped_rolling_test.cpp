@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -2387,3 +2387,48 @@ TYPED_TEST(TypedUnboundedWindowTest, UnboundedPrecedingAndFollowingWindowMultiGr
                                  fixed_width_column_wrapper<cudf::size_type>{
                                    {3, 3, 3, 3, 3, 4, 4, 4, 4, 4}, {1, 1, 1, 1, 1, 1, 1, 1, 1, 1}});
 }
+
+TYPED_TEST(TypedNullTimestampTestForRangeQueries, SharedWindowSpecMultipleAggregations)
+{
+  using namespace cudf::test;
+  using T = TypeParam;
+
+  auto const grp_col  = fixed_width_column_wrapper<T>{0, 0, 0, 0, 0, 1, 1, 1, 1, 1};
+  auto const agg_col  = fixed_width_column_wrapper<T>{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9},
+                                                     {1, 1, 0, 1, 1, 1, 1, 0, 1, 1}};
+  auto const time_col = fixed_width_column_wrapper<cudf::timestamp_D, cudf::timestamp_D::rep>{
+    {1, 2, 2, 1, 2, 1, 2, 3, 4, 5}, {0, 0, 0, 1, 1, 0, 0, 1, 1, 1}};
+
+  auto const grouping_keys = cudf::table_view{std::vector<cudf::column_view>{grp_col}};
+  auto const preceding     = cudf::window_bounds::get(1);
+  auto const following     = cudf::window_bounds::get(1);
+  auto const min_periods   = 1;
+
+  std::vector<std::unique_ptr<cudf::aggregation>> aggs;
+  aggs.push_back(cudf::make_count_aggregation());
+  aggs.push_back(cudf::make_min_aggregation());
+  aggs.push_back(cudf::make_max_aggregation());
+  aggs.push_back(cudf::make_count_aggregation(cudf::null_policy::INCLUDE));
+
+  auto const window_spec = cudf::make_grouped_time_range_window_spec(
+    grouping_keys, time_col, cudf::order::ASCENDING, preceding, following);
+  EXPECT_EQ(window_spec.size(), cudf::column_view{agg_col}.size());
+
+  auto const results = cudf::rolling_window(agg_col, window_spec, min_periods, aggs);
+  ASSERT_EQ(results.size(), aggs.size());
+
+  for (std::size_t i = 0; i < aggs.size(); ++i) {
+    auto const expected = cudf::grouped_time_range_rolling_window(grouping_keys,
+                                                                  time_col,
+                                                                  cudf::order::ASCENDING,
+                                                                  agg_col,
+                                                                  preceding,
+                                                                  following,
+                                                                  min_periods,
+                                                                  aggs[i]);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), results[i]->view());
+  }
+
+  auto const short_col = fixed_width_column_wrapper<T>{0, 1, 2};
+  EXPECT_THROW(cudf::rolling_window(short_col, window_spec, min_periods, aggs), cudf::logic_error);
+}
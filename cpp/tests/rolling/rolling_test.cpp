@@ -30,6 +30,8 @@
 
 #include <thrust/iterator/constant_iterator.h>
 
+#include <algorithm>
+#include <limits>
 #include <vector>
 
 using cudf::bitmask_type;
@@ -953,6 +955,36 @@ TEST_F(RollingTestUdf, DynamicWindow)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*output, expected);
 }
 
+TEST_F(RollingTestUdf, Precompile)
+{
+  size_type size = 1000;
+
+  fixed_width_column_wrapper<int32_t> input(thrust::make_counting_iterator(0),
+                                            thrust::make_counting_iterator(size),
+                                            thrust::make_constant_iterator(true));
+
+  auto cuda_udf_agg = cudf::make_udf_aggregation(
+    cudf::udf_type::CUDA, this->cuda_func, cudf::data_type{cudf::type_id::INT64});
+  auto ptx_udf_agg = cudf::make_udf_aggregation(
+    cudf::udf_type::PTX, this->ptx_func, cudf::data_type{cudf::type_id::INT64});
+
+  auto cuda_compiled =
+    cudf::precompile_rolling_window_udf(cudf::data_type{cudf::type_id::INT32}, cuda_udf_agg);
+  auto ptx_compiled =
+    cudf::precompile_rolling_window_udf(cudf::data_type{cudf::type_id::INT32}, ptx_udf_agg);
+  EXPECT_NO_THROW(cuda_compiled.get());
+  EXPECT_NO_THROW(ptx_compiled.get());
+
+  // The precompiled kernels compute the INT64 rolling sum
+  auto expected = cudf::rolling_window(input, 2, 2, 4, cudf::make_sum_aggregation());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::rolling_window(input, 2, 2, 4, cuda_udf_agg), *expected);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::rolling_window(input, 2, 2, 4, ptx_udf_agg), *expected);
+
+  EXPECT_THROW(cudf::precompile_rolling_window_udf(cudf::data_type{cudf::type_id::INT32},
+                                                   cudf::make_sum_aggregation()),
+               cudf::logic_error);
+}
+
 template <typename T>
 struct FixedPointTests : public cudf::test::BaseFixture {
 };
@@ -1116,4 +1148,91 @@ TEST_F(RollingDictionaryTest, LeadLag)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_lag, got_lag->view());
 }
 
+template <typename T>
+class RollingSlidingWindowTest : public cudf::test::BaseFixture {
+ protected:
+  // Compares every aggregation computed by the sliding-window algorithms against a host loop.
+  // The inputs are small integers, so floating-point sums are exact in any order.
+  void run_test(size_type preceding, size_type following, size_type min_periods)
+  {
+    using SumType = cudf::detail::target_type_t<T, cudf::aggregation::SUM>;
+
+    size_type const num_rows = 1000;
+    std::vector<T> values(num_rows);
+    std::vector<bool> validity(num_rows);
+    for (size_type i = 0; i < num_rows; ++i) {
+      values[i]   = static_cast<T>((i * 37) % 101);
+      validity[i] = (i % 7) != 3;
+    }
+    fixed_width_column_wrapper<T> input(values.begin(), values.end(), validity.begin());
+
+    std::vector<SumType> sums(num_rows);
+    std::vector<double> means(num_rows);
+    std::vector<T> mins(num_rows);
+    std::vector<T> maxs(num_rows);
+    std::vector<size_type> counts(num_rows);
+    std::vector<bool> valid(num_rows);
+    std::vector<bool> count_valid(num_rows);
+    for (size_type i = 0; i < num_rows; ++i) {
+      size_type start = std::min(num_rows, std::max(0, i - preceding + 1));
+      size_type end   = std::min(num_rows, std::max(0, i + following + 1));
+      SumType sum{0};
+      T min_value     = std::numeric_limits<T>::max();
+      T max_value     = std::numeric_limits<T>::lowest();
+      size_type count = 0;
+      for (size_type j = start; j < end; ++j) {
+        if (!validity[j]) continue;
+        sum += static_cast<SumType>(values[j]);
+        min_value = std::min(min_value, values[j]);
+        max_value = std::max(max_value, values[j]);
+        ++count;
+      }
+      sums[i]        = sum;
+      means[i]       = static_cast<double>(sum) / count;
+      mins[i]        = min_value;
+      maxs[i]        = max_value;
+      counts[i]      = count;
+      valid[i]       = count >= min_periods;
+      count_valid[i] = (end - start) >= min_periods;
+    }
+
+    auto sum = cudf::rolling_window(
+      input, preceding, following, min_periods, cudf::make_sum_aggregation());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      fixed_width_column_wrapper<SumType>(sums.begin(), sums.end(), valid.begin()), *sum);
+
+    auto mean = cudf::rolling_window(
+      input, preceding, following, min_periods, cudf::make_mean_aggregation());
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+      fixed_width_column_wrapper<double>(means.begin(), means.end(), valid.begin()), *mean);
+
+    auto min = cudf::rolling_window(
+      input, preceding, following, min_periods, cudf::make_min_aggregation());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      fixed_width_column_wrapper<T>(mins.begin(), mins.end(), valid.begin()), *min);
+
+    auto max = cudf::rolling_window(
+      input, preceding, following, min_periods, cudf::make_max_aggregation());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      fixed_width_column_wrapper<T>(maxs.begin(), maxs.end(), valid.begin()), *max);
+
+    auto count = cudf::rolling_window(
+      input, preceding, following, min_periods, cudf::make_count_aggregation());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      fixed_width_column_wrapper<size_type>(counts.begin(), counts.end(), count_valid.begin()),
+      *count);
+  }
+};
+
+using SlidingWindowTypes = cudf::test::Types<int32_t, int64_t, float, double>;
+TYPED_TEST_CASE(RollingSlidingWindowTest, SlidingWindowTypes);
+
+TYPED_TEST(RollingSlidingWindowTest, CenteredWindow) { this->run_test(100, 60, 50); }
+
+TYPED_TEST(RollingSlidingWindowTest, ForwardWindow) { this->run_test(0, 200, 1); }
+
+TYPED_TEST(RollingSlidingWindowTest, WindowLargerThanColumn) { this->run_test(5000, 3000, 1); }
+
+TYPED_TEST(RollingSlidingWindowTest, AllInvalidWindows) { this->run_test(150, 0, 200); }
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -22,6 +22,10 @@
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/search.hpp>
 
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
 struct SearchTest : public cudf::test::BaseFixture {
 };
 
@@ -556,6 +560,83 @@ TEST_F(SearchTest, table__find_last__nulls_as_largest)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
 }
 
+TEST_F(SearchTest, table__sorted_values__nulls_as_smallest)
+{
+  fixed_width_column_wrapper<int32_t> column_0{{10, 10, 20, 20, 20, 20, 30, 50},
+                                               {0, 1, 1, 1, 1, 1, 1, 1}};
+  fixed_width_column_wrapper<float> column_1{{.5, 5.0, .5, .5, .7, .7, .5, .1},
+                                             {1, 1, 0, 1, 1, 1, 1, 1}};
+
+  // values are sorted like the table, with duplicates and bounds before and after all rows
+  fixed_width_column_wrapper<int32_t> values_0{{5, 10, 20, 20, 20, 20, 60}, {0, 1, 1, 1, 1, 1, 1}};
+  fixed_width_column_wrapper<float> values_1{{.5, 5.0, .5, .5, .7, .9, .1}, {1, 1, 0, 1, 1, 1, 1}};
+
+  cudf::table_view input_table{{column_0, column_1}};
+  cudf::table_view values_table{{values_0, values_1}};
+  std::vector<cudf::order> order_flags{cudf::order::ASCENDING, cudf::order::ASCENDING};
+  std::vector<cudf::null_order> null_order_flags{cudf::null_order::BEFORE,
+                                                 cudf::null_order::BEFORE};
+
+  fixed_width_column_wrapper<size_type> expect_first{0, 1, 2, 3, 4, 6, 8};
+  fixed_width_column_wrapper<size_type> expect_last{1, 2, 3, 4, 6, 6, 8};
+
+  auto const first = cudf::lower_bound(
+    input_table, values_table, order_flags, null_order_flags, cudf::sorted::YES);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*first, expect_first);
+  auto const last = cudf::upper_bound(
+    input_table, values_table, order_flags, null_order_flags, cudf::sorted::YES);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*last, expect_last);
+}
+
+TEST_F(SearchTest, large_column_with_duplicates)
+{
+  // deep enough that the search continues past the cached levels of the search tree
+  constexpr size_type num_rows = 10000;
+  std::vector<int64_t> data(num_rows);
+  std::iota(data.begin(), data.end(), 0);
+  std::transform(data.begin(), data.end(), data.begin(), [](auto i) { return i / 3; });
+  std::vector<int64_t> needles{-1, 0, 1, 1700, 3332, 3333, 3334, 42, 2999, 1};
+
+  std::vector<size_type> h_first, h_last, h_first_desc, h_last_desc;
+  for (auto needle : needles) {
+    h_first.push_back(std::lower_bound(data.begin(), data.end(), needle) - data.begin());
+    h_last.push_back(std::upper_bound(data.begin(), data.end(), needle) - data.begin());
+    h_first_desc.push_back(
+      std::lower_bound(data.rbegin(), data.rend(), needle, std::greater<>{}) - data.rbegin());
+    h_last_desc.push_back(
+      std::upper_bound(data.rbegin(), data.rend(), needle, std::greater<>{}) - data.rbegin());
+  }
+
+  fixed_width_column_wrapper<int64_t> column(data.begin(), data.end());
+  fixed_width_column_wrapper<int64_t> column_desc(data.rbegin(), data.rend());
+  fixed_width_column_wrapper<int64_t> values(needles.begin(), needles.end());
+
+  auto result = cudf::lower_bound(cudf::table_view{{column}},
+                                  cudf::table_view{{values}},
+                                  {cudf::order::ASCENDING},
+                                  {cudf::null_order::BEFORE});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *result, fixed_width_column_wrapper<size_type>(h_first.begin(), h_first.end()));
+  result = cudf::upper_bound(cudf::table_view{{column}},
+                             cudf::table_view{{values}},
+                             {cudf::order::ASCENDING},
+                             {cudf::null_order::BEFORE});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *result, fixed_width_column_wrapper<size_type>(h_last.begin(), h_last.end()));
+  result = cudf::lower_bound(cudf::table_view{{column_desc}},
+                             cudf::table_view{{values}},
+                             {cudf::order::DESCENDING},
+                             {cudf::null_order::BEFORE});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *result, fixed_width_column_wrapper<size_type>(h_first_desc.begin(), h_first_desc.end()));
+  result = cudf::upper_bound(cudf::table_view{{column_desc}},
+                             cudf::table_view{{values}},
+                             {cudf::order::DESCENDING},
+                             {cudf::null_order::BEFORE});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *result, fixed_width_column_wrapper<size_type>(h_last_desc.begin(), h_last_desc.end()));
+}
+
 TEST_F(SearchTest, contains_true)
 {
   using element_type = int64_t;
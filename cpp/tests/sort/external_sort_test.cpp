@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+// Global environment for the spill files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+struct ExternalSort : public BaseFixture {
+};
+
+namespace {
+/// Sorts the `chunks` with `external_sort`, returns the output chunks
+std::vector<std::unique_ptr<table>> external_sort_chunks(std::vector<table_view> const& chunks,
+                                                         std::vector<order> const& column_order,
+                                                         size_type block_rows,
+                                                         std::string const& spill_directory = {})
+{
+  std::size_t next = 0;
+  std::vector<std::unique_ptr<table>> output;
+  external_sort(
+    [&]() { return next < chunks.size() ? std::make_unique<table>(chunks[next++]) : nullptr; },
+    [&](std::unique_ptr<table>&& chunk) { output.push_back(std::move(chunk)); },
+    {0},
+    column_order,
+    {null_order::AFTER},
+    block_rows,
+    spill_directory);
+  return output;
+}
+
+/// Concatenates the output chunks
+std::unique_ptr<table> concatenate_chunks(std::vector<std::unique_ptr<table>> const& chunks)
+{
+  std::vector<table_view> views;
+  for (auto const& chunk : chunks) {
+    views.push_back(chunk->view());
+  }
+  return cudf::concatenate(views);
+}
+}  // namespace
+
+TEST_F(ExternalSort, Basic)
+{
+  fixed_width_column_wrapper<int32_t> keys0{3, 1, 5};
+  fixed_width_column_wrapper<int32_t> keys1{4, 2, 6};
+  fixed_width_column_wrapper<int32_t> keys2{0, 7};
+  std::vector<table_view> chunks{table_view{{keys0}}, table_view{{keys1}}, table_view{{keys2}}};
+
+  auto const output = external_sort_chunks(chunks, {order::ASCENDING}, 2);
+
+  ASSERT_EQ(output.size(), 3u);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<int32_t>{0, 1, 2, 3},
+                                 output[0]->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<int32_t>{4}, output[1]->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<int32_t>{5, 6, 7},
+                                 output[2]->get_column(0));
+}
+
+TEST_F(ExternalSort, MatchesSortOfWholeInput)
+{
+  // Distinct keys with one null, so that the order of the payload is unique
+  auto const num_rows = 1000;
+  using cudf::detail::make_counting_transform_iterator;
+  auto const keys     = make_counting_transform_iterator(0, [](auto i) { return i * 7919 % 1000; });
+  auto const validity = make_counting_transform_iterator(0, [](auto i) { return i != 500; });
+  auto const payload =
+    make_counting_transform_iterator(0, [](auto i) { return std::to_string(i); });
+  fixed_width_column_wrapper<int64_t> key_col(keys, keys + num_rows, validity);
+  strings_column_wrapper payload_col(payload, payload + num_rows);
+  table_view input{{key_col, payload_col}};
+
+  auto const chunks = cudf::split(input, {100, 350, 351, 700});
+  auto const expected =
+    sort_by_key(input, input.select({0}), {order::DESCENDING}, {null_order::AFTER});
+  for (auto const& spill_directory : {std::string{}, temp_env->get_temp_dir()}) {
+    auto const output = external_sort_chunks(chunks, {order::DESCENDING}, 64, spill_directory);
+    EXPECT_GT(output.size(), 1u);
+    for (auto const& chunk : output) {
+      EXPECT_LE(chunk->num_rows(), 64 * 5);
+    }
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, *concatenate_chunks(output));
+  }
+}
+
+TEST_F(ExternalSort, EmptyInput)
+{
+  fixed_width_column_wrapper<int32_t> empty{};
+  EXPECT_TRUE(external_sort_chunks({}, {order::ASCENDING}, 2).empty());
+  EXPECT_TRUE(external_sort_chunks({table_view{{empty}}}, {order::ASCENDING}, 2).empty());
+}
+
+TEST_F(ExternalSort, InvalidInputs)
+{
+  fixed_width_column_wrapper<int32_t> ints{1, 2};
+  fixed_width_column_wrapper<float> floats{1, 2};
+  std::vector<table_view> chunks{table_view{{ints}}, table_view{{floats}}};
+  EXPECT_THROW(external_sort_chunks(chunks, {order::ASCENDING}, 2), logic_error);
+  EXPECT_THROW(external_sort_chunks({table_view{{ints}}}, {order::ASCENDING}, 0), logic_error);
+  EXPECT_THROW(external_sort_chunks({table_view{{ints}}}, {}, 2), logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -22,8 +22,11 @@
 
 #include <cudf/copying.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/sorting.hpp>
 
+#include <thrust/iterator/constant_iterator.h>
+
 #include <type_traits>
 #include <vector>
 
@@ -242,6 +245,36 @@ TEST_F(SegmentedSortInt, Sliced)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected3);
 }
 
+TEST_F(SegmentedSortInt, LongSegments)
+{
+  // Segments of 150 rows on average are sorted by a segmented radix sort
+  auto const num_rows = 3000;
+  using cudf::detail::make_counting_transform_iterator;
+  auto const ints     = make_counting_transform_iterator(0, [](auto i) { return i * 7919 % 61; });
+  auto const doubles  = make_counting_transform_iterator(0, [](auto i) { return i % 7 - 3.5; });
+  auto const validity = make_counting_transform_iterator(0, [](auto i) { return i % 11 != 0; });
+  auto const offsets  = make_counting_transform_iterator(0, [](auto i) { return i * i * 15 / 2; });
+  fixed_width_column_wrapper<int32_t> col1(ints, ints + num_rows, validity);
+  fixed_width_column_wrapper<double> col2(doubles, doubles + num_rows);
+  fixed_width_column_wrapper<size_type> segments(offsets, offsets + 21);
+  // A constant strings column makes the sort use the segment ids and the comparator
+  auto const strings = thrust::make_constant_iterator("a");
+  strings_column_wrapper constant(strings, strings + num_rows);
+
+  table_view keys{{col1, col2}};
+  auto const got = cudf::detail::segmented_sorted_order(keys,
+                                                        segments,
+                                                        {order::ASCENDING, order::DESCENDING},
+                                                        {null_order::AFTER, null_order::AFTER});
+  auto const expected =
+    cudf::detail::segmented_sorted_order(table_view{{col1, col2, constant}},
+                                         segments,
+                                         {order::ASCENDING, order::DESCENDING, order::ASCENDING},
+                                         {null_order::AFTER, null_order::AFTER, null_order::AFTER});
+  // Rows with equal keys may be ordered differently
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*cudf::gather(keys, *expected), *cudf::gather(keys, *got));
+}
+
 TEST_F(SegmentedSortInt, ErrorsMismatchArgSizes)
 {
   using T = int;
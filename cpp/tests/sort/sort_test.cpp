@@ -17,17 +17,26 @@
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <thrust/iterator/constant_iterator.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace cudf {
@@ -665,6 +674,192 @@ TEST_F(SortByKey, ValueKeysSizeMismatch)
   EXPECT_THROW(sort_by_key(values, keys), logic_error);
 }
 
+struct SortNormalizedKeys : public BaseFixture {
+};
+
+TEST_F(SortNormalizedKeys, MatchesComparator)
+{
+  auto const num_rows = 1000;
+  auto const nan      = std::numeric_limits<double>::quiet_NaN();
+  auto const inf      = std::numeric_limits<double>::infinity();
+  std::vector<double> const doubles{nan, -0.0, 0.0, -inf, inf, 1.5, -1.5, -nan};
+
+  using cudf::detail::make_counting_transform_iterator;
+  auto const ints   = make_counting_transform_iterator(0, [](auto i) { return i * 7919 % 13 - 6; });
+  auto const floats = make_counting_transform_iterator(0, [&](auto i) { return doubles[i % 8]; });
+  auto const longs  = make_counting_transform_iterator(
+    0, [](auto i) { return (i * 31 % 5 - 2) * int64_t{1'000'000'000'000}; });
+  auto const bools = make_counting_transform_iterator(0, [](auto i) { return i % 3 == 0; });
+  auto const days  = make_counting_transform_iterator(0, [](auto i) { return i % 4 - 2; });
+  auto const uints = make_counting_transform_iterator(
+    0, [](auto i) { return i % 2 ? std::numeric_limits<uint64_t>::max() - i % 3 : i % 3; });
+  auto const valid_n = [](int n) {
+    return make_counting_transform_iterator(0, [n](auto i) { return i % n != 0; });
+  };
+
+  fixed_width_column_wrapper<int32_t> col0(ints, ints + num_rows, valid_n(7));
+  fixed_width_column_wrapper<double> col1(floats, floats + num_rows, valid_n(5));
+  fixed_width_column_wrapper<int64_t> col2(longs, longs + num_rows);
+  fixed_width_column_wrapper<bool> col3(bools, bools + num_rows, valid_n(11));
+  fixed_width_column_wrapper<timestamp_D, int32_t> col4(days, days + num_rows);
+  fixed_width_column_wrapper<uint64_t> col5(uints, uints + num_rows, valid_n(9));
+  // A constant strings column makes the sort use the comparator without changing the order
+  auto const strings = thrust::make_constant_iterator("a");
+  strings_column_wrapper constant(strings, strings + num_rows);
+
+  table_view keys{{col0, col1, col2, col3, col4, col5}};
+  table_view keys_with_strings{{col0, col1, col2, col3, col4, col5, constant}};
+
+  auto const asc    = order::ASCENDING;
+  auto const desc   = order::DESCENDING;
+  auto const before = null_order::BEFORE;
+  auto const after  = null_order::AFTER;
+  std::vector<std::pair<std::vector<order>, std::vector<null_order>>> const cases{
+    {{}, {}},
+    {{desc, desc, desc, desc, desc, desc}, {after, after, after, after, after, after}},
+    {{asc, desc, asc, desc, asc, desc}, {before, after, after, before, before, after}},
+    {{desc, asc, desc, asc, desc, asc}, {after, before, before, after, after, before}}};
+
+  for (auto const& c : cases) {
+    auto orders      = c.first;
+    auto null_orders = c.second;
+    auto const got   = stable_sorted_order(keys, orders, null_orders);
+    if (not orders.empty()) {
+      orders.push_back(asc);
+      null_orders.push_back(before);
+    }
+    auto const expected = stable_sorted_order(keys_with_strings, orders, null_orders);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, *got);
+  }
+
+  // Single radix sort of two 32-bit columns without nulls
+  fixed_width_column_wrapper<int32_t> col6(ints, ints + num_rows);
+  fixed_width_column_wrapper<float, int32_t> col7(ints, ints + num_rows);
+  auto const got = sorted_order(table_view{{col6, col7}}, {desc, asc});
+  auto const expected =
+    stable_sorted_order(table_view{{col6, col7, constant}}, {desc, asc, asc});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, *got);
+}
+
+TEST_F(SortNormalizedKeys, StringPrefixes)
+{
+  // Strings sharing 8-byte prefixes, differing in their trailing zero bytes or in their lengths
+  auto const num_rows = 1000;
+  std::vector<std::string> const words{"https://example.com/a",
+                                       "https://example.com/b",
+                                       "https://",
+                                       "https:/",
+                                       "",
+                                       std::string("a\0", 2),
+                                       "a",
+                                       "\xff\xfe",
+                                       "Zebra",
+                                       "zebra"};
+  using cudf::detail::make_counting_transform_iterator;
+  auto const strings =
+    make_counting_transform_iterator(0, [&](auto i) { return words[i * 7 % words.size()]; });
+  auto const validity = make_counting_transform_iterator(0, [](auto i) { return i % 13 != 0; });
+  strings_column_wrapper col(strings, strings + num_rows, validity);
+  strings_column_wrapper non_null_col(strings, strings + num_rows);
+  fixed_width_column_wrapper<int32_t> constant(thrust::make_constant_iterator(0),
+                                               thrust::make_constant_iterator(0) + num_rows);
+
+  for (auto const& input : {column_view{col}, column_view{non_null_col}}) {
+    for (auto const column_order : {order::ASCENDING, order::DESCENDING}) {
+      for (auto const null_precedence : {null_order::BEFORE, null_order::AFTER}) {
+        // The constant column makes the sort compare full strings
+        auto const expected = stable_sorted_order(table_view{{input, constant}},
+                                                  {column_order, order::ASCENDING},
+                                                  {null_precedence, null_order::BEFORE});
+        CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+          *expected, *stable_sorted_order(table_view{{input}}, {column_order}, {null_precedence}));
+        auto const sorted = sorted_order(table_view{{input}}, {column_order}, {null_precedence});
+        CUDF_TEST_EXPECT_COLUMNS_EQUAL(gather(table_view{{input}}, *expected)->view().column(0),
+                                       gather(table_view{{input}}, *sorted)->view().column(0));
+      }
+    }
+  }
+}
+
+TEST_F(SortNormalizedKeys, MultiColumnStringPrefixes)
+{
+  // Strings compared by their prefixes, then by the bytes after them, then by the second column
+  std::vector<std::string> const words{"abcdefghij",
+                                       "abcdefgh",
+                                       "abcdefghi",
+                                       "abc",
+                                       "abcdefgh",
+                                       "",
+                                       "abcdefghb",
+                                       std::string("abcdefgh\0", 9),
+                                       std::string("abc\0", 4),
+                                       "\xff\xfe"};
+  std::vector<int32_t> const ints{1, 2, 3, 4, 1, 5, 6, 7, 8, 9};
+  strings_column_wrapper strings(words.begin(), words.end());
+  fixed_width_column_wrapper<int32_t> values(ints.begin(), ints.end());
+  table_view const input{{strings, values}};
+
+  for (auto const column_order : {order::ASCENDING, order::DESCENDING}) {
+    std::vector<size_type> expected(words.size());
+    std::iota(expected.begin(), expected.end(), 0);
+    std::stable_sort(expected.begin(), expected.end(), [&](auto lhs, auto rhs) {
+      if (words[lhs] != words[rhs]) {
+        return (column_order == order::ASCENDING) == (words[lhs] < words[rhs]);
+      }
+      return ints[lhs] < ints[rhs];
+    });
+    fixed_width_column_wrapper<size_type> expected_col(expected.begin(), expected.end());
+    auto const got = stable_sorted_order(input, {column_order, order::ASCENDING});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_col, *got);
+  }
+}
+
+struct SortLists : public BaseFixture {
+};
+
+TEST_F(SortLists, Basic)
+{
+  using LCW = lists_column_wrapper<int32_t>;
+  // Lists are ordered by their first unequal elements, then by their sizes
+  auto const lists = LCW{{LCW{3, 1},
+                          LCW{1, 2, 3},
+                          LCW{},
+                          LCW{1, 2},
+                          LCW{3},
+                          LCW{},
+                          LCW{{1, 0}, iterator_with_null_at(1)}},
+                         iterator_with_null_at(5)};
+  fixed_width_column_wrapper<int32_t> values{0, 1, 2, 3, 4, 5, 6};
+  table_view const input{{lists, values}};
+
+  fixed_width_column_wrapper<size_type> expected_ascending{5, 2, 6, 3, 1, 4, 0};
+  auto got = sorted_order(table_view{{lists}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_ascending, *got);
+  run_sort_test(input, expected_ascending);
+
+  fixed_width_column_wrapper<size_type> expected_descending{0, 4, 1, 3, 6, 2, 5};
+  got = sorted_order(table_view{{lists}}, {order::DESCENDING});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_descending, *got);
+}
+
+TEST_F(SortLists, Sliced)
+{
+  using LCW        = lists_column_wrapper<int32_t>;
+  auto const lists = LCW{LCW{9}, LCW{4, 5}, LCW{4}, LCW{2, 7}, LCW{0}};
+  auto const input = cudf::slice(lists, {1, 4})[0];
+
+  fixed_width_column_wrapper<size_type> expected{2, 1, 0};
+  auto const got = sorted_order(table_view{{input}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *got);
+}
+
+TEST_F(SortLists, NestedElementsThrow)
+{
+  using LCW        = lists_column_wrapper<int32_t>;
+  auto const lists = LCW{LCW{{1, 2}, {3}}, LCW{{4, 5}}};
+  EXPECT_THROW(sorted_order(table_view{{lists}}), cudf::logic_error);
+}
+
 template <typename T>
 struct FixedPointTestBothReps : public cudf::test::BaseFixture {
 };
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <thrust/iterator/constant_iterator.h>
+
+#include <type_traits>
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+using indices_col = fixed_width_column_wrapper<size_type>;
+
+template <typename T>
+struct TopK : public BaseFixture {
+};
+
+TYPED_TEST_CASE(TopK, NumericTypes);
+
+TYPED_TEST(TopK, SingleColumn)
+{
+  if (std::is_same<TypeParam, bool>::value) { return; }
+  fixed_width_column_wrapper<TypeParam, int> col{5, 1, 4, 2, 1, 3, 0, 2};
+  table_view keys{{col}};
+
+  // Ties are broken by row order
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(indices_col{6, 1, 4}, *top_k(keys, 3));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(indices_col{0, 2, 5, 3},
+                                 *top_k(keys, 4, {order::DESCENDING}, {null_order::AFTER}));
+}
+
+struct TopKMultiColumn : public BaseFixture {
+};
+
+TEST_F(TopKMultiColumn, MatchesStableSortedOrder)
+{
+  auto const num_rows = 1000;
+  using cudf::detail::make_counting_transform_iterator;
+  auto const ints   = make_counting_transform_iterator(0, [](auto i) { return i * 7919 % 13 - 6; });
+  auto const floats = make_counting_transform_iterator(0, [](auto i) { return i * 31 % 7 * 0.5; });
+  auto const shorts = make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  auto const valid_n = [](int n) {
+    return make_counting_transform_iterator(0, [n](auto i) { return i % n != 0; });
+  };
+
+  fixed_width_column_wrapper<int32_t> col0(ints, ints + num_rows, valid_n(7));
+  fixed_width_column_wrapper<float> col1(floats, floats + num_rows, valid_n(5));
+  fixed_width_column_wrapper<int16_t> col2(shorts, shorts + num_rows);
+  // Strings keys are not normalized, the top rows are then taken from the sorted order
+  auto const strings = thrust::make_constant_iterator("a");
+  strings_column_wrapper col3(strings, strings + num_rows);
+
+  auto const desc  = order::DESCENDING;
+  auto const asc   = order::ASCENDING;
+  auto const after = null_order::AFTER;
+  for (auto const& keys : {table_view{{col0, col1, col2}}, table_view{{col0, col1, col2, col3}}}) {
+    std::vector<order> column_order(keys.num_columns(), asc);
+    std::vector<null_order> null_precedence(keys.num_columns(), after);
+    column_order[1] = desc;
+    for (auto k : {0, 1, 17, 500, 999, 1000, 2000}) {
+      auto const sorted   = stable_sorted_order(keys, column_order, null_precedence);
+      auto const expected = cudf::slice(*sorted, {0, std::min(k, num_rows)}).front();
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *top_k(keys, k, column_order, null_precedence));
+    }
+  }
+}
+
+TEST_F(TopKMultiColumn, Segmented)
+{
+  fixed_width_column_wrapper<int32_t> col{5, 1, 4, 2, 9, 8, 3};
+  indices_col offsets{0, 3, 4, 4, 7};
+  table_view keys{{col}};
+
+  lists_column_wrapper<size_type> expected{{1, 2}, {3}, {}, {6, 5}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *segmented_top_k(keys, offsets, 2));
+  lists_column_wrapper<size_type> empty{{}, {}, {}, {}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(empty, *segmented_top_k(keys, offsets, 0));
+}
+
+TEST_F(TopKMultiColumn, InvalidInputs)
+{
+  fixed_width_column_wrapper<int32_t> col{5, 1, 4};
+  table_view keys{{col}};
+  EXPECT_THROW(top_k(keys, -1), logic_error);
+  EXPECT_THROW(top_k(keys, 1, {order::ASCENDING, order::ASCENDING}), logic_error);
+  fixed_width_column_wrapper<int64_t> offsets{0, 3};
+  EXPECT_THROW(segmented_top_k(keys, offsets, 1), logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <cudf/ast/linearizer.hpp>
+#include <cudf/ast/transform.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/stream_compaction.hpp>
@@ -26,6 +28,8 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <string>
+
 struct ApplyBooleanMask : public cudf::test::BaseFixture {
 };
 
@@ -271,6 +275,62 @@ TEST_F(ApplyBooleanMask, CorrectNullCount)
   ASSERT_EQ(out_col.null_count(), expected_null_count);
 }
 
+TEST_F(ApplyBooleanMask, WideTable)
+{
+  cudf::size_type const num_rows = 1000;
+
+  auto const seq    = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto const valids = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i % 7 != 0; });
+  auto const strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::to_string(i); });
+  cudf::test::fixed_width_column_wrapper<int8_t, int32_t> col1(seq, seq + num_rows, valids);
+  cudf::test::fixed_width_column_wrapper<int16_t, int32_t> col2(seq, seq + num_rows);
+  cudf::test::fixed_width_column_wrapper<int32_t> col3(seq, seq + num_rows, valids);
+  cudf::test::fixed_width_column_wrapper<int64_t, int32_t> col4(seq, seq + num_rows, valids);
+  cudf::test::fixed_width_column_wrapper<double, int32_t> col5(seq, seq + num_rows);
+  cudf::test::strings_column_wrapper col6(strings, strings + num_rows, valids);
+  cudf::test::fixed_width_column_wrapper<bool, int32_t> col7(seq, seq + num_rows, valids);
+  cudf::table_view input{{col1, col2, col3, col4, col5, col6, col7}};
+
+  auto const mask_values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i % 3 != 0; });
+  auto const mask_valids = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i % 11 != 0; });
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask(
+    mask_values, mask_values + num_rows, mask_valids);
+
+  auto got = cudf::apply_boolean_mask(input, boolean_mask);
+
+  // Filtering the columns one at a time scatters each of them
+  for (cudf::size_type i = 0; i < input.num_columns(); ++i) {
+    auto expected = cudf::apply_boolean_mask(cudf::table_view{{input.column(i)}}, boolean_mask);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->get_column(0), got->get_column(i));
+  }
+}
+
+TEST_F(ApplyBooleanMask, GatherMap)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{10, 40, 70, 5, 2, 10}, {1, 1, 0, 1, 1, 0}};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{{true, false, true, false, true, true},
+                                                            {0, 1, 1, 1, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{2, 4, 5};
+
+  auto gather_map = cudf::boolean_mask_gather_map(boolean_mask);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, gather_map->view());
+
+  cudf::table_view input{{col}};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::apply_boolean_mask(input, boolean_mask)->view(),
+                                cudf::gather(input, gather_map->view())->view());
+}
+
+TEST_F(ApplyBooleanMask, GatherMapWrongMaskType)
+{
+  cudf::test::fixed_width_column_wrapper<int8_t> boolean_mask{{1, 0, 1}};
+
+  EXPECT_THROW(cudf::boolean_mask_gather_map(boolean_mask), cudf::logic_error);
+}
+
 TEST_F(ApplyBooleanMask, StructFiltering)
 {
   using namespace cudf::test;
@@ -366,4 +426,48 @@ TEST_F(ApplyBooleanMask, StructOfListsFiltering)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(filtered_lists_column, expected_structs_column);
 }
 
+TEST_F(ApplyBooleanMask, FilterWithExpression)
+{
+  using namespace cudf::test;
+
+  auto price = fixed_width_column_wrapper<int32_t>{{5, 40, 3, 20, 50}, {1, 1, 1, 0, 1}};
+  auto qty   = fixed_width_column_wrapper<int32_t>{1, 2, 10, 4, 1};
+  auto name  = strings_column_wrapper{"a", "bb", "ccc", "dddd", "eeeee"};
+  auto input = cudf::table_view{{price, qty, name}};
+
+  // price * qty > 25
+  auto price_ref   = cudf::ast::column_reference(0);
+  auto qty_ref     = cudf::ast::column_reference(1);
+  auto bound_value = cudf::numeric_scalar<int32_t>(25);
+  auto bound       = cudf::ast::literal(bound_value);
+  auto product     = cudf::ast::expression(cudf::ast::ast_operator::MUL, price_ref, qty_ref);
+  auto predicate   = cudf::ast::expression(cudf::ast::ast_operator::GREATER, product, bound);
+
+  auto expected_price = fixed_width_column_wrapper<int32_t>{40, 3, 50};
+  auto expected_qty   = fixed_width_column_wrapper<int32_t>{2, 10, 1};
+  auto expected_name  = strings_column_wrapper{"bb", "ccc", "eeeee"};
+  auto expected       = cudf::table_view{{expected_price, expected_qty, expected_name}};
+
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected, cudf::filter(input, predicate)->view());
+
+  auto boolean_mask = cudf::ast::compute_column(input, predicate);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::apply_boolean_mask(input, *boolean_mask)->view(),
+                                cudf::filter(input, predicate)->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::boolean_mask_gather_map(*boolean_mask)->view(),
+                                 cudf::filter_gather_map(input, predicate)->view());
+}
+
+TEST_F(ApplyBooleanMask, FilterNonBooleanPredicate)
+{
+  using namespace cudf::test;
+
+  auto value = fixed_width_column_wrapper<int32_t>{1, 2, 3, 4};
+  auto input = cudf::table_view{{value}};
+
+  auto value_ref = cudf::ast::column_reference(0);
+  auto predicate = cudf::ast::expression(cudf::ast::ast_operator::ADD, value_ref, value_ref);
+
+  EXPECT_THROW(cudf::filter(input, predicate), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,8 @@
 #include <cmath>
 #include <ctgmath>
 #include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/sorting.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -28,6 +30,8 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+
 using cudf::nan_policy;
 using cudf::null_equality;
 using cudf::null_policy;
@@ -258,6 +262,42 @@ TEST_F(DistinctCount, TableWithStringColumnWithNull)
   EXPECT_EQ(10, cudf::distinct_count(input, null_equality::UNEQUAL));
 }
 
+TEST_F(DistinctCount, ApproxWithinError)
+{
+  auto const values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int64_t>(i % 5000) * 7919; });
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 100 != 0; });
+  cudf::test::fixed_width_column_wrapper<int64_t> input_col(values, values + 10000, valids);
+
+  auto const expected =
+    cudf::distinct_count(input_col, null_policy::EXCLUDE, nan_policy::NAN_IS_VALID);
+  auto const max_relative_error = 0.02;
+  auto const estimate =
+    cudf::approx_distinct_count(input_col, max_relative_error, null_policy::EXCLUDE);
+  EXPECT_NEAR(expected, estimate, 3 * max_relative_error * expected);
+  EXPECT_EQ(estimate + 1,
+            cudf::approx_distinct_count(input_col, max_relative_error, null_policy::INCLUDE));
+}
+
+TEST_F(DistinctCount, ApproxWithNans)
+{
+  cudf::test::fixed_width_column_wrapper<double> input_col{
+    {1.0, NAN, 3.0, NAN, 1.0, 0.0, 2.0, -0.0}, {1, 1, 1, 1, 1, 0, 1, 1}};
+
+  EXPECT_EQ(5, cudf::approx_distinct_count(input_col, 0.01, null_policy::EXCLUDE));
+  EXPECT_EQ(6, cudf::approx_distinct_count(input_col, 0.01, null_policy::INCLUDE));
+}
+
+TEST_F(DistinctCount, ApproxEmptyAndInvalidError)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> empty_col{};
+  cudf::test::fixed_width_column_wrapper<int32_t> input_col{1, 2, 3};
+
+  EXPECT_EQ(0, cudf::approx_distinct_count(empty_col, 0.01));
+  EXPECT_THROW(cudf::approx_distinct_count(input_col, 0.0), cudf::logic_error);
+}
+
 struct DropDuplicate : public cudf::test::BaseFixture {
 };
 
@@ -394,3 +434,89 @@ TEST_F(DropDuplicate, EmptyKeys)
 
   CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{empty_col}}, got->view());
 }
+
+struct Distinct : public cudf::test::BaseFixture {
+};
+
+TEST_F(Distinct, KeepOptions)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> key_col{4, 1, 4, 2, 1, 4};
+  cudf::test::strings_column_wrapper col{"a", "b", "c", "d", "e", "f"};
+  cudf::table_view input{{key_col, col}};
+  std::vector<cudf::size_type> keys{0};
+
+  // The kept rows are in the order of the input
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_key_first{4, 1, 2};
+  cudf::test::strings_column_wrapper exp_col_first{"a", "b", "d"};
+  auto got = distinct(input, keys, cudf::duplicate_keep_option::KEEP_FIRST);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{exp_key_first, exp_col_first}}, got->view());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_key_last{2, 1, 4};
+  cudf::test::strings_column_wrapper exp_col_last{"d", "e", "f"};
+  got = distinct(input, keys, cudf::duplicate_keep_option::KEEP_LAST);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{exp_key_last, exp_col_last}}, got->view());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_key_unique{2};
+  cudf::test::strings_column_wrapper exp_col_unique{"d"};
+  got = distinct(input, keys, cudf::duplicate_keep_option::KEEP_NONE);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{exp_key_unique, exp_col_unique}}, got->view());
+
+  // Any of the duplicates may be kept, but the keys are the same as with KEEP_FIRST
+  got = distinct(input, keys, cudf::duplicate_keep_option::KEEP_ANY);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(exp_key_first, got->get_column(0));
+}
+
+TEST_F(Distinct, NullKeys)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{5, 4, 3, 5, 8, 1}, {1, 0, 1, 1, 1, 1}};
+  cudf::test::strings_column_wrapper key_col{{"all", "new", "all", "new", "the", "strings"},
+                                             {1, 1, 1, 0, 1, 1}};
+  cudf::table_view input{{col, key_col}};
+  std::vector<cudf::size_type> keys{1};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col{{4, 3, 5, 8, 1}, {0, 1, 1, 1, 1}};
+  cudf::test::strings_column_wrapper exp_key_col{{"new", "all", "new", "the", "strings"},
+                                                 {1, 1, 0, 1, 1}};
+  auto got = distinct(input, keys, cudf::duplicate_keep_option::KEEP_LAST);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{exp_col, exp_key_col}}, got->view());
+
+  // Unequal nulls are all kept
+  cudf::test::fixed_width_column_wrapper<int32_t> nulls_col{{1, 2, 3, 4}, {1, 1, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> nulls_key{{0, 0, 7, 7}, {0, 0, 1, 1}};
+  cudf::table_view nulls_input{{nulls_key, nulls_col}};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_nulls_col{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_nulls_key{{0, 0, 7}, {0, 0, 1}};
+  got = distinct(
+    nulls_input, {0}, cudf::duplicate_keep_option::KEEP_FIRST, null_equality::UNEQUAL);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{exp_nulls_key, exp_nulls_col}}, got->view());
+}
+
+TEST_F(Distinct, MatchesDropDuplicates)
+{
+  auto const num_rows = 10000;
+  auto const keys_it  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i * 7919 % 1223; });
+  cudf::test::fixed_width_column_wrapper<int32_t> key_col(keys_it, keys_it + num_rows);
+  cudf::test::fixed_width_column_wrapper<int32_t> col(thrust::make_counting_iterator(0),
+                                                      thrust::make_counting_iterator(num_rows));
+  cudf::table_view input{{key_col, col}};
+
+  for (auto keep : {cudf::duplicate_keep_option::KEEP_FIRST,
+                    cudf::duplicate_keep_option::KEEP_LAST,
+                    cudf::duplicate_keep_option::KEEP_NONE}) {
+    // drop_duplicates sorts the rows by their keys
+    auto const got      = distinct(input, {0}, keep);
+    auto const sorted   = cudf::sort_by_key(got->view(), got->view().select({0}));
+    auto const expected = drop_duplicates(input, {0}, keep);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), sorted->view());
+  }
+}
+
+TEST_F(Distinct, EmptyInputTable)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col(std::initializer_list<int32_t>{});
+  cudf::table_view input{{col}};
+
+  auto got = distinct(input, {0});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, got->view());
+}
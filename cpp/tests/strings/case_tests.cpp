@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/strings/capitalize.hpp>
 #include <cudf/strings/case.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -26,6 +27,9 @@
 
 #include <thrust/iterator/transform_iterator.h>
 
+#include <algorithm>
+#include <cctype>
+#include <string>
 #include <vector>
 
 struct StringsCaseTest : public cudf::test::BaseFixture {
@@ -174,3 +178,47 @@ TEST_F(StringsCaseTest, MultiCharLower)
 
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
+
+TEST_F(StringsCaseTest, Ascii)
+{
+  // every ASCII character in strings of various lengths, so the words are not aligned
+  std::string all_ascii;
+  for (int ch = 1; ch < 128; ++ch) {
+    all_ascii.push_back(static_cast<char>(ch));
+  }
+  std::vector<std::string> h_strings;
+  for (std::size_t length = 0; length < 12; ++length) {
+    h_strings.push_back(all_ascii.substr(length * 7, length));
+  }
+  h_strings.push_back(all_ascii);
+  auto const convert = [](std::string str, auto fn) {
+    std::transform(str.begin(), str.end(), str.begin(), fn);
+    return str;
+  };
+  auto const lower = [](char ch) { return static_cast<char>(std::tolower(ch)); };
+  auto const upper = [](char ch) { return static_cast<char>(std::toupper(ch)); };
+  auto const swap  = [](char ch) {
+    return static_cast<char>(std::islower(ch) ? std::toupper(ch) : std::tolower(ch));
+  };
+
+  std::vector<std::string> h_lower, h_upper, h_swapped;
+  for (auto const& str : h_strings) {
+    h_lower.push_back(convert(str, lower));
+    h_upper.push_back(convert(str, upper));
+    h_swapped.push_back(convert(str, swap));
+  }
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  cudf::test::strings_column_wrapper expected_lower(h_lower.begin(), h_lower.end());
+  cudf::test::strings_column_wrapper expected_upper(h_upper.begin(), h_upper.end());
+  cudf::test::strings_column_wrapper expected_swapped(h_swapped.begin(), h_swapped.end());
+
+  auto strings_view = cudf::strings_column_view(strings);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::strings::to_lower(strings_view), expected_lower);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::strings::to_upper(strings_view), expected_upper);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::strings::swapcase(strings_view), expected_swapped);
+
+  // sliced rows start within the chars
+  auto const sliced = cudf::slice(strings, {3, 9}).front();
+  auto results      = cudf::strings::to_upper(cudf::strings_column_view(sliced));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, cudf::slice(expected_upper, {3, 9}).front());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -192,6 +192,63 @@ TEST_F(StringsContainsTests, MatchesTest)
   }
 }
 
+TEST_F(StringsContainsTests, DFAPatterns)
+{
+  // the non-ASCII strings are not evaluated by the DFA
+  cudf::test::strings_column_wrapper strings({"ERROR [db] timeout after 30s",
+                                              "INFO [web] GET /index.html 200",
+                                              "WARN [wéb] retry 3 of 5",
+                                              "error",
+                                              "",
+                                              "ERROR [café] 500",
+                                              "DEBUG [db] 12ms"});
+  auto strings_view = cudf::strings_column_view(strings);
+  {
+    auto results = cudf::strings::contains_re(strings_view, "(ERROR|WARN) \\[\\w+\\]");
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 1, 0, 0, 1, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results = cudf::strings::contains_re(strings_view, "\\d+(s|ms)");
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 0, 0, 0, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results = cudf::strings::contains_re(strings_view, "[^ -~]");
+    cudf::test::fixed_width_column_wrapper<bool> expected({0, 0, 1, 0, 0, 1, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto results = cudf::strings::matches_re(strings_view, "[A-Z]+ \\[\\w+\\] \\d");
+    cudf::test::fixed_width_column_wrapper<bool> expected({0, 0, 0, 0, 0, 1, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    // anchors are evaluated without the DFA
+    auto results = cudf::strings::contains_re(strings_view, "\\d$");
+    cudf::test::fixed_width_column_wrapper<bool> expected({0, 1, 1, 0, 0, 1, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
+TEST_F(StringsContainsTests, CachedPatterns)
+{
+  cudf::test::strings_column_wrapper strings({"abc", "xabc", "", "ab"});
+  auto strings_view = cudf::strings_column_view(strings);
+  // the same pattern is compiled once for each kind of match and reused
+  for (int i = 0; i < 2; ++i) {
+    auto results = cudf::strings::contains_re(strings_view, "ab+c");
+    cudf::test::fixed_width_column_wrapper<bool> expected_contains({1, 1, 0, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_contains);
+    results = cudf::strings::matches_re(strings_view, "ab+c");
+    cudf::test::fixed_width_column_wrapper<bool> expected_matches({1, 0, 0, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_matches);
+    results = cudf::strings::count_re(strings_view, "ab+c");
+    cudf::test::fixed_width_column_wrapper<int32_t> expected_count({1, 1, 0, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_count);
+  }
+}
+
 TEST_F(StringsContainsTests, MatchesIPV4Test)
 {
   cudf::test::strings_column_wrapper strings({"5.79.97.178",
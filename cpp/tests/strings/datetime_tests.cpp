@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -155,6 +155,29 @@ TEST_F(StringsDatetimeTest, ToTimestampTimezone)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, is_expected);
 }
 
+TEST_F(StringsDatetimeTest, ToTimestampISOFormats)
+{
+  cudf::test::strings_column_wrapper strings({"2021-01-02T03:04:05.678Z",
+                                              "2021-01-02T03:04:0x.678Z",
+                                              "",
+                                              "1999-12-31T23:59:59.001Z"},
+                                             {1, 1, 0, 1});
+  auto const type   = cudf::data_type{cudf::type_id::TIMESTAMP_MILLISECONDS};
+  auto const format = std::string{"%Y-%m-%dT%H:%M:%S.%3fZ"};
+  auto const view   = cudf::strings_column_view(strings);
+  auto results      = cudf::strings::to_timestamps(view, type, format);
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep> expected(
+    {1609556645678, 1609556640678, 0, 946684799001}, {1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  cudf::test::strings_column_wrapper dates{"2020-02-29", "1969-12-31", "2020-2-29"};
+  results = cudf::strings::to_timestamps(
+    cudf::strings_column_view(dates), cudf::data_type{cudf::type_id::TIMESTAMP_DAYS}, "%Y-%m-%d");
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_D, cudf::timestamp_D::rep>
+    expected_dates{18321, -1, 18301};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_dates);
+}
+
 TEST_F(StringsDatetimeTest, FromTimestamp)
 {
   std::vector<cudf::timestamp_s::rep> h_timestamps{
@@ -18,6 +18,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/strings/string_view.cuh>
@@ -31,6 +32,7 @@
 #include <rmm/device_uvector.hpp>
 
 #include <thrust/execution_policy.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/transform.h>
 
 #include <cstring>
@@ -207,6 +209,31 @@ TEST_F(StringsFactoriesTest, CreateOffsets)
   }
 }
 
+TEST_F(StringsFactoriesTest, Int64OffsetsRejected)
+{
+  std::vector<char const*> h_strings{"the quick", "", "brown fox", nullptr, "jumps over"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  cudf::strings_column_view strings_view(strings);
+
+  auto offsets32 = cudf::test::to_host<cudf::size_type>(strings_view.offsets()).first;
+  std::vector<int64_t> h_offsets(offsets32.begin(), offsets32.end());
+  auto offsets_column = cudf::test::fixed_width_column_wrapper<int64_t>(h_offsets.begin(),
+                                                                        h_offsets.end())
+                          .release();
+  auto chars_column = std::make_unique<cudf::column>(strings_view.chars());
+
+  // The strings APIs read offsets as size_type, so INT64 offsets must not reach them
+  EXPECT_THROW(cudf::make_strings_column(strings_view.size(),
+                                         std::move(offsets_column),
+                                         std::move(chars_column),
+                                         strings_view.null_count(),
+                                         cudf::copy_bitmask(strings_view.parent())),
+               cudf::logic_error);
+}
+
 namespace {
 using string_pair = thrust::pair<char const*, cudf::size_type>;
 struct string_view_to_pair {
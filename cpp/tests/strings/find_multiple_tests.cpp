@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/strings/find_multiple.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -51,6 +52,48 @@ TEST_F(StringsFindMultipleTest, FindMultiple)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsFindMultipleTest, OverlappingTargets)
+{
+  cudf::test::strings_column_wrapper strings({"ushers", "she", "hishe", "", "his"});
+  cudf::test::strings_column_wrapper targets({"he", "she", "his", "hers", ""});
+  auto results = cudf::strings::find_multiple(cudf::strings_column_view(strings),
+                                              cudf::strings_column_view(targets));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({2,  1,  -1, 2,  0,    // ushers
+                                                            1,  0,  -1, -1, 0,    // she
+                                                            3,  2,  0,  -1, 0,    // hishe
+                                                            -1, -1, -1, -1, 0,    // ""
+                                                            -1, -1, 0,  -1, 0});  // his
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(StringsFindMultipleTest, ContainsMultiple)
+{
+  std::vector<const char*> h_strings{"Héllo", "thesé", nullptr, "lease", "test strings", ""};
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity);
+  auto strings_view = cudf::strings_column_view(strings);
+  cudf::test::strings_column_wrapper targets({"é", "es", "strings", "x"});
+
+  auto results = cudf::strings::contains_multiple(strings_view, cudf::strings_column_view(targets));
+  ASSERT_EQ(results->num_columns(), 4);
+  using bools = cudf::test::fixed_width_column_wrapper<bool>;
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), bools({1, 1, 0, 0, 0, 0}, validity));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1), bools({0, 1, 0, 0, 1, 0}, validity));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(2), bools({0, 0, 0, 0, 1, 0}, validity));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(3), bools({0, 0, 0, 0, 0, 0}, validity));
+}
+
+TEST_F(StringsFindMultipleTest, FindFirstTarget)
+{
+  cudf::test::strings_column_wrapper strings({"abc", "def", "xyz", "", "cab"}, {1, 1, 1, 1, 0});
+  cudf::test::strings_column_wrapper targets({"e", "c", "ab"});
+  auto results = cudf::strings::find_first_target(cudf::strings_column_view(strings),
+                                                  cudf::strings_column_view(targets));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 0, -1, -1, 0}, {1, 1, 1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
 TEST_F(StringsFindMultipleTest, ZeroSizeStringsColumn)
 {
   cudf::column_view zero_size_strings_column(
@@ -77,4 +120,6 @@ TEST_F(StringsFindMultipleTest, ErrorTest)
 
   // targets cannot have nulls
   EXPECT_THROW(cudf::strings::find_multiple(strings_view, strings_view), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::contains_multiple(strings_view, empty_view), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::find_first_target(strings_view, strings_view), cudf::logic_error);
 }
@@ -80,6 +80,39 @@ TEST_F(StringsFindTest, Contains)
   }
 }
 
+TEST_F(StringsFindTest, LongStrings)
+{
+  // long enough on average to be searched by a warp per string
+  std::string const padding(100, 'a');
+  cudf::test::strings_column_wrapper strings(
+    {padding + "é" + padding + "thé end",
+     "thé start" + padding + padding,
+     padding + "thé" + padding + "thé" + padding,
+     "",
+     padding + "thx" + padding,
+     padding},
+    {1, 1, 1, 1, 1, 0});
+  auto strings_view = cudf::strings_column_view(strings);
+  auto const target = cudf::string_scalar("thé");
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({201, 0, 100, -1, -1, -1},
+                                                             {1, 1, 1, 1, 1, 0});
+    auto results = cudf::strings::find(strings_view, target);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({201, 0, 203, -1, -1, -1},
+                                                             {1, 1, 1, 1, 1, 0});
+    auto results = cudf::strings::rfind(strings_view, target);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 1, 1, 0, 0, 0}, {1, 1, 1, 1, 1, 0});
+    auto results = cudf::strings::contains(strings_view, target);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
 TEST_F(StringsFindTest, StartsWith)
 {
   cudf::test::strings_column_wrapper strings({"Héllo", "thesé", "", "lease", "tést strings", ""},
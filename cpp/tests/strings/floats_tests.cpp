@@ -114,7 +114,7 @@ TEST_F(StringsConvertTest, FromFloats32)
                               839542223232.79,
                               -0.0};
   std::vector<const char*> h_expected{
-    "100.0", "654321.25", "-12761.125", "0.0", "5.0", "-4.0", "NaN", "8.395422433e+11", "-0.0"};
+    "100.0", "654321.25", "-12761.125", "0.0", "5.0", "-4.0", "NaN", "8.3954224e+11", "-0.0"};
 
   cudf::test::fixed_width_column_wrapper<float> floats(
     h_floats.begin(),
@@ -182,8 +182,15 @@ TEST_F(StringsConvertTest, FromFloats64)
                                std::numeric_limits<double>::quiet_NaN(),
                                839542223232.794248339,
                                -0.0};
-  std::vector<const char*> h_expected{
-    "100.0", "654321.25", "-12761.125", "0.0", "5.0", "-4.0", "NaN", "8.395422232e+11", "-0.0"};
+  std::vector<const char*> h_expected{"100.0",
+                                      "654321.25",
+                                      "-12761.125",
+                                      "0.0",
+                                      "5.0",
+                                      "-4.0",
+                                      "NaN",
+                                      "8.395422232327942e+11",
+                                      "-0.0"};
 
   cudf::test::fixed_width_column_wrapper<double> floats(
     h_floats.begin(),
@@ -200,6 +207,37 @@ TEST_F(StringsConvertTest, FromFloats64)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected, true);
 }
 
+TEST_F(StringsConvertTest, FromFloatsShortest)
+{
+  cudf::test::fixed_width_column_wrapper<double> doubles{0.1,
+                                                         0.3,
+                                                         1.0e-4,
+                                                         1.5e-5,
+                                                         123456789.0,
+                                                         1.0e22,
+                                                         5e-324,
+                                                         1.7976931348623157e308,
+                                                         -std::numeric_limits<double>::infinity()};
+  cudf::test::strings_column_wrapper expected_doubles{"0.1",
+                                                      "0.3",
+                                                      "0.0001",
+                                                      "1.5e-05",
+                                                      "123456789.0",
+                                                      "1.0e+22",
+                                                      "5.0e-324",
+                                                      "1.7976931348623157e+308",
+                                                      "-Inf"};
+  auto results = cudf::strings::from_floats(doubles);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_doubles);
+
+  cudf::test::fixed_width_column_wrapper<float> floats{
+    0.1f, 1.0e-45f, 3.4028235e38f, 1.17549435e-38f, 0.333333343f};
+  cudf::test::strings_column_wrapper expected_floats{
+    "0.1", "1.0e-45", "3.4028235e+38", "1.1754944e-38", "0.33333334"};
+  results = cudf::strings::from_floats(floats);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_floats);
+}
+
 TEST_F(StringsConvertTest, ZeroSizeStringsColumnFloat)
 {
   cudf::column_view zero_size_column(
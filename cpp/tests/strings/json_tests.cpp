@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/strings/json.hpp>
 #include <cudf/strings/replace.hpp>
@@ -759,3 +760,47 @@ TEST_F(JsonTests, MixedOutput)
     CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*result, expected);
   }
 }
+
+TEST_F(JsonTests, GetJsonObjectMultiplePaths)
+{
+  // clang-format off
+  std::vector<std::string> input_strings {
+    json_string,
+    "{\"a\": {\"b\" : \"c\"}, \"d\": [{\"e\":123}, {\"f\":-10}]}",
+    "{\"d\": 1, \"a\": [\"y\",500], \"d\": 2}",
+    "[1, 2, {\"a\": 3}]",
+    "{}",
+    ""
+  };
+  // clang-format on
+  cudf::test::strings_column_wrapper input(
+    input_strings.begin(), input_strings.end(), {1, 1, 1, 1, 1, 0});
+
+  std::vector<std::string> paths{"$.store.bicycle",
+                                 "$.store.book[0].author",
+                                 "$",
+                                 "$.missing",
+                                 "$.a.b",
+                                 "$.d",
+                                 "$.d[*].e",
+                                 "$[*]",
+                                 "$.*",
+                                 "$[2].a",
+                                 ""};
+  std::vector<cudf::string_scalar> json_paths(paths.begin(), paths.end());
+  auto results = cudf::strings::get_json_object(cudf::strings_column_view(input), json_paths);
+  ASSERT_EQ(results.size(), paths.size());
+
+  for (std::size_t i = 0; i < paths.size(); ++i) {
+    auto expected =
+      cudf::strings::get_json_object(cudf::strings_column_view(input), json_paths[i]);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results[i], *expected);
+  }
+
+  auto empty = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
+  results    = cudf::strings::get_json_object(cudf::strings_column_view(*empty), json_paths);
+  ASSERT_EQ(results.size(), paths.size());
+  for (auto const& result : results) {
+    EXPECT_EQ(result->size(), 0);
+  }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,6 +15,7 @@
  */
 
 #include <tests/strings/utilities.h>
+#include <cudf/copying.hpp>
 #include <cudf/strings/replace_re.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf_test/base_fixture.hpp>
@@ -59,6 +60,53 @@ TEST_F(StringsReplaceTests, ReplaceRegexTest)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsReplaceTests, RemoveRegexTest)
+{
+  std::vector<const char*> h_strings{"the quick brown fox jumps over the lazy dog",
+                                     "the fat cat lays next to the other accénted cat",
+                                     "a slow moving turtlé cannot catch the bird",
+                                     "",
+                                     nullptr,
+                                     "thé result does not include the value in the sum in"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+
+  std::vector<const char*> h_expected{" quick brown fox jumps over  lazy dog",
+                                      " fat cat lays next to  other accénted cat",
+                                      "a slow moving turtlé cannot catch  bird",
+                                      "",
+                                      nullptr,
+                                      "thé result does not include  value in  sum in"};
+  cudf::test::strings_column_wrapper expected(
+    h_expected.begin(),
+    h_expected.end(),
+    thrust::make_transform_iterator(h_expected.begin(), [](auto str) { return str != nullptr; }));
+
+  auto results = cudf::strings::replace_re(cudf::strings_column_view(strings), "\\bthe\\b");
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  auto sliced = cudf::slice(strings, {1, 5}).front();
+  results     = cudf::strings::replace_re(cudf::strings_column_view(sliced), "\\bthe\\b");
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, cudf::slice(expected, {1, 5}).front());
+
+  results = cudf::strings::replace_re(
+    cudf::strings_column_view(strings), "the", cudf::string_scalar(""), 1);
+  std::vector<const char*> h_expected_one{" quick brown fox jumps over the lazy dog",
+                                          " fat cat lays next to the other accénted cat",
+                                          "a slow moving turtlé cannot catch  bird",
+                                          "",
+                                          nullptr,
+                                          "thé result does not include  value in the sum in"};
+  cudf::test::strings_column_wrapper expected_one(
+    h_expected_one.begin(),
+    h_expected_one.end(),
+    thrust::make_transform_iterator(h_expected_one.begin(),
+                                    [](auto str) { return str != nullptr; }));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_one);
+}
+
 TEST_F(StringsReplaceTests, ReplaceMultiRegexTest)
 {
   std::vector<const char*> h_strings{"the quick brown fox jumps over the lazy dog",
@@ -95,6 +143,20 @@ TEST_F(StringsReplaceTests, ReplaceMultiRegexTest)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsReplaceTests, ReplaceMultiRegexOverlapTest)
+{
+  cudf::test::strings_column_wrapper strings({"abcdef", "xyz", "zyx", "bcdbcd"});
+  auto strings_view = cudf::strings_column_view(strings);
+
+  // the earliest match is replaced and the first pattern wins a tie
+  std::vector<std::string> patterns{"cd", "bcd", "de", "f$", "x", "xy"};
+  cudf::test::strings_column_wrapper repls({"1", "2", "3", "4", "5", "6"});
+  auto repls_view = cudf::strings_column_view(repls);
+  auto results    = cudf::strings::replace_re(strings_view, patterns, repls_view);
+  cudf::test::strings_column_wrapper expected({"a2e4", "5yz", "zy5", "22"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
 TEST_F(StringsReplaceTests, InvalidRegex)
 {
   cudf::test::strings_column_wrapper strings(
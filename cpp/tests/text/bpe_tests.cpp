@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <nvtext/bpe_tokenize.hpp>
+
+#include <thrust/iterator/transform_iterator.h>
+
+#include <fstream>
+#include <vector>
+
+namespace {
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+struct TextBPETokenizeTest : public cudf::test::BaseFixture {
+};
+
+// Create a fake hashed vocab text file for the tests in this source file.
+// The vocab only includes the following words:
+//  'this', 'is', 'a', 'test', 'tést'
+// The period '.' character also has a token id and the unknown token id is 100.
+void create_hashed_vocab(std::string const& hash_file)
+{
+  std::vector<std::pair<int, int>> coefficients(23, {65559, 0});
+  std::ofstream outfile(hash_file, std::ofstream::out);
+  outfile << "1\n0\n" << coefficients.size() << "\n";
+  for (auto c : coefficients) outfile << c.first << " " << c.second << "\n";
+  std::vector<uint64_t> hash_table(23, 0);
+  outfile << hash_table.size() << "\n";
+  hash_table[0]  = 3015668L;              // based on values
+  hash_table[1]  = 6205475701751155871L;  // from the
+  hash_table[5]  = 6358029;               // bert_hash_table.txt
+  hash_table[16] = 451412625363L;         // file for the test
+  hash_table[20] = 6206321707968235495L;  // words above
+  for (auto h : hash_table) outfile << h << "\n";
+  outfile << "100\n101\n102\n\n";
+}
+
+void create_merge_pairs(std::string const& merges_file)
+{
+  std::ofstream outfile(merges_file, std::ofstream::out);
+  outfile << "#version: 0.2\n";
+  outfile << "t h\nth i\nthi s\ni s\nt e\nte s\ntes t\n";
+}
+}  // namespace
+
+TEST_F(TextBPETokenizeTest, Tokenize)
+{
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+  std::string merges_file = temp_env->get_temp_filepath("merges.txt");
+  create_merge_pairs(merges_file);
+
+  std::vector<const char*> h_strings{"this is a test.", "the dog", nullptr, "", "  is  "};
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity);
+
+  auto vocab       = nvtext::load_vocabulary_file(hash_file);
+  auto merge_pairs = nvtext::load_merge_pairs_file(merges_file);
+  auto results =
+    nvtext::byte_pair_encoding(cudf::strings_column_view(strings), *merge_pairs, *vocab);
+
+  // 'th', 'e' and the letters of 'dog' are not in the vocab
+  using LCW = cudf::test::lists_column_wrapper<uint32_t>;
+  LCW expected({LCW{2023, 2003, 1037, 3231, 1012},
+                LCW{100, 100, 100, 100, 100},
+                LCW{},
+                LCW{},
+                LCW{2003}},
+               validity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected);
+}
+
+TEST_F(TextBPETokenizeTest, EmptyInput)
+{
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+  std::string merges_file = temp_env->get_temp_filepath("merges.txt");
+  create_merge_pairs(merges_file);
+
+  auto vocab       = nvtext::load_vocabulary_file(hash_file);
+  auto merge_pairs = nvtext::load_merge_pairs_file(merges_file);
+  auto strings     = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
+  auto results =
+    nvtext::byte_pair_encoding(cudf::strings_column_view(strings->view()), *merge_pairs, *vocab);
+  EXPECT_EQ(0, results->size());
+}
+
+TEST_F(TextBPETokenizeTest, LoadMergesFileErrors)
+{
+  std::string merges_file = temp_env->get_temp_filepath("nothing.txt");
+  EXPECT_THROW(nvtext::load_merge_pairs_file(merges_file), cudf::logic_error);
+}
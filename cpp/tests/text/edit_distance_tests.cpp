@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,6 +22,7 @@
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 
+#include <string>
 #include <vector>
 
 struct TextEditDistanceTest : public cudf::test::BaseFixture {
@@ -79,6 +80,58 @@ TEST_F(TextEditDistanceTest, EditDistanceMatrix)
   }
 }
 
+TEST_F(TextEditDistanceTest, EditDistanceMaxDistance)
+{
+  std::vector<const char*> h_strings{"dog", nullptr, "cat", "mouse", "pup", "", "puppy", "thé"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+
+  std::vector<const char*> h_targets{"hog", "not", "cake", "house", "fox", nullptr, "puppy", "the"};
+  cudf::test::strings_column_wrapper targets(
+    h_targets.begin(),
+    h_targets.end(),
+    thrust::make_transform_iterator(h_targets.begin(), [](auto str) { return str != nullptr; }));
+
+  auto results = nvtext::edit_distance(
+    cudf::strings_column_view(strings), cudf::strings_column_view(targets), 1);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 2, 2, 1, 2, 0, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  results = nvtext::edit_distance_matrix(cudf::strings_column_view(strings), 2);
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+  LCW expected_matrix({LCW{0, 3, 3, 3, 3, 3, 3, 3},
+                       LCW{3, 0, 3, 3, 3, 0, 3, 3},
+                       LCW{3, 3, 0, 3, 3, 3, 3, 3},
+                       LCW{3, 3, 3, 0, 3, 3, 3, 3},
+                       LCW{3, 3, 3, 3, 0, 3, 2, 3},
+                       LCW{3, 0, 3, 3, 3, 0, 3, 3},
+                       LCW{3, 3, 3, 3, 2, 3, 0, 3},
+                       LCW{3, 3, 3, 3, 3, 3, 3, 0}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_matrix);
+}
+
+TEST_F(TextEditDistanceTest, EditDistanceLongStrings)
+{
+  // strings longer than the thread-local computation supports use a temporary buffer
+  std::string const long_str(100, 'a');
+  std::string const other_str = std::string(40, 'a') + "bb" + std::string(38, 'a');
+  std::string const short_str = std::string(10, 'a') + "é";
+  cudf::test::strings_column_wrapper strings({long_str, long_str, long_str});
+  cudf::test::strings_column_wrapper targets({long_str, other_str, short_str});
+
+  auto results =
+    nvtext::edit_distance(cudf::strings_column_view(strings), cudf::strings_column_view(targets));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({0, 22, 90});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  results = nvtext::edit_distance(
+    cudf::strings_column_view(strings), cudf::strings_column_view(targets), 25);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_max({0, 22, 26});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_max);
+}
+
 TEST_F(TextEditDistanceTest, EmptyTest)
 {
   auto strings = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
@@ -97,4 +150,7 @@ TEST_F(TextEditDistanceTest, ErrorsTest)
     nvtext::edit_distance(cudf::strings_column_view(strings), cudf::strings_column_view(targets)),
     cudf::logic_error);
   EXPECT_THROW(nvtext::edit_distance_matrix(cudf::strings_column_view(strings)), cudf::logic_error);
+  EXPECT_THROW(nvtext::edit_distance(
+                 cudf::strings_column_view(strings), cudf::strings_column_view(strings), -1),
+               cudf::logic_error);
 }
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <nvtext/minhash.hpp>
+
+#include <thrust/iterator/transform_iterator.h>
+
+#include <vector>
+
+struct TextMinHashTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(TextMinHashTest, CharacterNgrams)
+{
+  std::vector<const char*> h_strings{"doc", "this is my", nullptr, "", "héllo wörld"};
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity);
+  cudf::test::fixed_width_column_wrapper<uint32_t> seeds({0, 1, 42});
+
+  auto results = nvtext::minhash(cudf::strings_column_view(strings), seeds, 4);
+
+  using LCW = cudf::test::lists_column_wrapper<uint32_t>;
+  // clang-format off
+  LCW expected({LCW{3584054563, 1341020699, 1790212845},
+                LCW{  21141582,  403093213,  786673628},
+                LCW{},
+                LCW{         0, 1364076727,  142593372},
+                LCW{ 152688934,  620638934,  839694664}},
+               validity);
+  // clang-format on
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected);
+}
+
+TEST_F(TextMinHashTest, WordNgrams)
+{
+  cudf::test::strings_column_wrapper strings({"the quick brown fox", "  fox  ", ""});
+  cudf::test::fixed_width_column_wrapper<uint32_t> seeds({0, 1, 42});
+
+  auto results = nvtext::word_minhash(cudf::strings_column_view(strings), seeds, 2);
+
+  using LCW = cudf::test::lists_column_wrapper<uint32_t>;
+  // clang-format off
+  LCW expected({LCW{ 170037781, 2235656572,  455600068},
+                LCW{2673099881, 4205380189, 1355380193},
+                LCW{         0, 1364076727,  142593372}});
+  // clang-format on
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected);
+}
+
+TEST_F(TextMinHashTest, EmptyInput)
+{
+  auto strings = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
+  cudf::test::fixed_width_column_wrapper<uint32_t> seeds({0});
+  auto results = nvtext::minhash(cudf::strings_column_view(strings->view()), seeds);
+  EXPECT_EQ(0, results->size());
+}
+
+TEST_F(TextMinHashTest, Errors)
+{
+  cudf::test::strings_column_wrapper strings({"this string"});
+  cudf::test::fixed_width_column_wrapper<uint32_t> seeds({0});
+  cudf::test::fixed_width_column_wrapper<uint32_t> no_seeds{};
+  cudf::test::fixed_width_column_wrapper<int32_t> int_seeds({0});
+  EXPECT_THROW(nvtext::minhash(cudf::strings_column_view(strings), seeds, 0), cudf::logic_error);
+  EXPECT_THROW(nvtext::minhash(cudf::strings_column_view(strings), no_seeds), cudf::logic_error);
+  EXPECT_THROW(nvtext::minhash(cudf::strings_column_view(strings), int_seeds), cudf::logic_error);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,10 +17,12 @@
 #include <tests/strings/utilities.h>
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
 
 #include <nvtext/generate_ngrams.hpp>
 
@@ -98,6 +100,39 @@ TEST_F(TextGenerateNgramsTest, NgramsWithNulls)
   }
 }
 
+TEST_F(TextGenerateNgramsTest, HashCharacterNgrams)
+{
+  std::vector<const char*> h_strings{"the quick", "héllo", "", nullptr, "fox"};
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity);
+
+  auto const results = nvtext::hash_character_ngrams(cudf::strings_column_view(strings));
+  using LCW          = cudf::test::lists_column_wrapper<uint32_t>;
+  LCW expected({LCW{2169381797, 3924065905, 1634753325, 3766025829, 771291085},
+                LCW{3164577896},
+                LCW{},
+                LCW{},
+                LCW{}},
+               validity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected);
+}
+
+TEST_F(TextGenerateNgramsTest, CountCharacterNgrams)
+{
+  cudf::test::strings_column_wrapper strings({"abab", "ba", "a"});
+  auto const results = nvtext::count_character_ngrams(cudf::strings_column_view(strings), 2);
+  // the hashes of "ab" and "ba"
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_hashes({2613040991, 3853534966});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_counts({2, 2});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::sort(results->view())->view(),
+                                cudf::table_view({expected_hashes, expected_counts}));
+
+  // no ngrams
+  auto const empty = nvtext::count_character_ngrams(cudf::strings_column_view(strings), 5);
+  EXPECT_EQ(0, empty->num_rows());
+}
+
 TEST_F(TextGenerateNgramsTest, Empty)
 {
   cudf::column_view zero_size_strings_column(
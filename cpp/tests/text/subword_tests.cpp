@@ -15,7 +15,9 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
 #include <cudf_test/base_fixture.hpp>
@@ -255,6 +257,72 @@ TEST(TextSubwordTest, TokenizeFromVocabStruct)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_metadata->view(), expected_metadata);
 }
 
+TEST(TextSubwordTest, TokenizeIntoPreallocatedColumns)
+{
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+  auto vocab = nvtext::load_vocabulary_file(hash_file);
+
+  uint32_t const max_sequence_length = 8;
+  uint32_t const max_rows            = 4;
+  auto tensor_token_ids = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                                    max_rows * max_sequence_length);
+  auto tensor_attention_mask = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                                         max_rows * max_sequence_length);
+  auto tensor_metadata =
+    cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32}, max_rows * 3);
+  auto token_ids_view = tensor_token_ids->mutable_view();
+  auto attn_view      = tensor_attention_mask->mutable_view();
+  auto metadata_view  = tensor_metadata->mutable_view();
+
+  // each batch reuses the same vocabulary and output columns
+  std::vector<std::vector<const char*>> batches{
+    {"This is a test.", "This is a test. This is a tést."}, {"this is", "", "A TEST."}};
+  for (auto const& h_strings : batches) {
+    cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+    auto const expected = nvtext::subword_tokenize(cudf::strings_column_view{strings},
+                                                   *vocab,
+                                                   max_sequence_length,
+                                                   6,
+                                                   true,   // do_lower_case
+                                                   false,  // do_truncate
+                                                   max_rows);
+
+    auto const nrows = nvtext::subword_tokenize(cudf::strings_column_view{strings},
+                                                *vocab,
+                                                max_sequence_length,
+                                                6,
+                                                true,   // do_lower_case
+                                                false,  // do_truncate
+                                                token_ids_view,
+                                                attn_view,
+                                                metadata_view);
+    EXPECT_EQ(expected.nrows_tensor, nrows);
+    auto const size = static_cast<cudf::size_type>(nrows * max_sequence_length);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::slice(token_ids_view, {0, size}).front(),
+                                   expected.tensor_token_ids->view());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::slice(attn_view, {0, size}).front(),
+                                   expected.tensor_attention_mask->view());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+      cudf::slice(metadata_view, {0, static_cast<cudf::size_type>(nrows * 3)}).front(),
+      expected.tensor_metadata->view());
+  }
+
+  // more rows than the output columns hold
+  std::vector<const char*> h_strings{"a", "b", "c", "d", "e"};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  EXPECT_THROW(nvtext::subword_tokenize(cudf::strings_column_view{strings},
+                                        *vocab,
+                                        max_sequence_length,
+                                        6,
+                                        true,
+                                        false,
+                                        token_ids_view,
+                                        attn_view,
+                                        metadata_view),
+               cudf::logic_error);
+}
+
 TEST(TextSubwordTest, LoadVocabFileErrors)
 {
   std::vector<const char*> h_strings{"This is a test.", "This is a test. This is a tést."};
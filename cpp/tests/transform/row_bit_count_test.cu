@@ -25,6 +25,8 @@
 
 #include <rmm/exec_policy.hpp>
 
+#include <vector>
+
 using namespace cudf;
 
 template <typename T>
@@ -591,4 +593,30 @@ TEST_F(RowBitCount, EmptyTable)
     auto result = cudf::row_bit_count(empty);
     CUDF_EXPECTS(result != nullptr && result->size() == 0, "Expected an empty column");
   }
-}
\ No newline at end of file
+}
+TEST_F(RowBitCount, SplitBySize)
+{
+  // 4 bytes per row
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{1, 2, 3, 4, 5};
+  cudf::table_view t({ints});
+
+  EXPECT_EQ(std::vector<size_type>({2, 4}), cudf::split_by_size(t, 8));
+  EXPECT_EQ(std::vector<size_type>({2, 4}), cudf::split_by_size(t, 11));
+  EXPECT_TRUE(cudf::split_by_size(t, 20).empty());
+
+  // a row larger than the budget is a batch on its own
+  EXPECT_EQ(std::vector<size_type>({1, 2, 3, 4}), cudf::split_by_size(t, 1));
+
+  EXPECT_TRUE(cudf::split_by_size(cudf::table_view{}, 8).empty());
+  EXPECT_THROW(cudf::split_by_size(t, 0), cudf::logic_error);
+}
+
+TEST_F(RowBitCount, SplitBySizeStrings)
+{
+  // 4 bytes of offset + the characters per row
+  cudf::test::strings_column_wrapper strings{"a", "bbbb", "cc", "dddddddd", "e"};
+  cudf::table_view t({strings});
+
+  // row sizes are 5, 8, 6, 12 and 5 bytes
+  EXPECT_EQ(std::vector<size_type>({2, 3, 4}), cudf::split_by_size(t, 13));
+}
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/row_conversion.hpp>
+#include <cudf/row_conversion.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <numeric>
+
+namespace {
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+std::vector<cudf::data_type> schema_of(cudf::table_view const& input)
+{
+  std::vector<cudf::data_type> schema;
+  std::transform(input.begin(), input.end(), std::back_inserter(schema), [](auto const& col) {
+    return col.type();
+  });
+  return schema;
+}
+
+std::unique_ptr<cudf::table> round_trip(std::vector<std::unique_ptr<cudf::column>> const& rows,
+                                        std::vector<cudf::data_type> const& schema)
+{
+  std::vector<std::unique_ptr<cudf::table>> tables;
+  std::vector<cudf::table_view> views;
+  for (auto const& batch : rows) {
+    tables.push_back(cudf::convert_from_rows(cudf::lists_column_view(*batch), schema));
+    views.push_back(tables.back()->view());
+  }
+  return cudf::concatenate(views);
+}
+}  // namespace
+
+struct RowConversionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(RowConversionTest, FixedWidthLayout)
+{
+  fixed_width_column_wrapper<int8_t> col0({1, 2});
+  fixed_width_column_wrapper<int32_t> col1({3, 4}, {1, 0});
+  cudf::table_view input({col0, col1});
+
+  auto rows = cudf::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1u);
+  cudf::lists_column_view batch(*rows.front());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(batch.offsets(), fixed_width_column_wrapper<int32_t>({0, 16, 32}));
+
+  // the validity bytes follow the INT8 value at 0 and the INT32 value at 4
+  auto const validity0 = cudf::test::to_host<int8_t>(cudf::slice(batch.child(), {8, 9})[0]).first;
+  auto const validity1 = cudf::test::to_host<int8_t>(cudf::slice(batch.child(), {24, 25})[0]).first;
+  EXPECT_EQ(validity0.front(), 3);
+  EXPECT_EQ(validity1.front(), 1);
+}
+
+TEST_F(RowConversionTest, FixedWidthRoundTrip)
+{
+  fixed_width_column_wrapper<bool> col0({true, false, true, true, false}, {1, 1, 0, 1, 1});
+  fixed_width_column_wrapper<int16_t> col1({1, 2, 3, 4, 5});
+  fixed_width_column_wrapper<int64_t> col2({10, 20, 30, 40, 50}, {0, 1, 1, 1, 0});
+  fixed_width_column_wrapper<double> col3({1.5, 2.5, 3.5, 4.5, 5.5});
+  fixed_width_column_wrapper<cudf::timestamp_D, cudf::timestamp_D::rep> col4({1, 2, 3, 4, 5});
+  cudf::table_view input({col0, col1, col2, col3, col4});
+
+  auto rows = cudf::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1u);
+  EXPECT_EQ(rows.front()->size(), 5);
+  auto result = round_trip(rows, schema_of(input));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, *result);
+}
+
+TEST_F(RowConversionTest, StringsRoundTrip)
+{
+  fixed_width_column_wrapper<int32_t> col0({1, 2, 3, 4}, {1, 0, 1, 1});
+  strings_column_wrapper col1({"a", "", "ccc", "this is a longer string"}, {1, 1, 0, 1});
+  fixed_width_column_wrapper<int8_t> col2({5, 6, 7, 8});
+  strings_column_wrapper col3({"", "bb", "dddd", "e"});
+  cudf::table_view input({col0, col1, col2, col3});
+
+  auto rows = cudf::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1u);
+  // 32 fixed width bytes per row, followed by the characters padded to 8 bytes
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::lists_column_view(*rows.front()).offsets(),
+                                 fixed_width_column_wrapper<int32_t>({0, 40, 80, 120, 176}));
+  auto result = round_trip(rows, schema_of(input));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, *result);
+}
+
+TEST_F(RowConversionTest, Batches)
+{
+  std::vector<int32_t> values(100);
+  std::iota(values.begin(), values.end(), 0);
+  fixed_width_column_wrapper<int32_t> col0(values.begin(), values.end());
+  std::vector<std::string> strings(100, "abcdefghijklmnop");
+  strings_column_wrapper col1(strings.begin(), strings.end());
+
+  cudf::table_view fixed_width({col0});
+  auto rows = cudf::detail::convert_to_rows(fixed_width, 256);
+  EXPECT_EQ(rows.size(), 4u);
+  EXPECT_EQ(rows.front()->size(), 32);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(fixed_width, *round_trip(rows, schema_of(fixed_width)));
+
+  cudf::table_view with_strings({col0, col1});
+  rows = cudf::detail::convert_to_rows(with_strings, 256);
+  EXPECT_EQ(rows.size(), 13u);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(with_strings, *round_trip(rows, schema_of(with_strings)));
+
+  EXPECT_THROW(cudf::detail::convert_to_rows(with_strings, 16), cudf::logic_error);
+}
+
+TEST_F(RowConversionTest, WideRows)
+{
+  // rows too large for a warp of them to fit in shared memory
+  std::vector<fixed_width_column_wrapper<int64_t>> wrappers;
+  wrappers.reserve(200);
+  for (int i = 0; i < 200; ++i) {
+    wrappers.emplace_back(std::initializer_list<int64_t>{i, i + 1, i + 2});
+  }
+  std::vector<cudf::column_view> columns(wrappers.begin(), wrappers.end());
+  cudf::table_view input(columns);
+
+  auto rows = cudf::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1u);
+  auto result = round_trip(rows, schema_of(input));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, *result);
+}
+
+TEST_F(RowConversionTest, Sliced)
+{
+  fixed_width_column_wrapper<int32_t> col0({1, 2, 3, 4, 5}, {1, 0, 1, 1, 0});
+  strings_column_wrapper col1({"a", "bb", "ccc", "dddd", "eeeee"}, {0, 1, 1, 0, 1});
+  auto const fixed_width  = cudf::slice(cudf::table_view{{col0}}, {1, 4})[0];
+  auto const with_strings = cudf::slice(cudf::table_view{{col0, col1}}, {1, 4})[0];
+
+  auto rows = cudf::convert_to_rows(fixed_width);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(fixed_width, *round_trip(rows, schema_of(fixed_width)));
+  rows = cudf::convert_to_rows(with_strings);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(with_strings, *round_trip(rows, schema_of(with_strings)));
+}
+
+TEST_F(RowConversionTest, Empty)
+{
+  fixed_width_column_wrapper<int32_t> col0{};
+  strings_column_wrapper col1{};
+  cudf::table_view input({col0, col1});
+
+  auto rows = cudf::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1u);
+  EXPECT_EQ(rows.front()->size(), 0);
+  auto result = round_trip(rows, schema_of(input));
+  EXPECT_EQ(result->num_rows(), 0);
+}
+
+TEST_F(RowConversionTest, UnsupportedType)
+{
+  cudf::test::lists_column_wrapper<int32_t> col0{{1, 2}, {3}};
+  EXPECT_THROW(cudf::convert_to_rows(cudf::table_view{{col0}}), cudf::logic_error);
+  EXPECT_THROW(cudf::convert_to_rows(cudf::table_view{}), cudf::logic_error);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/copying.hpp>
 #include <cudf/transpose.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -178,6 +179,37 @@ TYPED_TEST(TransposeTest, EmptyTable) { run_test<TypeParam>(0, 0, false); }
 
 TYPED_TEST(TransposeTest, EmptyColumns) { run_test<TypeParam>(10, 0, false); }
 
+TYPED_TEST(TransposeTest, SlicedNulls)
+{
+  // the sliced columns start in the middle of their null mask words
+  constexpr size_t ncols = 40;
+  constexpr size_t nrows = 70;
+  std::mt19937 rng(1);
+  auto const values = generate_vectors<TypeParam>(
+    ncols, nrows, [&rng]() { return cudf::test::make_type_param_scalar<TypeParam>(rng()); });
+  auto const valids = generate_vectors<cudf::size_type>(
+    ncols, nrows, [&rng]() { return static_cast<cudf::size_type>(rng() % 3 > 0 ? 1 : 0); });
+  auto const input_cols = make_columns(values, valids);
+
+  std::vector<cudf::column_view> sliced;
+  std::vector<std::vector<TypeParam>> sliced_values;
+  std::vector<std::vector<cudf::size_type>> sliced_valids;
+  for (size_t col = 0; col < ncols; ++col) {
+    sliced.push_back(cudf::slice(input_cols[col], {5, 65}).front());
+    sliced_values.emplace_back(values[col].begin() + 5, values[col].begin() + 65);
+    sliced_valids.emplace_back(valids[col].begin() + 5, valids[col].begin() + 65);
+  }
+  auto const expected_cols =
+    make_columns(transpose_vectors(sliced_values), transpose_vectors(sliced_valids));
+
+  auto const result      = cudf::transpose(cudf::table_view(sliced));
+  auto const result_view = std::get<1>(result);
+  ASSERT_EQ(result_view.num_columns(), static_cast<cudf::size_type>(expected_cols.size()));
+  for (cudf::size_type i = 0; i < result_view.num_columns(); ++i) {
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(result_view.column(i), expected_cols[i]);
+  }
+}
+
 TYPED_TEST(TransposeTest, MismatchedColumns)
 {
   fixed_width_column_wrapper<TypeParam, int32_t> col1({1, 2, 3});
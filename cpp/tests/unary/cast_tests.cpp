@@ -19,6 +19,7 @@
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
@@ -531,6 +532,28 @@ TYPED_TEST(CastFromDurations, WithNulls)
   validate_cast_result<T, T>(durations_ns_exp, *durations_ns_got);
 }
 
+struct CastIntoPreallocated : public cudf::test::BaseFixture {
+};
+
+TEST_F(CastIntoPreallocated, NumericWithNulls)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input({1, -2, 3, -4, 5}, {1, 0, 1, 1, 0});
+  cudf::test::fixed_width_column_wrapper<double> expected({1., -2., 3., -4., 5.}, {1, 0, 1, 1, 0});
+
+  auto const type = cudf::data_type{cudf::type_id::FLOAT64};
+  auto out        = cudf::make_fixed_width_column(type, 5, cudf::mask_state::UNINITIALIZED);
+  auto out_view   = out->mutable_view();
+  cudf::cast(input, out_view);
+
+  EXPECT_EQ(2, out_view.null_count());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, out_view);
+
+  // the output must have a null mask since the input has nulls
+  auto not_nullable      = cudf::make_fixed_width_column(type, 5);
+  auto not_nullable_view = not_nullable->mutable_view();
+  EXPECT_THROW(cudf::cast(input, not_nullable_view), cudf::logic_error);
+}
+
 template <typename T>
 inline auto make_fixed_point_data_type(int32_t scale)
 {
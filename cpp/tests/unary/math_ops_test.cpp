@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/dictionary/encode.hpp>
 #include <cudf/unary.hpp>
@@ -423,6 +424,20 @@ TYPED_TEST(UnaryMathFloatOpsTest, SimpleCBRT)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, output->view());
 }
 
+TYPED_TEST(UnaryMathFloatOpsTest, SimpleSQRTIntoPreallocated)
+{
+  cudf::test::fixed_width_column_wrapper<TypeParam> input{{1, 4, 9, 16}, {1, 1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<TypeParam> expected{{1, 2, 3, 4}, {1, 1, 0, 1}};
+
+  auto out = cudf::make_fixed_width_column(
+    cudf::data_type{cudf::type_to_id<TypeParam>()}, 4, cudf::mask_state::UNINITIALIZED);
+  auto out_view = out->mutable_view();
+  cudf::unary_operation(input, cudf::unary_operator::SQRT, out_view);
+
+  EXPECT_EQ(1, out_view.null_count());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, out_view);
+}
+
 struct UnaryMathOpsErrorTest : public cudf::test::BaseFixture {
 };
 
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/io/csv.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/utilities/metrics.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/mr/device/statistics_resource_adaptor.hpp>
+
+#include <string>
+#include <vector>
+
+struct MetricsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(MetricsTest, OneCallbackPerOperation)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col0({3, 1, 2});
+  std::vector<cudf::metrics::operation_metrics> recorded;
+  {
+    cudf::metrics::scope metrics{[&](auto const& m) { recorded.push_back(m); }};
+    // the public `sort` calls the detail `sort`, which opens a range of its own
+    cudf::sort(cudf::table_view{{col0}});
+  }
+  ASSERT_EQ(recorded.size(), 1u);
+  EXPECT_EQ(std::string{recorded.front().name}, "sort");
+  EXPECT_GE(recorded.front().elapsed_ms, 0);
+
+  cudf::sort(cudf::table_view{{col0}});
+  EXPECT_EQ(recorded.size(), 1u);
+}
+
+TEST_F(MetricsTest, AllocatedBytes)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col0({3, 1, 2});
+  auto const upstream = rmm::mr::get_current_device_resource();
+  rmm::mr::statistics_resource_adaptor<rmm::mr::device_memory_resource> stats{upstream};
+
+  std::vector<cudf::metrics::operation_metrics> recorded;
+  cudf::metrics::scope metrics{[&](auto const& m) { recorded.push_back(m); }};
+  cudf::sort(cudf::table_view{{col0}});
+  ASSERT_EQ(recorded.size(), 1u);
+  EXPECT_EQ(recorded.back().allocated_bytes, -1);
+  EXPECT_EQ(recorded.back().peak_bytes, -1);
+
+  rmm::mr::set_current_device_resource(&stats);
+  cudf::sort(cudf::table_view{{col0}});
+  rmm::mr::set_current_device_resource(upstream);
+  ASSERT_EQ(recorded.size(), 2u);
+  EXPECT_GE(recorded.back().allocated_bytes, 3 * static_cast<int64_t>(sizeof(int32_t)));
+  EXPECT_GE(recorded.back().peak_bytes, 3 * static_cast<int64_t>(sizeof(int32_t)));
+}
+
+TEST_F(MetricsTest, BytesProcessed)
+{
+  std::string const csv = "1,2\n3,4\n5,6\n";
+  std::vector<cudf::metrics::operation_metrics> recorded;
+  cudf::metrics::scope metrics{[&](auto const& m) { recorded.push_back(m); }};
+  auto const options =
+    cudf::io::csv_reader_options::builder(cudf::io::source_info{csv.c_str(), csv.size()})
+      .header(-1)
+      .build();
+  cudf::io::read_csv(options);
+  ASSERT_EQ(recorded.size(), 1u);
+  EXPECT_GE(recorded.front().bytes_processed, static_cast<int64_t>(csv.size()));
+}
+
+TEST_F(MetricsTest, StageRange)
+{
+  std::vector<cudf::metrics::operation_metrics> recorded;
+  {
+    cudf::metrics::scope metrics{[&](auto const& m) { recorded.push_back(m); }};
+    // The number of rows, when known, is appended to the name of the stage
+    cudf::stage_range const decode{"parquet::decode", 1024, 100};
+    EXPECT_EQ(decode.message(), "parquet::decode (100 rows)");
+    cudf::stage_range const footer{"parquet::read_footer", -1};
+    EXPECT_EQ(footer.message(), "parquet::read_footer");
+  }
+  // Stage ranges outside of a function range are not operations of their own
+  EXPECT_TRUE(recorded.empty());
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/filling.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/spill.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/cuda_memory_resource.hpp>
+#include <rmm/mr/device/limiting_resource_adaptor.hpp>
+
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+struct SpillTest : public cudf::test::BaseFixture {
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{{1, 2, 3, 4}, {true, false, true, true}};
+  cudf::test::strings_column_wrapper strings{"a", "", "ccc", "dd"};
+  cudf::table_view input{{ints, strings}};
+};
+
+TEST_F(SpillTest, SpillToHost)
+{
+  cudf::spill_manager manager;
+  cudf::spillable_table table{input, manager};
+  EXPECT_FALSE(table.is_spilled());
+
+  EXPECT_EQ(manager.spill(1), table.size());
+  EXPECT_TRUE(table.is_spilled());
+  EXPECT_EQ(manager.spilled_bytes(), table.size());
+
+  auto const locked = table.lock();
+  EXPECT_FALSE(table.is_spilled());
+  EXPECT_EQ(manager.spilled_bytes(), 0u);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, locked.view());
+}
+
+TEST_F(SpillTest, SpillToDisk)
+{
+  cudf::spill_manager manager{cudf::spill_target::DISK, temp_env->get_temp_dir()};
+  cudf::spillable_table table{input, manager};
+
+  EXPECT_EQ(manager.spill(1), table.size());
+  EXPECT_TRUE(table.is_spilled());
+
+  auto const locked = table.lock();
+  EXPECT_FALSE(table.is_spilled());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, locked.view());
+}
+
+TEST_F(SpillTest, LockedTableIsNotSpilled)
+{
+  cudf::spill_manager manager;
+  cudf::spillable_table table{input, manager};
+  {
+    auto const locked = table.lock();
+    EXPECT_EQ(manager.spill(table.size()), 0u);
+    EXPECT_FALSE(table.is_spilled());
+  }
+  EXPECT_EQ(manager.spill(table.size()), table.size());
+  EXPECT_TRUE(table.is_spilled());
+}
+
+TEST_F(SpillTest, LeastRecentlyLockedIsSpilledFirst)
+{
+  cudf::spill_manager manager;
+  cudf::spillable_table first{input, manager};
+  cudf::spillable_table second{input, manager};
+  first.lock();
+
+  EXPECT_EQ(manager.spill(1), second.size());
+  EXPECT_FALSE(first.is_spilled());
+  EXPECT_TRUE(second.is_spilled());
+}
+
+TEST_F(SpillTest, AllocationFailureSpills)
+{
+  auto const num_rows = cudf::size_type{1} << 20;  // 4 MiB of INT32
+  auto const column   = cudf::sequence(num_rows, cudf::numeric_scalar<int32_t>(0));
+  cudf::table_view const large_input{{column->view()}};
+
+  rmm::mr::cuda_memory_resource cuda_mr;
+  rmm::mr::limiting_resource_adaptor<rmm::mr::cuda_memory_resource> limited{&cuda_mr, 6 << 20};
+  cudf::spill_manager manager;
+  cudf::spilling_resource_adaptor mr{&limited, manager};
+
+  cudf::spillable_table table{large_input, manager, &mr};
+  EXPECT_FALSE(table.is_spilled());
+  {
+    // does not fit next to the table
+    rmm::device_buffer buffer(4 << 20, rmm::cuda_stream_default, &mr);
+    EXPECT_TRUE(table.is_spilled());
+    EXPECT_THROW(table.lock(), rmm::bad_alloc);
+  }
+  auto const locked = table.lock();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(large_input, locked.view());
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/concatenate.hpp>
+#include <cudf/detail/utilities/stream_pool.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/stream_pool.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <vector>
+
+struct StreamPoolTest : public cudf::test::BaseFixture {
+  void SetUp() override { initial_size = cudf::get_stream_pool_size(); }
+  void TearDown() override { cudf::set_stream_pool_size(initial_size); }
+
+  std::size_t initial_size;
+};
+
+TEST_F(StreamPoolTest, SetSize)
+{
+  cudf::set_stream_pool_size(3);
+  EXPECT_EQ(cudf::get_stream_pool_size(), 3u);
+  EXPECT_THROW(cudf::set_stream_pool_size(0), cudf::logic_error);
+  EXPECT_EQ(cudf::get_stream_pool_size(), 3u);
+}
+
+TEST_F(StreamPoolTest, ForkIsClampedToPoolSize)
+{
+  auto const stream = rmm::cuda_stream_default;
+  cudf::set_stream_pool_size(4);
+  auto const streams = cudf::detail::fork_streams(stream, 10);
+  EXPECT_EQ(streams.size(), 4u);
+  cudf::detail::join_streams(streams, stream);
+
+  auto const single = cudf::detail::fork_streams(stream, 1);
+  ASSERT_EQ(single.size(), 1u);
+  EXPECT_EQ(single.front().value(), stream.value());
+}
+
+TEST_F(StreamPoolTest, SingleStreamPool)
+{
+  auto const stream = rmm::cuda_stream_default;
+  cudf::set_stream_pool_size(1);
+  auto const streams = cudf::detail::fork_streams(stream, 10);
+  ASSERT_EQ(streams.size(), 1u);
+  EXPECT_EQ(streams.front().value(), stream.value());
+  cudf::detail::join_streams(streams, stream);
+}
+
+TEST_F(StreamPoolTest, ConcatenateTablesWithAnyPoolSize)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a0{1, 2, 3};
+  cudf::test::strings_column_wrapper b0{"a", "bb", "ccc"};
+  cudf::test::fixed_width_column_wrapper<int32_t> a1{{4, 5}, {true, false}};
+  cudf::test::strings_column_wrapper b1{"dddd", "e"};
+  std::vector<cudf::table_view> const tables{cudf::table_view{{a0, b0}},
+                                             cudf::table_view{{a1, b1}}};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_a{{1, 2, 3, 4, 5},
+                                                             {true, true, true, true, false}};
+  cudf::test::strings_column_wrapper expected_b{"a", "bb", "ccc", "dddd", "e"};
+  cudf::table_view const expected{{expected_a, expected_b}};
+
+  for (std::size_t size : {1, 2, 16}) {
+    cudf::set_stream_pool_size(size);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, cudf::concatenate(tables)->view());
+  }
+}
@@ -44,7 +44,13 @@ public enum CompressionType {
   ZIP(6),
 
   /** XZ format using LZMA(2) algorithm */
-  XZ(7);
+  XZ(7),
+
+  /** ZLIB format using DEFLATE algorithm */
+  ZLIB(8),
+
+  /** ZSTD format using LZ77 + Huffman + FSE entropy coding */
+  ZSTD(9);
 
   final int nativeId;
 
@@ -26,7 +26,9 @@ public enum HashType {
   MURMUR3(1),
   HASH_MD5(2),
   HASH_SERIAL_MURMUR3(3),
-  HASH_SPARK_MURMUR3(4);
+  HASH_SPARK_MURMUR3(4),
+  HASH_XXHASH64(5),
+  HASH_MURMUR3_64(6);
 
   private static final HashType[] HASH_TYPES = HashType.values();
   final int nativeId;
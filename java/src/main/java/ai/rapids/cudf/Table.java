@@ -2172,8 +2172,10 @@ public final class Table implements AutoCloseable {
    * padding will slow down the transfer and looking at only a handful of buffers is not likely to
    * cause cache issues.
    * <p/>
-   * There are some limits on the size of a single row.  If the row is larger than 1KB this will
-   * throw an exception.
+   * A STRING column takes 8 bytes aligned to 4 bytes in the fixed width part of the row: the
+   * 32-bit offset of its characters from the start of the row, followed by their 32-bit length.
+   * The characters of the strings of a row follow its validity bytes in column order, and the row
+   * is padded again to a 64-bit boundary, so rows with strings vary in size.
    */
   public ColumnVector[] convertToRows() {
     long[] ptrs = convertToRows(nativeHandle);
@@ -1,4 +1,4 @@
-# Copyright (c) 2020, NVIDIA CORPORATION.
+# Copyright (c) 2020-2021, NVIDIA CORPORATION.
 
 from cudf._lib.cpp.io.avro cimport (
     avro_reader_options,
@@ -11,7 +11,7 @@ from libcpp.utility cimport move
 
 from cudf._lib.cpp.io.types cimport table_with_metadata
 from cudf._lib.cpp.types cimport size_type
-from cudf._lib.io.utils cimport make_source_info
+from cudf._lib.io.utils cimport make_source_info, update_struct_field_names
 from cudf._lib.table cimport Table
 
 
@@ -53,4 +53,8 @@ cpdef read_avro(datasource, columns=None, skip_rows=-1, num_rows=-1):
 
     names = [name.decode() for name in c_result.metadata.column_names]
 
-    return Table.from_unique_ptr(move(c_result.tbl), column_names=names)
+    tbl = Table.from_unique_ptr(move(c_result.tbl), column_names=names)
+
+    update_struct_field_names(tbl, c_result.metadata.schema_info)
+
+    return tbl
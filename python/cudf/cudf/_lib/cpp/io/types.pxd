@@ -29,6 +29,8 @@ cdef extern from "cudf/io/types.hpp" \
         BROTLI "cudf::io::compression_type::BROTLI"
         ZIP "cudf::io::compression_type::ZIP"
         XZ "cudf::io::compression_type::XZ"
+        ZLIB "cudf::io::compression_type::ZLIB"
+        ZSTD "cudf::io::compression_type::ZSTD"
 
     ctypedef enum io_type:
         FILEPATH "cudf::io::io_type::FILEPATH"
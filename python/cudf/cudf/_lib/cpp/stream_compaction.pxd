@@ -1,4 +1,4 @@
-# Copyright (c) 2020, NVIDIA CORPORATION.
+# Copyright (c) 2020-2021, NVIDIA CORPORATION.
 
 from libcpp.memory cimport unique_ptr
 from libcpp.vector cimport vector
@@ -20,6 +20,7 @@ cdef extern from "cudf/stream_compaction.hpp" namespace "cudf" \
         KEEP_FIRST 'cudf::duplicate_keep_option::KEEP_FIRST'
         KEEP_LAST 'cudf::duplicate_keep_option::KEEP_LAST'
         KEEP_NONE 'cudf::duplicate_keep_option::KEEP_NONE'
+        KEEP_ANY 'cudf::duplicate_keep_option::KEEP_ANY'
 
     cdef unique_ptr[table] drop_nulls(table_view source_table,
                                       vector[size_type] keys,
@@ -86,6 +86,8 @@ cdef extern from "cudf/types.hpp" namespace "cudf" nogil:
         HASH_MD5 "cudf::hash_id::HASH_MD5"
         HASH_SERIAL_MURMUR3 "cudf::hash_id::HASH_SERIAL_MURMUR3"
         HASH_SPARK_MURMUR3 "cudf::hash_id::HASH_SPARK_MURMUR3"
+        HASH_XXHASH64 "cudf::hash_id::HASH_XXHASH64"
+        HASH_MURMUR3_64 "cudf::hash_id::HASH_MURMUR3_64"
 
     cdef cppclass data_type:
         data_type() except +
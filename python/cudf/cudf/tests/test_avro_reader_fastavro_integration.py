@@ -13,6 +13,8 @@
 # limitations under the License.
 
 import io
+import random
+import string
 
 import fastavro
 import pytest
@@ -96,16 +98,16 @@ def test_can_detect_dtype_from_avro_type_nested(
 
     actual = cudf_from_avro_util(schema_root, [])
 
-    col_name = "{ns}child.{ns}leaf.prop3".format(
-        ns="" if namespace is None else namespace + "."
+    # Nested records are read as struct columns
+    assert list(actual.columns) == ["prop1"]
+    assert len(actual) == 0
+    prop2_dtype = actual["prop1"].dtype.fields["prop2"]
+    assert list(prop2_dtype.fields) == ["prop3"]
+    assert (
+        prop2_dtype.fields["prop3"]
+        == cudf.Series(None, None, expected_dtype).dtype
     )
 
-    expected = cudf.DataFrame(
-        {col_name: cudf.Series(None, None, expected_dtype)}
-    )
-
-    assert_eq(expected, actual)
-
 
 @pytest.mark.parametrize(
     "avro_type, cudf_type, avro_val, cudf_val",
@@ -207,3 +209,146 @@ def test_can_parse_no_schema():
     actual = cudf_from_avro_util(schema_root, records)
     expected = cudf.DataFrame()
     assert_eq(expected, actual)
+
+
+@pytest.mark.parametrize("codec", ["deflate", "snappy"])
+def test_can_parse_compressed_blocks(codec):
+    if codec == "snappy":
+        pytest.importorskip("snappy")
+
+    schema = fastavro.parse_schema(
+        {
+            "name": "root",
+            "type": "record",
+            "fields": [{"name": "prop", "type": ["null", "string"]}],
+        }
+    )
+
+    # Blocks of repeated characters compress far better than blocks of
+    # random text, so only some of the blocks outgrow the initial guess of
+    # their decompressed size
+    rng = random.Random(0)
+    values = []
+    for i in range(40):
+        if i % 5 == 0:
+            values.append("x" * 100000)
+        elif i % 7 == 0:
+            values.append(None)
+        else:
+            values.append(
+                "".join(
+                    rng.choice(string.ascii_letters) for _ in range(5000)
+                )
+            )
+
+    buffer = io.BytesIO()
+    fastavro.writer(
+        buffer,
+        schema,
+        [{"prop": value} for value in values],
+        codec=codec,
+        sync_interval=1,
+    )
+    buffer.seek(0)
+    actual = cudf.read_avro(buffer)
+
+    expected = cudf.DataFrame({"prop": cudf.Series(values, dtype="str")})
+
+    assert_eq(expected, actual)
+
+
+def assert_columns_equal_to_pylist(expected, actual):
+    assert list(actual.columns) == list(expected)
+    for name, values in expected.items():
+        assert actual[name].to_arrow().to_pylist() == values
+
+
+def test_read_nested_record_followed_by_siblings(datadir):
+    actual = cudf.read_avro(datadir / "avro" / "nested_record.avro")
+
+    expected = {
+        "id": list(range(7)),
+        "info": [
+            {"name": f"n{i}", "inner": {"x": i * 100}, "score": i * 0.5}
+            for i in range(7)
+        ],
+        "flag": [i % 2 == 0 for i in range(7)],
+        "after": [f"a{i}" for i in range(7)],
+    }
+
+    assert_columns_equal_to_pylist(expected, actual)
+
+
+def test_read_array_of_records(datadir):
+    actual = cudf.read_avro(datadir / "avro" / "array_of_records.avro")
+
+    expected = {
+        "id": [0, 1, 2, 3, 4],
+        "items": [
+            [{"a": 1, "b": "x"}, {"a": 2, "b": "yy"}],
+            [],
+            [{"a": 3, "b": ""}],
+            [
+                {"a": 4, "b": "z"},
+                {"a": 5, "b": "zz"},
+                {"a": 6, "b": "zzz"},
+                {"a": 7, "b": "w"},
+            ],
+            [{"a": 8, "b": "v"}],
+        ],
+        "after": [10, 11, 12, 13, 14],
+    }
+
+    assert_columns_equal_to_pylist(expected, actual)
+
+
+def test_read_map(datadir):
+    actual = cudf.read_avro(datadir / "avro" / "map.avro")
+
+    # Maps are lists of key-value structs
+    expected = {
+        "id": [0, 1, 2, 3],
+        "attrs": [
+            [{"key": "a", "value": 1}, {"key": "b", "value": 2}],
+            [],
+            [{"key": "c", "value": 3}],
+            [
+                {"key": "d", "value": 4},
+                {"key": "e", "value": 5},
+                {"key": "f", "value": 6},
+            ],
+        ],
+        "after": ["p", "q", "r", "s"],
+    }
+
+    assert_columns_equal_to_pylist(expected, actual)
+
+
+def test_read_nullable_unions_in_nested_types(datadir):
+    actual = cudf.read_avro(datadir / "avro" / "nested_nullable.avro")
+
+    expected = {
+        "id": [0, 1, 2, 3],
+        "rec": [
+            {"x": 1, "y": "a"},
+            None,
+            {"x": None, "y": "b"},
+            {"x": 3, "y": ""},
+        ],
+        "arr": [["p", None], [], [None, None, "q"], ["r"]],
+        "attrs": [
+            [{"key": "k", "value": 1.5}],
+            None,
+            [{"key": "k", "value": None}, {"key": "l", "value": 2.5}],
+            [],
+        ],
+        "after": [7, None, 9, 10],
+    }
+
+    assert_columns_equal_to_pylist(expected, actual)
+
+    # Selecting a column after the nested ones skips their data
+    after = cudf.read_avro(
+        datadir / "avro" / "nested_nullable.avro", columns=["after"]
+    )
+    assert_columns_equal_to_pylist({"after": [7, None, 9, 10]}, after)
@@ -603,6 +603,99 @@ def test_parquet_reader_mixedcompression(datadir):
     assert_eq(expect, got)
 
 
+# Values of the columns of the delta encoded files in the data directory. The
+# integers have negative deltas and miniblocks of up to 59 bits. The strings
+# share prefixes across miniblocks, and include nulls and empty strings.
+def _delta_int32_value(i):
+    if i % 7 == 3:
+        return None
+    return ((i * i * 37) % 100003 - 50000) * (1000 if i % 5 == 0 else 1)
+
+
+def _delta_int64_value(i):
+    return (i * 1000003) ** 2 * (-1) ** i + (1 << 40) * (i % 3)
+
+
+def _delta_string_value(i):
+    if i % 11 == 3:
+        return None
+    if i % 13 == 5:
+        return ""
+    if i % 17 == 9:
+        return "x" * 40 + str(i)
+    return "group%02d_item%03d" % (i // 20, i)
+
+
+def test_parquet_reader_delta_binary_packed(datadir):
+    # Pages of 200, 100 and 1 rows; the miniblocks of the last block of a
+    # page are partially filled
+    fname = datadir / "delta_binary_packed.parquet"
+
+    expect = cudf.DataFrame(
+        {
+            "int32": cudf.Series(
+                [_delta_int32_value(i) for i in range(301)], dtype="int32"
+            ),
+            "int64": cudf.Series(
+                [_delta_int64_value(i) for i in range(301)], dtype="int64"
+            ),
+        }
+    )
+    got = cudf.read_parquet(fname)
+
+    assert_eq(expect, got)
+
+
+def test_parquet_reader_delta_byte_array(datadir):
+    # DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY columns of the same values,
+    # in pages of 100 and 50 rows
+    fname = datadir / "delta_byte_array.parquet"
+
+    values = [_delta_string_value(i) for i in range(150)]
+    expect = cudf.DataFrame(
+        {
+            "delta_length": cudf.Series(values, dtype="str"),
+            "delta": cudf.Series(values, dtype="str"),
+        }
+    )
+    got = cudf.read_parquet(fname)
+
+    assert_eq(expect, got)
+
+
+def test_parquet_reader_data_page_v2(datadir):
+    # Uncompressed V2 data pages of 100 and 50 rows
+    fname = datadir / "data_page_v2.parquet"
+
+    expect = cudf.DataFrame(
+        {
+            "plain": cudf.Series(
+                [_delta_int32_value(i) for i in range(150)], dtype="int32"
+            ),
+            "delta_binary_packed": cudf.Series(
+                [
+                    None if i % 11 == 3 else _delta_int64_value(i)
+                    for i in range(150)
+                ],
+                dtype="int64",
+            ),
+            "delta_length": cudf.Series(
+                [_delta_string_value(i) or "" for i in range(150)], dtype="str"
+            ),
+            "delta": cudf.Series(
+                [_delta_string_value(i) for i in range(150)], dtype="str"
+            ),
+        }
+    )
+    got = cudf.read_parquet(fname)
+
+    assert_eq(expect, got)
+
+    got = cudf.read_parquet(fname, columns=["delta"], skiprows=90, num_rows=20)
+
+    assert_eq(expect[["delta"]][90:110].reset_index(drop=True), got)
+
+
 def test_parquet_reader_select_columns(datadir):
     fname = datadir / "nested_column_map.parquet"
 